@@ -127,6 +127,7 @@ private:
   GravityForce,             /*!< \brief Flag to know if the gravity force is incuded in the formulation. */
   SmoothNumGrid,            /*!< \brief Smooth the numerical grid. */
   AdaptBoundary,            /*!< \brief Adapt the elements on the boundary. */
+  ParallelAdaptation,       /*!< \brief Refine the partitioned grid in parallel. */
   SubsonicEngine,           /*!< \brief Engine intake subsonic region. */
   Frozen_Visc_Cont,         /*!< \brief Flag for cont. adjoint problem with/without frozen viscosity. */
   Frozen_Visc_Disc,         /*!< \brief Flag for disc. adjoint problem with/without frozen viscosity. */
@@ -161,6 +162,10 @@ private:
   su2double **DV_Value;              /*!< \brief Previous value of the design variable. */
   su2double Venkat_LimiterCoeff;     /*!< \brief Limiter coefficient */
   unsigned long LimiterIter;         /*!< \brief Freeze the value of the limiter after a number of iterations */
+  bool LimiterFreeze;                /*!< \brief Freeze the limiter once the residual is below a threshold. */
+  su2double *LimiterFreezeParam;     /*!< \brief Residual threshold, frequency of full evaluations, and solution change tolerance. */
+  bool ActiveSet;                    /*!< \brief Skip the edges of converged regions (frozen points). */
+  su2double *ActiveSetParam;         /*!< \brief Residual fraction, iterations before freezing, and frequency of full sweeps. */
   su2double AdjSharp_LimiterCoeff;   /*!< \brief Coefficient to identify the limit of a sharp edge. */
   unsigned short SystemMeasurements; /*!< \brief System of measurements. */
   unsigned short Kind_Regime;        /*!< \brief Kind of adjoint function. */
@@ -171,6 +176,7 @@ private:
   unsigned short Discrete_Eqns;      /*!< \brief Which equations to treat discretely (Hybrid adjoint). */
   unsigned short *Design_Variable;   /*!< \brief Kind of design variable. */
   unsigned short Kind_Adaptation;    /*!< \brief Kind of numerical grid adaptation. */
+  unsigned short nAdapt_Cycles;      /*!< \brief Number of in-process adaptation cycles of SU2_CFD. */
   unsigned short nTimeInstances;     /*!< \brief Number of periodic time instances for  harmonic balance. */
   su2double HarmonicBalance_Period;  /*!< \brief Period of oscillation to be used with harmonic balance computations. */
   su2double New_Elem_Adapt;          /*!< \brief Elements to adapt in the numerical grid adaptation process. */
@@ -397,6 +403,8 @@ private:
   unsigned long InnerIter;          /*!< \brief Current inner iterations for multizone problems. */
   unsigned long TimeIter;           /*!< \brief Current time iterations for multizone problems. */
   unsigned long Unst_nIntIter;      /*!< \brief Number of internal iterations (Dual time Method). */
+  unsigned short TimePredictor_Order; /*!< \brief Order of the extrapolation of the initial guess of each time step (Dual time Method). */
+  bool TimePredictor_LowPrec;       /*!< \brief Store the extra time level of the predictor in single precision. */
   unsigned long Dyn_nIntIter;       /*!< \brief Number of internal iterations (Newton-Raphson Method for nonlinear structural analysis). */
   long Unst_RestartIter;            /*!< \brief Iteration number to restart an unsteady simulation (Dual time Method). */
   long Unst_AdjointIter;            /*!< \brief Iteration number to begin the reverse time integration in the direct solver for the unsteady adjoint. */
@@ -412,8 +420,12 @@ private:
   su2double *WeightsIntegrationADER_DG;     /*!< \brief The weights of the ADER-DG time integration points on the interval [-1,1]. */
   unsigned short nRKStep;                   /*!< \brief Number of steps of the explicit Runge-Kutta method. */
   su2double *RK_Alpha_Step;                 /*!< \brief Runge-Kutta beta coefficients. */
+  unsigned short ResSmoothing_Iter;         /*!< \brief Number of Jacobi sweeps of the implicit residual smoothing (explicit schemes). */
+  su2double ResSmoothing_Coeff;             /*!< \brief Coefficient of the implicit residual smoothing. */
 
   unsigned short nMGLevels;    /*!< \brief Number of multigrid levels (coarse levels). */
+  unsigned short Kind_MG_Agglomeration; /*!< \brief Agglomeration algorithm of the multigrid levels. */
+  bool MG_Agglomeration_Cache;          /*!< \brief Read the agglomeration of the multigrid levels from (or write it to) per-rank cache files. */
   unsigned short nCFL;         /*!< \brief Number of CFL, one for each multigrid level. */
   su2double
   CFLRedCoeff_Turb,            /*!< \brief CFL reduction coefficient on the LevelSet problem. */
@@ -443,6 +455,7 @@ private:
   string *TagFFDBox;                  /*!< \brief Tag of the FFD box. */
   unsigned short GeometryMode;        /*!< \brief Gemoetry mode (analysis or gradient computation). */
   unsigned short MGCycle;             /*!< \brief Kind of multigrid cycle. */
+  bool MG_Turbulence;                 /*!< \brief Solve the turbulence equations with the multigrid cycle of the mean flow. */
   unsigned short FinestMesh;          /*!< \brief Finest mesh for the full multigrid approach. */
   unsigned short nFFD_Fix_IDir,
   nFFD_Fix_JDir, nFFD_Fix_KDir;       /*!< \brief Number of planes fixed in the FFD. */
@@ -460,6 +473,8 @@ private:
   unsigned short Kind_Solver,      /*!< \brief Kind of solver Euler, NS, Continuous adjoint, etc.  */
   Kind_MZSolver,                   /*!< \brief Kind of multizone solver.  */
   Kind_FluidModel,                 /*!< \brief Kind of the Fluid Model: Ideal or Van der Walls, ... . */
+  Kind_TabulatedFluidModel,        /*!< \brief Fluid model from which the table of TABULATED_GAS is generated. */
+  TabulatedGas_Size[2],            /*!< \brief Number of density and energy nodes of the table of TABULATED_GAS. */
   Kind_ViscosityModel,             /*!< \brief Kind of the Viscosity Model*/
   Kind_ConductivityModel,          /*!< \brief Kind of the Thermal Conductivity Model*/
   Kind_ConductivityModel_Turb,     /*!< \brief Kind of the Turbulent Thermal Conductivity Model*/
@@ -529,6 +544,15 @@ private:
   Kind_Solver_Struc_FSI,        /*!< \brief Kind of solver for the structure in FSI applications. */
   Kind_BGS_RelaxMethod,         /*!< \brief Kind of relaxation method for Block Gauss Seidel method in FSI problems. */
   Kind_CHT_Coupling;            /*!< \brief Kind of coupling method used at CHT interfaces. */
+  bool DiscAdj_Krylov;                   /*!< \brief Accelerate the fixed-point discrete adjoint iterations with FGMRES. */
+  unsigned short DiscAdj_Krylov_Size;    /*!< \brief Krylov subspace size (tape evaluations) per adjoint iteration. */
+  su2double DiscAdj_Krylov_Error;        /*!< \brief Residual reduction of the Krylov cycle of each adjoint iteration. */
+  unsigned short nQuasiNewtonSamples;    /*!< \brief Number of previous iterations of the quasi-Newton acceleration of the fixed points. */
+  bool DiscAdj_Separate_Objectives;      /*!< \brief Converge the adjoint of each objective function separately (vector reverse mode). */
+  bool DiscAdj_Combined_Recording;      /*!< \brief Record the state and geometric inputs on one tape (no secondary recording). */
+  unsigned short DiscAdj_Checkpoints;      /*!< \brief Number of checkpoints of the primal solution for the unsteady discrete adjoint. */
+  unsigned short DiscAdj_Checkpoints_Disk; /*!< \brief Number of those checkpoints that are written to disk. */
+  string DiscAdj_Checkpoints_Folder;       /*!< \brief Folder of the checkpoints that are written to disk. */
   bool ReconstructionGradientRequired; /*!< \brief Enable or disable a second gradient calculation for upwind reconstruction only. */
   bool LeastSquaresRequired;    /*!< \brief Enable or disable memory allocation for least-squares gradient methods. */
   bool Energy_Equation;         /*!< \brief Solve the energy equation for incompressible flows. */
@@ -572,14 +596,37 @@ private:
   su2double Linear_Solver_Smoother_Relaxation;   /*!< \brief Relaxation factor for iterative linear smoothers. */
   unsigned long Linear_Solver_Iter;              /*!< \brief Max iterations of the linear solver for the implicit formulation. */
   unsigned long Deform_Linear_Solver_Iter;       /*!< \brief Max iterations of the linear solver for the implicit formulation. */
+  bool Deform_Reuse_Stiffness;                   /*!< \brief Keep the stiffness matrix and preconditioner of the mesh deformation across deformations. */
   unsigned long Linear_Solver_Iter_FSI_Struc;    /*!< \brief Max iterations of the linear solver for FSI applications and structural solver. */
   unsigned long Linear_Solver_Restart_Frequency; /*!< \brief Restart frequency of the linear solver for the implicit formulation. */
   unsigned long Linear_Solver_Prec_Threads;      /*!< \brief Number of threads per rank for ILU and LU_SGS preconditioners. */
   unsigned short Linear_Solver_ILU_n;            /*!< \brief ILU fill=in level. */
+  unsigned short Linear_Solver_Prec_Degree;      /*!< \brief Degree of the polynomial preconditioners. */
+  bool Linear_Solver_ILU_LevelSched;             /*!< \brief Thread-parallelize ILU by level scheduling instead of domain decomposition. */
+  bool Linear_Solver_Device;                     /*!< \brief Solve the linear systems on the offload device (FGMRES with Jacobi). */
+  unsigned long Linear_Solver_Prec_Reuse;        /*!< \brief Maximum number of consecutive linear solves that reuse the preconditioner. */
+  su2double Linear_Solver_Prec_Reuse_Growth;     /*!< \brief Growth of the linear iterations (w.r.t. the last build) that forces a rebuild. */
+  bool Linear_Solver_Adaptive_Error;             /*!< \brief Adapt the tolerance of the linear solver to the convergence of the nonlinear residual. */
+  su2double *Linear_Solver_Adaptive_Param;       /*!< \brief Parameters of the adaptive tolerance (gamma, alpha, min and max tolerance). */
+  bool Jacobian_DiagonalOnly;                    /*!< \brief Only store the diagonal blocks of the finite volume Jacobians. */
+  bool MG_Jacobian_DiagonalOnly;                 /*!< \brief Only store the diagonal blocks of the Jacobians of the coarse multigrid levels. */
+  unsigned short nMG_Linear_Solver_Iter,         /*!< \brief Number of coarse level linear solver iterations found in config file. */
+  nMG_Linear_Solver_Error,                       /*!< \brief Number of coarse level linear solver errors found in config file. */
+  nMG_Linear_Solver_Prec;                        /*!< \brief Number of coarse level linear preconditioners found in config file. */
+  unsigned short *MG_Linear_Solver_Iter;         /*!< \brief Max iterations of the linear solver of each coarse multigrid level. */
+  su2double *MG_Linear_Solver_Error;             /*!< \brief Min error of the linear solver of each coarse multigrid level. */
+  unsigned short *MG_Linear_Solver_Prec;         /*!< \brief Preconditioner of the linear solver of each coarse multigrid level. */
+  unsigned long Linear_Solver_Recycle_Size;      /*!< \brief Size of the subspace recycled by the GCRO_DR linear solver. */
+  bool NewtonKrylov;                             /*!< \brief Use the matrix-free Newton-Krylov method for the flow equations. */
+  unsigned long NewtonKrylov_StartupIter;        /*!< \brief Number of quasi-Newton iterations before starting the Newton-Krylov method. */
+  su2double NewtonKrylov_FinDiffStep;            /*!< \brief Relative step of the finite differences for the matrix-free products. */
+  bool NewtonKrylov_ADJacobian;                  /*!< \brief Assemble the preconditioner of the Newton-Krylov method with forward AD. */
+  bool CoupledTurbulence;                        /*!< \brief Solve the mean flow and turbulence equations as one block system. */
   su2double SemiSpan;                   /*!< \brief Wing Semi span. */
   su2double Roe_Kappa;                  /*!< \brief Relaxation of the Roe scheme. */
   su2double Relaxation_Factor_AdjFlow;  /*!< \brief Relaxation coefficient of the linear solver adjoint mean flow. */
   su2double Relaxation_Factor_CHT;      /*!< \brief Relaxation coefficient for the update of conjugate heat variables. */
+  bool CHT_AitkenRelaxation;            /*!< \brief Use Aitken's dynamic relaxation for the conjugate heat variables. */
   su2double AdjTurb_Linear_Error;       /*!< \brief Min error of the turbulent adjoint linear solver for the implicit formulation. */
   su2double EntropyFix_Coeff;           /*!< \brief Entropy fix coefficient. */
   unsigned short AdjTurb_Linear_Iter;   /*!< \brief Min error of the turbulent adjoint linear solver for the implicit formulation. */
@@ -606,7 +653,12 @@ private:
   Max_Beta_RoeTurkel;               /*!< \brief Maximum value of Beta for the Roe-Turkel low Mach preconditioner. */
   unsigned long GridDef_Nonlinear_Iter;  /*!< \brief Number of nonlinear increments for grid deformation. */
   unsigned short Deform_Stiffness_Type;  /*!< \brief Type of element stiffness imposed for FEA mesh deformation. */
+  unsigned short Kind_Deform_Method;     /*!< \brief Method used for the volume deformation (elasticity or RBF). */
+  su2double Deform_RBF_Radius;           /*!< \brief Support radius of the RBF volume deformation (0 means automatic). */
+  su2double Deform_RBF_Greedy_Tol;       /*!< \brief Relative tolerance of the greedy selection of the RBF control points. */
+  unsigned long Deform_RBF_Max_Points;   /*!< \brief Maximum number of RBF control points. */
   bool Deform_Mesh;                      /*!< \brief Determines whether the mesh will be deformed. */
+  bool Deform_Design;                    /*!< \brief Deform the grid by the design variables in SU2_CFD, in memory. */
   bool Deform_Output;                    /*!< \brief Print the residuals during mesh deformation to the console. */
   su2double Deform_Tol_Factor;       /*!< \brief Factor to multiply smallest volume for deform tolerance (0.001 default) */
   su2double Deform_Coeff;            /*!< \brief Deform coeffienct */
@@ -618,6 +670,7 @@ private:
   bool Visualize_Surface_Def;        /*!< \brief Flag to visualize the surface deformacion in SU2_DEF. */
   bool Visualize_Volume_Def;         /*!< \brief Flag to visualize the volume deformation in SU2_DEF. */
   bool FFD_Symmetry_Plane;           /*!< \brief FFD symmetry plane. */
+  bool FFD_Sparse_Projection;        /*!< \brief Project the sensitivities onto the FFD control points with the sparse basis. */
 
   su2double Mach;             /*!< \brief Mach number. */
   su2double Reynolds;         /*!< \brief Reynolds number. */
@@ -646,6 +699,9 @@ private:
   bool Update_BCThrust_Bool;            /*!< \brief Boolean flag for whether to update the AoA for fixed lift mode on a given iteration. */
   bool Update_AoA;                      /*!< \brief Boolean flag for whether to update the AoA for fixed lift mode on a given iteration. */
   unsigned long Update_AoA_Iter_Limit;  /*!< \brief Limit on number of iterations between AoA updates for fixed lift mode. */
+  bool Fixed_CL_Newton;                 /*!< \brief Newton updates of the AoA with a secant estimate of dCL/dAlpha (fixed lift mode). */
+  unsigned long Fixed_CL_Newton_Iter;   /*!< \brief Number of iterations between Newton updates of the AoA. */
+  unsigned long Fixed_CL_AoA_Ramp;      /*!< \brief Number of iterations over which each AoA change is applied. */
   bool Finite_Difference_Mode;        /*!< \brief Flag to run the finite difference mode in fixed Cl mode. */
   bool Update_HTPIncidence;           /*!< \brief Boolean flag for whether to update the AoA for fixed lift mode on a given iteration. */
   su2double ChargeCoeff;              /*!< \brief Charge coefficient (just for poisson problems). */
@@ -691,6 +747,7 @@ private:
   unsigned short  *Kind_WallFunctions;        /*!< \brief The kind of wall function to use for the corresponding markers. */
   unsigned short  **IntInfo_WallFunctions;    /*!< \brief Additional integer information for the wall function markers. */
   su2double       **DoubleInfo_WallFunctions; /*!< \brief Additional double information for the wall function markers. */
+  unsigned short  WallModel_FreezeStages;     /*!< \brief Number of consecutive residual evaluations for which the wall model data is reused. */
   unsigned short  *Marker_All_Monitoring,     /*!< \brief Global index for monitoring using the grid information. */
   *Marker_All_GeoEval,               /*!< \brief Global index for geometrical evaluation. */
   *Marker_All_Plotting,              /*!< \brief Global index for plotting using the grid information. */
@@ -726,9 +783,21 @@ private:
   unsigned short Analytical_Surface;  /*!< \brief Information about the analytical definition of the surface for grid adaptation. */
   unsigned short Geo_Description;     /*!< \brief Description of the geometry. */
   unsigned short Mesh_FileFormat;     /*!< \brief Mesh input format. */
+  unsigned short Kind_Point_Ordering; /*!< \brief Renumbering of the grid points after partitioning. */
+  bool Partition_Cache;               /*!< \brief Read the partitioned grid from (or write it to) per-rank cache files. */
+  unsigned short Kind_Partition_Weights; /*!< \brief Kind of vertex weights used for the graph partitioning. */
+  unsigned short nMarker_PartitionWeight; /*!< \brief Number of markers with a partitioning weight. */
+  string *Marker_PartitionWeight;     /*!< \brief Markers with a partitioning weight. */
+  su2double *PartitionWeight;         /*!< \brief Work of the points of the marker relative to an interior point. */
+  unsigned long LoadBalancing_Freq;   /*!< \brief Time steps between the checks of the load balance of the ranks (0 never checks). */
+  su2double LoadBalancing_Tol;        /*!< \brief Imbalance of the computation time of the ranks above which the grid is repartitioned. */
+  unsigned short Kind_WallDistance_ADT; /*!< \brief Kind of search tree used for the wall distance. */
+  su2double WallDistance_UpdateTol;   /*!< \brief Relative change of the wall distance below which it is not recomputed for moving grids. */
   unsigned short Tab_FileFormat;      /*!< \brief Format of the output files. */
   unsigned short ActDisk_Jump;        /*!< \brief Format of the output files. */
   unsigned long StartWindowIteration; /*!< \brief Starting Iteration for long time Windowing apporach . */
+  bool Window_Streaming;              /*!< \brief Windowed averages in constant memory, over the entire time domain. */
+  unsigned long Time_Average_Freq;    /*!< \brief Number of time iterations between samples of the time averages. */
   bool CFL_Adapt;        /*!< \brief Adaptive CFL number. */
   bool HB_Precondition;  /*!< \brief Flag to turn on harmonic balance source term preconditioning */
   su2double RefArea,     /*!< \brief Reference area for coefficient computation. */
@@ -752,9 +821,13 @@ private:
   short *Mesh_Box_Size;          /*!< \brief Array containing the number of grid points in the x-, y-, and z-directions for the analytic RECTANGLE and BOX grid formats. */
   su2double* Mesh_Box_Length;    /*!< \brief Array containing the length in the x-, y-, and z-directions for the analytic RECTANGLE and BOX grid formats. */
   su2double* Mesh_Box_Offset;    /*!< \brief Array containing the offset from 0.0 in the x-, y-, and z-directions for the analytic RECTANGLE and BOX grid formats. */
+  su2double* Mesh_Box_Clustering; /*!< \brief Array containing the clustering factors (towards the minimum coordinate) in the x-, y-, and z-directions for the analytic RECTANGLE and BOX grid formats. */
+  unsigned short Kind_Mesh_Box_Elements; /*!< \brief Type of elements of the analytic RECTANGLE and BOX grid formats. */
   string Mesh_FileName,          /*!< \brief Mesh input file. */
   Mesh_Out_FileName,             /*!< \brief Mesh output file. */
+  Partition_Cache_FileName,      /*!< \brief Root name of the per-rank partition cache files. */
   Solution_FileName,             /*!< \brief Flow solution input file. */
+  Solution_Donor_Mesh_FileName,  /*!< \brief Grid of the flow solution input file, if different (interpolated restart). */
   Solution_LinFileName,          /*!< \brief Linearized flow solution input file. */
   Solution_AdjFileName,          /*!< \brief Adjoint solution input file for drag functional. */
   Volume_FileName,               /*!< \brief Flow variables output file. */
@@ -770,7 +843,9 @@ private:
   SurfAdjCoeff_FileName,         /*!< \brief Output file with the adjoint variables on the surface. */
   New_SU2_FileName,              /*!< \brief Output SU2 mesh file converted from CGNS format. */
   SurfSens_FileName,             /*!< \brief Output file for the sensitivity on the surface (discrete adjoint). */
-  VolSens_FileName;              /*!< \brief Output file for the sensitivity in the volume (discrete adjoint). */
+  VolSens_FileName,              /*!< \brief Output file for the sensitivity in the volume (discrete adjoint). */
+  ADIOS2_Engine,                 /*!< \brief ADIOS2 engine of the in-situ output streams. */
+  ADIOS2_Config_FileName;        /*!< \brief ADIOS2 XML runtime configuration of the in-situ output streams. */
 
   bool Wrt_Output,           /*!< \brief Write any output files */
   Wrt_Vol_Sol,               /*!< \brief Write a volume solution file */
@@ -783,14 +858,18 @@ private:
   Wrt_SharpEdges,            /*!< \brief Write residuals to solution file */
   Wrt_Halo,                  /*!< \brief Write rind layers in solution files */
   Wrt_Performance,           /*!< \brief Write the performance summary at the end of a calculation.  */
+  Wrt_Async_Output,          /*!< \brief Sort and write the volume output files on a helper thread. */
   Wrt_AD_Statistics,         /*!< \brief Write the tape statistics (discrete adjoint).  */
   Wrt_MeshQuality,           /*!< \brief Write the mesh quality statistics to the visualization files.  */
+  MeshQuality_Statistics,    /*!< \brief Compute and print the mesh quality statistics of the dual control volumes.  */
   Wrt_Slice,                 /*!< \brief Write 1D slice of a 2D cartesian solution */
   Wrt_Projected_Sensitivity, /*!< \brief Write projected sensitivities (dJ/dx) on surfaces to ASCII file. */
   Plot_Section_Forces;       /*!< \brief Write sectional forces for specified markers. */
   unsigned short
   Console_Output_Verb,  /*!< \brief Level of verbosity for console output */
-  Kind_Average;         /*!< \brief Particular average for the marker analyze. */
+  Kind_Average,         /*!< \brief Particular average for the marker analyze. */
+  HDF5_Compression,     /*!< \brief Deflate level of the chunked HDF5 output files (0 means no compression). */
+  Restart_Compression;  /*!< \brief Compression of the binary restart files (none, lossless, lossy). */
   unsigned short
   nPolyCoeffs;          /*!< \brief Number of coefficients in temperature polynomial fits for fluid models. */
   su2double Gamma,      /*!< \brief Ratio of specific heats of the gas. */
@@ -896,6 +975,8 @@ private:
   su2double AitkenStatRelax;      /*!< \brief Aitken's relaxation factor (if set as static) */
   su2double AitkenDynMaxInit;     /*!< \brief Aitken's maximum dynamic relaxation factor for the first iteration */
   su2double AitkenDynMinInit;     /*!< \brief Aitken's minimum dynamic relaxation factor for the first iteration */
+  unsigned short IQN_ReuseTimeIter; /*!< \brief Number of previous time steps whose IQN-ILS history is reused. */
+  su2double IQN_FilterTol;        /*!< \brief Tolerance of the QR filter that removes linearly dependent IQN-ILS columns. */
   bool RampAndRelease;            /*!< \brief option for ramp load and release */
   bool Sine_Load;                 /*!< \brief option for sine load */
   su2double *SineLoad_Coeff;      /*!< \brief Stores the load coefficient */
@@ -991,10 +1072,17 @@ private:
   unsigned short Kind_RadialBasisFunction;   /*!< \brief type of radial basis function to use for radial basis FSI. */
   bool RadialBasisFunction_PolynomialOption; /*!< \brief Option of whether to include polynomial terms in Radial Basis Function Interpolation or not. */
   su2double RadialBasisFunction_Parameter;   /*!< \brief Radial basis function parameter. */
+  unsigned long RadialBasisFunction_PatchSize; /*!< \brief Number of donor points of the local RBF patches (0 for a global interpolation). */
   bool Prestretch;                           /*!< \brief Read a reference geometry for optimization purposes. */
   string Prestretch_FEMFileName;             /*!< \brief File name for reference geometry. */
   string FEA_FileName;              /*!< \brief File name for element-based properties. */
   bool FEAAdvancedMode;             /*!< \brief Determine if advanced features are used from the element-based FEA analysis (experimental). */
+  bool FEA_MatrixFree;              /*!< \brief Apply the stiffness matrix element by element instead of assembling it. */
+  unsigned long FEA_Tangent_Update_Iter; /*!< \brief Iterations between updates of the frozen tangent (0 once per time step). */
+  su2double FEA_Tangent_Stall_Ratio;     /*!< \brief Residual ratio above which the frozen tangent is updated (0 disabled). */
+  unsigned short QuasiNewton_Memory;     /*!< \brief Number of BFGS updates kept by the quasi-Newton method. */
+  bool QuasiNewton_LineSearch;           /*!< \brief Line search of the quasi-Newton steps. */
+  bool FEA_GradientCache;                /*!< \brief Store the reference gradients of the shape functions of each element. */
   su2double RefGeom_Penalty,        /*!< \brief Penalty weight value for the reference geometry objective function. */
   RefNode_Penalty,                  /*!< \brief Penalty weight value for the reference node objective function. */
   DV_Penalty;                       /*!< \brief Penalty weight to add a constraint to the total amount of stiffness. */
@@ -1003,6 +1091,7 @@ private:
   Nonphys_Reconstr;                 /*!< \brief Current number of non-physical reconstructions for 2nd-order upwinding. */
   bool ParMETIS;                    /*!< \brief Boolean for activating ParMETIS mode (while testing). */
   unsigned short DirectDiff;        /*!< \brief Direct Differentation mode. */
+  unsigned short DirectDiff_Directions; /*!< \brief Number of design variables differentiated per run (vector forward mode). */
   bool DiscreteAdjoint,                  /*!< \brief AD-based discrete adjoint mode. */
   FullTape;                              /*!< \brief Full tape mode for coupled discrete adjoints. */
   unsigned long Wrt_Surf_Freq_DualTime;  /*!< \brief Writing surface solution frequency for Dual Time. */
@@ -1067,6 +1156,9 @@ private:
   default_eng_cyl[7],            /*!< \brief Default engine box array for the COption class. */
   default_eng_val[5],            /*!< \brief Default engine box array values for the COption class. */
   default_cfl_adapt[4],          /*!< \brief Default CFL adapt param array for the COption class. */
+  default_linsol_adapt[4],       /*!< \brief Default adaptive linear solver tolerance param array for the COption class. */
+  default_limiter_freeze[3],     /*!< \brief Default limiter freezing param array for the COption class. */
+  default_active_set[3],         /*!< \brief Default active set param array for the COption class. */
   default_jst_coeff[2],          /*!< \brief Default artificial dissipation (flow) array for the COption class. */
   default_ffd_coeff[3],          /*!< \brief Default artificial dissipation (flow) array for the COption class. */
   default_mixedout_coeff[3],     /*!< \brief Default default mixedout algorithm coefficients for the COption class. */
@@ -1087,7 +1179,11 @@ private:
   default_body_force[3],         /*!< \brief Default body force vector for the COption class. */
   default_nacelle_location[5],   /*!< \brief Location of the nacelle. */
   default_hs_axes[3],            /*!< \brief Default principal axes (x, y, z) of the ellipsoid containing the heat source. */
-  default_hs_center[3];          /*!< \brief Default position of the center of the heat source. */
+  default_hs_center[3],          /*!< \brief Default position of the center of the heat source. */
+  default_tabulated_range[2];    /*!< \brief Default (automatic) ranges of the table of TABULATED_GAS. */
+  su2double *TabulatedGas_DensityRange, /*!< \brief Density range of the table of TABULATED_GAS. */
+  *TabulatedGas_EnergyRange;           /*!< \brief Static energy range of the table of TABULATED_GAS. */
+  string TabulatedGas_FileName;        /*!< \brief File from which the table of TABULATED_GAS is read (or to which it is written). */
 
   unsigned short Riemann_Solver_FEM;         /*!< \brief Riemann solver chosen for the DG method. */
   su2double Quadrature_Factor_Straight;      /*!< \brief Factor applied during quadrature of elements with a constant Jacobian. */
@@ -1099,8 +1195,14 @@ private:
   bool Compute_Entropy;                      /*!< \brief Whether or not to compute the entropy in the fluid model. */
   bool Use_Lumped_MassMatrix_DGFEM;          /*!< \brief Whether or not to use the lumped mass matrix for DGFEM. */
   bool Jacobian_Spatial_Discretization_Only; /*!< \brief Flag to know if only the exact Jacobian of the spatial discretization must be computed. */
+  bool Measure_ElemCost_DGFEM;               /*!< \brief Whether or not to measure the cost of the DG elements and use it for the partitioning of a restart. */
+  string ElemCost_FileName_DGFEM;            /*!< \brief Name of the file with the measured cost of the DG elements. */
+  unsigned long Jacobian_Frequency_DGFEM;    /*!< \brief Number of iterations between the updates of the Jacobian of the implicit DG solver. */
+  bool ElementBlock_Jacobian_DGFEM;          /*!< \brief Only keep the couplings within the elements in the Jacobian of the implicit DG solver. */
+  bool ADER_Predictor_SinglePrecision;       /*!< \brief Store the ADER-DG predictor solution in single precision. */
   bool Compute_Average;                      /*!< \brief Whether or not to compute averages for unsteady simulations in FV or DG solver. */
   unsigned short Comm_Level;                 /*!< \brief Level of MPI communications to be performed. */
+  unsigned short Kind_P2P_Comms;             /*!< \brief Implementation of the point-to-point MPI communications. */
   unsigned short Kind_Verification_Solution; /*!< \brief Verification solution for accuracy assessment. */
 
   ofstream *ConvHistFile;        /*!< \brief Store the pointer to each history file */
@@ -1114,10 +1216,26 @@ private:
   su2double Max_Time;            /*!< \brief Determines the maximum time for the time-domain problems */
 
   unsigned long HistoryWrtFreq[3],    /*!< \brief Array containing history writing frequencies for timer iter, outer iter, inner iter */
+                HistoryFlushFreq,     /*!< \brief Number of history file writes between flushes of the file */
                 ScreenWrtFreq[3];     /*!< \brief Array containing screen writing frequencies for timer iter, outer iter, inner iter */
   unsigned long VolumeWrtFreq;        /*!< \brief Writing frequency for solution files. */
+  bool Wrt_History_Binary;            /*!< \brief Write the history file in binary format */
   unsigned short* VolumeOutputFiles;  /*!< \brief File formats to output */
   unsigned short nVolumeOutputFiles;  /*!< \brief Number of File formats to output */
+  su2double *Output_Probes,           /*!< \brief Coordinates of the output probes */
+  *Output_Probe_Planes,               /*!< \brief Origin, edge vectors and number of samples of the output probe planes */
+  *Output_Probe_Boxes;                /*!< \brief Bounds of the output boxes */
+  unsigned short nOutput_Probes,      /*!< \brief Number of values of OUTPUT_PROBES */
+  nOutput_Probe_Planes,               /*!< \brief Number of values of OUTPUT_PROBE_PLANES */
+  nOutput_Probe_Boxes;                /*!< \brief Number of values of OUTPUT_PROBE_BOXES */
+  unsigned long Output_Probe_Freq;    /*!< \brief Writing frequency of the output probes and boxes */
+  string Output_Probe_FileName;       /*!< \brief Base name of the files of the output probes and boxes */
+  string *Marker_Surface_Sampling,    /*!< \brief Markers whose points are streamed to the surface sampling file */
+  *Surface_Sampling_Fields;           /*!< \brief Volume output groups or fields of the surface sampling */
+  unsigned short nMarker_Surface_Sampling, /*!< \brief Number of markers of the surface sampling */
+  nSurface_Sampling_Fields;           /*!< \brief Number of groups or fields of the surface sampling */
+  unsigned long Surface_Sampling_Freq; /*!< \brief Writing frequency of the surface sampling */
+  string Surface_Sampling_FileName;   /*!< \brief Name of the surface sampling file */
 
   bool Multizone_Mesh;            /*!< \brief Determines if the mesh contains multiple zones. */
   bool SinglezoneDriver;          /*!< \brief Determines if the single-zone driver is used. (TEMPORARY) */
@@ -1129,6 +1247,17 @@ private:
   *HistoryOutput, *VolumeOutput;  /*!< \brief Kind of the output printed to the history file. */
   unsigned short nScreenOutput,   /*!< \brief Number of screen output variables (max: 6). */
   nHistoryOutput, nVolumeOutput;  /*!< \brief Number of variables printed to the history file. */
+  string *Restart_Lossy_Fields;   /*!< \brief Volume output groups or fields with lossy compression in the binary restart files. */
+  unsigned short nRestart_Lossy_Fields;  /*!< \brief Number of groups or fields with lossy compression. */
+  unsigned long *Solution_Iter_List;     /*!< \brief Time iterations of the restart files converted by SU2_SOL in batch mode. */
+  unsigned short nSolution_Iter_List;    /*!< \brief Number of time iterations in SOLUTION_ITER_LIST. */
+  unsigned long *Solution_Iter_Range;    /*!< \brief First and last time iteration, and stride, of the batch conversion of SU2_SOL. */
+  unsigned short nSolution_Iter_Range;   /*!< \brief Number of values of SOLUTION_ITER_RANGE. */
+  vector<unsigned long> Solution_Batch_Iter; /*!< \brief Time iterations of the restart files converted in batch mode (list and range). */
+  su2double Restart_Lossy_Error;  /*!< \brief Absolute error bound of the lossy compression of the restart files. */
+  bool WallTime_Checkpoint;       /*!< \brief Write a restart before the walltime limit and on SIGUSR1/SIGTERM. */
+  su2double WallTime_Limit;       /*!< \brief Walltime limit of the run in seconds (0 to use the scheduler's end time). */
+  su2double WallTime_Margin;      /*!< \brief Time in seconds the restart is written before the walltime limit. */
   bool Multizone_Residual;        /*!< \brief Determines if memory should be allocated for the multizone residual. */
 
   bool using_uq;                /*!< \brief Using uncertainty quantification with SST model */
@@ -1136,14 +1265,34 @@ private:
   unsigned short eig_val_comp;  /*!< \brief Parameter used to determine type of eigenvalue perturbation */
   su2double uq_urlx;            /*!< \brief Under-relaxation factor */
   bool uq_permute;              /*!< \brief Permutation of eigenvectors */
+  bool uq_ensemble;             /*!< \brief Solve all the perturbations at once, as instances of the zone */
 
   unsigned long pastix_fact_freq;  /*!< \brief (Re-)Factorization frequency for PaStiX */
+  unsigned long pastix_fact_time_freq; /*!< \brief (Re-)Factorization frequency for PaStiX, in time steps */
   unsigned short pastix_verb_lvl;  /*!< \brief Verbosity level for PaStiX */
   unsigned short pastix_fill_lvl;  /*!< \brief Fill level for PaStiX ILU */
 
   string caseName;                 /*!< \brief Name of the current case */
 
   unsigned long edgeColorGroupSize; /*!< \brief Size of the edge groups colored for OpenMP parallelization of edge loops. */
+  bool edgeColorAutoTune;           /*!< \brief Choose the size of the edge groups with a quick benchmark. */
+  bool edgeOwnerComputes;           /*!< \brief Owner-computes strategy for the cheap convective schemes. */
+  bool edgeBatchedNumerics;         /*!< \brief Compute the upwind fluxes in batches of edges with vectorized numerics. */
+  bool batchedTurbSources;          /*!< \brief Compute the turbulence source terms in batches of points with vectorized kernels. */
+  bool edgeGeometryCache;           /*!< \brief Store the geometric factors of the edges used by the numerics. */
+  bool leanVariableStorage;         /*!< \brief Allocate the containers of the flow variables only for the features that use them. */
+  bool variableMemoryReport;        /*!< \brief Report the memory of the containers of the flow variables at startup. */
+  bool memoryReport;                /*!< \brief Report the memory by category at the end of the preprocessing and of the run. */
+  bool preprocessingTimingReport;   /*!< \brief Report the time and memory of the phases of the preprocessing. */
+  bool regionProfiling;             /*!< \brief Time the main regions of the iterations. */
+  string regionProfilingFileName;   /*!< \brief Base name of the files of the region profiling. */
+  bool regionProfilingCounters;     /*!< \brief Read hardware counters for the profiled regions. */
+  string regionProfilingFlopEventName; /*!< \brief Raw perf_event code of the FLOP counter, as given. */
+  unsigned long long regionProfilingFlopEvent; /*!< \brief Raw perf_event code of the FLOP counter (0 for none). */
+  bool commProfiling;               /*!< \brief Count the MPI communication and report the load imbalance of the ranks. */
+  bool overlapHaloComms;            /*!< \brief Overlap the halo exchange of gradients and limiters with the edge loop. */
+  bool leastSquaresCache;           /*!< \brief Store the least-squares gradient weights of each neighbor. */
+  bool packedEdgeData;              /*!< \brief Pack the data read by the MUSCL edge loops in one record per point. */
 
   unsigned short Kind_InletInterpolationFunction; /*!brief type of spanwise interpolation function to use for the inlet face. */
   unsigned short Kind_Inlet_InterpolationType;    /*!brief type of spanwise interpolation data to use for the inlet face. */
@@ -1219,6 +1368,8 @@ private:
 
   void addUShortListOption(const string name, unsigned short & size, unsigned short * & option_field);
 
+  void addULongListOption(const string name, unsigned short & size, unsigned long * & option_field);
+
   void addStringListOption(const string name, unsigned short & num_marker, string* & option_field);
 
   void addConvectOption(const string name, unsigned short & space_field, unsigned short & centered_field, unsigned short & upwind_field);
@@ -1339,6 +1490,22 @@ public:
    */
   static unsigned short GetnDim(string val_mesh_filename, unsigned short val_format);
 
+  /*!
+   * \brief Reads the number of zones in the mesh file (called by the master only).
+   * \param[in] val_mesh_filename - Name of the file with the grid information.
+   * \param[in] val_format - Format of the file with the grid information.
+   * \return Total number of zones in the grid file.
+   */
+  static unsigned short ReadnZone(string val_mesh_filename, unsigned short val_format);
+
+  /*!
+   * \brief Reads the number of dimensions in the mesh file (called by the master only).
+   * \param[in] val_mesh_filename - Name of the file with the grid information.
+   * \param[in] val_format - Format of the file with the grid information.
+   * \return Total number of domains in the grid file.
+   */
+  static unsigned short ReadnDim(string val_mesh_filename, unsigned short val_format);
+
   /*!
    * \brief Initializes pointers to null
    */
@@ -1351,7 +1518,7 @@ public:
    * \param[out] option_value - the tokens found after the "=" sign on the line
    * \return false if the line is empty or a commment, true otherwise
    */
-  bool TokenizeString(string & str, string & option_name, vector<string> & option_value);
+  static bool TokenizeString(string & str, string & option_name, vector<string> & option_value);
 
   /*!
    * \brief Get reference origin for moment computation.
@@ -2250,6 +2417,36 @@ public:
    */
   unsigned long GetLimiterIter(void) const { return LimiterIter; }
 
+  /*!
+   * \brief Get whether the limiter is frozen once the residual is below a threshold.
+   * \return <code>TRUE</code> if the limiter is frozen and re-evaluated lazily.
+   */
+  bool GetLimiterFreeze(void) const { return LimiterFreeze; }
+
+  /*!
+   * \brief Get the parameters of the limiter freezing.
+   * \param[in] val_index - 0: log10 of the rms residual (first variable) below which the limiter is frozen,
+   *                        1: frequency (iterations) of the full re-evaluations, 2: relative solution change
+   *                        above which the limiter of a point is re-evaluated (0 disables the partial updates).
+   * \return Value of the parameter.
+   */
+  su2double GetLimiterFreezeParam(unsigned short val_index) const { return LimiterFreezeParam[val_index]; }
+
+  /*!
+   * \brief Get whether the edges between points of converged regions are skipped (active set updates).
+   * \return <code>TRUE</code> if the points with low residual are frozen.
+   */
+  bool GetActiveSet(void) const { return ActiveSet; }
+
+  /*!
+   * \brief Get the parameters of the active set updates.
+   * \param[in] val_index - 0: fraction of the global rms residual (each variable) below which the residual
+   *                        of a point is low, 1: consecutive iterations with low residual before the point is
+   *                        frozen, 2: frequency (iterations) of the full sweeps that re-evaluate all points.
+   * \return Value of the parameter.
+   */
+  su2double GetActiveSetParam(unsigned short val_index) const { return ActiveSetParam[val_index]; }
+
   /*!
    * \brief Get the value of sharp edge limiter.
    * \return Value of the sharp edge limiter coefficient.
@@ -2618,6 +2815,18 @@ public:
    */
   void SetMGLevels(unsigned short val_nMGLevels) { nMGLevels = val_nMGLevels; }
 
+  /*!
+   * \brief Get the agglomeration algorithm of the multigrid levels.
+   * \return Kind of agglomeration (see ENUM_MG_AGGLOMERATION).
+   */
+  unsigned short GetKind_MG_Agglomeration(void) const { return Kind_MG_Agglomeration; }
+
+  /*!
+   * \brief Check if the agglomeration of the multigrid levels is cached.
+   * \return <code>TRUE</code> if the coarse levels are read from (or written to) per-rank cache files.
+   */
+  bool GetMG_Agglomeration_Cache(void) const { return MG_Agglomeration_Cache; }
+
   /*!
    * \brief Get the index of the finest grid.
    * \return Index of the finest grid in a multigrid strategy, this is 0 unless we are
@@ -2632,6 +2841,12 @@ public:
    */
   unsigned short GetMGCycle(void) const { return MGCycle; }
 
+  /*!
+   * \brief Get whether the turbulence equations are solved with the multigrid cycle.
+   * \return <code>TRUE</code> if the turbulence model uses the coarse grids (instead of the finest only).
+   */
+  bool GetMG_Turbulence(void) const { return MG_Turbulence; }
+
   /*!
    * \brief Get the king of evaluation in the geometrical module.
    * \return 0 or 1 depending of we are dealing with a V or W cycle.
@@ -2941,6 +3156,19 @@ public:
    */
   unsigned long GetUnst_nIntIter(void) const { return Unst_nIntIter; }
 
+  /*!
+   * \brief Get the order of the predictor of the flow solution at the start of each physical time step (dual time),
+   *        1 starts from the previous time level, 2 and 3 extrapolate linearly and quadratically.
+   * \return Order of the predictor.
+   */
+  unsigned short GetTimePredictor_Order(void) const { return TimePredictor_Order; }
+
+  /*!
+   * \brief Get whether the extra time level of the quadratic predictor is stored in single precision.
+   * \return <code>TRUE</code> if the level n-2 is stored in single precision.
+   */
+  bool GetTimePredictor_LowPrec(void) const { return TimePredictor_LowPrec; }
+
   /*!
    * \brief Get the number of internal iterations for the Newton-Raphson Method in nonlinear structural applications.
    * \return Number of internal iterations.
@@ -3133,6 +3361,60 @@ public:
    */
   bool GetWrt_Performance(void) const { return Wrt_Performance; }
 
+  /*!
+   * \brief Get information about writing the volume output files asynchronously.
+   * \return <code>TRUE</code> means that the output data is sorted and written by a helper thread while the solver continues.
+   */
+  bool GetWrt_Async_Output(void) const { return Wrt_Async_Output; }
+
+  /*!
+   * \brief Get whether a restart is written before the walltime limit and when SIGUSR1 or SIGTERM is received.
+   */
+  bool GetWallTime_Checkpoint(void) const { return WallTime_Checkpoint; }
+
+  /*!
+   * \brief Get the walltime limit of the run in seconds, 0 to use the end time of the job (SLURM_JOB_END_TIME).
+   */
+  su2double GetWallTime_Limit(void) const { return WallTime_Limit; }
+
+  /*!
+   * \brief Get the time in seconds, before the walltime limit, by which the restart is written.
+   */
+  su2double GetWallTime_Margin(void) const { return WallTime_Margin; }
+
+  /*!
+   * \brief Get the compression level of the HDF5 output files.
+   * \return Deflate level (1 to 9) of the chunked datasets, 0 if they are written uncompressed.
+   */
+  unsigned short GetHDF5_Compression(void) const { return HDF5_Compression; }
+
+  /*!
+   * \brief Get the compression of the binary restart files.
+   * \return NO_COMPRESSION, LOSSLESS_COMPRESSION or LOSSY_COMPRESSION.
+   */
+  unsigned short GetRestart_Compression(void) const { return Restart_Compression; }
+
+  /*!
+   * \brief Get the number of volume output groups or fields with lossy compression in the restart files.
+   */
+  unsigned short GetnRestart_Lossy_Fields(void) const { return nRestart_Lossy_Fields; }
+
+  /*!
+   * \brief Get the volume output group or field iField with lossy compression in the restart files.
+   */
+  string GetRestart_Lossy_Field(unsigned short iField) const { return Restart_Lossy_Fields[iField]; }
+
+  /*!
+   * \brief Get the time iterations of the restart files converted by SU2_SOL in batch mode.
+   * \return The iterations of SOLUTION_ITER_LIST followed by those of SOLUTION_ITER_RANGE, empty if batch mode is off.
+   */
+  const vector<unsigned long>& GetSolution_Batch_Iter(void) const { return Solution_Batch_Iter; }
+
+  /*!
+   * \brief Get the absolute error bound of the lossy compression of the restart files.
+   */
+  su2double GetRestart_Lossy_Error(void) const { return Restart_Lossy_Error; }
+
   /*!
    * \brief Get information about the computational graph (e.g. memory usage) when using AD in reverse mode.
    * \return <code>TRUE</code> means that the tape statistics will be written after each recording.
@@ -3145,6 +3427,12 @@ public:
    */
   bool GetWrt_MeshQuality(void) const { return Wrt_MeshQuality; }
 
+  /*!
+   * \brief Get information about computing the mesh quality statistics during the preprocessing.
+   * \return <code>TRUE</code> means that the statistics are computed (always when they are written).
+   */
+  bool GetMeshQuality_Statistics(void) const { return MeshQuality_Statistics || Wrt_MeshQuality; }
+
   /*!
    * \brief Get information about writing a 1D slice of a 2D cartesian solution.
    * \return <code>TRUE</code> means that a 1D slice of a 2D cartesian solution will be written.
@@ -3176,6 +3464,18 @@ public:
    */
   su2double Get_Alpha_RKStep(unsigned short val_step) const { return RK_Alpha_Step[val_step]; }
 
+  /*!
+   * \brief Get the number of Jacobi sweeps of the implicit residual smoothing of the explicit schemes.
+   * \return Number of sweeps, 0 if the residual is not smoothed.
+   */
+  unsigned short GetResSmoothing_Iter(void) const { return ResSmoothing_Iter; }
+
+  /*!
+   * \brief Get the coefficient of the implicit residual smoothing of the explicit schemes.
+   * \return Smoothing coefficient.
+   */
+  su2double GetResSmoothing_Coeff(void) const { return ResSmoothing_Coeff; }
+
   /*!
    * \brief Get the index of the surface defined in the geometry file.
    * \param[in] val_marker - Value of the marker in which we are interested.
@@ -3693,6 +3993,37 @@ public:
    */
   su2double GetAcentric_Factor(void) const { return Acentric_Factor; }
 
+  /*!
+   * \brief Get the fluid model from which the table of TABULATED_GAS is generated.
+   * \return Kind of the base fluid model.
+   */
+  unsigned short GetKind_TabulatedFluidModel(void) const { return Kind_TabulatedFluidModel; }
+
+  /*!
+   * \brief Get the number of nodes of the table of TABULATED_GAS.
+   * \param[in] iDir - 0 for the density direction, 1 for the static energy direction.
+   * \return Number of nodes in that direction.
+   */
+  unsigned short GetTabulatedGas_Size(unsigned short iDir) const { return TabulatedGas_Size[iDir]; }
+
+  /*!
+   * \brief Get the (dimensional) density range of the table of TABULATED_GAS, 0 for automatic.
+   * \return Pointer to the minimum and maximum density.
+   */
+  const su2double* GetTabulatedGas_DensityRange(void) const { return TabulatedGas_DensityRange; }
+
+  /*!
+   * \brief Get the (dimensional) static energy range of the table of TABULATED_GAS, 0 for automatic.
+   * \return Pointer to the minimum and maximum static energy.
+   */
+  const su2double* GetTabulatedGas_EnergyRange(void) const { return TabulatedGas_EnergyRange; }
+
+  /*!
+   * \brief Get the name of the file of the table of TABULATED_GAS (empty if not used).
+   * \return File name.
+   */
+  string GetTabulatedGas_FileName(void) const { return TabulatedGas_FileName; }
+
   /*!
    * \brief Get the value of the viscosity model.
    * \return Viscosity model.
@@ -3956,12 +4287,127 @@ public:
    */
   unsigned long GetDeform_Linear_Solver_Iter(void) const { return Deform_Linear_Solver_Iter; }
 
+  /*!
+   * \brief Check if the stiffness matrix and preconditioner of the mesh deformation are kept across deformations.
+   * \return <code>TRUE</code> if only the right hand side is rebuilt after the first deformation.
+   */
+  bool GetDeform_Reuse_Stiffness(void) const { return Deform_Reuse_Stiffness; }
+
   /*!
    * \brief Get the ILU fill-in level for the linear solver.
    * \return Fill in level of the ILU preconditioner for the linear solver.
    */
   unsigned short GetLinear_Solver_ILU_n(void) const { return Linear_Solver_ILU_n; }
 
+  /*!
+   * \brief Get the degree of the polynomial preconditioners (NEUMANN, CHEBYSHEV).
+   * \return Number of matrix-vector products per application of the preconditioner.
+   */
+  unsigned short GetLinear_Solver_Prec_Degree(void) const { return Linear_Solver_Prec_Degree; }
+
+  /*!
+   * \brief Get whether the matrix-free Newton-Krylov method is used for the flow equations.
+   */
+  bool GetNewtonKrylov(void) const { return NewtonKrylov; }
+
+  /*!
+   * \brief Get the number of quasi-Newton iterations before the Newton-Krylov method is started.
+   */
+  unsigned long GetNewtonKrylov_StartupIter(void) const { return NewtonKrylov_StartupIter; }
+
+  /*!
+   * \brief Get the relative step used to approximate Jacobian-vector products by finite differences.
+   */
+  su2double GetNewtonKrylov_FinDiffStep(void) const { return NewtonKrylov_FinDiffStep; }
+
+  /*!
+   * \brief Get whether the Jacobian of the Newton-Krylov method is computed with forward AD (graph coloring).
+   */
+  bool GetNewtonKrylov_ADJacobian(void) const { return NewtonKrylov_ADJacobian; }
+
+  /*!
+   * \brief Get whether the mean flow and turbulence equations are solved as one (coupled) implicit system.
+   */
+  bool GetCoupledTurbulence(void) const { return CoupledTurbulence; }
+
+  /*!
+   * \brief Get if the ILU preconditioner is thread-parallelized by level scheduling.
+   * \return <code>TRUE</code> for level scheduling, <code>FALSE</code> for domain decomposition.
+   */
+  bool GetLinear_Solver_ILU_LevelScheduling(void) const { return Linear_Solver_ILU_LevelSched; }
+
+  /*!
+   * \brief Get whether the linear systems are solved on the offload device (e.g. GPU).
+   */
+  bool GetLinear_Solver_Device(void) const { return Linear_Solver_Device; }
+
+  /*!
+   * \brief Get the maximum number of consecutive linear solves that reuse the preconditioner (0 means no reuse).
+   */
+  unsigned long GetLinear_Solver_Prec_Reuse(void) const { return Linear_Solver_Prec_Reuse; }
+
+  /*!
+   * \brief Get the growth factor of the linear solver iterations that forces the preconditioner to be rebuilt.
+   */
+  su2double GetLinear_Solver_Prec_Reuse_Growth(void) const { return Linear_Solver_Prec_Reuse_Growth; }
+
+  /*!
+   * \brief Get whether the tolerance of the linear solver adapts to the convergence of the nonlinear residual.
+   */
+  bool GetLinear_Solver_Adaptive_Error(void) const { return Linear_Solver_Adaptive_Error; }
+
+  /*!
+   * \brief Get the parameters of the adaptive tolerance of the linear solver.
+   * \param[in] val_index - 0 gamma, 1 alpha, 2 minimum tolerance, 3 maximum tolerance.
+   */
+  su2double GetLinear_Solver_Adaptive_Param(unsigned short val_index) const { return Linear_Solver_Adaptive_Param[val_index]; }
+
+  /*!
+   * \brief Get whether only the diagonal blocks of the finite volume Jacobians are stored (point implicit).
+   */
+  bool GetJacobian_DiagonalOnly(void) const { return Jacobian_DiagonalOnly; }
+
+  /*!
+   * \brief Get whether only the diagonal blocks of the finite volume Jacobians of a multigrid level are stored.
+   * \param[in] val_mesh - Multigrid level.
+   */
+  bool GetJacobian_DiagonalOnly(unsigned short val_mesh) const {
+    return Jacobian_DiagonalOnly || ((val_mesh != MESH_0) && MG_Jacobian_DiagonalOnly);
+  }
+
+  /*!
+   * \brief Get the max number of iterations of the linear solver of a multigrid level, the coarse
+   *        levels without a value in MG_LINEAR_SOLVER_ITER use the last one, or LINEAR_SOLVER_ITER.
+   * \param[in] val_mesh - Multigrid level.
+   */
+  unsigned long GetLinear_Solver_Iter(unsigned short val_mesh) const {
+    if ((val_mesh == MESH_0) || (nMG_Linear_Solver_Iter == 0)) return Linear_Solver_Iter;
+    return MG_Linear_Solver_Iter[min(val_mesh, nMG_Linear_Solver_Iter)-1];
+  }
+
+  /*!
+   * \brief Get the min error of the linear solver of a multigrid level (see GetLinear_Solver_Iter).
+   * \param[in] val_mesh - Multigrid level.
+   */
+  su2double GetLinear_Solver_Error(unsigned short val_mesh) const {
+    if ((val_mesh == MESH_0) || (nMG_Linear_Solver_Error == 0)) return Linear_Solver_Error;
+    return MG_Linear_Solver_Error[min(val_mesh, nMG_Linear_Solver_Error)-1];
+  }
+
+  /*!
+   * \brief Get the preconditioner of the linear solver of a multigrid level (see GetLinear_Solver_Iter).
+   * \param[in] val_mesh - Multigrid level.
+   */
+  unsigned short GetKind_Linear_Solver_Prec(unsigned short val_mesh) const {
+    if ((val_mesh == MESH_0) || (nMG_Linear_Solver_Prec == 0)) return Kind_Linear_Solver_Prec;
+    return MG_Linear_Solver_Prec[min(val_mesh, nMG_Linear_Solver_Prec)-1];
+  }
+
+  /*!
+   * \brief Get the size of the subspace recycled across linear solves by GCRO_DR.
+   */
+  unsigned long GetLinear_Solver_Recycle_Size(void) const { return Linear_Solver_Recycle_Size; }
+
   /*!
    * \brief Get restart frequency of the linear solver for the implicit formulation.
    * \return Restart frequency of the linear solver for the implicit formulation.
@@ -3986,6 +4432,12 @@ public:
    */
   su2double GetRelaxation_Factor_CHT(void) const { return Relaxation_Factor_CHT; }
 
+  /*!
+   * \brief Get whether the conjugate heat variables are relaxed with Aitken's dynamic factor.
+   * \return <code>TRUE</code> for dynamic relaxation (the fixed factor is used in the first transfer).
+   */
+  bool GetCHT_AitkenRelaxation(void) const { return CHT_AitkenRelaxation; }
+
   /*!
    * \brief Get the relaxation coefficient of the linear solver for the implicit formulation.
    * \return relaxation coefficient of the linear solver for the implicit formulation.
@@ -4022,6 +4474,63 @@ public:
    */
   unsigned short GetKind_DiscAdj_Linear_Prec(void) const { return Kind_DiscAdj_Linear_Prec; }
 
+  /*!
+   * \brief Get whether the fixed-point iterations of the discrete adjoint are accelerated by FGMRES.
+   * \return <code>TRUE</code> if each adjoint iteration is preceded by a Krylov cycle.
+   */
+  bool GetDiscAdj_Krylov(void) const { return DiscAdj_Krylov; }
+
+  /*!
+   * \brief Get the size of the Krylov subspace (number of tape evaluations) of each adjoint iteration.
+   * \return Size of the subspace.
+   */
+  unsigned short GetDiscAdj_Krylov_Size(void) const { return DiscAdj_Krylov_Size; }
+
+  /*!
+   * \brief Get the relative residual reduction at which the Krylov cycle of an adjoint iteration stops.
+   * \return Residual reduction.
+   */
+  su2double GetDiscAdj_Krylov_Error(void) const { return DiscAdj_Krylov_Error; }
+
+  /*!
+   * \brief Get the number of previous iterations used by the quasi-Newton (Anderson) acceleration of the discrete
+   *        adjoint and block Gauss-Seidel fixed-point iterations.
+   * \return Number of samples (0 if the acceleration is disabled).
+   */
+  unsigned short GetnQuasiNewtonSamples(void) const { return nQuasiNewtonSamples; }
+
+  /*!
+   * \brief Get whether the adjoints of the objective functions are converged separately, one direction of the vector
+   *        reverse mode each, instead of the adjoint of their weighted sum.
+   * \return <code>TRUE</code> if each objective has its own adjoint solution.
+   */
+  bool GetDiscAdj_Separate_Objectives(void) const { return DiscAdj_Separate_Objectives; }
+
+  /*!
+   * \brief Get whether the state and the geometric inputs (mesh coordinates or deformation) are registered on one tape,
+   *        such that the geometric sensitivities are evaluated without recording the secondary tape.
+   * \return <code>TRUE</code> if one combined recording is used.
+   */
+  bool GetDiscAdj_Combined_Recording(void) const { return DiscAdj_Combined_Recording; }
+
+  /*!
+   * \brief Get the number of checkpoints of the primal solution for the unsteady discrete adjoint.
+   * \return Number of checkpoints, 0 if the primal solution is read from restart files.
+   */
+  unsigned short GetDiscAdj_Checkpoints(void) const { return DiscAdj_Checkpoints; }
+
+  /*!
+   * \brief Get the number of checkpoints of the primal solution that are written to disk.
+   * \return Number of checkpoints on disk.
+   */
+  unsigned short GetDiscAdj_Checkpoints_Disk(void) const { return DiscAdj_Checkpoints_Disk; }
+
+  /*!
+   * \brief Get the folder of the checkpoints of the primal solution that are written to disk.
+   * \return Name of the folder.
+   */
+  string GetDiscAdj_Checkpoints_Folder(void) const { return DiscAdj_Checkpoints_Folder; }
+
   /*!
    * \brief Get the kind of preconditioner for the implicit solver.
    * \return Numerical preconditioner for implicit formulation (solving the linear system).
@@ -4070,6 +4579,12 @@ public:
    */
   bool GetDeform_Mesh(void) const { return Deform_Mesh; }
 
+  /*!
+   * \brief Get whether SU2_CFD deforms the grid in memory by the design variables (DV_KIND, DV_VALUE).
+   * \return <code>TRUE</code> if the grid is deformed before the solution.
+   */
+  bool GetDeform_Design(void) const { return Deform_Design; }
+
   /*!
    * \brief Get information about writing grid deformation residuals to the console.
    * \return <code>TRUE</code> means that grid deformation residuals will be written to the console.
@@ -4105,6 +4620,30 @@ public:
    */
   unsigned short GetDeform_Stiffness_Type(void) const { return Deform_Stiffness_Type; }
 
+  /*!
+   * \brief Get the method used for the volume deformation.
+   * \return Method used for the volume deformation (elasticity or RBF).
+   */
+  unsigned short GetKind_Deform_Method(void) const { return Kind_Deform_Method; }
+
+  /*!
+   * \brief Get the support radius of the RBF volume deformation.
+   * \return Support radius, a value of zero means it is determined from the moving boundaries.
+   */
+  su2double GetDeform_RBF_Radius(void) const { return Deform_RBF_Radius; }
+
+  /*!
+   * \brief Get the tolerance of the greedy selection of the RBF control points.
+   * \return Tolerance relative to the maximum boundary displacement.
+   */
+  su2double GetDeform_RBF_Greedy_Tol(void) const { return Deform_RBF_Greedy_Tol; }
+
+  /*!
+   * \brief Get the maximum number of control points of the RBF volume deformation.
+   * \return Maximum number of RBF control points.
+   */
+  unsigned long GetDeform_RBF_Max_Points(void) const { return Deform_RBF_Max_Points; }
+
   /*!
    * \brief Creates a tecplot file to visualize the volume deformation deformation made by the DEF software.
    * \return <code>TRUE</code> if the deformation is going to be plotted; otherwise <code>FALSE</code>.
@@ -4123,6 +4662,12 @@ public:
    */
   bool GetFFD_Symmetry_Plane(void) const { return FFD_Symmetry_Plane; }
 
+  /*!
+   * \brief Get whether SU2_DOT projects the surface sensitivity with the sparse FFD Jacobian.
+   * \return <code>TRUE</code> to use the cached FFD basis instead of one surface deformation per design variable.
+   */
+  bool GetFFD_Sparse_Projection(void) const { return FFD_Sparse_Projection; }
+
   /*!
    * \brief Get the kind of SU2 software component.
    * \return Kind of the SU2 software component.
@@ -4171,6 +4716,12 @@ public:
    */
   unsigned short GetKind_Adaptation(void) const { return Kind_Adaptation; }
 
+  /*!
+   * \brief Get the number of in-process (metric-based) adaptation cycles of SU2_CFD.
+   * \return Number of adaptation cycles, 0 if the grid is not adapted.
+   */
+  unsigned short GetnAdapt_Cycles(void) const { return nAdapt_Cycles; }
+
   /*!
    * \brief Get the number of new elements added in the adaptation process.
    * \return percentage of new elements that are going to be added in the adaptation.
@@ -4282,6 +4833,13 @@ public:
    */
   unsigned short GetKind_TimeIntScheme_Flow(void) const { return Kind_TimeIntScheme_Flow; }
 
+  /*!
+   * \brief Set the kind of integration scheme for the flow equations.
+   * \note Used to evaluate the residual without updating the Jacobian (matrix-free Newton-Krylov).
+   * \param[in] val_kind - Kind of integration scheme.
+   */
+  void SetKind_TimeIntScheme_Flow(unsigned short val_kind) { Kind_TimeIntScheme_Flow = val_kind; }
+
   /*!
    * \brief Get the kind of scheme (aliased or non-aliased) to be used in the
    *        predictor step of ADER-DG.
@@ -4289,6 +4847,12 @@ public:
    */
   unsigned short GetKind_ADER_Predictor(void) const { return Kind_ADER_Predictor; }
 
+  /*!
+   * \brief Get whether the predictor solution of ADER-DG is stored in single precision.
+   * \return <code>TRUE</code> if the predictor solution is stored in single precision.
+   */
+  bool GetADER_Predictor_SinglePrecision(void) const { return ADER_Predictor_SinglePrecision; }
+
   /*!
    * \brief Get the kind of integration scheme (explicit or implicit)
    *        for the flow equations.
@@ -4343,6 +4907,40 @@ public:
    */
   unsigned short GetKind_SpaceIteScheme_FEA(void) const { return Kind_SpaceIteScheme_FEA; }
 
+  /*!
+   * \brief Get whether the structural stiffness matrix is applied element by element (matrix-free).
+   * \note Only the diagonal blocks are then assembled, to build the preconditioner.
+   * \return <code>TRUE</code> if the products are matrix-free.
+   */
+  bool GetFEA_MatrixFree(void) const { return FEA_MatrixFree; }
+
+  /*!
+   * \brief Get the number of iterations between updates of the frozen tangent of modified Newton-Raphson
+   *        and quasi-Newton (0 to update it only on the first iteration of each time step).
+   */
+  unsigned long GetFEA_Tangent_Update_Iter(void) const { return FEA_Tangent_Update_Iter; }
+
+  /*!
+   * \brief Get the ratio of the norms of consecutive residuals above which the frozen tangent is updated (0 to disable).
+   */
+  su2double GetFEA_Tangent_Stall_Ratio(void) const { return FEA_Tangent_Stall_Ratio; }
+
+  /*!
+   * \brief Get the number of BFGS updates (pairs of step and residual change) kept by the quasi-Newton method.
+   */
+  unsigned short GetQuasiNewton_Memory(void) const { return QuasiNewton_Memory; }
+
+  /*!
+   * \brief Get whether the quasi-Newton steps are corrected by a line search.
+   */
+  bool GetQuasiNewton_LineSearch(void) const { return QuasiNewton_LineSearch; }
+
+  /*!
+   * \brief Get whether the gradients of the shape functions wrt the reference coordinates (and the Jacobians)
+   *        at the Gauss points of each finite element are stored, instead of computed on each assembly.
+   */
+  bool GetFEA_GradientCache(void) const { return FEA_GradientCache; }
+
   /*!
    * \brief Get the kind of convective numerical scheme for the flow
    *        equations (centered or upwind).
@@ -5260,6 +5858,12 @@ public:
    */
   string GetMesh_FileName(void) const { return Mesh_FileName; }
 
+  /*!
+   * \brief Set the name of the input grid (e.g. to read the grid of another solution).
+   * \param[in] val_filename - File name of the input grid.
+   */
+  void SetMesh_FileName(const string& val_filename) { Mesh_FileName = val_filename; }
+
   /*!
    * \brief Get name of the output grid, this parameter is important for grid
    *        adaptation and deformation.
@@ -5273,6 +5877,12 @@ public:
    */
   string GetSolution_FileName(void) const { return Solution_FileName; }
 
+  /*!
+   * \brief Get the name of the grid of the solution of the flow problem, when it differs from the input grid.
+   * \return File name of the grid of the restart solution, empty if it is the input grid.
+   */
+  string GetSolution_Donor_Mesh_FileName(void) const { return Solution_Donor_Mesh_FileName; }
+
   /*!
    * \brief Get the name of the file with the solution of the adjoint flow problem
    *          with drag objective function.
@@ -5293,6 +5903,61 @@ public:
    */
   unsigned short GetMesh_FileFormat(void) const { return Mesh_FileFormat; }
 
+  /*!
+   * \brief Get the kind of renumbering of the grid points.
+   * \return Renumbering applied to the points of each partition (RCM or space-filling curve).
+   */
+  unsigned short GetKind_Point_Ordering(void) const { return Kind_Point_Ordering; }
+
+  /*!
+   * \brief Get whether the partitioned grid is cached between runs.
+   * \return <code>TRUE</code> if the partition is read from (or written to) the cache files.
+   */
+  bool GetPartition_Cache(void) const { return Partition_Cache; }
+
+  /*!
+   * \brief Get the root name of the partition cache files (one per rank and zone).
+   * \return Root name of the partition cache files.
+   */
+  string GetPartition_Cache_FileName(void) const { return Partition_Cache_FileName; }
+
+  /*!
+   * \brief Get the kind of vertex weights used for the graph partitioning.
+   * \return Kind of partitioning weights (none, per point, or multi-constraint).
+   */
+  unsigned short GetKind_Partition_Weights(void) const { return Kind_Partition_Weights; }
+
+  /*!
+   * \brief Get the partitioning weight of the points of a marker.
+   * \param[in] val_marker - Name of the marker.
+   * \return Work of the points of the marker relative to an interior point (0 if not specified).
+   */
+  su2double GetMarker_PartitionWeight(string val_marker) const;
+
+  /*!
+   * \brief Get the number of time steps between the checks of the load balance of the ranks.
+   * \return Number of time steps, 0 if the grid is never repartitioned during the run.
+   */
+  unsigned long GetLoadBalancing_Freq(void) const { return LoadBalancing_Freq; }
+
+  /*!
+   * \brief Get the imbalance above which the grid is repartitioned during the run.
+   * \return Ratio of the maximum to the average computation time of the ranks.
+   */
+  su2double GetLoadBalancing_Tol(void) const { return LoadBalancing_Tol; }
+
+  /*!
+   * \brief Get the kind of search tree (ADT) used for the wall distance.
+   * \return Global (replicated) or distributed tree.
+   */
+  unsigned short GetKind_WallDistance_ADT(void) const { return Kind_WallDistance_ADT; }
+
+  /*!
+   * \brief Get the tolerance for the incremental update of the wall distance of moving grids.
+   * \return Bound of the relative change of the distance of a point below which it is not recomputed.
+   */
+  su2double GetWallDistance_UpdateTol(void) const { return WallDistance_UpdateTol; }
+
   /*!
    * \brief Get the format of the output solution.
    * \return Format of the output solution.
@@ -5311,6 +5976,18 @@ public:
    */
   string GetConv_FileName(void) const { return Conv_FileName; }
 
+  /*!
+   * \brief Get the ADIOS2 engine used by the in-situ output streams (SST, BP4, ...).
+   * \return Name of the engine, used unless the IO of the stream is set in the ADIOS2 configuration file.
+   */
+  string GetADIOS2_Engine(void) const { return ADIOS2_Engine; }
+
+  /*!
+   * \brief Get the name of the ADIOS2 XML runtime configuration file of the in-situ output streams.
+   * \return Name of the file, empty if there is none.
+   */
+  string GetADIOS2_Config_FileName(void) const { return ADIOS2_Config_FileName; }
+
   /*!
    * \brief Get the Starting Iteration for the windowing approach
    *        in Sensitivity Analysis for period-averaged outputs, which oscillate.
@@ -5324,6 +6001,17 @@ public:
    */
   WINDOW_FUNCTION GetKindWindow(void) const { return static_cast<WINDOW_FUNCTION>(Kind_WindowFct); }
 
+  /*!
+   * \brief Get whether the windowed time averages are computed without storing the values, the window
+   *        then spans the entire time domain and the average is final at the last time iteration.
+   */
+  bool GetWindow_Streaming(void) const { return Window_Streaming; }
+
+  /*!
+   * \brief Get the number of time iterations between samples of the time averages.
+   */
+  unsigned long GetTime_Average_Freq(void) const { return Time_Average_Freq; }
+
   /*!
    * \brief Get the name of the file with the forces breakdown of the problem.
    * \return Name of the file with forces breakdown of the problem.
@@ -5347,9 +6035,10 @@ public:
    * \param[in] config - Definition of the particular problem.
    * \param[in] filename - the base filename.
    * \param[in] ext - the extension to be added.
+   * \param[in] appendIter - whether the iteration number is added for time-domain problems.
    * \return The new filename
    */
-  string GetFilename(string filename, string ext, unsigned long Iter);
+  string GetFilename(string filename, string ext, unsigned long Iter, bool appendIter = true);
 
   /*!
    * \brief Append the zone index to the restart or the solution files.
@@ -5440,9 +6129,10 @@ public:
   /*!
    * \brief Append the input filename string with the appropriate objective function extension.
    * \param[in] val_filename - String value of the base filename.
+   * \param[in] val_obj - Use the extension of this objective function (by default that of the weighted sum).
    * \return Name of the file with the appropriate objective function extension.
    */
-  string GetObjFunc_Extension(string val_filename);
+  string GetObjFunc_Extension(string val_filename, short val_obj = -1);
 
   /*!
    * \brief Get the criteria for structural residual (relative/absolute).
@@ -5934,6 +6624,12 @@ public:
    */
   bool GetAdaptBoundary(void) const { return AdaptBoundary; }
 
+  /*!
+   * \brief Get whether the partitioned grid is refined in parallel (CParallelGridAdaptation).
+   * \return <code>TRUE</code> if the grid is refined in parallel; otherwise <code>FALSE</code>.
+   */
+  bool GetParallel_Adaptation(void) const { return ParallelAdaptation; }
+
   /*!
    * \brief Get information about there is a smoothing of the grid coordinates.
    * \return <code>TRUE</code> if there is smoothing of the grid coordinates; otherwise <code>FALSE</code>.
@@ -6714,6 +7410,13 @@ public:
    */
   su2double* GetWallFunction_DoubleInfo(string val_marker);
 
+  /*!
+   * \brief Get the number of consecutive residual evaluations, e.g. RK stages,
+            for which the wall shear stress and heat flux of the wall model are reused.
+   * \return Number of evaluations for which the wall model is frozen, 1 means no freezing.
+   */
+  unsigned short GetWallModel_FreezeStages(void) const { return WallModel_FreezeStages; }
+
   /*!
    * \brief Get the target (pressure, massflow, etc) at an engine inflow boundary.
    * \param[in] val_index - Index corresponding to the engine inflow boundary.
@@ -7952,6 +8655,21 @@ public:
    */
   void SetRunTime_Options(void);
 
+  /*!
+   * \brief Options (name and tokens of the value) of a config file, in the order of the file.
+   */
+  using CFileOptions = vector<pair<string, vector<string> > >;
+
+  /*!
+   * \brief Get the tokenized options of a config file (collective).
+   * \details Only the master reads the file, its text is broadcast to the other ranks. The options are
+   *          cached by file name, the text is not broadcast (nor tokenized) again while the size and hash
+   *          of the file read by the master do not change, e.g. for the driver and zone configs of a case.
+   * \param[in] filename - Name of the config file.
+   * \return The options, nullptr if the file cannot be opened.
+   */
+  static const CFileOptions* GetConfigFileOptions(const string& filename);
+
   /*!
    * \brief Set the config file parsing.
    */
@@ -8251,6 +8969,24 @@ public:
    */
   unsigned long GetUpdate_AoA_Iter_Limit(void) const { return Update_AoA_Iter_Limit; }
 
+  /*!
+   * \brief Get whether the AoA is updated by Newton steps in fixed C_L mode (instead of waiting for convergence).
+   * \return <code>TRUE</code> for Newton updates with a secant estimate of dCL/dAlpha.
+   */
+  bool GetFixed_CL_Newton(void) const { return Fixed_CL_Newton; }
+
+  /*!
+   * \brief Get the number of iterations between Newton updates of the AoA in fixed C_L mode.
+   * \return Number of iterations.
+   */
+  unsigned long GetFixed_CL_Newton_Iter(void) const { return Fixed_CL_Newton_Iter; }
+
+  /*!
+   * \brief Get the number of iterations over which each Newton update of the AoA is ramped.
+   * \return Number of iterations.
+   */
+  unsigned long GetFixed_CL_AoA_Ramp(void) const { return Fixed_CL_AoA_Ramp; }
+
   /*!
    * \brief Get whether at the end of finite differencing (Fixed CL mode)
    * \return boolean indicating end of finite differencing mode (Fixed CL mode)
@@ -8380,6 +9116,12 @@ public:
    */
   unsigned short GetDirectDiff() const { return DirectDiff;}
 
+  /*!
+   * \brief Get the number of design variables that are differentiated in one run (vector forward mode).
+   * \return Number of derivative directions.
+   */
+  unsigned short GetDirectDiff_Directions() const { return DirectDiff_Directions;}
+
   /*!
    * \brief Get the indicator whether we are solving an discrete adjoint problem.
    * \return the discrete adjoint indicator.
@@ -8428,6 +9170,18 @@ public:
    */
   su2double GetAitkenDynMinInit(void) const { return AitkenDynMinInit; }
 
+  /*!
+   * \brief Get the number of previous time steps whose IQN-ILS coupling history is reused.
+   * \return Number of time steps.
+   */
+  unsigned short GetIQN_ReuseTimeIter(void) const { return IQN_ReuseTimeIter; }
+
+  /*!
+   * \brief Get the tolerance of the QR filter used to discard linearly dependent IQN-ILS columns.
+   * \return Filter tolerance.
+   */
+  su2double GetIQN_FilterTol(void) const { return IQN_FilterTol; }
+
   /*!
    * \brief Decide whether to apply dead loads to the model.
    * \return <code>TRUE</code> if the dead loads are to be applied, <code>FALSE</code> otherwise.
@@ -8762,6 +9516,34 @@ public:
    */
   bool GetJacobian_Spatial_Discretization_Only(void) const { return Jacobian_Spatial_Discretization_Only; }
 
+  /*!
+   * \brief Function to make available whether or not the cost of the DG elements
+            must be measured, and used for the partitioning when restarting.
+   * \return The boolean whether or not to measure the cost of the elements.
+   */
+  bool GetMeasure_ElemCost_DGFEM(void) const { return Measure_ElemCost_DGFEM; }
+
+  /*!
+   * \brief Function to make available the name of the file with the measured
+            cost of the DG elements.
+   * \return The name of the file.
+   */
+  string GetElemCost_FileName_DGFEM(void) const { return ElemCost_FileName_DGFEM; }
+
+  /*!
+   * \brief Function to make available the number of iterations between the
+            updates of the Jacobian (preconditioner) of the implicit DG solver.
+   * \return The number of iterations.
+   */
+  unsigned long GetJacobian_Frequency_DGFEM(void) const { return Jacobian_Frequency_DGFEM; }
+
+  /*!
+   * \brief Function to make available whether or not only the couplings within
+            the elements are kept in the Jacobian of the implicit DG solver.
+   * \return The boolean whether or not the Jacobian is element block diagonal.
+   */
+  bool GetElementBlock_Jacobian_DGFEM(void) const { return ElementBlock_Jacobian_DGFEM; }
+
   /*!
    * \brief Get the interpolation method used for matching between zones.
    */
@@ -8787,6 +9569,12 @@ public:
    */
   su2double GetRadialBasisFunctionParameter(void) const { return RadialBasisFunction_Parameter; }
 
+  /*!
+   * \brief Get the number of donor points of the local patches of the radial basis function interpolation.
+   * \return Size of the patches, 0 if all donor points are used (global interpolation).
+   */
+  unsigned long GetRadialBasisFunctionPatchSize(void) const { return RadialBasisFunction_PatchSize; }
+
   /*!
    * \brief Get the kind of inlet face interpolation function to use.
    */
@@ -8832,6 +9620,22 @@ public:
    */
   bool GetUQ_Permute(void) const { return uq_permute; }
 
+  /*!
+   * \brief Get whether the perturbations of the UQ study are solved at once, as instances sharing the geometry.
+   * \return <code>TRUE</code> if each instance is a member of the UQ ensemble.
+   */
+  bool GetUQ_Ensemble(void) const { return uq_ensemble; }
+
+  /*!
+   * \brief Set the perturbation of a member of the UQ ensemble, those of compute_uncertainty.py:
+   *        componentality 1, 2, and 3, then 1 and 2 with permuted eigenvectors.
+   * \param[in] iMember - Index of the member (instance).
+   */
+  void SetUQ_EnsembleMember(unsigned short iMember) {
+    eig_val_comp = (iMember % 3) + 1;
+    uq_permute = (iMember >= 3);
+  }
+
   /*!
    * \brief Get information about whether to use wall functions.
    * \return <code>TRUE</code> if wall functions are on; otherwise <code>FALSE</code>.
@@ -9060,6 +9864,12 @@ public:
    */
   unsigned short GetComm_Level(void) const { return Comm_Level; }
 
+  /*!
+   * \brief Get the implementation of the point-to-point (halo) MPI communications.
+   * \return Kind of point-to-point communications (see ENUM_P2P_COMMS).
+   */
+  unsigned short GetKind_P2P_Comms(void) const { return Kind_P2P_Comms; }
+
   /*!
    * \brief Check if the mesh read supports multiple zones.
    * \return YES if multiple zones can be contained in the mesh file.
@@ -9163,6 +9973,18 @@ public:
    */
   su2double GetMeshBoxOffset(unsigned short val_iDim) const { return Mesh_Box_Offset[val_iDim]; }
 
+  /*!
+   * \brief Get the clustering factor of the analytic RECTANGLE or BOX grid in the specified coordinate direction.
+   * \return Clustering factor towards the minimum coordinate (0 for uniform spacing).
+   */
+  su2double GetMeshBoxClustering(unsigned short val_iDim) const { return Mesh_Box_Clustering[val_iDim]; }
+
+  /*!
+   * \brief Get the type of elements of the analytic RECTANGLE or BOX grid.
+   * \return Type of elements (see ENUM_BOX_ELEMENTS).
+   */
+  unsigned short GetKind_MeshBoxElements(void) const { return Kind_Mesh_Box_Elements; }
+
   /*!
    * \brief Get the number of screen output variables requested (maximum 6)
    */
@@ -9270,6 +10092,18 @@ public:
    */
   void SetHistory_Wrt_Freq(unsigned short iter, unsigned long nIter) { HistoryWrtFreq[iter] = nIter;}
 
+  /*!
+   * \brief Get the number of history file writes between flushes of the file.
+   * \return Number of writes, the lines are buffered in between.
+   */
+  unsigned long GetHistory_Flush_Freq(void) const { return HistoryFlushFreq; }
+
+  /*!
+   * \brief Get whether the history file is written in binary format.
+   * \return <code>TRUE</code> for the binary format, otherwise the tabular format (CSV or Tecplot) is used.
+   */
+  bool GetWrt_History_Binary(void) const { return Wrt_History_Binary; }
+
   /*!
    * \brief GetScreen_Wrt_Freq_Inner
    * \return
@@ -9289,6 +10123,84 @@ public:
    */
   unsigned long GetVolume_Wrt_Freq() const { return VolumeWrtFreq; }
 
+  /*!
+   * \brief Get the number of output probes (points where the volume output is interpolated).
+   */
+  unsigned short GetnOutput_Probes(void) const { return nOutput_Probes/3; }
+
+  /*!
+   * \brief Get the coordinates of an output probe.
+   * \param[in] iProbe - Index of the probe.
+   * \return Pointer to the 3 coordinates of the probe.
+   */
+  const su2double* GetOutput_Probe(unsigned short iProbe) const { return &Output_Probes[3*iProbe]; }
+
+  /*!
+   * \brief Get the number of output probe planes (regular grids of probes).
+   */
+  unsigned short GetnOutput_Probe_Planes(void) const { return nOutput_Probe_Planes/11; }
+
+  /*!
+   * \brief Get the definition of an output probe plane.
+   * \param[in] iPlane - Index of the plane.
+   * \return Pointer to the origin (3), the two edge vectors (3+3) and the number of samples along them (2).
+   */
+  const su2double* GetOutput_Probe_Plane(unsigned short iPlane) const { return &Output_Probe_Planes[11*iPlane]; }
+
+  /*!
+   * \brief Get the number of output boxes (regions where the volume output is written at the grid points).
+   */
+  unsigned short GetnOutput_Probe_Boxes(void) const { return nOutput_Probe_Boxes/6; }
+
+  /*!
+   * \brief Get the bounds of an output box.
+   * \param[in] iBox - Index of the box.
+   * \return Pointer to the minimum (3) and maximum (3) coordinates of the box.
+   */
+  const su2double* GetOutput_Probe_Box(unsigned short iBox) const { return &Output_Probe_Boxes[6*iBox]; }
+
+  /*!
+   * \brief Get the writing frequency of the output probes and boxes.
+   */
+  unsigned long GetOutput_Probe_Freq(void) const { return Output_Probe_Freq; }
+
+  /*!
+   * \brief Get the base name of the files of the output probes and boxes.
+   */
+  string GetOutput_Probe_FileName(void) const { return Output_Probe_FileName; }
+
+  /*!
+   * \brief Get the number of markers whose points are streamed to the surface sampling file.
+   */
+  unsigned short GetnMarker_Surface_Sampling(void) const { return nMarker_Surface_Sampling; }
+
+  /*!
+   * \brief Get the name of a marker of the surface sampling.
+   * \param[in] iMarker - Index of the marker in MARKER_SURFACE_SAMPLING.
+   */
+  string GetMarker_Surface_Sampling(unsigned short iMarker) const { return Marker_Surface_Sampling[iMarker]; }
+
+  /*!
+   * \brief Get the number of volume output groups or fields of the surface sampling (0 for all the fields).
+   */
+  unsigned short GetnSurface_Sampling_Fields(void) const { return nSurface_Sampling_Fields; }
+
+  /*!
+   * \brief Get a volume output group or field of the surface sampling.
+   * \param[in] iField - Index of the group or field in SURFACE_SAMPLING_FIELDS.
+   */
+  string GetSurface_Sampling_Field(unsigned short iField) const { return Surface_Sampling_Fields[iField]; }
+
+  /*!
+   * \brief Get the writing frequency of the surface sampling.
+   */
+  unsigned long GetSurface_Sampling_Freq(void) const { return Surface_Sampling_Freq; }
+
+  /*!
+   * \brief Get the name of the surface sampling file (without extension).
+   */
+  string GetSurface_Sampling_FileName(void) const { return Surface_Sampling_FileName; }
+
   /*!
    * \brief GetVolumeOutputFiles
    * \return
@@ -9307,6 +10219,12 @@ public:
    */
   unsigned long GetPastixFactFreq(void) const { return pastix_fact_freq; }
 
+  /*!
+   * \brief Get the factorization frequency for PaStiX in time steps (unsteady problems).
+   * \return Number of time steps that reuse the factorization (0 means GetPastixFactFreq is used).
+   */
+  unsigned long GetPastixFactTimeFreq(void) const { return pastix_fact_time_freq; }
+
   /*!
    * \brief Get the desired level of verbosity for PaStiX
    * \return 0 - Quiet, 1 - During factorization and cleanup, 2 - Even more detail.
@@ -9343,4 +10261,90 @@ public:
    */
   unsigned long GetEdgeColoringGroupSize(void) const { return edgeColorGroupSize; }
 
+  /*!
+   * \brief Get whether the size of the edge groups is chosen at run time (from a quick benchmark).
+   */
+  bool GetEdgeColoringAutoTune(void) const { return edgeColorAutoTune; }
+
+  /*!
+   * \brief Get whether the centered and first order upwind fluxes use the owner-computes strategy
+   *        (each point computes the fluxes of all its edges) instead of coloring or the reducer.
+   */
+  bool GetEdgeOwnerComputes(void) const { return edgeOwnerComputes; }
+
+  /*!
+   * \brief Get whether the upwind fluxes are computed in batches of edges with vectorized numerics.
+   */
+  bool GetEdgeBatchedNumerics(void) const { return edgeBatchedNumerics; }
+
+  /*!
+   * \brief Get whether the turbulence source terms are computed in batches of points with vectorized kernels.
+   */
+  bool GetBatchedTurbSources(void) const { return batchedTurbSources; }
+
+  /*!
+   * \brief Get whether the geometric factors of the edges used by the numerics are stored.
+   */
+  bool GetEdgeGeometryCache(void) const { return edgeGeometryCache; }
+
+  /*!
+   * \brief Get whether the containers of the flow variables are only allocated for the features that use them.
+   */
+  bool GetLeanVariableStorage(void) const { return leanVariableStorage; }
+
+  /*!
+   * \brief Get whether the memory of the containers of the flow variables is reported at startup.
+   */
+  bool GetVariableMemoryReport(void) const { return variableMemoryReport; }
+
+  /*!
+   * \brief Get whether the time and memory of the phases of the preprocessing are reported.
+   */
+  bool GetPreprocessing_Timing_Report(void) const { return preprocessingTimingReport; }
+
+  /*!
+   * \brief Get whether the memory by category is reported (see MemoryAllocation::print_memory_report).
+   */
+  bool GetMemory_Report(void) const { return memoryReport; }
+
+  /*!
+   * \brief Get whether the main regions of the iterations are timed (see CRegionProfiler).
+   */
+  bool GetRegion_Profiling(void) const { return regionProfiling; }
+
+  /*!
+   * \brief Get the base name of the per rank files of the region profiling.
+   */
+  string GetRegion_Profiling_FileName(void) const { return regionProfilingFileName; }
+
+  /*!
+   * \brief Get whether hardware counters are read for the profiled regions.
+   */
+  bool GetRegion_Profiling_Counters(void) const { return regionProfilingCounters; }
+
+  /*!
+   * \brief Get the raw perf_event code of the CPU event that counts the floating point operations (0 for none).
+   */
+  unsigned long long GetRegion_Profiling_FLOP_Event(void) const { return regionProfilingFlopEvent; }
+
+  /*!
+   * \brief Get whether the MPI communication is counted and the load imbalance reported (see CCommProfiler).
+   */
+  bool GetComm_Profiling(void) const { return commProfiling; }
+
+  /*!
+   * \brief Get whether the halo exchange of gradients and limiters is overlapped with the fluxes of the interior edges.
+   */
+  bool GetOverlapHaloComms(void) const { return overlapHaloComms; }
+
+  /*!
+   * \brief Get whether the least-squares gradient weights of the neighbors of each point are stored.
+   */
+  bool GetLeastSquaresCache(void) const { return leastSquaresCache; }
+
+  /*!
+   * \brief Get whether the primitives, gradients, and limiters read by the MUSCL edge loops are packed per point.
+   */
+  bool GetPackedEdgeData(void) const { return packedEdgeData; }
+
 };
@@ -55,10 +55,34 @@ namespace AD{
   bool TapeActive();
 
   /*!
-   * \brief Prints out tape statistics.
+   * \brief Prints out tape statistics, followed by the report of the sections of the current recording.
    */
   void PrintStatistics();
 
+  /*!
+   * \brief Start a named section of the recording (e.g. one solver), its tape size and time are reported by PrintStatistics.
+   * \note Sections should not be nested, a section that is recorded multiple times is accumulated. No effect if the tape is not active.
+   * \param[in] name - Name of the section, it must remain valid until the report is printed (e.g. a string literal).
+   */
+  void StartSection(const char* name);
+
+  /*!
+   * \brief End the section started last.
+   */
+  void EndSection();
+
+  /*!
+   * \brief Get the number of statements recorded on the tape.
+   * \return Number of statements (0 if reverse AD is not used).
+   */
+  unsigned long GetTapeStatements();
+
+  /*!
+   * \brief Get the memory used by the tape.
+   * \return Memory in bytes (0 if reverse AD is not used).
+   */
+  double GetTapeMemory();
+
   /*!
    * \brief Registers the variable as an input and saves internal data (indices). I.e. as a leaf of the computational graph.
    * \param[in] data - The variable to be registered as input.
@@ -86,6 +110,15 @@ namespace AD{
    */
   double GetDerivative(int index);
 
+  /*!
+   * \brief Set the direction of the vector reverse mode on which the scalar accessors of the adjoints act
+   *        (SU2_TYPE::SetDerivative/GetDerivative and the ones above), and restart the extraction of the inputs.
+   * \note The directions are seeded and extracted one after the other, the tape is evaluated once for all.
+   *       Only direction 0 exists if codi-reverse-directions is 1 (the default).
+   * \param[in] iDir - Direction, smaller than SU2_TYPE::GetnDirections().
+   */
+  void SetDirection(unsigned short iDir);
+
   /*!
    * \brief Clears the currently stored adjoints but keeps the computational graph.
    */
@@ -46,6 +46,10 @@ namespace AD{
 
   extern int adjointVectorPosition;
 
+  /*--- Direction of the vector mode that the scalar accessors act on ---*/
+
+  extern unsigned short adjointDirection;
+
   /*--- Reference to the tape ---*/
 
   extern su2double::TapeType& globalTape;
@@ -66,6 +70,14 @@ namespace AD{
 
   extern codi::PreaccumulationHelper<su2double> PreaccHelper;  
 
+  /*--- Number of external functions recorded by SU2 (MPI communication not included) ---*/
+
+  extern unsigned long nExtFunc;
+
+  /*--- Clears the sections of the tape report, called by Reset ---*/
+
+  void ResetSections();
+
   inline void RegisterInput(su2double &data, bool push_index) {
     AD::globalTape.registerInput(data);
     if (push_index) {
@@ -83,7 +95,9 @@ namespace AD{
 
   inline bool TapeActive() { return AD::globalTape.isActive(); }
 
-  inline void PrintStatistics() {AD::globalTape.printStatistics();}
+  inline unsigned long GetTapeStatements() {return AD::globalTape.getUsedStatementsSize();}
+
+  inline double GetTapeMemory() {return AD::globalTape.getTapeValues().getUsedMemorySize();}
 
   inline void ClearAdjoints() {AD::globalTape.clearAdjoints(); }
 
@@ -106,12 +120,28 @@ namespace AD{
     if (TapePositions.size() != 0) {
       TapePositions.clear();
     }    
+    nExtFunc = 0;
+    ResetSections();
   }
 
   inline void SetIndex(int &index, const su2double &data) {
     index = data.getGradientData();
   }
 
+  inline void SetDirection(unsigned short iDir) {
+    adjointDirection = iDir;
+    adjointVectorPosition = 0;
+  }
+
+#if CODI_REVERSE_DIRECTIONS > 1
+  inline void SetDerivative(int index, const double val) {
+    if (index != 0) AD::globalTape.gradient(index)[adjointDirection] = val;
+  }
+
+  inline double GetDerivative(int index) {
+    return AD::globalTape.getGradient(index)[adjointDirection];
+  }
+#else
   inline void SetDerivative(int index, const double val) {
     AD::globalTape.setGradient(index, val);
   }
@@ -119,6 +149,7 @@ namespace AD{
   inline double GetDerivative(int index) {
     return AD::globalTape.getGradient(index);
   }
+#endif
 
   inline void SetPreaccIn(const su2double &data) {
     if (PreaccActive) {
@@ -255,7 +286,7 @@ namespace AD{
     checkpoint->clear();
   }
   
-  inline void EndExtFunc(){delete FuncHelper;}
+  inline void EndExtFunc(){delete FuncHelper; nExtFunc++;}
   
 #else
 
@@ -273,6 +304,14 @@ namespace AD{
 
   inline void PrintStatistics() {}
 
+  inline void StartSection(const char* name) {}
+
+  inline void EndSection() {}
+
+  inline unsigned long GetTapeStatements() {return 0;}
+
+  inline double GetTapeMemory() {return 0.0;}
+
   inline void ClearAdjoints() {}
 
   inline void ComputeAdjoint() {}
@@ -285,6 +324,8 @@ namespace AD{
 
   inline double GetDerivative(int position) { return 0.0; }
 
+  inline void SetDirection(unsigned short iDir) {}
+
   inline void Reset() {}
 
   inline void ResetInput(su2double &data) {}
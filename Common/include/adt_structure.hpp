@@ -38,6 +38,7 @@
 
 #include "./mpi_structure.hpp"
 #include "./option_structure.hpp"
+#include "./omp_structure.hpp"
 
 using namespace std;
 
@@ -207,8 +208,9 @@ protected:
 
   vector<CADTNodeClass> leaves; /*!< \brief Vector, which contains all the leaves of the ADT. */
 
-  vector<unsigned long> frontLeaves;    /*!< \brief Vector used in the tree traversal. */
-  vector<unsigned long> frontLeavesNew; /*!< \brief Vector used in the tree traversal. */
+  vector<vector<unsigned long> > FrontLeaves;    /*!< \brief Vectors used in the tree traversal, one per thread
+                                                            such that the searches are thread safe. */
+  vector<vector<unsigned long> > FrontLeavesNew; /*!< \brief Vectors used in the tree traversal, one per thread. */
 
 private:
   vector<su2double> coorMinLeaves; /*!< \brief Vector, which contains all the minimum coordinates
@@ -301,6 +303,19 @@ public:
                             su2double       &dist,
                             unsigned long   &pointID,
                             int             &rankID);
+
+  /*!
+   * \brief Function, which determines all nodes in the ADT that are located
+            within the given distance of the given coordinate.
+   * \param[in]  coor     Coordinate of the center of the search ball.
+   * \param[in]  radius   Radius of the search ball.
+   * \param[out] pointIDs Positions in the ADT of the nodes inside the ball,
+                          i.e. the numbering of the (gathered) points used to
+                          construct the tree, in arbitrary order.
+   */
+  void DetermineNodesInBall(const su2double       *coor,
+                            const su2double       radius,
+                            vector<unsigned long> &pointIDs);
 private:
   /*!
    * \brief Default constructor of the class, disabled.
@@ -347,9 +362,9 @@ private:
   vector<int>           ranksOfElems;  /*!< \brief Vector, which contains the ranks
                                                     of the elements in the ADT. */
 
-  vector<CBBoxTargetClass> BBoxTargets; /*!< \brief Vector, used to store possible bounding
-                                                    box candidates during the nearest element
-                                                    search. */
+  vector<vector<CBBoxTargetClass> > ThreadBBoxTargets; /*!< \brief Vectors, used to store possible bounding
+                                                                   box candidates during the nearest element
+                                                                   search, one per thread. */
 public:
   /*!
    * \brief Constructor of the class.
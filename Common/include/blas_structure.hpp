@@ -32,6 +32,10 @@
 #include "datatype_structure.hpp"
 #include "CConfig.hpp"
 
+#include <map>
+#include <tuple>
+#include <vector>
+
 /* LIBXSMM include files, if supported. */
 #ifdef HAVE_LIBXSMM
 #include "libxsmm.h"
@@ -69,6 +73,29 @@ public:
             const su2double *A, const su2double *B, su2double *C,
             CConfig *config);
 
+  /*!
+   * \brief Function, which carries out a batch of dense matrix products of the
+            same shape, C_i = A_i*B_i, e.g. one for every element of the same
+            standard element. The kernel is selected once for the batch and the
+            profiling registers the batch as one call.
+   * \param[in]  M       - Number of rows of A and C.
+   * \param[in]  N       - Number of columns of B and C.
+   * \param[in]  K       - Number of columns of A and number of rows of B.
+   * \param[in]  nBatch  - Number of matrix products.
+   * \param[in]  A       - Input matrices in the multiplication.
+   * \param[in]  strideA - Distance between consecutive A matrices, 0 if A is shared.
+   * \param[in]  B       - Input matrices in the multiplication.
+   * \param[in]  strideB - Distance between consecutive B matrices, 0 if B is shared.
+   * \param[out] C       - Results of the matrix products.
+   * \param[in]  strideC - Distance between consecutive C matrices.
+   */
+  void gemm_batch(const int M,        const int N,       const int K,
+                  const int nBatch,
+                  const su2double *A, const int strideA,
+                  const su2double *B, const int strideB,
+                  su2double *C,       const int strideC,
+                  CConfig *config);
+
   /*!
    * \brief Function, which carries out a dense matrix vector product
             y = A x. It is a limited version of the BLAS gemv functionality.
@@ -105,6 +132,42 @@ private:
   const int kc;
   const int nc;
 
+  /*!
+   * \brief Kernels for the blocks of the native implementation. All kernels add
+            the products to C in the same order, hence they give the same result.
+   */
+  enum ENUM_GEMM_KERNEL {
+    GEMM_KERNEL_NAIVE  = 0,  /*!< \brief Loops over the entries of C. */
+    GEMM_KERNEL_REG4X4 = 1,  /*!< \brief 4x4 blocks of C kept in registers. */
+    GEMM_KERNEL_REG8X4 = 2,  /*!< \brief 8x4 blocks of C kept in registers. */
+    N_GEMM_KERNELS     = 3   /*!< \brief Number of kernels. */
+  };
+
+  /*!
+   * \brief Autotuning data of one matrix shape. The first calls of a shape cycle
+            through the kernels and are timed, after which the fastest is used.
+   */
+  struct CGemmTuning {
+    int kernel = -1;                    /*!< \brief Selected kernel, negative while tuning. */
+    int nCalls = 0;                     /*!< \brief Number of timed calls so far. */
+    double minTime[N_GEMM_KERNELS];     /*!< \brief Minimum time of each kernel. */
+  };
+
+  const int nTrialsTuning = 3;  /*!< \brief Number of timed calls per kernel. */
+
+  vector<map<tuple<int,int,int>, CGemmTuning> > tuningThreads; /*!< \brief Autotuning data per thread and (M,N,K). */
+
+  /*!
+   * \brief Function, which carries out a batch of products with the native implementation,
+            selecting (or tuning) the kernel for the shape.
+   * \param[in]  M, N, K, nBatch, A, strideA, B, strideB, C, strideC - See gemm_batch.
+   */
+  void gemm_native(const int M,        const int N,       const int K,
+                   const int nBatch,
+                   const su2double *A, const int strideA,
+                   const su2double *B, const int strideB,
+                   su2double *C,       const int strideC);
+
   /*!
    * \brief Function, which perform the implementation of the gemm functionality.
    * \param[in]  m  - Number of rows of a and c.
@@ -113,9 +176,11 @@ private:
    * \param[in]  a  - Input matrix in the multiplication.
    * \param[in]  b  - Input matrix in the multiplication.
    * \param[out] c  - Result of the matrix product a*b.
+   * \param[in]  kernel - Kernel used for the blocks.
    */
   void gemm_imp(const int m,        const int n,        const int k,
-                const su2double *a, const su2double *b, su2double *c);
+                const su2double *a, const su2double *b, su2double *c,
+                const int kernel);
 
   /*!
    * \brief Compute a portion of the c matrix one block at a time.
@@ -129,9 +194,20 @@ private:
    * \param[in]  ldb - Leading dimension of the matrix b.
    * \param[out] c   - Result of the matrix product a*b.
    * \param[in]  ldc - Leading dimension of the matrix c.
+   * \param[in]  kernel - Kernel used for the block.
    */
   void gemm_inner(int m, int n, int k, const su2double *a, int lda,
-                  const su2double *b, int ldb, su2double *c, int ldc);
+                  const su2double *b, int ldb, su2double *c, int ldc,
+                  const int kernel);
+
+  /*!
+   * \brief Register blocked gemm kernel, blocks of MR x NR entries of c are kept in
+            local variables. The ragged edges are handled by gemm_arbitrary.
+   * \param[in]  m, n, k, a, lda, b, ldb, c, ldc - See gemm_arbitrary.
+   */
+  template<int MR, int NR>
+  void gemm_register_blocked(int m, int n, int k, const su2double *a, int lda,
+                             const su2double *b, int ldb, su2double *c, int ldc);
 
   /*!
    * \brief Naive gemm implementation to handle arbitrary sized matrices.
@@ -53,6 +53,26 @@
 
 typedef double passivedouble;
 
+/*--- Floating point type used to store and operate on the sparse linear systems (Jacobian, preconditioners,
+ *    Krylov vectors). Reducing it to single precision halves the memory traffic of those memory bound operations,
+ *    the outer (nonlinear) iterations are still driven by double precision residuals. ---*/
+
+#if defined(USE_MIXED_PRECISION)
+typedef float su2mixedfloat;
+#else
+typedef passivedouble su2mixedfloat;
+#endif
+
+/*--- Integer type of the local (per rank) indices of the sparse structures (matrix patterns, edge maps,
+ *    colorings, point and edge connectivity). The local sizes are far below 2^32, 32-bit indices halve the
+ *    index traffic of the sparse products and factorizations. Global indices are always unsigned long. ---*/
+
+#if defined(USE_32BIT_LOCAL_INDEX)
+typedef unsigned int su2localidx;
+#else
+typedef unsigned long su2localidx;
+#endif
+
 /*!
  * \namespace SU2_TYPE
  * \brief Namespace for defining the datatype wrapper routines; this class features as a base class for
@@ -102,6 +122,28 @@ namespace SU2_TYPE{
    */
   void SetDerivative(su2double &data, const double &val);
 
+  /*!
+   * \brief Get the number of derivative directions carried by the datatype (> 1 for the vector forward mode).
+   * \return Number of directions.
+   */
+  unsigned short GetnDirections();
+
+  /*!
+   * \brief Get one direction of the derivative value of the datatype (needs to be implemented for each new type).
+   * \param[in] data - The non-primitive datatype.
+   * \param[in] iDir - Index of the direction.
+   * \return The derivative value.
+   */
+  double GetDerivative(const su2double &data, unsigned short iDir);
+
+  /*!
+   * \brief Set one direction of the derivative value of the datatype (needs to be implemented for each new type).
+   * \param[in] data - The non-primitive datatype.
+   * \param[in] iDir - Index of the direction.
+   * \param[in] val - The value of the derivative.
+   */
+  void SetDerivative(su2double &data, unsigned short iDir, const double &val);
+
   /*!
    * \brief Casts the primitive value to int (uses GetValue, already implemented for each type).
    * \param[in] data - The non-primitive datatype.
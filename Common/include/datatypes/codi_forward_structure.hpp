@@ -29,5 +29,16 @@
 
 #include "codi.hpp"
 
-typedef codi::RealForward su2double;
+/*--- Number of tangent directions propagated in one evaluation (vector mode if > 1), e.g. for the
+ *    derivatives with respect to several design variables in one run of SU2_CFD_DIRECTDIFF. ---*/
+
+#ifndef CODI_FORWARD_DIRECTIONS
+#  define CODI_FORWARD_DIRECTIONS 1
+#endif
+
+#if CODI_FORWARD_DIRECTIONS > 1
+  typedef codi::RealForwardVec<CODI_FORWARD_DIRECTIONS> su2double;
+#else
+  typedef codi::RealForward su2double;
+#endif
 
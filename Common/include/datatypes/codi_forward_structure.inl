@@ -32,11 +32,33 @@ namespace SU2_TYPE{
 
   inline double GetValue(const su2double& data) { return data.getValue();}
 
-  inline void SetSecondary(su2double& data, const double &val) {data.setGradient(val);}
+  inline unsigned short GetnDirections() { return CODI_FORWARD_DIRECTIONS; }
 
-  inline double GetSecondary(const su2double& data) { return data.getGradient();}
+#if CODI_FORWARD_DIRECTIONS > 1
 
-  inline double GetDerivative(const su2double& data) { return data.getGradient();}
+  /*--- In vector mode the scalar accessors act on the first direction. ---*/
+
+  inline double GetDerivative(const su2double& data, unsigned short iDir) { return data.getGradient()[iDir]; }
+
+  inline void SetDerivative(su2double& data, unsigned short iDir, const double &val) {data.gradient()[iDir] = val;}
+
+  inline void SetDerivative(su2double& data, const double &val) {
+    data.setGradient(su2double::GradientValue());
+    data.gradient()[0] = val;
+  }
+
+  inline double GetDerivative(const su2double& data) { return data.getGradient()[0];}
+#else
+  inline double GetDerivative(const su2double& data, unsigned short iDir) { return data.getGradient();}
+
+  inline void SetDerivative(su2double& data, unsigned short iDir, const double &val) {data.setGradient(val);}
 
   inline void SetDerivative(su2double& data, const double &val) {data.setGradient(val);}
+
+  inline double GetDerivative(const su2double& data) { return data.getGradient();}
+#endif
+
+  inline void SetSecondary(su2double& data, const double &val) {SetDerivative(data, val);}
+
+  inline double GetSecondary(const su2double& data) { return GetDerivative(data);}
 }
@@ -42,7 +42,23 @@
 #  define CODI_PRIMAL_INDEX_TAPE 0
 #endif
 
-#if CODI_INDEX_TAPE
+/*--- Number of adjoint directions evaluated by one sweep of the tape (vector mode if > 1), e.g. for
+ *    the adjoints of several objective functions with one recording (DISCADJ_SEPARATE_OBJECTIVES). ---*/
+
+#ifndef CODI_REVERSE_DIRECTIONS
+#  define CODI_REVERSE_DIRECTIONS 1
+#endif
+
+#if CODI_REVERSE_DIRECTIONS > 1
+#  if CODI_PRIMAL_TAPE || CODI_PRIMAL_INDEX_TAPE
+#    error "The vector reverse mode is only implemented for the Jacobian tapes."
+#  endif
+#  if CODI_INDEX_TAPE
+  typedef codi::RealReverseIndexVec<CODI_REVERSE_DIRECTIONS> su2double;
+#  else
+  typedef codi::RealReverseVec<CODI_REVERSE_DIRECTIONS> su2double;
+#  endif
+#elif CODI_INDEX_TAPE
   typedef codi::RealReverseIndex su2double;
 #elif CODI_PRIMAL_TAPE
   typedef codi::RealReversePrimal su2double;
@@ -32,6 +32,36 @@ namespace SU2_TYPE{
 
   inline double GetValue(const su2double& data) { return data.getValue();}
 
+#if CODI_REVERSE_DIRECTIONS > 1
+
+  /*--- In vector mode the scalar accessors act on the current direction (see AD::SetDirection). ---*/
+
+  inline void SetSecondary(su2double& data, const double &val) {
+    if (data.isActive()) AD::globalTape.gradient(data.getGradientData())[AD::adjointDirection] = val;
+  }
+
+  inline double GetSecondary(const su2double& data) {
+    return AD::globalTape.getGradient(AD::inputValues[AD::adjointVectorPosition++])[AD::adjointDirection];
+  }
+
+  inline double GetDerivative(const su2double& data) {
+    return AD::globalTape.getGradient(AD::inputValues[AD::adjointVectorPosition++])[AD::adjointDirection];
+  }
+
+  inline void SetDerivative(su2double& data, const double &val) {
+    if (data.isActive()) AD::globalTape.gradient(data.getGradientData())[AD::adjointDirection] = val;
+  }
+
+  inline unsigned short GetnDirections() { return CODI_REVERSE_DIRECTIONS; }
+
+  inline double GetDerivative(const su2double& data, unsigned short iDir) {
+    return AD::globalTape.getGradient(AD::inputValues[AD::adjointVectorPosition++])[iDir];
+  }
+
+  inline void SetDerivative(su2double& data, unsigned short iDir, const double &val) {
+    if (data.isActive()) AD::globalTape.gradient(data.getGradientData())[iDir] = val;
+  }
+#else
   inline void SetSecondary(su2double& data, const double &val) {data.setGradient(val);}
 
   inline double GetSecondary(const su2double& data) { return AD::globalTape.getGradient(AD::inputValues[AD::adjointVectorPosition++]);}
@@ -39,6 +69,13 @@ namespace SU2_TYPE{
   inline double GetDerivative(const su2double& data) { return AD::globalTape.getGradient(AD::inputValues[AD::adjointVectorPosition++]);}
 
   inline void SetDerivative(su2double& data, const double &val) {data.setGradient(val);}
+
+  inline unsigned short GetnDirections() { return 1; }
+
+  inline double GetDerivative(const su2double& data, unsigned short iDir) { return (iDir == 0)? GetDerivative(data) : 0.0;}
+
+  inline void SetDerivative(su2double& data, unsigned short iDir, const double &val) { if (iDir == 0) SetDerivative(data, val);}
+#endif
 }
 
 /*--- Object for the definition of getValue used in the printfOver definition.
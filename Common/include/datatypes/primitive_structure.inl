@@ -39,4 +39,10 @@ namespace SU2_TYPE{
   inline double GetSecondary(const double& data) { return 0.0;}
 
   inline void SetDerivative(double &data, const double &val) {}
+
+  inline unsigned short GetnDirections() { return 1; }
+
+  inline double GetDerivative(const double& data, unsigned short iDir) { return 0.0;}
+
+  inline void SetDerivative(double &data, unsigned short iDir, const double &val) {}
 }
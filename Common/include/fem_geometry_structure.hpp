@@ -503,6 +503,12 @@ public:
   vector<vector<su2double> > matWallFunctionDonor;  /*!< \brief Matrices, which store the interpolation coefficients
                                                                 for the donors of the integration points.*/
 
+  mutable vector<su2double> wallModelData;     /*!< \brief Wall shear stress, heat flux, viscosity and conductivity
+                                                           over Cv of the wall model in the integration points (working
+                                                           memory). Used as initial guess and when the model is frozen. */
+  mutable unsigned long nWallModelEvaluations; /*!< \brief Number of times the wall treatment of this face has been
+                                                           carried out (working memory). */
+
   /*!
    * \brief Constructor of the class. Initialize some variables.
    */
@@ -1050,6 +1056,12 @@ public:
    */
   long GetGlobal_to_Local_Point(unsigned long val_ipoint) const override;
 
+  /*!
+   * \brief Get the map from the global to the local index of the owned DOFs.
+   * \return The map, ordered by global index (which is also the order of the DOFs in the restart files).
+   */
+  const map<unsigned long, unsigned long>& GetGlobal_to_Local_Map() const override;
+
   /*!
    * \brief Function, which carries out the preprocessing tasks when wall functions are used.
    * \param[in] config - Definition of the particular problem.
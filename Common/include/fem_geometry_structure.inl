@@ -84,7 +84,7 @@ inline CInternalFaceElementFEM::CInternalFaceElementFEM(const CInternalFaceEleme
 
 inline CInternalFaceElementFEM& CInternalFaceElementFEM::operator=(const CInternalFaceElementFEM &other) { Copy(other); return (*this); }
 
-inline CSurfaceElementFEM::CSurfaceElementFEM(void) {indStandardElement = -1;}
+inline CSurfaceElementFEM::CSurfaceElementFEM(void) {indStandardElement = -1; nWallModelEvaluations = 0;}
 
 inline CSurfaceElementFEM::~CSurfaceElementFEM(void) { }
 
@@ -161,6 +161,10 @@ inline long CMeshFEM_DG::GetGlobal_to_Local_Point(unsigned long val_ipoint) cons
   return -1;
 }
 
+inline const map<unsigned long, unsigned long>& CMeshFEM_DG::GetGlobal_to_Local_Map() const {
+  return Global_to_Local_Point;
+}
+
 inline su2double* CMeshFEM_DG::GetTimeCoefADER_DG(void) {return timeCoefADER_DG.data();}
 
 inline su2double* CMeshFEM_DG::GetTimeInterpolDOFToIntegrationADER_DG(void) {return timeInterpolDOFToIntegrationADER_DG.data();}
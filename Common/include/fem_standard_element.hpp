@@ -36,6 +36,8 @@
 
 using namespace std;
 
+class CBlasStructure;
+
 /*!
  * \class CFEMStandardElementBase
  * \brief Base class for a FEM standard element.
@@ -841,6 +843,17 @@ private:
                                                           Used for plotting. */
   vector<unsigned short> subConn2ForPlotting; /*!< \brief Local subconnectivity of element type 2 of the high order element.
                                                           Used for plotting. */
+
+  bool sumFactorization = false; /*!< \brief Whether or not the volume terms are computed with sum factorization, which
+                                             is possible for quadrilaterals and hexahedra, because both the basis
+                                             functions and the integration rule are tensor products of 1D ones. */
+  unsigned short nDOFs1D = 0;    /*!< \brief Number of DOFs in one direction of a tensor product element. */
+  unsigned short nInt1D  = 0;    /*!< \brief Number of integration points in one direction of a tensor product element. */
+
+  vector<su2double> lagBasisInt1D;         /*!< \brief 1D Lagrangian basis functions in the 1D integration points (row major). */
+  vector<su2double> derLagBasisInt1D;      /*!< \brief Derivatives of the 1D Lagrangian basis functions in the 1D integration points. */
+  vector<su2double> lagBasisInt1DTrans;    /*!< \brief Transpose of lagBasisInt1D. */
+  vector<su2double> derLagBasisInt1DTrans; /*!< \brief Transpose of derLagBasisInt1D. */
 public:
   /*!
   * \brief Standard Constructor. Nothing to be done.
@@ -1032,6 +1045,80 @@ public:
   */
   unsigned short GetNPoly(void) const;
 
+  /*!
+  * \brief Function, which indicates whether or not the sum factorization kernels must be used
+           for the volume terms of this standard element.
+  * \return  True for quadrilaterals and hexahedra of a high enough polynomial degree.
+  */
+  bool GetSumFactorization(void) const;
+
+  /*!
+  * \brief Function, which makes available the size of the work array of the sum factorization
+           kernels, per column of the matrices (i.e. it must be multiplied by N).
+  * \return  The size of the work array per column.
+  */
+  unsigned long GetSizeWorkSumFactorization(void) const;
+
+  /*!
+  * \brief Function, which computes the solution and, if desired, its parametric derivatives
+           in the integration points by sum factorization. The result is the same as the
+           product of GetMatBasisFunctionsIntegration() and the solution in the DOFs.
+  * \param[in]  N             - Number of columns of the matrices, i.e. the padded
+                                 number of variables of the chunk of elements.
+  * \param[in]  computeGrad   - Whether or not the parametric derivatives must be computed.
+  * \param[in]  solDOFs       - The solution in the DOFs, row major nDOFs x N.
+  * \param[out] solAndGradInt - The solution in the integration points, followed by the
+                                 r-, s- and t-derivatives if computeGrad is true, each
+                                 stored as a row major nIntegration x N block.
+  * \param[in]  work          - Work array of size GetSizeWorkSumFactorization()*N.
+  * \param[in]  blasFunctions - Object to carry out the matrix products.
+  * \param[in]  config        - Object, which contains the input parameters (profiling).
+  */
+  void SumFactSolAndGradIntegration(const unsigned short N,
+                                    const bool           computeGrad,
+                                    const su2double      *solDOFs,
+                                    su2double            *solAndGradInt,
+                                    su2double            *work,
+                                    CBlasStructure       *blasFunctions,
+                                    CConfig              *config) const;
+
+  /*!
+  * \brief Function, which computes the volume residual from the fluxes in the integration
+           points by sum factorization. The result is the same as the product of
+           GetDerMatBasisFunctionsIntTrans() and the fluxes.
+  * \param[in]  N             - Number of columns of the matrices.
+  * \param[in]  fluxes        - The fluxes in the parametric directions in the integration
+                                 points, the fluxes of an integration point are contiguous.
+  * \param[out] res           - The residual in the DOFs, row major nDOFs x N.
+  * \param[in]  work          - Work array of size GetSizeWorkSumFactorization()*N.
+  * \param[in]  blasFunctions - Object to carry out the matrix products.
+  * \param[in]  config        - Object, which contains the input parameters (profiling).
+  */
+  void SumFactResidualFluxes(const unsigned short N,
+                             const su2double      *fluxes,
+                             su2double            *res,
+                             su2double            *work,
+                             CBlasStructure       *blasFunctions,
+                             CConfig              *config) const;
+
+  /*!
+  * \brief Function, which computes the volume residual from the source terms in the integration
+           points by sum factorization. The result is the same as the product of
+           GetBasisFunctionsIntegrationTrans() and the source terms.
+  * \param[in]  N             - Number of columns of the matrices.
+  * \param[in]  sources       - The source terms in the integration points, row major nIntegration x N.
+  * \param[out] res           - The residual in the DOFs, row major nDOFs x N.
+  * \param[in]  work          - Work array of size GetSizeWorkSumFactorization()*N.
+  * \param[in]  blasFunctions - Object to carry out the matrix products.
+  * \param[in]  config        - Object, which contains the input parameters (profiling).
+  */
+  void SumFactResidualSources(const unsigned short N,
+                              const su2double      *sources,
+                              su2double            *res,
+                              su2double            *work,
+                              CBlasStructure       *blasFunctions,
+                              CConfig              *config) const;
+
   /*!
    * \brief Function, which makes available the type of the element in subConn1ForPlotting.
    * \return  The type of the elements in subConn1ForPlotting using the VTK convention.
@@ -1167,6 +1254,39 @@ private:
                                                       vector<su2double> &lagBasis,
                                                       vector<su2double> &matDerBasis);
   /*!
+  * \brief Function, which creates the 1D data for the sum factorization of a quadrilateral
+           or hexahedron and checks it against the data of the full element.
+  */
+  void CreateDataSumFactorization(void);
+
+  /*!
+  * \brief Function, which applies a 1D matrix in every direction of a tensor product
+           element, starting with the last direction.
+  * \param[in]  N             - Number of columns of the data.
+  * \param[in]  nOut          - Number of rows of the 1D matrices.
+  * \param[in]  nIn           - Number of columns of the 1D matrices.
+  * \param[in]  matR          - 1D matrix in r-direction, row major nOut x nIn.
+  * \param[in]  matS          - 1D matrix in s-direction.
+  * \param[in]  matT          - 1D matrix in t-direction, only used in 3D.
+  * \param[in]  dataIn        - Input data, nIn^nDim x N, with the r-index running fastest.
+  * \param[out] dataOut       - Output data, nOut^nDim x N.
+  * \param[in]  work          - Work array.
+  * \param[in]  blasFunctions - Object to carry out the matrix products.
+  * \param[in]  config        - Object, which contains the input parameters (profiling).
+  */
+  void SumFactTensorProduct(const unsigned short N,
+                            const unsigned short nOut,
+                            const unsigned short nIn,
+                            const su2double      *matR,
+                            const su2double      *matS,
+                            const su2double      *matT,
+                            const su2double      *dataIn,
+                            su2double            *dataOut,
+                            su2double            *work,
+                            CBlasStructure       *blasFunctions,
+                            CConfig              *config) const;
+
+  /*!
   * \brief Function, which creates all the data for a line element.
   */
   void DataStandardLine(void);
@@ -87,6 +87,8 @@ inline unsigned short CFEMStandardElement::GetNDOFs(void) const {return nDOFs;}
 
 inline unsigned short CFEMStandardElement::GetNPoly(void) const {return nPoly;}
 
+inline bool CFEMStandardElement::GetSumFactorization(void) const {return sumFactorization;}
+
 inline unsigned short CFEMStandardElement::GetVTK_Type1(void) const {return VTK_Type1;}
 
 inline unsigned short CFEMStandardElement::GetNSubElemsType1(void) const {return subConn1ForPlotting.size()/GetNDOFsPerSubElem(GetVTK_Type1());}
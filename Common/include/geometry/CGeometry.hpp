@@ -110,7 +110,7 @@ protected:
   unsigned short nMarker;       /*!< \brief Number of different markers of the mesh. */
   unsigned short nCommLevel;    /*!< \brief Number of non-blocking communication levels. */
 
-  unsigned short MGLevel;        /*!< \brief The mesh level index for the current geometry container. */
+  unsigned short MGLevel = MESH_0; /*!< \brief The mesh level index for the current geometry container. */
   unsigned long Max_GlobalPoint; /*!< \brief Greater global point in the domain local structure. */
 
   /*--- Boundary information. ---*/
@@ -166,21 +166,74 @@ protected:
 
   /*--- Sparsity patterns associated with the geometry. ---*/
 
-  CCompressedSparsePatternUL
+  CCompressedSparsePatternLocal
   finiteVolumeCSRFill0,                  /*!< \brief 0-fill FVM sparsity. */
   finiteVolumeCSRFillN,                  /*!< \brief N-fill FVM sparsity (e.g. for ILUn preconditioner). */
   finiteElementCSRFill0,                 /*!< \brief 0-fill FEM sparsity. */
   finiteElementCSRFillN;                 /*!< \brief N-fill FEM sparsity (e.g. for ILUn preconditioner). */
 
-  CEdgeToNonZeroMapUL edgeToCSRMap;      /*!< \brief Map edges to CSR entries referenced by them (i,j) and (j,i). */
+  CEdgeToNonZeroMapLocal edgeToCSRMap;      /*!< \brief Map edges to CSR entries referenced by them (i,j) and (j,i). */
 
   /*--- Edge and element colorings. ---*/
 
-  CCompressedSparsePatternUL
+  CCompressedSparsePatternLocal
   edgeColoring,                          /*!< \brief Edge coloring structure for thread-based parallelization. */
   elemColoring;                          /*!< \brief Element coloring structure for thread-based parallelization. */
   unsigned long edgeColorGroupSize = 1;  /*!< \brief Size of the edge groups within each color. */
   unsigned long elemColorGroupSize = 1;  /*!< \brief Size of the element groups within each color. */
+  bool edgeColorAutoTune = false;        /*!< \brief Choose the edge group size with a quick benchmark. */
+
+  vector<vector<unsigned long> > linelets; /*!< \brief Lines of points normal to the walls, for the linelet preconditioner. */
+  bool lineletsBuilt = false;              /*!< \brief Whether the linelets have been computed. */
+
+  /*--- Contiguous (structure of arrays) storage of the most used dual grid data,
+   *    the CPoint and CEdge objects reference these containers. ---*/
+
+  su2matrix<su2localidx> edgeNodes;    /*!< \brief Nodes of each edge. */
+  su2activematrix edgeNormal;            /*!< \brief Normal of the dual face of each edge. */
+  su2activematrix edgeCoordCG;           /*!< \brief Center of gravity of each edge. */
+  su2activematrix pointCoord;            /*!< \brief Coordinates of each point. */
+  su2activematrix pointVolume;           /*!< \brief Volume (and time levels) of each control volume. */
+  su2activevector pointWallDistance;     /*!< \brief Wall distance of each point. */
+  su2activematrix edgeGeometry;          /*!< \brief Optional geometric factors of each edge used by the numerics, the edge
+                                                     vector (i to j), its squared length, the area of the dual face, and the
+                                                     product of edge vector and normal over the squared length (nDim+3). */
+  su2vector<bool> edgeHalo;              /*!< \brief Whether each edge has a halo point, i.e. its fluxes depend on halo data. */
+  su2activevector edgeGridFlux;          /*!< \brief Optional projected grid velocity of each edge, the average grid velocity of
+                                                     its points dotted with the normal, for grid velocities that do not change. */
+  su2vector<unsigned long> lsqOffset;    /*!< \brief Position of the first neighbor of each (owned) point in the least-squares weights. */
+  su2activematrix lsqWeights[2];         /*!< \brief Optional least-squares gradient weights of each neighbor (nDim), unweighted and
+                                                     inverse-distance weighted, the gradient is the sum of weights times differences. */
+  bool lsqWeightsValid[2] = {false, false}; /*!< \brief Whether the least-squares weights correspond to the current coordinates. */
+  CCompressedSparsePatternUL childrenCV; /*!< \brief Children (fine grid points) of each agglomerated control volume. */
+
+  /*--- Element neighbourhoods of the density filters (topology optimization), they only depend on the mesh. ---*/
+
+  vector<CCompressedSparsePatternUL> filterNeighbours;  /*!< \brief Global indices of the elements within the filter radius of each element. */
+  vector<pair<passivedouble,unsigned short> > filterNeighboursKey; /*!< \brief Radius and search limit of each set of neighbourhoods. */
+
+  vector<bool> dualGridChanged;          /*!< \brief Points whose dual grid changed since the next coarser level was updated. */
+  su2double rigidMotion[3][4] = {{0.0}}; /*!< \brief Rigid motion (rotation matrix and translation) of all the points since the
+                                                     next coarser level was updated. */
+  bool rigidMotionPending = false;       /*!< \brief Whether the points moved rigidly since the next coarser level was updated. */
+
+  /*!
+   * \brief Rotate the normals of the dual faces of the edges and of the boundary vertices (rigid motion).
+   * \param[in] rotMatrix - Rotation matrix.
+   */
+  void RotateDualGrid(const su2double rotMatrix[][3]);
+
+  /*!
+   * \brief Compose a rigid motion with the one since the next coarser level was updated.
+   * \param[in] rotMatrix - Rotation matrix.
+   * \param[in] translation - Translation vector.
+   */
+  void AddRigidMotion(const su2double rotMatrix[][3], const su2double *translation);
+
+  /*!
+   * \brief Move the coordinates, volumes, and wall distances of the points to contiguous storage.
+   */
+  void SetPointStorage(void);
 
 public:
   /*--- Main geometric elements of the grid. ---*/
@@ -224,6 +277,26 @@ public:
   unsigned short *bufS_P2PSend;          /*!< \brief Data structure for unsigned long point-to-point send. */
   SU2_MPI::Request *req_P2PSend;         /*!< \brief Data structure for point-to-point send requests. */
   SU2_MPI::Request *req_P2PRecv;         /*!< \brief Data structure for point-to-point recv requests. */
+  unsigned short kindP2PComms;           /*!< \brief Implementation of the point-to-point comms (see ENUM_P2P_COMMS). */
+  vector<SU2_MPI::Request>
+  persReq_P2PSend[2][2],                 /*!< \brief Persistent send requests, by data type (su2double or not) and direction (reverse or not). */
+  persReq_P2PRecv[2][2];                 /*!< \brief Persistent recv requests, by data type (su2double or not) and direction (reverse or not). */
+#ifdef HAVE_MPI_NEIGHBOR
+  SU2_MPI::Comm comm_P2PNeighbor[2];     /*!< \brief Graph communicators of the neighbors for forward and reverse point-to-point comms. */
+  SU2_MPI::Request req_P2PNeighbor;      /*!< \brief Request of the neighborhood collective point-to-point comms. */
+  vector<int> counts_P2PNeighbor;        /*!< \brief Send counts, send displacements, recv counts, and recv displacements of the collective. */
+  int iMessage_P2PNeighbor;              /*!< \brief Next message returned by WaitAnyP2PRecv for the neighborhood collective. */
+#endif
+#ifdef HAVE_MPI_P2P_EXTFUNC
+  vector<passivedouble> bufP_P2PSend,    /*!< \brief Passive copy of the su2double send buffer for the comms taped as external functions. */
+  bufP_P2PRecv;                          /*!< \brief Passive copy of the su2double recv buffer for the comms taped as external functions. */
+  vector<CBaseMPIWrapper::Request>
+  reqP_P2PSend,                          /*!< \brief Send requests of the passive comms. */
+  reqP_P2PRecv;                          /*!< \brief Recv requests of the passive comms. */
+  bool extFunc_P2P;                      /*!< \brief Whether the current exchange is taped as an external function. */
+  bool reverse_P2P;                      /*!< \brief Direction of the current exchange. */
+  int iMessage_P2PExtFunc;               /*!< \brief Next message returned by WaitAnyP2PRecv for the passive comms. */
+#endif
 
   /*--- Data structures for periodic communications. ---*/
 
@@ -236,6 +309,8 @@ public:
   int *Neighbors_PeriodicRecv;           /*!< \brief Data structure holding the ranks of the neighbors for periodic recv comms. */
   map<int, int> PeriodicSend2Neighbor;   /*!< \brief Data structure holding the reverse mapping of the ranks of the neighbors for periodic send comms. */
   map<int, int> PeriodicRecv2Neighbor;   /*!< \brief Data structure holding the reverse mapping of the ranks of the neighbors for periodic recv comms. */
+  int iPeriodicSendSelf = -1;            /*!< \brief Index of the periodic send to this rank (copied without MPI), -1 if none. */
+  int iPeriodicRecvSelf = -1;            /*!< \brief Index of the periodic recv from this rank (copied without MPI), -1 if none. */
   unsigned long
   *Local_Point_PeriodicSend,             /*!< \brief Data structure holding the local index of all vertices to be sent in periodic comms. */
   *Local_Point_PeriodicRecv,             /*!< \brief Data structure holding the local index of all vertices to be received in periodic comms. */
@@ -278,6 +353,51 @@ public:
    */
   void PreprocessP2PComms(CGeometry *geometry, CConfig *config);
 
+  /*!
+   * \brief Create the persistent point-to-point requests for a data type and direction of the comms.
+   * \note The requests depend on the buffers, they are freed when these are reallocated.
+   * \param[in] commType - Enumerated type for the quantity to be communicated.
+   * \param[in] val_reverse  - Boolean controlling forward or reverse communication between neighbors.
+   */
+  void SetPersistentP2PComms(unsigned short commType, bool val_reverse);
+
+  /*!
+   * \brief Free all the persistent point-to-point requests.
+   */
+  void FreePersistentP2PComms();
+
+  /*!
+   * \brief Start the neighborhood collective that performs all the point-to-point comms.
+   * \param[in] commType - Enumerated type for the quantity to be communicated.
+   * \param[in] val_reverse  - Boolean controlling forward or reverse communication between neighbors.
+   */
+  void StartP2PNeighborComms(unsigned short commType, bool val_reverse);
+
+#ifdef HAVE_MPI_P2P_EXTFUNC
+  /*!
+   * \brief Post the passive recvs of all the point-to-point messages.
+   * \param[in] val_reverse - Boolean controlling forward or reverse communication between neighbors.
+   * \param[in] val_countPerPoint - Count of the data per vertex that the buffers were laid out with.
+   */
+  void PostP2PPassiveRecvs(bool val_reverse, int val_countPerPoint);
+
+  /*!
+   * \brief Post the passive send of one point-to-point message.
+   * \param[in] val_iSend - Index of the message in the order they are stored.
+   * \param[in] val_reverse - Boolean controlling forward or reverse communication between neighbors.
+   * \param[in] val_countPerPoint - Count of the data per vertex that the buffers were laid out with.
+   */
+  void PostP2PPassiveSend(int val_iSend, bool val_reverse, int val_countPerPoint);
+
+  /*!
+   * \brief Reverse of an exchange taped as an external function, the adjoints of the received
+   *        values are sent back (in the opposite direction) and become those of the sent values.
+   */
+  static void P2PComms_b(const codi::RealReverse::Real* x, codi::RealReverse::Real* x_b, size_t m,
+                         const codi::RealReverse::Real* y, const codi::RealReverse::Real* y_b, size_t n,
+                         codi::DataStore* d);
+#endif
+
   /*!
    * \brief Routine to allocate buffers for point-to-point MPI communications. Also called to dynamically reallocate if not enough memory is found for comms during runtime.
    * \param[in] val_countPerPoint - Maximum count of the data type per vertex in point-to-point comms, e.g., nPrimvarGrad*nDim.
@@ -305,6 +425,20 @@ public:
    */
   void PostP2PSends(CGeometry *geometry, CConfig *config, unsigned short commType, int val_iMessage, bool val_reverse);
 
+  /*!
+   * \brief Wait for any of the point-to-point recvs posted by PostP2PRecvs to complete.
+   * \note The messages are returned in arrival order for non-blocking and persistent comms,
+   *       and in order (once all have arrived) for the neighborhood collective and the comms
+   *       taped as external functions (the whole exchange is taped when the first is requested).
+   * \return Index of the message (in the order they are stored) that was received.
+   */
+  int WaitAnyP2PRecv();
+
+  /*!
+   * \brief Wait for all the point-to-point sends posted by PostP2PSends to complete.
+   */
+  void WaitAllP2PSends();
+
   /*!
    * \brief Routine to set up persistent data structures for periodic communications.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -337,6 +471,16 @@ public:
    */
   void PostPeriodicSends(CGeometry *geometry, CConfig *config, unsigned short commType, int val_iMessage);
 
+  /*!
+   * \brief Number of periodic sends that go through MPI, i.e. the active requests in req_PeriodicSend.
+   */
+  inline int GetnPeriodicSendMPI() const { return nPeriodicSend - (iPeriodicSendSelf >= 0); }
+
+  /*!
+   * \brief Number of periodic recvs that go through MPI, i.e. the active requests in req_PeriodicRecv.
+   */
+  inline int GetnPeriodicRecvMPI() const { return nPeriodicRecv - (iPeriodicRecvSelf >= 0); }
+
   /*!
    * \brief Routine to load a geometric quantity into the data structures for MPI point-to-point communication and to
    *        launch non-blocking sends and recvs for all point-to-point communication with neighboring partitions.
@@ -402,6 +546,160 @@ public:
    */
   inline unsigned long GetnEdge(void) const {return nEdge;}
 
+  /*!
+   * \brief Get a node of an edge (contiguous storage, prefer it over edge[iEdge]->GetNode(iNode) in hot loops).
+   * \param[in] iEdge - Edge index.
+   * \param[in] iNode - 0 or 1.
+   * \return Point index.
+   */
+  inline unsigned long GetEdgeNode(unsigned long iEdge, unsigned short iNode) const {return edgeNodes(iEdge,iNode);}
+
+  /*!
+   * \brief Get the normal of the dual face of an edge (contiguous storage).
+   * \param[in] iEdge - Edge index.
+   * \return Pointer to nDim components, the modulus is the area of the face.
+   */
+  inline su2double* GetEdgeNormal(unsigned long iEdge) {return edgeNormal[iEdge];}
+  inline const su2double* GetEdgeNormal(unsigned long iEdge) const {return edgeNormal[iEdge];}
+
+  /*!
+   * \brief Get the coordinates of a point (contiguous storage).
+   * \param[in] iPoint - Point index.
+   * \return Pointer to nDim coordinates.
+   */
+  inline su2double* GetPointCoord(unsigned long iPoint) {return pointCoord[iPoint];}
+  inline const su2double* GetPointCoord(unsigned long iPoint) const {return pointCoord[iPoint];}
+
+  /*!
+   * \brief Compute the geometric factors of the edges, if they are stored (see EDGE_GEOMETRY_CACHE).
+   * \note Called when the dual grid is (re)computed, to be called by a single thread.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetEdgeGeometry(const CConfig *config);
+
+  /*!
+   * \brief Recompute the stored geometric factors of the edges (e.g. after the points move), nothing if not stored.
+   */
+  void UpdateEdgeGeometry(void);
+
+  /*!
+   * \brief Recompute the stored geometric factors of the edges with at least one flagged point, nothing if not stored.
+   * \param[in] pointMask - Flag of each point, e.g. whether it moved or its control volume changed.
+   */
+  void UpdateEdgeGeometry(const vector<bool>& pointMask);
+
+  /*!
+   * \brief Store the projected grid velocity of the edges, for grid velocities that are set once (steadily
+   *        rotating frame, steady translation), such that the edge loops do not gather them for each edge.
+   * \note To be called by a single thread, after the grid velocities are set, and again if they change.
+   *       Not stored in AD builds, the normals are recomputed when the geometry is recorded.
+   */
+  void SetEdgeGridFlux(void);
+
+  /*!
+   * \brief Get the stored projected grid velocity of an edge.
+   * \param[in] iEdge - Edge index.
+   * \return Pointer to the average grid velocity of the points dotted with the normal, or nullptr if not stored.
+   */
+  inline const su2double* GetEdgeGridFlux(unsigned long iEdge) const {
+    return edgeGridFlux.empty()? nullptr : &edgeGridFlux(iEdge);
+  }
+
+  /*!
+   * \brief Classify the edges as interior (both points owned by the rank) or halo, nothing if already done.
+   * \note To be called by a single thread.
+   */
+  void SetEdgeHalo(void);
+
+  /*!
+   * \brief Get whether an edge has a halo point (see SetEdgeHalo).
+   * \param[in] iEdge - Edge index.
+   * \return True if the fluxes of the edge depend on halo data.
+   */
+  inline bool GetEdgeHalo(unsigned long iEdge) const { return edgeHalo(iEdge); }
+
+  /*!
+   * \brief Allocate the least-squares gradient weights required by the gradient methods (see LEAST_SQUARES_CACHE),
+   *        and mark them as invalid, they are stored by the first gradient computation.
+   * \note Called when the dual grid is (re)computed, i.e. whenever the points move, to be called by a single thread.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetLeastSquaresWeights(const CConfig *config);
+
+  /*!
+   * \brief Get the least-squares gradient weights of the neighbors of a point.
+   * \param[in] weighted - Inverse-distance weighted or unweighted least-squares.
+   * \param[in] iPoint - Point index (owned point).
+   * \return Weights of each neighbor, nDim per neighbor in the order of CPoint::GetPoint, or nullptr if not stored.
+   */
+  inline su2double* GetLeastSquaresWeights(bool weighted, unsigned long iPoint) {
+    return lsqWeights[weighted].empty()? nullptr : lsqWeights[weighted][lsqOffset(iPoint)];
+  }
+
+  /*!
+   * \brief Get whether the stored least-squares weights correspond to the current coordinates.
+   * \param[in] weighted - Inverse-distance weighted or unweighted least-squares.
+   */
+  inline bool GetLeastSquaresWeightsValid(bool weighted) const { return lsqWeightsValid[weighted]; }
+
+  /*!
+   * \brief Mark the least-squares weights as computed for the current coordinates.
+   * \param[in] weighted - Inverse-distance weighted or unweighted least-squares.
+   */
+  inline void SetLeastSquaresWeightsValid(bool weighted) { lsqWeightsValid[weighted] = !lsqWeights[weighted].empty(); }
+
+  /*!
+   * \brief Build the compressed (CSR) map of the children of each control volume from the CPoint data.
+   * \note Called once the agglomeration of a multigrid level is complete.
+   */
+  void SetChildren_CSR(void);
+
+  /*!
+   * \brief Get the compressed map of the children of each control volume (outer index is the coarse point).
+   * \return Reference to the map.
+   */
+  inline const CCompressedSparsePatternUL& GetChildren_CSR(void) const { return childrenCV; }
+
+  /*!
+   * \brief Get the stored geometric factors of an edge.
+   * \param[in] iEdge - Edge index.
+   * \return Edge vector (nDim), squared length, area, and edge vector dot normal over squared length,
+   *         or nullptr if the factors are not stored (the numerics compute them).
+   */
+  inline const su2double* GetEdgeGeometry(unsigned long iEdge) const {
+    return edgeGeometry.empty()? nullptr : edgeGeometry[iEdge];
+  }
+
+  /*!
+   * \brief Get the vector from the first point of an edge to its midpoint (MUSCL reconstruction).
+   * \param[in] iEdge - Edge index.
+   * \param[out] Vector_ij - Half of the edge vector (nDim).
+   */
+  inline void GetEdgeHalfVector(unsigned long iEdge, su2double *Vector_ij) const {
+    if (!edgeGeometry.empty()) {
+      for (unsigned short iDim = 0; iDim < nDim; iDim++)
+        Vector_ij[iDim] = 0.5*edgeGeometry(iEdge,iDim);
+    }
+    else {
+      const su2double* Coord_i = pointCoord[edgeNodes(iEdge,0)];
+      const su2double* Coord_j = pointCoord[edgeNodes(iEdge,1)];
+      for (unsigned short iDim = 0; iDim < nDim; iDim++)
+        Vector_ij[iDim] = 0.5*(Coord_j[iDim] - Coord_i[iDim]);
+    }
+  }
+
+  /*!
+   * \brief Get the volume of the control volume of a point (contiguous storage).
+   * \param[in] iPoint - Point index.
+   */
+  inline su2double GetPointVolume(unsigned long iPoint) const {return pointVolume(iPoint,0);}
+
+  /*!
+   * \brief Get the wall distance of a point (contiguous storage).
+   * \param[in] iPoint - Point index.
+   */
+  inline su2double GetPointWallDistance(unsigned long iPoint) const {return pointWallDistance(iPoint);}
+
   /*!
    * \brief Get number of markers.
    * \return Number of markers.
@@ -598,6 +896,12 @@ public:
    */
   inline virtual void SetRCM_Ordering(CConfig *config) {}
 
+  /*!
+   * \brief Orders the points along a space-filling curve.
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline virtual void SetSFC_Ordering(CConfig *config) {}
+
   /*!
    * \brief Connects elements  .
    */
@@ -605,6 +909,7 @@ public:
 
   /*!
    * \brief Sets the edges of an elemment.
+   * \note The point data is also moved to contiguous storage as this starts the construction of the dual grid.
    */
   void SetEdges(void);
 
@@ -684,6 +989,41 @@ public:
    */
   inline virtual void SetControlVolume(CConfig *config, unsigned short action) {}
 
+  /*!
+   * \brief Update the dual grid (CGs, control volumes, boundary control volumes, max length) after the points move,
+   *        only the parts of the dual grid that depend on displaced points are recomputed.
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline virtual void UpdateDualGrid(CConfig *config) {}
+
+  /*!
+   * \brief Get the points whose dual grid changed since the next coarser level was updated (see UpdateDualGrid).
+   */
+  inline const vector<bool>& GetDualGridChanged(void) const { return dualGridChanged; }
+
+  /*!
+   * \brief Mark the dual grid of all points as unchanged, once the next coarser level is updated.
+   */
+  inline void ClearDualGridChanged(void) { dualGridChanged.assign(nPoint, false); rigidMotionPending = false; }
+
+  /*!
+   * \brief Update the dual grid after a rigid motion of all the points, x_new = R x_old + b, by rotating the normals,
+   *        keeping the volumes, and recomputing the CGs (instead of recomputing the entire dual grid).
+   * \note The points are moved by the caller, the coarse levels follow in UpdateDualGrid(config, fine_grid).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] rotMatrix - Rotation matrix (R).
+   * \param[in] translation - Translation vector (b).
+   */
+  inline virtual void SetRigidMotion(CConfig *config, const su2double rotMatrix[][3], const su2double *translation) {}
+
+  /*!
+   * \brief Get the rigid motion of the points since the next coarser level was updated (see SetRigidMotion).
+   * \param[out] rotMatrix - Rotation matrix.
+   * \param[out] translation - Translation vector.
+   * \return True if there was a rigid motion.
+   */
+  bool GetRigidMotion(su2double rotMatrix[][3], su2double *translation) const;
+
   /*!
    * \brief A virtual member.
    * \param[in] config - Definition of the particular problem.
@@ -760,6 +1100,12 @@ public:
    */
   inline virtual void SetColorFEMGrid_Parallel(CConfig *config) {}
 
+  /*!
+   * \brief A virtual member.
+   * \return Whether or not the polynomial degree of at least one element was decreased.
+   */
+  inline virtual bool DecreasePolySolFEM(void) { return false; }
+
   /*!
    * \brief A virtual member.
    * \param[in] config - Definition of the particular problem.
@@ -839,6 +1185,14 @@ public:
    */
   inline virtual void SetBoundControlVolume(CConfig *config, CGeometry *geometry, unsigned short action) {}
 
+  /*!
+   * \brief Update the dual grid of an agglomerated level (control volumes, boundary control volumes, coordinates)
+   *        after the finer level changed, only the parents of changed fine points are recomputed.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the finer level.
+   */
+  inline virtual void UpdateDualGrid(CConfig *config, CGeometry *geometry) {}
+
   /*!
    * \brief A virtual member.
    * \param[in] config - Definition of the particular problem.
@@ -899,6 +1253,12 @@ public:
    */
   inline virtual void SetRestricted_GridVelocity(CGeometry *fine_mesh, CConfig *config) {}
 
+  /*!
+   * \brief A virtual member.
+   * \param[in] fine_mesh - Geometry of the fine mesh.
+   */
+  inline virtual void SetRestricted_WallDistance(const CGeometry *fine_mesh) {}
+
   /*!
    * \brief Check if a boundary is straight(2D) / plane(3D) for EULER_WALL and SYMMETRY_PLANE
    *        only and store the information in bound_is_straight. For all other boundary types
@@ -927,6 +1287,41 @@ public:
                               vector<su2double> &Zcoord_Airfoil, vector<su2double> &Variable_Airfoil,
                               bool original_surface, CConfig *config);
 
+  /*!
+   * \brief Compute the sections of the surface (markers of GEO_MARKER) by several planes at once.
+   * \details The elements of the surface are prepared once for all the planes, and if the planes are
+   *          parallel they are indexed in a bucket list along the normal, so that each plane only visits
+   *          the elements it can cut. The planes are cut concurrently by the threads, the segments of all
+   *          the planes are gathered on the master node in one communication, and their curves are sorted
+   *          concurrently by the threads of the master node (no pairwise comparison of the segments).
+   *          The operations are recorded if the AD tape is active (the gather is differentiated by the AD MPI
+   *          wrapper), SU2_GEO_AD evaluates the gradients of the geometrical functions this way.
+   * \param[in] nPlane - Number of planes.
+   * \param[in] Plane_P0 - Point of each plane.
+   * \param[in] Plane_Normal - Normal of each plane.
+   * \param[in] MinXCoord - Minimum X coordinate of the elements (average of their nodes).
+   * \param[in] MaxXCoord - Maximum X coordinate of the elements.
+   * \param[in] MinYCoord - Minimum Y coordinate of the elements.
+   * \param[in] MaxYCoord - Maximum Y coordinate of the elements.
+   * \param[in] MinZCoord - Minimum Z coordinate of the elements.
+   * \param[in] MaxZCoord - Maximum Z coordinate of the elements.
+   * \param[in] FlowVariable - Variable of each point interpolated along the sections (or NULL).
+   * \param[out] Xcoord_Airfoil - X coordinates of each section (master node).
+   * \param[out] Ycoord_Airfoil - Y coordinates of each section (master node).
+   * \param[out] Zcoord_Airfoil - Z coordinates of each section (master node).
+   * \param[out] Variable_Airfoil - Variable along each section (master node).
+   * \param[in] original_surface - Whether the original surface is cut, otherwise the deformed one.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeAirfoil_Sections(unsigned short nPlane, su2double **Plane_P0, su2double **Plane_Normal,
+                               su2double MinXCoord, su2double MaxXCoord,
+                               su2double MinYCoord, su2double MaxYCoord,
+                               su2double MinZCoord, su2double MaxZCoord,
+                               su2double *FlowVariable,
+                               vector<su2double> *Xcoord_Airfoil, vector<su2double> *Ycoord_Airfoil,
+                               vector<su2double> *Zcoord_Airfoil, vector<su2double> *Variable_Airfoil,
+                               bool original_surface, CConfig *config);
+
   /*!
    * \brief A virtual member.
    */
@@ -1060,6 +1455,15 @@ public:
    */
   inline virtual long GetGlobal_to_Local_Point(unsigned long val_ipoint) const { return 0; }
 
+  /*!
+   * \brief A virtual member.
+   * \return Map from the global to the local index of the points of this rank, ordered by global index.
+   */
+  inline virtual const map<unsigned long, unsigned long>& GetGlobal_to_Local_Map() const {
+    static const map<unsigned long, unsigned long> emptyMap;
+    return emptyMap;
+  }
+
   /*!
    * \brief A virtual member.
    * \param[in] val_ipoint - Global marker.
@@ -1272,8 +1676,9 @@ public:
   /*!
    * \brief A virtual member.
    * \param config - Config
+   * \param val_obj - Index of the objective function (separate adjoint objectives), -1 for the combined objective.
    */
-  inline virtual void SetSensitivity(CConfig *config) {}
+  inline virtual void SetSensitivity(CConfig *config, short val_obj = -1) {}
 
   /*!
    * \brief A virtual member.
@@ -1555,9 +1960,21 @@ public:
    * \param[in] kernels - Kernel types and respective parameter, size of vector defines number of filter recursions.
    * \param[in] search_limit - Max degree of neighborhood considered for neighbor search, avoids excessive work in fine regions.
    * \param[in,out] values - On entry, the "raw" values, on exit, the filtered values.
+   * \note The neighbourhoods are computed on the first call and reused afterwards, the mesh is assumed fixed.
    */
   void FilterValuesAtElementCG(const vector<su2double> &filter_radius, const vector<pair<unsigned short,su2double> > &kernels,
-                               const unsigned short search_limit, su2double *values) const;
+                               const unsigned short search_limit, su2double *values);
+
+  /*!
+   * \brief Get the radial neighbourhoods of all the (local) elements, computed on the first request and then cached.
+   *        Used by FilterValuesAtElementCG, the weights of the filters are not cached to keep them differentiable.
+   * \param[in] radius - Parameter defining the size of the neighbourhood.
+   * \param[in] search_limit - See GetRadialNeighbourhood.
+   * \param[in] cg_elem - Global element centroid coordinates in row major format {x0,y0,x1,y1,...}. Size nDim*nElemDomain.
+   * \return Global indices of the neighbours of each element (the element itself first).
+   */
+  const CCompressedSparsePatternUL& GetFilterNeighbourhood(const passivedouble radius, const unsigned short search_limit,
+                                                           const su2double *cg_elem);
 
   /*!
    * \brief Build the global (entire mesh!) adjacency matrix for the elements in compressed format.
@@ -1621,21 +2038,21 @@ public:
    * \param[in] fillLvl - Level of fill of the pattern.
    * \return Reference to the sparse pattern.
    */
-  const CCompressedSparsePatternUL& GetSparsePattern(ConnectivityType type, unsigned long fillLvl = 0);
+  const CCompressedSparsePatternLocal& GetSparsePattern(ConnectivityType type, unsigned long fillLvl = 0);
 
   /*!
    * \brief Get the edge to sparse pattern map.
    * \note This method builds the map and required pattern (0-fill FVM) if that has not been done yet.
    * \return Reference to the map.
    */
-  const CEdgeToNonZeroMapUL& GetEdgeToSparsePatternMap(void);
+  const CEdgeToNonZeroMapLocal& GetEdgeToSparsePatternMap(void);
 
   /*!
    * \brief Get the transpose of the (main, i.e 0 fill) sparse pattern (e.g. CSR becomes CSC).
    * \param[in] type - Finite volume or finite element.
    * \return Reference to the map.
    */
-  const su2vector<unsigned long>& GetTransposeSparsePatternMap(ConnectivityType type);
+  const su2vector<su2localidx>& GetTransposeSparsePatternMap(ConnectivityType type);
 
   /*!
    * \brief Get the edge coloring.
@@ -1643,13 +2060,21 @@ public:
    * \param[out] efficiency - optional output of the coloring efficiency.
    * \return Reference to the coloring.
    */
-  const CCompressedSparsePatternUL& GetEdgeColoring(su2double* efficiency = nullptr);
+  const CCompressedSparsePatternLocal& GetEdgeColoring(su2double* efficiency = nullptr);
 
   /*!
    * \brief Force the natural (sequential) edge coloring.
    */
   void SetNaturalEdgeColoring();
 
+  /*!
+   * \brief Color the edges with a few group sizes (multiples of the SIMD batches of the edge loops)
+   *        and keep the fastest for a synthetic edge kernel (gather of the nodes and scatter of a flux),
+   *        among those with good coloring efficiency, or the most efficient if none is good.
+   * \param[in] pattern - Edges as a sparse pattern (edge -> nodes).
+   */
+  void TuneEdgeColoring(const CCompressedSparsePatternLocal& pattern);
+
   /*!
    * \brief Get the group size used in edge coloring.
    * \return Group size.
@@ -1662,7 +2087,7 @@ public:
    * \param[out] efficiency - optional output of the coloring efficiency.
    * \return Reference to the coloring.
    */
-  const CCompressedSparsePatternUL& GetElementColoring(su2double* efficiency = nullptr);
+  const CCompressedSparsePatternLocal& GetElementColoring(su2double* efficiency = nullptr);
 
   /*!
    * \brief Force the natural (sequential) element coloring.
@@ -1675,5 +2100,15 @@ public:
    */
   inline unsigned long GetElementColorGroupSize(void) const { return elemColorGroupSize; }
 
+  /*!
+   * \brief Get the linelets, lines of points that start at the walls and follow the strongest coupling
+   *        (largest face area over volume) until an isotropic zone or the boundary of the partition.
+   * \note This method computes the linelets if that has not been done yet, they are shared by the
+   *       solvers of this grid, longest linelets first to balance the work of the threads.
+   * \param[in] config - Definition of the particular problem.
+   * \return Reference to the linelets (local point indices).
+   */
+  const vector<vector<unsigned long> >& GetLinelets(const CConfig *config);
+
 };
 
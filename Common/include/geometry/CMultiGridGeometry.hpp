@@ -37,12 +37,64 @@
  */
 class CMultiGridGeometry final : public CGeometry {
 
+private:
+  /*!
+   * \brief Agglomerate the control volumes of the fine grid (boundary, interior, and halo points).
+   * \param[in] fine_grid - Geometrical definition of the fine grid.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void AgglomerateFineGrid(CGeometry *fine_grid, CConfig *config);
+
+  /*!
+   * \brief Thread-parallel agglomeration of the interior points, groups of seeds with the same color
+   *        are agglomerated simultaneously with their direct neighbors (no indirect agglomeration).
+   * \param[in] fine_grid - Geometrical definition of the fine grid.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in,out] Index_CoarseCV - Number of coarse control volumes.
+   * \return <code>FALSE</code> if the fine grid cannot be colored (nothing is agglomerated).
+   */
+  bool ColoredAgglomeration(CGeometry *fine_grid, CConfig *config, unsigned long &Index_CoarseCV);
+
+  /*!
+   * \brief Get the name of the agglomeration cache file of this rank for a multigrid level.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Level of the multigrid.
+   * \return Name of the cache file.
+   */
+  static string GetAgglomerationCacheName(CConfig *config, unsigned short iMesh);
+
+  /*!
+   * \brief Check (on all ranks) whether the agglomeration cache files can be used, i.e. they were
+   *        written by the same kind of agglomeration of the same fine grid.
+   * \param[in] fine_grid - Geometrical definition of the fine grid.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_filename - Name of the cache file of this rank.
+   * \return <code>TRUE</code> if the cache of every rank is valid.
+   */
+  bool CheckAgglomerationCache(const CGeometry *fine_grid, CConfig *config, const string& val_filename);
+
+  /*!
+   * \brief Write the agglomeration (parents of the fine points, children of the coarse points) to a cache file.
+   * \param[in] fine_grid - Geometrical definition of the fine grid.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_filename - Name of the cache file of this rank.
+   */
+  void WriteAgglomerationCache(const CGeometry *fine_grid, CConfig *config, const string& val_filename) const;
+
+  /*!
+   * \brief Read the agglomeration written in a previous run, replaces the call to AgglomerateFineGrid.
+   * \param[in] fine_grid - Geometrical definition of the fine grid.
+   * \param[in] val_filename - Name of the cache file of this rank.
+   */
+  void ReadAgglomerationCache(CGeometry *fine_grid, const string& val_filename);
+
 public:
   /*--- This is to suppress Woverloaded-virtual, omitting it has no negative impact. ---*/
   using CGeometry::SetVertex;
   using CGeometry::SetMeshFile;
   using CGeometry::SetControlVolume;
   using CGeometry::SetBoundControlVolume;
+  using CGeometry::UpdateDualGrid;
   using CGeometry::SetPoint_Connectivity;
 
   /*!
@@ -141,6 +193,15 @@ public:
    */
   void SetCoord(CGeometry *geometry) override;
 
+  /*!
+   * \brief Update the dual grid after the finer level changed, the volumes, edge normals, boundary normals, and
+   *        coordinates of the parents of changed fine points are recomputed (the same as SetControlVolume,
+   *        SetBoundControlVolume, and SetCoord, which are used in AD builds).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   */
+  void UpdateDualGrid(CConfig *config, CGeometry *geometry) override;
+
   /*!
    * \brief Set a representative wall normal heat flux of the agglomerated control volume on a particular boundary marker.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -163,6 +224,13 @@ public:
    */
   void SetRestricted_GridVelocity(CGeometry *fine_mesh, CConfig *config) override;
 
+  /*!
+   * \brief Set the wall distance of each node in the coarse mesh level based
+   *        on a restriction (volume weighted average) from a finer mesh.
+   * \param[in] fine_mesh - Geometry container for the finer mesh level.
+   */
+  void SetRestricted_WallDistance(const CGeometry *fine_mesh) override;
+
   /*!
    * \brief Find and store the closest neighbor to a vertex.
    * \param[in] config - Definition of the particular problem.
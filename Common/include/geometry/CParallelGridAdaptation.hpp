@@ -0,0 +1,225 @@
+/*!
+ * \file CParallelGridAdaptation.hpp
+ * \brief Headers of the partition-local (parallel) refinement of the grid.
+ *        The implementation is in the <i>CParallelGridAdaptation.cpp</i> file.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "CGeometry.hpp"
+#include "../CConfig.hpp"
+
+#include <vector>
+#include <string>
+
+/*!
+ * \struct CAdaptedMesh
+ * \brief Adapted grid held in memory, distributed over the ranks as it is written to the binary SU2 format.
+ */
+struct CAdaptedMesh {
+  unsigned short nDim = 0;          /*!< \brief Number of dimensions of the problem. */
+  unsigned long nPointGlobal = 0;   /*!< \brief Number of points of the grid. */
+  unsigned long nElemGlobal = 0;    /*!< \brief Number of volume elements of the grid. */
+  unsigned long firstPoint = 0;     /*!< \brief Global index of the first point of the linear partition of this rank. */
+  unsigned long firstElem = 0;      /*!< \brief Global index of the first element of this rank. */
+  std::vector<passivedouble> coords;            /*!< \brief Coordinates of the points of the linear partition (nDim per point). */
+  std::vector<passivedouble> weights;           /*!< \brief Optional work of the points of the linear partition, for the partitioning. */
+  std::vector<unsigned long> elems;             /*!< \brief Elements of this rank [vtkType n0 ... n7] (SU2_BINARY_MESH_ELEM). */
+  std::vector<std::string> markerNames;         /*!< \brief Names of the markers (all ranks). */
+  std::vector<std::vector<unsigned long> > markers; /*!< \brief Boundary elements of each marker [vtkType n0 ... n3] (master only). */
+};
+
+/*!
+ * \class CParallelGridAdaptation
+ * \brief Refinement of the distributed (partitioned) grid, each rank divides the elements it owns and the
+ *        adapted grid is written in the binary SU2 format (PARALLEL_ADAPTATION= YES in SU2_MSH).
+ * \details The elements are divided by splitting their edges at the midpoint, without hanging nodes:
+ *          triangles into 2 (one edge) or 4 (red), tetrahedra into 2 (one edge), 4 (the edges of one face)
+ *          or 8 (red), and prisms along their triangular faces into 2 or 4 prisms (the vertical edges are never
+ *          split, which keeps the layers of the boundary layer meshes). Any other pattern of split edges is
+ *          closed by splitting more edges, iteratively until no element changes on any rank.
+ *          An edge is owned by the rank that owns its endpoint of lowest global index, since that rank holds all
+ *          its elements; the edge flags and the global indices of the new points are combined on the owners and
+ *          sent back to the ranks that also hold the edge, which makes the halos consistent.
+ *          An element (volume or boundary) is divided by the rank that owns its node of lowest global index.
+ *          The new points are appended to the global numbering and the adapted grid is written in linear slices
+ *          with MPI-IO, it is repartitioned (ParMETIS) when it is read by the solver.
+ * \note Only grids of triangles (2D), and of tetrahedra and prisms (3D) can be refined, the new boundary points
+ *       are not projected on the geometry and the solution is not interpolated.
+ * \author SU2 Contributors
+ */
+class CParallelGridAdaptation {
+
+  int rank,                    /*!< \brief MPI Rank. */
+  size;                        /*!< \brief MPI Size. */
+  unsigned short nDim;         /*!< \brief Number of dimensions of the problem. */
+
+  unsigned long nPointGlobal,  /*!< \brief Number of points of the original grid. */
+  nPointGlobal_New,            /*!< \brief Number of points of the adapted grid. */
+  nElemGlobal,                 /*!< \brief Number of volume elements of the original grid. */
+  nElemGlobal_New;             /*!< \brief Number of volume elements of the adapted grid. */
+  unsigned short nClosureIter; /*!< \brief Number of iterations needed to close the splitting of the edges. */
+
+  std::vector<bool> Divide;            /*!< \brief Whether each local element is marked for refinement. */
+  std::vector<unsigned long> Split;    /*!< \brief Whether each local edge is split (0 or 1). */
+  std::vector<unsigned long> MidPoint; /*!< \brief Global index of the midpoint of each split edge. */
+
+  std::vector<std::vector<unsigned long> > EdgeSend; /*!< \brief Local edges held by this rank and owned by each rank. */
+  std::vector<std::vector<unsigned long> > EdgeRecv; /*!< \brief Local (owned) edges also held by each rank. */
+
+  std::vector<unsigned long> ElemConn;  /*!< \brief Adapted elements of this rank [vtkType n0 ... n7] (global indices). */
+  std::vector<std::vector<unsigned long> > BoundConn; /*!< \brief Adapted boundary elements of each marker of the config file [vtkType n0 ... n3]. */
+
+  /*!
+   * \brief Send the buffers to each rank and receive the buffers sent by each rank (all-to-all).
+   * \param[in] sendBuf - Buffer for each rank.
+   * \param[out] recvBuf - Buffer from each rank.
+   */
+  template<class T>
+  void ExchangeBuffers(const std::vector<std::vector<T> >& sendBuf, std::vector<std::vector<T> >& recvBuf) const;
+
+  /*!
+   * \brief Get whether this rank owns an element, i.e. its node of lowest global index.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] nodes - Local indices of the nodes of the element.
+   * \param[in] nNodes - Number of nodes of the element.
+   */
+  bool IsOwned(CGeometry *geometry, const unsigned long *nodes, unsigned short nNodes) const;
+
+  /*!
+   * \brief Set the values of the halo points from the ranks that own them.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in,out] values - Values of each local point, set for the domain points.
+   * \param[in] nValue - Number of values per point.
+   */
+  void SetHaloValues(CGeometry *geometry, std::vector<passivedouble>& values, unsigned short nValue = 1) const;
+
+  /*!
+   * \brief Read one field of the (binary) flow restart file for the local points.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iField - Index of the field, after the coordinates.
+   * \return Value of the field at each local point.
+   */
+  std::vector<passivedouble> ReadRestartField(CGeometry *geometry, CConfig *config,
+                                              unsigned short iField) const;
+
+  /*!
+   * \brief Mark the elements by the gradient of the density, the fraction NEW_ELEMS of the elements with
+   *        the largest (dual volume scaled) gradient at their nodes is marked.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetIndicator_Flow(CGeometry *geometry, CConfig *config);
+
+  /*!
+   * \brief Mark the elements of largest index, at most a fraction of the elements of the grid.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] elemIndex - Adaptation index of each local element.
+   * \param[in] fraction - Fraction of the elements that can be marked.
+   */
+  void SetMarking_Fraction(CGeometry *geometry, const std::vector<passivedouble>& elemIndex, passivedouble fraction);
+
+  /*!
+   * \brief Combine the values of the edges on their owners (maximum) and send them to the other ranks that hold them.
+   * \param[in,out] values - Value of each local edge.
+   * \param[in] combine - Whether the values of the other ranks are combined, otherwise those of the owners are kept.
+   */
+  void SynchronizeEdges(std::vector<unsigned long>& values, bool combine) const;
+
+  /*!
+   * \brief Split the edges needed by an element to be divided without hanging nodes.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] iElem - Local index of the element.
+   * \return Whether an edge was split.
+   */
+  bool SetElementClosure(CGeometry *geometry, unsigned long iElem);
+
+  /*!
+   * \brief Add the children of an element (volume or boundary) to a connectivity list.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] vtkType - Type of the element.
+   * \param[in] nodes - Local indices of the nodes of the element.
+   * \param[in] recordSize - Size of each record of the list (type and nodes).
+   * \param[in,out] conn - The connectivity list, in global indices.
+   */
+  void SetDivision(CGeometry *geometry, unsigned short vtkType, const unsigned long *nodes,
+                   unsigned short recordSize, std::vector<unsigned long>& conn);
+
+public:
+
+  /*!
+   * \brief Constructor of the class, check the grid.
+   * \param[in] geometry - Geometrical definition of the problem (partitioned, with edges and dual grid).
+   * \param[in] config - Definition of the particular problem.
+   */
+  CParallelGridAdaptation(CGeometry *geometry, CConfig *config);
+
+  /*!
+   * \brief Mark the elements to refine according to KIND_ADAPT (FULL, FULL_FLOW or GRAD_FLOW).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetMarking(CGeometry *geometry, CConfig *config);
+
+  /*!
+   * \brief Mark the elements by a metric, the error of an element is the largest length of its edges in the metric
+   *        (e.g. e^T |H| e for the Hessian H of a sensor, an estimate of the interpolation error along the edge e).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] metric - Symmetric tensor (nDim x nDim) of each domain point, the halos are set by this function.
+   * \param[in] fraction - Fraction of the elements with the largest error that are marked.
+   */
+  void SetMarking(CGeometry *geometry, std::vector<passivedouble> metric, passivedouble fraction);
+
+  /*!
+   * \brief Split the edges of the marked elements, close the splitting, and number the new points.
+   * \param[in] geometry - Geometrical definition of the problem.
+   */
+  void SetEdgeSplitting(CGeometry *geometry);
+
+  /*!
+   * \brief Divide the (volume and boundary) elements owned by this rank.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetRefinement(CGeometry *geometry, CConfig *config);
+
+  /*!
+   * \brief Get the adapted grid in memory (collective).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[out] mesh - The adapted grid.
+   */
+  void GetMesh(CGeometry *geometry, CConfig *config, CAdaptedMesh& mesh) const;
+
+  /*!
+   * \brief Write the adapted grid in the binary SU2 format (collective MPI-IO).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_filename - Name of the file, the extension .su2b is added.
+   */
+  void WriteMesh(CGeometry *geometry, CConfig *config, std::string val_filename) const;
+
+};
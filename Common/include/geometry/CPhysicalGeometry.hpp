@@ -31,6 +31,8 @@
 #include "meshreader/CMeshReaderFVM.hpp"
 #include "../toolboxes/C2DContainer.hpp"
 
+class CADTElemClass;
+
 /*!
  * \class CPhysicalGeometry
  * \brief Class for reading a defining the primal grid which is read from the grid file in .su2 or .cgns format.
@@ -104,12 +106,101 @@ class CPhysicalGeometry final : public CGeometry {
   unsigned long *Elem_ID_BoundTria_Linear;
   unsigned long *Elem_ID_BoundQuad_Linear;
 
+  vector<su2double> WallDist_Coord;   /*!< \brief Coordinates of the points when the wall distance was last updated (moving grids). */
+  vector<su2double> WallDist_Bound;   /*!< \brief Bound of the change of the wall distance of each point since it was last computed. */
+  vector<su2double> DualGrid_Coord;   /*!< \brief Coordinates of the points when the dual grid was last computed (moving grids). */
+  vector<passivedouble> PointWeights; /*!< \brief Work of the points of the linear partition relative to an average point (empty if not known). */
+
+  /*!
+   * \brief Add the contributions of an element to the dual faces of its edges and to the volumes of its points.
+   * \param[in] iElem - Element index.
+   * \param[in] pointMask - If not null, only the faces of edges with both points flagged, and the volumes of flagged points.
+   * \return Volume added to the points.
+   */
+  su2double AddElemControlVolume(unsigned long iElem, const vector<bool>* pointMask = nullptr);
+
+  /*!
+   * \brief Add the contributions of a boundary element to the normals of its vertices.
+   * \param[in] iMarker - Marker index.
+   * \param[in] iElem - Boundary element index.
+   * \param[in] pointMask - If not null, only to the vertices of flagged points.
+   */
+  void AddBoundElemControlVolume(unsigned short iMarker, unsigned long iElem, const vector<bool>* pointMask = nullptr);
+
+  /*!
+   * \brief Set the maximum cell-center to cell-center distance of one point.
+   * \param[in] iPoint - Point index.
+   */
+  void SetPointMaxLength(unsigned long iPoint);
+
+  /*!
+   * \brief Renumber the points, update the coordinates, global indices and connectivities.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] Result - Old index of each new point (the halo points must stay at the end).
+   */
+  void ApplyPointOrdering(CConfig *config, const vector<unsigned long>& Result);
+
+  /*!
+   * \brief Set the default values of the data used to distribute the grid between the ranks.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void InitializeDistributionData(CConfig *config);
+
+  /*!
+   * \brief Load the distributed points, elements, and markers into the geometry structures,
+   *        and free the memory used for the distribution.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometry holding the global sizes of the linearly partitioned grid.
+   */
+  void LoadDistributedGrid(CConfig *config, CGeometry *geometry);
+
+  /*!
+   * \brief Write the points, elements, and markers distributed to this rank to its partition cache file.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometry container holding the initial linear partitions of the grid.
+   * \param[in] val_filename - Name of the cache file of this rank.
+   */
+  void WritePartitionCache(CConfig *config, CGeometry *geometry, const string& val_filename) const;
+
+  /*!
+   * \brief Read the points, elements, and markers of this rank from its partition cache file.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_filename - Name of the cache file of this rank.
+   */
+  void ReadPartitionCache(CConfig *config, const string& val_filename);
+
+  /*!
+   * \brief Compute the wall distance of a set of points with the search trees of the walls of all ranks.
+   * \note The points are only sent to the ranks whose walls (bounding box) may be closer than
+   *       the distance to the local walls, or than the farthest corner of another bounding box.
+   * \param[in] WallADT - Search tree of the wall elements of this rank.
+   * \param[in] wallBBox - Bounding box (min and max coordinates) of the walls of this rank, empty if no walls.
+   * \param[in] points - Points whose wall distance is computed.
+   */
+  void ComputeDistributedWallDistance(CADTElemClass &WallADT, const vector<su2double> &wallBBox,
+                                      const vector<unsigned long> &points);
+
+#ifdef HAVE_MPI
+#ifdef HAVE_PARMETIS
+  /*!
+   * \brief Compute the ParMETIS vertex weights of the points in the linear partition of this rank,
+   *        the points of the markers with a partitioning weight have additional (boundary) work, and
+   *        the volume work is scaled by the work of the points when it is known (PointWeights).
+   * \param[in] config - Definition of the particular problem.
+   * \param[out] vwgt - Weights of the points (nPoint x number of constraints), empty if the points are not weighted.
+   * \return Number of balance constraints.
+   */
+  idx_t SetPartitionWeights(CConfig *config, vector<idx_t>& vwgt) const;
+#endif
+#endif
+
 public:
   /*--- This is to suppress Woverloaded-virtual, omitting it has no negative impact. ---*/
   using CGeometry::SetVertex;
   using CGeometry::SetMeshFile;
   using CGeometry::SetControlVolume;
   using CGeometry::SetBoundControlVolume;
+  using CGeometry::UpdateDualGrid;
   using CGeometry::SetPoint_Connectivity;
 
   /*!
@@ -139,6 +230,15 @@ public:
    */
   CPhysicalGeometry(CGeometry *geometry, CConfig *config);
 
+  /*!
+   * \overload
+   * \brief Reads the grid distributed to this rank in a previous run from its partition cache file,
+   *        this skips the reading of the mesh file, the partitioning, and the distribution.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_filename - Name of the cache file of this rank (see GetPartitionCacheName).
+   */
+  CPhysicalGeometry(CConfig *config, const string& val_filename);
+
   /*!
    * \overload
    * \brief Accepts a geometry container holding a linearly partitioned grid
@@ -154,6 +254,22 @@ public:
    */
   ~CPhysicalGeometry(void);
 
+  /*!
+   * \brief Get the name of the partition cache file of this rank.
+   * \param[in] config - Definition of the particular problem.
+   * \return Name of the cache file.
+   */
+  static string GetPartitionCacheName(CConfig *config);
+
+  /*!
+   * \brief Check (on all ranks) whether the partition cache files can be used for this run,
+   *        i.e. they were written with the same number of ranks and from the same mesh file.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_filename - Name of the cache file of this rank.
+   * \return <code>TRUE</code> if the cache of every rank is valid.
+   */
+  static bool CheckPartitionCache(CConfig *config, const string& val_filename);
+
   /*!
    * \brief Distributes the coloring from ParMETIS so that each rank has complete information about the local grid points.
    * \param[in] geometry - Definition of the geometry container holding the initial linear partitions of the grid + coloring.
@@ -303,6 +419,14 @@ public:
     return -1;
   }
 
+  /*!
+   * \brief Get the map from the global to the local index of the domain points of this rank.
+   * \return The map, ordered by global index (which is also the order of the points in the restart files).
+   */
+  inline const map<unsigned long, unsigned long>& GetGlobal_to_Local_Map() const override {
+    return Global_to_Local_Point;
+  }
+
   /*!
    * \brief Get the local marker that correspond with the global marker.
    * \param[in] val_ipoint - Global marker.
@@ -404,6 +528,12 @@ public:
    */
   void SetRCM_Ordering(CConfig *config) override;
 
+  /*!
+   * \brief Set a renumbering of the domain points along a space-filling curve (Hilbert or Morton).
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetSFC_Ordering(CConfig *config) override;
+
   /*!
    * \brief Set elements which surround an element.
    */
@@ -501,6 +631,24 @@ public:
    */
   void SetMaxLength(CConfig* config) override;
 
+  /*!
+   * \brief Update the dual grid after the points move, the CGs of elements with displaced points, and the
+   *        control volumes, boundary normals, and max lengths that depend on them are recomputed.
+   * \note The result is the same as SetCoord_CG, SetControlVolume, SetBoundControlVolume, and SetMaxLength
+   *       (which are used in AD builds, as the metrics depend on all the coordinates, or the first time).
+   * \param[in] config - Definition of the particular problem.
+   */
+  void UpdateDualGrid(CConfig *config) override;
+
+  /*!
+   * \brief Update the dual grid after a rigid motion of all the points (rotate the normals, keep the volumes).
+   * \note AD builds, or the first time, recompute the dual grid (UpdateDualGrid).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] rotMatrix - Rotation matrix.
+   * \param[in] translation - Translation vector.
+   */
+  void SetRigidMotion(CConfig *config, const su2double rotMatrix[][3], const su2double *translation) override;
+
   /*!
    * \brief Set the Tecplot file.
    * \param[in] config_filename - Name of the file where the Tecplot
@@ -542,6 +690,14 @@ public:
    */
   void SetColorFEMGrid_Parallel(CConfig *config) override;
 
+  /*!
+   * \brief Decrease the polynomial degree of the solution of the FEM elements by one,
+            such that the next coarser level of the p-multigrid algorithm can be created.
+            The number of solution DOFs and their global offsets are updated accordingly.
+   * \return Whether or not the polynomial degree of at least one element was decreased.
+   */
+  bool DecreasePolySolFEM(void) override;
+
   /*!
    * \brief Compute the weights of the FEM graph for ParMETIS.
    * \param[in]  config                       - Definition of the particular problem.
@@ -549,6 +705,8 @@ public:
    * \param[in]  adjacency                    - Neighbors of the element.
    * \param[in]  mapExternalElemIDToTimeLevel - Map from the external element ID's to their time level
                                                 and number of DOFs.
+   * \param[out] nConstraints                 - Number of vertex weights per element, i.e. the work
+                                                per time level that occurs and the number of DOFs.
    * \param[out] vwgt                         - Weights of the vertices of the graph, i.e. the elements.
    * \param[out] adjwgt                       - Weights of the edges of the graph.
    */
@@ -557,6 +715,7 @@ public:
       const vector<CFaceOfElement>               &localFaces,
       const vector<vector<unsigned long> >       &adjacency,
       const map<unsigned long, CUnsignedShort2T> &mapExternalElemIDToTimeLevel,
+      unsigned short                             &nConstraints,
       vector<su2double>                          &vwgt,
       vector<vector<su2double> >                 &adjwgt);
 
@@ -756,8 +915,10 @@ public:
   /*!
    * \brief Read the sensitivity from adjoint solution file and store it.
    * \param[in] config - Definition of the particular problem.
+   * \param[in] val_obj - Index of the objective function whose adjoint file is read (DISCADJ_SEPARATE_OBJECTIVES),
+   *            -1 for the combined objective.
    */
-  void SetSensitivity(CConfig *config) override;
+  void SetSensitivity(CConfig *config, short val_obj = -1) override;
 
   /*!
    * \brief Read the sensitivity from unordered ASCII adjoint solution file and store it.
@@ -32,12 +32,13 @@
 /*!
  * \class CEdge
  * \brief Class for defining an edge.
+ * \note The data is owned by the geometry (contiguous storage for all edges), the edge is a view.
  * \author F. Palacios
  */
 class CEdge final : public CDualGrid {
 private:
   su2double *Coord_CG;      /*!< \brief Center-of-gravity of the element. */
-  unsigned long *Nodes;   /*!< \brief Vector to store the global nodes of an element. */
+  su2localidx *Nodes;       /*!< \brief Vector to store the (local) nodes of the edge. */
   su2double *Normal;        /*!< \brief Normal al elemento y coordenadas de su centro de gravedad. */
 
 public:
@@ -47,8 +48,12 @@ public:
    * \param[in] val_iPoint - First node of the edge.
    * \param[in] val_jPoint - Second node of the edge.
    * \param[in] val_nDim - Number of dimensions of the problem.
+   * \param[in] val_nodes - Storage for the 2 nodes.
+   * \param[in] val_normal - Storage for the normal (nDim).
+   * \param[in] val_coord_cg - Storage for the center of gravity (nDim).
    */
-  CEdge(unsigned long val_iPoint, unsigned long val_jPoint, unsigned short val_nDim);
+  CEdge(unsigned long val_iPoint, unsigned long val_jPoint, unsigned short val_nDim,
+        su2localidx *val_nodes, su2double *val_normal, su2double *val_coord_cg);
 
   /*!
    * \brief Destructor of the class.
@@ -40,9 +40,10 @@ private:
   unsigned short nElem,               /*!< \brief Number of elements that set up the control volume. */
   nPoint;                             /*!< \brief Number of points that set up the control volume  */
   vector<long> Elem;                  /*!< \brief Elements that set up a control volume around a node. */
-  vector<unsigned long> Point;        /*!< \brief Points surrounding the central node of the control volume. */
-  vector<long> Edge;                  /*!< \brief Edges that set up a control volume. */
+  vector<su2localidx> Point;          /*!< \brief Points surrounding the central node of the control volume. */
+  vector<make_signed<su2localidx>::type> Edge; /*!< \brief Edges that set up a control volume (-1 if not set). */
   su2double *Volume;                  /*!< \brief Volume or Area of the control volume in 3D and 2D. */
+  unsigned short nVolume;             /*!< \brief Number of volumes stored (1, or 3 for time marching). */
   su2double Periodic_Volume;          /*!< \brief Missing component of volume or area of a control volume on a periodic marker in 3D and 2D. */
   bool Domain,                        /*!< \brief Indicates if a point must be computed or belong to another boundary */
   Boundary,                           /*!< \brief To see if a point belong to the boundary (including MPI). */
@@ -65,7 +66,9 @@ private:
   Agglomerate;                        /*!< \brief This flag indicates if the element has been agglomerated. */
   bool Move;                          /*!< \brief This flag indicates if the point is going to be move in the grid deformation process. */
   unsigned long color;                /*!< \brief Color of the point in the partitioning strategy. */
-  su2double Wall_Distance;            /*!< \brief Distance to the nearest wall. */
+  su2double *Wall_Distance;           /*!< \brief Distance to the nearest wall. */
+  su2double Wall_Distance_Local;      /*!< \brief Storage of the wall distance before the point is stored contiguously. */
+  bool ExternalStorage;               /*!< \brief Coord, Volume, and Wall_Distance are owned by the geometry (see SetStorage). */
   su2double SharpEdge_Distance;       /*!< \brief Distance to a sharp edge. */
   su2double Curvature;                /*!< \brief Value of the surface curvature (SU2_GEO). */
   unsigned long GlobalIndex;          /*!< \brief Global index in the parallel simulation. */
@@ -109,6 +112,20 @@ public:
    */
   ~CPoint(void) override;
 
+  /*!
+   * \brief Move the coordinates, volumes, and wall distance to storage provided by
+   *        the geometry, after which the point only references (does not own) them.
+   * \param[in] coord - Storage for nDim coordinates.
+   * \param[in] volume - Storage for GetnVolume() volumes.
+   * \param[in] wall_distance - Storage for the wall distance.
+   */
+  void SetStorage(su2double *coord, su2double *volume, su2double *wall_distance);
+
+  /*!
+   * \brief Get the number of volumes stored by the point (1, or 3 for time marching).
+   */
+  inline unsigned short GetnVolume(void) const { return nVolume; }
+
   /*!
    * \brief For parallel computation, its indicates if a point must be computed or not.
    * \param[in] val_domain - <code>TRUE</code> if the point belong to the domain; otherwise <code>FALSE</code>.
@@ -125,7 +142,7 @@ public:
    * \brief Set the value of the distance to the nearest wall.
    * \param[in] val_distance - Value of the distance.
    */
-  inline void SetWall_Distance(su2double val_distance) { Wall_Distance = val_distance; }
+  inline void SetWall_Distance(su2double val_distance) { *Wall_Distance = val_distance; }
 
   /*!
    * \brief Set the value of the distance to a sharp edge.
@@ -137,7 +154,7 @@ public:
    * \brief Get the value of the distance to the nearest wall.
    * \return Value of the distance to the nearest wall.
    */
-  inline su2double GetWall_Distance(void) const { return Wall_Distance; }
+  inline su2double GetWall_Distance(void) const { return *Wall_Distance; }
 
   /*!
    * \brief Set the value of the curvature at a surface node.
@@ -254,6 +271,15 @@ public:
    */
   inline void SetElem(unsigned long val_elem) { Elem.push_back(val_elem); nElem = Elem.size(); }
 
+  /*!
+   * \brief Set all the elements that set the control volume, replacing the current ones.
+   * \param[in] val_elems - Elements of the control volume.
+   * \param[in] val_nElems - Number of elements.
+   */
+  inline void SetElems(const unsigned long* val_elems, unsigned short val_nElems) {
+    Elem.assign(val_elems, val_elems+val_nElems); nElem = val_nElems;
+  }
+
   /*!
    * \brief Reset the elements of a control volume.
    */
@@ -270,6 +296,16 @@ public:
    */
   void SetPoint(unsigned long val_point);
 
+  /*!
+   * \brief Set all the points that compose the control volume (without duplicates), replacing the
+   *        current ones, their edges are not set.
+   * \param[in] val_points - Points of the control volume.
+   * \param[in] val_nPoints - Number of points.
+   */
+  inline void SetPoints(const su2localidx* val_points, unsigned short val_nPoints) {
+    Point.assign(val_points, val_points+val_nPoints); Edge.assign(val_nPoints, -1); nPoint = val_nPoints;
+  }
+
   /*!
    * \brief Set the edges that compose the control volume.
    * \param[in] val_edge - Edge to be added.
@@ -81,6 +81,9 @@ protected:
   unsigned short nNodes;              /*!< \brief Number of geometric points. */
   unsigned short nDim;                /*!< \brief Number of dimension of the problem. */
 
+  su2double* GradCache = nullptr;     /*!< \brief Record of the reference gradients for the next ComputeGrad_Linear. */
+  bool GradCacheValid = false;        /*!< \brief Load the gradients from the record, instead of storing them there. */
+
 public:
   enum FrameType {REFERENCE=1, CURRENT=2}; /*!< \brief Type of nodal coordinates. */
 
@@ -120,6 +123,22 @@ public:
    */
   void ClearElement(void);
 
+  /*!
+   * \brief Size of the records of the reference gradients, the Jacobian and the gradients of each Gauss point.
+   */
+  inline unsigned long GetGradCacheSize(void) const { return nGaussPoints*(1ul+nNodes*nDim); }
+
+  /*!
+   * \brief Set the record of the reference gradients of the element that the next call to ComputeGrad_Linear uses.
+   * \note The record only applies to that call, the reference coordinates are not needed when it is valid.
+   * \param[in] record - Start of the record (of size GetGradCacheSize).
+   * \param[in] valid - If true the gradients are loaded from the record, otherwise they are computed and stored.
+   */
+  inline void SetGradCache(su2double* record, bool valid) {
+    GradCache = record;
+    GradCacheValid = valid;
+  }
+
   /*!
    * \brief Retrieve the number of nodes of the element.
    * \return Number of nodes of the element.
@@ -499,6 +518,21 @@ protected:
           for the gradient computation, REFERENCE (undeformed) or CURRENT (deformed) ---*/
     const su2activematrix& Coord = (FRAME==REFERENCE) ? RefCoord : CurrentCoord;
 
+    /*--- The reference gradients may be stored, see SetGradCache. ---*/
+    su2double* record = (FRAME==REFERENCE) ? GradCache : nullptr;
+    const bool load = (record != nullptr) && GradCacheValid;
+    if (FRAME==REFERENCE) GradCache = nullptr;
+
+    if (load) {
+      for (iGauss = 0; iGauss < NGAUSS; iGauss++) {
+        GaussPoint[iGauss].SetJ_X(*(record++));
+        for (iNode = 0; iNode < NNODE; iNode++)
+          for (iDim = 0; iDim < NDIM; iDim++)
+            GaussPoint[iGauss].SetGradNi_Xj(*(record++), iDim, iNode);
+      }
+      return;
+    }
+
     for (iGauss = 0; iGauss < NGAUSS; iGauss++) {
 
       /*--- Jacobian transformation ---*/
@@ -569,6 +603,15 @@ protected:
 
     }
 
+    if (record != nullptr) {
+      for (iGauss = 0; iGauss < NGAUSS; iGauss++) {
+        *(record++) = GaussPoint[iGauss].GetJ_X();
+        for (iNode = 0; iNode < NNODE; iNode++)
+          for (iDim = 0; iDim < NDIM; iDim++)
+            *(record++) = GaussPoint[iGauss].GetGradNi_Xj(iNode, iDim);
+      }
+    }
+
   }
 
 public:
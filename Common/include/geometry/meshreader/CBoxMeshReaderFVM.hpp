@@ -33,6 +33,8 @@
 /*!
  * \class CBoxMeshReaderFVM
  * \brief Reads a 3D box grid into linear partitions for the finite volume solver (FVM).
+ * \note Each rank generates only the points of its linear partition and the elements that contain them,
+ *       hence the grid can be made as large as the memory of all ranks allows (e.g. for scaling studies).
  * \author: T. Economon
  */
 class CBoxMeshReaderFVM: public CMeshReaderFVM {
@@ -51,8 +53,21 @@ private:
   su2double Oy; /*!< \brief Offset of the domain from 0.0 in the y-direction. */
   su2double Oz; /*!< \brief Offset of the domain from 0.0 in the z-direction. */
   
-  unsigned short KindElem;  /*!< \brief VTK identifier of the interior elements. */
-  unsigned short KindBound; /*!< \brief VTK identifier of the surface elements. */
+  su2double Cx; /*!< \brief Clustering factor of the nodes towards x-minus (0.0 for uniform spacing). */
+  su2double Cy; /*!< \brief Clustering factor of the nodes towards y-minus (0.0 for uniform spacing). */
+  su2double Cz; /*!< \brief Clustering factor of the nodes towards z-minus (0.0 for uniform spacing). */
+  
+  unsigned short KindElements; /*!< \brief Kind of interior elements, the hexahedra are split into prisms or tetrahedra (ENUM_BOX_ELEMENTS). */
+  
+  /*!
+   * \brief Store a quadrilateral face of a marker, as two triangles if the adjacent elements are split.
+   * \note The face is split along the diagonal from its first to its third node, which is the
+   *       diagonal of the split of the volume elements when the first node is the lowest corner.
+   * \param[in] iMarker - Marker of the face.
+   * \param[in] face - The 4 nodes of the face.
+   * \param[in] split - Whether to store two triangles.
+   */
+  void AddSurfaceFace(unsigned long iMarker, const unsigned long *face, bool split);
   
   /*!
    * \brief Computes and stores the grid points based on an analytic definition of a box grid.
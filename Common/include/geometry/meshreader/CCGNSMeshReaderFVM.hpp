@@ -30,6 +30,10 @@
 
 #ifdef HAVE_CGNS
 #include "cgnslib.h"
+#if defined(HAVE_MPI) && CG_BUILD_PARALLEL
+#include "pcgnslib.h"
+#define HAVE_PCGNS
+#endif
 #endif
 
 #include "CMeshReaderFVM.hpp"
@@ -51,6 +55,8 @@ private:
   int nZones;     /*!< \brief Total number of zones in the CGNS file. */
   int nSections;  /*!< \brief Total number of sections in the CGNS file. */
   
+  bool parallelCGNS = false; /*!< \brief Whether the file was opened with parallel CGNS (HDF5 files only). */
+  
   vector<bool> isInterior;             /*!< \brief Vector of booleans to store whether each section in the CGNS file is an interior or boundary section. */
   vector<unsigned long> nElems;        /*!< \brief Vector containing the local number of elements found within each CGNS section. */
   vector<unsigned long> elemOffset;    /*!< \brief Global ID offset for each interior section (i.e., the total number of global elements that came before it). */
@@ -89,6 +95,38 @@ private:
    */
   void ReadCGNSVolumeSection(int val_section);
   
+  /*!
+   * \brief Reads a contiguous range of elements of a CGNS section and stores them in the SU2 format [globalID VTK n1 ... n8].
+   * \param[in] val_section - CGNS section index.
+   * \param[in] val_elem_type - CGNS element type of the section.
+   * \param[in] val_first - CGNS index of the first element.
+   * \param[in] val_count - Number of elements (may be zero).
+   * \param[in] val_collective - Whether all ranks call the function (collective reads with parallel CGNS).
+   * \param[in] val_id_offset - Offset subtracted from the CGNS index to get the global ID, negative for IDs set to zero.
+   * \param[out] val_conn - Connectivity of the elements.
+   * \param[out] val_npe - Number of points of each element.
+   */
+  void ReadCGNSElementChunk(int                    val_section,
+                            ElementType_t          val_elem_type,
+                            unsigned long          val_first,
+                            unsigned long          val_count,
+                            bool                   val_collective,
+                            long                   val_id_offset,
+                            vector<cgsize_t>       &val_conn,
+                            vector<unsigned short> &val_npe);
+  
+  /*!
+   * \brief Sends a chunk of volume elements to the ranks that own their points, and appends the received elements to the section.
+   * \param[in] val_section - CGNS section index.
+   * \param[in] val_count - Number of elements in the chunk.
+   * \param[in] val_conn - Connectivity of the elements in the SU2 format.
+   * \param[in] val_npe - Number of points of each element.
+   */
+  void DistributeCGNSVolumeElements(int                          val_section,
+                                    unsigned long                val_count,
+                                    const vector<cgsize_t>       &val_conn,
+                                    const vector<unsigned short> &val_npe);
+  
   /*!
    * \brief Reads the surface (boundary) elements from the CGNS zone. Only the master rank currently reads and stores the connectivity, which is linearly partitioned later.
    * \param[in] val_section - CGNS section index.
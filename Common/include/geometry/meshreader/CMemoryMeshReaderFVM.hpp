@@ -0,0 +1,90 @@
+/*!
+ * \file CMemoryMeshReaderFVM.hpp
+ * \brief Header file for the class CMemoryMeshReaderFVM.
+ *        The implementations are in the <i>CMemoryMeshReaderFVM.cpp</i> file.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "CMeshReaderFVM.hpp"
+#include "../CParallelGridAdaptation.hpp"
+
+/*!
+ * \class CMemoryMeshReaderFVM
+ * \brief Reads a grid held in memory (e.g. adapted in the same process) into linear partitions for the
+ *        finite volume solver (FVM), without a file round trip.
+ * \note The grid is set with SetMesh before the geometry is built, it is used by the next read of the grid
+ *       of the zone (whatever the MESH_FORMAT) and released. The points are already in linear partitions,
+ *       the elements are sent to the ranks that own their points, as for the binary SU2 reader.
+ * \author SU2 Contributors
+ */
+class CMemoryMeshReaderFVM: public CMeshReaderFVM {
+
+private:
+
+  static CAdaptedMesh pendingMesh; /*!< \brief The grid to be read. */
+  static bool hasPendingMesh;      /*!< \brief Whether a grid is held. */
+
+  /*!
+   * \brief Sets the grid points of the linear partition of this rank.
+   */
+  void LoadPointCoordinates();
+
+  /*!
+   * \brief Sends the volume elements to the ranks that own their points.
+   */
+  void LoadVolumeElementConnectivity();
+
+  /*!
+   * \brief Sets the surface (boundary) elements, the master node stores the connectivity.
+   */
+  void LoadSurfaceElementConnectivity();
+
+public:
+
+  /*!
+   * \brief Constructor of the CMemoryMeshReaderFVM class, takes the grid held in memory.
+   */
+  CMemoryMeshReaderFVM(CConfig        *val_config,
+                       unsigned short val_iZone,
+                       unsigned short val_nZone);
+
+  /*!
+   * \brief Destructor of the CMemoryMeshReaderFVM class.
+   */
+  ~CMemoryMeshReaderFVM(void);
+
+  /*!
+   * \brief Hold a grid for the next read (collective, single zone problems).
+   * \param[in] mesh - The grid, it is moved.
+   */
+  static void SetMesh(CAdaptedMesh&& mesh);
+
+  /*!
+   * \brief Get whether a grid is held for the next read.
+   */
+  static inline bool HasMesh() { return hasPendingMesh; }
+
+};
@@ -53,6 +53,7 @@ protected:
   unsigned long numberOfLocalPoints;                    /*!< \brief Number of local grid points within the linear partition on this rank. */
   unsigned long numberOfGlobalPoints;                   /*!< \brief Number of global grid points within the mesh file. */
   vector<vector<passivedouble> > localPointCoordinates; /*!< \brief Vector holding the coordinates from the mesh file for the local grid points. First index is dimension, second is point index. */
+  vector<passivedouble> localPointWeights;              /*!< \brief Work of the local grid points relative to an average point, for the partitioning (empty if not known). */
   
   unsigned long numberOfLocalElements;                  /*!< \brief Number of local elements within the linear partition on this rank. */
   unsigned long numberOfGlobalElements;                 /*!< \brief Number of global elements within the mesh file. */
@@ -62,6 +63,24 @@ protected:
   vector<string> markerNames;                                /*!< \brief String names for all markers in the mesh file. */
   vector<vector<unsigned long> > surfaceElementConnectivity; /*!< \brief Vector containing the surface element connectivity from the mesh file on a per-marker basis. Only the master node reads and stores this connectivity. */
   
+  /*!
+   * \brief Coordinate of a node of an analytically defined (box or rectangle) grid.
+   * \note The spacing is uniform for a non-positive clustering factor, otherwise the nodes are
+   *       clustered towards the lower end, x = O + L*(1 - tanh(beta*(1-s))/tanh(beta)).
+   * \param[in] length - Length of the domain.
+   * \param[in] offset - Offset of the domain from 0.0.
+   * \param[in] beta - Clustering factor.
+   * \param[in] iNode - Index of the node.
+   * \param[in] nNode - Number of nodes in the direction.
+   * \return Coordinate of the node.
+   */
+  static passivedouble AnalyticGridCoordinate(su2double length, su2double offset, su2double beta,
+                                              unsigned long iNode, unsigned long nNode) {
+    const su2double s = su2double(iNode)/su2double(nNode-1);
+    if (beta > 0.0) return SU2_TYPE::GetValue(length*(1.0-tanh(beta*(1.0-s))/tanh(beta))+offset);
+    return SU2_TYPE::GetValue(length*s+offset);
+  }
+  
 public:
   
   /*!
@@ -94,6 +113,14 @@ public:
   inline const vector<vector<passivedouble> > &GetLocalPointCoordinates() const {
     return localPointCoordinates;
   }
+
+  /*!
+   * \brief Get the work of the local points (linearly partitioned), e.g. measured in a previous partition.
+   * \returns Work of the local points relative to an average point, empty if it is not known.
+   */
+  inline const vector<passivedouble> &GetLocalPointWeights() const {
+    return localPointWeights;
+  }
   
   /*!
    * \brief Get the surface element connectivity for the specified marker. Only the master node owns the surface connectivity.
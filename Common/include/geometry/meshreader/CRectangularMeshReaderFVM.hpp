@@ -48,6 +48,10 @@ private:
   su2double Ox; /*!< \brief Offset of the domain from 0.0 in the x-direction. */
   su2double Oy; /*!< \brief Offset of the domain from 0.0 in the y-direction. */
   
+  su2double Cx; /*!< \brief Clustering factor of the nodes towards x-minus (0.0 for uniform spacing). */
+  su2double Cy; /*!< \brief Clustering factor of the nodes towards y-minus (0.0 for uniform spacing). */
+  
+  bool SplitElements;       /*!< \brief Whether the quadrilaterals are split into triangles. */
   unsigned short KindElem;  /*!< \brief VTK identifier of the interior elements. */
   unsigned short KindBound; /*!< \brief VTK identifier of the surface elements. */
   
@@ -66,6 +66,31 @@ private:
   vector<su2double> CoordYVolumePoint; /*!< \brief Y-coordinates of the volume elements touching the actuator disk. */
   vector<su2double> CoordZVolumePoint; /*!< \brief Z-coordinates of the volume elements touching the actuator disk. */
   
+  enum : unsigned long {LINE_INDEX_STRIDE = 1024}; /*!< \brief Number of lines between two entries of the index of a section. */
+  
+  vector<unsigned long> pointLineOffsets; /*!< \brief Byte offsets of every LINE_INDEX_STRIDE-th line of the NPOIN section, the last entry is the end of the section. */
+  vector<unsigned long> elemLineOffsets;  /*!< \brief Byte offsets of every LINE_INDEX_STRIDE-th line of the NELEM section, the last entry is the end of the section. */
+  unsigned long markerOffset = 0;         /*!< \brief Byte offset of the line containing the NMARK= keyword. */
+  
+  /*!
+   * \brief Index the lines of a section, starting at the current position of the mesh file.
+   * \note The lines are only counted (no parsing), the file is left at the end of the section.
+   * \param[in] nLines - Number of lines of the section.
+   * \param[out] offsets - Byte offsets of every LINE_INDEX_STRIDE-th line, and of the end of the section.
+   */
+  void IndexSectionLines(unsigned long nLines, vector<unsigned long>& offsets);
+  
+  /*!
+   * \brief Read a range of lines of an indexed section, seeking directly to the first of them.
+   * \param[in] offsets - Index of the section.
+   * \param[in] firstLine - First line of the range.
+   * \param[in] lastLine - One past the last line of the range.
+   * \param[in] parseLine - Functor called with the index of each line and the (null terminated) line.
+   */
+  template<class F>
+  void ReadSectionLines(const vector<unsigned long>& offsets, unsigned long firstLine,
+                        unsigned long lastLine, const F& parseLine);
+  
   /*!
    * \brief Reads all SU2 ASCII mesh metadata and checks for errors.
    */
@@ -83,6 +108,7 @@ private:
   
   /*!
    * \brief Reads the interior volume elements from one section of an SU2 zone into linear partitions across all ranks.
+   * \note Each rank parses a linear partition of the elements, and sends them to the ranks owning their points.
    */
   void ReadVolumeElementConnectivity();
   
@@ -0,0 +1,106 @@
+/*!
+ * \file CSU2BinaryMeshReaderFVM.hpp
+ * \brief Header file for the class CSU2BinaryMeshReaderFVM.
+ *        The implementations are in the <i>CSU2BinaryMeshReaderFVM.cpp</i> file.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "CMeshReaderFVM.hpp"
+
+/*!
+ * \class CSU2BinaryMeshReaderFVM
+ * \brief Reads a binary SU2 grid into linear partitions for the finite volume solver (FVM).
+ * \note The file has a header of SU2_BINARY_MESH_HEADER 64 bit integers (see option_structure.hpp),
+ *       followed by the blocks of points (nDim doubles each), volume elements (SU2_BINARY_MESH_ELEM
+ *       64 bit integers each) and markers (name of CGNS_STRING_SIZE chars, 64 bit number of elements,
+ *       and SU2_BINARY_MESH_BOUND 64 bit integers per element), at the offsets given in the header.
+ *       Each rank reads only its linear partition of points and elements with collective MPI-IO,
+ *       the elements are then sent to the ranks that own their points. The master reads the markers.
+ * \author SU2 Contributors
+ */
+class CSU2BinaryMeshReaderFVM: public CMeshReaderFVM {
+
+private:
+
+  string meshFilename; /*!< \brief Name of the binary SU2 mesh file being read. */
+
+#ifdef HAVE_MPI
+  MPI_File mesh_file;  /*!< \brief File handle for the binary SU2 mesh file. */
+#else
+  FILE* mesh_file;     /*!< \brief File handle for the binary SU2 mesh file. */
+#endif
+
+  uint64_t header[SU2_BINARY_MESH_HEADER]; /*!< \brief Header of the file (counts and offsets of the blocks). */
+
+  /*!
+   * \brief Read a contiguous range of records of the file.
+   * \param[out] data - Destination of the data.
+   * \param[in] offset - Offset in bytes of the first record.
+   * \param[in] recordSize - Size of each record in bytes.
+   * \param[in] nRecords - Number of records read by this rank.
+   * \param[in] collective - Whether all ranks call the function (collective MPI-IO).
+   */
+  void ReadRecords(void* data, uint64_t offset, unsigned long recordSize,
+                   unsigned long nRecords, bool collective = true);
+
+  /*!
+   * \brief Reads the header of the file and checks for errors.
+   */
+  void ReadMetadata();
+
+  /*!
+   * \brief Reads the grid points of the linear partition of this rank.
+   */
+  void ReadPointCoordinates();
+
+  /*!
+   * \brief Reads the volume elements of the linear partition of elements of this rank and
+   *        distributes them to the ranks that own their points.
+   */
+  void ReadVolumeElementConnectivity();
+
+  /*!
+   * \brief Reads the surface (boundary) elements, the master node stores the connectivity.
+   */
+  void ReadSurfaceElementConnectivity();
+
+public:
+
+  /*!
+   * \brief Constructor of the CSU2BinaryMeshReaderFVM class.
+   */
+  CSU2BinaryMeshReaderFVM(CConfig        *val_config,
+                          unsigned short val_iZone,
+                          unsigned short val_nZone);
+
+  /*!
+   * \brief Destructor of the CSU2BinaryMeshReaderFVM class.
+   */
+  ~CSU2BinaryMeshReaderFVM(void);
+
+};
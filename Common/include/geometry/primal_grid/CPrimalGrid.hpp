@@ -421,6 +421,16 @@ public:
    */
   inline virtual void AddOffsetGlobalDOFs(const unsigned long val_offsetRank) {}
 
+  /*!
+   * \brief Virtual function to set the polynomial degree and the DOF information of the solution.
+   * \param[in] val_nPolySol   - Polynomial degree of the solution of the element.
+   * \param[in] val_nDOFsSol   - Number of DOFs of the solution of the element.
+   * \param[in] val_offDOFsSol - Global offset of the solution DOFs of the element.
+   */
+  inline virtual void SetSolutionDOFs(const unsigned short val_nPolySol,
+                                      const unsigned short val_nDOFsSol,
+                                      const unsigned long  val_offDOFsSol) {}
+
   /*!
    * \brief Virtual function to add the given donor ID to the donor elements for the wall function treatment.
    * \param[in] donorElement - Element to be added to donor elements.
@@ -261,4 +261,17 @@ public:
    * \param[in] val_offsetRank - The offset that must be added for this rank.
    */
   inline void AddOffsetGlobalDOFs(const unsigned long val_offsetRank) override {offsetDOFsSolGlobal += val_offsetRank;}
+
+  /*!
+   * \brief Function to set the polynomial degree and the DOF information of the solution.
+            It is used to create the coarse levels of the p-multigrid algorithm.
+   * \param[in] val_nPolySol   - Polynomial degree of the solution of the element.
+   * \param[in] val_nDOFsSol   - Number of DOFs of the solution of the element.
+   * \param[in] val_offDOFsSol - Global offset of the solution DOFs of the element.
+   */
+  inline void SetSolutionDOFs(const unsigned short val_nPolySol,
+                              const unsigned short val_nDOFsSol,
+                              const unsigned long  val_offDOFsSol) override {
+    nPolySol = val_nPolySol; nDOFsSol = val_nDOFsSol; offsetDOFsSolGlobal = val_offDOFsSol;
+  }
 };
@@ -305,6 +305,10 @@ public:
 
   CFreeFormBlending** BlendingFunction;
 
+  vector<unsigned long> SurfaceBasisPtr;  /*!< \brief Start of the basis weights of each surface point (CSR layout). */
+  vector<unsigned short> SurfaceBasisIJK; /*!< \brief Control point indices (i, j, k) of each nonzero basis weight. */
+  vector<su2double> SurfaceBasisVal;      /*!< \brief Nonzero tensor-product basis weights of the surface points. */
+  bool SurfaceBasis_Set = false;          /*!< \brief True if the weights match the current parametric coordinates. */
 
 public:
 
@@ -746,6 +750,40 @@ public:
    */
   su2double *EvalCartesianCoord(su2double *ParamCoord);
 
+  /*!
+   * \brief Evaluate the FFD mapping X(u, v, w), and optionally its first and second derivatives, with a single
+   *        sweep over the control points. The univariate basis functions are evaluated once per direction.
+   * \param[in] uvw - Parametric coordinates of a point.
+   * \param[in] val_maxdiff - Highest derivative order to compute (0, 1, or 2).
+   * \param[out] coord - Cartesian coordinates of the point.
+   * \param[out] jac - dX_i/du_j (only if val_maxdiff > 0).
+   * \param[out] hess - d2X_i/du_j du_k (only if val_maxdiff > 1).
+   */
+  void EvalMapping(const su2double *uvw, unsigned short val_maxdiff, su2double *coord,
+                   su2double jac[][3] = nullptr, su2double hess[][3][3] = nullptr);
+
+  /*!
+   * \brief Precompute the (sparse) tensor-product basis weights of all the surface points of the box, so that
+   *        the cartesian coordinates can be updated with a sparse product with the control points.
+   * \note Nothing is done if the weights are up to date with the parametric coordinates.
+   */
+  void SetSurfaceBasis(void);
+
+  /*!
+   * \brief Evaluate the cartesian coordinates of a surface point using the precomputed basis weights.
+   * \param[in] iSurfacePoints - Index of the surface point in the box.
+   * \param[out] coord - Cartesian coordinates of the point.
+   */
+  void EvalSurfaceCartesianCoord(unsigned long iSurfacePoints, su2double *coord) const;
+
+  /*!
+   * \brief Transpose of the product evaluated by EvalSurfaceCartesianCoord, accumulates a field defined at the
+   *        surface points of the box onto the control points, e.g. the sensitivity w.r.t. the control points.
+   * \param[in] val_surface - Field at the surface points (3 values per surface point).
+   * \param[out] val_control - Field at the control points (3 values per control point, ordered by i, j, k).
+   */
+  void ProjectSurfaceToControlPoints(const vector<su2double> &val_surface, vector<su2double> &val_control);
+
   /*!
    * \brief Get the order in the l direction of the FFD FFDBox.
    * \return Order in the l direction of the FFD FFDBox.
@@ -955,9 +993,12 @@ protected:
 
   CSysSolve<su2double>  System;
   CSysMatrix<su2double> StiffMatrix; /*!< \brief Matrix to store the point-to-point stiffness. */
+  bool StiffMatrix_Set;              /*!< \brief The stiffness matrix and its preconditioner can be reused. */
   CSysVector<su2double> LinSysSol;
   CSysVector<su2double> LinSysRes;
 
+  unsigned short Derivative_Direction = 0;  /*!< \brief Direction of the derivatives computed by the deformation in derivative mode. */
+
 public:
 
   /*!
@@ -965,6 +1006,12 @@ public:
    */
   CVolumetricMovement(void);
 
+  /*!
+   * \brief Set the direction (of the vector forward mode) of the derivatives computed by SetVolume_Deformation in derivative mode.
+   * \param[in] iDir - Index of the direction.
+   */
+  inline void SetDerivative_Direction(unsigned short iDir) { Derivative_Direction = iDir; }
+
   /*!
    * \brief Constructor of the class.
    */
@@ -989,6 +1036,18 @@ public:
    */
   void UpdateDualGrid(CGeometry *geometry, CConfig *config);
   
+  /*!
+   * \brief Update the dual grid after a rigid rotation of the grid about a center, x_new = R (x_old - c)/Lref + c,
+   *        by rotating the normals (see CGeometry::SetRigidMotion), or recomputing it if Lref scales the grid.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] rotMatrix - Rotation matrix (R).
+   * \param[in] center - Center of rotation (c).
+   * \param[in] Lref - Reference length used to non-dimensionalize the rotated positions.
+   */
+  void SetRigidMotion_DualGrid(CGeometry *geometry, CConfig *config, const su2double rotMatrix[][3],
+                               const su2double *center, su2double Lref);
+  
   /*!
    * \brief Update the coarse multigrid levels after the grid movement.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -1230,6 +1289,15 @@ public:
    */
   void SetVolume_Deformation(CGeometry *geometry, CConfig *config, bool UpdateGeo, bool Derivative = false);
 
+  /*!
+   * \brief Grid deformation by interpolation of the boundary displacements with radial basis functions.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] UpdateGeo - Update geometry.
+   * \param[in] Screen_Output - Print the deformation summary to the console.
+   */
+  void SetVolume_Deformation_RBF(CGeometry *geometry, CConfig *config, bool UpdateGeo, bool Screen_Output);
+
   /*!
    * \brief Grid deformation using the spring analogy method.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -1478,6 +1546,7 @@ protected:
   unsigned short nFFDBox;	/*!< \brief Number of FFD FFDBoxes. */
   unsigned short nLevel;	/*!< \brief Level of the FFD FFDBoxes (parent/child). */
   bool FFDBoxDefinition;	/*!< \brief If the FFD FFDBox has been defined in the input file. */
+  bool FFDBoxStored;	/*!< \brief If the FFD boxes read from the grid file are kept for the next deformations. */
 
 public:
   vector<su2double> GlobalCoordX[MAX_NUMBER_FFD];
@@ -1685,6 +1754,8 @@ public:
   
   /*!
    * \brief Set the surface/boundary deformation.
+   * \note Cartesian FFD boxes without nested levels are read from the grid file by the first call only, the
+   *       next calls (repeated deformations of the same grid) start from their original control points.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
    */
@@ -1951,10 +2022,12 @@ public:
 
   /*!
    * \brief Set derivatives of the surface/boundary deformation.
+   * \note With the vector forward mode each active design variable is seeded in its own direction.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
+   * \return Number of derivative directions that were seeded.
    */
-  void SetSurface_Derivative(CGeometry *geometry, CConfig *config);
+  unsigned short SetSurface_Derivative(CGeometry *geometry, CConfig *config);
 };
 
 #include "grid_movement_structure.inl"
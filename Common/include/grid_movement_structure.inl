@@ -71,11 +71,13 @@ inline void CFreeFormDefBox::Set_CartesianCoord(su2double *val_coord, unsigned l
 																																																			CartesianCoord[1][val_iSurfacePoints] = val_coord[1]; 
 																																																			CartesianCoord[2][val_iSurfacePoints] = val_coord[2]; }		
 
-inline void CFreeFormDefBox::Set_ParametricCoord(su2double *val_coord) { ParametricCoord[0].push_back(val_coord[0]);
+inline void CFreeFormDefBox::Set_ParametricCoord(su2double *val_coord) { SurfaceBasis_Set = false;
+                                                                         ParametricCoord[0].push_back(val_coord[0]);
 																																		 ParametricCoord[1].push_back(val_coord[1]); 
 																																		 ParametricCoord[2].push_back(val_coord[2]); }
 																																		 
-inline void CFreeFormDefBox::Set_ParametricCoord(su2double *val_coord, unsigned long val_iSurfacePoints) { ParametricCoord[0][val_iSurfacePoints] = val_coord[0];
+inline void CFreeFormDefBox::Set_ParametricCoord(su2double *val_coord, unsigned long val_iSurfacePoints) { SurfaceBasis_Set = false;
+                                                                                                          ParametricCoord[0][val_iSurfacePoints] = val_coord[0];
 																																																			 ParametricCoord[1][val_iSurfacePoints] = val_coord[1]; 
 																																																			 ParametricCoord[2][val_iSurfacePoints] = val_coord[2]; }
 
@@ -131,11 +133,11 @@ inline unsigned short CFreeFormDefBox::GetmOrder(void) { return mOrder; }
 
 inline unsigned short CFreeFormDefBox::GetnOrder(void) { return nOrder; }
 
-inline void CFreeFormDefBox::SetlOrder(unsigned short val_lOrder) { lOrder = val_lOrder; lDegree = lOrder-1; }
+inline void CFreeFormDefBox::SetlOrder(unsigned short val_lOrder) { lOrder = val_lOrder; lDegree = lOrder-1; SurfaceBasis_Set = false; }
 
-inline void CFreeFormDefBox::SetmOrder(unsigned short val_mOrder) { mOrder = val_mOrder; mDegree = mOrder-1; }
+inline void CFreeFormDefBox::SetmOrder(unsigned short val_mOrder) { mOrder = val_mOrder; mDegree = mOrder-1; SurfaceBasis_Set = false; }
 
-inline void CFreeFormDefBox::SetnOrder(unsigned short val_nOrder) { nOrder = val_nOrder; nDegree = nOrder-1;}
+inline void CFreeFormDefBox::SetnOrder(unsigned short val_nOrder) { nOrder = val_nOrder; nDegree = nOrder-1; SurfaceBasis_Set = false;}
 
 inline void  CFreeFormDefBox::SetCoordCornerPoints(su2double *val_coord, unsigned short val_icornerpoints) {
 	for (unsigned short iDim = 0; iDim < nDim; iDim++) 
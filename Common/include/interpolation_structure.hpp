@@ -379,6 +379,8 @@ public:
   bool CheckPointInsideTriangle(su2double* Point, su2double* T1, su2double* T2, su2double* T3);
 };
 
+class CSymmetricMatrix;
+
 /*!
  * \brief Radial basis function interpolation
  */
@@ -432,6 +434,34 @@ private:
    */
   void Check_PolynomialTerms(int m, unsigned long n, const int *skip_row, su2double max_diff_tol_in, int *keep_row, int &n_polynomial, su2double *P);
 
+  /*!
+   * \brief Set up the transfer coefficients with local interpolations, each target point using only
+   * its patch of nearest donor points, i.e. a dense system of the size of the patch instead of all donor points.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] mark_target - target marker of the interface
+   * \param[in] nVertexTarget - number of vertices of the target marker
+   * \param[in] nGlobalVertexDonor - number of donor vertices gathered from all ranks
+   * \param[in] nDim - number of dimensions
+   */
+  void Set_TransferCoeff_Patches(CConfig **config, int mark_target, unsigned long nVertexTarget,
+                                 unsigned long nGlobalVertexDonor, unsigned short nDim);
+
+  /*!
+   * \brief Invert the matrix of basis function values of a set of donor points and form the rows of the interpolation
+   * matrix that multiply the polynomial terms and the basis function values of a target point.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] nDonor - number of donor points
+   * \param[in] nDim - number of dimensions
+   * \param[in] donorCoord - coordinates of the donor points (nDonor x nDim)
+   * \param[in,out] M - basis function values between the donor points, inverted on exit
+   * \param[out] nPolynomial - number of polynomial terms (excluding the constant one)
+   * \param[out] calc_polynomial_check - marks the coordinates kept in the polynomial terms
+   * \return (nDonor+nPolynomial+1) x nDonor matrix in row major order (nDonor x nDonor without polynomial terms), allocated here
+   */
+  su2double* Get_InterpolationMatrix(CConfig *config, unsigned long nDonor, unsigned short nDim,
+                                     const su2double *donorCoord, CSymmetricMatrix &M,
+                                     int &nPolynomial, int *calc_polynomial_check);
+
 };
 
 /*!
@@ -0,0 +1,165 @@
+/*!
+ * \file CAlgebraicMultigrid.hpp
+ * \brief Smoothed aggregation algebraic multigrid for block sparse matrices.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../datatype_structure.hpp"
+
+#include <vector>
+#include <utility>
+
+using namespace std;
+
+/*!
+ * \class CAlgebraicMultigrid
+ * \brief Smoothed aggregation AMG hierarchy for block-CSR matrices (as stored by CSysMatrix).
+ *
+ * The hierarchy is built from the rows and columns of the matrix that are owned by
+ * this rank (halo couplings are dropped), the result is therefore an additive Schwarz
+ * type preconditioner across ranks, similar to what is done for ILU. The tentative
+ * prolongation uses the nVar "translation" modes (one per variable) as near null space,
+ * it is smoothed with one weighted Jacobi step. The V-cycle uses weighted block Jacobi
+ * smoothing, which makes it thread-parallel (it is designed to be called by all threads),
+ * and a dense LU factorization on the coarsest level.
+ */
+template<class ScalarType>
+class CAlgebraicMultigrid {
+private:
+  enum : unsigned long { MAX_LEVELS = 12 };        /*!< \brief Maximum number of levels in the hierarchy. */
+  enum : unsigned long { MAX_DIRECT_SIZE = 1500 }; /*!< \brief Max. number of unknowns for the direct coarse solve. */
+  enum : unsigned long { MIN_COARSE_SIZE = 100 };  /*!< \brief Stop coarsening below this number of blocks. */
+  enum : unsigned long { NUM_SMOOTH = 2 };         /*!< \brief Number of pre and post smoothing sweeps. */
+  enum : unsigned long { NUM_COARSE_SMOOTH = 20 }; /*!< \brief Sweeps on the coarsest level when it is too large to factorize. */
+
+  /*!
+   * \brief Block-CSR storage for the operators of the hierarchy.
+   */
+  struct CBlockCSR {
+    unsigned long nRows = 0;       /*!< \brief Number of block rows. */
+    vector<unsigned long> row_ptr; /*!< \brief Pointers to the first element in each row. */
+    vector<unsigned long> col_ind; /*!< \brief Column index of each block. */
+    vector<ScalarType> values;     /*!< \brief Blocks, stored row major. */
+  };
+
+  /*!
+   * \brief Data of each level, the prolongation and restriction are to/from the next (coarser) level.
+   */
+  struct CLevel {
+    CBlockCSR A;                    /*!< \brief Operator of the level. */
+    vector<unsigned long> dia_ptr;  /*!< \brief Position of the diagonal block in each row of A. */
+    vector<ScalarType> inv_diag;    /*!< \brief Inverse of the diagonal blocks. */
+    ScalarType omega = 0.0;         /*!< \brief Weight of the Jacobi smoother. */
+    CBlockCSR P;                    /*!< \brief Prolongation from the next level. */
+    CBlockCSR R;                    /*!< \brief Restriction to the next level (transpose of P). */
+    mutable vector<ScalarType> x, b, r; /*!< \brief Working vectors, solution, rhs and residual. */
+  };
+
+  unsigned long nVar = 0;           /*!< \brief Block size. */
+  vector<CLevel> levels;            /*!< \brief The hierarchy, the first level is the input matrix. */
+  vector<ScalarType> coarse_lu;     /*!< \brief Dense LU factors of the coarsest operator (if small enough). */
+  vector<unsigned long> coarse_piv; /*!< \brief Pivoting of the dense LU factorization. */
+
+  /*!
+   * \brief Compute the inverse diagonal blocks and the weight of the smoother of a level.
+   */
+  void SetupSmoother(CLevel& level) const;
+
+  /*!
+   * \brief Group the rows of a level in aggregates based on the strength of their connections.
+   * \param[in] level - The level being coarsened.
+   * \param[out] aggregate - Aggregate of each row.
+   * \return Number of aggregates.
+   */
+  unsigned long Aggregate(const CLevel& level, vector<unsigned long>& aggregate) const;
+
+  /*!
+   * \brief Build the smoothed prolongation operator of a level from its aggregates.
+   */
+  void BuildProlongation(CLevel& level, const vector<unsigned long>& aggregate, unsigned long nAggregates) const;
+
+  /*!
+   * \brief Transpose a block-CSR matrix (also transposes the blocks).
+   */
+  void Transpose(const CBlockCSR& mat, unsigned long nCols, CBlockCSR& matT) const;
+
+  /*!
+   * \brief Sparse product of block-CSR matrices, C = A * B.
+   */
+  void Multiply(const CBlockCSR& A, const CBlockCSR& B, unsigned long nColsB, CBlockCSR& C) const;
+
+  /*!
+   * \brief Allocate the working vectors and find the diagonal of a new level.
+   */
+  void InitializeLevel(CLevel& level) const;
+
+  /*!
+   * \brief Factorize the coarsest operator as a dense matrix (if it is small enough).
+   */
+  void FactorizeCoarsest();
+
+  /*!
+   * \brief Weighted block Jacobi sweeps, x += omega * D^-1 (b - A x).
+   * \param[in] level - Level where the smoothing is performed.
+   * \param[in] b - Right hand side.
+   * \param[in,out] x - Solution (used as initial guess if not zeroGuess).
+   * \param[in] nSweeps - Number of sweeps.
+   * \param[in] zeroGuess - The initial solution is zero (skips a product).
+   */
+  void Smooth(const CLevel& level, const ScalarType* b, ScalarType* x, unsigned long nSweeps, bool zeroGuess) const;
+
+  /*!
+   * \brief Recursive V-cycle starting at level iLevel.
+   */
+  void VCycle(unsigned long iLevel, const ScalarType* b, ScalarType* x) const;
+
+public:
+  /*!
+   * \brief Build the hierarchy from a block-CSR matrix.
+   * \note Only the master thread should call this method.
+   * \param[in] nVar - Block size.
+   * \param[in] nPointDomain - Number of rows (and columns) considered (owned by this rank).
+   * \param[in] row_ptr - Pointers to the first element in each row.
+   * \param[in] col_ind - Column indices.
+   * \param[in] values - Matrix blocks.
+   * \param[in] transposed - Build the hierarchy for the transposed matrix.
+   */
+  void Build(unsigned long nVar, unsigned long nPointDomain, const su2localidx *row_ptr,
+             const su2localidx *col_ind, const ScalarType *values, bool transposed);
+
+  /*!
+   * \brief Apply one V-cycle to b (with zero initial guess), the result is stored in x.
+   * \note This method should be called by all threads.
+   * \param[in] b - Right hand side, at least nPointDomain*nVar entries.
+   * \param[out] x - Result, at least nPointDomain*nVar entries.
+   */
+  void Apply(const ScalarType* b, ScalarType* x) const;
+
+  /*!
+   * \brief Get the number of levels in the hierarchy.
+   */
+  inline unsigned long GetNumLevels() const { return levels.size(); }
+};
@@ -0,0 +1,133 @@
+/*!
+ * \file CDeviceLinearSystem.hpp
+ * \brief Storage and kernels of the sparse linear systems on the offload device (e.g. GPU).
+ *        The implementation is in the <i>CDeviceLinearSystem.cpp</i> file.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../datatype_structure.hpp"
+
+#include <vector>
+
+using namespace std;
+
+template<class ScalarType> class CSysMatrix;
+
+/*!
+ * \class CDeviceLinearSystem
+ * \brief Copy of a block-CSR matrix (as stored by CSysMatrix), of its block Jacobi preconditioner,
+ *        and of the vectors of a Krylov solver, resident on the offload device.
+ *
+ * The sparse pattern is uploaded once and kept while it does not change, the values of the
+ * matrix are uploaded for each system and the inverse diagonal blocks when the preconditioner
+ * is rebuilt. The vectors live in one allocation and are identified by their index, they have
+ * the size of the host vectors (domain and halo points), the products and the preconditioner
+ * only operate on the domain points and the reductions are local to the rank.
+ * Without offload support the "device" is the host, for testing.
+ * \note Only the master thread should call the methods of this class.
+ */
+template<class ScalarType>
+class CDeviceLinearSystem {
+private:
+  unsigned long nVar = 0;          /*!< \brief Block size. */
+  unsigned long nPoint = 0;        /*!< \brief Number of block rows (domain and halo). */
+  unsigned long nPointDomain = 0;  /*!< \brief Number of block rows owned by this rank. */
+  unsigned long nnz = 0;           /*!< \brief Number of blocks of the matrix. */
+  unsigned long nVector = 0;       /*!< \brief Number of vectors allocated. */
+
+  const su2localidx* hostRowPtr = nullptr;   /*!< \brief Host pattern that was uploaded, to detect changes. */
+  const su2localidx* hostColInd = nullptr;   /*!< \brief Host pattern that was uploaded, to detect changes. */
+
+  su2localidx* row_ptr = nullptr;   /*!< \brief Pointers to the first block of each row (device). */
+  su2localidx* col_ind = nullptr;   /*!< \brief Column index of each block (device). */
+  ScalarType* matrix = nullptr;     /*!< \brief Blocks of the matrix (device). */
+  ScalarType* invM = nullptr;       /*!< \brief Inverse of the diagonal blocks (device). */
+  ScalarType* vectors = nullptr;    /*!< \brief Storage of the vectors (device). */
+
+  /*!
+   * \brief Release the device memory.
+   */
+  void Clear();
+
+public:
+  CDeviceLinearSystem() = default;
+  CDeviceLinearSystem(const CDeviceLinearSystem&) = delete;
+  CDeviceLinearSystem& operator=(const CDeviceLinearSystem&) = delete;
+
+  /*!
+   * \brief Destructor, releases the device memory.
+   */
+  ~CDeviceLinearSystem();
+
+  /*!
+   * \brief Upload the matrix, and allocate the vectors.
+   * \param[in] mat - The matrix, its Jacobi preconditioner must have been built if newInverse is true.
+   * \param[in] newInverse - Upload the inverse diagonal blocks (the preconditioner was rebuilt).
+   * \param[in] numVectors - Number of vectors needed by the solver.
+   */
+  void SetMatrix(const CSysMatrix<ScalarType>& mat, bool newInverse, unsigned long numVectors);
+
+  /*!
+   * \brief Get the device address of a vector.
+   */
+  inline ScalarType* GetVector(unsigned long iVec) const { return vectors + iVec*nPoint*nVar; }
+
+  /*!
+   * \brief Copy entries [begin, end) of a host array to a device vector.
+   */
+  void Upload(const ScalarType* src, unsigned long iVec, unsigned long begin, unsigned long end) const;
+
+  /*!
+   * \brief Copy entries [begin, end) of a device vector to a host array.
+   */
+  void Download(unsigned long iVec, ScalarType* dst, unsigned long begin, unsigned long end) const;
+
+  /*!
+   * \brief Matrix-vector product y = A x, for the domain rows (the halos of x must be up to date).
+   */
+  void MatVec(unsigned long x, unsigned long y) const;
+
+  /*!
+   * \brief Block Jacobi preconditioner y = D^{-1} x, for the domain rows.
+   */
+  void Jacobi(unsigned long x, unsigned long y) const;
+
+  /*!
+   * \brief y = a x + b y, for the domain entries.
+   */
+  void Axpby(ScalarType a, unsigned long x, ScalarType b, unsigned long y) const;
+
+  /*!
+   * \brief Local dot products of v with vectors [first, first+n) and with itself (stored in dots[n]).
+   */
+  void MultiDot(unsigned long first, unsigned long n, unsigned long v, ScalarType* dots) const;
+
+  /*!
+   * \brief v -= sum_k coef[k] * w_k, for vectors w_k in [first, first+n) and the domain entries.
+   */
+  void MultiAxpy(unsigned long first, unsigned long n, const ScalarType* coef, unsigned long v) const;
+
+};
@@ -36,6 +36,7 @@ extern "C" {
 }
 }
 #include <vector>
+#include "../datatype_structure.hpp"
 
 using namespace std;
 
@@ -66,8 +67,8 @@ private:
     unsigned long nVar = 0;
     unsigned long nPoint = 0;
     unsigned long nPointDomain = 0;
-    const unsigned long *rowptr = nullptr;
-    const unsigned long *colidx = nullptr;
+    const su2localidx *rowptr = nullptr;
+    const su2localidx *colidx = nullptr;
     const passivedouble *values = nullptr;
 
     unsigned long size_rhs() {return nPointDomain*nVar;}
@@ -78,6 +79,7 @@ private:
   bool isinitialized;  /*!< \brief Signals that the sparsity pattern has been set. */
   bool isfactorized;   /*!< \brief Signals that a factorization has been computed. */
   unsigned long iter;  /*!< \brief Number of times a factorization has been requested. */
+  unsigned long factTimeIter; /*!< \brief Time iteration of the last factorization. */
   unsigned short verb; /*!< \brief Verbosity level. */
   int mpi_size, mpi_rank;
 
@@ -93,17 +95,20 @@ private:
   }
 
   /*!
-   * \brief Run the "clean" task, releases all memory, leaves object in unusable state.
+   * \brief Run the "clean" task, releases all memory (including the analysis), which is then
+   *        redone by the next factorization.
    */
   void Clean() {
     using namespace PaStiX;
-    if(isfactorized) {
+    if(isinitialized) {
       iparm[IPARM_VERBOSE] = (verb > 0) ? API_VERBOSE_NO : API_VERBOSE_NOT;
       iparm[IPARM_START_TASK] = API_TASK_CLEAN;
       iparm[IPARM_END_TASK]   = API_TASK_CLEAN;
       Run();
-      isfactorized = false;
     }
+    isinitialized = false;
+    isfactorized = false;
+    iter = 0;
   }
 
   /*!
@@ -116,7 +121,7 @@ public:
    * \brief Class constructor.
    */
   CPastixWrapper() : state(nullptr), issetup(false), isinitialized(false),
-                     isfactorized(false), iter(0), verb(0) {
+                     isfactorized(false), iter(0), factTimeIter(0), verb(0) {
     mpi_size = SU2_MPI::GetSize();
     mpi_rank = SU2_MPI::GetRank();
   }
@@ -133,7 +138,7 @@ public:
   ~CPastixWrapper() { Clean(); }
 
   /*!
-   * \brief Set matrix data, only once.
+   * \brief Set matrix data, the ordering and symbolic analysis are only redone if the pattern changes.
    * \param[in] nVar - DOF per point.
    * \param[in] nPoint - Total number of points including halos.
    * \param[in] nPointDomain - Number of internal points.
@@ -144,11 +149,16 @@ public:
   void SetMatrix(unsigned long nVar,
                  unsigned long nPoint,
                  unsigned long nPointDomain,
-                 const unsigned long *rowptr,
-                 const unsigned long *colidx,
+                 const su2localidx *rowptr,
+                 const su2localidx *colidx,
                  const passivedouble *values) {
 
-    if (issetup) return;
+    if (issetup && (matrix.nVar == nVar) && (matrix.nPoint == nPoint) && (matrix.nPointDomain == nPointDomain) &&
+        (matrix.rowptr == rowptr) && (matrix.colidx == colidx) && (matrix.values == values)) return;
+
+    /*--- The matrix was (re)allocated. ---*/
+    Clean();
+
     matrix.nVar = nVar;
     matrix.nPoint = nPoint;
     matrix.nPointDomain = nPointDomain;
@@ -172,6 +172,167 @@ public:
 };
 
 
+/*!
+ * \class CAMGPreconditioner
+ * \brief Specialization of preconditioner that uses the smoothed aggregation AMG of the CSysMatrix class.
+ */
+template<class ScalarType>
+class CAMGPreconditioner final : public CPreconditioner<ScalarType> {
+private:
+  CSysMatrix<ScalarType>& sparse_matrix; /*!< \brief Pointer to matrix that defines the preconditioner. */
+  CGeometry* geometry;                   /*!< \brief Pointer to geometry associated with the matrix. */
+  CConfig* config;                       /*!< \brief Pointer to problem configuration. */
+  bool transp;                           /*!< \brief If the transpose version of the preconditioner is required. */
+
+public:
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] matrix_ref - Matrix reference that will be used to define the preconditioner.
+   * \param[in] geometry_ref - Geometry associated with the problem.
+   * \param[in] config_ref - Config of the problem.
+   * \param[in] transposed - If the transpose version of the preconditioner is required.
+   */
+  inline CAMGPreconditioner(CSysMatrix<ScalarType> & matrix_ref,
+                            CGeometry *geometry_ref, CConfig *config_ref, bool transposed) :
+    sparse_matrix(matrix_ref)
+  {
+    if((geometry_ref == nullptr) || (config_ref == nullptr))
+      SU2_MPI::Error("Preconditioner needs to be built with valid references.", CURRENT_FUNCTION);
+    geometry = geometry_ref;
+    config = config_ref;
+    transp = transposed;
+  }
+
+  /*!
+   * \note This class cannot be default constructed as that would leave us with invalid Pointers.
+   */
+  CAMGPreconditioner() = delete;
+
+  /*!
+   * \brief Operator that defines the preconditioner operation.
+   * \param[in] u - CSysVector that is being preconditioned.
+   * \param[out] v - CSysVector that is the result of the preconditioning.
+   */
+  inline void operator()(const CSysVector<ScalarType> & u, CSysVector<ScalarType> & v) const override {
+    sparse_matrix.ComputeAMGPreconditioner(u, v, geometry, config);
+  }
+
+  /*!
+   * \note Request the associated matrix to build the preconditioner.
+   */
+  inline void Build() override {
+    sparse_matrix.BuildAMGPreconditioner(transp);
+  }
+};
+
+
+/*!
+ * \class CPolynomialPreconditioner
+ * \brief Specialization of preconditioner that uses a polynomial (truncated Neumann series or Chebyshev) of the
+ *        block Jacobi preconditioned matrix of the CSysMatrix class, applied with matrix-vector products only.
+ */
+template<class ScalarType>
+class CPolynomialPreconditioner final : public CPreconditioner<ScalarType> {
+private:
+  CSysMatrix<ScalarType>& sparse_matrix; /*!< \brief Pointer to matrix that defines the preconditioner. */
+  CGeometry* geometry;                   /*!< \brief Pointer to geometry associated with the matrix. */
+  CConfig* config;                       /*!< \brief Pointer to problem configuration. */
+  bool chebyshev;                        /*!< \brief Chebyshev polynomial, otherwise Neumann series. */
+
+public:
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] matrix_ref - Matrix reference that will be used to define the preconditioner.
+   * \param[in] geometry_ref - Geometry associated with the problem.
+   * \param[in] config_ref - Config of the problem.
+   * \param[in] kind_prec - NEUMANN_PREC or CHEBYSHEV.
+   */
+  inline CPolynomialPreconditioner(CSysMatrix<ScalarType> & matrix_ref,
+                                   CGeometry *geometry_ref, CConfig *config_ref, unsigned short kind_prec) :
+    sparse_matrix(matrix_ref)
+  {
+    if((geometry_ref == nullptr) || (config_ref == nullptr))
+      SU2_MPI::Error("Preconditioner needs to be built with valid references.", CURRENT_FUNCTION);
+    geometry = geometry_ref;
+    config = config_ref;
+    chebyshev = (kind_prec == CHEBYSHEV);
+  }
+
+  /*!
+   * \note This class cannot be default constructed as that would leave us with invalid Pointers.
+   */
+  CPolynomialPreconditioner() = delete;
+
+  /*!
+   * \brief Operator that defines the preconditioner operation.
+   * \param[in] u - CSysVector that is being preconditioned.
+   * \param[out] v - CSysVector that is the result of the preconditioning.
+   */
+  inline void operator()(const CSysVector<ScalarType> & u, CSysVector<ScalarType> & v) const override {
+    if (chebyshev) sparse_matrix.ComputeChebyshevPreconditioner(u, v, geometry, config);
+    else sparse_matrix.ComputeNeumannPreconditioner(u, v, geometry, config);
+  }
+
+  /*!
+   * \note Request the associated matrix to build the preconditioner.
+   */
+  inline void Build() override {
+    sparse_matrix.BuildPolynomialPreconditioner(chebyshev, geometry, config);
+  }
+};
+
+
+/*!
+ * \class CSPAIPreconditioner
+ * \brief Specialization of preconditioner that uses the block sparse approximate inverse of the CSysMatrix class.
+ */
+template<class ScalarType>
+class CSPAIPreconditioner final : public CPreconditioner<ScalarType> {
+private:
+  CSysMatrix<ScalarType>& sparse_matrix; /*!< \brief Pointer to matrix that defines the preconditioner. */
+  CGeometry* geometry;                   /*!< \brief Pointer to geometry associated with the matrix. */
+  CConfig* config;                       /*!< \brief Pointer to problem configuration. */
+
+public:
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] matrix_ref - Matrix reference that will be used to define the preconditioner.
+   * \param[in] geometry_ref - Geometry associated with the problem.
+   * \param[in] config_ref - Config of the problem.
+   */
+  inline CSPAIPreconditioner(CSysMatrix<ScalarType> & matrix_ref,
+                             CGeometry *geometry_ref, CConfig *config_ref) :
+    sparse_matrix(matrix_ref)
+  {
+    if((geometry_ref == nullptr) || (config_ref == nullptr))
+      SU2_MPI::Error("Preconditioner needs to be built with valid references.", CURRENT_FUNCTION);
+    geometry = geometry_ref;
+    config = config_ref;
+  }
+
+  /*!
+   * \note This class cannot be default constructed as that would leave us with invalid Pointers.
+   */
+  CSPAIPreconditioner() = delete;
+
+  /*!
+   * \brief Operator that defines the preconditioner operation.
+   * \param[in] u - CSysVector that is being preconditioned.
+   * \param[out] v - CSysVector that is the result of the preconditioning.
+   */
+  inline void operator()(const CSysVector<ScalarType> & u, CSysVector<ScalarType> & v) const override {
+    sparse_matrix.ComputeSPAIPreconditioner(u, v, geometry, config);
+  }
+
+  /*!
+   * \note Request the associated matrix to build the preconditioner.
+   */
+  inline void Build() override {
+    sparse_matrix.BuildSPAIPreconditioner();
+  }
+};
+
+
 /*!
  * \class CLU_SGSPreconditioner
  * \brief Specialization of preconditioner that uses CSysMatrix class.
@@ -264,6 +425,7 @@ public:
    */
   inline void Build() override {
     sparse_matrix.BuildJacobiPreconditioner(false);
+    sparse_matrix.BuildLineletFactorization();
   }
 };
 
@@ -31,6 +31,8 @@
 #include "../../include/mpi_structure.hpp"
 #include "CSysVector.hpp"
 #include "CPastixWrapper.hpp"
+#include "CAlgebraicMultigrid.hpp"
+#include "../toolboxes/graph_toolbox.hpp"
 
 #include <cstdlib>
 #include <vector>
@@ -38,7 +40,7 @@
 using namespace std;
 
 /*--- In forward mode the matrix is not of a built-in type. ---*/
-#if defined(HAVE_MKL) && !defined(CODI_FORWARD_TYPE)
+#if defined(HAVE_MKL) && !(defined(CODI_FORWARD_TYPE) || defined(USE_MIXED_PRECISION))
 #include "mkl.h"
 #ifndef __INTEL_MKL__
   #error Could not determine the MKL version
@@ -72,6 +74,9 @@ private:
   /*--- We are friends with all other possible CSysMatrices. ---*/
   template<class T> friend class CSysMatrix;
 
+  /*--- The device copy of the system reads the storage directly. ---*/
+  template<class T> friend class CDeviceLinearSystem;
+
   int rank;     /*!< \brief MPI Rank. */
   int size;     /*!< \brief MPI Size. */
 
@@ -92,28 +97,49 @@ private:
 
   ScalarType *matrix;               /*!< \brief Entries of the sparse matrix. */
   unsigned long nnz;                /*!< \brief Number of possible nonzero entries in the matrix. */
-  const unsigned long *row_ptr;     /*!< \brief Pointers to the first element in each row. */
-  const unsigned long *dia_ptr;     /*!< \brief Pointers to the diagonal element in each row. */
-  const unsigned long *col_ind;     /*!< \brief Column index for each of the elements in val(). */
-  const unsigned long *col_ptr;     /*!< \brief The transpose of col_ind, pointer to blocks with the same column index. */
+  const su2localidx *row_ptr;       /*!< \brief Pointers to the first element in each row. */
+  const su2localidx *dia_ptr;       /*!< \brief Pointers to the diagonal element in each row. */
+  const su2localidx *col_ind;       /*!< \brief Column index for each of the elements in val(). */
+  const su2localidx *col_ptr;       /*!< \brief The transpose of col_ind, pointer to blocks with the same column index. */
+
+  bool diag_only;                   /*!< \brief Only the diagonal blocks are stored (point implicit systems). */
+  CCompressedSparsePatternLocal diag_pattern; /*!< \brief Sparse pattern of the diagonal-only mode. */
+  CCompressedSparsePatternLocal user_pattern; /*!< \brief Sparse pattern given by the user of the matrix (not from the geometry). */
 
   ScalarType *ILU_matrix;           /*!< \brief Entries of the ILU sparse matrix. */
   unsigned long nnz_ilu;            /*!< \brief Number of possible nonzero entries in the matrix (ILU). */
-  const unsigned long *row_ptr_ilu; /*!< \brief Pointers to the first element in each row (ILU). */
-  const unsigned long *dia_ptr_ilu; /*!< \brief Pointers to the diagonal element in each row (ILU). */
-  const unsigned long *col_ind_ilu; /*!< \brief Column index for each of the elements in val() (ILU). */
+  const su2localidx *row_ptr_ilu;   /*!< \brief Pointers to the first element in each row (ILU). */
+  const su2localidx *dia_ptr_ilu;   /*!< \brief Pointers to the diagonal element in each row (ILU). */
+  const su2localidx *col_ind_ilu;   /*!< \brief Column index for each of the elements in val() (ILU). */
   unsigned short ilu_fill_in;       /*!< \brief Fill in level for the ILU preconditioner. */
 
+  bool ilu_level_sched;                       /*!< \brief Use level scheduling instead of partitioning to thread-parallelize ILU. */
+  CCompressedSparsePatternLocal ilu_lower_levels; /*!< \brief Rows of the ILU pattern grouped by level for the factorization and forward solve. */
+  CCompressedSparsePatternLocal ilu_upper_levels; /*!< \brief Rows of the ILU pattern grouped by level for the backward solve. */
+
   ScalarType *invM;                 /*!< \brief Inverse of (Jacobi) preconditioner, or diagonal of ILU. */
 
+  unsigned short poly_degree;       /*!< \brief Degree of the polynomial preconditioners (Neumann and Chebyshev). */
+  ScalarType cheby_lmin, cheby_lmax; /*!< \brief Interval of the eigenvalues of D^{-1}A of the Chebyshev preconditioner. */
+  mutable CSysVector<ScalarType> poly_work[4]; /*!< \brief Working vectors of the polynomial preconditioners, shared by the threads. */
+
+  ScalarType *SPAI_matrix;          /*!< \brief Blocks of the sparse approximate inverse, on the pattern of the matrix. */
+
+  vector<unsigned long> spmv_row_order; /*!< \brief Order of the rows in the product, rows sent to other ranks come first. */
+  unsigned long spmv_num_send_rows;     /*!< \brief Number of rows sent to other ranks (computed before the halo exchange). */
+
   unsigned long nLinelet;                      /*!< \brief Number of Linelets in the system. */
   vector<bool> LineletBool;                    /*!< \brief Identify if a point belong to a Linelet. */
   vector<vector<unsigned long> > LineletPoint; /*!< \brief Linelet structure. */
+  vector<unsigned long> LineletPtr;            /*!< \brief Position of the first point of each linelet in the factorization. */
+
+  /*--- Factorization of the tri-diagonal systems of the linelets, built with the preconditioner. ---*/
+  vector<const ScalarType*> LineletUpper; /*!< \brief Pointers to the upper blocks of the tri-diag systems. */
+  vector<ScalarType> LineletInvDiag;      /*!< \brief Inverse of the modified diagonal blocks of the tri-diag systems. */
+  vector<ScalarType> LineletWeight;       /*!< \brief Lower blocks times the inverse of the previous modified diagonal. */
 
   /*--- Temporary (hence mutable) working memory used in the Linelet preconditioner, outer vector is for threads ---*/
-  mutable vector<vector<const ScalarType*> > LineletUpper; /*!< \brief Pointers to the upper blocks of the tri-diag system (working memory). */
-  mutable vector<vector<ScalarType> > LineletInvDiag;      /*!< \brief Inverse of the diagonal blocks of the tri-diag system (working memory). */
-  mutable vector<vector<ScalarType> > LineletVector;       /*!< \brief Solution and RHS of the tri-diag system (working memory). */
+  mutable vector<vector<ScalarType> > LineletVector; /*!< \brief RHS of the tri-diag system (working memory). */
 
 #ifdef USE_MKL
   void * MatrixMatrixProductJitter;                            /*!< \brief Jitter handle for MKL JIT based GEMM. */
@@ -132,11 +158,13 @@ private:
   mutable CPastixWrapper pastix_wrapper;
 #endif
 
+  CAlgebraicMultigrid<ScalarType> amg_hierarchy; /*!< \brief Smoothed aggregation AMG hierarchy. */
+
   /*!
    * \brief Auxilary object to wrap the edge map pointer used in fast block updates, i.e. without linear searches.
    */
   struct {
-    const unsigned long *ptr = nullptr;
+    const su2localidx *ptr = nullptr;
 
     inline unsigned long operator() (unsigned long edge, unsigned long node) const {
       return ptr[2*edge+node];
@@ -293,6 +321,31 @@ private:
    */
   inline void SetBlockTransposed_ILUMatrix(unsigned long block_i, unsigned long block_j, ScalarType *val_block);
 
+  /*!
+   * \brief Factorize one row of the ILU matrix and invert its diagonal block.
+   * \note The rows above (lower part) must have been factorized already, only columns in [begin, end[ are considered.
+   * \param[in] iPoint - Row being factorized.
+   * \param[in] begin - Inclusive lower bound of the sub matrix being factorized.
+   * \param[in] end - Exclusive upper bound of the sub matrix being factorized.
+   */
+  inline void FactorizeRow_ILUMatrix(unsigned long iPoint, unsigned long begin, unsigned long end);
+
+  /*!
+   * \brief Forward solve step of one row of the ILU preconditioner, prod_i -= L_ij * prod_j.
+   * \param[in] iPoint - Row being solved.
+   * \param[in] begin - Inclusive lower bound for column indices considered.
+   * \param[in,out] prod - Vector being solved in place.
+   */
+  inline void ForwardSolveRow_ILUMatrix(unsigned long iPoint, unsigned long begin, CSysVector<ScalarType> & prod) const;
+
+  /*!
+   * \brief Backward substitution step of one row of the ILU preconditioner, prod_i = D_i^{-1} (prod_i - U_ij * prod_j).
+   * \param[in] iPoint - Row being solved.
+   * \param[in] end - Exclusive upper bound for column indices considered.
+   * \param[in,out] prod - Vector being solved in place.
+   */
+  inline void BackwardSolveRow_ILUMatrix(unsigned long iPoint, unsigned long end, CSysVector<ScalarType> & prod) const;
+
   /*!
    * \brief Performs the product of i-th row of the upper part of a sparse matrix by a vector.
    * \param[in] vec - Vector to be multiplied by the upper part of the sparse matrix A.
@@ -350,12 +403,33 @@ public:
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
    * \param[in] needTranspPtr - If "col_ptr" should be created.
+   * \note With JACOBIAN_DIAGONAL_ONLY, finite volume matrices only store the diagonal blocks, the
+   *       updates of off-diagonal blocks are then ignored.
    */
   void Initialize(unsigned long npoint, unsigned long npointdomain,
                   unsigned short nvar, unsigned short neqn,
                   bool EdgeConnect, CGeometry *geometry,
                   CConfig *config, bool needTranspPtr = false);
 
+  /*!
+   * \brief Initializes the sparse matrix system with a given sparse pattern, e.g. of the DOFs of a DG discretization.
+   * \param[in] npoint - Number of (owned) points, the matrix has no halo rows.
+   * \param[in] nvar - Number of variables.
+   * \param[in] neqn - Number of equations.
+   * \param[in] pattern - Sparse pattern of the point couplings, the columns of each row sorted and the diagonal present.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \note The pattern is owned by the matrix, the ILU preconditioner has no fill-in (the pattern is used).
+   */
+  void Initialize(unsigned long npoint, unsigned short nvar, unsigned short neqn,
+                  CCompressedSparsePatternLocal pattern, CGeometry *geometry, CConfig *config);
+
+  /*!
+   * \brief Only store the diagonal blocks, regardless of the type of connectivity (e.g. for matrix-free products).
+   * \note Must be called before Initialize, the updates of off-diagonal blocks are then ignored.
+   */
+  inline void SetDiagonalOnly(void) { diag_only = true; }
+
   /*!
    * \brief Sets to zero all the entries of the sparse matrix.
    */
@@ -394,6 +468,18 @@ public:
                      CConfig *config,
                      unsigned short commType) const;
 
+  /*!
+   * \brief Forward point-to-point communication of a vector (e.g. SOLUTION_MATRIX), with
+   *        the packing and unpacking of the buffers shared by the threads.
+   * \note To be called by all threads, the messages are exchanged by the master thread.
+   * \param[in,out] x   - CSysVector holding the array of data.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config   - Definition of the particular problem.
+   */
+  void CommunicateHalos(CSysVector<ScalarType> & x,
+                        CGeometry *geometry,
+                        CConfig *config) const;
+
   /*!
    * \brief Get a pointer to the start of block "ij"
    * \param[in] block_i - Row index.
@@ -550,6 +636,7 @@ public:
    * \param[in] jPoint - Row from which we subtract the blocks.
    * \param[in] block_i - Adds to ii, subs from ji.
    * \param[in] block_j - Adds to ij, subs from jj.
+   * \note In diagonal-only mode only ii and jj are updated.
    */
   template<class OtherType, int Sign = 1>
   inline void UpdateBlocks(unsigned long iEdge, unsigned long iPoint, unsigned long jPoint,
@@ -557,11 +644,23 @@ public:
 
     ScalarType *bii = &matrix[dia_ptr[iPoint]*nVar*nEqn];
     ScalarType *bjj = &matrix[dia_ptr[jPoint]*nVar*nEqn];
-    ScalarType *bij = &matrix[edge_ptr(iEdge,0)*nVar*nEqn];
-    ScalarType *bji = &matrix[edge_ptr(iEdge,1)*nVar*nEqn];
 
     unsigned long iVar, jVar, offset = 0;
 
+    if (diag_only) {
+      for (iVar = 0; iVar < nVar; iVar++) {
+        for (jVar = 0; jVar < nEqn; jVar++) {
+          bii[offset] += PassiveAssign<ScalarType,OtherType>(block_i[iVar][jVar]) * Sign;
+          bjj[offset] -= PassiveAssign<ScalarType,OtherType>(block_j[iVar][jVar]) * Sign;
+          ++offset;
+        }
+      }
+      return;
+    }
+
+    ScalarType *bij = &matrix[edge_ptr(iEdge,0)*nVar*nEqn];
+    ScalarType *bji = &matrix[edge_ptr(iEdge,1)*nVar*nEqn];
+
     for (iVar = 0; iVar < nVar; iVar++) {
       for (jVar = 0; jVar < nEqn; jVar++) {
         bii[offset] += PassiveAssign<ScalarType,OtherType>(block_i[iVar][jVar]) * Sign;
@@ -591,10 +690,13 @@ public:
    * \param[in] edge - Index of edge that connects iPoint and jPoint.
    * \param[in] block_i - Subs from ji.
    * \param[in] block_j - Adds to ij.
+   * \note Does nothing in diagonal-only mode.
    */
   template<class OtherType, int Sign = 1, bool Overwrite = false>
   inline void UpdateBlocks(unsigned long iEdge, const OtherType* const* block_i, const OtherType* const* block_j) {
 
+    if (diag_only) return;
+
     ScalarType *bij = &matrix[edge_ptr(iEdge,0)*nVar*nEqn];
     ScalarType *bji = &matrix[edge_ptr(iEdge,1)*nVar*nEqn];
 
@@ -625,6 +727,158 @@ public:
     UpdateBlocks<OtherType,1,true>(iEdge, block_i, block_j);
   }
 
+  /*!
+   * \brief Version of UpdateBlocks (4 blocks) for blocks stored in 2D containers, e.g. the fixed size
+   *        (MAXNVAR x MAXNVAR) contiguous storage of the numerics, the leading nVar x nEqn entries are used.
+   * \note The third template parameter only exists to exclude the version for pointers to rows.
+   */
+  template<class MatrixType, int Sign = 1, class OtherType = typename MatrixType::Scalar>
+  inline void UpdateBlocks(unsigned long iEdge, unsigned long iPoint, unsigned long jPoint,
+                           const MatrixType& block_i, const MatrixType& block_j) {
+
+    ScalarType *bii = &matrix[dia_ptr[iPoint]*nVar*nEqn];
+    ScalarType *bjj = &matrix[dia_ptr[jPoint]*nVar*nEqn];
+
+    unsigned long iVar, jVar, offset = 0;
+
+    if (diag_only) {
+      for (iVar = 0; iVar < nVar; iVar++) {
+        for (jVar = 0; jVar < nEqn; jVar++) {
+          bii[offset] += PassiveAssign<ScalarType,OtherType>(block_i(iVar,jVar)) * Sign;
+          bjj[offset] -= PassiveAssign<ScalarType,OtherType>(block_j(iVar,jVar)) * Sign;
+          ++offset;
+        }
+      }
+      return;
+    }
+
+    ScalarType *bij = &matrix[edge_ptr(iEdge,0)*nVar*nEqn];
+    ScalarType *bji = &matrix[edge_ptr(iEdge,1)*nVar*nEqn];
+
+    for (iVar = 0; iVar < nVar; iVar++) {
+      for (jVar = 0; jVar < nEqn; jVar++) {
+        const ScalarType vi = PassiveAssign<ScalarType,OtherType>(block_i(iVar,jVar)) * Sign;
+        const ScalarType vj = PassiveAssign<ScalarType,OtherType>(block_j(iVar,jVar)) * Sign;
+        bii[offset] += vi;
+        bij[offset] += vj;
+        bji[offset] -= vi;
+        bjj[offset] -= vj;
+        ++offset;
+      }
+    }
+  }
+
+  /*!
+   * \brief Version of UpdateBlocksSub (4 blocks) for blocks stored in 2D containers.
+   */
+  template<class MatrixType, class OtherType = typename MatrixType::Scalar>
+  inline void UpdateBlocksSub(unsigned long iEdge, unsigned long iPoint, unsigned long jPoint,
+                              const MatrixType& block_i, const MatrixType& block_j) {
+    UpdateBlocks<MatrixType,-1>(iEdge, iPoint, jPoint, block_i, block_j);
+  }
+
+  /*!
+   * \brief Version of UpdateBlocks (2 blocks) for blocks stored in 2D containers.
+   */
+  template<class MatrixType, int Sign = 1, bool Overwrite = false, class OtherType = typename MatrixType::Scalar>
+  inline void UpdateBlocks(unsigned long iEdge, const MatrixType& block_i, const MatrixType& block_j) {
+
+    if (diag_only) return;
+
+    ScalarType *bij = &matrix[edge_ptr(iEdge,0)*nVar*nEqn];
+    ScalarType *bji = &matrix[edge_ptr(iEdge,1)*nVar*nEqn];
+
+    unsigned long iVar, jVar, offset = 0;
+
+    for (iVar = 0; iVar < nVar; iVar++) {
+      for (jVar = 0; jVar < nEqn; jVar++) {
+        bij[offset] = (Overwrite? ScalarType(0) : bij[offset]) + PassiveAssign<ScalarType,OtherType>(block_j(iVar,jVar)) * Sign;
+        bji[offset] = (Overwrite? ScalarType(0) : bji[offset]) - PassiveAssign<ScalarType,OtherType>(block_i(iVar,jVar)) * Sign;
+        ++offset;
+      }
+    }
+  }
+
+  /*!
+   * \brief Version of UpdateBlocksSub (2 blocks) for blocks stored in 2D containers.
+   */
+  template<class MatrixType, class OtherType = typename MatrixType::Scalar>
+  inline void UpdateBlocksSub(unsigned long iEdge, const MatrixType& block_i, const MatrixType& block_j) {
+    UpdateBlocks<MatrixType,-1>(iEdge, block_i, block_j);
+  }
+
+  /*!
+   * \brief Version of SetBlocks for blocks stored in 2D containers.
+   */
+  template<class MatrixType, class OtherType = typename MatrixType::Scalar>
+  inline void SetBlocks(unsigned long iEdge, const MatrixType& block_i, const MatrixType& block_j) {
+    UpdateBlocks<MatrixType,1,true>(iEdge, block_i, block_j);
+  }
+
+  /*!
+   * \brief Update the row of one point of an edge, for loops where each point computes the fluxes of all its
+   *        edges (owner-computes) and so where the rows are not shared. The off-diagonal block is overwritten
+   *        (it is only touched by this edge), the contribution to the diagonal block is added.
+   * \param[in] iEdge - Edge that connects iPoint and the other point.
+   * \param[in] iPoint - Row to update, one of the points of the edge.
+   * \param[in] first - Whether iPoint is the first point of the edge (the flux is added, else subtracted).
+   * \param[in] block_i - Jacobian w.r.t. the first point of the edge.
+   * \param[in] block_j - Jacobian w.r.t. the second point of the edge.
+   */
+  template<class MatrixType, class OtherType = typename MatrixType::Scalar>
+  inline void SetRowBlocks(unsigned long iEdge, unsigned long iPoint, bool first,
+                           const MatrixType& block_i, const MatrixType& block_j) {
+
+    ScalarType *bii = &matrix[dia_ptr[iPoint]*nVar*nEqn];
+    ScalarType *bij = diag_only? nullptr : &matrix[edge_ptr(iEdge, first? 0 : 1)*nVar*nEqn];
+
+    const MatrixType& diag = first? block_i : block_j;
+    const MatrixType& offDiag = first? block_j : block_i;
+    const ScalarType sign = first? 1 : -1;
+
+    unsigned long iVar, jVar, offset = 0;
+
+    for (iVar = 0; iVar < nVar; iVar++) {
+      for (jVar = 0; jVar < nEqn; jVar++) {
+        bii[offset] += sign * PassiveAssign<ScalarType,OtherType>(diag(iVar,jVar));
+        if (bij) bij[offset] = sign * PassiveAssign<ScalarType,OtherType>(offDiag(iVar,jVar));
+        ++offset;
+      }
+    }
+  }
+
+  /*!
+   * \brief Version of AddBlock2Diag for blocks stored in 2D containers.
+   */
+  template<class MatrixType, class OtherType = typename MatrixType::Scalar>
+  inline void AddBlock2Diag(unsigned long block_i, const MatrixType& val_block) {
+
+    ScalarType *bii = &matrix[dia_ptr[block_i]*nVar*nEqn];
+
+    unsigned long iVar, jVar, offset = 0;
+
+    for (iVar = 0; iVar < nVar; iVar++)
+      for (jVar = 0; jVar < nEqn; jVar++)
+        bii[offset++] += PassiveAssign<ScalarType,OtherType>(val_block(iVar,jVar));
+
+  }
+
+  /*!
+   * \brief Version of SubtractBlock2Diag for blocks stored in 2D containers.
+   */
+  template<class MatrixType, class OtherType = typename MatrixType::Scalar>
+  inline void SubtractBlock2Diag(unsigned long block_i, const MatrixType& val_block) {
+
+    ScalarType *bii = &matrix[dia_ptr[block_i]*nVar*nEqn];
+
+    unsigned long iVar, jVar, offset = 0;
+
+    for (iVar = 0; iVar < nVar; iVar++)
+      for (jVar = 0; jVar < nEqn; jVar++)
+        bii[offset++] -= PassiveAssign<ScalarType,OtherType>(val_block(iVar,jVar));
+
+  }
+
   /*!
    * \brief Adds the specified block to the (i, i) subblock of the matrix-by-blocks structure.
    * \param[in] block_i - Diagonal index.
@@ -661,6 +915,15 @@ public:
 
   }
 
+  /*!
+   * \brief Set the (i, i) subblock of the matrix-by-blocks structure to zero.
+   * \param[in] block_i - Diagonal index.
+   */
+  inline void SetBlock2DiagZero(unsigned long block_i) {
+    ScalarType *bii = &matrix[dia_ptr[block_i]*nVar*nEqn];
+    for (auto k = 0ul; k < nVar*nEqn; k++) bii[k] = 0.0;
+  }
+
   /*!
    * \brief Adds the specified value to the diagonal of the (i, i) subblock
    *        of the matrix-by-blocks structure.
@@ -772,6 +1035,69 @@ public:
   void ComputeILUPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
                                 CGeometry *geometry, CConfig *config) const;
 
+  /*!
+   * \brief Build the smoothed aggregation AMG preconditioner.
+   * \param[in] transposed - Flag to use the transposed matrix to construct the preconditioner.
+   */
+  void BuildAMGPreconditioner(bool transposed = false);
+
+  /*!
+   * \brief Multiply CSysVector by the AMG preconditioner (one V-cycle).
+   * \param[in] vec - CSysVector to be multiplied by the preconditioner.
+   * \param[out] prod - Result of the product M*vec.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeAMGPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+                                CGeometry *geometry, CConfig *config) const;
+
+  /*!
+   * \brief Build the polynomial preconditioners, i.e. the block Jacobi preconditioner and, for Chebyshev,
+   *        an estimate of the largest eigenvalue of D^{-1}A by power iterations.
+   * \param[in] chebyshev - Build the Chebyshev preconditioner, otherwise the Neumann one.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void BuildPolynomialPreconditioner(bool chebyshev, CGeometry *geometry, CConfig *config);
+
+  /*!
+   * \brief Multiply CSysVector by the truncated Neumann series of the block Jacobi preconditioned matrix,
+   *        i.e. LINEAR_SOLVER_PREC_DEGREE Jacobi iterations for A*prod = vec from prod = 0.
+   * \param[in] vec - CSysVector to be multiplied by the preconditioner.
+   * \param[out] prod - Result of the product M*vec.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeNeumannPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+                                    CGeometry *geometry, CConfig *config) const;
+
+  /*!
+   * \brief Multiply CSysVector by the Chebyshev polynomial of the block Jacobi preconditioned matrix,
+   *        i.e. LINEAR_SOLVER_PREC_DEGREE Chebyshev iterations for A*prod = vec from prod = 0.
+   * \param[in] vec - CSysVector to be multiplied by the preconditioner.
+   * \param[out] prod - Result of the product M*vec.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeChebyshevPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+                                      CGeometry *geometry, CConfig *config) const;
+
+  /*!
+   * \brief Build the block sparse approximate inverse, the rows of M minimize ||I - M*A||_F on the pattern of
+   *        the matrix, restricted to the points of the rank (the halo couplings are dropped as for ILU).
+   */
+  void BuildSPAIPreconditioner();
+
+  /*!
+   * \brief Multiply CSysVector by the sparse approximate inverse.
+   * \param[in] vec - CSysVector to be multiplied by the preconditioner.
+   * \param[out] prod - Result of the product M*vec.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeSPAIPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+                                 CGeometry *geometry, CConfig *config) const;
+
   /*!
    * \brief Multiply CSysVector by the preconditioner
    * \param[in] vec - CSysVector to be multiplied by the preconditioner.
@@ -781,13 +1107,19 @@ public:
                                    CGeometry *geometry, CConfig *config) const;
 
   /*!
-   * \brief Build the Linelet preconditioner.
+   * \brief Build the Linelet preconditioner, i.e. the structure of the linelets (from the geometry).
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
    * \return Average number of points per linelet.
    */
   unsigned long BuildLineletPreconditioner(CGeometry *geometry, CConfig *config);
 
+  /*!
+   * \brief Factorize the tri-diagonal systems of the linelets (after BuildLineletPreconditioner).
+   * \note Must be called after the Jacobi preconditioner is built, the other points use it.
+   */
+  void BuildLineletFactorization();
+
   /*!
    * \brief Multiply CSysVector by the preconditioner
    * \param[in] vec - CSysVector to be multiplied by the preconditioner.
@@ -832,4 +1164,9 @@ inline passivedouble CSysMatrix<passivedouble>::ActiveAssign(const su2double & v
 
 template<> template<>
 inline passivedouble CSysMatrix<su2double>::ActiveAssign(const su2double & val) const { return SU2_TYPE::GetValue(val); }
+
+#ifdef USE_MIXED_PRECISION
+template<> template<>
+inline float CSysMatrix<float>::ActiveAssign(const su2double & val) const { return SU2_TYPE::GetValue(val); }
+#endif
 #endif
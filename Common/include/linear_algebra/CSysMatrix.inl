@@ -78,36 +78,99 @@ FORCEINLINE void CSysMatrix<ScalarType>::SetBlockTransposed_ILUMatrix(unsigned l
   }
 }
 
-template<class T, bool alpha, bool beta, bool transp>
-FORCEINLINE void gemv_impl(const unsigned long n, const T *a, const T *b, T *c) {
+/*--- Explicit vectorization of the block kernels, only for the built-in types (not the AD types). ---*/
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+#define BLOCK_SIMD
+#define BLOCK_SIMD_SUM(VAR)
+#else
+#define BLOCK_SIMD SU2_OMP_SIMD
+#define BLOCK_SIMD_SUM(VAR) SU2_OMP(simd reduction(+:VAR))
+#endif
+
+template<class T, unsigned long N, bool alpha, bool beta, bool transp>
+FORCEINLINE void gemv_impl(const unsigned long n_, const T *a, const T *b, T *c) {
   /*---
    This is a templated version of GEMV with the constants as boolean
    template parameters so that they can be optimized away at compilation.
-   This is still the traditional "row dot vector" method.
+   When N is not 0 it is the (compile time) size of the block, which allows
+   the loops to be fully unrolled and vectorized, otherwise n_ is used.
   ---*/
+  const unsigned long n = N? N : n_;
   unsigned long i, j;
-  for (i = 0; i < n; i++) {
-    if (!beta) c[i] = 0.0;
-    for (j = 0; j < n; j++) {
-      if (alpha) c[transp? j:i] += a[i*n+j] * b[transp? i:j];
-      else       c[transp? j:i] -= a[i*n+j] * b[transp? i:j];
+  if (!transp) {
+    /*--- Traditional "row dot vector" method. ---*/
+    for (i = 0; i < n; i++) {
+      T sum = 0.0;
+      BLOCK_SIMD_SUM(sum)
+      for (j = 0; j < n; j++)
+        sum += a[i*n+j] * b[j];
+      if (!beta) c[i] = sum;
+      else if (alpha) c[i] += sum;
+      else c[i] -= sum;
+    }
+  }
+  else {
+    /*--- Transposed product, axpy on the rows for unit stride access. ---*/
+    if (!beta) for (j = 0; j < n; j++) c[j] = 0.0;
+    for (i = 0; i < n; i++) {
+      const T bi = alpha? b[i] : -b[i];
+      BLOCK_SIMD
+      for (j = 0; j < n; j++)
+        c[j] += a[i*n+j] * bi;
     }
   }
 }
 
-template<class T>
-FORCEINLINE void gemm_impl(const unsigned long n, const T *a, const T *b, T *c) {
-  /*--- Same deal as for GEMV but here only the type is templated. ---*/
+template<class T, unsigned long N>
+FORCEINLINE void gemm_impl(const unsigned long n_, const T *a, const T *b, T *c) {
+  /*--- Same deal as for GEMV, the "i-k-j" loop order gives unit stride in the inner loop. ---*/
+  const unsigned long n = N? N : n_;
   unsigned long i, j, k;
   for (i = 0; i < n; i++) {
-    for (j = 0; j < n; j++) {
+    BLOCK_SIMD
+    for (j = 0; j < n; j++)
       c[i*n+j] = 0.0;
-      for (k = 0; k < n; k++)
-        c[i*n+j] += a[i*n+k] * b[k*n+j];
+    for (k = 0; k < n; k++) {
+      const T aik = a[i*n+k];
+      BLOCK_SIMD
+      for (j = 0; j < n; j++)
+        c[i*n+j] += aik * b[k*n+j];
     }
   }
 }
 
+/*---
+ Dispatch the block kernels to their specialized versions for the common block sizes, i.e. nDim+2 and
+ nDim+1 for compressible and incompressible flow, 1 and 2 for turbulence (and 3 for FEA), 6 and 7 for
+ flows with additional transported quantities. The block size is fixed when the matrix is initialized,
+ this branch is therefore perfectly predictable and it allows the kernels to remain inlined.
+---*/
+#define BLOCK_SIZE_DISPATCH(N, KERNEL, ...)  \
+switch (N) {                                \
+  case 1: KERNEL(1, __VA_ARGS__); break;     \
+  case 2: KERNEL(2, __VA_ARGS__); break;     \
+  case 3: KERNEL(3, __VA_ARGS__); break;     \
+  case 4: KERNEL(4, __VA_ARGS__); break;     \
+  case 5: KERNEL(5, __VA_ARGS__); break;     \
+  case 6: KERNEL(6, __VA_ARGS__); break;     \
+  case 7: KERNEL(7, __VA_ARGS__); break;     \
+  default: KERNEL(0, __VA_ARGS__); break;    \
+}
+
+template<class T, bool alpha, bool beta, bool transp>
+FORCEINLINE void gemv(const unsigned long n, const T *a, const T *b, T *c) {
+#define GEMV_KERNEL(SIZE, ...) gemv_impl<T,SIZE,alpha,beta,transp>(__VA_ARGS__)
+  BLOCK_SIZE_DISPATCH(n, GEMV_KERNEL, n, a, b, c)
+#undef GEMV_KERNEL
+}
+
+template<class T>
+FORCEINLINE void gemm(const unsigned long n, const T *a, const T *b, T *c) {
+#define GEMM_KERNEL(SIZE, ...) gemm_impl<T,SIZE>(__VA_ARGS__)
+  BLOCK_SIZE_DISPATCH(n, GEMM_KERNEL, n, a, b, c)
+#undef GEMM_KERNEL
+}
+
 #define __MATVECPROD_SIGNATURE__(TYPE,NAME) \
 FORCEINLINE void CSysMatrix<TYPE>::NAME(const TYPE *matrix, const TYPE *vector, TYPE *product) const
 
@@ -117,26 +180,26 @@ FORCEINLINE void CSysMatrix<TYPE>::NAME(const TYPE *matrix, const TYPE *vector,
 MATVECPROD_SIGNATURE( MatrixVectorProduct ) {
   /*---
    Without MKL (default) picture copying the body of gemv_impl
-   here and resolving the conditionals at compilation.
+   here and resolving the conditionals (and block size) at compilation.
   ---*/
-  gemv_impl<ScalarType,true,false,false>(nVar, matrix, vector, product);
+  gemv<ScalarType,true,false,false>(nVar, matrix, vector, product);
 }
 
 MATVECPROD_SIGNATURE( MatrixVectorProductAdd ) {
-  gemv_impl<ScalarType,true,true,false>(nVar, matrix, vector, product);
+  gemv<ScalarType,true,true,false>(nVar, matrix, vector, product);
 }
 
 MATVECPROD_SIGNATURE( MatrixVectorProductSub ) {
-  gemv_impl<ScalarType,false,true,false>(nVar, matrix, vector, product);
+  gemv<ScalarType,false,true,false>(nVar, matrix, vector, product);
 }
 
 MATVECPROD_SIGNATURE( MatrixVectorProductTransp ) {
-  gemv_impl<ScalarType,true,true,true>(nVar, matrix, vector, product);
+  gemv<ScalarType,true,true,true>(nVar, matrix, vector, product);
 }
 
 template<class ScalarType>
 FORCEINLINE void CSysMatrix<ScalarType>::MatrixMatrixProduct(const ScalarType *matrix_a, const ScalarType *matrix_b, ScalarType *product) const {
-  gemm_impl<ScalarType>(nVar, matrix_a, matrix_b, product);
+  gemm<ScalarType>(nVar, matrix_a, matrix_b, product);
 }
 #else
 MATVECPROD_SIGNATURE( MatrixVectorProduct ) {
@@ -169,24 +232,24 @@ FORCEINLINE void CSysMatrix<ScalarType>::MatrixMatrixProduct(const ScalarType *m
 /*--- WHEN using MKL, AND compiling for AD, we need to specialize for su2double to avoid mixing incompatible types. ---*/
 #define MATVECPROD_SPECIALIZATION(NAME) template<> __MATVECPROD_SIGNATURE__(su2double,NAME)
 MATVECPROD_SPECIALIZATION( MatrixVectorProduct ) {
-  gemv_impl<su2double,true,false,false>(nVar, matrix, vector, product);
+  gemv<su2double,true,false,false>(nVar, matrix, vector, product);
 }
 
 MATVECPROD_SPECIALIZATION( MatrixVectorProductAdd ) {
-  gemv_impl<su2double,true,true,false>(nVar, matrix, vector, product);
+  gemv<su2double,true,true,false>(nVar, matrix, vector, product);
 }
 
 MATVECPROD_SPECIALIZATION( MatrixVectorProductSub ) {
-  gemv_impl<su2double,false,true,false>(nVar, matrix, vector, product);
+  gemv<su2double,false,true,false>(nVar, matrix, vector, product);
 }
 
 MATVECPROD_SPECIALIZATION( MatrixVectorProductTransp ) {
-  gemv_impl<su2double,true,true,true>(nVar, matrix, vector, product);
+  gemv<su2double,true,true,true>(nVar, matrix, vector, product);
 }
 
 template<>
 FORCEINLINE void CSysMatrix<su2double>::MatrixMatrixProduct(const su2double *matrix_a, const su2double *matrix_b, su2double *product) const {
-  gemm_impl<su2double>(nVar, matrix_a, matrix_b, product);
+  gemm<su2double>(nVar, matrix_a, matrix_b, product);
 }
 #undef MATVECPROD_SPECIALIZATION
 #endif // CODI_REVERSE_TYPE
@@ -225,6 +288,92 @@ FORCEINLINE void CSysMatrix<ScalarType>::InverseDiagonalBlock_ILUMatrix(unsigned
   MatrixInverse(block, invBlock);
 }
 
+template<class ScalarType>
+FORCEINLINE void CSysMatrix<ScalarType>::FactorizeRow_ILUMatrix(unsigned long iPoint, unsigned long begin, unsigned long end) {
+
+  ScalarType weight[MAXNVAR*MAXNVAR], aux_block[MAXNVAR*MAXNVAR];
+
+  /*--- For this row (unknown), loop over its lower diagonal entries. ---*/
+
+  for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
+
+    /*--- jPoint is the column index (jPoint < iPoint). ---*/
+
+    auto jPoint = col_ind_ilu[index];
+
+    /*--- We only care about the sub matrix within "begin" and "end-1". ---*/
+
+    if (jPoint < begin) continue;
+
+    /*--- Multiply the block by the inverse of the corresponding diagonal block. ---*/
+
+    auto Block_ij = &ILU_matrix[index*nVar*nVar];
+    MatrixMatrixProduct(Block_ij, &invM[jPoint*nVar*nVar], weight);
+
+    /*--- "weight" holds Aij*inv(Ajj). Jump to the upper part of the jPoint row. ---*/
+
+    for (auto index_ = dia_ptr_ilu[jPoint]+1; index_ < row_ptr_ilu[jPoint+1]; index_++) {
+
+      /*--- Get the column index (kPoint > jPoint). ---*/
+
+      auto kPoint = col_ind_ilu[index_];
+
+      if (kPoint >= end) break;
+
+      /*--- If Aik exists, update it: Aik -= Aij*inv(Ajj)*Ajk ---*/
+
+      auto Block_ik = GetBlock_ILUMatrix(iPoint, kPoint);
+
+      if (Block_ik != nullptr) {
+        auto Block_jk = &ILU_matrix[index_*nVar*nVar];
+        MatrixMatrixProduct(weight, Block_jk, aux_block);
+        MatrixSubtraction(Block_ik, aux_block, Block_ik);
+      }
+    }
+
+    /*--- Lastly, store "weight" in the lower triangular part, which
+     will be reused during the forward solve in the precon/smoother. ---*/
+
+    for (auto iVar = 0ul; iVar < nVar*nVar; ++iVar)
+      Block_ij[iVar] = weight[iVar];
+  }
+
+  /*--- The diagonal block of this row is final, invert and store it to later compute the weights. ---*/
+
+  InverseDiagonalBlock_ILUMatrix(iPoint, &invM[iPoint*nVar*nVar]);
+}
+
+template<class ScalarType>
+FORCEINLINE void CSysMatrix<ScalarType>::ForwardSolveRow_ILUMatrix(unsigned long iPoint, unsigned long begin,
+                                                                   CSysVector<ScalarType> & prod) const {
+
+  for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
+    auto jPoint = col_ind_ilu[index];
+    if (jPoint < begin) continue;
+    auto Block_ij = &ILU_matrix[index*nVar*nVar];
+    MatrixVectorProductSub(Block_ij, &prod[jPoint*nVar], &prod[iPoint*nVar]);
+  }
+}
+
+template<class ScalarType>
+FORCEINLINE void CSysMatrix<ScalarType>::BackwardSolveRow_ILUMatrix(unsigned long iPoint, unsigned long end,
+                                                                    CSysVector<ScalarType> & prod) const {
+
+  ScalarType aux_vec[MAXNVAR];
+
+  for (auto iVar = 0ul; iVar < nVar; iVar++)
+    aux_vec[iVar] = prod[iPoint*nVar+iVar];
+
+  for (auto index = dia_ptr_ilu[iPoint]+1; index < row_ptr_ilu[iPoint+1]; index++) {
+    auto jPoint = col_ind_ilu[index];
+    if (jPoint >= end) break;
+    auto Block_ij = &ILU_matrix[index*nVar*nVar];
+    MatrixVectorProductSub(Block_ij, &prod[jPoint*nVar], aux_vec);
+  }
+
+  MatrixVectorProduct(&invM[iPoint*nVar*nVar], aux_vec, &prod[iPoint*nVar]);
+}
+
 template<class ScalarType>
 FORCEINLINE void CSysMatrix<ScalarType>::UpperProduct(const CSysVector<ScalarType> & vec, unsigned long row_i,
                                                       unsigned long col_ub, ScalarType *prod) const {
@@ -39,6 +39,7 @@
 #include <string>
 
 #include "CSysVector.hpp"
+#include "CDeviceLinearSystem.hpp"
 
 class CConfig;
 class CGeometry;
@@ -77,6 +78,14 @@ private:
   bool mesh_deform;    /*!< \brief Operate in mesh deformation mode, changes the source of solver options. */
   ScalarType Residual; /*!< \brief Residual at the end of a call to Solve. */
 
+  unsigned long PrecondAge;  /*!< \brief Number of calls to Solve that reused the preconditioner since it was last built. */
+  unsigned long PrecondIter; /*!< \brief Linear iterations of the call to Solve that last built the preconditioner. */
+  bool PrecondRebuild;       /*!< \brief Force the preconditioner to be built on the next call to Solve. */
+  bool MatrixUnchanged;      /*!< \brief The matrix of the next call to Solve is the same as in the last call. */
+
+  ScalarType Tolerance;      /*!< \brief Relative tolerance of the last call to Solve. */
+  ScalarType ResNorm_Old;    /*!< \brief Norm of the right hand side of the last call to Solve (adaptive tolerance). */
+
   mutable bool cg_ready;     /*!< \brief Indicate if memory used by CG is allocated. */
   mutable bool bcg_ready;    /*!< \brief Indicate if memory used by BCGSTAB is allocated. */
   mutable bool gmres_ready;  /*!< \brief Indicate if memory used by FGMRES is allocated. */
@@ -92,6 +101,16 @@ private:
 
   mutable vector<VectorType> W;  /*!< \brief Large matrix used by FGMRES, w^i+1 = A * z^i. */
   mutable vector<VectorType> Z;  /*!< \brief Large matrix used by FGMRES, preconditioned W. */
+  mutable vector<ScalarType> cgs_dots; /*!< \brief Shared result of the fused dot products of classical Gram-Schmidt. */
+
+  mutable bool gcro_ready;           /*!< \brief Indicate if memory used by GCRO_DR is allocated. */
+  mutable unsigned long nRecycled;   /*!< \brief Current size of the recycled subspace of GCRO_DR. */
+  mutable unsigned long oldestRecycled; /*!< \brief Position of the direction to replace when the subspace is full. */
+  mutable vector<VectorType> U;      /*!< \brief Recycled (deflation) subspace of GCRO_DR, kept across calls to Solve. */
+  mutable vector<VectorType> C;      /*!< \brief Image of the recycled subspace, C = A * U, orthonormal. */
+
+  mutable CDeviceLinearSystem<ScalarType> DeviceSystem; /*!< \brief Matrix and Krylov vectors on the offload device. */
+  mutable VectorType DeviceBuffer;   /*!< \brief Host copy of a device vector for its halo exchange. */
 
   VectorType  LinSysSol_tmp;        /*!< \brief Temporary used when it is necessary to interface between active and passive types. */
   VectorType  LinSysRes_tmp;        /*!< \brief Temporary used when it is necessary to interface between active and passive types. */
@@ -166,6 +185,30 @@ private:
    */
   void ModGramSchmidt(int i, vector<vector<ScalarType> > & Hsbg, vector<VectorType> & w) const;
 
+  /*!
+   * \brief Classical Gram-Schmidt orthogonalization with one reorthogonalization pass (CGS2)
+   *
+   * \param[in] i - index indicating which vector in w is being orthogonalized
+   * \param[in,out] Hsbg - the upper Hessenberg begin updated
+   * \param[in,out] w - the (i+1)th vector of w is orthogonalized against the
+   *                    previous vectors in w
+   *
+   * \pre the vectors w[0:i] are orthonormal
+   * \post the vectors w[0:i+1] are orthonormal
+   *
+   * All the dot products of each pass (and the norm of w[i+1]) are computed together,
+   * with a single global reduction, i.e. two reductions per call instead of O(i) in MGS.
+   */
+  void ClassicalGramSchmidt(int i, vector<vector<ScalarType> > & Hsbg, vector<VectorType> & w) const;
+
+  /*!
+   * \brief Fused dot products of w[i+1] with w[0:i+1], reduced across all threads and ranks.
+   * \param[in] i - index of the vector being orthogonalized.
+   * \param[in] w - the vectors.
+   * \param[out] dots - i+2 dot products, the last one is the squared norm of w[i+1].
+   */
+  void MultiDot(int i, const vector<VectorType> & w, ScalarType* dots) const;
+
   /*!
    * \brief writes header information for a CSysSolve residual history
    * \param[in] solver - string describing the solver
@@ -248,8 +291,49 @@ public:
    * \param[out] residual - final normalized residual
    * \param[in] monitoring - turn on priting residuals from solver to screen.
    * \param[in] config - Definition of the particular problem.
+   * \param[in] classicalGS - Use classical Gram-Schmidt (fewer global reductions) instead of modified.
    */
   unsigned long FGMRES_LinSolver(const VectorType & b, VectorType & x, const ProductType & mat_vec,
+                                 const PrecondType & precond, ScalarType tol, unsigned long m,
+                                 ScalarType & residual, bool monitoring, CConfig *config,
+                                 bool classicalGS = false) const;
+
+  /*!
+   * \brief Flexible Generalized Minimal Residual method, with block Jacobi preconditioning, on the offload device.
+   * \note The Krylov vectors stay on the device, the host only keeps the Hessenberg matrix, the halos of the
+   *       preconditioned vectors are exchanged through the host buffer before each product, and the
+   *       orthogonalization is classical Gram-Schmidt with two passes (one reduction per pass).
+   * \param[in] b - the right hand size vector
+   * \param[in,out] x - on entry the intial guess, on exit the solution
+   * \param[in] Jacobian - the matrix, with its Jacobi preconditioner built on the host
+   * \param[in] newPrecond - the preconditioner was rebuilt and needs to be uploaded
+   * \param[in] tol - tolerance with which to solve the system
+   * \param[in] m - maximum size of the search subspace
+   * \param[out] residual - final normalized residual
+   * \param[in] monitoring - turn on priting residuals from solver to screen.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  unsigned long FGMRES_Device_LinSolver(const VectorType & b, VectorType & x, const MatrixType & Jacobian,
+                                        bool newPrecond, ScalarType tol, unsigned long m, ScalarType & residual,
+                                        bool monitoring, CGeometry *geometry, CConfig *config) const;
+
+  /*!
+   * \brief Flexible GCRO with deflated restarting (recycling of a subspace across calls).
+   * \note The recycled subspace is formed by the most recent solution corrections (which for
+   *       sequences of similar systems contain the "slow" directions), it is re-projected on
+   *       the current operator at the start of each call (k extra products for a subspace of size k).
+   * \param[in] b - the right hand size vector
+   * \param[in,out] x - on entry the intial guess, on exit the solution
+   * \param[in] mat_vec - object that defines matrix-vector product
+   * \param[in] precond - object that defines preconditioner
+   * \param[in] tol - tolerance with which to solve the system
+   * \param[in] m - maximum size of the search subspace
+   * \param[out] residual - final normalized residual
+   * \param[in] monitoring - turn on priting residuals from solver to screen.
+   * \param[in] config - Definition of the particular problem.
+   */
+  unsigned long GCRODR_LinSolver(const VectorType & b, VectorType & x, const ProductType & mat_vec,
                                  const PrecondType & precond, ScalarType tol, unsigned long m,
                                  ScalarType & residual, bool monitoring, CConfig *config) const;
 
@@ -292,9 +376,11 @@ public:
    * \param[in,out] LinSysSol - Linear system solution
    * \param[in] geometry -  Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
+   * \param[in] product - Optional matrix-vector product (e.g. matrix-free) that replaces the product by the Jacobian,
+   *            which is then only used to define the preconditioner.
    */
   unsigned long Solve(MatrixType & Jacobian, const CSysVector<su2double> & LinSysRes, CSysVector<su2double> & LinSysSol,
-                      CGeometry *geometry, CConfig *config);
+                      CGeometry *geometry, CConfig *config, const ProductType* product = nullptr);
 
   /*!
    * \brief Solve the adjoint linear system using a Krylov subspace method
@@ -313,4 +399,22 @@ public:
    */
   inline ScalarType GetResidual(void) const { return Residual; }
 
+  /*!
+   * \brief Get the age of the preconditioner used in the last call to Solve.
+   * \return Number of calls that reused it since it was built (0 if it was built on the last call).
+   */
+  inline unsigned long GetPrecondAge(void) const { return PrecondAge; }
+
+  /*!
+   * \brief Indicate that the matrix of the next call to Solve is the one of the last call (e.g. a frozen
+   *        tangent), the preconditioner is then reused regardless of LINEAR_SOLVER_PREC_REUSE.
+   * \note Only applies to the next call, should be called outside parallel regions or by a single thread.
+   */
+  inline void SetMatrixUnchanged(bool unchanged) { MatrixUnchanged = unchanged; }
+
+  /*!
+   * \brief Get the relative tolerance used in the last call to Solve (see LINEAR_SOLVER_ADAPTIVE_ERROR).
+   */
+  inline ScalarType GetTolerance(void) const { return Tolerance; }
+
 };
@@ -52,7 +52,7 @@ private:
   unsigned long nElm;             /*!< \brief total number of elements (or number elements on this processor) */
   unsigned long nElmDomain;       /*!< \brief total number of elements (or number elements on this processor without Ghost cells) */
   unsigned long nVar;             /*!< \brief number of elements in a block */
-  mutable ScalarType dotRes;      /*!< \brief result of dot product. to perform a reduction with OpenMP the
+  mutable ScalarType dotRes[2];   /*!< \brief result of dot products. to perform a reduction with OpenMP the
                                               variable needs to be declared outside the parallel region */
 
   /*!
@@ -67,6 +67,14 @@ private:
   void Initialize(unsigned long numBlk, unsigned long numBlkDomain, unsigned long numVar,
                   const ScalarType* val, bool valIsArray);
 
+  /*!
+   * \brief Combine the partial sums of the threads and ranks, all threads must call this method.
+   * \note The shared results must have been zeroed before the partial sums were computed.
+   * \param[in,out] sum - Partial sums of the calling thread, on exit the global sums.
+   * \param[in] n - Number of sums (at most 2).
+   */
+  void ReduceDots(ScalarType* sum, unsigned short n) const;
+
 public:
 
   /*!
@@ -210,6 +218,29 @@ public:
    */
   void Equals_AX_Plus_BY(ScalarType a, const CSysVector & x, ScalarType b, const CSysVector & y);
 
+  /*!
+   * \brief adds a scaled CSysVector to calling CSysVector and computes the dot product of the
+   *        result with another vector, in one pass over the data.
+   * \param[in] a - scalar factor for x
+   * \param[in] x - CSysVector that is being scaled
+   * \param[in] u - Another vector, may be the calling object (the result is then the squared norm).
+   * \return dot product of the updated vector and u
+   */
+  ScalarType Plus_AX_Dot(ScalarType a, const CSysVector & x, const CSysVector & u);
+
+  /*!
+   * \brief Plus_AX followed by the dot products of the result with two other vectors,
+   *        in one pass over the data and with a single reduction.
+   * \param[in] a - scalar factor for x
+   * \param[in] x - CSysVector that is being scaled
+   * \param[in] u - First vector, may be the calling object.
+   * \param[in] v - Second vector, may be the calling object.
+   * \param[out] dot_u - Dot product of the updated vector and u.
+   * \param[out] dot_v - Dot product of the updated vector and v.
+   */
+  void Plus_AX_Dot2(ScalarType a, const CSysVector & x, const CSysVector & u, const CSysVector & v,
+                    ScalarType & dot_u, ScalarType & dot_v);
+
   /*!
    * \brief assignment operator with deep copy
    * \param[in] u - CSysVector whose values are being assigned
@@ -258,6 +289,15 @@ public:
    */
   ScalarType dot(const CSysVector & u) const;
 
+  /*!
+   * \brief Dot products between "this" and two other vectors, in one pass and with a single reduction.
+   * \param[in] u - First vector, may be "this".
+   * \param[in] v - Second vector, may be "this".
+   * \param[out] dot_u - Result of the dot product with u.
+   * \param[out] dot_v - Result of the dot product with v.
+   */
+  void Dot2(const CSysVector & u, const CSysVector & v, ScalarType & dot_u, ScalarType & dot_v) const;
+
   /*!
    * \brief squared L2 norm of the vector (via dot with self)
    * \return squared L2 norm
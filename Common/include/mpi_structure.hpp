@@ -34,6 +34,7 @@
 #endif
 
 #include "./datatype_structure.hpp"
+#include "./toolboxes/CCommProfiler.hpp"
 #include <stdlib.h>
 #ifndef _MSC_VER
 #include <unistd.h>
@@ -78,6 +79,9 @@ template<class T> struct SelectMPIWrapper { typedef SU2_MPI W; };
 #if defined CODI_REVERSE_TYPE
 class CBaseMPIWrapper;
 template<> struct SelectMPIWrapper<passivedouble> { typedef CBaseMPIWrapper W; };
+#ifdef USE_MIXED_PRECISION
+template<> struct SelectMPIWrapper<float> { typedef CBaseMPIWrapper W; };
+#endif
 #endif
 
 /*!
@@ -200,10 +204,49 @@ public:
 
   static void Reduce_scatter(void *sendbuf, void *recvbuf, int *recvcounts,
                              Datatype datatype, Op op, Comm comm);
+
+  static void Send_init(void *buf, int count, Datatype datatype, int dest,
+                        int tag, Comm comm, Request* request);
+
+  static void Recv_init(void *buf, int count, Datatype datatype, int source,
+                        int tag, Comm comm, Request* request);
+
+  static void Start(Request *request);
+
+  static void Startall(int nrequests, Request *request);
+
+  static void Request_free(Request *request);
+
+  static void Comm_free(Comm *comm);
+
+#if MPI_VERSION >= 3
+  static void Dist_graph_create_adjacent(Comm comm, int indegree, const int *sources,
+                                         int outdegree, const int *destinations,
+                                         Comm *graph_comm);
+
+  static void Ineighbor_alltoallv(void *sendbuf, int *sendcounts, int *sdispls, Datatype sendtype,
+                                  void *recvbuf, int *recvcounts, int *recvdispls, Datatype recvtype,
+                                  Comm comm, Request* request);
+#endif
 };
 
 typedef MPI_Comm SU2_Comm;
 
+/*--- Persistent requests and neighborhood collectives are only used with the
+ * passive (base) wrapper, the AD wrappers do not support them. ---*/
+#if !defined CODI_REVERSE_TYPE && !defined CODI_FORWARD_TYPE
+#define HAVE_MPI_PERSISTENT
+#if MPI_VERSION >= 3
+#define HAVE_MPI_NEIGHBOR
+#endif
+#endif
+
+/*--- In reverse AD the su2double point-to-point comms can instead send passive values with the
+ * base wrapper, each exchange is then taped as one external function (rather than per message). ---*/
+#if defined CODI_REVERSE_TYPE
+#define HAVE_MPI_P2P_EXTFUNC
+#endif
+
 #if defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE
 
 /*!
@@ -466,3 +509,11 @@ extern CBaseMPIWrapper::Status* MPI_STATUS_IGNORE;
 #endif
 
 #include "mpi_structure.inl"
+
+#if defined HAVE_MPI && !defined SU2_KEEP_MPI_COMM_WORLD
+/*--- The communications of SU2 use the communicator given to the driver (see SU2_MPI::SetComm), which
+ * is the world communicator by default. This allows several drivers to run concurrently on disjoint
+ * groups of processes of one allocation (see SU2_PY/SU2/run/scheduler.py). ---*/
+#undef MPI_COMM_WORLD
+#define MPI_COMM_WORLD SU2_MPI::GetComm()
+#endif
@@ -228,6 +228,12 @@ inline void CBaseMPIWrapper::Reduce(void *sendbuf, void *recvbuf, int count,
 
 inline void CBaseMPIWrapper::Allreduce(void *sendbuf, void *recvbuf, int count,
                                    Datatype datatype, Op op, Comm comm) {
+  if (CCommProfiler::IsActive()) {
+    int typeSize = 0;
+    MPI_Type_size(datatype, &typeSize);
+    CCommProfiler::AddExchange(CCommProfiler::COLLECTIVE_COMMS, 1, passivedouble(count)*typeSize);
+  }
+  CCommWaitScope wait(CCommProfiler::COLLECTIVE_COMMS);
   MPI_Allreduce(sendbuf,recvbuf,count,datatype,op,comm);
 }
 
@@ -278,6 +284,48 @@ inline void CBaseMPIWrapper::Waitany(int nrequests, Request *request,
   MPI_Waitany(nrequests, request, index, status);
 }
 
+inline void CBaseMPIWrapper::Send_init(void *buf, int count, Datatype datatype,
+                                        int dest, int tag, Comm comm, Request *request) {
+  MPI_Send_init(buf,count,datatype,dest,tag,comm,request);
+}
+
+inline void CBaseMPIWrapper::Recv_init(void *buf, int count, Datatype datatype,
+                                        int source, int tag, Comm comm, Request *request) {
+  MPI_Recv_init(buf,count,datatype,source,tag,comm,request);
+}
+
+inline void CBaseMPIWrapper::Start(Request *request) {
+  MPI_Start(request);
+}
+
+inline void CBaseMPIWrapper::Startall(int nrequests, Request *request) {
+  MPI_Startall(nrequests, request);
+}
+
+inline void CBaseMPIWrapper::Request_free(Request *request) {
+  MPI_Request_free(request);
+}
+
+inline void CBaseMPIWrapper::Comm_free(Comm *comm) {
+  MPI_Comm_free(comm);
+}
+
+#if MPI_VERSION >= 3
+inline void CBaseMPIWrapper::Dist_graph_create_adjacent(Comm comm, int indegree, const int *sources,
+                                                         int outdegree, const int *destinations,
+                                                         Comm *graph_comm) {
+  MPI_Dist_graph_create_adjacent(comm, indegree, sources, MPI_UNWEIGHTED, outdegree, destinations,
+                                 MPI_UNWEIGHTED, MPI_INFO_NULL, 0, graph_comm);
+}
+
+inline void CBaseMPIWrapper::Ineighbor_alltoallv(void *sendbuf, int *sendcounts, int *sdispls, Datatype sendtype,
+                                                  void *recvbuf, int *recvcounts, int *recvdispls, Datatype recvtype,
+                                                  Comm comm, Request *request) {
+  MPI_Ineighbor_alltoallv(sendbuf, sendcounts, sdispls, sendtype, recvbuf, recvcounts, recvdispls, recvtype,
+                          comm, request);
+}
+#endif
+
 
 #if defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE
 
@@ -456,6 +504,12 @@ inline void CMediMPIWrapper::Reduce(void *sendbuf, void *recvbuf, int count,
 
 inline void CMediMPIWrapper::Allreduce(void *sendbuf, void *recvbuf, int count,
                                    Datatype datatype, Op op, Comm comm) {
+  if (CCommProfiler::IsActive()) {
+    int typeSize = 0;
+    MPI_Type_size(datatype, &typeSize);
+    CCommProfiler::AddExchange(CCommProfiler::COLLECTIVE_COMMS, 1, passivedouble(count)*typeSize);
+  }
+  CCommWaitScope wait(CCommProfiler::COLLECTIVE_COMMS);
   AMPI_Allreduce(sendbuf,recvbuf,count,convertDatatype(datatype),convertOp(op),convertComm(comm));
 }
 
@@ -47,7 +47,11 @@
 #endif
 
 /*--- Detect compilation with OpenMP support, protect agaisnt
- *    using OpenMP with Reverse AD (not supported yet). ---*/
+ *    using OpenMP with Reverse AD (not supported yet). The tape of the CoDiPack
+ *    version used (and the preaccumulation state in ad_structure) is global, its
+ *    recording and evaluation are not thread-safe. Moreover, in the reverse sweep
+ *    shared reads become concurrent adjoint updates, which the edge coloring does
+ *    not prevent for the non-point data (e.g. free-stream values). ---*/
 #if defined(_OPENMP) && !defined(CODI_REVERSE_TYPE)
 #define HAVE_OMP
 #include <omp.h>
@@ -80,6 +84,11 @@ inline void omp_set_num_threads(int) { }
  */
 inline constexpr int omp_get_thread_num(void) {return 0;}
 
+/*!
+ * \brief Number of (offload) devices available.
+ */
+inline constexpr int omp_get_num_devices(void) {return 0;}
+
 /*!
  * \brief Dummy lock type and associated functions.
  */
@@ -110,6 +119,23 @@ inline void omp_destroy_lock(omp_lock_t*){}
 #define SU2_OMP_FOR_DYN(CHUNK) SU2_OMP(for schedule(dynamic,CHUNK))
 #define SU2_OMP_FOR_STAT(CHUNK) SU2_OMP(for schedule(static,CHUNK))
 
+/*--- Device (e.g. GPU) offload constructs, they are only enabled when compiling with the
+ *    offload arguments of the compiler (omp-offload-args in meson) and without AD types,
+ *    otherwise the code runs on the host (check HAVE_OMP_OFFLOAD after including this file).
+ *    The target regions must only access contiguous data (C2DContainer based arrays,
+ *    su2vector) mapped explicitly, no virtual calls or AD types are allowed. ---*/
+#if defined(HAVE_OMP_OFFLOAD) && (!defined(HAVE_OMP) || defined(CODI_FORWARD_TYPE))
+#undef HAVE_OMP_OFFLOAD
+#endif
+
+#ifdef HAVE_OMP_OFFLOAD
+#define SU2_OMP_TARGET(ARGS) SU2_OMP(target ARGS)
+#define SU2_OMP_TARGET_LOOP(ARGS) SU2_OMP(target teams distribute parallel for ARGS)
+#else
+#define SU2_OMP_TARGET(ARGS)
+#define SU2_OMP_TARGET_LOOP(ARGS)
+#endif
+
 
 /*--- Convenience functions (e.g. to compute chunk sizes). ---*/
 
@@ -173,6 +199,33 @@ void parallelSet(size_t size, T val, U* dst)
   for(size_t i=0; i<size; ++i) dst[i] = val;
 }
 
+/*!
+ * \brief Initialize an array (e.g. just allocated) in parallel when called outside of parallel regions,
+ *        with the static schedule of the loops that later work on it, such that each page of memory is
+ *        first touched, and therefore placed on the NUMA node, by the thread that uses it.
+ * \note Small arrays, non arithmetic (AD) types, and calls from parallel regions are set serially.
+ * \param[in] size - Number of elements.
+ * \param[in] val - Value to set.
+ * \param[in] dst - Destination array.
+ * \param[in] maxChunkSize - Upper bound for the chunk size of the static schedule (in rows, see computeStaticChunkSize).
+ * \param[in] rowSize - Number of elements of each row (e.g. variables per point).
+ */
+template<class T, class U>
+void parallelFirstTouch(size_t size, T val, U* dst, size_t maxChunkSize, size_t rowSize = 1)
+{
+#ifdef HAVE_OMP
+  constexpr size_t minSize = 1<<14;
+  if(std::is_arithmetic<U>::value && (size >= minSize) && !omp_in_parallel() && (omp_get_max_threads() > 1))
+  {
+    const size_t chunkSize = computeStaticChunkSize(size/rowSize, omp_get_max_threads(), maxChunkSize)*rowSize;
+    SU2_OMP_PARALLEL_(for schedule(static,chunkSize))
+    for(size_t i=0; i<size; ++i) dst[i] = val;
+    return;
+  }
+#endif
+  for(size_t i=0; i<size; ++i) dst[i] = val;
+}
+
 /*!
  * \brief Atomically update a (shared) lhs value with a (local) rhs value.
  * \note For types without atomic support (non-arithmetic) this is done via critical.
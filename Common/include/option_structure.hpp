@@ -133,6 +133,15 @@ const int SU2_CONN_SIZE   = 10;  /*!< \brief Size of the connectivity array that
                                              that we read from a mesh file in the format [[globalID vtkType n0 n1 n2 n3 n4 n5 n6 n7 n8]. */
 const int SU2_CONN_SKIP   = 2;   /*!< \brief Offset to skip the globalID and VTK type at the start of the element connectivity list for each CGNS element. */
 
+const int SU2_BINARY_MESH_ID     = 535533; /*!< \brief First value of binary SU2 mesh files (binary restart files start with 535532). */
+const int SU2_COMPRESSED_RESTART_ID = 535534; /*!< \brief First value of compressed SU2 binary restart files. */
+const int SU2_BINARY_HISTORY_ID = 535535; /*!< \brief First value of binary SU2 history files. */
+const int SU2_SURFACE_SAMPLING_ID = 535536; /*!< \brief First value of SU2 surface sampling (time series) files. */
+const int SU2_BINARY_MESH_HEADER = 8;      /*!< \brief Size of the header of binary SU2 mesh files, in 64 bit integers
+                                                       [id nDim nPoint nElem nMarker pointOffset elemOffset markerOffset] (offsets in bytes). */
+const int SU2_BINARY_MESH_ELEM   = 9;      /*!< \brief Size of each volume element record of binary SU2 mesh files [vtkType n0 n1 n2 n3 n4 n5 n6 n7]. */
+const int SU2_BINARY_MESH_BOUND  = 5;      /*!< \brief Size of each surface element record of binary SU2 mesh files [vtkType n0 n1 n2 n3]. */
+
 const su2double COLORING_EFF_THRESH = 0.875;  /*!< \brief Below this value fallback strategies are used instead. */
 
 /*!
@@ -530,7 +539,8 @@ enum ENUM_FLUIDMODEL {
   PR_GAS = 3,             /*!< \brief Perfect Real gas model. */
   CONSTANT_DENSITY = 4,   /*!< \brief Constant density gas model. */
   INC_IDEAL_GAS = 5,      /*!< \brief Incompressible ideal gas model. */
-  INC_IDEAL_GAS_POLY = 6  /*!< \brief Inc. ideal gas, polynomial gas model. */
+  INC_IDEAL_GAS_POLY = 6, /*!< \brief Inc. ideal gas, polynomial gas model. */
+  TABULATED_GAS = 7       /*!< \brief Look-up table of a compressible fluid model. */
 };
 static const MapType<string, ENUM_FLUIDMODEL> FluidModel_Map = {
   MakePair("STANDARD_AIR", STANDARD_AIR)
@@ -540,6 +550,7 @@ static const MapType<string, ENUM_FLUIDMODEL> FluidModel_Map = {
   MakePair("CONSTANT_DENSITY", CONSTANT_DENSITY)
   MakePair("INC_IDEAL_GAS", INC_IDEAL_GAS)
   MakePair("INC_IDEAL_GAS_POLY", INC_IDEAL_GAS_POLY)
+  MakePair("TABULATED_GAS", TABULATED_GAS)
 };
 
 /*!
@@ -1012,11 +1023,13 @@ static const MapType<string, ENUM_TIME_INT_FEA> Time_Int_Map_FEA = {
  */
 enum ENUM_SPACE_ITE_FEA {
   NEWTON_RAPHSON = 1,           /*!< \brief Full Newton-Rapshon method. */
-  MODIFIED_NEWTON_RAPHSON = 2   /*!< \brief Modified Newton-Raphson method. */
+  MODIFIED_NEWTON_RAPHSON = 2,  /*!< \brief Modified Newton-Raphson method. */
+  QUASI_NEWTON_BFGS = 3         /*!< \brief BFGS updates of the frozen tangent of modified Newton-Raphson. */
 };
 static const MapType<string, ENUM_SPACE_ITE_FEA> Space_Ite_Map_FEA = {
   MakePair("NEWTON_RAPHSON", NEWTON_RAPHSON)
   MakePair("MODIFIED_NEWTON_RAPHSON", MODIFIED_NEWTON_RAPHSON)
+  MakePair("QUASI_NEWTON", QUASI_NEWTON_BFGS)
 };
 
 /*!
@@ -1114,12 +1127,14 @@ static const MapType<string, ENUM_2DFORM> ElasForm_2D = {
 enum ENUM_AITKEN {
   NO_RELAXATION = 0,        /*!< \brief No relaxation in the strongly coupled approach. */
   FIXED_PARAMETER = 1,      /*!< \brief Relaxation with a fixed parameter. */
-  AITKEN_DYNAMIC = 2        /*!< \brief Relaxation using Aitken's dynamic parameter. */
+  AITKEN_DYNAMIC = 2,       /*!< \brief Relaxation using Aitken's dynamic parameter. */
+  IQN_ILS = 3               /*!< \brief Interface quasi-Newton with an inverse Jacobian from a least-squares model. */
 };
 static const MapType<string, ENUM_AITKEN> AitkenForm_Map = {
   MakePair("NONE", NO_RELAXATION)
   MakePair("FIXED_PARAMETER", FIXED_PARAMETER)
   MakePair("AITKEN_DYNAMIC", AITKEN_DYNAMIC)
+  MakePair("IQN_ILS", IQN_ILS)
 };
 
 /*!
@@ -1588,15 +1603,71 @@ enum ENUM_INPUT {
   SU2       = 1,  /*!< \brief SU2 input format. */
   CGNS_GRID = 2,  /*!< \brief CGNS input format for the computational grid. */
   RECTANGLE = 3,  /*!< \brief 2D rectangular mesh with N x M points of size Lx x Ly. */
-  BOX       = 4   /*!< \brief 3D box mesh with N x M x L points of size Lx x Ly x Lz. */
+  BOX       = 4,  /*!< \brief 3D box mesh with N x M x L points of size Lx x Ly x Lz. */
+  SU2_BINARY = 5  /*!< \brief Binary SU2 input format (read in parallel). */
 };
 static const MapType<string, ENUM_INPUT> Input_Map = {
   MakePair("SU2", SU2)
+  MakePair("SU2_BINARY", SU2_BINARY)
   MakePair("CGNS", CGNS_GRID)
   MakePair("RECTANGLE", RECTANGLE)
   MakePair("BOX", BOX)
 };
 
+/*!
+ * \brief Types of elements of the analytic RECTANGLE and BOX grids.
+ */
+enum ENUM_BOX_ELEMENTS {
+  BOX_HEXAHEDRA = 0,   /*!< \brief Hexahedra (quadrilaterals in 2D). */
+  BOX_PRISMS = 1,      /*!< \brief Each hexahedron split into 2 prisms (triangles in 2D). */
+  BOX_TETRAHEDRA = 2   /*!< \brief Each hexahedron split into 6 tetrahedra (triangles in 2D). */
+};
+static const MapType<string, ENUM_BOX_ELEMENTS> Box_Elements_Map = {
+  MakePair("HEXAHEDRA", BOX_HEXAHEDRA)
+  MakePair("PRISMS", BOX_PRISMS)
+  MakePair("TETRAHEDRA", BOX_TETRAHEDRA)
+};
+
+/*!
+ * \brief Types of renumbering of the grid points (for data locality).
+ */
+enum ENUM_POINT_ORDERING {
+  RCM_ORDERING     = 0,  /*!< \brief Reverse Cuthill-McKee ordering (bandwidth reduction). */
+  HILBERT_ORDERING = 1,  /*!< \brief Ordering along the Hilbert space-filling curve. */
+  MORTON_ORDERING  = 2   /*!< \brief Ordering along the Morton (Z) space-filling curve. */
+};
+static const MapType<string, ENUM_POINT_ORDERING> Point_Ordering_Map = {
+  MakePair("RCM", RCM_ORDERING)
+  MakePair("HILBERT", HILBERT_ORDERING)
+  MakePair("MORTON", MORTON_ORDERING)
+};
+
+/*!
+ * \brief Types of vertex weights for the graph partitioning (ParMETIS).
+ */
+enum ENUM_PARTITION_WEIGHTS {
+  NO_PARTITION_WEIGHTS      = 0,  /*!< \brief All points have the same weight. */
+  POINT_PARTITION_WEIGHTS   = 1,  /*!< \brief The weight of a point is the sum of its volume and boundary work. */
+  MULTI_CONSTRAINT_WEIGHTS  = 2   /*!< \brief The volume and boundary work are balanced separately (two constraints). */
+};
+static const MapType<string, ENUM_PARTITION_WEIGHTS> Partition_Weights_Map = {
+  MakePair("NONE", NO_PARTITION_WEIGHTS)
+  MakePair("POINT", POINT_PARTITION_WEIGHTS)
+  MakePair("MULTI_CONSTRAINT", MULTI_CONSTRAINT_WEIGHTS)
+};
+
+/*!
+ * \brief Types of search trees (ADT) for the wall distance computation.
+ */
+enum ENUM_WALL_DISTANCE_ADT {
+  GLOBAL_WALL_ADT      = 0,  /*!< \brief Every rank builds the tree of all wall elements. */
+  DISTRIBUTED_WALL_ADT = 1   /*!< \brief Every rank builds the tree of its wall elements, points are sent to the ranks whose walls may be closer. */
+};
+static const MapType<string, ENUM_WALL_DISTANCE_ADT> Wall_Distance_ADT_Map = {
+  MakePair("GLOBAL", GLOBAL_WALL_ADT)
+  MakePair("DISTRIBUTED", DISTRIBUTED_WALL_ADT)
+};
+
 /*!
  * \brief Type of solution output file formats
  */
@@ -1619,7 +1690,11 @@ enum ENUM_OUTPUT {
   STL_BINARY              = 16, /*!< \brief STL binary format for surface solution output. Not implemented yet. */
   PARAVIEW_XML            = 17, /*!< \brief Paraview XML with binary data format */
   SURFACE_PARAVIEW_XML    = 18, /*!< \brief Surface Paraview XML with binary data format */
-  PARAVIEW_MULTIBLOCK     = 19  /*!< \brief Paraview XML Multiblock */
+  PARAVIEW_MULTIBLOCK     = 19, /*!< \brief Paraview XML Multiblock */
+  HDF5                    = 20, /*!< \brief Parallel HDF5 time series with an XDMF descriptor. */
+  SURFACE_HDF5            = 21, /*!< \brief Surface parallel HDF5 time series with an XDMF descriptor. */
+  ADIOS2                  = 22, /*!< \brief ADIOS2 stream of the volume data for in-situ processing (or staging). */
+  SURFACE_ADIOS2          = 23  /*!< \brief ADIOS2 stream of the surface data for in-situ processing (or staging). */
 };
 static const MapType<string, ENUM_OUTPUT> Output_Map = {
   MakePair("TECPLOT_ASCII", TECPLOT)
@@ -1640,6 +1715,24 @@ static const MapType<string, ENUM_OUTPUT> Output_Map = {
   MakePair("CGNS", CGNS)
   MakePair("STL", STL)
   MakePair("STL_BINARY", STL_BINARY)
+  MakePair("HDF5", HDF5)
+  MakePair("SURFACE_HDF5", SURFACE_HDF5)
+  MakePair("ADIOS2", ADIOS2)
+  MakePair("SURFACE_ADIOS2", SURFACE_ADIOS2)
+};
+
+/*!
+ * \brief Compression of the binary restart files.
+ */
+enum ENUM_RESTART_COMPRESSION {
+  NO_COMPRESSION = 0,       /*!< \brief Raw doubles. */
+  LOSSLESS_COMPRESSION = 1, /*!< \brief Byte shuffle and deflate of all the fields. */
+  LOSSY_COMPRESSION = 2     /*!< \brief As lossless, but some fields are first quantized with an absolute error bound. */
+};
+static const MapType<string, ENUM_RESTART_COMPRESSION> Restart_Compression_Map = {
+  MakePair("NONE", NO_COMPRESSION)
+  MakePair("LOSSLESS", LOSSLESS_COMPRESSION)
+  MakePair("LOSSY", LOSSY_COMPRESSION)
 };
 
 /*!
@@ -1684,12 +1777,26 @@ static const MapType<string, JUMP_DEFINITION> Jump_Map = {
 enum MG_CYCLE {
   V_CYCLE = 0,        /*!< \brief V cycle. */
   W_CYCLE = 1,        /*!< \brief W cycle. */
-  FULLMG_CYCLE = 2    /*!< \brief FullMG cycle. */
+  FULLMG_CYCLE = 2,   /*!< \brief FullMG cycle. */
+  F_CYCLE = 3         /*!< \brief F cycle (an F cycle followed by a V cycle on each coarse level). */
 };
 static const MapType<string, MG_CYCLE> MG_Cycle_Map = {
   MakePair("V_CYCLE", V_CYCLE)
   MakePair("W_CYCLE", W_CYCLE)
   MakePair("FULLMG_CYCLE", FULLMG_CYCLE)
+  MakePair("F_CYCLE", F_CYCLE)
+};
+
+/*!
+ * \brief Type of agglomeration of the multigrid levels
+ */
+enum ENUM_MG_AGGLOMERATION {
+  SEQUENTIAL_AGGLOMERATION = 0,  /*!< \brief Queue-driven agglomeration, one seed at a time. */
+  COLORED_AGGLOMERATION = 1      /*!< \brief Thread-parallel greedy agglomeration of colored groups of seeds. */
+};
+static const MapType<string, ENUM_MG_AGGLOMERATION> MG_Agglomeration_Map = {
+  MakePair("SEQUENTIAL", SEQUENTIAL_AGGLOMERATION)
+  MakePair("COLORED", COLORED_AGGLOMERATION)
 };
 
 /*!
@@ -1820,6 +1927,8 @@ enum ENUM_LINEAR_SOLVER {
   SMOOTHER = 8,             /*!< \brief Iterative smoother. */
   PASTIX_LDLT = 9,          /*!< \brief PaStiX LDLT (complete) factorization. */
   PASTIX_LU = 10,           /*!< \brief PaStiX LU (complete) factorization. */
+  FGMRES_CGS = 11,          /*!< \brief FGMRES with classical Gram-Schmidt orthogonalization (fused reductions). */
+  GCRO_DR = 12,             /*!< \brief Flexible GCRO with a subspace recycled across linear solves. */
 };
 static const MapType<string, ENUM_LINEAR_SOLVER> Linear_Solver_Map = {
   MakePair("STEEPEST_DESCENT", STEEPEST_DESCENT)
@@ -1830,6 +1939,8 @@ static const MapType<string, ENUM_LINEAR_SOLVER> Linear_Solver_Map = {
   MakePair("FGMRES", FGMRES)
   MakePair("RESTARTED_FGMRES", RESTARTED_FGMRES)
   MakePair("SMOOTHER", SMOOTHER)
+  MakePair("FGMRES_CGS", FGMRES_CGS)
+  MakePair("GCRO_DR", GCRO_DR)
   MakePair("PASTIX_LDLT", PASTIX_LDLT)
   MakePair("PASTIX_LU", PASTIX_LU)
 };
@@ -1891,6 +2002,10 @@ enum ENUM_LINEAR_SOLVER_PREC {
   PASTIX_ILU= 5,     /*!< \brief PaStiX ILU(k) preconditioner. */
   PASTIX_LU_P= 6,    /*!< \brief PaStiX LU as preconditioner. */
   PASTIX_LDLT_P= 7,  /*!< \brief PaStiX LDLT as preconditioner. */
+  AMG = 8,           /*!< \brief Smoothed aggregation algebraic multigrid preconditioner. */
+  NEUMANN_PREC = 9,  /*!< \brief Truncated Neumann series of the block Jacobi preconditioned matrix. */
+  CHEBYSHEV = 10,    /*!< \brief Chebyshev polynomial of the block Jacobi preconditioned matrix. */
+  SPAI = 11,         /*!< \brief Block sparse approximate inverse on the pattern of the matrix. */
 };
 static const MapType<string, ENUM_LINEAR_SOLVER_PREC> Linear_Solver_Prec_Map = {
   MakePair("JACOBI", JACOBI)
@@ -1900,6 +2015,10 @@ static const MapType<string, ENUM_LINEAR_SOLVER_PREC> Linear_Solver_Prec_Map = {
   MakePair("PASTIX_ILU", PASTIX_ILU)
   MakePair("PASTIX_LU", PASTIX_LU_P)
   MakePair("PASTIX_LDLT", PASTIX_LDLT_P)
+  MakePair("AMG", AMG)
+  MakePair("NEUMANN", NEUMANN_PREC)
+  MakePair("CHEBYSHEV", CHEBYSHEV)
+  MakePair("SPAI", SPAI)
 };
 
 /*!
@@ -1982,6 +2101,18 @@ static const MapType<string, ENUM_DEFORM_STIFFNESS> Deform_Stiffness_Map = {
   MakePair("WALL_DISTANCE", SOLID_WALL_DISTANCE)
 };
 
+/*!
+ * \brief Types of volume deformation methods
+ */
+enum ENUM_DEFORM_METHOD {
+  ELASTICITY_DEFORMATION = 0,  /*!< \brief Linear elasticity analogy, solved with the FEA stiffness matrix. */
+  RBF_DEFORMATION = 1          /*!< \brief Interpolation of the boundary displacements with radial basis functions. */
+};
+static const MapType<string, ENUM_DEFORM_METHOD> Deform_Method_Map = {
+  MakePair("ELASTICITY", ELASTICITY_DEFORMATION)
+  MakePair("RBF", RBF_DEFORMATION)
+};
+
 /*!
  * \brief The direct differentation variables.
  */
@@ -2116,7 +2247,8 @@ enum MPI_QUANTITIES {
   SOLUTION_FEA_OLD     = 26,  /*!< \brief FEA solution old communication. */
   MESH_DISPLACEMENTS   = 27,  /*!< \brief Mesh displacements at the interface. */
   SOLUTION_TIME_N      = 28,  /*!< \brief Solution at time n. */
-  SOLUTION_TIME_N1     = 29   /*!< \brief Solution at time n-1. */
+  SOLUTION_TIME_N1     = 29,  /*!< \brief Solution at time n-1. */
+  PRIMITIVE_GRAD_LIMITER = 30 /*!< \brief Primitive gradient and limiter communication (one message). */
 };
 
 /*!
@@ -2133,6 +2265,20 @@ static const MapType<string, COMM_LEVEL> Comm_Map = {
   MakePair("FULL",    COMM_FULL)
 };
 
+/*!
+ * \brief Implementation of the point-to-point (halo) MPI communications.
+ */
+enum ENUM_P2P_COMMS {
+  ISEND_IRECV_COMMS = 0,  /*!< \brief New non-blocking sends and recvs for every exchange. */
+  PERSISTENT_COMMS  = 1,  /*!< \brief Persistent requests created once and restarted for every exchange. */
+  NEIGHBOR_COMMS    = 2   /*!< \brief Neighborhood collective (MPI_Ineighbor_alltoallv) over a graph communicator. */
+};
+static const MapType<string, ENUM_P2P_COMMS> P2P_Comms_Map = {
+  MakePair("ISEND_IRECV",         ISEND_IRECV_COMMS)
+  MakePair("PERSISTENT",          PERSISTENT_COMMS)
+  MakePair("NEIGHBOR_COLLECTIVE", NEIGHBOR_COMMS)
+};
+
 /*
  * \brief Types of filter kernels, initially intended for structural topology optimization applications
  */
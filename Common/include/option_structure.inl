@@ -521,6 +521,48 @@ public:
   }
 };
 
+class COptionULongList : public COptionBase {
+  unsigned long * & field; // Reference to the fieldname
+  string name; // identifier for the option
+  unsigned short & size;
+
+public:
+  COptionULongList(string option_field_name, unsigned short & list_size, unsigned long * & option_field) : field(option_field), size(list_size) {
+    this->name = option_field_name;
+  }
+
+  ~COptionULongList() {};
+  string SetValue(vector<string> option_value) {
+    COptionBase::SetValue(option_value);
+    // The size is the length of option_value
+    unsigned short option_size = option_value.size();
+    if (option_size == 1 && option_value[0].compare("NONE") == 0) {
+      // No options
+      this->size = 0;
+      return "";
+    }
+    this->size = option_size;
+
+    // Parse all of the options
+    unsigned long * vals = new unsigned long[option_size];
+    for (unsigned long i  = 0; i < option_size; i++) {
+      istringstream is(option_value[i]);
+      unsigned long val;
+      if (!(is >> val)) {
+        delete [] vals;
+        return badValue(option_value, "unsigned long", this->name);
+      }
+      vals[i] = val;
+    }
+    this->field = vals;
+    return "";
+  }
+
+  void SetDefault() {
+    this->size = 0; // There is no default value for list
+  }
+};
+
 class COptionStringList : public COptionBase {
   string * & field; // Reference to the feildname
   string name; // identifier for the option
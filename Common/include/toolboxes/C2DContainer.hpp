@@ -29,6 +29,7 @@
 
 #include "allocation_toolbox.hpp"
 #include "../datatype_structure.hpp"
+#include "../omp_structure.hpp"
 
 #include <utility>
 #include <type_traits>
@@ -113,7 +114,7 @@ public:
                                                                         \
   AccessorImpl& operator= (AccessorImpl&& other) noexcept               \
   {                                                                     \
-    if(m_data!=nullptr) free(m_data);                                   \
+    if(m_data!=nullptr) MemoryAllocation::aligned_free(m_data);         \
     MOVE; m_data=other.m_data; other.m_data=nullptr;                    \
     return *this;                                                       \
   }                                                                     \
@@ -403,7 +404,7 @@ private:
     {
       if(rows==this->rows() && cols==this->cols())
         return reqSize;
-      free(m_data);
+      MemoryAllocation::aligned_free(m_data);
     }
 
     /*--- request actual allocation to base class as it needs specialization ---*/
@@ -480,10 +481,13 @@ public:
 
   /*!
    * \brief Set value of all entries to "value".
+   * \note Large containers are set in parallel (see parallelFirstTouch) with the rows distributed as in
+   *       the point loops of the solvers (chunks of at most 512 rows), e.g. the variables of CVariable.
    */
   void setConstant(const Scalar_t& value) noexcept
   {
-    for(size_t i=0; i<size(); ++i) m_data[i] = value;
+    const size_t rowSize = (Store == StorageType::RowMajor)? this->cols() : 1;
+    parallelFirstTouch(size(), value, m_data, 512, rowSize);
   }
 };
 
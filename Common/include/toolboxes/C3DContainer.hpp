@@ -0,0 +1,126 @@
+/*!
+ * \file C3DContainer.hpp
+ * \brief Storage of a vector of small matrices (e.g. the gradients of the points) with a selectable layout.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "C2DContainer.hpp"
+
+/*!
+ * \enum StorageType3D
+ * \brief Supported ways to flatten the matrix (j,k) of each outer index i into an array.
+ * For gradients (point, variable, dimension), "LastContiguous" stores the dimensions of each variable
+ * contiguously (point x var x dim), "MiddleContiguous" the variables of each dimension (point x dim x var).
+ */
+enum class StorageType3D {LastContiguous=0, MiddleContiguous=1};
+
+/*!
+ * \class C3DContainer
+ * \brief Vector (outer index i) of dynamically sized matrices (indices j and k), always accessed as (i,j,k)
+ *        regardless of the layout, such that the algorithms do not depend on it.
+ * \note The matrices of consecutive outer indices are padded to a multiple of PadSize entries, with the
+ *       alignment of the storage (64 bytes) the start of each matrix is then aligned to PadSize entries.
+ *       The padding is set to the initial value but otherwise never touched.
+ * \tparam Index_t - The data type (built-in) for indices.
+ * \tparam Scalar_t - The data type of the entries.
+ * \tparam Store - How the matrix of each outer index is flattened.
+ * \tparam PadSize - Multiple of entries of the stride between outer indices.
+ */
+template<typename Index_t, class Scalar_t, StorageType3D Store = StorageType3D::LastContiguous, size_t PadSize = 1>
+class C3DContainer {
+  static_assert(PadSize > 0, "The padding must be at least 1.");
+
+public:
+  using Index = Index_t;
+  using Scalar = Scalar_t;
+  static constexpr StorageType3D Storage = Store;
+
+protected:
+  C2DContainer<Index_t, Scalar_t, StorageType::ColumnMajor, 64, DynamicSize, 1> m_data;
+  Index_t m_length = 0;  /*!< \brief Number of outer indices. */
+  Index_t m_rows = 0;    /*!< \brief Size of the middle index (j). */
+  Index_t m_cols = 0;    /*!< \brief Size of the last index (k). */
+  Index_t m_stride = 0;  /*!< \brief Padded size of the matrix of each outer index. */
+
+  /*!
+   * \brief Position of an entry in the storage.
+   */
+  inline Index_t offset(Index_t i, Index_t j, Index_t k) const noexcept {
+    return i*m_stride + ((Store == StorageType3D::LastContiguous)? j*m_cols + k : k*m_rows + j);
+  }
+
+public:
+  /*!
+   * \brief Allocate the container and set all its entries (padding included) to a value.
+   * \param[in] length - Number of outer indices (e.g. points).
+   * \param[in] rows - Size of the middle index (e.g. variables).
+   * \param[in] cols - Size of the last index (e.g. dimensions).
+   * \param[in] value - Initial value.
+   */
+  void resize(Index_t length, Index_t rows, Index_t cols, Scalar_t value) {
+    m_length = length;
+    m_rows = rows;
+    m_cols = cols;
+    m_stride = ((rows*cols + PadSize - 1) / PadSize) * PadSize;
+    m_data.resize(length*m_stride) = value;
+  }
+
+  /*!
+   * \brief Sizes of the container.
+   */
+  inline Index_t length() const noexcept { return m_length; }
+  inline Index_t rows() const noexcept { return m_rows; }
+  inline Index_t cols() const noexcept { return m_cols; }
+  inline Index_t stride() const noexcept { return m_stride; }
+
+  /*!
+   * \brief Number of entries of the storage, padding included.
+   */
+  inline size_t size() const noexcept { return m_data.size(); }
+
+  /*!
+   * \brief Access to the storage.
+   */
+  inline Scalar_t* data() noexcept { return m_data.data(); }
+  inline const Scalar_t* data() const noexcept { return m_data.data(); }
+
+  /*!
+   * \brief Access an entry, (point, var, dim) for gradients.
+   */
+  inline Scalar_t& operator() (Index_t i, Index_t j, Index_t k) noexcept { return m_data(offset(i,j,k)); }
+  inline const Scalar_t& operator() (Index_t i, Index_t j, Index_t k) const noexcept { return m_data(offset(i,j,k)); }
+
+  /*!
+   * \brief Pointer to the contiguous entries of the matrix of i, for LastContiguous the k's of row j,
+   *        for MiddleContiguous the j's of column k (the second argument is then k).
+   */
+  inline Scalar_t* innerData(Index_t i, Index_t outer) noexcept {
+    return &m_data(i*m_stride + outer*((Store == StorageType3D::LastContiguous)? m_cols : m_rows));
+  }
+  inline const Scalar_t* innerData(Index_t i, Index_t outer) const noexcept {
+    return &m_data(i*m_stride + outer*((Store == StorageType3D::LastContiguous)? m_cols : m_rows));
+  }
+};
@@ -0,0 +1,116 @@
+/*!
+ * \file CBinomialCheckpoints.hpp
+ * \brief Storage and binomial placement of the checkpoints of a time-marching computation.
+ *        The implementations are in the <i>CBinomialCheckpoints.cpp</i> file.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../mpi_structure.hpp"
+
+#include <vector>
+#include <string>
+
+using namespace std;
+
+/*!
+ * \class CBinomialCheckpoints
+ * \brief Checkpoints of the states of a time-marching computation that is reversed (e.g. by an
+ *        unsteady adjoint), the states in between are recomputed from the latest checkpoint.
+ * \note The states are requested in decreasing order of time step (with small exceptions), the
+ *       checkpoints taken after the requested step are released. While recomputing, the next
+ *       checkpoint is placed as in binomial checkpointing (Griewank and Walther, "Algorithm 799:
+ *       Revolve"), given the number of free checkpoints. The first checkpoints are kept in memory,
+ *       the remaining ones (if any) are written to the disk (one file per rank and checkpoint).
+ * \author SU2 Contributors
+ */
+class CBinomialCheckpoints {
+
+private:
+
+  /*!
+   * \brief One checkpoint, the state is in memory or in a file.
+   */
+  struct CSlot {
+    long step = -1;               /*!< \brief Time step of the stored state, negative if free. */
+    bool onDisk = false;          /*!< \brief Whether the state is stored in a file. */
+    vector<passivedouble> state;  /*!< \brief State stored in memory. */
+  };
+
+  vector<CSlot> slots;  /*!< \brief The checkpoints. */
+  string folder;        /*!< \brief Folder of the checkpoints that are written to the disk. */
+
+  /*!
+   * \brief Name of the file of a checkpoint of this rank.
+   * \param[in] iSlot - Index of the checkpoint.
+   */
+  string FileName(unsigned short iSlot) const;
+
+  /*!
+   * \brief Number of steps that can be reversed with a given number of checkpoints and recomputations.
+   * \param[in] nCheckpoints - Number of checkpoints.
+   * \param[in] nRepeats - Number of times each step is recomputed.
+   */
+  static passivedouble Beta(unsigned long nCheckpoints, unsigned long nRepeats);
+
+public:
+
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] nCheckpoints - Total number of checkpoints.
+   * \param[in] nDisk - Number of those that are written to the disk.
+   * \param[in] diskFolder - Folder of the files.
+   */
+  CBinomialCheckpoints(unsigned short nCheckpoints, unsigned short nDisk, string diskFolder);
+
+  /*!
+   * \brief Destructor of the class, removes the files.
+   */
+  ~CBinomialCheckpoints();
+
+  /*!
+   * \brief Release the checkpoints taken after a step and get the latest state before (or at) it.
+   * \param[in] target - Time step that is requested.
+   * \param[out] state - State of the latest checkpoint, unchanged if there is none.
+   * \return Time step of that checkpoint, negative if there is none (start from the initial state).
+   */
+  long Restore(long target, vector<passivedouble>& state);
+
+  /*!
+   * \brief Step at which the next checkpoint should be taken while recomputing towards a target.
+   * \param[in] current - Time step of the current state.
+   * \param[in] target - Time step that is requested.
+   * \return Time step of the next checkpoint, the target if none should be taken.
+   */
+  long NextCheckpoint(long current, long target) const;
+
+  /*!
+   * \brief Store a state in a free checkpoint (those in memory are used first).
+   * \param[in] step - Time step of the state.
+   * \param[in] state - The state.
+   */
+  void Store(long step, const vector<passivedouble>& state);
+
+};
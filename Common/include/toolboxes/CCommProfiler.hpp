@@ -0,0 +1,169 @@
+/*!
+ * \file CCommProfiler.hpp
+ * \brief Accumulated counts, volume and wait time of the MPI communication.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../datatype_structure.hpp"
+#include "../omp_structure.hpp"
+
+#include <chrono>
+
+/*!
+ * \class CCommProfiler
+ * \brief Counts the exchanges, messages and bytes of the MPI communication of the rank, and the time
+ *        spent waiting for it, by kind of communication (COMM_PROFILING= YES).
+ * \details The point-to-point exchanges of the geometry, of the solvers and of the linear systems all go
+ *          through the buffers of CGeometry, they are counted when the receives are posted and their wait
+ *          time is the time spent in the completion of the messages (the posting, packing and unpacking are
+ *          computation). For the collectives (SU2_MPI::Allreduce) the whole call is wait time, since it
+ *          includes the synchronization with the slowest rank. The remaining wall time is the computation
+ *          time of the rank, whose imbalance is reported at the end of the run with the distribution of the
+ *          number of neighbors of the ranks.
+ * \note All the members are static, there is one profiler per process. Only the master thread counts,
+ *       which is the thread that communicates.
+ * \author SU2 Contributors
+ */
+class CCommProfiler {
+
+public:
+
+  using Clock = std::chrono::steady_clock;
+
+  /*!
+   * \brief Kinds of communication.
+   */
+  enum ENUM_COMM_KIND : int {
+    GEOMETRY_COMMS = 0,       /*!< \brief Point-to-point comms of the geometry (CGeometry::InitiateComms). */
+    SOLVER_COMMS = 1,         /*!< \brief Point-to-point comms of the solvers (CSolver::InitiateComms). */
+    LINEAR_SYSTEM_COMMS = 2,  /*!< \brief Point-to-point comms of the linear systems (CSysMatrix). */
+    COLLECTIVE_COMMS = 3      /*!< \brief Reductions (SU2_MPI::Allreduce). */
+  };
+  static constexpr int N_KIND = 4;
+
+private:
+
+  /*!
+   * \brief Counters of one kind of communication.
+   */
+  struct CCounter {
+    unsigned long exchanges = 0;   /*!< \brief Number of exchanges (or collective calls). */
+    unsigned long messages = 0;    /*!< \brief Number of messages sent. */
+    passivedouble bytes = 0.0;     /*!< \brief Bytes sent. */
+    passivedouble time = 0.0;      /*!< \brief Time spent waiting, in seconds. */
+  };
+
+  static bool active;                /*!< \brief Whether the communication is being counted. */
+  static int currentKind;            /*!< \brief Kind of the current point-to-point exchange. */
+  static CCounter counters[N_KIND];  /*!< \brief Counters of each kind. */
+  static Clock::time_point start;    /*!< \brief Start of the profiling. */
+
+  friend class CCommWaitScope;
+
+public:
+
+  /*!
+   * \brief Start counting the communication (resets the counters).
+   */
+  static void Enable();
+
+  /*!
+   * \brief Get whether the communication of the calling thread is counted.
+   */
+  static inline bool IsActive() { return active && (omp_get_thread_num() == 0); }
+
+  /*!
+   * \brief Set the kind of the point-to-point exchange that is about to start.
+   * \param[in] kind - Kind of communication (ENUM_COMM_KIND).
+   */
+  static inline void SetKind(int kind) { if (IsActive()) currentKind = kind; }
+
+  /*!
+   * \brief Get the kind of the current point-to-point exchange.
+   */
+  static inline int GetKind() { return currentKind; }
+
+  /*!
+   * \brief Count an exchange.
+   * \param[in] kind - Kind of communication (ENUM_COMM_KIND).
+   * \param[in] nMessage - Number of messages sent by the rank.
+   * \param[in] nBytes - Bytes sent by the rank.
+   */
+  static inline void AddExchange(int kind, unsigned long nMessage, passivedouble nBytes) {
+    if (!IsActive()) return;
+    counters[kind].exchanges++;
+    counters[kind].messages += nMessage;
+    counters[kind].bytes += nBytes;
+  }
+
+  /*!
+   * \brief Get the computation time of the rank since the start of the profiling, the wall time minus the wait time.
+   * \note Differences of this value give the computation time of a part of the run (e.g. of some time steps).
+   * \return Time in seconds, 0 if the communication is not being counted.
+   */
+  static passivedouble GetComputeTime();
+
+  /*!
+   * \brief Print the communication and the load imbalance of the ranks, and stop counting (collective).
+   * \param[in] nPointDomain - Number of domain points of the rank (its work).
+   * \param[in] nNeighbor - Number of ranks the rank exchanges points with.
+   */
+  static void Report(unsigned long nPointDomain, int nNeighbor);
+
+};
+
+/*!
+ * \class CCommWaitScope
+ * \brief Accumulates the time from its construction to its destruction as wait time of a kind of communication.
+ */
+class CCommWaitScope {
+
+  const int kind;                         /*!< \brief Kind of communication. */
+  const bool on;                          /*!< \brief Whether the time is counted. */
+  CCommProfiler::Clock::time_point start; /*!< \brief Start of the wait. */
+
+public:
+
+  /*!
+   * \brief Start timing a wait.
+   * \param[in] valKind - Kind of communication (ENUM_COMM_KIND).
+   */
+  explicit CCommWaitScope(int valKind) : kind(valKind), on(CCommProfiler::IsActive()) {
+    if (on) start = CCommProfiler::Clock::now();
+  }
+
+  /*!
+   * \brief Stop timing the wait and accumulate it.
+   */
+  ~CCommWaitScope() {
+    if (!on) return;
+    CCommProfiler::counters[kind].time +=
+      std::chrono::duration<passivedouble>(CCommProfiler::Clock::now() - start).count();
+  }
+
+  CCommWaitScope(const CCommWaitScope&) = delete;
+  CCommWaitScope& operator=(const CCommWaitScope&) = delete;
+};
@@ -0,0 +1,107 @@
+/*!
+ * \file CQuasiNewtonInvLeastSquares.hpp
+ * \brief Quasi-Newton (Anderson) acceleration of fixed-point iterations.
+ *        The implementations are in the <i>CQuasiNewtonInvLeastSquares.cpp</i> file.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../mpi_structure.hpp"
+
+#include <vector>
+
+using namespace std;
+
+/*!
+ * \class CQuasiNewtonInvLeastSquares
+ * \brief Accelerates a fixed-point iteration x_k+1 = G(x_k) with the inverse least squares quasi-Newton
+ *        method (IQN-ILS, equivalent to Anderson acceleration). The new iterate is a combination of the
+ *        last results of G, whose coefficients minimize the same combination of the last residuals
+ *        r = G(x) - x (in the least squares sense).
+ * \note The vectors are flat and distributed, the values of 0 to nOwned-1 are those of this rank and enter the
+ *       (global) inner products, the others (e.g. of the halo points) are only combined with the same
+ *       coefficients. The caller must pack the values in the same order on every iteration.
+ *       Usage: set x_k in CurrentSolution() (it holds the last result of compute), G(x_k) in FPresult(),
+ *       then compute() to obtain x_k+1 in CurrentSolution().
+ * \author SU2 Contributors
+ */
+class CQuasiNewtonInvLeastSquares {
+
+private:
+
+  unsigned short nMaxSamples = 0;  /*!< \brief Max number of stored samples (history depth plus one). */
+  unsigned short nSamples = 0;     /*!< \brief Number of stored samples. */
+  unsigned short iNewest = 0;      /*!< \brief Position of the newest sample in the circular buffers. */
+  unsigned long nOwned = 0;        /*!< \brief Number of values that enter the inner products. */
+
+  vector<vector<passivedouble> > fpSample;   /*!< \brief Results of G of the stored samples. */
+  vector<vector<passivedouble> > resSample;  /*!< \brief Residuals of the stored samples. */
+  vector<passivedouble> gram;                /*!< \brief Inner products of the residuals of the samples (by position). */
+
+  vector<passivedouble> current;   /*!< \brief Current iterate. */
+  vector<passivedouble> fpResult;  /*!< \brief Result of G for the current iterate. */
+
+public:
+
+  /*!
+   * \brief Allocate the history and the vectors.
+   * \param[in] nHistory - Number of previous samples used by the least squares problem (0 disables the acceleration).
+   * \param[in] size - Total number of values.
+   * \param[in] owned - Number of values owned by this rank (the first ones).
+   */
+  void resize(unsigned short nHistory, unsigned long size, unsigned long owned);
+
+  /*!
+   * \brief Discard the stored samples, the next compute returns the result of G (e.g. when G changes).
+   */
+  inline void reset() { nSamples = 0; }
+
+  /*!
+   * \brief Whether the acceleration is allocated.
+   */
+  inline bool active() const { return nMaxSamples > 1; }
+
+  /*!
+   * \brief Number of previous samples in use.
+   */
+  inline unsigned short history() const { return (nSamples > 0)? nSamples-1 : 0; }
+
+  /*!
+   * \brief Access the current iterate x_k.
+   */
+  inline vector<passivedouble>& CurrentSolution() { return current; }
+
+  /*!
+   * \brief Access the result of G for the current iterate.
+   */
+  inline vector<passivedouble>& FPresult() { return fpResult; }
+
+  /*!
+   * \brief Store the current sample and compute the next iterate (collective, all ranks must call it).
+   * \return The next iterate, also in CurrentSolution().
+   */
+  const vector<passivedouble>& compute();
+
+};
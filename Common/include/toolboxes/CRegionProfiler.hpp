@@ -0,0 +1,204 @@
+/*!
+ * \file CRegionProfiler.hpp
+ * \brief Lightweight profiler of named code regions, timed by scoped (RAII) objects.
+ *        The implementations are in the <i>CRegionProfiler.cpp</i> file.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../datatype_structure.hpp"
+#include "../omp_structure.hpp"
+
+#include <vector>
+#include <string>
+#include <chrono>
+#include <algorithm>
+
+using namespace std;
+
+/*!
+ * \class CRegionProfiler
+ * \brief Accumulates the number of calls and the wall time of named code regions, per thread.
+ * \details Regions are timed with SU2_PROFILE_REGION("Name"), which registers the name once (the first
+ *          time the line is executed) and times the rest of the enclosing scope. When the profiler is not
+ *          enabled (REGION_PROFILING= NO) a region costs one branch. Each thread accumulates into its own
+ *          counters, hence regions may be used inside parallel regions. The times are inclusive, i.e. nested
+ *          regions are also counted in their parents. When compiled with VTUNEPROF (Intel ITT) or
+ *          HAVE_NVTX (NVIDIA Tools Extension) the regions are also reported to those tools as tasks/ranges.
+ *          On Linux, each thread can also read hardware counters (perf_event) at the start and end of the
+ *          regions, and SU2_PROFILE_REGION_BYTES sets an estimate of the data traffic of a region, from which
+ *          the achieved bandwidth and arithmetic intensity (roofline model) of the region are reported.
+ * \note All the members are static, there is one profiler per process.
+ * \author SU2 Contributors
+ */
+class CRegionProfiler {
+
+public:
+
+  using Clock = chrono::steady_clock;
+
+  static constexpr int MAX_REGIONS = 128;  /*!< \brief Maximum number of distinct regions. */
+  static constexpr int MAX_EVENTS = 4;     /*!< \brief Maximum number of hardware counters. */
+
+private:
+
+  /*!
+   * \brief Counters of one region and thread.
+   */
+  struct CCounter {
+    unsigned long calls = 0;       /*!< \brief Number of calls. */
+    passivedouble time = 0.0;      /*!< \brief Accumulated wall time in seconds. */
+    passivedouble maxTime = 0.0;   /*!< \brief Longest call in seconds. */
+    passivedouble bytes = 0.0;     /*!< \brief Estimated data traffic of the calls (counted by thread 0). */
+    unsigned long long events[MAX_EVENTS] = {}; /*!< \brief Hardware counts of the calls. */
+  };
+
+  static bool active;                 /*!< \brief Whether the regions are being timed. */
+  static int nThread;                 /*!< \brief Number of threads with counters. */
+  static vector<string> names;        /*!< \brief Names of the registered regions. */
+  static vector<CCounter> counters;   /*!< \brief Counters, MAX_REGIONS per thread. */
+  static int nEvent;                  /*!< \brief Number of hardware counters read per region (0 if disabled). */
+  static vector<int> eventFds;        /*!< \brief File descriptors of the counters, MAX_EVENTS per thread. */
+  static string eventStatus;          /*!< \brief Why the hardware counters are not available. */
+
+  /*!
+   * \brief Open the hardware counters of each thread (in a parallel region), disables them on failure.
+   * \param[in] flopEvent - Raw code of the FLOP counter, 0 for none.
+   */
+  static void OpenEvents(unsigned long long flopEvent);
+
+  /*!
+   * \brief Read the hardware counters of the calling thread.
+   * \param[out] values - Current counts, zero if the thread has no counters.
+   */
+  static void ReadEvents(unsigned long long* values);
+
+  /*!
+   * \brief Tool hooks (ITT, NVTX) at the start and end of a region.
+   */
+  static void BeginHook(int id);
+  static void EndHook(int id);
+
+  friend class CProfilerScope;
+
+public:
+
+  /*!
+   * \brief Register a region (thread-safe), regions with the same name share the counters.
+   * \param[in] name - Name of the region.
+   * \return Identifier of the region, negative if there are too many regions.
+   */
+  static int Register(const char* name);
+
+  /*!
+   * \brief Start timing the regions, for the maximum number of threads of the process.
+   * \param[in] hardwareCounters - Read the cycles, instructions and last level cache misses of the regions.
+   * \param[in] flopEvent - Raw perf_event code of a FLOP counter, 0 for none.
+   */
+  static void Enable(bool hardwareCounters = false, unsigned long long flopEvent = 0);
+
+  /*!
+   * \brief Get whether the regions are being timed.
+   */
+  static inline bool IsActive() { return active; }
+
+  /*!
+   * \brief Write the counters of the rank to "<fileName>_<rank>.csv" and print those of the master (not collective).
+   * \param[in] fileName - Base name of the file.
+   * \param[in] rank - Rank of the process.
+   */
+  static void Write(const string& fileName, int rank);
+
+};
+
+/*!
+ * \class CProfilerScope
+ * \brief Times a region from its construction to its destruction, see SU2_PROFILE_REGION.
+ */
+class CProfilerScope {
+
+  const int id;                          /*!< \brief Identifier of the region. */
+  const bool on;                         /*!< \brief Whether the region is timed. */
+  const passivedouble bytes;             /*!< \brief Estimated data traffic of the region. */
+  CRegionProfiler::Clock::time_point start; /*!< \brief Start of the region. */
+  unsigned long long startEvents[CRegionProfiler::MAX_EVENTS]; /*!< \brief Counts at the start of the region. */
+
+public:
+
+  /*!
+   * \brief Start timing a region.
+   * \param[in] regionId - Identifier returned by CRegionProfiler::Register.
+   * \param[in] valBytes - Estimated data traffic of the whole region (not per thread), 0 if unknown.
+   */
+  explicit CProfilerScope(int regionId, passivedouble valBytes = 0.0) :
+    id(regionId), on(CRegionProfiler::IsActive() && (regionId >= 0)), bytes(valBytes) {
+    if (!on) return;
+    CRegionProfiler::BeginHook(id);
+    if (CRegionProfiler::nEvent > 0) CRegionProfiler::ReadEvents(startEvents);
+    start = CRegionProfiler::Clock::now();
+  }
+
+  /*!
+   * \brief Stop timing the region and accumulate its time in the counters of the thread.
+   */
+  ~CProfilerScope() {
+    if (!on) return;
+    const passivedouble time = chrono::duration<passivedouble>(CRegionProfiler::Clock::now() - start).count();
+    unsigned long long endEvents[CRegionProfiler::MAX_EVENTS];
+    if (CRegionProfiler::nEvent > 0) CRegionProfiler::ReadEvents(endEvents);
+    CRegionProfiler::EndHook(id);
+
+    const int iThread = omp_get_thread_num();
+    if (iThread >= CRegionProfiler::nThread) return;
+
+    auto& counter = CRegionProfiler::counters[iThread*CRegionProfiler::MAX_REGIONS + id];
+    counter.calls++;
+    counter.time += time;
+    counter.maxTime = max(counter.maxTime, time);
+    if (iThread == 0) counter.bytes += bytes;
+    for (int iEvent = 0; iEvent < CRegionProfiler::nEvent; ++iEvent)
+      counter.events[iEvent] += endEvents[iEvent] - startEvents[iEvent];
+  }
+
+  CProfilerScope(const CProfilerScope&) = delete;
+  CProfilerScope& operator=(const CProfilerScope&) = delete;
+};
+
+#define SU2_PROFILE_CONCAT_(A,B) A##B
+#define SU2_PROFILE_CONCAT(A,B) SU2_PROFILE_CONCAT_(A,B)
+
+/*!
+ * \brief Time the rest of the enclosing scope as the region NAME (a string literal).
+ */
+#define SU2_PROFILE_REGION(NAME) \
+  static const int SU2_PROFILE_CONCAT(su2ProfileId_,__LINE__) = CRegionProfiler::Register(NAME); \
+  const CProfilerScope SU2_PROFILE_CONCAT(su2ProfileScope_,__LINE__)(SU2_PROFILE_CONCAT(su2ProfileId_,__LINE__))
+
+/*!
+ * \brief Like SU2_PROFILE_REGION, with an estimate of the bytes moved by the whole region (all threads).
+ */
+#define SU2_PROFILE_REGION_BYTES(NAME, BYTES) \
+  static const int SU2_PROFILE_CONCAT(su2ProfileId_,__LINE__) = CRegionProfiler::Register(NAME); \
+  const CProfilerScope SU2_PROFILE_CONCAT(su2ProfileScope_,__LINE__)(SU2_PROFILE_CONCAT(su2ProfileId_,__LINE__), BYTES)
@@ -0,0 +1,94 @@
+/*!
+ * \file CSumReduction.hpp
+ * \brief Fused reduction (sum over all ranks) of scalars and small arrays.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../mpi_structure.hpp"
+
+#include <vector>
+
+/*!
+ * \class CSumReduction
+ * \brief Collects the values that need to be summed over all ranks (e.g. the force coefficients of
+ *        the boundaries, the residuals) and reduces them with a single Allreduce, instead of one
+ *        latency-bound reduction per value.
+ * \note The registered values are overwritten with their sums by Complete, hence they must remain
+ *       valid (and must not be used) until then. Complete is collective, all ranks must register
+ *       the same number of values in the same order.
+ */
+class CSumReduction {
+
+  std::vector<su2double*> values;     /*!< \brief Registered arrays. */
+  std::vector<int> sizes;             /*!< \brief Number of values of each registered array. */
+  std::vector<su2double> sendBuffer;  /*!< \brief Packed local values. */
+  std::vector<su2double> recvBuffer;  /*!< \brief Packed sums. */
+
+public:
+
+  /*!
+   * \brief Register an array whose values are summed over all ranks.
+   * \param[in,out] array - Local values, replaced by their sums in Complete.
+   * \param[in] size - Number of values.
+   */
+  inline void Add(su2double* array, int size) {
+    if (size <= 0) return;
+    values.push_back(array);
+    sizes.push_back(size);
+  }
+
+  /*!
+   * \brief Register a scalar that is summed over all ranks.
+   * \param[in,out] value - Local value, replaced by its sum in Complete.
+   */
+  inline void Add(su2double& value) { Add(&value, 1); }
+
+  /*!
+   * \brief Sum all the registered values over the ranks of the communicator, then clear the registrations.
+   * \param[in] comm - The communicator.
+   */
+  inline void Complete(SU2_MPI::Comm comm = MPI_COMM_WORLD) {
+
+    sendBuffer.clear();
+    for (size_t i = 0; i < values.size(); ++i)
+      sendBuffer.insert(sendBuffer.end(), values[i], values[i]+sizes[i]);
+
+    recvBuffer.resize(sendBuffer.size());
+
+    if (!sendBuffer.empty())
+      SU2_MPI::Allreduce(sendBuffer.data(), recvBuffer.data(), sendBuffer.size(), MPI_DOUBLE, MPI_SUM, comm);
+
+    size_t pos = 0;
+    for (size_t i = 0; i < values.size(); ++i) {
+      for (int j = 0; j < sizes[i]; ++j) values[i][j] = recvBuffer[pos+j];
+      pos += sizes[i];
+    }
+
+    values.clear();
+    sizes.clear();
+  }
+
+};
@@ -0,0 +1,99 @@
+/*!
+ * \file CTimingReport.hpp
+ * \brief Wall time and memory high-water mark of nested phases (e.g. of the preprocessing).
+ *        The implementations are in the <i>CTimingReport.cpp</i> file.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../mpi_structure.hpp"
+
+#include <vector>
+#include <string>
+#include <chrono>
+
+using namespace std;
+
+/*!
+ * \class CTimingReport
+ * \brief Measures the wall time of nested phases and the memory high-water mark of the process at the end
+ *        of each phase, and prints the minimum, average and maximum over the ranks as a table.
+ * \note The phases are identified by their order, hence all ranks must start and stop the same phases
+ *       in the same order (true for collective code paths, e.g. the preprocessing of the drivers).
+ *       Start and Stop are cheap and always active, only Print communicates.
+ * \author SU2 Contributors
+ */
+class CTimingReport {
+
+private:
+
+  using Clock = chrono::steady_clock;
+
+  /*!
+   * \brief One measured phase.
+   */
+  struct CPhase {
+    string name;                /*!< \brief Name of the phase. */
+    unsigned short depth;       /*!< \brief Nesting level of the phase. */
+    passivedouble time = 0.0;   /*!< \brief Wall time of the phase in seconds. */
+    passivedouble memory = 0.0; /*!< \brief Memory high-water mark of the process at the end of the phase in MB. */
+  };
+
+  vector<CPhase> phases;                                /*!< \brief Phases, in the order they were started. */
+  vector<pair<unsigned long, Clock::time_point> > open; /*!< \brief Started phases that were not stopped. */
+
+public:
+
+  /*!
+   * \brief Start a phase, nested in the current one if any.
+   * \param[in] name - Name of the phase.
+   */
+  void Start(const string& name);
+
+  /*!
+   * \brief Stop the phase that was started last.
+   */
+  void Stop();
+
+  /*!
+   * \brief Print the phases, with their time and memory over the ranks, on the master (collective).
+   * \param[in] title - Title of the table.
+   * \param[in] comm - The communicator.
+   */
+  void Print(const string& title, SU2_MPI::Comm comm = MPI_COMM_WORLD) const;
+
+  /*!
+   * \brief Get the memory high-water mark (peak resident set size) of the process.
+   * \return Memory in MB, 0 if not available on the platform.
+   */
+  static passivedouble GetPeakMemory();
+
+  /*!
+   * \brief Get the current memory (resident set size) of the process.
+   * \return Memory in MB, 0 if not available on the platform.
+   */
+  static passivedouble GetCurrentMemory();
+
+};
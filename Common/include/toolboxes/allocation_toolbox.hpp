@@ -28,6 +28,7 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 
+
 #pragma once
 
 #if defined(_WIN32)
@@ -37,6 +38,12 @@
 #endif
 
 #include <cassert>
+#include <cstddef>
+#include <atomic>
+#include <string>
+#include <vector>
+#include <new>
+#include <type_traits>
 
 namespace MemoryAllocation
 {
@@ -51,14 +58,119 @@ inline constexpr size_t round_up(size_t multiple, size_t x)
   return ((x+multiple-1)/multiple)*multiple;
 }
 
+/*!
+ * \brief Categories of the tracked memory.
+ */
+enum ENUM_MEMORY_CATEGORY : int {
+  MEMORY_OTHER = 0,           /*!< \brief Not attributed to a category. */
+  MEMORY_GEOMETRY = 1,        /*!< \brief Grids, dual grids and multigrid levels. */
+  MEMORY_VARIABLES = 2,       /*!< \brief Variables (solution, primitives, gradients, etc.) of the solvers. */
+  MEMORY_JACOBIAN = 3,        /*!< \brief Matrices of the linear systems (CSysMatrix). */
+  MEMORY_PRECONDITIONER = 4,  /*!< \brief ILU factors and inverse diagonal blocks of the matrices. */
+  MEMORY_LINEAR_SOLVER = 5,   /*!< \brief Vectors of the linear systems and Krylov workspace (CSysVector). */
+  MEMORY_OUTPUT = 6,          /*!< \brief Buffers of the output (data sorters). */
+  MEMORY_AD_TAPE = 7          /*!< \brief Tape of the reverse mode AD (set when reported). */
+};
+constexpr int N_MEMORY_CATEGORY = 8;
+
+/*!
+ * \brief Bytes in use and high-water mark of each category, for the whole process.
+ */
+struct CMemoryCounters {
+  std::atomic<long long> current[N_MEMORY_CATEGORY]; /*!< \brief Bytes in use. */
+  std::atomic<long long> peak[N_MEMORY_CATEGORY];    /*!< \brief High-water mark of the bytes in use. */
+  std::atomic<long long> totalCurrent;               /*!< \brief Bytes in use, all categories. */
+  std::atomic<long long> totalPeak;                  /*!< \brief High-water mark of all categories. */
+  std::atomic<int> category;                         /*!< \brief Category of the allocations without one. */
+};
+extern CMemoryCounters memoryCounters;
+
+/*!
+ * \brief Raise a high-water mark (thread-safe).
+ */
+inline void update_peak(std::atomic<long long>& peak, long long value) noexcept
+{
+  long long old = peak.load(std::memory_order_relaxed);
+  while (value > old && !peak.compare_exchange_weak(old, value, std::memory_order_relaxed)) {}
+}
+
+/*!
+ * \brief Account for an allocation (bytes > 0) or deallocation (bytes < 0) of a category, thread-safe.
+ * \note The allocations of this toolbox are accounted automatically, this is for the memory of other
+ *       containers (e.g. allocated with new) that should appear in the report.
+ * \param[in] category - Category of the memory (ENUM_MEMORY_CATEGORY).
+ * \param[in] bytes - Size of the (de)allocation in bytes.
+ */
+inline void track_memory(int category, long long bytes) noexcept
+{
+  const long long current = memoryCounters.current[category].fetch_add(bytes, std::memory_order_relaxed) + bytes;
+  update_peak(memoryCounters.peak[category], current);
+  const long long total = memoryCounters.totalCurrent.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+  update_peak(memoryCounters.totalPeak, total);
+}
+
+/*!
+ * \brief Get the category of the allocations that do not specify one.
+ */
+inline int memory_category() noexcept
+{
+  return memoryCounters.category.load(std::memory_order_relaxed);
+}
+
+/*!
+ * \brief Get the resident memory of the process in bytes (0 if not available on the platform).
+ */
+long long resident_memory();
+
+/*!
+ * \class CMemoryCategoryScope
+ * \brief Sets the category of the allocations that do not specify one (e.g. those of C2DContainer) until
+ *        the end of the scope, e.g. the variables for the preprocessing of the solvers.
+ * \note Optionally, the growth of the resident memory during the scope that was not tracked (e.g. containers
+ *       allocated with new) is also attributed to the category, meaningful for the large phases of the
+ *       preprocessing (e.g. the geometry) that are not run in parallel with other allocations.
+ */
+class CMemoryCategoryScope {
+  const int category, previous;
+  const bool attributeResident;
+  long long residentStart = 0, trackedStart = 0;
+public:
+  explicit CMemoryCategoryScope(int valCategory, bool valAttributeResident = false) noexcept :
+    category(valCategory), previous(memory_category()), attributeResident(valAttributeResident) {
+    memoryCounters.category.store(category, std::memory_order_relaxed);
+    if (!attributeResident) return;
+    residentStart = resident_memory();
+    trackedStart = memoryCounters.totalCurrent.load(std::memory_order_relaxed);
+  }
+  ~CMemoryCategoryScope() {
+    memoryCounters.category.store(previous, std::memory_order_relaxed);
+    if (!attributeResident) return;
+    const long long untracked = (resident_memory() - residentStart) -
+                                (memoryCounters.totalCurrent.load(std::memory_order_relaxed) - trackedStart);
+    if (untracked > 0) track_memory(category, untracked);
+  }
+  CMemoryCategoryScope(const CMemoryCategoryScope&) = delete;
+  CMemoryCategoryScope& operator=(const CMemoryCategoryScope&) = delete;
+};
+
+/*!
+ * \brief Size, category and offset of an allocation, stored in front of the aligned block.
+ */
+struct CAllocationHeader {
+  size_t bytes;
+  int category;
+  int offset;
+};
+
 /*!
  * \brief Aligned memory allocation compatible across platforms.
  * \param[in] alignment, in bytes, of the memory being allocated.
  * \param[in] size, also in bytes.
+ * \param[in] category, of the memory (ENUM_MEMORY_CATEGORY).
  * \return Pointer to memory, always use su2::aligned_free to deallocate.
  */
 template<class T>
-inline T* aligned_alloc(size_t alignment, size_t size) noexcept
+inline T* aligned_alloc(size_t alignment, size_t size, int category) noexcept
 {
   assert(is_power_of_two(alignment));
 
@@ -66,19 +178,44 @@ inline T* aligned_alloc(size_t alignment, size_t size) noexcept
 
   size = round_up(alignment, size);
 
+  /*--- The header is placed just before the returned (aligned) address. ---*/
+  const size_t offset = round_up(alignment, sizeof(CAllocationHeader));
+
   void* ptr = nullptr;
 
 #if defined(__APPLE__)
-  if(::posix_memalign(&ptr, alignment, size) != 0)
+  if(::posix_memalign(&ptr, alignment, offset+size) != 0)
   {
     ptr = nullptr;
   }
 #elif defined(_WIN32)
-  ptr = _aligned_malloc(size, alignment);
+  ptr = _aligned_malloc(offset+size, alignment);
 #else
-  ptr = ::aligned_alloc(alignment, size);
+  ptr = ::aligned_alloc(alignment, offset+size);
 #endif
-  return static_cast<T*>(ptr);
+  if(ptr == nullptr) return nullptr;
+
+  char* data = static_cast<char*>(ptr) + offset;
+  CAllocationHeader* header = reinterpret_cast<CAllocationHeader*>(data) - 1;
+  header->bytes = size;
+  header->category = category;
+  header->offset = static_cast<int>(offset);
+
+  track_memory(category, static_cast<long long>(size));
+
+  return reinterpret_cast<T*>(data);
+}
+
+/*!
+ * \brief Aligned memory allocation in the current category (see CMemoryCategoryScope).
+ * \param[in] alignment, in bytes, of the memory being allocated.
+ * \param[in] size, also in bytes.
+ * \return Pointer to memory, always use su2::aligned_free to deallocate.
+ */
+template<class T>
+inline T* aligned_alloc(size_t alignment, size_t size) noexcept
+{
+  return aligned_alloc<T>(alignment, size, memory_category());
 }
 
 /*!
@@ -88,12 +225,176 @@ inline T* aligned_alloc(size_t alignment, size_t size) noexcept
 template<class T>
 inline void aligned_free(T* ptr) noexcept
 {
+  if(ptr == nullptr) return;
+
+  char* data = reinterpret_cast<char*>(ptr);
+  const CAllocationHeader* header = reinterpret_cast<const CAllocationHeader*>(data) - 1;
+
+  track_memory(header->category, -static_cast<long long>(header->bytes));
+
+  void* base = data - header->offset;
 #if defined(_WIN32)
-  _aligned_free(ptr);
+  _aligned_free(base);
 #else
-  free(ptr);
+  free(base);
 #endif
 }
 
-} // namespace
+/*!
+ * \class CScratchArena
+ * \brief Stack-like allocator for the temporaries of hot paths (e.g. the Jacobians of a boundary
+ *        condition, the partial sums of a reduction), there is one per thread, see scratch_arena().
+ * \note The memory is kept after the temporaries are released, once the arena has grown to the size
+ *       needed by the code, an allocation only moves an offset (no calls to malloc, which contend
+ *       when many threads allocate, and no page faults). Use CScratchScope to release the memory.
+ */
+class CScratchArena {
+public:
+  /*!
+   * \brief Position in the arena, the allocations made after it are released together.
+   */
+  struct CMark {
+    size_t block, offset, nDestructor;
+  };
+
+private:
+  enum : size_t { ALIGNMENT = 64, MIN_BLOCK_SIZE = 65536 };
 
+  struct CBlock {
+    char* data;
+    size_t size;
+  };
+  struct CDestructor {
+    void* ptr;
+    size_t n;
+    void (*destroy)(void*, size_t);
+  };
+
+  std::vector<CBlock> blocks;            /*!< \brief Blocks of memory, the used ones are [0, current]. */
+  std::vector<CDestructor> destructors;  /*!< \brief Arrays of non-trivial types (e.g. AD types) to destroy. */
+  size_t current = 0;                    /*!< \brief Block from which the memory is taken. */
+  size_t offset = 0;                     /*!< \brief Used bytes of the current block. */
+
+  template<class T>
+  static void destroy(void* ptr, size_t n) noexcept {
+    T* p = static_cast<T*>(ptr);
+    for (size_t i = 0; i < n; ++i) p[i].~T();
+  }
+
+  /*!
+   * \brief Get uninitialized memory, adding a block if the current one does not have space.
+   */
+  void* allocate(size_t bytes);
+
+  /*!
+   * \brief Free all the blocks.
+   */
+  void clear() noexcept;
+
+public:
+  CScratchArena() = default;
+  CScratchArena(const CScratchArena&) = delete;
+  CScratchArena& operator=(const CScratchArena&) = delete;
+  ~CScratchArena() { clear(); }
+
+  /*!
+   * \brief Get the current position of the arena.
+   */
+  inline CMark mark() const noexcept { return {current, offset, destructors.size()}; }
+
+  /*!
+   * \brief Release the allocations made after a mark, the most recent first.
+   * \note When everything is released and the memory spans more than one block, these are
+   *       replaced by a single block large enough for all of them.
+   */
+  void release(const CMark& start) noexcept;
+
+  /*!
+   * \brief Allocate an array of value initialized (e.g. zero) objects.
+   * \param[in] n - Number of objects.
+   */
+  template<class T>
+  T* alloc(size_t n) {
+    T* ptr = static_cast<T*>(allocate(n*sizeof(T)));
+    for (size_t i = 0; i < n; ++i) new (ptr+i) T();
+    if (!std::is_trivially_destructible<T>::value)
+      destructors.push_back({ptr, n, &destroy<T>});
+    return ptr;
+  }
+
+  /*!
+   * \brief Allocate a zero initialized matrix as an array of pointers to its (contiguous) rows.
+   * \param[in] rows - Number of rows.
+   * \param[in] cols - Number of columns.
+   */
+  template<class T>
+  T** alloc_matrix(size_t rows, size_t cols) {
+    T** mat = alloc<T*>(rows);
+    T* data = alloc<T>(rows*cols);
+    for (size_t i = 0; i < rows; ++i) mat[i] = data + i*cols;
+    return mat;
+  }
+};
+
+/*!
+ * \brief Get the arena of the calling thread.
+ */
+CScratchArena& scratch_arena();
+
+/*!
+ * \class CScratchScope
+ * \brief Allocates from the arena of the calling thread, the memory is released at the end of the scope.
+ */
+class CScratchScope {
+  CScratchArena& arena;
+  const CScratchArena::CMark start;
+public:
+  CScratchScope() : arena(scratch_arena()), start(arena.mark()) {}
+  ~CScratchScope() { arena.release(start); }
+  CScratchScope(const CScratchScope&) = delete;
+  CScratchScope& operator=(const CScratchScope&) = delete;
+
+  /*!
+   * \brief Allocate an array of value initialized objects, see CScratchArena::alloc.
+   */
+  template<class T>
+  inline T* alloc(size_t n) { return arena.alloc<T>(n); }
+
+  /*!
+   * \brief Allocate a zero initialized matrix, see CScratchArena::alloc_matrix.
+   */
+  template<class T>
+  inline T** alloc_matrix(size_t rows, size_t cols) { return arena.alloc_matrix<T>(rows, cols); }
+};
+
+/*!
+ * \brief Get the bytes in use of a category in this process.
+ * \param[in] category - Category of the memory (ENUM_MEMORY_CATEGORY).
+ */
+inline long long memory_in_use(int category) noexcept
+{
+  return memoryCounters.current[category].load(std::memory_order_relaxed);
+}
+
+/*!
+ * \brief Get the name of a category.
+ * \param[in] category - Category of the memory (ENUM_MEMORY_CATEGORY).
+ */
+const char* memory_category_name(int category);
+
+/*!
+ * \brief Print the memory of each category (current and high-water mark) in use by the ranks, the
+ *        memory of the AD tape, and the resident memory of the processes, on the master (collective).
+ * \param[in] title - Title of the report.
+ */
+void print_memory_report(const std::string& title);
+
+/*!
+ * \brief Print the CPU and NUMA node of the threads of each rank at the time of the call, on the master
+ *        (collective), with a warning when threads share a CPU (which suggests they are not bound).
+ * \note Memory is placed on the NUMA node of the thread that first touches it (see parallelFirstTouch),
+ *       the threads should be bound (e.g. OMP_PROC_BIND=close, OMP_PLACES=cores) for this to be effective.
+ */
+void print_thread_placement();
+
+} // namespace
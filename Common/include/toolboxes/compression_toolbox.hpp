@@ -0,0 +1,86 @@
+/*!
+ * \file compression_toolbox.hpp
+ * \brief Compression of the data of the SU2 binary restart files (byte shuffle + deflate,
+ *        optionally with an error-bounded quantization of some fields).
+ *        The implementations are in the <i>compression_toolbox.cpp</i> file.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../mpi_structure.hpp"
+
+#include <vector>
+#include <string>
+
+class CGeometry;
+
+/*!
+ * \namespace CompressionToolbox
+ * \brief Compressed SU2 binary restart files, they start with the header ints
+ *        [SU2_COMPRESSED_RESTART_ID nVar nPointGlobal compression nBlock] and the field names as the
+ *        uncompressed files, followed by the absolute error bound of each field (0 for lossless fields),
+ *        the table [nPoint nBytes] (unsigned long) of the blocks and the compressed blocks. Each block
+ *        holds the data of consecutive points, with the usual layout, and is written by one rank.
+ * \details In a block the values of each field are byte shuffled (the first bytes of all values, then the
+ *          second ones, ...) and deflated. The fields with an error bound are first quantized to integer
+ *          multiples of twice the bound, whose differences between consecutive points are stored instead.
+ */
+namespace CompressionToolbox {
+
+/*!
+ * \brief Compress the data of consecutive points.
+ * \param[in] data - Values of the points (nVar values per point).
+ * \param[in] nPoint - Number of points.
+ * \param[in] nVar - Number of values per point.
+ * \param[in] errorBound - Absolute error bound of each field, 0 (or negative) for lossless compression.
+ * \param[in] level - Deflate level (1-9).
+ * \param[out] block - The compressed data.
+ */
+void CompressBlock(const passivedouble* data, unsigned long nPoint, unsigned long nVar,
+                   const passivedouble* errorBound, int level, std::vector<char>& block);
+
+/*!
+ * \brief Restore the data of consecutive points from a compressed block.
+ * \param[in] block - The compressed data.
+ * \param[in] nBytes - Size of the compressed data.
+ * \param[in] nPoint - Number of points.
+ * \param[in] nVar - Number of values per point.
+ * \param[in] errorBound - Absolute error bound of each field, as for the compression.
+ * \param[out] data - Values of the points (nVar values per point).
+ */
+void DecompressBlock(const char* block, unsigned long nBytes, unsigned long nPoint, unsigned long nVar,
+                     const passivedouble* errorBound, passivedouble* data);
+
+/*!
+ * \brief Read the data of the points of this rank from a compressed restart file, the blocks are
+ *        shared among the ranks for the decompression and the points are sent to the ranks that own them.
+ * \param[in] fileName - Name of the restart file.
+ * \param[in] header - The 5 ints at the start of the file.
+ * \param[in] geometry - Geometrical definition, to find the (domain) points of this rank.
+ * \return Values of the points of this rank, in the order of their global index (to be deleted by the caller).
+ */
+passivedouble* ReadRestartData(const std::string& fileName, const int* header, const CGeometry* geometry);
+
+}
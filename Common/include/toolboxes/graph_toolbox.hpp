@@ -287,6 +287,10 @@ using CEdgeToNonZeroMap = C2DContainer<unsigned long, Index_t, StorageType::RowM
 using CCompressedSparsePatternUL = CCompressedSparsePattern<unsigned long>;
 using CEdgeToNonZeroMapUL = CEdgeToNonZeroMap<unsigned long>;
 
+/*--- Local (per rank) sparse structures, see su2localidx. ---*/
+using CCompressedSparsePatternLocal = CCompressedSparsePattern<su2localidx>;
+using CEdgeToNonZeroMapLocal = CEdgeToNonZeroMap<su2localidx>;
+
 
 /*!
  * \brief Build a sparse pattern from geometry information, of type FVM or FEM,
@@ -421,7 +425,7 @@ CEdgeToNonZeroMap<Index_t> mapEdgesToSparsePattern(Geometry_t& geometry,
  * \param[in] numInnerIndexes - Number of indexes that are to be colored.
  * \return Natural (sequential) coloring of the inner indices.
  */
-template<class T = CCompressedSparsePatternUL,
+template<class T = CCompressedSparsePatternLocal,
          class Index_t = typename T::IndexType>
 T createNaturalColoring(Index_t numInnerIndexes)
 {
@@ -471,7 +475,7 @@ T colorSparsePattern(const T& pattern, size_t groupSize = 1, bool balanceColors
   const Index_t nOuter = pattern.getOuterSize();
 
   /*--- Trivial case. ---*/
-  if(groupSize >= nOuter) return createNaturalColoring(nOuter);
+  if(groupSize >= nOuter) return createNaturalColoring<T>(nOuter);
 
   const Index_t minIdx = pattern.getMinInnerIdx();
   const Index_t nInner = pattern.getMaxInnerIdx()+1-minIdx;
@@ -578,10 +582,80 @@ T colorSparsePattern(const T& pattern, size_t groupSize = 1, bool balanceColors
 }
 
 
+/*!
+ * \brief Compute the non zero blocks of a sparse Jacobian dR/dU with tangent (forward AD)
+ *        sweeps. The outer indices of the same color are seeded together, which is
+ *        possible if the coloring is of the dependency stencil (e.g. colorSparsePattern
+ *        of the pattern), as then each row depends on at most one index of each color.
+ * \note  Each sweep seeds "numDirections" (color, variable) pairs, one per tangent direction.
+ *        The callbacks receive outer indices of the pattern, to be called by all threads:
+ *        seed(iOuter, iVar, iDir, on) - set (on) or clear the tangent of variable iVar of
+ *        index iOuter in direction iDir; evaluate() - compute R(U) with the seeded tangents;
+ *        store(iRow, iCol, jVar, iDir) - the tangent of row iRow in direction iDir is the
+ *        column jVar of block (iRow,iCol).
+ * \param[in] pattern - Dependency stencil, row i depends on the inner indices of i (symmetric).
+ * \param[in] coloring - Coloring of the pattern.
+ * \param[in] indexColor - Color of each outer index (optional output of colorSparsePattern).
+ * \param[in] blockSize - Number of variables per index.
+ * \param[in] numDirections - Number of tangent directions per sweep.
+ * \return Number of sweeps (evaluations of the residual).
+ */
+template<class T, typename Color_t, class Seed_t, class Evaluate_t, class Store_t>
+unsigned long computeColoredJacobian(const T& pattern, const T& coloring, const std::vector<Color_t>& indexColor,
+                                     unsigned long blockSize, unsigned long numDirections,
+                                     Seed_t seed, Evaluate_t evaluate, Store_t store)
+{
+  using Index_t = typename T::IndexType;
+
+  const unsigned long nColumns = coloring.getOuterSize() * blockSize;
+  const Index_t nOuter = pattern.getOuterSize();
+  unsigned long nSweep = 0;
+
+  for(unsigned long first = 0; first < nColumns; first += numDirections, ++nSweep)
+  {
+    const unsigned long nDir = std::min(numDirections, nColumns-first);
+
+    auto Seed = [&](bool on) {
+      for(unsigned long iDir = 0; iDir < nDir; ++iDir) {
+        const Index_t color = (first+iDir) / blockSize;
+        const unsigned long iVar = (first+iDir) % blockSize;
+        const Index_t begin = coloring.outerPtr()[color], end = coloring.outerPtr()[color+1];
+
+        SU2_OMP_FOR_STAT(roundUpDiv(end-begin, omp_get_num_threads()))
+        for(Index_t k = begin; k < end; ++k)
+          seed(coloring.innerIdx()[k], iVar, iDir, on);
+      }
+    };
+
+    Seed(true);
+
+    evaluate();
+
+    /*--- Each row has at most one inner index of the seeded colors. ---*/
+
+    SU2_OMP_FOR_DYN(roundUpDiv(nOuter, 2*omp_get_num_threads()))
+    for(Index_t iRow = 0; iRow < nOuter; ++iRow) {
+      for(Index_t k = pattern.outerPtr()[iRow]; k < pattern.outerPtr()[iRow+1]; ++k) {
+        const Index_t iCol = pattern.innerIdx()[k];
+        const unsigned long column = indexColor[iCol] * blockSize;
+        if(column+blockSize <= first || column >= first+nDir) continue;
+
+        for(unsigned long jVar = 0; jVar < blockSize; ++jVar)
+          if(column+jVar >= first && column+jVar < first+nDir)
+            store(iRow, iCol, jVar, column+jVar-first);
+      }
+    }
+
+    Seed(false);
+  }
+  return nSweep;
+}
+
+
 /*!
  * \brief A way to represent one grid color that allows range-for syntax.
  */
-template<typename T = unsigned long>
+template<typename T = su2localidx>
 struct GridColor
 {
   static_assert(std::is_integral<T>::value,"");
@@ -598,6 +672,70 @@ struct GridColor
 };
 
 
+/*!
+ * \brief Level-schedule the rows of a sparse pattern for a triangular sweep (e.g.
+ *        Gauss-Seidel, or the factorization and solves of ILU). Rows in the same level
+ *        only depend on rows of previous levels, and so they can be processed in parallel.
+ * \note  The result is returned as a compressed sparse pattern where the levels are the
+ *        outer indices and the rows of the input pattern are the inner indices. The inner
+ *        indices of the input pattern must be sorted and the diagonal pointer available.
+ * \param[in] pattern - Row-major sparse pattern that defines the dependencies.
+ * \param[in] nRows - Number of rows to schedule, columns >= nRows are ignored (e.g. halos).
+ * \param[in] upper - Schedule a backward sweep (upper part) instead of a forward one.
+ * \return Level schedule in the same type of the input pattern.
+ */
+template<class T>
+T levelScheduleSparsePattern(const T& pattern, typename T::IndexType nRows, bool upper)
+{
+  using Index_t = typename T::IndexType;
+
+  const auto outerPtr = pattern.outerPtr();
+  const auto innerIdx = pattern.innerIdx();
+  const auto diagPtr = pattern.diagPtr();
+
+  /*--- Level of each row, one more than the highest level of its dependencies. ---*/
+  std::vector<Index_t> rowLevel(nRows, 0);
+  Index_t nLevel = 0;
+
+  for(Index_t iRow = 0; iRow < nRows; ++iRow)
+  {
+    Index_t row = upper? nRows-1-iRow : iRow;
+    Index_t level = 0;
+
+    if(!upper) {
+      for(auto k = outerPtr[row]; k < diagPtr[row]; ++k)
+        level = std::max(level, rowLevel[innerIdx[k]]+1);
+    }
+    else {
+      for(auto k = diagPtr[row]+1; k < outerPtr[row+1]; ++k) {
+        if(innerIdx[k] >= nRows) break;
+        level = std::max(level, rowLevel[innerIdx[k]]+1);
+      }
+    }
+    rowLevel[row] = level;
+    nLevel = std::max(nLevel, level+1);
+  }
+
+  /*--- Count the rows per level and sort them into the outer pointer. ---*/
+  su2vector<Index_t> levelPtr(nLevel+1);
+  levelPtr = 0;
+  for(Index_t iRow = 0; iRow < nRows; ++iRow)
+    ++levelPtr(rowLevel[iRow]+1);
+
+  for(Index_t iLevel = 0; iLevel < nLevel; ++iLevel)
+    levelPtr(iLevel+1) += levelPtr(iLevel);
+
+  /*--- Rows are inserted in ascending order within each level. ---*/
+  su2vector<Index_t> levelRows(nRows);
+  std::vector<Index_t> pos(levelPtr.data(), levelPtr.data()+nLevel);
+
+  for(Index_t iRow = 0; iRow < nRows; ++iRow)
+    levelRows(pos[rowLevel[iRow]]++) = iRow;
+
+  return T(std::move(levelPtr), std::move(levelRows));
+}
+
+
 /*!
  * \brief A way to represent natural coloring {0,1,2,...,size-1} with zero
  * overhead (behaves like looping with an integer index, after optimization...).
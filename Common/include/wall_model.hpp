@@ -38,6 +38,10 @@ using namespace std;
 /* Forward declaration of the class CFluidModel to avoid any problems. */
 class CFluidModel;
 
+/* Maximum number of exchange points treated simultaneously in the batched
+   versions of the wall models. */
+#define SIZE_BATCH_WALL_MODEL 16
+
 /*!
  * \class CWallModel
  * \brief Base class for defining the LES wall model.
@@ -71,7 +75,8 @@ public:
    * \param[in]  Wall_Temperature       - Value of the wall temperature, if prescribed.
    * \param[in]  Temperature_Prescribed - Wheter or not the wall temperature is prescribed.
    * \param[in]  FluidModel             - Fluid model used in the solver.
-   * \param[out] tauWall                - Wall shear stress, to be computed.
+   * \param[in,out] tauWall            - Wall shear stress, to be computed. A positive value
+                                          on input is used as initial guess.
    * \param[out] qWall                  - Wall hear flux, to be computed (if not prescribed).
    * \param[out] ViscosityWall          - Laminar viscosity at the wall, to be computed.
    * \param[out] OverCvWall             - Thermal conductivity divided by Cv at the wall,
@@ -90,6 +95,42 @@ public:
                                           su2double       &qWall,
                                           su2double       &ViscosityWall,
                                           su2double       &kOverCvWall);
+
+  /*!
+   * \brief Virtual function, which computes the wall shear stress and heat flux
+            for a batch of exchange locations. The base class loops over the
+            points and calls the pointwise version.
+   * \param[in]  nPoints                - Number of exchange locations in the batch.
+   * \param[in]  tExchange              - Temperatures at the exchange locations.
+   * \param[in]  velExchange            - Velocities at the exchange locations.
+   * \param[in]  muExchange             - Laminar viscosities at the exchange locations.
+   * \param[in]  pExchange              - Pressures at the exchange locations.
+   * \param[in]  Wall_HeatFlux          - Value of the wall heat flux, if prescribed.
+   * \param[in]  HeatFlux_Prescribed    - Whether or not the wall heat flux is prescribed.
+   * \param[in]  Wall_Temperature       - Value of the wall temperature, if prescribed.
+   * \param[in]  Temperature_Prescribed - Wheter or not the wall temperature is prescribed.
+   * \param[in]  FluidModel             - Fluid model used in the solver.
+   * \param[in,out] tauWall            - Wall shear stresses, to be computed. Positive values
+                                          on input are used as initial guess.
+   * \param[out] qWall                  - Wall heat fluxes, to be computed (if not prescribed).
+   * \param[out] ViscosityWall          - Laminar viscosities at the wall, to be computed.
+   * \param[out] kOverCvWall            - Thermal conductivities divided by Cv at the wall,
+                                          to be computed.
+   */
+  virtual void WallShearStressAndHeatFlux(const unsigned short nPoints,
+                                          const su2double      *tExchange,
+                                          const su2double      *velExchange,
+                                          const su2double      *muExchange,
+                                          const su2double      *pExchange,
+                                          const su2double      Wall_HeatFlux,
+                                          const bool           HeatFlux_Prescribed,
+                                          const su2double      Wall_Temperature,
+                                          const bool           Temperature_Prescribed,
+                                          CFluidModel          *FluidModel,
+                                          su2double            *tauWall,
+                                          su2double            *qWall,
+                                          su2double            *ViscosityWall,
+                                          su2double            *kOverCvWall);
 protected:
 
   su2double h_wm;    /*!< \brief The thickness of the wall model. This is also basically the exchange location */
@@ -122,6 +163,9 @@ public:
    */
   ~CWallModel1DEQ(void);
 
+  /* The batched version of the base class, which loops over the points, is used. */
+  using CWallModel::WallShearStressAndHeatFlux;
+
   /*!
    * \brief Function, which computes the wall shear stress and heat flux
             from the data at the exchange location.
@@ -134,7 +178,8 @@ public:
    * \param[in]  Wall_Temperature       - Value of the wall temperature, if prescribed.
    * \param[in]  Temperature_Prescribed - Wheter or not the wall temperature is prescribed.
    * \param[in]  FluidModel             - Fluid model used in the solver.
-   * \param[out] tauWall                - Wall shear stress, to be computed.
+   * \param[in,out] tauWall            - Wall shear stress, to be computed. A positive value
+                                          on input is used as initial guess.
    * \param[out] qWall                  - Wall hear flux, to be computed (if not prescribed).
    * \param[out] ViscosityWall          - Laminar viscosity at the wall, to be computed.
    * \param[out] kOverCvWall             - Thermal conductivity divided by Cv at the wall,
@@ -198,7 +243,8 @@ public:
    * \param[in]  Wall_Temperature       - Value of the wall temperature, if prescribed.
    * \param[in]  Temperature_Prescribed - Wheter or not the wall temperature is prescribed.
    * \param[in]  FluidModel             - Fluid model used in the solver.
-   * \param[out] tauWall                - Wall shear stress, to be computed.
+   * \param[in,out] tauWall            - Wall shear stress, to be computed. A positive value
+                                          on input is used as initial guess.
    * \param[out] qWall                  - Wall hear flux, to be computed (if not prescribed).
    * \param[out] ViscosityWall          - Laminar viscosity at the wall, to be computed.
    * \param[out] kOverCvWall             - Thermal conductivity divided by Cv at the wall,
@@ -217,6 +263,42 @@ public:
                                   su2double       &qWall,
                                   su2double       &ViscosityWall,
                                   su2double       &kOverCvWall);
+
+  /*!
+   * \brief Function, which computes the wall shear stress and heat flux for a
+            batch of exchange locations. The Newton iterations for the friction
+            velocity are carried out simultaneously for all points of the batch.
+   * \param[in]  nPoints                - Number of exchange locations in the batch.
+   * \param[in]  tExchange              - Temperatures at the exchange locations.
+   * \param[in]  velExchange            - Velocities at the exchange locations.
+   * \param[in]  muExchange             - Laminar viscosities at the exchange locations.
+   * \param[in]  pExchange              - Pressures at the exchange locations.
+   * \param[in]  Wall_HeatFlux          - Value of the wall heat flux, if prescribed.
+   * \param[in]  HeatFlux_Prescribed    - Whether or not the wall heat flux is prescribed.
+   * \param[in]  Wall_Temperature       - Value of the wall temperature, if prescribed.
+   * \param[in]  Temperature_Prescribed - Wheter or not the wall temperature is prescribed.
+   * \param[in]  FluidModel             - Fluid model used in the solver.
+   * \param[in,out] tauWall            - Wall shear stresses, to be computed. Positive values
+                                          on input are used as initial guess.
+   * \param[out] qWall                  - Wall heat fluxes, to be computed (if not prescribed).
+   * \param[out] ViscosityWall          - Laminar viscosities at the wall, to be computed.
+   * \param[out] kOverCvWall            - Thermal conductivities divided by Cv at the wall,
+                                          to be computed.
+   */
+  void WallShearStressAndHeatFlux(const unsigned short nPoints,
+                                  const su2double      *tExchange,
+                                  const su2double      *velExchange,
+                                  const su2double      *muExchange,
+                                  const su2double      *pExchange,
+                                  const su2double      Wall_HeatFlux,
+                                  const bool           HeatFlux_Prescribed,
+                                  const su2double      Wall_Temperature,
+                                  const bool           Temperature_Prescribed,
+                                  CFluidModel          *FluidModel,
+                                  su2double            *tauWall,
+                                  su2double            *qWall,
+                                  su2double            *ViscosityWall,
+                                  su2double            *kOverCvWall);
   
 private:
 
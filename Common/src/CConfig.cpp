@@ -34,6 +34,7 @@
 
 #include "../include/ad_structure.hpp"
 #include "../include/toolboxes/printing_toolbox.hpp"
+#include "../include/omp_structure.hpp"
 
 using namespace PrintingToolbox;
 
@@ -380,6 +381,13 @@ void CConfig::addUShortListOption(const string name, unsigned short & size, unsi
   option_map.insert(pair<string, COptionBase *>(name, val));
 }
 
+void CConfig::addULongListOption(const string name, unsigned short & size, unsigned long * & option_field) {
+  assert(option_map.find(name) == option_map.end());
+  all_options.insert(pair<string, bool>(name, true));
+  COptionBase* val = new COptionULongList(name, size, option_field);
+  option_map.insert(pair<string, COptionBase *>(name, val));
+}
+
 void CConfig::addStringListOption(const string name, unsigned short & num_marker, string* & option_field) {
   assert(option_map.find(name) == option_map.end());
   all_options.insert(pair<string, bool>(name, true));
@@ -529,6 +537,26 @@ void CConfig::addPythonOption(const string name) {
 
 unsigned short CConfig::GetnZone(string val_mesh_filename, unsigned short val_format) {
 
+  /*--- Only the master opens the mesh file, see CConfig::GetConfigFileOptions. ---*/
+
+  unsigned long nZone = 0;
+  if (SU2_MPI::GetRank() == MASTER_NODE) nZone = ReadnZone(val_mesh_filename, val_format);
+  SU2_MPI::Bcast(&nZone, 1, MPI_UNSIGNED_LONG, MASTER_NODE, SU2_MPI::GetComm());
+
+  return (unsigned short) nZone;
+}
+
+unsigned short CConfig::GetnDim(string val_mesh_filename, unsigned short val_format) {
+
+  unsigned long nDim = 0;
+  if (SU2_MPI::GetRank() == MASTER_NODE) nDim = ReadnDim(val_mesh_filename, val_format);
+  SU2_MPI::Bcast(&nDim, 1, MPI_UNSIGNED_LONG, MASTER_NODE, SU2_MPI::GetComm());
+
+  return (unsigned short) nDim;
+}
+
+unsigned short CConfig::ReadnZone(string val_mesh_filename, unsigned short val_format) {
+
   int nZone = 1; /* Default value if nothing is specified. */
 
   switch (val_format) {
@@ -649,7 +677,7 @@ unsigned short CConfig::GetnZone(string val_mesh_filename, unsigned short val_fo
 
 }
 
-unsigned short CConfig::GetnDim(string val_mesh_filename, unsigned short val_format) {
+unsigned short CConfig::ReadnDim(string val_mesh_filename, unsigned short val_format) {
 
   short nDim = -1;
 
@@ -745,6 +773,23 @@ unsigned short CConfig::GetnDim(string val_mesh_filename, unsigned short val_for
 
       break;
     }
+    case SU2_BINARY: {
+
+      /*--- The dimension is the second value of the header. ---*/
+      uint64_t header[2] = {0, 0};
+      FILE *mesh_file = fopen(val_mesh_filename.c_str(), "rb");
+      if (!mesh_file) {
+        SU2_MPI::Error(string("The binary SU2 mesh file named ") + val_mesh_filename + string(" was not found."), CURRENT_FUNCTION);
+      }
+      size_t ret = fread(header, sizeof(uint64_t), 2, mesh_file);
+      fclose(mesh_file);
+
+      if ((ret != 2) || (header[0] != SU2_BINARY_MESH_ID)) {
+        SU2_MPI::Error(val_mesh_filename + string(" is not a binary SU2 mesh file. Please check."), CURRENT_FUNCTION);
+      }
+      nDim = header[1];
+      break;
+    }
     case RECTANGLE: {
       nDim = 2;
       break;
@@ -812,13 +857,14 @@ void CConfig::SetPointersNull(void) {
   Marker_CfgFile_KindBC       = NULL;    Marker_All_SendRecv     = NULL;    Marker_All_PerBound   = NULL;
   Marker_ZoneInterface        = NULL;    Marker_All_ZoneInterface= NULL;    Marker_Riemann        = NULL;
   Marker_Fluid_InterfaceBound = NULL;    Marker_CHTInterface     = NULL;    Marker_Damper         = NULL;
-  Marker_Emissivity           = NULL;
+  Marker_Emissivity           = NULL;    Marker_PartitionWeight  = NULL;
 
     /*--- Boundary Condition settings ---*/
 
   Isothermal_Temperature = NULL;
   Heat_Flux              = NULL;    Displ_Value            = NULL;    Load_Value      = NULL;
   FlowLoad_Value         = NULL;    Damper_Constant        = NULL;    Wall_Emissivity = NULL;
+  PartitionWeight        = NULL;
 
   /*--- Inlet Outlet Boundary Condition settings ---*/
 
@@ -899,6 +945,9 @@ void CConfig::SetPointersNull(void) {
 
   RefOriginMoment     = NULL;
   CFL_AdaptParam      = NULL;
+  Linear_Solver_Adaptive_Param = NULL;
+  LimiterFreezeParam  = NULL;
+  ActiveSetParam      = NULL;
   CFL                 = NULL;
   HTP_Axis = NULL;
   PlaneTag            = NULL;
@@ -919,6 +968,9 @@ void CConfig::SetPointersNull(void) {
   RK_Alpha_Step             = NULL;
   MG_CorrecSmooth           = NULL;
   MG_PreSmooth              = NULL;
+  MG_Linear_Solver_Iter     = NULL;
+  MG_Linear_Solver_Error    = NULL;
+  MG_Linear_Solver_Prec     = NULL;
   MG_PostSmooth             = NULL;
   Int_Coeffs                = NULL;
 
@@ -1014,6 +1066,14 @@ void CConfig::SetPointersNull(void) {
   HistoryOutput = NULL;
   VolumeOutput = NULL;
   VolumeOutputFiles = NULL;
+  Restart_Lossy_Fields = NULL;
+  Solution_Iter_List = NULL;
+  Solution_Iter_Range = NULL;
+  Output_Probes = NULL;
+  Output_Probe_Planes = NULL;
+  Output_Probe_Boxes = NULL;
+  Marker_Surface_Sampling = NULL;
+  Surface_Sampling_Fields = NULL;
   ConvField = NULL;
 
   /*--- Variable initialization ---*/
@@ -1172,6 +1232,21 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Critical Density, default value for MDM */
    addDoubleOption("ACENTRIC_FACTOR", Acentric_Factor, 0.035);
 
+  /*--- Options related to the TABULATED_GAS model ---*/
+  /*!\brief TABULATED_FLUID_MODEL \n DESCRIPTION: Fluid model from which the table is generated \n OPTIONS: STANDARD_AIR, IDEAL_GAS, VW_GAS, PR_GAS \n DEFAULT: PR_GAS \ingroup Config*/
+  addEnumOption("TABULATED_FLUID_MODEL", Kind_TabulatedFluidModel, FluidModel_Map, PR_GAS);
+  /* DESCRIPTION: Number of nodes of the table in the density direction */
+  addUnsignedShortOption("TABULATED_GAS_DENSITY_NODES", TabulatedGas_Size[0], 256);
+  /* DESCRIPTION: Number of nodes of the table in the static energy direction */
+  addUnsignedShortOption("TABULATED_GAS_ENERGY_NODES", TabulatedGas_Size[1], 256);
+  default_tabulated_range[0] = 0.0; default_tabulated_range[1] = 0.0;
+  /* DESCRIPTION: Density range of the table (min, max), (0.0, 0.0) for automatic */
+  addDoubleArrayOption("TABULATED_GAS_DENSITY_RANGE", 2, TabulatedGas_DensityRange, default_tabulated_range);
+  /* DESCRIPTION: Static energy range of the table (min, max), (0.0, 0.0) for automatic */
+  addDoubleArrayOption("TABULATED_GAS_ENERGY_RANGE", 2, TabulatedGas_EnergyRange, default_tabulated_range);
+  /* DESCRIPTION: File of the table, read if it exists, otherwise the generated table is written to it */
+  addStringOption("TABULATED_GAS_FILENAME", TabulatedGas_FileName, string(""));
+
    /*--- Options related to Viscosity Model ---*/
   /*!\brief VISCOSITY_MODEL \n DESCRIPTION: model of the viscosity \n OPTIONS: See \link ViscosityModel_Map \endlink \n DEFAULT: SUTHERLAND \ingroup Config*/
   addEnumOption("VISCOSITY_MODEL", Kind_ViscosityModel, ViscosityModel_Map, SUTHERLAND);
@@ -1313,6 +1388,12 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("DCM_DIH", dCM_diH, 0.05);
   /* DESCRIPTION: Maximum number of iterations between AoA updates for fixed CL problem. */
   addUnsignedLongOption("UPDATE_AOA_ITER_LIMIT", Update_AoA_Iter_Limit, 200);
+  /* DESCRIPTION: Newton updates of the AoA with a secant estimate of dCL/dAlpha for fixed CL mode. */
+  addBoolOption("FIXED_CL_NEWTON", Fixed_CL_Newton, false);
+  /* DESCRIPTION: Number of iterations between Newton updates of the AoA for fixed CL mode. */
+  addUnsignedLongOption("FIXED_CL_NEWTON_ITER", Fixed_CL_Newton_Iter, 50);
+  /* DESCRIPTION: Number of iterations over which each Newton update of the AoA is applied. */
+  addUnsignedLongOption("FIXED_CL_AOA_RAMP", Fixed_CL_AoA_Ramp, 10);
   /* DESCRIPTION: Number of times Alpha is updated in a fix CL problem. */
   addUnsignedLongOption("UPDATE_IH", Update_iH, 5);
   /* DESCRIPTION: Number of iterations to evaluate dCL_dAlpha . */
@@ -1402,6 +1483,10 @@ void CConfig::SetConfig_Options() {
   addWallFunctionOption("MARKER_WALL_FUNCTIONS", nMarker_WallFunctions, Marker_WallFunctions,
                         Kind_WallFunctions, IntInfo_WallFunctions, DoubleInfo_WallFunctions);
 
+  /*!\brief WALL_MODEL_FREEZE_STAGES\n DESCRIPTION: Number of consecutive residual evaluations (RK stages) for which
+   the wall model data of the FEM solver is reused, 1 means that the wall model is evaluated every time. \ingroup Config*/
+  addUnsignedShortOption("WALL_MODEL_FREEZE_STAGES", WallModel_FreezeStages, 1);
+
   /*!\brief ACTDISK_TYPE  \n DESCRIPTION: Actuator Disk boundary type \n OPTIONS: see \link ActDisk_Map \endlink \n Default: VARIABLES_JUMP \ingroup Config*/
   addEnumOption("ACTDISK_TYPE", Kind_ActDisk, ActDisk_Map, VARIABLES_JUMP);
 
@@ -1610,6 +1695,10 @@ void CConfig::SetConfig_Options() {
   // these options share nRKStep as their size, which is not a good idea in general
   /* DESCRIPTION: Runge-Kutta alpha coefficients */
   addDoubleListOption("RK_ALPHA_COEFF", nRKStep, RK_Alpha_Step);
+  /* DESCRIPTION: Number of Jacobi sweeps of the implicit residual smoothing of the explicit schemes (0 to disable) */
+  addUnsignedShortOption("RES_SMOOTHING_ITER", ResSmoothing_Iter, 0);
+  /* DESCRIPTION: Coefficient of the implicit residual smoothing of the explicit schemes */
+  addDoubleOption("RES_SMOOTHING_COEFF", ResSmoothing_Coeff, 0.5);
   /* DESCRIPTION: Number of time levels for time accurate local time stepping. */
   addUnsignedShortOption("LEVELS_TIME_ACCURATE_LTS", nLevels_TimeAccurateLTS, 1);
   /* DESCRIPTION: Number of time DOFs used in the predictor step of ADER-DG. */
@@ -1624,6 +1713,16 @@ void CConfig::SetConfig_Options() {
   addBoolOption("HB_PRECONDITION", HB_Precondition, false);
   /* DESCRIPTION: Iteration number to begin unsteady restarts (dual time method) */
   addLongOption("UNST_RESTART_ITER", Unst_RestartIter, 0);
+  /* DESCRIPTION: Order of the extrapolation of the flow solution used as initial guess of each physical time step (dual time method) */
+  addUnsignedShortOption("TIME_PREDICTOR_ORDER", TimePredictor_Order, 1);
+  /* DESCRIPTION: Store the extra time level of the quadratic predictor in single precision */
+  addBoolOption("TIME_PREDICTOR_LOWPREC", TimePredictor_LowPrec, false);
+  /* DESCRIPTION: Number of checkpoints of the primal solution for the unsteady discrete adjoint (0 reads the restart files) */
+  addUnsignedShortOption("DISCADJ_CHECKPOINTS", DiscAdj_Checkpoints, 0);
+  /* DESCRIPTION: Number of those checkpoints written to disk */
+  addUnsignedShortOption("DISCADJ_CHECKPOINTS_DISK", DiscAdj_Checkpoints_Disk, 0);
+  /* DESCRIPTION: Folder of the checkpoints written to disk */
+  addStringOption("DISCADJ_CHECKPOINTS_FOLDER", DiscAdj_Checkpoints_Folder, string("."));
   /* DESCRIPTION: Starting direct solver iteration for the unsteady adjoint */
   addLongOption("UNST_ADJOINT_ITER", Unst_AdjointIter, 0);
   /* DESCRIPTION: Number of iterations to average the objective */
@@ -1636,6 +1735,8 @@ void CConfig::SetConfig_Options() {
   addEnumOption("TIME_DISCRE_FEM_FLOW", Kind_TimeIntScheme_FEM_Flow, Time_Int_Map, RUNGE_KUTTA_EXPLICIT);
   /* DESCRIPTION: ADER-DG predictor step */
   addEnumOption("ADER_PREDICTOR", Kind_ADER_Predictor, Ader_Predictor_Map, ADER_ALIASED_PREDICTOR);
+  /* DESCRIPTION: Store the ADER-DG predictor solution in single precision to reduce the memory footprint */
+  addBoolOption("ADER_PREDICTOR_SINGLE_PRECISION", ADER_Predictor_SinglePrecision, false);
   /* DESCRIPTION: Time discretization */
   addEnumOption("TIME_DISCRE_ADJFLOW", Kind_TimeIntScheme_AdjFlow, Time_Int_Map, EULER_IMPLICIT);
   /* DESCRIPTION: Time discretization */
@@ -1666,16 +1767,56 @@ void CConfig::SetConfig_Options() {
   addUnsignedLongOption("LINEAR_SOLVER_ITER", Linear_Solver_Iter, 10);
   /* DESCRIPTION: Fill in level for the ILU preconditioner */
   addUnsignedShortOption("LINEAR_SOLVER_ILU_FILL_IN", Linear_Solver_ILU_n, 0);
+  /* DESCRIPTION: Degree of the polynomial preconditioners (NEUMANN, CHEBYSHEV), i.e. matrix-vector products per application */
+  addUnsignedShortOption("LINEAR_SOLVER_PREC_DEGREE", Linear_Solver_Prec_Degree, 3);
   /* DESCRIPTION: Maximum number of iterations of the linear solver for the implicit formulation */
   addUnsignedLongOption("LINEAR_SOLVER_RESTART_FREQUENCY", Linear_Solver_Restart_Frequency, 10);
   /* DESCRIPTION: Relaxation factor for iterative linear smoothers (SMOOTHER_ILU/JACOBI/LU-SGS/LINELET) */
   addDoubleOption("LINEAR_SOLVER_SMOOTHER_RELAXATION", Linear_Solver_Smoother_Relaxation, 1.0);
   /* DESCRIPTION: Custom number of threads used for additive domain decomposition for ILU and LU_SGS (0 is "auto"). */
   addUnsignedLongOption("LINEAR_SOLVER_PREC_THREADS", Linear_Solver_Prec_Threads, 0);
+  /* DESCRIPTION: Thread-parallelize ILU by level scheduling (same factorization for any number of threads). */
+  addBoolOption("LINEAR_SOLVER_ILU_LEVEL_SCHEDULING", Linear_Solver_ILU_LevelSched, false);
+  /* DESCRIPTION: Solve the linear systems on the offload device, FGMRES with JACOBI preconditioning (requires the offload build). */
+  addBoolOption("LINEAR_SOLVER_DEVICE", Linear_Solver_Device, false);
+  /* DESCRIPTION: Maximum number of consecutive linear solves that reuse the preconditioner (0 means it is always rebuilt). */
+  addUnsignedLongOption("LINEAR_SOLVER_PREC_REUSE", Linear_Solver_Prec_Reuse, 0);
+  /* DESCRIPTION: The preconditioner is rebuilt when the linear iterations grow by this factor relative to the last build. */
+  addDoubleOption("LINEAR_SOLVER_PREC_REUSE_GROWTH", Linear_Solver_Prec_Reuse_Growth, 1.5);
+  /* DESCRIPTION: Adapt the tolerance of the linear solver to the convergence of the nonlinear residual (Eisenstat-Walker). */
+  addBoolOption("LINEAR_SOLVER_ADAPTIVE_ERROR", Linear_Solver_Adaptive_Error, false);
+  /* DESCRIPTION: Parameters of the adaptive tolerance (gamma, alpha, min and max tolerance),
+   * tolerance = gamma * (residual / previous residual)^alpha. */
+  default_linsol_adapt[0] = 0.9; default_linsol_adapt[1] = 2.0; default_linsol_adapt[2] = 1E-4; default_linsol_adapt[3] = 0.1;
+  addDoubleArrayOption("LINEAR_SOLVER_ADAPTIVE_PARAM", 4, Linear_Solver_Adaptive_Param, default_linsol_adapt);
+  /* DESCRIPTION: Only store the diagonal blocks of the finite volume Jacobians (point implicit method). */
+  addBoolOption("JACOBIAN_DIAGONAL_ONLY", Jacobian_DiagonalOnly, false);
+  /* DESCRIPTION: Only store the diagonal blocks of the Jacobians of the coarse multigrid levels. */
+  addBoolOption("MG_JACOBIAN_DIAGONAL_ONLY", MG_Jacobian_DiagonalOnly, false);
+  /* DESCRIPTION: Maximum number of iterations of the linear solver of each coarse multigrid level. */
+  addUShortListOption("MG_LINEAR_SOLVER_ITER", nMG_Linear_Solver_Iter, MG_Linear_Solver_Iter);
+  /* DESCRIPTION: Minimum error threshold of the linear solver of each coarse multigrid level. */
+  addDoubleListOption("MG_LINEAR_SOLVER_ERROR", nMG_Linear_Solver_Error, MG_Linear_Solver_Error);
+  /* DESCRIPTION: Preconditioner of the linear solver of each coarse multigrid level. */
+  addEnumListOption("MG_LINEAR_SOLVER_PREC", nMG_Linear_Solver_Prec, MG_Linear_Solver_Prec, Linear_Solver_Prec_Map);
+  /* DESCRIPTION: Size of the subspace recycled across linear solves by the GCRO_DR linear solver. */
+  addUnsignedLongOption("LINEAR_SOLVER_RECYCLE_SIZE", Linear_Solver_Recycle_Size, 5);
+  /* DESCRIPTION: Matrix-free Newton-Krylov method for the flow equations, the assembled Jacobian is used as preconditioner. */
+  addBoolOption("NEWTON_KRYLOV", NewtonKrylov, false);
+  /* DESCRIPTION: Number of quasi-Newton iterations (standard implicit method) before starting the Newton-Krylov method. */
+  addUnsignedLongOption("NEWTON_KRYLOV_STARTUP_ITER", NewtonKrylov_StartupIter, 100);
+  /* DESCRIPTION: Relative step of the finite differences used to approximate the Jacobian-vector products. */
+  addDoubleOption("NEWTON_KRYLOV_FD_STEP", NewtonKrylov_FinDiffStep, 1e-7);
+  /* DESCRIPTION: Compute the Jacobian of the Newton-Krylov method by colored forward AD sweeps of the residual (SU2_CFD_DIRECTDIFF). */
+  addBoolOption("NEWTON_KRYLOV_AD_JACOBIAN", NewtonKrylov_ADJacobian, false);
+  /* DESCRIPTION: Solve the mean flow and turbulence equations as one implicit block system (compressible RANS). */
+  addBoolOption("COUPLED_TURBULENCE", CoupledTurbulence, false);
   /* DESCRIPTION: Relaxation of the flow equations solver for the implicit formulation */
   addDoubleOption("RELAXATION_FACTOR_ADJFLOW", Relaxation_Factor_AdjFlow, 1.0);
   /* DESCRIPTION: Relaxation of the CHT coupling */
   addDoubleOption("RELAXATION_FACTOR_CHT", Relaxation_Factor_CHT, 1.0);
+  /* DESCRIPTION: Relax the CHT coupling with Aitken's dynamic factor (RELAXATION_FACTOR_CHT is the initial value) */
+  addBoolOption("CHT_AITKEN_RELAXATION", CHT_AitkenRelaxation, false);
   /* DESCRIPTION: Roe coefficient */
   addDoubleOption("ROE_KAPPA", Roe_Kappa, 0.5);
   /* DESCRIPTION: Roe-Turkel preconditioning for low Mach number flows */
@@ -1700,6 +1841,18 @@ void CConfig::SetConfig_Options() {
   addEnumOption("DISCADJ_LIN_SOLVER", Kind_DiscAdj_Linear_Solver, Linear_Solver_Map, FGMRES);
   /* DESCRIPTION: Preconditioner for the discrete adjoint Krylov linear solvers */
   addEnumOption("DISCADJ_LIN_PREC", Kind_DiscAdj_Linear_Prec, Linear_Solver_Prec_Map, ILU);
+  /* DESCRIPTION: Accelerate the fixed-point iterations of the discrete adjoint with FGMRES on the tape */
+  addBoolOption("DISCADJ_KRYLOV", DiscAdj_Krylov, false);
+  /* DESCRIPTION: Krylov subspace size (tape evaluations) per discrete adjoint iteration */
+  addUnsignedShortOption("DISCADJ_KRYLOV_SIZE", DiscAdj_Krylov_Size, 10);
+  /* DESCRIPTION: Relative residual reduction of the Krylov cycle of each discrete adjoint iteration */
+  addDoubleOption("DISCADJ_KRYLOV_ERROR", DiscAdj_Krylov_Error, 0.1);
+  /* DESCRIPTION: Number of previous iterations of the quasi-Newton (Anderson) acceleration of the discrete adjoint and block Gauss-Seidel fixed points, 0 disables it */
+  addUnsignedShortOption("QUASI_NEWTON_NUM_SAMPLES", nQuasiNewtonSamples, 0);
+  /* DESCRIPTION: Converge the adjoint of each OBJECTIVE_FUNCTION separately, one direction of the vector reverse mode each */
+  addBoolOption("DISCADJ_SEPARATE_OBJECTIVES", DiscAdj_Separate_Objectives, false);
+  /* DESCRIPTION: Record the state and the geometric inputs on one tape, the sensitivities are then evaluated without a secondary recording */
+  addBoolOption("DISCADJ_COMBINED_RECORDING", DiscAdj_Combined_Recording, false);
   /* DESCRIPTION: Linear solver for the discete adjoint systems */
   addEnumOption("FSI_DISCADJ_LIN_SOLVER_STRUC", Kind_DiscAdj_Linear_Solver_FSI_Struc, Linear_Solver_Map, CONJUGATE_GRADIENT);
   /* DESCRIPTION: Preconditioner for the discrete adjoint Krylov linear solvers */
@@ -1752,6 +1905,16 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("MG_DAMP_RESTRICTION", Damp_Res_Restric, 0.75);
   /*!\brief MG_DAMP_PROLONGATION\n DESCRIPTION: Damping factor for the correction prolongation. DEFAULT 0.75 \ingroup Config*/
   addDoubleOption("MG_DAMP_PROLONGATION", Damp_Correc_Prolong, 0.75);
+  /*!\brief MG_TURBULENCE\n DESCRIPTION: Solve the turbulence equations (SA and SST) with the multigrid cycle,
+   *  instead of on the finest grid only. DEFAULT: NO \ingroup Config*/
+  addBoolOption("MG_TURBULENCE", MG_Turbulence, false);
+  /*!\brief MG_AGGLOMERATION\n DESCRIPTION: Agglomeration algorithm of the multigrid levels, COLORED agglomerates
+   *  colored groups of seeds in parallel (OpenMP) using only the direct neighbors of the seeds.
+   *  OPTIONS: See \link MG_Agglomeration_Map \endlink. DEFAULT: SEQUENTIAL \ingroup Config*/
+  addEnumOption("MG_AGGLOMERATION", Kind_MG_Agglomeration, MG_Agglomeration_Map, SEQUENTIAL_AGGLOMERATION);
+  /*!\brief MG_AGGLOMERATION_CACHE\n DESCRIPTION: Read the multigrid levels from (or write them to) per-rank cache files
+   *  named after PARTITION_CACHE_FILENAME. DEFAULT: NO \ingroup Config*/
+  addBoolOption("MG_AGGLOMERATION_CACHE", MG_Agglomeration_Cache, false);
 
   /*!\par CONFIG_CATEGORY: Spatial Discretization \ingroup Config*/
   /*--- Options related to the spatial discretization ---*/
@@ -1771,6 +1934,24 @@ void CConfig::SetConfig_Options() {
   /*!\brief LIMITER_ITER
    *  \n DESCRIPTION: Freeze the value of the limiter after a number of iterations. DEFAULT value 999999. \ingroup Config*/
   addUnsignedLongOption("LIMITER_ITER", LimiterIter, 999999);
+  /*!\brief LIMITER_FREEZE
+   *  \n DESCRIPTION: Freeze the limiter once the residual is below a threshold, and re-evaluate it
+   *  periodically or where the solution changes. DEFAULT value NO. \ingroup Config*/
+  addBoolOption("LIMITER_FREEZE", LimiterFreeze, false);
+  /*!\brief LIMITER_FREEZE_PARAM
+   *  \n DESCRIPTION: Parameters of the limiter freezing (log10 of the rms residual threshold, frequency of
+   *  the full re-evaluations, relative solution change tolerance for the partial re-evaluations). \ingroup Config*/
+  default_limiter_freeze[0] = -8.0; default_limiter_freeze[1] = 100.0; default_limiter_freeze[2] = 0.0;
+  addDoubleArrayOption("LIMITER_FREEZE_PARAM", 3, LimiterFreezeParam, default_limiter_freeze);
+  /*!\brief ACTIVE_SET
+   *  \n DESCRIPTION: Freeze the points whose residual stays low and skip the edges between frozen points,
+   *  all points are re-evaluated periodically (compressible steady flow). DEFAULT value NO. \ingroup Config*/
+  addBoolOption("ACTIVE_SET", ActiveSet, false);
+  /*!\brief ACTIVE_SET_PARAM
+   *  \n DESCRIPTION: Parameters of the active set (fraction of the global rms residual below which the residual
+   *  of a point is low, consecutive iterations with low residual before freezing, frequency of the full sweeps). \ingroup Config*/
+  default_active_set[0] = 0.01; default_active_set[1] = 10.0; default_active_set[2] = 50.0;
+  addDoubleArrayOption("ACTIVE_SET_PARAM", 3, ActiveSetParam, default_active_set);
 
   /*!\brief CONV_NUM_METHOD_FLOW
    *  \n DESCRIPTION: Convective numerical method \n OPTIONS: See \link Upwind_Map \endlink , \link Centered_Map \endlink. \ingroup Config*/
@@ -1920,6 +2101,25 @@ void CConfig::SetConfig_Options() {
   addEnumOption("ACTDISK_JUMP", ActDisk_Jump, Jump_Map, DIFFERENCE);
   /*!\brief MESH_FORMAT \n DESCRIPTION: Mesh input file format \n OPTIONS: see \link Input_Map \endlink \n DEFAULT: SU2 \ingroup Config*/
   addEnumOption("MESH_FORMAT", Mesh_FileFormat, Input_Map, SU2);
+  /*!\brief POINT_ORDERING \n DESCRIPTION: Renumbering of the points of each partition, for data locality \n OPTIONS: see \link Point_Ordering_Map \endlink \n DEFAULT: RCM \ingroup Config*/
+  addEnumOption("POINT_ORDERING", Kind_Point_Ordering, Point_Ordering_Map, RCM_ORDERING);
+  /*!\brief PARTITION_CACHE \n DESCRIPTION: Read the partitioned grid from per-rank cache files if they match the run, otherwise write them \n DEFAULT: NO \ingroup Config*/
+  addBoolOption("PARTITION_CACHE", Partition_Cache, false);
+  /*!\brief PARTITION_CACHE_FILENAME \n DESCRIPTION: Root name of the partition cache files \n DEFAULT: partition_cache \ingroup Config*/
+  addStringOption("PARTITION_CACHE_FILENAME", Partition_Cache_FileName, string("partition_cache"));
+  /*!\brief PARTITION_WEIGHTS \n DESCRIPTION: Vertex weights for the graph partitioning \n OPTIONS: see \link Partition_Weights_Map \endlink \n DEFAULT: NONE \ingroup Config*/
+  addEnumOption("PARTITION_WEIGHTS", Kind_Partition_Weights, Partition_Weights_Map, NO_PARTITION_WEIGHTS);
+  /*!\brief MARKER_PARTITION_WEIGHT \n DESCRIPTION: Additional work of the points of a marker relative to an interior point \n
+   * Format: ( marker, weight of the marker, ... ) \ingroup Config */
+  addStringDoubleListOption("MARKER_PARTITION_WEIGHT", nMarker_PartitionWeight, Marker_PartitionWeight, PartitionWeight);
+  /*!\brief LOAD_BALANCING_FREQ \n DESCRIPTION: Number of time steps between the checks of the computation time of the ranks, which repartition the grid when it is imbalanced (0 never checks) \n DEFAULT: 0 \ingroup Config*/
+  addUnsignedLongOption("LOAD_BALANCING_FREQ", LoadBalancing_Freq, 0);
+  /*!\brief LOAD_BALANCING_TOL \n DESCRIPTION: Ratio of the maximum to the average computation time of the ranks above which the grid is repartitioned \n DEFAULT: 1.1 \ingroup Config*/
+  addDoubleOption("LOAD_BALANCING_TOL", LoadBalancing_Tol, 1.1);
+  /*!\brief WALL_DISTANCE_ADT \n DESCRIPTION: Search tree for the wall distance, replicated on every rank or distributed \n OPTIONS: see \link Wall_Distance_ADT_Map \endlink \n DEFAULT: DISTRIBUTED \ingroup Config*/
+  addEnumOption("WALL_DISTANCE_ADT", Kind_WallDistance_ADT, Wall_Distance_ADT_Map, DISTRIBUTED_WALL_ADT);
+  /*!\brief WALL_DISTANCE_UPDATE_TOL \n DESCRIPTION: Bound of the relative change of the wall distance of a point of a moving grid below which it is not recomputed \n DEFAULT: 0.0 (exact) \ingroup Config*/
+  addDoubleOption("WALL_DISTANCE_UPDATE_TOL", WallDistance_UpdateTol, 0.0);
   /* DESCRIPTION:  Mesh input file */
   addStringOption("MESH_FILENAME", Mesh_FileName, string("mesh.su2"));
   /*!\brief MESH_OUT_FILENAME \n DESCRIPTION: Mesh output file name. Used when converting, scaling, or deforming a mesh. \n DEFAULT: mesh_out.su2 \ingroup Config*/
@@ -1936,6 +2136,13 @@ void CConfig::SetConfig_Options() {
   array<su2double, 3> default_mesh_box_offset = {{0.0, 0.0, 0.0}};
   addDoubleArrayOption("MESH_BOX_OFFSET", 3, Mesh_Box_Offset, default_mesh_box_offset.data());
 
+  /* DESCRIPTION: List of the clustering factors of the RECTANGLE or BOX grid towards the minimum x,y,z (tanh stretching, 0.0 is uniform). (default: (0.0,0.0,0.0) ). */
+  array<su2double, 3> default_mesh_box_clustering = {{0.0, 0.0, 0.0}};
+  addDoubleArrayOption("MESH_BOX_CLUSTERING", 3, Mesh_Box_Clustering, default_mesh_box_clustering.data());
+
+  /* DESCRIPTION: Type of elements of the RECTANGLE or BOX grid (HEXAHEDRA, PRISMS, TETRAHEDRA), the last two give triangles in 2D. (default: HEXAHEDRA ). */
+  addEnumOption("MESH_BOX_ELEMENTS", Kind_Mesh_Box_Elements, Box_Elements_Map, BOX_HEXAHEDRA);
+
   /* DESCRIPTION: Determine if the mesh file supports multizone. \n DEFAULT: true (temporarily) */
   addBoolOption("MULTIZONE_MESH", Multizone_Mesh, true);
   /* DESCRIPTION: Determine if we need to allocate memory to store the multizone residual. \n DEFAULT: true (temporarily) */
@@ -1943,12 +2150,22 @@ void CConfig::SetConfig_Options() {
 
   /*!\brief CONV_FILENAME \n DESCRIPTION: Output file convergence history (w/o extension) \n DEFAULT: history \ingroup Config*/
   addStringOption("CONV_FILENAME", Conv_FileName, string("history"));
+  /* DESCRIPTION: ADIOS2 engine of the in-situ output streams (ADIOS2 and SURFACE_ADIOS2 in OUTPUT_FILES) \ingroup Config*/
+  addStringOption("ADIOS2_ENGINE", ADIOS2_Engine, string("SST"));
+  /* DESCRIPTION: ADIOS2 XML runtime configuration file of the in-situ output streams, none if empty \ingroup Config*/
+  addStringOption("ADIOS2_CONFIG_FILENAME", ADIOS2_Config_FileName, string(""));
   /*!\brief BREAKDOWN_FILENAME \n DESCRIPTION: Output file forces breakdown \ingroup Config*/
   addStringOption("BREAKDOWN_FILENAME", Breakdown_FileName, string("forces_breakdown.dat"));
   /*!\brief SOLUTION_FLOW_FILENAME \n DESCRIPTION: Restart flow input file (the file output under the filename set by RESTART_FLOW_FILENAME) \n DEFAULT: solution_flow.dat \ingroup Config */
   addStringOption("SOLUTION_FILENAME", Solution_FileName, string("solution.dat"));
+  /*!\brief SOLUTION_DONOR_MESH_FILENAME \n DESCRIPTION: Grid of the restart flow input file when it differs from MESH_FILENAME, the solution is interpolated (none by default) \ingroup Config*/
+  addStringOption("SOLUTION_DONOR_MESH_FILENAME", Solution_Donor_Mesh_FileName, string(""));
   /*!\brief SOLUTION_ADJ_FILENAME\n DESCRIPTION: Restart adjoint input file. Objective function abbreviation is expected. \ingroup Config*/
   addStringOption("SOLUTION_ADJ_FILENAME", Solution_AdjFileName, string("solution_adj.dat"));
+  /*!\brief SOLUTION_ITER_LIST\n DESCRIPTION: Time iterations of the restart files converted in one run of SU2_SOL (batch mode). \ingroup Config*/
+  addULongListOption("SOLUTION_ITER_LIST", nSolution_Iter_List, Solution_Iter_List);
+  /*!\brief SOLUTION_ITER_RANGE\n DESCRIPTION: First and last time iteration, and stride, of the restart files converted in one run of SU2_SOL (batch mode). \ingroup Config*/
+  addULongListOption("SOLUTION_ITER_RANGE", nSolution_Iter_Range, Solution_Iter_Range);
   /*!\brief RESTART_FLOW_FILENAME \n DESCRIPTION: Output file restart flow \ingroup Config*/
   addStringOption("RESTART_FILENAME", Restart_FileName, string("restart.dat"));
   /*!\brief RESTART_ADJ_FILENAME  \n DESCRIPTION: Output file restart adjoint. Objective function abbreviation will be appended. \ingroup Config*/
@@ -2019,10 +2236,29 @@ void CConfig::SetConfig_Options() {
   addBoolOption("WRT_HALO", Wrt_Halo, false);
   /* DESCRIPTION: Output the performance summary to the console at the end of SU2_CFD  \ingroup Config*/
   addBoolOption("WRT_PERFORMANCE", Wrt_Performance, false);
-  /* DESCRIPTION: Output the tape statistics (discrete adjoint)  \ingroup Config*/
+  /* DESCRIPTION: Sort and write the volume output files on a helper thread while the solver continues, requires
+   * MPI_THREAD_MULTIPLE in parallel (--thread_multiple) and is not available for the discrete adjoint  \ingroup Config*/
+  addBoolOption("WRT_ASYNC_OUTPUT", Wrt_Async_Output, false);
+  /* DESCRIPTION: Write a restart just before the walltime limit, and when the process receives SIGUSR1 or SIGTERM  \ingroup Config*/
+  addBoolOption("WALLTIME_CHECKPOINT", WallTime_Checkpoint, false);
+  /* DESCRIPTION: Walltime limit of the run in seconds, 0 uses the end time of the job given by the scheduler (SLURM_JOB_END_TIME)  \ingroup Config*/
+  addDoubleOption("WALLTIME_LIMIT", WallTime_Limit, 0.0);
+  /* DESCRIPTION: Time in seconds before the walltime limit by which the restart must be written  \ingroup Config*/
+  addDoubleOption("WALLTIME_MARGIN", WallTime_Margin, 60.0);
+  /* DESCRIPTION: Deflate level (0-9) of the chunked datasets of the HDF5 output files, 0 writes them uncompressed  \ingroup Config*/
+  addUnsignedShortOption("HDF5_COMPRESSION_LEVEL", HDF5_Compression, 0);
+  /* DESCRIPTION: Compression of the binary restart files (NONE, LOSSLESS, LOSSY), LOSSY only applies to RESTART_LOSSY_FIELDS  \ingroup Config*/
+  addEnumOption("RESTART_COMPRESSION", Restart_Compression, Restart_Compression_Map, NO_COMPRESSION);
+  /* DESCRIPTION: Volume output groups or fields (not the coordinates or the solution) with lossy compression in the restart files  \ingroup Config*/
+  addStringListOption("RESTART_LOSSY_FIELDS", nRestart_Lossy_Fields, Restart_Lossy_Fields);
+  /* DESCRIPTION: Absolute error bound of the lossy compression of the restart files  \ingroup Config*/
+  addDoubleOption("RESTART_LOSSY_ERROR", Restart_Lossy_Error, 1e-6);
+  /* DESCRIPTION: Output the tape statistics, the tape size and time of each solver in the recording, and the statements recorded by each numerics kernel (discrete adjoint)  \ingroup Config*/
   addBoolOption("WRT_AD_STATISTICS", Wrt_AD_Statistics, false);
   /* DESCRIPTION: Write the mesh quality metrics to the visualization files.  \ingroup Config*/
   addBoolOption("WRT_MESH_QUALITY", Wrt_MeshQuality, false);
+  /* DESCRIPTION: Compute and print the mesh quality statistics of the dual control volumes (skipping them saves preprocessing time of large meshes).  \ingroup Config*/
+  addBoolOption("MESH_QUALITY_STATISTICS", MeshQuality_Statistics, true);
     /* DESCRIPTION: Output a 1D slice of a 2D cartesian solution \ingroup Config*/
   addBoolOption("WRT_SLICE", Wrt_Slice, false);
   /*!\brief MARKER_ANALYZE_AVERAGE
@@ -2033,6 +2269,10 @@ void CConfig::SetConfig_Options() {
   /*!\brief COMM_LEVEL
    *  \n DESCRIPTION: Level of MPI communications during runtime  \ingroup Config*/
   addEnumOption("COMM_LEVEL", Comm_Level, Comm_Map, COMM_FULL);
+  /*!\brief P2P_COMMS
+   *  \n DESCRIPTION: Implementation of the point-to-point (halo) MPI communications
+   *  \n OPTIONS: see \link P2P_Comms_Map \endlink \n DEFAULT: PERSISTENT \ingroup Config*/
+  addEnumOption("P2P_COMMS", Kind_P2P_Comms, P2P_Comms_Map, PERSISTENT_COMMS);
 
   /*!\par CONFIG_CATEGORY: Dynamic mesh definition \ingroup Config*/
   /*--- Options related to dynamic meshes ---*/
@@ -2096,6 +2336,10 @@ void CConfig::SetConfig_Options() {
   addBoolOption("SMOOTH_GEOMETRY", SmoothNumGrid, false);
   /* DESCRIPTION: Adapt the boundary elements */
   addBoolOption("ADAPT_BOUNDARY", AdaptBoundary, true);
+  /* DESCRIPTION: Refine the partitioned grid in parallel (SU2_MSH), the adapted grid is written in the binary format */
+  addBoolOption("PARALLEL_ADAPTATION", ParallelAdaptation, false);
+  /* DESCRIPTION: Number of cycles of solution and metric-based refinement of the grid in SU2_CFD, without files */
+  addUnsignedShortOption("ADAPT_CYCLES", nAdapt_Cycles, 0);
 
   /*!\par CONFIG_CATEGORY: Aeroelastic Simulation (Typical Section Model) \ingroup Config*/
   /*--- Options related to aeroelastic simulations using the Typical Section Model) ---*/
@@ -2189,6 +2433,8 @@ void CConfig::SetConfig_Options() {
   addDVParamOption("DV_PARAM", nDV, ParamDV, FFDTag, Design_Variable);
   /* DESCRIPTION: New value of the shape deformation */
   addDVValueOption("DV_VALUE", nDV_Value, DV_Value, nDV, ParamDV, Design_Variable);
+  /* DESCRIPTION: Deform the grid in memory by the design variables in SU2_CFD, before the solution. */
+  addBoolOption("DEFORM_DESIGN", Deform_Design, false);
   /* DESCRIPTION: Provide a file of surface positions from an external parameterization. */
   addStringOption("DV_FILENAME", DV_Filename, string("surface_positions.dat"));
   /* DESCRIPTION: File of sensitivities as an unordered ASCII file with rows of x, y, z, dJ/dx, dJ/dy, dJ/dz for each volume grid point. */
@@ -2222,6 +2468,14 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("DEFORM_LIMIT", Deform_Limit, 1E6);
   /* DESCRIPTION: Type of element stiffness imposed for FEA mesh deformation (INVERSE_VOLUME, WALL_DISTANCE, CONSTANT_STIFFNESS) */
   addEnumOption("DEFORM_STIFFNESS_TYPE", Deform_Stiffness_Type, Deform_Stiffness_Map, SOLID_WALL_DISTANCE);
+  /* DESCRIPTION: Method of the volume deformation (ELASTICITY, RBF) */
+  addEnumOption("DEFORM_METHOD", Kind_Deform_Method, Deform_Method_Map, ELASTICITY_DEFORMATION);
+  /* DESCRIPTION: Support radius of the RBF volume deformation, 0 means the size of the moving boundaries */
+  addDoubleOption("DEFORM_RBF_RADIUS", Deform_RBF_Radius, 0.0);
+  /* DESCRIPTION: Tolerance of the greedy point selection of the RBF deformation, relative to the maximum displacement */
+  addDoubleOption("DEFORM_RBF_GREEDY_TOL", Deform_RBF_Greedy_Tol, 1E-3);
+  /* DESCRIPTION: Maximum number of control points of the RBF volume deformation */
+  addUnsignedLongOption("DEFORM_RBF_MAX_POINTS", Deform_RBF_Max_Points, 2000);
   /* DESCRIPTION: Poisson's ratio for constant stiffness FEA method of grid deformation*/
   addDoubleOption("DEFORM_ELASTICITY_MODULUS", Deform_ElasticityMod, 2E11);
   /* DESCRIPTION: Young's modulus and Poisson's ratio for constant stiffness FEA method of grid deformation*/
@@ -2234,6 +2488,8 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("DEFORM_LINEAR_SOLVER_ERROR", Deform_Linear_Solver_Error, 1E-14);
   /* DESCRIPTION: Maximum number of iterations of the linear solver for the implicit formulation */
   addUnsignedLongOption("DEFORM_LINEAR_SOLVER_ITER", Deform_Linear_Solver_Iter, 1000);
+  /* DESCRIPTION: Assemble the stiffness matrix and build its preconditioner only for the first deformation */
+  addBoolOption("DEFORM_REUSE_STIFFNESS", Deform_Reuse_Stiffness, false);
 
   /*!\par CONFIG_CATEGORY: Rotorcraft problem \ingroup Config*/
   /*--- option related to rotorcraft problems ---*/
@@ -2262,6 +2518,14 @@ void CConfig::SetConfig_Options() {
   addBoolOption("USE_LUMPED_MASSMATRIX_DGFEM", Use_Lumped_MassMatrix_DGFEM, false);
   /* DESCRIPTION: Only compute the exact Jacobian of the spatial discretization (NO, YES) */
   addBoolOption("JACOBIAN_SPATIAL_DISCRETIZATION_ONLY", Jacobian_Spatial_Discretization_Only, false);
+  /* DESCRIPTION: Measure the cost of the DG elements, it is used for the partitioning when restarting (NO, YES) */
+  addBoolOption("MEASURE_ELEMENT_COST_DGFEM", Measure_ElemCost_DGFEM, false);
+  /* DESCRIPTION: File with the measured cost of the DG elements (fem_element_cost.dat by default) */
+  addStringOption("ELEMENT_COST_FILENAME_DGFEM", ElemCost_FileName_DGFEM, string("fem_element_cost.dat"));
+  /* DESCRIPTION: Number of iterations between the updates of the Jacobian of the implicit DG solver (1 by default) */
+  addUnsignedLongOption("JACOBIAN_FREQUENCY_DGFEM", Jacobian_Frequency_DGFEM, 1);
+  /* DESCRIPTION: Only keep the couplings within the elements in the Jacobian of the implicit DG solver (NO, YES) */
+  addBoolOption("ELEMENT_BLOCK_JACOBIAN_DGFEM", ElementBlock_Jacobian_DGFEM, false);
 
   /* DESCRIPTION: Number of aligned bytes for the matrix multiplications. Multiple of 64. (128 by default) */
   addUnsignedShortOption("ALIGNED_BYTES_MATMUL", byteAlignmentMatMul, 128);
@@ -2334,8 +2598,20 @@ void CConfig::SetConfig_Options() {
 
   /* DESCRIPTION: Iterative method for non-linear structural analysis */
   addEnumOption("NONLINEAR_FEM_SOLUTION_METHOD", Kind_SpaceIteScheme_FEA, Space_Ite_Map_FEA, NEWTON_RAPHSON);
+  /* DESCRIPTION: Recompute the frozen tangent of modified Newton and quasi-Newton every this many iterations (0 only on the first iteration of each time step) */
+  addUnsignedLongOption("FEA_TANGENT_UPDATE_ITER", FEA_Tangent_Update_Iter, 0);
+  /* DESCRIPTION: Recompute the frozen tangent when the norm of the residual decreases by less than this ratio between iterations (0 to disable) */
+  addDoubleOption("FEA_TANGENT_STALL_RATIO", FEA_Tangent_Stall_Ratio, 0.0);
+  /* DESCRIPTION: Number of BFGS updates kept by the quasi-Newton method */
+  addUnsignedShortOption("QUASI_NEWTON_MEMORY", QuasiNewton_Memory, 10);
+  /* DESCRIPTION: Line search of the quasi-Newton steps (secant on the projection of the residual on the step) */
+  addBoolOption("QUASI_NEWTON_LINE_SEARCH", QuasiNewton_LineSearch, true);
+  /* DESCRIPTION: Store the gradients of the shape functions wrt the reference coordinates, and the Jacobians, at the Gauss points of each element */
+  addBoolOption("FEA_GRADIENT_CACHE", FEA_GradientCache, false);
   /* DESCRIPTION: Number of internal iterations for Newton-Raphson Method in nonlinear structural applications */
   addUnsignedLongOption("NONLINEAR_FEM_INT_ITER", Dyn_nIntIter, 10);
+  /* DESCRIPTION: Apply the stiffness matrix element by element (matrix-free), only its diagonal blocks are stored */
+  addBoolOption("FEA_MATRIX_FREE", FEA_MatrixFree, false);
 
   /* DESCRIPTION: Formulation for bidimensional elasticity solver */
   addEnumOption("FORMULATION_ELASTICITY_2D", Kind_2DElasForm, ElasForm_2D, PLANE_STRAIN);
@@ -2481,6 +2757,9 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Radius for radial basis function */
   addDoubleOption("RADIAL_BASIS_FUNCTION_PARAMETER", RadialBasisFunction_Parameter, 1);
 
+  /* DESCRIPTION: Number of nearest donor points used to interpolate each target point, 0 means all donor points */
+  addUnsignedLongOption("RADIAL_BASIS_FUNCTION_PATCH_SIZE", RadialBasisFunction_PatchSize, 0);
+
    /*!\par INLETINTERPOLATION \n
    * DESCRIPTION: Type of spanwise interpolation to use for the inlet face. \n OPTIONS: see \link Inlet_SpanwiseInterpolation_Map \endlink
    * Sets Kind_InletInterpolation \ingroup Config
@@ -2507,6 +2786,10 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("AITKEN_DYN_MIN_INITIAL", AitkenDynMinInit, 0.5);
   /* DESCRIPTION: Kind of relaxation */
   addEnumOption("BGS_RELAXATION", Kind_BGS_RelaxMethod, AitkenForm_Map, NO_RELAXATION);
+  /* DESCRIPTION: Number of previous time steps whose IQN-ILS history is reused (0 keeps only the current time step) */
+  addUnsignedShortOption("IQN_REUSE_TIME_ITER", IQN_ReuseTimeIter, 0);
+  /* DESCRIPTION: Tolerance of the QR filter that discards linearly dependent IQN-ILS columns */
+  addDoubleOption("IQN_FILTER_TOL", IQN_FilterTol, 1e-6);
   /* DESCRIPTION: Relaxation required */
   addBoolOption("RELAXATION", Relaxation, false);
 
@@ -2609,6 +2892,10 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Free surface damping coefficient */
   addDoubleOption("FFD_TOLERANCE", FFD_Tol, 1E-10);
 
+  /* DESCRIPTION: Project the surface sensitivity (SU2_DOT, finite differences) onto the FFD design variables
+   with the sparse d(surface)/d(control points) matrix, instead of one surface deformation per variable */
+  addBoolOption("FFD_SPARSE_PROJECTION", FFD_Sparse_Projection, false);
+
   /* DESCRIPTION: Definition of the FFD boxes */
   addFFDDefOption("FFD_DEFINITION", nFFDBox, CoordFFDBox, TagFFDBox);
 
@@ -2630,6 +2917,8 @@ void CConfig::SetConfig_Options() {
 
   /* DESCRIPTION: Direct differentiation mode (forward) */
   addEnumOption("DIRECT_DIFF", DirectDiff, DirectDiff_Var_Map, NO_DERIVATIVE);
+  /* DESCRIPTION: Number of design variables differentiated per run, at most the number of directions SU2_CFD_DIRECTDIFF was compiled with (vector forward mode) */
+  addUnsignedShortOption("DIRECT_DIFF_DIRECTIONS", DirectDiff_Directions, 1);
 
   /* DESCRIPTION: Automatic differentiation mode (reverse) */
   addBoolOption("AUTO_DIFF", AD_Mode, NO);
@@ -2710,6 +2999,12 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Window (weight) function for the cost-functional in the reverse sweep */
   addEnumOption("WINDOW_FUNCTION", Kind_WindowFct,Window_Map, SQUARE);
 
+  /* DESCRIPTION: Windowed averages of the history outputs in constant memory, over the entire time domain */
+  addBoolOption("WINDOW_STREAMING", Window_Streaming, false);
+
+  /* DESCRIPTION: Number of time iterations between samples of the time averages (history and volume) */
+  addUnsignedLongOption("TIME_AVERAGE_FREQ", Time_Average_Freq, 1);
+
   /* DESCRIPTION: DES Constant */
   addDoubleOption("DES_CONST", Const_DES, 0.65);
 
@@ -2771,6 +3066,10 @@ void CConfig::SetConfig_Options() {
   addUnsignedLongOption("HISTORY_WRT_FREQ_OUTER", HistoryWrtFreq[1], 1);
   /* DESCRIPTION: History writing frequency (TIME_ITER) */
   addUnsignedLongOption("HISTORY_WRT_FREQ_TIME", HistoryWrtFreq[0], 1);
+  /* DESCRIPTION: Number of history file writes between flushes of the file */
+  addUnsignedLongOption("HISTORY_FLUSH_FREQ", HistoryFlushFreq, 1);
+  /* DESCRIPTION: Write the history file in binary format */
+  addBoolOption("WRT_HISTORY_BINARY", Wrt_History_Binary, false);
 
   /* DESCRIPTION: Screen writing frequency (INNER_ITER) */
   addUnsignedLongOption("SCREEN_WRT_FREQ_INNER", ScreenWrtFreq[2], 1);
@@ -2782,6 +3081,24 @@ void CConfig::SetConfig_Options() {
   addUnsignedLongOption("OUTPUT_WRT_FREQ", VolumeWrtFreq, 250);
   /* DESCRIPTION: Volume solution files */
   addEnumListOption("OUTPUT_FILES", nVolumeOutputFiles, VolumeOutputFiles, Output_Map);
+  /* DESCRIPTION: Output probes, coordinates (x, y, z) of each probe where the volume output is interpolated */
+  addDoubleListOption("OUTPUT_PROBES", nOutput_Probes, Output_Probes);
+  /* DESCRIPTION: Output probe planes, regular grids of probes (x0, y0, z0, ux, uy, uz, vx, vy, vz, nu, nv) */
+  addDoubleListOption("OUTPUT_PROBE_PLANES", nOutput_Probe_Planes, Output_Probe_Planes);
+  /* DESCRIPTION: Output boxes, bounds (xmin, ymin, zmin, xmax, ymax, zmax) of the regions whose grid points are written */
+  addDoubleListOption("OUTPUT_PROBE_BOXES", nOutput_Probe_Boxes, Output_Probe_Boxes);
+  /* DESCRIPTION: Writing frequency of the output probes and boxes */
+  addUnsignedLongOption("OUTPUT_PROBE_FREQ", Output_Probe_Freq, 1);
+  /* DESCRIPTION: Base name of the files of the output probes and boxes */
+  addStringOption("OUTPUT_PROBE_FILENAME", Output_Probe_FileName, string("probes"));
+  /* DESCRIPTION: Markers whose points are streamed to the surface sampling file */
+  addStringListOption("MARKER_SURFACE_SAMPLING", nMarker_Surface_Sampling, Marker_Surface_Sampling);
+  /* DESCRIPTION: Volume output groups or fields of the surface sampling (all the volume output fields by default) */
+  addStringListOption("SURFACE_SAMPLING_FIELDS", nSurface_Sampling_Fields, Surface_Sampling_Fields);
+  /* DESCRIPTION: Writing frequency of the surface sampling */
+  addUnsignedLongOption("SURFACE_SAMPLING_FREQ", Surface_Sampling_Freq, 1);
+  /* DESCRIPTION: Name of the surface sampling file */
+  addStringOption("SURFACE_SAMPLING_FILENAME", Surface_Sampling_FileName, string("surface_sampling"));
 
   /* DESCRIPTION: Using Uncertainty Quantification with SST Turbulence Model */
   addBoolOption("USING_UQ", using_uq, false);
@@ -2798,9 +3115,15 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Permuting eigenvectors for UQ analysis */
   addBoolOption("UQ_PERMUTE", uq_permute, false);
 
+  /* DESCRIPTION: Solve the five eigenspace perturbations of the UQ study at once, as instances sharing the geometry */
+  addBoolOption("UQ_ENSEMBLE", uq_ensemble, false);
+
   /* DESCRIPTION: Number of calls to 'Build' that trigger re-factorization (0 means only once). */
   addUnsignedLongOption("PASTIX_FACTORIZATION_FREQUENCY", pastix_fact_freq, 1);
 
+  /* DESCRIPTION: Number of time steps that reuse the factorization, e.g. ILU(k), (0 means PASTIX_FACTORIZATION_FREQUENCY). */
+  addUnsignedLongOption("PASTIX_FACTORIZATION_TIME_FREQUENCY", pastix_fact_time_freq, 0);
+
   /* DESCRIPTION: 0 - Quiet, 1 - During factorization and cleanup, 2 - Even more detail. */
   addUnsignedShortOption("PASTIX_VERBOSITY_LEVEL", pastix_verb_lvl, 0);
 
@@ -2810,20 +3133,125 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Size of the edge groups colored for thread parallel edge loops (0 forces the reducer strategy). */
   addUnsignedLongOption("EDGE_COLORING_GROUP_SIZE", edgeColorGroupSize, 512);
 
+  /* DESCRIPTION: Choose the size of the edge groups per rank with a quick benchmark of a few sizes (EDGE_COLORING_GROUP_SIZE is the fallback). */
+  addBoolOption("EDGE_COLORING_AUTOTUNE", edgeColorAutoTune, false);
+
+  /* DESCRIPTION: Compute the centered and first order upwind fluxes with the owner-computes strategy, each point computes the fluxes of all its edges. */
+  addBoolOption("EDGE_OWNER_COMPUTES", edgeOwnerComputes, false);
+
+  /* DESCRIPTION: Compute the upwind fluxes (ROE, HLLC) in batches of edges with vectorized kernels (ideal gas, static grids). */
+  addBoolOption("EDGE_BATCHED_NUMERICS", edgeBatchedNumerics, false);
+
+  /* DESCRIPTION: Compute the source terms of the turbulence models in batches of points with vectorized kernels. */
+  addBoolOption("BATCHED_TURB_SOURCES", batchedTurbSources, false);
+
+  /* DESCRIPTION: Store the geometric factors of the edges (edge vector, length, area) used by the viscous numerics and MUSCL reconstruction. */
+  addBoolOption("EDGE_GEOMETRY_CACHE", edgeGeometryCache, false);
+
+  /* DESCRIPTION: Allocate the containers of the compressible flow variables (limiters, sensors, truncation error, etc.) only for the features that use them. */
+  addBoolOption("LEAN_VARIABLE_STORAGE", leanVariableStorage, false);
+
+  /* DESCRIPTION: Report the memory used by each container of the compressible flow variables at startup. */
+  addBoolOption("VARIABLE_MEMORY_REPORT", variableMemoryReport, false);
+
+  /* DESCRIPTION: Report the memory by category (geometry, variables, Jacobian, etc.) at the end of the preprocessing and of the run. */
+  addBoolOption("MEMORY_REPORT", memoryReport, false);
+
+  /* DESCRIPTION: Report the wall time (min/avg/max over the ranks) and memory high-water mark of the phases of the preprocessing. */
+  addBoolOption("PREPROCESSING_TIMING_REPORT", preprocessingTimingReport, false);
+
+  /* DESCRIPTION: Time the main regions of the iterations (residuals, BCs, linear solver, comms, output) and write them per rank at the end. */
+  addBoolOption("REGION_PROFILING", regionProfiling, false);
+  /* DESCRIPTION: Base name of the per rank files of the region profiling. */
+  addStringOption("REGION_PROFILING_FILENAME", regionProfilingFileName, string("profiling"));
+  /* DESCRIPTION: Read hardware counters (cycles, instructions, last level cache misses) for each profiled region (Linux perf_event). */
+  addBoolOption("REGION_PROFILING_COUNTERS", regionProfilingCounters, false);
+  /* DESCRIPTION: Raw perf_event code of a CPU event that counts the floating point operations, e.g. 0x3 or 0x01c7, (0 for none). */
+  addStringOption("REGION_PROFILING_FLOP_EVENT", regionProfilingFlopEventName, string("0"));
+
+  /* DESCRIPTION: Count the MPI messages, bytes and wait time of the comms, and report the load imbalance of the ranks at the end. */
+  addBoolOption("COMM_PROFILING", commProfiling, false);
+
+  /* DESCRIPTION: Overlap the halo exchange of the gradients and limiters with the fluxes of the edges without halo points. */
+  addBoolOption("OVERLAP_HALO_COMMS", overlapHaloComms, false);
+
+  /* DESCRIPTION: Store the least-squares gradient weights of each neighbor, the gradients become weighted sums of differences. */
+  addBoolOption("LEAST_SQUARES_CACHE", leastSquaresCache, false);
+
+  /* DESCRIPTION: Pack the primitives, reconstruction gradients, and limiters of each point in one record for the MUSCL edge loops. */
+  addBoolOption("PACKED_EDGE_DATA", packedEdgeData, false);
+
   /* END_CONFIG_OPTIONS */
 
 }
 
-void CConfig::SetConfig_Parsing(char case_filename[MAX_STRING_SIZE]) {
+const CConfig::CFileOptions* CConfig::GetConfigFileOptions(const string& filename) {
+
+  /*--- Options of the files that were read, with the size and hash of their text. ---*/
+
+  struct CCachedFile {
+    unsigned long size = 0, hash = 0;
+    CFileOptions options;
+  };
+  static map<string, CCachedFile> cache;
+
+  /*--- Only the master reads the file, the other ranks get whether it exists, its size and hash. ---*/
+
+  string text;
+  unsigned long header[3] = {0, 0, 0};
+
+  if (SU2_MPI::GetRank() == MASTER_NODE) {
+    ifstream case_file(filename.c_str(), ios::in);
+    if (!case_file.fail()) {
+      stringstream buffer;
+      buffer << case_file.rdbuf();
+      text = buffer.str();
+      header[0] = 1;
+      header[1] = text.size();
+      header[2] = static_cast<unsigned long>(std::hash<string>()(text));
+    }
+  }
+  SU2_MPI::Bcast(header, 3, MPI_UNSIGNED_LONG, MASTER_NODE, SU2_MPI::GetComm());
+
+  if (header[0] == 0) return nullptr;
+
+  auto cached = cache.find(filename);
+  if ((cached != cache.end()) && (cached->second.size == header[1]) && (cached->second.hash == header[2]))
+    return &cached->second.options;
+
+  /*--- The file changed or was not read yet, broadcast its text. ---*/
+
+  text.resize(header[1]);
+  SU2_MPI::Bcast(&text[0], static_cast<int>(header[1]), MPI_CHAR, MASTER_NODE, SU2_MPI::GetComm());
+
+  /*--- All ranks tokenize the text, such that all of them stop on the errors of the file. ---*/
+
+  CCachedFile file;
+  file.size = header[1];
+  file.hash = header[2];
+
+  istringstream stream(text);
   string text_line, option_name;
-  ifstream case_file;
   vector<string> option_value;
 
-  /*--- Read the configuration file ---*/
+  while (getline(stream, text_line)) {
+    if (TokenizeString(text_line, option_name, option_value))
+      file.options.emplace_back(option_name, option_value);
+  }
 
-  case_file.open(case_filename, ios::in);
+  CCachedFile& entry = cache[filename];
+  entry = move(file);
+  return &entry.options;
+
+}
 
-  if (case_file.fail()) {
+void CConfig::SetConfig_Parsing(char case_filename[MAX_STRING_SIZE]) {
+
+  /*--- Get the options of the configuration file ---*/
+
+  const CFileOptions* file_options = GetConfigFileOptions(case_filename);
+
+  if (file_options == nullptr) {
     SU2_MPI::Error("The configuration file (.cfg) is missing!!", CURRENT_FUNCTION);
   }
 
@@ -2836,7 +3264,7 @@ void CConfig::SetConfig_Parsing(char case_filename[MAX_STRING_SIZE]) {
 
   /*--- Parse the configuration file and set the options ---*/
 
-  while (getline (case_file, text_line)) {
+  for (const auto& file_option : *file_options) {
 
     if (err_count >= max_err_count) {
       errorString.append("too many errors. Stopping parse");
@@ -2845,61 +3273,61 @@ void CConfig::SetConfig_Parsing(char case_filename[MAX_STRING_SIZE]) {
       throw(1);
     }
 
-    if (TokenizeString(text_line, option_name, option_value)) {
+    const string& option_name = file_option.first;
+    const vector<string>& option_value = file_option.second;
 
-      /*--- See if it's a python option ---*/
+    /*--- See if it's a python option ---*/
 
-      if (option_map.find(option_name) == option_map.end()) {
-          string newString;
-          newString.append(option_name);
-          newString.append(": invalid option name");
-          newString.append(". Check current SU2 options in config_template.cfg.");
-          newString.append("\n");
-          if (!option_name.compare("EXT_ITER")) newString.append("Option EXT_ITER is deprecated as of v7.0. Please use TIME_ITER, OUTER_ITER or ITER \n"
-                                                                 "to specify the number of time iterations, outer multizone iterations or iterations, respectively.");
-          if (!option_name.compare("UNST_TIMESTEP")) newString.append("UNST_TIMESTEP is now TIME_STEP.\n");
-          if (!option_name.compare("UNST_TIME")) newString.append("UNST_TIME is now MAX_TIME.\n");
-          if (!option_name.compare("UNST_INT_ITER")) newString.append("UNST_INT_ITER is now INNER_ITER.\n");
-          if (!option_name.compare("RESIDUAL_MINVAL")) newString.append("RESIDUAL_MINVAL is now CONV_RESIDUAL_MINVAL.\n");
-          if (!option_name.compare("STARTCONV_ITER")) newString.append("STARTCONV_ITER is now CONV_STARTITER.\n");
-          if (!option_name.compare("CAUCHY_ELEMS")) newString.append("CAUCHY_ELEMS is now CONV_CAUCHY_ELEMS.\n");
-          if (!option_name.compare("CAUCHY_EPS")) newString.append("CAUCHY_EPS is now CONV_CAUCHY_EPS.\n");
-          if (!option_name.compare("OUTPUT_FORMAT")) newString.append("OUTPUT_FORMAT is now TABULAR_FORMAT.\n");
-          if (!option_name.compare("PHYSICAL_PROBLEM")) newString.append("PHYSICAL_PROBLEM is now SOLVER.\n");
-          if (!option_name.compare("REGIME_TYPE")) newString.append("REGIME_TYPE has been removed.\n "
-                                                                    "If you want use the incompressible solver, \n"
-                                                                    "use INC_EULER, INC_NAVIER_STOKES or INC_RANS as value of the SOLVER option.");
-          errorString.append(newString);
-          err_count++;
-        continue;
-      }
-
-      /*--- Option exists, check if the option has already been in the config file ---*/
-
-      if (included_options.find(option_name) != included_options.end()) {
+    if (option_map.find(option_name) == option_map.end()) {
         string newString;
         newString.append(option_name);
-        newString.append(": option appears twice");
+        newString.append(": invalid option name");
+        newString.append(". Check current SU2 options in config_template.cfg.");
         newString.append("\n");
+        if (!option_name.compare("EXT_ITER")) newString.append("Option EXT_ITER is deprecated as of v7.0. Please use TIME_ITER, OUTER_ITER or ITER \n"
+                                                               "to specify the number of time iterations, outer multizone iterations or iterations, respectively.");
+        if (!option_name.compare("UNST_TIMESTEP")) newString.append("UNST_TIMESTEP is now TIME_STEP.\n");
+        if (!option_name.compare("UNST_TIME")) newString.append("UNST_TIME is now MAX_TIME.\n");
+        if (!option_name.compare("UNST_INT_ITER")) newString.append("UNST_INT_ITER is now INNER_ITER.\n");
+        if (!option_name.compare("RESIDUAL_MINVAL")) newString.append("RESIDUAL_MINVAL is now CONV_RESIDUAL_MINVAL.\n");
+        if (!option_name.compare("STARTCONV_ITER")) newString.append("STARTCONV_ITER is now CONV_STARTITER.\n");
+        if (!option_name.compare("CAUCHY_ELEMS")) newString.append("CAUCHY_ELEMS is now CONV_CAUCHY_ELEMS.\n");
+        if (!option_name.compare("CAUCHY_EPS")) newString.append("CAUCHY_EPS is now CONV_CAUCHY_EPS.\n");
+        if (!option_name.compare("OUTPUT_FORMAT")) newString.append("OUTPUT_FORMAT is now TABULAR_FORMAT.\n");
+        if (!option_name.compare("PHYSICAL_PROBLEM")) newString.append("PHYSICAL_PROBLEM is now SOLVER.\n");
+        if (!option_name.compare("REGIME_TYPE")) newString.append("REGIME_TYPE has been removed.\n "
+                                                                  "If you want use the incompressible solver, \n"
+                                                                  "use INC_EULER, INC_NAVIER_STOKES or INC_RANS as value of the SOLVER option.");
         errorString.append(newString);
         err_count++;
-        continue;
-      }
+      continue;
+    }
 
+    /*--- Option exists, check if the option has already been in the config file ---*/
 
-      /*--- New found option. Add it to the map, and delete from all options ---*/
+    if (included_options.find(option_name) != included_options.end()) {
+      string newString;
+      newString.append(option_name);
+      newString.append(": option appears twice");
+      newString.append("\n");
+      errorString.append(newString);
+      err_count++;
+      continue;
+    }
 
-      included_options.insert(pair<string, bool>(option_name, true));
-      all_options.erase(option_name);
 
-      /*--- Set the value and check error ---*/
+    /*--- New found option. Add it to the map, and delete from all options ---*/
 
-      string out = option_map[option_name]->SetValue(option_value);
-      if (out.compare("") != 0) {
-        errorString.append(out);
-        errorString.append("\n");
-        err_count++;
-      }
+    included_options.insert(pair<string, bool>(option_name, true));
+    all_options.erase(option_name);
+
+    /*--- Set the value and check error ---*/
+
+    string out = option_map[option_name]->SetValue(option_value);
+    if (out.compare("") != 0) {
+      errorString.append(out);
+      errorString.append("\n");
+      err_count++;
     }
   }
 
@@ -2909,8 +3337,6 @@ void CConfig::SetConfig_Parsing(char case_filename[MAX_STRING_SIZE]) {
     SU2_MPI::Error(errorString, CURRENT_FUNCTION);
   }
 
-  case_file.close();
-
 }
 
 void CConfig::SetDefaultFromConfig(CConfig *config){
@@ -3126,8 +3552,7 @@ void CConfig::SetnZone(){
 
     if (nConfig_Files != 0){
       for (unsigned short iConfig = 0; iConfig < nConfig_Files; iConfig++){
-        ifstream f(Config_Filenames[iConfig].c_str());
-        if (!f.good()){
+        if (GetConfigFileOptions(Config_Filenames[iConfig]) == nullptr){
           SU2_MPI::Error("Config file " + Config_Filenames[iConfig] + " defined in CONFIG_FILES does not exist", CURRENT_FUNCTION);
         }
       }
@@ -3158,6 +3583,15 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
     Multizone_Problem = YES;
   }
 
+  /*--- Raw code of the FLOP counter of the region profiling, in any base (e.g. hexadecimal). ---*/
+  {
+    char* end = nullptr;
+    regionProfilingFlopEvent = strtoull(regionProfilingFlopEventName.c_str(), &end, 0);
+    if (regionProfilingFlopEventName.empty() || (*end != '\0')) {
+      SU2_MPI::Error("REGION_PROFILING_FLOP_EVENT must be an integer code, e.g. 0x01c7.", CURRENT_FUNCTION);
+    }
+  }
+
   /*--- Set the default output files ---*/
   if (!OptionIsSet("OUTPUT_FILES")){
     nVolumeOutputFiles = 3;
@@ -3177,6 +3611,70 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
   }
 #endif
 
+  /*--- Check if SU2 was build with HDF5 support, as that is required for the HDF5/XDMF output. ---*/
+#ifndef HAVE_HDF5
+  for (unsigned short iVolumeFile = 0; iVolumeFile < nVolumeOutputFiles; iVolumeFile++){
+    if (VolumeOutputFiles[iVolumeFile] == HDF5 ||
+        VolumeOutputFiles[iVolumeFile] == SURFACE_HDF5) {
+      SU2_MPI::Error(string("HDF5 file requested in option OUTPUT_FILES but SU2 was built without HDF5 support.\n"), CURRENT_FUNCTION);
+    }
+  }
+#endif
+  /*--- Check if SU2 was build with ADIOS2 support, as that is required for the in-situ output streams. ---*/
+#ifndef HAVE_ADIOS2
+  for (unsigned short iVolumeFile = 0; iVolumeFile < nVolumeOutputFiles; iVolumeFile++){
+    if (VolumeOutputFiles[iVolumeFile] == ADIOS2 ||
+        VolumeOutputFiles[iVolumeFile] == SURFACE_ADIOS2) {
+      SU2_MPI::Error(string("ADIOS2 stream requested in option OUTPUT_FILES but SU2 was built without ADIOS2 support.\n"), CURRENT_FUNCTION);
+    }
+  }
+#endif
+  /*--- Check if SU2 was build with zlib support, as that is required for the compressed restart files. ---*/
+#ifndef HAVE_ZLIB
+  if (Restart_Compression != NO_COMPRESSION) {
+    SU2_MPI::Error(string("RESTART_COMPRESSION requested but SU2 was built without zlib support.\n"), CURRENT_FUNCTION);
+  }
+#endif
+  if ((Restart_Compression == LOSSY_COMPRESSION) && (Restart_Lossy_Error <= 0.0)) {
+    SU2_MPI::Error("RESTART_LOSSY_ERROR must be positive.", CURRENT_FUNCTION);
+  }
+  if (HDF5_Compression > 9) {
+    SU2_MPI::Error("HDF5_COMPRESSION_LEVEL must be between 0 (no compression) and 9.", CURRENT_FUNCTION);
+  }
+
+  /*--- Restart files converted by SU2_SOL in batch mode, the list followed by the range. ---*/
+
+  Solution_Batch_Iter.clear();
+  for (unsigned short iIter = 0; iIter < nSolution_Iter_List; iIter++)
+    Solution_Batch_Iter.push_back(Solution_Iter_List[iIter]);
+  if (nSolution_Iter_Range > 0) {
+    if ((nSolution_Iter_Range != 3) || (Solution_Iter_Range[2] == 0) ||
+        (Solution_Iter_Range[0] > Solution_Iter_Range[1])) {
+      SU2_MPI::Error("SOLUTION_ITER_RANGE needs 3 values (first, last, stride) with first <= last and stride > 0.",
+                     CURRENT_FUNCTION);
+    }
+    for (unsigned long iIter = Solution_Iter_Range[0]; iIter <= Solution_Iter_Range[1]; iIter += Solution_Iter_Range[2])
+      Solution_Batch_Iter.push_back(iIter);
+  }
+  if (HistoryFlushFreq == 0) {
+    SU2_MPI::Error("HISTORY_FLUSH_FREQ must be at least 1.", CURRENT_FUNCTION);
+  }
+  if ((nOutput_Probes % 3 != 0) || (nOutput_Probe_Planes % 11 != 0) || (nOutput_Probe_Boxes % 6 != 0)) {
+    SU2_MPI::Error("OUTPUT_PROBES, OUTPUT_PROBE_PLANES and OUTPUT_PROBE_BOXES need 3, 11 and 6 values per entry.",
+                   CURRENT_FUNCTION);
+  }
+  for (unsigned short iPlane = 0; iPlane < nOutput_Probe_Planes/11; iPlane++) {
+    if ((Output_Probe_Planes[11*iPlane+9] < 1.0) || (Output_Probe_Planes[11*iPlane+10] < 1.0)) {
+      SU2_MPI::Error("OUTPUT_PROBE_PLANES need at least one sample along each edge.", CURRENT_FUNCTION);
+    }
+  }
+  if (Output_Probe_Freq == 0) {
+    SU2_MPI::Error("OUTPUT_PROBE_FREQ must be at least 1.", CURRENT_FUNCTION);
+  }
+  if (Surface_Sampling_Freq == 0) {
+    SU2_MPI::Error("SURFACE_SAMPLING_FREQ must be at least 1.", CURRENT_FUNCTION);
+  }
+
   /*--- STL_BINARY output not implelemted yet, but already a value in option_structure.hpp---*/
   for (unsigned short iVolumeFile = 0; iVolumeFile < nVolumeOutputFiles; iVolumeFile++) {
     if (VolumeOutputFiles[iVolumeFile] == STL_BINARY){
@@ -3218,6 +3716,9 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
     }
   }
 
+  if (WallModel_FreezeStages == 0)
+    SU2_MPI::Error(string("WALL_MODEL_FREEZE_STAGES must be at least 1.\n"), CURRENT_FUNCTION);
+
   /*--- Fixed CM mode requires a static movement of the grid ---*/
 
   if (Fixed_CM_Mode) {
@@ -3435,6 +3936,230 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
     Kind_Regime = NO_FLOW;
   }
 
+  /*--- The matrix-free Newton-Krylov method is only available for the primal compressible solvers,
+   *    the adjoint solvers reuse the primal configuration files so the option is ignored. ---*/
+
+  if (NewtonKrylov && (ContinuousAdjoint || DiscreteAdjoint)) NewtonKrylov = false;
+  if (CoupledTurbulence && (ContinuousAdjoint || DiscreteAdjoint)) CoupledTurbulence = false;
+
+  /*--- The stored least-squares weights are not recorded, the geometric sensitivities would be lost. ---*/
+
+  if (DiscreteAdjoint) leastSquaresCache = false;
+
+  /*--- Likewise for the stored gradients of the shape functions of the finite elements. ---*/
+
+  if (DiscreteAdjoint) FEA_GradientCache = false;
+
+  /*--- The frozen limiters would make the recorded residual depend on past iterations. ---*/
+
+  if (DiscreteAdjoint) LimiterFreeze = false;
+
+  if (LimiterFreeze && (LimiterFreezeParam[1] < 1.0 || LimiterFreezeParam[2] < 0.0)) {
+    SU2_MPI::Error("LIMITER_FREEZE_PARAM requires a frequency of at least 1 and a non-negative tolerance.",
+                   CURRENT_FUNCTION);
+  }
+
+  /*--- The residual of the frozen points is that of the last full sweep, which is only meaningful
+   *    for steady problems on a single grid, and the matrix-free products need complete residuals. ---*/
+
+  if (DiscreteAdjoint || ContinuousAdjoint || Time_Domain) ActiveSet = false;
+
+  if (ActiveSet && (nMGLevels > 0 || NewtonKrylov)) {
+    SU2_MPI::Error("ACTIVE_SET is not compatible with multigrid (MGLEVEL > 0) or NEWTON_KRYLOV.", CURRENT_FUNCTION);
+  }
+
+  if (ActiveSet && (ActiveSetParam[0] < 0.0 || ActiveSetParam[1] < 1.0 || ActiveSetParam[2] < 1.0)) {
+    SU2_MPI::Error("ACTIVE_SET_PARAM requires a non-negative fraction, and at least 1 iteration and frequency.",
+                   CURRENT_FUNCTION);
+  }
+
+  /*--- The adjoint recomputes the primal time steps from their stored solution. ---*/
+
+  if (DiscreteAdjoint || ContinuousAdjoint) TimePredictor_Order = 1;
+
+  if ((TimePredictor_Order < 1) || (TimePredictor_Order > 3))
+    SU2_MPI::Error("TIME_PREDICTOR_ORDER must be 1, 2, or 3.", CURRENT_FUNCTION);
+
+  if (!DiscreteAdjoint) DiscAdj_Krylov = false;
+
+  if (DiscAdj_Krylov) {
+    /*--- The kind of solver is converted to its adjoint at the end of this routine. ---*/
+    const bool fluid = (Kind_Solver == EULER) || (Kind_Solver == NAVIER_STOKES) || (Kind_Solver == RANS) ||
+                       (Kind_Solver == INC_EULER) || (Kind_Solver == INC_NAVIER_STOKES) || (Kind_Solver == INC_RANS);
+    if (!fluid || Time_Domain || Multizone_Problem)
+      SU2_MPI::Error("DISCADJ_KRYLOV is only available for steady single zone fluid problems.", CURRENT_FUNCTION);
+    if (DiscAdj_Krylov_Size < 1)
+      SU2_MPI::Error("DISCADJ_KRYLOV_SIZE must be at least 1.", CURRENT_FUNCTION);
+  }
+
+  if (!DiscreteAdjoint || (nObj == 1)) DiscAdj_Separate_Objectives = false;
+
+  /*--- The quasi-Newton acceleration applies to the discrete adjoint, and to the block Gauss-Seidel
+   *    coupling of the primal multizone problems, it has no effect on the other solvers. ---*/
+
+  if (!DiscreteAdjoint && !Multizone_Problem) nQuasiNewtonSamples = 0;
+
+  if ((nQuasiNewtonSamples > 0) && (DiscAdj_Krylov || DiscAdj_Separate_Objectives))
+    SU2_MPI::Error("QUASI_NEWTON_NUM_SAMPLES is not compatible with DISCADJ_KRYLOV or DISCADJ_SEPARATE_OBJECTIVES.", CURRENT_FUNCTION);
+
+  if (DiscAdj_Separate_Objectives) {
+    const bool fluid = (Kind_Solver == EULER) || (Kind_Solver == NAVIER_STOKES) || (Kind_Solver == RANS) ||
+                       (Kind_Solver == INC_EULER) || (Kind_Solver == INC_NAVIER_STOKES) || (Kind_Solver == INC_RANS);
+    if (!fluid || Time_Domain || Multizone_Problem || GetWeakly_Coupled_Heat() || GetBoolTurbomachinery() || DiscAdj_Krylov)
+      SU2_MPI::Error("DISCADJ_SEPARATE_OBJECTIVES is only available for steady single zone fluid problems\n"
+                     "(without heat coupling, turbomachinery, or DISCADJ_KRYLOV).", CURRENT_FUNCTION);
+    if ((Kind_SU2 == SU2_CFD) && (nObj > SU2_TYPE::GetnDirections()))
+      SU2_MPI::Error("DISCADJ_SEPARATE_OBJECTIVES requires SU2_CFD_AD built with at least as many reverse directions\n"
+                     "(meson option codi-reverse-directions) as the number of OBJECTIVE_FUNCTION.", CURRENT_FUNCTION);
+  }
+
+  if (!DiscreteAdjoint) DiscAdj_Combined_Recording = false;
+
+  if (DiscAdj_Combined_Recording) {
+    const bool fluid = (Kind_Solver == EULER) || (Kind_Solver == NAVIER_STOKES) || (Kind_Solver == RANS) ||
+                       (Kind_Solver == INC_EULER) || (Kind_Solver == INC_NAVIER_STOKES) || (Kind_Solver == INC_RANS);
+    const bool multizone_ok = (Kind_Solver == MULTIPHYSICS) || fluid || (Kind_Solver == HEAT_EQUATION);
+    if (Multizone_Problem? (!multizone_ok || !FullTape) : (!fluid || Time_Domain))
+      SU2_MPI::Error("DISCADJ_COMBINED_RECORDING is only available for steady single zone fluid problems, or for\n"
+                     "multizone problems of fluid and heat zones with FULL_TAPE= YES.", CURRENT_FUNCTION);
+  }
+
+  if (!DiscreteAdjoint) DiscAdj_Checkpoints = 0;
+
+  if (DiscAdj_Checkpoints > 0) {
+    const bool fluid = (Kind_Solver == EULER) || (Kind_Solver == NAVIER_STOKES) || (Kind_Solver == RANS) ||
+                       (Kind_Solver == INC_EULER) || (Kind_Solver == INC_NAVIER_STOKES) || (Kind_Solver == INC_RANS);
+    const bool dual_time = (TimeMarching == DT_STEPPING_1ST) || (TimeMarching == DT_STEPPING_2ND);
+    if (!fluid || !dual_time || Multizone_Problem || GetDynamic_Grid() || GetWeakly_Coupled_Heat() || AddRadiation())
+      SU2_MPI::Error("DISCADJ_CHECKPOINTS is only available for dual time stepping single zone fluid problems on fixed grids\n"
+                     "(without heat coupling or radiation).", CURRENT_FUNCTION);
+    if (DiscAdj_Checkpoints_Disk > DiscAdj_Checkpoints)
+      SU2_MPI::Error("DISCADJ_CHECKPOINTS_DISK cannot exceed DISCADJ_CHECKPOINTS.", CURRENT_FUNCTION);
+  }
+
+  if ((ResSmoothing_Iter > 0) && (ResSmoothing_Coeff < 0.0))
+    SU2_MPI::Error("RES_SMOOTHING_COEFF must be non-negative.", CURRENT_FUNCTION);
+
+  /*--- The adjoint linear solves (transposed) use the same storage for the preconditioner. ---*/
+
+  if (DiscreteAdjoint) Linear_Solver_Prec_Reuse = 0;
+
+  /*--- The stiffness of the mesh deformation depends on the coordinates that are differentiated. ---*/
+
+  if (DiscreteAdjoint) Deform_Reuse_Stiffness = false;
+
+  if (FFD_Sparse_Projection && (FFD_CoordSystem != CARTESIAN))
+    SU2_MPI::Error("FFD_SPARSE_PROJECTION requires FFD_COORD_SYSTEM= CARTESIAN.", CURRENT_FUNCTION);
+
+  if (Linear_Solver_Prec_Reuse_Growth < 1.0)
+    SU2_MPI::Error("LINEAR_SOLVER_PREC_REUSE_GROWTH must be greater or equal to 1.", CURRENT_FUNCTION);
+
+  if (Linear_Solver_Adaptive_Error) {
+    const auto param = Linear_Solver_Adaptive_Param;
+    if ((param[0] <= 0.0) || (param[0] > 1.0) || (param[1] < 1.0) || (param[1] > 2.0))
+      SU2_MPI::Error("LINEAR_SOLVER_ADAPTIVE_PARAM requires 0 < gamma <= 1 and 1 <= alpha <= 2.", CURRENT_FUNCTION);
+    if ((param[2] <= 0.0) || (param[2] > param[3]) || (param[3] >= 1.0))
+      SU2_MPI::Error("LINEAR_SOLVER_ADAPTIVE_PARAM requires 0 < min tolerance <= max tolerance < 1.", CURRENT_FUNCTION);
+  }
+
+  if (Linear_Solver_Device) {
+#ifndef HAVE_OMP_OFFLOAD
+    SU2_MPI::Error("LINEAR_SOLVER_DEVICE= YES requires an OpenMP offload build (omp-offload-args, without AD).", CURRENT_FUNCTION);
+#endif
+    if (((Kind_Linear_Solver != FGMRES) && (Kind_Linear_Solver != FGMRES_CGS)) || (Kind_Linear_Solver_Prec != JACOBI))
+      SU2_MPI::Error("LINEAR_SOLVER_DEVICE= YES requires LINEAR_SOLVER= FGMRES and LINEAR_SOLVER_PREC= JACOBI.", CURRENT_FUNCTION);
+  }
+
+  /*--- Diagonal-only Jacobians, the preconditioners reduce to block Jacobi, those that require
+   *    the off-diagonal blocks (or their own sparse pattern) cannot be used. ---*/
+
+  if ((Kind_Linear_Solver == GCRO_DR) && (Linear_Solver_Recycle_Size >= Linear_Solver_Iter))
+    SU2_MPI::Error("LINEAR_SOLVER_RECYCLE_SIZE must be smaller than LINEAR_SOLVER_ITER.", CURRENT_FUNCTION);
+
+  if (Jacobian_DiagonalOnly) {
+    auto diagCompatible = [](unsigned short kind) {
+      return (kind == JACOBI) || (kind == ILU) || (kind == LU_SGS);
+    };
+    if (!diagCompatible(Kind_Linear_Solver_Prec) || (DiscreteAdjoint && !diagCompatible(Kind_DiscAdj_Linear_Prec)))
+      SU2_MPI::Error("JACOBIAN_DIAGONAL_ONLY requires a JACOBI, ILU, or LU_SGS preconditioner.", CURRENT_FUNCTION);
+    if ((Kind_Linear_Solver == PASTIX_LU) || (Kind_Linear_Solver == PASTIX_LDLT))
+      SU2_MPI::Error("JACOBIAN_DIAGONAL_ONLY is not compatible with the PaStiX linear solvers.", CURRENT_FUNCTION);
+  }
+
+  /*--- Matrix-free structural products, the preconditioner is built from the diagonal blocks.
+   *    The mass matrix (dynamics) and the frozen tangent of modified Newton-Raphson are not available. ---*/
+
+  if (FEA_MatrixFree) {
+    if (DiscreteAdjoint)
+      SU2_MPI::Error("FEA_MATRIX_FREE is not compatible with the discrete adjoint.", CURRENT_FUNCTION);
+    if (Time_Domain)
+      SU2_MPI::Error("FEA_MATRIX_FREE is only available for static structural problems.", CURRENT_FUNCTION);
+    if ((Kind_Struct_Solver == LARGE_DEFORMATIONS) && ((Kind_SpaceIteScheme_FEA == MODIFIED_NEWTON_RAPHSON) ||
+                                                      (Kind_SpaceIteScheme_FEA == QUASI_NEWTON_BFGS)))
+      SU2_MPI::Error("FEA_MATRIX_FREE is not compatible with MODIFIED_NEWTON_RAPHSON or QUASI_NEWTON.", CURRENT_FUNCTION);
+    if ((Kind_Linear_Solver_Prec != JACOBI) && (Kind_Linear_Solver_Prec != ILU) && (Kind_Linear_Solver_Prec != LU_SGS))
+      SU2_MPI::Error("FEA_MATRIX_FREE requires a JACOBI, ILU, or LU_SGS preconditioner.", CURRENT_FUNCTION);
+    if ((Kind_Linear_Solver == PASTIX_LU) || (Kind_Linear_Solver == PASTIX_LDLT))
+      SU2_MPI::Error("FEA_MATRIX_FREE is not compatible with the PaStiX linear solvers.", CURRENT_FUNCTION);
+  }
+
+  /*--- The BFGS updates of the quasi-Newton method are not differentiated, and they assume
+   *    the step is zero where the solution is enforced (only true for clamped nodes). ---*/
+
+  if ((Kind_Struct_Solver == LARGE_DEFORMATIONS) && (Kind_SpaceIteScheme_FEA == QUASI_NEWTON_BFGS)) {
+    if (DiscreteAdjoint)
+      SU2_MPI::Error("QUASI_NEWTON is not compatible with the discrete adjoint.", CURRENT_FUNCTION);
+    if ((nMarker_Disp_Dir > 0) || (nMarker_Displacement > 0))
+      SU2_MPI::Error("QUASI_NEWTON is not compatible with prescribed displacements, use MODIFIED_NEWTON_RAPHSON.",
+                     CURRENT_FUNCTION);
+    if (QuasiNewton_Memory == 0)
+      SU2_MPI::Error("QUASI_NEWTON_MEMORY must be at least 1.", CURRENT_FUNCTION);
+  }
+
+  /*--- The coarse level settings apply to preconditioners without setup outside the matrix. ---*/
+
+  for (unsigned short iMesh = 1; iMesh <= nMG_Linear_Solver_Prec; iMesh++) {
+    const auto kind = GetKind_Linear_Solver_Prec(iMesh);
+    if ((kind != JACOBI) && (kind != ILU) && (kind != LU_SGS) && (kind != LINELET))
+      SU2_MPI::Error("MG_LINEAR_SOLVER_PREC only supports JACOBI, ILU, LU_SGS, and LINELET.", CURRENT_FUNCTION);
+    if (MG_Jacobian_DiagonalOnly && (kind == LINELET))
+      SU2_MPI::Error("MG_JACOBIAN_DIAGONAL_ONLY requires a JACOBI, ILU, or LU_SGS preconditioner.", CURRENT_FUNCTION);
+  }
+
+  if (MG_Jacobian_DiagonalOnly && (nMG_Linear_Solver_Prec == 0) &&
+      (Kind_Linear_Solver_Prec != JACOBI) && (Kind_Linear_Solver_Prec != ILU) && (Kind_Linear_Solver_Prec != LU_SGS))
+    SU2_MPI::Error("MG_JACOBIAN_DIAGONAL_ONLY requires a JACOBI, ILU, or LU_SGS preconditioner.", CURRENT_FUNCTION);
+
+  if (NewtonKrylov) {
+    if ((Kind_Solver != EULER) && (Kind_Solver != NAVIER_STOKES) && (Kind_Solver != RANS))
+      SU2_MPI::Error("NEWTON_KRYLOV is only available for the compressible finite volume solvers.", CURRENT_FUNCTION);
+    if (Kind_TimeIntScheme_Flow != EULER_IMPLICIT)
+      SU2_MPI::Error("NEWTON_KRYLOV requires TIME_DISCRE_FLOW= EULER_IMPLICIT.", CURRENT_FUNCTION);
+    if (nMGLevels != 0)
+      SU2_MPI::Error("NEWTON_KRYLOV is not compatible with multigrid, set MGLEVEL= 0.", CURRENT_FUNCTION);
+    if (Fixed_CL_Mode || Low_Mach_Precon || (Kind_Upwind_Flow == TURKEL) || (nMarker_PerBound > 0))
+      SU2_MPI::Error("NEWTON_KRYLOV is not compatible with fixed CL mode, low Mach preconditioning, or periodic boundaries.", CURRENT_FUNCTION);
+  }
+
+  if (NewtonKrylov_ADJacobian) {
+#ifndef CODI_FORWARD_TYPE
+    SU2_MPI::Error("NEWTON_KRYLOV_AD_JACOBIAN requires the forward AD build (SU2_CFD_DIRECTDIFF).", CURRENT_FUNCTION);
+#endif
+    if (!NewtonKrylov || (DirectDiff != NO_DERIVATIVE))
+      SU2_MPI::Error("NEWTON_KRYLOV_AD_JACOBIAN requires NEWTON_KRYLOV= YES and DIRECT_DIFF= NONE.", CURRENT_FUNCTION);
+  }
+
+  if (CoupledTurbulence) {
+    if (Kind_Solver != RANS)
+      SU2_MPI::Error("COUPLED_TURBULENCE is only available for the compressible RANS solver.", CURRENT_FUNCTION);
+    if ((Kind_TimeIntScheme_Flow != EULER_IMPLICIT) || (Kind_TimeIntScheme_Turb != EULER_IMPLICIT))
+      SU2_MPI::Error("COUPLED_TURBULENCE requires TIME_DISCRE_FLOW= EULER_IMPLICIT and TIME_DISCRE_TURB= EULER_IMPLICIT.", CURRENT_FUNCTION);
+    if (nMGLevels != 0)
+      SU2_MPI::Error("COUPLED_TURBULENCE is not compatible with multigrid, set MGLEVEL= 0.", CURRENT_FUNCTION);
+    if (NewtonKrylov)
+      SU2_MPI::Error("COUPLED_TURBULENCE is not compatible with NEWTON_KRYLOV.", CURRENT_FUNCTION);
+  }
+
   if ((rank == MASTER_NODE) && ContinuousAdjoint && (Ref_NonDim == DIMENSIONAL) && (Kind_SU2 == SU2_CFD)) {
     cout << "WARNING: The adjoint solver should use a non-dimensional flow solution." << endl;
   }
@@ -3549,6 +4274,23 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
 
   }
 
+  /*--- Check the options of the tabulated fluid model ---*/
+
+  if (Kind_FluidModel == TABULATED_GAS) {
+    if (Kind_TabulatedFluidModel != STANDARD_AIR && Kind_TabulatedFluidModel != IDEAL_GAS &&
+        Kind_TabulatedFluidModel != VW_GAS && Kind_TabulatedFluidModel != PR_GAS) {
+      SU2_MPI::Error("TABULATED_FLUID_MODEL must be STANDARD_AIR, IDEAL_GAS, VW_GAS, or PR_GAS.", CURRENT_FUNCTION);
+    }
+    if (TabulatedGas_Size[0] < 4 || TabulatedGas_Size[1] < 4) {
+      SU2_MPI::Error("The table of TABULATED_GAS needs at least 4 nodes in each direction.", CURRENT_FUNCTION);
+    }
+    if ((TabulatedGas_DensityRange[1] != 0.0 && TabulatedGas_DensityRange[0] <= 0.0) ||
+        TabulatedGas_DensityRange[1] < TabulatedGas_DensityRange[0] ||
+        TabulatedGas_EnergyRange[1] < TabulatedGas_EnergyRange[0]) {
+      SU2_MPI::Error("Invalid TABULATED_GAS_DENSITY_RANGE or TABULATED_GAS_ENERGY_RANGE.", CURRENT_FUNCTION);
+    }
+  }
+
   /*--- Check for Boundary condition available for NICF ---*/
 
   if (ideal_gas && (Kind_Solver != INC_EULER && Kind_Solver != INC_NAVIER_STOKES && Kind_Solver != INC_RANS)) {
@@ -4163,7 +4905,7 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
   }
   if (nMG_CorrecSmooth != 0) MG_CorrecSmooth[nMGLevels] = 0;
 
-  if (Restart) MGCycle = V_CYCLE;
+  if (Restart && (MGCycle == FULLMG_CYCLE)) MGCycle = V_CYCLE;
 
   if (ContinuousAdjoint) {
     if (Kind_Solver == EULER) Kind_Solver = ADJ_EULER;
@@ -4171,6 +4913,29 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
     if (Kind_Solver == RANS) Kind_Solver = ADJ_RANS;
   }
 
+  /*--- The multigrid of the turbulence equations is only used by the direct RANS problems
+   *    with segregated turbulence, without the full multigrid startup. ---*/
+
+  if (MG_Turbulence && (MGCycle == FULLMG_CYCLE))
+    SU2_MPI::Error("MG_TURBULENCE is not compatible with MGCYCLE= FULLMG_CYCLE.", CURRENT_FUNCTION);
+
+  MG_Turbulence = MG_Turbulence && (nMGLevels > 0) && !CoupledTurbulence &&
+                  ((Kind_Solver == RANS) || (Kind_Solver == INC_RANS));
+
+  /*--- The RBF volume deformation is only available in CVolumetricMovement,
+   *    the mesh solver (DEFORM_MESH= YES) always uses the elasticity analogy. ---*/
+
+  if (Kind_Deform_Method == RBF_DEFORMATION) {
+    if (Deform_Mesh)
+      SU2_MPI::Error("DEFORM_METHOD= RBF is not compatible with DEFORM_MESH= YES.", CURRENT_FUNCTION);
+    if (Deform_RBF_Radius < 0.0)
+      SU2_MPI::Error("DEFORM_RBF_RADIUS must be non-negative.", CURRENT_FUNCTION);
+    if (Deform_RBF_Greedy_Tol <= 0.0)
+      SU2_MPI::Error("DEFORM_RBF_GREEDY_TOL must be positive.", CURRENT_FUNCTION);
+    if (Deform_RBF_Max_Points == 0)
+      SU2_MPI::Error("DEFORM_RBF_MAX_POINTS must be positive.", CURRENT_FUNCTION);
+  }
+
   nCFL = nMGLevels+1;
   CFL = new su2double[nCFL];
   CFL[0] = CFLFineGrid;
@@ -4201,6 +4966,14 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
   if (Update_AoA_Iter_Limit == 0 && Fixed_CL_Mode) {
     SU2_MPI::Error("ERROR: Please specify non-zero UPDATE_AOA_ITER_LIMIT.", CURRENT_FUNCTION);
   }
+  if (Fixed_CL_Newton && Fixed_CL_Mode) {
+    Fixed_CL_AoA_Ramp = max<unsigned long>(Fixed_CL_AoA_Ramp, 1);
+    if (Fixed_CL_Newton_Iter < Fixed_CL_AoA_Ramp)
+      SU2_MPI::Error("FIXED_CL_NEWTON_ITER must be at least FIXED_CL_AOA_RAMP.", CURRENT_FUNCTION);
+  }
+  if (Time_Average_Freq == 0) {
+    SU2_MPI::Error("TIME_AVERAGE_FREQ must be at least 1.", CURRENT_FUNCTION);
+  }
   if (Iter_Fixed_CM == 0) { Iter_Fixed_CM = nInnerIter+1; Update_iH = 0; }
   if (Iter_Fixed_NetThrust == 0) { Iter_Fixed_NetThrust = nInnerIter+1; Update_BCThrust = 0; }
 
@@ -4244,10 +5017,45 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
     nLevels_TimeAccurateLTS = 1;
   }
 
+  /* The implicit DG solver is a Newton-Krylov method for steady problems, of
+     which the preconditioner is built from the (owned part of the) Jacobian. */
+  if (Kind_TimeIntScheme_FEM_Flow == EULER_IMPLICIT) {
+
+    if (TimeMarching != STEADY)
+      SU2_MPI::Error("TIME_DISCRE_FEM_FLOW= EULER_IMPLICIT is only available for steady problems.", CURRENT_FUNCTION);
+    if ((Kind_Linear_Solver_Prec != JACOBI) && (Kind_Linear_Solver_Prec != ILU))
+      SU2_MPI::Error("TIME_DISCRE_FEM_FLOW= EULER_IMPLICIT requires LINEAR_SOLVER_PREC= JACOBI or ILU.", CURRENT_FUNCTION);
+    if (Jacobian_Frequency_DGFEM == 0)
+      SU2_MPI::Error("JACOBIAN_FREQUENCY_DGFEM must be positive.", CURRENT_FUNCTION);
+  }
+
+  /* The p-multigrid algorithm of the DG solver, MGLEVEL > 0, accelerates the
+     explicit Runge-Kutta schemes for steady problems. */
+  const bool fem_dg_solver = (Kind_Solver == FEM_EULER)          || (Kind_Solver == FEM_NAVIER_STOKES) ||
+                             (Kind_Solver == FEM_RANS)           || (Kind_Solver == FEM_LES)           ||
+                             (Kind_Solver == DISC_ADJ_FEM_EULER) || (Kind_Solver == DISC_ADJ_FEM_NS)   ||
+                             (Kind_Solver == DISC_ADJ_FEM_RANS);
+  if (fem_dg_solver && (nMGLevels > 0)) {
+
+    if ((TimeMarching != STEADY) || DiscreteAdjoint)
+      SU2_MPI::Error("The p-multigrid of the DG solver (MGLEVEL > 0) is only available for steady direct problems.", CURRENT_FUNCTION);
+    if ((Kind_TimeIntScheme_FEM_Flow != RUNGE_KUTTA_EXPLICIT) && (Kind_TimeIntScheme_FEM_Flow != CLASSICAL_RK4_EXPLICIT))
+      SU2_MPI::Error("The p-multigrid of the DG solver requires TIME_DISCRE_FEM_FLOW= RUNGE-KUTTA_EXPLICIT or CLASSICAL_RK4_EXPLICIT.", CURRENT_FUNCTION);
+    if (MGCycle == FULLMG_CYCLE)
+      SU2_MPI::Error("FULLMG_CYCLE is not available for the p-multigrid of the DG solver.", CURRENT_FUNCTION);
+  }
+
   if (Kind_TimeIntScheme_FEM_Flow == ADER_DG) {
 
     TimeMarching = TIME_STEPPING;  // Only time stepping for ADER.
 
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+    /* The single precision predictor does not store derivative information. */
+    if (ADER_Predictor_SinglePrecision)
+      SU2_MPI::Error("ADER_PREDICTOR_SINGLE_PRECISION is not possible for a discrete adjoint or direct differentiation.",
+                     CURRENT_FUNCTION);
+#endif
+
     /* If time accurate local time stepping is used, make sure that an unsteady
        CFL is specified. If not, terminate. */
     if (nLevels_TimeAccurateLTS != 1) {
@@ -4427,6 +5235,12 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
                        CURRENT_FUNCTION);
       }
 #endif
+    if ((DirectDiff_Directions < 1) || (DirectDiff_Directions > SU2_TYPE::GetnDirections())) {
+      if (Kind_SU2 == SU2_CFD)
+        SU2_MPI::Error("DIRECT_DIFF_DIRECTIONS must be between 1 and the number of directions of the build (" +
+                       to_string(SU2_TYPE::GetnDirections()) + "), see the meson option codi-forward-directions.",
+                       CURRENT_FUNCTION);
+    }
     /*--- Initialize the derivative values ---*/
     switch (DirectDiff) {
       case D_MACH:
@@ -4510,6 +5324,30 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
     SU2_MPI::Error("Componentality should be either 1, 2, or 3!", CURRENT_FUNCTION);
   }
 
+  /* --- Restart interpolated from the solution on another grid --- */
+
+  if (!Solution_Donor_Mesh_FileName.empty()) {
+    const bool flow = (Kind_Solver == EULER) || (Kind_Solver == NAVIER_STOKES) || (Kind_Solver == RANS) ||
+                      (Kind_Solver == INC_EULER) || (Kind_Solver == INC_NAVIER_STOKES) || (Kind_Solver == INC_RANS);
+    if (!Restart)
+      SU2_MPI::Error("SOLUTION_DONOR_MESH_FILENAME requires RESTART_SOL= YES.", CURRENT_FUNCTION);
+    if (!flow || Time_Domain || Multizone_Problem || (TimeMarching == HARMONIC_BALANCE) || GetGrid_Movement() ||
+        FSI_Problem || Weakly_Coupled_Heat || (Kind_Radiation != NO_RADIATION) || uq_ensemble)
+      SU2_MPI::Error("SOLUTION_DONOR_MESH_FILENAME is only available for steady single zone finite volume flow problems on fixed grids.",
+                     CURRENT_FUNCTION);
+  }
+
+  /* --- The members of the UQ ensemble are instances of the zone (one per perturbation) --- */
+
+  if (uq_ensemble) {
+    if (!using_uq)
+      SU2_MPI::Error("UQ_ENSEMBLE requires USING_UQ= YES.", CURRENT_FUNCTION);
+    if ((Kind_Solver != RANS) || Time_Domain || Multizone_Problem || DiscreteAdjoint || ContinuousAdjoint || Fixed_CL_Mode ||
+        (TimeMarching == HARMONIC_BALANCE) || GetGrid_Movement() || Deform_Mesh || Deform_Design)
+      SU2_MPI::Error("UQ_ENSEMBLE is only available for steady single zone RANS problems on fixed grids (without fixed CL).", CURRENT_FUNCTION);
+    nTimeInstances = 5;
+  }
+
   /*--- If there are not design variables defined in the file ---*/
 
   if (nDV == 0) {
@@ -6421,8 +7259,12 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
             case BCGSTAB:
             case FGMRES:
             case RESTARTED_FGMRES:
+            case FGMRES_CGS:
+            case GCRO_DR:
               if (Kind_Linear_Solver == BCGSTAB)
                 cout << "BCGSTAB is used for solving the linear system." << endl;
+              else if (Kind_Linear_Solver == GCRO_DR)
+                cout << "GCRO_DR (recycled subspace size " << Linear_Solver_Recycle_Size << ") is used for solving the linear system." << endl;
               else
                 cout << "FGMRES is used for solving the linear system." << endl;
               switch (Kind_Linear_Solver_Prec) {
@@ -6430,6 +7272,10 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
                 case LINELET: cout << "Using a linelet preconditioning."<< endl; break;
                 case LU_SGS:  cout << "Using a LU-SGS preconditioning."<< endl; break;
                 case JACOBI:  cout << "Using a Jacobi preconditioning."<< endl; break;
+                case AMG:     cout << "Using an AMG preconditioning."<< endl; break;
+                case NEUMANN_PREC: cout << "Using a Neumann polynomial (degree " << Linear_Solver_Prec_Degree << ") preconditioning."<< endl; break;
+                case CHEBYSHEV: cout << "Using a Chebyshev polynomial (degree " << Linear_Solver_Prec_Degree << ") preconditioning."<< endl; break;
+                case SPAI:    cout << "Using a SPAI preconditioning."<< endl; break;
               }
               break;
             case SMOOTHER:
@@ -6438,6 +7284,10 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
                 case LINELET: cout << "A Linelet"; break;
                 case LU_SGS:  cout << "A LU-SGS"; break;
                 case JACOBI:  cout << "A Jacobi"; break;
+                case AMG:     cout << "An AMG"; break;
+                case NEUMANN_PREC: cout << "A Neumann polynomial"; break;
+                case CHEBYSHEV: cout << "A Chebyshev polynomial"; break;
+                case SPAI:    cout << "A SPAI"; break;
               }
               cout << " method is used for smoothing the linear system." << endl;
               break;
@@ -6470,7 +7320,7 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
               cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
               cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
               break;
-            case FGMRES: case RESTARTED_FGMRES:
+            case FGMRES: case RESTARTED_FGMRES: case FGMRES_CGS:
               cout << "FGMRES is used for solving the linear system." << endl;
               cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
               cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
@@ -6520,6 +7370,13 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
           cout << "Function coefficients: {1/6, 1/3, 1/3, 1/6}" << endl;
           break;
 
+        case EULER_IMPLICIT:
+          cout << "Euler implicit (Newton-Krylov) method for the flow equations." << endl;
+          cout << "Jacobian of the preconditioner updated every " << Jacobian_Frequency_DGFEM << " iterations";
+          if (ElementBlock_Jacobian_DGFEM) cout << ", couplings within the elements only";
+          cout << "." << endl;
+          break;
+
         case ADER_DG:
           if(nLevels_TimeAccurateLTS == 1)
             cout << "ADER-DG for the flow equations with global time stepping." << endl;
@@ -6563,6 +7420,7 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
       if (MGCycle == V_CYCLE) cout << "V Multigrid Cycle, with " << nMGLevels << " multigrid levels."<< endl;
       if (MGCycle == W_CYCLE) cout << "W Multigrid Cycle, with " << nMGLevels << " multigrid levels."<< endl;
       if (MGCycle == FULLMG_CYCLE) cout << "Full Multigrid Cycle, with " << nMGLevels << " multigrid levels."<< endl;
+      if (MGCycle == F_CYCLE) cout << "F Multigrid Cycle, with " << nMGLevels << " multigrid levels."<< endl;
 
       cout << "Damping factor for the residual restriction: " << Damp_Res_Restric <<"."<< endl;
       cout << "Damping factor for the correction prolongation: " << Damp_Correc_Prolong <<"."<< endl;
@@ -7776,6 +8634,8 @@ CConfig::~CConfig(void) {
   if (Marker_Internal != NULL )            delete[] Marker_Internal;
   if (Marker_HeatFlux != NULL )               delete[] Marker_HeatFlux;
   if (Marker_Emissivity != NULL )         delete[] Marker_Emissivity;
+  if (Marker_PartitionWeight != NULL )    delete[] Marker_PartitionWeight;
+  if (PartitionWeight != NULL )           delete[] PartitionWeight;
 
   if (Int_Coeffs != NULL) delete [] Int_Coeffs;
 
@@ -7830,12 +8690,20 @@ CConfig::~CConfig(void) {
   if (VolumeOutput != NULL) delete [] VolumeOutput;
   if (Mesh_Box_Size != NULL) delete [] Mesh_Box_Size;
   if (VolumeOutputFiles != NULL) delete [] VolumeOutputFiles;
+  if (Restart_Lossy_Fields != NULL) delete [] Restart_Lossy_Fields;
+  if (Solution_Iter_List != NULL) delete [] Solution_Iter_List;
+  if (Solution_Iter_Range != NULL) delete [] Solution_Iter_Range;
+  if (Output_Probes != NULL) delete [] Output_Probes;
+  if (Output_Probe_Planes != NULL) delete [] Output_Probe_Planes;
+  if (Output_Probe_Boxes != NULL) delete [] Output_Probe_Boxes;
+  if (Marker_Surface_Sampling != NULL) delete [] Marker_Surface_Sampling;
+  if (Surface_Sampling_Fields != NULL) delete [] Surface_Sampling_Fields;
 
   if (ConvField != NULL) delete [] ConvField;
 
 }
 
-string CConfig::GetFilename(string filename, string ext, unsigned long Iter){
+string CConfig::GetFilename(string filename, string ext, unsigned long Iter, bool appendIter){
 
   /*--- Remove any extension --- */
 
@@ -7854,7 +8722,7 @@ string CConfig::GetFilename(string filename, string ext, unsigned long Iter){
   if (GetnTimeInstances() > 1)
     filename = GetMultiInstance_FileName(filename, GetiInst(), ext);
 
-  if (GetTime_Domain()){
+  if (GetTime_Domain() && appendIter){
     filename = GetUnsteady_FileName(filename, (int)Iter, ext);
   }
 
@@ -7949,7 +8817,7 @@ string CConfig::GetMultiInstance_HistoryFileName(string val_filename, int val_iI
     return multizone_filename;
 }
 
-string CConfig::GetObjFunc_Extension(string val_filename) {
+string CConfig::GetObjFunc_Extension(string val_filename, short val_obj) {
 
   string AdjExt, Filename = val_filename;
 
@@ -7960,8 +8828,8 @@ string CConfig::GetObjFunc_Extension(string val_filename) {
     unsigned short lastindex = Filename.find_last_of(".");
     Filename = Filename.substr(0, lastindex);
 
-    if (nObj==1) {
-      switch (Kind_ObjFunc[0]) {
+    if ((nObj==1) || (val_obj >= 0)) {
+      switch (Kind_ObjFunc[max<short>(val_obj, 0)]) {
         case DRAG_COEFFICIENT:            AdjExt = "_cd";       break;
         case LIFT_COEFFICIENT:            AdjExt = "_cl";       break;
         case SIDEFORCE_COEFFICIENT:       AdjExt = "_csf";      break;
@@ -9217,6 +10085,14 @@ su2double* CConfig::GetLoad_Sine_Dir(string val_marker) {
   return Load_Sine_Dir[iMarker_Load_Sine];
 }
 
+su2double CConfig::GetMarker_PartitionWeight(string val_marker) const {
+
+  for (unsigned short iMarker = 0; iMarker < nMarker_PartitionWeight; iMarker++)
+    if (Marker_PartitionWeight[iMarker] == val_marker) return PartitionWeight[iMarker];
+
+  return 0.0;
+}
+
 su2double CConfig::GetWall_Emissivity(string val_marker) const {
 
   unsigned short iMarker_Emissivity = 0;
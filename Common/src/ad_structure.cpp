@@ -26,12 +26,18 @@
  */
 
 #include "../include/datatype_structure.hpp"
+#include "../include/mpi_structure.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <iomanip>
 
 namespace AD {
 #ifdef CODI_REVERSE_TYPE
   /*--- Initialization of the global variables ---*/
 
   int adjointVectorPosition = 0;
+  unsigned short adjointDirection = 0;
 
   std::vector<su2double::GradientData> inputValues;
   std::vector<su2double::GradientData> localInputValues;
@@ -49,5 +55,107 @@ namespace AD {
 
   ExtFuncHelper* FuncHelper;
 
+  unsigned long nExtFunc = 0;
+
+  namespace {
+  /*--- Tape used by AD of the current recording, accumulated per section ---*/
+  struct CSection {
+    const char* name;
+    unsigned long statements = 0, extFunc = 0;
+    double memory = 0.0, time = 0.0;
+  };
+  std::vector<CSection> Sections;
+
+  /*--- The values when the open section started ---*/
+  CSection* openSection = nullptr;
+  CSection openStart;
+
+  double UsedMemory() { return globalTape.getTapeValues().getUsedMemorySize(); }
+
+  double WallTime() {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+  }
+  }
+
+  void ResetSections() {
+    Sections.clear();
+    openSection = nullptr;
+  }
+
+  void StartSection(const char* name) {
+    if (!globalTape.isActive() || openSection) return;
+
+    unsigned long iSection = 0;
+    while ((iSection < Sections.size()) && std::strcmp(Sections[iSection].name, name)) iSection++;
+    if (iSection == Sections.size()) {
+      Sections.emplace_back();
+      Sections.back().name = name;
+    }
+    openSection = &Sections[iSection];
+
+    openStart.statements = globalTape.getUsedStatementsSize();
+    openStart.extFunc = nExtFunc;
+    openStart.memory = UsedMemory();
+    openStart.time = WallTime();
+  }
+
+  void EndSection() {
+    if (!openSection) return;
+
+    openSection->statements += globalTape.getUsedStatementsSize() - openStart.statements;
+    openSection->extFunc += nExtFunc - openStart.extFunc;
+    openSection->memory += UsedMemory() - openStart.memory;
+    openSection->time += WallTime() - openStart.time;
+    openSection = nullptr;
+  }
+
+  void PrintStatistics() {
+
+    globalTape.printStatistics();
+
+    if (Sections.empty()) return;
+
+#if CODI_INDEX_TAPE
+    const char* tape = "Jacobian, index reuse";
+#elif CODI_PRIMAL_TAPE
+    const char* tape = "primal value";
+#elif CODI_PRIMAL_INDEX_TAPE
+    const char* tape = "primal value, index reuse";
+#else
+    const char* tape = "Jacobian";
+#endif
+
+    /*--- The remainder of the tape is reported as "Other", the values are those of this rank. ---*/
+
+    CSection total;
+    total.name = "Total";
+    total.statements = globalTape.getUsedStatementsSize();
+    total.extFunc = nExtFunc;
+    total.memory = UsedMemory();
+    CSection other = total;
+    other.name = "Other";
+    for (const auto& section : Sections) {
+      other.statements -= section.statements;
+      other.extFunc -= section.extFunc;
+      other.memory -= section.memory;
+    }
+
+    std::cout << "\nTape of the recording (" << tape << " tape):\n";
+    std::cout << std::setw(24) << "Section" << std::setw(14) << "Statements" << std::setw(14) << "Memory [MB]"
+              << std::setw(12) << "Ext. func." << std::setw(12) << "Time [s]" << "\n";
+
+    auto PrintRow = [](const CSection& section, bool timed) {
+      std::cout << std::setw(24) << section.name << std::setw(14) << section.statements << std::setw(14)
+                << std::fixed << std::setprecision(2) << section.memory/(1024.0*1024.0) << std::setw(12) << section.extFunc;
+      if (timed) std::cout << std::setw(12) << std::setprecision(3) << section.time;
+      std::cout.unsetf(std::ios::floatfield);
+      std::cout << "\n";
+    };
+    for (const auto& section : Sections) PrintRow(section, true);
+    PrintRow(other, false);
+    PrintRow(total, false);
+    std::cout << std::endl;
+  }
+
 #endif
 }
@@ -334,10 +334,12 @@ CADTPointsOnlyClass::CADTPointsOnlyClass(unsigned short nDim,
   /*--- Build the tree. ---*/
   BuildADT(nDim, localPointIDs.size(), coorPoints.data());
 
-  /*--- Reserve the memory for frontLeaves and frontLeavesNew,
-        which are needed during the tree search. ---*/
-  frontLeaves.reserve(200);
-  frontLeavesNew.reserve(200);
+  /*--- Reserve the memory for frontLeaves and frontLeavesNew of every
+        thread, which are needed during the tree search. ---*/
+  FrontLeaves.resize(omp_get_max_threads());
+  FrontLeavesNew.resize(omp_get_max_threads());
+  for(auto& front : FrontLeaves)    front.reserve(200);
+  for(auto& front : FrontLeavesNew) front.reserve(200);
 }
 
 void CADTPointsOnlyClass::DetermineNearestNode(const su2double *coor,
@@ -345,6 +347,10 @@ void CADTPointsOnlyClass::DetermineNearestNode(const su2double *coor,
                                                unsigned long   &pointID,
                                                int             &rankID) {
 
+  /*--- Work vectors of this thread, which makes the search thread safe. ---*/
+  vector<unsigned long> &frontLeaves    = FrontLeaves[omp_get_thread_num()];
+  vector<unsigned long> &frontLeavesNew = FrontLeavesNew[omp_get_thread_num()];
+
   AD_BEGIN_PASSIVE
 
   /*--------------------------------------------------------------------------*/
@@ -478,6 +484,86 @@ void CADTPointsOnlyClass::DetermineNearestNode(const su2double *coor,
 
 }
 
+void CADTPointsOnlyClass::DetermineNodesInBall(const su2double       *coor,
+                                               const su2double       radius,
+                                               vector<unsigned long> &pointIDs) {
+
+  /*--- Work vectors of this thread, which makes the search thread safe. ---*/
+  vector<unsigned long> &frontLeaves    = FrontLeaves[omp_get_thread_num()];
+  vector<unsigned long> &frontLeavesNew = FrontLeavesNew[omp_get_thread_num()];
+
+  /*--- Initialize the list of nodes and return if the tree is empty. ---*/
+  pointIDs.clear();
+  if( isEmpty ) return;
+
+  AD_BEGIN_PASSIVE
+
+  /*--- The comparisons are carried out on the distance squared. ---*/
+  const su2double radius2 = radius*radius;
+
+  /*--- Exceptional case of a tree with a single node, for which both children
+        of the root leaf may refer to the same node. ---*/
+  if(coorPoints.size() == nDimADT) {
+    su2double dist = 0.0;
+    for(unsigned short l=0; l<nDimADT; ++l) {
+      const su2double ds = coor[l] - coorPoints[l];
+      dist += ds*ds;
+    }
+    if(dist <= radius2) pointIDs.push_back(0);
+  }
+  else {
+
+    /*--- Traverse the tree, starting at the root leaf. Leaves whose bounding
+          box does not intersect the ball are not visited. ---*/
+    frontLeaves.clear();
+    frontLeaves.push_back(0);
+
+    while( frontLeaves.size() ) {
+
+      frontLeavesNew.clear();
+      for(unsigned long i=0; i<frontLeaves.size(); ++i) {
+
+        const unsigned long ll = frontLeaves[i];
+        for(unsigned short mm=0; mm<2; ++mm) {
+
+          const unsigned long kk = leaves[ll].children[mm];
+          if( leaves[ll].childrenAreTerminal[mm] ) {
+
+            /*--- Child contains a node. Store it if it is inside the ball. ---*/
+            const su2double *coorTarget = coorPoints.data() + nDimADT*kk;
+            su2double dist = 0.0;
+            for(unsigned short l=0; l<nDimADT; ++l) {
+              const su2double ds = coor[l] - coorTarget[l];
+              dist += ds*ds;
+            }
+            if(dist <= radius2) pointIDs.push_back(kk);
+          }
+          else {
+
+            /*--- Child contains a leaf. Determine the possible minimum distance
+                  squared to that leaf and store it for the next round if the
+                  bounding box intersects the ball. ---*/
+            su2double posDist = 0.0;
+            for(unsigned short l=0; l<nDimADT; ++l) {
+              su2double ds = 0.0;
+              if(     coor[l] < leaves[kk].xMin[l]) ds = coor[l] - leaves[kk].xMin[l];
+              else if(coor[l] > leaves[kk].xMax[l]) ds = coor[l] - leaves[kk].xMax[l];
+
+              posDist += ds*ds;
+            }
+
+            if(posDist <= radius2) frontLeavesNew.push_back(kk);
+          }
+        }
+      }
+
+      frontLeaves = frontLeavesNew;
+    }
+  }
+
+  AD_END_PASSIVE
+}
+
 CADTElemClass::CADTElemClass(unsigned short         val_nDim,
                              vector<su2double>      &val_coor,
                              vector<unsigned long>  &val_connElem,
@@ -694,9 +780,12 @@ CADTElemClass::CADTElemClass(unsigned short         val_nDim,
 
   /*--- Reserve the memory for frontLeaves, frontLeavesNew and BBoxTargets,
         which are needed during the tree search. ---*/
-  frontLeaves.reserve(200);
-  frontLeavesNew.reserve(200);
-  BBoxTargets.reserve(200);
+  FrontLeaves.resize(omp_get_max_threads());
+  FrontLeavesNew.resize(omp_get_max_threads());
+  ThreadBBoxTargets.resize(omp_get_max_threads());
+  for(auto& front : FrontLeaves)    front.reserve(200);
+  for(auto& front : FrontLeavesNew) front.reserve(200);
+  for(auto& boxes : ThreadBBoxTargets) boxes.reserve(200);
 }
 
 bool CADTElemClass::DetermineContainingElement(const su2double *coor,
@@ -706,6 +795,10 @@ bool CADTElemClass::DetermineContainingElement(const su2double *coor,
                                                su2double       *parCoor,
                                                su2double       *weightsInterpol) {
 
+  /*--- Work vectors of this thread, which makes the search thread safe. ---*/
+  vector<unsigned long> &frontLeaves    = FrontLeaves[omp_get_thread_num()];
+  vector<unsigned long> &frontLeavesNew = FrontLeavesNew[omp_get_thread_num()];
+
   /* Start at the root leaf of the ADT, i.e. initialize frontLeaves such that
      it only contains the root leaf. Make sure to wipe out any data from a
      previous search. */
@@ -791,6 +884,11 @@ void CADTElemClass::DetermineNearestElement(const su2double *coor,
                                             unsigned long   &elemID,
                                             int             &rankID) {
 
+  /*--- Work vectors of this thread, which makes the search thread safe. ---*/
+  vector<unsigned long> &frontLeaves    = FrontLeaves[omp_get_thread_num()];
+  vector<unsigned long> &frontLeavesNew = FrontLeavesNew[omp_get_thread_num()];
+  vector<CBBoxTargetClass> &BBoxTargets = ThreadBBoxTargets[omp_get_thread_num()];
+
   AD_BEGIN_PASSIVE
 
   /*----------------------------------------------------------------------------*/
@@ -27,7 +27,9 @@
  */
 
 #include "../include/blas_structure.hpp"
+#include "../include/omp_structure.hpp"
 #include <cstring>
+#include <chrono>
 
 /* MKL or BLAS, if supported. */
 #if (defined (HAVE_MKL) || defined(HAVE_BLAS)) && !(defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
@@ -46,7 +48,7 @@ extern "C" void dgemv_(char*, const int*, const int*, const passivedouble*,
 /* Constructor. Initialize the const member variables, if needed. */
 CBlasStructure::CBlasStructure(void)
 #if !(defined(HAVE_LIBXSMM) || defined(HAVE_BLAS) || defined(HAVE_MKL)) || (defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
-  : mc (256), kc (128), nc (128) 
+  : mc (256), kc (128), nc (128), tuningThreads(omp_get_max_threads())
 #endif
 {}
 
@@ -58,6 +60,18 @@ void CBlasStructure::gemm(const int M,        const int N,        const int K,
                           const su2double *A, const su2double *B, su2double *C,
                           CConfig *config) {
 
+  /* A single product is a batch of size one. */
+  gemm_batch(M, N, K, 1, A, 0, B, 0, C, 0, config);
+}
+
+/* Batch of dense matrix multiplications of the same shape. */
+void CBlasStructure::gemm_batch(const int M,        const int N,       const int K,
+                                const int nBatch,
+                                const su2double *A, const int strideA,
+                                const su2double *B, const int strideB,
+                                su2double *C,       const int strideC,
+                                CConfig *config) {
+
   /* Initialize the variable for the timing, if profiling is active. */
 #ifdef PROFILE
   double timeGemm;
@@ -65,36 +79,40 @@ void CBlasStructure::gemm(const int M,        const int N,        const int K,
 #endif
 
 #if (defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)) || !(defined(HAVE_LIBXSMM) || defined(HAVE_MKL) || defined(HAVE_BLAS))
-  /* Native implementation of the matrix product. This optimized implementation
-     assumes that the matrices are in column major order. This can be
-     accomplished by swapping N and M and A and B. This implementation is based
-     on https://github.com/flame/how-to-optimize-gemm. */
-  gemm_imp(N, M, K, B, A, C);
+  /* Native implementation of the matrix products, with the kernel
+     selected by the autotuner. */
+  gemm_native(M, N, K, nBatch, A, strideA, B, strideB, C, strideC);
 
 #else
+  for(int iBatch=0; iBatch<nBatch; ++iBatch) {
+    const su2double *AA = A + iBatch*strideA;
+    const su2double *BB = B + iBatch*strideB;
+    su2double       *CC = C + iBatch*strideC;
+
 #ifdef HAVE_LIBXSMM
 
-  /* The gemm function of libxsmm is used to carry out the multiplication.
-     Note that libxsmm_gemm expects the matrices in column major order. That's
-     why the in the calling sequence A and B and M and N are reversed. */
-  su2double alpha = 1.0;
-  su2double beta  = 0.0;
-  char trans = 'N';
+    /* The gemm function of libxsmm is used to carry out the multiplication.
+       Note that libxsmm_gemm expects the matrices in column major order. That's
+       why the in the calling sequence A and B and M and N are reversed. */
+    su2double alpha = 1.0;
+    su2double beta  = 0.0;
+    char trans = 'N';
 
-  libxsmm_dgemm(&trans, &trans, &N, &M, &K, &alpha, B, &N, A, &K, &beta, C, &N);
+    libxsmm_dgemm(&trans, &trans, &N, &M, &K, &alpha, BB, &N, AA, &K, &beta, CC, &N);
 
 #else // MKL and BLAS
 
-  /* The standard blas routine dgemm is used for the multiplication.
-     Call dgemm without transposing the matrices. In that case dgemm expects
-     the matrices in column major order, see the comments for libxsmm. */
-  su2double alpha = 1.0;
-  su2double beta  = 0.0;
-  char trans = 'N';
+    /* The standard blas routine dgemm is used for the multiplication.
+       Call dgemm without transposing the matrices. In that case dgemm expects
+       the matrices in column major order, see the comments for libxsmm. */
+    su2double alpha = 1.0;
+    su2double beta  = 0.0;
+    char trans = 'N';
 
-  dgemm_(&trans, &trans, &N, &M, &K, &alpha, B, &N, A, &K, &beta, C, &N);
+    dgemm_(&trans, &trans, &N, &M, &K, &alpha, BB, &N, AA, &K, &beta, CC, &N);
 
 #endif
+  }
 #endif
 
   /* Store the profiling information, if needed. */
@@ -143,9 +161,59 @@ void CBlasStructure::gemv(const int M,        const int N,   const su2double *A,
 #define B(i, j) b[(j)*ldb + (i)]
 #define C(i, j) c[(j)*ldc + (i)]
 
+/* Native implementation of a batch of products, with autotuning of the kernel. */
+void CBlasStructure::gemm_native(const int M,        const int N,       const int K,
+                                 const int nBatch,
+                                 const su2double *A, const int strideA,
+                                 const su2double *B, const int strideB,
+                                 su2double *C,       const int strideC) {
+
+  /* The optimized implementation assumes that the matrices are in column major
+     order. This can be accomplished by swapping N and M and A and B. This
+     implementation is based on https://github.com/flame/how-to-optimize-gemm. */
+  auto carryOutBatch = [&](const int kernel) {
+    for(int iBatch=0; iBatch<nBatch; ++iBatch)
+      gemm_imp(N, M, K, B + iBatch*strideB, A + iBatch*strideA, C + iBatch*strideC, kernel);
+  };
+
+  /* The tuning data is stored per thread, such that no synchronization is needed.
+     Threads outside the range (e.g. nested parallelism) use the default kernel. */
+  const int thread = omp_get_thread_num();
+  if(thread >= (int) tuningThreads.size()) {
+    carryOutBatch(GEMM_KERNEL_REG4X4);
+    return;
+  }
+
+  CGemmTuning &tuning = tuningThreads[thread][make_tuple(M, N, K)];
+
+  if(tuning.kernel >= 0) {
+    carryOutBatch(tuning.kernel);
+    return;
+  }
+
+  /* Still tuning this shape, cycle through the kernels and time the actual
+     products (all kernels give the same result, so nothing is wasted). */
+  const int kernel = tuning.nCalls%N_GEMM_KERNELS;
+
+  const auto start = chrono::steady_clock::now();
+  carryOutBatch(kernel);
+  const double time = chrono::duration<double>(chrono::steady_clock::now() - start).count()/nBatch;
+
+  if(tuning.nCalls < N_GEMM_KERNELS) tuning.minTime[kernel] = time;
+  else tuning.minTime[kernel] = min(tuning.minTime[kernel], time);
+
+  /* Select the fastest kernel when all kernels have been timed enough. */
+  if(++tuning.nCalls == nTrialsTuning*N_GEMM_KERNELS) {
+    tuning.kernel = 0;
+    for(int i=1; i<N_GEMM_KERNELS; ++i)
+      if(tuning.minTime[i] < tuning.minTime[tuning.kernel]) tuning.kernel = i;
+  }
+}
+
 /* Function, which perform the implementation of the gemm functionality.  */
 void CBlasStructure::gemm_imp(const int m,        const int n,        const int k,
-                              const su2double *a, const su2double *b, su2double *c) {
+                              const su2double *a, const su2double *b, su2double *c,
+                              const int kernel) {
 
   /* Initialize the elements of c to zero. */
   memset(c, 0, m*n*sizeof(su2double));
@@ -165,7 +233,7 @@ void CBlasStructure::gemm_imp(const int m,        const int n,        const int
         int ib = min(m-i, mc);
 
         /* Carry out the multiplication for this block. */
-        gemm_inner(ib, jb, pb, &A(i, p), lda, &B(p, j), ldb, &C(i, j), ldc);
+        gemm_inner(ib, jb, pb, &A(i, p), lda, &B(p, j), ldb, &C(i, j), ldc, kernel);
       }
     }
   }
@@ -174,11 +242,57 @@ void CBlasStructure::gemm_imp(const int m,        const int n,        const int
 /* Compute a portion of the c matrix one block at a time.
    Handle ragged edges with calls to a slow but general function. */
 void CBlasStructure::gemm_inner(int m, int n, int k, const su2double *a, int lda,
-                                const su2double *b, int ldb, su2double *c, int ldc) {
+                                const su2double *b, int ldb, su2double *c, int ldc,
+                                const int kernel) {
+
+  /* Carry out the multiplication for this block with the selected kernel. */
+  switch( kernel ) {
+    case GEMM_KERNEL_REG4X4:
+      gemm_register_blocked<4,4>(m, n, k, a, lda, b, ldb, c, ldc);
+      break;
+    case GEMM_KERNEL_REG8X4:
+      gemm_register_blocked<8,4>(m, n, k, a, lda, b, ldb, c, ldc);
+      break;
+    default:
+      gemm_arbitrary(m, n, k, a, lda, b, ldb, c, ldc);
+      break;
+  }
+}
+
+/* Register blocked kernel. The entries of c are loaded, updated in the same
+   order (increasing p) as gemm_arbitrary and stored again. */
+template<int MR, int NR>
+void CBlasStructure::gemm_register_blocked(int m, int n, int k, const su2double *a, int lda,
+                                           const su2double *b, int ldb, su2double *c, int ldc) {
+  int j = 0;
+  for(; j+NR<=n; j+=NR) {
+    int i = 0;
+    for(; i+MR<=m; i+=MR) {
+
+      su2double cReg[NR][MR];
+      for(int jj=0; jj<NR; ++jj)
+        for(int ii=0; ii<MR; ++ii)
+          cReg[jj][ii] = C(i+ii, j+jj);
+
+      for(int p=0; p<k; ++p) {
+        for(int jj=0; jj<NR; ++jj) {
+          const su2double bpj = B(p, j+jj);
+          for(int ii=0; ii<MR; ++ii)
+            cReg[jj][ii] += A(i+ii, p) * bpj;
+        }
+      }
+
+      for(int jj=0; jj<NR; ++jj)
+        for(int ii=0; ii<MR; ++ii)
+          C(i+ii, j+jj) = cReg[jj][ii];
+    }
+
+    /* Remaining rows of this panel of columns. */
+    if(i < m) gemm_arbitrary(m-i, NR, k, &A(i, 0), lda, &B(0, j), ldb, &C(i, j), ldc);
+  }
 
-  /* Carry out the multiplication for this block. At the
-     moment simply a call to gemm_arbitrary. */
-  gemm_arbitrary(m, n, k, a, lda, b, ldb, c, ldc);
+  /* Remaining columns. */
+  if(j < n) gemm_arbitrary(m, n-j, k, a, lda, &B(0, j), ldb, &C(0, j), ldc);
 }
 
 /* Naive gemm implementation to handle arbitrary sized matrices. */
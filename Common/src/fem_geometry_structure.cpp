@@ -322,6 +322,9 @@ void CSurfaceElementFEM::Copy(const CSurfaceElementFEM &other) {
   nIntPerWallFunctionDonor = other.nIntPerWallFunctionDonor;
   intPerWallFunctionDonor  = other.intPerWallFunctionDonor;
   matWallFunctionDonor     = other.matWallFunctionDonor;
+
+  wallModelData         = other.wallModelData;
+  nWallModelEvaluations = other.nWallModelEvaluations;
 }
 
 CMeshFEM::CMeshFEM(CGeometry *geometry, CConfig *config) {
@@ -6409,6 +6412,10 @@ void CMeshFEM_DG::WallFunctionPreprocessing(CConfig *config) {
 
             surfElem[l].nIntPerWallFunctionDonor.push_back(nInt);
 
+            /* Allocate the memory to store the wall model data in the integration
+               points. A zero wall shear stress means that no initial guess is present. */
+            surfElem[l].wallModelData.assign(4*nInt, 0.0);
+
             /* Determine whether or not halo information is needed to apply
                the boundary conditions for this surface. If needed, set
                haloInfoNeededForBC of the boundary to true. As DonorsWallFunction
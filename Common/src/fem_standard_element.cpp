@@ -2090,6 +2090,14 @@ CFEMStandardElement::CFEMStandardElement(unsigned short          val_VTK_Type,
       mat2ndDerBasisIntPoint = mat2ndDerBasisIntPoint + offsetDerInt;
     }
   }
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Create the 1D data for the sum factorization of the volume terms   ---*/
+  /*--- of quadrilaterals and hexahedra.                                   ---*/
+  /*--------------------------------------------------------------------------*/
+
+  if((VTK_Type == QUADRILATERAL) || (VTK_Type == HEXAHEDRON))
+    CreateDataSumFactorization();
 }
 
 void CFEMStandardElement::BasisFunctionsInPoint(const su2double   *parCoor,
@@ -2223,6 +2231,109 @@ void CFEMStandardElement::BasisFunctionsAndDerivativesInPoint(
     MatMulRowMajor(nDOFs, 1, VDr[i], matVandermondeInv, dLagBasis[i]);
 }
 
+unsigned long CFEMStandardElement::GetSizeWorkSumFactorization(void) const {
+
+  /* Four arrays of the largest tensor size, two for the intermediate results of
+     the sweeps and two for the fluxes and residual of a parametric direction. */
+  if( !sumFactorization ) return 0;
+
+  const unsigned long nMax1D = max(nDOFs1D, nInt1D);
+  unsigned long sizeTensor   = nMax1D*nMax1D;
+  if(VTK_Type == HEXAHEDRON) sizeTensor *= nMax1D;
+
+  return 4*sizeTensor;
+}
+
+void CFEMStandardElement::SumFactSolAndGradIntegration(const unsigned short N,
+                                                       const bool           computeGrad,
+                                                       const su2double      *solDOFs,
+                                                       su2double            *solAndGradInt,
+                                                       su2double            *work,
+                                                       CBlasStructure       *blasFunctions,
+                                                       CConfig              *config) const {
+
+  /* Easier storage of the 1D matrices, in the integration points. */
+  const su2double *A = lagBasisInt1D.data();
+  const su2double *D = derLagBasisInt1D.data();
+
+  /* The solution is interpolated with the basis functions in all directions. */
+  SumFactTensorProduct(N, nInt1D, nDOFs1D, A, A, A, solDOFs, solAndGradInt,
+                       work, blasFunctions, config);
+  if( !computeGrad ) return;
+
+  /* The derivative in a parametric direction uses the derivatives of the basis
+     functions in that direction. The blocks are stored in the same order as in
+     matBasisIntegration, i.e. the r-, s- and t-derivatives follow the solution. */
+  const unsigned long offsetDer = nIntegration*N;
+
+  SumFactTensorProduct(N, nInt1D, nDOFs1D, D, A, A, solDOFs, solAndGradInt + offsetDer,
+                       work, blasFunctions, config);
+  SumFactTensorProduct(N, nInt1D, nDOFs1D, A, D, A, solDOFs, solAndGradInt + 2*offsetDer,
+                       work, blasFunctions, config);
+
+  if(VTK_Type == HEXAHEDRON)
+    SumFactTensorProduct(N, nInt1D, nDOFs1D, A, A, D, solDOFs, solAndGradInt + 3*offsetDer,
+                         work, blasFunctions, config);
+}
+
+void CFEMStandardElement::SumFactResidualFluxes(const unsigned short N,
+                                                const su2double      *fluxes,
+                                                su2double            *res,
+                                                su2double            *work,
+                                                CBlasStructure       *blasFunctions,
+                                                CConfig              *config) const {
+
+  /* Easier storage of the transposed 1D matrices and the number of dimensions. */
+  const su2double *AT = lagBasisInt1DTrans.data();
+  const su2double *DT = derLagBasisInt1DTrans.data();
+  const unsigned short nDim = (VTK_Type == HEXAHEDRON) ? 3 : 2;
+
+  /* Set the pointers for the fluxes and residual of a single parametric direction,
+     which are stored after the work space of the tensor products. */
+  const unsigned long sizeTensor = GetSizeWorkSumFactorization()/4*N;
+  su2double *fluxDir = work    + 2*sizeTensor;
+  su2double *resDir  = fluxDir +   sizeTensor;
+
+  /* Loop over the parametric directions. */
+  for(unsigned short iDim=0; iDim<nDim; ++iDim) {
+
+    /* Copy the fluxes in this direction into contiguous memory. */
+    for(unsigned short i=0; i<nIntegration; ++i)
+      memcpy(fluxDir + i*N, fluxes + (i*nDim+iDim)*N, N*sizeof(su2double));
+
+    /* The derivative of the basis functions is only taken in this direction. */
+    const su2double *matR = (iDim == 0) ? DT : AT;
+    const su2double *matS = (iDim == 1) ? DT : AT;
+    const su2double *matT = (iDim == 2) ? DT : AT;
+
+    /* Apply the transposed 1D matrices. The first direction is stored in
+       res directly, the others are added to it. */
+    if(iDim == 0) {
+      SumFactTensorProduct(N, nDOFs1D, nInt1D, matR, matS, matT, fluxDir, res,
+                           work, blasFunctions, config);
+    }
+    else {
+      SumFactTensorProduct(N, nDOFs1D, nInt1D, matR, matS, matT, fluxDir, resDir,
+                           work, blasFunctions, config);
+      for(unsigned long i=0; i<((unsigned long) nDOFs)*N; ++i)
+        res[i] += resDir[i];
+    }
+  }
+}
+
+void CFEMStandardElement::SumFactResidualSources(const unsigned short N,
+                                                 const su2double      *sources,
+                                                 su2double            *res,
+                                                 su2double            *work,
+                                                 CBlasStructure       *blasFunctions,
+                                                 CConfig              *config) const {
+
+  /* The source terms are multiplied with the transposed basis functions in all directions. */
+  const su2double *AT = lagBasisInt1DTrans.data();
+  SumFactTensorProduct(N, nDOFs1D, nInt1D, AT, AT, AT, sources, res,
+                       work, blasFunctions, config);
+}
+
 bool CFEMStandardElement::SameStandardElement(unsigned short val_VTK_Type,
                                               unsigned short val_nPoly,
                                               bool           val_constJac) {
@@ -2275,6 +2386,160 @@ void CFEMStandardElement::Copy(const CFEMStandardElement &other) {
   matDerBasisSolDOFs  = other.matDerBasisSolDOFs;
   matDerBasisOwnDOFs  = other.matDerBasisOwnDOFs;
   mat2ndDerBasisInt   = other.mat2ndDerBasisInt;
+
+  sumFactorization = other.sumFactorization;
+  nDOFs1D          = other.nDOFs1D;
+  nInt1D           = other.nInt1D;
+
+  lagBasisInt1D         = other.lagBasisInt1D;
+  derLagBasisInt1D      = other.derLagBasisInt1D;
+  lagBasisInt1DTrans    = other.lagBasisInt1DTrans;
+  derLagBasisInt1DTrans = other.derLagBasisInt1DTrans;
+}
+
+void CFEMStandardElement::CreateDataSumFactorization(void) {
+
+  /*--- The sum factorization reduces the cost of the volume terms from
+        O(p^(2*nDim)) to O(p^(nDim+1)). For low polynomial degrees the
+        overhead of the many small matrix products does not pay off, hence
+        it is only used from polynomial degree 3 onwards. ---*/
+  const unsigned short nDim = (VTK_Type == HEXAHEDRON) ? 3 : 2;
+  sumFactorization = (nPoly >= 3);
+  if( !sumFactorization ) return;
+
+  /*--- The DOFs of the standard element are equidistant and the integration
+        points are a tensor product of the 1D Gauss-Legendre points (Gauss-Jacobi
+        with alpha = beta = 0). In both cases the r-index runs fastest, hence the
+        1D locations are the first entries of the r-coordinates. ---*/
+  nDOFs1D = nPoly+1;
+  nInt1D  = orderExact/2 + 1;
+
+  unsigned long nIntTensor = nInt1D*nInt1D;
+  if(nDim == 3) nIntTensor *= nInt1D;
+  if(nIntTensor != nIntegration)
+    SU2_MPI::Error("Integration rule is not a tensor product", CURRENT_FUNCTION);
+
+  vector<su2double> rDOFs1D(rDOFs.begin(), rDOFs.begin()+nDOFs1D);
+  vector<su2double> rInt1D(rIntegration.begin(), rIntegration.begin()+nInt1D);
+
+  /*--- Compute the 1D Lagrangian basis functions and their derivatives in the
+        1D integration points, row major, i.e. the DOFs run fastest. ---*/
+  lagBasisInt1D.resize(nInt1D*nDOFs1D);
+  derLagBasisInt1D.resize(nInt1D*nDOFs1D);
+
+  for(unsigned short a=0; a<nInt1D; ++a) {
+    for(unsigned short i=0; i<nDOFs1D; ++i) {
+
+      su2double lag = 1.0, derLag = 0.0;
+      for(unsigned short m=0; m<nDOFs1D; ++m) {
+        if(m == i) continue;
+        const su2double denInv = 1.0/(rDOFs1D[i] - rDOFs1D[m]);
+
+        /* Product rule for the derivative. */
+        derLag = derLag*(rInt1D[a] - rDOFs1D[m])*denInv + lag*denInv;
+        lag   *= (rInt1D[a] - rDOFs1D[m])*denInv;
+      }
+
+      lagBasisInt1D[a*nDOFs1D+i]    = lag;
+      derLagBasisInt1D[a*nDOFs1D+i] = derLag;
+    }
+  }
+
+  /*--- Create the transposed matrices, needed for the residuals. ---*/
+  lagBasisInt1DTrans.resize(nDOFs1D*nInt1D);
+  derLagBasisInt1DTrans.resize(nDOFs1D*nInt1D);
+
+  for(unsigned short i=0; i<nDOFs1D; ++i) {
+    for(unsigned short a=0; a<nInt1D; ++a) {
+      lagBasisInt1DTrans[i*nInt1D+a]    = lagBasisInt1D[a*nDOFs1D+i];
+      derLagBasisInt1DTrans[i*nInt1D+a] = derLagBasisInt1D[a*nDOFs1D+i];
+    }
+  }
+
+  /*--- Check the 1D data against the basis functions and the derivatives of
+        the full element, which are computed via the Vandermonde matrix. ---*/
+  const unsigned short nIntT  = (nDim == 3) ? nInt1D  : 1;
+  const unsigned short nDOFsT = (nDim == 3) ? nDOFs1D : 1;
+
+  unsigned long ii = 0;
+  for(unsigned short c=0; c<nIntT; ++c) {
+    for(unsigned short b=0; b<nInt1D; ++b) {
+      for(unsigned short a=0; a<nInt1D; ++a, ++ii) {
+
+        unsigned long jj = 0;
+        for(unsigned short k=0; k<nDOFsT; ++k) {
+          const su2double lagT = (nDim == 3) ? lagBasisInt1D[c*nDOFs1D+k]    : 1.0;
+          const su2double derT = (nDim == 3) ? derLagBasisInt1D[c*nDOFs1D+k] : 0.0;
+
+          for(unsigned short j=0; j<nDOFs1D; ++j) {
+            const su2double lagS = lagBasisInt1D[b*nDOFs1D+j];
+            const su2double derS = derLagBasisInt1D[b*nDOFs1D+j];
+
+            for(unsigned short i=0; i<nDOFs1D; ++i, ++jj) {
+              const su2double lagR = lagBasisInt1D[a*nDOFs1D+i];
+              const su2double derR = derLagBasisInt1D[a*nDOFs1D+i];
+              const unsigned long ind = ii*nDOFs + jj;
+
+              su2double dev = fabs(lagR*lagS*lagT - lagBasisIntegration[ind])
+                            + fabs(derR*lagS*lagT - drLagBasisIntegration[ind])
+                            + fabs(lagR*derS*lagT - dsLagBasisIntegration[ind]);
+              if(nDim == 3) dev += fabs(lagR*lagS*derT - dtLagBasisIntegration[ind]);
+
+              if(dev > 1.e-6)
+                SU2_MPI::Error("Difference is too large to be caused by roundoff", CURRENT_FUNCTION);
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+void CFEMStandardElement::SumFactTensorProduct(const unsigned short N,
+                                               const unsigned short nOut,
+                                               const unsigned short nIn,
+                                               const su2double      *matR,
+                                               const su2double      *matS,
+                                               const su2double      *matT,
+                                               const su2double      *dataIn,
+                                               su2double            *dataOut,
+                                               su2double            *work,
+                                               CBlasStructure       *blasFunctions,
+                                               CConfig              *config) const {
+
+  /*--- The data is stored with the r-index running fastest (after the N columns),
+        followed by the s- and t-index. Applying a 1D matrix in a direction then
+        amounts to a batch of matrix products, one for every combination of the
+        slower indices, in which the faster indices and the columns form the
+        columns of the product. All matrix products write contiguous memory. ---*/
+  const unsigned long nInN  = nIn*N;
+  const unsigned long nOutN = nOut*N;
+
+  if(VTK_Type == HEXAHEDRON) {
+
+    /* t-direction: (nIn,nIn,nIn) -> (nOut,nIn,nIn), a single product. */
+    su2double *tmpT = work;
+    blasFunctions->gemm(nOut, nIn*nInN, nIn, matT, dataIn, tmpT, config);
+
+    /* s-direction: (nOut,nIn,nIn) -> (nOut,nOut,nIn), one product per t-index. */
+    su2double *tmpS = tmpT + nOut*nIn*nInN;
+    blasFunctions->gemm_batch(nOut, nInN, nIn, nOut, matS, 0, tmpT, nIn*nInN,
+                              tmpS, nOut*nInN, config);
+
+    /* r-direction: (nOut,nOut,nIn) -> (nOut,nOut,nOut), one product per (s,t)-index. */
+    blasFunctions->gemm_batch(nOut, N, nIn, nOut*nOut, matR, 0, tmpS, nInN,
+                              dataOut, nOutN, config);
+  }
+  else {
+
+    /* s-direction: (nIn,nIn) -> (nOut,nIn), a single product. */
+    su2double *tmpS = work;
+    blasFunctions->gemm(nOut, nInN, nIn, matS, dataIn, tmpS, config);
+
+    /* r-direction: (nOut,nIn) -> (nOut,nOut), one product per s-index. */
+    blasFunctions->gemm_batch(nOut, N, nIn, nOut, matR, 0, tmpS, nInN,
+                              dataOut, nOutN, config);
+  }
 }
 
 void CFEMStandardElement::CreateBasisFunctionsAndMatrixDerivatives(
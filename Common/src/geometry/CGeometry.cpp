@@ -28,6 +28,11 @@
 #include "../../include/geometry/CGeometry.hpp"
 #include "../../include/geometry/elements/CElement.hpp"
 #include "../../include/omp_structure.hpp"
+#include "../../include/toolboxes/CRegionProfiler.hpp"
+
+#include <chrono>
+#include <map>
+#include <set>
 
 /*--- Cross product ---*/
 
@@ -102,6 +107,20 @@ CGeometry::CGeometry(void) {
   req_P2PSend = NULL;
   req_P2PRecv = NULL;
 
+  kindP2PComms = ISEND_IRECV_COMMS;
+
+#ifdef HAVE_MPI_NEIGHBOR
+  comm_P2PNeighbor[0] = MPI_COMM_NULL;
+  comm_P2PNeighbor[1] = MPI_COMM_NULL;
+  iMessage_P2PNeighbor = 0;
+#endif
+
+#ifdef HAVE_MPI_P2P_EXTFUNC
+  extFunc_P2P = false;
+  reverse_P2P = false;
+  iMessage_P2PExtFunc = 0;
+#endif
+
   nPoint_P2PSend = NULL;
   nPoint_P2PRecv = NULL;
 
@@ -237,6 +256,13 @@ CGeometry::~CGeometry(void) {
   if (req_P2PSend != NULL) delete [] req_P2PSend;
   if (req_P2PRecv != NULL) delete [] req_P2PRecv;
 
+  FreePersistentP2PComms();
+
+#ifdef HAVE_MPI_NEIGHBOR
+  for (auto& comm : comm_P2PNeighbor)
+    if (comm != MPI_COMM_NULL) SU2_MPI::Comm_free(&comm);
+#endif
+
   if (nPoint_P2PRecv != NULL) delete [] nPoint_P2PRecv;
   if (nPoint_P2PSend != NULL) delete [] nPoint_P2PSend;
 
@@ -470,12 +496,168 @@ void CGeometry::PreprocessP2PComms(CGeometry *geometry,
     }
   }
 
+  /*--- Select the implementation of the comms, persistent requests are
+   created on demand (they depend on the buffers) but the graph communicators
+   of the neighborhood collective are created here. The collective requires
+   every rank to take part in all exchanges, otherwise we fall back to
+   persistent requests. The AD wrappers only support non-blocking comms, in
+   reverse AD the persistent option instead tapes each su2double exchange as
+   one external function (see PostP2PRecvs). ---*/
+
+  kindP2PComms = ISEND_IRECV_COMMS;
+
+#if defined HAVE_MPI_PERSISTENT || defined HAVE_MPI_P2P_EXTFUNC
+  kindP2PComms = config->GetKind_P2P_Comms();
+#endif
+
+#ifdef HAVE_MPI_NEIGHBOR
+  if (kindP2PComms == NEIGHBOR_COMMS) {
+
+    int allNeighbors = 0, myNeighbors = (nP2PSend > 0) && (nP2PRecv > 0);
+    SU2_MPI::Allreduce(&myNeighbors, &allNeighbors, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+
+    if (allNeighbors) {
+      for (auto& comm : comm_P2PNeighbor)
+        if (comm != MPI_COMM_NULL) SU2_MPI::Comm_free(&comm);
+
+      SU2_MPI::Dist_graph_create_adjacent(MPI_COMM_WORLD, nP2PRecv, Neighbors_P2PRecv,
+                                          nP2PSend, Neighbors_P2PSend, &comm_P2PNeighbor[0]);
+      SU2_MPI::Dist_graph_create_adjacent(MPI_COMM_WORLD, nP2PSend, Neighbors_P2PSend,
+                                          nP2PRecv, Neighbors_P2PRecv, &comm_P2PNeighbor[1]);
+      counts_P2PNeighbor.resize(2*(nP2PSend+nP2PRecv));
+    }
+    else {
+      kindP2PComms = PERSISTENT_COMMS;
+    }
+  }
+#else
+  if (kindP2PComms == NEIGHBOR_COMMS) kindP2PComms = PERSISTENT_COMMS;
+#endif
+
   /*--- In the future, some additional data structures could be created
    here to separate the interior and boundary nodes in order to help
    further overlap computation and communication. ---*/
 
 }
 
+void CGeometry::SetPersistentP2PComms(unsigned short commType, bool val_reverse) {
+
+#ifdef HAVE_MPI_PERSISTENT
+
+  if ((commType != COMM_TYPE_DOUBLE) && (commType != COMM_TYPE_UNSIGNED_SHORT))
+    SU2_MPI::Error("Unrecognized data type for point-to-point MPI comms.", CURRENT_FUNCTION);
+
+  const bool isDouble = (commType == COMM_TYPE_DOUBLE);
+
+  /*--- In reverse, the send structures define the recvs and vice-versa,
+   see PostP2PRecvs and PostP2PSends for the non-persistent version. ---*/
+
+  const int nRecv = val_reverse? nP2PSend : nP2PRecv;
+  const int nSend = val_reverse? nP2PRecv : nP2PSend;
+  const int *nPointRecv = val_reverse? nPoint_P2PSend : nPoint_P2PRecv;
+  const int *nPointSend = val_reverse? nPoint_P2PRecv : nPoint_P2PSend;
+  const int *source = val_reverse? Neighbors_P2PSend : Neighbors_P2PRecv;
+  const int *dest = val_reverse? Neighbors_P2PRecv : Neighbors_P2PSend;
+
+  su2double *bufDRecv = val_reverse? bufD_P2PSend : bufD_P2PRecv;
+  su2double *bufDSend = val_reverse? bufD_P2PRecv : bufD_P2PSend;
+  unsigned short *bufSRecv = val_reverse? bufS_P2PSend : bufS_P2PRecv;
+  unsigned short *bufSSend = val_reverse? bufS_P2PRecv : bufS_P2PSend;
+
+  auto& recvReq = persReq_P2PRecv[isDouble][val_reverse];
+  auto& sendReq = persReq_P2PSend[isDouble][val_reverse];
+
+  recvReq.resize(nRecv);
+  for (int iRecv = 0; iRecv < nRecv; iRecv++) {
+    const int offset = countPerPoint*nPointRecv[iRecv];
+    const int count = countPerPoint*(nPointRecv[iRecv+1] - nPointRecv[iRecv]);
+    const int tag = source[iRecv] + 1;
+    if (isDouble)
+      SU2_MPI::Recv_init(&bufDRecv[offset], count, MPI_DOUBLE, source[iRecv], tag,
+                         MPI_COMM_WORLD, &recvReq[iRecv]);
+    else
+      SU2_MPI::Recv_init(&bufSRecv[offset], count, MPI_UNSIGNED_SHORT, source[iRecv], tag,
+                         MPI_COMM_WORLD, &recvReq[iRecv]);
+  }
+
+  sendReq.resize(nSend);
+  for (int iSend = 0; iSend < nSend; iSend++) {
+    const int offset = countPerPoint*nPointSend[iSend];
+    const int count = countPerPoint*(nPointSend[iSend+1] - nPointSend[iSend]);
+    const int tag = rank + 1;
+    if (isDouble)
+      SU2_MPI::Send_init(&bufDSend[offset], count, MPI_DOUBLE, dest[iSend], tag,
+                         MPI_COMM_WORLD, &sendReq[iSend]);
+    else
+      SU2_MPI::Send_init(&bufSSend[offset], count, MPI_UNSIGNED_SHORT, dest[iSend], tag,
+                         MPI_COMM_WORLD, &sendReq[iSend]);
+  }
+
+#endif
+}
+
+void CGeometry::FreePersistentP2PComms() {
+
+#ifdef HAVE_MPI_PERSISTENT
+  for (int iType = 0; iType < 2; iType++) {
+    for (int iDir = 0; iDir < 2; iDir++) {
+      for (auto& req : persReq_P2PSend[iType][iDir]) SU2_MPI::Request_free(&req);
+      for (auto& req : persReq_P2PRecv[iType][iDir]) SU2_MPI::Request_free(&req);
+      persReq_P2PSend[iType][iDir].clear();
+      persReq_P2PRecv[iType][iDir].clear();
+    }
+  }
+#endif
+}
+
+void CGeometry::StartP2PNeighborComms(unsigned short commType, bool val_reverse) {
+
+#ifdef HAVE_MPI_NEIGHBOR
+
+  /*--- The blocks of the collective are ordered as the sources and
+   destinations of the graph communicator, i.e. as the messages. ---*/
+
+  const int nRecv = val_reverse? nP2PSend : nP2PRecv;
+  const int nSend = val_reverse? nP2PRecv : nP2PSend;
+  const int *nPointRecv = val_reverse? nPoint_P2PSend : nPoint_P2PRecv;
+  const int *nPointSend = val_reverse? nPoint_P2PRecv : nPoint_P2PSend;
+
+  int *sendCounts = counts_P2PNeighbor.data();
+  int *sendDispls = sendCounts + nSend;
+  int *recvCounts = sendDispls + nSend;
+  int *recvDispls = recvCounts + nRecv;
+
+  for (int iSend = 0; iSend < nSend; iSend++) {
+    sendCounts[iSend] = countPerPoint*(nPointSend[iSend+1] - nPointSend[iSend]);
+    sendDispls[iSend] = countPerPoint*nPointSend[iSend];
+  }
+  for (int iRecv = 0; iRecv < nRecv; iRecv++) {
+    recvCounts[iRecv] = countPerPoint*(nPointRecv[iRecv+1] - nPointRecv[iRecv]);
+    recvDispls[iRecv] = countPerPoint*nPointRecv[iRecv];
+  }
+
+  switch (commType) {
+    case COMM_TYPE_DOUBLE:
+      SU2_MPI::Ineighbor_alltoallv(val_reverse? bufD_P2PRecv : bufD_P2PSend, sendCounts, sendDispls, MPI_DOUBLE,
+                                   val_reverse? bufD_P2PSend : bufD_P2PRecv, recvCounts, recvDispls, MPI_DOUBLE,
+                                   comm_P2PNeighbor[val_reverse], &req_P2PNeighbor);
+      break;
+    case COMM_TYPE_UNSIGNED_SHORT:
+      SU2_MPI::Ineighbor_alltoallv(val_reverse? bufS_P2PRecv : bufS_P2PSend, sendCounts, sendDispls, MPI_UNSIGNED_SHORT,
+                                   val_reverse? bufS_P2PSend : bufS_P2PRecv, recvCounts, recvDispls, MPI_UNSIGNED_SHORT,
+                                   comm_P2PNeighbor[val_reverse], &req_P2PNeighbor);
+      break;
+    default:
+      SU2_MPI::Error("Unrecognized data type for point-to-point MPI comms.",
+                     CURRENT_FUNCTION);
+      break;
+  }
+
+  iMessage_P2PNeighbor = 0;
+
+#endif
+}
+
 void CGeometry::AllocateP2PComms(unsigned short val_countPerPoint) {
 
   /*--- This routine is activated whenever we attempt to perform
@@ -491,6 +673,10 @@ void CGeometry::AllocateP2PComms(unsigned short val_countPerPoint) {
 
   countPerPoint = val_countPerPoint;
 
+  /*--- The persistent requests refer to the old buffers. ---*/
+
+  FreePersistentP2PComms();
+
   /*-- Deallocate and reallocate our su2double cummunication memory. ---*/
 
   if (bufD_P2PSend != NULL) delete [] bufD_P2PSend;
@@ -517,6 +703,13 @@ void CGeometry::AllocateP2PComms(unsigned short val_countPerPoint) {
   for (iRecv = 0; iRecv < countPerPoint*nPoint_P2PRecv[nP2PRecv]; iRecv++)
     bufS_P2PRecv[iRecv] = 0;
 
+#ifdef HAVE_MPI_P2P_EXTFUNC
+  bufP_P2PSend.assign(countPerPoint*nPoint_P2PSend[nP2PSend], 0.0);
+  bufP_P2PRecv.assign(countPerPoint*nPoint_P2PRecv[nP2PRecv], 0.0);
+  reqP_P2PSend.resize(max(nP2PSend, nP2PRecv));
+  reqP_P2PRecv.resize(max(nP2PSend, nP2PRecv));
+#endif
+
 }
 
 void CGeometry::PostP2PRecvs(CGeometry *geometry,
@@ -528,6 +721,49 @@ void CGeometry::PostP2PRecvs(CGeometry *geometry,
 
   int iMessage, iRecv, offset, nPointP2P, count, source, tag;
 
+  /*--- Count the exchange (the sends of the rank) for the communication report. ---*/
+
+  if (CCommProfiler::IsActive()) {
+    const int nSend = val_reverse? nP2PRecv : nP2PSend;
+    const int nPointSend = val_reverse? nPoint_P2PRecv[nP2PRecv] : nPoint_P2PSend[nP2PSend];
+    const size_t typeSize = (commType == COMM_TYPE_DOUBLE)? sizeof(passivedouble) : sizeof(unsigned short);
+    CCommProfiler::AddExchange(CCommProfiler::GetKind(), nSend, passivedouble(countPerPoint)*nPointSend*typeSize);
+  }
+
+  /*--- With the neighborhood collective the recvs are posted together
+   with the sends, once the last message is loaded. ---*/
+
+#ifdef HAVE_MPI_NEIGHBOR
+  if (kindP2PComms == NEIGHBOR_COMMS) return;
+#endif
+
+  /*--- In reverse AD the su2double values are exchanged passively, the
+   exchange is taped when it completes (see WaitAnyP2PRecv). ---*/
+
+#ifdef HAVE_MPI_P2P_EXTFUNC
+  extFunc_P2P = (kindP2PComms == PERSISTENT_COMMS) && (commType == COMM_TYPE_DOUBLE);
+  if (extFunc_P2P) {
+    reverse_P2P = val_reverse;
+    iMessage_P2PExtFunc = 0;
+    PostP2PPassiveRecvs(val_reverse, countPerPoint);
+    return;
+  }
+#endif
+
+  /*--- Persistent requests are created the first time a type of data is
+   communicated in a given direction, after that they are only restarted. ---*/
+
+#ifdef HAVE_MPI_PERSISTENT
+  if (kindP2PComms == PERSISTENT_COMMS) {
+    auto& recvReq = persReq_P2PRecv[commType == COMM_TYPE_DOUBLE][val_reverse];
+    if (recvReq.empty()) SetPersistentP2PComms(commType, val_reverse);
+
+    for (iRecv = 0; iRecv < nP2PRecv; iRecv++) req_P2PRecv[iRecv] = recvReq[iRecv];
+    if (nP2PRecv > 0) SU2_MPI::Startall(nP2PRecv, req_P2PRecv);
+    return;
+  }
+#endif
+
   /*--- Launch the non-blocking recv's first. Note that we have stored
    the counts and sources, so we can launch these before we even load
    the data and send from the neighbor ranks. ---*/
@@ -638,6 +874,41 @@ void CGeometry::PostP2PSends(CGeometry *geometry,
 
   int iMessage, offset, nPointP2P, count, dest, tag;
 
+  /*--- The neighborhood collective sends all messages at once. ---*/
+
+#ifdef HAVE_MPI_NEIGHBOR
+  if (kindP2PComms == NEIGHBOR_COMMS) {
+    if (val_iSend == nP2PSend-1) StartP2PNeighborComms(commType, val_reverse);
+    return;
+  }
+#endif
+
+  /*--- Copy the loaded message to the passive buffer and send it. ---*/
+
+#ifdef HAVE_MPI_P2P_EXTFUNC
+  if (extFunc_P2P) {
+    const int *nPointSend = val_reverse? nPoint_P2PRecv : nPoint_P2PSend;
+    const su2double *bufDSend = val_reverse? bufD_P2PRecv : bufD_P2PSend;
+    auto& bufPSend = val_reverse? bufP_P2PRecv : bufP_P2PSend;
+
+    for (int iBuf = countPerPoint*nPointSend[val_iSend]; iBuf < countPerPoint*nPointSend[val_iSend+1]; iBuf++)
+      bufPSend[iBuf] = SU2_TYPE::GetValue(bufDSend[iBuf]);
+
+    PostP2PPassiveSend(val_iSend, val_reverse, countPerPoint);
+    return;
+  }
+#endif
+
+  /*--- Restart the persistent request (created by PostP2PRecvs). ---*/
+
+#ifdef HAVE_MPI_PERSISTENT
+  if (kindP2PComms == PERSISTENT_COMMS) {
+    req_P2PSend[val_iSend] = persReq_P2PSend[commType == COMM_TYPE_DOUBLE][val_reverse][val_iSend];
+    SU2_MPI::Start(&req_P2PSend[val_iSend]);
+    return;
+  }
+#endif
+
   /*--- Post the non-blocking send as soon as the buffer is loaded. ---*/
 
   iMessage = val_iSend;
@@ -729,10 +1000,175 @@ void CGeometry::PostP2PSends(CGeometry *geometry,
 
 }
 
+int CGeometry::WaitAnyP2PRecv() {
+
+  CCommWaitScope wait(CCommProfiler::GetKind());
+
+  int ind = 0;
+
+  /*--- The collective completes all messages at once, they are then
+   returned in order. ---*/
+
+#ifdef HAVE_MPI_NEIGHBOR
+  if (kindP2PComms == NEIGHBOR_COMMS) {
+    if (iMessage_P2PNeighbor == 0)
+      SU2_MPI::Wait(&req_P2PNeighbor, MPI_STATUS_IGNORE);
+    ind = iMessage_P2PNeighbor;
+    iMessage_P2PNeighbor++;
+    return ind;
+  }
+#endif
+
+  /*--- All the messages are received before the exchange is taped as one
+   external function, whose inputs are all the sent values and outputs all
+   the received ones. They are then returned in order. ---*/
+
+#ifdef HAVE_MPI_P2P_EXTFUNC
+  if (extFunc_P2P) {
+    if (iMessage_P2PExtFunc == 0) {
+
+      const int nRecv = reverse_P2P? nP2PSend : nP2PRecv;
+      const int nSendBuf = countPerPoint*(reverse_P2P? nPoint_P2PRecv[nP2PRecv] : nPoint_P2PSend[nP2PSend]);
+      const int nRecvBuf = countPerPoint*(reverse_P2P? nPoint_P2PSend[nP2PSend] : nPoint_P2PRecv[nP2PRecv]);
+      su2double *bufDSend = reverse_P2P? bufD_P2PRecv : bufD_P2PSend;
+      su2double *bufDRecv = reverse_P2P? bufD_P2PSend : bufD_P2PRecv;
+      const auto& bufPRecv = reverse_P2P? bufP_P2PSend : bufP_P2PRecv;
+
+      CBaseMPIWrapper::Waitall(nRecv, reqP_P2PRecv.data(), MPI_STATUS_IGNORE);
+
+      const bool tapeActive = AD::globalTape.isActive();
+
+      if (tapeActive) {
+        AD::StartExtFunc(false, false);
+        AD::SetExtFuncIn(bufDSend, nSendBuf);
+        AD::StopRecording();
+      }
+
+      for (int iBuf = 0; iBuf < nRecvBuf; iBuf++) bufDRecv[iBuf] = bufPRecv[iBuf];
+
+      if (tapeActive) {
+        AD::StartRecording();
+        AD::SetExtFuncOut(bufDRecv, nRecvBuf);
+        AD::FuncHelper->addUserData(this);
+        AD::FuncHelper->addUserData(reverse_P2P);
+        AD::FuncHelper->addUserData(countPerPoint);
+        AD::FuncHelper->addToTape(CGeometry::P2PComms_b);
+        AD::EndExtFunc();
+      }
+    }
+    ind = iMessage_P2PExtFunc;
+    iMessage_P2PExtFunc++;
+    return ind;
+  }
+#endif
+
+  /*--- For efficiency, recv the messages dynamically based on the order
+   they arrive. The request index is also the index of the message. ---*/
+
+  SU2_MPI::Status status;
+  SU2_MPI::Waitany(nP2PRecv, req_P2PRecv, &ind, &status);
+
+  return ind;
+}
+
+void CGeometry::WaitAllP2PSends() {
+
+  CCommWaitScope wait(CCommProfiler::GetKind());
+
+#ifdef HAVE_MPI_NEIGHBOR
+  if (kindP2PComms == NEIGHBOR_COMMS) return;
+#endif
+
+#ifdef HAVE_MPI_P2P_EXTFUNC
+  if (extFunc_P2P) {
+    CBaseMPIWrapper::Waitall(reverse_P2P? nP2PRecv : nP2PSend, reqP_P2PSend.data(), MPI_STATUS_IGNORE);
+    extFunc_P2P = false;
+    return;
+  }
+#endif
+
+#ifdef HAVE_MPI
+  SU2_MPI::Waitall(nP2PSend, req_P2PSend, MPI_STATUS_IGNORE);
+#endif
+}
+
+#ifdef HAVE_MPI_P2P_EXTFUNC
+void CGeometry::PostP2PPassiveRecvs(bool val_reverse, int val_countPerPoint) {
+
+  /*--- In reverse, the send structures define the recvs and vice-versa. ---*/
+
+  const int nRecv = val_reverse? nP2PSend : nP2PRecv;
+  const int *nPointRecv = val_reverse? nPoint_P2PSend : nPoint_P2PRecv;
+  const int *source = val_reverse? Neighbors_P2PSend : Neighbors_P2PRecv;
+  auto& bufPRecv = val_reverse? bufP_P2PSend : bufP_P2PRecv;
+
+  for (int iRecv = 0; iRecv < nRecv; iRecv++) {
+    const int offset = val_countPerPoint*nPointRecv[iRecv];
+    const int count = val_countPerPoint*(nPointRecv[iRecv+1] - nPointRecv[iRecv]);
+    const int tag = source[iRecv] + 1;
+    CBaseMPIWrapper::Irecv(&bufPRecv[offset], count, MPI_DOUBLE, source[iRecv], tag,
+                           MPI_COMM_WORLD, &reqP_P2PRecv[iRecv]);
+  }
+}
+
+void CGeometry::PostP2PPassiveSend(int val_iSend, bool val_reverse, int val_countPerPoint) {
+
+  const int *nPointSend = val_reverse? nPoint_P2PRecv : nPoint_P2PSend;
+  const int *dest = val_reverse? Neighbors_P2PRecv : Neighbors_P2PSend;
+  auto& bufPSend = val_reverse? bufP_P2PRecv : bufP_P2PSend;
+
+  const int offset = val_countPerPoint*nPointSend[val_iSend];
+  const int count = val_countPerPoint*(nPointSend[val_iSend+1] - nPointSend[val_iSend]);
+  const int tag = rank + 1;
+  CBaseMPIWrapper::Isend(&bufPSend[offset], count, MPI_DOUBLE, dest[val_iSend], tag,
+                         MPI_COMM_WORLD, &reqP_P2PSend[val_iSend]);
+}
+
+void CGeometry::P2PComms_b(const codi::RealReverse::Real* x, codi::RealReverse::Real* x_b, size_t m,
+                           const codi::RealReverse::Real* y, const codi::RealReverse::Real* y_b, size_t n,
+                           codi::DataStore* d) {
+
+  CGeometry* geometry = nullptr;
+  d->getData(geometry);
+
+  bool reverse = false;
+  d->getData(reverse);
+
+  int countPerPoint = 0;
+  d->getData(countPerPoint);
+
+  /*--- The adjoints flow in the opposite direction of the recorded exchange, from the
+   *    passive buffer of the received values to the passive buffer of the sent values.
+   *    The buffers may have grown since the recording, the recorded layout is used. ---*/
+
+  const bool adjReverse = !reverse;
+  auto& bufPSend = adjReverse? geometry->bufP_P2PRecv : geometry->bufP_P2PSend;
+  const auto& bufPRecv = adjReverse? geometry->bufP_P2PSend : geometry->bufP_P2PRecv;
+  const int nSend = adjReverse? geometry->nP2PRecv : geometry->nP2PSend;
+
+  for (size_t i = 0; i < n; i++) bufPSend[i] = y_b[i];
+
+  geometry->PostP2PPassiveRecvs(adjReverse, countPerPoint);
+
+  for (int iSend = 0; iSend < nSend; iSend++)
+    geometry->PostP2PPassiveSend(iSend, adjReverse, countPerPoint);
+
+  CBaseMPIWrapper::Waitall(adjReverse? geometry->nP2PSend : geometry->nP2PRecv,
+                           geometry->reqP_P2PRecv.data(), MPI_STATUS_IGNORE);
+  CBaseMPIWrapper::Waitall(nSend, geometry->reqP_P2PSend.data(), MPI_STATUS_IGNORE);
+
+  for (size_t i = 0; i < m; i++) x_b[i] = bufPRecv[i];
+}
+#endif
+
 void CGeometry::InitiateComms(CGeometry *geometry,
                               CConfig *config,
                               unsigned short commType) {
 
+  SU2_PROFILE_REGION("MPI communication");
+
+  CCommProfiler::SetKind(CCommProfiler::GEOMETRY_COMMS);
+
   /*--- Local variables ---*/
 
   unsigned short iDim;
@@ -869,13 +1305,14 @@ void CGeometry::CompleteComms(CGeometry *geometry,
                               CConfig *config,
                               unsigned short commType) {
 
+  SU2_PROFILE_REGION("MPI communication");
+
   /*--- Local variables ---*/
 
   unsigned short iDim;
   unsigned long iPoint, iRecv, nRecv, msg_offset, buf_offset;
 
-  int ind, source, iMessage, jRecv;
-  SU2_MPI::Status status;
+  int iMessage, jRecv;
 
   /*--- Set some local pointers to make access simpler. ---*/
 
@@ -892,17 +1329,9 @@ void CGeometry::CompleteComms(CGeometry *geometry,
     for (iMessage = 0; iMessage < nP2PRecv; iMessage++) {
 
       /*--- For efficiency, recv the messages dynamically based on
-       the order they arrive. ---*/
-
-      SU2_MPI::Waitany(nP2PRecv, req_P2PRecv, &ind, &status);
-
-      /*--- Once we have recv'd a message, get the source rank. ---*/
+       the order they arrive, we know the offsets based on the message. ---*/
 
-      source = status.MPI_SOURCE;
-
-      /*--- We know the offsets based on the source rank. ---*/
-
-      jRecv = P2PRecv2Neighbor[source];
+      jRecv = WaitAnyP2PRecv();
 
       /*--- Get the offset in the buffer for the start of this message. ---*/
 
@@ -956,9 +1385,7 @@ void CGeometry::CompleteComms(CGeometry *geometry,
      Note that this should be satisfied, as we have received all of the
      data in the loop above at this point. ---*/
 
-#ifdef HAVE_MPI
-    SU2_MPI::Waitall(nP2PSend, req_P2PSend, MPI_STATUS_IGNORE);
-#endif
+    WaitAllP2PSends();
 
   }
 
@@ -1090,6 +1517,12 @@ void CGeometry::PreprocessPeriodicComms(CGeometry *geometry,
   for (iRecv = 0; iRecv < nPeriodicRecv; iRecv++)
     PeriodicRecv2Neighbor[Neighbors_PeriodicRecv[iRecv]] = iRecv;
 
+  /*--- The periodic data of points whose donor is on this rank is copied
+   directly during the iterations, without messages to ourselves. ---*/
+
+  iPeriodicSendSelf = (PeriodicSend2Neighbor.count(rank) > 0)? PeriodicSend2Neighbor[rank] : -1;
+  iPeriodicRecvSelf = (PeriodicRecv2Neighbor.count(rank) > 0)? PeriodicRecv2Neighbor[rank] : -1;
+
   delete [] nPoint_Send_All;
   delete [] nPoint_Recv_All;
 
@@ -1362,11 +1795,14 @@ void CGeometry::PostPeriodicRecvs(CGeometry *geometry,
 
   /*--- Launch the non-blocking recv's first. Note that we have stored
    the counts and sources, so we can launch these before we even load
-   the data and send from the neighbor ranks. ---*/
+   the data and send from the neighbor ranks. The data from this rank
+   is copied directly by PostPeriodicSends, it has no request. ---*/
 
   iMessage = 0;
   for (iRecv = 0; iRecv < nPeriodicRecv; iRecv++) {
 
+    if (iRecv == iPeriodicRecvSelf) continue;
+
     /*--- Compute our location in the recv buffer. ---*/
 
     offset = countPerPeriodicPoint*nPoint_PeriodicRecv[iRecv];
@@ -1419,6 +1855,33 @@ void CGeometry::PostPeriodicSends(CGeometry *geometry,
                                   unsigned short commType,
                                   int val_iSend) {
 
+  /*--- The data sent to this rank (both sides of the periodic pair are
+   local) is copied directly into the recv buffer, also in parallel. ---*/
+
+  if (val_iSend == iPeriodicSendSelf) {
+
+    int iSend, myStart, myFinal, iRecv;
+    iRecv   = nPoint_PeriodicRecv[iPeriodicRecvSelf]*countPerPeriodicPoint;
+    myStart = nPoint_PeriodicSend[val_iSend]*countPerPeriodicPoint;
+    myFinal = nPoint_PeriodicSend[val_iSend+1]*countPerPeriodicPoint;
+    for (iSend = myStart; iSend < myFinal; iSend++) {
+      switch (commType) {
+        case COMM_TYPE_DOUBLE:
+          bufD_PeriodicRecv[iRecv] =  bufD_PeriodicSend[iSend];
+          break;
+        case COMM_TYPE_UNSIGNED_SHORT:
+          bufS_PeriodicRecv[iRecv] =  bufS_PeriodicSend[iSend];
+          break;
+        default:
+          SU2_MPI::Error("Unrecognized data type for periodic MPI comms.",
+                         CURRENT_FUNCTION);
+          break;
+      }
+      iRecv++;
+    }
+    return;
+  }
+
   /*--- In parallel, communicate the data with non-blocking send/recv. ---*/
 
 #ifdef HAVE_MPI
@@ -1427,9 +1890,10 @@ void CGeometry::PostPeriodicSends(CGeometry *geometry,
 
   int iMessage, offset, nPointPeriodic, count, dest, tag;
 
-  /*--- Post the non-blocking send as soon as the buffer is loaded. ---*/
+  /*--- Post the non-blocking send as soon as the buffer is loaded,
+   the message to this rank (if any) does not have a request. ---*/
 
-  iMessage = val_iSend;
+  iMessage = val_iSend - ((iPeriodicSendSelf >= 0) && (iPeriodicSendSelf < val_iSend));
 
   /*--- Compute our location in the send buffer. ---*/
 
@@ -1469,31 +1933,6 @@ void CGeometry::PostPeriodicSends(CGeometry *geometry,
       break;
   }
 
-#else
-
-  /*--- Copy my own rank's data into the recv buffer directly in serial. ---*/
-
-  int iSend, myStart, myFinal, iRecv, iRank;
-  iRank   = geometry->PeriodicRecv2Neighbor[rank];
-  iRecv   = geometry->nPoint_PeriodicRecv[iRank]*countPerPeriodicPoint;
-  myStart = nPoint_PeriodicSend[val_iSend]*countPerPeriodicPoint;
-  myFinal = nPoint_PeriodicSend[val_iSend+1]*countPerPeriodicPoint;
-  for (iSend = myStart; iSend < myFinal; iSend++) {
-    switch (commType) {
-      case COMM_TYPE_DOUBLE:
-        bufD_PeriodicRecv[iRecv] =  bufD_PeriodicSend[iSend];
-        break;
-      case COMM_TYPE_UNSIGNED_SHORT:
-        bufS_PeriodicRecv[iRecv] =  bufS_PeriodicSend[iSend];
-        break;
-      default:
-        SU2_MPI::Error("Unrecognized data type for periodic MPI comms.",
-                       CURRENT_FUNCTION);
-        break;
-    }
-    iRecv++;
-  }
-
 #endif
 
 }
@@ -1552,36 +1991,285 @@ bool CGeometry::CheckEdge(unsigned long first_point, unsigned long second_point)
 
 }
 
+void CGeometry::SetPointStorage(void) {
+
+  unsigned short nVolume = 0;
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
+    nVolume = max(nVolume, node[iPoint]->GetnVolume());
+
+  /*--- New containers, the current storage of the points may already be contiguous. ---*/
+
+  su2activematrix coord(nPoint,nDim), volume(nPoint,nVolume);
+  su2activevector wallDistance(nPoint);
+  volume = su2double(0.0);
+
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
+    node[iPoint]->SetStorage(coord[iPoint], volume[iPoint], &wallDistance(iPoint));
+
+  /*--- Moving does not change the addresses of the data. ---*/
+
+  pointCoord = move(coord);
+  pointVolume = move(volume);
+  pointWallDistance = move(wallDistance);
+}
+
+void CGeometry::SetEdgeGeometry(const CConfig *config) {
+
+  if (!config->GetEdgeGeometryCache()) return;
+
+  if (edgeGeometry.rows() != nEdge) edgeGeometry.resize(nEdge, nDim+3);
+
+  UpdateEdgeGeometry();
+}
+
+void CGeometry::UpdateEdgeGeometry(void) {
+
+  if (edgeGeometry.empty()) return;
+
+  UpdateEdgeGeometry(vector<bool>(nPoint, true));
+}
+
+void CGeometry::UpdateEdgeGeometry(const vector<bool>& pointMask) {
+
+  if (edgeGeometry.empty()) return;
+
+  for (unsigned long iEdge = 0; iEdge < nEdge; iEdge++) {
+
+    if (!pointMask[edgeNodes(iEdge,0)] && !pointMask[edgeNodes(iEdge,1)]) continue;
+
+    const su2double* Coord_i = pointCoord[edgeNodes(iEdge,0)];
+    const su2double* Coord_j = pointCoord[edgeNodes(iEdge,1)];
+    const su2double* Normal = edgeNormal[iEdge];
+    su2double* factors = edgeGeometry[iEdge];
+
+    su2double dist_ij_2 = 0.0, area = 0.0, proj = 0.0;
+    for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+      factors[iDim] = Coord_j[iDim] - Coord_i[iDim];
+      dist_ij_2 += pow(factors[iDim], 2);
+      area += pow(Normal[iDim], 2);
+      proj += factors[iDim]*Normal[iDim];
+    }
+
+    /*--- The coordinates of coarse grids are only set after their dual grid. ---*/
+
+    factors[nDim] = dist_ij_2;
+    factors[nDim+1] = sqrt(area);
+    factors[nDim+2] = (dist_ij_2 > 0.0)? proj/dist_ij_2 : su2double(0.0);
+  }
+}
+
+void CGeometry::SetEdgeGridFlux(void) {
+
+#if defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE
+  return;
+#endif
+
+  if (edgeGridFlux.size() != nEdge) edgeGridFlux.resize(nEdge);
+
+  SU2_OMP_PARALLEL_(for schedule(static,1024))
+  for (unsigned long iEdge = 0; iEdge < nEdge; iEdge++) {
+    const su2double* GridVel_i = node[edgeNodes(iEdge,0)]->GetGridVel();
+    const su2double* GridVel_j = node[edgeNodes(iEdge,1)]->GetGridVel();
+    const su2double* Normal = edgeNormal[iEdge];
+
+    su2double ProjGridVel = 0.0;
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      ProjGridVel += 0.5*(GridVel_i[iDim]+GridVel_j[iDim])*Normal[iDim];
+    edgeGridFlux(iEdge) = ProjGridVel;
+  }
+}
+
+void CGeometry::RotateDualGrid(const su2double rotMatrix[][3]) {
+
+  su2double rotNormal[3] = {0.0};
+
+  const auto rotate = [&](su2double* Normal) {
+    for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+      rotNormal[iDim] = 0.0;
+      for (unsigned short jDim = 0; jDim < nDim; jDim++)
+        rotNormal[iDim] += rotMatrix[iDim][jDim]*Normal[jDim];
+    }
+    for (unsigned short iDim = 0; iDim < nDim; iDim++) Normal[iDim] = rotNormal[iDim];
+  };
+
+  for (unsigned long iEdge = 0; iEdge < nEdge; iEdge++)
+    rotate(edge[iEdge]->GetNormal());
+
+  for (unsigned short iMarker = 0; iMarker < nMarker; iMarker++)
+    for (unsigned long iVertex = 0; iVertex < nVertex[iMarker]; iVertex++)
+      rotate(vertex[iMarker][iVertex]->GetNormal());
+}
+
+void CGeometry::AddRigidMotion(const su2double rotMatrix[][3], const su2double *translation) {
+
+  /*--- x = R_new (R_old x + b_old) + b_new, starting from the identity. ---*/
+
+  if (!rigidMotionPending) {
+    for (unsigned short iDim = 0; iDim < 3; iDim++)
+      for (unsigned short jDim = 0; jDim < 4; jDim++)
+        rigidMotion[iDim][jDim] = (iDim == jDim)? 1.0 : 0.0;
+  }
+
+  su2double composed[3][4] = {{0.0}};
+
+  for (unsigned short iDim = 0; iDim < 3; iDim++) {
+    for (unsigned short jDim = 0; jDim < 4; jDim++)
+      for (unsigned short kDim = 0; kDim < 3; kDim++)
+        composed[iDim][jDim] += rotMatrix[iDim][kDim]*rigidMotion[kDim][jDim];
+    composed[iDim][3] += translation[iDim];
+  }
+
+  for (unsigned short iDim = 0; iDim < 3; iDim++)
+    for (unsigned short jDim = 0; jDim < 4; jDim++)
+      rigidMotion[iDim][jDim] = composed[iDim][jDim];
+
+  rigidMotionPending = true;
+}
+
+bool CGeometry::GetRigidMotion(su2double rotMatrix[][3], su2double *translation) const {
+
+  if (!rigidMotionPending) return false;
+
+  for (unsigned short iDim = 0; iDim < 3; iDim++) {
+    for (unsigned short jDim = 0; jDim < 3; jDim++)
+      rotMatrix[iDim][jDim] = rigidMotion[iDim][jDim];
+    translation[iDim] = rigidMotion[iDim][3];
+  }
+  return true;
+}
+
+void CGeometry::SetEdgeHalo(void) {
+
+  if (edgeHalo.size() == nEdge) return;
+
+  edgeHalo.resize(nEdge);
+
+  for (unsigned long iEdge = 0; iEdge < nEdge; iEdge++)
+    edgeHalo(iEdge) = !node[edgeNodes(iEdge,0)]->GetDomain() || !node[edgeNodes(iEdge,1)]->GetDomain();
+}
+
+void CGeometry::SetLeastSquaresWeights(const CConfig *config) {
+
+  lsqWeightsValid[0] = lsqWeightsValid[1] = false;
+
+  if (!config->GetLeastSquaresCache()) return;
+
+  bool required[2] = {false, false};
+
+  for (auto kind : {config->GetKind_Gradient_Method(), config->GetKind_Gradient_Method_Recon()}) {
+    if (kind == LEAST_SQUARES) required[0] = true;
+    if (kind == WEIGHTED_LEAST_SQUARES) required[1] = true;
+  }
+
+  if (!required[0] && !required[1]) return;
+
+  if (lsqOffset.size() != nPointDomain+1) {
+    lsqOffset.resize(nPointDomain+1);
+    lsqOffset(0) = 0;
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
+      lsqOffset(iPoint+1) = lsqOffset(iPoint) + node[iPoint]->GetnPoint();
+  }
+
+  for (int iKind = 0; iKind < 2; iKind++) {
+    if (required[iKind] && (lsqWeights[iKind].rows() != lsqOffset(nPointDomain)))
+      lsqWeights[iKind].resize(lsqOffset(nPointDomain), nDim) = su2double(0.0);
+  }
+}
+
+void CGeometry::SetChildren_CSR(void) {
+
+  su2vector<unsigned long> outerPtr(nPoint+1);
+  outerPtr(0) = 0;
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
+    outerPtr(iPoint+1) = outerPtr(iPoint) + node[iPoint]->GetnChildren_CV();
+
+  su2vector<unsigned long> innerIdx(outerPtr(nPoint));
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
+    for (unsigned short iChildren = 0; iChildren < node[iPoint]->GetnChildren_CV(); iChildren++)
+      innerIdx(outerPtr(iPoint)+iChildren) = node[iPoint]->GetChildren_CV(iChildren);
+
+  childrenCV = CCompressedSparsePatternUL(move(outerPtr), move(innerIdx));
+}
+
 void CGeometry::SetEdges(void) {
-  unsigned long iPoint, jPoint;
-  long iEdge;
-  unsigned short jNode, iNode;
-  long TestEdge = 0;
-
-  nEdge = 0;
-  for (iPoint = 0; iPoint < nPoint; iPoint++)
-    for (iNode = 0; iNode < node[iPoint]->GetnPoint(); iNode++) {
-      jPoint = node[iPoint]->GetPoint(iNode);
-      for (jNode = 0; jNode < node[jPoint]->GetnPoint(); jNode++)
-        if (node[jPoint]->GetPoint(jNode) == iPoint) {
-          TestEdge = node[jPoint]->GetEdge(jNode);
-          break;
-        }
-      if (TestEdge == -1) {
-        node[iPoint]->SetEdge(nEdge, iNode);
-        node[jPoint]->SetEdge(nEdge, jNode);
-        nEdge++;
+
+  /*--- Contiguous storage for the points, the multigrid levels and the
+   *    other programs all build their edges after the points. ---*/
+
+  SetPointStorage();
+
+  /*--- Sorted neighbors of each point (CSR), with their position in the list of the point. ---*/
+
+  vector<su2localidx> outerPtr(nPoint+1, 0);
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
+    outerPtr[iPoint+1] = outerPtr[iPoint] + node[iPoint]->GetnPoint();
+
+  vector<su2localidx> innerIdx(outerPtr[nPoint]);
+  vector<unsigned short> slot(outerPtr[nPoint]);
+  vector<su2localidx> firstOwned(nPoint);
+
+  SU2_OMP_PARALLEL
+  {
+    vector<pair<su2localidx, unsigned short> > neighbors;
+
+    SU2_OMP_FOR_DYN(256)
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+      neighbors.clear();
+      for (unsigned short iNode = 0; iNode < node[iPoint]->GetnPoint(); iNode++)
+        neighbors.emplace_back(node[iPoint]->GetPoint(iNode), iNode);
+      sort(neighbors.begin(), neighbors.end());
+
+      auto k = outerPtr[iPoint];
+      firstOwned[iPoint] = outerPtr[iPoint+1];
+      for (const auto& neighbor : neighbors) {
+        if ((neighbor.first > iPoint) && (firstOwned[iPoint] == outerPtr[iPoint+1])) firstOwned[iPoint] = k;
+        innerIdx[k] = neighbor.first;
+        slot[k++] = neighbor.second;
       }
     }
+  }
+
+  const CCompressedSparsePatternLocal neighbors(outerPtr, innerIdx);
+  vector<su2localidx>().swap(innerIdx);
+
+  /*--- The edges are numbered by owner point (their lowest point) and, for the same
+   *    owner, by increasing index of the other point. Edge loops then access the point
+   *    data almost sequentially, in whichever order the points were renumbered.
+   *    The first edge of each point follows from the number of neighbors it owns. ---*/
+
+  vector<unsigned long> edgePtr(nPoint+1, 0);
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
+    edgePtr[iPoint+1] = edgePtr[iPoint] + (outerPtr[iPoint+1] - firstOwned[iPoint]);
+
+  nEdge = edgePtr[nPoint];
 
   edge = new CEdge*[nEdge];
 
-  for (iPoint = 0; iPoint < nPoint; iPoint++)
-    for (iNode = 0; iNode < node[iPoint]->GetnPoint(); iNode++) {
-      jPoint = node[iPoint]->GetPoint(iNode);
-      iEdge = FindEdge(iPoint, jPoint);
-      if (iPoint < jPoint) edge[iEdge] = new CEdge(iPoint, jPoint, nDim);
+  edgeNodes.resize(nEdge,2);
+  edgeNormal.resize(nEdge,nDim);
+  edgeCoordCG.resize(nEdge,nDim);
+
+  /*--- Each point sets its own edges, the edge of a neighbor of lower index is found by
+   *    a binary search in the sorted neighbors of that neighbor. ---*/
+
+  SU2_OMP_PARALLEL_(for schedule(dynamic,256))
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+    for (auto k = outerPtr[iPoint]; k < outerPtr[iPoint+1]; k++) {
+      const unsigned long jPoint = neighbors.innerIdx()[k];
+      unsigned long iEdge;
+
+      if (jPoint > iPoint) {
+        iEdge = edgePtr[iPoint] + (k - firstOwned[iPoint]);
+        edge[iEdge] = new CEdge(iPoint, jPoint, nDim, edgeNodes[iEdge], edgeNormal[iEdge], edgeCoordCG[iEdge]);
+      }
+      else {
+        const auto jNeighbors = neighbors.innerIdx(jPoint);
+        const auto pos = lower_bound(jNeighbors, jNeighbors + neighbors.getNumNonZeros(jPoint), iPoint) - jNeighbors;
+        iEdge = edgePtr[jPoint] + (outerPtr[jPoint] + pos - firstOwned[jPoint]);
+      }
+      node[iPoint]->SetEdge(iEdge, slot[k]);
     }
+  }
 }
 
 void CGeometry::SetFaces(void) {
@@ -1912,736 +2600,765 @@ bool CGeometry::SegmentIntersectsTriangle(su2double point0[3], su2double point1[
 
 }
 
-void CGeometry::ComputeAirfoil_Section(su2double *Plane_P0, su2double *Plane_Normal,
-                                       su2double MinXCoord, su2double MaxXCoord,
-                                       su2double MinYCoord, su2double MaxYCoord,
-                                       su2double MinZCoord, su2double MaxZCoord,
-                                       su2double *FlowVariable,
-                                       vector<su2double> &Xcoord_Airfoil, vector<su2double> &Ycoord_Airfoil,
-                                       vector<su2double> &Zcoord_Airfoil, vector<su2double> &Variable_Airfoil,
-                                       bool original_surface, CConfig *config) {
-
-  AD_BEGIN_PASSIVE
-
-  unsigned short iMarker, iNode, jNode, iDim, Index = 0;
-  bool intersect;
-  long Next_Edge = 0;
-  unsigned long iPoint, jPoint, iElem, Trailing_Point, Airfoil_Point, iVertex, iEdge, PointIndex, jEdge;
-  su2double Segment_P0[3] = {0.0, 0.0, 0.0}, Segment_P1[3] = {0.0, 0.0, 0.0}, Variable_P0 = 0.0, Variable_P1 = 0.0, Intersection[3] = {0.0, 0.0, 0.0}, Trailing_Coord,
-  *VarCoord = NULL, Variable_Interp, v1[3] = {0.0, 0.0, 0.0}, v3[3] = {0.0, 0.0, 0.0}, CrossProduct = 1.0;
-  bool Found_Edge;
-  passivedouble Dist_Value;
-  vector<su2double> Xcoord_Index0, Ycoord_Index0, Zcoord_Index0, Variable_Index0, Xcoord_Index1, Ycoord_Index1, Zcoord_Index1, Variable_Index1;
-  vector<unsigned long> IGlobalID_Index0, JGlobalID_Index0, IGlobalID_Index1, JGlobalID_Index1, IGlobalID_Airfoil, JGlobalID_Airfoil;
-  vector<unsigned short> Conection_Index0, Conection_Index1;
-  vector<unsigned long> Duplicate;
-  vector<unsigned long>::iterator it;
-  su2double **Coord_Variation = NULL;
-  vector<su2double> XcoordExtra, YcoordExtra, ZcoordExtra, VariableExtra;
-  vector<unsigned long> IGlobalIDExtra, JGlobalIDExtra;
-  vector<bool> AddExtra;
-  unsigned long EdgeDonor;
-  bool FoundEdge;
-
-#ifdef HAVE_MPI
-  unsigned long nLocalEdge, MaxLocalEdge, *Buffer_Send_nEdge, *Buffer_Receive_nEdge, nBuffer_Coord, nBuffer_Variable, nBuffer_GlobalID;
-  int nProcessor, iProcessor;
-  su2double *Buffer_Send_Coord, *Buffer_Receive_Coord;
-  su2double *Buffer_Send_Variable, *Buffer_Receive_Variable;
-  unsigned long *Buffer_Send_GlobalID, *Buffer_Receive_GlobalID;
-#endif
-
-  Xcoord_Airfoil.clear();
-  Ycoord_Airfoil.clear();
-  Zcoord_Airfoil.clear();
-  Variable_Airfoil.clear();
-  IGlobalID_Airfoil.clear();
-  JGlobalID_Airfoil.clear();
-
-  /*--- Set the right plane in 2D (note the change in Y-Z plane) ---*/
-
-  if (nDim == 2) {
-    Plane_P0[0] = 0.0;      Plane_P0[1] = 0.0;      Plane_P0[2] = 0.0;
-    Plane_Normal[0] = 0.0;  Plane_Normal[1] = 1.0;  Plane_Normal[2] = 0.0;
-  }
-
-  /*--- Grid movement is stored using a vertices information,
-   we should go from vertex to points ---*/
-
-  if (original_surface == false) {
-
-    Coord_Variation = new su2double *[nPoint];
-    for (iPoint = 0; iPoint < nPoint; iPoint++)
-      Coord_Variation[iPoint] = new su2double [nDim];
-
-    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-      if (config->GetMarker_All_GeoEval(iMarker) == YES) {
-        for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
-          VarCoord = vertex[iMarker][iVertex]->GetVarCoord();
-          iPoint = vertex[iMarker][iVertex]->GetNode();
-          for (iDim = 0; iDim < nDim; iDim++)
-            Coord_Variation[iPoint][iDim] = VarCoord[iDim];
-        }
-      }
-    }
-
-  }
+namespace {
 
-  for (iMarker = 0; iMarker < nMarker; iMarker++) {
+/*--- Segments of the intersection of a plane with the surface: the coordinates of their two points
+ *    [x0 y0 z0 x1 y1 z1], the variable [v0 v1], and the global indices of the edges of the surface that
+ *    contain the points [i0 j0 i1 j1] (in 2D the edges of the surface, each point is its own edge). ---*/
+struct CSectionSegments {
+  vector<su2double> coord, variable;
+  vector<unsigned long> globalID;
+  unsigned long size() const { return variable.size()/2; }
+};
 
-    if (config->GetMarker_All_GeoEval(iMarker) == YES) {
+/*--- Boundary element of the markers of the geometrical evaluation, with what does not depend on the plane. ---*/
+struct CSectionElement {
+  unsigned short iMarker;
+  unsigned long iElem;
+  bool inBounds;                      /*--- Average coordinate inside the bounds of the sections. ---*/
+  su2double YCoord_Nacelle;           /*--- Average coordinate in the frame of the nacelle. ---*/
+  su2double ZCoord_Nacelle;
+  su2double MinProj, MaxProj;         /*--- Extent along the common normal of the planes. ---*/
+};
+
+/*--- Edge of the surface regardless of its orientation. ---*/
+using EdgeKey = pair<unsigned long, unsigned long>;
+
+inline EdgeKey MakeEdgeKey(unsigned long iPoint, unsigned long jPoint) {
+  return (iPoint < jPoint)? EdgeKey(iPoint, jPoint) : EdgeKey(jPoint, iPoint);
+}
 
-      for (iElem = 0; iElem < nElem_Bound[iMarker]; iElem++) {
+template<class T>
+void Compact(vector<T>& values, const vector<bool>& keep) {
+  unsigned long nKept = 0;
+  for (unsigned long i = 0; i < values.size(); i++)
+    if (keep[i]) values[nKept++] = values[i];
+  values.resize(nKept);
+}
 
-        PointIndex=0;
+/*--- Sort the segments of a section into a curve that starts at the trailing edge. ---*/
+void SetAirfoil_Curve(const CSectionSegments &segments, const su2double *Plane_Normal, CConfig *config,
+                      vector<su2double> &Xcoord_Airfoil, vector<su2double> &Ycoord_Airfoil,
+                      vector<su2double> &Zcoord_Airfoil, vector<su2double> &Variable_Airfoil) {
 
-        /*--- To decide if an element is going to be used or not should be done element based,
-         The first step is to compute and average coordinate for the element ---*/
+  unsigned short Index = 0;
+  unsigned long iEdge, jEdge, Trailing_Point, Airfoil_Point, Next_Edge = 0, EdgeDonor;
+  su2double Trailing_Coord;
+  passivedouble Dist_Value;
+  bool Found_Edge, FoundEdge;
+  vector<su2double> Xcoord_Index0, Ycoord_Index0, Zcoord_Index0, Variable_Index0, Xcoord_Index1, Ycoord_Index1, Zcoord_Index1, Variable_Index1;
+  vector<unsigned long> IGlobalID_Index0, JGlobalID_Index0, IGlobalID_Index1, JGlobalID_Index1, IGlobalID_Airfoil, JGlobalID_Airfoil;
+  vector<unsigned short> Conection_Index0, Conection_Index1;
+  vector<su2double> XcoordExtra, YcoordExtra, ZcoordExtra, VariableExtra;
+  vector<unsigned long> IGlobalIDExtra, JGlobalIDExtra;
+  vector<bool> AddExtra;
 
-        su2double AveXCoord = 0.0;
-        su2double AveYCoord = 0.0;
-        su2double AveZCoord = 0.0;
+  for (iEdge = 0; iEdge < segments.size(); iEdge++) {
+    Xcoord_Index0.push_back(segments.coord[iEdge*6 + 0]);     Xcoord_Index1.push_back(segments.coord[iEdge*6 + 3]);
+    Ycoord_Index0.push_back(segments.coord[iEdge*6 + 1]);     Ycoord_Index1.push_back(segments.coord[iEdge*6 + 4]);
+    Zcoord_Index0.push_back(segments.coord[iEdge*6 + 2]);     Zcoord_Index1.push_back(segments.coord[iEdge*6 + 5]);
+    Variable_Index0.push_back(segments.variable[iEdge*2 + 0]); Variable_Index1.push_back(segments.variable[iEdge*2 + 1]);
+    IGlobalID_Index0.push_back(segments.globalID[iEdge*4 + 0]); JGlobalID_Index0.push_back(segments.globalID[iEdge*4 + 1]);
+    IGlobalID_Index1.push_back(segments.globalID[iEdge*4 + 2]); JGlobalID_Index1.push_back(segments.globalID[iEdge*4 + 3]);
+  }
 
-        for (iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++) {
-          iPoint = bound[iMarker][iElem]->GetNode(iNode);
-          AveXCoord += node[iPoint]->GetCoord(0);
-          AveYCoord += node[iPoint]->GetCoord(1);
-          if (nDim == 3) AveZCoord += node[iPoint]->GetCoord(2);
-        }
+  auto CompactSegments = [&](const vector<bool>& keep) {
+    Compact(Xcoord_Index0, keep);    Compact(Xcoord_Index1, keep);
+    Compact(Ycoord_Index0, keep);    Compact(Ycoord_Index1, keep);
+    Compact(Zcoord_Index0, keep);    Compact(Zcoord_Index1, keep);
+    Compact(Variable_Index0, keep);  Compact(Variable_Index1, keep);
+    Compact(IGlobalID_Index0, keep); Compact(IGlobalID_Index1, keep);
+    Compact(JGlobalID_Index0, keep); Compact(JGlobalID_Index1, keep);
+  };
+
+  /*--- Remove singular edges ---*/
+
+  vector<bool> Keep(Xcoord_Index0.size());
+  for (iEdge = 0; iEdge < Xcoord_Index0.size(); iEdge++)
+    Keep[iEdge] = (MakeEdgeKey(IGlobalID_Index0[iEdge], JGlobalID_Index0[iEdge]) !=
+                   MakeEdgeKey(IGlobalID_Index1[iEdge], JGlobalID_Index1[iEdge]));
+  CompactSegments(Keep);
+
+  /*--- Remove repeated edges (with either orientation), this could happend because the MPI, the first
+   *    one of the list is kept. The edges are hashed instead of compared pairwise. ---*/
+
+  set<pair<EdgeKey, EdgeKey> > Unique;
+  Keep.resize(Xcoord_Index0.size());
+  for (iEdge = 0; iEdge < Xcoord_Index0.size(); iEdge++) {
+    const EdgeKey Edge0 = MakeEdgeKey(IGlobalID_Index0[iEdge], JGlobalID_Index0[iEdge]);
+    const EdgeKey Edge1 = MakeEdgeKey(IGlobalID_Index1[iEdge], JGlobalID_Index1[iEdge]);
+    Keep[iEdge] = Unique.insert((Edge0 < Edge1)? make_pair(Edge0, Edge1) : make_pair(Edge1, Edge0)).second;
+  }
+  CompactSegments(Keep);
+
+  if (Xcoord_Index0.size() <= 1) return;
+
+  /*--- Rotate from the Y-Z plane to the X-Z plane to reuse the rest of subroutines  ---*/
+
+  if (config->GetGeo_Description() == FUSELAGE) {
+    su2double Angle = -0.5*PI_NUMBER;
+    for (iEdge = 0; iEdge < Xcoord_Index0.size(); iEdge++) {
+      su2double XCoord = Xcoord_Index0[iEdge]*cos(Angle) - Ycoord_Index0[iEdge]*sin(Angle);
+      su2double YCoord = Ycoord_Index0[iEdge]*cos(Angle) + Xcoord_Index0[iEdge]*sin(Angle);
+      su2double ZCoord = Zcoord_Index0[iEdge];
+      Xcoord_Index0[iEdge] = XCoord; Ycoord_Index0[iEdge] = YCoord; Zcoord_Index0[iEdge] = ZCoord;
+      XCoord = Xcoord_Index1[iEdge]*cos(Angle) - Ycoord_Index1[iEdge]*sin(Angle);
+      YCoord = Ycoord_Index1[iEdge]*cos(Angle) + Xcoord_Index1[iEdge]*sin(Angle);
+      ZCoord = Zcoord_Index1[iEdge];
+      Xcoord_Index1[iEdge] = XCoord; Ycoord_Index1[iEdge] = YCoord; Zcoord_Index1[iEdge] = ZCoord;
+    }
+  }
 
-        AveXCoord /= su2double(bound[iMarker][iElem]->GetnNodes());
-        AveYCoord /= su2double(bound[iMarker][iElem]->GetnNodes());
-        AveZCoord /= su2double(bound[iMarker][iElem]->GetnNodes());
+  /*--- Rotate nacelle secction to a X-Z plane to reuse the rest of subroutines  ---*/
 
-        /*--- To only cut one part of the nacelle based on the cross product
-         of the normal to the plane and a vector that connect the point
-         with the center line ---*/
+  if (config->GetGeo_Description() == NACELLE) {
 
-        CrossProduct = 1.0;
+    su2double Tilt_Angle = config->GetNacelleLocation(3)*PI_NUMBER/180;
+    su2double Toe_Angle = config->GetNacelleLocation(4)*PI_NUMBER/180;
+    su2double Theta_deg = atan2(Plane_Normal[1],-Plane_Normal[2])/PI_NUMBER*180 + 180;
+    su2double Roll_Angle = 0.5*PI_NUMBER - Theta_deg*PI_NUMBER/180;
 
-        if (config->GetGeo_Description() == NACELLE) {
+    su2double XCoord_Trans, YCoord_Trans, ZCoord_Trans, XCoord_Trans_Tilt, YCoord_Trans_Tilt, ZCoord_Trans_Tilt,
+    XCoord_Trans_Tilt_Toe, YCoord_Trans_Tilt_Toe, ZCoord_Trans_Tilt_Toe, XCoord, YCoord, ZCoord;
 
-          su2double Tilt_Angle = config->GetNacelleLocation(3)*PI_NUMBER/180;
-          su2double Toe_Angle = config->GetNacelleLocation(4)*PI_NUMBER/180;
+    for (iEdge = 0; iEdge < Xcoord_Index0.size(); iEdge++) {
 
-          /*--- Translate to the origin ---*/
+      /*--- First point of the edge ---*/
 
-          su2double XCoord_Trans = AveXCoord - config->GetNacelleLocation(0);
-          su2double YCoord_Trans = AveYCoord - config->GetNacelleLocation(1);
-          su2double ZCoord_Trans = AveZCoord - config->GetNacelleLocation(2);
+      /*--- Translate to the origin ---*/
 
-          /*--- Apply tilt angle ---*/
+      XCoord_Trans = Xcoord_Index0[iEdge] - config->GetNacelleLocation(0);
+      YCoord_Trans = Ycoord_Index0[iEdge] - config->GetNacelleLocation(1);
+      ZCoord_Trans = Zcoord_Index0[iEdge] - config->GetNacelleLocation(2);
 
-          su2double XCoord_Trans_Tilt = XCoord_Trans*cos(Tilt_Angle) + ZCoord_Trans*sin(Tilt_Angle);
-          su2double YCoord_Trans_Tilt = YCoord_Trans;
-          su2double ZCoord_Trans_Tilt = ZCoord_Trans*cos(Tilt_Angle) - XCoord_Trans*sin(Tilt_Angle);
+      /*--- Apply tilt angle ---*/
 
-          /*--- Apply toe angle ---*/
+      XCoord_Trans_Tilt = XCoord_Trans*cos(Tilt_Angle) + ZCoord_Trans*sin(Tilt_Angle);
+      YCoord_Trans_Tilt = YCoord_Trans;
+      ZCoord_Trans_Tilt = ZCoord_Trans*cos(Tilt_Angle) - XCoord_Trans*sin(Tilt_Angle);
 
-          su2double YCoord_Trans_Tilt_Toe = XCoord_Trans_Tilt*sin(Toe_Angle) + YCoord_Trans_Tilt*cos(Toe_Angle);
-          su2double ZCoord_Trans_Tilt_Toe = ZCoord_Trans_Tilt;
+      /*--- Apply toe angle ---*/
 
-          /*--- Undo plane rotation, we have already rotated the nacelle ---*/
+      XCoord_Trans_Tilt_Toe = XCoord_Trans_Tilt*cos(Toe_Angle) - YCoord_Trans_Tilt*sin(Toe_Angle);
+      YCoord_Trans_Tilt_Toe = XCoord_Trans_Tilt*sin(Toe_Angle) + YCoord_Trans_Tilt*cos(Toe_Angle);
+      ZCoord_Trans_Tilt_Toe = ZCoord_Trans_Tilt;
 
-          /*--- Undo tilt angle ---*/
+      /*--- Rotate to X-Z plane (roll) ---*/
 
-          su2double XPlane_Normal_Tilt = Plane_Normal[0]*cos(-Tilt_Angle) + Plane_Normal[2]*sin(-Tilt_Angle);
-          su2double YPlane_Normal_Tilt = Plane_Normal[1];
-          su2double ZPlane_Normal_Tilt = Plane_Normal[2]*cos(-Tilt_Angle) - Plane_Normal[0]*sin(-Tilt_Angle);
+      XCoord = XCoord_Trans_Tilt_Toe;
+      YCoord = YCoord_Trans_Tilt_Toe*cos(Roll_Angle) - ZCoord_Trans_Tilt_Toe*sin(Roll_Angle);
+      ZCoord = YCoord_Trans_Tilt_Toe*sin(Roll_Angle) + ZCoord_Trans_Tilt_Toe*cos(Roll_Angle);
 
-          /*--- Undo toe angle ---*/
+      /*--- Update coordinates ---*/
 
-          su2double YPlane_Normal_Tilt_Toe = XPlane_Normal_Tilt*sin(-Toe_Angle) + YPlane_Normal_Tilt*cos(-Toe_Angle);
-          su2double ZPlane_Normal_Tilt_Toe = ZPlane_Normal_Tilt;
+      Xcoord_Index0[iEdge] = XCoord; Ycoord_Index0[iEdge] = YCoord; Zcoord_Index0[iEdge] = ZCoord;
 
+      /*--- Second point of the edge ---*/
 
-          v1[1] = YCoord_Trans_Tilt_Toe - 0.0;
-          v1[2] = ZCoord_Trans_Tilt_Toe - 0.0;
-          v3[0] = v1[1]*ZPlane_Normal_Tilt_Toe-v1[2]*YPlane_Normal_Tilt_Toe;
-          CrossProduct = v3[0] * 1.0;
+      /*--- Translate to the origin ---*/
 
-        }
+      XCoord_Trans = Xcoord_Index1[iEdge] - config->GetNacelleLocation(0);
+      YCoord_Trans = Ycoord_Index1[iEdge] - config->GetNacelleLocation(1);
+      ZCoord_Trans = Zcoord_Index1[iEdge] - config->GetNacelleLocation(2);
 
-        for (unsigned short iFace = 0; iFace < bound[iMarker][iElem]->GetnFaces(); iFace++){
-          iNode = bound[iMarker][iElem]->GetFaces(iFace,0);
-          jNode = bound[iMarker][iElem]->GetFaces(iFace,1);
-          iPoint = bound[iMarker][iElem]->GetNode(iNode);
-          jPoint = bound[iMarker][iElem]->GetNode(jNode);
+      /*--- Apply tilt angle ---*/
 
-          if ((CrossProduct >= 0.0)
-              && ((AveXCoord > MinXCoord) && (AveXCoord < MaxXCoord))
-              && ((AveYCoord > MinYCoord) && (AveYCoord < MaxYCoord))
-              && ((AveZCoord > MinZCoord) && (AveZCoord < MaxZCoord))) {
+      XCoord_Trans_Tilt = XCoord_Trans*cos(Tilt_Angle) + ZCoord_Trans*sin(Tilt_Angle);
+      YCoord_Trans_Tilt = YCoord_Trans;
+      ZCoord_Trans_Tilt = ZCoord_Trans*cos(Tilt_Angle) - XCoord_Trans*sin(Tilt_Angle);
 
-            Segment_P0[0] = 0.0;  Segment_P0[1] = 0.0;  Segment_P0[2] = 0.0;  Variable_P0 = 0.0;
-            Segment_P1[0] = 0.0;  Segment_P1[1] = 0.0;  Segment_P1[2] = 0.0;  Variable_P1 = 0.0;
+      /*--- Apply toe angle ---*/
 
+      XCoord_Trans_Tilt_Toe = XCoord_Trans_Tilt*cos(Toe_Angle) - YCoord_Trans_Tilt*sin(Toe_Angle);
+      YCoord_Trans_Tilt_Toe = XCoord_Trans_Tilt*sin(Toe_Angle) + YCoord_Trans_Tilt*cos(Toe_Angle);
+      ZCoord_Trans_Tilt_Toe = ZCoord_Trans_Tilt;
 
-            for (iDim = 0; iDim < nDim; iDim++) {
-              if (original_surface == true) {
-                Segment_P0[iDim] = node[iPoint]->GetCoord(iDim);
-                Segment_P1[iDim] = node[jPoint]->GetCoord(iDim);
-              }
-              else {
-                Segment_P0[iDim] = node[iPoint]->GetCoord(iDim) + Coord_Variation[iPoint][iDim];
-                Segment_P1[iDim] = node[jPoint]->GetCoord(iDim) + Coord_Variation[jPoint][iDim];
-              }
-            }
+      /*--- Rotate to X-Z plane (roll) ---*/
 
-            if (FlowVariable != NULL) {
-              Variable_P0 = FlowVariable[iPoint];
-              Variable_P1 = FlowVariable[jPoint];
-            }
+      XCoord = XCoord_Trans_Tilt_Toe;
+      YCoord = YCoord_Trans_Tilt_Toe*cos(Roll_Angle) - ZCoord_Trans_Tilt_Toe*sin(Roll_Angle);
+      ZCoord = YCoord_Trans_Tilt_Toe*sin(Roll_Angle) + ZCoord_Trans_Tilt_Toe*cos(Roll_Angle);
 
-            /*--- In 2D add the points directly (note the change between Y and Z coordinate) ---*/
+      /*--- Update coordinates ---*/
 
-            if (nDim == 2) {
-              Xcoord_Index0.push_back(Segment_P0[0]);                     Xcoord_Index1.push_back(Segment_P1[0]);
-              Ycoord_Index0.push_back(Segment_P0[2]);                     Ycoord_Index1.push_back(Segment_P1[2]);
-              Zcoord_Index0.push_back(Segment_P0[1]);                     Zcoord_Index1.push_back(Segment_P1[1]);
-              Variable_Index0.push_back(Variable_P0);                     Variable_Index1.push_back(Variable_P1);
-              IGlobalID_Index0.push_back(node[iPoint]->GetGlobalIndex()); IGlobalID_Index1.push_back(node[jPoint]->GetGlobalIndex());
-              JGlobalID_Index0.push_back(node[iPoint]->GetGlobalIndex()); JGlobalID_Index1.push_back(node[jPoint]->GetGlobalIndex());
-              PointIndex++;
-            }
+      Xcoord_Index1[iEdge] = XCoord; Ycoord_Index1[iEdge] = YCoord; Zcoord_Index1[iEdge] = ZCoord;
 
-            /*--- In 3D compute the intersection ---*/
-
-            else if (nDim == 3) {
-              intersect = SegmentIntersectsPlane(Segment_P0, Segment_P1, Variable_P0, Variable_P1, Plane_P0, Plane_Normal, Intersection, Variable_Interp);
-              if (intersect == true) {
-                if (PointIndex == 0) {
-                  Xcoord_Index0.push_back(Intersection[0]);
-                  Ycoord_Index0.push_back(Intersection[1]);
-                  Zcoord_Index0.push_back(Intersection[2]);
-                  Variable_Index0.push_back(Variable_Interp);
-                  IGlobalID_Index0.push_back(node[iPoint]->GetGlobalIndex());
-                  JGlobalID_Index0.push_back(node[jPoint]->GetGlobalIndex());
-                }
-                if (PointIndex == 1) {
-                  Xcoord_Index1.push_back(Intersection[0]);
-                  Ycoord_Index1.push_back(Intersection[1]);
-                  Zcoord_Index1.push_back(Intersection[2]);
-                  Variable_Index1.push_back(Variable_Interp);
-                  IGlobalID_Index1.push_back(node[iPoint]->GetGlobalIndex());
-                  JGlobalID_Index1.push_back(node[jPoint]->GetGlobalIndex());
-                }
-                PointIndex++;
-              }
-            }
-          }
-        }
-      }
     }
   }
 
-  if (original_surface == false) {
-    for (iPoint = 0; iPoint < nPoint; iPoint++)
-      delete [] Coord_Variation[iPoint];
-    delete [] Coord_Variation;
+  /*--- Identify the extreme of the curve and close it, by the number of other points of the
+   *    segments in the same edge of the surface ---*/
+
+  map<EdgeKey, unsigned short> nEdgePoints;
+  for (iEdge = 0; iEdge < Xcoord_Index0.size(); iEdge++) {
+    nEdgePoints[MakeEdgeKey(IGlobalID_Index0[iEdge], JGlobalID_Index0[iEdge])]++;
+    nEdgePoints[MakeEdgeKey(IGlobalID_Index1[iEdge], JGlobalID_Index1[iEdge])]++;
   }
 
-#ifdef HAVE_MPI
+  Conection_Index0.resize(Xcoord_Index0.size());
+  Conection_Index1.resize(Xcoord_Index0.size());
 
-  /*--- Copy the coordinates of all the points in the plane to the master node ---*/
+  for (iEdge = 0; iEdge < Xcoord_Index0.size(); iEdge++) {
+    Conection_Index0[iEdge] = nEdgePoints[MakeEdgeKey(IGlobalID_Index0[iEdge], JGlobalID_Index0[iEdge])] - 1;
+    Conection_Index1[iEdge] = nEdgePoints[MakeEdgeKey(IGlobalID_Index1[iEdge], JGlobalID_Index1[iEdge])] - 1;
+  }
 
-  nLocalEdge = 0, MaxLocalEdge = 0;
-  nProcessor = size;
+  /*--- Connect extremes of the curves ---*/
 
-  Buffer_Send_nEdge = new unsigned long [1];
-  Buffer_Receive_nEdge = new unsigned long [nProcessor];
+  /*--- First: Identify the extremes of the curve in the extra vector  ---*/
 
-  nLocalEdge = Xcoord_Index0.size();
+  for (iEdge = 0; iEdge < Xcoord_Index0.size(); iEdge++) {
+    if (Conection_Index0[iEdge] == 0) {
+      XcoordExtra.push_back(Xcoord_Index0[iEdge]);
+      YcoordExtra.push_back(Ycoord_Index0[iEdge]);
+      ZcoordExtra.push_back(Zcoord_Index0[iEdge]);
+      VariableExtra.push_back(Variable_Index0[iEdge]);
+      IGlobalIDExtra.push_back(IGlobalID_Index0[iEdge]);
+      JGlobalIDExtra.push_back(JGlobalID_Index0[iEdge]);
+      AddExtra.push_back(true);
+    }
+    if (Conection_Index1[iEdge] == 0) {
+      XcoordExtra.push_back(Xcoord_Index1[iEdge]);
+      YcoordExtra.push_back(Ycoord_Index1[iEdge]);
+      ZcoordExtra.push_back(Zcoord_Index1[iEdge]);
+      VariableExtra.push_back(Variable_Index1[iEdge]);
+      IGlobalIDExtra.push_back(IGlobalID_Index1[iEdge]);
+      JGlobalIDExtra.push_back(JGlobalID_Index1[iEdge]);
+      AddExtra.push_back(true);
+    }
+  }
 
-  Buffer_Send_nEdge[0] = nLocalEdge;
+  /*--- Second, if it is an open curve then find the closest point to an extreme to close it  ---*/
 
-  SU2_MPI::Allreduce(&nLocalEdge, &MaxLocalEdge, 1, MPI_UNSIGNED_LONG, MPI_MAX, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(Buffer_Send_nEdge, 1, MPI_UNSIGNED_LONG, Buffer_Receive_nEdge, 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+  if (XcoordExtra.size() > 1) {
 
-  Buffer_Send_Coord    = new su2double [MaxLocalEdge*6];
-  Buffer_Receive_Coord = new su2double [nProcessor*MaxLocalEdge*6];
+    for (iEdge = 0; iEdge < XcoordExtra.size()-1; iEdge++) {
 
-  Buffer_Send_Variable    = new su2double [MaxLocalEdge*2];
-  Buffer_Receive_Variable = new su2double [nProcessor*MaxLocalEdge*2];
+      su2double MinDist = 1E6; FoundEdge = false; EdgeDonor = 0;
+      for (jEdge = iEdge+1; jEdge < XcoordExtra.size(); jEdge++) {
+        Dist_Value = sqrt(pow(SU2_TYPE::GetValue(XcoordExtra[iEdge])-SU2_TYPE::GetValue(XcoordExtra[jEdge]), 2.0));
+        if ((Dist_Value < MinDist) && (AddExtra[iEdge]) && (AddExtra[jEdge])) {
+          EdgeDonor = jEdge; FoundEdge = true;
+        }
+      }
 
-  Buffer_Send_GlobalID    = new unsigned long [MaxLocalEdge*4];
-  Buffer_Receive_GlobalID = new unsigned long [nProcessor*MaxLocalEdge*4];
+      if (FoundEdge) {
 
-  nBuffer_Coord    = MaxLocalEdge*6;
-  nBuffer_Variable = MaxLocalEdge*2;
-  nBuffer_GlobalID = MaxLocalEdge*4;
+        /*--- Add first point of the new edge ---*/
 
-  for (iEdge = 0; iEdge < nLocalEdge; iEdge++) {
-    Buffer_Send_Coord[iEdge*6 + 0] = Xcoord_Index0[iEdge];
-    Buffer_Send_Coord[iEdge*6 + 1] = Ycoord_Index0[iEdge];
-    Buffer_Send_Coord[iEdge*6 + 2] = Zcoord_Index0[iEdge];
-    Buffer_Send_Coord[iEdge*6 + 3] = Xcoord_Index1[iEdge];
-    Buffer_Send_Coord[iEdge*6 + 4] = Ycoord_Index1[iEdge];
-    Buffer_Send_Coord[iEdge*6 + 5] = Zcoord_Index1[iEdge];
+        Xcoord_Index0.push_back (XcoordExtra[iEdge]);
+        Ycoord_Index0.push_back (YcoordExtra[iEdge]);
+        Zcoord_Index0.push_back (ZcoordExtra[iEdge]);
+        Variable_Index0.push_back (VariableExtra[iEdge]);
+        IGlobalID_Index0.push_back (IGlobalIDExtra[iEdge]);
+        JGlobalID_Index0.push_back (JGlobalIDExtra[iEdge]);
+        AddExtra[iEdge] = false;
 
-    Buffer_Send_Variable[iEdge*2 + 0] = Variable_Index0[iEdge];
-    Buffer_Send_Variable[iEdge*2 + 1] = Variable_Index1[iEdge];
+        /*--- Add second (closest)  point of the new edge ---*/
 
-    Buffer_Send_GlobalID[iEdge*4 + 0] = IGlobalID_Index0[iEdge];
-    Buffer_Send_GlobalID[iEdge*4 + 1] = JGlobalID_Index0[iEdge];
-    Buffer_Send_GlobalID[iEdge*4 + 2] = IGlobalID_Index1[iEdge];
-    Buffer_Send_GlobalID[iEdge*4 + 3] = JGlobalID_Index1[iEdge];
-  }
+        Xcoord_Index1.push_back (XcoordExtra[EdgeDonor]);
+        Ycoord_Index1.push_back (YcoordExtra[EdgeDonor]);
+        Zcoord_Index1.push_back (ZcoordExtra[EdgeDonor]);
+        Variable_Index1.push_back (VariableExtra[EdgeDonor]);
+        IGlobalID_Index1.push_back (IGlobalIDExtra[EdgeDonor]);
+        JGlobalID_Index1.push_back (JGlobalIDExtra[EdgeDonor]);
+        AddExtra[EdgeDonor] = false;
 
-  SU2_MPI::Allgather(Buffer_Send_Coord, nBuffer_Coord, MPI_DOUBLE, Buffer_Receive_Coord, nBuffer_Coord, MPI_DOUBLE, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(Buffer_Send_Variable, nBuffer_Variable, MPI_DOUBLE, Buffer_Receive_Variable, nBuffer_Variable, MPI_DOUBLE, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(Buffer_Send_GlobalID, nBuffer_GlobalID, MPI_UNSIGNED_LONG, Buffer_Receive_GlobalID, nBuffer_GlobalID, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+      }
 
-  /*--- Clean the vectors before adding the new vertices only to the master node ---*/
+    }
 
-  Xcoord_Index0.clear();     Xcoord_Index1.clear();
-  Ycoord_Index0.clear();     Ycoord_Index1.clear();
-  Zcoord_Index0.clear();     Zcoord_Index1.clear();
-  Variable_Index0.clear();   Variable_Index1.clear();
-  IGlobalID_Index0.clear();  IGlobalID_Index1.clear();
-  JGlobalID_Index0.clear();  JGlobalID_Index1.clear();
+  }
 
-  /*--- Copy the boundary to the master node vectors ---*/
+  else if (XcoordExtra.size() == 1) {
+    SU2_OMP_CRITICAL
+    cout <<"There cutting system has failed, there is an incomplete curve (not used)." << endl;
+  }
 
-  if (rank == MASTER_NODE) {
-    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
-      for (iEdge = 0; iEdge < Buffer_Receive_nEdge[iProcessor]; iEdge++) {
-        Xcoord_Index0.push_back( Buffer_Receive_Coord[ iProcessor*MaxLocalEdge*6 + iEdge*6 + 0] );
-        Ycoord_Index0.push_back( Buffer_Receive_Coord[ iProcessor*MaxLocalEdge*6 + iEdge*6 + 1] );
-        Zcoord_Index0.push_back( Buffer_Receive_Coord[ iProcessor*MaxLocalEdge*6 + iEdge*6 + 2] );
-        Xcoord_Index1.push_back( Buffer_Receive_Coord[ iProcessor*MaxLocalEdge*6 + iEdge*6 + 3] );
-        Ycoord_Index1.push_back( Buffer_Receive_Coord[ iProcessor*MaxLocalEdge*6 + iEdge*6 + 4] );
-        Zcoord_Index1.push_back( Buffer_Receive_Coord[ iProcessor*MaxLocalEdge*6 + iEdge*6 + 5] );
-
-        Variable_Index0.push_back( Buffer_Receive_Variable[ iProcessor*MaxLocalEdge*2 + iEdge*2 + 0] );
-        Variable_Index1.push_back( Buffer_Receive_Variable[ iProcessor*MaxLocalEdge*2 + iEdge*2 + 1] );
-
-        IGlobalID_Index0.push_back( Buffer_Receive_GlobalID[ iProcessor*MaxLocalEdge*4 + iEdge*4 + 0] );
-        JGlobalID_Index0.push_back( Buffer_Receive_GlobalID[ iProcessor*MaxLocalEdge*4 + iEdge*4 + 1] );
-        IGlobalID_Index1.push_back( Buffer_Receive_GlobalID[ iProcessor*MaxLocalEdge*4 + iEdge*4 + 2] );
-        JGlobalID_Index1.push_back( Buffer_Receive_GlobalID[ iProcessor*MaxLocalEdge*4 + iEdge*4 + 3] );
+  /*--- Find and add the trailing edge to to the list
+   and the contect the first point to the trailing edge ---*/
 
-      }
+  Trailing_Point = 0; Trailing_Coord = Xcoord_Index0[0];
+  for (iEdge = 1; iEdge < Xcoord_Index0.size(); iEdge++) {
+    if (Xcoord_Index0[iEdge] > Trailing_Coord) {
+      Trailing_Point = iEdge; Trailing_Coord = Xcoord_Index0[iEdge];
     }
   }
 
-  delete[] Buffer_Send_Coord;      delete[] Buffer_Receive_Coord;
-  delete[] Buffer_Send_Variable;   delete[] Buffer_Receive_Variable;
-  delete[] Buffer_Send_GlobalID;   delete[] Buffer_Receive_GlobalID;
-  delete[] Buffer_Send_nEdge;    delete[] Buffer_Receive_nEdge;
-
-#endif
-
-  if ((rank == MASTER_NODE) && (Xcoord_Index0.size() != 0)) {
+  Xcoord_Airfoil.push_back(Xcoord_Index0[Trailing_Point]);
+  Ycoord_Airfoil.push_back(Ycoord_Index0[Trailing_Point]);
+  Zcoord_Airfoil.push_back(Zcoord_Index0[Trailing_Point]);
+  Variable_Airfoil.push_back(Variable_Index0[Trailing_Point]);
+  IGlobalID_Airfoil.push_back(IGlobalID_Index0[Trailing_Point]);
+  JGlobalID_Airfoil.push_back(JGlobalID_Index0[Trailing_Point]);
+
+  Xcoord_Airfoil.push_back(Xcoord_Index1[Trailing_Point]);
+  Ycoord_Airfoil.push_back(Ycoord_Index1[Trailing_Point]);
+  Zcoord_Airfoil.push_back(Zcoord_Index1[Trailing_Point]);
+  Variable_Airfoil.push_back(Variable_Index1[Trailing_Point]);
+  IGlobalID_Airfoil.push_back(IGlobalID_Index1[Trailing_Point]);
+  JGlobalID_Airfoil.push_back(JGlobalID_Index1[Trailing_Point]);
+
+  /*--- Algorithm for adding the rest of the points, the next point is in the first remaining segment
+   *    (in the order of the list) with a point in the edge of the last added point. The points of the
+   *    segments are indexed by their edge, 2*iEdge+Index in the order of the list. ---*/
+
+  map<EdgeKey, vector<unsigned long> > EdgePoints;
+  for (iEdge = 0; iEdge < Xcoord_Index0.size(); iEdge++) {
+    EdgePoints[MakeEdgeKey(IGlobalID_Index0[iEdge], JGlobalID_Index0[iEdge])].push_back(2*iEdge);
+    EdgePoints[MakeEdgeKey(IGlobalID_Index1[iEdge], JGlobalID_Index1[iEdge])].push_back(2*iEdge+1);
+  }
 
-    /*--- Remove singular edges ---*/
+  vector<bool> Added(Xcoord_Index0.size(), false);
+  Added[Trailing_Point] = true;
+  unsigned long nRemaining = Xcoord_Index0.size()-1;
 
-    bool Remove;
+  while (nRemaining != 0) {
 
-    do { Remove = false;
-      for (iEdge = 0; iEdge < Xcoord_Index0.size(); iEdge++) {
+    /*--- Last added point in the list ---*/
 
-        if (((IGlobalID_Index0[iEdge] == IGlobalID_Index1[iEdge]) && (JGlobalID_Index0[iEdge] == JGlobalID_Index1[iEdge])) ||
-            ((IGlobalID_Index0[iEdge] == JGlobalID_Index1[iEdge]) && (JGlobalID_Index0[iEdge] == IGlobalID_Index1[iEdge]))) {
+    Airfoil_Point = Xcoord_Airfoil.size() - 1;
 
-          Xcoord_Index0.erase (Xcoord_Index0.begin() + iEdge);
-          Ycoord_Index0.erase (Ycoord_Index0.begin() + iEdge);
-          Zcoord_Index0.erase (Zcoord_Index0.begin() + iEdge);
-          Variable_Index0.erase (Variable_Index0.begin() + iEdge);
-          IGlobalID_Index0.erase (IGlobalID_Index0.begin() + iEdge);
-          JGlobalID_Index0.erase (JGlobalID_Index0.begin() + iEdge);
+    /*--- Find the closest point  ---*/
 
-          Xcoord_Index1.erase (Xcoord_Index1.begin() + iEdge);
-          Ycoord_Index1.erase (Ycoord_Index1.begin() + iEdge);
-          Zcoord_Index1.erase (Zcoord_Index1.begin() + iEdge);
-          Variable_Index1.erase (Variable_Index1.begin() + iEdge);
-          IGlobalID_Index1.erase (IGlobalID_Index1.begin() + iEdge);
-          JGlobalID_Index1.erase (JGlobalID_Index1.begin() + iEdge);
+    Found_Edge = false;
 
-          Remove = true; break;
+    const auto Candidates = EdgePoints.find(MakeEdgeKey(IGlobalID_Airfoil[Airfoil_Point], JGlobalID_Airfoil[Airfoil_Point]));
+    if (Candidates != EdgePoints.end()) {
+      for (const auto EdgePoint : Candidates->second) {
+        if (!Added[EdgePoint/2]) {
+          Next_Edge = EdgePoint/2; Index = EdgePoint%2; Found_Edge = true; break;
         }
-        if (Remove) break;
       }
-    } while (Remove == true);
-
-    /*--- Remove repeated edges computing distance, this could happend because the MPI ---*/
-
-    do { Remove = false;
-      for (iEdge = 0; iEdge < Xcoord_Index0.size()-1; iEdge++) {
-        for (jEdge = iEdge+1; jEdge < Xcoord_Index0.size(); jEdge++) {
+    }
 
-          /*--- Edges with the same orientation ---*/
+    if (!Found_Edge) break;
 
-          if ((((IGlobalID_Index0[iEdge] == IGlobalID_Index0[jEdge]) && (JGlobalID_Index0[iEdge] == JGlobalID_Index0[jEdge])) ||
-               ((IGlobalID_Index0[iEdge] == JGlobalID_Index0[jEdge]) && (JGlobalID_Index0[iEdge] == IGlobalID_Index0[jEdge]))) &&
-              (((IGlobalID_Index1[iEdge] == IGlobalID_Index1[jEdge]) && (JGlobalID_Index1[iEdge] == JGlobalID_Index1[jEdge])) ||
-               ((IGlobalID_Index1[iEdge] == JGlobalID_Index1[jEdge]) && (JGlobalID_Index1[iEdge] == IGlobalID_Index1[jEdge])))) {
+    /*--- Add the next point to the list and remove the edge ---*/
 
-                Xcoord_Index0.erase (Xcoord_Index0.begin() + jEdge);
-                Ycoord_Index0.erase (Ycoord_Index0.begin() + jEdge);
-                Zcoord_Index0.erase (Zcoord_Index0.begin() + jEdge);
-                Variable_Index0.erase (Variable_Index0.begin() + jEdge);
-                IGlobalID_Index0.erase (IGlobalID_Index0.begin() + jEdge);
-                JGlobalID_Index0.erase (JGlobalID_Index0.begin() + jEdge);
+    if (Index == 0) {
+      Xcoord_Airfoil.push_back(Xcoord_Index1[Next_Edge]);
+      Ycoord_Airfoil.push_back(Ycoord_Index1[Next_Edge]);
+      Zcoord_Airfoil.push_back(Zcoord_Index1[Next_Edge]);
+      Variable_Airfoil.push_back(Variable_Index1[Next_Edge]);
+      IGlobalID_Airfoil.push_back(IGlobalID_Index1[Next_Edge]);
+      JGlobalID_Airfoil.push_back(JGlobalID_Index1[Next_Edge]);
+    }
 
-                Xcoord_Index1.erase (Xcoord_Index1.begin() + jEdge);
-                Ycoord_Index1.erase (Ycoord_Index1.begin() + jEdge);
-                Zcoord_Index1.erase (Zcoord_Index1.begin() + jEdge);
-                Variable_Index1.erase (Variable_Index1.begin() + jEdge);
-                IGlobalID_Index1.erase (IGlobalID_Index1.begin() + jEdge);
-                JGlobalID_Index1.erase (JGlobalID_Index1.begin() + jEdge);
+    if (Index == 1) {
+      Xcoord_Airfoil.push_back(Xcoord_Index0[Next_Edge]);
+      Ycoord_Airfoil.push_back(Ycoord_Index0[Next_Edge]);
+      Zcoord_Airfoil.push_back(Zcoord_Index0[Next_Edge]);
+      Variable_Airfoil.push_back(Variable_Index0[Next_Edge]);
+      IGlobalID_Airfoil.push_back(IGlobalID_Index0[Next_Edge]);
+      JGlobalID_Airfoil.push_back(JGlobalID_Index0[Next_Edge]);
+    }
 
-                Remove = true; break;
+    Added[Next_Edge] = true;
+    nRemaining--;
 
-              }
+  }
 
-          /*--- Edges with oposite orientation ---*/
+}
 
-          if ((((IGlobalID_Index0[iEdge] == IGlobalID_Index1[jEdge]) && (JGlobalID_Index0[iEdge] == JGlobalID_Index1[jEdge])) ||
-               ((IGlobalID_Index0[iEdge] == JGlobalID_Index1[jEdge]) && (JGlobalID_Index0[iEdge] == IGlobalID_Index1[jEdge]))) &&
-              (((IGlobalID_Index1[iEdge] == IGlobalID_Index0[jEdge]) && (JGlobalID_Index1[iEdge] == JGlobalID_Index0[jEdge])) ||
-               ((IGlobalID_Index1[iEdge] == JGlobalID_Index0[jEdge]) && (JGlobalID_Index1[iEdge] == IGlobalID_Index0[jEdge])))) {
+}
 
-                Xcoord_Index0.erase (Xcoord_Index0.begin() + jEdge);
-                Ycoord_Index0.erase (Ycoord_Index0.begin() + jEdge);
-                Zcoord_Index0.erase (Zcoord_Index0.begin() + jEdge);
-                Variable_Index0.erase (Variable_Index0.begin() + jEdge);
-                IGlobalID_Index0.erase (IGlobalID_Index0.begin() + jEdge);
-                JGlobalID_Index0.erase (JGlobalID_Index0.begin() + jEdge);
+void CGeometry::ComputeAirfoil_Section(su2double *Plane_P0, su2double *Plane_Normal,
+                                       su2double MinXCoord, su2double MaxXCoord,
+                                       su2double MinYCoord, su2double MaxYCoord,
+                                       su2double MinZCoord, su2double MaxZCoord,
+                                       su2double *FlowVariable,
+                                       vector<su2double> &Xcoord_Airfoil, vector<su2double> &Ycoord_Airfoil,
+                                       vector<su2double> &Zcoord_Airfoil, vector<su2double> &Variable_Airfoil,
+                                       bool original_surface, CConfig *config) {
 
-                Xcoord_Index1.erase (Xcoord_Index1.begin() + jEdge);
-                Ycoord_Index1.erase (Ycoord_Index1.begin() + jEdge);
-                Zcoord_Index1.erase (Zcoord_Index1.begin() + jEdge);
-                Variable_Index1.erase (Variable_Index1.begin() + jEdge);
-                IGlobalID_Index1.erase (IGlobalID_Index1.begin() + jEdge);
-                JGlobalID_Index1.erase (JGlobalID_Index1.begin() + jEdge);
+  ComputeAirfoil_Sections(1, &Plane_P0, &Plane_Normal, MinXCoord, MaxXCoord, MinYCoord, MaxYCoord,
+                          MinZCoord, MaxZCoord, FlowVariable, &Xcoord_Airfoil, &Ycoord_Airfoil,
+                          &Zcoord_Airfoil, &Variable_Airfoil, original_surface, config);
+}
 
-                Remove = true; break;
-              }
-          if (Remove) break;
-        }
-        if (Remove) break;
-      }
+void CGeometry::ComputeAirfoil_Sections(unsigned short nPlane, su2double **Plane_P0, su2double **Plane_Normal,
+                                        su2double MinXCoord, su2double MaxXCoord,
+                                        su2double MinYCoord, su2double MaxYCoord,
+                                        su2double MinZCoord, su2double MaxZCoord,
+                                        su2double *FlowVariable,
+                                        vector<su2double> *Xcoord_Airfoil, vector<su2double> *Ycoord_Airfoil,
+                                        vector<su2double> *Zcoord_Airfoil, vector<su2double> *Variable_Airfoil,
+                                        bool original_surface, CConfig *config) {
 
-    } while (Remove == true);
+  /*--- Same perturbation of the planes as SegmentIntersectsPlane. ---*/
 
-    if (Xcoord_Index0.size() != 1) {
+  const su2double epsilon = 1E-6;
 
-      /*--- Rotate from the Y-Z plane to the X-Z plane to reuse the rest of subroutines  ---*/
+  unsigned short iPlane, iMarker, iNode, iDim;
+  unsigned long iPoint, iElem, iVertex;
 
-      if (config->GetGeo_Description() == FUSELAGE) {
-        su2double Angle = -0.5*PI_NUMBER;
-        for (iEdge = 0; iEdge < Xcoord_Index0.size(); iEdge++) {
-          su2double XCoord = Xcoord_Index0[iEdge]*cos(Angle) - Ycoord_Index0[iEdge]*sin(Angle);
-          su2double YCoord = Ycoord_Index0[iEdge]*cos(Angle) + Xcoord_Index0[iEdge]*sin(Angle);
-          su2double ZCoord = Zcoord_Index0[iEdge];
-          Xcoord_Index0[iEdge] = XCoord; Ycoord_Index0[iEdge] = YCoord; Zcoord_Index0[iEdge] = ZCoord;
-          XCoord = Xcoord_Index1[iEdge]*cos(Angle) - Ycoord_Index1[iEdge]*sin(Angle);
-          YCoord = Ycoord_Index1[iEdge]*cos(Angle) + Xcoord_Index1[iEdge]*sin(Angle);
-          ZCoord = Zcoord_Index1[iEdge];
-          Xcoord_Index1[iEdge] = XCoord; Ycoord_Index1[iEdge] = YCoord; Zcoord_Index1[iEdge] = ZCoord;
-        }
-      }
+  for (iPlane = 0; iPlane < nPlane; iPlane++) {
+    Xcoord_Airfoil[iPlane].clear();
+    Ycoord_Airfoil[iPlane].clear();
+    Zcoord_Airfoil[iPlane].clear();
+    Variable_Airfoil[iPlane].clear();
+  }
 
-      /*--- Rotate nacelle secction to a X-Z plane to reuse the rest of subroutines  ---*/
+  /*--- Set the right plane in 2D (note the change in Y-Z plane) ---*/
 
+  if (nDim == 2) {
+    for (iPlane = 0; iPlane < nPlane; iPlane++) {
+      Plane_P0[iPlane][0] = 0.0;      Plane_P0[iPlane][1] = 0.0;      Plane_P0[iPlane][2] = 0.0;
+      Plane_Normal[iPlane][0] = 0.0;  Plane_Normal[iPlane][1] = 1.0;  Plane_Normal[iPlane][2] = 0.0;
+    }
+  }
 
-      if (config->GetGeo_Description() == NACELLE) {
+  /*--- Coordinates of the surface points, with the grid movement (stored in the vertices)
+   if the surface is not the original one ---*/
 
-        su2double Tilt_Angle = config->GetNacelleLocation(3)*PI_NUMBER/180;
-        su2double Toe_Angle = config->GetNacelleLocation(4)*PI_NUMBER/180;
-        su2double Theta_deg = atan2(Plane_Normal[1],-Plane_Normal[2])/PI_NUMBER*180 + 180;
-        su2double Roll_Angle = 0.5*PI_NUMBER - Theta_deg*PI_NUMBER/180;
+  vector<su2double> SurfaceCoord(nPoint*3, 0.0);
+  su2double CoordScale = 0.0;
 
-        su2double XCoord_Trans, YCoord_Trans, ZCoord_Trans, XCoord_Trans_Tilt, YCoord_Trans_Tilt, ZCoord_Trans_Tilt,
-        XCoord_Trans_Tilt_Toe, YCoord_Trans_Tilt_Toe, ZCoord_Trans_Tilt_Toe, XCoord, YCoord, ZCoord;
+  for (iMarker = 0; iMarker < nMarker; iMarker++) {
+    if (config->GetMarker_All_GeoEval(iMarker) == YES) {
+      for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
+        iPoint = vertex[iMarker][iVertex]->GetNode();
+        const su2double *VarCoord = vertex[iMarker][iVertex]->GetVarCoord();
+        for (iDim = 0; iDim < nDim; iDim++) {
+          SurfaceCoord[iPoint*3+iDim] = node[iPoint]->GetCoord(iDim);
+          if (original_surface == false) SurfaceCoord[iPoint*3+iDim] += VarCoord[iDim];
+          CoordScale = max(CoordScale, fabs(SurfaceCoord[iPoint*3+iDim]));
+        }
+      }
+    }
+  }
 
-        for (iEdge = 0; iEdge < Xcoord_Index0.size(); iEdge++) {
+  /*--- The planes can be indexed when they are parallel (e.g. the stations of a wing or a fuselage). ---*/
 
-          /*--- First point of the edge ---*/
+  bool CommonNormal = (nDim == 3) && (nPlane > 1);
+  for (iPlane = 1; CommonNormal && (iPlane < nPlane); iPlane++)
+    for (iDim = 0; iDim < 3; iDim++)
+      CommonNormal = CommonNormal && (Plane_Normal[iPlane][iDim] == Plane_Normal[0][iDim]);
 
-          /*--- Translate to the origin ---*/
+  /*--- To decide if an element is going to be used or not should be done element based, the first step
+   is to compute and average coordinate for the element, and its extent along the normal of the planes ---*/
 
-          XCoord_Trans = Xcoord_Index0[iEdge] - config->GetNacelleLocation(0);
-          YCoord_Trans = Ycoord_Index0[iEdge] - config->GetNacelleLocation(1);
-          ZCoord_Trans = Zcoord_Index0[iEdge] - config->GetNacelleLocation(2);
+  const bool nacelle = (config->GetGeo_Description() == NACELLE);
+  const su2double Tilt_Angle = config->GetNacelleLocation(3)*PI_NUMBER/180;
+  const su2double Toe_Angle = config->GetNacelleLocation(4)*PI_NUMBER/180;
 
-          /*--- Apply tilt angle ---*/
+  vector<CSectionElement> Elements;
 
-          XCoord_Trans_Tilt = XCoord_Trans*cos(Tilt_Angle) + ZCoord_Trans*sin(Tilt_Angle);
-          YCoord_Trans_Tilt = YCoord_Trans;
-          ZCoord_Trans_Tilt = ZCoord_Trans*cos(Tilt_Angle) - XCoord_Trans*sin(Tilt_Angle);
+  for (iMarker = 0; iMarker < nMarker; iMarker++) {
 
-          /*--- Apply toe angle ---*/
+    if (config->GetMarker_All_GeoEval(iMarker) != YES) continue;
 
-          XCoord_Trans_Tilt_Toe = XCoord_Trans_Tilt*cos(Toe_Angle) - YCoord_Trans_Tilt*sin(Toe_Angle);
-          YCoord_Trans_Tilt_Toe = XCoord_Trans_Tilt*sin(Toe_Angle) + YCoord_Trans_Tilt*cos(Toe_Angle);
-          ZCoord_Trans_Tilt_Toe = ZCoord_Trans_Tilt;
+    for (iElem = 0; iElem < nElem_Bound[iMarker]; iElem++) {
 
-          /*--- Rotate to X-Z plane (roll) ---*/
+      CSectionElement Element;
+      Element.iMarker = iMarker;
+      Element.iElem = iElem;
 
-          XCoord = XCoord_Trans_Tilt_Toe;
-          YCoord = YCoord_Trans_Tilt_Toe*cos(Roll_Angle) - ZCoord_Trans_Tilt_Toe*sin(Roll_Angle);
-          ZCoord = YCoord_Trans_Tilt_Toe*sin(Roll_Angle) + ZCoord_Trans_Tilt_Toe*cos(Roll_Angle);
+      su2double AveXCoord = 0.0;
+      su2double AveYCoord = 0.0;
+      su2double AveZCoord = 0.0;
 
-          /*--- Update coordinates ---*/
+      for (iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++) {
+        iPoint = bound[iMarker][iElem]->GetNode(iNode);
+        AveXCoord += node[iPoint]->GetCoord(0);
+        AveYCoord += node[iPoint]->GetCoord(1);
+        if (nDim == 3) AveZCoord += node[iPoint]->GetCoord(2);
+      }
 
-          Xcoord_Index0[iEdge] = XCoord; Ycoord_Index0[iEdge] = YCoord; Zcoord_Index0[iEdge] = ZCoord;
+      AveXCoord /= su2double(bound[iMarker][iElem]->GetnNodes());
+      AveYCoord /= su2double(bound[iMarker][iElem]->GetnNodes());
+      AveZCoord /= su2double(bound[iMarker][iElem]->GetnNodes());
 
-          /*--- Second point of the edge ---*/
+      Element.inBounds = ((AveXCoord > MinXCoord) && (AveXCoord < MaxXCoord)) &&
+                         ((AveYCoord > MinYCoord) && (AveYCoord < MaxYCoord)) &&
+                         ((AveZCoord > MinZCoord) && (AveZCoord < MaxZCoord));
 
-          /*--- Translate to the origin ---*/
+      /*--- To only cut one part of the nacelle based on the cross product of the normal to the
+       plane and a vector that connect the point with the center line (frame of the nacelle) ---*/
 
-          XCoord_Trans = Xcoord_Index1[iEdge] - config->GetNacelleLocation(0);
-          YCoord_Trans = Ycoord_Index1[iEdge] - config->GetNacelleLocation(1);
-          ZCoord_Trans = Zcoord_Index1[iEdge] - config->GetNacelleLocation(2);
+      Element.YCoord_Nacelle = 0.0;
+      Element.ZCoord_Nacelle = 0.0;
 
-          /*--- Apply tilt angle ---*/
+      if (nacelle) {
 
-          XCoord_Trans_Tilt = XCoord_Trans*cos(Tilt_Angle) + ZCoord_Trans*sin(Tilt_Angle);
-          YCoord_Trans_Tilt = YCoord_Trans;
-          ZCoord_Trans_Tilt = ZCoord_Trans*cos(Tilt_Angle) - XCoord_Trans*sin(Tilt_Angle);
+        /*--- Translate to the origin ---*/
 
-          /*--- Apply toe angle ---*/
+        su2double XCoord_Trans = AveXCoord - config->GetNacelleLocation(0);
+        su2double YCoord_Trans = AveYCoord - config->GetNacelleLocation(1);
+        su2double ZCoord_Trans = AveZCoord - config->GetNacelleLocation(2);
 
-          XCoord_Trans_Tilt_Toe = XCoord_Trans_Tilt*cos(Toe_Angle) - YCoord_Trans_Tilt*sin(Toe_Angle);
-          YCoord_Trans_Tilt_Toe = XCoord_Trans_Tilt*sin(Toe_Angle) + YCoord_Trans_Tilt*cos(Toe_Angle);
-          ZCoord_Trans_Tilt_Toe = ZCoord_Trans_Tilt;
+        /*--- Apply tilt angle ---*/
 
-          /*--- Rotate to X-Z plane (roll) ---*/
+        su2double XCoord_Trans_Tilt = XCoord_Trans*cos(Tilt_Angle) + ZCoord_Trans*sin(Tilt_Angle);
+        su2double YCoord_Trans_Tilt = YCoord_Trans;
+        su2double ZCoord_Trans_Tilt = ZCoord_Trans*cos(Tilt_Angle) - XCoord_Trans*sin(Tilt_Angle);
 
-          XCoord = XCoord_Trans_Tilt_Toe;
-          YCoord = YCoord_Trans_Tilt_Toe*cos(Roll_Angle) - ZCoord_Trans_Tilt_Toe*sin(Roll_Angle);
-          ZCoord = YCoord_Trans_Tilt_Toe*sin(Roll_Angle) + ZCoord_Trans_Tilt_Toe*cos(Roll_Angle);
+        /*--- Apply toe angle ---*/
 
-          /*--- Update coordinates ---*/
+        Element.YCoord_Nacelle = XCoord_Trans_Tilt*sin(Toe_Angle) + YCoord_Trans_Tilt*cos(Toe_Angle);
+        Element.ZCoord_Nacelle = ZCoord_Trans_Tilt;
+      }
 
-          Xcoord_Index1[iEdge] = XCoord; Ycoord_Index1[iEdge] = YCoord; Zcoord_Index1[iEdge] = ZCoord;
+      Element.MinProj = 0.0;
+      Element.MaxProj = 0.0;
 
+      if (CommonNormal) {
+        Element.MinProj = 1E30;
+        Element.MaxProj = -1E30;
+        for (iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++) {
+          iPoint = bound[iMarker][iElem]->GetNode(iNode);
+          su2double Proj = 0.0;
+          for (iDim = 0; iDim < 3; iDim++) Proj += (Plane_Normal[0][iDim]+epsilon)*SurfaceCoord[iPoint*3+iDim];
+          Element.MinProj = min(Element.MinProj, Proj);
+          Element.MaxProj = max(Element.MaxProj, Proj);
         }
       }
 
+      Elements.push_back(Element);
+    }
+  }
 
-      /*--- Identify the extreme of the curve and close it ---*/
+  /*--- Bucket list of the elements along the common normal, each bucket lists, in the order of
+   the markers, the elements whose extent (with a tolerance) overlaps it. The tolerance is far
+   larger than the round-off of the intersections, the elements that are not cut are rejected
+   by the exact intersection test. ---*/
 
-      Conection_Index0.reserve(Xcoord_Index0.size()+1);
-      Conection_Index1.reserve(Xcoord_Index0.size()+1);
+  unsigned long nBucket = 1;
+  su2double MinBucket = 0.0, BucketWidth = 1.0, Tolerance = 0.0;
+  vector<vector<unsigned long> > Buckets;
 
-      for (iEdge = 0; iEdge < Xcoord_Index0.size(); iEdge++) {
-        Conection_Index0[iEdge] = 0;
-        Conection_Index1[iEdge] = 0;
-      }
+  auto GetBucket = [&](su2double Proj) {
+    const su2double Position = floor((Proj - MinBucket)/BucketWidth);
+    if (Position < 0.0) return 0ul;
+    return min(static_cast<unsigned long>(SU2_TYPE::GetValue(Position)), nBucket-1);
+  };
 
-      for (iEdge = 0; iEdge < Xcoord_Index0.size()-1; iEdge++) {
-        for (jEdge = iEdge+1; jEdge < Xcoord_Index0.size(); jEdge++) {
+  if (CommonNormal && !Elements.empty()) {
 
-          if (((IGlobalID_Index0[iEdge] == IGlobalID_Index0[jEdge]) && (JGlobalID_Index0[iEdge] == JGlobalID_Index0[jEdge])) ||
-              ((IGlobalID_Index0[iEdge] == JGlobalID_Index0[jEdge]) && (JGlobalID_Index0[iEdge] == IGlobalID_Index0[jEdge])))
-          { Conection_Index0[iEdge]++; Conection_Index0[jEdge]++; }
+    su2double MaxBucket = -1E30;
+    MinBucket = 1E30;
+    for (const auto& Element : Elements) {
+      MinBucket = min(MinBucket, Element.MinProj);
+      MaxBucket = max(MaxBucket, Element.MaxProj);
+    }
 
-          if (((IGlobalID_Index0[iEdge] == IGlobalID_Index1[jEdge]) && (JGlobalID_Index0[iEdge] == JGlobalID_Index1[jEdge])) ||
-              ((IGlobalID_Index0[iEdge] == JGlobalID_Index1[jEdge]) && (JGlobalID_Index0[iEdge] == IGlobalID_Index1[jEdge])))
-          { Conection_Index0[iEdge]++; Conection_Index1[jEdge]++; }
+    su2double NormalScale = 0.0;
+    for (iDim = 0; iDim < 3; iDim++) NormalScale += fabs(Plane_Normal[0][iDim]+epsilon);
+    Tolerance = 1E-9*CoordScale*NormalScale;
 
-          if (((IGlobalID_Index1[iEdge] == IGlobalID_Index0[jEdge]) && (JGlobalID_Index1[iEdge] == JGlobalID_Index0[jEdge])) ||
-              ((IGlobalID_Index1[iEdge] == JGlobalID_Index0[jEdge]) && (JGlobalID_Index1[iEdge] == IGlobalID_Index0[jEdge])))
-          { Conection_Index1[iEdge]++; Conection_Index0[jEdge]++; }
+    nBucket = max<unsigned long>(1, min<unsigned long>(Elements.size()/16, 4*nPlane));
+    BucketWidth = (MaxBucket - MinBucket)/su2double(nBucket);
+    if (BucketWidth <= 0.0) { nBucket = 1; BucketWidth = 1.0; }
 
-          if (((IGlobalID_Index1[iEdge] == IGlobalID_Index1[jEdge]) && (JGlobalID_Index1[iEdge] == JGlobalID_Index1[jEdge])) ||
-              ((IGlobalID_Index1[iEdge] == JGlobalID_Index1[jEdge]) && (JGlobalID_Index1[iEdge] == IGlobalID_Index1[jEdge])))
-          { Conection_Index1[iEdge]++; Conection_Index1[jEdge]++; }
+    Buckets.resize(nBucket);
+    for (unsigned long iElement = 0; iElement < Elements.size(); iElement++) {
+      const unsigned long FirstBucket = GetBucket(Elements[iElement].MinProj - Tolerance);
+      const unsigned long LastBucket = GetBucket(Elements[iElement].MaxProj + Tolerance);
+      for (unsigned long iBucket = FirstBucket; iBucket <= LastBucket; iBucket++)
+        Buckets[iBucket].push_back(iElement);
+    }
+  }
 
-        }
-      }
+  /*--- Intersect the planes with the surface, each thread computes the segments of entire planes. ---*/
 
-      /*--- Connect extremes of the curves ---*/
+  vector<CSectionSegments> Segments(nPlane);
 
-      /*--- First: Identify the extremes of the curve in the extra vector  ---*/
+  SU2_OMP_PARALLEL_(for schedule(dynamic,1))
+  for (iPlane = 0; iPlane < nPlane; iPlane++) {
 
-      for (iEdge = 0; iEdge < Xcoord_Index0.size(); iEdge++) {
-        if (Conection_Index0[iEdge] == 0) {
-          XcoordExtra.push_back(Xcoord_Index0[iEdge]);
-          YcoordExtra.push_back(Ycoord_Index0[iEdge]);
-          ZcoordExtra.push_back(Zcoord_Index0[iEdge]);
-          VariableExtra.push_back(Variable_Index0[iEdge]);
-          IGlobalIDExtra.push_back(IGlobalID_Index0[iEdge]);
-          JGlobalIDExtra.push_back(JGlobalID_Index0[iEdge]);
-          AddExtra.push_back(true);
-        }
-        if (Conection_Index1[iEdge] == 0) {
-          XcoordExtra.push_back(Xcoord_Index1[iEdge]);
-          YcoordExtra.push_back(Ycoord_Index1[iEdge]);
-          ZcoordExtra.push_back(Zcoord_Index1[iEdge]);
-          VariableExtra.push_back(Variable_Index1[iEdge]);
-          IGlobalIDExtra.push_back(IGlobalID_Index1[iEdge]);
-          JGlobalIDExtra.push_back(JGlobalID_Index1[iEdge]);
-          AddExtra.push_back(true);
-        }
-      }
+    su2double *PlaneP0 = Plane_P0[iPlane], *PlaneNormal = Plane_Normal[iPlane];
+    CSectionSegments &PlaneSegments = Segments[iPlane];
 
-      /*--- Second, if it is an open curve then find the closest point to an extreme to close it  ---*/
+    /*--- Undo plane rotation, we have already rotated the nacelle ---*/
 
-      if (XcoordExtra.size() > 1) {
+    su2double YPlane_Normal_Tilt_Toe = 0.0, ZPlane_Normal_Tilt_Toe = 0.0;
 
-        for (iEdge = 0; iEdge < XcoordExtra.size()-1; iEdge++) {
+    if (nacelle) {
 
-          su2double MinDist = 1E6; FoundEdge = false; EdgeDonor = 0;
-          for (jEdge = iEdge+1; jEdge < XcoordExtra.size(); jEdge++) {
-            Dist_Value = sqrt(pow(SU2_TYPE::GetValue(XcoordExtra[iEdge])-SU2_TYPE::GetValue(XcoordExtra[jEdge]), 2.0));
-            if ((Dist_Value < MinDist) && (AddExtra[iEdge]) && (AddExtra[jEdge])) {
-              EdgeDonor = jEdge; FoundEdge = true;
-            }
-          }
+      /*--- Undo tilt angle ---*/
 
-          if (FoundEdge) {
+      su2double XPlane_Normal_Tilt = PlaneNormal[0]*cos(-Tilt_Angle) + PlaneNormal[2]*sin(-Tilt_Angle);
+      su2double YPlane_Normal_Tilt = PlaneNormal[1];
+      su2double ZPlane_Normal_Tilt = PlaneNormal[2]*cos(-Tilt_Angle) - PlaneNormal[0]*sin(-Tilt_Angle);
 
-            /*--- Add first point of the new edge ---*/
+      /*--- Undo toe angle ---*/
 
-            Xcoord_Index0.push_back (XcoordExtra[iEdge]);
-            Ycoord_Index0.push_back (YcoordExtra[iEdge]);
-            Zcoord_Index0.push_back (ZcoordExtra[iEdge]);
-            Variable_Index0.push_back (VariableExtra[iEdge]);
-            IGlobalID_Index0.push_back (IGlobalIDExtra[iEdge]);
-            JGlobalID_Index0.push_back (JGlobalIDExtra[iEdge]);
-            AddExtra[iEdge] = false;
+      YPlane_Normal_Tilt_Toe = XPlane_Normal_Tilt*sin(-Toe_Angle) + YPlane_Normal_Tilt*cos(-Toe_Angle);
+      ZPlane_Normal_Tilt_Toe = ZPlane_Normal_Tilt;
+    }
 
-            /*--- Add second (closest)  point of the new edge ---*/
+    /*--- Position of the (perturbed) plane along its normal, to skip the elements it does not cut. ---*/
 
-            Xcoord_Index1.push_back (XcoordExtra[EdgeDonor]);
-            Ycoord_Index1.push_back (YcoordExtra[EdgeDonor]);
-            Zcoord_Index1.push_back (ZcoordExtra[EdgeDonor]);
-            Variable_Index1.push_back (VariableExtra[EdgeDonor]);
-            IGlobalID_Index1.push_back (IGlobalIDExtra[EdgeDonor]);
-            JGlobalID_Index1.push_back (JGlobalIDExtra[EdgeDonor]);
-            AddExtra[EdgeDonor] = false;
+    su2double PlaneProj = 0.0, PlaneTolerance = Tolerance;
+    if (nDim == 3) {
+      su2double NormalScale = 0.0;
+      for (unsigned short iDim = 0; iDim < 3; iDim++) {
+        PlaneProj += (PlaneNormal[iDim]+epsilon)*(PlaneP0[iDim]+epsilon);
+        NormalScale += fabs(PlaneNormal[iDim]+epsilon);
+      }
+      if (!CommonNormal) PlaneTolerance = 1E-9*CoordScale*NormalScale;
+    }
 
-          }
+    const vector<unsigned long> *Candidates = nullptr;
+    if (CommonNormal && !Elements.empty()) Candidates = &Buckets[GetBucket(PlaneProj)];
 
-        }
+    const unsigned long nCandidate = Candidates? Candidates->size() : Elements.size();
 
-      }
+    for (unsigned long iCandidate = 0; iCandidate < nCandidate; iCandidate++) {
 
-      else if (XcoordExtra.size() == 1) {
-        cout <<"There cutting system has failed, there is an incomplete curve (not used)." << endl;
-      }
+      const CSectionElement &Element = Elements[Candidates? (*Candidates)[iCandidate] : iCandidate];
+      CPrimalGrid *Bound = bound[Element.iMarker][Element.iElem];
 
-      /*--- Find and add the trailing edge to to the list
-       and the contect the first point to the trailing edge ---*/
+      if (!Element.inBounds) continue;
 
-      Trailing_Point = 0; Trailing_Coord = Xcoord_Index0[0];
-      for (iEdge = 1; iEdge < Xcoord_Index0.size(); iEdge++) {
-        if (Xcoord_Index0[iEdge] > Trailing_Coord) {
-          Trailing_Point = iEdge; Trailing_Coord = Xcoord_Index0[iEdge];
+      if (nDim == 3) {
+        su2double MinProj = Element.MinProj, MaxProj = Element.MaxProj;
+        if (!CommonNormal) {
+          MinProj = 1E30; MaxProj = -1E30;
+          for (unsigned short iNode = 0; iNode < Bound->GetnNodes(); iNode++) {
+            const unsigned long iPoint = Bound->GetNode(iNode);
+            su2double Proj = 0.0;
+            for (unsigned short iDim = 0; iDim < 3; iDim++) Proj += (PlaneNormal[iDim]+epsilon)*SurfaceCoord[iPoint*3+iDim];
+            MinProj = min(MinProj, Proj);
+            MaxProj = max(MaxProj, Proj);
+          }
         }
+        if ((MinProj > PlaneProj + PlaneTolerance) || (MaxProj < PlaneProj - PlaneTolerance)) continue;
       }
 
-      Xcoord_Airfoil.push_back(Xcoord_Index0[Trailing_Point]);
-      Ycoord_Airfoil.push_back(Ycoord_Index0[Trailing_Point]);
-      Zcoord_Airfoil.push_back(Zcoord_Index0[Trailing_Point]);
-      Variable_Airfoil.push_back(Variable_Index0[Trailing_Point]);
-      IGlobalID_Airfoil.push_back(IGlobalID_Index0[Trailing_Point]);
-      JGlobalID_Airfoil.push_back(JGlobalID_Index0[Trailing_Point]);
-
-      Xcoord_Airfoil.push_back(Xcoord_Index1[Trailing_Point]);
-      Ycoord_Airfoil.push_back(Ycoord_Index1[Trailing_Point]);
-      Zcoord_Airfoil.push_back(Zcoord_Index1[Trailing_Point]);
-      Variable_Airfoil.push_back(Variable_Index1[Trailing_Point]);
-      IGlobalID_Airfoil.push_back(IGlobalID_Index1[Trailing_Point]);
-      JGlobalID_Airfoil.push_back(JGlobalID_Index1[Trailing_Point]);
-
-      Xcoord_Index0.erase (Xcoord_Index0.begin() + Trailing_Point);
-      Ycoord_Index0.erase (Ycoord_Index0.begin() + Trailing_Point);
-      Zcoord_Index0.erase (Zcoord_Index0.begin() + Trailing_Point);
-      Variable_Index0.erase (Variable_Index0.begin() + Trailing_Point);
-      IGlobalID_Index0.erase (IGlobalID_Index0.begin() + Trailing_Point);
-      JGlobalID_Index0.erase (JGlobalID_Index0.begin() + Trailing_Point);
+      su2double CrossProduct = 1.0;
+      if (nacelle) CrossProduct = (Element.YCoord_Nacelle*ZPlane_Normal_Tilt_Toe - Element.ZCoord_Nacelle*YPlane_Normal_Tilt_Toe) * 1.0;
+      if (!(CrossProduct >= 0.0)) continue;
 
-      Xcoord_Index1.erase (Xcoord_Index1.begin() + Trailing_Point);
-      Ycoord_Index1.erase (Ycoord_Index1.begin() + Trailing_Point);
-      Zcoord_Index1.erase (Zcoord_Index1.begin() + Trailing_Point);
-      Variable_Index1.erase (Variable_Index1.begin() + Trailing_Point);
-      IGlobalID_Index1.erase (IGlobalID_Index1.begin() + Trailing_Point);
-      JGlobalID_Index1.erase (JGlobalID_Index1.begin() + Trailing_Point);
+      unsigned short PointIndex = 0;
+      su2double Intersection[3] = {0.0, 0.0, 0.0}, FirstIntersection[3] = {0.0, 0.0, 0.0};
+      su2double Variable_Interp = 0.0, FirstVariable = 0.0;
+      unsigned long FirstID[2] = {0, 0};
 
+      for (unsigned short iFace = 0; iFace < Bound->GetnFaces(); iFace++) {
 
-      /*--- Algorithm for adding the rest of the points ---*/
+        const unsigned long iPoint = Bound->GetNode(Bound->GetFaces(iFace,0));
+        const unsigned long jPoint = Bound->GetNode(Bound->GetFaces(iFace,1));
 
-      do {
+        su2double Segment_P0[3], Segment_P1[3], Variable_P0 = 0.0, Variable_P1 = 0.0;
+        for (unsigned short iDim = 0; iDim < 3; iDim++) {
+          Segment_P0[iDim] = SurfaceCoord[iPoint*3+iDim];
+          Segment_P1[iDim] = SurfaceCoord[jPoint*3+iDim];
+        }
 
-        /*--- Last added point in the list ---*/
+        if (FlowVariable != NULL) {
+          Variable_P0 = FlowVariable[iPoint];
+          Variable_P1 = FlowVariable[jPoint];
+        }
 
-        Airfoil_Point = Xcoord_Airfoil.size() - 1;
+        const unsigned long iGlobal = node[iPoint]->GetGlobalIndex(), jGlobal = node[jPoint]->GetGlobalIndex();
 
-        /*--- Find the closest point  ---*/
+        /*--- In 2D add the points directly (note the change between Y and Z coordinate) ---*/
 
-        Found_Edge = false;
+        if (nDim == 2) {
+          const su2double Coord[6] = {Segment_P0[0], Segment_P0[2], Segment_P0[1], Segment_P1[0], Segment_P1[2], Segment_P1[1]};
+          PlaneSegments.coord.insert(PlaneSegments.coord.end(), Coord, Coord+6);
+          PlaneSegments.variable.push_back(Variable_P0);
+          PlaneSegments.variable.push_back(Variable_P1);
+          const unsigned long GlobalID[4] = {iGlobal, iGlobal, jGlobal, jGlobal};
+          PlaneSegments.globalID.insert(PlaneSegments.globalID.end(), GlobalID, GlobalID+4);
+          PointIndex++;
+        }
 
-        for (iEdge = 0; iEdge < Xcoord_Index0.size(); iEdge++) {
+        /*--- In 3D compute the intersection, the first two intersections of the element are a segment ---*/
 
-          if (((IGlobalID_Index0[iEdge] == IGlobalID_Airfoil[Airfoil_Point]) && (JGlobalID_Index0[iEdge] == JGlobalID_Airfoil[Airfoil_Point])) ||
-              ((IGlobalID_Index0[iEdge] == JGlobalID_Airfoil[Airfoil_Point]) && (JGlobalID_Index0[iEdge] == IGlobalID_Airfoil[Airfoil_Point]))) {
-            Next_Edge = iEdge; Found_Edge = true; Index = 0; break;
+        else if (nDim == 3) {
+          if (SegmentIntersectsPlane(Segment_P0, Segment_P1, Variable_P0, Variable_P1, PlaneP0, PlaneNormal,
+                                     Intersection, Variable_Interp)) {
+            if (PointIndex == 0) {
+              for (unsigned short iDim = 0; iDim < 3; iDim++) FirstIntersection[iDim] = Intersection[iDim];
+              FirstVariable = Variable_Interp;
+              FirstID[0] = iGlobal; FirstID[1] = jGlobal;
+            }
+            if (PointIndex == 1) {
+              PlaneSegments.coord.insert(PlaneSegments.coord.end(), FirstIntersection, FirstIntersection+3);
+              PlaneSegments.coord.insert(PlaneSegments.coord.end(), Intersection, Intersection+3);
+              PlaneSegments.variable.push_back(FirstVariable);
+              PlaneSegments.variable.push_back(Variable_Interp);
+              const unsigned long GlobalID[4] = {FirstID[0], FirstID[1], iGlobal, jGlobal};
+              PlaneSegments.globalID.insert(PlaneSegments.globalID.end(), GlobalID, GlobalID+4);
+            }
+            PointIndex++;
           }
+        }
+      }
+    }
+  }
 
-          if (((IGlobalID_Index1[iEdge] == IGlobalID_Airfoil[Airfoil_Point]) && (JGlobalID_Index1[iEdge] == JGlobalID_Airfoil[Airfoil_Point])) ||
-              ((IGlobalID_Index1[iEdge] == JGlobalID_Airfoil[Airfoil_Point]) && (JGlobalID_Index1[iEdge] == IGlobalID_Airfoil[Airfoil_Point]))) {
-            Next_Edge = iEdge; Found_Edge = true; Index = 1; break;
-          }
+#ifdef HAVE_MPI
 
-        }
+  /*--- Copy the segments of all the planes to the master node, at once and in the order of the ranks. ---*/
 
-        /*--- Add and remove the next point to the list and the next point in the edge ---*/
+  unsigned long nLocalSegment = 0, MaxLocalSegment = 0, iSection;
+  vector<unsigned long> nPlaneSegment(nPlane), nPlaneSegment_Recv(rank == MASTER_NODE? nPlane*size : 0);
 
-        if (Found_Edge) {
+  for (iPlane = 0; iPlane < nPlane; iPlane++) {
+    nPlaneSegment[iPlane] = Segments[iPlane].size();
+    nLocalSegment += nPlaneSegment[iPlane];
+  }
 
-          if (Index == 0) {
-            Xcoord_Airfoil.push_back(Xcoord_Index1[Next_Edge]);
-            Ycoord_Airfoil.push_back(Ycoord_Index1[Next_Edge]);
-            Zcoord_Airfoil.push_back(Zcoord_Index1[Next_Edge]);
-            Variable_Airfoil.push_back(Variable_Index1[Next_Edge]);
-            IGlobalID_Airfoil.push_back(IGlobalID_Index1[Next_Edge]);
-            JGlobalID_Airfoil.push_back(JGlobalID_Index1[Next_Edge]);
-          }
+  SU2_MPI::Allreduce(&nLocalSegment, &MaxLocalSegment, 1, MPI_UNSIGNED_LONG, MPI_MAX, MPI_COMM_WORLD);
+  SU2_MPI::Gather(nPlaneSegment.data(), nPlane, MPI_UNSIGNED_LONG, nPlaneSegment_Recv.data(), nPlane, MPI_UNSIGNED_LONG,
+                  MASTER_NODE, MPI_COMM_WORLD);
 
-          if (Index == 1) {
-            Xcoord_Airfoil.push_back(Xcoord_Index0[Next_Edge]);
-            Ycoord_Airfoil.push_back(Ycoord_Index0[Next_Edge]);
-            Zcoord_Airfoil.push_back(Zcoord_Index0[Next_Edge]);
-            Variable_Airfoil.push_back(Variable_Index0[Next_Edge]);
-            IGlobalID_Airfoil.push_back(IGlobalID_Index0[Next_Edge]);
-            JGlobalID_Airfoil.push_back(JGlobalID_Index0[Next_Edge]);
-          }
+  vector<su2double> Buffer_Send_Coord(MaxLocalSegment*6), Buffer_Send_Variable(MaxLocalSegment*2);
+  vector<unsigned long> Buffer_Send_GlobalID(MaxLocalSegment*4);
 
-          Xcoord_Index0.erase(Xcoord_Index0.begin() + Next_Edge);
-          Ycoord_Index0.erase(Ycoord_Index0.begin() + Next_Edge);
-          Zcoord_Index0.erase(Zcoord_Index0.begin() + Next_Edge);
-          Variable_Index0.erase(Variable_Index0.begin() + Next_Edge);
-          IGlobalID_Index0.erase(IGlobalID_Index0.begin() + Next_Edge);
-          JGlobalID_Index0.erase(JGlobalID_Index0.begin() + Next_Edge);
+  iSection = 0;
+  for (iPlane = 0; iPlane < nPlane; iPlane++) {
+    copy(Segments[iPlane].coord.begin(), Segments[iPlane].coord.end(), Buffer_Send_Coord.begin() + iSection*6);
+    copy(Segments[iPlane].variable.begin(), Segments[iPlane].variable.end(), Buffer_Send_Variable.begin() + iSection*2);
+    copy(Segments[iPlane].globalID.begin(), Segments[iPlane].globalID.end(), Buffer_Send_GlobalID.begin() + iSection*4);
+    iSection += Segments[iPlane].size();
+    Segments[iPlane] = CSectionSegments();
+  }
 
-          Xcoord_Index1.erase(Xcoord_Index1.begin() + Next_Edge);
-          Ycoord_Index1.erase(Ycoord_Index1.begin() + Next_Edge);
-          Zcoord_Index1.erase(Zcoord_Index1.begin() + Next_Edge);
-          Variable_Index1.erase(Variable_Index1.begin() + Next_Edge);
-          IGlobalID_Index1.erase(IGlobalID_Index1.begin() + Next_Edge);
-          JGlobalID_Index1.erase(JGlobalID_Index1.begin() + Next_Edge);
+  const unsigned long nRecv = (rank == MASTER_NODE)? MaxLocalSegment*size : 0;
+  vector<su2double> Buffer_Receive_Coord(nRecv*6), Buffer_Receive_Variable(nRecv*2);
+  vector<unsigned long> Buffer_Receive_GlobalID(nRecv*4);
 
-        }
-        else { break; }
+  SU2_MPI::Gather(Buffer_Send_Coord.data(), MaxLocalSegment*6, MPI_DOUBLE, Buffer_Receive_Coord.data(),
+                  MaxLocalSegment*6, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Gather(Buffer_Send_Variable.data(), MaxLocalSegment*2, MPI_DOUBLE, Buffer_Receive_Variable.data(),
+                  MaxLocalSegment*2, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Gather(Buffer_Send_GlobalID.data(), MaxLocalSegment*4, MPI_UNSIGNED_LONG, Buffer_Receive_GlobalID.data(),
+                  MaxLocalSegment*4, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
 
-      } while (Xcoord_Index0.size() != 0);
+  if (rank == MASTER_NODE) {
+    for (int iProcessor = 0; iProcessor < size; iProcessor++) {
+      iSection = iProcessor*MaxLocalSegment;
+      for (iPlane = 0; iPlane < nPlane; iPlane++) {
+        const unsigned long nSegment = nPlaneSegment_Recv[iProcessor*nPlane + iPlane];
+        CSectionSegments &PlaneSegments = Segments[iPlane];
+        PlaneSegments.coord.insert(PlaneSegments.coord.end(), Buffer_Receive_Coord.begin() + iSection*6,
+                                   Buffer_Receive_Coord.begin() + (iSection+nSegment)*6);
+        PlaneSegments.variable.insert(PlaneSegments.variable.end(), Buffer_Receive_Variable.begin() + iSection*2,
+                                      Buffer_Receive_Variable.begin() + (iSection+nSegment)*2);
+        PlaneSegments.globalID.insert(PlaneSegments.globalID.end(), Buffer_Receive_GlobalID.begin() + iSection*4,
+                                      Buffer_Receive_GlobalID.begin() + (iSection+nSegment)*4);
+        iSection += nSegment;
+      }
+    }
+  }
 
-      /*--- Clean the vector before using them again for storing the upper or the lower side ---*/
+#endif
 
-      Xcoord_Index0.clear(); Ycoord_Index0.clear(); Zcoord_Index0.clear(); Variable_Index0.clear();  IGlobalID_Index0.clear();  JGlobalID_Index0.clear();
-      Xcoord_Index1.clear(); Ycoord_Index1.clear(); Zcoord_Index1.clear(); Variable_Index1.clear();  IGlobalID_Index1.clear();  JGlobalID_Index1.clear();
+  /*--- Sort the segments of each plane into the section curve, the planes are independent. ---*/
 
+  if (rank == MASTER_NODE) {
+    SU2_OMP_PARALLEL_(for schedule(dynamic,1))
+    for (iPlane = 0; iPlane < nPlane; iPlane++) {
+      SetAirfoil_Curve(Segments[iPlane], Plane_Normal[iPlane], config, Xcoord_Airfoil[iPlane],
+                       Ycoord_Airfoil[iPlane], Zcoord_Airfoil[iPlane], Variable_Airfoil[iPlane]);
     }
-
   }
 
-  AD_END_PASSIVE
-
 }
 
 void CGeometry::RegisterCoordinates(CConfig *config) {
@@ -3314,7 +4031,7 @@ void CGeometry::ComputeSurf_Curvature(CConfig *config) {
 void CGeometry::FilterValuesAtElementCG(const vector<su2double> &filter_radius,
                                         const vector<pair<unsigned short,su2double> > &kernels,
                                         const unsigned short search_limit,
-                                        su2double *values) const
+                                        su2double *values)
 {
   /*--- Apply a filter to "input_values". The filter is an averaging process over the neighbourhood
   of each element, which is a circle in 2D and a sphere in 3D of radius "filter_radius".
@@ -3326,13 +4043,8 @@ void CGeometry::FilterValuesAtElementCG(const vector<su2double> &filter_radius,
   if ( kernels.empty() ) return;
 
 
-  /*--- FIRST: Gather the adjacency matrix, element centroids, volumes, and values on every
-  processor, this is required because the filter reaches far into adjacent partitions. ---*/
-
-  /*--- Adjacency matrix ---*/
-  vector<unsigned long> neighbour_start;
-  long *neighbour_idx = nullptr;
-  GetGlobalElementAdjacencyMatrix(neighbour_start,neighbour_idx);
+  /*--- FIRST: Gather the element centroids, volumes, and values on every processor,
+  this is required because the filter reaches far into adjacent partitions. ---*/
 
   /*--- Element centroids and volumes. ---*/
   su2double *cg_elem  = new su2double [Global_nElemDomain*nDim],
@@ -3345,15 +4057,7 @@ void CGeometry::FilterValuesAtElementCG(const vector<su2double> &filter_radius,
   /*--- Inputs of a filter stage, like with CG and volumes, each processor needs to see everything. ---*/
   su2double *work_values = new su2double [Global_nElemDomain];
 
-  /*--- When gathering the neighborhood of each element we use a vector of booleans to indicate
-  whether an element is already added to the list of neighbors (one vector per thread). ---*/
-  vector<vector<bool> > is_neighbor(omp_get_max_threads());
-
-  /*--- Begin OpenMP parallel section, count total number of searches for which
-  the recursion limit is reached and the full neighborhood is not considered. ---*/
-  unsigned long limited_searches = 0;
-
-  SU2_OMP_PARALLEL_(reduction(+:limited_searches))
+  SU2_OMP_PARALLEL
   {
 
   /*--- Initialize ---*/
@@ -3410,17 +4114,31 @@ void CGeometry::FilterValuesAtElementCG(const vector<su2double> &filter_radius,
   }
 #endif
 
-  /*--- SECOND: Each processor performs the average for its elements. For each
-  element we look for neighbours of neighbours of... until the distance to the
-  closest newly found one is greater than the filter radius.  ---*/
+  } // end OpenMP parallel section
+
+  /*--- SECOND: Get the neighbours of each element, within the radius of each kernel. These
+  only depend on the mesh and are therefore computed once and reused by subsequent calls. ---*/
+
+  for (unsigned long iKernel=0; iKernel<kernels.size(); ++iKernel)
+    GetFilterNeighbourhood(SU2_TYPE::GetValue(filter_radius[iKernel]), search_limit, cg_elem);
+
+  /*--- The cache no longer grows, the references remain valid. ---*/
+  vector<const CCompressedSparsePatternUL*> neighbourhoods(kernels.size());
 
-  is_neighbor[omp_get_thread_num()].resize(Global_nElemDomain,false);
+  for (unsigned long iKernel=0; iKernel<kernels.size(); ++iKernel)
+    neighbourhoods[iKernel] = &GetFilterNeighbourhood(SU2_TYPE::GetValue(filter_radius[iKernel]), search_limit, cg_elem);
+
+  /*--- THIRD: Each processor performs the average for its elements. ---*/
+
+  SU2_OMP_PARALLEL
+  {
 
   for (unsigned long iKernel=0; iKernel<kernels.size(); ++iKernel)
   {
     unsigned short kernel_type = kernels[iKernel].first;
     su2double kernel_param = kernels[iKernel].second;
     su2double kernel_radius = filter_radius[iKernel];
+    const auto& neighbours = *neighbourhoods[iKernel];
 
     /*--- Synchronize work values ---*/
     /*--- Initialize ---*/
@@ -3455,16 +4173,9 @@ void CGeometry::FilterValuesAtElementCG(const vector<su2double> &filter_radius,
     SU2_OMP_FOR_DYN(128)
     for(auto iElem=0ul; iElem<nElem; ++iElem)
     {
-      int thread = omp_get_thread_num();
-
       /*--- Center of the search ---*/
       auto iElem_global = elem[iElem]->GetGlobalIndex();
 
-      /*--- Find the neighbours of iElem ---*/
-      vector<long> neighbours;
-      limited_searches += !GetRadialNeighbourhood(iElem_global, SU2_TYPE::GetValue(kernel_radius),
-                                                  search_limit, neighbour_start, neighbour_idx,
-                                                  cg_elem, neighbours, is_neighbor[thread]);
       /*--- Apply the kernel ---*/
       su2double weight = 0.0, numerator = 0.0, denominator = 0.0;
 
@@ -3472,8 +4183,9 @@ void CGeometry::FilterValuesAtElementCG(const vector<su2double> &filter_radius,
         /*--- distance-based kernels (weighted averages) ---*/
         case CONSTANT_WEIGHT_FILTER: case CONICAL_WEIGHT_FILTER: case GAUSSIAN_WEIGHT_FILTER:
 
-          for (auto idx : neighbours)
+          for (auto k = neighbours.outerPtr()[iElem]; k < neighbours.outerPtr()[iElem+1]; ++k)
           {
+            auto idx = neighbours.innerIdx()[k];
             su2double distance = 0.0;
             for (unsigned short iDim=0; iDim<nDim; ++iDim)
               distance += pow(cg_elem[nDim*iElem_global+iDim]-cg_elem[nDim*idx+iDim],2);
@@ -3495,8 +4207,9 @@ void CGeometry::FilterValuesAtElementCG(const vector<su2double> &filter_radius,
         /*--- morphology kernels (image processing) ---*/
         case DILATE_MORPH_FILTER: case ERODE_MORPH_FILTER:
 
-          for (auto idx : neighbours)
+          for (auto k = neighbours.outerPtr()[iElem]; k < neighbours.outerPtr()[iElem+1]; ++k)
           {
+            auto idx = neighbours.innerIdx()[k];
             switch ( kernel_type ) {
               case DILATE_MORPH_FILTER: numerator += exp(kernel_param*work_values[idx]); break;
               case ERODE_MORPH_FILTER:  numerator += exp(kernel_param*(1.0-work_values[idx])); break;
@@ -3516,7 +4229,70 @@ void CGeometry::FilterValuesAtElementCG(const vector<su2double> &filter_radius,
 
   } // end OpenMP parallel section
 
-  limited_searches /= kernels.size();
+  delete [] cg_elem;
+  delete [] vol_elem;
+  delete [] work_values;
+}
+
+const CCompressedSparsePatternUL& CGeometry::GetFilterNeighbourhood(const passivedouble radius,
+                                                                     const unsigned short search_limit,
+                                                                     const su2double *cg_elem)
+{
+  /*--- Check if these neighbourhoods were already computed. ---*/
+  const auto key = make_pair(radius, search_limit);
+
+  for (size_t iCache = 0; iCache < filterNeighboursKey.size(); ++iCache)
+    if (filterNeighboursKey[iCache] == key) return filterNeighbours[iCache];
+
+  /*--- Adjacency matrix, only needed to build the neighbourhoods. ---*/
+  vector<unsigned long> neighbour_start;
+  long *neighbour_idx = nullptr;
+  GetGlobalElementAdjacencyMatrix(neighbour_start,neighbour_idx);
+
+  /*--- For each element we look for neighbours of neighbours of... until the distance
+  to the closest newly found one is greater than the filter radius. When gathering the
+  neighborhood of each element we use a vector of booleans to indicate whether an
+  element is already added to the list of neighbors (one vector per thread). ---*/
+  vector<vector<bool> > is_neighbor(omp_get_max_threads());
+  vector<vector<long> > neighbours(nElem);
+  su2vector<unsigned long> outerPtr(nElem+1);
+
+  /*--- Count total number of searches for which the recursion
+  limit is reached and the full neighborhood is not considered. ---*/
+  unsigned long limited_searches = 0;
+
+  SU2_OMP_PARALLEL_(reduction(+:limited_searches))
+  {
+    is_neighbor[omp_get_thread_num()].resize(Global_nElemDomain,false);
+
+    SU2_OMP_FOR_DYN(128)
+    for(auto iElem=0ul; iElem<nElem; ++iElem) {
+      int thread = omp_get_thread_num();
+      limited_searches += !GetRadialNeighbourhood(elem[iElem]->GetGlobalIndex(), radius,
+                                                  search_limit, neighbour_start, neighbour_idx,
+                                                  cg_elem, neighbours[iElem], is_neighbor[thread]);
+    }
+
+    /*--- Compress the neighbourhoods. ---*/
+    SU2_OMP_MASTER
+    {
+      outerPtr(0) = 0;
+      for(auto iElem=0ul; iElem<nElem; ++iElem)
+        outerPtr(iElem+1) = outerPtr(iElem) + neighbours[iElem].size();
+    }
+    SU2_OMP_BARRIER
+  }
+
+  su2vector<unsigned long> innerIdx(outerPtr(nElem));
+
+  SU2_OMP_PARALLEL_(for schedule(dynamic,128))
+  for(auto iElem=0ul; iElem<nElem; ++iElem) {
+    auto pos = outerPtr(iElem);
+    for(auto idx : neighbours[iElem]) innerIdx(pos++) = idx;
+    vector<long>().swap(neighbours[iElem]);
+  }
+
+  delete [] neighbour_idx;
 
   unsigned long tmp = limited_searches;
   SU2_MPI::Reduce(&tmp,&limited_searches,1,MPI_UNSIGNED_LONG,MPI_SUM,MASTER_NODE,MPI_COMM_WORLD);
@@ -3525,10 +4301,10 @@ void CGeometry::FilterValuesAtElementCG(const vector<su2double> &filter_radius,
     cout << "Warning: The filter radius was limited for " << limited_searches
          << " elements (" << limited_searches/(0.01*Global_nElemDomain) << "%).\n";
 
-  delete [] neighbour_idx;
-  delete [] cg_elem;
-  delete [] vol_elem;
-  delete [] work_values;
+  filterNeighboursKey.push_back(key);
+  filterNeighbours.emplace_back(move(outerPtr), move(innerIdx));
+
+  return filterNeighbours.back();
 }
 
 void CGeometry::GetGlobalElementAdjacencyMatrix(vector<unsigned long> &neighbour_start,
@@ -4006,11 +4782,11 @@ void CGeometry::SetGridVelocity(CConfig *config, unsigned long iter) {
 
 }
 
-const CCompressedSparsePatternUL& CGeometry::GetSparsePattern(ConnectivityType type, unsigned long fillLvl)
+const CCompressedSparsePatternLocal& CGeometry::GetSparsePattern(ConnectivityType type, unsigned long fillLvl)
 {
   bool fvm = (type == ConnectivityType::FiniteVolume);
 
-  CCompressedSparsePatternUL* pattern = nullptr;
+  CCompressedSparsePatternLocal* pattern = nullptr;
 
   if (fillLvl == 0)
     pattern = fvm? &finiteVolumeCSRFill0 : &finiteElementCSRFill0;
@@ -4018,33 +4794,33 @@ const CCompressedSparsePatternUL& CGeometry::GetSparsePattern(ConnectivityType t
     pattern = fvm? &finiteVolumeCSRFillN : &finiteElementCSRFillN;
 
   if (pattern->empty()) {
-    *pattern = buildCSRPattern(*this, type, fillLvl);
+    *pattern = buildCSRPattern(*this, type, su2localidx(fillLvl));
     pattern->buildDiagPtr();
   }
 
   return *pattern;
 }
 
-const CEdgeToNonZeroMapUL& CGeometry::GetEdgeToSparsePatternMap(void)
+const CEdgeToNonZeroMapLocal& CGeometry::GetEdgeToSparsePatternMap(void)
 {
   if (edgeToCSRMap.empty()) {
     if (finiteVolumeCSRFill0.empty()) {
-      finiteVolumeCSRFill0 = buildCSRPattern(*this, ConnectivityType::FiniteVolume, 0ul);
+      finiteVolumeCSRFill0 = buildCSRPattern(*this, ConnectivityType::FiniteVolume, su2localidx(0));
     }
     edgeToCSRMap = mapEdgesToSparsePattern(*this, finiteVolumeCSRFill0);
   }
   return edgeToCSRMap;
 }
 
-const su2vector<unsigned long>& CGeometry::GetTransposeSparsePatternMap(ConnectivityType type)
+const su2vector<su2localidx>& CGeometry::GetTransposeSparsePatternMap(ConnectivityType type)
 {
   /*--- Yes the const cast is weird but it is still better than repeating code. ---*/
-  auto& pattern = const_cast<CCompressedSparsePatternUL&>(GetSparsePattern(type));
+  auto& pattern = const_cast<CCompressedSparsePatternLocal&>(GetSparsePattern(type));
   pattern.buildTransposePtr();
   return pattern.transposePtr();
 }
 
-const CCompressedSparsePatternUL& CGeometry::GetEdgeColoring(su2double* efficiency)
+const CCompressedSparsePatternLocal& CGeometry::GetEdgeColoring(su2double* efficiency)
 {
   /*--- Check for dry run mode with dummy geometry. ---*/
   if (nEdge==0) return edgeColoring;
@@ -4061,8 +4837,8 @@ const CCompressedSparsePatternUL& CGeometry::GetEdgeColoring(su2double* efficien
 
     /*--- Create a temporary sparse pattern from the edges. ---*/
     /// TODO: Try to avoid temporary once grid information is made contiguous.
-    su2vector<unsigned long> outerPtr(nEdge+1);
-    su2vector<unsigned long> innerIdx(nEdge*2);
+    su2vector<su2localidx> outerPtr(nEdge+1);
+    su2vector<su2localidx> innerIdx(nEdge*2);
 
     for (unsigned long iEdge = 0; iEdge < nEdge; ++iEdge) {
       outerPtr(iEdge) = 2*iEdge;
@@ -4071,11 +4847,14 @@ const CCompressedSparsePatternUL& CGeometry::GetEdgeColoring(su2double* efficien
     }
     outerPtr(nEdge) = 2*nEdge;
 
-    CCompressedSparsePatternUL pattern(move(outerPtr), move(innerIdx));
+    CCompressedSparsePatternLocal pattern(move(outerPtr), move(innerIdx));
 
-    /*--- Color the edges. ---*/
+    /*--- Color the edges, the group size is chosen at run time unless the reducer strategy is forced. ---*/
     constexpr bool balanceColors = true;
-    edgeColoring = colorSparsePattern(pattern, edgeColorGroupSize, balanceColors);
+    if (edgeColorAutoTune && (edgeColorGroupSize != 1ul<<30))
+      TuneEdgeColoring(pattern);
+    else
+      edgeColoring = colorSparsePattern(pattern, edgeColorGroupSize, balanceColors);
 
     /*--- If the coloring fails use the natural coloring. This is a
      *    "soft" failure as this "bad" coloring should be detected
@@ -4097,7 +4876,99 @@ void CGeometry::SetNaturalEdgeColoring()
   if (omp_get_max_threads() > 1) edgeColorGroupSize = nEdge;
 }
 
-const CCompressedSparsePatternUL& CGeometry::GetElementColoring(su2double* efficiency)
+void CGeometry::TuneEdgeColoring(const CCompressedSparsePatternLocal& pattern)
+{
+  /*--- Candidate group sizes, all multiples of the batch sizes (SIMD) of the edge loops. ---*/
+  const unsigned long candidates[] = {64, 128, 256, 512, 1024, 2048};
+  constexpr int numRepeat = 3;
+  const int nThread = omp_get_max_threads();
+
+  /*--- Passive copy of the coordinates and a "residual" for the benchmark kernel. ---*/
+  vector<passivedouble> coord(nPoint*nDim), sum(nPoint*nDim);
+  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint)
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+      coord[iPoint*nDim+iDim] = SU2_TYPE::GetValue(node[iPoint]->GetCoord(iDim));
+
+  CCompressedSparsePatternLocal bestColoring;
+  unsigned long bestSize = edgeColorGroupSize;
+  passivedouble bestTime = 0.0;
+  su2double bestEff = -1.0;
+  bool bestIsEfficient = false;
+
+  for (auto groupSize : candidates) {
+    if (groupSize >= nEdge) break;
+
+    auto coloring = colorSparsePattern(pattern, groupSize, true);
+    if (coloring.empty()) continue;
+
+    const su2double eff = coloringEfficiency(coloring, nThread, groupSize);
+    const bool efficient = (eff >= COLORING_EFF_THRESH);
+
+    /*--- Inefficient colorings are only kept when no efficient one was found, they
+     *    are not timed as the solvers will fall back to other strategies. ---*/
+    if (!efficient) {
+      if (!bestIsEfficient && (eff > bestEff)) {
+        bestColoring = move(coloring);
+        bestSize = groupSize;
+        bestEff = eff;
+      }
+      continue;
+    }
+
+    chrono::steady_clock::time_point start;
+    passivedouble elapsed = 0.0;
+
+    SU2_OMP_PARALLEL
+    {
+      for (int iRepeat = 0; iRepeat <= numRepeat; ++iRepeat) {
+        /*--- The first pass warms up the caches and is not timed. ---*/
+        SU2_OMP_BARRIER
+        SU2_OMP_MASTER
+        if (iRepeat == 1) start = chrono::steady_clock::now();
+
+        for (auto iColor = 0ul; iColor < coloring.getOuterSize(); ++iColor) {
+          const auto edges = coloring.innerIdx(iColor);
+          const auto nEdgeColor = coloring.getNumNonZeros(iColor);
+
+          SU2_OMP_FOR_DYN(nextMultiple(32, groupSize))
+          for (auto k = 0ul; k < nEdgeColor; ++k) {
+            const auto iEdge = edges[k];
+            const auto iPoint = pattern.innerIdx()[2*iEdge];
+            const auto jPoint = pattern.innerIdx()[2*iEdge+1];
+            for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+              const passivedouble flux = coord[jPoint*nDim+iDim] - coord[iPoint*nDim+iDim];
+              sum[iPoint*nDim+iDim] += flux;
+              sum[jPoint*nDim+iDim] -= flux;
+            }
+          }
+        }
+      }
+      SU2_OMP_BARRIER
+      SU2_OMP_MASTER
+      elapsed = chrono::duration<passivedouble>(chrono::steady_clock::now() - start).count();
+      SU2_OMP_BARRIER
+    }
+
+    if (!bestIsEfficient || (elapsed < bestTime)) {
+      bestColoring = move(coloring);
+      bestSize = groupSize;
+      bestTime = elapsed;
+      bestEff = eff;
+      bestIsEfficient = true;
+    }
+  }
+
+  /*--- Nothing could be colored (e.g. too few edges), use the configured size. ---*/
+  if (bestColoring.empty()) {
+    edgeColoring = colorSparsePattern(pattern, edgeColorGroupSize, true);
+    return;
+  }
+
+  edgeColoring = move(bestColoring);
+  edgeColorGroupSize = bestSize;
+}
+
+const CCompressedSparsePatternLocal& CGeometry::GetElementColoring(su2double* efficiency)
 {
   /*--- Check for dry run mode with dummy geometry. ---*/
   if (nElem==0) return elemColoring;
@@ -4114,8 +4985,8 @@ const CCompressedSparsePatternUL& CGeometry::GetElementColoring(su2double* effic
 
     /*--- Create a temporary sparse pattern from the elements. ---*/
     /// TODO: Try to avoid temporary once grid information is made contiguous.
-    vector<unsigned long> outerPtr(nElem+1);
-    vector<unsigned long> innerIdx; innerIdx.reserve(nElem);
+    vector<su2localidx> outerPtr(nElem+1);
+    vector<su2localidx> innerIdx; innerIdx.reserve(nElem);
 
     for (unsigned long iElem = 0; iElem < nElem; ++iElem) {
       outerPtr[iElem] = innerIdx.size();
@@ -4126,7 +4997,7 @@ const CCompressedSparsePatternUL& CGeometry::GetElementColoring(su2double* effic
     }
     outerPtr[nElem] = innerIdx.size();
 
-    CCompressedSparsePatternUL pattern(outerPtr, innerIdx);
+    CCompressedSparsePatternLocal pattern(outerPtr, innerIdx);
 
     /*--- Color the elements. ---*/
     constexpr bool balanceColors = true;
@@ -4149,3 +5020,84 @@ void CGeometry::SetNaturalElementColoring()
   /*--- In parallel, set the group size to nElem to protect client code. ---*/
   if (omp_get_max_threads() > 1) elemColorGroupSize = nElem;
 }
+
+const vector<vector<unsigned long> >& CGeometry::GetLinelets(const CConfig *config)
+{
+  if (lineletsBuilt) return linelets;
+  lineletsBuilt = true;
+
+  const su2double alpha = 0.9;
+
+  auto isWall = [config](unsigned short iMarker) {
+    const auto kindBC = config->GetMarker_All_KindBC(iMarker);
+    return (kindBC == HEAT_FLUX) || (kindBC == ISOTHERMAL) ||
+           (kindBC == EULER_WALL) || (kindBC == DISPLACEMENT_BOUNDARY);
+  };
+
+  /*--- Coupling between two neighbors, the face area over the dual volumes. ---*/
+
+  auto weight = [this](unsigned long iPoint, unsigned long jPoint) {
+    const su2double* normal = edge[FindEdge(iPoint, jPoint)]->GetNormal();
+    su2double area = 0.0;
+    for (unsigned short iDim = 0; iDim < nDim; iDim++) area += normal[iDim]*normal[iDim];
+    area = sqrt(area);
+    return 0.5*area*(1.0/node[iPoint]->GetVolume() + 1.0/node[jPoint]->GetVolume());
+  };
+
+  vector<bool> check_Point(nPoint,true);
+
+  /*--- Define the basic linelets, starting from each vertex of the walls. ---*/
+
+  for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    if (!isWall(iMarker)) continue;
+    for (unsigned long iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
+      const auto iPoint = vertex[iMarker][iVertex]->GetNode();
+      linelets.push_back({iPoint});
+      check_Point[iPoint] = false;
+    }
+  }
+
+  /*--- Grow each linelet while there is a single neighbor with a strong coupling. ---*/
+
+  for (auto& line : linelets) {
+
+    bool add_point;
+    do {
+      const auto iPoint = line.back();
+      const auto nNeigh = node[iPoint]->GetnPoint();
+
+      su2double max_weight = 0.0;
+      for (unsigned short iNode = 0; iNode < nNeigh; iNode++) {
+        const auto jPoint = node[iPoint]->GetPoint(iNode);
+        if (check_Point[jPoint] && node[jPoint]->GetDomain())
+          max_weight = max(max_weight, weight(iPoint, jPoint));
+      }
+
+      /*--- Verify if any face of the control volume must be added,
+       *    more than one candidate means an isotropic zone was reached. ---*/
+
+      unsigned long next_Point = 0, counter = 0;
+      for (unsigned short iNode = 0; iNode < nNeigh; iNode++) {
+        const auto jPoint = node[iPoint]->GetPoint(iNode);
+        if (check_Point[jPoint] && node[jPoint]->GetDomain() &&
+            (weight(iPoint, jPoint)/max_weight > alpha)) {
+          next_Point = jPoint;
+          counter++;
+        }
+      }
+
+      add_point = (counter == 1);
+      if (add_point) {
+        line.push_back(next_Point);
+        check_Point[next_Point] = false;
+      }
+    } while (add_point);
+  }
+
+  /*--- Longest linelets first, for the dynamic schedule of the line solves. ---*/
+
+  stable_sort(linelets.begin(), linelets.end(),
+    [](const vector<unsigned long>& a, const vector<unsigned long>& b) { return a.size() > b.size(); });
+
+  return linelets;
+}
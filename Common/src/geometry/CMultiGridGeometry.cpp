@@ -28,6 +28,7 @@
 #include "../../include/geometry/CMultiGridGeometry.hpp"
 #include "../../include/CMultiGridQueue.hpp"
 #include "../../include/toolboxes/printing_toolbox.hpp"
+#include "../../include/omp_structure.hpp"
 
 
 CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_container, unsigned short iMesh) : CGeometry() {
@@ -40,24 +41,8 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
 
   /*--- Local variables ---*/
 
-  unsigned long iPoint, Index_CoarseCV, CVPoint, iElem, iVertex, jPoint, iteration, nVertexS, nVertexR,
-                nBufferS_Vector, nBufferR_Vector, iParent, jVertex,Local_nPointCoarse, Local_nPointFine, Global_nPointCoarse, Global_nPointFine,
-                *Buffer_Receive_Parent = NULL, *Buffer_Send_Parent = NULL, *Buffer_Receive_Children = NULL, *Buffer_Send_Children = NULL,
-                *Parent_Remote = NULL,         *Children_Remote = NULL,    *Parent_Local = NULL,            *Children_Local = NULL;
-  short marker_seed;
-  bool agglomerate_seed = true;
-  unsigned short nChildren, iNode, counter, iMarker, jMarker, priority, MarkerS, MarkerR, *nChildren_MPI;
-  vector<unsigned long> Suitable_Indirect_Neighbors, Aux_Parent;
-  vector<unsigned long>::iterator it;
-
-  unsigned short nMarker_Max = config->GetnMarker_Max();
-
-  unsigned short *copy_marker = new unsigned short [nMarker_Max];
-
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  SU2_MPI::Status status;
-#endif
+  unsigned long iPoint, iElem, Local_nPointCoarse, Local_nPointFine, Global_nPointCoarse, Global_nPointFine;
+  unsigned short iNode;
 
   nDim = fine_grid->GetnDim(); // Write the number of dimensions of the coarse grid.
 
@@ -88,8 +73,6 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
 
   /*--- Create the coarse grid structure using as baseline the fine grid ---*/
 
-  CMultiGridQueue MGQueue_InnerCV(fine_grid->GetnPoint());
-
   nPointNode = fine_grid->GetnPoint();
   node = new CPoint*[fine_grid->GetnPoint()];
   for (iPoint = 0; iPoint < fine_grid->GetnPoint(); iPoint ++) {
@@ -103,6 +86,96 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
     node[iPoint]->SetAgglomerate_Indirect(false);
   }
 
+  /*--- Use the agglomeration of a previous run when possible, otherwise agglomerate the fine grid. ---*/
+
+  const string cacheFilename = GetAgglomerationCacheName(config, iMesh);
+
+  if (config->GetMG_Agglomeration_Cache() && CheckAgglomerationCache(fine_grid, config, cacheFilename)) {
+    ReadAgglomerationCache(fine_grid, cacheFilename);
+  }
+  else {
+    AgglomerateFineGrid(fine_grid, config);
+    if (config->GetMG_Agglomeration_Cache()) WriteAgglomerationCache(fine_grid, config, cacheFilename);
+  }
+
+  /*--- Console output with the summary of the agglomeration ---*/
+
+  Local_nPointCoarse = nPoint;
+  Local_nPointFine = fine_grid->GetnPoint();
+
+  SU2_MPI::Allreduce(&Local_nPointCoarse, &Global_nPointCoarse, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&Local_nPointFine, &Global_nPointFine, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+
+  su2double Coeff = 1.0, CFL = 0.0, factor = 1.5;
+
+  if (iMesh != MESH_0) {
+    if (nDim == 2) Coeff = pow(su2double(Global_nPointFine)/su2double(Global_nPointCoarse), 1./2.);
+    if (nDim == 3) Coeff = pow(su2double(Global_nPointFine)/su2double(Global_nPointCoarse), 1./3.);
+    CFL = factor*config->GetCFL(iMesh-1)/Coeff;
+    config->SetCFL(iMesh, CFL);
+  }
+
+  su2double ratio = su2double(Global_nPointFine)/su2double(Global_nPointCoarse);
+
+  if (((nDim == 2) && (ratio < 2.5)) ||
+      ((nDim == 3) && (ratio < 2.5))) {
+    config->SetMGLevels(iMesh-1);
+  }
+  else {
+    if (rank == MASTER_NODE) {
+      PrintingToolbox::CTablePrinter MGTable(&std::cout);
+      MGTable.AddColumn("MG Level", 10);
+      MGTable.AddColumn("CVs", 10);
+      MGTable.AddColumn("Aggl. Rate", 10);
+      MGTable.AddColumn("CFL", 10);
+      MGTable.SetAlign(PrintingToolbox::CTablePrinter::RIGHT);
+
+
+      if (iMesh == 1){
+        MGTable.PrintHeader();
+        MGTable << iMesh - 1 << Global_nPointFine << "1/1.00" << config->GetCFL(iMesh -1);
+      }
+      stringstream ss;
+      ss << "1/" << std::setprecision(3) << ratio;
+      MGTable << iMesh << Global_nPointCoarse << ss.str() << CFL;
+      if (iMesh == config->GetnMGLevels()){
+        MGTable.PrintFooter();
+      }
+    }
+  }
+
+  /*--- Contiguous children of each control volume for the transfer operators. ---*/
+
+  SetChildren_CSR();
+
+  edgeColorGroupSize = config->GetEdgeColoringGroupSize();
+  edgeColorAutoTune = config->GetEdgeColoringAutoTune();
+
+}
+
+void CMultiGridGeometry::AgglomerateFineGrid(CGeometry *fine_grid, CConfig *config) {
+
+  /*--- Local variables ---*/
+
+  unsigned long iPoint, Index_CoarseCV, CVPoint, iVertex, jPoint, iteration, nVertexS, nVertexR,
+                nBufferS_Vector, nBufferR_Vector, iParent, jVertex,
+                *Buffer_Receive_Parent = NULL, *Buffer_Send_Parent = NULL, *Buffer_Receive_Children = NULL, *Buffer_Send_Children = NULL,
+                *Parent_Remote = NULL,         *Children_Remote = NULL,    *Parent_Local = NULL,            *Children_Local = NULL;
+  short marker_seed;
+  bool agglomerate_seed = true;
+  unsigned short nChildren, iNode, counter, iMarker, jMarker, priority, MarkerS, MarkerR, *nChildren_MPI;
+  vector<unsigned long> Suitable_Indirect_Neighbors, Aux_Parent;
+  vector<unsigned long>::iterator it;
+
+  unsigned short nMarker_Max = config->GetnMarker_Max();
+
+  unsigned short *copy_marker = new unsigned short [nMarker_Max];
+
+#ifdef HAVE_MPI
+  int send_to, receive_from;
+  SU2_MPI::Status status;
+#endif
+
   Index_CoarseCV = 0;
 
   /*--- The first step is the boundary agglomeration. ---*/
@@ -242,141 +315,151 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
       }
     }
 
-  /*--- Update the queue with the results from the boundary agglomeration ---*/
+  /*--- Agglomerate the interior points, the colored (thread-parallel) algorithm falls back
+   to the queue-driven one if the fine grid cannot be colored. ---*/
 
-  for (iPoint = 0; iPoint < fine_grid->GetnPoint(); iPoint ++) {
+  if ((config->GetKind_MG_Agglomeration() != COLORED_AGGLOMERATION) ||
+      !ColoredAgglomeration(fine_grid, config, Index_CoarseCV)) {
 
-    /*--- The CV has been agglomerated, remove form the list ---*/
+    CMultiGridQueue MGQueue_InnerCV(fine_grid->GetnPoint());
 
-    if (fine_grid->node[iPoint]->GetAgglomerate() == true) {
+    /*--- Update the queue with the results from the boundary agglomeration ---*/
 
-      MGQueue_InnerCV.RemoveCV(iPoint);
+    for (iPoint = 0; iPoint < fine_grid->GetnPoint(); iPoint ++) {
 
-    }
+      /*--- The CV has been agglomerated, remove form the list ---*/
 
-    else {
+      if (fine_grid->node[iPoint]->GetAgglomerate() == true) {
 
-      /*--- Count the number of agglomerated neighbors, and modify the queue ---*/
+        MGQueue_InnerCV.RemoveCV(iPoint);
 
-      priority = 0;
-      for (iNode = 0; iNode < fine_grid->node[iPoint]->GetnPoint(); iNode ++) {
-        jPoint = fine_grid->node[iPoint]->GetPoint(iNode);
-        if (fine_grid->node[jPoint]->GetAgglomerate() == true) priority++;
       }
-      MGQueue_InnerCV.MoveCV(iPoint, priority);
+
+      else {
+
+        /*--- Count the number of agglomerated neighbors, and modify the queue ---*/
+
+        priority = 0;
+        for (iNode = 0; iNode < fine_grid->node[iPoint]->GetnPoint(); iNode ++) {
+          jPoint = fine_grid->node[iPoint]->GetPoint(iNode);
+          if (fine_grid->node[jPoint]->GetAgglomerate() == true) priority++;
+        }
+        MGQueue_InnerCV.MoveCV(iPoint, priority);
+      }
     }
-  }
 
-  /*--- Agglomerate the domain nodes ---*/
+    /*--- Agglomerate the domain nodes ---*/
 
-  iteration = 0;
-  while (!MGQueue_InnerCV.EmptyQueue() && (iteration < fine_grid->GetnPoint())) {
+    iteration = 0;
+    while (!MGQueue_InnerCV.EmptyQueue() && (iteration < fine_grid->GetnPoint())) {
 
-    iPoint = MGQueue_InnerCV.NextCV();
-    iteration ++;
+      iPoint = MGQueue_InnerCV.NextCV();
+      iteration ++;
 
-    /*--- If the element has not being previously agglomerated, belongs to the physical domain,
-     and satisfies several geometrical criteria then the seed CV is acepted for agglomeration ---*/
+      /*--- If the element has not being previously agglomerated, belongs to the physical domain,
+       and satisfies several geometrical criteria then the seed CV is acepted for agglomeration ---*/
 
-    if ((fine_grid->node[iPoint]->GetAgglomerate() == false) &&
-        (fine_grid->node[iPoint]->GetDomain()) &&
-        (GeometricalCheck(iPoint, fine_grid, config))) {
+      if ((fine_grid->node[iPoint]->GetAgglomerate() == false) &&
+          (fine_grid->node[iPoint]->GetDomain()) &&
+          (GeometricalCheck(iPoint, fine_grid, config))) {
 
-      nChildren = 1;
+        nChildren = 1;
 
-      /*--- We set an index for the parent control volume ---*/
+        /*--- We set an index for the parent control volume ---*/
 
-      fine_grid->node[iPoint]->SetParent_CV(Index_CoarseCV);
+        fine_grid->node[iPoint]->SetParent_CV(Index_CoarseCV);
 
-      /*--- We add the seed point (child) to the parent control volume ---*/
+        /*--- We add the seed point (child) to the parent control volume ---*/
 
-      node[Index_CoarseCV]->SetChildren_CV(0, iPoint);
+        node[Index_CoarseCV]->SetChildren_CV(0, iPoint);
+
+        /*--- Update the queue with the seed point (remove the seed and
+         increase the priority of the neighbors) ---*/
 
-      /*--- Update the queue with the seed point (remove the seed and
-       increase the priority of the neighbors) ---*/
+        MGQueue_InnerCV.Update(iPoint, fine_grid);
 
-      MGQueue_InnerCV.Update(iPoint, fine_grid);
+        /*--- Now we do a sweep over all the nodes that surround the seed point ---*/
 
-      /*--- Now we do a sweep over all the nodes that surround the seed point ---*/
+        for (iNode = 0; iNode < fine_grid->node[iPoint]->GetnPoint(); iNode ++) {
 
-      for (iNode = 0; iNode < fine_grid->node[iPoint]->GetnPoint(); iNode ++) {
+          CVPoint = fine_grid->node[iPoint]->GetPoint(iNode);
 
-        CVPoint = fine_grid->node[iPoint]->GetPoint(iNode);
+          /*--- Determine if the CVPoint can be agglomerated ---*/
 
-        /*--- Determine if the CVPoint can be agglomerated ---*/
+          if ((fine_grid->node[CVPoint]->GetAgglomerate() == false) &&
+              (fine_grid->node[CVPoint]->GetDomain()) &&
+              (GeometricalCheck(CVPoint, fine_grid, config))) {
 
-        if ((fine_grid->node[CVPoint]->GetAgglomerate() == false) &&
-            (fine_grid->node[CVPoint]->GetDomain()) &&
-            (GeometricalCheck(CVPoint, fine_grid, config))) {
+            /*--- We set the value of the parent ---*/
 
-          /*--- We set the value of the parent ---*/
+            fine_grid->node[CVPoint]->SetParent_CV(Index_CoarseCV);
 
-          fine_grid->node[CVPoint]->SetParent_CV(Index_CoarseCV);
+            /*--- We set the value of the child ---*/
 
-          /*--- We set the value of the child ---*/
+            node[Index_CoarseCV]->SetChildren_CV(nChildren, CVPoint);
+            nChildren++;
 
-          node[Index_CoarseCV]->SetChildren_CV(nChildren, CVPoint);
-          nChildren++;
+            /*--- Update the queue with the new control volume (remove the CV and
+             increase the priority of the neighbors) ---*/
 
-          /*--- Update the queue with the new control volume (remove the CV and
-           increase the priority of the neighbors) ---*/
+            MGQueue_InnerCV.Update(CVPoint, fine_grid);
 
-          MGQueue_InnerCV.Update(CVPoint, fine_grid);
+          }
 
         }
 
-      }
+        /*--- Subrotuine to identify the indirect neighbors ---*/
 
-      /*--- Subrotuine to identify the indirect neighbors ---*/
+        Suitable_Indirect_Neighbors.clear();
+        if (fine_grid->node[iPoint]->GetAgglomerate_Indirect())
+          SetSuitableNeighbors(&Suitable_Indirect_Neighbors, iPoint, Index_CoarseCV, fine_grid);
 
-      Suitable_Indirect_Neighbors.clear();
-      if (fine_grid->node[iPoint]->GetAgglomerate_Indirect())
-        SetSuitableNeighbors(&Suitable_Indirect_Neighbors, iPoint, Index_CoarseCV, fine_grid);
+        /*--- Now we do a sweep over all the indirect nodes that can be added ---*/
 
-      /*--- Now we do a sweep over all the indirect nodes that can be added ---*/
+        for (iNode = 0; iNode < Suitable_Indirect_Neighbors.size(); iNode ++) {
 
-      for (iNode = 0; iNode < Suitable_Indirect_Neighbors.size(); iNode ++) {
+          CVPoint = Suitable_Indirect_Neighbors[iNode];
 
-        CVPoint = Suitable_Indirect_Neighbors[iNode];
+          /*--- The new point can be agglomerated ---*/
 
-        /*--- The new point can be agglomerated ---*/
+          if ((fine_grid->node[CVPoint]->GetAgglomerate() == false) &&
+              (fine_grid->node[CVPoint]->GetDomain())) {
 
-        if ((fine_grid->node[CVPoint]->GetAgglomerate() == false) &&
-            (fine_grid->node[CVPoint]->GetDomain())) {
+            /*--- We set the value of the parent ---*/
 
-          /*--- We set the value of the parent ---*/
+            fine_grid->node[CVPoint]->SetParent_CV(Index_CoarseCV);
 
-          fine_grid->node[CVPoint]->SetParent_CV(Index_CoarseCV);
+            /*--- We set the indirect agglomeration information ---*/
 
-          /*--- We set the indirect agglomeration information ---*/
+            if (fine_grid->node[CVPoint]->GetAgglomerate_Indirect())
+              node[Index_CoarseCV]->SetAgglomerate_Indirect(true);
 
-          if (fine_grid->node[CVPoint]->GetAgglomerate_Indirect())
-            node[Index_CoarseCV]->SetAgglomerate_Indirect(true);
+            /*--- We set the value of the child ---*/
 
-          /*--- We set the value of the child ---*/
+            node[Index_CoarseCV]->SetChildren_CV(nChildren, CVPoint);
+            nChildren++;
 
-          node[Index_CoarseCV]->SetChildren_CV(nChildren, CVPoint);
-          nChildren++;
+            /*--- Update the queue with the new control volume (remove the CV and
+             increase the priority of the neighbors) ---*/
 
-          /*--- Update the queue with the new control volume (remove the CV and
-           increase the priority of the neighbors) ---*/
-
-          MGQueue_InnerCV.Update(CVPoint, fine_grid);
+            MGQueue_InnerCV.Update(CVPoint, fine_grid);
 
+          }
         }
-      }
 
-      /*--- Update the number of control of childrens ---*/
+        /*--- Update the number of control of childrens ---*/
 
-      node[Index_CoarseCV]->SetnChildren_CV(nChildren);
-      Index_CoarseCV++;
-    }
-    else {
+        node[Index_CoarseCV]->SetnChildren_CV(nChildren);
+        Index_CoarseCV++;
+      }
+      else {
+
+        /*--- The seed point can not be agglomerated because of size, domain, streching, etc.
+         move the point to the lowest priority ---*/
 
-      /*--- The seed point can not be agglomerated because of size, domain, streching, etc.
-       move the point to the lowest priority ---*/
+        MGQueue_InnerCV.MoveCV(iPoint, -1);
+      }
 
-      MGQueue_InnerCV.MoveCV(iPoint, -1);
     }
 
   }
@@ -619,58 +702,281 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
 
   nPoint = Index_CoarseCV;
 
-  /*--- Console output with the summary of the agglomeration ---*/
+  delete [] copy_marker;
 
-  Local_nPointCoarse = nPoint;
-  Local_nPointFine = fine_grid->GetnPoint();
+}
 
-  SU2_MPI::Allreduce(&Local_nPointCoarse, &Global_nPointCoarse, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&Local_nPointFine, &Global_nPointFine, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
 
-  su2double Coeff = 1.0, CFL = 0.0, factor = 1.5;
+namespace {
+/*--- Layout of the header of the agglomeration cache files, the counts are those of the rank. ---*/
+enum AGGLOMERATION_CACHE_HEADER {
+  MG_CACHE_ID, MG_CACHE_SIZE, MG_CACHE_RANK, MG_CACHE_KIND, MG_CACHE_FINE_NPOINT, MG_CACHE_FINE_NPOINTDOMAIN,
+  MG_CACHE_FINE_HASH, MG_CACHE_NPOINTDOMAIN, MG_CACHE_NPOINT, MG_CACHE_NCHILDREN, MG_CACHE_HEADER_SIZE
+};
 
-  if (iMesh != MESH_0) {
-    if (nDim == 2) Coeff = pow(su2double(Global_nPointFine)/su2double(Global_nPointCoarse), 1./2.);
-    if (nDim == 3) Coeff = pow(su2double(Global_nPointFine)/su2double(Global_nPointCoarse), 1./3.);
-    CFL = factor*config->GetCFL(iMesh-1)/Coeff;
-    config->SetCFL(iMesh, CFL);
+const unsigned long AGGLOMERATION_CACHE_ID = 535535; /*!< \brief Identifier of the agglomeration cache files. */
+
+const unsigned long MG_AGGLOMERATION_GROUP_SIZE = 64; /*!< \brief Points per group of the colored agglomeration. */
+
+/*--- Flags of the coarse control volumes stored in the cache. ---*/
+const unsigned char MG_CACHE_INDIRECT = 1, MG_CACHE_DOMAIN = 2;
+
+/*--- Hash (FNV-1a) of the point connectivity of the fine grid, a cheap check that the cache
+ *    was built from the same local grid (same partition and ordering of the points). ---*/
+unsigned long FineGridHash(const CGeometry *fine_grid) {
+
+  uint64_t hash = 14695981039346656037ull;
+
+  auto Combine = [&hash](uint64_t val) {
+    for (int iByte = 0; iByte < 8; iByte++) {
+      hash ^= (val >> (8*iByte)) & 0xff;
+      hash *= 1099511628211ull;
+    }
+  };
+
+  for (unsigned long iPoint = 0; iPoint < fine_grid->GetnPoint(); iPoint++) {
+    const auto point = fine_grid->node[iPoint];
+    Combine(point->GetnPoint());
+    Combine(point->GetDomain());
+    for (unsigned short iNode = 0; iNode < point->GetnPoint(); iNode++)
+      Combine(point->GetPoint(iNode));
   }
+  return static_cast<unsigned long>(hash);
+}
+}
 
-  su2double ratio = su2double(Global_nPointFine)/su2double(Global_nPointCoarse);
+bool CMultiGridGeometry::ColoredAgglomeration(CGeometry *fine_grid, CConfig *config, unsigned long &Index_CoarseCV) {
 
-  if (((nDim == 2) && (ratio < 2.5)) ||
-      ((nDim == 3) && (ratio < 2.5))) {
-    config->SetMGLevels(iMesh-1);
+  const unsigned long nPointFine = fine_grid->GetnPoint();
+
+  /*--- Color groups of points such that the groups of one color have disjoint closed neighborhoods
+   (the pattern includes the point itself). Since a seed only agglomerates its direct neighbors, the
+   groups of one color can be agglomerated simultaneously, and in a way that does not depend on the
+   number of threads. ---*/
+
+  const auto pattern = buildCSRPattern(*fine_grid, ConnectivityType::FiniteVolume, 0ul);
+  const auto coloring = colorSparsePattern(pattern, MG_AGGLOMERATION_GROUP_SIZE);
+
+  if (coloring.empty()) {
+    cout << "WARNING: The grid of rank " << rank << " could not be colored, the sequential agglomeration is used." << endl;
+    return false;
   }
-  else {
-    if (rank == MASTER_NODE) {
-      PrintingToolbox::CTablePrinter MGTable(&std::cout);
-      MGTable.AddColumn("MG Level", 10);
-      MGTable.AddColumn("CVs", 10);
-      MGTable.AddColumn("Aggl. Rate", 10);
-      MGTable.AddColumn("CFL", 10);
-      MGTable.SetAlign(PrintingToolbox::CTablePrinter::RIGHT);
 
+  /*--- Points that can be agglomerated (seed or neighbor) must belong to the domain and pass the
+   geometrical check, which is evaluated here by one thread (it uses the active type). ---*/
 
-      if (iMesh == 1){
-        MGTable.PrintHeader();
-        MGTable << iMesh - 1 << Global_nPointFine << "1/1.00" << config->GetCFL(iMesh -1);
+  vector<char> candidate(nPointFine);
+  for (unsigned long iPoint = 0; iPoint < nPointFine; iPoint++)
+    candidate[iPoint] = fine_grid->node[iPoint]->GetDomain() && GeometricalCheck(iPoint, fine_grid, config);
+
+  /*--- Seed of the points agglomerated in this stage (nPointFine if not agglomerated). ---*/
+
+  vector<unsigned long> seed(nPointFine, nPointFine);
+
+  SU2_OMP_PARALLEL
+  {
+    for (unsigned long iColor = 0; iColor < coloring.getOuterSize(); iColor++) {
+
+      const unsigned long nPointColor = coloring.getNumNonZeros(iColor);
+      const unsigned long* pointColor = coloring.innerIdx(iColor);
+
+      /*--- The chunk size is the group size, the groups are not split between threads. ---*/
+
+      SU2_OMP_FOR_DYN(MG_AGGLOMERATION_GROUP_SIZE)
+      for (unsigned long k = 0; k < nPointColor; k++) {
+
+        const unsigned long iPoint = pointColor[k];
+
+        if (fine_grid->node[iPoint]->GetAgglomerate() || !candidate[iPoint]) continue;
+
+        /*--- The parent is set to mark the point as agglomerated, it is renumbered below. ---*/
+
+        fine_grid->node[iPoint]->SetParent_CV(iPoint);
+        seed[iPoint] = iPoint;
+
+        for (unsigned short iNode = 0; iNode < fine_grid->node[iPoint]->GetnPoint(); iNode++) {
+          const unsigned long jPoint = fine_grid->node[iPoint]->GetPoint(iNode);
+
+          if (!fine_grid->node[jPoint]->GetAgglomerate() && candidate[jPoint]) {
+            fine_grid->node[jPoint]->SetParent_CV(iPoint);
+            seed[jPoint] = iPoint;
+          }
+        }
       }
-      stringstream ss;
-      ss << "1/" << std::setprecision(3) << ratio;
-      MGTable << iMesh << Global_nPointCoarse << ss.str() << CFL;
-      if (iMesh == config->GetnMGLevels()){
-        MGTable.PrintFooter();
+    }
+  }
+
+  /*--- Number the new coarse control volumes in the order of their seeds, the seed is
+   the first child followed by the neighbors (as in the sequential agglomeration). ---*/
+
+  for (unsigned long iPoint = 0; iPoint < nPointFine; iPoint++) {
+
+    if (seed[iPoint] != iPoint) continue;
+
+    unsigned short nChildren = 1;
+
+    fine_grid->node[iPoint]->SetParent_CV(Index_CoarseCV);
+    node[Index_CoarseCV]->SetChildren_CV(0, iPoint);
+
+    for (unsigned short iNode = 0; iNode < fine_grid->node[iPoint]->GetnPoint(); iNode++) {
+      const unsigned long jPoint = fine_grid->node[iPoint]->GetPoint(iNode);
+
+      if (seed[jPoint] == iPoint) {
+        fine_grid->node[jPoint]->SetParent_CV(Index_CoarseCV);
+        node[Index_CoarseCV]->SetChildren_CV(nChildren, jPoint);
+        nChildren++;
       }
     }
+
+    node[Index_CoarseCV]->SetnChildren_CV(nChildren);
+    Index_CoarseCV++;
   }
 
-  edgeColorGroupSize = config->GetEdgeColoringGroupSize();
+  return true;
 
-  delete [] copy_marker;
+}
 
+string CMultiGridGeometry::GetAgglomerationCacheName(CConfig *config, unsigned short iMesh) {
+
+  const string ext = "_" + to_string(SU2_MPI::GetRank()) + ".dat";
+
+  return config->GetMultizone_FileName(config->GetPartition_Cache_FileName() + "_mg" + to_string(iMesh),
+                                       config->GetiZone(), ext);
+}
+
+bool CMultiGridGeometry::CheckAgglomerationCache(const CGeometry *fine_grid, CConfig *config,
+                                                 const string& val_filename) {
+
+  /*--- The cache of every rank must exist and match the fine grid, otherwise the level is agglomerated again. ---*/
+
+  int valid = 0, allValid = 0;
+
+  FILE *fhr = fopen(val_filename.c_str(), "rb");
+
+  if (fhr != NULL) {
+    unsigned long header[MG_CACHE_HEADER_SIZE] = {0};
+
+    if (fread(header, sizeof(unsigned long), MG_CACHE_HEADER_SIZE, fhr) == MG_CACHE_HEADER_SIZE) {
+      valid = (header[MG_CACHE_ID] == AGGLOMERATION_CACHE_ID) &&
+              (header[MG_CACHE_SIZE] == static_cast<unsigned long>(size)) &&
+              (header[MG_CACHE_RANK] == static_cast<unsigned long>(rank)) &&
+              (header[MG_CACHE_KIND] == config->GetKind_MG_Agglomeration()) &&
+              (header[MG_CACHE_FINE_NPOINT] == fine_grid->GetnPoint()) &&
+              (header[MG_CACHE_FINE_NPOINTDOMAIN] == fine_grid->GetnPointDomain()) &&
+              (header[MG_CACHE_FINE_HASH] == FineGridHash(fine_grid));
+    }
+    fclose(fhr);
+  }
+
+  SU2_MPI::Allreduce(&valid, &allValid, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+
+  return (allValid == 1);
 }
 
+void CMultiGridGeometry::WriteAgglomerationCache(const CGeometry *fine_grid, CConfig *config,
+                                                 const string& val_filename) const {
+
+  const unsigned long nPointFine = fine_grid->GetnPoint();
+
+  vector<unsigned long> parent(nPointFine), nChildren(nPoint), children;
+  vector<unsigned char> flags(nPoint, 0);
+
+  for (unsigned long iPoint = 0; iPoint < nPointFine; iPoint++)
+    parent[iPoint] = fine_grid->node[iPoint]->GetParent_CV();
+
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+    nChildren[iPoint] = node[iPoint]->GetnChildren_CV();
+    for (unsigned short iChildren = 0; iChildren < nChildren[iPoint]; iChildren++)
+      children.push_back(node[iPoint]->GetChildren_CV(iChildren));
+
+    if (node[iPoint]->GetAgglomerate_Indirect()) flags[iPoint] |= MG_CACHE_INDIRECT;
+    if (node[iPoint]->GetDomain()) flags[iPoint] |= MG_CACHE_DOMAIN;
+  }
+
+  unsigned long header[MG_CACHE_HEADER_SIZE] = {0};
+
+  header[MG_CACHE_ID]   = AGGLOMERATION_CACHE_ID;
+  header[MG_CACHE_SIZE] = size;
+  header[MG_CACHE_RANK] = rank;
+  header[MG_CACHE_KIND] = config->GetKind_MG_Agglomeration();
+  header[MG_CACHE_FINE_NPOINT] = nPointFine;
+  header[MG_CACHE_FINE_NPOINTDOMAIN] = fine_grid->GetnPointDomain();
+  header[MG_CACHE_FINE_HASH] = FineGridHash(fine_grid);
+  header[MG_CACHE_NPOINTDOMAIN] = nPointDomain;
+  header[MG_CACHE_NPOINT] = nPoint;
+  header[MG_CACHE_NCHILDREN] = children.size();
+
+  FILE *fhw = fopen(val_filename.c_str(), "wb");
+
+  if (fhw == NULL) {
+    SU2_MPI::Error(string("Unable to write the agglomeration cache file ") + val_filename, CURRENT_FUNCTION);
+  }
+
+  auto WriteArray = [fhw](const void* data, size_t bytes, unsigned long count) {
+    if (count > 0) fwrite(data, bytes, count, fhw);
+  };
+
+  WriteArray(header, sizeof(unsigned long), MG_CACHE_HEADER_SIZE);
+  WriteArray(parent.data(), sizeof(unsigned long), parent.size());
+  WriteArray(nChildren.data(), sizeof(unsigned long), nChildren.size());
+  WriteArray(children.data(), sizeof(unsigned long), children.size());
+  WriteArray(flags.data(), sizeof(unsigned char), flags.size());
+
+  fclose(fhw);
+
+}
+
+void CMultiGridGeometry::ReadAgglomerationCache(CGeometry *fine_grid, const string& val_filename) {
+
+  FILE *fhr = fopen(val_filename.c_str(), "rb");
+
+  if (fhr == NULL) {
+    SU2_MPI::Error(string("Unable to open the agglomeration cache file ") + val_filename, CURRENT_FUNCTION);
+  }
+
+  auto ReadArray = [fhr, &val_filename](void* data, size_t bytes, unsigned long count) {
+    if ((count > 0) && (fread(data, bytes, count, fhr) != count)) {
+      SU2_MPI::Error(string("Unexpected end of the agglomeration cache file ") + val_filename, CURRENT_FUNCTION);
+    }
+  };
+
+  unsigned long header[MG_CACHE_HEADER_SIZE] = {0};
+
+  ReadArray(header, sizeof(unsigned long), MG_CACHE_HEADER_SIZE);
+
+  const unsigned long nPointFine = header[MG_CACHE_FINE_NPOINT];
+
+  nPointDomain = header[MG_CACHE_NPOINTDOMAIN];
+  nPoint = header[MG_CACHE_NPOINT];
+
+  vector<unsigned long> parent(nPointFine), nChildren(nPoint), children(header[MG_CACHE_NCHILDREN]);
+  vector<unsigned char> flags(nPoint);
+
+  ReadArray(parent.data(), sizeof(unsigned long), parent.size());
+  ReadArray(nChildren.data(), sizeof(unsigned long), nChildren.size());
+  ReadArray(children.data(), sizeof(unsigned long), children.size());
+  ReadArray(flags.data(), sizeof(unsigned char), flags.size());
+
+  fclose(fhr);
+
+  /*--- Restore the state left by the agglomeration, parents of the fine points and
+   children of the coarse control volumes. ---*/
+
+  for (unsigned long iPoint = 0; iPoint < nPointFine; iPoint++)
+    fine_grid->node[iPoint]->SetParent_CV(parent[iPoint]);
+
+  unsigned long iChildrenGlobal = 0;
+
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+    for (unsigned short iChildren = 0; iChildren < nChildren[iPoint]; iChildren++)
+      node[iPoint]->SetChildren_CV(iChildren, children[iChildrenGlobal++]);
+    node[iPoint]->SetnChildren_CV(nChildren[iPoint]);
+
+    node[iPoint]->SetAgglomerate_Indirect((flags[iPoint] & MG_CACHE_INDIRECT) != 0);
+    node[iPoint]->SetDomain((flags[iPoint] & MG_CACHE_DOMAIN) != 0);
+  }
+
+}
 
 CMultiGridGeometry::~CMultiGridGeometry(void) {
 
@@ -1162,6 +1468,15 @@ void CMultiGridGeometry::SetControlVolume(CConfig *config, CGeometry *fine_grid,
     if (Area == 0.0) for (iDim = 0; iDim < nDim; iDim++) NormalFace[iDim] = EPS*EPS;
   }
 
+  /*--- Geometric factors of the edges used by the numerics. ---*/
+
+  SetEdgeGeometry(config);
+
+  /*--- Everything changed for the next coarser level, the changes of the fine grid are consumed. ---*/
+
+  dualGridChanged.assign(nPoint, true);
+  fine_grid->ClearDualGridChanged();
+
 }
 
 void CMultiGridGeometry::SetBoundControlVolume(CConfig *config, CGeometry *fine_grid, unsigned short action) {
@@ -1224,6 +1539,169 @@ void CMultiGridGeometry::SetCoord(CGeometry *geometry) {
       node[Point_Coarse]->SetCoord(iDim, Coordinates[iDim]);
   }
   delete[] Coordinates;
+
+  /*--- The stored edge factors depend on the coordinates. ---*/
+
+  UpdateEdgeGeometry();
+}
+
+void CMultiGridGeometry::UpdateDualGrid(CConfig *config, CGeometry *fine_grid) {
+
+  unsigned long iCoarsePoint, iFinePoint, iFinePoint_Neighbor, iParent, iEdge, iVertex;
+  unsigned short iChildren, iNode, iMarker, iDim;
+  long FineEdge, CoarseEdge, FineVertex;
+  su2double Normal[3] = {0.0}, Coordinates[3] = {0.0}, Coarse_Volume, Area, *NormalFace;
+
+  const auto& fineChanged = fine_grid->GetDualGridChanged();
+
+  /*--- Everything is computed in AD builds, or if the changes of the fine grid are not known. ---*/
+
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+  bool incremental = false;
+#else
+  bool incremental = (fineChanged.size() == fine_grid->GetnPoint());
+#endif
+
+  /*--- If the fine grid only moved rigidly, so does this level, otherwise everything changed. ---*/
+
+  su2double rotMatrix[3][3], translation[3];
+
+  if (incremental && fine_grid->GetRigidMotion(rotMatrix, translation)) {
+
+    if (find(fineChanged.begin(), fineChanged.end(), true) == fineChanged.end()) {
+
+      for (iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint++) {
+        for (iDim = 0; iDim < nDim; iDim++) {
+          Coordinates[iDim] = translation[iDim];
+          for (unsigned short jDim = 0; jDim < nDim; jDim++)
+            Coordinates[iDim] += rotMatrix[iDim][jDim]*node[iCoarsePoint]->GetCoord(jDim);
+        }
+        for (iDim = 0; iDim < nDim; iDim++)
+          node[iCoarsePoint]->SetCoord(iDim, Coordinates[iDim]);
+      }
+
+      RotateDualGrid(rotMatrix);
+
+      UpdateEdgeGeometry();
+
+      fine_grid->ClearDualGridChanged();
+
+      if (dualGridChanged.size() != nPoint) dualGridChanged.assign(nPoint, true);
+      AddRigidMotion(rotMatrix, translation);
+      return;
+    }
+    incremental = false;
+  }
+
+  if (!incremental) {
+    SetControlVolume(config, fine_grid, UPDATE);
+    SetBoundControlVolume(config, fine_grid, UPDATE);
+    SetCoord(fine_grid);
+    return;
+  }
+
+  /*--- Parents of changed fine points. ---*/
+
+  vector<bool> changed(nPoint, false);
+  for (iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint++)
+    for (iChildren = 0; iChildren < node[iCoarsePoint]->GetnChildren_CV(); iChildren++)
+      if (fineChanged[node[iCoarsePoint]->GetChildren_CV(iChildren)]) changed[iCoarsePoint] = true;
+
+  /*--- Volumes, edges (both points changed), and vertices, in the same order as SetControlVolume
+   *    and SetBoundControlVolume, a fine edge that changed is between children of changed parents. ---*/
+
+  for (iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint++) {
+    if (!changed[iCoarsePoint]) continue;
+    Coarse_Volume = 0.0;
+    for (iChildren = 0; iChildren < node[iCoarsePoint]->GetnChildren_CV(); iChildren++) {
+      iFinePoint = node[iCoarsePoint]->GetChildren_CV(iChildren);
+      Coarse_Volume += fine_grid->node[iFinePoint]->GetVolume();
+    }
+    node[iCoarsePoint]->SetVolume(Coarse_Volume);
+  }
+
+  for (iEdge = 0; iEdge < nEdge; iEdge++)
+    if (changed[edge[iEdge]->GetNode(0)] && changed[edge[iEdge]->GetNode(1)])
+      edge[iEdge]->SetZeroValues();
+
+  for (iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint++) {
+    if (!changed[iCoarsePoint]) continue;
+    for (iChildren = 0; iChildren < node[iCoarsePoint]->GetnChildren_CV(); iChildren++) {
+      iFinePoint = node[iCoarsePoint]->GetChildren_CV(iChildren);
+
+      for (iNode = 0; iNode < fine_grid->node[iFinePoint]->GetnPoint(); iNode++) {
+        iFinePoint_Neighbor = fine_grid->node[iFinePoint]->GetPoint(iNode);
+        iParent = fine_grid->node[iFinePoint_Neighbor]->GetParent_CV();
+        if ((iParent < iCoarsePoint) && changed[iParent]) {
+
+          FineEdge = fine_grid->FindEdge(iFinePoint, iFinePoint_Neighbor);
+          CoarseEdge = FindEdge(iParent, iCoarsePoint);
+
+          fine_grid->edge[FineEdge]->GetNormal(Normal);
+
+          if (iFinePoint < iFinePoint_Neighbor)
+            for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Normal[iDim];
+
+          edge[CoarseEdge]->AddNormal(Normal);
+        }
+      }
+    }
+  }
+
+  for (iEdge = 0; iEdge < nEdge; iEdge++) {
+    if (!changed[edge[iEdge]->GetNode(0)] || !changed[edge[iEdge]->GetNode(1)]) continue;
+    NormalFace = edge[iEdge]->GetNormal();
+    Area = 0.0; for (iDim = 0; iDim < nDim; iDim++) Area += NormalFace[iDim]*NormalFace[iDim];
+    Area = sqrt(Area);
+    if (Area == 0.0) for (iDim = 0; iDim < nDim; iDim++) NormalFace[iDim] = EPS*EPS;
+  }
+
+  for (iMarker = 0; iMarker < nMarker; iMarker++) {
+    for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
+      iCoarsePoint = vertex[iMarker][iVertex]->GetNode();
+      if (!changed[iCoarsePoint]) continue;
+
+      vertex[iMarker][iVertex]->SetZeroValues();
+      for (iChildren = 0; iChildren < node[iCoarsePoint]->GetnChildren_CV(); iChildren++) {
+        iFinePoint = node[iCoarsePoint]->GetChildren_CV(iChildren);
+        FineVertex = fine_grid->node[iFinePoint]->GetVertex(iMarker);
+        if (FineVertex != -1) {
+          fine_grid->vertex[iMarker][FineVertex]->GetNormal(Normal);
+          vertex[iMarker][iVertex]->AddNormal(Normal);
+        }
+      }
+
+      NormalFace = vertex[iMarker][iVertex]->GetNormal();
+      Area = 0.0; for (iDim = 0; iDim < nDim; iDim++) Area += NormalFace[iDim]*NormalFace[iDim];
+      Area = sqrt(Area);
+      if (Area == 0.0) for (iDim = 0; iDim < nDim; iDim++) NormalFace[iDim] = EPS*EPS;
+    }
+  }
+
+  /*--- Coordinates (as SetCoord), and the edge factors that depend on them or on the normals. ---*/
+
+  for (iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint++) {
+    if (!changed[iCoarsePoint]) continue;
+    for (iDim = 0; iDim < nDim; iDim++) Coordinates[iDim] = 0.0;
+    for (iChildren = 0; iChildren < node[iCoarsePoint]->GetnChildren_CV(); iChildren++) {
+      iFinePoint = node[iCoarsePoint]->GetChildren_CV(iChildren);
+      for (iDim = 0; iDim < nDim; iDim++)
+        Coordinates[iDim] += fine_grid->node[iFinePoint]->GetCoord(iDim)*
+                             fine_grid->node[iFinePoint]->GetVolume()/node[iCoarsePoint]->GetVolume();
+    }
+    for (iDim = 0; iDim < nDim; iDim++)
+      node[iCoarsePoint]->SetCoord(iDim, Coordinates[iDim]);
+  }
+
+  UpdateEdgeGeometry(changed);
+
+  /*--- The changes of the fine grid are consumed, accumulate those of this level for the next. ---*/
+
+  fine_grid->ClearDualGridChanged();
+
+  if (dualGridChanged.size() != nPoint) dualGridChanged.assign(nPoint, true);
+  for (iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint++)
+    if (changed[iCoarsePoint]) dualGridChanged[iCoarsePoint] = true;
 }
 
 void CMultiGridGeometry::SetMultiGridWallHeatFlux(CGeometry *geometry, unsigned short val_marker){
@@ -1343,6 +1821,25 @@ void CMultiGridGeometry::SetRestricted_GridVelocity(CGeometry *fine_mesh, CConfi
   }
 }
 
+void CMultiGridGeometry::SetRestricted_WallDistance(const CGeometry *fine_mesh) {
+
+  /*--- Loop over all coarse mesh points, the distance is the volume weighted
+   average of the distances of the child CVs (fine mesh). ---*/
+
+  for (unsigned long Point_Coarse = 0; Point_Coarse < nPoint; Point_Coarse++) {
+    su2double Area_Parent = node[Point_Coarse]->GetVolume();
+    su2double Distance = 0.0;
+
+    for (unsigned long iChild = 0; iChild < childrenCV.getNumNonZeros(Point_Coarse); iChild++) {
+      unsigned long Point_Fine = childrenCV.getInnerIdx(Point_Coarse, iChild);
+      su2double Area_Child = fine_mesh->node[Point_Fine]->GetVolume();
+      Distance += fine_mesh->node[Point_Fine]->GetWall_Distance()*Area_Child/Area_Parent;
+    }
+
+    node[Point_Coarse]->SetWall_Distance(Distance);
+  }
+}
+
 
 void CMultiGridGeometry::FindNormal_Neighbor(CConfig *config) {
 
@@ -0,0 +1,1155 @@
+/*!
+ * \file CParallelGridAdaptation.cpp
+ * \brief Partition-local (parallel) refinement of the grid.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/geometry/CParallelGridAdaptation.hpp"
+#include "../../include/toolboxes/CLinearPartitioner.hpp"
+#include "../../include/toolboxes/printing_toolbox.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+namespace {
+
+/*--- Pairs of local nodes of the edges of the element types that can be divided.
+ *    For prisms, the edges of the bottom and top triangles come first, then the vertical ones. ---*/
+
+const unsigned short LineEdges[1][2]  = {{0,1}};
+const unsigned short TriaEdges[3][2]  = {{0,1},{1,2},{2,0}};
+const unsigned short QuadEdges[4][2]  = {{0,1},{1,2},{2,3},{3,0}};
+const unsigned short TetraEdges[6][2] = {{0,1},{0,2},{0,3},{1,2},{1,3},{2,3}};
+const unsigned short PrismEdges[9][2] = {{0,1},{1,2},{2,0},{3,4},{4,5},{5,3},{0,3},{1,4},{2,5}};
+
+/*--- Edges of each face of a tetrahedron (indices in TetraEdges). ---*/
+
+const unsigned short TetraFaceEdges[4][3] = {{0,3,1},{0,4,2},{1,5,2},{3,5,4}};
+
+/*!
+ * \brief Get the local edges of an element.
+ * \param[in] geometry - Geometrical definition of the problem.
+ * \param[in] elem - The (volume or boundary) element.
+ * \param[out] edges - Local indices of the edges, in the order of the tables above.
+ * \return Number of edges, 0 if the element cannot be divided.
+ */
+unsigned short ElementEdges(CGeometry *geometry, CPrimalGrid *elem, unsigned long *edges) {
+
+  const unsigned short (*pairs)[2] = nullptr;
+  unsigned short nEdge = 0;
+
+  switch (elem->GetVTK_Type()) {
+    case LINE:          pairs = LineEdges;  nEdge = 1; break;
+    case TRIANGLE:      pairs = TriaEdges;  nEdge = 3; break;
+    case QUADRILATERAL: pairs = QuadEdges;  nEdge = 4; break;
+    case TETRAHEDRON:   pairs = TetraEdges; nEdge = 6; break;
+    case PRISM:         pairs = PrismEdges; nEdge = 9; break;
+    default: return 0;
+  }
+
+  for (unsigned short iEdge = 0; iEdge < nEdge; iEdge++)
+    edges[iEdge] = geometry->FindEdge(elem->GetNode(pairs[iEdge][0]), elem->GetNode(pairs[iEdge][1]));
+
+  return nEdge;
+}
+
+/*!
+ * \brief Children of a triangle as indices of its vertices (0-2) and of the midpoints of its edges (3-5),
+ *        the orientation of the parent is preserved.
+ * \param[in] split - Whether each edge (TriaEdges) is split, one or all of them.
+ * \return The children.
+ */
+vector<array<unsigned short,3> > TriangleChildren(const bool *split) {
+
+  const unsigned short nSplit = split[0] + split[1] + split[2];
+
+  if (nSplit == 0) return {{{0,1,2}}};
+  if (nSplit == 3) return {{{0,3,5}}, {{3,1,4}}, {{5,4,2}}, {{3,4,5}}};
+  if (split[0]) return {{{0,3,2}}, {{3,1,2}}};
+  if (split[1]) return {{{0,1,4}}, {{0,4,2}}};
+  return {{{0,1,5}}, {{5,1,2}}};
+}
+
+/*!
+ * \brief Map the MPI datatype of the buffers.
+ */
+inline SU2_MPI::Datatype MPIType(unsigned long) { return MPI_UNSIGNED_LONG; }
+inline SU2_MPI::Datatype MPIType(passivedouble) { return MPI_DOUBLE; }
+
+}
+
+CParallelGridAdaptation::CParallelGridAdaptation(CGeometry *geometry, CConfig *config) {
+
+  rank = SU2_MPI::GetRank();
+  size = SU2_MPI::GetSize();
+  nDim = geometry->GetnDim();
+
+  nPointGlobal = geometry->GetGlobal_nPointDomain();
+  nPointGlobal_New = nPointGlobal;
+  nClosureIter = 0;
+
+  /*--- Check the element types and count the elements owned by this rank. ---*/
+
+  unsigned long nElemOwned = 0;
+  unsigned long nodes[N_POINTS_HEXAHEDRON];
+
+  for (unsigned long iElem = 0; iElem < geometry->GetnElem(); iElem++) {
+    const unsigned short vtkType = geometry->elem[iElem]->GetVTK_Type();
+    const bool valid = (nDim == 2)? (vtkType == TRIANGLE) : ((vtkType == TETRAHEDRON) || (vtkType == PRISM));
+    if (!valid) {
+      SU2_MPI::Error("PARALLEL_ADAPTATION refines grids of triangles (2D), or of tetrahedra and prisms (3D) only.",
+                     CURRENT_FUNCTION);
+    }
+    const unsigned short nNodes = geometry->elem[iElem]->GetnNodes();
+    for (unsigned short iNode = 0; iNode < nNodes; iNode++) nodes[iNode] = geometry->elem[iElem]->GetNode(iNode);
+    if (IsOwned(geometry, nodes, nNodes)) nElemOwned++;
+  }
+
+  SU2_MPI::Allreduce(&nElemOwned, &nElemGlobal, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+  nElemGlobal_New = nElemGlobal;
+
+  /*--- The periodic boundaries would no longer match after the division of their elements. ---*/
+
+  for (unsigned short iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
+    if (config->GetMarker_All_KindBC(iMarker) == PERIODIC_BOUNDARY) {
+      SU2_MPI::Error("PARALLEL_ADAPTATION does not support periodic boundaries.", CURRENT_FUNCTION);
+    }
+  }
+
+  /*--- Find the owner of each edge and, for the edges owned by other ranks, send them the global indices
+   of the endpoints such that they find their local edges. The lists are kept for the synchronizations. ---*/
+
+  const unsigned long nEdge = geometry->GetnEdge();
+
+  EdgeSend.resize(size);
+  EdgeRecv.resize(size);
+
+  vector<vector<unsigned long> > sendKeys(size), recvKeys;
+
+  for (unsigned long iEdge = 0; iEdge < nEdge; iEdge++) {
+    unsigned long iPoint = geometry->edge[iEdge]->GetNode(0);
+    unsigned long jPoint = geometry->edge[iEdge]->GetNode(1);
+    if (geometry->node[jPoint]->GetGlobalIndex() < geometry->node[iPoint]->GetGlobalIndex()) swap(iPoint, jPoint);
+
+    const int owner = geometry->node[iPoint]->GetColor();
+    if (owner == rank) continue;
+
+    EdgeSend[owner].push_back(iEdge);
+    sendKeys[owner].push_back(geometry->node[iPoint]->GetGlobalIndex());
+    sendKeys[owner].push_back(geometry->node[jPoint]->GetGlobalIndex());
+  }
+
+  ExchangeBuffers(sendKeys, recvKeys);
+
+  for (int iRank = 0; iRank < size; iRank++) {
+    for (unsigned long iKey = 0; iKey < recvKeys[iRank].size(); iKey += 2) {
+      const long iPoint = geometry->GetGlobal_to_Local_Point(recvKeys[iRank][iKey]);
+      const long jPoint = geometry->GetGlobal_to_Local_Point(recvKeys[iRank][iKey+1]);
+      if ((iPoint < 0) || (jPoint < 0)) {
+        SU2_MPI::Error("An edge of the halo is not known by the rank that owns it.", CURRENT_FUNCTION);
+      }
+      EdgeRecv[iRank].push_back(geometry->FindEdge(iPoint, jPoint));
+    }
+  }
+
+  Divide.assign(geometry->GetnElem(), false);
+  Split.assign(nEdge, 0);
+  MidPoint.assign(nEdge, 0);
+
+}
+
+template<class T>
+void CParallelGridAdaptation::ExchangeBuffers(const vector<vector<T> >& sendBuf, vector<vector<T> >& recvBuf) const {
+
+  recvBuf.clear();
+  recvBuf.resize(size);
+
+  if (size == 1) {
+    recvBuf[0] = sendBuf[0];
+    return;
+  }
+
+#ifdef HAVE_MPI
+  vector<int> nSend(size), nRecv(size), sendDispl(size+1, 0), recvDispl(size+1, 0);
+
+  for (int iRank = 0; iRank < size; iRank++) nSend[iRank] = sendBuf[iRank].size();
+
+  SU2_MPI::Alltoall(nSend.data(), 1, MPI_INT, nRecv.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+  for (int iRank = 0; iRank < size; iRank++) {
+    sendDispl[iRank+1] = sendDispl[iRank] + nSend[iRank];
+    recvDispl[iRank+1] = recvDispl[iRank] + nRecv[iRank];
+  }
+
+  vector<T> sendData(sendDispl[size]), recvData(recvDispl[size]);
+  for (int iRank = 0; iRank < size; iRank++)
+    copy(sendBuf[iRank].begin(), sendBuf[iRank].end(), sendData.begin()+sendDispl[iRank]);
+
+  SelectMPIWrapper<T>::W::Alltoallv(sendData.data(), nSend.data(), sendDispl.data(), MPIType(T()),
+                                    recvData.data(), nRecv.data(), recvDispl.data(), MPIType(T()),
+                                    MPI_COMM_WORLD);
+
+  for (int iRank = 0; iRank < size; iRank++)
+    recvBuf[iRank].assign(recvData.begin()+recvDispl[iRank], recvData.begin()+recvDispl[iRank+1]);
+#endif
+
+}
+
+bool CParallelGridAdaptation::IsOwned(CGeometry *geometry, const unsigned long *nodes, unsigned short nNodes) const {
+
+  unsigned long lowest = nodes[0];
+  for (unsigned short iNode = 1; iNode < nNodes; iNode++)
+    if (geometry->node[nodes[iNode]]->GetGlobalIndex() < geometry->node[lowest]->GetGlobalIndex())
+      lowest = nodes[iNode];
+
+  return (geometry->node[lowest]->GetColor() == (unsigned long)rank);
+}
+
+void CParallelGridAdaptation::SetHaloValues(CGeometry *geometry, vector<passivedouble>& values,
+                                            unsigned short nValue) const {
+
+  /*--- Request the halo points from their owners, and reply with the values of the requested points. ---*/
+
+  vector<vector<unsigned long> > request(size), requested;
+  vector<vector<unsigned long> > halos(size);
+
+  for (unsigned long iPoint = geometry->GetnPointDomain(); iPoint < geometry->GetnPoint(); iPoint++) {
+    const unsigned long owner = geometry->node[iPoint]->GetColor();
+    request[owner].push_back(geometry->node[iPoint]->GetGlobalIndex());
+    halos[owner].push_back(iPoint);
+  }
+
+  ExchangeBuffers(request, requested);
+
+  vector<vector<passivedouble> > reply(size), replied;
+
+  for (int iRank = 0; iRank < size; iRank++) {
+    for (auto iPoint_Global : requested[iRank]) {
+      const auto value = &values[geometry->GetGlobal_to_Local_Point(iPoint_Global)*nValue];
+      reply[iRank].insert(reply[iRank].end(), value, value+nValue);
+    }
+  }
+
+  ExchangeBuffers(reply, replied);
+
+  for (int iRank = 0; iRank < size; iRank++)
+    for (unsigned long iHalo = 0; iHalo < halos[iRank].size(); iHalo++)
+      copy(&replied[iRank][iHalo*nValue], &replied[iRank][iHalo*nValue]+nValue, &values[halos[iRank][iHalo]*nValue]);
+
+}
+
+vector<passivedouble> CParallelGridAdaptation::ReadRestartField(CGeometry *geometry, CConfig *config,
+                                                                unsigned short iField) const {
+
+  const string filename = config->GetFilename(config->GetSolution_FileName(), ".dat", 0);
+
+  /*--- The master reads the header of the binary restart file. ---*/
+
+  int header[5] = {0, 0, 0, 0, 0};
+
+  if (rank == MASTER_NODE) {
+    FILE *restart_file = fopen(filename.c_str(), "rb");
+    if (!restart_file) {
+      SU2_MPI::Error(string("Unable to open SU2 restart file ") + filename, CURRENT_FUNCTION);
+    }
+    const size_t ret = fread(header, sizeof(int), 5, restart_file);
+    fclose(restart_file);
+
+    if ((ret != 5) || (header[0] != 535532)) {
+      SU2_MPI::Error(string("File ") + filename + string(" is not an (uncompressed) binary SU2 restart file.\n") +
+                     string("PARALLEL_ADAPTATION reads the solution from binary restart files."), CURRENT_FUNCTION);
+    }
+  }
+  SU2_MPI::Bcast(header, 5, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+
+  const unsigned long nFields = header[1];
+  const unsigned long nPointFile = header[2];
+
+  if ((nPointFile != nPointGlobal) || (iField >= nFields)) {
+    SU2_MPI::Error(string("The restart file ") + filename + string(" does not match the mesh."), CURRENT_FUNCTION);
+  }
+
+  /*--- Each rank reads a slice of a linear partition of the points of the file. ---*/
+
+  CLinearPartitioner filePartitioner(nPointFile, 0);
+
+  const unsigned long firstPoint = filePartitioner.GetFirstIndexOnRank(rank);
+  const unsigned long nPointSlice = filePartitioner.GetSizeOnRank(rank);
+  const unsigned long offset = 5*sizeof(int) + CGNS_STRING_SIZE*nFields + firstPoint*nFields*sizeof(passivedouble);
+
+  vector<passivedouble> sliceData(nPointSlice*nFields);
+
+#ifdef HAVE_MPI
+  MPI_File fhw;
+  MPI_Status status;
+  MPI_Datatype pointtype;
+
+  if (MPI_File_open(MPI_COMM_WORLD, filename.c_str(), MPI_MODE_RDONLY, MPI_INFO_NULL, &fhw)) {
+    SU2_MPI::Error(string("Unable to open SU2 restart file ") + filename, CURRENT_FUNCTION);
+  }
+
+  MPI_Type_contiguous(nFields, MPI_DOUBLE, &pointtype);
+  MPI_Type_commit(&pointtype);
+
+  const int ierr = MPI_File_read_at_all(fhw, MPI_Offset(offset), sliceData.data(), nPointSlice, pointtype, &status);
+
+  int nRead = 0;
+  MPI_Get_count(&status, pointtype, &nRead);
+
+  MPI_File_close(&fhw);
+  MPI_Type_free(&pointtype);
+
+  if (ierr || (unsigned long)nRead != nPointSlice) {
+    SU2_MPI::Error(string("Error reading restart file ") + filename, CURRENT_FUNCTION);
+  }
+#else
+  FILE *restart_file = fopen(filename.c_str(), "rb");
+  if (!restart_file || fseek(restart_file, offset, SEEK_SET) ||
+      (fread(sliceData.data(), sizeof(passivedouble), sliceData.size(), restart_file) != sliceData.size())) {
+    SU2_MPI::Error(string("Error reading restart file ") + filename, CURRENT_FUNCTION);
+  }
+  fclose(restart_file);
+#endif
+
+  /*--- Request the field at the local (domain and halo) points from the ranks that read them. ---*/
+
+  vector<vector<unsigned long> > request(size), requested;
+  vector<vector<unsigned long> > points(size);
+
+  for (unsigned long iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
+    const unsigned long iPoint_Global = geometry->node[iPoint]->GetGlobalIndex();
+    const unsigned long reader = filePartitioner.GetRankContainingIndex(iPoint_Global);
+    request[reader].push_back(iPoint_Global);
+    points[reader].push_back(iPoint);
+  }
+
+  ExchangeBuffers(request, requested);
+
+  vector<vector<passivedouble> > reply(size), replied;
+
+  for (int iRank = 0; iRank < size; iRank++)
+    for (auto iPoint_Global : requested[iRank])
+      reply[iRank].push_back(sliceData[(iPoint_Global-firstPoint)*nFields + iField]);
+
+  ExchangeBuffers(reply, replied);
+
+  vector<passivedouble> field(geometry->GetnPoint());
+
+  for (int iRank = 0; iRank < size; iRank++)
+    for (unsigned long iPoint = 0; iPoint < points[iRank].size(); iPoint++)
+      field[points[iRank][iPoint]] = replied[iRank][iPoint];
+
+  return field;
+}
+
+void CParallelGridAdaptation::SetIndicator_Flow(CGeometry *geometry, CConfig *config) {
+
+  const unsigned long nPoint = geometry->GetnPoint();
+  const passivedouble scale_area = SU2_TYPE::GetValue(config->GetDualVol_Power());
+  const passivedouble fraction = 0.01*SU2_TYPE::GetValue(config->GetNew_Elem_Adapt());
+
+  if (fraction <= 0.0) {
+    SU2_MPI::Error("NEW_ELEMS must be positive for the GRAD_FLOW adaptation.", CURRENT_FUNCTION);
+  }
+
+  /*--- The first variable after the coordinates (the density). ---*/
+
+  const vector<passivedouble> solution = ReadRestartField(geometry, config, nDim);
+
+  /*--- Green-Gauss gradient, exact at the domain points since their edges and vertices are all local. ---*/
+
+  vector<passivedouble> gradient(nPoint*nDim, 0.0), index(nPoint, 0.0);
+
+  for (unsigned long iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+    const unsigned long iPoint = geometry->edge[iEdge]->GetNode(0);
+    const unsigned long jPoint = geometry->edge[iEdge]->GetNode(1);
+    const su2double *Normal = geometry->edge[iEdge]->GetNormal();
+    const passivedouble average = 0.5*(solution[iPoint] + solution[jPoint]);
+    for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+      gradient[iPoint*nDim+iDim] += average*SU2_TYPE::GetValue(Normal[iDim]);
+      gradient[jPoint*nDim+iDim] -= average*SU2_TYPE::GetValue(Normal[iDim]);
+    }
+  }
+
+  for (unsigned short iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
+    if ((config->GetMarker_All_KindBC(iMarker) == INTERNAL_BOUNDARY) ||
+        (config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE)) continue;
+    for (unsigned long iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+      const unsigned long iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+      const su2double *Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+      for (unsigned short iDim = 0; iDim < nDim; iDim++)
+        gradient[iPoint*nDim+iDim] -= solution[iPoint]*SU2_TYPE::GetValue(Normal[iDim]);
+    }
+  }
+
+  /*--- Adaptation index of the domain points, as for the serial adaptation, then of the halo points. ---*/
+
+  for (unsigned long iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
+    const passivedouble volume = SU2_TYPE::GetValue(geometry->node[iPoint]->GetVolume());
+    passivedouble norm = 0.0;
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      norm += pow(gradient[iPoint*nDim+iDim]/volume, 2);
+    index[iPoint] = pow(volume, scale_area)*sqrt(norm);
+  }
+
+  SetHaloValues(geometry, index);
+
+  /*--- The index of an element is the largest of its nodes. ---*/
+
+  vector<passivedouble> elemIndex(geometry->GetnElem(), 0.0);
+
+  for (unsigned long iElem = 0; iElem < geometry->GetnElem(); iElem++)
+    for (unsigned short iNode = 0; iNode < geometry->elem[iElem]->GetnNodes(); iNode++)
+      elemIndex[iElem] = max(elemIndex[iElem], index[geometry->elem[iElem]->GetNode(iNode)]);
+
+  SetMarking_Fraction(geometry, elemIndex, fraction);
+
+}
+
+void CParallelGridAdaptation::SetMarking_Fraction(CGeometry *geometry, const vector<passivedouble>& elemIndex,
+                                                  passivedouble fraction) {
+
+  /*--- The threshold of the marked elements is found by bisection, such that the (owned) marked elements
+   are at most the requested fraction of the grid. ---*/
+
+  vector<bool> owned(geometry->GetnElem());
+  unsigned long nodes[N_POINTS_HEXAHEDRON];
+  passivedouble maxIndex = 0.0, maxIndexGlobal = 0.0;
+
+  for (unsigned long iElem = 0; iElem < geometry->GetnElem(); iElem++) {
+    const unsigned short nNodes = geometry->elem[iElem]->GetnNodes();
+    for (unsigned short iNode = 0; iNode < nNodes; iNode++) nodes[iNode] = geometry->elem[iElem]->GetNode(iNode);
+    owned[iElem] = IsOwned(geometry, nodes, nNodes);
+    maxIndex = max(maxIndex, elemIndex[iElem]);
+  }
+
+#ifdef HAVE_MPI
+  SelectMPIWrapper<passivedouble>::W::Allreduce(&maxIndex, &maxIndexGlobal, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+#else
+  maxIndexGlobal = maxIndex;
+#endif
+
+  const unsigned long maxMarked = static_cast<unsigned long>(fraction*nElemGlobal);
+
+  auto CountMarked = [&](passivedouble threshold) {
+    unsigned long nMarked = 0, nMarkedGlobal = 0;
+    for (unsigned long iElem = 0; iElem < geometry->GetnElem(); iElem++)
+      nMarked += (owned[iElem] && (elemIndex[iElem] > threshold));
+    SU2_MPI::Allreduce(&nMarked, &nMarkedGlobal, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+    return nMarkedGlobal;
+  };
+
+  passivedouble lower = 0.0, upper = maxIndexGlobal;
+  for (unsigned short iIter = 0; iIter < 64; iIter++) {
+    const passivedouble threshold = 0.5*(lower + upper);
+    if (CountMarked(threshold) > maxMarked) lower = threshold;
+    else upper = threshold;
+  }
+
+  for (unsigned long iElem = 0; iElem < geometry->GetnElem(); iElem++)
+    Divide[iElem] = (elemIndex[iElem] > upper);
+
+}
+
+void CParallelGridAdaptation::SetMarking(CGeometry *geometry, CConfig *config) {
+
+  switch (config->GetKind_Adaptation()) {
+    case FULL: case FULL_FLOW:
+      Divide.assign(geometry->GetnElem(), true);
+      break;
+    case GRAD_FLOW:
+      SetIndicator_Flow(geometry, config);
+      break;
+    default:
+      SU2_MPI::Error("PARALLEL_ADAPTATION supports KIND_ADAPT= FULL, FULL_FLOW and GRAD_FLOW.", CURRENT_FUNCTION);
+  }
+
+}
+
+void CParallelGridAdaptation::SetMarking(CGeometry *geometry, vector<passivedouble> metric, passivedouble fraction) {
+
+  if (fraction <= 0.0) {
+    SU2_MPI::Error("The fraction of the elements to refine must be positive.", CURRENT_FUNCTION);
+  }
+
+  const unsigned short nTensor = nDim*nDim;
+  metric.resize(geometry->GetnPoint()*nTensor, 0.0);
+  SetHaloValues(geometry, metric, nTensor);
+
+  /*--- Length of each edge in the metric averaged over its endpoints, and error of each element. ---*/
+
+  vector<passivedouble> edgeError(geometry->GetnEdge());
+
+  for (unsigned long iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+    const unsigned long iPoint = geometry->edge[iEdge]->GetNode(0);
+    const unsigned long jPoint = geometry->edge[iEdge]->GetNode(1);
+
+    passivedouble edge[3] = {0.0};
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      edge[iDim] = SU2_TYPE::GetValue(geometry->node[jPoint]->GetCoord(iDim) - geometry->node[iPoint]->GetCoord(iDim));
+
+    passivedouble length = 0.0;
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      for (unsigned short jDim = 0; jDim < nDim; jDim++)
+        length += 0.5*(metric[iPoint*nTensor+iDim*nDim+jDim] + metric[jPoint*nTensor+iDim*nDim+jDim])*edge[iDim]*edge[jDim];
+
+    edgeError[iEdge] = fabs(length);
+  }
+
+  vector<passivedouble> elemIndex(geometry->GetnElem(), 0.0);
+  unsigned long edges[9];
+
+  for (unsigned long iElem = 0; iElem < geometry->GetnElem(); iElem++) {
+    const unsigned short nEdge = ElementEdges(geometry, geometry->elem[iElem], edges);
+    for (unsigned short iEdge = 0; iEdge < nEdge; iEdge++)
+      elemIndex[iElem] = max(elemIndex[iElem], edgeError[edges[iEdge]]);
+  }
+
+  SetMarking_Fraction(geometry, elemIndex, fraction);
+
+}
+
+void CParallelGridAdaptation::SynchronizeEdges(vector<unsigned long>& values, bool combine) const {
+
+  vector<vector<unsigned long> > sendBuf(size), recvBuf;
+
+  /*--- The owners combine the values of the ranks that hold their edges. ---*/
+
+  if (combine) {
+    for (int iRank = 0; iRank < size; iRank++)
+      for (auto iEdge : EdgeSend[iRank]) sendBuf[iRank].push_back(values[iEdge]);
+
+    ExchangeBuffers(sendBuf, recvBuf);
+
+    for (int iRank = 0; iRank < size; iRank++)
+      for (unsigned long iKey = 0; iKey < EdgeRecv[iRank].size(); iKey++)
+        values[EdgeRecv[iRank][iKey]] = max(values[EdgeRecv[iRank][iKey]], recvBuf[iRank][iKey]);
+  }
+
+  /*--- And send the final values back. ---*/
+
+  for (int iRank = 0; iRank < size; iRank++) {
+    sendBuf[iRank].clear();
+    for (auto iEdge : EdgeRecv[iRank]) sendBuf[iRank].push_back(values[iEdge]);
+  }
+
+  ExchangeBuffers(sendBuf, recvBuf);
+
+  for (int iRank = 0; iRank < size; iRank++)
+    for (unsigned long iKey = 0; iKey < EdgeSend[iRank].size(); iKey++)
+      values[EdgeSend[iRank][iKey]] = recvBuf[iRank][iKey];
+
+}
+
+bool CParallelGridAdaptation::SetElementClosure(CGeometry *geometry, unsigned long iElem) {
+
+  unsigned long edges[9];
+  const unsigned short nEdge = ElementEdges(geometry, geometry->elem[iElem], edges);
+
+  bool changed = false;
+  auto SetSplit = [&](unsigned short iEdge) {
+    if (Split[edges[iEdge]] == 0) { Split[edges[iEdge]] = 1; changed = true; }
+  };
+
+  unsigned short nSplit = 0;
+
+  switch (geometry->elem[iElem]->GetVTK_Type()) {
+
+    case TRIANGLE:
+
+      /*--- One or three edges, the pattern of 2 edges is upgraded to red. ---*/
+
+      for (unsigned short iEdge = 0; iEdge < nEdge; iEdge++) nSplit += Split[edges[iEdge]];
+      if (nSplit == 2) for (unsigned short iEdge = 0; iEdge < nEdge; iEdge++) SetSplit(iEdge);
+      break;
+
+    case TETRAHEDRON: {
+
+      /*--- One edge, the edges of one face, or red. ---*/
+
+      for (unsigned short iEdge = 0; iEdge < nEdge; iEdge++) nSplit += Split[edges[iEdge]];
+      bool valid = (nSplit == 0) || (nSplit == 1) || (nSplit == 6);
+      if (nSplit == 3) {
+        for (unsigned short iFace = 0; iFace < 4; iFace++) {
+          const auto face = TetraFaceEdges[iFace];
+          valid |= (Split[edges[face[0]]] + Split[edges[face[1]]] + Split[edges[face[2]]] == 3);
+        }
+      }
+      if (!valid) for (unsigned short iEdge = 0; iEdge < nEdge; iEdge++) SetSplit(iEdge);
+      break;
+    }
+
+    case PRISM:
+
+      /*--- The bottom and top triangles are divided alike, with the pattern of the triangles. ---*/
+
+      for (unsigned short iEdge = 0; iEdge < 3; iEdge++) {
+        if (Split[edges[iEdge]] || Split[edges[iEdge+3]]) { SetSplit(iEdge); SetSplit(iEdge+3); nSplit++; }
+      }
+      if (nSplit == 2) for (unsigned short iEdge = 0; iEdge < 6; iEdge++) SetSplit(iEdge);
+      break;
+  }
+
+  return changed;
+}
+
+void CParallelGridAdaptation::SetEdgeSplitting(CGeometry *geometry) {
+
+  const unsigned long nElem = geometry->GetnElem();
+  const unsigned long nEdge = geometry->GetnEdge();
+  unsigned long edges[9];
+
+  /*--- Split the edges of the marked elements, all of them except the vertical edges of the prisms. ---*/
+
+  for (unsigned long iElem = 0; iElem < nElem; iElem++) {
+    if (!Divide[iElem]) continue;
+    const unsigned short nEdge_Elem = ElementEdges(geometry, geometry->elem[iElem], edges);
+    const unsigned short nSplit = (geometry->elem[iElem]->GetVTK_Type() == PRISM)? 6 : nEdge_Elem;
+    for (unsigned short iEdge = 0; iEdge < nSplit; iEdge++) Split[edges[iEdge]] = 1;
+  }
+
+  /*--- Close the splitting: synchronize the edges and split those needed by the elements,
+   until no element changes on any rank (the splitting only grows, hence this terminates). ---*/
+
+  unsigned long changed = 0;
+  nClosureIter = 0;
+
+  do {
+    SynchronizeEdges(Split, true);
+
+    unsigned long changedLocal = 0;
+    for (unsigned long iElem = 0; iElem < nElem; iElem++)
+      changedLocal |= SetElementClosure(geometry, iElem);
+
+    SU2_MPI::Allreduce(&changedLocal, &changed, 1, MPI_UNSIGNED_LONG, MPI_MAX, MPI_COMM_WORLD);
+    nClosureIter++;
+  } while (changed);
+
+  /*--- The vertical edges of the prisms can only be split by a neighbor that is not a prism (or tetrahedron),
+   i.e. a pyramid or hexahedron, which are rejected by the constructor. ---*/
+
+  for (unsigned long iElem = 0; iElem < nElem; iElem++) {
+    if (geometry->elem[iElem]->GetVTK_Type() != PRISM) continue;
+    ElementEdges(geometry, geometry->elem[iElem], edges);
+    if (Split[edges[6]] || Split[edges[7]] || Split[edges[8]]) {
+      SU2_MPI::Error("A vertical edge of a prism would be split, the grid cannot be refined conformingly.",
+                     CURRENT_FUNCTION);
+    }
+  }
+
+  /*--- Number the new points, the midpoints of the split edges, on the owners of the edges
+   (after the points of the original grid), and send their indices to the other ranks. ---*/
+
+  vector<bool> owned(nEdge, true);
+  for (int iRank = 0; iRank < size; iRank++)
+    for (auto iEdge : EdgeSend[iRank]) owned[iEdge] = false;
+
+  unsigned long nNewPoint = 0;
+  for (unsigned long iEdge = 0; iEdge < nEdge; iEdge++) nNewPoint += (owned[iEdge] && Split[iEdge]);
+
+  vector<unsigned long> nNewPointRank(size);
+  SU2_MPI::Allgather(&nNewPoint, 1, MPI_UNSIGNED_LONG, nNewPointRank.data(), 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+  if (size == 1) nNewPointRank[0] = nNewPoint;
+
+  unsigned long offset = nPointGlobal;
+  nPointGlobal_New = nPointGlobal;
+  for (int iRank = 0; iRank < size; iRank++) {
+    if (iRank < rank) offset += nNewPointRank[iRank];
+    nPointGlobal_New += nNewPointRank[iRank];
+  }
+
+  for (unsigned long iEdge = 0; iEdge < nEdge; iEdge++)
+    if (owned[iEdge] && Split[iEdge]) MidPoint[iEdge] = offset++;
+
+  SynchronizeEdges(MidPoint, false);
+
+}
+
+void CParallelGridAdaptation::SetDivision(CGeometry *geometry, unsigned short vtkType, const unsigned long *nodes,
+                                          unsigned short recordSize, vector<unsigned long>& conn) {
+
+  /*--- Local element of the same type with the given nodes, to get its edges. ---*/
+
+  unsigned long edges[9];
+  unsigned short nNode = 0, nEdge = 0;
+  const unsigned short (*pairs)[2] = nullptr;
+
+  switch (vtkType) {
+    case LINE:          nNode = N_POINTS_LINE;          pairs = LineEdges;  nEdge = 1; break;
+    case TRIANGLE:      nNode = N_POINTS_TRIANGLE;      pairs = TriaEdges;  nEdge = 3; break;
+    case QUADRILATERAL: nNode = N_POINTS_QUADRILATERAL; pairs = QuadEdges;  nEdge = 4; break;
+    case TETRAHEDRON:   nNode = N_POINTS_TETRAHEDRON;   pairs = TetraEdges; nEdge = 6; break;
+    case PRISM:         nNode = N_POINTS_PRISM;         pairs = PrismEdges; nEdge = 6; break;
+    default:
+      SU2_MPI::Error("Unsupported element type.", CURRENT_FUNCTION);
+  }
+
+  /*--- Global indices and coordinates of the vertices (tokens 0 to nNode-1), and of the midpoints
+   of the edges (tokens nNode + index of the edge). ---*/
+
+  unsigned long global[15] = {0};
+  su2double coord[15][3] = {{0.0}};
+  bool split[9] = {false};
+
+  for (unsigned short iNode = 0; iNode < nNode; iNode++) {
+    global[iNode] = geometry->node[nodes[iNode]]->GetGlobalIndex();
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      coord[iNode][iDim] = geometry->node[nodes[iNode]]->GetCoord(iDim);
+  }
+
+  for (unsigned short iEdge = 0; iEdge < nEdge; iEdge++) {
+    edges[iEdge] = geometry->FindEdge(nodes[pairs[iEdge][0]], nodes[pairs[iEdge][1]]);
+    split[iEdge] = Split[edges[iEdge]];
+    global[nNode+iEdge] = MidPoint[edges[iEdge]];
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      coord[nNode+iEdge][iDim] = 0.5*(coord[pairs[iEdge][0]][iDim] + coord[pairs[iEdge][1]][iDim]);
+  }
+
+  auto AddChild = [&](unsigned short childType, const unsigned short *tokens, unsigned short nToken) {
+    conn.push_back(childType);
+    for (unsigned short i = 0; i < recordSize-1; i++)
+      conn.push_back((i < nToken)? global[tokens[i]] : 0);
+  };
+
+  switch (vtkType) {
+
+    case LINE: {
+      const unsigned short whole[] = {0,1}, first[] = {0,2}, second[] = {2,1};
+      if (split[0]) { AddChild(LINE, first, 2); AddChild(LINE, second, 2); }
+      else AddChild(LINE, whole, 2);
+      break;
+    }
+
+    case TRIANGLE: {
+      for (const auto& child : TriangleChildren(split)) AddChild(TRIANGLE, child.data(), 3);
+      break;
+    }
+
+    case QUADRILATERAL: {
+
+      /*--- Side faces of prisms, divided by their opposite (horizontal) split edges. ---*/
+
+      const unsigned short whole[] = {0,1,2,3};
+      const unsigned short first02[] = {0,4,6,3}, second02[] = {4,1,2,6};
+      const unsigned short first13[] = {0,1,5,7}, second13[] = {7,5,2,3};
+
+      if (!split[0] && !split[1] && !split[2] && !split[3]) AddChild(QUADRILATERAL, whole, 4);
+      else if (split[0] && split[2] && !split[1] && !split[3]) {
+        AddChild(QUADRILATERAL, first02, 4); AddChild(QUADRILATERAL, second02, 4);
+      }
+      else if (split[1] && split[3] && !split[0] && !split[2]) {
+        AddChild(QUADRILATERAL, first13, 4); AddChild(QUADRILATERAL, second13, 4);
+      }
+      else SU2_MPI::Error("Invalid division of a quadrilateral boundary element.", CURRENT_FUNCTION);
+      break;
+    }
+
+    case PRISM: {
+
+      /*--- The children of the bottom triangle, extruded to the matching children of the top triangle. ---*/
+
+      const unsigned short bottom[] = {0,1,2,6,7,8}, top[] = {3,4,5,9,10,11};
+      for (const auto& child : TriangleChildren(split)) {
+        const unsigned short tokens[] = {bottom[child[0]], bottom[child[1]], bottom[child[2]],
+                                         top[child[0]], top[child[1]], top[child[2]]};
+        AddChild(PRISM, tokens, 6);
+      }
+      break;
+    }
+
+    case TETRAHEDRON: {
+
+      auto Mid = [](unsigned short a, unsigned short b) {
+        for (unsigned short iEdge = 0; iEdge < 6; iEdge++)
+          if (((TetraEdges[iEdge][0] == a) && (TetraEdges[iEdge][1] == b)) ||
+              ((TetraEdges[iEdge][0] == b) && (TetraEdges[iEdge][1] == a))) return (unsigned short)(4+iEdge);
+        return (unsigned short)0;
+      };
+
+      /*--- The children replace vertices of the parent by midpoints, which keeps its orientation. ---*/
+
+      unsigned short nSplit = 0, splitEdge = 0, splitFace = 4;
+      for (unsigned short iEdge = 0; iEdge < 6; iEdge++)
+        if (split[iEdge]) { nSplit++; splitEdge = iEdge; }
+      for (unsigned short iFace = 0; iFace < 4; iFace++) {
+        const auto face = TetraFaceEdges[iFace];
+        if (split[face[0]] && split[face[1]] && split[face[2]]) splitFace = iFace;
+      }
+
+      if (nSplit == 0) {
+        const unsigned short whole[] = {0,1,2,3};
+        AddChild(TETRAHEDRON, whole, 4);
+      }
+      else if (nSplit == 1) {
+        const unsigned short a = TetraEdges[splitEdge][0], b = TetraEdges[splitEdge][1];
+        unsigned short first[] = {0,1,2,3}, second[] = {0,1,2,3};
+        first[b] = 4+splitEdge; second[a] = 4+splitEdge;
+        AddChild(TETRAHEDRON, first, 4); AddChild(TETRAHEDRON, second, 4);
+      }
+      else if (nSplit == 3) {
+
+        /*--- The face is divided in 4 triangles (corners and center), connected to the opposite vertex. ---*/
+
+        unsigned short faceNodes[3], nFaceNode = 0;
+        for (unsigned short iNode = 0; iNode < 4; iNode++) {
+          bool inFace = false;
+          for (unsigned short i = 0; i < 3; i++) {
+            const unsigned short iEdge = TetraFaceEdges[splitFace][i];
+            inFace |= (TetraEdges[iEdge][0] == iNode) || (TetraEdges[iEdge][1] == iNode);
+          }
+          if (inFace) faceNodes[nFaceNode++] = iNode;
+        }
+
+        for (unsigned short i = 0; i < 3; i++) {
+          const unsigned short v = faceNodes[i], u = faceNodes[(i+1)%3], w = faceNodes[(i+2)%3];
+          unsigned short corner[] = {0,1,2,3};
+          corner[u] = Mid(v,u); corner[w] = Mid(v,w);
+          AddChild(TETRAHEDRON, corner, 4);
+        }
+        unsigned short center[] = {0,1,2,3};
+        for (unsigned short i = 0; i < 3; i++)
+          center[faceNodes[i]] = Mid(faceNodes[i], faceNodes[(i+1)%3]);
+        AddChild(TETRAHEDRON, center, 4);
+      }
+      else {
+
+        /*--- Red: the 4 corners, and the inner octahedron divided along its shortest diagonal. ---*/
+
+        for (unsigned short v = 0; v < 4; v++) {
+          unsigned short corner[] = {0,1,2,3};
+          for (unsigned short u = 0; u < 4; u++) if (u != v) corner[u] = Mid(v,u);
+          AddChild(TETRAHEDRON, corner, 4);
+        }
+
+        const unsigned short diagonals[3][4] = {{0,1,2,3},{0,2,1,3},{0,3,1,2}};
+        unsigned short best = 0;
+        su2double minLength = 0.0;
+        for (unsigned short iDiag = 0; iDiag < 3; iDiag++) {
+          const auto d = diagonals[iDiag];
+          const unsigned short A = Mid(d[0],d[1]), B = Mid(d[2],d[3]);
+          su2double length = 0.0;
+          for (unsigned short iDim = 0; iDim < nDim; iDim++) length += pow(coord[A][iDim]-coord[B][iDim], 2);
+          if ((iDiag == 0) || (length < minLength)) { minLength = length; best = iDiag; }
+        }
+
+        const auto d = diagonals[best];
+        const unsigned short A = Mid(d[0],d[1]), B = Mid(d[2],d[3]);
+        const unsigned short equator[] = {Mid(d[0],d[2]), Mid(d[0],d[3]), Mid(d[1],d[3]), Mid(d[1],d[2])};
+
+        for (unsigned short i = 0; i < 4; i++) {
+          unsigned short tokens[] = {A, B, equator[i], equator[(i+1)%4]};
+
+          /*--- Orient the inner children like the parent (positive volume). ---*/
+
+          su2double r[3][3];
+          for (unsigned short j = 0; j < 3; j++)
+            for (unsigned short iDim = 0; iDim < 3; iDim++)
+              r[j][iDim] = coord[tokens[j+1]][iDim] - coord[tokens[0]][iDim];
+          const su2double volume = r[0][0]*(r[1][1]*r[2][2]-r[1][2]*r[2][1]) -
+                                   r[0][1]*(r[1][0]*r[2][2]-r[1][2]*r[2][0]) +
+                                   r[0][2]*(r[1][0]*r[2][1]-r[1][1]*r[2][0]);
+
+          su2double p[3][3];
+          for (unsigned short j = 0; j < 3; j++)
+            for (unsigned short iDim = 0; iDim < 3; iDim++)
+              p[j][iDim] = coord[j+1][iDim] - coord[0][iDim];
+          const su2double parent = p[0][0]*(p[1][1]*p[2][2]-p[1][2]*p[2][1]) -
+                                   p[0][1]*(p[1][0]*p[2][2]-p[1][2]*p[2][0]) +
+                                   p[0][2]*(p[1][0]*p[2][1]-p[1][1]*p[2][0]);
+
+          if (volume*parent < 0.0) swap(tokens[2], tokens[3]);
+          AddChild(TETRAHEDRON, tokens, 4);
+        }
+      }
+      break;
+    }
+  }
+
+}
+
+void CParallelGridAdaptation::SetRefinement(CGeometry *geometry, CConfig *config) {
+
+  unsigned long nodes[N_POINTS_HEXAHEDRON];
+
+  /*--- Volume elements. ---*/
+
+  ElemConn.clear();
+
+  for (unsigned long iElem = 0; iElem < geometry->GetnElem(); iElem++) {
+    const unsigned short nNodes = geometry->elem[iElem]->GetnNodes();
+    for (unsigned short iNode = 0; iNode < nNodes; iNode++) nodes[iNode] = geometry->elem[iElem]->GetNode(iNode);
+    if (IsOwned(geometry, nodes, nNodes))
+      SetDivision(geometry, geometry->elem[iElem]->GetVTK_Type(), nodes, SU2_BINARY_MESH_ELEM, ElemConn);
+  }
+
+  unsigned long nElem = ElemConn.size()/SU2_BINARY_MESH_ELEM;
+  SU2_MPI::Allreduce(&nElem, &nElemGlobal_New, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+
+  /*--- Boundary elements, by marker of the config file (the local markers differ among the ranks). ---*/
+
+  BoundConn.clear();
+  BoundConn.resize(config->GetnMarker_CfgFile());
+
+  for (unsigned short iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
+
+    if (config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) continue;
+
+    const unsigned short iMarker_CfgFile = config->GetMarker_CfgFile_TagBound(config->GetMarker_All_TagBound(iMarker));
+
+    for (unsigned long iElem = 0; iElem < geometry->GetnElem_Bound(iMarker); iElem++) {
+      CPrimalGrid *bound = geometry->bound[iMarker][iElem];
+      const unsigned short nNodes = bound->GetnNodes();
+      for (unsigned short iNode = 0; iNode < nNodes; iNode++) nodes[iNode] = bound->GetNode(iNode);
+      if (IsOwned(geometry, nodes, nNodes))
+        SetDivision(geometry, bound->GetVTK_Type(), nodes, SU2_BINARY_MESH_BOUND, BoundConn[iMarker_CfgFile]);
+    }
+  }
+
+}
+
+void CParallelGridAdaptation::GetMesh(CGeometry *geometry, CConfig *config, CAdaptedMesh& mesh) const {
+
+  mesh.nDim = nDim;
+  mesh.nPointGlobal = nPointGlobal_New;
+  mesh.nElemGlobal = nElemGlobal_New;
+
+  /*--- Points owned by this rank, the domain points and the midpoints of the owned split edges,
+   sent to the ranks of the linear partition of the adapted grid. ---*/
+
+  CLinearPartitioner pointPartitioner(nPointGlobal_New, 0);
+
+  vector<vector<unsigned long> > sendIndex(size), recvIndex;
+  vector<vector<passivedouble> > sendCoord(size), recvCoord;
+
+  auto SendPoint = [&](unsigned long iPoint_Global, const passivedouble *coord) {
+    const unsigned long iRank = pointPartitioner.GetRankContainingIndex(iPoint_Global);
+    sendIndex[iRank].push_back(iPoint_Global);
+    sendCoord[iRank].insert(sendCoord[iRank].end(), coord, coord+nDim);
+  };
+
+  passivedouble coord[3];
+
+  for (unsigned long iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      coord[iDim] = SU2_TYPE::GetValue(geometry->node[iPoint]->GetCoord(iDim));
+    SendPoint(geometry->node[iPoint]->GetGlobalIndex(), coord);
+  }
+
+  vector<bool> owned(geometry->GetnEdge(), true);
+  for (int iRank = 0; iRank < size; iRank++)
+    for (auto iEdge : EdgeSend[iRank]) owned[iEdge] = false;
+
+  for (unsigned long iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+    if (!owned[iEdge] || !Split[iEdge]) continue;
+    const unsigned long iPoint = geometry->edge[iEdge]->GetNode(0);
+    const unsigned long jPoint = geometry->edge[iEdge]->GetNode(1);
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      coord[iDim] = SU2_TYPE::GetValue(0.5*(geometry->node[iPoint]->GetCoord(iDim) +
+                                            geometry->node[jPoint]->GetCoord(iDim)));
+    SendPoint(MidPoint[iEdge], coord);
+  }
+
+  ExchangeBuffers(sendIndex, recvIndex);
+  ExchangeBuffers(sendCoord, recvCoord);
+
+  mesh.firstPoint = pointPartitioner.GetFirstIndexOnRank(rank);
+  const unsigned long nPointSlice = pointPartitioner.GetSizeOnRank(rank);
+
+  mesh.coords.assign(nPointSlice*nDim, 0.0);
+  unsigned long nReceived = 0;
+
+  for (int iRank = 0; iRank < size; iRank++) {
+    for (unsigned long iPoint = 0; iPoint < recvIndex[iRank].size(); iPoint++) {
+      copy(&recvCoord[iRank][iPoint*nDim], &recvCoord[iRank][iPoint*nDim]+nDim,
+           &mesh.coords[(recvIndex[iRank][iPoint]-mesh.firstPoint)*nDim]);
+    }
+    nReceived += recvIndex[iRank].size();
+  }
+
+  if (nReceived != nPointSlice) {
+    SU2_MPI::Error("The points of the adapted grid are not consistent among the ranks.", CURRENT_FUNCTION);
+  }
+
+  /*--- The elements stay on the rank that built them, after those of the lower ranks in the global list. ---*/
+
+  mesh.elems = ElemConn;
+
+  unsigned long nElem = ElemConn.size()/SU2_BINARY_MESH_ELEM;
+  vector<unsigned long> nElemRank(size, nElem);
+  SU2_MPI::Allgather(&nElem, 1, MPI_UNSIGNED_LONG, nElemRank.data(), 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+
+  mesh.firstElem = 0;
+  for (int iRank = 0; iRank < rank; iRank++) mesh.firstElem += nElemRank[iRank];
+
+  /*--- The boundary elements are gathered on the master, the empty markers are removed. ---*/
+
+  mesh.markerNames.clear();
+  mesh.markers.clear();
+
+  for (unsigned short iMarker = 0; iMarker < BoundConn.size(); iMarker++) {
+
+    unsigned long nElem_Bound = BoundConn[iMarker].size(), nElem_BoundGlobal = 0;
+    SU2_MPI::Allreduce(&nElem_Bound, &nElem_BoundGlobal, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+    if (nElem_BoundGlobal == 0) continue;
+
+    vector<vector<unsigned long> > sendBound(size), recvBound;
+    sendBound[MASTER_NODE] = BoundConn[iMarker];
+    ExchangeBuffers(sendBound, recvBound);
+
+    mesh.markerNames.push_back(config->GetMarker_CfgFile_TagBound(iMarker));
+    mesh.markers.emplace_back();
+
+    if (rank == MASTER_NODE) {
+      for (int iRank = 0; iRank < size; iRank++)
+        mesh.markers.back().insert(mesh.markers.back().end(), recvBound[iRank].begin(), recvBound[iRank].end());
+    }
+  }
+
+  /*--- Summary of the adaptation. ---*/
+
+  if (rank == MASTER_NODE) {
+    cout << endl << "Parallel adaptation of the grid (" << nClosureIter << " closure iterations):" << endl;
+
+    PrintingToolbox::CTablePrinter AdaptTable(&cout);
+    AdaptTable.AddColumn("Grid", 12);
+    AdaptTable.AddColumn("Points", 14);
+    AdaptTable.AddColumn("Elements", 14);
+    AdaptTable.SetAlign(PrintingToolbox::CTablePrinter::LEFT);
+    AdaptTable.PrintHeader();
+    AdaptTable << "Original" << nPointGlobal << nElemGlobal;
+    AdaptTable << "Adapted" << nPointGlobal_New << nElemGlobal_New;
+    AdaptTable.PrintFooter();
+  }
+
+}
+
+void CParallelGridAdaptation::WriteMesh(CGeometry *geometry, CConfig *config, string val_filename) const {
+
+  /*--- Replace the extension of the name by the one of the binary format. ---*/
+
+  for (const string ext : {".su2b", ".su2"}) {
+    if ((val_filename.size() > ext.size()) &&
+        (val_filename.compare(val_filename.size()-ext.size(), ext.size(), ext) == 0)) {
+      val_filename.erase(val_filename.size()-ext.size());
+      break;
+    }
+  }
+  val_filename += ".su2b";
+
+  CAdaptedMesh mesh;
+  GetMesh(geometry, config, mesh);
+
+  /*--- The master builds the marker block. ---*/
+
+  vector<char> markers;
+
+  if (rank == MASTER_NODE) {
+    for (unsigned short iMarker = 0; iMarker < mesh.markers.size(); iMarker++) {
+
+      char name[CGNS_STRING_SIZE] = {'\0'};
+      strncpy(name, mesh.markerNames[iMarker].c_str(), CGNS_STRING_SIZE-1);
+      const uint64_t nElem_Bound = mesh.markers[iMarker].size()/SU2_BINARY_MESH_BOUND;
+
+      const char* bytes = name;
+      markers.insert(markers.end(), bytes, bytes+CGNS_STRING_SIZE);
+      bytes = reinterpret_cast<const char*>(&nElem_Bound);
+      markers.insert(markers.end(), bytes, bytes+sizeof(uint64_t));
+
+      for (auto value : mesh.markers[iMarker]) {
+        const uint64_t record = value;
+        bytes = reinterpret_cast<const char*>(&record);
+        markers.insert(markers.end(), bytes, bytes+sizeof(uint64_t));
+      }
+    }
+  }
+
+  /*--- Header with the counts and the offsets of the blocks (see CSU2BinaryMeshReaderFVM). ---*/
+
+  const unsigned long pointSize = nDim*sizeof(passivedouble);
+  const unsigned long elemSize = SU2_BINARY_MESH_ELEM*sizeof(uint64_t);
+  const unsigned long nPointSlice = mesh.coords.size()/nDim;
+  const unsigned long nElem = mesh.elems.size()/SU2_BINARY_MESH_ELEM;
+
+  uint64_t header[SU2_BINARY_MESH_HEADER];
+  header[0] = SU2_BINARY_MESH_ID;
+  header[1] = nDim;
+  header[2] = mesh.nPointGlobal;
+  header[3] = mesh.nElemGlobal;
+  header[4] = mesh.markers.size();
+  header[5] = SU2_BINARY_MESH_HEADER*sizeof(uint64_t);
+  header[6] = header[5] + mesh.nPointGlobal*pointSize;
+  header[7] = header[6] + mesh.nElemGlobal*elemSize;
+
+  const vector<uint64_t> elems(mesh.elems.begin(), mesh.elems.end());
+
+#ifdef HAVE_MPI
+
+  /*--- The master writes the header and the markers, all ranks write their points and elements collectively. ---*/
+
+  MPI_File fhw;
+  if (MPI_File_open(MPI_COMM_WORLD, val_filename.c_str(), MPI_MODE_CREATE|MPI_MODE_WRONLY, MPI_INFO_NULL, &fhw)) {
+    SU2_MPI::Error(string("Unable to open file ") + val_filename, CURRENT_FUNCTION);
+  }
+  MPI_File_set_size(fhw, 0);
+
+  MPI_Datatype pointtype, elemtype;
+  MPI_Type_contiguous(pointSize, MPI_BYTE, &pointtype);
+  MPI_Type_contiguous(elemSize, MPI_BYTE, &elemtype);
+  MPI_Type_commit(&pointtype);
+  MPI_Type_commit(&elemtype);
+
+  if (rank == MASTER_NODE) {
+    MPI_File_write_at(fhw, 0, header, sizeof(header), MPI_BYTE, MPI_STATUS_IGNORE);
+    MPI_File_write_at(fhw, MPI_Offset(header[7]), markers.data(), markers.size(), MPI_BYTE, MPI_STATUS_IGNORE);
+  }
+
+  MPI_File_write_at_all(fhw, MPI_Offset(header[5] + mesh.firstPoint*pointSize), mesh.coords.data(), nPointSlice,
+                        pointtype, MPI_STATUS_IGNORE);
+  MPI_File_write_at_all(fhw, MPI_Offset(header[6] + mesh.firstElem*elemSize), elems.data(), nElem,
+                        elemtype, MPI_STATUS_IGNORE);
+
+  MPI_Type_free(&pointtype);
+  MPI_Type_free(&elemtype);
+  MPI_File_close(&fhw);
+
+#else
+
+  FILE *fhw = fopen(val_filename.c_str(), "wb");
+  if (!fhw) {
+    SU2_MPI::Error(string("Unable to open file ") + val_filename, CURRENT_FUNCTION);
+  }
+  fwrite(header, sizeof(uint64_t), SU2_BINARY_MESH_HEADER, fhw);
+  fwrite(mesh.coords.data(), sizeof(passivedouble), mesh.coords.size(), fhw);
+  fwrite(elems.data(), sizeof(uint64_t), elems.size(), fhw);
+  fwrite(markers.data(), sizeof(char), markers.size(), fhw);
+  fclose(fhw);
+
+#endif
+
+  if (rank == MASTER_NODE)
+    cout << "Adapted grid written to " << val_filename << " (MESH_FORMAT= SU2_BINARY)." << endl;
+
+}
@@ -28,11 +28,14 @@
 #include "../../include/geometry/CPhysicalGeometry.hpp"
 #include "../../include/adt_structure.hpp"
 #include "../../include/toolboxes/printing_toolbox.hpp"
+#include "../../include/toolboxes/compression_toolbox.hpp"
 #include "../../include/toolboxes/CLinearPartitioner.hpp"
 #include "../../include/geometry/meshreader/CSU2ASCIIMeshReaderFVM.hpp"
+#include "../../include/geometry/meshreader/CSU2BinaryMeshReaderFVM.hpp"
 #include "../../include/geometry/meshreader/CCGNSMeshReaderFVM.hpp"
 #include "../../include/geometry/meshreader/CRectangularMeshReaderFVM.hpp"
 #include "../../include/geometry/meshreader/CBoxMeshReaderFVM.hpp"
+#include "../../include/geometry/meshreader/CMemoryMeshReaderFVM.hpp"
 
 #include "../../include/geometry/primal_grid/CPrimalGrid.hpp"
 #include "../../include/geometry/primal_grid/CLine.hpp"
@@ -47,6 +50,7 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <iterator>
+#include <cstdint>
 #ifdef _MSC_VER
 #include <direct.h>
 #endif
@@ -125,6 +129,7 @@ CPhysicalGeometry::CPhysicalGeometry(CConfig *config, unsigned short val_iZone,
 #endif
 
   edgeColorGroupSize = config->GetEdgeColoringGroupSize();
+  edgeColorAutoTune = config->GetEdgeColoringAutoTune();
 
   /*--- Arrays for defining the turbomachinery structure ---*/
 
@@ -194,7 +199,7 @@ CPhysicalGeometry::CPhysicalGeometry(CConfig *config, unsigned short val_iZone,
   else {
 
     switch (val_format) {
-      case SU2: case CGNS_GRID: case RECTANGLE: case BOX:
+      case SU2: case SU2_BINARY: case CGNS_GRID: case RECTANGLE: case BOX:
         Read_Mesh_FVM(config, val_mesh_filename, val_iZone, val_nZone);
         break;
       default:
@@ -287,6 +292,93 @@ CPhysicalGeometry::CPhysicalGeometry(CConfig *config, unsigned short val_iZone,
 CPhysicalGeometry::CPhysicalGeometry(CGeometry *geometry,
                                      CConfig *config) {
 
+  InitializeDistributionData(config);
+
+  /*--- The new geometry class has the same problem dimension/zone. ---*/
+
+  nDim  = geometry->GetnDim();
+  nZone = geometry->GetnZone();
+
+  /*--- Recompute the linear partitioning offsets. ---*/
+
+  PrepareOffsets(geometry->GetGlobal_nPoint());
+
+  /*--- Communicate the coloring data so that each rank has a complete set
+   of colors for all points that reside on it, including repeats. ---*/
+
+  if ((rank == MASTER_NODE) && (size != SINGLE_NODE))
+    cout <<"Distributing ParMETIS coloring." << endl;
+
+  DistributeColoring(config, geometry);
+
+  /*--- Redistribute the points to all ranks based on the coloring. ---*/
+
+  if ((rank == MASTER_NODE) && (size != SINGLE_NODE))
+    cout <<"Rebalancing vertices." << endl;
+
+  DistributePoints(config, geometry);
+
+  /*--- Distribute the element information to all ranks based on coloring. ---*/
+
+  if ((rank == MASTER_NODE) && (size != SINGLE_NODE))
+    cout <<"Rebalancing volume element connectivity." << endl;
+
+  DistributeVolumeConnectivity(config, geometry, TRIANGLE     );
+  DistributeVolumeConnectivity(config, geometry, QUADRILATERAL);
+  DistributeVolumeConnectivity(config, geometry, TETRAHEDRON  );
+  DistributeVolumeConnectivity(config, geometry, HEXAHEDRON   );
+  DistributeVolumeConnectivity(config, geometry, PRISM        );
+  DistributeVolumeConnectivity(config, geometry, PYRAMID      );
+
+  /*--- Distribute the marker information to all ranks based on coloring. ---*/
+
+  if ((rank == MASTER_NODE) && (size != SINGLE_NODE))
+    cout <<"Rebalancing markers and surface elements." << endl;
+
+  /*--- First, perform a linear partitioning of the marker information, as
+   the grid readers currently store all boundary information on the master
+   rank. In the future, this process can be moved directly into the grid
+   reader to avoid reading the markers to the master rank alone at first. ---*/
+
+  DistributeMarkerTags(config, geometry);
+  PartitionSurfaceConnectivity(config, geometry, LINE         );
+  PartitionSurfaceConnectivity(config, geometry, TRIANGLE     );
+  PartitionSurfaceConnectivity(config, geometry, QUADRILATERAL);
+
+  /*--- Once the markers are distributed according to the linear partitioning
+   of the grid points, we can use similar techniques as above for distributing
+   the surface element connectivity. ---*/
+
+  DistributeSurfaceConnectivity(config, geometry, LINE         );
+  DistributeSurfaceConnectivity(config, geometry, TRIANGLE     );
+  DistributeSurfaceConnectivity(config, geometry, QUADRILATERAL);
+
+  /*--- Keep the distributed grid for the next runs on the same number of ranks. ---*/
+
+  if (config->GetPartition_Cache()) {
+    if (rank == MASTER_NODE) cout << "Writing the partition cache files." << endl;
+    WritePartitionCache(config, geometry, GetPartitionCacheName(config));
+  }
+
+  LoadDistributedGrid(config, geometry);
+
+}
+
+CPhysicalGeometry::CPhysicalGeometry(CConfig *config, const string& val_filename) {
+
+  InitializeDistributionData(config);
+
+  /*--- Read the points, elements, and markers that were distributed to this
+   rank in a previous run, they are loaded as if they had just been distributed. ---*/
+
+  ReadPartitionCache(config, val_filename);
+
+  LoadDistributedGrid(config, this);
+
+}
+
+void CPhysicalGeometry::InitializeDistributionData(CConfig *config) {
+
   /*--- Get rank and size. ---*/
 
   size = SU2_MPI::GetSize();
@@ -314,6 +406,7 @@ CPhysicalGeometry::CPhysicalGeometry(CGeometry *geometry,
 #endif
 
   edgeColorGroupSize = config->GetEdgeColoringGroupSize();
+  edgeColorAutoTune = config->GetEdgeColoringAutoTune();
 
   /*--- Arrays for defining the turbomachinery structure ---*/
 
@@ -347,6 +440,9 @@ CPhysicalGeometry::CPhysicalGeometry(CGeometry *geometry,
   nLocal_PointGhost    = 0;
   nLocal_PointPeriodic = 0;
   nLocal_Line          = 0;
+  nLinear_Line         = 0;
+  nLinear_BoundTria    = 0;
+  nLinear_BoundQuad    = 0;
   nLocal_BoundTria     = 0;
   nLocal_BoundQuad     = 0;
   nLocal_Tria          = 0;
@@ -400,64 +496,9 @@ CPhysicalGeometry::CPhysicalGeometry(CGeometry *geometry,
   Elem_ID_BoundTria_Linear = NULL;
   Elem_ID_BoundQuad_Linear = NULL;
 
-  /*--- The new geometry class has the same problem dimension/zone. ---*/
-
-  nDim  = geometry->GetnDim();
-  nZone = geometry->GetnZone();
-
-  /*--- Recompute the linear partitioning offsets. ---*/
-
-  PrepareOffsets(geometry->GetGlobal_nPoint());
-
-  /*--- Communicate the coloring data so that each rank has a complete set
-   of colors for all points that reside on it, including repeats. ---*/
-
-  if ((rank == MASTER_NODE) && (size != SINGLE_NODE))
-    cout <<"Distributing ParMETIS coloring." << endl;
-
-  DistributeColoring(config, geometry);
-
-  /*--- Redistribute the points to all ranks based on the coloring. ---*/
-
-  if ((rank == MASTER_NODE) && (size != SINGLE_NODE))
-    cout <<"Rebalancing vertices." << endl;
-
-  DistributePoints(config, geometry);
-
-  /*--- Distribute the element information to all ranks based on coloring. ---*/
-
-  if ((rank == MASTER_NODE) && (size != SINGLE_NODE))
-    cout <<"Rebalancing volume element connectivity." << endl;
-
-  DistributeVolumeConnectivity(config, geometry, TRIANGLE     );
-  DistributeVolumeConnectivity(config, geometry, QUADRILATERAL);
-  DistributeVolumeConnectivity(config, geometry, TETRAHEDRON  );
-  DistributeVolumeConnectivity(config, geometry, HEXAHEDRON   );
-  DistributeVolumeConnectivity(config, geometry, PRISM        );
-  DistributeVolumeConnectivity(config, geometry, PYRAMID      );
-
-  /*--- Distribute the marker information to all ranks based on coloring. ---*/
-
-  if ((rank == MASTER_NODE) && (size != SINGLE_NODE))
-    cout <<"Rebalancing markers and surface elements." << endl;
-
-  /*--- First, perform a linear partitioning of the marker information, as
-   the grid readers currently store all boundary information on the master
-   rank. In the future, this process can be moved directly into the grid
-   reader to avoid reading the markers to the master rank alone at first. ---*/
-
-  DistributeMarkerTags(config, geometry);
-  PartitionSurfaceConnectivity(config, geometry, LINE         );
-  PartitionSurfaceConnectivity(config, geometry, TRIANGLE     );
-  PartitionSurfaceConnectivity(config, geometry, QUADRILATERAL);
-
-  /*--- Once the markers are distributed according to the linear partitioning
-   of the grid points, we can use similar techniques as above for distributing
-   the surface element connectivity. ---*/
+}
 
-  DistributeSurfaceConnectivity(config, geometry, LINE         );
-  DistributeSurfaceConnectivity(config, geometry, TRIANGLE     );
-  DistributeSurfaceConnectivity(config, geometry, QUADRILATERAL);
+void CPhysicalGeometry::LoadDistributedGrid(CConfig *config, CGeometry *geometry) {
 
   /*--- Reduce the total number of elements that we have on each rank. ---*/
 
@@ -531,6 +572,274 @@ CPhysicalGeometry::CPhysicalGeometry(CGeometry *geometry,
 
 }
 
+namespace {
+/*--- Layout of the header of the partition cache files, the counts are those of the rank. ---*/
+enum PARTITION_CACHE_HEADER {
+  CACHE_ID, CACHE_SIZE, CACHE_RANK, CACHE_NDIM, CACHE_NZONE, CACHE_MESH_BYTES,
+  CACHE_GLOBAL_NPOINT, CACHE_GLOBAL_NPOINTDOMAIN, CACHE_GLOBAL_NELEMDOMAIN,
+  CACHE_NPOINT, CACHE_NPOINTDOMAIN, CACHE_NPOINTPERIODIC, CACHE_NPOINTGHOST,
+  CACHE_NTRIA, CACHE_NQUAD, CACHE_NTETR, CACHE_NHEXA, CACHE_NPRIS, CACHE_NPYRA,
+  CACHE_NLINE, CACHE_NBOUNDTRIA, CACHE_NBOUNDQUAD, CACHE_NMARKER, CACHE_HEADER_SIZE
+};
+
+const unsigned long PARTITION_CACHE_ID = 535534; /*!< \brief Identifier of the partition cache files. */
+
+/*--- Size of the mesh file, a cheap check that the cache was built from the same grid. ---*/
+unsigned long MeshFileBytes(const string& filename) {
+  ifstream mesh_file(filename.c_str(), ios::in | ios::binary | ios::ate);
+  if (!mesh_file.is_open()) return 0;
+  return static_cast<unsigned long>(mesh_file.tellg());
+}
+}
+
+string CPhysicalGeometry::GetPartitionCacheName(CConfig *config) {
+
+  const string ext = "_" + to_string(SU2_MPI::GetRank()) + ".dat";
+
+  return config->GetMultizone_FileName(config->GetPartition_Cache_FileName(), config->GetiZone(), ext);
+}
+
+bool CPhysicalGeometry::CheckPartitionCache(CConfig *config, const string& val_filename) {
+
+  /*--- The cache of every rank must exist and match the run, otherwise the grid is partitioned again. ---*/
+
+  int valid = 0, allValid = 0;
+
+  FILE *fhr = fopen(val_filename.c_str(), "rb");
+
+  if (fhr != NULL) {
+    unsigned long header[CACHE_HEADER_SIZE] = {0};
+    char mesh_name[MAX_STRING_SIZE] = {0};
+
+    if ((fread(header, sizeof(unsigned long), CACHE_HEADER_SIZE, fhr) == CACHE_HEADER_SIZE) &&
+        (fread(mesh_name, sizeof(char), MAX_STRING_SIZE, fhr) == MAX_STRING_SIZE)) {
+      mesh_name[MAX_STRING_SIZE-1] = '\0';
+      valid = (header[CACHE_ID] == PARTITION_CACHE_ID) &&
+              (header[CACHE_SIZE] == static_cast<unsigned long>(SU2_MPI::GetSize())) &&
+              (header[CACHE_RANK] == static_cast<unsigned long>(SU2_MPI::GetRank())) &&
+              (header[CACHE_MESH_BYTES] == MeshFileBytes(config->GetMesh_FileName())) &&
+              (config->GetMesh_FileName() == string(mesh_name));
+    }
+    fclose(fhr);
+  }
+
+  SU2_MPI::Allreduce(&valid, &allValid, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+
+  return (allValid == 1);
+}
+
+void CPhysicalGeometry::WritePartitionCache(CConfig *config, CGeometry *geometry, const string& val_filename) const {
+
+  unsigned long header[CACHE_HEADER_SIZE] = {0};
+
+  header[CACHE_ID]   = PARTITION_CACHE_ID;
+  header[CACHE_SIZE] = size;
+  header[CACHE_RANK] = rank;
+  header[CACHE_NDIM] = nDim;
+  header[CACHE_NZONE] = nZone;
+  header[CACHE_MESH_BYTES] = MeshFileBytes(config->GetMesh_FileName());
+
+  /*--- Global sizes of the linearly partitioned grid (used when loading the points and elements). ---*/
+
+  header[CACHE_GLOBAL_NPOINT]       = geometry->GetGlobal_nPoint();
+  header[CACHE_GLOBAL_NPOINTDOMAIN] = geometry->GetGlobal_nPointDomain();
+  header[CACHE_GLOBAL_NELEMDOMAIN]  = geometry->GetGlobal_nElemDomain();
+
+  header[CACHE_NPOINT]         = nLocal_Point;
+  header[CACHE_NPOINTDOMAIN]   = nLocal_PointDomain;
+  header[CACHE_NPOINTPERIODIC] = nLocal_PointPeriodic;
+  header[CACHE_NPOINTGHOST]    = nLocal_PointGhost;
+
+  header[CACHE_NTRIA] = nLocal_Tria;
+  header[CACHE_NQUAD] = nLocal_Quad;
+  header[CACHE_NTETR] = nLocal_Tetr;
+  header[CACHE_NHEXA] = nLocal_Hexa;
+  header[CACHE_NPRIS] = nLocal_Pris;
+  header[CACHE_NPYRA] = nLocal_Pyra;
+
+  header[CACHE_NLINE]      = nLocal_Line;
+  header[CACHE_NBOUNDTRIA] = nLocal_BoundTria;
+  header[CACHE_NBOUNDQUAD] = nLocal_BoundQuad;
+  header[CACHE_NMARKER]    = nMarker_Global;
+
+  char mesh_name[MAX_STRING_SIZE] = {0};
+  SPRINTF(mesh_name, "%s", config->GetMesh_FileName().substr(0, MAX_STRING_SIZE-1).c_str());
+
+  FILE *fhw = fopen(val_filename.c_str(), "wb");
+
+  if (fhw == NULL) {
+    SU2_MPI::Error(string("Unable to write the partition cache file ") + val_filename, CURRENT_FUNCTION);
+  }
+
+  auto WriteArray = [fhw](const void* data, size_t bytes, unsigned long count) {
+    if (count > 0) fwrite(data, bytes, count, fhw);
+  };
+
+  WriteArray(header, sizeof(unsigned long), CACHE_HEADER_SIZE);
+  WriteArray(mesh_name, sizeof(char), MAX_STRING_SIZE);
+
+  /*--- Points, the coordinates are stored as passive doubles. ---*/
+
+  vector<passivedouble> coords(nLocal_Point*nDim);
+  for (unsigned long iCoord = 0; iCoord < coords.size(); iCoord++)
+    coords[iCoord] = SU2_TYPE::GetValue(Local_Coords[iCoord]);
+
+  WriteArray(Local_Points, sizeof(unsigned long), nLocal_Point);
+  WriteArray(Local_Colors, sizeof(unsigned long), nLocal_Point);
+  WriteArray(coords.data(), sizeof(passivedouble), coords.size());
+
+  /*--- Volume elements, connectivity and global IDs. ---*/
+
+  WriteArray(Conn_Tria, sizeof(unsigned long), nLocal_Tria*N_POINTS_TRIANGLE);
+  WriteArray(ID_Tria,   sizeof(unsigned long), nLocal_Tria);
+  WriteArray(Conn_Quad, sizeof(unsigned long), nLocal_Quad*N_POINTS_QUADRILATERAL);
+  WriteArray(ID_Quad,   sizeof(unsigned long), nLocal_Quad);
+  WriteArray(Conn_Tetr, sizeof(unsigned long), nLocal_Tetr*N_POINTS_TETRAHEDRON);
+  WriteArray(ID_Tetr,   sizeof(unsigned long), nLocal_Tetr);
+  WriteArray(Conn_Hexa, sizeof(unsigned long), nLocal_Hexa*N_POINTS_HEXAHEDRON);
+  WriteArray(ID_Hexa,   sizeof(unsigned long), nLocal_Hexa);
+  WriteArray(Conn_Pris, sizeof(unsigned long), nLocal_Pris*N_POINTS_PRISM);
+  WriteArray(ID_Pris,   sizeof(unsigned long), nLocal_Pris);
+  WriteArray(Conn_Pyra, sizeof(unsigned long), nLocal_Pyra*N_POINTS_PYRAMID);
+  WriteArray(ID_Pyra,   sizeof(unsigned long), nLocal_Pyra);
+
+  /*--- Surface elements, connectivity, global marker and global element IDs. ---*/
+
+  WriteArray(Conn_Line,         sizeof(unsigned long), nLocal_Line*N_POINTS_LINE);
+  WriteArray(ID_Line,           sizeof(unsigned long), nLocal_Line);
+  WriteArray(Elem_ID_Line,      sizeof(unsigned long), nLocal_Line);
+  WriteArray(Conn_BoundTria,    sizeof(unsigned long), nLocal_BoundTria*N_POINTS_TRIANGLE);
+  WriteArray(ID_BoundTria,      sizeof(unsigned long), nLocal_BoundTria);
+  WriteArray(Elem_ID_BoundTria, sizeof(unsigned long), nLocal_BoundTria);
+  WriteArray(Conn_BoundQuad,    sizeof(unsigned long), nLocal_BoundQuad*N_POINTS_QUADRILATERAL);
+  WriteArray(ID_BoundQuad,      sizeof(unsigned long), nLocal_BoundQuad);
+  WriteArray(Elem_ID_BoundQuad, sizeof(unsigned long), nLocal_BoundQuad);
+
+  /*--- Tags of all the markers (in global ordering). ---*/
+
+  vector<char> tags(nMarker_Global*MAX_STRING_SIZE, '\0');
+  for (unsigned long iMarker = 0; iMarker < nMarker_Global; iMarker++)
+    SPRINTF(&tags[iMarker*MAX_STRING_SIZE], "%s", Marker_Tags[iMarker].substr(0, MAX_STRING_SIZE-1).c_str());
+
+  WriteArray(tags.data(), sizeof(char), tags.size());
+
+  fclose(fhw);
+
+}
+
+void CPhysicalGeometry::ReadPartitionCache(CConfig *config, const string& val_filename) {
+
+  FILE *fhr = fopen(val_filename.c_str(), "rb");
+
+  if (fhr == NULL) {
+    SU2_MPI::Error(string("Unable to open the partition cache file ") + val_filename, CURRENT_FUNCTION);
+  }
+
+  auto ReadArray = [fhr, &val_filename](void* data, size_t bytes, unsigned long count) {
+    if ((count > 0) && (fread(data, bytes, count, fhr) != count)) {
+      SU2_MPI::Error(string("Unexpected end of the partition cache file ") + val_filename, CURRENT_FUNCTION);
+    }
+  };
+
+  /*--- Allocate (if not empty) and read an array of global indices. ---*/
+
+  auto ReadIndices = [&ReadArray](unsigned long*& data, unsigned long count) {
+    if (count == 0) return;
+    data = new unsigned long[count];
+    ReadArray(data, sizeof(unsigned long), count);
+  };
+
+  unsigned long header[CACHE_HEADER_SIZE] = {0};
+  char mesh_name[MAX_STRING_SIZE] = {0};
+
+  ReadArray(header, sizeof(unsigned long), CACHE_HEADER_SIZE);
+  ReadArray(mesh_name, sizeof(char), MAX_STRING_SIZE);
+
+  nDim  = header[CACHE_NDIM];
+  nZone = header[CACHE_NZONE];
+
+  /*--- The linear partitioning and global sizes are those of the run that wrote the cache. ---*/
+
+  PrepareOffsets(header[CACHE_GLOBAL_NPOINT]);
+
+  Global_nPointDomain = header[CACHE_GLOBAL_NPOINTDOMAIN];
+  Global_nElemDomain  = header[CACHE_GLOBAL_NELEMDOMAIN];
+
+  nLocal_Point         = header[CACHE_NPOINT];
+  nLocal_PointDomain   = header[CACHE_NPOINTDOMAIN];
+  nLocal_PointPeriodic = header[CACHE_NPOINTPERIODIC];
+  nLocal_PointGhost    = header[CACHE_NPOINTGHOST];
+
+  nLocal_Tria = header[CACHE_NTRIA];
+  nLocal_Quad = header[CACHE_NQUAD];
+  nLocal_Tetr = header[CACHE_NTETR];
+  nLocal_Hexa = header[CACHE_NHEXA];
+  nLocal_Pris = header[CACHE_NPRIS];
+  nLocal_Pyra = header[CACHE_NPYRA];
+
+  nLocal_Line      = header[CACHE_NLINE];
+  nLocal_BoundTria = header[CACHE_NBOUNDTRIA];
+  nLocal_BoundQuad = header[CACHE_NBOUNDQUAD];
+  nMarker_Global   = header[CACHE_NMARKER];
+
+  /*--- Points. ---*/
+
+  Local_Points = new unsigned long[nLocal_Point];
+  Local_Colors = new unsigned long[nLocal_Point];
+  Local_Coords = new su2double[nDim*nLocal_Point];
+
+  vector<passivedouble> coords(nLocal_Point*nDim);
+
+  ReadArray(Local_Points, sizeof(unsigned long), nLocal_Point);
+  ReadArray(Local_Colors, sizeof(unsigned long), nLocal_Point);
+  ReadArray(coords.data(), sizeof(passivedouble), coords.size());
+
+  for (unsigned long iCoord = 0; iCoord < coords.size(); iCoord++)
+    Local_Coords[iCoord] = coords[iCoord];
+
+  /*--- Volume elements. ---*/
+
+  ReadIndices(Conn_Tria, nLocal_Tria*N_POINTS_TRIANGLE);
+  ReadIndices(ID_Tria,   nLocal_Tria);
+  ReadIndices(Conn_Quad, nLocal_Quad*N_POINTS_QUADRILATERAL);
+  ReadIndices(ID_Quad,   nLocal_Quad);
+  ReadIndices(Conn_Tetr, nLocal_Tetr*N_POINTS_TETRAHEDRON);
+  ReadIndices(ID_Tetr,   nLocal_Tetr);
+  ReadIndices(Conn_Hexa, nLocal_Hexa*N_POINTS_HEXAHEDRON);
+  ReadIndices(ID_Hexa,   nLocal_Hexa);
+  ReadIndices(Conn_Pris, nLocal_Pris*N_POINTS_PRISM);
+  ReadIndices(ID_Pris,   nLocal_Pris);
+  ReadIndices(Conn_Pyra, nLocal_Pyra*N_POINTS_PYRAMID);
+  ReadIndices(ID_Pyra,   nLocal_Pyra);
+
+  /*--- Surface elements. ---*/
+
+  ReadIndices(Conn_Line,         nLocal_Line*N_POINTS_LINE);
+  ReadIndices(ID_Line,           nLocal_Line);
+  ReadIndices(Elem_ID_Line,      nLocal_Line);
+  ReadIndices(Conn_BoundTria,    nLocal_BoundTria*N_POINTS_TRIANGLE);
+  ReadIndices(ID_BoundTria,      nLocal_BoundTria);
+  ReadIndices(Elem_ID_BoundTria, nLocal_BoundTria);
+  ReadIndices(Conn_BoundQuad,    nLocal_BoundQuad*N_POINTS_QUADRILATERAL);
+  ReadIndices(ID_BoundQuad,      nLocal_BoundQuad);
+  ReadIndices(Elem_ID_BoundQuad, nLocal_BoundQuad);
+
+  /*--- Marker tags, set in the config as done when they are distributed. ---*/
+
+  vector<char> tags(nMarker_Global*MAX_STRING_SIZE, '\0');
+  ReadArray(tags.data(), sizeof(char), tags.size());
+
+  for (unsigned long iMarker = 0; iMarker < nMarker_Global; iMarker++) {
+    tags[(iMarker+1)*MAX_STRING_SIZE-1] = '\0';
+    Marker_Tags.push_back(string(&tags[iMarker*MAX_STRING_SIZE]));
+    config->SetMarker_All_TagBound(iMarker, Marker_Tags[iMarker]);
+    config->SetMarker_All_SendRecv(iMarker, NO);
+  }
+
+  fclose(fhr);
+
+}
+
 CPhysicalGeometry::~CPhysicalGeometry(void) {
 
   if (Local_to_Global_Point  != NULL) delete [] Local_to_Global_Point;
@@ -3966,22 +4275,32 @@ void CPhysicalGeometry::Read_Mesh_FVM(CConfig        *config,
   unsigned short val_format = config->GetMesh_FileFormat();
 
   CMeshReaderFVM *MeshFVM = NULL;
-  switch (val_format) {
-    case SU2:
-      MeshFVM = new CSU2ASCIIMeshReaderFVM(config, val_iZone, val_nZone);
-      break;
-    case CGNS_GRID:
-      MeshFVM = new CCGNSMeshReaderFVM(config, val_iZone, val_nZone);
-      break;
-    case RECTANGLE:
-      MeshFVM = new CRectangularMeshReaderFVM(config, val_iZone, val_nZone);
-      break;
-    case BOX:
-      MeshFVM = new CBoxMeshReaderFVM(config, val_iZone, val_nZone);
-      break;
-    default:
-      SU2_MPI::Error("Unrecognized mesh format specified!", CURRENT_FUNCTION);
-      break;
+
+  /*--- A grid held in memory (in-process adaptation) is read whatever the format. ---*/
+  if (CMemoryMeshReaderFVM::HasMesh()) {
+    MeshFVM = new CMemoryMeshReaderFVM(config, val_iZone, val_nZone);
+  }
+  else {
+    switch (val_format) {
+      case SU2:
+        MeshFVM = new CSU2ASCIIMeshReaderFVM(config, val_iZone, val_nZone);
+        break;
+      case SU2_BINARY:
+        MeshFVM = new CSU2BinaryMeshReaderFVM(config, val_iZone, val_nZone);
+        break;
+      case CGNS_GRID:
+        MeshFVM = new CCGNSMeshReaderFVM(config, val_iZone, val_nZone);
+        break;
+      case RECTANGLE:
+        MeshFVM = new CRectangularMeshReaderFVM(config, val_iZone, val_nZone);
+        break;
+      case BOX:
+        MeshFVM = new CBoxMeshReaderFVM(config, val_iZone, val_nZone);
+        break;
+      default:
+        SU2_MPI::Error("Unrecognized mesh format specified!", CURRENT_FUNCTION);
+        break;
+    }
   }
 
   /*--- Store the dimension of the problem ---*/
@@ -4043,6 +4362,10 @@ void CPhysicalGeometry::LoadLinearlyPartitionedPoints(CConfig        *config,
   const vector<vector<passivedouble> > &gridCoords =
   mesh->GetLocalPointCoordinates();
 
+  /*--- The work of the points, if the mesh object knows it, weights the partitioning. ---*/
+
+  PointWeights = mesh->GetLocalPointWeights();
+
   /*--- Initialize point counts and the grid node data structure. ---*/
 
   nPointNode = nPoint;
@@ -4642,16 +4965,18 @@ void CPhysicalGeometry::PrepareAdjacency(CConfig *config) {
 
 void CPhysicalGeometry::Check_IntElem_Orientation(CConfig *config) {
 
-  unsigned long Point_1, Point_2, Point_3, Point_4, Point_5, Point_6,
-  iElem, triangle_flip = 0, quad_flip = 0, tet_flip = 0, prism_flip = 0,
+  unsigned long triangle_flip = 0, quad_flip = 0, tet_flip = 0, prism_flip = 0,
   hexa_flip = 0, pyram_flip = 0;
-  su2double test_1, test_2, test_3, test_4, *Coord_1, *Coord_2, *Coord_3, *Coord_4,
-  *Coord_5, *Coord_6, a[3] = {0.0,0.0,0.0}, b[3] = {0.0,0.0,0.0}, c[3] = {0.0,0.0,0.0}, n[3] = {0.0,0.0,0.0}, test;
-  unsigned short iDim;
 
-  /*--- Loop over all the elements ---*/
+  /*--- Loop over all the elements, they are independent (threaded loop). ---*/
 
-  for (iElem = 0; iElem < nElem; iElem++) {
+  SU2_OMP_PARALLEL_(for schedule(dynamic,512) reduction(+:triangle_flip,quad_flip,tet_flip,prism_flip,hexa_flip,pyram_flip))
+  for (unsigned long iElem = 0; iElem < nElem; iElem++) {
+
+    unsigned long Point_1, Point_2, Point_3, Point_4, Point_5, Point_6;
+    su2double test_1, test_2, test_3, test_4, *Coord_1, *Coord_2, *Coord_3, *Coord_4,
+    *Coord_5, *Coord_6, a[3] = {0.0,0.0,0.0}, b[3] = {0.0,0.0,0.0}, c[3] = {0.0,0.0,0.0}, n[3] = {0.0,0.0,0.0}, test;
+    unsigned short iDim;
 
     /*--- 2D grid, triangle case ---*/
 
@@ -4891,21 +5216,13 @@ void CPhysicalGeometry::Check_IntElem_Orientation(CConfig *config) {
 
   }
 
-#ifdef HAVE_MPI
-  unsigned long Mytriangle_flip  = triangle_flip;
-  unsigned long Myquad_flip      = quad_flip;
-  unsigned long Mytet_flip       = tet_flip;
-  unsigned long Myprism_flip     = prism_flip;
-  unsigned long Myhexa_flip      = hexa_flip;
-  unsigned long Mypyram_flip     = pyram_flip;
-
-  SU2_MPI::Allreduce(&Mytriangle_flip, &triangle_flip, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&Myquad_flip, &quad_flip, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&Mytet_flip, &tet_flip, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&Myprism_flip, &prism_flip, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&Myhexa_flip, &hexa_flip, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&Mypyram_flip, &pyram_flip, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
-#endif
+  /*--- One reduction for all the counters. ---*/
+
+  unsigned long Myflip[6] = {triangle_flip, quad_flip, tet_flip, prism_flip, hexa_flip, pyram_flip}, flip[6];
+  SU2_MPI::Allreduce(Myflip, flip, 6, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+
+  triangle_flip = flip[0]; quad_flip = flip[1]; tet_flip = flip[2];
+  prism_flip = flip[3]; hexa_flip = flip[4]; pyram_flip = flip[5];
 
   if (rank == MASTER_NODE) {
     if (triangle_flip > 0) cout << "There has been a re-orientation of the TRIANGLE volume elements." << endl;
@@ -4920,19 +5237,25 @@ void CPhysicalGeometry::Check_IntElem_Orientation(CConfig *config) {
 
 void CPhysicalGeometry::Check_BoundElem_Orientation(CConfig *config) {
 
-  unsigned long Point_1_Surface, Point_2_Surface, Point_3_Surface, Point_4_Surface,
-  iElem_Domain, Point_Domain = 0, Point_Surface, iElem_Surface,
-  line_flip = 0, triangle_flip = 0, quad_flip = 0;
-  su2double test_1, test_2, test_3, test_4, *Coord_1, *Coord_2, *Coord_3, *Coord_4,
-  *Coord_5, a[3] = {0.0,0.0,0.0}, b[3] = {0.0,0.0,0.0}, c[3] = {0.0,0.0,0.0}, n[3] = {0.0,0.0,0.0}, test;
-  unsigned short iDim, iMarker, iNode_Domain, iNode_Surface;
-  bool find;
+  unsigned long line_flip = 0, triangle_flip = 0, quad_flip = 0;
 
-  for (iMarker = 0; iMarker < nMarker; iMarker++) {
+  /*--- The boundary elements are independent (threaded loop), the flip flag of
+   *    the nodes is only ever set to true, so concurrent writes are harmless. ---*/
+
+  SU2_OMP_PARALLEL
+  for (unsigned short iMarker = 0; iMarker < nMarker; iMarker++) {
 
     if (config->GetMarker_All_KindBC(iMarker) != INTERNAL_BOUNDARY) {
 
-      for (iElem_Surface = 0; iElem_Surface < nElem_Bound[iMarker]; iElem_Surface++) {
+      SU2_OMP(for schedule(dynamic,256) reduction(+:line_flip,triangle_flip,quad_flip))
+      for (unsigned long iElem_Surface = 0; iElem_Surface < nElem_Bound[iMarker]; iElem_Surface++) {
+
+        unsigned long Point_1_Surface, Point_2_Surface, Point_3_Surface, Point_4_Surface,
+        iElem_Domain, Point_Domain = 0, Point_Surface;
+        su2double test_1, test_2, test_3, test_4, *Coord_1, *Coord_2, *Coord_3, *Coord_4,
+        *Coord_5, a[3] = {0.0,0.0,0.0}, b[3] = {0.0,0.0,0.0}, c[3] = {0.0,0.0,0.0}, n[3] = {0.0,0.0,0.0}, test;
+        unsigned short iDim, iNode_Domain, iNode_Surface;
+        bool find;
 
         iElem_Domain = bound[iMarker][iElem_Surface]->GetDomainElement();
         for (iNode_Domain = 0; iNode_Domain < elem[iElem_Domain]->GetnNodes(); iNode_Domain++) {
@@ -5061,14 +5384,9 @@ void CPhysicalGeometry::Check_BoundElem_Orientation(CConfig *config) {
     }
   }
 
-#ifdef HAVE_MPI
-  unsigned long Myline_flip   = line_flip;
-  unsigned long Mytriangle_flip  = triangle_flip;
-  unsigned long Myquad_flip   = quad_flip;
-  SU2_MPI::Allreduce(&Myline_flip, &line_flip, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&Mytriangle_flip, &triangle_flip, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&Myquad_flip, &quad_flip, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
-#endif
+  unsigned long Myflip[3] = {line_flip, triangle_flip, quad_flip}, flip[3];
+  SU2_MPI::Allreduce(Myflip, flip, 3, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+  line_flip = flip[0]; triangle_flip = flip[1]; quad_flip = flip[2];
 
   if (rank == MASTER_NODE) {
     if (line_flip > 0) cout << "There has been a re-orientation of the LINE surface elements." << endl;
@@ -5080,6 +5398,15 @@ void CPhysicalGeometry::Check_BoundElem_Orientation(CConfig *config) {
 
 void CPhysicalGeometry::ComputeWall_Distance(CConfig *config) {
 
+  /*--- In discrete adjoint builds all distances are recomputed, as they are
+        recorded with the rest of the geometry. ---*/
+#if defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE
+  const bool incremental = false;
+#else
+  const bool incremental = true;
+#endif
+  const bool distributed = (config->GetKind_WallDistance_ADT() == DISTRIBUTED_WALL_ADT) && (size > 1);
+
   /*--------------------------------------------------------------------------*/
   /*--- Step 1: Create the coordinates and connectivity of the linear      ---*/
   /*---         subelements of the local boundaries that must be taken     ---*/
@@ -5133,22 +5460,82 @@ void CPhysicalGeometry::ComputeWall_Distance(CConfig *config) {
     }
   }
 
+  /*--- Determine the points whose distance must be computed. The first time all
+        points, afterwards (moving grids) the change of the distance of a point is
+        bounded by its displacement plus the maximum displacement of the walls,
+        the points for which this (accumulated) bound is larger than the tolerance
+        times their distance are recomputed. ---*/
+  vector<unsigned long> pointsToUpdate;
 
-  /*--- Create the coordinates of the local points on the viscous surfaces and
-        create the final version of the mapping from all volume points to the
-        points on the viscous surfaces. ---*/
-  vector<su2double> surfaceCoor;
-  unsigned long nVertex_SolidWall = 0;
+  if (incremental && (WallDist_Coord.size() == nPoint*nDim)) {
 
-  for(unsigned long i=0; i<nPoint; ++i) {
-    if( meshToSurface[i] ) {
-      meshToSurface[i] = nVertex_SolidWall++;
+    vector<su2double> displacement(nPoint);
+    su2double myWallDispl = 0.0, wallDispl = 0.0;
+
+    for(unsigned long i=0; i<nPoint; ++i) {
+      su2double displ2 = 0.0;
+      for(unsigned short k=0; k<nDim; ++k)
+        displ2 += pow(node[i]->GetCoord(k) - WallDist_Coord[i*nDim+k], 2);
+      displacement[i] = sqrt(displ2);
+      if( meshToSurface[i] ) myWallDispl = max(myWallDispl, displacement[i]);
+    }
+    SU2_MPI::Allreduce(&myWallDispl, &wallDispl, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+
+    const su2double tol = config->GetWallDistance_UpdateTol();
+
+    for(unsigned long i=0; i<nPoint; ++i) {
+      WallDist_Bound[i] += wallDispl + displacement[i];
+      if(WallDist_Bound[i] > tol*node[i]->GetWall_Distance())
+        pointsToUpdate.push_back(i);
+    }
+  }
+  else {
+    pointsToUpdate.resize(nPoint);
+    for(unsigned long i=0; i<nPoint; ++i) pointsToUpdate[i] = i;
+    WallDist_Bound.assign(nPoint, 0.0);
+  }
+
+  if (incremental) {
+    WallDist_Coord.resize(nPoint*nDim);
+    for(unsigned long i=0; i<nPoint; ++i)
+      for(unsigned short k=0; k<nDim; ++k)
+        WallDist_Coord[i*nDim+k] = node[i]->GetCoord(k);
+  }
+
+  for(const auto iPoint : pointsToUpdate) WallDist_Bound[iPoint] = 0.0;
+
+  /*--- The rest is collective, nothing to do if no rank needs to update points. ---*/
+  unsigned long myUpdates = pointsToUpdate.size(), nUpdates = 0;
+  SU2_MPI::Allreduce(&myUpdates, &nUpdates, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+  if (nUpdates == 0) return;
+
+  /*--- Create the coordinates of the local points on the viscous surfaces and
+        create the final version of the mapping from all volume points to the
+        points on the viscous surfaces. The bounding box of the local walls is
+        used by the distributed search. ---*/
+  vector<su2double> surfaceCoor, wallBBox;
+  unsigned long nVertex_SolidWall = 0;
+
+  for(unsigned long i=0; i<nPoint; ++i) {
+    if( meshToSurface[i] ) {
+      meshToSurface[i] = nVertex_SolidWall++;
 
       for(unsigned short k=0; k<nDim; ++k)
         surfaceCoor.push_back(node[i]->GetCoord(k));
     }
   }
 
+  if (distributed && (nVertex_SolidWall > 0)) {
+    wallBBox.assign(surfaceCoor.begin(), surfaceCoor.begin()+nDim);
+    wallBBox.insert(wallBBox.end(), surfaceCoor.begin(), surfaceCoor.begin()+nDim);
+    for(unsigned long i=1; i<nVertex_SolidWall; ++i) {
+      for(unsigned short k=0; k<nDim; ++k) {
+        wallBBox[k]      = min(wallBBox[k],      surfaceCoor[i*nDim+k]);
+        wallBBox[nDim+k] = max(wallBBox[nDim+k], surfaceCoor[i*nDim+k]);
+      }
+    }
+  }
+
   /*--- Change the surface connectivity, such that it corresponds to
         the entries in surfaceCoor rather than in meshPoints. ---*/
   for(unsigned long i=0; i<surfaceConn.size(); ++i)
@@ -5158,12 +5545,13 @@ void CPhysicalGeometry::ComputeWall_Distance(CConfig *config) {
   /*--- Step 2: Build the ADT, which is an ADT of bounding boxes of the    ---*/
   /*---         surface elements. A nearest point search does not give     ---*/
   /*---         accurate results, especially not for the integration       ---*/
-  /*---         points of the elements close to a wall boundary.           ---*/
+  /*---         points of the elements close to a wall boundary. In the    ---*/
+  /*---         distributed mode each rank only stores its own walls.      ---*/
   /*--------------------------------------------------------------------------*/
 
   /* Build the ADT. */
   CADTElemClass WallADT(nDim, surfaceCoor, surfaceConn, VTK_TypeElem,
-                           markerIDs, elemIDs, true);
+                           markerIDs, elemIDs, !distributed);
 
   /* Release the memory of the vectors used to build the ADT. To make sure
      that all the memory is deleted, the swap function is used. */
@@ -5178,8 +5566,10 @@ void CPhysicalGeometry::ComputeWall_Distance(CConfig *config) {
   /*---         distance to a solid wall element                           ---*/
   /*--------------------------------------------------------------------------*/
 
-
-  if ( WallADT.IsEmpty() ) {
+  if ( distributed ) {
+    ComputeDistributedWallDistance(WallADT, wallBBox, pointsToUpdate);
+  }
+  else if ( WallADT.IsEmpty() ) {
 
     /*--- No solid wall boundary nodes in the entire mesh.
      Set the wall distance to zero for all nodes. ---*/
@@ -5192,7 +5582,7 @@ void CPhysicalGeometry::ComputeWall_Distance(CConfig *config) {
     /*--- Solid wall boundary nodes are present. Compute the wall
      distance for all nodes. ---*/
 
-    for (unsigned long iPoint=0; iPoint<GetnPoint(); ++iPoint) {
+    for (const auto iPoint : pointsToUpdate) {
       unsigned short markerID;
       unsigned long  elemID;
       int            rankID;
@@ -5206,6 +5596,153 @@ void CPhysicalGeometry::ComputeWall_Distance(CConfig *config) {
 
 }
 
+void CPhysicalGeometry::ComputeDistributedWallDistance(CADTElemClass &WallADT,
+                                                       const vector<su2double> &wallBBox,
+                                                       const vector<unsigned long> &points) {
+
+  /*--- Gather the bounding boxes of the walls of all ranks, empty boxes
+        (min larger than max) mark the ranks without walls. ---*/
+  const unsigned short nBBox = 2*nDim;
+  vector<su2double> myBBox(nBBox), allBBox(nBBox*size);
+
+  for(unsigned short k=0; k<nDim; ++k) {
+    myBBox[k] = 1.0; myBBox[nDim+k] = -1.0;
+  }
+  if (!wallBBox.empty()) myBBox = wallBBox;
+
+  SU2_MPI::Allgather(myBBox.data(), nBBox, MPI_DOUBLE, allBBox.data(), nBBox,
+                     MPI_DOUBLE, MPI_COMM_WORLD);
+
+  vector<int> wallRanks;
+  for(int iRank=0; iRank<size; ++iRank)
+    if ((iRank != rank) && (allBBox[iRank*nBBox] <= allBBox[iRank*nBBox+nDim]))
+      wallRanks.push_back(iRank);
+
+  const bool localWalls = !WallADT.IsEmpty();
+
+  /*--- No solid wall boundary nodes in the entire mesh.
+        Set the wall distance to zero for all nodes. ---*/
+  if (wallRanks.empty() && !localWalls) {
+    for (unsigned long iPoint=0; iPoint<nPoint; ++iPoint)
+      node[iPoint]->SetWall_Distance(0.0);
+    return;
+  }
+
+  /*--- Possible (minimum) and guaranteed (maximum) distance squared from a
+        point to the walls inside a bounding box. ---*/
+  auto possibleDist2 = [&](const su2double *coor, const su2double *bbox) {
+    su2double dist2 = 0.0;
+    for(unsigned short k=0; k<nDim; ++k) {
+      su2double ds = 0.0;
+      if(     coor[k] < bbox[k])      ds = coor[k] - bbox[k];
+      else if(coor[k] > bbox[nDim+k]) ds = coor[k] - bbox[nDim+k];
+      dist2 += ds*ds;
+    }
+    return dist2;
+  };
+
+  auto guaranteedDist2 = [&](const su2double *coor, const su2double *bbox) {
+    su2double dist2 = 0.0;
+    for(unsigned short k=0; k<nDim; ++k) {
+      const su2double dsMin = fabs(coor[k] - bbox[k]);
+      const su2double dsMax = fabs(coor[k] - bbox[nDim+k]);
+      const su2double ds    = max(dsMin, dsMax);
+      dist2 += ds*ds;
+    }
+    return dist2;
+  };
+
+  /*--- Distance to the local walls, and list of the points to send to the ranks
+        whose walls may be closer. The distance to the nearest wall is at most the
+        distance to the local walls or the guaranteed distance of any box, a box
+        whose possible distance is larger than that cannot contain the nearest wall. ---*/
+  vector<su2double> dist(points.size(), 0.0);
+  vector<vector<unsigned long> > sendPoints(size);
+
+  for(unsigned long i=0; i<points.size(); ++i) {
+    const su2double *coor = node[points[i]]->GetCoord();
+
+    su2double upperDist2 = 0.0;
+    if (localWalls) {
+      unsigned short markerID;
+      unsigned long  elemID;
+      int            rankID;
+      WallADT.DetermineNearestElement(coor, dist[i], markerID, elemID, rankID);
+      upperDist2 = dist[i]*dist[i];
+    }
+    else {
+      upperDist2 = guaranteedDist2(coor, &allBBox[wallRanks[0]*nBBox]);
+      dist[i] = sqrt(upperDist2);
+    }
+
+    for(const auto iRank : wallRanks)
+      upperDist2 = min(upperDist2, guaranteedDist2(coor, &allBBox[iRank*nBBox]));
+
+    for(const auto iRank : wallRanks)
+      if (possibleDist2(coor, &allBBox[iRank*nBBox]) <= upperDist2)
+        sendPoints[iRank].push_back(i);
+  }
+
+  /*--- Exchange the coordinates of the points with the ranks whose walls must be searched. ---*/
+  vector<int> nSend(size), nRecv(size), sendDispl(size+1, 0), recvDispl(size+1, 0);
+
+  for(int iRank=0; iRank<size; ++iRank) nSend[iRank] = sendPoints[iRank].size();
+
+  SU2_MPI::Alltoall(nSend.data(), 1, MPI_INT, nRecv.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+  for(int iRank=0; iRank<size; ++iRank) {
+    sendDispl[iRank+1] = sendDispl[iRank] + nSend[iRank];
+    recvDispl[iRank+1] = recvDispl[iRank] + nRecv[iRank];
+  }
+
+  vector<su2double> sendCoor(sendDispl[size]*nDim), recvCoor(recvDispl[size]*nDim);
+
+  for(int iRank=0; iRank<size; ++iRank) {
+    for(unsigned long j=0; j<sendPoints[iRank].size(); ++j) {
+      const su2double *coor = node[points[sendPoints[iRank][j]]]->GetCoord();
+      for(unsigned short k=0; k<nDim; ++k)
+        sendCoor[(sendDispl[iRank]+j)*nDim+k] = coor[k];
+    }
+  }
+
+  {
+    /*--- The counts and displacements of the coordinates include the dimension. ---*/
+    vector<int> nSendCoor(size), nRecvCoor(size), sendDisplCoor(size), recvDisplCoor(size);
+    for(int iRank=0; iRank<size; ++iRank) {
+      nSendCoor[iRank] = nSend[iRank]*nDim;  sendDisplCoor[iRank] = sendDispl[iRank]*nDim;
+      nRecvCoor[iRank] = nRecv[iRank]*nDim;  recvDisplCoor[iRank] = recvDispl[iRank]*nDim;
+    }
+    SU2_MPI::Alltoallv(sendCoor.data(), nSendCoor.data(), sendDisplCoor.data(), MPI_DOUBLE,
+                       recvCoor.data(), nRecvCoor.data(), recvDisplCoor.data(), MPI_DOUBLE,
+                       MPI_COMM_WORLD);
+  }
+  vector<su2double>().swap(sendCoor);
+
+  /*--- Distance of the received points to the local walls, returned to their ranks. ---*/
+  vector<su2double> recvDist(recvDispl[size]), sendDist(sendDispl[size]);
+
+  for(int j=0; j<recvDispl[size]; ++j) {
+    unsigned short markerID;
+    unsigned long  elemID;
+    int            rankID;
+    WallADT.DetermineNearestElement(&recvCoor[j*nDim], recvDist[j], markerID, elemID, rankID);
+  }
+
+  SU2_MPI::Alltoallv(recvDist.data(), nRecv.data(), recvDispl.data(), MPI_DOUBLE,
+                     sendDist.data(), nSend.data(), sendDispl.data(), MPI_DOUBLE,
+                     MPI_COMM_WORLD);
+
+  /*--- The wall distance is the minimum over the searched ranks. ---*/
+  for(int iRank=0; iRank<size; ++iRank)
+    for(unsigned long j=0; j<sendPoints[iRank].size(); ++j) {
+      const auto i = sendPoints[iRank][j];
+      dist[i] = min(dist[i], sendDist[sendDispl[iRank]+j]);
+    }
+
+  for(unsigned long i=0; i<points.size(); ++i)
+    node[points[i]]->SetWall_Distance(dist[i]);
+}
+
 void CPhysicalGeometry::SetPositive_ZArea(CConfig *config) {
   unsigned short iMarker, Boundary, Monitoring;
   unsigned long iVertex, iPoint;
@@ -5268,35 +5805,27 @@ void CPhysicalGeometry::SetPositive_ZArea(CConfig *config) {
 
   }
 
-#ifdef HAVE_MPI
-  SU2_MPI::Allreduce(&PositiveXArea, &TotalPositiveXArea, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&PositiveYArea, &TotalPositiveYArea, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&PositiveZArea, &TotalPositiveZArea, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-
-  SU2_MPI::Allreduce(&MinCoordX, &TotalMinCoordX, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MinCoordY, &TotalMinCoordY, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MinCoordZ, &TotalMinCoordZ, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+  /*--- Two reductions, one for the areas and one for the bounds of the
+   coordinates (the max is the min of the negated coordinates). ---*/
 
-  SU2_MPI::Allreduce(&MaxCoordX, &TotalMaxCoordX, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MaxCoordY, &TotalMaxCoordY, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MaxCoordZ, &TotalMaxCoordZ, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  su2double MySum[4] = {PositiveXArea, PositiveYArea, PositiveZArea, WettedArea}, Sum[4];
+  SU2_MPI::Allreduce(MySum, Sum, 4, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
 
-  SU2_MPI::Allreduce(&WettedArea, &TotalWettedArea, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-#else
-  TotalPositiveXArea = PositiveXArea;
-  TotalPositiveYArea = PositiveYArea;
-  TotalPositiveZArea = PositiveZArea;
+  TotalPositiveXArea = Sum[0];
+  TotalPositiveYArea = Sum[1];
+  TotalPositiveZArea = Sum[2];
+  TotalWettedArea    = Sum[3];
 
-  TotalMinCoordX = MinCoordX;
-  TotalMinCoordY = MinCoordY;
-  TotalMinCoordZ = MinCoordZ;
+  su2double MyMin[6] = {MinCoordX, MinCoordY, MinCoordZ, -MaxCoordX, -MaxCoordY, -MaxCoordZ}, Min[6];
+  SU2_MPI::Allreduce(MyMin, Min, 6, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
 
-  TotalMaxCoordX = MaxCoordX;
-  TotalMaxCoordY = MaxCoordY;
-  TotalMaxCoordZ = MaxCoordZ;
+  TotalMinCoordX = Min[0];
+  TotalMinCoordY = Min[1];
+  TotalMinCoordZ = Min[2];
 
-  TotalWettedArea    = WettedArea;
-#endif
+  TotalMaxCoordX = -Min[3];
+  TotalMaxCoordY = -Min[4];
+  TotalMaxCoordZ = -Min[5];
 
   /*--- Set a reference area if no value is provided ---*/
 
@@ -5381,63 +5910,67 @@ void CPhysicalGeometry::SetPositive_ZArea(CConfig *config) {
 
 void CPhysicalGeometry::SetPoint_Connectivity(void) {
 
-  unsigned short Node_Neighbor, iNode, iNeighbor;
-  unsigned long jElem, Point_Neighbor, iPoint, iElem;
-
-  /*--- Loop over all the elements ---*/
+  /*--- Elements of each point (CSR) by a counting sort of the nodes of the elements,
+   *    the elements of each point are in increasing order. ---*/
 
-  for (iElem = 0; iElem < nElem; iElem++)
+  vector<unsigned long> elemPtr(nPoint+1, 0);
 
-  /*--- Loop over all the nodes of an element ---*/
-
-    for (iNode = 0; iNode < elem[iElem]->GetnNodes(); iNode++) {
-      iPoint = elem[iElem]->GetNode(iNode);
-
-      /*--- Store the element into the point ---*/
-
-      node[iPoint]->SetElem(iElem);
-    }
+  for (unsigned long iElem = 0; iElem < nElem; iElem++)
+    for (unsigned short iNode = 0; iNode < elem[iElem]->GetnNodes(); iNode++)
+      elemPtr[elem[iElem]->GetNode(iNode)+1]++;
 
-  /*--- Loop over all the points ---*/
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
+    elemPtr[iPoint+1] += elemPtr[iPoint];
 
-  for (iPoint = 0; iPoint < nPoint; iPoint++)
+  CCompressedSparsePatternUL elemsOfPoints;
+  {
+    vector<unsigned long> pointElems(elemPtr[nPoint]), position(elemPtr.begin(), elemPtr.end()-1);
 
-  /*--- Loop over all elements shared by the point ---*/
+    for (unsigned long iElem = 0; iElem < nElem; iElem++)
+      for (unsigned short iNode = 0; iNode < elem[iElem]->GetnNodes(); iNode++)
+        pointElems[position[elem[iElem]->GetNode(iNode)]++] = iElem;
 
-    for (iElem = 0; iElem < node[iPoint]->GetnElem(); iElem++) {
+    elemsOfPoints = CCompressedSparsePatternUL(elemPtr, pointElems);
+  }
 
-      jElem = node[iPoint]->GetElem(iElem);
+  /*--- The neighbors of each point are the neighbors of its node in each of its elements,
+   *    sorted and without duplicates (the points are independent, threaded loop).
+   *    The number of neighbors is important for JST and multigrid in parallel. ---*/
 
-      /*--- If we find the point iPoint in the surronding element ---*/
+  SU2_OMP_PARALLEL
+  {
+    vector<su2localidx> neighbors;
 
-      for (iNode = 0; iNode < elem[jElem]->GetnNodes(); iNode++)
+    SU2_OMP_FOR_DYN(256)
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
 
-        if (elem[jElem]->GetNode(iNode) == iPoint)
+      neighbors.clear();
 
-        /*--- Localize the local index of the neighbor of iPoint in the element ---*/
+      for (unsigned long k = 0; k < elemsOfPoints.getNumNonZeros(iPoint); k++) {
+        CPrimalGrid* jElem = elem[elemsOfPoints.getInnerIdx(iPoint, k)];
 
-          for (iNeighbor = 0; iNeighbor < elem[jElem]->GetnNeighbor_Nodes(iNode); iNeighbor++) {
-            Node_Neighbor = elem[jElem]->GetNeighbor_Nodes(iNode, iNeighbor);
-            Point_Neighbor = elem[jElem]->GetNode(Node_Neighbor);
+        for (unsigned short iNode = 0; iNode < jElem->GetnNodes(); iNode++) {
+          if (jElem->GetNode(iNode) != iPoint) continue;
+          for (unsigned short iNeighbor = 0; iNeighbor < jElem->GetnNeighbor_Nodes(iNode); iNeighbor++)
+            neighbors.push_back(jElem->GetNode(jElem->GetNeighbor_Nodes(iNode, iNeighbor)));
+        }
+      }
 
-            /*--- Store the point into the point ---*/
+      sort(neighbors.begin(), neighbors.end());
+      neighbors.erase(unique(neighbors.begin(), neighbors.end()), neighbors.end());
 
-            node[iPoint]->SetPoint(Point_Neighbor);
-          }
+      node[iPoint]->SetElems(elemsOfPoints.innerIdx(iPoint), elemsOfPoints.getNumNonZeros(iPoint));
+      node[iPoint]->SetPoints(neighbors.data(), neighbors.size());
+      node[iPoint]->SetnNeighbor(neighbors.size());
     }
-
-  /*--- Set the number of neighbors variable, this is
-   important for JST and multigrid in parallel ---*/
-
-  for (iPoint = 0; iPoint < nPoint; iPoint++)
-    node[iPoint]->SetnNeighbor(node[iPoint]->GetnPoint());
+  }
 
 }
 
 void CPhysicalGeometry::SetRCM_Ordering(CConfig *config) {
-  unsigned long iPoint, AdjPoint, AuxPoint, AddPoint, iElem, iNode, jNode;
+  unsigned long iPoint, AdjPoint, AuxPoint, AddPoint, iNode, jNode;
   vector<unsigned long> Queue, AuxQueue, Result;
-  unsigned short Degree, MinDegree, iDim, iMarker;
+  unsigned short Degree, MinDegree;
   bool *inQueue;
 
   inQueue = new bool [nPoint];
@@ -5525,6 +6058,116 @@ void CPhysicalGeometry::SetRCM_Ordering(CConfig *config) {
     Result.push_back(iPoint);
   }
 
+  ApplyPointOrdering(config, Result);
+
+}
+
+namespace {
+/*--- Keys of the points along a space-filling curve, the coordinates are given as
+ *    integers with nBits bits each, the key interleaves those bits (most significant
+ *    first). For the Hilbert curve the coordinates are first transformed as in
+ *    J. Skilling, "Programming the Hilbert curve", AIP Conf. Proc. 707, 2004. ---*/
+
+uint64_t MortonKey(const uint32_t* X, unsigned short nDim, unsigned short nBits) {
+  uint64_t key = 0;
+  for (int iBit = nBits-1; iBit >= 0; --iBit)
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+      key = (key << 1) | ((X[iDim] >> iBit) & 1u);
+  return key;
+}
+
+uint64_t HilbertKey(const uint32_t* Coord, unsigned short nDim, unsigned short nBits) {
+  uint32_t X[3] = {0, 0, 0};
+  for (unsigned short iDim = 0; iDim < nDim; ++iDim) X[iDim] = Coord[iDim];
+
+  const uint32_t M = 1u << (nBits-1);
+
+  /*--- Inverse undo. ---*/
+  for (uint32_t Q = M; Q > 1; Q >>= 1) {
+    const uint32_t P = Q-1;
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+      if (X[iDim] & Q) {
+        X[0] ^= P;
+      } else {
+        const uint32_t t = (X[0] ^ X[iDim]) & P;
+        X[0] ^= t; X[iDim] ^= t;
+      }
+    }
+  }
+
+  /*--- Gray encode. ---*/
+  for (unsigned short iDim = 1; iDim < nDim; ++iDim) X[iDim] ^= X[iDim-1];
+  uint32_t t = 0;
+  for (uint32_t Q = M; Q > 1; Q >>= 1)
+    if (X[nDim-1] & Q) t ^= Q-1;
+  for (unsigned short iDim = 0; iDim < nDim; ++iDim) X[iDim] ^= t;
+
+  return MortonKey(X, nDim, nBits);
+}
+}
+
+void CPhysicalGeometry::SetSFC_Ordering(CConfig *config) {
+  unsigned long iPoint;
+  unsigned short iDim;
+
+  const bool hilbert = (config->GetKind_Point_Ordering() == HILBERT_ORDERING);
+
+  /*--- The keys must fit in 64 bits. ---*/
+
+  const unsigned short nBits = 63 / nDim;
+
+  /*--- Bounding box of the points of this partition, the same scale is used
+   *    in all directions to keep the curve isotropic. ---*/
+
+  su2double MinCoord[3] = {0.0, 0.0, 0.0}, Extent = 0.0;
+
+  for (iDim = 0; iDim < nDim; iDim++) {
+    su2double MaxCoord = MinCoord[iDim] = (nPointDomain > 0)? node[0]->GetCoord(iDim) : 0.0;
+    for (iPoint = 1; iPoint < nPointDomain; iPoint++) {
+      MinCoord[iDim] = min(MinCoord[iDim], node[iPoint]->GetCoord(iDim));
+      MaxCoord = max(MaxCoord, node[iPoint]->GetCoord(iDim));
+    }
+    Extent = max(Extent, MaxCoord-MinCoord[iDim]);
+  }
+
+  const passivedouble MaxInt = static_cast<passivedouble>((1ul << nBits) - 1);
+  const passivedouble Scale = (Extent > 0.0)? MaxInt / SU2_TYPE::GetValue(Extent) : 0.0;
+
+  /*--- Sort the domain points by key (ties by index, for determinism). ---*/
+
+  vector<pair<uint64_t, unsigned long> > Keys(nPointDomain);
+
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    uint32_t X[3] = {0, 0, 0};
+    for (iDim = 0; iDim < nDim; iDim++) {
+      const passivedouble x = SU2_TYPE::GetValue(node[iPoint]->GetCoord(iDim) - MinCoord[iDim]) * Scale;
+      X[iDim] = static_cast<uint32_t>(min(max(x, 0.0), MaxInt));
+    }
+    Keys[iPoint].first = hilbert? HilbertKey(X, nDim, nBits) : MortonKey(X, nDim, nBits);
+    Keys[iPoint].second = iPoint;
+  }
+
+  sort(Keys.begin(), Keys.end());
+
+  vector<unsigned long> Result;
+  Result.reserve(nPoint);
+
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    Result.push_back(Keys[iPoint].second);
+
+  /*--- Add the MPI points ---*/
+
+  for (iPoint = nPointDomain; iPoint < nPoint; iPoint++)
+    Result.push_back(iPoint);
+
+  ApplyPointOrdering(config, Result);
+
+}
+
+void CPhysicalGeometry::ApplyPointOrdering(CConfig *config, const vector<unsigned long>& Result) {
+  unsigned long iPoint, iElem;
+  unsigned short iDim, iNode, iMarker;
+
   /*--- Reset old data structures ---*/
 
   for (iPoint = 0; iPoint < nPoint; iPoint++) {
@@ -5652,12 +6295,21 @@ void CPhysicalGeometry::SetElement_Connectivity(void) {
 }
 
 void CPhysicalGeometry::SetBoundVolume(void) {
-  unsigned short cont, iMarker, iElem, iNode_Domain, iNode_Surface;
-  unsigned long Point_Domain, Point_Surface, Point, iElem_Surface, iElem_Domain;
-  bool CheckVol;
 
-  for (iMarker = 0; iMarker < nMarker; iMarker++)
-    for (iElem_Surface = 0; iElem_Surface < nElem_Bound[iMarker]; iElem_Surface++) {
+  /*--- The boundary elements are independent (threaded loop), the first element
+   *    without a volume element is reported after the loop. ---*/
+
+  unsigned short badMarker = 0;
+  unsigned long badElem = numeric_limits<unsigned long>::max();
+
+  SU2_OMP_PARALLEL
+  for (unsigned short iMarker = 0; iMarker < nMarker; iMarker++) {
+    SU2_OMP_FOR_DYN(256)
+    for (unsigned long iElem_Surface = 0; iElem_Surface < nElem_Bound[iMarker]; iElem_Surface++) {
+
+      unsigned short cont, iElem, iNode_Domain, iNode_Surface;
+      unsigned long Point_Domain, Point_Surface, Point, iElem_Domain;
+      bool CheckVol;
 
       /*--- Choose and arbitrary point from the surface --*/
       Point = bound[iMarker][iElem_Surface]->GetNode(0);
@@ -5683,11 +6335,20 @@ void CPhysicalGeometry::SetBoundVolume(void) {
         }
       }
       if (!CheckVol) {
-        char buf[100];
-        SPRINTF(buf,"The surface element (%u, %lu) doesn't have an associated volume element", iMarker, iElem_Surface );
-        SU2_MPI::Error(buf, CURRENT_FUNCTION);
+        SU2_OMP_CRITICAL
+        if (badElem == numeric_limits<unsigned long>::max()) {
+          badMarker = iMarker;
+          badElem = iElem_Surface;
+        }
       }
     }
+  }
+
+  if (badElem != numeric_limits<unsigned long>::max()) {
+    char buf[100];
+    SPRINTF(buf,"The surface element (%u, %lu) doesn't have an associated volume element", badMarker, badElem );
+    SU2_MPI::Error(buf, CURRENT_FUNCTION);
+  }
 }
 
 void CPhysicalGeometry::SetVertex(CConfig *config) {
@@ -7448,9 +8109,8 @@ void CPhysicalGeometry::SetCoord_CG(void) {
 }
 
 void CPhysicalGeometry::SetBoundControlVolume(CConfig *config, unsigned short action) {
-  unsigned short Neighbor_Node, iMarker, iNode, iNeighbor_Nodes, iDim;
-  unsigned long Neighbor_Point, iVertex, iPoint, iElem;
-  long iEdge;
+  unsigned short iMarker, iDim;
+  unsigned long iVertex, iElem;
   su2double Area, *NormalFace = NULL;
 
   /*--- Update values of faces of the edge ---*/
@@ -7460,10 +8120,6 @@ void CPhysicalGeometry::SetBoundControlVolume(CConfig *config, unsigned short ac
       for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++)
         vertex[iMarker][iVertex]->SetZeroValues();
 
-  su2double *Coord_Edge_CG = new su2double [nDim];
-  su2double *Coord_Elem_CG = new su2double [nDim];
-  su2double *Coord_Vertex = new su2double [nDim];
-
   /*--- Loop over all the markers ---*/
 
   for (iMarker = 0; iMarker < nMarker; iMarker++)
@@ -7471,115 +8127,322 @@ void CPhysicalGeometry::SetBoundControlVolume(CConfig *config, unsigned short ac
   /*--- Loop over all the boundary elements ---*/
 
     for (iElem = 0; iElem < nElem_Bound[iMarker]; iElem++)
+      AddBoundElemControlVolume(iMarker, iElem);
 
-    /*--- Loop over all the nodes of the boundary ---*/
+  /*--- Check if there is a normal with null area ---*/
 
-      for (iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++) {
-        iPoint = bound[iMarker][iElem]->GetNode(iNode);
-        iVertex = node[iPoint]->GetVertex(iMarker);
+  for (iMarker = 0; iMarker < nMarker; iMarker ++)
+    for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
+      NormalFace = vertex[iMarker][iVertex]->GetNormal();
+      Area = 0.0; for (iDim = 0; iDim < nDim; iDim++) Area += NormalFace[iDim]*NormalFace[iDim];
+      Area = sqrt(Area);
+      if (Area == 0.0) for (iDim = 0; iDim < nDim; iDim++) NormalFace[iDim] = EPS*EPS;
+    }
 
-        /*--- Loop over the neighbor nodes, there is a face for each one ---*/
+}
 
-        for (iNeighbor_Nodes = 0; iNeighbor_Nodes < bound[iMarker][iElem]->GetnNeighbor_Nodes(iNode); iNeighbor_Nodes++) {
-          Neighbor_Node = bound[iMarker][iElem]->GetNeighbor_Nodes(iNode, iNeighbor_Nodes);
-          Neighbor_Point = bound[iMarker][iElem]->GetNode(Neighbor_Node);
+void CPhysicalGeometry::AddBoundElemControlVolume(unsigned short iMarker, unsigned long iElem, const vector<bool>* pointMask) {
+  unsigned short Neighbor_Node, iNode, iNeighbor_Nodes, iDim;
+  unsigned long Neighbor_Point, iVertex, iPoint;
+  long iEdge;
+  su2double Coord_Edge_CG[3] = {0.0}, Coord_Elem_CG[3] = {0.0}, Coord_Vertex[3] = {0.0};
 
-          /*--- Shared edge by the Neighbor Point and the point ---*/
+  /*--- Loop over all the nodes of the boundary ---*/
 
-          iEdge = FindEdge(iPoint, Neighbor_Point);
-          for (iDim = 0; iDim < nDim; iDim++) {
-            Coord_Edge_CG[iDim] = edge[iEdge]->GetCG(iDim);
-            Coord_Elem_CG[iDim] = bound[iMarker][iElem]->GetCG(iDim);
-            Coord_Vertex[iDim] = node[iPoint]->GetCoord(iDim);
-          }
-          switch (nDim) {
-            case 2:
+  for (iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++) {
+    iPoint = bound[iMarker][iElem]->GetNode(iNode);
+    iVertex = node[iPoint]->GetVertex(iMarker);
 
-              /*--- Store the 2D face ---*/
+    /*--- Only the vertices of flagged points are updated (incremental update). ---*/
 
-              if (iNode == 0) vertex[iMarker][iVertex]->SetNodes_Coord(Coord_Elem_CG, Coord_Vertex);
-              if (iNode == 1) vertex[iMarker][iVertex]->SetNodes_Coord(Coord_Vertex, Coord_Elem_CG);
-              break;
-            case 3:
+    if ((pointMask != nullptr) && !(*pointMask)[iPoint]) continue;
 
-              /*--- Store the 3D face ---*/
+    /*--- Loop over the neighbor nodes, there is a face for each one ---*/
 
-              if (iNeighbor_Nodes == 0) vertex[iMarker][iVertex]->SetNodes_Coord(Coord_Elem_CG, Coord_Edge_CG, Coord_Vertex);
-              if (iNeighbor_Nodes == 1) vertex[iMarker][iVertex]->SetNodes_Coord(Coord_Edge_CG, Coord_Elem_CG, Coord_Vertex);
-              break;
-          }
-        }
+    for (iNeighbor_Nodes = 0; iNeighbor_Nodes < bound[iMarker][iElem]->GetnNeighbor_Nodes(iNode); iNeighbor_Nodes++) {
+      Neighbor_Node = bound[iMarker][iElem]->GetNeighbor_Nodes(iNode, iNeighbor_Nodes);
+      Neighbor_Point = bound[iMarker][iElem]->GetNode(Neighbor_Node);
+
+      /*--- Shared edge by the Neighbor Point and the point ---*/
+
+      iEdge = FindEdge(iPoint, Neighbor_Point);
+      for (iDim = 0; iDim < nDim; iDim++) {
+        Coord_Edge_CG[iDim] = edge[iEdge]->GetCG(iDim);
+        Coord_Elem_CG[iDim] = bound[iMarker][iElem]->GetCG(iDim);
+        Coord_Vertex[iDim] = node[iPoint]->GetCoord(iDim);
       }
+      switch (nDim) {
+        case 2:
 
-  delete[] Coord_Edge_CG;
-  delete[] Coord_Elem_CG;
-  delete[] Coord_Vertex;
+          /*--- Store the 2D face ---*/
 
-  /*--- Check if there is a normal with null area ---*/
+          if (iNode == 0) vertex[iMarker][iVertex]->SetNodes_Coord(Coord_Elem_CG, Coord_Vertex);
+          if (iNode == 1) vertex[iMarker][iVertex]->SetNodes_Coord(Coord_Vertex, Coord_Elem_CG);
+          break;
+        case 3:
+
+          /*--- Store the 3D face ---*/
+
+          if (iNeighbor_Nodes == 0) vertex[iMarker][iVertex]->SetNodes_Coord(Coord_Elem_CG, Coord_Edge_CG, Coord_Vertex);
+          if (iNeighbor_Nodes == 1) vertex[iMarker][iVertex]->SetNodes_Coord(Coord_Edge_CG, Coord_Elem_CG, Coord_Vertex);
+          break;
+      }
+    }
+  }
+}
+
+void CPhysicalGeometry::SetMaxLength(CConfig* config) {
+
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
+    SetPointMaxLength(iPoint);
+
+  InitiateComms(this, config, MAX_LENGTH);
+  CompleteComms(this, config, MAX_LENGTH);
+
+}
+
+void CPhysicalGeometry::SetPointMaxLength(unsigned long iPoint) {
+
+  const unsigned short nNeigh = node[iPoint]->GetnPoint();
+  const su2double* Coord_i = node[iPoint]->GetCoord();
+
+  /*--- If using AD, computing the maximum grid length can generate
+   * a lot of unnecessary overhead since we would store all computations
+   * of each grid length, even though we only need the maximum value.
+   * We solve that by finding the neighbor that's furthest away
+   * (corresponding to the maximum distance) using passive calculations,
+   * then set the max using the AD datatype. ---*/
+
+  passivedouble passive_max_delta=0;
+  unsigned short max_neighbor = 0;
+  for (unsigned short iNeigh = 0; iNeigh < nNeigh; iNeigh++) {
+
+    /*-- Calculate the cell-center to cell-center length ---*/
+
+    const unsigned long jPoint  = node[iPoint]->GetPoint(iNeigh);
+    const su2double* Coord_j = node[jPoint]->GetCoord();
+
+    passivedouble delta_aux = 0;
+    for (unsigned short iDim = 0;iDim < nDim; iDim++){
+      delta_aux += pow(SU2_TYPE::GetValue(Coord_j[iDim])-SU2_TYPE::GetValue(Coord_i[iDim]), 2.);
+    }
+
+    /*--- Only keep the maximum length ---*/
+
+    if (delta_aux > passive_max_delta) {
+      passive_max_delta = delta_aux;
+      max_neighbor = iNeigh;
+    }
+  }
+
+  /*--- Now that we know where the maximum distance is, repeat
+   * calculation with the AD-friendly su2double datatype ---*/
+
+  const unsigned long jPoint  = node[iPoint]->GetPoint(max_neighbor);
+  const su2double* Coord_j = node[jPoint]->GetCoord();
+
+  su2double max_delta = 0;
+  for (unsigned short iDim = 0;iDim < nDim; iDim++) {
+    max_delta += pow((Coord_j[iDim]-Coord_i[iDim]), 2.);
+  }
+  max_delta = sqrt(max_delta);
+
+  node[iPoint]->SetMaxLength(max_delta);
+}
+
+void CPhysicalGeometry::UpdateDualGrid(CConfig *config) {
+
+  unsigned long iPoint, iElem, iEdge, iVertex;
+  unsigned short iNode, iMarker, iDim;
+  su2double *Coord[N_POINTS_HEXAHEDRON], Area, *NormalFace, DomainVolume, my_DomainVolume;
+
+  /*--- Without a reference (first computation) everything is computed, and the same in AD
+   *    builds, where the derivatives of the metrics w.r.t. all the coordinates are needed. ---*/
+
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+  const bool incremental = false;
+#else
+  const bool incremental = (DualGrid_Coord.size() == nPoint*nDim);
+#endif
+
+  if (!incremental) {
+    SetCoord_CG();
+    SetControlVolume(config, UPDATE);
+    SetBoundControlVolume(config, UPDATE);
+    SetMaxLength(config);
+    return;
+  }
+
+  /*--- Points displaced since the last computation of the dual grid. ---*/
+
+  vector<bool> moved(nPoint, false);
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    for (iDim = 0; iDim < nDim; iDim++) {
+      if (node[iPoint]->GetCoord(iDim) != DualGrid_Coord[iPoint*nDim+iDim]) moved[iPoint] = true;
+      DualGrid_Coord[iPoint*nDim+iDim] = node[iPoint]->GetCoord(iDim);
+    }
+  }
+
+  const auto anyMoved = [&](CPrimalGrid* prim) {
+    for (unsigned short iNode = 0; iNode < prim->GetnNodes(); iNode++)
+      if (moved[prim->GetNode(iNode)]) return true;
+    return false;
+  };
+
+  /*--- CGs of the elements with displaced points, the control volumes of all their points
+   *    change, the flag of the edges is that both of their points change. ---*/
+
+  vector<bool> changed(nPoint, false);
+
+  for (iElem = 0; iElem < nElem; iElem++) {
+    if (!anyMoved(elem[iElem])) continue;
+    for (iNode = 0; iNode < elem[iElem]->GetnNodes(); iNode++) {
+      Coord[iNode] = node[elem[iElem]->GetNode(iNode)]->GetCoord();
+      changed[elem[iElem]->GetNode(iNode)] = true;
+    }
+    elem[iElem]->SetCoord_CG(Coord);
+  }
+
+  for (iMarker = 0; iMarker < nMarker; iMarker++) {
+    for (iElem = 0; iElem < nElem_Bound[iMarker]; iElem++) {
+      if (!anyMoved(bound[iMarker][iElem])) continue;
+      for (iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++)
+        Coord[iNode] = node[bound[iMarker][iElem]->GetNode(iNode)]->GetCoord();
+      bound[iMarker][iElem]->SetCoord_CG(Coord);
+    }
+  }
+
+  for (iEdge = 0; iEdge < nEdge; iEdge++) {
+    if (!moved[edge[iEdge]->GetNode(0)] && !moved[edge[iEdge]->GetNode(1)]) continue;
+    for (iNode = 0; iNode < 2; iNode++)
+      Coord[iNode] = node[edge[iEdge]->GetNode(iNode)]->GetCoord();
+    edge[iEdge]->SetCoord_CG(Coord);
+  }
+
+  /*--- Control volumes, the changed parts are reset and all the elements that touch changed points
+   *    contribute to them, in the same order as SetControlVolume, i.e. the result is the same. ---*/
+
+  for (iEdge = 0; iEdge < nEdge; iEdge++)
+    if (changed[edge[iEdge]->GetNode(0)] && changed[edge[iEdge]->GetNode(1)])
+      edge[iEdge]->SetZeroValues();
+
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    if (changed[iPoint]) node[iPoint]->SetVolume(0.0);
+
+  const auto anyChanged = [&](CPrimalGrid* prim) {
+    for (unsigned short iNode = 0; iNode < prim->GetnNodes(); iNode++)
+      if (changed[prim->GetNode(iNode)]) return true;
+    return false;
+  };
+
+  for (iElem = 0; iElem < nElem; iElem++)
+    if (anyChanged(elem[iElem])) AddElemControlVolume(iElem, &changed);
+
+  for (iEdge = 0; iEdge < nEdge; iEdge++) {
+    if (!changed[edge[iEdge]->GetNode(0)] || !changed[edge[iEdge]->GetNode(1)]) continue;
+    NormalFace = edge[iEdge]->GetNormal();
+    Area = 0.0; for (iDim = 0; iDim < nDim; iDim++) Area += NormalFace[iDim]*NormalFace[iDim];
+    Area = sqrt(Area);
+    if (Area == 0.0) for (iDim = 0; iDim < nDim; iDim++) NormalFace[iDim] = EPS*EPS;
+  }
+
+  my_DomainVolume = 0.0;
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    my_DomainVolume += node[iPoint]->GetVolume();
+
+  SU2_MPI::Allreduce(&my_DomainVolume, &DomainVolume, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+
+  config->SetDomainVolume(DomainVolume);
+
+  UpdateEdgeGeometry(changed);
+
+  SetLeastSquaresWeights(config);
+
+  /*--- Boundary control volumes, the vertices on boundary elements with displaced points. ---*/
+
+  vector<bool> changedVertex(nPoint, false);
+
+  for (iMarker = 0; iMarker < nMarker; iMarker++) {
+
+    for (iElem = 0; iElem < nElem_Bound[iMarker]; iElem++) {
+      if (!anyMoved(bound[iMarker][iElem])) continue;
+      for (iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++)
+        changedVertex[bound[iMarker][iElem]->GetNode(iNode)] = true;
+    }
+
+    for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++)
+      if (changedVertex[vertex[iMarker][iVertex]->GetNode()])
+        vertex[iMarker][iVertex]->SetZeroValues();
+
+    for (iElem = 0; iElem < nElem_Bound[iMarker]; iElem++) {
+      for (iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++) {
+        if (changedVertex[bound[iMarker][iElem]->GetNode(iNode)]) {
+          AddBoundElemControlVolume(iMarker, iElem, &changedVertex);
+          break;
+        }
+      }
+    }
 
-  for (iMarker = 0; iMarker < nMarker; iMarker ++)
     for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
+      iPoint = vertex[iMarker][iVertex]->GetNode();
+      if (!changedVertex[iPoint]) continue;
+      changedVertex[iPoint] = false;
       NormalFace = vertex[iMarker][iVertex]->GetNormal();
       Area = 0.0; for (iDim = 0; iDim < nDim; iDim++) Area += NormalFace[iDim]*NormalFace[iDim];
       Area = sqrt(Area);
       if (Area == 0.0) for (iDim = 0; iDim < nDim; iDim++) NormalFace[iDim] = EPS*EPS;
     }
+  }
 
-}
+  /*--- Max length of the displaced points and of their neighbors. ---*/
 
-void CPhysicalGeometry::SetMaxLength(CConfig* config) {
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    bool update = moved[iPoint];
+    for (unsigned short iNeigh = 0; !update && iNeigh < node[iPoint]->GetnPoint(); iNeigh++)
+      update = moved[node[iPoint]->GetPoint(iNeigh)];
+    if (update) SetPointMaxLength(iPoint);
+  }
 
-  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++){
-    const unsigned short nNeigh = node[iPoint]->GetnPoint();
-    const su2double* Coord_i = node[iPoint]->GetCoord();
+  InitiateComms(this, config, MAX_LENGTH);
+  CompleteComms(this, config, MAX_LENGTH);
 
-    /*--- If using AD, computing the maximum grid length can generate
-     * a lot of unnecessary overhead since we would store all computations
-     * of each grid length, even though we only need the maximum value.
-     * We solve that by finding the neighbor that's furthest away
-     * (corresponding to the maximum distance) using passive calculations,
-     * then set the max using the AD datatype. ---*/
+  /*--- Accumulate the changes for the next coarser level. ---*/
 
-    passivedouble passive_max_delta=0;
-    unsigned short max_neighbor = 0;
-    for (unsigned short iNeigh = 0; iNeigh < nNeigh; iNeigh++) {
+  if (dualGridChanged.size() != nPoint) dualGridChanged.assign(nPoint, true);
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    if (changed[iPoint]) dualGridChanged[iPoint] = true;
+}
 
-      /*-- Calculate the cell-center to cell-center length ---*/
+void CPhysicalGeometry::SetRigidMotion(CConfig *config, const su2double rotMatrix[][3], const su2double *translation) {
 
-      const unsigned long jPoint  = node[iPoint]->GetPoint(iNeigh);
-      const su2double* Coord_j = node[jPoint]->GetCoord();
+  /*--- As for UpdateDualGrid, the rotated dual grid must correspond to the previous coordinates. ---*/
 
-      passivedouble delta_aux = 0;
-      for (unsigned short iDim = 0;iDim < nDim; iDim++){
-        delta_aux += pow(SU2_TYPE::GetValue(Coord_j[iDim])-SU2_TYPE::GetValue(Coord_i[iDim]), 2.);
-      }
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+  const bool rigid = false;
+#else
+  const bool rigid = (DualGrid_Coord.size() == nPoint*nDim);
+#endif
 
-      /*--- Only keep the maximum length ---*/
+  if (!rigid) {
+    UpdateDualGrid(config);
+    return;
+  }
 
-      if (delta_aux > passive_max_delta) {
-        passive_max_delta = delta_aux;
-        max_neighbor = iNeigh;
-      }
-    }
+  /*--- The CGs are cheap to recompute, the volumes and max lengths do not change. ---*/
 
-    /*--- Now that we know where the maximum distance is, repeat
-     * calculation with the AD-friendly su2double datatype ---*/
+  SetCoord_CG();
 
-    const unsigned long jPoint  = node[iPoint]->GetPoint(max_neighbor);
-    const su2double* Coord_j = node[jPoint]->GetCoord();
+  RotateDualGrid(rotMatrix);
 
-    su2double max_delta = 0;
-    for (unsigned short iDim = 0;iDim < nDim; iDim++) {
-      max_delta += pow((Coord_j[iDim]-Coord_i[iDim]), 2.);
-    }
-    max_delta = sqrt(max_delta);
+  UpdateEdgeGeometry();
 
-    node[iPoint]->SetMaxLength(max_delta);
-  }
+  SetLeastSquaresWeights(config);
 
-  InitiateComms(this, config, MAX_LENGTH);
-  CompleteComms(this, config, MAX_LENGTH);
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      DualGrid_Coord[iPoint*nDim+iDim] = node[iPoint]->GetCoord(iDim);
 
+  AddRigidMotion(rotMatrix, translation);
 }
 
 void CPhysicalGeometry::MatchNearField(CConfig *config) {
@@ -8354,96 +9217,54 @@ void CPhysicalGeometry::MatchPeriodic(CConfig        *config,
 }
 
 void CPhysicalGeometry::SetControlVolume(CConfig *config, unsigned short action) {
-  unsigned long face_iPoint = 0, face_jPoint = 0, iPoint, iElem;
-  long iEdge;
-  unsigned short nEdgesFace = 1, iFace, iEdgesFace, iDim;
-  su2double *Coord_Edge_CG, *Coord_FaceElem_CG, *Coord_Elem_CG, *Coord_FaceiPoint, *Coord_FacejPoint, Area,
-  Volume, DomainVolume, my_DomainVolume, *NormalFace = NULL;
-  bool change_face_orientation;
+  unsigned long iPoint;
+  unsigned short iDim;
+  su2double DomainVolume, my_DomainVolume;
 
-  /*--- Update values of faces of the edge ---*/
-  if (action != ALLOCATE) {
-    for (iEdge = 0; iEdge < (long)nEdge; iEdge++)
-      edge[iEdge]->SetZeroValues();
-    for (iPoint = 0; iPoint < nPoint; iPoint++)
-      node[iPoint]->SetVolume (0.0);
-  }
+  /*--- The elements of a color do not share points (nor edges), their contributions to the
+   *    normals of the edges and to the volumes of the points can be added concurrently. ---*/
 
-  Coord_Edge_CG = new su2double [nDim];
-  Coord_FaceElem_CG = new su2double [nDim];
-  Coord_Elem_CG = new su2double [nDim];
-  Coord_FaceiPoint = new su2double [nDim];
-  Coord_FacejPoint = new su2double [nDim];
+  const auto& coloring = GetElementColoring();
+  const auto groupSize = GetElementColorGroupSize();
 
   my_DomainVolume = 0.0;
-  for (iElem = 0; iElem < nElem; iElem++)
-    for (iFace = 0; iFace < elem[iElem]->GetnFaces(); iFace++) {
 
-      /*--- In 2D all the faces have only one edge ---*/
-      if (nDim == 2) nEdgesFace = 1;
-      /*--- In 3D the number of edges per face is the same as the number of point per face ---*/
-      if (nDim == 3) nEdgesFace = elem[iElem]->GetnNodesFace(iFace);
-
-      /*-- Loop over the edges of a face ---*/
-      for (iEdgesFace = 0; iEdgesFace < nEdgesFace; iEdgesFace++) {
+  SU2_OMP_PARALLEL
+  {
+    /*--- Update values of faces of the edge ---*/
+    if (action != ALLOCATE) {
+      SU2_OMP_FOR_STAT(1024)
+      for (long iEdge = 0; iEdge < (long)nEdge; iEdge++)
+        edge[iEdge]->SetZeroValues();
+      SU2_OMP_FOR_STAT(1024)
+      for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
+        node[iPoint]->SetVolume (0.0);
+    }
 
-        /*--- In 2D only one edge (two points) per edge ---*/
-        if (nDim == 2) {
-          face_iPoint = elem[iElem]->GetNode(elem[iElem]->GetFaces(iFace,0));
-          face_jPoint = elem[iElem]->GetNode(elem[iElem]->GetFaces(iFace,1));
-        }
+    su2double threadVolume = 0.0;
 
-        /*--- In 3D there are several edges in each face ---*/
-        if (nDim == 3) {
-          face_iPoint = elem[iElem]->GetNode(elem[iElem]->GetFaces(iFace, iEdgesFace));
-          if (iEdgesFace != nEdgesFace-1)
-            face_jPoint = elem[iElem]->GetNode(elem[iElem]->GetFaces(iFace, iEdgesFace+1));
-          else
-            face_jPoint = elem[iElem]->GetNode(elem[iElem]->GetFaces(iFace,0));
-        }
+    for (unsigned long iColor = 0; iColor < coloring.getOuterSize(); iColor++) {
+      const auto colorElems = coloring.innerIdx(iColor);
+      const unsigned long nColorElem = coloring.getNumNonZeros(iColor);
 
-        /*--- We define a direction (from the smalest index to the greatest) --*/
-        change_face_orientation = false;
-        if (face_iPoint > face_jPoint) change_face_orientation = true;
-        iEdge = FindEdge(face_iPoint, face_jPoint);
+      /*--- Chunks of at least 32 elements, a multiple of the color group size. ---*/
+      SU2_OMP_FOR_DYN(nextMultiple(32, groupSize))
+      for (unsigned long k = 0; k < nColorElem; k++)
+        threadVolume += AddElemControlVolume(colorElems[k]);
+    }
 
-        for (iDim = 0; iDim < nDim; iDim++) {
-          Coord_Edge_CG[iDim] = edge[iEdge]->GetCG(iDim);
-          Coord_Elem_CG[iDim] = elem[iElem]->GetCG(iDim);
-          Coord_FaceElem_CG[iDim] = elem[iElem]->GetFaceCG(iFace, iDim);
-          Coord_FaceiPoint[iDim] = node[face_iPoint]->GetCoord(iDim);
-          Coord_FacejPoint[iDim] = node[face_jPoint]->GetCoord(iDim);
-        }
+    SU2_OMP_CRITICAL
+    my_DomainVolume += threadVolume;
 
-        switch (nDim) {
-          case 2:
-            /*--- Two dimensional problem ---*/
-            if (change_face_orientation) edge[iEdge]->SetNodes_Coord(Coord_Elem_CG, Coord_Edge_CG);
-            else edge[iEdge]->SetNodes_Coord(Coord_Edge_CG, Coord_Elem_CG);
-            Area = edge[iEdge]->GetVolume(Coord_FaceiPoint, Coord_Edge_CG, Coord_Elem_CG);
-            node[face_iPoint]->AddVolume(Area); my_DomainVolume +=Area;
-            Area = edge[iEdge]->GetVolume(Coord_FacejPoint, Coord_Edge_CG, Coord_Elem_CG);
-            node[face_jPoint]->AddVolume(Area); my_DomainVolume +=Area;
-            break;
-          case 3:
-            /*--- Three dimensional problem ---*/
-            if (change_face_orientation) edge[iEdge]->SetNodes_Coord(Coord_FaceElem_CG, Coord_Edge_CG, Coord_Elem_CG);
-            else edge[iEdge]->SetNodes_Coord(Coord_Edge_CG, Coord_FaceElem_CG, Coord_Elem_CG);
-            Volume = edge[iEdge]->GetVolume(Coord_FaceiPoint, Coord_Edge_CG, Coord_FaceElem_CG, Coord_Elem_CG);
-            node[face_iPoint]->AddVolume(Volume); my_DomainVolume +=Volume;
-            Volume = edge[iEdge]->GetVolume(Coord_FacejPoint, Coord_Edge_CG, Coord_FaceElem_CG, Coord_Elem_CG);
-            node[face_jPoint]->AddVolume(Volume); my_DomainVolume +=Volume;
-            break;
-        }
-      }
+    /*--- Check if there is a normal with null area ---*/
+    SU2_OMP_FOR_STAT(1024)
+    for (long iEdge = 0; iEdge < (long)nEdge; iEdge++) {
+      su2double* NormalFace = edge[iEdge]->GetNormal();
+      su2double Area = 0.0;
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) Area += NormalFace[iDim]*NormalFace[iDim];
+      Area = sqrt(Area);
+      if (Area == 0.0) for (unsigned short iDim = 0; iDim < nDim; iDim++) NormalFace[iDim] = EPS*EPS;
     }
-
-  /*--- Check if there is a normal with null area ---*/
-  for (iEdge = 0; iEdge < (long)nEdge; iEdge++) {
-    NormalFace = edge[iEdge]->GetNormal();
-    Area = 0.0; for (iDim = 0; iDim < nDim; iDim++) Area += NormalFace[iDim]*NormalFace[iDim];
-    Area = sqrt(Area);
-    if (Area == 0.0) for (iDim = 0; iDim < nDim; iDim++) NormalFace[iDim] = EPS*EPS;
   }
 
 
@@ -8460,11 +9281,113 @@ void CPhysicalGeometry::SetControlVolume(CConfig *config, unsigned short action)
 
   config->SetDomainVolume(DomainVolume);
 
-  delete[] Coord_Edge_CG;
-  delete[] Coord_FaceElem_CG;
-  delete[] Coord_Elem_CG;
-  delete[] Coord_FaceiPoint;
-  delete[] Coord_FacejPoint;
+  /*--- Geometric factors of the edges used by the numerics, and the least-squares
+   *    weights (recomputed by the next gradient evaluation). ---*/
+
+  SetEdgeGeometry(config);
+
+  SetLeastSquaresWeights(config);
+
+  /*--- Reference for the incremental updates of the dual grid (see UpdateDualGrid),
+   *    and everything changed for the coarse levels. ---*/
+
+#if !(defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
+  DualGrid_Coord.resize(nPoint*nDim);
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    for (iDim = 0; iDim < nDim; iDim++)
+      DualGrid_Coord[iPoint*nDim+iDim] = node[iPoint]->GetCoord(iDim);
+#endif
+  dualGridChanged.assign(nPoint, true);
+}
+
+su2double CPhysicalGeometry::AddElemControlVolume(unsigned long iElem, const vector<bool>* pointMask) {
+  unsigned long face_iPoint = 0, face_jPoint = 0;
+  long iEdge;
+  unsigned short nEdgesFace = 1, iFace, iEdgesFace, iDim;
+  su2double Coord_Edge_CG[3] = {0.0}, Coord_FaceElem_CG[3] = {0.0}, Coord_Elem_CG[3] = {0.0},
+  Coord_FaceiPoint[3] = {0.0}, Coord_FacejPoint[3] = {0.0}, Area, Volume, ElemVolume = 0.0;
+  bool change_face_orientation, add_face, add_iPoint, add_jPoint;
+
+  for (iFace = 0; iFace < elem[iElem]->GetnFaces(); iFace++) {
+
+    /*--- In 2D all the faces have only one edge ---*/
+    if (nDim == 2) nEdgesFace = 1;
+    /*--- In 3D the number of edges per face is the same as the number of point per face ---*/
+    if (nDim == 3) nEdgesFace = elem[iElem]->GetnNodesFace(iFace);
+
+    /*-- Loop over the edges of a face ---*/
+    for (iEdgesFace = 0; iEdgesFace < nEdgesFace; iEdgesFace++) {
+
+      /*--- In 2D only one edge (two points) per edge ---*/
+      if (nDim == 2) {
+        face_iPoint = elem[iElem]->GetNode(elem[iElem]->GetFaces(iFace,0));
+        face_jPoint = elem[iElem]->GetNode(elem[iElem]->GetFaces(iFace,1));
+      }
+
+      /*--- In 3D there are several edges in each face ---*/
+      if (nDim == 3) {
+        face_iPoint = elem[iElem]->GetNode(elem[iElem]->GetFaces(iFace, iEdgesFace));
+        if (iEdgesFace != nEdgesFace-1)
+          face_jPoint = elem[iElem]->GetNode(elem[iElem]->GetFaces(iFace, iEdgesFace+1));
+        else
+          face_jPoint = elem[iElem]->GetNode(elem[iElem]->GetFaces(iFace,0));
+      }
+
+      /*--- Only the flagged parts of the dual grid are updated (incremental update). ---*/
+      add_iPoint = (pointMask == nullptr) || (*pointMask)[face_iPoint];
+      add_jPoint = (pointMask == nullptr) || (*pointMask)[face_jPoint];
+      add_face = add_iPoint && add_jPoint;
+      if (!add_iPoint && !add_jPoint) continue;
+
+      /*--- We define a direction (from the smalest index to the greatest) --*/
+      change_face_orientation = false;
+      if (face_iPoint > face_jPoint) change_face_orientation = true;
+      iEdge = FindEdge(face_iPoint, face_jPoint);
+
+      for (iDim = 0; iDim < nDim; iDim++) {
+        Coord_Edge_CG[iDim] = edge[iEdge]->GetCG(iDim);
+        Coord_Elem_CG[iDim] = elem[iElem]->GetCG(iDim);
+        Coord_FaceElem_CG[iDim] = elem[iElem]->GetFaceCG(iFace, iDim);
+        Coord_FaceiPoint[iDim] = node[face_iPoint]->GetCoord(iDim);
+        Coord_FacejPoint[iDim] = node[face_jPoint]->GetCoord(iDim);
+      }
+
+      switch (nDim) {
+        case 2:
+          /*--- Two dimensional problem ---*/
+          if (add_face) {
+            if (change_face_orientation) edge[iEdge]->SetNodes_Coord(Coord_Elem_CG, Coord_Edge_CG);
+            else edge[iEdge]->SetNodes_Coord(Coord_Edge_CG, Coord_Elem_CG);
+          }
+          if (add_iPoint) {
+            Area = edge[iEdge]->GetVolume(Coord_FaceiPoint, Coord_Edge_CG, Coord_Elem_CG);
+            node[face_iPoint]->AddVolume(Area); ElemVolume += Area;
+          }
+          if (add_jPoint) {
+            Area = edge[iEdge]->GetVolume(Coord_FacejPoint, Coord_Edge_CG, Coord_Elem_CG);
+            node[face_jPoint]->AddVolume(Area); ElemVolume += Area;
+          }
+          break;
+        case 3:
+          /*--- Three dimensional problem ---*/
+          if (add_face) {
+            if (change_face_orientation) edge[iEdge]->SetNodes_Coord(Coord_FaceElem_CG, Coord_Edge_CG, Coord_Elem_CG);
+            else edge[iEdge]->SetNodes_Coord(Coord_Edge_CG, Coord_FaceElem_CG, Coord_Elem_CG);
+          }
+          if (add_iPoint) {
+            Volume = edge[iEdge]->GetVolume(Coord_FaceiPoint, Coord_Edge_CG, Coord_FaceElem_CG, Coord_Elem_CG);
+            node[face_iPoint]->AddVolume(Volume); ElemVolume += Volume;
+          }
+          if (add_jPoint) {
+            Volume = edge[iEdge]->GetVolume(Coord_FacejPoint, Coord_Edge_CG, Coord_FaceElem_CG, Coord_Elem_CG);
+            node[face_jPoint]->AddVolume(Volume); ElemVolume += Volume;
+          }
+          break;
+      }
+    }
+  }
+
+  return ElemVolume;
 }
 
 void CPhysicalGeometry::VisualizeControlVolume(CConfig *config, unsigned short action) {
@@ -9095,24 +10018,33 @@ void CPhysicalGeometry::SetColorGrid_Parallel(CConfig *config) {
     idx_t *vtxdist = new idx_t[size+1];
     idx_t *part    = new idx_t[nPoint];
 
-    real_t ubvec;
-    real_t *tpwgts = new real_t[size];
+    real_t *tpwgts = new real_t[2*size];
+
+    /*--- Vertex weights that account for the work of the boundary points. ---*/
+
+    vector<idx_t> vwgt;
+    ncon = 1;
+
+    if ((config->GetKind_Partition_Weights() != NO_PARTITION_WEIGHTS) || !PointWeights.empty())
+      ncon = SetPartitionWeights(config, vwgt);
 
     /*--- Some recommended defaults for the various ParMETIS options. ---*/
 
-    wgtflag = 0;
+    wgtflag = vwgt.empty()? 0 : 2;
     numflag = 0;
-    ncon    = 1;
-    ubvec   = 1.05;
     nparts  = (idx_t)size;
     idx_t options[METIS_NOPTIONS];
     METIS_SetDefaultOptions(options);
     options[1] = 0;
 
-    /*--- Fill the necessary ParMETIS data arrays. We do not apply
-     any weighting during the partitioning process. ---*/
+    /*--- The boundary work is concentrated on fewer points, it is balanced less strictly. ---*/
 
-    for (int i = 0; i < size; i++) {
+    real_t ubvec[2] = {1.05, 1.10};
+
+    /*--- Fill the necessary ParMETIS data arrays, all partitions have the
+     same share of each constraint. ---*/
+
+    for (int i = 0; i < ncon*size; i++) {
       tpwgts[i] = 1.0/((real_t)size);
     }
 
@@ -9124,8 +10056,8 @@ void CPhysicalGeometry::SetColorGrid_Parallel(CConfig *config) {
     /*--- Calling ParMETIS ---*/
 
     if (rank == MASTER_NODE) cout << "Calling ParMETIS...";
-    ParMETIS_V3_PartKway(vtxdist, xadj, adjacency, NULL, NULL, &wgtflag,
-                         &numflag, &ncon, &nparts, tpwgts, &ubvec, options,
+    ParMETIS_V3_PartKway(vtxdist, xadj, adjacency, vwgt.empty()? NULL : vwgt.data(), NULL, &wgtflag,
+                         &numflag, &ncon, &nparts, tpwgts, ubvec, options,
                          &edgecut, part, &comm);
     if (rank == MASTER_NODE) {
       cout << " graph partitioning complete (";
@@ -9159,6 +10091,110 @@ void CPhysicalGeometry::SetColorGrid_Parallel(CConfig *config) {
 
 }
 
+#ifdef HAVE_MPI
+#ifdef HAVE_PARMETIS
+idx_t CPhysicalGeometry::SetPartitionWeights(CConfig *config, vector<idx_t>& vwgt) const {
+
+  /*--- ParMETIS uses integer weights, an interior point has a weight of WEIGHT_SCALE. ---*/
+
+  const passivedouble WEIGHT_SCALE = 10.0;
+
+  const bool markerWeights = (config->GetKind_Partition_Weights() != NO_PARTITION_WEIGHTS);
+
+  CLinearPartitioner pointPartitioner(Global_nPointDomain,0);
+  const unsigned long firstIndex = pointPartitioner.GetFirstIndexOnRank(rank);
+
+  /*--- The master node holds all the markers, it finds the points of the weighted
+   markers (a point on several markers takes the largest weight) and sends them to
+   the ranks that own them in the linear partitioning. ---*/
+
+  vector<int> nSend(size,0), nRecv(size,0), sendOffset(size+1,0), recvOffset(size+1,0);
+  vector<unsigned long> idSend;
+  vector<passivedouble> weightSend;
+
+  if (markerWeights && (rank == MASTER_NODE)) {
+    map<unsigned long, passivedouble> pointWeight;
+
+    for (unsigned short iMarker = 0; iMarker < nMarker; iMarker++) {
+      const string Marker_Tag = config->GetMarker_All_TagBound(iMarker);
+      const passivedouble weight = SU2_TYPE::GetValue(config->GetMarker_PartitionWeight(Marker_Tag));
+      if (weight <= 0.0) continue;
+
+      for (unsigned long iElem = 0; iElem < nElem_Bound[iMarker]; iElem++) {
+        for (unsigned short iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++) {
+          const unsigned long iPoint = bound[iMarker][iElem]->GetNode(iNode);
+          if (iPoint >= Global_nPointDomain) continue;
+          passivedouble& pw = pointWeight[iPoint];
+          pw = max(pw, weight);
+        }
+      }
+    }
+
+    /*--- The map is sorted by global index, hence by rank. ---*/
+
+    for (const auto& pw : pointWeight) {
+      nSend[pointPartitioner.GetRankContainingIndex(pw.first)]++;
+      idSend.push_back(pw.first);
+      weightSend.push_back(pw.second);
+    }
+  }
+
+  SU2_MPI::Alltoall(nSend.data(), 1, MPI_INT, nRecv.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+  for (int iRank = 0; iRank < size; iRank++) {
+    sendOffset[iRank+1] = sendOffset[iRank] + nSend[iRank];
+    recvOffset[iRank+1] = recvOffset[iRank] + nRecv[iRank];
+  }
+
+  vector<unsigned long> idRecv(recvOffset[size]);
+  vector<passivedouble> weightRecv(recvOffset[size]);
+
+  SU2_MPI::Alltoallv(idSend.data(), nSend.data(), sendOffset.data(), MPI_UNSIGNED_LONG,
+                     idRecv.data(), nRecv.data(), recvOffset.data(), MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+  SU2_MPI::Alltoallv(weightSend.data(), nSend.data(), sendOffset.data(), MPI_DOUBLE,
+                     weightRecv.data(), nRecv.data(), recvOffset.data(), MPI_DOUBLE, MPI_COMM_WORLD);
+
+  /*--- Without weighted points, or work measured for the points, the partitioning is not weighted. ---*/
+
+  unsigned long nWeighted = idRecv.size(), nWeightedGlobal = 0;
+  SU2_MPI::Allreduce(&nWeighted, &nWeightedGlobal, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+
+  if (nWeightedGlobal == 0) {
+    if (markerWeights && (rank == MASTER_NODE))
+      cout << "No points on markers with a partitioning weight (MARKER_PARTITION_WEIGHT)." << endl;
+    if (PointWeights.empty()) return 1;
+  }
+
+  /*--- With multiple constraints the volume work (first constraint) and the boundary
+   work (second constraint) are balanced separately, otherwise they are added. ---*/
+
+  const bool multiConstraint = (nWeightedGlobal > 0) &&
+                               (config->GetKind_Partition_Weights() == MULTI_CONSTRAINT_WEIGHTS);
+  const idx_t ncon = multiConstraint? 2 : 1;
+
+  vwgt.assign(nPoint*ncon, 0);
+
+  /*--- The volume work of a point is scaled by its measured work (relative to an average point). ---*/
+
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+    const passivedouble work = PointWeights.empty()? 1.0 : PointWeights[iPoint];
+    vwgt[iPoint*ncon] = max<idx_t>(1, static_cast<idx_t>(round(WEIGHT_SCALE*work)));
+  }
+
+  for (unsigned long iRecv = 0; iRecv < idRecv.size(); iRecv++) {
+    const unsigned long iPoint = idRecv[iRecv] - firstIndex;
+    const idx_t weight = max<idx_t>(1, static_cast<idx_t>(round(WEIGHT_SCALE*weightRecv[iRecv])));
+
+    if (multiConstraint) vwgt[iPoint*ncon+1] = weight;
+    else vwgt[iPoint] += weight;
+  }
+
+  return ncon;
+
+}
+#endif
+#endif
+
 void CPhysicalGeometry::ComputeMeshQualityStatistics(CConfig *config) {
 
   /*--- Resize our vectors for the 3 metrics: orthogonality, aspect
@@ -9177,103 +10213,106 @@ void CPhysicalGeometry::ComputeMeshQualityStatistics(CConfig *config) {
   vector<su2double> SubVolume_Min(nPoint,1.e6);
 
   /*--- Orthogonality and aspect ratio (areas) are computed by
-   looping over all edges to check the angles and the face areas. ---*/
+   looping over all edges to check the angles and the face areas.
+   The loop is over the edges of each point, such that the points are
+   independent (threaded loop), each edge is visited by its two points.
+   The first invalid edge or point is reported after the loop. ---*/
 
-  for (unsigned long iEdge = 0; iEdge < nEdge; iEdge++) {
+  const auto invalid = numeric_limits<unsigned long>::max();
+  unsigned long zeroAreaEdge = invalid, zeroVolumePoint = invalid;
 
-    /*--- Point identification, edge normal vector and area ---*/
+  SU2_OMP_PARALLEL_(for schedule(dynamic,256))
+  for (unsigned long kPoint = 0; kPoint < nPoint; kPoint++) {
 
-    const unsigned long iPoint = edge[iEdge]->GetNode(0);
-    const unsigned long jPoint = edge[iEdge]->GetNode(1);
+    for (unsigned short iNeigh = 0; iNeigh < node[kPoint]->GetnPoint(); iNeigh++) {
 
-    const unsigned long GlobalIndex_i = node[iPoint]->GetGlobalIndex();
-    const unsigned long GlobalIndex_j = node[iPoint]->GetGlobalIndex();
+      /*--- Point identification, edge normal vector and area ---*/
 
-    /*-- Area normal for the current edge. Recall that this normal
-     is computed by summing the normals of adjacent faces along
-     the edge between iPoint & jPoint. ---*/
+      const unsigned long iEdge  = node[kPoint]->GetEdge(iNeigh);
+      const unsigned long iPoint = edge[iEdge]->GetNode(0);
+      const unsigned long jPoint = edge[iEdge]->GetNode(1);
 
-    const su2double *Normal = edge[iEdge]->GetNormal();
+      /*-- Area normal for the current edge. Recall that this normal
+       is computed by summing the normals of adjacent faces along
+       the edge between iPoint & jPoint. ---*/
 
-    /*--- Get the coordinates for point i & j. ---*/
+      const su2double *Normal = edge[iEdge]->GetNormal();
 
-    const su2double *Coord_i = node[iPoint]->GetCoord();
-    const su2double *Coord_j = node[jPoint]->GetCoord();
+      /*--- Get the coordinates for point i & j. ---*/
 
-    /*--- Compute the vector pointing from iPoint to jPoint and
-     its distance. We also compute face area (norm of the normal vector). ---*/
+      const su2double *Coord_i = node[iPoint]->GetCoord();
+      const su2double *Coord_j = node[jPoint]->GetCoord();
 
-    su2double distance = 0.0;
-    su2double area     = 0.0;
-    vector<su2double> edgeVector(nDim);
-    for (unsigned short iDim = 0; iDim < nDim; iDim++) {
-      edgeVector[iDim] = Coord_j[iDim]-Coord_i[iDim];
-      distance        += edgeVector[iDim]*edgeVector[iDim];
-      area            += Normal[iDim]*Normal[iDim];
-    }
-    distance = sqrt(distance);
-    area     = sqrt(area);
+      /*--- Compute the vector pointing from iPoint to jPoint and
+       its distance. We also compute face area (norm of the normal vector).
+       Both flip for the other point of the edge, the angle does not. ---*/
 
-    /*--- Aspect ratio is the ratio between the largest and smallest
-     faces making up the boundary of the dual CV and is a measure
-     of the aspect ratio of the dual control volume. Smaller
-     is better (closer to isotropic). ----*/
+      su2double distance = 0.0;
+      su2double area     = 0.0;
+      su2double edgeVector[3] = {0.0, 0.0, 0.0};
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+        edgeVector[iDim] = Coord_j[iDim]-Coord_i[iDim];
+        distance        += edgeVector[iDim]*edgeVector[iDim];
+        area            += Normal[iDim]*Normal[iDim];
+      }
+      distance = sqrt(distance);
+      area     = sqrt(area);
 
-    if (node[iPoint]->GetDomain()) {
-      Area_Min[iPoint] = min(Area_Min[iPoint], area);
-      Area_Max[iPoint] = max(Area_Max[iPoint], area);
-    }
+      if (area <= 0.0) {
+        SU2_OMP_CRITICAL
+        if (zeroAreaEdge == invalid) zeroAreaEdge = iEdge;
+        continue;
+      }
 
-    if (node[jPoint]->GetDomain()) {
-      Area_Min[jPoint] = min(Area_Min[jPoint], area);
-      Area_Max[jPoint] = max(Area_Max[jPoint], area);
-    }
+      if (!node[kPoint]->GetDomain()) continue;
 
-    if (area <= 0.0) {
-      char buf[200];
-      SPRINTF(buf, "Zero-area CV face found for edge (%lu,%lu).",
-              GlobalIndex_i, GlobalIndex_j);
-      SU2_MPI::Error(string(buf), CURRENT_FUNCTION);
-    }
+      /*--- Aspect ratio is the ratio between the largest and smallest
+       faces making up the boundary of the dual CV and is a measure
+       of the aspect ratio of the dual control volume. Smaller
+       is better (closer to isotropic). ----*/
 
-    /*--- Compute the angle between the unit normal associated
-     with the edge and the unit vector pointing from iPoint to jPoint. ---*/
+      Area_Min[kPoint] = min(Area_Min[kPoint], area);
+      Area_Max[kPoint] = max(Area_Max[kPoint], area);
 
-    su2double dotProduct = 0.0;
-    for (unsigned short iDim = 0; iDim < nDim; iDim++) {
-      dotProduct += (Normal[iDim]/area)*(edgeVector[iDim]/distance);
-    }
+      /*--- Compute the angle between the unit normal associated
+       with the edge and the unit vector pointing from iPoint to jPoint. ---*/
+
+      su2double dotProduct = 0.0;
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+        dotProduct += (Normal[iDim]/area)*(edgeVector[iDim]/distance);
+      }
 
-    /*--- The definition of orthogonality is an area-weighted average of
-     90 degrees minus the angle between the face area unit normal and
-     the vector between i & j. If the two are perfectly aligned, then
-     the orthogonality is the desired max of 90 degrees. If they are
-     not aligned, the orthogonality will reduce from there. Good values
-     are close to 90 degress, poor values are typically below 20 degress. ---*/
+      /*--- The definition of orthogonality is an area-weighted average of
+       90 degrees minus the angle between the face area unit normal and
+       the vector between i & j. If the two are perfectly aligned, then
+       the orthogonality is the desired max of 90 degrees. If they are
+       not aligned, the orthogonality will reduce from there. Good values
+       are close to 90 degress, poor values are typically below 20 degress. ---*/
 
-    if (node[iPoint]->GetDomain()) {
-      Orthogonality[iPoint] += area*(90.0 - acos(dotProduct)*180.0/PI_NUMBER);
-      SurfaceArea[iPoint]   += area;
-    }
-    if (node[jPoint]->GetDomain()) {
-      Orthogonality[jPoint] += area*(90.0 - acos(dotProduct)*180.0/PI_NUMBER);
-      SurfaceArea[jPoint]   += area;
+      Orthogonality[kPoint] += area*(90.0 - acos(dotProduct)*180.0/PI_NUMBER);
+      SurfaceArea[kPoint]   += area;
     }
 
-    /*--- Error check for zero volume of the dual CVs. ---*/
+    /*--- Error check for zero volume of the dual CVs (of the points of edges). ---*/
 
-    if (node[iPoint]->GetVolume() <= 0.0) {
-      char buf[200];
-      SPRINTF(buf, "Zero-area CV face found for point %lu.", GlobalIndex_i);
-      SU2_MPI::Error(string(buf), CURRENT_FUNCTION);
+    if ((node[kPoint]->GetnPoint() > 0) && (node[kPoint]->GetVolume() <= 0.0)) {
+      SU2_OMP_CRITICAL
+      if (zeroVolumePoint == invalid) zeroVolumePoint = kPoint;
     }
+  }
 
-    if (node[jPoint]->GetVolume() <= 0.0) {
-      char buf[200];
-      SPRINTF(buf, "Zero-area CV face found for point %lu.", GlobalIndex_j);
-      SU2_MPI::Error(string(buf), CURRENT_FUNCTION);
-    }
+  if (zeroAreaEdge != invalid) {
+    char buf[200];
+    SPRINTF(buf, "Zero-area CV face found for edge (%lu,%lu).",
+            node[edge[zeroAreaEdge]->GetNode(0)]->GetGlobalIndex(),
+            node[edge[zeroAreaEdge]->GetNode(1)]->GetGlobalIndex());
+    SU2_MPI::Error(string(buf), CURRENT_FUNCTION);
+  }
 
+  if (zeroVolumePoint != invalid) {
+    char buf[200];
+    SPRINTF(buf, "Zero-volume CV found for point %lu.", node[zeroVolumePoint]->GetGlobalIndex());
+    SU2_MPI::Error(string(buf), CURRENT_FUNCTION);
   }
 
   /*--- Loop boundary edges to include the area of the boundary elements.  ---*/
@@ -9419,39 +10458,44 @@ void CPhysicalGeometry::ComputeMeshQualityStatistics(CConfig *config) {
 
   su2double orthoMin = 1.e6, arMin = 1.e6, vrMin = 1.e6;
   su2double orthoMax = 0.0,  arMax = 0.0,  vrMax = 0.0;
-  for (unsigned long iPoint= 0; iPoint < nPointDomain; iPoint++) {
-    Orthogonality[iPoint] = Orthogonality[iPoint]/SurfaceArea[iPoint];
-    orthoMin = min(Orthogonality[iPoint], orthoMin);
-    orthoMax = max(Orthogonality[iPoint], orthoMax);
 
-    Aspect_Ratio[iPoint] = Area_Max[iPoint]/Area_Min[iPoint];
-    arMin = min(Aspect_Ratio[iPoint], arMin);
-    arMax = max(Aspect_Ratio[iPoint], arMax);
+  SU2_OMP_PARALLEL
+  {
+    su2double thrOrthoMin = 1.e6, thrArMin = 1.e6, thrVrMin = 1.e6;
+    su2double thrOrthoMax = 0.0,  thrArMax = 0.0,  thrVrMax = 0.0;
 
-    Volume_Ratio[iPoint] = SubVolume_Max[iPoint]/SubVolume_Min[iPoint];
-    vrMin = min(Volume_Ratio[iPoint], vrMin);
-    vrMax = max(Volume_Ratio[iPoint], vrMax);
-  }
+    SU2_OMP_FOR_STAT(1024)
+    for (unsigned long iPoint= 0; iPoint < nPointDomain; iPoint++) {
+      Orthogonality[iPoint] = Orthogonality[iPoint]/SurfaceArea[iPoint];
+      thrOrthoMin = min(Orthogonality[iPoint], thrOrthoMin);
+      thrOrthoMax = max(Orthogonality[iPoint], thrOrthoMax);
+
+      Aspect_Ratio[iPoint] = Area_Max[iPoint]/Area_Min[iPoint];
+      thrArMin = min(Aspect_Ratio[iPoint], thrArMin);
+      thrArMax = max(Aspect_Ratio[iPoint], thrArMax);
+
+      Volume_Ratio[iPoint] = SubVolume_Max[iPoint]/SubVolume_Min[iPoint];
+      thrVrMin = min(Volume_Ratio[iPoint], thrVrMin);
+      thrVrMax = max(Volume_Ratio[iPoint], thrVrMax);
+    }
 
-  /*--- Reduction to find the min and max values globally. ---*/
+    SU2_OMP_CRITICAL
+    {
+      orthoMin = min(orthoMin, thrOrthoMin); orthoMax = max(orthoMax, thrOrthoMax);
+      arMin = min(arMin, thrArMin); arMax = max(arMax, thrArMax);
+      vrMin = min(vrMin, thrVrMin); vrMax = max(vrMax, thrVrMax);
+    }
+  }
 
-  su2double Global_Ortho_Min, Global_Ortho_Max;
-  SU2_MPI::Allreduce(&orthoMin, &Global_Ortho_Min, 1,
-                     MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&orthoMax, &Global_Ortho_Max, 1,
-                     MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  /*--- One reduction to find the min and max values globally
+   (the max is the min of the negated values). ---*/
 
-  su2double Global_AR_Min, Global_AR_Max;
-  SU2_MPI::Allreduce(&arMin, &Global_AR_Min, 1,
-                     MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&arMax, &Global_AR_Max, 1,
-                     MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  su2double MyMin[6] = {orthoMin, arMin, vrMin, -orthoMax, -arMax, -vrMax}, Min[6];
+  SU2_MPI::Allreduce(MyMin, Min, 6, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
 
-  su2double Global_VR_Min, Global_VR_Max;
-  SU2_MPI::Allreduce(&vrMin, &Global_VR_Min, 1,
-                     MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&vrMax, &Global_VR_Max, 1,
-                     MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  const su2double Global_Ortho_Min = Min[0], Global_Ortho_Max = -Min[3];
+  const su2double Global_AR_Min = Min[1], Global_AR_Max = -Min[4];
+  const su2double Global_VR_Min = Min[2], Global_VR_Max = -Min[5];
 
   /*--- Print the summary to the console for the user. ---*/
 
@@ -9664,7 +10708,7 @@ void CPhysicalGeometry::SetBoundSensitivity(CConfig *config) {
 
 }
 
-void CPhysicalGeometry::SetSensitivity(CConfig *config) {
+void CPhysicalGeometry::SetSensitivity(CConfig *config, short val_obj) {
 
   ifstream restart_file;
   string filename = config->GetSolution_AdjFileName();
@@ -9693,7 +10737,7 @@ void CPhysicalGeometry::SetSensitivity(CConfig *config) {
 
   filename = config->GetSolution_AdjFileName();
 
-  filename = config->GetObjFunc_Extension(filename);
+  filename = config->GetObjFunc_Extension(filename, val_obj);
 
 
   if (config->GetRead_Binary_Restart()) {
@@ -9734,7 +10778,9 @@ void CPhysicalGeometry::SetSensitivity(CConfig *config) {
     /*--- Check that this is an SU2 binary file. SU2 binary files
      have the hex representation of "SU2" as the first int in the file. ---*/
 
-    if (Restart_Vars[0] != 535532) {
+    const bool compressed = (Restart_Vars[0] == SU2_COMPRESSED_RESTART_ID);
+
+    if ((Restart_Vars[0] != 535532) && !compressed) {
       SU2_MPI::Error(string("File ") + string(fname) + string(" is not a binary SU2 restart file.\n") +
                      string("SU2 reads/writes binary restart files by default.\n") +
                      string("Note that backward compatibility for ASCII restart files is\n") +
@@ -9759,39 +10805,48 @@ void CPhysicalGeometry::SetSensitivity(CConfig *config) {
       config->fields.push_back(str_buf);
     }
 
-    /*--- For now, create a temp 1D buffer to read the data from file. ---*/
+    /*--- The data of compressed files is decompressed by the toolbox (they have no metadata). ---*/
 
-    Restart_Data = new passivedouble[nFields*GetnPointDomain()];
+    if (compressed) {
+      fclose(fhw);
+      Restart_Data = CompressionToolbox::ReadRestartData(filename, Restart_Vars, this);
+    }
+    else {
 
-    /*--- Read in the data for the restart at all local points. ---*/
+      /*--- For now, create a temp 1D buffer to read the data from file. ---*/
 
-    ret = fread(Restart_Data, sizeof(passivedouble), nFields*GetnPointDomain(), fhw);
-    if (ret != (unsigned long)nFields*GetnPointDomain()) {
-      SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
-    }
+      Restart_Data = new passivedouble[nFields*GetnPointDomain()];
 
-    /*--- Compute (negative) displacements and grab the metadata. ---*/
+      /*--- Read in the data for the restart at all local points. ---*/
 
-    ret = sizeof(int) + 8*sizeof(passivedouble);
-    fseek(fhw,-ret, SEEK_END);
+      ret = fread(Restart_Data, sizeof(passivedouble), nFields*GetnPointDomain(), fhw);
+      if (ret != (unsigned long)nFields*GetnPointDomain()) {
+        SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+      }
 
-    /*--- Read the external iteration. ---*/
+      /*--- Compute (negative) displacements and grab the metadata. ---*/
 
-    ret = fread(&Restart_Iter, sizeof(int), 1, fhw);
-    if (ret != 1) {
-      SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
-    }
+      ret = sizeof(int) + 8*sizeof(passivedouble);
+      fseek(fhw,-ret, SEEK_END);
 
-    /*--- Read the metadata. ---*/
+      /*--- Read the external iteration. ---*/
 
-    ret = fread(Restart_Meta_Passive, sizeof(passivedouble), 8, fhw);
-    if (ret != 8) {
-      SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
-    }
+      ret = fread(&Restart_Iter, sizeof(int), 1, fhw);
+      if (ret != 1) {
+        SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+      }
 
-    /*--- Close the file. ---*/
+      /*--- Read the metadata. ---*/
 
-    fclose(fhw);
+      ret = fread(Restart_Meta_Passive, sizeof(passivedouble), 8, fhw);
+      if (ret != 8) {
+        SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+      }
+
+      /*--- Close the file. ---*/
+
+      fclose(fhw);
+    }
 
 #else
 
@@ -9830,7 +10885,9 @@ void CPhysicalGeometry::SetSensitivity(CConfig *config) {
     /*--- Check that this is an SU2 binary file. SU2 binary files
      have the hex representation of "SU2" as the first int in the file. ---*/
 
-    if (Restart_Vars[0] != 535532) {
+    const bool compressed = (Restart_Vars[0] == SU2_COMPRESSED_RESTART_ID);
+
+    if ((Restart_Vars[0] != 535532) && !compressed) {
 
       SU2_MPI::Error(string("File ") + string(fname) + string(" is not a binary SU2 restart file.\n") +
                      string("SU2 reads/writes binary restart files by default.\n") +
@@ -9876,89 +10933,98 @@ void CPhysicalGeometry::SetSensitivity(CConfig *config) {
 
     delete [] mpi_str_buf;
 
-    /*--- We're writing only su2doubles in the data portion of the file. ---*/
+    /*--- The data of compressed files is decompressed by the toolbox (they have no metadata). ---*/
 
-    etype = MPI_DOUBLE;
+    if (compressed) {
+      MPI_File_close(&fhw);
+      Restart_Data = CompressionToolbox::ReadRestartData(filename, Restart_Vars, this);
+    }
+    else {
 
-    /*--- We need to ignore the 4 ints describing the nVar_Restart and nPoints,
-     along with the string names of the variables. ---*/
+      /*--- We're writing only su2doubles in the data portion of the file. ---*/
 
-    disp = nRestart_Vars*sizeof(int) + CGNS_STRING_SIZE*nFields*sizeof(char);
+      etype = MPI_DOUBLE;
 
-    /*--- Define a derived datatype for this rank's set of non-contiguous data
-     that will be placed in the restart. Here, we are collecting each one of the
-     points which are distributed throughout the file in blocks of nVar_Restart data. ---*/
+      /*--- We need to ignore the 4 ints describing the nVar_Restart and nPoints,
+       along with the string names of the variables. ---*/
 
-    int *blocklen = new int[GetnPointDomain()];
-    int *displace = new int[GetnPointDomain()];
+      disp = nRestart_Vars*sizeof(int) + CGNS_STRING_SIZE*nFields*sizeof(char);
 
-    counter = 0;
-    for (iPoint_Global = 0; iPoint_Global < GetGlobal_nPointDomain(); iPoint_Global++ ) {
-      if (GetGlobal_to_Local_Point(iPoint_Global) > -1) {
-        blocklen[counter] = nFields;
-        displace[counter] = iPoint_Global*nFields;
-        counter++;
+      /*--- Define a derived datatype for this rank's set of non-contiguous data
+       that will be placed in the restart. Here, we are collecting each one of the
+       points which are distributed throughout the file in blocks of nVar_Restart data. ---*/
+
+      int *blocklen = new int[GetnPointDomain()];
+      int *displace = new int[GetnPointDomain()];
+
+      counter = 0;
+      for (iPoint_Global = 0; iPoint_Global < GetGlobal_nPointDomain(); iPoint_Global++ ) {
+        if (GetGlobal_to_Local_Point(iPoint_Global) > -1) {
+          blocklen[counter] = nFields;
+          displace[counter] = iPoint_Global*nFields;
+          counter++;
+        }
       }
-    }
-    MPI_Type_indexed(GetnPointDomain(), blocklen, displace, MPI_DOUBLE, &filetype);
-    MPI_Type_commit(&filetype);
+      MPI_Type_indexed(GetnPointDomain(), blocklen, displace, MPI_DOUBLE, &filetype);
+      MPI_Type_commit(&filetype);
 
-    /*--- Set the view for the MPI file write, i.e., describe the location in
-     the file that this rank "sees" for writing its piece of the restart file. ---*/
+      /*--- Set the view for the MPI file write, i.e., describe the location in
+       the file that this rank "sees" for writing its piece of the restart file. ---*/
 
-    MPI_File_set_view(fhw, disp, etype, filetype, (char*)"native", MPI_INFO_NULL);
+      MPI_File_set_view(fhw, disp, etype, filetype, (char*)"native", MPI_INFO_NULL);
 
-    /*--- For now, create a temp 1D buffer to read the data from file. ---*/
+      /*--- For now, create a temp 1D buffer to read the data from file. ---*/
 
-    Restart_Data = new passivedouble[nFields*GetnPointDomain()];
+      Restart_Data = new passivedouble[nFields*GetnPointDomain()];
 
-    /*--- Collective call for all ranks to read from their view simultaneously. ---*/
+      /*--- Collective call for all ranks to read from their view simultaneously. ---*/
 
-    MPI_File_read_all(fhw, Restart_Data, nFields*GetnPointDomain(), MPI_DOUBLE, &status);
+      MPI_File_read_all(fhw, Restart_Data, nFields*GetnPointDomain(), MPI_DOUBLE, &status);
 
-    /*--- Free the derived datatype. ---*/
+      /*--- Free the derived datatype. ---*/
 
-    MPI_Type_free(&filetype);
+      MPI_Type_free(&filetype);
 
-    /*--- Reset the file view before writing the metadata. ---*/
+      /*--- Reset the file view before writing the metadata. ---*/
 
-    MPI_File_set_view(fhw, 0, MPI_BYTE, MPI_BYTE, (char*)"native", MPI_INFO_NULL);
+      MPI_File_set_view(fhw, 0, MPI_BYTE, MPI_BYTE, (char*)"native", MPI_INFO_NULL);
 
-    /*--- Access the metadata. ---*/
+      /*--- Access the metadata. ---*/
 
-    if (rank == MASTER_NODE) {
+      if (rank == MASTER_NODE) {
 
-      /*--- External iteration. ---*/
-      disp = (nRestart_Vars*sizeof(int) + nFields*CGNS_STRING_SIZE*sizeof(char) +
-              nFields*Restart_Vars[2]*sizeof(passivedouble));
-      MPI_File_read_at(fhw, disp, &Restart_Iter, 1, MPI_INT, MPI_STATUS_IGNORE);
+        /*--- External iteration. ---*/
+        disp = (nRestart_Vars*sizeof(int) + nFields*CGNS_STRING_SIZE*sizeof(char) +
+                nFields*Restart_Vars[2]*sizeof(passivedouble));
+        MPI_File_read_at(fhw, disp, &Restart_Iter, 1, MPI_INT, MPI_STATUS_IGNORE);
 
-      /*--- Additional doubles for AoA, AoS, etc. ---*/
+        /*--- Additional doubles for AoA, AoS, etc. ---*/
 
-      disp = (nRestart_Vars*sizeof(int) + nFields*CGNS_STRING_SIZE*sizeof(char) +
-              nFields*Restart_Vars[2]*sizeof(passivedouble) + 1*sizeof(int));
-      MPI_File_read_at(fhw, disp, Restart_Meta_Passive, 8, MPI_DOUBLE, MPI_STATUS_IGNORE);
+        disp = (nRestart_Vars*sizeof(int) + nFields*CGNS_STRING_SIZE*sizeof(char) +
+                nFields*Restart_Vars[2]*sizeof(passivedouble) + 1*sizeof(int));
+        MPI_File_read_at(fhw, disp, Restart_Meta_Passive, 8, MPI_DOUBLE, MPI_STATUS_IGNORE);
 
-    }
+      }
 
-    /*--- Communicate metadata. ---*/
+      /*--- Communicate metadata. ---*/
 
-    SU2_MPI::Bcast(&Restart_Iter, 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+      SU2_MPI::Bcast(&Restart_Iter, 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
 
-    /*--- Copy to a su2double structure (because of the SU2_MPI::Bcast
-              doesn't work with passive data)---*/
+      /*--- Copy to a su2double structure (because of the SU2_MPI::Bcast
+                doesn't work with passive data)---*/
 
-    for (unsigned short iVar = 0; iVar < 8; iVar++)
-      Restart_Meta[iVar] = Restart_Meta_Passive[iVar];
+      for (unsigned short iVar = 0; iVar < 8; iVar++)
+        Restart_Meta[iVar] = Restart_Meta_Passive[iVar];
 
-    SU2_MPI::Bcast(Restart_Meta, 8, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+      SU2_MPI::Bcast(Restart_Meta, 8, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
 
-    /*--- All ranks close the file after writing. ---*/
+      /*--- All ranks close the file after writing. ---*/
 
-    MPI_File_close(&fhw);
+      MPI_File_close(&fhw);
 
-    delete [] blocklen;
-    delete [] displace;
+      delete [] blocklen;
+      delete [] displace;
+    }
 
 #endif
 
@@ -10051,7 +11117,7 @@ void CPhysicalGeometry::SetSensitivity(CConfig *config) {
     /*--- Check that this is an SU2 binary file. SU2 binary files
      have the hex representation of "SU2" as the first int in the file. ---*/
 
-    if (magic_number == 535532) {
+    if ((magic_number == 535532) || (magic_number == SU2_COMPRESSED_RESTART_ID)) {
       SU2_MPI::Error(string("File ") + string(fname) + string(" is a binary SU2 restart file, expected ASCII.\n") +
                      string("SU2 reads/writes binary restart files by default.\n") +
                      string("Note that backward compatibility for ASCII restart files is\n") +
@@ -10089,7 +11155,7 @@ void CPhysicalGeometry::SetSensitivity(CConfig *config) {
     /*--- Check that this is an SU2 binary file. SU2 binary files
      have the hex representation of "SU2" as the first int in the file. ---*/
 
-    if (magic_number == 535532) {
+    if ((magic_number == 535532) || (magic_number == SU2_COMPRESSED_RESTART_ID)) {
 
       SU2_MPI::Error(string("File ") + string(fname) + string(" is a binary SU2 restart file, expected ASCII.\n") +
                      string("SU2 reads/writes binary restart files by default.\n") +
@@ -10988,16 +12054,12 @@ void CPhysicalGeometry::Compute_Wing(CConfig *config, bool original_surface,
   Zcoord_Airfoil   = new vector<su2double>[nPlane];
   Variable_Airfoil = new vector<su2double>[nPlane];
 
-  /*--- Create the section slices through the geometry ---*/
-
-  for (iPlane = 0; iPlane < nPlane; iPlane++) {
-
-    ComputeAirfoil_Section(Plane_P0[iPlane], Plane_Normal[iPlane],
-                           -1E6, 1E6, -1E6, 1E6, -1E6, 1E6, NULL, Xcoord_Airfoil[iPlane],
-                           Ycoord_Airfoil[iPlane], Zcoord_Airfoil[iPlane],
-                           Variable_Airfoil[iPlane], original_surface, config);
+  /*--- Create the section slices through the geometry (all the planes at once) ---*/
 
-   }
+  ComputeAirfoil_Sections(nPlane, Plane_P0, Plane_Normal,
+                          -1E6, 1E6, -1E6, 1E6, -1E6, 1E6, NULL, Xcoord_Airfoil,
+                          Ycoord_Airfoil, Zcoord_Airfoil,
+                          Variable_Airfoil, original_surface, config);
 
   /*--- Compute airfoil characteristic only in the master node ---*/
 
@@ -11023,11 +12085,13 @@ void CPhysicalGeometry::Compute_Wing(CConfig *config, bool original_surface,
     }
 
 
-    /*--- Evaluate  geometrical quatities that do not require any kind of filter, local to each point ---*/
+    /*--- Evaluate  geometrical quatities that do not require any kind of filter, local to each point
+     (the sections are independent) ---*/
 
+    SU2_OMP_PARALLEL_(for schedule(dynamic,1))
     for (iPlane = 0; iPlane < nPlane; iPlane++) {
 
-      for (iDim = 0; iDim < nDim; iDim++) {
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) {
         LeadingEdge[iPlane][iDim]  = 0.0;
         TrailingEdge[iPlane][iDim] = 0.0;
       }
@@ -11284,15 +12348,12 @@ void CPhysicalGeometry::Compute_Fuselage(CConfig *config, bool original_surface,
   Zcoord_Airfoil   = new vector<su2double>[nPlane];
   Variable_Airfoil = new vector<su2double>[nPlane];
 
-  /*--- Create the section slices through the geometry ---*/
-
-  for (iPlane = 0; iPlane < nPlane; iPlane++) {
+  /*--- Create the section slices through the geometry (all the planes at once) ---*/
 
-    ComputeAirfoil_Section(Plane_P0[iPlane], Plane_Normal[iPlane],
-                           -1E6, 1E6, -1E6, 1E6, -1E6, 1E6, NULL, Xcoord_Airfoil[iPlane],
-                           Ycoord_Airfoil[iPlane], Zcoord_Airfoil[iPlane],
-                           Variable_Airfoil[iPlane], original_surface, config);
-  }
+  ComputeAirfoil_Sections(nPlane, Plane_P0, Plane_Normal,
+                          -1E6, 1E6, -1E6, 1E6, -1E6, 1E6, NULL, Xcoord_Airfoil,
+                          Ycoord_Airfoil, Zcoord_Airfoil,
+                          Variable_Airfoil, original_surface, config);
 
   /*--- Compute the area at each section ---*/
 
@@ -11318,11 +12379,13 @@ void CPhysicalGeometry::Compute_Fuselage(CConfig *config, bool original_surface,
     }
 
 
-    /*--- Evaluate  geometrical quatities that do not require any kind of filter, local to each point ---*/
+    /*--- Evaluate  geometrical quatities that do not require any kind of filter, local to each point
+     (the sections are independent) ---*/
 
+    SU2_OMP_PARALLEL_(for schedule(dynamic,1))
     for (iPlane = 0; iPlane < nPlane; iPlane++) {
 
-      for (iDim = 0; iDim < nDim; iDim++) {
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) {
         LeadingEdge[iPlane][iDim]  = 0.0;
         TrailingEdge[iPlane][iDim] = 0.0;
       }
@@ -11594,16 +12657,12 @@ void CPhysicalGeometry::Compute_Nacelle(CConfig *config, bool original_surface,
   Zcoord_Airfoil   = new vector<su2double>[nPlane];
   Variable_Airfoil = new vector<su2double>[nPlane];
 
-  /*--- Create the section slices through the geometry ---*/
-
-  for (iPlane = 0; iPlane < nPlane; iPlane++) {
-
-    ComputeAirfoil_Section(Plane_P0[iPlane], Plane_Normal[iPlane],
-                           -1E6, 1E6, -1E6, 1E6, -1E6, 1E6, NULL, Xcoord_Airfoil[iPlane],
-                           Ycoord_Airfoil[iPlane], Zcoord_Airfoil[iPlane],
-                           Variable_Airfoil[iPlane], original_surface, config);
+  /*--- Create the section slices through the geometry (all the planes at once) ---*/
 
-  }
+  ComputeAirfoil_Sections(nPlane, Plane_P0, Plane_Normal,
+                          -1E6, 1E6, -1E6, 1E6, -1E6, 1E6, NULL, Xcoord_Airfoil,
+                          Ycoord_Airfoil, Zcoord_Airfoil,
+                          Variable_Airfoil, original_surface, config);
 
   /*--- Compute airfoil characteristic only in the master node ---*/
 
@@ -11629,11 +12688,13 @@ void CPhysicalGeometry::Compute_Nacelle(CConfig *config, bool original_surface,
     }
 
 
-    /*--- Evaluate  geometrical quatities that do not require any kind of filter, local to each point ---*/
+    /*--- Evaluate  geometrical quatities that do not require any kind of filter, local to each point
+     (the sections are independent) ---*/
 
+    SU2_OMP_PARALLEL_(for schedule(dynamic,1))
     for (iPlane = 0; iPlane < nPlane; iPlane++) {
 
-      for (iDim = 0; iDim < nDim; iDim++) {
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) {
         LeadingEdge[iPlane][iDim]  = 0.0;
         TrailingEdge[iPlane][iDim] = 0.0;
       }
@@ -27,22 +27,16 @@
 
 #include "../../../include/geometry/dual_grid/CEdge.hpp"
 
-CEdge::CEdge(unsigned long val_iPoint, unsigned long val_jPoint, unsigned short val_nDim) : CDualGrid(val_nDim) {
+CEdge::CEdge(unsigned long val_iPoint, unsigned long val_jPoint, unsigned short val_nDim,
+             su2localidx *val_nodes, su2double *val_normal, su2double *val_coord_cg) : CDualGrid(val_nDim) {
 
-  unsigned short iDim;
-
-  /*--- Pointers initialization ---*/
-  Coord_CG = NULL;
-  Normal   = NULL;
-  Nodes    = NULL;
-
-  /*--- Allocate center of gravity coordinates, nodes, and face normal ---*/
-  Coord_CG = new su2double [nDim];
-  Normal   = new su2double [nDim];
-  Nodes    = new unsigned long[2];
+  /*--- The storage is provided (and owned) by the geometry ---*/
+  Coord_CG = val_coord_cg;
+  Normal   = val_normal;
+  Nodes    = val_nodes;
 
   /*--- Initializate the structure ---*/
-  for (iDim = 0; iDim < nDim; iDim++) {
+  for (unsigned short iDim = 0; iDim < nDim; iDim++) {
     Coord_CG[iDim] = 0.0;
     Normal[iDim]   = 0.0;
   }
@@ -52,13 +46,7 @@ CEdge::CEdge(unsigned long val_iPoint, unsigned long val_jPoint, unsigned short
 
 }
 
-CEdge::~CEdge() {
-
-  if (Coord_CG != NULL) delete[] Coord_CG;
-  if (Normal   != NULL) delete[] Normal;
-  if (Nodes    != NULL) delete[] Nodes;
-
-}
+CEdge::~CEdge() { }
 
 void CEdge::SetCoord_CG(su2double **val_coord) {
 
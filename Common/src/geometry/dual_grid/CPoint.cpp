@@ -42,14 +42,20 @@ CPoint::CPoint(unsigned short val_nDim, unsigned long val_globalindex, CConfig *
   GridVel           = NULL;           GridVel_Grad        = NULL;
   AD_InputIndex     = NULL;           AD_OutputIndex      = NULL;
 
+  Wall_Distance_Local = 0.0;
+  Wall_Distance = &Wall_Distance_Local;
+  ExternalStorage = false;
+
   /*--- Volume (0 -> Vol_nP1, 1-> Vol_n, 2 -> Vol_nM1 ) and coordinates of the control volume ---*/
 
   if (config->GetTime_Marching() == NO) {
-    Volume = new su2double[1];
+    nVolume = 1;
+    Volume = new su2double[nVolume];
     Volume[0] = 0.0;
   }
   else {
-    Volume = new su2double[3];
+    nVolume = 3;
+    Volume = new su2double[nVolume];
     Volume[0] = 0.0;
     Volume[1] = 0.0;
     Volume[2] = 0.0;
@@ -137,9 +143,6 @@ CPoint::CPoint(unsigned short val_nDim, unsigned long val_globalindex, CConfig *
   /*--- Intialize the value of the periodic volume. ---*/
   Periodic_Volume = 0.0;
 
-  /*--- Init walldistance ---*/
-
-  Wall_Distance = 0.0;
 }
 
 CPoint::CPoint(su2double val_coord_0, su2double val_coord_1, unsigned long val_globalindex, CConfig *config) : CDualGrid(2) {
@@ -157,14 +160,20 @@ CPoint::CPoint(su2double val_coord_0, su2double val_coord_1, unsigned long val_g
   GridVel           = NULL;           GridVel_Grad        = NULL;
   AD_InputIndex     = NULL;           AD_OutputIndex      = NULL;
 
+  Wall_Distance_Local = 0.0;
+  Wall_Distance = &Wall_Distance_Local;
+  ExternalStorage = false;
+
   /*--- Volume (0 -> Vol_nP1, 1-> Vol_n, 2 -> Vol_nM1 ) and coordinates of the control volume ---*/
 
   if (config->GetTime_Marching() == NO) {
-    Volume = new su2double[1];
+    nVolume = 1;
+    Volume = new su2double[nVolume];
     Volume[0] = 0.0;
   }
   else{
-    Volume = new su2double[3];
+    nVolume = 3;
+    Volume = new su2double[nVolume];
     Volume[0] = 0.0;
     Volume[1] = 0.0;
     Volume[2] = 0.0;
@@ -273,13 +282,19 @@ CPoint::CPoint(su2double val_coord_0, su2double val_coord_1, su2double val_coord
   GridVel           = NULL;           GridVel_Grad        = NULL;
   AD_InputIndex     = NULL;           AD_OutputIndex      = NULL;
 
+  Wall_Distance_Local = 0.0;
+  Wall_Distance = &Wall_Distance_Local;
+  ExternalStorage = false;
+
   /*--- Volume (0 -> Vol_nP1, 1-> Vol_n, 2 -> Vol_nM1 ) and coordinates of the control volume ---*/
   if ( config->GetTime_Marching() == NO ) {
-    Volume = new su2double[1];
+    nVolume = 1;
+    Volume = new su2double[nVolume];
     Volume[0] = 0.0;
   }
   else{
-    Volume = new su2double[3];
+    nVolume = 3;
+    Volume = new su2double[nVolume];
     Volume[0] = 0.0;
     Volume[1] = 0.0;
     Volume[2] = 0.0;
@@ -378,8 +393,10 @@ CPoint::CPoint(su2double val_coord_0, su2double val_coord_1, su2double val_coord
 CPoint::~CPoint() {
 
   if (Vertex       != NULL && Boundary) delete[] Vertex;
-  if (Volume       != NULL) delete[] Volume;
-  if (Coord        != NULL) delete[] Coord;
+  if (!ExternalStorage) {
+    if (Volume     != NULL) delete[] Volume;
+    if (Coord      != NULL) delete[] Coord;
+  }
   if (Coord_Old    != NULL) delete[] Coord_Old;
   if (Coord_Sum    != NULL) delete[] Coord_Sum;
   if (Coord_n      != NULL) delete[] Coord_n;
@@ -395,6 +412,27 @@ CPoint::~CPoint() {
   if (AD_OutputIndex != NULL) delete[] AD_OutputIndex;
  }
 
+void CPoint::SetStorage(su2double *coord, su2double *volume, su2double *wall_distance) {
+
+  for (unsigned short iDim = 0; iDim < nDim; iDim++)
+    coord[iDim] = Coord[iDim];
+
+  for (unsigned short iVol = 0; iVol < nVolume; iVol++)
+    volume[iVol] = Volume[iVol];
+
+  *wall_distance = *Wall_Distance;
+
+  if (!ExternalStorage) {
+    delete [] Coord;
+    delete [] Volume;
+  }
+
+  Coord = coord;
+  Volume = volume;
+  Wall_Distance = wall_distance;
+  ExternalStorage = true;
+}
+
 void CPoint::SetPoint(unsigned long val_point) {
 
   unsigned short iPoint;
@@ -29,6 +29,16 @@
 #include "../../../include/toolboxes/CLinearPartitioner.hpp"
 #include "../../../include/geometry/meshreader/CBoxMeshReaderFVM.hpp"
 
+namespace {
+/*--- Node numbering (in the hexahedron) of the sub-elements of the split hexahedra. The local
+ *    nodes of the hexahedron are 0-3 at the bottom and 4-7 at the top, starting at its lowest corner.
+ *    The prisms split the bottom (and top) face along 0-2, the tetrahedra are the 6 tetrahedra
+ *    around the 0-6 diagonal, which split each face along the diagonal through its lowest corner. ---*/
+const unsigned short SPLIT_PRISMS[2][N_POINTS_PRISM] = {{0,1,2,4,5,6}, {0,2,3,4,6,7}};
+const unsigned short SPLIT_TETRAHEDRA[6][N_POINTS_TETRAHEDRON] = {{0,1,2,6}, {0,5,1,6}, {0,2,3,6},
+                                                                  {0,3,7,6}, {0,4,5,6}, {0,7,4,6}};
+}
+
 CBoxMeshReaderFVM::CBoxMeshReaderFVM(CConfig        *val_config,
                                      unsigned short val_iZone,
                                      unsigned short val_nZone)
@@ -37,9 +47,8 @@ CBoxMeshReaderFVM::CBoxMeshReaderFVM(CConfig        *val_config,
   /* The box mesh is always 3D. */
   dimension = 3;
   
-  /* Set the VTK type for the interior elements and the boundary elements. */
-  KindElem  = HEXAHEDRON;
-  KindBound = QUADRILATERAL;
+  /* Hexahedra, or hexahedra split into prisms or tetrahedra. */
+  KindElements = config->GetKind_MeshBoxElements();
   
   /* The number of nodes in the i and j directions. */
   nNode = config->GetMeshBoxSize(0);
@@ -56,6 +65,11 @@ CBoxMeshReaderFVM::CBoxMeshReaderFVM(CConfig        *val_config,
   Oy = config->GetMeshBoxOffset(1);
   Oz = config->GetMeshBoxOffset(2);
   
+  /* Clustering of the nodes towards the minus sides. */
+  Cx = config->GetMeshBoxClustering(0);
+  Cy = config->GetMeshBoxClustering(1);
+  Cz = config->GetMeshBoxClustering(2);
+  
   /* Compute and store the points, interior elements, and surface elements.
    In these routines, we use a simple analytic formula to compute the
    coordinates and the node numbering. We store only the points and interior
@@ -77,101 +91,162 @@ void CBoxMeshReaderFVM::ComputeBoxPointCoordinates() {
   /* Get a partitioner to help with linear partitioning. */
   CLinearPartitioner pointPartitioner(numberOfGlobalPoints,0);
 
-  /* Determine number of local points */
-  for(unsigned long globalIndex=0; globalIndex < numberOfGlobalPoints; globalIndex++) {
-    if ((int)pointPartitioner.GetRankContainingIndex(globalIndex) == rank) {
-      numberOfLocalPoints++;
-    }
-  }
+  /* Our linear partition of points is a contiguous range of global indices. */
+  const unsigned long firstIndex = pointPartitioner.GetFirstIndexOnRank(rank);
+  numberOfLocalPoints = pointPartitioner.GetSizeOnRank(rank);
 
-  /* Loop over our analytically defined of coordinates and store only
-   those that contain a node within our linear partition of points. */
+  /* Loop over the global indices of our partition only, the i,j,k
+   indices of each point are recovered from its global index. */
   localPointCoordinates.resize(dimension);
   for (int k = 0; k < dimension; k++)
     localPointCoordinates[k].reserve(numberOfLocalPoints);
 
-  unsigned long globalIndex = 0;
-  for (unsigned long kNode = 0; kNode < pNode; kNode++) {
-    for (unsigned long jNode = 0; jNode < mNode; jNode++) {
-      for (unsigned long iNode = 0; iNode < nNode; iNode++) {
-        if ((int)pointPartitioner.GetRankContainingIndex(globalIndex) == rank) {
+  for (unsigned long globalIndex = firstIndex; globalIndex < firstIndex+numberOfLocalPoints; globalIndex++) {
 
-          /* Store the coordinates more clearly. */
-          const passivedouble x = SU2_TYPE::GetValue(Lx*((su2double)iNode)/((su2double)(nNode-1))+Ox);
-          const passivedouble y = SU2_TYPE::GetValue(Ly*((su2double)jNode)/((su2double)(mNode-1))+Oy);
-          const passivedouble z = SU2_TYPE::GetValue(Lz*((su2double)kNode)/((su2double)(pNode-1))+Oz);
+    const unsigned long iNode = globalIndex%nNode;
+    const unsigned long jNode = (globalIndex/nNode)%mNode;
+    const unsigned long kNode = globalIndex/(nNode*mNode);
 
-          /* Load into the coordinate class data structure. */
-          localPointCoordinates[0].push_back(x);
-          localPointCoordinates[1].push_back(y);
-          localPointCoordinates[2].push_back(z);
-        }
-        globalIndex++;
-      }
-    }
+    /* Load into the coordinate class data structure. */
+    localPointCoordinates[0].push_back(AnalyticGridCoordinate(Lx, Ox, Cx, iNode, nNode));
+    localPointCoordinates[1].push_back(AnalyticGridCoordinate(Ly, Oy, Cy, jNode, mNode));
+    localPointCoordinates[2].push_back(AnalyticGridCoordinate(Lz, Oz, Cz, kNode, pNode));
   }
 
 }
 
 void CBoxMeshReaderFVM::ComputeBoxVolumeConnectivity() {
   
+  /* Number of elements per hexahedron of the box. */
+  unsigned short nSplit = 1;
+  if (KindElements == BOX_PRISMS)     nSplit = 2;
+  if (KindElements == BOX_TETRAHEDRA) nSplit = 6;
+  
   /* Set the global count of elements based on the grid dimensions. */
-  numberOfGlobalElements = (nNode-1)*(mNode-1)*(pNode-1);
+  numberOfGlobalElements = (nNode-1)*(mNode-1)*(pNode-1)*nSplit;
   
   /* Get a partitioner to help with linear partitioning. */
   CLinearPartitioner pointPartitioner(numberOfGlobalPoints,0);
   
+  const unsigned long firstIndex = pointPartitioner.GetFirstIndexOnRank(rank);
+  const unsigned long lastIndex  = firstIndex + pointPartitioner.GetSizeOnRank(rank);
+  
+  /* Only the hexahedra with a node in our partition are visited, their lowest
+   corner is at most one layer, one row, and one node before our first point. */
+  const unsigned long nodeLayer = mNode*nNode;
+  const unsigned long firstCorner = (firstIndex > nodeLayer+nNode+1)? firstIndex-nodeLayer-nNode-1 : 0;
+  
   /* Loop over our analytically defined of elements and store only those
    that contain a node within our linear partition of points. */
   numberOfLocalElements  = 0;
-  vector<unsigned long> connectivity(N_POINTS_HEXAHEDRON,0);
-  unsigned long globalIndex = 0;
-  for (unsigned long kNode = 0; kNode < pNode-1; kNode++) {
-    for (unsigned long jNode = 0; jNode < mNode-1; jNode++) {
-      for (unsigned long iNode = 0; iNode < nNode-1; iNode++) {
-        
-        /* Compute connectivity based on the i,j,k index. */
-        connectivity[0] = kNode*mNode*nNode + jNode*nNode + iNode;
-        connectivity[1] = kNode*mNode*nNode + jNode*nNode + iNode + 1;
-        connectivity[2] = kNode*mNode*nNode + (jNode + 1)*nNode + (iNode + 1);
-        connectivity[3] = kNode*mNode*nNode + (jNode + 1)*nNode + iNode;
-        connectivity[4] = (kNode + 1)*mNode*nNode + jNode*nNode + iNode;
-        connectivity[5] = (kNode + 1)*mNode*nNode + jNode*nNode + iNode + 1;
-        connectivity[6] = (kNode + 1)*mNode*nNode + (jNode + 1)*nNode + (iNode + 1);
-        connectivity[7] = (kNode + 1)*mNode*nNode + (jNode + 1)*nNode + iNode;
-        
-        /* Check whether any of the points is in our linear partition. */
-        bool isOwned = false;
-        for (unsigned short i = 0; i < N_POINTS_HEXAHEDRON; i++) {
-          if ((int)pointPartitioner.GetRankContainingIndex(connectivity[i]) == rank) {
-            isOwned = true;
-          }
+  unsigned long connectivity[N_POINTS_HEXAHEDRON];
+  unsigned long element[N_POINTS_HEXAHEDRON];
+  
+  for (unsigned long corner = firstCorner; corner < lastIndex; corner++) {
+    
+    const unsigned long iNode = corner%nNode;
+    const unsigned long jNode = (corner/nNode)%mNode;
+    const unsigned long kNode = corner/nodeLayer;
+    
+    if ((iNode == nNode-1) || (jNode == mNode-1) || (kNode >= pNode-1)) continue;
+    
+    const unsigned long globalHexa = kNode*(mNode-1)*(nNode-1) + jNode*(nNode-1) + iNode;
+    
+    /* Compute connectivity based on the i,j,k index. */
+    connectivity[0] = corner;
+    connectivity[1] = corner + 1;
+    connectivity[2] = corner + nNode + 1;
+    connectivity[3] = corner + nNode;
+    connectivity[4] = corner + nodeLayer;
+    connectivity[5] = corner + nodeLayer + 1;
+    connectivity[6] = corner + nodeLayer + nNode + 1;
+    connectivity[7] = corner + nodeLayer + nNode;
+    
+    for (unsigned short iSplit = 0; iSplit < nSplit; iSplit++) {
+      
+      /* Nodes of the (sub-)element, unused entries are 0. */
+      unsigned short KindElem = HEXAHEDRON, nNodeElem = N_POINTS_HEXAHEDRON;
+      for (unsigned short i = 0; i < N_POINTS_HEXAHEDRON; i++) element[i] = 0;
+      
+      switch (KindElements) {
+        case BOX_PRISMS:
+          KindElem = PRISM; nNodeElem = N_POINTS_PRISM;
+          for (unsigned short i = 0; i < nNodeElem; i++)
+            element[i] = connectivity[SPLIT_PRISMS[iSplit][i]];
+          break;
+        case BOX_TETRAHEDRA:
+          KindElem = TETRAHEDRON; nNodeElem = N_POINTS_TETRAHEDRON;
+          for (unsigned short i = 0; i < nNodeElem; i++)
+            element[i] = connectivity[SPLIT_TETRAHEDRA[iSplit][i]];
+          break;
+        default:
+          for (unsigned short i = 0; i < nNodeElem; i++)
+            element[i] = connectivity[i];
+          break;
+      }
+      
+      /* Check whether any of the points is in our linear partition. */
+      bool isOwned = false;
+      for (unsigned short i = 0; i < nNodeElem; i++) {
+        if ((element[i] >= firstIndex) && (element[i] < lastIndex)) {
+          isOwned = true;
         }
-        
-        /* If so, we need to store the element locally. */
-        if (isOwned) {
-          localVolumeElementConnectivity.push_back(globalIndex);
-          localVolumeElementConnectivity.push_back(KindElem);
-          for (unsigned short i = 0; i < N_POINTS_HEXAHEDRON; i++) {
-            localVolumeElementConnectivity.push_back(connectivity[i]);
-          }
-          numberOfLocalElements++;
+      }
+      
+      /* If so, we need to store the element locally. */
+      if (isOwned) {
+        localVolumeElementConnectivity.push_back(globalHexa*nSplit + iSplit);
+        localVolumeElementConnectivity.push_back(KindElem);
+        for (unsigned short i = 0; i < N_POINTS_HEXAHEDRON; i++) {
+          localVolumeElementConnectivity.push_back(element[i]);
         }
-        globalIndex++;
+        numberOfLocalElements++;
       }
     }
   }
   
 }
 
+void CBoxMeshReaderFVM::AddSurfaceFace(unsigned long iMarker, const unsigned long *face, bool split) {
+  
+  vector<unsigned long> &markerConnectivity = surfaceElementConnectivity[iMarker];
+  
+  if (!split) {
+    markerConnectivity.push_back(0);
+    markerConnectivity.push_back(QUADRILATERAL);
+    for (unsigned short i = 0; i < N_POINTS_QUADRILATERAL; i++)
+      markerConnectivity.push_back(face[i]);
+    for (unsigned short i = N_POINTS_QUADRILATERAL; i < N_POINTS_HEXAHEDRON; i++)
+      markerConnectivity.push_back(0);
+    return;
+  }
+  
+  /* Triangles 0-1-2 and 0-2-3. */
+  for (unsigned short iTria = 0; iTria < 2; iTria++) {
+    markerConnectivity.push_back(0);
+    markerConnectivity.push_back(TRIANGLE);
+    markerConnectivity.push_back(face[0]);
+    markerConnectivity.push_back(face[iTria+1]);
+    markerConnectivity.push_back(face[iTria+2]);
+    for (unsigned short i = N_POINTS_TRIANGLE; i < N_POINTS_HEXAHEDRON; i++)
+      markerConnectivity.push_back(0);
+  }
+  
+}
+
 void CBoxMeshReaderFVM::ComputeBoxSurfaceConnectivity() {
   
-  /* The rectangle alays has 4 markers. */
+  /* The box always has 6 markers. */
   numberOfMarkers = 6;
   surfaceElementConnectivity.resize(numberOfMarkers);
   markerNames.resize(numberOfMarkers);
   
-  vector<unsigned long> connectivity(N_POINTS_HEXAHEDRON,0);
+  /* The faces of the tetrahedra are all triangles, the prisms have
+   triangular faces only on the z markers. */
+  const bool splitX = (KindElements == BOX_TETRAHEDRA);
+  const bool splitZ = (KindElements != BOX_HEXAHEDRA);
+  
+  unsigned long connectivity[N_POINTS_QUADRILATERAL];
   
   /* Compute and store the 6 sets of connectivity. */
   
@@ -185,10 +260,7 @@ void CBoxMeshReaderFVM::ComputeBoxSurfaceConnectivity() {
         connectivity[2] = (kNode + 1)*mNode*nNode + (jNode + 1)*nNode;
         connectivity[3] = kNode*mNode*nNode + (jNode + 1)*nNode;
         
-        surfaceElementConnectivity[0].push_back(0);
-        surfaceElementConnectivity[0].push_back(KindBound);
-        for (unsigned short i = 0; i < N_POINTS_HEXAHEDRON; i++)
-        surfaceElementConnectivity[0].push_back(connectivity[i]);
+        AddSurfaceFace(0, connectivity, splitX);
       }
     }
   }
@@ -203,10 +275,7 @@ void CBoxMeshReaderFVM::ComputeBoxSurfaceConnectivity() {
         connectivity[2] = (kNode + 1)*mNode*nNode + (jNode + 1)*nNode + (nNode - 1);
         connectivity[3] = (kNode + 1)*mNode*nNode + jNode*nNode + (nNode - 1);
         
-        surfaceElementConnectivity[1].push_back(0);
-        surfaceElementConnectivity[1].push_back(KindBound);
-        for (unsigned short i = 0; i < N_POINTS_HEXAHEDRON; i++)
-        surfaceElementConnectivity[1].push_back(connectivity[i]);
+        AddSurfaceFace(1, connectivity, splitX);
       }
     }
   }
@@ -221,10 +290,7 @@ void CBoxMeshReaderFVM::ComputeBoxSurfaceConnectivity() {
         connectivity[2] = (kNode + 1)*mNode*nNode + iNode + 1;
         connectivity[3] = (kNode + 1)*mNode*nNode + iNode;
         
-        surfaceElementConnectivity[2].push_back(0);
-        surfaceElementConnectivity[2].push_back(KindBound);
-        for (unsigned short i = 0; i < N_POINTS_HEXAHEDRON; i++)
-        surfaceElementConnectivity[2].push_back(connectivity[i]);
+        AddSurfaceFace(2, connectivity, splitX);
       }
     }
   }
@@ -239,10 +305,7 @@ void CBoxMeshReaderFVM::ComputeBoxSurfaceConnectivity() {
         connectivity[2] = (kNode + 1)*mNode*nNode + (mNode - 1)*nNode + iNode + 1;
         connectivity[3] = (kNode + 1)*mNode*nNode + (mNode - 1)*nNode + iNode;
         
-        surfaceElementConnectivity[3].push_back(0);
-        surfaceElementConnectivity[3].push_back(KindBound);
-        for (unsigned short i = 0; i < N_POINTS_HEXAHEDRON; i++)
-        surfaceElementConnectivity[3].push_back(connectivity[i]);
+        AddSurfaceFace(3, connectivity, splitX);
       }
     }
   }
@@ -257,10 +320,7 @@ void CBoxMeshReaderFVM::ComputeBoxSurfaceConnectivity() {
         connectivity[2] = (jNode + 1)*nNode + (iNode + 1);
         connectivity[3] = (jNode + 1)*nNode + iNode;
         
-        surfaceElementConnectivity[4].push_back(0);
-        surfaceElementConnectivity[4].push_back(KindBound);
-        for (unsigned short i = 0; i < N_POINTS_HEXAHEDRON; i++)
-        surfaceElementConnectivity[4].push_back(connectivity[i]);
+        AddSurfaceFace(4, connectivity, splitZ);
       }
     }
   }
@@ -275,10 +335,7 @@ void CBoxMeshReaderFVM::ComputeBoxSurfaceConnectivity() {
         connectivity[2] = (pNode-1)*mNode*nNode + (jNode + 1)*nNode + (iNode + 1);
         connectivity[3] = (pNode-1)*mNode*nNode + (jNode + 1)*nNode + iNode;
         
-        surfaceElementConnectivity[5].push_back(0);
-        surfaceElementConnectivity[5].push_back(KindBound);
-        for (unsigned short i = 0; i < N_POINTS_HEXAHEDRON; i++)
-        surfaceElementConnectivity[5].push_back(connectivity[i]);
+        AddSurfaceFace(5, connectivity, splitZ);
       }
     }
   }
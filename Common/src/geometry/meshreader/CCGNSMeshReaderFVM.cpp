@@ -29,6 +29,13 @@
 #include "../../../include/toolboxes/CLinearPartitioner.hpp"
 #include "../../../include/geometry/meshreader/CCGNSMeshReaderFVM.hpp"
 
+#ifdef HAVE_CGNS
+namespace {
+/*--- Maximum number of elements read from a section at once, bounds the temporary memory. ---*/
+const unsigned long CGNS_READ_CHUNK_SIZE = 1048576;
+}
+#endif
+
 CCGNSMeshReaderFVM::CCGNSMeshReaderFVM(CConfig        *val_config,
                                        unsigned short val_iZone,
                                        unsigned short val_nZone)
@@ -68,6 +75,12 @@ CCGNSMeshReaderFVM::CCGNSMeshReaderFVM(CConfig        *val_config,
   }
   
   /*--- We have extracted all CGNS data. Close the CGNS file. ---*/
+#ifdef HAVE_PCGNS
+  if (parallelCGNS) {
+    if (cgp_close(cgnsFileID)) cgp_error_exit();
+  }
+  else
+#endif
   if (cg_close(cgnsFileID)) cg_error_exit();
 
   /*--- Put our CGNS data into the class data for the mesh reader. ---*/
@@ -101,11 +114,26 @@ void CCGNSMeshReaderFVM::OpenCGNSFile(string val_filename) {
    is the specific index number for this file and will be
    repeatedly used in the function calls. ---*/
   
+#ifdef HAVE_PCGNS
+  /*--- HDF5 files are opened with parallel CGNS, the coordinates and the
+   volume sections are then read with collective MPI-IO. ---*/
+  
+  parallelCGNS = (file_type == CG_FILE_HDF5);
+  if (parallelCGNS) {
+    if (cgp_mpi_comm(MPI_COMM_WORLD)) cgp_error_exit();
+    if (cgp_pio_mode(CGP_COLLECTIVE)) cgp_error_exit();
+    if (cgp_open(val_filename.c_str(), CG_MODE_READ, &cgnsFileID))
+      cgp_error_exit();
+  }
+  else
+#endif
   if (cg_open(val_filename.c_str(), CG_MODE_READ, &cgnsFileID))
     cg_error_exit();
   if (rank == MASTER_NODE) {
     cout << "Reading the CGNS file: ";
-    cout << val_filename.c_str() << "." << endl;
+    cout << val_filename.c_str();
+    if (parallelCGNS) cout << " (parallel CGNS)";
+    cout << "." << endl;
   }
   
 }
@@ -282,6 +310,24 @@ void CCGNSMeshReaderFVM::ReadCGNSPointCoordinates() {
      Ask for datatype RealDouble and let CGNS library do the translation
      when RealSingle is found. ---*/
     
+#ifdef HAVE_PCGNS
+    if (parallelCGNS) {
+      
+      /*--- Collective read into the memory layout of our rank, with the
+       translation to RealDouble. Ranks without points read no data. ---*/
+      
+      const cgsize_t nLocal = numberOfLocalPoints;
+      const cgsize_t mem_min = 1, mem_max = nLocal;
+      const bool hasPoints = (nLocal > 0);
+      if (cgp_coord_general_read_data(cgnsFileID, cgnsBase, cgnsZone, k+1,
+                                      hasPoints? &range_min : &mem_min,
+                                      hasPoints? &range_max : &mem_min,
+                                      RealDouble, 1, &nLocal, &mem_min, &mem_max,
+                                      hasPoints? localPointCoordinates[indC].data() : NULL))
+        cgp_error_exit();
+    }
+    else
+#endif
     if (cg_coord_read(cgnsFileID, cgnsBase, cgnsZone, coordname, RealDouble,
                       &range_min, &range_max, localPointCoordinates[indC].data()))
       cg_error_exit();
@@ -407,13 +453,15 @@ void CCGNSMeshReaderFVM::ReadCGNSVolumeSection(int val_section) {
    All operations are executed in parallel here and the reading of the
    section proceeds based on a linear partitioning of the elements
    across all ranks in the calculation. We will use partial reads of
-   the CGNS section from the CGNS API to accomplish this. Once each
+   the CGNS section from the CGNS API to accomplish this (collective
+   reads when the file is opened with parallel CGNS). Once each
    rank has a linear chunk of the mesh, we will redistribute the
    connectivity to match the linear partitioning of the grid points,
-   not the elements, since the points control the overall partitioning. ---*/
+   not the elements, since the points control the overall partitioning.
+   The linear chunk is read and redistributed in pieces of at most
+   CGNS_READ_CHUNK_SIZE elements, which bounds the temporary memory. ---*/
   
-  int nbndry, parent_flag, npe, iProcessor;
-  unsigned long iElem = 0, iPoint = 0, iNode = 0, jNode = 0;
+  int nbndry, parent_flag;
   cgsize_t startE, endE;
   ElementType_t elemType;
   char sectionName[CGNS_STRING_SIZE];
@@ -431,90 +479,139 @@ void CCGNSMeshReaderFVM::ReadCGNSVolumeSection(int val_section) {
   unsigned long element_count = (endE-startE+1);
   CLinearPartitioner elementPartitioner(element_count,startE,true);
   
-  /*--- Store the number of elements that this rank is responsible for
-   in the current section. ---*/
+  const unsigned long firstElem = elementPartitioner.GetFirstIndexOnRank(rank);
+  const unsigned long nElemRank = elementPartitioner.GetSizeOnRank(rank);
   
-  nElems[val_section] = elementPartitioner.GetSizeOnRank(rank);
+  /*--- The redistribution of each chunk is collective, all ranks
+   loop over the same number of chunks (some may be empty). ---*/
   
-  /*--- Allocate some memory for the handling the connectivity
-   and auxiliary data that we need to communicate. ---*/
+  unsigned long nChunk = (nElemRank+CGNS_READ_CHUNK_SIZE-1)/CGNS_READ_CHUNK_SIZE, maxChunk = 0;
+  SU2_MPI::Allreduce(&nChunk, &maxChunk, 1, MPI_UNSIGNED_LONG, MPI_MAX, MPI_COMM_WORLD);
   
-  vector<cgsize_t> elemTypes(nElems[val_section],   0);
-  vector<cgsize_t> nPoinPerElem(nElems[val_section],0);
-  vector<cgsize_t> elemGlobalID(nElems[val_section],0);
+  /*--- Print some information to the console. ---*/
   
-  /*--- Determine the size of the vector needed to read the connectivity
-   data from the CGNS file. Only call the CGNS API if we have a non-zero
-   number of elements on this rank. ---*/
-  
-  cgsize_t sizeNeeded = 0, sizeOffset = 0;
-  if (nElems[val_section] > 0) {
-    if (cg_ElementPartialSize(cgnsFileID, cgnsBase, cgnsZone, val_section+1,
-                              (cgsize_t)elementPartitioner.GetFirstIndexOnRank(rank),
-                              (cgsize_t)elementPartitioner.GetLastIndexOnRank(rank),
-                              &sizeNeeded) != CG_OK)
-    cg_error_exit();
+  if (rank == MASTER_NODE) {
+    cout << "Loading volume section " << string(sectionName);
+    cout <<  " from file." << endl;
   }
   
-  /*--- Allocate the memory for the connectivity, the offset if needed
-   and read the data. ---*/
+  nElems[val_section] = 0;
+  connElems[val_section].clear();
+  
+  vector<cgsize_t> connElemTemp;
+  vector<unsigned short> nPoinPerElem;
   
-  vector<cgsize_t> connElemCGNS(sizeNeeded,0);
-  if (elemType == MIXED || elemType == NFACE_n || elemType == NGON_n) {
-    sizeOffset = nElems[val_section]+1;
+  for (unsigned long iChunk = 0; iChunk < maxChunk; iChunk++) {
+    
+    const unsigned long offset = min(iChunk*CGNS_READ_CHUNK_SIZE, nElemRank);
+    const unsigned long nElemChunk = min(CGNS_READ_CHUNK_SIZE, nElemRank-offset);
+    
+    /*--- The global IDs of the internal elements start from zero, the
+     boundary sections found prior to this one are subtracted. ---*/
+    
+    ReadCGNSElementChunk(val_section, elemType, firstElem+offset, nElemChunk,
+                         true, elemOffset[val_section], connElemTemp, nPoinPerElem);
+    
+    DistributeCGNSVolumeElements(val_section, nElemChunk, connElemTemp, nPoinPerElem);
   }
-  vector<cgsize_t> connOffsetCGNS(sizeOffset,0);
   
-  /*--- Retrieve the connectivity information and store. Note that
-   we are only accessing our rank's piece of the data here in the
-   partial read function in the CGNS API. Only call the CGNS API
-   if we have a non-zero number of elements on this rank. ---*/
+}
+
+void CCGNSMeshReaderFVM::ReadCGNSElementChunk(int                    val_section,
+                                              ElementType_t          val_elem_type,
+                                              unsigned long          val_first,
+                                              unsigned long          val_count,
+                                              bool                   val_collective,
+                                              long                   val_id_offset,
+                                              vector<cgsize_t>       &val_conn,
+                                              vector<unsigned short> &val_npe) {
   
-  if (nElems[val_section] > 0) {
-    if (elemType == MIXED || elemType == NFACE_n || elemType == NGON_n) {
-      if (cg_poly_elements_partial_read(cgnsFileID, cgnsBase, cgnsZone, val_section+1,
-                                        (cgsize_t)elementPartitioner.GetFirstIndexOnRank(rank),
-                                        (cgsize_t)elementPartitioner.GetLastIndexOnRank(rank),
-                                        connElemCGNS.data(),
-                                        connOffsetCGNS.data(), NULL) != CG_OK)
-      cg_error_exit();
-    } else {
-      if (cg_elements_partial_read(cgnsFileID, cgnsBase, cgnsZone, val_section+1,
-                                   (cgsize_t)elementPartitioner.GetFirstIndexOnRank(rank),
-                                   (cgsize_t)elementPartitioner.GetLastIndexOnRank(rank),
-                                   connElemCGNS.data(), NULL) != CG_OK)
-      cg_error_exit();
-    }
-  }
+  unsigned long iElem = 0, iNode = 0;
   
-  /*--- Print some information to the console. ---*/
+  const cgsize_t first = (cgsize_t)val_first;
+  const cgsize_t last  = (cgsize_t)(val_first+val_count)-1;
   
-  if (rank == MASTER_NODE) {
-    cout << "Loading volume section " << string(sectionName);
-    cout <<  " from file." << endl;
-  }
+  /*--- Check whether the sections contains a mixture of multiple
+   element types, which will require special handling to get the
+   element type one-by-one when reading. ---*/
+  
+  const bool isPoly  = (val_elem_type == MIXED || val_elem_type == NFACE_n || val_elem_type == NGON_n);
+  const bool isMixed = (val_elem_type == MIXED);
   
   /*--- Find the number of nodes required to represent
    this type of element. ---*/
   
-  if (cg_npe(elemType, &npe)) cg_error_exit();
+  int npe = 0;
+  if (cg_npe(val_elem_type, &npe)) cg_error_exit();
   
-  /*--- Check whether the sections contains a mixture of multiple
-   element types, which will require special handling to get the
-   element type one-by-one when reading. ---*/
+  /*--- Determine the size of the vector needed to read the connectivity
+   data from the CGNS file, allocate the memory for the connectivity and
+   the offset if needed, and read the data. Note that we are only accessing
+   this piece of the data here in the partial read functions of the CGNS API. ---*/
+  
+  vector<cgsize_t> connElemCGNS, connOffsetCGNS;
   
-  bool isMixed = false;
-  if (elemType == MIXED) {
-    isMixed = true;
+  if (isPoly) {
+    
+    /*--- Only call the CGNS API if we have a non-zero number of elements. ---*/
+    
+    if (val_count > 0) {
+      cgsize_t sizeNeeded = 0;
+      if (cg_ElementPartialSize(cgnsFileID, cgnsBase, cgnsZone, val_section+1,
+                                first, last, &sizeNeeded) != CG_OK)
+        cg_error_exit();
+      
+      connElemCGNS.resize(sizeNeeded,0);
+      connOffsetCGNS.resize(val_count+1,0);
+      
+      if (cg_poly_elements_partial_read(cgnsFileID, cgnsBase, cgnsZone, val_section+1,
+                                        first, last, connElemCGNS.data(),
+                                        connOffsetCGNS.data(), NULL) != CG_OK)
+        cg_error_exit();
+    }
+  }
+  else {
+    
+    connElemCGNS.resize(val_count*npe,0);
+    
+#ifdef HAVE_PCGNS
+    if (parallelCGNS && val_collective) {
+      
+      /*--- Collective read, the ranks without elements in this chunk still take
+       part in the call with a valid range and no data (NULL selection). ---*/
+      
+      cgsize_t startE, endE;
+      int nbndry, parent_flag;
+      ElementType_t elemType;
+      char sectionName[CGNS_STRING_SIZE];
+      if (cg_section_read(cgnsFileID, cgnsBase, cgnsZone, val_section+1, sectionName,
+                          &elemType, &startE, &endE, &nbndry, &parent_flag))
+        cg_error_exit();
+      
+      if (cgp_elements_read_data(cgnsFileID, cgnsBase, cgnsZone, val_section+1,
+                                 (val_count > 0)? first : startE, (val_count > 0)? last : startE,
+                                 (val_count > 0)? connElemCGNS.data() : NULL) != CG_OK)
+        cgp_error_exit();
+    }
+    else
+#endif
+    if (val_count > 0) {
+      if (cg_elements_partial_read(cgnsFileID, cgnsBase, cgnsZone, val_section+1,
+                                   first, last, connElemCGNS.data(), NULL) != CG_OK)
+        cg_error_exit();
+    }
   }
   
-  /*--- Loop through all of the elements in this section to get more
-   information and to decide whether it has interior elements. ---*/
+  /*--- Copy the connectivity with a standard format per element:
+   [globalID vtkType n0 n1 n2 n3 n4 n5 n6 n7 n8]. ---*/
+  
+  val_conn.assign(val_count*SU2_CONN_SIZE,0);
+  val_npe.assign(val_count,0);
   
   unsigned long counterCGNS = 0;
-  for (iElem = 0; iElem < nElems[val_section]; iElem++) {
+  for (iElem = 0; iElem < val_count; iElem++) {
     
-    ElementType_t iElemType = elemType;
+    ElementType_t iElemType = val_elem_type;
     
     /*--- If we have a mixed element section, we need to check the elem
      type one-by-one. We also must manually advance the counter to the
@@ -524,68 +621,44 @@ void CCGNSMeshReaderFVM::ReadCGNSVolumeSection(int val_section) {
       iElemType = ElementType_t(connElemCGNS[counterCGNS]);
       npe       = connOffsetCGNS[iElem+1]-connOffsetCGNS[iElem]-1;
       counterCGNS++;
-      for (int jj = 0; jj < npe; jj++) counterCGNS++;
     }
     
     /*--- Store the number of points per element for the current elem. ---*/
     
-    nPoinPerElem[iElem] = npe;
-    
-    /*--- Store the global ID for this element. Note the -1 to move
-     from CGNS convention to SU2 convention. We also subtract off
-     an additional offset in case we have found boundary sections
-     prior to this one, in order to keep the internal element global
-     IDs indexed starting from zero. ---*/
-    
-    elemGlobalID[iElem] = (elementPartitioner.GetFirstIndexOnRank(rank) +
-                           iElem - elemOffset[val_section]);
+    val_npe[iElem] = npe;
     
-    /* Get the VTK type for this element. */
+    /*--- Get the VTK type for this element. ---*/
     
     int vtk_type;
     string elem_name = GetCGNSElementType(iElemType, vtk_type);
-    elemTypes[iElem] = vtk_type;
-    
-  }
-  
-  /*--- Force free the memory for the conn offset from the CGNS file. ---*/
-  
-  vector<cgsize_t>().swap(connOffsetCGNS);
-  
-  /*--- These are internal elems. Allocate memory on each proc. ---*/
-  
-  vector<cgsize_t> connElemTemp(nElems[val_section]*SU2_CONN_SIZE,0);
-  
-  /*--- Copy the connectivity into the larger array with a standard
-   format per element: [globalID vtkType n0 n1 n2 n3 n4 n5 n6 n7 n8]. ---*/
-  
-  counterCGNS = 0;
-  for (iElem = 0; iElem < nElems[val_section]; iElem++) {
     
-    /*--- Store the conn in chunks of SU2_CONN_SIZE for simplicity. ---*/
+    /*--- First, store the global element ID (zero if no ID offset is
+     given, e.g. surface elements) and the VTK type. ---*/
     
     unsigned long nn = iElem*SU2_CONN_SIZE;
     
-    /*--- First, store the global element ID and the VTK type. ---*/
-    
-    connElemTemp[nn] = elemGlobalID[iElem]; nn++;
-    connElemTemp[nn] = elemTypes[iElem];    nn++;
+    val_conn[nn] = (val_id_offset < 0)? 0 : (cgsize_t)(val_first + iElem - val_id_offset); nn++;
+    val_conn[nn] = vtk_type; nn++;
     
     /*--- Store the connectivity values. Note we subtract one from
-     the CGNS 1-based convention. We may also need to remove the first
-     entry if this is a mixed element section. ---*/
+     the CGNS 1-based convention. ---*/
     
-    if (isMixed) counterCGNS++;
-    for (iNode = 0; iNode < (unsigned long)nPoinPerElem[iElem]; iNode++) {
-      connElemTemp[nn] = connElemCGNS[counterCGNS + iNode] - 1; nn++;
+    for (iNode = 0; iNode < (unsigned long)npe; iNode++) {
+      val_conn[nn] = connElemCGNS[counterCGNS + iNode] - 1; nn++;
     }
-    counterCGNS += nPoinPerElem[iElem];
+    counterCGNS += npe;
     
   }
   
-  /*--- Force free the memory for the conn from the CGNS file. ---*/
+}
+
+void CCGNSMeshReaderFVM::DistributeCGNSVolumeElements(int                          val_section,
+                                                      unsigned long                val_count,
+                                                      const vector<cgsize_t>       &val_conn,
+                                                      const vector<unsigned short> &val_npe) {
   
-  vector<cgsize_t>().swap(connElemCGNS);
+  int iProcessor;
+  unsigned long iElem = 0, iPoint = 0, iNode = 0, jNode = 0;
   
   /*--- We now have the connectivity stored in linearly partitioned
    chunks. We need to loop through and decide how many elements we
@@ -610,12 +683,12 @@ void CCGNSMeshReaderFVM::ReadCGNSVolumeSection(int val_section) {
   
   CLinearPartitioner pointPartitioner(numberOfGlobalPoints,0);
   
-  for (iElem = 0; iElem < nElems[val_section]; iElem++) {
-    for (iNode = 0; iNode < (unsigned long)nPoinPerElem[iElem]; iNode++) {
+  for (iElem = 0; iElem < val_count; iElem++) {
+    for (iNode = 0; iNode < (unsigned long)val_npe[iElem]; iNode++) {
       
       /*--- Get the index of the current point. ---*/
       
-      iPoint = connElemTemp[iElem*SU2_CONN_SIZE + SU2_CONN_SKIP + iNode];
+      iPoint = val_conn[iElem*SU2_CONN_SIZE + SU2_CONN_SKIP + iNode];
       
       /*--- Search for the processor that owns this point. ---*/
       
@@ -678,12 +751,12 @@ void CCGNSMeshReaderFVM::ReadCGNSVolumeSection(int val_section) {
   /*--- Loop through our elements and load the elems and their
    additional data that we will send to the other procs. ---*/
   
-  for (iElem = 0; iElem < (unsigned long)nElems[val_section]; iElem++) {
-    for (iNode = 0; iNode < (unsigned long)nPoinPerElem[iElem]; iNode++) {
+  for (iElem = 0; iElem < val_count; iElem++) {
+    for (iNode = 0; iNode < (unsigned long)val_npe[iElem]; iNode++) {
       
       /*--- Get the index of the current point. ---*/
       
-      iPoint = connElemTemp[iElem*SU2_CONN_SIZE + SU2_CONN_SKIP + iNode];
+      iPoint = val_conn[iElem*SU2_CONN_SIZE + SU2_CONN_SKIP + iNode];
       
       /*--- Search for the processor that owns this point ---*/
       
@@ -700,7 +773,7 @@ void CCGNSMeshReaderFVM::ReadCGNSVolumeSection(int val_section) {
          then the connectivity vals, and last, the global ID. ---*/
         
         for (jNode = 0; jNode < SU2_CONN_SIZE; jNode++) {
-          connSend[nn] = connElemTemp[iElem*SU2_CONN_SIZE + jNode]; nn++;
+          connSend[nn] = val_conn[iElem*SU2_CONN_SIZE + jNode]; nn++;
         }
         
         /*--- Increment the index by the message length ---*/
@@ -712,13 +785,6 @@ void CCGNSMeshReaderFVM::ReadCGNSVolumeSection(int val_section) {
     }
   }
   
-  /*--- Force free memory after loading up the send buffer. ---*/
-  
-  vector<cgsize_t>().swap(connElemTemp);
-  vector<cgsize_t>().swap(elemTypes);
-  vector<cgsize_t>().swap(nPoinPerElem);
-  vector<cgsize_t>().swap(elemGlobalID);
-  
   vector<unsigned long>().swap(index);
   
   /*--- Allocate the memory that we need for receiving the conn
@@ -764,35 +830,12 @@ void CCGNSMeshReaderFVM::ReadCGNSVolumeSection(int val_section) {
   
   CompleteCommsAll(nSends, connSendReq, nRecvs, connRecvReq);
   
-  /*--- Store the connectivity for this rank in the proper data
-   structure. First, allocate the appropriate amount of memory
-   for this section, then write the recv'd values. ---*/
-  
-  if (nElem_Recv[size] > 0) {
-    connElems[val_section].resize(nElem_Recv[size]*SU2_CONN_SIZE,0);
-    unsigned long count = 0;
-    for (iElem = 0; iElem < (unsigned long)nElem_Recv[size]; iElem++) {
-      for (iNode = 0; iNode < SU2_CONN_SIZE; iNode++) {
-        unsigned long nn = iElem*SU2_CONN_SIZE+iNode;
-        connElems[val_section][count] = (cgsize_t)connRecv[nn];
-        count++;
-      }
-    }
-    
-    /*--- Store the total number of elements the current rank
-     now has for the current section after completing the comms. ---*/
-    
-    nElems[val_section] = nElem_Recv[size];
-    
-  } else {
-    
-    /*--- The current rank did not recv any elements from this
-     section. Set the count to zero and nullify the data structure. ---*/
-    
-    nElems[val_section]    = 0;
-    connElems[val_section].resize(0);
-    
-  }
+  /*--- Append the connectivity received for this chunk to the
+   data structure of the section, and update the total number of
+   elements the current rank now has for the current section. ---*/
+  
+  connElems[val_section].insert(connElems[val_section].end(), connRecv, connRecv+recvSize);
+  nElems[val_section] += nElem_Recv[size];
   
   /*--- Free temporary memory from communications ---*/
   
@@ -813,26 +856,17 @@ void CCGNSMeshReaderFVM::ReadCGNSSurfaceSection(int val_section) {
    master rank load all of the surface conn. This can help avoid issues
    where there are fewer elements than ranks on a surface. This is later
    linearly partitioned. A limitation of this approach is that there
-   could be a memory bottleneck for extremely large grids, but this has
-   not been reached yet in practice. In that event, we can also read these
-   surface sections with a linear partitioning. ---*/
+   could be a memory bottleneck for extremely large grids, to limit it
+   the section is read in chunks of at most CGNS_READ_CHUNK_SIZE elements,
+   i.e. only the final connectivity of the section is stored in full. ---*/
   
-  int nbndry, parent_flag, npe;
-  unsigned long iElem = 0, iNode = 0;
-  cgsize_t startE, endE, ElementDataSize;
+  int nbndry, parent_flag;
+  cgsize_t startE, endE;
   ElementType_t elemType;
   char sectionName[CGNS_STRING_SIZE];
   
   if (rank == MASTER_NODE) {
     
-    /*--- Allocate some memory for the handling the connectivity
-     and auxiliary data that we are need to communicate. ---*/
-    
-    vector<cgsize_t> connElemCGNS(nElems[val_section]*SU2_CONN_SIZE,0);
-    vector<unsigned short> elemTypes(nElems[val_section],0);
-    vector<unsigned short> nPoinPerElem(nElems[val_section],0);
-    vector<unsigned long>  elemGlobalID(nElems[val_section],0);
-    
     /*--- Read the section info again ---*/
     
     if (cg_section_read(cgnsFileID, cgnsBase, cgnsZone, val_section+1,
@@ -849,89 +883,29 @@ void CCGNSMeshReaderFVM::ReadCGNSSurfaceSection(int val_section) {
     
     nElems[val_section] = (endE-startE+1);
     
-    /*--- Read and store the total amount of data that will be
-     listed when reading this section. ---*/
-    
-    if (cg_ElementDataSize(cgnsFileID, cgnsBase, cgnsZone, val_section+1,
-                           &ElementDataSize))
-      cg_error_exit();
-    
-    /*--- Find the number of nodes required to represent
-     this type of element. ---*/
-    
-    if (cg_npe(elemType, &npe)) cg_error_exit();
-    
-    /*--- Check whether the sections contains a mixture of multiple
-     element types, which will require special handling to get the
-     element type one-by-one when reading. ---*/
-    
-    bool isMixed = false;
-    if (elemType == MIXED) {
-      isMixed = true;
-    }
-    
-    /*--- Allocate memory for accessing the connectivity and to
-     store it in the proper data structure for post-processing. ---*/
-    
-    vector<cgsize_t> connElemTemp(ElementDataSize,0);
-    
-    /*--- Retrieve the connectivity information and store. ---*/
-    
-    if (elemType == MIXED || elemType == NGON_n || elemType == NFACE_n) {
-      vector<cgsize_t> connOffsetTemp(nElems[val_section]+1, 0);
-      if (cg_poly_elements_partial_read(cgnsFileID, cgnsBase, cgnsZone,
-                                        val_section+1, startE, endE,
-                                        connElemTemp.data(),
-                                        connOffsetTemp.data(), NULL) != CG_OK)
-        cg_error_exit();
-    } else {
-      if (cg_elements_read(cgnsFileID, cgnsBase, cgnsZone, val_section+1,
-                           connElemTemp.data(), NULL))
-        cg_error_exit();
-    }
-    
     /*--- Allocate the memory for the data structure used to carry
      the connectivity for this section. ---*/
     
     connElems[val_section].resize(nElems[val_section]*SU2_CONN_SIZE,0);
     
-    unsigned long counterCGNS = 0;
-    for (iElem = 0; iElem < nElems[val_section]; iElem++) {
-      
-      ElementType_t iElemType = elemType;
-      
-      /*--- If we have a mixed element section, we need to check the elem
-       type one-by-one. We also must manually advance the counter. ---*/
-      
-      if (isMixed) {
-        iElemType = ElementType_t(connElemTemp[counterCGNS]);
-        counterCGNS++;
-      }
-      
-      /*--- Get the VTK type for this element. ---*/
-      
-      int vtk_type;
-      string elem_name = GetCGNSElementType(iElemType, vtk_type);
-      
-      /*--- Get the number of nodes per element. ---*/
-      
-      cg_npe(iElemType, &npe);
+    /*--- Load the surface element connectivity into the SU2 data
+     structure with format: [globalID VTK n1 n2 n3 n4 n5 n6 n7 n8].
+     We do not need a global ID for the surface elements, so we
+     simply set that to zero to maintain the same data structure
+     format as the interior elements. ---*/
+    
+    vector<cgsize_t> connElemTemp;
+    vector<unsigned short> nPoinPerElem;
+    
+    for (unsigned long offset = 0; offset < nElems[val_section]; offset += CGNS_READ_CHUNK_SIZE) {
       
-      /*--- Load the surface element connectivity into the SU2 data
-       structure with format: [globalID VTK n1 n2 n3 n4 n5 n6 n7 n8].
-       We do not need a global ID for the surface elements, so we
-       simply set that to zero to maintain the same data structure
-       format as the interior elements. Note that we subtract 1 to
-       move from the CGNS 1-based indexing to SU2's zero-based. ---*/
+      const unsigned long nElemChunk = min(CGNS_READ_CHUNK_SIZE, nElems[val_section]-offset);
       
-      connElems[val_section][iElem*SU2_CONN_SIZE+0] = 0;
-      connElems[val_section][iElem*SU2_CONN_SIZE+1] = vtk_type;
-      for (iNode = 0; iNode < (unsigned long)npe; iNode++) {
-        unsigned long nn = iElem*SU2_CONN_SIZE+SU2_CONN_SKIP+iNode;
-        connElems[val_section][nn] = connElemTemp[counterCGNS] - 1;
-        counterCGNS++;
-      }
+      ReadCGNSElementChunk(val_section, elemType, startE+offset, nElemChunk,
+                           false, -1, connElemTemp, nPoinPerElem);
       
+      copy(connElemTemp.begin(), connElemTemp.end(),
+           connElems[val_section].begin() + offset*SU2_CONN_SIZE);
     }
     
   } else {
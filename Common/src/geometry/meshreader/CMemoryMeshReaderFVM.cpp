@@ -0,0 +1,193 @@
+/*!
+ * \file CMemoryMeshReaderFVM.cpp
+ * \brief Reads a grid held in memory into linear partitions for the
+ *        finite volume solver (FVM).
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/toolboxes/CLinearPartitioner.hpp"
+#include "../../../include/geometry/meshreader/CMemoryMeshReaderFVM.hpp"
+
+CAdaptedMesh CMemoryMeshReaderFVM::pendingMesh;
+bool CMemoryMeshReaderFVM::hasPendingMesh = false;
+
+void CMemoryMeshReaderFVM::SetMesh(CAdaptedMesh&& mesh) {
+  pendingMesh = move(mesh);
+  hasPendingMesh = true;
+}
+
+CMemoryMeshReaderFVM::CMemoryMeshReaderFVM(CConfig        *val_config,
+                                           unsigned short val_iZone,
+                                           unsigned short val_nZone)
+: CMeshReaderFVM(val_config, val_iZone, val_nZone) {
+
+  if (!hasPendingMesh) {
+    SU2_MPI::Error("There is no grid in memory to be read.", CURRENT_FUNCTION);
+  }
+  if (val_nZone > 1) {
+    SU2_MPI::Error("Grids held in memory contain a single zone.", CURRENT_FUNCTION);
+  }
+
+  dimension              = pendingMesh.nDim;
+  numberOfGlobalPoints   = pendingMesh.nPointGlobal;
+  numberOfGlobalElements = pendingMesh.nElemGlobal;
+  numberOfMarkers        = pendingMesh.markerNames.size();
+
+  LoadPointCoordinates();
+  LoadVolumeElementConnectivity();
+  LoadSurfaceElementConnectivity();
+
+  /*--- The grid is read once. ---*/
+
+  pendingMesh = CAdaptedMesh();
+  hasPendingMesh = false;
+
+}
+
+CMemoryMeshReaderFVM::~CMemoryMeshReaderFVM(void) { }
+
+void CMemoryMeshReaderFVM::LoadPointCoordinates() {
+
+  /*--- The points are held in the linear partitions, nDim coordinates per point. ---*/
+
+  numberOfLocalPoints = pendingMesh.coords.size()/dimension;
+
+  localPointCoordinates.resize(dimension);
+  for (unsigned short iDim = 0; iDim < dimension; iDim++) {
+    localPointCoordinates[iDim].resize(numberOfLocalPoints);
+    for (unsigned long iPoint = 0; iPoint < numberOfLocalPoints; iPoint++)
+      localPointCoordinates[iDim][iPoint] = pendingMesh.coords[iPoint*dimension+iDim];
+  }
+  vector<passivedouble>().swap(pendingMesh.coords);
+
+  /*--- The work of the points, if it is known, weights the partitioning. ---*/
+
+  if (!pendingMesh.weights.empty() && (pendingMesh.weights.size() != numberOfLocalPoints)) {
+    SU2_MPI::Error("The weights of the grid held in memory do not match its points.", CURRENT_FUNCTION);
+  }
+  localPointWeights = move(pendingMesh.weights);
+
+}
+
+void CMemoryMeshReaderFVM::LoadVolumeElementConnectivity() {
+
+  CLinearPartitioner pointPartitioner(numberOfGlobalPoints,0);
+
+  const unsigned long nElemHeld = pendingMesh.elems.size()/SU2_BINARY_MESH_ELEM;
+
+  /*--- Every element is needed by the ranks that own at least one of its points, in the
+   format [globalID vtkType n0 ... n7] (see CSU2BinaryMeshReaderFVM). ---*/
+
+  vector<vector<unsigned long> > sendConn(size);
+  vector<int> elemRanks;
+
+  for (unsigned long iElem = 0; iElem < nElemHeld; iElem++) {
+
+    const unsigned long* record = &pendingMesh.elems[iElem*SU2_BINARY_MESH_ELEM];
+
+    unsigned short nNodes = 0;
+    switch (record[0]) {
+      case TRIANGLE:      nNodes = N_POINTS_TRIANGLE;      break;
+      case QUADRILATERAL: nNodes = N_POINTS_QUADRILATERAL; break;
+      case TETRAHEDRON:   nNodes = N_POINTS_TETRAHEDRON;   break;
+      case HEXAHEDRON:    nNodes = N_POINTS_HEXAHEDRON;    break;
+      case PRISM:         nNodes = N_POINTS_PRISM;         break;
+      case PYRAMID:       nNodes = N_POINTS_PYRAMID;       break;
+      default:
+        SU2_MPI::Error("Unsupported volume element type in the grid held in memory.", CURRENT_FUNCTION);
+    }
+
+    elemRanks.clear();
+    for (unsigned short iNode = 0; iNode < nNodes; iNode++)
+      elemRanks.push_back(pointPartitioner.GetRankContainingIndex(record[iNode+1]));
+    sort(elemRanks.begin(), elemRanks.end());
+    elemRanks.erase(unique(elemRanks.begin(), elemRanks.end()), elemRanks.end());
+
+    for (auto iRank : elemRanks) {
+      sendConn[iRank].push_back(pendingMesh.firstElem+iElem);
+      sendConn[iRank].insert(sendConn[iRank].end(), record, record+SU2_BINARY_MESH_ELEM);
+    }
+  }
+
+  vector<unsigned long>().swap(pendingMesh.elems);
+
+  /*--- Exchange the elements, the received ones remain sorted by global index. ---*/
+
+  vector<int> nSend(size), nRecv(size), sendDispl(size+1,0), recvDispl(size+1,0);
+
+  for (int iRank = 0; iRank < size; iRank++)
+    nSend[iRank] = sendConn[iRank].size();
+
+  if (size == SINGLE_NODE) {
+    localVolumeElementConnectivity = move(sendConn[0]);
+  }
+  else {
+    SU2_MPI::Alltoall(nSend.data(), 1, MPI_INT, nRecv.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+    for (int iRank = 0; iRank < size; iRank++) {
+      sendDispl[iRank+1] = sendDispl[iRank] + nSend[iRank];
+      recvDispl[iRank+1] = recvDispl[iRank] + nRecv[iRank];
+    }
+
+    vector<unsigned long> sendBuf(sendDispl[size]);
+    for (int iRank = 0; iRank < size; iRank++) {
+      copy(sendConn[iRank].begin(), sendConn[iRank].end(), sendBuf.begin()+sendDispl[iRank]);
+      vector<unsigned long>().swap(sendConn[iRank]);
+    }
+
+    localVolumeElementConnectivity.resize(recvDispl[size]);
+
+    SU2_MPI::Alltoallv(sendBuf.data(), nSend.data(), sendDispl.data(), MPI_UNSIGNED_LONG,
+                       localVolumeElementConnectivity.data(), nRecv.data(), recvDispl.data(),
+                       MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+  }
+
+  numberOfLocalElements = localVolumeElementConnectivity.size()/SU2_CONN_SIZE;
+
+}
+
+void CMemoryMeshReaderFVM::LoadSurfaceElementConnectivity() {
+
+  markerNames = pendingMesh.markerNames;
+  surfaceElementConnectivity.resize(numberOfMarkers);
+
+  if (rank != MASTER_NODE) return;
+
+  for (unsigned long iMarker = 0; iMarker < numberOfMarkers; iMarker++) {
+
+    const vector<unsigned long>& bound = pendingMesh.markers[iMarker];
+    const unsigned long nElem_Bound = bound.size()/SU2_BINARY_MESH_BOUND;
+
+    surfaceElementConnectivity[iMarker].resize(nElem_Bound*SU2_CONN_SIZE, 0);
+
+    for (unsigned long iElem = 0; iElem < nElem_Bound; iElem++) {
+      const unsigned long* record = &bound[iElem*SU2_BINARY_MESH_BOUND];
+      unsigned long* conn = &surfaceElementConnectivity[iMarker][iElem*SU2_CONN_SIZE];
+      conn[1] = record[0];
+      for (unsigned short iNode = 0; iNode < SU2_BINARY_MESH_BOUND-1; iNode++)
+        conn[iNode+SU2_CONN_SKIP] = record[iNode+1];
+    }
+  }
+
+}
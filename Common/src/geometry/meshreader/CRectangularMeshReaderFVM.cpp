@@ -37,8 +37,10 @@ CRectangularMeshReaderFVM::CRectangularMeshReaderFVM(CConfig        *val_config,
   /* The rectangular mesh is always 2D. */
   dimension = 2;
   
-  /* Set the VTK type for the interior elements and the boundary elements. */
-  KindElem  = QUADRILATERAL;
+  /* Set the VTK type for the interior elements and the boundary elements,
+   the quadrilaterals are split into triangles for the non-hexahedral options. */
+  SplitElements = (config->GetKind_MeshBoxElements() != BOX_HEXAHEDRA);
+  KindElem  = SplitElements? TRIANGLE : QUADRILATERAL;
   KindBound = LINE;
   
   /* The number of nodes in the i and j directions. */
@@ -53,6 +55,10 @@ CRectangularMeshReaderFVM::CRectangularMeshReaderFVM(CConfig        *val_config,
   Ox = config->GetMeshBoxOffset(0);
   Oy = config->GetMeshBoxOffset(1);
   
+  /* Clustering of the nodes towards the minus sides. */
+  Cx = config->GetMeshBoxClustering(0);
+  Cy = config->GetMeshBoxClustering(1);
+  
   /* Compute and store the points, interior elements, and surface elements.
    In these routines, we use a simple analytic formula to compute the
    coordinates and the node numbering. We store only the points and interior
@@ -74,77 +80,94 @@ void CRectangularMeshReaderFVM::ComputeRectangularPointCoordinates() {
   /* Get a partitioner to help with linear partitioning. */
   CLinearPartitioner pointPartitioner(numberOfGlobalPoints,0);
 
-  /* Determine number of local points */
-  for(unsigned long globalIndex=0; globalIndex < numberOfGlobalPoints; globalIndex++) {
-    if ((int)pointPartitioner.GetRankContainingIndex(globalIndex) == rank) {
-      numberOfLocalPoints++;
-    }
-  }
+  /* Our linear partition of points is a contiguous range of global indices. */
+  const unsigned long firstIndex = pointPartitioner.GetFirstIndexOnRank(rank);
+  numberOfLocalPoints = pointPartitioner.GetSizeOnRank(rank);
 
-  /* Loop over our analytically defined of coordinates and store only
-   those that contain a node within our linear partition of points. */
+  /* Loop over the global indices of our partition only, the i,j
+   indices of each point are recovered from its global index. */
   localPointCoordinates.resize(dimension);
   for (int k = 0; k < dimension; k++)
     localPointCoordinates[k].reserve(numberOfLocalPoints);
-  unsigned long globalIndex = 0;
-  for (unsigned long jNode = 0; jNode < mNode; jNode++) {
-    for (unsigned long iNode = 0; iNode < nNode; iNode++) {
-      if ((int)pointPartitioner.GetRankContainingIndex(globalIndex) == rank) {
-        
-        /* Store the coordinates more clearly. */
-        const passivedouble x = SU2_TYPE::GetValue(Lx*((su2double)iNode)/((su2double)(nNode-1))+Ox);
-        const passivedouble y = SU2_TYPE::GetValue(Ly*((su2double)jNode)/((su2double)(mNode-1))+Oy);
-        
-        /* Load into the coordinate class data structure. */
-        localPointCoordinates[0].push_back(x);
-        localPointCoordinates[1].push_back(y);
-      }
-      globalIndex++;
-    }
+
+  for (unsigned long globalIndex = firstIndex; globalIndex < firstIndex+numberOfLocalPoints; globalIndex++) {
+
+    const unsigned long iNode = globalIndex%nNode;
+    const unsigned long jNode = globalIndex/nNode;
+
+    /* Load into the coordinate class data structure. */
+    localPointCoordinates[0].push_back(AnalyticGridCoordinate(Lx, Ox, Cx, iNode, nNode));
+    localPointCoordinates[1].push_back(AnalyticGridCoordinate(Ly, Oy, Cy, jNode, mNode));
   }
   
 }
 
 void CRectangularMeshReaderFVM::ComputeRectangularVolumeConnectivity() {
   
+  /* Number of elements per quadrilateral of the rectangle. */
+  const unsigned short nSplit = SplitElements? 2 : 1;
+  
   /* Set the global count of elements based on the grid dimensions. */
-  numberOfGlobalElements = (nNode-1)*(mNode-1);
+  numberOfGlobalElements = (nNode-1)*(mNode-1)*nSplit;
   
   /* Get a partitioner to help with linear partitioning. */
   CLinearPartitioner pointPartitioner(numberOfGlobalPoints,0);
   
+  const unsigned long firstIndex = pointPartitioner.GetFirstIndexOnRank(rank);
+  const unsigned long lastIndex  = firstIndex + pointPartitioner.GetSizeOnRank(rank);
+  
+  /* Only the quadrilaterals with a node in our partition are visited, their
+   lowest corner is at most one row and one node before our first point. */
+  const unsigned long firstCorner = (firstIndex > nNode+1)? firstIndex-nNode-1 : 0;
+  
   /* Loop over our analytically defined of elements and store only those
    that contain a node within our linear partition of points. */
   numberOfLocalElements  = 0;
-  vector<unsigned long> connectivity(N_POINTS_HEXAHEDRON,0);
-  unsigned long globalIndex = 0;
-  for (unsigned long jNode = 0; jNode < mNode-1; jNode++) {
-    for (unsigned long iNode = 0; iNode < nNode-1; iNode++) {
+  unsigned long connectivity[N_POINTS_QUADRILATERAL];
+  unsigned long element[N_POINTS_HEXAHEDRON];
+  
+  for (unsigned long corner = firstCorner; corner < lastIndex; corner++) {
+    
+    const unsigned long iNode = corner%nNode;
+    const unsigned long jNode = corner/nNode;
+    
+    if ((iNode == nNode-1) || (jNode >= mNode-1)) continue;
+    
+    const unsigned long globalQuad = jNode*(nNode-1) + iNode;
+    
+    /* Compute connectivity based on the i,j index. */
+    connectivity[0] = corner;
+    connectivity[1] = corner + 1;
+    connectivity[2] = corner + nNode + 1;
+    connectivity[3] = corner + nNode;
+    
+    for (unsigned short iSplit = 0; iSplit < nSplit; iSplit++) {
+      
+      /* Nodes of the element, the triangles are 0-1-2 and 0-2-3, unused entries are 0. */
+      const unsigned short nNodeElem = SplitElements? N_POINTS_TRIANGLE : N_POINTS_QUADRILATERAL;
+      for (unsigned short i = 0; i < N_POINTS_HEXAHEDRON; i++) element[i] = 0;
       
-      /* Compute connectivity based on the i,j index. */
-      connectivity[0] = jNode*nNode + iNode;
-      connectivity[1] = jNode*nNode + iNode + 1;
-      connectivity[2] = (jNode + 1)*nNode + (iNode + 1);
-      connectivity[3] = (jNode + 1)*nNode + iNode;
+      element[0] = connectivity[0];
+      for (unsigned short i = 1; i < nNodeElem; i++)
+        element[i] = connectivity[i + iSplit];
       
       /* Check whether any of the points is in our linear partition. */
       bool isOwned = false;
-      for (unsigned short i = 0; i < N_POINTS_QUADRILATERAL; i++) {
-        if ((int)pointPartitioner.GetRankContainingIndex(connectivity[i]) == rank) {
+      for (unsigned short i = 0; i < nNodeElem; i++) {
+        if ((element[i] >= firstIndex) && (element[i] < lastIndex)) {
           isOwned = true;
         }
       }
       
       /* If so, we need to store the element locally. */
       if (isOwned) {
-        localVolumeElementConnectivity.push_back(globalIndex);
+        localVolumeElementConnectivity.push_back(globalQuad*nSplit + iSplit);
         localVolumeElementConnectivity.push_back(KindElem);
         for (unsigned short i = 0; i < N_POINTS_HEXAHEDRON; i++) {
-          localVolumeElementConnectivity.push_back(connectivity[i]);
+          localVolumeElementConnectivity.push_back(element[i]);
         }
         numberOfLocalElements++;
       }
-      globalIndex++;
     }
   }
   
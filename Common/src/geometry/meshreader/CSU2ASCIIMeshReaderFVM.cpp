@@ -29,6 +29,22 @@
 #include "../../../include/toolboxes/CLinearPartitioner.hpp"
 #include "../../../include/geometry/meshreader/CSU2ASCIIMeshReaderFVM.hpp"
 
+namespace {
+/*--- Number of points of the supported element types, 0 if not supported. ---*/
+unsigned short NumberOfPoints(unsigned long VTK_Type) {
+  switch (VTK_Type) {
+    case LINE:          return N_POINTS_LINE;
+    case TRIANGLE:      return N_POINTS_TRIANGLE;
+    case QUADRILATERAL: return N_POINTS_QUADRILATERAL;
+    case TETRAHEDRON:   return N_POINTS_TETRAHEDRON;
+    case HEXAHEDRON:    return N_POINTS_HEXAHEDRON;
+    case PRISM:         return N_POINTS_PRISM;
+    case PYRAMID:       return N_POINTS_PYRAMID;
+    default:            return 0;
+  }
+}
+}
+
 CSU2ASCIIMeshReaderFVM::CSU2ASCIIMeshReaderFVM(CConfig        *val_config,
                                                unsigned short val_iZone,
                                                unsigned short val_nZone)
@@ -75,152 +91,152 @@ void CSU2ASCIIMeshReaderFVM::ReadMetadata() {
   bool harmonic_balance = config->GetTime_Marching() == HARMONIC_BALANCE;
   bool multizone_file = config->GetMultizone_Mesh();
   
-  /*--- Open grid file ---*/
-  
-  mesh_file.open(meshFilename.c_str(), ios::in);
-  if (mesh_file.fail()) {
-    SU2_MPI::Error(string("Error opening SU2 ASCII grid.") +
-                   string(" \n Check that the file exists."), CURRENT_FUNCTION);
-  }
+  /*--- The master reads the metadata and indexes the sections of the
+   zone (the lines are only counted, not parsed), such that the other
+   ranks can seek directly to their linear partitions. ---*/
   
-  /*--- If more than one, find the curent zone in the mesh file. ---*/
+  bool foundNDIME = false, foundNPOIN = false;
+  bool foundNELEM = false, foundNMARK = false;
+  passivedouble AoA_Offset = 0.0, AoS_Offset = 0.0;
   
-  string text_line;
-  string::size_type position;
-  if ((nZones > 1 && multizone_file) || harmonic_balance) {
-    if (harmonic_balance) {
-      if (rank == MASTER_NODE)
+  if (rank == MASTER_NODE) {
+    
+    /*--- Open grid file ---*/
+    
+    mesh_file.open(meshFilename.c_str(), ios::in | ios::binary);
+    if (mesh_file.fail()) {
+      SU2_MPI::Error(string("Error opening SU2 ASCII grid.") +
+                     string(" \n Check that the file exists."), CURRENT_FUNCTION);
+    }
+    
+    /*--- If more than one, find the curent zone in the mesh file. ---*/
+    
+    string text_line;
+    string::size_type position;
+    if ((nZones > 1 && multizone_file) || harmonic_balance) {
+      if (harmonic_balance) {
         cout << "Reading time instance " << config->GetiInst()+1 << "." << endl;
-    } else {
-      bool foundZone = false;
-      while (getline (mesh_file,text_line)) {
-        /*--- Search for the current domain ---*/
-        position = text_line.find ("IZONE=",0);
-        if (position != string::npos) {
-          text_line.erase (0,6);
-          unsigned short jZone = atoi(text_line.c_str());
-          if (jZone == myZone+1) {
-            if (rank == MASTER_NODE)
+      } else {
+        bool foundZone = false;
+        while (getline (mesh_file,text_line)) {
+          /*--- Search for the current domain ---*/
+          position = text_line.find ("IZONE=",0);
+          if (position != string::npos) {
+            text_line.erase (0,6);
+            unsigned short jZone = atoi(text_line.c_str());
+            if (jZone == myZone+1) {
               cout << "Reading zone " << myZone << " from native SU2 ASCII mesh." << endl;
-            foundZone = true;
-            break;
+              foundZone = true;
+              break;
+            }
           }
         }
-      }
-      if (!foundZone) {
-        SU2_MPI::Error(string("Could not find the IZONE= keyword or the zone contents.") +
-                       string(" \n Check the SU2 ASCII file format."),
-                       CURRENT_FUNCTION);
+        if (!foundZone) {
+          SU2_MPI::Error(string("Could not find the IZONE= keyword or the zone contents.") +
+                         string(" \n Check the SU2 ASCII file format."),
+                         CURRENT_FUNCTION);
+        }
       }
     }
-  }
-  
-  /*--- Read the metadata: problem dimension, offsets for angle
-   of attack and angle of sideslip, global points, global elements,
-   and number of markers. Perform error checks as we go. ---*/
-  
-  bool foundNDIME = false, foundNPOIN = false;
-  bool foundNELEM = false, foundNMARK = false;
-  
-  while (getline (mesh_file, text_line)) {
-    
-    /*--- Read the dimension of the problem ---*/
     
-    position = text_line.find ("NDIME=",0);
-    if (position != string::npos) {
-      text_line.erase (0,6);
-      dimension = atoi(text_line.c_str());
-      foundNDIME = true;
-    }
+    /*--- Read the metadata: problem dimension, offsets for angle
+     of attack and angle of sideslip, global points, global elements,
+     and number of markers. ---*/
     
-    /*--- The AoA and AoS offset values are optional. ---*/
+    unsigned long lineOffset = mesh_file.tellg();
     
-    position = text_line.find ("AOA_OFFSET=",0);
-    if (position != string::npos) {
-      su2double AoA_Offset = 0.0;
-      text_line.erase (0,11);
-      AoA_Offset = atof(text_line.c_str());
+    while (getline (mesh_file, text_line)) {
       
-      /*--- The offset is in deg ---*/
+      /*--- Read the dimension of the problem ---*/
       
-      su2double AoA_Current = config->GetAoA() + AoA_Offset;
-      
-      if (config->GetDiscard_InFiles() == false) {
-        if ((rank == MASTER_NODE) && (AoA_Offset != 0.0))  {
-          cout.precision(6);
-          cout << fixed <<"WARNING: AoA in the config file (" << config->GetAoA() << " deg.) +" << endl;
-          cout << "         AoA offset in mesh file (" << AoA_Offset << " deg.) = " << AoA_Current << " deg." << endl;
-        }
-        config->SetAoA_Offset(AoA_Offset);
-        config->SetAoA(AoA_Current);
+      position = text_line.find ("NDIME=",0);
+      if (position != string::npos) {
+        text_line.erase (0,6);
+        dimension = atoi(text_line.c_str());
+        foundNDIME = true;
       }
-      else {
-        if ((rank == MASTER_NODE) && (AoA_Offset != 0.0))
-          cout <<"WARNING: Discarding the AoA offset in the geometry file." << endl;
+      
+      /*--- The AoA and AoS offset values are optional. ---*/
+      
+      position = text_line.find ("AOA_OFFSET=",0);
+      if (position != string::npos) {
+        text_line.erase (0,11);
+        AoA_Offset = atof(text_line.c_str());
       }
       
-    }
-    
-    position = text_line.find ("AOS_OFFSET=",0);
-    if (position != string::npos) {
-      su2double AoS_Offset = 0.0;
-      text_line.erase (0,11);
-      AoS_Offset = atof(text_line.c_str());
+      position = text_line.find ("AOS_OFFSET=",0);
+      if (position != string::npos) {
+        text_line.erase (0,11);
+        AoS_Offset = atof(text_line.c_str());
+      }
       
-      /*--- The offset is in deg ---*/
+      position = text_line.find ("NPOIN=",0);
+      if (position != string::npos) {
+        text_line.erase (0,6);
+        numberOfGlobalPoints = atoi(text_line.c_str());
+        IndexSectionLines(numberOfGlobalPoints, pointLineOffsets);
+        foundNPOIN = true;
+      }
       
-      su2double AoS_Current = config->GetAoS() + AoS_Offset;
+      position = text_line.find ("NELEM=",0);
+      if (position != string::npos) {
+        text_line.erase (0,6);
+        numberOfGlobalElements = atoi(text_line.c_str());
+        IndexSectionLines(numberOfGlobalElements, elemLineOffsets);
+        foundNELEM = true;
+      }
       
-      if (config->GetDiscard_InFiles() == false) {
-        if ((rank == MASTER_NODE) && (AoS_Offset != 0.0))  {
-          cout.precision(6);
-          cout << fixed <<"WARNING: AoS in the config file (" << config->GetAoS() << " deg.) +" << endl;
-          cout << "         AoS offset in mesh file (" << AoS_Offset << " deg.) = " << AoS_Current << " deg." << endl;
-        }
-        config->SetAoS_Offset(AoS_Offset);
-        config->SetAoS(AoS_Current);
+      position = text_line.find ("NMARK=",0);
+      if (position != string::npos) {
+        text_line.erase (0,6);
+        numberOfMarkers = atoi(text_line.c_str());
+        markerOffset = lineOffset;
+        foundNMARK = true;
       }
-      else {
-        if ((rank == MASTER_NODE) && (AoS_Offset != 0.0))
-          cout <<"WARNING: Discarding the AoS offset in the geometry file." << endl;
+      
+      /* Stop before we reach the next zone then check for errors below. */
+      position = text_line.find ("IZONE=",0);
+      if (position != string::npos) {
+        break;
       }
       
+      lineOffset = mesh_file.tellg();
     }
     
-    position = text_line.find ("NPOIN=",0);
-    if (position != string::npos) {
-      text_line.erase (0,6);
-      numberOfGlobalPoints = atoi(text_line.c_str());
-      for (unsigned long iPoint = 0; iPoint < numberOfGlobalPoints; iPoint++)
-        getline (mesh_file, text_line);
-      foundNPOIN = true;
-    }
-    
-    position = text_line.find ("NELEM=",0);
-    if (position != string::npos) {
-      text_line.erase (0,6);
-      numberOfGlobalElements = atoi(text_line.c_str());
-      for (unsigned long iElem = 0; iElem < numberOfGlobalElements; iElem++)
-        getline (mesh_file, text_line);
-      foundNELEM = true;
-    }
+    /* Close the mesh file. */
+    mesh_file.close();
     
-    position = text_line.find ("NMARK=",0);
-    if (position != string::npos) {
-      text_line.erase (0,6);
-      numberOfMarkers = atoi(text_line.c_str());
-      foundNMARK = true;
-    }
-    
-    /* Stop before we reach the next zone then check for errors below. */
-    position = text_line.find ("IZONE=",0);
-    if (position != string::npos) {
-      break;
-    }
   }
   
-  /* Close the mesh file. */
-  mesh_file.close();
+  /*--- Broadcast the metadata and the index of the sections. ---*/
+  
+  unsigned long metadata[] = {static_cast<unsigned long>(dimension), numberOfGlobalPoints,
+                              numberOfGlobalElements, numberOfMarkers, markerOffset,
+                              pointLineOffsets.size(), elemLineOffsets.size(),
+                              foundNDIME, foundNPOIN, foundNELEM, foundNMARK};
+  passivedouble offsets[] = {AoA_Offset, AoS_Offset};
+  
+  SU2_MPI::Bcast(metadata, 11, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Bcast(offsets, 2, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+  
+  dimension = metadata[0];
+  numberOfGlobalPoints = metadata[1];
+  numberOfGlobalElements = metadata[2];
+  numberOfMarkers = metadata[3];
+  markerOffset = metadata[4];
+  pointLineOffsets.resize(metadata[5]);
+  elemLineOffsets.resize(metadata[6]);
+  foundNDIME = metadata[7];
+  foundNPOIN = metadata[8];
+  foundNELEM = metadata[9];
+  foundNMARK = metadata[10];
+  AoA_Offset = offsets[0];
+  AoS_Offset = offsets[1];
+  
+  if (!pointLineOffsets.empty())
+    SU2_MPI::Bcast(pointLineOffsets.data(), pointLineOffsets.size(), MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+  if (!elemLineOffsets.empty())
+    SU2_MPI::Bcast(elemLineOffsets.data(), elemLineOffsets.size(), MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
   
   /* Throw an error if any of the keywords was not found. */
   if (!foundNDIME) {
@@ -244,6 +260,140 @@ void CSU2ASCIIMeshReaderFVM::ReadMetadata() {
                    CURRENT_FUNCTION);
   }
   
+  /*--- The offset is in deg ---*/
+  
+  if (AoA_Offset != 0.0) {
+    su2double AoA_Current = config->GetAoA() + AoA_Offset;
+    
+    if (config->GetDiscard_InFiles() == false) {
+      if (rank == MASTER_NODE) {
+        cout.precision(6);
+        cout << fixed <<"WARNING: AoA in the config file (" << config->GetAoA() << " deg.) +" << endl;
+        cout << "         AoA offset in mesh file (" << AoA_Offset << " deg.) = " << AoA_Current << " deg." << endl;
+      }
+      config->SetAoA_Offset(AoA_Offset);
+      config->SetAoA(AoA_Current);
+    }
+    else {
+      if (rank == MASTER_NODE)
+        cout <<"WARNING: Discarding the AoA offset in the geometry file." << endl;
+    }
+  }
+  
+  if (AoS_Offset != 0.0) {
+    su2double AoS_Current = config->GetAoS() + AoS_Offset;
+    
+    if (config->GetDiscard_InFiles() == false) {
+      if (rank == MASTER_NODE) {
+        cout.precision(6);
+        cout << fixed <<"WARNING: AoS in the config file (" << config->GetAoS() << " deg.) +" << endl;
+        cout << "         AoS offset in mesh file (" << AoS_Offset << " deg.) = " << AoS_Current << " deg." << endl;
+      }
+      config->SetAoS_Offset(AoS_Offset);
+      config->SetAoS(AoS_Current);
+    }
+    else {
+      if (rank == MASTER_NODE)
+        cout <<"WARNING: Discarding the AoS offset in the geometry file." << endl;
+    }
+  }
+  
+}
+
+void CSU2ASCIIMeshReaderFVM::IndexSectionLines(unsigned long nLines, vector<unsigned long>& offsets) {
+  
+  /*--- Count the line breaks in large chunks of the file, storing the
+   offset of every LINE_INDEX_STRIDE-th line. ---*/
+  
+  const unsigned long chunkSize = 1<<22;
+  vector<char> chunk(chunkSize);
+  
+  unsigned long chunkOffset = mesh_file.tellg();
+  offsets.clear();
+  offsets.reserve(nLines/LINE_INDEX_STRIDE+2);
+  offsets.push_back(chunkOffset);
+  
+  unsigned long iLine = 0, lineOffset = chunkOffset;
+  while (iLine < nLines) {
+    mesh_file.read(chunk.data(), chunkSize);
+    const unsigned long nRead = mesh_file.gcount();
+    
+    /*--- The last line of the file may not be terminated. ---*/
+    
+    if (nRead == 0) {
+      if ((iLine == nLines-1) && (lineOffset < chunkOffset)) {
+        offsets.push_back(chunkOffset);
+        ++iLine;
+      }
+      break;
+    }
+    
+    const char* begin = chunk.data();
+    const char* end = begin + nRead;
+    const char* next = begin;
+    
+    while (iLine < nLines) {
+      next = static_cast<const char*>(memchr(next, '\n', end-next));
+      if (next == nullptr) break;
+      ++next; ++iLine;
+      lineOffset = chunkOffset + (next-begin);
+      if ((iLine % LINE_INDEX_STRIDE == 0) || (iLine == nLines))
+        offsets.push_back(lineOffset);
+    }
+    chunkOffset += nRead;
+  }
+  
+  if (iLine != nLines) {
+    SU2_MPI::Error(string("The SU2 ASCII mesh ends before the expected number of lines of a section.") +
+                   string(" \n Check the NPOIN= and NELEM= values."), CURRENT_FUNCTION);
+  }
+  
+  /*--- Resume reading after the section. ---*/
+  
+  mesh_file.clear();
+  mesh_file.seekg(offsets.back());
+  
+}
+
+template<class F>
+void CSU2ASCIIMeshReaderFVM::ReadSectionLines(const vector<unsigned long>& offsets, unsigned long firstLine,
+                                              unsigned long lastLine, const F& parseLine) {
+  
+  if (firstLine >= lastLine) return;
+  
+  /*--- Read the blocks of lines (as delimited by the index) containing
+   the range, they are contiguous so we only seek once. ---*/
+  
+  const unsigned long firstBlock = firstLine / LINE_INDEX_STRIDE;
+  const unsigned long lastBlock = (lastLine + LINE_INDEX_STRIDE - 1) / LINE_INDEX_STRIDE;
+  
+  mesh_file.seekg(offsets[firstBlock]);
+  
+  vector<char> block;
+  
+  for (unsigned long iBlock = firstBlock; iBlock < lastBlock; iBlock++) {
+    
+    const unsigned long nBytes = offsets[iBlock+1] - offsets[iBlock];
+    block.resize(nBytes+1);
+    mesh_file.read(block.data(), nBytes);
+    if (static_cast<unsigned long>(mesh_file.gcount()) != nBytes) {
+      SU2_MPI::Error("Could not read the SU2 ASCII mesh, has the file changed?", CURRENT_FUNCTION);
+    }
+    block[nBytes] = '\0';
+    
+    char* line = block.data();
+    char* end = line + nBytes;
+    const unsigned long blockEnd = min((iBlock+1)*LINE_INDEX_STRIDE, lastLine);
+    
+    for (unsigned long iLine = iBlock*LINE_INDEX_STRIDE; iLine < blockEnd; iLine++) {
+      char* next = static_cast<char*>(memchr(line, '\n', end-line));
+      if (next == nullptr) next = end;
+      *next = '\0';
+      if (iLine >= firstLine) parseLine(iLine, line);
+      line = min(next+1, end);
+    }
+  }
+  
 }
 
 void CSU2ASCIIMeshReaderFVM::SplitActuatorDiskSurface() {
@@ -728,456 +878,157 @@ void CSU2ASCIIMeshReaderFVM::ReadPointCoordinates() {
   /* Get a partitioner to help with linear partitioning. */
   CLinearPartitioner pointPartitioner(numberOfGlobalPoints,0);
   
-  /* Determine number of local points */
-  for (unsigned long globalIndex=0; globalIndex < numberOfGlobalPoints; globalIndex++) {
-    if ((int)pointPartitioner.GetRankContainingIndex(globalIndex) == rank) {
-      numberOfLocalPoints++;
-    }
-  }
+  /* Determine the range of local points, the new points of an
+   actuator disk are not in the file, they are at the end. */
+  const unsigned long firstPoint = pointPartitioner.GetFirstIndexOnRank(rank);
+  numberOfLocalPoints = pointPartitioner.GetSizeOnRank(rank);
+  const unsigned long lastPoint = firstPoint + numberOfLocalPoints;
+  const unsigned long numberOfFilePoints = numberOfGlobalPoints - ActDiskNewPoints;
   
   /* Prepare our data structure for the point coordinates. */
   localPointCoordinates.resize(dimension);
   for (int k = 0; k < dimension; k++)
     localPointCoordinates[k].reserve(numberOfLocalPoints);
   
-  /*--- Open the mesh file and jump to our zone. ---*/
-  
-  mesh_file.open(meshFilename, ios::in);
-  FastForwardToMyZone();
+  /*--- Open the mesh file and read the lines of our linear partition. ---*/
   
-  /*--- Read the point coordinates into our data structure. ---*/
+  mesh_file.open(meshFilename, ios::in | ios::binary);
   
-  string text_line;
-  string::size_type position;
-  while (getline (mesh_file, text_line)) {
-    
-    position = text_line.find ("NPOIN=",0);
-    if (position != string::npos) {
-      
-      unsigned long GlobalIndex = 0;
-      while (GlobalIndex < numberOfGlobalPoints) {
-        
-        if (!actuator_disk) { getline(mesh_file, text_line); }
-        else {
-          if (GlobalIndex < numberOfGlobalPoints-ActDiskNewPoints) {
-            getline(mesh_file, text_line);
-          }
-          else {
-            /* This is a new actuator disk point, so we must construct a
-             string with the new point's coordinates. */
-            ostringstream strsX, strsY, strsZ;
-            unsigned long BackActDisk_Index = GlobalIndex;
-            unsigned long LocalIndex = BackActDisk_Index - (numberOfGlobalPoints-ActDiskNewPoints);
-            strsX.precision(20); strsY.precision(20); strsZ.precision(20);
-            su2double CoordX = CoordXActDisk[LocalIndex]; strsX << scientific << CoordX;
-            su2double CoordY = CoordYActDisk[LocalIndex]; strsY << scientific << CoordY;
-            su2double CoordZ = CoordZActDisk[LocalIndex]; strsZ << scientific << CoordZ;
-            text_line = strsX.str() + "\t" + strsY.str() + "\t" + strsZ.str();
-          }
-        }
-        
-        /*--- We only read information for this node if it is owned by this
-         rank based upon our initial linear partitioning. ---*/
-        
-        passivedouble Coords[3] = {0.0,0.0,0.0};
-        if ((int)pointPartitioner.GetRankContainingIndex(GlobalIndex) == rank) {
-          
-          istringstream point_line(text_line);
-          
-          /* Store the coordinates more clearly. */
-          if (dimension == 2) {
-            point_line >> Coords[0];
-            point_line >> Coords[1];
-          } else {
-            point_line >> Coords[0];
-            point_line >> Coords[1];
-            point_line >> Coords[2];
-          }
-          
-          /* Load into the coordinate class data structure. */
-          for (unsigned short iDim = 0; iDim < dimension; iDim++) {
-            localPointCoordinates[iDim].push_back(Coords[iDim]);
-            
-          }
-        }
-        GlobalIndex++;
-      }
+  ReadSectionLines(pointLineOffsets, firstPoint, min(lastPoint, numberOfFilePoints),
+                   [&](unsigned long, const char* line) {
+    char* next = nullptr;
+    for (int iDim = 0; iDim < dimension; iDim++) {
+      localPointCoordinates[iDim].push_back(strtod(line, &next));
+      line = next;
     }
-  }
+  });
   
   mesh_file.close();
   
+  /*--- Add the new points of the actuator disk. ---*/
+  
+  for (unsigned long GlobalIndex = max(firstPoint, numberOfFilePoints); GlobalIndex < lastPoint; GlobalIndex++) {
+    const unsigned long LocalIndex = GlobalIndex - numberOfFilePoints;
+    const su2double Coords[] = {CoordXActDisk[LocalIndex], CoordYActDisk[LocalIndex], CoordZActDisk[LocalIndex]};
+    for (int iDim = 0; iDim < dimension; iDim++)
+      localPointCoordinates[iDim].push_back(SU2_TYPE::GetValue(Coords[iDim]));
+  }
+  
 }
 
 void CSU2ASCIIMeshReaderFVM::ReadVolumeElementConnectivity() {
   
-  /* Get a partitioner to help with linear partitioning. */
+  /* Get partitioners to help with linear partitioning. */
   CLinearPartitioner pointPartitioner(numberOfGlobalPoints,0);
+  CLinearPartitioner elemPartitioner(numberOfGlobalElements,0);
   
-  /* Loop over our analytically defined of elements and store only those
-   that contain a node within our linear partition of points. */
-  numberOfLocalElements  = 0;
-  vector<unsigned long> connectivity(N_POINTS_HEXAHEDRON,0);
+  const unsigned long firstElem = elemPartitioner.GetFirstIndexOnRank(rank);
+  const unsigned long lastElem = firstElem + elemPartitioner.GetSizeOnRank(rank);
+  const unsigned long numberOfFilePoints = numberOfGlobalPoints - ActDiskNewPoints;
   
-  /*--- Open the mesh file and jump to our zone. ---*/
+  /*--- Parse the elements of our linear partition of elements, storing
+   them with the ranks that need them, i.e. those owning at least one of
+   their points (there will be element redundancy, since multiple ranks
+   will store the same elems on the boundaries of the initial linear
+   partitioning of points). ---*/
   
-  mesh_file.open(meshFilename, ios::in);
-  FastForwardToMyZone();
+  vector<unsigned long> parsedElems;
+  parsedElems.reserve((lastElem-firstElem)*SU2_CONN_SIZE);
+  vector<unsigned long> elemRanksPtr(1,0);
+  vector<int> elemRanks;
+  vector<int> nElemSend(size,0);
   
-  string text_line;
-  string::size_type position;
-  while (getline (mesh_file, text_line)) {
+  mesh_file.open(meshFilename, ios::in | ios::binary);
+  
+  ReadSectionLines(elemLineOffsets, firstElem, lastElem, [&](unsigned long GlobalIndex, const char* line) {
     
-    /*--- Find the section containing the interior elements. ---*/
+    char* next = nullptr;
+    const unsigned short VTK_Type = strtoul(line, &next, 10);
+    const unsigned short nPoints = NumberOfPoints(VTK_Type);
+    if ((nPoints == 0) || (VTK_Type == LINE)) {
+      SU2_MPI::Error(string("Unknown volume element type in line ") + to_string(GlobalIndex) +
+                     string(" of the NELEM section.\n Check the SU2 ASCII file format."), CURRENT_FUNCTION);
+    }
     
-    position = text_line.find ("NELEM=",0);
-    if (position != string::npos) {
-      
-      /*--- Loop over all the volumetric elements and store any element that
-       contains at least one of an owned node for this rank (i.e., there will
-       be element redundancy, since multiple ranks will store the same elems
-       on the boundaries of the initial linear partitioning. ---*/
-      
-      numberOfLocalElements = 0;
-      unsigned long GlobalIndex = 0;
-      bool isOwned = false;
-      while (GlobalIndex < numberOfGlobalElements) {
-        getline(mesh_file, text_line);
-        istringstream elem_line(text_line);
-        
-        /*--- Decide whether this rank needs each element. ---*/
-        
-        unsigned short VTK_Type;
-        elem_line >> VTK_Type;
-        
-        switch(VTK_Type) {
-            
-          case TRIANGLE:
-            
-            /*--- Store the connectivity for this element more clearly. ---*/
-            
-            elem_line >> connectivity[0];
-            elem_line >> connectivity[1];
-            elem_line >> connectivity[2];
-            
-            /*--- Adjust for actuator disk splitting if necessary. ---*/
-            
-            if (actuator_disk) {
-              for (unsigned short i = 0; i<N_POINTS_TRIANGLE; i++) {
-                if (ActDisk_Bool[connectivity[i]]) {
-                  
-                  su2double Xcg = 0.0; unsigned long Counter = 0;
-                  for (unsigned short j = 0; j<N_POINTS_TRIANGLE; j++) {
-                    if (connectivity[j] < numberOfGlobalPoints-ActDiskNewPoints) {
-                      Xcg += CoordXVolumePoint[VolumePoint_Inv[connectivity[j]]];
-                      Counter++;
-                    }
-                  }
-                  Xcg = Xcg / su2double(Counter);
-                  
-                  if (Counter != 0)  {
-                    if (Xcg > Xloc) {
-                      connectivity[i] = ActDiskPoint_Back[connectivity[i]];
-                    }
-                    else { connectivity[i] = connectivity[i]; }
-                  }
-                  
-                }
-              }
-            }
-            
-            /* Check whether any of the points reside in our linear partition. */
-            isOwned = false;
-            for (unsigned short i = 0; i < N_POINTS_TRIANGLE; i++) {
-              if ((int)pointPartitioner.GetRankContainingIndex(connectivity[i]) == rank) {
-                isOwned = true;
-              }
-            }
-            
-            /* If so, we need to store the element locally. */
-            if (isOwned) {
-              localVolumeElementConnectivity.push_back(GlobalIndex);
-              localVolumeElementConnectivity.push_back(VTK_Type);
-              for (unsigned short i = 0; i < N_POINTS_HEXAHEDRON; i++) {
-                localVolumeElementConnectivity.push_back(connectivity[i]);
-              }
-              numberOfLocalElements++;
-            }
-            GlobalIndex++;
-            break;
-            
-          case QUADRILATERAL:
-            
-            /*--- Load the connectivity for this element. ---*/
-            
-            elem_line >> connectivity[0];
-            elem_line >> connectivity[1];
-            elem_line >> connectivity[2];
-            elem_line >> connectivity[3];
-            
-            if (actuator_disk) {
-              for (unsigned short  i = 0; i<N_POINTS_QUADRILATERAL; i++) {
-                if (ActDisk_Bool[connectivity[i]]) {
-                  
-                  su2double Xcg = 0.0; unsigned long Counter = 0;
-                  for (unsigned short j = 0; j<N_POINTS_QUADRILATERAL; j++) {
-                    if (connectivity[j] < numberOfGlobalPoints-ActDiskNewPoints) {
-                      Xcg += CoordXVolumePoint[VolumePoint_Inv[connectivity[j]]];
-                      Counter++;
-                    }
-                  }
-                  Xcg = Xcg / su2double(Counter);
-                  
-                  
-                  if (Counter != 0)  {
-                    if (Xcg > Xloc) {
-                      connectivity[i] = ActDiskPoint_Back[connectivity[i]];
-                    }
-                    else { connectivity[i] = connectivity[i]; }
-                  }
-                  
-                }
-              }
-            }
-            
-            /* Check whether any of the points reside in our linear partition. */
-            isOwned = false;
-            for (unsigned short i = 0; i < N_POINTS_QUADRILATERAL; i++) {
-              if ((int)pointPartitioner.GetRankContainingIndex(connectivity[i]) == rank) {
-                isOwned = true;
-              }
-            }
-            
-            /* If so, we need to store the element locally. */
-            if (isOwned) {
-              localVolumeElementConnectivity.push_back(GlobalIndex);
-              localVolumeElementConnectivity.push_back(VTK_Type);
-              for (unsigned short i = 0; i < N_POINTS_HEXAHEDRON; i++) {
-                localVolumeElementConnectivity.push_back(connectivity[i]);
-              }
-              numberOfLocalElements++;
-            }
-            GlobalIndex++;
-            break;
-            
-          case TETRAHEDRON:
-            
-            /*--- Load the connectivity for this element. ---*/
-            
-            elem_line >> connectivity[0];
-            elem_line >> connectivity[1];
-            elem_line >> connectivity[2];
-            elem_line >> connectivity[3];
-            
-            if (actuator_disk) {
-              for (unsigned short  i = 0; i<N_POINTS_TETRAHEDRON; i++) {
-                if (ActDisk_Bool[connectivity[i]]) {
-                  
-                  su2double Xcg = 0.0; unsigned long Counter = 0;
-                  for (unsigned short j = 0; j<N_POINTS_TETRAHEDRON; j++) {
-                    if (connectivity[j] < numberOfGlobalPoints-ActDiskNewPoints) {
-                      Xcg += CoordXVolumePoint[VolumePoint_Inv[connectivity[j]]];
-                      Counter++;
-                    }
-                  }
-                  Xcg = Xcg / su2double(Counter);
-                  
-                  
-                  if (Counter != 0)  {
-                    if (Xcg > Xloc) {
-                      connectivity[i] = ActDiskPoint_Back[connectivity[i]];
-                    }
-                    else { connectivity[i] = connectivity[i]; }
-                  }
-                  
-                }
-              }
-            }
-            
-            /* Check whether any of the points reside in our linear partition. */
-            isOwned = false;
-            for (unsigned short i = 0; i < N_POINTS_TETRAHEDRON; i++) {
-              if ((int)pointPartitioner.GetRankContainingIndex(connectivity[i]) == rank) {
-                isOwned = true;
-              }
-            }
-            
-            /* If so, we need to store the element locally. */
-            if (isOwned) {
-              localVolumeElementConnectivity.push_back(GlobalIndex);
-              localVolumeElementConnectivity.push_back(VTK_Type);
-              for (unsigned short i = 0; i < N_POINTS_HEXAHEDRON; i++) {
-                localVolumeElementConnectivity.push_back(connectivity[i]);
-              }
-              numberOfLocalElements++;
-            }
-            GlobalIndex++;
-            break;
-            
-          case HEXAHEDRON:
-            
-            /*--- Load the connectivity for this element. ---*/
-            
-            elem_line >> connectivity[0];
-            elem_line >> connectivity[1];
-            elem_line >> connectivity[2];
-            elem_line >> connectivity[3];
-            elem_line >> connectivity[4];
-            elem_line >> connectivity[5];
-            elem_line >> connectivity[6];
-            elem_line >> connectivity[7];
-            
-            if (actuator_disk) {
-              for (unsigned short  i = 0; i<N_POINTS_HEXAHEDRON; i++) {
-                if (ActDisk_Bool[connectivity[i]]) {
-                  
-                  su2double Xcg = 0.0; unsigned long Counter = 0;
-                  for (unsigned short j = 0; j<N_POINTS_HEXAHEDRON; j++) {
-                    if (connectivity[j] < numberOfGlobalPoints-ActDiskNewPoints) {
-                      Xcg += CoordXVolumePoint[VolumePoint_Inv[connectivity[j]]];
-                      Counter++;
-                    }
-                  }
-                  Xcg = Xcg / su2double(Counter);
-                  
-                  if (Counter != 0)  {
-                    if (Xcg > Xloc) { connectivity[i] = ActDiskPoint_Back[connectivity[i]]; }
-                    else { connectivity[i] = connectivity[i]; }
-                  }
-                }
-              }
-            }
-            
-            /* Check whether any of the points reside in our linear partition. */
-            isOwned = false;
-            for (unsigned short i = 0; i < N_POINTS_HEXAHEDRON; i++) {
-              if ((int)pointPartitioner.GetRankContainingIndex(connectivity[i]) == rank) {
-                isOwned = true;
-              }
-            }
-            
-            /* If so, we need to store the element locally. */
-            if (isOwned) {
-              localVolumeElementConnectivity.push_back(GlobalIndex);
-              localVolumeElementConnectivity.push_back(VTK_Type);
-              for (unsigned short i = 0; i < N_POINTS_HEXAHEDRON; i++) {
-                localVolumeElementConnectivity.push_back(connectivity[i]);
-              }
-              numberOfLocalElements++;
-            }
-            GlobalIndex++;
-            break;
-            
-          case PRISM:
-            
-            /*--- Load the connectivity for this element. ---*/
-            
-            elem_line >> connectivity[0];
-            elem_line >> connectivity[1];
-            elem_line >> connectivity[2];
-            elem_line >> connectivity[3];
-            elem_line >> connectivity[4];
-            elem_line >> connectivity[5];
-            
-            if (actuator_disk) {
-              for (unsigned short i = 0; i<N_POINTS_PRISM; i++) {
-                if (ActDisk_Bool[connectivity[i]]) {
-                  
-                  su2double Xcg = 0.0; unsigned long Counter = 0;
-                  for (unsigned short j = 0; j<N_POINTS_PRISM; j++) {
-                    if (connectivity[j] < numberOfGlobalPoints-ActDiskNewPoints) {
-                      Xcg += CoordXVolumePoint[VolumePoint_Inv[connectivity[j]]];
-                      Counter++;
-                    }
-                  }
-                  Xcg = Xcg / su2double(Counter);
-                  
-                  if (Counter != 0)  {
-                    if (Xcg > Xloc) { connectivity[i] = ActDiskPoint_Back[connectivity[i]]; }
-                    else { connectivity[i] = connectivity[i]; }
-                  }
-                }
-              }
-            }
-            
-            /* Check whether any of the points reside in our linear partition. */
-            isOwned = false;
-            for (unsigned short i = 0; i < N_POINTS_PRISM; i++) {
-              if ((int)pointPartitioner.GetRankContainingIndex(connectivity[i]) == rank) {
-                isOwned = true;
-              }
-            }
-            
-            /* If so, we need to store the element locally. */
-            if (isOwned) {
-              localVolumeElementConnectivity.push_back(GlobalIndex);
-              localVolumeElementConnectivity.push_back(VTK_Type);
-              for (unsigned short i = 0; i < N_POINTS_HEXAHEDRON; i++) {
-                localVolumeElementConnectivity.push_back(connectivity[i]);
-              }
-              numberOfLocalElements++;
-            }
-            GlobalIndex++;
-            break;
-            
-          case PYRAMID:
-            
-            /*--- Load the connectivity for this element. ---*/
-            
-            elem_line >> connectivity[0];
-            elem_line >> connectivity[1];
-            elem_line >> connectivity[2];
-            elem_line >> connectivity[3];
-            elem_line >> connectivity[4];
-            
-            if (actuator_disk) {
-              for (unsigned short i = 0; i<N_POINTS_PYRAMID; i++) {
-                if (ActDisk_Bool[connectivity[i]]) {
-                  
-                  su2double Xcg = 0.0; unsigned long Counter = 0;
-                  for (unsigned short j = 0; j<N_POINTS_PYRAMID; j++) {
-                    if (connectivity[j] < numberOfGlobalPoints-ActDiskNewPoints) {
-                      Xcg += CoordXVolumePoint[VolumePoint_Inv[connectivity[j]]];
-                      Counter++;
-                    }
-                  }
-                  Xcg = Xcg / su2double(Counter);
-                  
-                  if (Counter != 0)  {
-                    if (Xcg > Xloc) { connectivity[i] = ActDiskPoint_Back[connectivity[i]]; }
-                    else { connectivity[i] = connectivity[i]; }
-                  }
-                }
-              }
-            }
-            
-            /* Check whether any of the points reside in our linear partition. */
-            isOwned = false;
-            for (unsigned short i = 0; i < N_POINTS_PYRAMID; i++) {
-              if ((int)pointPartitioner.GetRankContainingIndex(connectivity[i]) == rank) {
-                isOwned = true;
-              }
-            }
-            
-            /* If so, we need to store the element locally. */
-            if (isOwned) {
-              localVolumeElementConnectivity.push_back(GlobalIndex);
-              localVolumeElementConnectivity.push_back(VTK_Type);
-              for (unsigned short i = 0; i < N_POINTS_HEXAHEDRON; i++) {
-                localVolumeElementConnectivity.push_back(connectivity[i]);
-              }
-              numberOfLocalElements++;
+    unsigned long connectivity[N_POINTS_HEXAHEDRON] = {0};
+    for (unsigned short i = 0; i < nPoints; i++) {
+      line = next;
+      connectivity[i] = strtoul(line, &next, 10);
+    }
+    
+    /*--- Adjust for actuator disk splitting if necessary. ---*/
+    
+    if (actuator_disk) {
+      for (unsigned short i = 0; i < nPoints; i++) {
+        if (ActDisk_Bool[connectivity[i]]) {
+          
+          su2double Xcg = 0.0; unsigned long Counter = 0;
+          for (unsigned short j = 0; j < nPoints; j++) {
+            if (connectivity[j] < numberOfFilePoints) {
+              Xcg += CoordXVolumePoint[VolumePoint_Inv[connectivity[j]]];
+              Counter++;
             }
-            GlobalIndex++;
-            break;
+          }
+          
+          if ((Counter != 0) && (Xcg / su2double(Counter) > Xloc)) {
+            connectivity[i] = ActDiskPoint_Back[connectivity[i]];
+          }
         }
       }
-      if (GlobalIndex == numberOfGlobalElements) break;
     }
-  }
+    
+    parsedElems.push_back(GlobalIndex);
+    parsedElems.push_back(VTK_Type);
+    parsedElems.insert(parsedElems.end(), connectivity, connectivity+N_POINTS_HEXAHEDRON);
+    
+    /* The ranks that own the points of the element, without repetitions. */
+    const unsigned long begin = elemRanksPtr.back();
+    for (unsigned short i = 0; i < nPoints; i++) {
+      const int iRank = pointPartitioner.GetRankContainingIndex(connectivity[i]);
+      if (find(elemRanks.begin()+begin, elemRanks.end(), iRank) == elemRanks.end()) {
+        elemRanks.push_back(iRank);
+        nElemSend[iRank]++;
+      }
+    }
+    elemRanksPtr.push_back(elemRanks.size());
+  });
   
   mesh_file.close();
   
+  /*--- Sort the elements by destination, they stay sorted by global index for each rank. ---*/
+  
+  vector<int> nElemRecv(size), sendCount(size), recvCount(size), sendDispl(size+1,0), recvDispl(size+1,0);
+  
+  SU2_MPI::Alltoall(nElemSend.data(), 1, MPI_INT, nElemRecv.data(), 1, MPI_INT, MPI_COMM_WORLD);
+  
+  for (int iRank = 0; iRank < size; iRank++) {
+    sendCount[iRank] = nElemSend[iRank]*SU2_CONN_SIZE;
+    recvCount[iRank] = nElemRecv[iRank]*SU2_CONN_SIZE;
+    sendDispl[iRank+1] = sendDispl[iRank] + sendCount[iRank];
+    recvDispl[iRank+1] = recvDispl[iRank] + recvCount[iRank];
+  }
+  
+  vector<unsigned long> sendElems(sendDispl[size]);
+  vector<int> counter(sendDispl.begin(), sendDispl.end()-1);
+  
+  for (unsigned long iElem = 0; iElem+1 < elemRanksPtr.size(); iElem++) {
+    for (auto k = elemRanksPtr[iElem]; k < elemRanksPtr[iElem+1]; k++) {
+      const int iRank = elemRanks[k];
+      copy_n(&parsedElems[iElem*SU2_CONN_SIZE], SU2_CONN_SIZE, &sendElems[counter[iRank]]);
+      counter[iRank] += SU2_CONN_SIZE;
+    }
+  }
+  
+  vector<unsigned long>().swap(parsedElems);
+  
+  localVolumeElementConnectivity.resize(recvDispl[size]);
+  
+  SU2_MPI::Alltoallv(sendElems.data(), sendCount.data(), sendDispl.data(), MPI_UNSIGNED_LONG,
+                     localVolumeElementConnectivity.data(), recvCount.data(), recvDispl.data(),
+                     MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+  
+  numberOfLocalElements = recvDispl[size] / SU2_CONN_SIZE;
+  
 }
 
 void CSU2ASCIIMeshReaderFVM::ReadSurfaceElementConnectivity() {
@@ -1192,8 +1043,8 @@ void CSU2ASCIIMeshReaderFVM::ReadSurfaceElementConnectivity() {
    however, the surface connectivity is still handled by the
    master node (and eventually distributed by the master as well). ---*/
   
-  mesh_file.open(meshFilename, ios::in);
-  FastForwardToMyZone();
+  mesh_file.open(meshFilename, ios::in | ios::binary);
+  mesh_file.seekg(markerOffset);
   
   string text_line;
   string::size_type position;
@@ -1242,10 +1093,13 @@ void CSU2ASCIIMeshReaderFVM::ReadSurfaceElementConnectivity() {
           
           for (unsigned long iElem_Bound = 0; iElem_Bound < nElem_Bound; iElem_Bound++) {
             getline(mesh_file, text_line);
-            istringstream bound_line(text_line);
             
-            unsigned short VTK_Type;
-            bound_line >> VTK_Type;
+            char* next = nullptr;
+            const unsigned short VTK_Type = strtoul(text_line.c_str(), &next, 10);
+            for (unsigned short i = 0; i < NumberOfPoints(VTK_Type); i++) {
+              const char* line = next;
+              connectivity[i] = strtoul(line, &next, 10);
+            }
             switch(VTK_Type) {
               case LINE:
                 
@@ -1254,9 +1108,6 @@ void CSU2ASCIIMeshReaderFVM::ReadSurfaceElementConnectivity() {
                                  string("Please check the SU2 ASCII mesh file."), CURRENT_FUNCTION);
                 }
                 
-                bound_line >> connectivity[0];
-                bound_line >> connectivity[1];
-                
                 surfaceElementConnectivity[iMarker].push_back(0);
                 surfaceElementConnectivity[iMarker].push_back(VTK_Type);
                 for (unsigned short i = 0; i < N_POINTS_HEXAHEDRON; i++)
@@ -1281,9 +1132,6 @@ void CSU2ASCIIMeshReaderFVM::ReadSurfaceElementConnectivity() {
                 
               case TRIANGLE:
                 
-                bound_line >> connectivity[0];
-                bound_line >> connectivity[1];
-                bound_line >> connectivity[2];
                 surfaceElementConnectivity[iMarker].push_back(0);
                 surfaceElementConnectivity[iMarker].push_back(VTK_Type);
                 for (unsigned short i = 0; i < N_POINTS_HEXAHEDRON; i++)
@@ -1310,10 +1158,6 @@ void CSU2ASCIIMeshReaderFVM::ReadSurfaceElementConnectivity() {
                 
               case QUADRILATERAL:
                 
-                bound_line >> connectivity[0];
-                bound_line >> connectivity[1];
-                bound_line >> connectivity[2];
-                bound_line >> connectivity[3];
                 surfaceElementConnectivity[iMarker].push_back(0);
                 surfaceElementConnectivity[iMarker].push_back(VTK_Type);
                 for (unsigned short i = 0; i < N_POINTS_HEXAHEDRON; i++)
@@ -1369,9 +1213,9 @@ void CSU2ASCIIMeshReaderFVM::ReadSurfaceElementConnectivity() {
     if (foundMarkers) break;
   }
   
-  /*--- Final error check for deprecated periodic BC format. ---*/
+  /*--- Final error check for deprecated periodic BC format, by the master only. ---*/
   
-  while (getline (mesh_file, text_line)) {
+  while ((rank == MASTER_NODE) && getline (mesh_file, text_line)) {
     
     /*--- Find any periodic transformation information. ---*/
     
@@ -1381,13 +1225,11 @@ void CSU2ASCIIMeshReaderFVM::ReadSurfaceElementConnectivity() {
       
       /*--- Read and store the number of transformations. ---*/
       text_line.erase (0,10); nPeriodic = atoi(text_line.c_str());
-      if (rank == MASTER_NODE) {
-        if (nPeriodic - 1 != 0)
-          SU2_MPI::Error(string("Mesh file contains deprecated periodic format!\n\n") +
-                         string("For SU2 v7.0.0 and later, preprocessing of periodic grids by SU2_MSH\n") +
-                         string("is no longer necessary. Please use the original mesh file (prior to SU2_MSH)\n") +
-                         string("with the same MARKER_PERIODIC definition in the configuration file.") , CURRENT_FUNCTION);
-      }
+      if (nPeriodic - 1 != 0)
+        SU2_MPI::Error(string("Mesh file contains deprecated periodic format!\n\n") +
+                       string("For SU2 v7.0.0 and later, preprocessing of periodic grids by SU2_MSH\n") +
+                       string("is no longer necessary. Please use the original mesh file (prior to SU2_MSH)\n") +
+                       string("with the same MARKER_PERIODIC definition in the configuration file.") , CURRENT_FUNCTION);
     }
   }
   
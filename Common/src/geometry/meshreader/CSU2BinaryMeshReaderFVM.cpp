@@ -0,0 +1,324 @@
+/*!
+ * \file CSU2BinaryMeshReaderFVM.cpp
+ * \brief Reads a binary SU2 grid into linear partitions for the
+ *        finite volume solver (FVM).
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/toolboxes/CLinearPartitioner.hpp"
+#include "../../../include/geometry/meshreader/CSU2BinaryMeshReaderFVM.hpp"
+
+namespace {
+/*--- Number of points of the supported element types, 0 if not supported. ---*/
+unsigned short NumberOfPoints(uint64_t VTK_Type) {
+  switch (VTK_Type) {
+    case LINE:          return N_POINTS_LINE;
+    case TRIANGLE:      return N_POINTS_TRIANGLE;
+    case QUADRILATERAL: return N_POINTS_QUADRILATERAL;
+    case TETRAHEDRON:   return N_POINTS_TETRAHEDRON;
+    case HEXAHEDRON:    return N_POINTS_HEXAHEDRON;
+    case PRISM:         return N_POINTS_PRISM;
+    case PYRAMID:       return N_POINTS_PYRAMID;
+    default:            return 0;
+  }
+}
+}
+
+CSU2BinaryMeshReaderFVM::CSU2BinaryMeshReaderFVM(CConfig        *val_config,
+                                                 unsigned short val_iZone,
+                                                 unsigned short val_nZone)
+: CMeshReaderFVM(val_config, val_iZone, val_nZone) {
+
+  /* The binary format holds a single zone, without the splitting of actuator disks. */
+  if ((val_nZone > 1) && config->GetMultizone_Mesh()) {
+    SU2_MPI::Error(string("Binary SU2 meshes contain a single zone.\n") +
+                   string("Use one mesh file per zone (MULTIZONE_MESH= NO)."), CURRENT_FUNCTION);
+  }
+  if (((config->GetnMarker_ActDiskInlet() != 0) || (config->GetnMarker_ActDiskOutlet() != 0)) &&
+      !config->GetActDisk_DoubleSurface()) {
+    SU2_MPI::Error(string("Actuator disk surfaces cannot be split when reading binary SU2 meshes.\n") +
+                   string("Use a mesh with both surfaces (ACTDISK_DOUBLE_SURFACE= YES)."), CURRENT_FUNCTION);
+  }
+
+  meshFilename = config->GetMesh_FileName();
+
+  /*--- All ranks open the file, read the header, and their parts of the file. ---*/
+
+#ifdef HAVE_MPI
+  int ierr = MPI_File_open(MPI_COMM_WORLD, meshFilename.c_str(), MPI_MODE_RDONLY, MPI_INFO_NULL, &mesh_file);
+  if (ierr != MPI_SUCCESS) {
+#else
+  mesh_file = fopen(meshFilename.c_str(), "rb");
+  if (!mesh_file) {
+#endif
+    SU2_MPI::Error(string("Error opening binary SU2 grid ") + meshFilename +
+                   string(" \n Check that the file exists."), CURRENT_FUNCTION);
+  }
+
+  ReadMetadata();
+  ReadPointCoordinates();
+  ReadVolumeElementConnectivity();
+  ReadSurfaceElementConnectivity();
+
+#ifdef HAVE_MPI
+  MPI_File_close(&mesh_file);
+#else
+  fclose(mesh_file);
+#endif
+
+}
+
+CSU2BinaryMeshReaderFVM::~CSU2BinaryMeshReaderFVM(void) { }
+
+void CSU2BinaryMeshReaderFVM::ReadRecords(void* data, uint64_t offset, unsigned long recordSize,
+                                          unsigned long nRecords, bool collective) {
+
+  bool success = true;
+
+#ifdef HAVE_MPI
+
+  /*--- Records as a contiguous type, the number of records fits in an int. ---*/
+
+  MPI_Datatype recordType;
+  MPI_Type_contiguous(int(recordSize), MPI_BYTE, &recordType);
+  MPI_Type_commit(&recordType);
+
+  MPI_File_set_view(mesh_file, 0, MPI_BYTE, MPI_BYTE, (char*)"native", MPI_INFO_NULL);
+
+  int ierr;
+  if (collective)
+    ierr = MPI_File_read_at_all(mesh_file, MPI_Offset(offset), data, int(nRecords), recordType, MPI_STATUS_IGNORE);
+  else
+    ierr = MPI_File_read_at(mesh_file, MPI_Offset(offset), data, int(nRecords), recordType, MPI_STATUS_IGNORE);
+
+  MPI_Type_free(&recordType);
+
+  success = (ierr == MPI_SUCCESS);
+
+#else
+
+  if (nRecords > 0) {
+    success = (fseek(mesh_file, long(offset), SEEK_SET) == 0) &&
+              (fread(data, recordSize, nRecords, mesh_file) == nRecords);
+  }
+
+#endif
+
+  if (!success) {
+    SU2_MPI::Error(string("Error reading binary SU2 grid ") + meshFilename, CURRENT_FUNCTION);
+  }
+
+}
+
+void CSU2BinaryMeshReaderFVM::ReadMetadata() {
+
+  /*--- Every rank reads the (small) header. ---*/
+
+  ReadRecords(header, 0, SU2_BINARY_MESH_HEADER*sizeof(uint64_t), 1);
+
+  if (header[0] != SU2_BINARY_MESH_ID) {
+    SU2_MPI::Error(string("File ") + meshFilename + string(" is not a binary SU2 mesh file.\n") +
+                   string("Check the MESH_FORMAT option."), CURRENT_FUNCTION);
+  }
+
+  dimension              = header[1];
+  numberOfGlobalPoints   = header[2];
+  numberOfGlobalElements = header[3];
+  numberOfMarkers        = header[4];
+
+  if ((dimension != 2) && (dimension != 3)) {
+    SU2_MPI::Error(string("Invalid dimension in the binary SU2 grid ") + meshFilename, CURRENT_FUNCTION);
+  }
+
+}
+
+void CSU2BinaryMeshReaderFVM::ReadPointCoordinates() {
+
+  /* Get a partitioner to help with linear partitioning. */
+  CLinearPartitioner pointPartitioner(numberOfGlobalPoints,0);
+
+  const unsigned long firstPoint = pointPartitioner.GetFirstIndexOnRank(rank);
+  numberOfLocalPoints = pointPartitioner.GetSizeOnRank(rank);
+
+  /*--- The coordinates of each point are contiguous in the file. ---*/
+
+  const unsigned long pointSize = dimension*sizeof(passivedouble);
+
+  vector<passivedouble> coords(numberOfLocalPoints*dimension);
+
+  ReadRecords(coords.data(), header[5] + firstPoint*pointSize, pointSize, numberOfLocalPoints);
+
+  localPointCoordinates.resize(dimension);
+  for (unsigned short iDim = 0; iDim < dimension; iDim++) {
+    localPointCoordinates[iDim].resize(numberOfLocalPoints);
+    for (unsigned long iPoint = 0; iPoint < numberOfLocalPoints; iPoint++)
+      localPointCoordinates[iDim][iPoint] = coords[iPoint*dimension+iDim];
+  }
+
+}
+
+void CSU2BinaryMeshReaderFVM::ReadVolumeElementConnectivity() {
+
+  /* Get partitioners for the points and for the elements of the file. */
+  CLinearPartitioner pointPartitioner(numberOfGlobalPoints,0);
+  CLinearPartitioner elemPartitioner(numberOfGlobalElements,0);
+
+  const unsigned long firstElem = elemPartitioner.GetFirstIndexOnRank(rank);
+  const unsigned long nElemRead = elemPartitioner.GetSizeOnRank(rank);
+
+  const unsigned long elemSize = SU2_BINARY_MESH_ELEM*sizeof(uint64_t);
+
+  vector<uint64_t> elems(nElemRead*SU2_BINARY_MESH_ELEM);
+
+  ReadRecords(elems.data(), header[6] + firstElem*elemSize, elemSize, nElemRead);
+
+  /*--- Every element is needed by the ranks that own at least one of its points (i.e.,
+   there is element redundancy, as for the ASCII reader). Build the connectivity in
+   the format [globalID vtkType n0 ... n7] for each of those ranks. ---*/
+
+  vector<vector<unsigned long> > sendConn(size);
+  vector<int> elemRanks;
+
+  for (unsigned long iElem = 0; iElem < nElemRead; iElem++) {
+
+    const uint64_t* record = &elems[iElem*SU2_BINARY_MESH_ELEM];
+    const unsigned short nNodes = NumberOfPoints(record[0]);
+
+    if ((nNodes == 0) || (record[0] == LINE)) {
+      SU2_MPI::Error(string("Unsupported volume element type in the binary SU2 grid ") + meshFilename,
+                     CURRENT_FUNCTION);
+    }
+
+    elemRanks.clear();
+    for (unsigned short iNode = 0; iNode < nNodes; iNode++)
+      elemRanks.push_back(pointPartitioner.GetRankContainingIndex(record[iNode+1]));
+    sort(elemRanks.begin(), elemRanks.end());
+    elemRanks.erase(unique(elemRanks.begin(), elemRanks.end()), elemRanks.end());
+
+    for (auto iRank : elemRanks) {
+      sendConn[iRank].push_back(firstElem+iElem);
+      for (unsigned short i = 0; i < SU2_BINARY_MESH_ELEM; i++)
+        sendConn[iRank].push_back(record[i]);
+    }
+  }
+
+  vector<uint64_t>().swap(elems);
+
+  /*--- Exchange the elements, the received ones remain sorted by global index
+   since the linear partitions of elements are ordered by rank. ---*/
+
+  vector<int> nSend(size), nRecv(size), sendDispl(size+1,0), recvDispl(size+1,0);
+
+  for (int iRank = 0; iRank < size; iRank++)
+    nSend[iRank] = sendConn[iRank].size();
+
+  SU2_MPI::Alltoall(nSend.data(), 1, MPI_INT, nRecv.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+  for (int iRank = 0; iRank < size; iRank++) {
+    sendDispl[iRank+1] = sendDispl[iRank] + nSend[iRank];
+    recvDispl[iRank+1] = recvDispl[iRank] + nRecv[iRank];
+  }
+
+  vector<unsigned long> sendBuf(sendDispl[size]);
+  for (int iRank = 0; iRank < size; iRank++) {
+    copy(sendConn[iRank].begin(), sendConn[iRank].end(), sendBuf.begin()+sendDispl[iRank]);
+    vector<unsigned long>().swap(sendConn[iRank]);
+  }
+
+  localVolumeElementConnectivity.resize(recvDispl[size]);
+
+  SU2_MPI::Alltoallv(sendBuf.data(), nSend.data(), sendDispl.data(), MPI_UNSIGNED_LONG,
+                     localVolumeElementConnectivity.data(), nRecv.data(), recvDispl.data(),
+                     MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+
+  numberOfLocalElements = localVolumeElementConnectivity.size()/SU2_CONN_SIZE;
+
+}
+
+void CSU2BinaryMeshReaderFVM::ReadSurfaceElementConnectivity() {
+
+  surfaceElementConnectivity.resize(numberOfMarkers);
+  markerNames.resize(numberOfMarkers);
+
+  /*--- The master reads the markers sequentially and stores the connectivity,
+   the names are broadcast to all ranks. ---*/
+
+  vector<char> names(numberOfMarkers*CGNS_STRING_SIZE, '\0');
+
+  if (rank == MASTER_NODE) {
+
+    uint64_t offset = header[7];
+    const unsigned long boundSize = SU2_BINARY_MESH_BOUND*sizeof(uint64_t);
+
+    for (unsigned long iMarker = 0; iMarker < numberOfMarkers; iMarker++) {
+
+      char* name = &names[iMarker*CGNS_STRING_SIZE];
+      uint64_t nElem_Bound = 0;
+
+      ReadRecords(name, offset, CGNS_STRING_SIZE, 1, false);
+      offset += CGNS_STRING_SIZE;
+      ReadRecords(&nElem_Bound, offset, sizeof(uint64_t), 1, false);
+      offset += sizeof(uint64_t);
+
+      name[CGNS_STRING_SIZE-1] = '\0';
+      if (string(name) == "SEND_RECEIVE") {
+        SU2_MPI::Error(string("Mesh file contains deprecated SEND_RECEIVE marker!\n\n") +
+                       string("Please remove any SEND_RECEIVE markers from the SU2 mesh."),
+                       CURRENT_FUNCTION);
+      }
+
+      vector<uint64_t> bound(nElem_Bound*SU2_BINARY_MESH_BOUND);
+      ReadRecords(bound.data(), offset, boundSize, nElem_Bound, false);
+      offset += nElem_Bound*boundSize;
+
+      surfaceElementConnectivity[iMarker].resize(nElem_Bound*SU2_CONN_SIZE, 0);
+
+      for (unsigned long iElem = 0; iElem < nElem_Bound; iElem++) {
+        const uint64_t* record = &bound[iElem*SU2_BINARY_MESH_BOUND];
+        const unsigned short nNodes = NumberOfPoints(record[0]);
+
+        if ((nNodes == 0) || (nNodes > SU2_BINARY_MESH_BOUND-1) || ((dimension == 3) && (record[0] == LINE))) {
+          SU2_MPI::Error(string("Invalid surface element type for the dimension of the binary SU2 grid ") +
+                         meshFilename, CURRENT_FUNCTION);
+        }
+
+        unsigned long* conn = &surfaceElementConnectivity[iMarker][iElem*SU2_CONN_SIZE];
+        conn[1] = record[0];
+        for (unsigned short iNode = 0; iNode < nNodes; iNode++)
+          conn[iNode+SU2_CONN_SKIP] = record[iNode+1];
+      }
+    }
+  }
+
+  SU2_MPI::Bcast(names.data(), int(names.size()), MPI_CHAR, MASTER_NODE, MPI_COMM_WORLD);
+
+  /*--- Remove any whitespaces from the marker names. ---*/
+
+  for (unsigned long iMarker = 0; iMarker < numberOfMarkers; iMarker++) {
+    string Marker_Tag(&names[iMarker*CGNS_STRING_SIZE]);
+    Marker_Tag.erase(remove(Marker_Tag.begin(), Marker_Tag.end(),' '), Marker_Tag.end());
+    markerNames[iMarker] = Marker_Tag;
+  }
+
+}
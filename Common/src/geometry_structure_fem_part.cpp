@@ -2659,8 +2659,9 @@ void CPhysicalGeometry::SetColorFEMGrid_Parallel(CConfig *config) {
     adjwgt[i].resize(adjacency[i].size());
 
   /* Compute the weigts of the graph. */
+  unsigned short nConstraints;
   ComputeFEMGraphWeights(config, localFaces, adjacency,
-                         mapExternalElemIDToTimeLevel, vwgt, adjwgt);
+                         mapExternalElemIDToTimeLevel, nConstraints, vwgt, adjwgt);
 
   /*--- The remainder of this function should only be called if we have parallel
         support with MPI and have the ParMETIS library compiled and linked. ---*/
@@ -2674,8 +2675,8 @@ void CPhysicalGeometry::SetColorFEMGrid_Parallel(CConfig *config) {
     /*--- The scalar variables and the options array for the call to ParMETIS. ---*/
     idx_t  wgtflag = 3;               // Weights on both the vertices and edges.
     idx_t  numflag = 0;               // C-numbering.
-    idx_t  ncon    = 2;               // Number of constraints.
-    real_t ubvec[] = {1.05, 1.05};    // Tolerances for the vertex weights, recommended value is 1.05.
+    idx_t  ncon    = nConstraints;    // Number of constraints.
+    vector<real_t> ubvec(ncon, 1.05); // Tolerances for the vertex weights, recommended value is 1.05.
     idx_t  nparts  = (idx_t)size;     // Number of subdomains. Must be number of MPI ranks.
     idx_t  options[METIS_NOPTIONS];   // Just use the default options.
     METIS_SetDefaultOptions(options);
@@ -2727,7 +2728,7 @@ void CPhysicalGeometry::SetColorFEMGrid_Parallel(CConfig *config) {
     MPI_Comm comm = MPI_COMM_WORLD;
     ParMETIS_V3_PartKway(vtxdist.data(), xadjPar.data(), adjacencyPar.data(),
                          vwgtPar.data(), adjwgtPar.data(), &wgtflag, &numflag,
-                         &ncon, &nparts, tpwgts.data(), ubvec, options,
+                         &ncon, &nparts, tpwgts.data(), ubvec.data(), options,
                          &edgecut, part.data(), &comm);
     if (rank == MASTER_NODE) {
       cout << " graph partitioning complete (";
@@ -2762,6 +2763,50 @@ void CPhysicalGeometry::SetColorFEMGrid_Parallel(CConfig *config) {
 #endif  /* HAVE_MPI */
 }
 
+bool CPhysicalGeometry::DecreasePolySolFEM(void) {
+
+  /*--- Loop over the local elements and decrease the polynomial degree of the
+        solution by one, if possible. The elements are stored in increasing
+        order of their global ID, hence the global offsets of the solution DOFs
+        are obtained in the same way as when the grid is read. ---*/
+  unsigned short nPolyDecreased = 0;
+  unsigned long nDOFsLoc = 0;
+
+  for(unsigned long i=0; i<nElem; ++i) {
+
+    const unsigned short nPolySol = elem[i]->GetNPolySol();
+    const unsigned short nPolyNew = (nPolySol > 0) ? nPolySol-1 : 0;
+    if(nPolyNew != nPolySol) nPolyDecreased = 1;
+
+    const unsigned short nDOFsNew = CFEMStandardElementBase::GetNDOFsStatic(elem[i]->GetVTK_Type(),
+                                                                            nPolyNew,
+                                                                            elem[i]->GetGlobalElemID());
+    elem[i]->SetSolutionDOFs(nPolyNew, nDOFsNew, nDOFsLoc);
+    nDOFsLoc += nDOFsNew;
+  }
+
+#ifdef HAVE_MPI
+  /* Correct the global offset of the DOFs and determine whether the polynomial
+     degree was decreased on any of the ranks. */
+  vector<unsigned long> nDOFsPerRank(size);
+  SU2_MPI::Allgather(&nDOFsLoc, 1, MPI_UNSIGNED_LONG, nDOFsPerRank.data(), 1,
+                     MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+
+  unsigned long offsetRank = 0;
+  for(int i=0; i<rank; ++i)
+    offsetRank += nDOFsPerRank[i];
+
+  for(unsigned long i=0; i<nElem; ++i)
+    elem[i]->AddOffsetGlobalDOFs(offsetRank);
+
+  unsigned short nPolyDecreasedLoc = nPolyDecreased;
+  SU2_MPI::Allreduce(&nPolyDecreasedLoc, &nPolyDecreased, 1, MPI_UNSIGNED_SHORT,
+                     MPI_MAX, MPI_COMM_WORLD);
+#endif
+
+  return (nPolyDecreased > 0);
+}
+
 void CPhysicalGeometry::DeterminePeriodicFacesFEMGrid(CConfig                *config,
                                                       vector<CFaceOfElement> &localFaces) {
 
@@ -4681,6 +4726,7 @@ void CPhysicalGeometry::ComputeFEMGraphWeights(
               const vector<CFaceOfElement>               &localFaces,
               const vector<vector<unsigned long> >       &adjacency,
               const map<unsigned long, CUnsignedShort2T> &mapExternalElemIDToTimeLevel,
+                    unsigned short                       &nConstraints,
                     vector<su2double>                    &vwgt,
                     vector<vector<su2double> >           &adjwgt) {
 
@@ -4700,7 +4746,8 @@ void CPhysicalGeometry::ComputeFEMGraphWeights(
   /*         weights are determined. The first weight is proportional to the  */
   /*         amount of work for the volume element. The second weight is the  */
   /*         number of DOFs of the element, such that the number of DOFs per  */
-  /*         rank will also be the same.                                      */
+  /*         rank will also be the same. At the end of this step the first    */
+  /*         weight is split per time level, see below.                       */
   /*--------------------------------------------------------------------------*/
 
   /*--- Define the standard elements for the volume elements, the boundary faces
@@ -4910,6 +4957,54 @@ void CPhysicalGeometry::ComputeFEMGraphWeights(
     }
   }
 
+  /*--------------------------------------------------------------------------*/
+  /*--- When restarting, the estimates of the work are replaced by the     ---*/
+  /*--- cost of the elements measured in the previous computation, if      ---*/
+  /*--- available. This cost is the time per update of the element.        ---*/
+  /*--------------------------------------------------------------------------*/
+
+  if(config->GetMeasure_ElemCost_DGFEM() &&
+     (config->GetRestart() || config->GetRestart_Flow())) {
+
+    /*--- Read the part of the file that corresponds to the elements of this
+          rank. The file contains the number of elements followed by the cost
+          of all elements in the order of the global element ID. ---*/
+    const string fileName = config->GetElemCost_FileName_DGFEM();
+    vector<passivedouble> elemCost(nElem, 0.0);
+    int costAvailable = 0;
+
+    ifstream costFile(fileName, ios::binary);
+    if( costFile.is_open() ) {
+      unsigned long nElemFile = 0;
+      costFile.read(reinterpret_cast<char*>(&nElemFile), sizeof(unsigned long));
+
+      if(costFile && (nElemFile == end_node[size-1])) {
+        costFile.seekg(sizeof(unsigned long) + beg_node[rank]*sizeof(passivedouble));
+        costFile.read(reinterpret_cast<char*>(elemCost.data()), nElem*sizeof(passivedouble));
+
+        costAvailable = costFile ? 1 : 0;
+        for(unsigned long i=0; i<nElem; ++i)
+          if( !(elemCost[i] > 0.0) ) costAvailable = 0;
+      }
+    }
+
+#ifdef HAVE_MPI
+    int locCostAvailable = costAvailable;
+    SU2_MPI::Allreduce(&locCostAvailable, &costAvailable, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+#endif
+
+    if( costAvailable ) {
+      for(unsigned long i=0; i<nElem; ++i) vwgt[2*i] = elemCost[i];
+
+      if(rank == MASTER_NODE)
+        cout << "Partitioning based on the measured element cost in " << fileName << "." << endl;
+    }
+    else if(rank == MASTER_NODE) {
+      cout << "The measured element cost in " << fileName << " is not available "
+           << "for this grid. The estimates of the work are used." << endl;
+    }
+  }
+
   /*--------------------------------------------------------------------------*/
   /*--- The final weight is obtained by taking the amount of work in time  ---*/
   /*--- into account. Note that this correction is only relevant when time ---*/
@@ -4938,6 +5033,44 @@ void CPhysicalGeometry::ComputeFEMGraphWeights(
   minvwgt = 100.0/minvwgt;
   for(unsigned long i=0; i<nElem; ++i) vwgt[2*i] *= minvwgt;
 
+  /*--------------------------------------------------------------------------*/
+  /*--- With time accurate local time stepping the ranks synchronize after ---*/
+  /*--- every update of a time level, hence the work must be balanced per  ---*/
+  /*--- time level and not only in total. Therefore the workload of the    ---*/
+  /*--- elements is split in one constraint per time level that occurs in  ---*/
+  /*--- the grid, followed by the number of DOFs as the last constraint.   ---*/
+  /*--------------------------------------------------------------------------*/
+
+  /*--- Determine the time levels that are present in the grid and the
+        corresponding index of the constraint. ---*/
+  vector<short> levelPresent(maxTimeLevel+1, 0);
+  for(unsigned long i=0; i<nElem; ++i) levelPresent[elem[i]->GetTimeLevel()] = 1;
+
+#ifdef HAVE_MPI
+  vector<short> locLevelPresent = levelPresent;
+  SU2_MPI::Allreduce(locLevelPresent.data(), levelPresent.data(), maxTimeLevel+1,
+                     MPI_SHORT, MPI_MAX, MPI_COMM_WORLD);
+#endif
+
+  vector<unsigned short> indConstraintLevel(maxTimeLevel+1, 0);
+  nConstraints = 0;
+  for(unsigned short i=0; i<=maxTimeLevel; ++i) {
+    indConstraintLevel[i] = nConstraints;
+    if( levelPresent[i] ) ++nConstraints;
+  }
+  ++nConstraints;
+
+  /*--- Store the vertex weights in the multi-constraint format. For a single
+        time level this is identical to the format of the work and the DOFs. ---*/
+  vector<su2double> vwgtLevels(nConstraints*nElem, 0.0);
+  for(unsigned long i=0; i<nElem; ++i) {
+    const unsigned short indLevel = indConstraintLevel[elem[i]->GetTimeLevel()];
+    vwgtLevels[nConstraints*i+indLevel]       = vwgt[2*i];
+    vwgtLevels[nConstraints*i+nConstraints-1] = vwgt[2*i+1];
+  }
+
+  vwgt.swap(vwgtLevels);
+
   /*--------------------------------------------------------------------------*/
   /* Step 2: Determine the adjacency weights, which are proportional to the   */
   /*         amount of communication needed when the two neighboring          */
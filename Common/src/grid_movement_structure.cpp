@@ -27,6 +27,7 @@
 
 #include "../include/grid_movement_structure.hpp"
 #include "../include/adt_structure.hpp"
+#include "../include/interpolation_structure.hpp"
 #include <list>
 
 #include "../include/linear_algebra/CMatrixVectorProduct.hpp"
@@ -40,7 +41,7 @@ CGridMovement::~CGridMovement(void) { }
 
 CVolumetricMovement::CVolumetricMovement(void) : CGridMovement() {
 
-
+  StiffMatrix_Set = false;
 
 }
 
@@ -58,12 +59,14 @@ CVolumetricMovement::CVolumetricMovement(CGeometry *geometry, CConfig *config) :
     nPointDomain = geometry->GetnPointDomain();
 
     nIterMesh = 0;
+    StiffMatrix_Set = false;
 
     /*--- Initialize matrix, solution, and r.h.s. structures for the linear solver. ---*/
     if (config->GetVolumetric_Movement()){
       LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
       LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
-      StiffMatrix.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
+      if (config->GetKind_Deform_Method() != RBF_DEFORMATION)
+        StiffMatrix.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
     }
 }
 
@@ -98,15 +101,36 @@ void CVolumetricMovement::UpdateGridCoord(CGeometry *geometry, CConfig *config)
 void CVolumetricMovement::UpdateDualGrid(CGeometry *geometry, CConfig *config) {
   
   /*--- After moving all nodes, update the dual mesh. Recompute the edges and
-   dual mesh control volumes in the domain and on the boundaries. ---*/
-  
-  geometry->SetCoord_CG();
-  geometry->SetControlVolume(config, UPDATE);
-  geometry->SetBoundControlVolume(config, UPDATE);
-  geometry->SetMaxLength(config);
+   dual mesh control volumes in the domain and on the boundaries, only where
+   they depend on displaced nodes. ---*/
+
+  geometry->UpdateDualGrid(config);
   
 }
 
+void CVolumetricMovement::SetRigidMotion_DualGrid(CGeometry *geometry, CConfig *config, const su2double rotMatrix[][3],
+                                                  const su2double *center, su2double Lref) {
+
+  if (Lref != 1.0) {
+    UpdateDualGrid(geometry, config);
+    return;
+  }
+
+  /*--- x_new = R (x_old - c) + c, i.e. the translation is c - R c. ---*/
+
+  const unsigned short nDim = geometry->GetnDim();
+  su2double translation[3] = {0.0, 0.0, 0.0};
+
+  for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+    translation[iDim] = center[iDim];
+    for (unsigned short jDim = 0; jDim < nDim; jDim++)
+      translation[iDim] -= rotMatrix[iDim][jDim]*center[jDim];
+  }
+
+  geometry->SetRigidMotion(config, rotMatrix, translation);
+
+}
+
 void CVolumetricMovement::UpdateMultiGrid(CGeometry **geometry, CConfig *config) {
   
   unsigned short iMGfine, iMGlevel, nMGlevel = config->GetnMGLevels();
@@ -116,9 +140,7 @@ void CVolumetricMovement::UpdateMultiGrid(CGeometry **geometry, CConfig *config)
   
   for (iMGlevel = 1; iMGlevel <= nMGlevel; iMGlevel++) {
     iMGfine = iMGlevel-1;
-    geometry[iMGlevel]->SetControlVolume(config, geometry[iMGfine], UPDATE);
-    geometry[iMGlevel]->SetBoundControlVolume(config, geometry[iMGfine],UPDATE);
-    geometry[iMGlevel]->SetCoord(geometry[iMGfine]);
+    geometry[iMGlevel]->UpdateDualGrid(config, geometry[iMGfine]);
     if (config->GetGrid_Movement())
       geometry[iMGlevel]->SetRestricted_GridVelocity(geometry[iMGfine], config);
   }
@@ -142,6 +164,16 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
   
   if (config->GetKind_SU2() == SU2_CFD && !Derivative) Screen_Output = false;
 
+  /*--- The radial basis function deformation does not assemble the stiffness
+   matrix, hence it is not available for the derivative computation. ---*/
+
+  if (config->GetKind_Deform_Method() == RBF_DEFORMATION) {
+    if (Derivative)
+      SU2_MPI::Error("DEFORM_METHOD= RBF does not support the computation of derivatives.", CURRENT_FUNCTION);
+    SetVolume_Deformation_RBF(geometry, config, UpdateGeo, Screen_Output);
+    return;
+  }
+
   /*--- Set the number of nonlinear iterations to 1 if Derivative computation is enabled ---*/
 
   if (Derivative) Nonlinear_Iter = 1;
@@ -152,17 +184,25 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
   
   for (iNonlinear_Iter = 0; iNonlinear_Iter < Nonlinear_Iter; iNonlinear_Iter++) {
     
+    /*--- If requested, the stiffness matrix (with the boundary rows deleted, which
+     are the same for every deformation) and its preconditioner are kept from the
+     previous deformation, only the r.h.s. is rebuilt. Not for the derivatives. ---*/
+
+    const bool ReuseStiffness = config->GetDeform_Reuse_Stiffness() && StiffMatrix_Set && !Derivative;
+
     /*--- Initialize vector and sparse matrix ---*/
     
     LinSysSol.SetValZero();
     LinSysRes.SetValZero();
-    StiffMatrix.SetValZero();
     
     /*--- Compute the stiffness matrix entries for all nodes/elements in the
      mesh. FEA uses a finite element method discretization of the linear
      elasticity equations (transfers element stiffnesses to point-to-point). ---*/
     
-    MinVolume = SetFEAMethodContributions_Elem(geometry, config);
+    if (!ReuseStiffness) {
+      StiffMatrix.SetValZero();
+      MinVolume = SetFEAMethodContributions_Elem(geometry, config);
+    }
     
     /*--- Set the boundary and volume displacements (as prescribed by the 
      design variable perturbations controlling the surface shape) 
@@ -206,16 +246,37 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
     	}
     	if (config->GetKind_Deform_Linear_Solver_Prec() == ILU) {
         if ((rank == MASTER_NODE) && Screen_Output) cout << "\n# ILU preconditioner." << endl;
-    		StiffMatrix.BuildILUPreconditioner();
+    		if (!ReuseStiffness) StiffMatrix.BuildILUPreconditioner();
     		mat_vec = new CSysMatrixVectorProduct<su2double>(StiffMatrix, geometry, config);
     		precond = new CILUPreconditioner<su2double>(StiffMatrix, geometry, config, false);
     	}
     	if (config->GetKind_Deform_Linear_Solver_Prec() == JACOBI) {
         if ((rank == MASTER_NODE) && Screen_Output) cout << "\n# Jacobi preconditioner." << endl;
-    		StiffMatrix.BuildJacobiPreconditioner();
+    		if (!ReuseStiffness) StiffMatrix.BuildJacobiPreconditioner();
     		mat_vec = new CSysMatrixVectorProduct<su2double>(StiffMatrix, geometry, config);
     		precond = new CJacobiPreconditioner<su2double>(StiffMatrix, geometry, config, false);
     	}
+    	if (config->GetKind_Deform_Linear_Solver_Prec() == AMG) {
+        if ((rank == MASTER_NODE) && Screen_Output) cout << "\n# AMG preconditioner." << endl;
+    		if (!ReuseStiffness) StiffMatrix.BuildAMGPreconditioner();
+    		mat_vec = new CSysMatrixVectorProduct<su2double>(StiffMatrix, geometry, config);
+    		precond = new CAMGPreconditioner<su2double>(StiffMatrix, geometry, config, false);
+    	}
+    	if ((config->GetKind_Deform_Linear_Solver_Prec() == NEUMANN_PREC) ||
+    	    (config->GetKind_Deform_Linear_Solver_Prec() == CHEBYSHEV)) {
+        const bool chebyshev = (config->GetKind_Deform_Linear_Solver_Prec() == CHEBYSHEV);
+        if ((rank == MASTER_NODE) && Screen_Output) cout << "\n# Polynomial preconditioner." << endl;
+    		if (!ReuseStiffness) StiffMatrix.BuildPolynomialPreconditioner(chebyshev, geometry, config);
+    		mat_vec = new CSysMatrixVectorProduct<su2double>(StiffMatrix, geometry, config);
+    		precond = new CPolynomialPreconditioner<su2double>(StiffMatrix, geometry, config,
+    		                                                   config->GetKind_Deform_Linear_Solver_Prec());
+    	}
+    	if (config->GetKind_Deform_Linear_Solver_Prec() == SPAI) {
+        if ((rank == MASTER_NODE) && Screen_Output) cout << "\n# SPAI preconditioner." << endl;
+    		if (!ReuseStiffness) StiffMatrix.BuildSPAIPreconditioner();
+    		mat_vec = new CSysMatrixVectorProduct<su2double>(StiffMatrix, geometry, config);
+    		precond = new CSPAIPreconditioner<su2double>(StiffMatrix, geometry, config);
+    	}
 
     } else if (Derivative && (config->GetKind_SU2() == SU2_DOT)) {
 
@@ -234,6 +295,12 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
     		mat_vec = new CSysMatrixVectorProductTransposed<su2double>(StiffMatrix, geometry, config);
     		precond = new CJacobiPreconditioner<su2double>(StiffMatrix, geometry, config, true);
     	}
+    	if (config->GetKind_Deform_Linear_Solver_Prec() == AMG) {
+        if ((rank == MASTER_NODE) && Screen_Output) cout << "\n# AMG preconditioner." << endl;
+    		StiffMatrix.BuildAMGPreconditioner(true);
+    		mat_vec = new CSysMatrixVectorProductTransposed<su2double>(StiffMatrix, geometry, config);
+    		precond = new CAMGPreconditioner<su2double>(StiffMatrix, geometry, config, true);
+    	}
 
     }
     
@@ -285,6 +352,12 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
 
           break;
 
+        case FGMRES_CGS:
+
+          Tot_Iter = System.FGMRES_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, NumError, Smoothing_Iter, Residual, Screen_Output, config, true);
+
+          break;
+
           /*--- Solve the linear system (BCGSTAB) ---*/
 
         case BCGSTAB:
@@ -307,6 +380,10 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
     
     delete mat_vec;
     delete precond;
+
+    /*--- The transposed preconditioner of the derivative mode cannot be reused. ---*/
+
+    StiffMatrix_Set = !Derivative;
     
     /*--- Update the grid coordinates and cell volumes using the solution
      of the linear system (usol contains the x, y, z displacements). ---*/
@@ -334,21 +411,346 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
 
 }
 
+void CVolumetricMovement::SetVolume_Deformation_RBF(CGeometry *geometry, CConfig *config, bool UpdateGeo, bool Screen_Output) {
+
+  unsigned short iDim, iMarker;
+  unsigned long iPoint, iVertex, i, j;
+  su2double MinVolume, MaxVolume;
+
+  const unsigned short Kind_SU2 = config->GetKind_SU2();
+  const passivedouble tolGreedy = SU2_TYPE::GetValue(config->GetDeform_RBF_Greedy_Tol());
+  const unsigned long maxPoints = config->GetDeform_RBF_Max_Points();
+
+  /*--- The compactly supported Wendland C2 function gives a positive definite
+   interpolation matrix without polynomial terms, and only the control points
+   within the support radius contribute to the displacement of a grid point.
+   As for the elasticity method the displacements are not differentiated. ---*/
+
+  auto Kernel = [](const passivedouble radius, const passivedouble dist) {
+    return SU2_TYPE::GetValue(CRadialBasisFunction::Get_RadialBasisValue(WENDLAND_C2, radius, dist));
+  };
+
+  /*--- Determine the constrained points, i.e. the points of the boundaries that
+   are held fixed (as in SetBoundaryDisplacements) and of the moving boundaries,
+   for which the displacement is prescribed. The symmetry planes are free. ---*/
+
+  vector<short> pointKind(nPoint, 0);
+  vector<passivedouble> pointDispl(nPoint*nDim, 0.0);
+
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    if ((config->GetMarker_All_KindBC(iMarker) != SYMMETRY_PLANE) &&
+        (config->GetMarker_All_KindBC(iMarker) != SEND_RECEIVE) &&
+        (config->GetMarker_All_KindBC(iMarker) != INTERNAL_BOUNDARY) &&
+        (config->GetMarker_All_KindBC(iMarker) != PERIODIC_BOUNDARY)) {
+      for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++)
+        pointKind[geometry->vertex[iMarker][iVertex]->GetNode()] = 1;
+    }
+  }
+
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    if ((config->GetMarker_All_KindBC(iMarker) != NEARFIELD_BOUNDARY) &&
+        (((config->GetMarker_All_Moving(iMarker) == YES) && (Kind_SU2 == SU2_CFD)) ||
+         ((config->GetMarker_All_DV(iMarker) == YES) && (Kind_SU2 == SU2_DEF)))) {
+      for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        const su2double *VarCoord = geometry->vertex[iMarker][iVertex]->GetVarCoord();
+        pointKind[iPoint] = 2;
+        for (iDim = 0; iDim < nDim; iDim++)
+          pointDispl[iPoint*nDim+iDim] = SU2_TYPE::GetValue(VarCoord[iDim]);
+      }
+    }
+  }
+
+  /*--- Gather the coordinates and displacements of the owned constrained points
+   on all ranks. The last entry of every point is the kind of the constraint. ---*/
+
+  const unsigned short nData = 2*nDim+1;
+  vector<passivedouble> sendBuf;
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    if (pointKind[iPoint] == 0) continue;
+    for (iDim = 0; iDim < nDim; iDim++)
+      sendBuf.push_back(SU2_TYPE::GetValue(geometry->node[iPoint]->GetCoord(iDim)));
+    for (iDim = 0; iDim < nDim; iDim++)
+      sendBuf.push_back(pointDispl[iPoint*nDim+iDim]);
+    sendBuf.push_back(pointKind[iPoint]);
+  }
+
+  vector<int> recvCounts(size), displs(size, 0);
+  int sizeLocal = sendBuf.size();
+  SU2_MPI::Allgather(&sizeLocal, 1, MPI_INT, recvCounts.data(), 1, MPI_INT, MPI_COMM_WORLD);
+  for (int iRank = 1; iRank < size; iRank++) displs[iRank] = displs[iRank-1] + recvCounts[iRank-1];
+
+  vector<passivedouble> constrData(displs.back() + recvCounts.back());
+  SU2_MPI::Allgatherv(sendBuf.data(), sizeLocal, MPI_DOUBLE, constrData.data(),
+                      recvCounts.data(), displs.data(), MPI_DOUBLE, MPI_COMM_WORLD);
+
+  const unsigned long nConstr = constrData.size()/nData;
+  auto ConstrCoord = [&](unsigned long k) { return constrData.data() + k*nData; };
+  auto ConstrDispl = [&](unsigned long k) { return constrData.data() + k*nData + nDim; };
+
+  /*--- Maximum displacement and bounding box of the moving points, the diagonal
+   of which is the default support radius. ---*/
+
+  passivedouble maxDispl = 0.0, bbMin[3] = {0.0}, bbMax[3] = {0.0};
+  bool firstMoving = true;
+  for (i = 0; i < nConstr; i++) {
+    if (constrData[i*nData+2*nDim] != 2) continue;
+    passivedouble displ = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++) {
+      displ += pow(ConstrDispl(i)[iDim], 2);
+      const passivedouble x = ConstrCoord(i)[iDim];
+      bbMin[iDim] = firstMoving? x : min(bbMin[iDim], x);
+      bbMax[iDim] = firstMoving? x : max(bbMax[iDim], x);
+    }
+    maxDispl = max(maxDispl, sqrt(displ));
+    firstMoving = false;
+  }
+
+  passivedouble radius = SU2_TYPE::GetValue(config->GetDeform_RBF_Radius());
+  if (radius == 0.0) {
+    for (iDim = 0; iDim < nDim; iDim++) radius += pow(bbMax[iDim]-bbMin[iDim], 2);
+    radius = sqrt(radius);
+  }
+  if ((maxDispl > 0.0) && (radius == 0.0))
+    SU2_MPI::Error("The support radius of the RBF deformation could not be determined, set DEFORM_RBF_RADIUS.", CURRENT_FUNCTION);
+
+  /*--- Greedy selection of the control points. In every pass the interpolation
+   error is evaluated at the constrained points, each rank treating a contiguous
+   part of them, and the points with the largest errors are added to the set of
+   control points. The Cholesky factor of the interpolation matrix is extended
+   row by row, hence the cost of adding a point is O(m^2) instead of O(m^3). ---*/
+
+  vector<unsigned long> ctrlPoints;
+  vector<passivedouble> cholFactor;   // Rows of the lower triangular factor, packed.
+  vector<passivedouble> ctrlCoef;     // nDim coefficients per control point.
+  vector<su2double> ctrlCoord;
+  vector<bool> isExcluded(nConstr, false);
+  CADTPointsOnlyClass *ctrlADT = NULL;
+  vector<unsigned long> ballIDs;
+
+  const unsigned long iBeg = nConstr*rank/size, iEnd = nConstr*(rank+1)/size;
+  passivedouble maxError = maxDispl;
+
+  /*--- Evaluate the interpolant of the current control points at a coordinate. ---*/
+
+  auto Interpolate = [&](const passivedouble *coor, passivedouble *val) {
+    for (unsigned short d = 0; d < nDim; d++) val[d] = 0.0;
+    if (ctrlADT == NULL) return;
+    su2double coorAD[3];
+    for (unsigned short d = 0; d < nDim; d++) coorAD[d] = coor[d];
+    ctrlADT->DetermineNodesInBall(coorAD, radius, ballIDs);
+    for (auto k : ballIDs) {
+      passivedouble dist = 0.0;
+      for (unsigned short d = 0; d < nDim; d++) dist += pow(coor[d]-ConstrCoord(ctrlPoints[k])[d], 2);
+      const passivedouble phi = Kernel(radius, sqrt(dist));
+      for (unsigned short d = 0; d < nDim; d++) val[d] += ctrlCoef[k*nDim+d]*phi;
+    }
+  };
+
+  while (maxDispl > 0.0) {
+
+    /*--- Interpolation errors at the constrained points of this rank. ---*/
+
+    vector<pair<passivedouble,unsigned long> > errors;
+    for (i = iBeg; i < iEnd; i++) {
+      if (isExcluded[i]) continue;
+      passivedouble val[3], error = 0.0;
+      Interpolate(ConstrCoord(i), val);
+      for (iDim = 0; iDim < nDim; iDim++) error += pow(val[iDim]-ConstrDispl(i)[iDim], 2);
+      errors.push_back(make_pair(sqrt(error), i));
+    }
+
+    /*--- Determine the points with the largest errors over all ranks. ---*/
+
+    const unsigned long nAdd = max<unsigned long>(min<unsigned long>(1 + ctrlPoints.size()/10,
+                                                     maxPoints - ctrlPoints.size()), 1);
+    const unsigned long nLocal = min<unsigned long>(nAdd, errors.size());
+    partial_sort(errors.begin(), errors.begin()+nLocal, errors.end(),
+                 [](const pair<passivedouble,unsigned long> &a, const pair<passivedouble,unsigned long> &b)
+                 { return (a.first > b.first) || ((a.first == b.first) && (a.second < b.second)); });
+
+    vector<passivedouble> sendErr(2*nAdd, -1.0), recvErr(2*nAdd*size);
+    for (i = 0; i < nLocal; i++) {
+      sendErr[2*i]   = errors[i].first;
+      sendErr[2*i+1] = errors[i].second;
+    }
+    SU2_MPI::Allgather(sendErr.data(), 2*nAdd, MPI_DOUBLE, recvErr.data(), 2*nAdd, MPI_DOUBLE, MPI_COMM_WORLD);
+
+    errors.clear();
+    for (i = 0; i < nAdd*size; i++)
+      if (recvErr[2*i] >= 0.0) errors.push_back(make_pair(recvErr[2*i], (unsigned long)recvErr[2*i+1]));
+    sort(errors.begin(), errors.end(),
+         [](const pair<passivedouble,unsigned long> &a, const pair<passivedouble,unsigned long> &b)
+         { return (a.first > b.first) || ((a.first == b.first) && (a.second < b.second)); });
+
+    maxError = errors.empty()? 0.0 : errors[0].first;
+    if ((maxError <= tolGreedy*maxDispl) || (ctrlPoints.size() >= maxPoints)) break;
+
+    /*--- Add the selected points to the Cholesky factor. A point for which the
+     pivot is not positive (numerically coincides with the span of the current
+     control points) is excluded from further selection. ---*/
+
+    const unsigned long nCtrlOld = ctrlPoints.size();
+    for (i = 0; (i < nAdd) && (i < errors.size()); i++) {
+      if (errors[i].first <= tolGreedy*maxDispl) break;
+      const unsigned long iNew = errors[i].second;
+      const unsigned long m = ctrlPoints.size();
+
+      vector<passivedouble> row(m+1);
+      for (j = 0; j < m; j++) {
+        passivedouble dist = 0.0;
+        for (iDim = 0; iDim < nDim; iDim++) dist += pow(ConstrCoord(iNew)[iDim]-ConstrCoord(ctrlPoints[j])[iDim], 2);
+        row[j] = Kernel(radius, sqrt(dist));
+      }
+
+      passivedouble pivot = 1.0;
+      for (j = 0; j < m; j++) {
+        const passivedouble *Lj = cholFactor.data() + j*(j+1)/2;
+        for (unsigned long k = 0; k < j; k++) row[j] -= Lj[k]*row[k];
+        row[j] /= Lj[j];
+        pivot -= row[j]*row[j];
+      }
+
+      isExcluded[iNew] = true;
+      if (pivot <= 1.e-12) continue;
+
+      row[m] = sqrt(pivot);
+      cholFactor.insert(cholFactor.end(), row.begin(), row.end());
+      ctrlPoints.push_back(iNew);
+    }
+    if (ctrlPoints.size() == nCtrlOld) break;
+
+    /*--- Solve for the coefficients of the interpolant, one forward and one
+     backward substitution per displacement component. ---*/
+
+    const unsigned long m = ctrlPoints.size();
+    ctrlCoef.assign(m*nDim, 0.0);
+    vector<passivedouble> y(m);
+    for (iDim = 0; iDim < nDim; iDim++) {
+      for (j = 0; j < m; j++) {
+        const passivedouble *Lj = cholFactor.data() + j*(j+1)/2;
+        y[j] = ConstrDispl(ctrlPoints[j])[iDim];
+        for (unsigned long k = 0; k < j; k++) y[j] -= Lj[k]*y[k];
+        y[j] /= Lj[j];
+      }
+      for (j = m; j-- > 0;) {
+        for (unsigned long k = j+1; k < m; k++) y[j] -= cholFactor[k*(k+1)/2+j]*y[k];
+        y[j] /= cholFactor[j*(j+1)/2+j];
+        ctrlCoef[j*nDim+iDim] = y[j];
+      }
+    }
+
+    /*--- Rebuild the search tree of the control points. ---*/
+
+    ctrlCoord.resize(m*nDim);
+    vector<unsigned long> ctrlIDs(m);
+    for (j = 0; j < m; j++) {
+      ctrlIDs[j] = j;
+      for (iDim = 0; iDim < nDim; iDim++) ctrlCoord[j*nDim+iDim] = ConstrCoord(ctrlPoints[j])[iDim];
+    }
+    delete ctrlADT;
+    ctrlADT = new CADTPointsOnlyClass(nDim, m, ctrlCoord.data(), ctrlIDs.data(), false);
+  }
+
+  /*--- Displacements of all the grid points. The constrained points get their
+   prescribed displacement, all others the value of the interpolant. ---*/
+
+  LinSysSol.SetValZero();
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    if (pointKind[iPoint] != 0) {
+      for (iDim = 0; iDim < nDim; iDim++)
+        LinSysSol[iPoint*nDim+iDim] = pointDispl[iPoint*nDim+iDim];
+    }
+    else {
+      passivedouble coor[3], val[3];
+      for (iDim = 0; iDim < nDim; iDim++)
+        coor[iDim] = SU2_TYPE::GetValue(geometry->node[iPoint]->GetCoord(iDim));
+      Interpolate(coor, val);
+      for (iDim = 0; iDim < nDim; iDim++) LinSysSol[iPoint*nDim+iDim] = val[iDim];
+    }
+  }
+  delete ctrlADT;
+
+  /*--- Remove the normal component of the displacement on the symmetry planes,
+   with the axis identified as in SetBoundaryDisplacements. ---*/
+
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    if ((config->GetMarker_All_KindBC(iMarker) != SYMMETRY_PLANE) || (geometry->nVertex[iMarker] == 0)) continue;
+
+    su2double MeanCoord[3] = {0.0, 0.0, 0.0};
+    const su2double *Coord_0 = geometry->node[geometry->vertex[iMarker][0]->GetNode()]->GetCoord();
+    for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+      const su2double *Coord = geometry->node[geometry->vertex[iMarker][iVertex]->GetNode()]->GetCoord();
+      for (iDim = 0; iDim < nDim; iDim++) MeanCoord[iDim] += pow(Coord[iDim]-Coord_0[iDim], 2);
+    }
+    unsigned short axis = 0;
+    for (iDim = 1; iDim < nDim; iDim++)
+      if (MeanCoord[iDim] <= MeanCoord[axis]) axis = iDim;
+
+    for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++)
+      LinSysSol[geometry->vertex[iMarker][iVertex]->GetNode()*nDim+axis] = 0.0;
+  }
+
+  /*--- Fix the location of any points in the domain, if requested. ---*/
+
+  if (config->GetHold_GridFixed()) {
+    const su2double *Hold_GridFixed_Coord = config->GetHold_GridFixed_Coord();
+    for (iPoint = 0; iPoint < nPoint; iPoint++) {
+      for (iDim = 0; iDim < nDim; iDim++) {
+        const su2double Coord = geometry->node[iPoint]->GetCoord(iDim);
+        if ((Coord < Hold_GridFixed_Coord[iDim]) || (Coord > Hold_GridFixed_Coord[iDim+3]))
+          LinSysSol[iPoint*nDim+iDim] = 0.0;
+      }
+    }
+  }
+
+  /*--- Update the grid coordinates and cell volumes and check for failed
+   deformation (negative volumes). ---*/
+
+  UpdateGridCoord(geometry, config);
+  if (UpdateGeo) { UpdateDualGrid(geometry, config); }
+
+  ComputeDeforming_Element_Volume(geometry, MinVolume, MaxVolume, Screen_Output);
+
+  /*--- The number of control points is reported as the number of iterations. ---*/
+
+  Set_nIterMesh(ctrlPoints.size());
+
+  if (rank == MASTER_NODE && Screen_Output) {
+    cout << "RBF deformation: " << ctrlPoints.size() << " of " << nConstr << " control points. ";
+    cout << "Support radius: " << radius << ". Rel. error: " << (maxDispl > 0.0? maxError/maxDispl : 0.0) << ". ";
+    if (nDim == 2) cout << "Min. area: " << MinVolume << "." << endl;
+    else cout << "Min. volume: " << MinVolume << "." << endl;
+  }
+
+}
+
 void CVolumetricMovement::ComputeDeforming_Element_Volume(CGeometry *geometry, su2double &MinVolume, su2double &MaxVolume, bool Screen_Output) {
   
-  unsigned long iElem, ElemCounter = 0, PointCorners[8];
-  su2double Volume = 0.0, CoordCorners[8][3];
-  unsigned short nNodes = 0, iNodes, iDim;
-  bool RightVol = true;
+  unsigned long ElemCounter = 0;
   
   if (rank == MASTER_NODE && Screen_Output)
     cout << "Computing volumes of the grid elements." << endl;
   
   MaxVolume = -1E22; MinVolume = 1E22;
   
+  const unsigned long nElem = geometry->GetnElem();
+  const auto chunkSize = computeStaticChunkSize(nElem, omp_get_max_threads(), 512);
+  
+  SU2_OMP_PARALLEL
+  {
+  /*--- Local min/max, final reduction outside loop. ---*/
+  
+  su2double maxVol = -1E22, minVol = 1E22;
+  
   /*--- Load up each triangle and tetrahedron to check for negative volumes. ---*/
   
-  for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
+  SU2_OMP(for schedule(static,chunkSize) reduction(+:ElemCounter) nowait)
+  for (unsigned long iElem = 0; iElem < nElem; iElem++) {
+    
+    unsigned long PointCorners[8];
+    su2double Volume = 0.0, CoordCorners[8][3];
+    unsigned short nNodes = 0;
     
     if (geometry->elem[iElem]->GetVTK_Type() == TRIANGLE)     nNodes = 3;
     if (geometry->elem[iElem]->GetVTK_Type() == QUADRILATERAL)    nNodes = 4;
@@ -357,9 +759,9 @@ void CVolumetricMovement::ComputeDeforming_Element_Volume(CGeometry *geometry, s
     if (geometry->elem[iElem]->GetVTK_Type() == PRISM)        nNodes = 6;
     if (geometry->elem[iElem]->GetVTK_Type() == HEXAHEDRON)   nNodes = 8;
     
-    for (iNodes = 0; iNodes < nNodes; iNodes++) {
+    for (unsigned short iNodes = 0; iNodes < nNodes; iNodes++) {
       PointCorners[iNodes] = geometry->elem[iElem]->GetNode(iNodes);
-      for (iDim = 0; iDim < nDim; iDim++) {
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) {
         CoordCorners[iNodes][iDim] = geometry->node[PointCorners[iNodes]]->GetCoord(iDim);
       }
     }
@@ -380,33 +782,43 @@ void CVolumetricMovement::ComputeDeforming_Element_Volume(CGeometry *geometry, s
       if (nNodes == 8) Volume = GetHexa_Volume(CoordCorners);
     }
     
-    RightVol = true;
-    if (Volume < 0.0) RightVol = false;
-    
-    MaxVolume = max(MaxVolume, Volume);
-    MinVolume = min(MinVolume, Volume);
+    maxVol = max(maxVol, Volume);
+    minVol = min(minVol, Volume);
     geometry->elem[iElem]->SetVolume(Volume);
     
-    if (!RightVol) ElemCounter++;
+    if (Volume < 0.0) ElemCounter++;
     
   }
+  SU2_OMP_CRITICAL
+  {
+    MaxVolume = max(MaxVolume, maxVol);
+    MinVolume = min(MinVolume, minVol);
+  }
+  SU2_OMP_BARRIER
   
 #ifdef HAVE_MPI
-  unsigned long ElemCounter_Local = ElemCounter; ElemCounter = 0;
-  su2double MaxVolume_Local = MaxVolume; MaxVolume = 0.0;
-  su2double MinVolume_Local = MinVolume; MinVolume = 0.0;
-  SU2_MPI::Allreduce(&ElemCounter_Local, &ElemCounter, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MaxVolume_Local, &MaxVolume, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MinVolume_Local, &MinVolume, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+  SU2_OMP_MASTER
+  {
+    unsigned long ElemCounter_Local = ElemCounter; ElemCounter = 0;
+    su2double MaxVolume_Local = MaxVolume; MaxVolume = 0.0;
+    su2double MinVolume_Local = MinVolume; MinVolume = 0.0;
+    SU2_MPI::Allreduce(&ElemCounter_Local, &ElemCounter, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(&MaxVolume_Local, &MaxVolume, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(&MinVolume_Local, &MinVolume, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+  }
+  SU2_OMP_BARRIER
 #endif
   
   /*--- Volume from  0 to 1 ---*/
   
-  for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
-    Volume = geometry->elem[iElem]->GetVolume()/MaxVolume;
+  SU2_OMP_FOR_STAT(chunkSize)
+  for (unsigned long iElem = 0; iElem < nElem; iElem++) {
+    su2double Volume = geometry->elem[iElem]->GetVolume()/MaxVolume;
     geometry->elem[iElem]->SetVolume(Volume);
   }
   
+  } // end SU2_OMP_PARALLEL
+  
   if ((ElemCounter != 0) && (rank == MASTER_NODE) && (Screen_Output))
     cout <<"There are " << ElemCounter << " elements with negative volume.\n" << endl;
   
@@ -416,10 +828,9 @@ void CVolumetricMovement::ComputeDeforming_Element_Volume(CGeometry *geometry, s
   
 void CVolumetricMovement::ComputeSolid_Wall_Distance(CGeometry *geometry, CConfig *config, su2double &MinDistance, su2double &MaxDistance) {
   
-  unsigned long nVertex_SolidWall, ii, jj, iVertex, iPoint, pointID;
+  unsigned long nVertex_SolidWall, ii, jj, iVertex, iPoint;
   unsigned short iMarker, iDim;
-  su2double dist, MaxDistance_Local, MinDistance_Local;
-  int rankID;
+  su2double MaxDistance_Local, MinDistance_Local;
 
   /*--- Initialize min and max distance ---*/
 
@@ -483,19 +894,38 @@ void CVolumetricMovement::ComputeSolid_Wall_Distance(CGeometry *geometry, CConfi
     /*--- Solid wall boundary nodes are present. Compute the wall
      distance for all nodes. ---*/
     
-    for(iPoint=0; iPoint<geometry->GetnPoint(); ++iPoint) {
-      
-      WallADT.DetermineNearestNode(geometry->node[iPoint]->GetCoord(), dist,
-                                   pointID, rankID);
-      geometry->node[iPoint]->SetWall_Distance(dist);
-      
-      MaxDistance = max(MaxDistance, dist);
+    const unsigned long nPointGeo = geometry->GetnPoint();
+    
+    SU2_OMP_PARALLEL
+    {
+      /*--- Local min/max, final reduction outside loop. The searches of the ADT are thread safe. ---*/
       
-      /*--- To discard points on the surface we use > EPS ---*/
-       
-      if (sqrt(dist) > EPS)  MinDistance = min(MinDistance, dist);
+      su2double maxDist = -1E22, minDist = 1E22;
       
-    }
+      SU2_OMP_FOR_DYN(256)
+      for(unsigned long jPoint=0; jPoint<nPointGeo; ++jPoint) {
+        
+        su2double dist;
+        unsigned long pointID;
+        int rankID;
+        
+        WallADT.DetermineNearestNode(geometry->node[jPoint]->GetCoord(), dist,
+                                     pointID, rankID);
+        geometry->node[jPoint]->SetWall_Distance(dist);
+        
+        maxDist = max(maxDist, dist);
+        
+        /*--- To discard points on the surface we use > EPS ---*/
+        
+        if (sqrt(dist) > EPS)  minDist = min(minDist, dist);
+        
+      }
+      SU2_OMP_CRITICAL
+      {
+        MaxDistance = max(MaxDistance, maxDist);
+        MinDistance = min(MinDistance, minDist);
+      }
+    } // end SU2_OMP_PARALLEL
     
     MaxDistance_Local = MaxDistance; MaxDistance = 0.0;
     MinDistance_Local = MinDistance; MinDistance = 0.0;
@@ -514,21 +944,13 @@ void CVolumetricMovement::ComputeSolid_Wall_Distance(CGeometry *geometry, CConfi
 
 su2double CVolumetricMovement::SetFEAMethodContributions_Elem(CGeometry *geometry, CConfig *config) {
   
-  unsigned short iVar, iDim, nNodes = 0, iNodes, StiffMatrix_nElem = 0;
-  unsigned long iElem, PointCorners[8];
-  su2double **StiffMatrix_Elem = NULL, CoordCorners[8][3];
-  su2double MinVolume = 0.0, MaxVolume = 0.0, MinDistance = 0.0, MaxDistance = 0.0, ElemVolume = 0.0, ElemDistance = 0.0;
+  su2double MinVolume = 0.0, MaxVolume = 0.0, MinDistance = 0.0, MaxDistance = 0.0;
   
   bool Screen_Output  = config->GetDeform_Output();
   
-  /*--- Allocate maximum size (quadrilateral and hexahedron) ---*/
+  /*--- Maximum size of the element matrix (quadrilateral and hexahedron) ---*/
   
-  if (nDim == 2) StiffMatrix_nElem = 8;
-  else StiffMatrix_nElem = 24;
-    
-  StiffMatrix_Elem = new su2double* [StiffMatrix_nElem];
-  for (iVar = 0; iVar < StiffMatrix_nElem; iVar++)
-    StiffMatrix_Elem[iVar] = new su2double [StiffMatrix_nElem];
+  const unsigned short StiffMatrix_nElem = (nDim == 2)? 8 : 24;
   
   /*--- Compute min volume in the entire mesh. ---*/
   
@@ -544,48 +966,80 @@ su2double CVolumetricMovement::SetFEAMethodContributions_Elem(CGeometry *geometr
     if (rank == MASTER_NODE && Screen_Output) cout <<"Min. distance: "<< MinDistance <<", max. distance: "<< MaxDistance <<"." << endl;
   }
   
+  /*--- The elements of one color do not share nodes, hence the threads can add
+   their contributions to the stiffness matrix without conflicts. If the coloring
+   is not efficient (or has a single color, e.g. without threads) the assembly is
+   carried out by one thread. ---*/
+  
+  su2double parallelEff = 1.0;
+  const auto& coloring = geometry->GetElementColoring(&parallelEff);
+  const auto nColor = coloring.getOuterSize();
+  const auto chunkSize = geometry->GetElementColorGroupSize();
+  const bool useThreads = (parallelEff >= COLORING_EFF_THRESH) && (nColor > 1);
+  
+  SU2_OMP_PARALLEL_(if(useThreads))
+  {
+  /*--- Element matrix of each thread. ---*/
+  
+  su2double **StiffMatrix_Elem = new su2double* [StiffMatrix_nElem];
+  for (unsigned short iVar = 0; iVar < StiffMatrix_nElem; iVar++)
+    StiffMatrix_Elem[iVar] = new su2double [StiffMatrix_nElem];
+  
   /*--- Compute contributions from each element by forming the stiffness matrix (FEA) ---*/
   
-  for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
+  for (auto iColor = 0ul; iColor < nColor; iColor++) {
     
-    if (geometry->elem[iElem]->GetVTK_Type() == TRIANGLE)      nNodes = 3;
-    if (geometry->elem[iElem]->GetVTK_Type() == QUADRILATERAL) nNodes = 4;
-    if (geometry->elem[iElem]->GetVTK_Type() == TETRAHEDRON)   nNodes = 4;
-    if (geometry->elem[iElem]->GetVTK_Type() == PYRAMID)       nNodes = 5;
-    if (geometry->elem[iElem]->GetVTK_Type() == PRISM)         nNodes = 6;
-    if (geometry->elem[iElem]->GetVTK_Type() == HEXAHEDRON)    nNodes = 8;
+    const auto nElemColor = coloring.getNumNonZeros(iColor);
+    const auto elemColor = coloring.innerIdx(iColor);
     
-    for (iNodes = 0; iNodes < nNodes; iNodes++) {
-      PointCorners[iNodes] = geometry->elem[iElem]->GetNode(iNodes);
-      for (iDim = 0; iDim < nDim; iDim++) {
-        CoordCorners[iNodes][iDim] = geometry->node[PointCorners[iNodes]]->GetCoord(iDim);
+    SU2_OMP_FOR_DYN(chunkSize)
+    for (auto k = 0ul; k < nElemColor; k++) {
+      
+      const auto iElem = elemColor[k];
+      unsigned short nNodes = 0;
+      unsigned long PointCorners[8];
+      su2double CoordCorners[8][3], ElemVolume = 0.0, ElemDistance = 0.0;
+      
+      if (geometry->elem[iElem]->GetVTK_Type() == TRIANGLE)      nNodes = 3;
+      if (geometry->elem[iElem]->GetVTK_Type() == QUADRILATERAL) nNodes = 4;
+      if (geometry->elem[iElem]->GetVTK_Type() == TETRAHEDRON)   nNodes = 4;
+      if (geometry->elem[iElem]->GetVTK_Type() == PYRAMID)       nNodes = 5;
+      if (geometry->elem[iElem]->GetVTK_Type() == PRISM)         nNodes = 6;
+      if (geometry->elem[iElem]->GetVTK_Type() == HEXAHEDRON)    nNodes = 8;
+      
+      for (unsigned short iNodes = 0; iNodes < nNodes; iNodes++) {
+        PointCorners[iNodes] = geometry->elem[iElem]->GetNode(iNodes);
+        for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+          CoordCorners[iNodes][iDim] = geometry->node[PointCorners[iNodes]]->GetCoord(iDim);
+        }
       }
+      
+      /*--- Extract Element volume and distance to compute the stiffness ---*/
+      
+      ElemVolume = geometry->elem[iElem]->GetVolume();
+      
+      if ((config->GetDeform_Stiffness_Type() == SOLID_WALL_DISTANCE)) {
+        for (unsigned short iNodes = 0; iNodes < nNodes; iNodes++)
+          ElemDistance += geometry->node[PointCorners[iNodes]]->GetWall_Distance();
+        ElemDistance = ElemDistance/(su2double)nNodes;
+      }
+      
+      if (nDim == 2) SetFEA_StiffMatrix2D(geometry, config, StiffMatrix_Elem, PointCorners, CoordCorners, nNodes, ElemVolume, ElemDistance);
+      if (nDim == 3) SetFEA_StiffMatrix3D(geometry, config, StiffMatrix_Elem, PointCorners, CoordCorners, nNodes, ElemVolume, ElemDistance);
+      
+      AddFEA_StiffMatrix(geometry, StiffMatrix_Elem, PointCorners, nNodes);
+      
     }
-    
-    /*--- Extract Element volume and distance to compute the stiffness ---*/
-    
-    ElemVolume = geometry->elem[iElem]->GetVolume();
-    
-    if ((config->GetDeform_Stiffness_Type() == SOLID_WALL_DISTANCE)) {
-      ElemDistance = 0.0;
-      for (iNodes = 0; iNodes < nNodes; iNodes++)
-        ElemDistance += geometry->node[PointCorners[iNodes]]->GetWall_Distance();
-      ElemDistance = ElemDistance/(su2double)nNodes;
-    }
-    
-    if (nDim == 2) SetFEA_StiffMatrix2D(geometry, config, StiffMatrix_Elem, PointCorners, CoordCorners, nNodes, ElemVolume, ElemDistance);
-    if (nDim == 3) SetFEA_StiffMatrix3D(geometry, config, StiffMatrix_Elem, PointCorners, CoordCorners, nNodes, ElemVolume, ElemDistance);
-    
-    AddFEA_StiffMatrix(geometry, StiffMatrix_Elem, PointCorners, nNodes);
-    
   }
   
   /*--- Deallocate memory and exit ---*/
   
-  for (iVar = 0; iVar < StiffMatrix_nElem; iVar++)
+  for (unsigned short iVar = 0; iVar < StiffMatrix_nElem; iVar++)
     delete [] StiffMatrix_Elem[iVar];
   delete [] StiffMatrix_Elem;
   
+  } // end SU2_OMP_PARALLEL
+  
   return MinVolume;
 
 }
@@ -1758,8 +2212,8 @@ void CVolumetricMovement::SetBoundaryDerivatives(CGeometry *geometry, CConfig *c
           VarCoord = geometry->vertex[iMarker][iVertex]->GetVarCoord();
           for (iDim = 0; iDim < nDim; iDim++) {
             total_index = iPoint*nDim + iDim;
-            LinSysRes[total_index] = SU2_TYPE::GetDerivative(VarCoord[iDim]);
-            LinSysSol[total_index] = SU2_TYPE::GetDerivative(VarCoord[iDim]);
+            LinSysRes[total_index] = SU2_TYPE::GetDerivative(VarCoord[iDim], Derivative_Direction);
+            LinSysSol[total_index] = SU2_TYPE::GetDerivative(VarCoord[iDim], Derivative_Direction);
           }
         }
       }
@@ -1792,7 +2246,7 @@ void CVolumetricMovement::UpdateGridCoord_Derivatives(CGeometry *geometry, CConf
       for (iDim = 0; iDim < nDim; iDim++) {
         total_index = iPoint*nDim + iDim;
         new_coord[iDim] = geometry->node[iPoint]->GetCoord(iDim);
-        SU2_TYPE::SetDerivative(new_coord[iDim], SU2_TYPE::GetValue(LinSysSol[total_index]));
+        SU2_TYPE::SetDerivative(new_coord[iDim], Derivative_Direction, SU2_TYPE::GetValue(LinSysSol[total_index]));
       }
       geometry->node[iPoint]->SetCoord(new_coord);
     }
@@ -2037,9 +2491,10 @@ void CVolumetricMovement::Rigid_Rotation(CGeometry *geometry, CConfig *config,
     config->SetRefOriginMoment_Z(jMarker, Center[2]+rotCoord[2]);
   }
   
-  /*--- After moving all nodes, update geometry class ---*/
+  /*--- After moving all nodes, update geometry class, the dual grid is rotated
+   if the motion is rigid (no scaling by the reference length). ---*/
   
-  UpdateDualGrid(geometry, config);
+  SetRigidMotion_DualGrid(geometry, config, rotMatrix, Center, Lref);
 
 }
 
@@ -2189,9 +2644,10 @@ void CVolumetricMovement::Rigid_Pitching(CGeometry *geometry, CConfig *config, u
   
   /*--- For pitching we don't update the motion origin and moment reference origin. ---*/
 
-  /*--- After moving all nodes, update geometry class ---*/
+  /*--- After moving all nodes, update geometry class, the dual grid is rotated
+   if the motion is rigid (no scaling by the reference length). ---*/
   
-  UpdateDualGrid(geometry, config);
+  SetRigidMotion_DualGrid(geometry, config, rotMatrix, Center, Lref);
   
 }
 
@@ -2320,9 +2776,11 @@ void CVolumetricMovement::Rigid_Plunging(CGeometry *geometry, CConfig *config, u
     config->SetRefOriginMoment_Z(jMarker, Center[2]);
   }
   
-  /*--- After moving all nodes, update geometry class ---*/
+  /*--- After moving all nodes, update geometry class, the dual grid is
+   only translated (normals and volumes do not change). ---*/
   
-  UpdateDualGrid(geometry, config);
+  const su2double identity[3][3] = {{1.0,0.0,0.0}, {0.0,1.0,0.0}, {0.0,0.0,1.0}};
+  geometry->SetRigidMotion(config, identity, deltaX);
   
 }
 
@@ -2431,9 +2889,11 @@ void CVolumetricMovement::Rigid_Translation(CGeometry *geometry, CConfig *config
     config->SetRefOriginMoment_Z(jMarker, Center[2]);
   }
   
-  /*--- After moving all nodes, update geometry class ---*/
+  /*--- After moving all nodes, update geometry class, the dual grid is
+   only translated (normals and volumes do not change). ---*/
   
-  UpdateDualGrid(geometry, config);
+  const su2double identity[3][3] = {{1.0,0.0,0.0}, {0.0,1.0,0.0}, {0.0,0.0,1.0}};
+  geometry->SetRigidMotion(config, identity, deltaX);
   
 }
 
@@ -2605,6 +3065,7 @@ CSurfaceMovement::CSurfaceMovement(void) : CGridMovement() {
   nFFDBox = 0;
   nLevel = 0;
   FFDBoxDefinition = false;
+  FFDBoxStored = false;
 }
 
 CSurfaceMovement::~CSurfaceMovement(void) {}
@@ -2745,13 +3206,26 @@ void CSurfaceMovement::SetSurface_Deformation(CGeometry *geometry, CConfig *conf
       (config->GetDesign_Variable(0) == FFD_THICKNESS) ||
       (config->GetDesign_Variable(0) == FFD_ANGLE_OF_ATTACK)) {
     
-    /*--- Definition of the FFD deformation class ---*/
-    
-    FFDBox = new CFreeFormDefBox*[MAX_NUMBER_FFD];
-    
-    /*--- Read the FFD information from the grid file ---*/
+    /*--- The boxes of a previous deformation of this grid are kept if they are cartesian and not nested
+     (the copy of the control points of the child boxes is modified by the deformation of their parents),
+     their original control points are restored, otherwise the FFD information is read again. ---*/
     
-    ReadFFDInfo(geometry, config, FFDBox, config->GetMesh_FileName());
+    if (FFDBoxStored) {
+      for (iFFDBox = 0; iFFDBox < GetnFFDBox(); iFFDBox++)
+        FFDBox[iFFDBox]->SetOriginalControlPoints();
+    }
+    else {
+      
+      /*--- Definition of the FFD deformation class ---*/
+      
+      FFDBox = new CFreeFormDefBox*[MAX_NUMBER_FFD];
+      
+      /*--- Read the FFD information from the grid file ---*/
+      
+      ReadFFDInfo(geometry, config, FFDBox, config->GetMesh_FileName());
+      
+      FFDBoxStored = cartesian && (GetnLevel() <= 1);
+    }
     
     /*--- If there is a FFDBox in the input file ---*/
     
@@ -3149,11 +3623,12 @@ void CSurfaceMovement::SetSurface_Deformation(CGeometry *geometry, CConfig *conf
 }
 
 
-void CSurfaceMovement::SetSurface_Derivative(CGeometry *geometry, CConfig *config) {
+unsigned short CSurfaceMovement::SetSurface_Derivative(CGeometry *geometry, CConfig *config) {
 
   su2double DV_Value = 0.0;
 
-  unsigned short iDV = 0, iDV_Value = 0;
+  unsigned short iDV = 0, iDV_Value = 0, iDir = 0;
+  const unsigned short nDir = SU2_TYPE::GetnDirections();
 
   for (iDV = 0; iDV < config->GetnDV(); iDV++) {
     for (iDV_Value = 0; iDV_Value < config->GetnDV_Value(iDV); iDV_Value++) {
@@ -3161,13 +3636,19 @@ void CSurfaceMovement::SetSurface_Derivative(CGeometry *geometry, CConfig *confi
       DV_Value = config->GetDV_Value(iDV, iDV_Value);
 
       /*--- If value of the design variable is not 0.0 we apply the differentation.
-     *     Note if multiple variables are non-zero, we end up with the sum of all the derivatives. ---*/
+     *     Note if multiple variables are non-zero, we end up with the sum of all the derivatives,
+     *     unless the vector mode is used, then each variable has its own direction. ---*/
 
       if (DV_Value != 0.0) {
 
+        if (iDir == nDir && nDir > 1)
+          SU2_MPI::Error("There are more non-zero design variables than derivative directions ("+to_string(nDir)+").",
+                         CURRENT_FUNCTION);
+
         DV_Value = 0.0;
 
-        SU2_TYPE::SetDerivative(DV_Value, 1.0);
+        SU2_TYPE::SetDerivative(DV_Value, iDir, 1.0);
+        if (nDir > 1) iDir++;
 
         config->SetDV_Value(iDV, iDV_Value, DV_Value);
       }
@@ -3177,6 +3658,8 @@ void CSurfaceMovement::SetSurface_Derivative(CGeometry *geometry, CConfig *confi
   /*--- Run the surface deformation with DV_Value = 0.0 (no deformation at all) ---*/
 
   SetSurface_Deformation(geometry, config);
+
+  return max<unsigned short>(iDir, 1);
 }
 
 void CSurfaceMovement::CopyBoundary(CGeometry *geometry, CConfig *config) {
@@ -3916,10 +4399,9 @@ void CSurfaceMovement::UpdateParametricCoord(CGeometry *geometry, CConfig *confi
 
 su2double CSurfaceMovement::SetCartesianCoord(CGeometry *geometry, CConfig *config, CFreeFormDefBox *FFDBox, unsigned short iFFDBox, bool ResetDef) {
   
-  su2double *CartCoordNew, Diff, my_MaxDiff = 0.0, MaxDiff,
-  *ParamCoord, VarCoord[3] = {0.0, 0.0, 0.0}, CartCoordOld[3] = {0.0, 0.0, 0.0};
-  unsigned short iMarker, iDim;
-  unsigned long iVertex, iPoint, iSurfacePoints;
+  su2double my_MaxDiff = 0.0, MaxDiff, ZeroCoord[3] = {0.0, 0.0, 0.0};
+  unsigned short iMarker;
+  unsigned long iVertex;
   
   bool cylindrical = (config->GetFFD_CoordSystem() == CYLINDRICAL);
   bool spherical = (config->GetFFD_CoordSystem() == SPHERICAL);
@@ -3932,38 +4414,47 @@ su2double CSurfaceMovement::SetCartesianCoord(CGeometry *geometry, CConfig *conf
   if (ResetDef) {
     for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        geometry->vertex[iMarker][iVertex]->SetVarCoord(VarCoord);
+        geometry->vertex[iMarker][iVertex]->SetVarCoord(ZeroCoord);
       }
     }
   }
   
+  /*--- The basis weights only depend on the parametric coordinates, they are computed once
+   and each update of the control points becomes a sparse product over the surface points. ---*/
+  
+  FFDBox->SetSurfaceBasis();
+  
   /*--- Recompute the cartesians coordinates ---*/
   
-  for (iSurfacePoints = 0; iSurfacePoints < FFDBox->GetnSurfacePoint(); iSurfacePoints++) {
+  const unsigned long nSurfacePoints = FFDBox->GetnSurfacePoint();
+  
+  SU2_OMP_PARALLEL
+  {
+  su2double CartCoordNew[3] = {0.0, 0.0, 0.0}, VarCoord[3] = {0.0, 0.0, 0.0}, CartCoordOld[3] = {0.0, 0.0, 0.0};
+  su2double Diff, my_MaxDiff_thread = 0.0;
+  
+  SU2_OMP_FOR_STAT(computeStaticChunkSize(nSurfacePoints, omp_get_max_threads(), 512))
+  for (unsigned long iSurfacePoints = 0; iSurfacePoints < nSurfacePoints; iSurfacePoints++) {
     
     /*--- Get the marker of the surface point ---*/
     
-    iMarker = FFDBox->Get_MarkerIndex(iSurfacePoints);
+    const unsigned short iMarker = FFDBox->Get_MarkerIndex(iSurfacePoints);
     
     if (config->GetMarker_All_DV(iMarker) == YES) {
       
       /*--- Get the vertex of the surface point ---*/
       
-      iVertex = FFDBox->Get_VertexIndex(iSurfacePoints);
-      iPoint = FFDBox->Get_PointIndex(iSurfacePoints);
+      const unsigned long iVertex = FFDBox->Get_VertexIndex(iSurfacePoints);
+      const unsigned long iPoint = FFDBox->Get_PointIndex(iSurfacePoints);
       
       /*--- Set to zero the variation of the coordinates ---*/
       
-      geometry->vertex[iMarker][iVertex]->SetVarCoord(VarCoord);
-      
-      /*--- Get the parametric coordinate of the surface point ---*/
-      
-      ParamCoord = FFDBox->Get_ParametricCoord(iSurfacePoints);
+      geometry->vertex[iMarker][iVertex]->SetVarCoord(ZeroCoord);
       
       /*--- Compute the new cartesian coordinate, and set the value in
        the FFDBox structure ---*/
       
-      CartCoordNew = FFDBox->EvalCartesianCoord(ParamCoord);
+      FFDBox->EvalSurfaceCartesianCoord(iSurfacePoints, CartCoordNew);
       
       /*--- If polar coordinates, compute the cartesians from the polar value ---*/
       
@@ -3996,14 +4487,14 @@ su2double CSurfaceMovement::SetCartesianCoord(CGeometry *geometry, CConfig *conf
       
       /*--- Get the original cartesian coordinates of the surface point ---*/
       
-      for (iDim = 0; iDim < nDim; iDim++) {
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) {
         CartCoordOld[iDim] = geometry->node[iPoint]->GetCoord(iDim);
       }
       
       /*--- Set the value of the variation of the coordinates ---*/
       
       Diff = 0.0;
-      for (iDim = 0; iDim < nDim; iDim++) {
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) {
         VarCoord[iDim] = CartCoordNew[iDim] - CartCoordOld[iDim];
         if ((fabs(VarCoord[iDim]) <= EPS) && (config->GetDirectDiff() != D_DESIGN) && (!config->GetAD_Mode()))
           VarCoord[iDim] = 0.0;
@@ -4011,7 +4502,7 @@ su2double CSurfaceMovement::SetCartesianCoord(CGeometry *geometry, CConfig *conf
       }
       Diff = sqrt(Diff);
       
-      my_MaxDiff = max(my_MaxDiff, Diff);
+      my_MaxDiff_thread = max(my_MaxDiff_thread, Diff);
       
       /*--- Set the variation of the coordinates ---*/
       
@@ -4019,6 +4510,10 @@ su2double CSurfaceMovement::SetCartesianCoord(CGeometry *geometry, CConfig *conf
       
     }
   }
+  SU2_OMP_CRITICAL
+  my_MaxDiff = max(my_MaxDiff, my_MaxDiff_thread);
+  
+  } // end SU2_OMP_PARALLEL
   
 #ifdef HAVE_MPI
   SU2_MPI::Allreduce(&my_MaxDiff, &MaxDiff, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
@@ -8676,39 +9171,199 @@ su2double *CFreeFormDefBox::GetParametricCoord_Analytical(su2double *cart_coord)
 }
 
 su2double *CFreeFormDefBox::EvalCartesianCoord(su2double *ParamCoord) {
+  
+  EvalMapping(ParamCoord, 0, cart_coord);
+  
+  return cart_coord;
+}
+
+void CFreeFormDefBox::EvalMapping(const su2double *uvw, unsigned short val_maxdiff, su2double *coord,
+                                  su2double jac[][3], su2double hess[][3][3]) {
+  
+  unsigned short iDim, jDim, kDim, iDiff, iDegree, jDegree, kDegree, ijk[3];
+  const unsigned short lmn[3] = {lDegree, mDegree, nDegree};
+  su2double basis[3][3], weight;
+  
+  /*--- Univariate basis functions (and derivatives) in each direction, evaluating them
+   inside the tensor-product loop would cost one virtual call per term and direction. ---*/
+  
+  vector<su2double> basis1D[3][3];
+  
+  for (iDim = 0; iDim < nDim; iDim++) {
+    for (iDiff = 0; iDiff <= val_maxdiff; iDiff++) {
+      basis1D[iDim][iDiff].resize(lmn[iDim]+1);
+      for (iDegree = 0; iDegree <= lmn[iDim]; iDegree++) {
+        if (iDiff == 0) basis1D[iDim][iDiff][iDegree] = BlendingFunction[iDim]->GetBasis(iDegree, uvw[iDim]);
+        else basis1D[iDim][iDiff][iDegree] = BlendingFunction[iDim]->GetDerivative(iDegree, uvw[iDim], iDiff);
+      }
+    }
+  }
+  
+  for (iDim = 0; iDim < nDim; iDim++) {
+    coord[iDim] = 0.0;
+    for (jDim = 0; jDim < nDim; jDim++) {
+      if (val_maxdiff > 0) jac[iDim][jDim] = 0.0;
+      for (kDim = 0; kDim < nDim; kDim++)
+        if (val_maxdiff > 1) hess[iDim][jDim][kDim] = 0.0;
+    }
+  }
+  
+  for (iDegree = 0; iDegree <= lmn[0]; iDegree++) {
+    for (jDegree = 0; jDegree <= lmn[1]; jDegree++) {
+      for (kDegree = 0; kDegree <= lmn[2]; kDegree++) {
+        
+        const su2double *CoordCP = Coord_Control_Points[iDegree][jDegree][kDegree];
+        
+        ijk[0] = iDegree; ijk[1] = jDegree; ijk[2] = kDegree;
+        for (iDim = 0; iDim < nDim; iDim++)
+          for (iDiff = 0; iDiff <= val_maxdiff; iDiff++)
+            basis[iDim][iDiff] = basis1D[iDim][iDiff][ijk[iDim]];
+        
+        /*--- Value of the mapping ---*/
+        
+        weight = basis[0][0] * basis[1][0] * basis[2][0];
+        for (iDim = 0; iDim < nDim; iDim++)
+          coord[iDim] += CoordCP[iDim] * weight;
+        
+        /*--- First derivatives, the direction jDim is differentiated once ---*/
+        
+        if (val_maxdiff > 0) {
+          for (jDim = 0; jDim < nDim; jDim++) {
+            weight = 1.0;
+            for (iDim = 0; iDim < nDim; iDim++) weight *= basis[iDim][iDim == jDim];
+            for (iDim = 0; iDim < nDim; iDim++)
+              jac[iDim][jDim] += CoordCP[iDim] * weight;
+          }
+        }
+        
+        /*--- Second derivatives, the directions jDim and kDim are each differentiated once
+         (twice if they coincide), the upper triangle is computed and then mirrored ---*/
+        
+        if (val_maxdiff > 1) {
+          for (jDim = 0; jDim < nDim; jDim++) {
+            for (kDim = jDim; kDim < nDim; kDim++) {
+              weight = 1.0;
+              for (iDim = 0; iDim < nDim; iDim++) weight *= basis[iDim][(iDim == jDim) + (iDim == kDim)];
+              for (iDim = 0; iDim < nDim; iDim++)
+                hess[iDim][jDim][kDim] += CoordCP[iDim] * weight;
+            }
+          }
+        }
+        
+      }
+    }
+  }
+  
+  if (val_maxdiff > 1) {
+    for (iDim = 0; iDim < nDim; iDim++)
+      for (jDim = 0; jDim < nDim; jDim++)
+        for (kDim = 0; kDim < jDim; kDim++)
+          hess[iDim][jDim][kDim] = hess[iDim][kDim][jDim];
+  }
+  
+}
+
+void CFreeFormDefBox::SetSurfaceBasis(void) {
+  
+  if (SurfaceBasis_Set) return;
+  
   unsigned short iDim, iDegree, jDegree, kDegree;
+  unsigned long iSurfacePoints, nSurfacePoints = GetnSurfacePoint();
+  const unsigned short lmn[3] = {lDegree, mDegree, nDegree};
+  su2double weight;
   
-  for (iDim = 0; iDim < nDim; iDim++)
-    cart_coord[iDim] = 0.0;
+  vector<su2double> basis1D[3];
+  for (iDim = 0; iDim < nDim; iDim++) basis1D[iDim].resize(lmn[iDim]+1);
   
-  for (iDegree = 0; iDegree <= lDegree; iDegree++)
-    for (jDegree = 0; jDegree <= mDegree; jDegree++)
-      for (kDegree = 0; kDegree <= nDegree; kDegree++)
-        for (iDim = 0; iDim < nDim; iDim++) {
-          cart_coord[iDim] += Coord_Control_Points[iDegree][jDegree][kDegree][iDim]
-          * BlendingFunction[0]->GetBasis(iDegree, ParamCoord[0])
-          * BlendingFunction[1]->GetBasis(jDegree, ParamCoord[1])
-          * BlendingFunction[2]->GetBasis(kDegree, ParamCoord[2]);
+  SurfaceBasisPtr.assign(1, 0);
+  SurfaceBasisPtr.reserve(nSurfacePoints+1);
+  SurfaceBasisIJK.clear();
+  SurfaceBasisVal.clear();
+  
+  for (iSurfacePoints = 0; iSurfacePoints < nSurfacePoints; iSurfacePoints++) {
+    
+    for (iDim = 0; iDim < nDim; iDim++)
+      for (iDegree = 0; iDegree <= lmn[iDim]; iDegree++)
+        basis1D[iDim][iDegree] = BlendingFunction[iDim]->GetBasis(iDegree, ParametricCoord[iDim][iSurfacePoints]);
+    
+    /*--- Only the nonzero weights are kept, B-Splines have local support. ---*/
+    
+    for (iDegree = 0; iDegree <= lmn[0]; iDegree++) {
+      for (jDegree = 0; jDegree <= lmn[1]; jDegree++) {
+        for (kDegree = 0; kDegree <= lmn[2]; kDegree++) {
+          weight = basis1D[0][iDegree] * basis1D[1][jDegree] * basis1D[2][kDegree];
+          if (weight != 0.0) {
+            SurfaceBasisIJK.push_back(iDegree);
+            SurfaceBasisIJK.push_back(jDegree);
+            SurfaceBasisIJK.push_back(kDegree);
+            SurfaceBasisVal.push_back(weight);
+          }
         }
+      }
+    }
+    SurfaceBasisPtr.push_back(SurfaceBasisVal.size());
+  }
+  
+  /*--- In reverse AD the weights are recomputed (thus recorded) every time. ---*/
+  
+#ifndef CODI_REVERSE_TYPE
+  SurfaceBasis_Set = true;
+#endif
+  
+}
+
+void CFreeFormDefBox::EvalSurfaceCartesianCoord(unsigned long iSurfacePoints, su2double *coord) const {
+  
+  unsigned short iDim;
+  unsigned long iNonZero;
+  
+  for (iDim = 0; iDim < nDim; iDim++)
+    coord[iDim] = 0.0;
+  
+  for (iNonZero = SurfaceBasisPtr[iSurfacePoints]; iNonZero < SurfaceBasisPtr[iSurfacePoints+1]; iNonZero++) {
+    const unsigned short *ijk = &SurfaceBasisIJK[3*iNonZero];
+    const su2double *CoordCP = Coord_Control_Points[ijk[0]][ijk[1]][ijk[2]];
+    for (iDim = 0; iDim < nDim; iDim++)
+      coord[iDim] += CoordCP[iDim] * SurfaceBasisVal[iNonZero];
+  }
   
-  return cart_coord;
 }
 
 
+void CFreeFormDefBox::ProjectSurfaceToControlPoints(const vector<su2double> &val_surface, vector<su2double> &val_control) {
+  
+  unsigned short iDim;
+  unsigned long iSurfacePoints, iNonZero, iControlPoint;
+  
+  SetSurfaceBasis();
+  
+  val_control.assign(nDim*lOrder*mOrder*nOrder, 0.0);
+  
+  for (iSurfacePoints = 0; iSurfacePoints < GetnSurfacePoint(); iSurfacePoints++) {
+    for (iNonZero = SurfaceBasisPtr[iSurfacePoints]; iNonZero < SurfaceBasisPtr[iSurfacePoints+1]; iNonZero++) {
+      const unsigned short *ijk = &SurfaceBasisIJK[3*iNonZero];
+      iControlPoint = (ijk[0]*mOrder + ijk[1])*nOrder + ijk[2];
+      for (iDim = 0; iDim < nDim; iDim++)
+        val_control[nDim*iControlPoint+iDim] += SurfaceBasisVal[iNonZero] * val_surface[nDim*iSurfacePoints+iDim];
+    }
+  }
+  
+}
+
 su2double *CFreeFormDefBox::GetFFDGradient(su2double *val_coord, su2double *xyz) {
   
-  unsigned short iDim, jDim, lmn[3];
+  unsigned short iDim, jDim;
+  su2double coord[3], jac[3][3];
   
-  /*--- Set the Degree of the spline ---*/
+  /*--- Gradient of F = ||X(u, v, w) - xyz||^2, i.e. 2 (X - xyz) dX/du ---*/
   
-  lmn[0] = lDegree; lmn[1] = mDegree; lmn[2] = nDegree;
+  EvalMapping(val_coord, 1, coord, jac);
   
   for (iDim = 0; iDim < nDim; iDim++) Gradient[iDim] = 0.0;
   
   for (iDim = 0; iDim < nDim; iDim++)
     for (jDim = 0; jDim < nDim; jDim++)
-      Gradient[jDim] += GetDerivative2(val_coord, iDim, xyz,  lmn) *
-      GetDerivative3(val_coord, iDim, jDim, lmn);
+      Gradient[jDim] += 2.0*(coord[iDim] - xyz[iDim]) * jac[iDim][jDim];
   
   return Gradient;
   
@@ -8716,43 +9371,24 @@ su2double *CFreeFormDefBox::GetFFDGradient(su2double *val_coord, su2double *xyz)
 
 void CFreeFormDefBox::GetFFDHessian(su2double *uvw, su2double *xyz, su2double **val_Hessian) {
   
-  unsigned short iDim, jDim, lmn[3];
-  
-  /*--- Set the Degree of the spline ---*/
-  
-  lmn[0] = lDegree; lmn[1] = mDegree; lmn[2] = nDegree;
+  unsigned short iDim, jDim, kDim;
+  su2double coord[3], jac[3][3], hess[3][3][3];
   
-  for (iDim = 0; iDim < nDim; iDim++)
-    for (jDim = 0; jDim < nDim; jDim++)
-      val_Hessian[iDim][jDim] = 0.0;
+  /*--- Hessian of F = ||X(u, v, w) - xyz||^2, i.e. 2 dX/du^T dX/du + 2 (X - xyz) d2X/du2.
+   Being all the functions linear combinations of polynomials, they are C^\infty,
+   and the Hessian is symmetric (the mapping returns a symmetric second derivative) ---*/
   
-  /*--- Note that being all the functions linear combinations of polynomials, they are C^\infty,
-   and the Hessian will be symmetric; no need to compute the under-diagonal part, for example ---*/
+  EvalMapping(uvw, 2, coord, jac, hess);
   
-  for (iDim = 0; iDim < nDim; iDim++) {
-    val_Hessian[0][0] += 2.0 * GetDerivative3(uvw, iDim,0, lmn) * GetDerivative3(uvw, iDim,0, lmn) +
-    GetDerivative2(uvw, iDim,xyz, lmn) * GetDerivative5(uvw, iDim,0,0, lmn);
-    
-    val_Hessian[1][1] += 2.0 * GetDerivative3(uvw, iDim,1, lmn) * GetDerivative3(uvw, iDim,1, lmn) +
-    GetDerivative2(uvw, iDim,xyz, lmn) * GetDerivative5(uvw, iDim,1,1, lmn);
-    
-    val_Hessian[2][2] += 2.0 * GetDerivative3(uvw, iDim,2, lmn) * GetDerivative3(uvw, iDim,2, lmn) +
-    GetDerivative2(uvw, iDim,xyz, lmn) * GetDerivative5(uvw, iDim,2,2, lmn);
-    
-    val_Hessian[0][1] += 2.0 * GetDerivative3(uvw, iDim,0, lmn) * GetDerivative3(uvw, iDim,1, lmn) +
-    GetDerivative2(uvw, iDim,xyz, lmn) * GetDerivative5(uvw, iDim,0,1, lmn);
-    
-    val_Hessian[0][2] += 2.0 * GetDerivative3(uvw, iDim,0, lmn) * GetDerivative3(uvw, iDim,2, lmn) +
-    GetDerivative2(uvw, iDim,xyz, lmn) * GetDerivative5(uvw, iDim,0,2, lmn);
-    
-    val_Hessian[1][2] += 2.0 * GetDerivative3(uvw, iDim,1, lmn) * GetDerivative3(uvw, iDim,2, lmn) +
-    GetDerivative2(uvw, iDim,xyz, lmn) * GetDerivative5(uvw, iDim,1,2, lmn);
+  for (jDim = 0; jDim < nDim; jDim++) {
+    for (kDim = 0; kDim < nDim; kDim++) {
+      val_Hessian[jDim][kDim] = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++)
+        val_Hessian[jDim][kDim] += 2.0 * jac[iDim][jDim] * jac[iDim][kDim] +
+                                   2.0 * (coord[iDim] - xyz[iDim]) * hess[iDim][jDim][kDim];
+    }
   }
   
-  val_Hessian[1][0] = val_Hessian[0][1];
-  val_Hessian[2][0] = val_Hessian[0][2];
-  val_Hessian[2][1] = val_Hessian[1][2];
-  
 }
 
 su2double *CFreeFormDefBox::GetParametricCoord_Iterative(unsigned long iPoint, su2double *xyz, su2double *ParamCoordGuess, CConfig *config) {
@@ -9396,12 +10032,10 @@ void CElasticityMovement::UpdateGridCoord(CGeometry *geometry, CConfig *config){
 void CElasticityMovement::UpdateDualGrid(CGeometry *geometry, CConfig *config){
 
   /*--- After moving all nodes, update the dual mesh. Recompute the edges and
-   dual mesh control volumes in the domain and on the boundaries. ---*/
+   dual mesh control volumes in the domain and on the boundaries, only where
+   they depend on displaced nodes. ---*/
 
-  geometry->SetCoord_CG();
-  geometry->SetControlVolume(config, UPDATE);
-  geometry->SetBoundControlVolume(config, UPDATE);
-  geometry->SetMaxLength(config);
+  geometry->UpdateDualGrid(config);
 
 }
 
@@ -9415,9 +10049,7 @@ void CElasticityMovement::UpdateMultiGrid(CGeometry **geometry, CConfig *config)
 
   for (iMGlevel = 1; iMGlevel <= nMGlevel; iMGlevel++) {
     iMGfine = iMGlevel-1;
-    geometry[iMGlevel]->SetControlVolume(config, geometry[iMGfine], UPDATE);
-    geometry[iMGlevel]->SetBoundControlVolume(config, geometry[iMGfine],UPDATE);
-    geometry[iMGlevel]->SetCoord(geometry[iMGfine]);
+    geometry[iMGlevel]->UpdateDualGrid(config, geometry[iMGfine]);
     if (config->GetGrid_Movement())
       geometry[iMGlevel]->SetRestricted_GridVelocity(geometry[iMGfine], config);
   }
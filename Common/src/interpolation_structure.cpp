@@ -25,6 +25,9 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 #include "../include/interpolation_structure.hpp"
+#include "../include/adt_structure.hpp"
+
+#include <unordered_map>
 
 #if defined(HAVE_MKL)
 #include "mkl.h"
@@ -596,36 +599,27 @@ CNearestNeighbor::~CNearestNeighbor() {}
 
 void CNearestNeighbor::Set_TransferCoeff(CConfig **config) {
 
-  int iProcessor, pProcessor, nProcessor = size;
-  int markDonor, markTarget;
-
-  unsigned short nDim, iMarkerInt, nMarkerInt, iDonor;    
+  int markDonor, markTarget, iRank;
 
-  unsigned long nVertexDonor, nVertexTarget, Point_Target, jVertex, iVertexTarget;
-  unsigned long Global_Point_Donor;
-  long pGlobalPoint = 0;
+  unsigned short nDim, iDim, iMarkerInt, nMarkerInt;
 
-  su2double *Coord_i, *Coord_j, dist, mindist, maxdist;
+  unsigned long nVertexDonor, nVertexTarget, iVertex, iPoint, iTarget;
 
   /*--- Initialize variables --- */
-  
+
   nMarkerInt = (int) ( config[donorZone]->GetMarker_n_ZoneInterface() / 2 );
-  
-  nDim = donor_geometry->GetnDim();
 
-  iDonor = 0;
-  
-  Buffer_Receive_nVertex_Donor = new unsigned long [nProcessor];
+  nDim = donor_geometry->GetnDim();
 
+  const unsigned short nBBox = 2*nDim;
 
   /*--- Cycle over nMarkersInt interface to determine communication pattern ---*/
 
   for (iMarkerInt = 1; iMarkerInt <= nMarkerInt; iMarkerInt++) {
 
-
     /*--- On the donor side: find the tag of the boundary sharing the interface ---*/
     markDonor  = Find_InterfaceMarker(config[donorZone],  iMarkerInt);
-      
+
     /*--- On the target side: find the tag of the boundary sharing the interface ---*/
     markTarget = Find_InterfaceMarker(config[targetZone], iMarkerInt);
 
@@ -637,85 +631,195 @@ void CNearestNeighbor::Set_TransferCoeff(CConfig **config) {
       nVertexDonor  = donor_geometry->GetnVertex( markDonor );
     else
       nVertexDonor  = 0;
-    
+
     if(markTarget != -1)
       nVertexTarget = target_geometry->GetnVertex( markTarget );
     else
       nVertexTarget  = 0;
-    
-    Buffer_Send_nVertex_Donor  = new unsigned long [ 1 ];
 
-    /* Sets MaxLocalVertex_Donor, Buffer_Receive_nVertex_Donor */
-    Determine_ArraySize(false, markDonor, markTarget, nVertexDonor, nDim);
+    /*--- Search tree of the (owned) donor vertices of this rank, identified by their global index,
+     *    instead of gathering the donor vertices of all ranks. ---*/
 
-    Buffer_Send_Coord          = new su2double     [ MaxLocalVertex_Donor * nDim ];
-    Buffer_Send_GlobalPoint    = new long [ MaxLocalVertex_Donor ];
-    Buffer_Receive_Coord       = new su2double     [ nProcessor * MaxLocalVertex_Donor * nDim ];
-    Buffer_Receive_GlobalPoint = new long [ nProcessor * MaxLocalVertex_Donor ];
+    vector<su2double> donorCoord, myBBox(nBBox), allBBox(nBBox*size);
+    vector<unsigned long> donorPoint;
 
-    /*-- Collect coordinates, global points, and normal vectors ---*/
-    Collect_VertexInfo( false, markDonor, markTarget, nVertexDonor, nDim );
+    for (iVertex = 0; iVertex < nVertexDonor; iVertex++) {
+      iPoint = donor_geometry->vertex[markDonor][iVertex]->GetNode();
+      if (donor_geometry->node[iPoint]->GetDomain()) {
+        donorPoint.push_back(donor_geometry->node[iPoint]->GetGlobalIndex());
+        for (iDim = 0; iDim < nDim; iDim++)
+          donorCoord.push_back(donor_geometry->node[iPoint]->GetCoord(iDim));
+      }
+    }
 
-    /*--- Compute the closest point to a Near-Field boundary point ---*/
-    maxdist = 0.0;
+    const unsigned long nLocalDonor = donorPoint.size();
 
-    for (iVertexTarget = 0; iVertexTarget < nVertexTarget; iVertexTarget++) {
+    CADTPointsOnlyClass DonorADT(nDim, nLocalDonor, donorCoord.data(), donorPoint.data(), false);
 
-      Point_Target = target_geometry->vertex[markTarget][iVertexTarget]->GetNode();
+    /*--- Gather the bounding boxes of the donors of all ranks, empty boxes
+     *    (min larger than max) mark the ranks without donor vertices. ---*/
 
-      if ( target_geometry->node[Point_Target]->GetDomain() ) {
+    for (iDim = 0; iDim < nDim; iDim++) {
+      myBBox[iDim] = 1.0; myBBox[nDim+iDim] = -1.0;
+    }
+    for (unsigned long iDonor = 0; iDonor < nLocalDonor; iDonor++) {
+      for (iDim = 0; iDim < nDim; iDim++) {
+        const su2double coor = donorCoord[iDonor*nDim+iDim];
+        if (iDonor == 0) { myBBox[iDim] = coor; myBBox[nDim+iDim] = coor; }
+        myBBox[iDim] = min(myBBox[iDim], coor);
+        myBBox[nDim+iDim] = max(myBBox[nDim+iDim], coor);
+      }
+    }
+    vector<su2double>().swap(donorCoord);
 
-        target_geometry->vertex[markTarget][iVertexTarget]->SetnDonorPoints(1);
-        target_geometry->vertex[markTarget][iVertexTarget]->Allocate_DonorInfo(); // Possible meme leak?
+    SU2_MPI::Allgather(myBBox.data(), nBBox, MPI_DOUBLE, allBBox.data(), nBBox, MPI_DOUBLE, MPI_COMM_WORLD);
 
-        /*--- Coordinates of the boundary point ---*/
-        Coord_i = target_geometry->node[Point_Target]->GetCoord();
+    vector<int> donorRanks;
+    for (iRank = 0; iRank < size; iRank++)
+      if ((iRank != rank) && (allBBox[iRank*nBBox] <= allBBox[iRank*nBBox+nDim]))
+        donorRanks.push_back(iRank);
 
-        mindist    = 1E6; 
-        pProcessor = 0;
+    /*--- Possible (minimum) and guaranteed (maximum) distance squared from a
+     *    point to the donors inside a bounding box. ---*/
 
-        /*--- Loop over all the boundaries to find the pair ---*/
+    auto possibleDist2 = [&](const su2double *coor, const su2double *bbox) {
+      su2double dist2 = 0.0;
+      for (unsigned short k = 0; k < nDim; k++) {
+        su2double ds = 0.0;
+        if (coor[k] < bbox[k])           ds = coor[k] - bbox[k];
+        else if (coor[k] > bbox[nDim+k]) ds = coor[k] - bbox[nDim+k];
+        dist2 += ds*ds;
+      }
+      return dist2;
+    };
+
+    auto guaranteedDist2 = [&](const su2double *coor, const su2double *bbox) {
+      su2double dist2 = 0.0;
+      for (unsigned short k = 0; k < nDim; k++) {
+        const su2double ds = max(fabs(coor[k] - bbox[k]), fabs(coor[k] - bbox[nDim+k]));
+        dist2 += ds*ds;
+      }
+      return dist2;
+    };
 
-        for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
-          for (jVertex = 0; jVertex < MaxLocalVertex_Donor; jVertex++) {
-           
-            Global_Point_Donor = iProcessor*MaxLocalVertex_Donor+jVertex;
-            
-            if (Buffer_Receive_GlobalPoint[Global_Point_Donor] != -1){
-              
-              Coord_j = &Buffer_Receive_Coord[ Global_Point_Donor*nDim];
-              
-              dist = PointsDistance(Coord_i, Coord_j);
-              
-              if (dist < mindist) {
-                mindist = dist; pProcessor = iProcessor; 
-                pGlobalPoint = Buffer_Receive_GlobalPoint[Global_Point_Donor];                
-              }
-              
-              if (dist == 0.0) break;
-            }
-          }
-        }
+    /*--- Nearest local donor of the owned target vertices, and list of the targets to send to
+     *    the ranks whose donors may be closer (as for the distributed wall distance). ---*/
+
+    vector<unsigned long> targetVertex;
+    for (iVertex = 0; iVertex < nVertexTarget; iVertex++) {
+      iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
+      if (target_geometry->node[iPoint]->GetDomain()) targetVertex.push_back(iVertex);
+    }
+
+    const unsigned long nTarget = targetVertex.size();
+
+    vector<su2double> bestDist(nTarget, 0.0);
+    vector<long> bestPoint(nTarget, 0);
+    vector<int> bestRank(nTarget, 0);
+    vector<vector<unsigned long> > sendTargets(size);
 
-        /*--- Store the value of the pair ---*/
-        maxdist = max(maxdist, mindist);
-        target_geometry->vertex[markTarget][iVertexTarget]->SetInterpDonorPoint(iDonor, pGlobalPoint);
-        target_geometry->vertex[markTarget][iVertexTarget]->SetInterpDonorProcessor(iDonor, pProcessor);
-        target_geometry->vertex[markTarget][iVertexTarget]->SetDonorCoeff(iDonor, 1.0);
+    for (iTarget = 0; iTarget < nTarget; iTarget++) {
+      iPoint = target_geometry->vertex[markTarget][targetVertex[iTarget]]->GetNode();
+      const su2double *coor = target_geometry->node[iPoint]->GetCoord();
+
+      su2double upperDist2 = numeric_limits<passivedouble>::max();
+      bestDist[iTarget] = upperDist2;
+
+      if (nLocalDonor > 0) {
+        unsigned long pointID;
+        int rankID;
+        DonorADT.DetermineNearestNode(coor, bestDist[iTarget], pointID, rankID);
+        bestPoint[iTarget] = pointID;
+        bestRank[iTarget] = rank;
+        upperDist2 = bestDist[iTarget]*bestDist[iTarget];
       }
+
+      for (const auto jRank : donorRanks)
+        upperDist2 = min(upperDist2, guaranteedDist2(coor, &allBBox[jRank*nBBox]));
+
+      for (const auto jRank : donorRanks)
+        if (possibleDist2(coor, &allBBox[jRank*nBBox]) <= upperDist2)
+          sendTargets[jRank].push_back(iTarget);
     }
 
-    delete[] Buffer_Send_Coord;
-    delete[] Buffer_Send_GlobalPoint;
-    
-    delete[] Buffer_Receive_Coord;
-    delete[] Buffer_Receive_GlobalPoint;
+    /*--- Exchange the coordinates of the targets with the ranks whose donors must be searched. ---*/
 
-    delete[] Buffer_Send_nVertex_Donor;
+    vector<int> nSend(size), nRecv(size), sendDispl(size+1, 0), recvDispl(size+1, 0);
 
-  }
+    for (iRank = 0; iRank < size; iRank++) nSend[iRank] = sendTargets[iRank].size();
 
-  delete[] Buffer_Receive_nVertex_Donor;
+    SU2_MPI::Alltoall(nSend.data(), 1, MPI_INT, nRecv.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+    for (iRank = 0; iRank < size; iRank++) {
+      sendDispl[iRank+1] = sendDispl[iRank] + nSend[iRank];
+      recvDispl[iRank+1] = recvDispl[iRank] + nRecv[iRank];
+    }
+
+    vector<su2double> sendCoor(sendDispl[size]*nDim), recvCoor(recvDispl[size]*nDim);
+
+    for (iRank = 0; iRank < size; iRank++) {
+      for (unsigned long j = 0; j < sendTargets[iRank].size(); j++) {
+        iPoint = target_geometry->vertex[markTarget][targetVertex[sendTargets[iRank][j]]]->GetNode();
+        for (iDim = 0; iDim < nDim; iDim++)
+          sendCoor[(sendDispl[iRank]+j)*nDim+iDim] = target_geometry->node[iPoint]->GetCoord(iDim);
+      }
+    }
+
+    {
+      /*--- The counts and displacements of the coordinates include the dimension. ---*/
+      vector<int> nSendCoor(size), nRecvCoor(size), sendDisplCoor(size), recvDisplCoor(size);
+      for (iRank = 0; iRank < size; iRank++) {
+        nSendCoor[iRank] = nSend[iRank]*nDim;  sendDisplCoor[iRank] = sendDispl[iRank]*nDim;
+        nRecvCoor[iRank] = nRecv[iRank]*nDim;  recvDisplCoor[iRank] = recvDispl[iRank]*nDim;
+      }
+      SU2_MPI::Alltoallv(sendCoor.data(), nSendCoor.data(), sendDisplCoor.data(), MPI_DOUBLE,
+                         recvCoor.data(), nRecvCoor.data(), recvDisplCoor.data(), MPI_DOUBLE,
+                         MPI_COMM_WORLD);
+    }
+    vector<su2double>().swap(sendCoor);
+
+    /*--- Nearest local donor of the received targets, returned to their ranks. ---*/
+
+    vector<su2double> recvDist(recvDispl[size]), sendDist(sendDispl[size]);
+    vector<long> recvPoint(recvDispl[size]), sendPoint(sendDispl[size]);
+
+    for (int j = 0; j < recvDispl[size]; j++) {
+      unsigned long pointID;
+      int rankID;
+      DonorADT.DetermineNearestNode(&recvCoor[j*nDim], recvDist[j], pointID, rankID);
+      recvPoint[j] = pointID;
+    }
+
+    SU2_MPI::Alltoallv(recvDist.data(), nRecv.data(), recvDispl.data(), MPI_DOUBLE,
+                       sendDist.data(), nSend.data(), sendDispl.data(), MPI_DOUBLE, MPI_COMM_WORLD);
+    SU2_MPI::Alltoallv(recvPoint.data(), nRecv.data(), recvDispl.data(), MPI_LONG,
+                       sendPoint.data(), nSend.data(), sendDispl.data(), MPI_LONG, MPI_COMM_WORLD);
+
+    /*--- The donor is the nearest over the searched ranks, the lowest rank for equal distances. ---*/
+
+    for (iRank = 0; iRank < size; iRank++) {
+      for (unsigned long j = 0; j < sendTargets[iRank].size(); j++) {
+        iTarget = sendTargets[iRank][j];
+        const su2double dist = sendDist[sendDispl[iRank]+j];
+        if ((dist < bestDist[iTarget]) || ((dist == bestDist[iTarget]) && (iRank < bestRank[iTarget]))) {
+          bestDist[iTarget] = dist;
+          bestPoint[iTarget] = sendPoint[sendDispl[iRank]+j];
+          bestRank[iTarget] = iRank;
+        }
+      }
+    }
+
+    /*--- Store the value of the pair ---*/
+
+    for (iTarget = 0; iTarget < nTarget; iTarget++) {
+      CVertex *vertex = target_geometry->vertex[markTarget][targetVertex[iTarget]];
+      vertex->SetnDonorPoints(1);
+      vertex->Allocate_DonorInfo();
+      vertex->SetInterpDonorPoint(0, bestPoint[iTarget]);
+      vertex->SetInterpDonorProcessor(0, bestRank[iTarget]);
+      vertex->SetDonorCoeff(0, 1.0);
+    }
+  }
 }
 
 
@@ -849,6 +953,12 @@ void CIsoparametric::Set_TransferCoeff(CConfig **config) {
 
     if (nDim==2) nNodes=2;
 
+    /*--- Position of the gathered donor vertices from their global index (the last match). ---*/
+    unordered_map<long, unsigned long> globalToBuffer;
+    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++)
+      for (jVertex = 0; jVertex < Buffer_Receive_nVertex_Donor[iProcessor]; jVertex++)
+        globalToBuffer[Buffer_Receive_GlobalPoint[MaxLocalVertex_Donor*iProcessor+jVertex]] = MaxLocalVertex_Donor*iProcessor+jVertex;
+
     for (iVertexDonor = 0; iVertexDonor < nVertexDonor; iVertexDonor++) {
       iPointDonor = donor_geometry->vertex[markDonor][iVertexDonor]->GetNode();
 
@@ -876,14 +986,10 @@ void CIsoparametric::Set_TransferCoeff(CConfig **config) {
               inode = donor_geometry->elem[temp_donor]->GetFaces(iFace, iDonor);
               dPoint = donor_geometry->elem[temp_donor]->GetNode(inode);
               // Match node on the face to the correct global index
-              long jGlobalPoint = donor_geometry->node[dPoint]->GetGlobalIndex();
-              for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
-                for (jVertex = 0; jVertex < Buffer_Receive_nVertex_Donor[iProcessor]; jVertex++) {
-                  if (jGlobalPoint == Buffer_Receive_GlobalPoint[MaxLocalVertex_Donor*iProcessor+jVertex]) {
-                    Buffer_Send_FaceNodes[nLocalFaceNodes_Donor]=MaxLocalVertex_Donor*iProcessor+jVertex;
-                    Buffer_Send_FaceProc[nLocalFaceNodes_Donor]=iProcessor;
-                  }
-                }
+              const auto match = globalToBuffer.find(donor_geometry->node[dPoint]->GetGlobalIndex());
+              if (match != globalToBuffer.end()) {
+                Buffer_Send_FaceNodes[nLocalFaceNodes_Donor]=match->second;
+                Buffer_Send_FaceProc[nLocalFaceNodes_Donor]=match->second/MaxLocalVertex_Donor;
               }
               nLocalFaceNodes_Donor++; // Increment total number of face-nodes / processor
             }
@@ -906,14 +1012,10 @@ void CIsoparametric::Set_TransferCoeff(CConfig **config) {
             inode = donor_geometry->node[iPointDonor]->GetEdge(jElem);
             dPoint = donor_geometry->edge[inode]->GetNode(iDonor);
             // Match node on the face to the correct global index
-            long jGlobalPoint = donor_geometry->node[dPoint]->GetGlobalIndex();
-            for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
-              for (jVertex = 0; jVertex < Buffer_Receive_nVertex_Donor[iProcessor]; jVertex++) {
-                if (jGlobalPoint == Buffer_Receive_GlobalPoint[MaxLocalVertex_Donor*iProcessor+jVertex]) {
-                  Buffer_Send_FaceNodes[nLocalFaceNodes_Donor]=MaxLocalVertex_Donor*iProcessor+jVertex;
-                  Buffer_Send_FaceProc[nLocalFaceNodes_Donor]=iProcessor;
-                }
-              }
+            const auto match = globalToBuffer.find(donor_geometry->node[dPoint]->GetGlobalIndex());
+            if (match != globalToBuffer.end()) {
+              Buffer_Send_FaceNodes[nLocalFaceNodes_Donor]=match->second;
+              Buffer_Send_FaceProc[nLocalFaceNodes_Donor]=match->second/MaxLocalVertex_Donor;
             }
             nLocalFaceNodes_Donor++; // Increment total number of face-nodes / processor
           }
@@ -941,6 +1043,30 @@ void CIsoparametric::Set_TransferCoeff(CConfig **config) {
       Buffer_Receive_FaceProc[iVertex] = Buffer_Send_FaceProc[iVertex];
 #endif
 
+    /*--- Search tree of the gathered donor faces, the target points are only projected
+     *    on the nearest face, instead of on every face of every rank. ---*/
+    vector<su2double> faceTreeCoord(Buffer_Receive_Coord, Buffer_Receive_Coord+nProcessor*MaxLocalVertex_Donor*nDim);
+    vector<unsigned long> faceTreeConn, faceTreeElem, faceStart;
+    vector<unsigned short> faceTreeVTK, faceTreeMarker, faceNodes;
+
+    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
+      for (iFace = 0; iFace < Buffer_Receive_nFace_Donor[iProcessor]; iFace++) {
+        faceindex = Buffer_Receive_FaceIndex[iProcessor*MaxFace_Donor+iFace];
+        nNodes = Buffer_Receive_FaceIndex[iProcessor*MaxFace_Donor+iFace+1] - faceindex;
+        if (nNodes == 2)      faceTreeVTK.push_back(LINE);
+        else if (nNodes == 3) faceTreeVTK.push_back(TRIANGLE);
+        else                  faceTreeVTK.push_back(QUADRILATERAL);
+        for (iDonor = 0; iDonor < nNodes; iDonor++)
+          faceTreeConn.push_back(Buffer_Receive_FaceNodes[faceindex+iDonor]);
+        faceTreeMarker.push_back(0);
+        faceTreeElem.push_back(faceStart.size());
+        faceStart.push_back(faceindex);
+        faceNodes.push_back(nNodes);
+      }
+    }
+
+    CADTElemClass FaceADT(nDim, faceTreeCoord, faceTreeConn, faceTreeVTK, faceTreeMarker, faceTreeElem, false);
+
     /*--- Loop over the vertices on the target Marker ---*/
     for (iVertex = 0; iVertex<nVertexTarget; iVertex++) {
       mindist=1E6;
@@ -952,19 +1078,19 @@ void CIsoparametric::Set_TransferCoeff(CConfig **config) {
       if (target_geometry->node[Point_Target]->GetDomain()) {
 
     Coord_i = target_geometry->node[Point_Target]->GetCoord();
-    /*---Loop over the faces previously communicated/stored ---*/
-    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
-
-      nFaces = (unsigned int)Buffer_Receive_nFace_Donor[iProcessor];
+    /*---Nearest of the faces previously communicated/stored ---*/
+    if (!FaceADT.IsEmpty()) {
 
-      for (iFace = 0; iFace< nFaces; iFace++) {
-        /*--- ---*/
+      unsigned short markerID;
+      unsigned long nearestFace;
+      int rankID;
+      FaceADT.DetermineNearestElement(Coord_i, dist, markerID, nearestFace, rankID);
 
-        nNodes = (unsigned int)Buffer_Receive_FaceIndex[iProcessor*MaxFace_Donor+iFace+1] -
-                (unsigned int)Buffer_Receive_FaceIndex[iProcessor*MaxFace_Donor+iFace];
+      {
+        faceindex = faceStart[nearestFace]; // first index of this face
+        nNodes = faceNodes[nearestFace];
 
         su2double *X = new su2double[nNodes*(nDim+1)];
-        faceindex = Buffer_Receive_FaceIndex[iProcessor*MaxFace_Donor+iFace]; // first index of this face
         for (iDonor=0; iDonor<nNodes; iDonor++) {
           jVertex = Buffer_Receive_FaceNodes[iDonor+faceindex]; // index which points to the stored coordinates, global points
           for (iDim=0; iDim<nDim; iDim++) {
@@ -1509,80 +1635,37 @@ void CSlidingMesh::Set_TransferCoeff(CConfig **config){
 
   /*  0 - Variable declaration - */
 
-  /* --- General variables --- */
-
-  bool check;
-  
-  unsigned short iDim, nDim;
-  
-  unsigned long ii, jj, *uptr;
-  unsigned long vPoint;
-  unsigned long iEdgeVisited, nEdgeVisited, iNodeVisited;
-  unsigned long nAlreadyVisited, nToVisit, StartVisited;
-  
-  unsigned long *alreadyVisitedDonor, *ToVisit, *tmpVect;
-  unsigned long *storeProc, *tmp_storeProc;
-
-  su2double dTMP;
-  su2double *Coeff_Vect, *tmp_Coeff_Vect;               
-
-  /* --- Geometrical variables --- */
-
-  su2double *Coord_i, *Coord_j, dist, mindist, *Normal;
-  su2double Area, Area_old, tmp_Area;
-  su2double LineIntersectionLength, *Direction, length;
-
+  unsigned short nDim;
 
   /* --- Markers Variables --- */
 
   unsigned short iMarkerInt, nMarkerInt; 
 
-  unsigned long iVertex, nVertexTarget;
+  unsigned long nVertexTarget;
 
   int markDonor, markTarget;
 
   /* --- Target variables --- */
 
-  unsigned long target_iPoint, jVertexTarget;
-  unsigned long nEdges_target, nNode_target;
-
-  unsigned long *Target_nLinkedNodes, *Target_LinkedNodes, *Target_StartLinkedNodes, *target_segment;
+  unsigned long *Target_nLinkedNodes, *Target_LinkedNodes, *Target_StartLinkedNodes;
   unsigned long  *Target_Proc;  
   long *Target_GlobalPoint, *Donor_GlobalPoint;
   
-  su2double *TargetPoint_Coord, *target_iMidEdge_point, *target_jMidEdge_point, **target_element;
+  su2double *TargetPoint_Coord;
 
   /* --- Donor variables --- */
 
-  unsigned long donor_StartIndex, donor_forward_point, donor_backward_point, donor_iPoint, donor_OldiPoint; 
-  unsigned long nEdges_donor, nNode_donor, nGlobalVertex_Donor; 
+  unsigned long nGlobalVertex_Donor; 
 
-  unsigned long nDonorPoints, iDonor;
-  unsigned long *Donor_Vect, *tmp_Donor_Vect;
   unsigned long *Donor_nLinkedNodes, *Donor_LinkedNodes, *Donor_StartLinkedNodes;
   unsigned long *Donor_Proc;
   
-  su2double *donor_iMidEdge_point, *donor_jMidEdge_point;
-  su2double **donor_element, *DonorPoint_Coord;
+  su2double *DonorPoint_Coord;
     
   /*  1 - Variable pre-processing - */
 
   nDim = donor_geometry->GetnDim();
 
-  /*--- Setting up auxiliary vectors ---*/
-
-  Donor_Vect = NULL;
-  Coeff_Vect = NULL;
-  storeProc  = NULL;
-
-  tmp_Donor_Vect = NULL;
-  tmp_Coeff_Vect = NULL;
-  tmp_storeProc  = NULL;
-  
-  Normal    = new su2double[nDim];
-  Direction = new su2double[nDim];
-    
-    
   /* 2 - Find boundary tag between touching grids */
 
   /*--- Number of markers on the FSI interface ---*/
@@ -1634,537 +1717,381 @@ void CSlidingMesh::Set_TransferCoeff(CConfig **config){
     Donor_LinkedNodes      = Buffer_Receive_LinkedNodes;
     Donor_Proc             = Buffer_Receive_Proc;
 
+    /*--- Position of the target points in the reconstructed target boundary ---*/
+
+    unordered_map<long, unsigned long> targetPosition;
+    targetPosition.reserve(nGlobalVertex_Target);
+    for (unsigned long jVertexTarget = 0; jVertexTarget < nGlobalVertex_Target; jVertexTarget++)
+      targetPosition.insert(make_pair(Target_GlobalPoint[jVertexTarget], jVertexTarget));
+
+    /*--- The closest donor node of each target node is found with a (local) tree of the
+     reconstructed donor boundary, which is rebuilt at every call as the boundaries move ---*/
+
+    vector<unsigned long> donorID(nGlobalVertex_Donor);
+    for (unsigned long iPoint = 0; iPoint < nGlobalVertex_Donor; iPoint++) donorID[iPoint] = iPoint;
+
+    CADTPointsOnlyClass donorADT(nDim, nGlobalVertex_Donor, DonorPoint_Coord, donorID.data(), false);
+
     /*--- Starts building the supermesh layer (2D or 3D) ---*/
     /* - For each target node, it first finds the closest donor point
      * - Then it creates the supermesh in the close proximity of the target point:
      * - Starting from the closest donor node, it expands the supermesh by including 
      * donor elements neighboring the initial one, until the overall target area is fully covered.
+     * - The target nodes are independent, they are distributed over the threads.
      */
 
-    if(nDim == 2){
-        
-      target_iMidEdge_point = new su2double[nDim];
-      target_jMidEdge_point = new su2double[nDim];
+    SU2_OMP_PARALLEL
+    {
 
-      donor_iMidEdge_point = new su2double[nDim];
-      donor_jMidEdge_point = new su2double[nDim];
-        
-      /*--- Starts with supermesh reconstruction ---*/
+    /* --- General variables --- */
 
-      target_segment = new unsigned long[2];
-      
-      for (iVertex = 0; iVertex < nVertexTarget; iVertex++) {
+    bool check;
+    unsigned short iDim;
+    unsigned long ii, jj, *uptr;
+    unsigned long vPoint, iEdgeVisited, nEdgeVisited, iNodeVisited, StartVisited;
+    unsigned long target_iPoint, jVertexTarget, nEdges_target, nNode_target, target_segment[2];
+    unsigned long donor_StartIndex, donor_forward_point, donor_backward_point, donor_iPoint, donor_OldiPoint;
+    unsigned long nEdges_donor, nNode_donor, nDonorPoints, iDonor;
+    int rankID;
 
-        nDonorPoints = 0;
+    su2double dTMP, *Coord_i, mindist, Normal[3], Direction[3];
+    su2double Area, Area_old, tmp_Area, LineIntersectionLength, length;
+    su2double target_iMidEdge_point[3], target_jMidEdge_point[3], donor_iMidEdge_point[3], donor_jMidEdge_point[3];
+    su2double **target_element, **donor_element;
 
-        /*--- Stores coordinates of the target node ---*/
+    vector<unsigned long> Donor_Vect, storeProc, alreadyVisitedDonor, ToVisit;
+    vector<su2double> Coeff_Vect;
 
-        target_iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
+    SU2_OMP_FOR_DYN(64)
+    for (unsigned long iVertex = 0; iVertex < nVertexTarget; iVertex++) {
 
-        if (target_geometry->node[target_iPoint]->GetDomain()){
+      /*--- Stores coordinates of the target node ---*/
 
-          Coord_i = target_geometry->node[target_iPoint]->GetCoord();
+      target_iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
 
-          /*--- Brute force to find the closest donor_node ---*/
+      if (!target_geometry->node[target_iPoint]->GetDomain()) continue;
 
-          mindist = 1E6;
-          donor_StartIndex = 0;
- 
-          for (donor_iPoint = 0; donor_iPoint < nGlobalVertex_Donor; donor_iPoint++) {
-        
-            Coord_j = &DonorPoint_Coord[ donor_iPoint * nDim ];
+      Coord_i = target_geometry->node[target_iPoint]->GetCoord();
 
-            dist = PointsDistance(Coord_i, Coord_j);
+      /*--- Find the closest donor_node ---*/
 
-            if (dist < mindist) {
-              mindist = dist;  
-              donor_StartIndex = donor_iPoint;
-            }
+      donorADT.DetermineNearestNode(Coord_i, mindist, donor_StartIndex, rankID);
 
-            if (dist == 0.0){
-              donor_StartIndex = donor_iPoint;
-              break;
-            }    
-          }
+      /*--- Contruct information regarding the target cell ---*/
 
-          donor_iPoint    = donor_StartIndex;
-          donor_OldiPoint = donor_iPoint;
-          
-          /*--- Contruct information regarding the target cell ---*/
-          
-          long dPoint = target_geometry->node[target_iPoint]->GetGlobalIndex();
-          for (jVertexTarget = 0; jVertexTarget < nGlobalVertex_Target; jVertexTarget++)
-            if( dPoint == Target_GlobalPoint[jVertexTarget] )
-              break;
-            
-          if ( Target_nLinkedNodes[jVertexTarget] == 1 ){
-            target_segment[0] = Target_LinkedNodes[ Target_StartLinkedNodes[jVertexTarget] ];
-            target_segment[1] = jVertexTarget;
-          }
-          else{
-            target_segment[0] = Target_LinkedNodes[ Target_StartLinkedNodes[jVertexTarget] ];
-            target_segment[1] = Target_LinkedNodes[ Target_StartLinkedNodes[jVertexTarget] + 1];
-          }
-      
-          dTMP = 0;
-          for(iDim = 0; iDim < nDim; iDim++){
-            target_iMidEdge_point[iDim] = ( TargetPoint_Coord[ nDim * target_segment[0] + iDim ] + target_geometry->node[ target_iPoint ]->GetCoord(iDim) ) / 2;
-            target_jMidEdge_point[iDim] = ( TargetPoint_Coord[ nDim * target_segment[1] + iDim ] + target_geometry->node[ target_iPoint ]->GetCoord(iDim) ) / 2;
+      jVertexTarget = targetPosition.find(target_geometry->node[target_iPoint]->GetGlobalIndex())->second;
 
-            Direction[iDim] = target_jMidEdge_point[iDim] - target_iMidEdge_point[iDim];
-            dTMP += Direction[iDim] * Direction[iDim];
-          }
+      Donor_Vect.clear();
+      Coeff_Vect.clear();
+      storeProc.clear();
 
-          dTMP = sqrt(dTMP);
-          for(iDim = 0; iDim < nDim; iDim++)
-            Direction[iDim] /= dTMP;
+      if(nDim == 2){
 
-          length = PointsDistance(target_iMidEdge_point, target_jMidEdge_point);
+        nDonorPoints = 0;
 
-          check = false;
+        donor_iPoint    = donor_StartIndex;
+        donor_OldiPoint = donor_iPoint;
 
-          /*--- Proceeds along the forward direction (depending on which connected boundary node is found first) ---*/
+        if ( Target_nLinkedNodes[jVertexTarget] == 1 ){
+          target_segment[0] = Target_LinkedNodes[ Target_StartLinkedNodes[jVertexTarget] ];
+          target_segment[1] = jVertexTarget;
+        }
+        else{
+          target_segment[0] = Target_LinkedNodes[ Target_StartLinkedNodes[jVertexTarget] ];
+          target_segment[1] = Target_LinkedNodes[ Target_StartLinkedNodes[jVertexTarget] + 1];
+        }
 
-          while( !check ){
-  
-            /*--- Proceeds until the value of the intersection area is null ---*/
+        dTMP = 0;
+        for(iDim = 0; iDim < nDim; iDim++){
+          target_iMidEdge_point[iDim] = ( TargetPoint_Coord[ nDim * target_segment[0] + iDim ] + target_geometry->node[ target_iPoint ]->GetCoord(iDim) ) / 2;
+          target_jMidEdge_point[iDim] = ( TargetPoint_Coord[ nDim * target_segment[1] + iDim ] + target_geometry->node[ target_iPoint ]->GetCoord(iDim) ) / 2;
 
-            if ( Donor_nLinkedNodes[donor_iPoint] == 1 ){
-              donor_forward_point  = Donor_LinkedNodes[ Donor_StartLinkedNodes[donor_iPoint] ];
-              donor_backward_point = donor_iPoint;
-            }
-            else{
-              uptr = &Donor_LinkedNodes[ Donor_StartLinkedNodes[donor_iPoint] ];
-              
-              if( donor_OldiPoint != uptr[0] ){
-                donor_forward_point  = uptr[0];
-                donor_backward_point = uptr[1];
-              }
-              else{
-                donor_forward_point  = uptr[1];
-                donor_backward_point = uptr[0];
-              }
-            }
-            
-            if(donor_iPoint >= nGlobalVertex_Donor){
-              check = true;
-              continue;
-            }
-            
-            for(iDim = 0; iDim < nDim; iDim++){
-              donor_iMidEdge_point[iDim] = ( DonorPoint_Coord[ donor_forward_point  * nDim + iDim] + DonorPoint_Coord[ donor_iPoint * nDim + iDim] ) / 2;
-              donor_jMidEdge_point[iDim] = ( DonorPoint_Coord[ donor_backward_point * nDim + iDim] + DonorPoint_Coord[ donor_iPoint * nDim + iDim] ) / 2;
-            }
+          Direction[iDim] = target_jMidEdge_point[iDim] - target_iMidEdge_point[iDim];
+          dTMP += Direction[iDim] * Direction[iDim];
+        }
 
-            LineIntersectionLength = ComputeLineIntersectionLength(target_iMidEdge_point, target_jMidEdge_point, donor_iMidEdge_point, donor_jMidEdge_point, Direction);
+        dTMP = sqrt(dTMP);
+        for(iDim = 0; iDim < nDim; iDim++)
+          Direction[iDim] /= dTMP;
 
-            if ( LineIntersectionLength == 0.0 ){
-              check = true;
-              continue;
-            }
-  
-            /*--- In case the element intersects the target cell, update the auxiliary communication data structure ---*/
+        length = PointsDistance(target_iMidEdge_point, target_jMidEdge_point);
 
-            tmp_Coeff_Vect = new     su2double[ nDonorPoints + 1 ];
-            tmp_Donor_Vect = new unsigned long[ nDonorPoints + 1 ];
-            tmp_storeProc  = new unsigned long[ nDonorPoints + 1 ];
- 
-            for( iDonor = 0; iDonor < nDonorPoints; iDonor++){
-              tmp_Donor_Vect[iDonor] = Donor_Vect[iDonor];
-              tmp_Coeff_Vect[iDonor] = Coeff_Vect[iDonor];
-              tmp_storeProc[iDonor]  = storeProc[iDonor];
-            }
+        check = false;
 
-            tmp_Donor_Vect[ nDonorPoints ] = donor_iPoint;
-            tmp_Coeff_Vect[ nDonorPoints ] = LineIntersectionLength / length;
-            tmp_storeProc[  nDonorPoints ] = Donor_Proc[donor_iPoint];
-            
-            if (Donor_Vect != NULL) delete [] Donor_Vect;  
-            if (Coeff_Vect != NULL) delete [] Coeff_Vect;            
-            if (storeProc  != NULL) delete [] storeProc;
+        /*--- Proceeds along the forward direction (depending on which connected boundary node is found first) ---*/
 
-            Donor_Vect = tmp_Donor_Vect;
-            Coeff_Vect = tmp_Coeff_Vect;
-            storeProc  = tmp_storeProc;
+        while( !check ){
 
-            donor_OldiPoint = donor_iPoint;
-            donor_iPoint    = donor_forward_point;
+          /*--- Proceeds until the value of the intersection area is null ---*/
 
-            nDonorPoints++;
+          if ( Donor_nLinkedNodes[donor_iPoint] == 1 ){
+            donor_forward_point  = Donor_LinkedNodes[ Donor_StartLinkedNodes[donor_iPoint] ];
+            donor_backward_point = donor_iPoint;
           }
-             
-          if ( Donor_nLinkedNodes[donor_StartIndex] == 2 ){
-            check = false;
-           
-            uptr = &Donor_LinkedNodes[ Donor_StartLinkedNodes[donor_StartIndex] ];
-
-            donor_iPoint = uptr[1];
-            donor_OldiPoint = donor_StartIndex;
+          else{
+            uptr = &Donor_LinkedNodes[ Donor_StartLinkedNodes[donor_iPoint] ];
+
+            if( donor_OldiPoint != uptr[0] ){
+              donor_forward_point  = uptr[0];
+              donor_backward_point = uptr[1];
+            }
+            else{
+              donor_forward_point  = uptr[1];
+              donor_backward_point = uptr[0];
+            }
           }
-          else
+
+          if(donor_iPoint >= nGlobalVertex_Donor){
             check = true;
+            continue;
+          }
 
-          /*--- Proceeds along the backward direction (depending on which connected boundary node is found first) ---*/
+          for(iDim = 0; iDim < nDim; iDim++){
+            donor_iMidEdge_point[iDim] = ( DonorPoint_Coord[ donor_forward_point  * nDim + iDim] + DonorPoint_Coord[ donor_iPoint * nDim + iDim] ) / 2;
+            donor_jMidEdge_point[iDim] = ( DonorPoint_Coord[ donor_backward_point * nDim + iDim] + DonorPoint_Coord[ donor_iPoint * nDim + iDim] ) / 2;
+          }
 
-          while( !check ){
+          LineIntersectionLength = ComputeLineIntersectionLength(target_iMidEdge_point, target_jMidEdge_point, donor_iMidEdge_point, donor_jMidEdge_point, Direction);
 
-            /*--- Proceeds until the value of the intersection length is null ---*/
-            if ( Donor_nLinkedNodes[donor_iPoint] == 1 ){
-              donor_forward_point  = donor_OldiPoint;
-              donor_backward_point = donor_iPoint;
-            }
-            else{
-              uptr = &Donor_LinkedNodes[ Donor_StartLinkedNodes[donor_iPoint] ];
-              
-              if( donor_OldiPoint != uptr[0] ){
-                donor_forward_point  = uptr[0];
-                donor_backward_point = uptr[1];
-              }
-              else{
-                donor_forward_point  = uptr[1];
-                donor_backward_point = uptr[0];
-              }
-            }
+          if ( LineIntersectionLength == 0.0 ){
+            check = true;
+            continue;
+          }
 
-            if(donor_iPoint >= nGlobalVertex_Donor){
-              check = true;
-              continue;
-            }
-            
-            for(iDim = 0; iDim < nDim; iDim++){
-              donor_iMidEdge_point[iDim] = ( DonorPoint_Coord[ donor_forward_point  * nDim + iDim] + DonorPoint_Coord[ donor_iPoint * nDim + iDim] ) / 2;
-              donor_jMidEdge_point[iDim] = ( DonorPoint_Coord[ donor_backward_point * nDim + iDim] + DonorPoint_Coord[ donor_iPoint * nDim + iDim] ) / 2;
-            }       
+          /*--- In case the element intersects the target cell, update the auxiliary communication data structure ---*/
 
-            LineIntersectionLength = ComputeLineIntersectionLength(target_iMidEdge_point, target_jMidEdge_point, donor_iMidEdge_point, donor_jMidEdge_point, Direction);
+          Donor_Vect.push_back(donor_iPoint);
+          Coeff_Vect.push_back(LineIntersectionLength / length);
+          storeProc.push_back(Donor_Proc[donor_iPoint]);
 
-            if ( LineIntersectionLength == 0.0 ){
-              check = true;
-              continue;
-            }
+          donor_OldiPoint = donor_iPoint;
+          donor_iPoint    = donor_forward_point;
 
-            /*--- In case the element intersects the target cell, update the auxiliary communication data structure ---*/
+          nDonorPoints++;
+        }
 
-            tmp_Coeff_Vect = new     su2double[ nDonorPoints + 1 ];
-            tmp_Donor_Vect = new unsigned long[ nDonorPoints + 1 ];
-            tmp_storeProc  = new unsigned long[ nDonorPoints + 1 ];
- 
-            for( iDonor = 0; iDonor < nDonorPoints; iDonor++){
-              tmp_Donor_Vect[iDonor] = Donor_Vect[iDonor];
-              tmp_Coeff_Vect[iDonor] = Coeff_Vect[iDonor];
-              tmp_storeProc[iDonor]  = storeProc[iDonor];
-            }
-                  
-            tmp_Coeff_Vect[ nDonorPoints ] = LineIntersectionLength / length;                  
-            tmp_Donor_Vect[ nDonorPoints ] = donor_iPoint;
-            tmp_storeProc[  nDonorPoints ] = Donor_Proc[donor_iPoint];
+        if ( Donor_nLinkedNodes[donor_StartIndex] == 2 ){
+          check = false;
 
-            if (Donor_Vect != NULL) delete [] Donor_Vect;
-            if (Coeff_Vect != NULL) delete [] Coeff_Vect;
-            if (storeProc  != NULL) delete [] storeProc;
+          uptr = &Donor_LinkedNodes[ Donor_StartLinkedNodes[donor_StartIndex] ];
 
-            Donor_Vect = tmp_Donor_Vect;
-            Coeff_Vect = tmp_Coeff_Vect;
-            storeProc  = tmp_storeProc;
+          donor_iPoint = uptr[1];
+          donor_OldiPoint = donor_StartIndex;
+        }
+        else
+          check = true;
 
-            donor_OldiPoint = donor_iPoint;
-            donor_iPoint    = donor_forward_point;
-  
-            nDonorPoints++;
+        /*--- Proceeds along the backward direction (depending on which connected boundary node is found first) ---*/
+
+        while( !check ){
+
+          /*--- Proceeds until the value of the intersection length is null ---*/
+          if ( Donor_nLinkedNodes[donor_iPoint] == 1 ){
+            donor_forward_point  = donor_OldiPoint;
+            donor_backward_point = donor_iPoint;
           }
-                
-          /*--- Set the communication data structure and copy data from the auxiliary vectors ---*/
+          else{
+            uptr = &Donor_LinkedNodes[ Donor_StartLinkedNodes[donor_iPoint] ];
 
-          target_geometry->vertex[markTarget][iVertex]->SetnDonorPoints(nDonorPoints);
+            if( donor_OldiPoint != uptr[0] ){
+              donor_forward_point  = uptr[0];
+              donor_backward_point = uptr[1];
+            }
+            else{
+              donor_forward_point  = uptr[1];
+              donor_backward_point = uptr[0];
+            }
+          }
 
-          target_geometry->vertex[markTarget][iVertex]->Allocate_DonorInfo();
-   
-          for ( iDonor = 0; iDonor < nDonorPoints; iDonor++ ){              
-            target_geometry->vertex[markTarget][iVertex]->SetDonorCoeff(          iDonor, Coeff_Vect[iDonor]);
-            target_geometry->vertex[markTarget][iVertex]->SetInterpDonorPoint(    iDonor, Donor_GlobalPoint[ Donor_Vect[iDonor] ]);
-            target_geometry->vertex[markTarget][iVertex]->SetInterpDonorProcessor(iDonor, storeProc[iDonor]);
+          if(donor_iPoint >= nGlobalVertex_Donor){
+            check = true;
+            continue;
           }
-        }
-      }    
-      
-      delete [] target_segment;
-      
-      delete [] target_iMidEdge_point;
-      delete [] target_jMidEdge_point;
 
-      delete [] donor_iMidEdge_point;
-      delete [] donor_jMidEdge_point;
-    }
-    else{ 
-      /* --- 3D geometry, creates a superficial super-mesh --- */
-      
-      for (iVertex = 0; iVertex < nVertexTarget; iVertex++) {
-  
-        nDonorPoints = 0;
+          for(iDim = 0; iDim < nDim; iDim++){
+            donor_iMidEdge_point[iDim] = ( DonorPoint_Coord[ donor_forward_point  * nDim + iDim] + DonorPoint_Coord[ donor_iPoint * nDim + iDim] ) / 2;
+            donor_jMidEdge_point[iDim] = ( DonorPoint_Coord[ donor_backward_point * nDim + iDim] + DonorPoint_Coord[ donor_iPoint * nDim + iDim] ) / 2;
+          }
 
-        /*--- Stores coordinates of the target node ---*/
+          LineIntersectionLength = ComputeLineIntersectionLength(target_iMidEdge_point, target_jMidEdge_point, donor_iMidEdge_point, donor_jMidEdge_point, Direction);
 
-        target_iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
-        
-        if (target_geometry->node[target_iPoint]->GetDomain()){
-    
-          Coord_i = target_geometry->node[target_iPoint]->GetCoord();
+          if ( LineIntersectionLength == 0.0 ){
+            check = true;
+            continue;
+          }
 
-          target_geometry->vertex[markTarget][iVertex]->GetNormal(Normal);
- 
-          /*--- The value of Area computed here includes also portion of boundary belonging to different marker ---*/
-          Area = 0.0;
-          for (iDim = 0; iDim < nDim; iDim++) 
-            Area += Normal[iDim]*Normal[iDim];
-          Area = sqrt(Area);
- 
-          for (iDim = 0; iDim < nDim; iDim++)
-            Normal[iDim] /= Area;
+          /*--- In case the element intersects the target cell, update the auxiliary communication data structure ---*/
 
-          for (iDim = 0; iDim < nDim; iDim++)
-            Coord_i[iDim] = target_geometry->node[target_iPoint]->GetCoord(iDim);
-          
-          long dPoint = target_geometry->node[target_iPoint]->GetGlobalIndex();
-          for (target_iPoint = 0; target_iPoint < nGlobalVertex_Target; target_iPoint++){
-            if( dPoint == Target_GlobalPoint[target_iPoint] )
-              break;
-          }        
-        
-          /*--- Build local surface dual mesh for target element ---*/
-        
-          nEdges_target = Target_nLinkedNodes[target_iPoint];
+          Donor_Vect.push_back(donor_iPoint);
+          Coeff_Vect.push_back(LineIntersectionLength / length);
+          storeProc.push_back(Donor_Proc[donor_iPoint]);
 
-          nNode_target = 2*(nEdges_target + 1);
-          
-          target_element = new su2double*[nNode_target];
-          for (ii = 0; ii < nNode_target; ii++)
-            target_element[ii] = new su2double[nDim];
-            
-          nNode_target = Build_3D_surface_element(Target_LinkedNodes, Target_StartLinkedNodes, Target_nLinkedNodes, TargetPoint_Coord, target_iPoint, target_element);
+          donor_OldiPoint = donor_iPoint;
+          donor_iPoint    = donor_forward_point;
 
-          /*--- Brute force to find the closest donor_node ---*/
+          nDonorPoints++;
+        }
 
-          mindist = 1E6;
-          donor_StartIndex = 0;
- 
-          for (donor_iPoint = 0; donor_iPoint < nGlobalVertex_Donor; donor_iPoint++) {
-        
-            Coord_j = &DonorPoint_Coord[ donor_iPoint * nDim ];
+        /*--- Set the communication data structure and copy data from the auxiliary vectors ---*/
 
-            dist = PointsDistance(Coord_i, Coord_j);
+        target_geometry->vertex[markTarget][iVertex]->SetnDonorPoints(nDonorPoints);
 
-            if (dist < mindist) {
-              mindist = dist;  
-              donor_StartIndex = donor_iPoint;
-            }
+        target_geometry->vertex[markTarget][iVertex]->Allocate_DonorInfo();
 
-            if (dist == 0.0){
-              donor_StartIndex = donor_iPoint;
-              break;
-            }    
-          }
-                
-          donor_iPoint = donor_StartIndex;
+        for ( iDonor = 0; iDonor < nDonorPoints; iDonor++ ){
+          target_geometry->vertex[markTarget][iVertex]->SetDonorCoeff(          iDonor, Coeff_Vect[iDonor]);
+          target_geometry->vertex[markTarget][iVertex]->SetInterpDonorPoint(    iDonor, Donor_GlobalPoint[ Donor_Vect[iDonor] ]);
+          target_geometry->vertex[markTarget][iVertex]->SetInterpDonorProcessor(iDonor, storeProc[iDonor]);
+        }
+      }
+      else{
+        /* --- 3D geometry, creates a superficial super-mesh --- */
 
-          nEdges_donor = Donor_nLinkedNodes[donor_iPoint];
+        target_geometry->vertex[markTarget][iVertex]->GetNormal(Normal);
 
-          donor_element = new su2double*[ 2*nEdges_donor + 2 ];
-          for (ii = 0; ii < 2*nEdges_donor + 2; ii++)
-            donor_element[ii] = new su2double[nDim];                
+        /*--- The value of Area computed here includes also portion of boundary belonging to different marker ---*/
+        Area = 0.0;
+        for (iDim = 0; iDim < nDim; iDim++)
+          Area += Normal[iDim]*Normal[iDim];
+        Area = sqrt(Area);
 
-          nNode_donor = Build_3D_surface_element(Donor_LinkedNodes, Donor_StartLinkedNodes, Donor_nLinkedNodes, DonorPoint_Coord, donor_iPoint, donor_element);
+        for (iDim = 0; iDim < nDim; iDim++)
+          Normal[iDim] /= Area;
 
-          Area = 0;
-          for (ii = 1; ii < nNode_target-1; ii++){
-            for (jj = 1; jj < nNode_donor-1; jj++){
-              Area += Compute_Triangle_Intersection(target_element[0], target_element[ii], target_element[ii+1], donor_element[0], donor_element[jj], donor_element[jj+1], Normal);
-              //cout << Compute_Triangle_Intersection(target_element[0], target_element[ii], target_element[ii+1], donor_element[0], donor_element[jj], donor_element[jj+1], Normal) << endl;
-            }
-          }
+        /*--- Build local surface dual mesh for target element ---*/
 
-          for (ii = 0; ii < 2*nEdges_donor + 2; ii++)
-            delete [] donor_element[ii];
-          delete [] donor_element;
+        nEdges_target = Target_nLinkedNodes[jVertexTarget];
 
-          nDonorPoints = 1;
+        nNode_target = 2*(nEdges_target + 1);
 
-          /*--- In case the element intersect the target cell update the auxiliary communication data structure ---*/
+        target_element = new su2double*[nNode_target];
+        for (ii = 0; ii < nNode_target; ii++)
+          target_element[ii] = new su2double[nDim];
 
-          Coeff_Vect = new     su2double[ nDonorPoints ];
-          Donor_Vect = new unsigned long[ nDonorPoints ];
-          storeProc  = new unsigned long[ nDonorPoints ];
+        nNode_target = Build_3D_surface_element(Target_LinkedNodes, Target_StartLinkedNodes, Target_nLinkedNodes, TargetPoint_Coord, jVertexTarget, target_element);
 
-          Coeff_Vect[0] = Area;
-          Donor_Vect[0] = donor_iPoint;
-          storeProc[0]  = Donor_Proc[donor_iPoint];
+        donor_iPoint = donor_StartIndex;
 
-          alreadyVisitedDonor = new unsigned long[1];
+        nEdges_donor = Donor_nLinkedNodes[donor_iPoint];
 
-          alreadyVisitedDonor[0] = donor_iPoint;
-          nAlreadyVisited = 1;
-          StartVisited = 0;
+        donor_element = new su2double*[ 2*nEdges_donor + 2 ];
+        for (ii = 0; ii < 2*nEdges_donor + 2; ii++)
+          donor_element[ii] = new su2double[nDim];
 
-          Area_old = -1;
-                    
-          while( Area > Area_old ){ 
+        nNode_donor = Build_3D_surface_element(Donor_LinkedNodes, Donor_StartLinkedNodes, Donor_nLinkedNodes, DonorPoint_Coord, donor_iPoint, donor_element);
 
-            /* 
-             * - Starting from the closest donor_point, it expands the supermesh by a countour search pattern.
-             * - The closest donor element becomes the core, at each iteration a new layer of elements around the core is taken into account
-             */
+        Area = 0;
+        for (ii = 1; ii < nNode_target-1; ii++){
+          for (jj = 1; jj < nNode_donor-1; jj++){
+            Area += Compute_Triangle_Intersection(target_element[0], target_element[ii], target_element[ii+1], donor_element[0], donor_element[jj], donor_element[jj+1], Normal);
+          }
+        }
 
-            Area_old = Area;
+        for (ii = 0; ii < 2*nEdges_donor + 2; ii++)
+          delete [] donor_element[ii];
+        delete [] donor_element;
 
-            ToVisit = NULL;
-            nToVisit = 0;
+        nDonorPoints = 1;
 
-            for( iNodeVisited = StartVisited; iNodeVisited < nAlreadyVisited; iNodeVisited++ ){
+        /*--- In case the element intersect the target cell update the auxiliary communication data structure ---*/
 
-              vPoint = alreadyVisitedDonor[ iNodeVisited ];
-            
-              nEdgeVisited = Donor_nLinkedNodes[vPoint];
- 
-              for (iEdgeVisited = 0; iEdgeVisited < nEdgeVisited; iEdgeVisited++){
+        Coeff_Vect.push_back(Area);
+        Donor_Vect.push_back(donor_iPoint);
+        storeProc.push_back(Donor_Proc[donor_iPoint]);
 
-                donor_iPoint = Donor_LinkedNodes[ Donor_StartLinkedNodes[vPoint] + iEdgeVisited];
+        alreadyVisitedDonor.assign(1, donor_iPoint);
+        StartVisited = 0;
 
-                /*--- Check if the node to visit is already listed in the data structure to avoid double visits ---*/
+        Area_old = -1;
 
-                check = 0;
+        while( Area > Area_old ){
 
-                for( jj = 0; jj < nAlreadyVisited; jj++ ){
-                  if( donor_iPoint == alreadyVisitedDonor[jj] ){
-                    check = 1; 
-                    break;
-                  }
-                }
+          /*
+           * - Starting from the closest donor_point, it expands the supermesh by a countour search pattern.
+           * - The closest donor element becomes the core, at each iteration a new layer of elements around the core is taken into account
+           */
 
-                if( check == 0 && ToVisit != NULL){
-                  for( jj = 0; jj < nToVisit; jj++ )
-                    if( donor_iPoint == ToVisit[jj] ){
-                      check = 1; 
-                      break;
-                    }       
-                }
+          Area_old = Area;
 
-                if( check == 0 ){ 
-                  /*--- If the node was not already visited, visit it and list it into data structure ---*/
-  
-                  tmpVect = new unsigned long[ nToVisit + 1 ];
+          ToVisit.clear();
 
-                  for( jj = 0; jj < nToVisit; jj++ )
-                    tmpVect[jj] = ToVisit[jj];
-                  tmpVect[nToVisit] = donor_iPoint;
+          for( iNodeVisited = StartVisited; iNodeVisited < alreadyVisitedDonor.size(); iNodeVisited++ ){
 
-                  if( ToVisit != NULL )
-                    delete [] ToVisit;
-                    
-                  ToVisit = tmpVect;
-                  tmpVect = NULL;
+            vPoint = alreadyVisitedDonor[ iNodeVisited ];
 
-                  nToVisit++; 
+            nEdgeVisited = Donor_nLinkedNodes[vPoint];
 
-                  /*--- Find the value of the intersection area between the current donor element and the target element --- */
+            for (iEdgeVisited = 0; iEdgeVisited < nEdgeVisited; iEdgeVisited++){
 
-                  nEdges_donor = Donor_nLinkedNodes[donor_iPoint];
+              donor_iPoint = Donor_LinkedNodes[ Donor_StartLinkedNodes[vPoint] + iEdgeVisited];
 
-                  donor_element = new su2double*[ 2*nEdges_donor + 2 ];   
-                  for (ii = 0; ii < 2*nEdges_donor + 2; ii++)
-                    donor_element[ii] = new su2double[nDim];             
+              /*--- Check if the node to visit is already listed in the data structure to avoid double visits ---*/
 
-                  nNode_donor = Build_3D_surface_element(Donor_LinkedNodes, Donor_StartLinkedNodes, Donor_nLinkedNodes, DonorPoint_Coord, donor_iPoint, donor_element);
+              check = (find(alreadyVisitedDonor.begin(), alreadyVisitedDonor.end(), donor_iPoint) != alreadyVisitedDonor.end()) ||
+                      (find(ToVisit.begin(), ToVisit.end(), donor_iPoint) != ToVisit.end());
 
-                  tmp_Area = 0;
-                  for (ii = 1; ii < nNode_target-1; ii++)
-                    for (jj = 1; jj < nNode_donor-1; jj++)
-                      tmp_Area += Compute_Triangle_Intersection(target_element[0], target_element[ii], target_element[ii+1], donor_element[0], donor_element[jj], donor_element[jj+1], Normal);
+              if( !check ){
+                /*--- If the node was not already visited, visit it and list it into data structure ---*/
 
-                  for (ii = 0; ii < 2*nEdges_donor + 2; ii++)
-                    delete [] donor_element[ii];
-                  delete [] donor_element;
- 
-                  /*--- In case the element intersect the target cell update the auxiliary communication data structure ---*/
+                ToVisit.push_back(donor_iPoint);
 
-                  tmp_Coeff_Vect = new     su2double[ nDonorPoints + 1 ];
-                  tmp_Donor_Vect = new unsigned long[ nDonorPoints + 1 ];
-                  tmp_storeProc  = new unsigned long[ nDonorPoints + 1 ];
- 
-                  for( iDonor = 0; iDonor < nDonorPoints; iDonor++){
-                    tmp_Donor_Vect[iDonor] = Donor_Vect[iDonor];
-                    tmp_Coeff_Vect[iDonor] = Coeff_Vect[iDonor];
-                    tmp_storeProc[iDonor]  = storeProc[iDonor];
-                  }
-                  
-                  tmp_Coeff_Vect[ nDonorPoints ] = tmp_Area;                  
-                  tmp_Donor_Vect[ nDonorPoints ] = donor_iPoint;
-                  tmp_storeProc[  nDonorPoints ] = Donor_Proc[donor_iPoint];
-
-                  if (Donor_Vect != NULL) {delete [] Donor_Vect; }
-                  if (Coeff_Vect != NULL) {delete [] Coeff_Vect; }
-                  if (storeProc  != NULL) {delete [] storeProc;  }
-
-                  Donor_Vect = tmp_Donor_Vect;
-                  Coeff_Vect = tmp_Coeff_Vect;
-                  storeProc  = tmp_storeProc;
-
-                  tmp_Coeff_Vect = NULL;                  
-                  tmp_Donor_Vect = NULL;
-                  tmp_storeProc  = NULL;
-
-                  nDonorPoints++;
-   
-                  Area += tmp_Area;
-                }
-              }   
-            }
+                /*--- Find the value of the intersection area between the current donor element and the target element --- */
 
-            /*--- Update auxiliary data structure ---*/
- 
-            StartVisited = nAlreadyVisited;
+                nEdges_donor = Donor_nLinkedNodes[donor_iPoint];
 
-            tmpVect = new unsigned long[ nAlreadyVisited + nToVisit ];
+                donor_element = new su2double*[ 2*nEdges_donor + 2 ];
+                for (ii = 0; ii < 2*nEdges_donor + 2; ii++)
+                  donor_element[ii] = new su2double[nDim];
 
-            for( jj = 0; jj < nAlreadyVisited; jj++ )
-              tmpVect[jj] = alreadyVisitedDonor[jj];
-              
-            for( jj = 0; jj < nToVisit; jj++ )
-              tmpVect[ nAlreadyVisited + jj ] = ToVisit[jj];
+                nNode_donor = Build_3D_surface_element(Donor_LinkedNodes, Donor_StartLinkedNodes, Donor_nLinkedNodes, DonorPoint_Coord, donor_iPoint, donor_element);
 
-            if( alreadyVisitedDonor != NULL )
-              delete [] alreadyVisitedDonor;
+                tmp_Area = 0;
+                for (ii = 1; ii < nNode_target-1; ii++)
+                  for (jj = 1; jj < nNode_donor-1; jj++)
+                    tmp_Area += Compute_Triangle_Intersection(target_element[0], target_element[ii], target_element[ii+1], donor_element[0], donor_element[jj], donor_element[jj+1], Normal);
 
-            alreadyVisitedDonor = tmpVect;            
+                for (ii = 0; ii < 2*nEdges_donor + 2; ii++)
+                  delete [] donor_element[ii];
+                delete [] donor_element;
 
-            nAlreadyVisited += nToVisit;    
+                /*--- In case the element intersect the target cell update the auxiliary communication data structure ---*/
 
-            delete [] ToVisit;  
+                Coeff_Vect.push_back(tmp_Area);
+                Donor_Vect.push_back(donor_iPoint);
+                storeProc.push_back(Donor_Proc[donor_iPoint]);
+
+                nDonorPoints++;
+
+                Area += tmp_Area;
+              }
+            }
           }
 
-          delete [] alreadyVisitedDonor;
-  
-          /*--- Set the communication data structure and copy data from the auxiliary vectors ---*/
+          /*--- Update auxiliary data structure ---*/
 
-          target_geometry->vertex[markTarget][iVertex]->SetnDonorPoints(nDonorPoints);
-          target_geometry->vertex[markTarget][iVertex]->Allocate_DonorInfo();
+          StartVisited = alreadyVisitedDonor.size();
 
-          for ( iDonor = 0; iDonor < nDonorPoints; iDonor++ ){              
-            target_geometry->vertex[markTarget][iVertex]->SetDonorCoeff(iDonor, Coeff_Vect[iDonor]/Area);
-            target_geometry->vertex[markTarget][iVertex]->SetInterpDonorPoint( iDonor, Donor_GlobalPoint[ Donor_Vect[iDonor] ] );
-            target_geometry->vertex[markTarget][iVertex]->SetInterpDonorProcessor(iDonor, storeProc[iDonor]);
-            //cout <<rank << " Global Point " << Global_Point<<" iDonor " << iDonor <<" coeff " << coeff <<" gp " << pGlobalPoint << endl;               
-          }
+          alreadyVisitedDonor.insert(alreadyVisitedDonor.end(), ToVisit.begin(), ToVisit.end());
+        }
 
-          for (ii = 0; ii < 2*nEdges_target + 2; ii++)
-            delete [] target_element[ii];
-          delete [] target_element;
-          
-          if (Donor_Vect != NULL) {delete [] Donor_Vect; Donor_Vect = NULL;}
-          if (Coeff_Vect != NULL) {delete [] Coeff_Vect; Coeff_Vect = NULL;}
-          if (storeProc  != NULL) {delete [] storeProc;  storeProc  = NULL;}
+        /*--- Set the communication data structure and copy data from the auxiliary vectors ---*/
+
+        target_geometry->vertex[markTarget][iVertex]->SetnDonorPoints(nDonorPoints);
+        target_geometry->vertex[markTarget][iVertex]->Allocate_DonorInfo();
+
+        for ( iDonor = 0; iDonor < nDonorPoints; iDonor++ ){
+          target_geometry->vertex[markTarget][iVertex]->SetDonorCoeff(iDonor, Coeff_Vect[iDonor]/Area);
+          target_geometry->vertex[markTarget][iVertex]->SetInterpDonorPoint( iDonor, Donor_GlobalPoint[ Donor_Vect[iDonor] ] );
+          target_geometry->vertex[markTarget][iVertex]->SetInterpDonorProcessor(iDonor, storeProc[iDonor]);
         }
+
+        for (ii = 0; ii < 2*nEdges_target + 2; ii++)
+          delete [] target_element[ii];
+        delete [] target_element;
       }
     }
 
+    } // end SU2_OMP_PARALLEL
 
     delete [] TargetPoint_Coord;
     delete [] Target_GlobalPoint;
@@ -2182,12 +2109,6 @@ void CSlidingMesh::Set_TransferCoeff(CConfig **config){
     
   }
 
-  delete [] Normal;
-  delete [] Direction;
-  
-  if (Donor_Vect != NULL) delete [] Donor_Vect;
-  if (Coeff_Vect != NULL) delete [] Coeff_Vect;
-  if (storeProc  != NULL) delete [] storeProc;  
 }
 
 int CSlidingMesh::Build_3D_surface_element(unsigned long *map, unsigned long *startIndex, unsigned long* nNeighbor, su2double *coord, unsigned long centralNode, su2double** element){
@@ -2739,7 +2660,7 @@ void CRadialBasisFunction::Set_TransferCoeff(CConfig **config) {
   int iProcessor, nProcessor = size;
   int nPolynomial = 0;
   int mark_donor, mark_target, target_check, donor_check;
-  int *skip_row = NULL, *calc_polynomial_check;
+  int *calc_polynomial_check;
 
   unsigned short iDim, nDim, iMarkerInt, nMarkerInt;    
 
@@ -2749,15 +2670,12 @@ void CRadialBasisFunction::Set_TransferCoeff(CConfig **config) {
   unsigned long point_donor, point_target;
   unsigned long *nLocalM_arr;
   
-  su2double val_i, val_j;
-  su2double interface_coord_tol=1e6*numeric_limits<double>::epsilon();
   su2double *Coord_i, *Coord_j;
   su2double *local_M;
-  su2double *P = NULL;
-  su2double *C_inv_trunc = NULL, *C_tmp = NULL;
+  su2double *C_inv_trunc = NULL;
   su2double *target_vec, *coeff_vec;
   
-  CSymmetricMatrix *global_M = NULL, *Mp = NULL;
+  CSymmetricMatrix *global_M = NULL;
 
 #ifdef HAVE_MPI
   unsigned long iLocalM;
@@ -2858,6 +2776,19 @@ void CRadialBasisFunction::Set_TransferCoeff(CConfig **config) {
 
     Collect_VertexInfo( false, mark_donor, mark_target, nVertexDonor, nDim);
 
+    /*--- Interpolation over local patches of the nearest donor points ---*/
+    if (config[donorZone]->GetRadialBasisFunctionPatchSize() > 0) {
+
+      Set_TransferCoeff_Patches(config, mark_target, nVertexTarget, nGlobalVertexDonor, nDim);
+
+      delete[] Buffer_Send_Coord;
+      delete[] Buffer_Send_GlobalPoint;
+      delete[] Buffer_Receive_Coord;
+      delete[] Buffer_Receive_GlobalPoint;
+      delete[] Buffer_Send_nVertex_Donor;
+      continue;
+    }
+
     /*--- Send information about size of local_M array ---*/
     nLocalM = nVertexDonorInDomain*(nVertexDonorInDomain+1)/2 \
 		    + nVertexDonorInDomain*(nGlobalVertexDonor-iGlobalVertexDonor_end);
@@ -2944,117 +2875,20 @@ void CRadialBasisFunction::Set_TransferCoeff(CConfig **config) {
     global_M->Initialize((int)nVertexDonorInDomain, local_M);
 #endif
     
-    /*--- Invert M matrix ---*/
-    if (rank == MASTER_NODE) {
-      switch (config[donorZone]->GetKindRadialBasisFunction())
-      {
-        /*--- Basis functions that make M positive definite ---*/
-        case WENDLAND_C2:
-        case INV_MULTI_QUADRIC:
-        case GAUSSIAN:
-          global_M->Invert(true);
-          break;
-
-        case THIN_PLATE_SPLINE:
-        case MULTI_QUADRIC:
-          global_M->Invert(false);
-          break;
-      }
-    }
-    
+    /*--- Invert M matrix and calculate C_inv_trunc ---*/
     calc_polynomial_check = new int [nDim];
-    
-    /*--- Calculate C_inv_trunc ---*/
-    if (rank == MASTER_NODE) {
-		
-      if ( config[donorZone]->GetRadialBasisFunctionPolynomialOption() ) {
-			  
-        /*--- Fill P matrix and get minimum and maximum values ---*/
-        P = new su2double [nGlobalVertexDonor*(nDim+1)];
-        iCount = 0;
-        for (iProcessor=MASTER_NODE; iProcessor<nProcessor; iProcessor++) {
-          for (iVertexDonor=0; iVertexDonor<Buffer_Receive_nVertex_Donor[iProcessor]; iVertexDonor++) {
-            P[iCount*(nDim+1)] = 1;
-            for (iDim=0; iDim<nDim; iDim++) {
-              P[iCount*(nDim+1)+iDim+1] = Buffer_Receive_Coord[(iProcessor*MaxLocalVertex_Donor+iVertexDonor)*nDim + iDim];
-            }
-            iCount++;
-          }
-        }
-
-        skip_row = new int [nDim+1];
-        skip_row[0] = 1;
-        for (int i=1; i<nDim+1; i++) skip_row[i] = 0;
 
-        Check_PolynomialTerms(nDim+1, nGlobalVertexDonor, skip_row, interface_coord_tol, calc_polynomial_check, nPolynomial, P);
-
-        /*--- Calculate Mp ---*/
-        Mp = new CSymmetricMatrix;
-        Mp->Initialize(nPolynomial+1);
-        for (int m=0; m<nPolynomial+1; m++) {
-          for (int n=m; n<nPolynomial+1; n++) {
-            val_i = 0;
-            for (iVertexDonor=0; iVertexDonor<nGlobalVertexDonor; iVertexDonor++) {
-              val_j = 0;
-              for (jVertexDonor=0; jVertexDonor<nGlobalVertexDonor; jVertexDonor++) {
-                val_j += global_M->Read((int)iVertexDonor, (int)jVertexDonor)*P[jVertexDonor*(nPolynomial+1)+n];
-              }
-              val_i += val_j*P[iVertexDonor*(nPolynomial+1)+m];
-            }
-            Mp->Write(m, n, val_i);
-          }
-        }
-        Mp->Invert(false);
-
-        /*--- Calculate M_p*P*M_inv ---*/
-        C_inv_trunc = new su2double [(nGlobalVertexDonor+nPolynomial+1)*nGlobalVertexDonor];
-      	for (int m=0; m<nPolynomial+1; m++) {
-          for (iVertexDonor=0; iVertexDonor<nGlobalVertexDonor; iVertexDonor++) {
-            val_i = 0;
-            for (int n=0; n<nPolynomial+1; n++) {
-              val_j = 0;
-              for (jVertexDonor=0; jVertexDonor<nGlobalVertexDonor; jVertexDonor++) {
-                val_j += P[jVertexDonor*(nPolynomial+1)+n]*global_M->Read((int)jVertexDonor, (int)iVertexDonor);
-              }
-              val_i += val_j*Mp->Read(m, n);
-            }
-            /*--- Save in row major order ---*/
-            C_inv_trunc[m*nGlobalVertexDonor+iVertexDonor] = val_i;
-          }  		
-      	}
-
-        /*--- Calculate (I - P'*M_p*P*M_inv) ---*/
-        C_tmp = new su2double [nGlobalVertexDonor*nGlobalVertexDonor];
-        for (iVertexDonor=0; iVertexDonor<nGlobalVertexDonor; iVertexDonor++) {
-          for (jVertexDonor=0; jVertexDonor<nGlobalVertexDonor; jVertexDonor++) {
-            val_i = 0;
-            for (int m=0; m<nPolynomial+1; m++) {
-              val_i += P[iVertexDonor*(nPolynomial+1)+m]*C_inv_trunc[m*nGlobalVertexDonor+jVertexDonor];
-            }
-            /*--- Save in row major order ---*/
-            C_tmp[iVertexDonor*(nGlobalVertexDonor)+jVertexDonor] = -val_i;
-
-            if (jVertexDonor==iVertexDonor) { C_tmp[iVertexDonor*(nGlobalVertexDonor)+jVertexDonor] += 1; }
-          }
-        }
-
-        /*--- Calculate M_inv*(I - P'*M_p*P*M_inv) ---*/
-        global_M->MatMatMult(true, C_tmp, (int)nGlobalVertexDonor);
-
-        /*--- Write to C_inv_trunc matrix ---*/
-        for (iVertexDonor=0; iVertexDonor<nGlobalVertexDonor; iVertexDonor++)
-      	  for (jVertexDonor=0; jVertexDonor<nGlobalVertexDonor; jVertexDonor++)
-            C_inv_trunc[(iVertexDonor+nPolynomial+1)*(nGlobalVertexDonor)+jVertexDonor] = C_tmp[iVertexDonor*(nGlobalVertexDonor)+jVertexDonor];
-
-      } else { // no polynomial term used in the interpolation
+    if (rank == MASTER_NODE) {
+      vector<su2double> donorCoord(nGlobalVertexDonor*nDim);
+      iCount = 0;
+      for (iProcessor=MASTER_NODE; iProcessor<nProcessor; iProcessor++)
+        for (iVertexDonor=0; iVertexDonor<Buffer_Receive_nVertex_Donor[iProcessor]; iVertexDonor++, iCount++)
+          for (iDim=0; iDim<nDim; iDim++)
+            donorCoord[iCount*nDim+iDim] = Buffer_Receive_Coord[(iProcessor*MaxLocalVertex_Donor+iVertexDonor)*nDim + iDim];
 
-        C_inv_trunc = new su2double [nGlobalVertexDonor*nGlobalVertexDonor];
-        for (iVertexDonor=0; iVertexDonor<nGlobalVertexDonor; iVertexDonor++)
-          for (jVertexDonor=0; jVertexDonor<nGlobalVertexDonor; jVertexDonor++)
-      		C_inv_trunc[iVertexDonor*nGlobalVertexDonor+jVertexDonor] = global_M->Read((int)iVertexDonor, (int)jVertexDonor);
-      
-      } // endif GetRadialBasisFunctionPolynomialOption
-    } // endif (rank == MASTER_NODE)
+      C_inv_trunc = Get_InterpolationMatrix(config[donorZone], nGlobalVertexDonor, nDim, donorCoord.data(),
+                                            *global_M, nPolynomial, calc_polynomial_check);
+    }
     
 #ifdef HAVE_MPI
     SU2_MPI::Bcast(&nPolynomial, 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
@@ -3149,16 +2983,8 @@ void CRadialBasisFunction::Set_TransferCoeff(CConfig **config) {
     delete [] target_vec;
     delete [] coeff_vec;   
     
-    if ( rank == MASTER_NODE ) {
+    if ( rank == MASTER_NODE )
       delete global_M;
-      
-      if ( config[donorZone]->GetRadialBasisFunctionPolynomialOption() ) {
-        delete [] skip_row;
-        delete [] P;
-        delete Mp;
-        delete [] C_tmp;
-      }
-    }
     
     delete[] Buffer_Send_Coord;
     delete[] Buffer_Send_GlobalPoint;
@@ -3182,6 +3008,255 @@ void CRadialBasisFunction::Set_TransferCoeff(CConfig **config) {
 #endif
 }
 
+void CRadialBasisFunction::Set_TransferCoeff_Patches(CConfig **config, int mark_target, unsigned long nVertexTarget,
+                                                     unsigned long nGlobalVertexDonor, unsigned short nDim) {
+
+  int iProcessor, nProcessor = size;
+  int nPolynomial = 0, calc_polynomial_check[3] = {0};
+  unsigned short iDim;
+  unsigned long iVertexDonor, jVertexDonor, iVertexTarget, iCount, jCount, point_target;
+
+  const bool usePolynomial = config[donorZone]->GetRadialBasisFunctionPolynomialOption();
+  const unsigned short kindRBF = config[donorZone]->GetKindRadialBasisFunction();
+  const su2double paramRBF = config[donorZone]->GetRadialBasisFunctionParameter();
+  const unsigned long nPatch = min(config[donorZone]->GetRadialBasisFunctionPatchSize(), nGlobalVertexDonor);
+
+  if (usePolynomial && (config[donorZone]->GetRadialBasisFunctionPatchSize() < nDim+2u))
+    SU2_MPI::Error("RADIAL_BASIS_FUNCTION_PATCH_SIZE must exceed the number of polynomial terms (NDIM+1).",
+                   CURRENT_FUNCTION);
+
+  /*--- Contiguous copy of the donor vertices gathered from all ranks ---*/
+
+  vector<su2double> donorCoord(nGlobalVertexDonor*nDim);
+  vector<long> donorPoint(nGlobalVertexDonor);
+  vector<int> donorProc(nGlobalVertexDonor);
+  vector<unsigned long> donorID(nGlobalVertexDonor);
+
+  su2double bbMin[3] = {0.0}, bbMax[3] = {0.0};
+  iCount = 0;
+  for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
+    for (iVertexDonor = 0; iVertexDonor < Buffer_Receive_nVertex_Donor[iProcessor]; iVertexDonor++, iCount++) {
+      for (iDim = 0; iDim < nDim; iDim++) {
+        const su2double x = Buffer_Receive_Coord[(iProcessor*MaxLocalVertex_Donor+iVertexDonor)*nDim + iDim];
+        donorCoord[iCount*nDim+iDim] = x;
+        bbMin[iDim] = (iCount == 0)? x : min(bbMin[iDim], x);
+        bbMax[iDim] = (iCount == 0)? x : max(bbMax[iDim], x);
+      }
+      donorPoint[iCount] = Buffer_Receive_GlobalPoint[iProcessor*MaxLocalVertex_Donor+iVertexDonor];
+      donorProc[iCount] = iProcessor;
+      donorID[iCount] = iCount;
+    }
+  }
+
+  /*--- Each rank only treats its own target vertices, hence a local tree of all
+   the donor vertices is used to find the patches of nearest donors. ---*/
+
+  CADTPointsOnlyClass donorADT(nDim, nGlobalVertexDonor, donorCoord.data(), donorID.data(), false);
+
+  /*--- Typical spacing of the donor vertices on the (nDim-1 dimensional) interface,
+   used for the initial radius of the search of the nearest donors. ---*/
+
+  su2double bbDiag = 0.0;
+  for (iDim = 0; iDim < nDim; iDim++) bbDiag += pow(bbMax[iDim]-bbMin[iDim], 2);
+  bbDiag = sqrt(bbDiag);
+  if (bbDiag == 0.0) bbDiag = 1.0;
+  const su2double patchRadius = bbDiag*pow(su2double(nPatch)/nGlobalVertexDonor, 1.0/max(nDim-1,1));
+
+  vector<unsigned long> ballIDs;
+  vector<pair<su2double,unsigned long> > patch;
+  vector<su2double> patchCoord(nPatch*nDim);
+  vector<su2double> target_vec(nPatch+nDim+1), coeff_vec(nPatch);
+  su2double Coord_i[3], dist;
+  unsigned long nearestID;
+  int nearestRank;
+
+  for (iVertexTarget = 0; iVertexTarget < nVertexTarget; iVertexTarget++) {
+
+    point_target = target_geometry->vertex[mark_target][iVertexTarget]->GetNode();
+
+    if (!target_geometry->node[point_target]->GetDomain()) continue;
+
+    for (iDim = 0; iDim < nDim; iDim++)
+      Coord_i[iDim] = target_geometry->node[point_target]->GetCoord(iDim);
+
+    /*--- Grow the search ball until it contains the patch ---*/
+
+    donorADT.DetermineNearestNode(Coord_i, dist, nearestID, nearestRank);
+    su2double radius = dist + patchRadius;
+    donorADT.DetermineNodesInBall(Coord_i, radius, ballIDs);
+    while (ballIDs.size() < nPatch) {
+      radius *= 2.0;
+      donorADT.DetermineNodesInBall(Coord_i, radius, ballIDs);
+    }
+
+    patch.clear();
+    for (auto iID : ballIDs)
+      patch.push_back(make_pair(PointsDistance(Coord_i, &donorCoord[iID*nDim]), iID));
+    partial_sort(patch.begin(), patch.begin()+nPatch, patch.end());
+
+    /*--- Interpolation matrix of the patch ---*/
+
+    CSymmetricMatrix M;
+    M.Initialize((int)nPatch);
+    for (iVertexDonor = 0; iVertexDonor < nPatch; iVertexDonor++) {
+      su2double *Coord_j = &donorCoord[patch[iVertexDonor].second*nDim];
+      for (iDim = 0; iDim < nDim; iDim++)
+        patchCoord[iVertexDonor*nDim+iDim] = Coord_j[iDim];
+      for (jVertexDonor = iVertexDonor; jVertexDonor < nPatch; jVertexDonor++)
+        M.Write((int)iVertexDonor, (int)jVertexDonor, Get_RadialBasisValue(kindRBF, paramRBF,
+                PointsDistance(Coord_j, &donorCoord[patch[jVertexDonor].second*nDim])));
+    }
+
+    su2double *C_inv_trunc = Get_InterpolationMatrix(config[donorZone], nPatch, nDim, patchCoord.data(),
+                                                     M, nPolynomial, calc_polynomial_check);
+
+    /*--- Coefficients of the donors, as for the global interpolation ---*/
+
+    iCount = 0;
+    if (usePolynomial) {
+      target_vec[iCount++] = 1;
+      for (iDim = 0; iDim < nDim; iDim++)
+        if (calc_polynomial_check[iDim] == 1) target_vec[iCount++] = Coord_i[iDim];
+    }
+    for (iVertexDonor = 0; iVertexDonor < nPatch; iVertexDonor++)
+      target_vec[iCount++] = Get_RadialBasisValue(kindRBF, paramRBF, patch[iVertexDonor].first);
+
+    jCount = 0;
+    for (iVertexDonor = 0; iVertexDonor < nPatch; iVertexDonor++) {
+      coeff_vec[iVertexDonor] = 0;
+      for (jVertexDonor = 0; jVertexDonor < iCount; jVertexDonor++)
+        coeff_vec[iVertexDonor] += target_vec[jVertexDonor]*C_inv_trunc[jVertexDonor*nPatch+iVertexDonor];
+      if (coeff_vec[iVertexDonor] != 0) jCount++;
+    }
+    delete [] C_inv_trunc;
+
+    target_geometry->vertex[mark_target][iVertexTarget]->SetnDonorPoints(jCount);
+    target_geometry->vertex[mark_target][iVertexTarget]->Allocate_DonorInfo();
+
+    jCount = 0;
+    for (iVertexDonor = 0; iVertexDonor < nPatch; iVertexDonor++) {
+      if (coeff_vec[iVertexDonor] != 0) {
+        const unsigned long iID = patch[iVertexDonor].second;
+        target_geometry->vertex[mark_target][iVertexTarget]->SetInterpDonorPoint(jCount, donorPoint[iID]);
+        target_geometry->vertex[mark_target][iVertexTarget]->SetInterpDonorProcessor(jCount, donorProc[iID]);
+        target_geometry->vertex[mark_target][iVertexTarget]->SetDonorCoeff(jCount, coeff_vec[iVertexDonor]);
+        jCount++;
+      }
+    }
+  }
+
+}
+
+su2double* CRadialBasisFunction::Get_InterpolationMatrix(CConfig *config, unsigned long nDonor, unsigned short nDim,
+                                                         const su2double *donorCoord, CSymmetricMatrix &M,
+                                                         int &nPolynomial, int *calc_polynomial_check) {
+
+  unsigned long iVertexDonor, jVertexDonor;
+  su2double val_i, val_j;
+  su2double interface_coord_tol=1e6*numeric_limits<double>::epsilon();
+  su2double *C_inv_trunc = NULL;
+
+  /*--- Invert M matrix ---*/
+  switch (config->GetKindRadialBasisFunction())
+  {
+    /*--- Basis functions that make M positive definite ---*/
+    case WENDLAND_C2:
+    case INV_MULTI_QUADRIC:
+    case GAUSSIAN:
+      M.Invert(true);
+      break;
+
+    case THIN_PLATE_SPLINE:
+    case MULTI_QUADRIC:
+      M.Invert(false);
+      break;
+  }
+
+  /*--- Calculate C_inv_trunc ---*/
+  if ( config->GetRadialBasisFunctionPolynomialOption() ) {
+
+    /*--- Fill P matrix and get minimum and maximum values ---*/
+    vector<su2double> P(nDonor*(nDim+1));
+    for (iVertexDonor=0; iVertexDonor<nDonor; iVertexDonor++) {
+      P[iVertexDonor*(nDim+1)] = 1;
+      for (unsigned short iDim=0; iDim<nDim; iDim++)
+        P[iVertexDonor*(nDim+1)+iDim+1] = donorCoord[iVertexDonor*nDim+iDim];
+    }
+
+    int skip_row[4] = {1, 0, 0, 0};
+
+    Check_PolynomialTerms(nDim+1, nDonor, skip_row, interface_coord_tol, calc_polynomial_check, nPolynomial, P.data());
+
+    /*--- Calculate Mp ---*/
+    CSymmetricMatrix Mp;
+    Mp.Initialize(nPolynomial+1);
+    for (int m=0; m<nPolynomial+1; m++) {
+      for (int n=m; n<nPolynomial+1; n++) {
+        val_i = 0;
+        for (iVertexDonor=0; iVertexDonor<nDonor; iVertexDonor++) {
+          val_j = 0;
+          for (jVertexDonor=0; jVertexDonor<nDonor; jVertexDonor++) {
+            val_j += M.Read((int)iVertexDonor, (int)jVertexDonor)*P[jVertexDonor*(nPolynomial+1)+n];
+          }
+          val_i += val_j*P[iVertexDonor*(nPolynomial+1)+m];
+        }
+        Mp.Write(m, n, val_i);
+      }
+    }
+    Mp.Invert(false);
+
+    /*--- Calculate M_p*P*M_inv ---*/
+    C_inv_trunc = new su2double [(nDonor+nPolynomial+1)*nDonor];
+    for (int m=0; m<nPolynomial+1; m++) {
+      for (iVertexDonor=0; iVertexDonor<nDonor; iVertexDonor++) {
+        val_i = 0;
+        for (int n=0; n<nPolynomial+1; n++) {
+          val_j = 0;
+          for (jVertexDonor=0; jVertexDonor<nDonor; jVertexDonor++) {
+            val_j += P[jVertexDonor*(nPolynomial+1)+n]*M.Read((int)jVertexDonor, (int)iVertexDonor);
+          }
+          val_i += val_j*Mp.Read(m, n);
+        }
+        /*--- Save in row major order ---*/
+        C_inv_trunc[m*nDonor+iVertexDonor] = val_i;
+      }
+    }
+
+    /*--- Calculate (I - P'*M_p*P*M_inv) ---*/
+    vector<su2double> C_tmp(nDonor*nDonor);
+    for (iVertexDonor=0; iVertexDonor<nDonor; iVertexDonor++) {
+      for (jVertexDonor=0; jVertexDonor<nDonor; jVertexDonor++) {
+        val_i = 0;
+        for (int m=0; m<nPolynomial+1; m++) {
+          val_i += P[iVertexDonor*(nPolynomial+1)+m]*C_inv_trunc[m*nDonor+jVertexDonor];
+        }
+        /*--- Save in row major order ---*/
+        C_tmp[iVertexDonor*nDonor+jVertexDonor] = -val_i;
+
+        if (jVertexDonor==iVertexDonor) { C_tmp[iVertexDonor*nDonor+jVertexDonor] += 1; }
+      }
+    }
+
+    /*--- Calculate M_inv*(I - P'*M_p*P*M_inv) ---*/
+    M.MatMatMult(true, C_tmp.data(), (int)nDonor);
+
+    /*--- Write to C_inv_trunc matrix ---*/
+    for (iVertexDonor=0; iVertexDonor<nDonor; iVertexDonor++)
+      for (jVertexDonor=0; jVertexDonor<nDonor; jVertexDonor++)
+        C_inv_trunc[(iVertexDonor+nPolynomial+1)*nDonor+jVertexDonor] = C_tmp[iVertexDonor*nDonor+jVertexDonor];
+
+  } else { // no polynomial term used in the interpolation
+
+    C_inv_trunc = new su2double [nDonor*nDonor];
+    for (iVertexDonor=0; iVertexDonor<nDonor; iVertexDonor++)
+      for (jVertexDonor=0; jVertexDonor<nDonor; jVertexDonor++)
+        C_inv_trunc[iVertexDonor*nDonor+jVertexDonor] = M.Read((int)iVertexDonor, (int)jVertexDonor);
+
+  } // endif GetRadialBasisFunctionPolynomialOption
+
+  return C_inv_trunc;
+}
+
 void CRadialBasisFunction::Check_PolynomialTerms(int m, unsigned long n, const int *skip_row, su2double max_diff_tol_in, int *keep_row, int &n_polynomial, su2double *P)
 {
   /*--- This routine keeps the AD information in P but the calculations are done in passivedouble as their purpose
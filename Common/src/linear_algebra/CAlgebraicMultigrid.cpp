@@ -0,0 +1,606 @@
+/*!
+ * \file CAlgebraicMultigrid.cpp
+ * \brief Smoothed aggregation algebraic multigrid for block sparse matrices.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/linear_algebra/CAlgebraicMultigrid.hpp"
+#include "../../include/mpi_structure.hpp"
+#include "../../include/omp_structure.hpp"
+
+#include <limits>
+#include <cmath>
+
+namespace {
+/*--- Small dense block kernels (row major blocks of size n x n). ---*/
+
+const unsigned long UNSET = numeric_limits<unsigned long>::max();
+
+template<class T>
+void blockGemvAdd(unsigned long n, const T* a, const T* x, T* y) {
+  for (auto i = 0ul; i < n; ++i)
+    for (auto j = 0ul; j < n; ++j)
+      y[i] += a[i*n+j] * x[j];
+}
+
+template<class T>
+void blockGemvSub(unsigned long n, const T* a, const T* x, T* y) {
+  for (auto i = 0ul; i < n; ++i)
+    for (auto j = 0ul; j < n; ++j)
+      y[i] -= a[i*n+j] * x[j];
+}
+
+template<class T>
+void blockGemmAdd(unsigned long n, const T* a, const T* b, T* c) {
+  for (auto i = 0ul; i < n; ++i)
+    for (auto k = 0ul; k < n; ++k)
+      for (auto j = 0ul; j < n; ++j)
+        c[i*n+j] += a[i*n+k] * b[k*n+j];
+}
+
+template<class T>
+T blockSquaredNorm(unsigned long n, const T* a) {
+  T sum = 0.0;
+  for (auto i = 0ul; i < n*n; ++i) sum += a[i]*a[i];
+  return sum;
+}
+
+template<class T>
+bool blockInverse(unsigned long n, const T* a, T* inv) {
+  /*--- Gauss-Jordan elimination with partial pivoting on a copy of the block. ---*/
+  T work[64];
+  for (auto i = 0ul; i < n*n; ++i) work[i] = a[i];
+  for (auto i = 0ul; i < n; ++i)
+    for (auto j = 0ul; j < n; ++j)
+      inv[i*n+j] = T(i==j);
+
+  for (auto k = 0ul; k < n; ++k) {
+    auto piv = k;
+    for (auto i = k+1; i < n; ++i)
+      if (fabs(work[i*n+k]) > fabs(work[piv*n+k])) piv = i;
+    if (work[piv*n+k] == 0.0) return false;
+    if (piv != k) {
+      for (auto j = 0ul; j < n; ++j) {
+        swap(work[k*n+j], work[piv*n+j]);
+        swap(inv[k*n+j], inv[piv*n+j]);
+      }
+    }
+    const T diag = work[k*n+k];
+    for (auto j = 0ul; j < n; ++j) { work[k*n+j] /= diag; inv[k*n+j] /= diag; }
+    for (auto i = 0ul; i < n; ++i) {
+      if (i == k) continue;
+      const T f = work[i*n+k];
+      for (auto j = 0ul; j < n; ++j) {
+        work[i*n+j] -= f * work[k*n+j];
+        inv[i*n+j] -= f * inv[k*n+j];
+      }
+    }
+  }
+  return true;
+}
+}
+
+template<class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Build(unsigned long nvar, unsigned long nPointDomain, const su2localidx *row_ptr,
+                                            const su2localidx *col_ind, const ScalarType *values, bool transposed) {
+  if (nvar > 8)
+    SU2_MPI::Error("The AMG preconditioner supports at most 8 variables per point.", CURRENT_FUNCTION);
+
+  nVar = nvar;
+  const auto nBlk = nVar*nVar;
+
+  levels.clear();
+  coarse_lu.clear();
+  coarse_piv.clear();
+
+  /*--- Finest level, only the rows and columns owned by this rank. ---*/
+
+  CBlockCSR fine;
+  fine.nRows = nPointDomain;
+  fine.row_ptr.resize(nPointDomain+1, 0);
+
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    for (auto k = row_ptr[iPoint]; k < row_ptr[iPoint+1]; ++k) {
+      if (col_ind[k] >= nPointDomain) continue;
+      fine.col_ind.push_back(col_ind[k]);
+      fine.values.insert(fine.values.end(), &values[k*nBlk], &values[(k+1)*nBlk]);
+    }
+    fine.row_ptr[iPoint+1] = fine.col_ind.size();
+  }
+
+  levels.emplace_back();
+  if (transposed) Transpose(fine, nPointDomain, levels[0].A);
+  else levels[0].A = move(fine);
+  InitializeLevel(levels[0]);
+
+  /*--- Coarsen until the level is small enough or the coarsening stagnates. ---*/
+
+  while (true) {
+    auto& level = levels.back();
+
+    SetupSmoother(level);
+
+    const auto nRows = level.A.nRows;
+    if ((nRows <= MIN_COARSE_SIZE) || (levels.size() == MAX_LEVELS)) break;
+
+    vector<unsigned long> aggregate;
+    const auto nAggregates = Aggregate(level, aggregate);
+
+    if ((nAggregates == 0) || (nAggregates*5 > nRows*4)) break;
+
+    BuildProlongation(level, aggregate, nAggregates);
+    Transpose(level.P, nAggregates, level.R);
+
+    /*--- Galerkin coarse operator R * A * P. ---*/
+
+    CBlockCSR AP;
+    Multiply(level.A, level.P, nAggregates, AP);
+
+    CLevel coarse;
+    Multiply(level.R, AP, nAggregates, coarse.A);
+    InitializeLevel(coarse);
+
+    levels.push_back(move(coarse));
+  }
+
+  /*--- The coarsest level does not prolongate. ---*/
+
+  levels.back().P = CBlockCSR();
+  levels.back().R = CBlockCSR();
+
+  FactorizeCoarsest();
+}
+
+template<class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::InitializeLevel(CLevel& level) const {
+
+  const auto nRows = level.A.nRows;
+
+  level.dia_ptr.assign(nRows, UNSET);
+
+  for (auto iRow = 0ul; iRow < nRows; ++iRow) {
+    for (auto k = level.A.row_ptr[iRow]; k < level.A.row_ptr[iRow+1]; ++k) {
+      if (level.A.col_ind[k] == iRow) { level.dia_ptr[iRow] = k; break; }
+    }
+    if (level.dia_ptr[iRow] == UNSET)
+      SU2_MPI::Error("The AMG preconditioner requires all diagonal blocks to be present.", CURRENT_FUNCTION);
+  }
+
+  level.x.assign(nRows*nVar, 0.0);
+  level.b.assign(nRows*nVar, 0.0);
+  level.r.assign(nRows*nVar, 0.0);
+}
+
+template<class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::SetupSmoother(CLevel& level) const {
+
+  const auto nRows = level.A.nRows;
+  const auto nBlk = nVar*nVar;
+  const auto& A = level.A;
+
+  level.inv_diag.resize(nRows*nBlk);
+
+  for (auto iRow = 0ul; iRow < nRows; ++iRow) {
+    if (!blockInverse(nVar, &A.values[level.dia_ptr[iRow]*nBlk], &level.inv_diag[iRow*nBlk]))
+      SU2_MPI::Error("Singular diagonal block found while building the AMG preconditioner.", CURRENT_FUNCTION);
+  }
+
+  /*--- Estimate the spectral radius of D^-1 A with a few power iterations,
+   *    the weight 4/(3 rho) is used both for smoothing and for the prolongation. ---*/
+
+  vector<ScalarType> u(nRows*nVar), Au(nRows*nVar), v(nRows*nVar);
+
+  for (auto i = 0ul; i < u.size(); ++i) u[i] = 1.0 + ScalarType((i*7919) % 101) / 101.0;
+
+  ScalarType rho = 1.0;
+
+  for (int iter = 0; iter < 15; ++iter) {
+    ScalarType norm = 0.0;
+    for (auto i = 0ul; i < u.size(); ++i) norm += u[i]*u[i];
+    norm = sqrt(norm);
+    if (norm == 0.0) break;
+    for (auto& ui : u) ui /= norm;
+
+    for (auto iRow = 0ul; iRow < nRows; ++iRow) {
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) Au[iRow*nVar+iVar] = 0.0;
+      for (auto k = A.row_ptr[iRow]; k < A.row_ptr[iRow+1]; ++k)
+        blockGemvAdd(nVar, &A.values[k*nBlk], &u[A.col_ind[k]*nVar], &Au[iRow*nVar]);
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) v[iRow*nVar+iVar] = 0.0;
+      blockGemvAdd(nVar, &level.inv_diag[iRow*nBlk], &Au[iRow*nVar], &v[iRow*nVar]);
+    }
+
+    rho = 0.0;
+    for (auto i = 0ul; i < v.size(); ++i) rho += v[i]*v[i];
+    rho = sqrt(rho);
+    swap(u, v);
+  }
+
+  if (rho <= 0.0 || rho != rho) rho = 1.0;
+  level.omega = 4.0 / (3.0 * rho);
+}
+
+template<class ScalarType>
+unsigned long CAlgebraicMultigrid<ScalarType>::Aggregate(const CLevel& level, vector<unsigned long>& aggregate) const {
+
+  /*--- Threshold for strong connections |Aij| > theta * sqrt(|Aii| |Ajj|) (Frobenius norms). ---*/
+  const passivedouble theta = 0.08;
+
+  const auto nRows = level.A.nRows;
+  const auto nBlk = nVar*nVar;
+  const auto& A = level.A;
+
+  vector<ScalarType> diagNorm(nRows);
+  for (auto iRow = 0ul; iRow < nRows; ++iRow)
+    diagNorm[iRow] = sqrt(blockSquaredNorm(nVar, &A.values[level.dia_ptr[iRow]*nBlk]));
+
+  vector<bool> strong(A.col_ind.size(), false);
+  for (auto iRow = 0ul; iRow < nRows; ++iRow) {
+    for (auto k = A.row_ptr[iRow]; k < A.row_ptr[iRow+1]; ++k) {
+      const auto jRow = A.col_ind[k];
+      if (jRow == iRow) continue;
+      strong[k] = blockSquaredNorm(nVar, &A.values[k*nBlk]) > theta*theta * diagNorm[iRow]*diagNorm[jRow];
+    }
+  }
+
+  aggregate.assign(nRows, UNSET);
+  unsigned long nAggregates = 0;
+
+  /*--- Phase 1, rows whose strong neighbors are all free form new aggregates with them. ---*/
+
+  for (auto iRow = 0ul; iRow < nRows; ++iRow) {
+    if (aggregate[iRow] != UNSET) continue;
+
+    bool free = true, isolated = true;
+    for (auto k = A.row_ptr[iRow]; k < A.row_ptr[iRow+1] && free; ++k) {
+      if (!strong[k]) continue;
+      isolated = false;
+      free = (aggregate[A.col_ind[k]] == UNSET);
+    }
+    if (!free || isolated) continue;
+
+    aggregate[iRow] = nAggregates;
+    for (auto k = A.row_ptr[iRow]; k < A.row_ptr[iRow+1]; ++k)
+      if (strong[k]) aggregate[A.col_ind[k]] = nAggregates;
+    ++nAggregates;
+  }
+
+  /*--- Phase 2, remaining rows join the aggregate of their strongest aggregated neighbor. ---*/
+
+  const auto phase1 = aggregate;
+
+  for (auto iRow = 0ul; iRow < nRows; ++iRow) {
+    if (aggregate[iRow] != UNSET) continue;
+
+    ScalarType maxStrength = 0.0;
+    for (auto k = A.row_ptr[iRow]; k < A.row_ptr[iRow+1]; ++k) {
+      const auto jRow = A.col_ind[k];
+      if (!strong[k] || (phase1[jRow] == UNSET)) continue;
+      const ScalarType strength = blockSquaredNorm(nVar, &A.values[k*nBlk]);
+      if (strength > maxStrength) {
+        maxStrength = strength;
+        aggregate[iRow] = phase1[jRow];
+      }
+    }
+  }
+
+  /*--- Phase 3, what is left forms aggregates with its free strong neighbors (or alone). ---*/
+
+  for (auto iRow = 0ul; iRow < nRows; ++iRow) {
+    if (aggregate[iRow] != UNSET) continue;
+
+    aggregate[iRow] = nAggregates;
+    for (auto k = A.row_ptr[iRow]; k < A.row_ptr[iRow+1]; ++k)
+      if (strong[k] && (aggregate[A.col_ind[k]] == UNSET)) aggregate[A.col_ind[k]] = nAggregates;
+    ++nAggregates;
+  }
+
+  return nAggregates;
+}
+
+template<class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::BuildProlongation(CLevel& level, const vector<unsigned long>& aggregate,
+                                                        unsigned long nAggregates) const {
+
+  const auto nRows = level.A.nRows;
+  const auto nBlk = nVar*nVar;
+  const auto& A = level.A;
+  auto& P = level.P;
+
+  /*--- Tentative prolongation, identity blocks normalized by the size of the aggregate. ---*/
+
+  vector<ScalarType> scale(nAggregates, 0.0);
+  for (auto iRow = 0ul; iRow < nRows; ++iRow) scale[aggregate[iRow]] += 1.0;
+  for (auto& s : scale) s = 1.0 / sqrt(s);
+
+  /*--- Smoothed prolongation P = (I - omega D^-1 A) P_tent, built row by row. ---*/
+
+  P = CBlockCSR();
+  P.nRows = nRows;
+  P.row_ptr.resize(nRows+1, 0);
+
+  vector<unsigned long> marker(nAggregates, UNSET);
+  ScalarType weight[64];
+
+  for (auto iRow = 0ul; iRow < nRows; ++iRow) {
+
+    const auto start = P.col_ind.size();
+
+    auto getBlock = [&](unsigned long iAgg) {
+      if ((marker[iAgg] == UNSET) || (marker[iAgg] < start)) {
+        marker[iAgg] = P.col_ind.size();
+        P.col_ind.push_back(iAgg);
+        P.values.resize(P.values.size()+nBlk, 0.0);
+      }
+      return &P.values[marker[iAgg]*nBlk];
+    };
+
+    auto block = getBlock(aggregate[iRow]);
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) block[iVar*(nVar+1)] += scale[aggregate[iRow]];
+
+    for (auto k = A.row_ptr[iRow]; k < A.row_ptr[iRow+1]; ++k) {
+      const auto iAgg = aggregate[A.col_ind[k]];
+
+      for (auto i = 0ul; i < nBlk; ++i) weight[i] = 0.0;
+      blockGemmAdd(nVar, &level.inv_diag[iRow*nBlk], &A.values[k*nBlk], weight);
+
+      block = getBlock(iAgg);
+      for (auto i = 0ul; i < nBlk; ++i) block[i] -= level.omega * scale[iAgg] * weight[i];
+    }
+    P.row_ptr[iRow+1] = P.col_ind.size();
+  }
+}
+
+template<class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Transpose(const CBlockCSR& mat, unsigned long nCols, CBlockCSR& matT) const {
+
+  const auto nBlk = nVar*nVar;
+  const auto nnz = mat.col_ind.size();
+
+  matT = CBlockCSR();
+  matT.nRows = nCols;
+  matT.row_ptr.assign(nCols+1, 0);
+  matT.col_ind.resize(nnz);
+  matT.values.resize(nnz*nBlk);
+
+  for (auto k = 0ul; k < nnz; ++k) ++matT.row_ptr[mat.col_ind[k]+1];
+  for (auto iCol = 0ul; iCol < nCols; ++iCol) matT.row_ptr[iCol+1] += matT.row_ptr[iCol];
+
+  vector<unsigned long> pos(matT.row_ptr.begin(), matT.row_ptr.end()-1);
+
+  for (auto iRow = 0ul; iRow < mat.nRows; ++iRow) {
+    for (auto k = mat.row_ptr[iRow]; k < mat.row_ptr[iRow+1]; ++k) {
+      const auto kT = pos[mat.col_ind[k]]++;
+      matT.col_ind[kT] = iRow;
+      for (auto i = 0ul; i < nVar; ++i)
+        for (auto j = 0ul; j < nVar; ++j)
+          matT.values[kT*nBlk+j*nVar+i] = mat.values[k*nBlk+i*nVar+j];
+    }
+  }
+}
+
+template<class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Multiply(const CBlockCSR& A, const CBlockCSR& B,
+                                               unsigned long nColsB, CBlockCSR& C) const {
+
+  const auto nBlk = nVar*nVar;
+
+  C = CBlockCSR();
+  C.nRows = A.nRows;
+  C.row_ptr.resize(A.nRows+1, 0);
+
+  vector<unsigned long> marker(nColsB, UNSET);
+
+  for (auto iRow = 0ul; iRow < A.nRows; ++iRow) {
+
+    const auto start = C.col_ind.size();
+
+    for (auto kA = A.row_ptr[iRow]; kA < A.row_ptr[iRow+1]; ++kA) {
+      const auto jRow = A.col_ind[kA];
+
+      for (auto kB = B.row_ptr[jRow]; kB < B.row_ptr[jRow+1]; ++kB) {
+        const auto jCol = B.col_ind[kB];
+
+        if ((marker[jCol] == UNSET) || (marker[jCol] < start)) {
+          marker[jCol] = C.col_ind.size();
+          C.col_ind.push_back(jCol);
+          C.values.resize(C.values.size()+nBlk, 0.0);
+        }
+        blockGemmAdd(nVar, &A.values[kA*nBlk], &B.values[kB*nBlk], &C.values[marker[jCol]*nBlk]);
+      }
+    }
+    C.row_ptr[iRow+1] = C.col_ind.size();
+  }
+}
+
+template<class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::FactorizeCoarsest() {
+
+  const auto& level = levels.back();
+  const auto N = level.A.nRows*nVar;
+  const auto nBlk = nVar*nVar;
+
+  if (N > MAX_DIRECT_SIZE) return;
+
+  /*--- Dense copy of the operator. ---*/
+
+  coarse_lu.assign(N*N, 0.0);
+  coarse_piv.resize(N);
+
+  for (auto iRow = 0ul; iRow < level.A.nRows; ++iRow)
+    for (auto k = level.A.row_ptr[iRow]; k < level.A.row_ptr[iRow+1]; ++k)
+      for (auto i = 0ul; i < nVar; ++i)
+        for (auto j = 0ul; j < nVar; ++j)
+          coarse_lu[(iRow*nVar+i)*N + level.A.col_ind[k]*nVar+j] = level.A.values[k*nBlk+i*nVar+j];
+
+  /*--- LU with partial pivoting, if it fails the coarsest level is smoothed instead. ---*/
+
+  for (auto k = 0ul; k < N; ++k) {
+    auto piv = k;
+    for (auto i = k+1; i < N; ++i)
+      if (fabs(coarse_lu[i*N+k]) > fabs(coarse_lu[piv*N+k])) piv = i;
+    coarse_piv[k] = piv;
+
+    if (coarse_lu[piv*N+k] == 0.0) {
+      coarse_lu.clear();
+      coarse_piv.clear();
+      return;
+    }
+    if (piv != k)
+      for (auto j = 0ul; j < N; ++j) swap(coarse_lu[k*N+j], coarse_lu[piv*N+j]);
+
+    for (auto i = k+1; i < N; ++i) {
+      const ScalarType f = coarse_lu[i*N+k] / coarse_lu[k*N+k];
+      coarse_lu[i*N+k] = f;
+      for (auto j = k+1; j < N; ++j) coarse_lu[i*N+j] -= f * coarse_lu[k*N+j];
+    }
+  }
+}
+
+template<class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Smooth(const CLevel& level, const ScalarType* b, ScalarType* x,
+                                             unsigned long nSweeps, bool zeroGuess) const {
+
+  const auto nRows = level.A.nRows;
+  const auto nBlk = nVar*nVar;
+  const auto& A = level.A;
+  const auto omega = level.omega;
+  auto r = level.r.data();
+  const auto chunk = computeStaticChunkSize(nRows, omp_get_num_threads(), 512);
+
+  for (auto iSweep = 0ul; iSweep < nSweeps; ++iSweep) {
+
+    if ((iSweep == 0) && zeroGuess) {
+      SU2_OMP_FOR_STAT(chunk)
+      for (auto iRow = 0ul; iRow < nRows; ++iRow) {
+        for (auto iVar = 0ul; iVar < nVar; ++iVar) x[iRow*nVar+iVar] = 0.0;
+        blockGemvAdd(nVar, &level.inv_diag[iRow*nBlk], &b[iRow*nVar], &x[iRow*nVar]);
+        for (auto iVar = 0ul; iVar < nVar; ++iVar) x[iRow*nVar+iVar] *= omega;
+      }
+      continue;
+    }
+
+    /*--- Residual (all threads must finish before the update). ---*/
+
+    SU2_OMP_FOR_STAT(chunk)
+    for (auto iRow = 0ul; iRow < nRows; ++iRow) {
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) r[iRow*nVar+iVar] = b[iRow*nVar+iVar];
+      for (auto k = A.row_ptr[iRow]; k < A.row_ptr[iRow+1]; ++k)
+        blockGemvSub(nVar, &A.values[k*nBlk], &x[A.col_ind[k]*nVar], &r[iRow*nVar]);
+    }
+
+    SU2_OMP_FOR_STAT(chunk)
+    for (auto iRow = 0ul; iRow < nRows; ++iRow) {
+      ScalarType dx[8] = {0.0};
+      blockGemvAdd(nVar, &level.inv_diag[iRow*nBlk], &r[iRow*nVar], dx);
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) x[iRow*nVar+iVar] += omega * dx[iVar];
+    }
+  }
+}
+
+template<class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::VCycle(unsigned long iLevel, const ScalarType* b, ScalarType* x) const {
+
+  const auto& level = levels[iLevel];
+  const auto nRows = level.A.nRows;
+  const auto nBlk = nVar*nVar;
+
+  /*--- Coarsest level, direct solve by the master thread or smoothing. ---*/
+
+  if (iLevel+1 == levels.size()) {
+    if (coarse_lu.empty()) {
+      Smooth(level, b, x, NUM_COARSE_SMOOTH, true);
+      return;
+    }
+    SU2_OMP_BARRIER
+    SU2_OMP_MASTER
+    {
+      const auto N = nRows*nVar;
+      for (auto i = 0ul; i < N; ++i) x[i] = b[i];
+      for (auto k = 0ul; k < N; ++k) swap(x[k], x[coarse_piv[k]]);
+      for (auto i = 1ul; i < N; ++i)
+        for (auto j = 0ul; j < i; ++j) x[i] -= coarse_lu[i*N+j] * x[j];
+      for (auto i = N; i > 0ul;) {
+        --i;
+        for (auto j = i+1; j < N; ++j) x[i] -= coarse_lu[i*N+j] * x[j];
+        x[i] /= coarse_lu[i*N+i];
+      }
+    }
+    SU2_OMP_BARRIER
+    return;
+  }
+
+  const auto& coarse = levels[iLevel+1];
+  const auto chunk = computeStaticChunkSize(nRows, omp_get_num_threads(), 512);
+  const auto coarseChunk = computeStaticChunkSize(coarse.A.nRows, omp_get_num_threads(), 512);
+  auto r = level.r.data();
+  auto bc = coarse.b.data();
+  auto xc = coarse.x.data();
+
+  /*--- Pre-smoothing. ---*/
+
+  Smooth(level, b, x, NUM_SMOOTH, true);
+
+  /*--- Residual and restriction. ---*/
+
+  SU2_OMP_FOR_STAT(chunk)
+  for (auto iRow = 0ul; iRow < nRows; ++iRow) {
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) r[iRow*nVar+iVar] = b[iRow*nVar+iVar];
+    for (auto k = level.A.row_ptr[iRow]; k < level.A.row_ptr[iRow+1]; ++k)
+      blockGemvSub(nVar, &level.A.values[k*nBlk], &x[level.A.col_ind[k]*nVar], &r[iRow*nVar]);
+  }
+
+  SU2_OMP_FOR_STAT(coarseChunk)
+  for (auto iAgg = 0ul; iAgg < coarse.A.nRows; ++iAgg) {
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) bc[iAgg*nVar+iVar] = 0.0;
+    for (auto k = level.R.row_ptr[iAgg]; k < level.R.row_ptr[iAgg+1]; ++k)
+      blockGemvAdd(nVar, &level.R.values[k*nBlk], &r[level.R.col_ind[k]*nVar], &bc[iAgg*nVar]);
+  }
+
+  /*--- Coarse grid correction. ---*/
+
+  VCycle(iLevel+1, bc, xc);
+
+  SU2_OMP_FOR_STAT(chunk)
+  for (auto iRow = 0ul; iRow < nRows; ++iRow)
+    for (auto k = level.P.row_ptr[iRow]; k < level.P.row_ptr[iRow+1]; ++k)
+      blockGemvAdd(nVar, &level.P.values[k*nBlk], &xc[level.P.col_ind[k]*nVar], &x[iRow*nVar]);
+
+  /*--- Post-smoothing. ---*/
+
+  Smooth(level, b, x, NUM_SMOOTH, false);
+}
+
+template<class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Apply(const ScalarType* b, ScalarType* x) const {
+  VCycle(0, b, x);
+}
+
+/*--- Explicit instantiations ---*/
+template class CAlgebraicMultigrid<su2double>;
+#ifdef CODI_REVERSE_TYPE
+template class CAlgebraicMultigrid<passivedouble>;
+#endif
+#ifdef USE_MIXED_PRECISION
+template class CAlgebraicMultigrid<float>;
+#endif
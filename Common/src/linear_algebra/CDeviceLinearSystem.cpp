@@ -0,0 +1,259 @@
+/*!
+ * \file CDeviceLinearSystem.cpp
+ * \brief Storage and kernels of the sparse linear systems on the offload device (e.g. GPU).
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/linear_algebra/CDeviceLinearSystem.hpp"
+#include "../../include/linear_algebra/CSysMatrix.hpp"
+#include "../../include/omp_structure.hpp"
+
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+/*--- Memory management of the device, or of the host without offload support. ---*/
+
+template<class T>
+T* DeviceAlloc(size_t n) {
+  if (n == 0) return nullptr;
+#ifdef HAVE_OMP_OFFLOAD
+  void* ptr = omp_target_alloc(n*sizeof(T), omp_get_default_device());
+#else
+  void* ptr = malloc(n*sizeof(T));
+#endif
+  if (ptr == nullptr)
+    SU2_MPI::Error("Could not allocate the memory of the device linear system.", CURRENT_FUNCTION);
+  return static_cast<T*>(ptr);
+}
+
+template<class T>
+void DeviceFree(T*& ptr) {
+  if (ptr == nullptr) return;
+#ifdef HAVE_OMP_OFFLOAD
+  omp_target_free(ptr, omp_get_default_device());
+#else
+  free(ptr);
+#endif
+  ptr = nullptr;
+}
+
+template<class T>
+void CopyToDevice(const T* src, T* dst, size_t n) {
+  if (n == 0) return;
+#ifdef HAVE_OMP_OFFLOAD
+  omp_target_memcpy(dst, const_cast<T*>(src), n*sizeof(T), 0, 0,
+                    omp_get_default_device(), omp_get_initial_device());
+#else
+  memcpy(dst, src, n*sizeof(T));
+#endif
+}
+
+template<class T>
+void CopyToHost(const T* src, T* dst, size_t n) {
+  if (n == 0) return;
+#ifdef HAVE_OMP_OFFLOAD
+  omp_target_memcpy(dst, const_cast<T*>(src), n*sizeof(T), 0, 0,
+                    omp_get_initial_device(), omp_get_default_device());
+#else
+  memcpy(dst, src, n*sizeof(T));
+#endif
+}
+}
+
+template<class ScalarType>
+CDeviceLinearSystem<ScalarType>::~CDeviceLinearSystem() {
+  Clear();
+}
+
+template<class ScalarType>
+void CDeviceLinearSystem<ScalarType>::Clear() {
+  DeviceFree(row_ptr);
+  DeviceFree(col_ind);
+  DeviceFree(matrix);
+  DeviceFree(invM);
+  DeviceFree(vectors);
+  hostRowPtr = hostColInd = nullptr;
+  nVector = 0;
+}
+
+template<class ScalarType>
+void CDeviceLinearSystem<ScalarType>::SetMatrix(const CSysMatrix<ScalarType>& mat, bool newInverse,
+                                                unsigned long numVectors) {
+
+  if (mat.nVar != mat.nEqn)
+    SU2_MPI::Error("The device linear system requires square blocks.", CURRENT_FUNCTION);
+
+  /*--- (Re)Allocate and upload the pattern if it changed. ---*/
+
+  if ((mat.row_ptr != hostRowPtr) || (mat.col_ind != hostColInd) || (mat.nPoint != nPoint) ||
+      (mat.nnz != nnz) || (mat.nVar != nVar)) {
+    Clear();
+
+    nVar = mat.nVar;
+    nPoint = mat.nPoint;
+    nPointDomain = mat.nPointDomain;
+    nnz = mat.nnz;
+
+    row_ptr = DeviceAlloc<su2localidx>(nPoint+1);
+    col_ind = DeviceAlloc<su2localidx>(nnz);
+    matrix = DeviceAlloc<ScalarType>(nnz*nVar*nVar);
+    invM = DeviceAlloc<ScalarType>(nPointDomain*nVar*nVar);
+
+    CopyToDevice(mat.row_ptr, row_ptr, nPoint+1);
+    CopyToDevice(mat.col_ind, col_ind, nnz);
+
+    hostRowPtr = mat.row_ptr;
+    hostColInd = mat.col_ind;
+    newInverse = true;
+  }
+
+  if (numVectors > nVector) {
+    DeviceFree(vectors);
+    vectors = DeviceAlloc<ScalarType>(numVectors*nPoint*nVar);
+    nVector = numVectors;
+  }
+
+  CopyToDevice(mat.matrix, matrix, nnz*nVar*nVar);
+
+  if (newInverse) CopyToDevice(mat.invM, invM, nPointDomain*nVar*nVar);
+}
+
+template<class ScalarType>
+void CDeviceLinearSystem<ScalarType>::Upload(const ScalarType* src, unsigned long iVec,
+                                             unsigned long begin, unsigned long end) const {
+  CopyToDevice(src+begin, GetVector(iVec)+begin, end-begin);
+}
+
+template<class ScalarType>
+void CDeviceLinearSystem<ScalarType>::Download(unsigned long iVec, ScalarType* dst,
+                                               unsigned long begin, unsigned long end) const {
+  CopyToHost(GetVector(iVec)+begin, dst+begin, end-begin);
+}
+
+/*--- The kernels copy the members to local variables, which are then captured by the target regions. ---*/
+
+template<class ScalarType>
+void CDeviceLinearSystem<ScalarType>::MatVec(unsigned long ix, unsigned long iy) const {
+
+  const auto nVar = this->nVar;
+  const auto nPointDomain = this->nPointDomain;
+  const auto row_ptr = this->row_ptr;
+  const auto col_ind = this->col_ind;
+  const auto matrix = this->matrix;
+  const ScalarType* x = GetVector(ix);
+  ScalarType* y = GetVector(iy);
+
+  SU2_OMP_TARGET_LOOP(is_device_ptr(row_ptr, col_ind, matrix, x, y))
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (unsigned long iVar = 0; iVar < nVar; iVar++) {
+      ScalarType sum = 0.0;
+      for (auto k = row_ptr[iPoint]; k < row_ptr[iPoint+1]; k++) {
+        const ScalarType* block = &matrix[(k*nVar+iVar)*nVar];
+        const ScalarType* xj = &x[col_ind[k]*nVar];
+        for (unsigned long jVar = 0; jVar < nVar; jVar++) sum += block[jVar] * xj[jVar];
+      }
+      y[iPoint*nVar+iVar] = sum;
+    }
+  }
+}
+
+template<class ScalarType>
+void CDeviceLinearSystem<ScalarType>::Jacobi(unsigned long ix, unsigned long iy) const {
+
+  const auto nVar = this->nVar;
+  const auto nPointDomain = this->nPointDomain;
+  const auto invM = this->invM;
+  const ScalarType* x = GetVector(ix);
+  ScalarType* y = GetVector(iy);
+
+  SU2_OMP_TARGET_LOOP(is_device_ptr(invM, x, y))
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (unsigned long iVar = 0; iVar < nVar; iVar++) {
+      const ScalarType* block = &invM[(iPoint*nVar+iVar)*nVar];
+      ScalarType sum = 0.0;
+      for (unsigned long jVar = 0; jVar < nVar; jVar++) sum += block[jVar] * x[iPoint*nVar+jVar];
+      y[iPoint*nVar+iVar] = sum;
+    }
+  }
+}
+
+template<class ScalarType>
+void CDeviceLinearSystem<ScalarType>::Axpby(ScalarType a, unsigned long ix, ScalarType b, unsigned long iy) const {
+
+  const auto nElm = nPointDomain*nVar;
+  const ScalarType* x = GetVector(ix);
+  ScalarType* y = GetVector(iy);
+
+  SU2_OMP_TARGET_LOOP(is_device_ptr(x, y))
+  for (unsigned long i = 0; i < nElm; i++)
+    y[i] = a*x[i] + b*y[i];
+}
+
+template<class ScalarType>
+void CDeviceLinearSystem<ScalarType>::MultiDot(unsigned long first, unsigned long n, unsigned long iv,
+                                               ScalarType* dots) const {
+
+  const auto nElm = nPointDomain*nVar;
+  const auto stride = nPoint*nVar;
+  const ScalarType* w = GetVector(first);
+  const ScalarType* v = GetVector(iv);
+
+  for (unsigned long k = 0; k <= n; k++) dots[k] = 0.0;
+
+  /*--- All the products in one pass, v is read once and the w_k are streamed. ---*/
+
+  SU2_OMP_TARGET_LOOP(is_device_ptr(w, v) map(tofrom: dots[0:n+1]) reduction(+: dots[0:n+1]))
+  for (unsigned long i = 0; i < nElm; i++) {
+    const ScalarType vi = v[i];
+    for (unsigned long k = 0; k < n; k++) dots[k] += vi * w[k*stride+i];
+    dots[n] += vi * vi;
+  }
+}
+
+template<class ScalarType>
+void CDeviceLinearSystem<ScalarType>::MultiAxpy(unsigned long first, unsigned long n, const ScalarType* coef,
+                                                unsigned long iv) const {
+
+  const auto nElm = nPointDomain*nVar;
+  const auto stride = nPoint*nVar;
+  const ScalarType* w = GetVector(first);
+  ScalarType* v = GetVector(iv);
+
+  SU2_OMP_TARGET_LOOP(is_device_ptr(w, v) map(to: coef[0:n]))
+  for (unsigned long i = 0; i < nElm; i++) {
+    ScalarType vi = v[i];
+    for (unsigned long k = 0; k < n; k++) vi -= coef[k] * w[k*stride+i];
+    v[i] = vi;
+  }
+}
+
+/*--- Explicit instantiations ---*/
+template class CDeviceLinearSystem<su2double>;
+#ifdef CODI_REVERSE_TYPE
+template class CDeviceLinearSystem<passivedouble>;
+#endif
+#ifdef USE_MIXED_PRECISION
+template class CDeviceLinearSystem<float>;
+#endif
@@ -45,8 +45,8 @@ void CPastixWrapper::Initialize(CGeometry *geometry, CConfig *config) {
   unsigned long nVar = matrix.nVar,
                 nPoint = matrix.nPoint,
                 nPointDomain = matrix.nPointDomain;
-  const unsigned long *row_ptr = matrix.rowptr,
-                      *col_ind = matrix.colidx;
+  const su2localidx *row_ptr = matrix.rowptr,
+                    *col_ind = matrix.colidx;
 
   unsigned long iPoint, offset = 0, nNonZero = row_ptr[nPointDomain];
 
@@ -56,6 +56,8 @@ void CPastixWrapper::Initialize(CGeometry *geometry, CConfig *config) {
   colptr.resize(nPointDomain+1);
   rowidx.clear();
   rowidx.reserve(nNonZero);
+  sort_rows.clear();
+  sort_order.clear();
   values.resize(nNonZero*nVar*nVar);
   loc2glb.resize(nPointDomain);
   perm.resize(nPointDomain);
@@ -226,12 +228,12 @@ void CPastixWrapper::Factorize(CGeometry *geometry, CConfig *config,
                                unsigned short kind_fact, bool transposed) {
   using namespace PaStiX;
 
-  /*--- Detect a possible change of settings between direct and adjoint that requires a reset ---*/
+  /*--- Detect a possible change of settings between direct and adjoint that requires a reset,
+   the symbolic analysis of the incomplete factorization depends on the level of fill.
+   Otherwise the ordering and analysis of the fixed sparse pattern are kept. ---*/
   if (isinitialized)
   if ((kind_fact == PASTIX_ILU) != (iparm[IPARM_INCOMPLETE] == API_YES)) {
     Clean();
-    isinitialized = false;
-    iter = 0;
   }
 
   verb = config->GetPastixVerbLvl();
@@ -258,10 +260,15 @@ void CPastixWrapper::Factorize(CGeometry *geometry, CConfig *config,
   else
     iparm[IPARM_TRANSPOSE_SOLVE] = pastix_int_t(!transposed); // negated due to CSR to CSC copy
 
-  /*--- Is factorizing needed on this iteration? ---*/
+  /*--- Is factorizing needed on this iteration? For unsteady problems the factorization can
+   be kept for a number of time steps, it is then only computed at the first call of a step. ---*/
 
   bool factorize = false;
-  if (config->GetPastixFactFreq() != 0)
+  const auto timeFreq = config->GetTime_Domain()? config->GetPastixFactTimeFreq() : 0;
+
+  if (timeFreq != 0)
+    factorize = (config->GetTimeIter() >= factTimeIter+timeFreq);
+  else if (config->GetPastixFactFreq() != 0)
     factorize = (iter % config->GetPastixFactFreq() == 0);
 
   iter++;
@@ -324,5 +331,6 @@ void CPastixWrapper::Factorize(CGeometry *geometry, CConfig *config,
     cout << " +--------------------------------------------------------------------+" << endl << endl;
 
   isfactorized = true;
+  factTimeIter = config->GetTimeIter();
 }
 #endif
@@ -31,8 +31,10 @@
 #include "../../include/CConfig.hpp"
 #include "../../include/omp_structure.hpp"
 #include "../../include/toolboxes/allocation_toolbox.hpp"
+#include "../../include/toolboxes/CRegionProfiler.hpp"
 
 #include <cmath>
+#include <algorithm>
 
 template<class ScalarType>
 CSysMatrix<ScalarType>::CSysMatrix(void) {
@@ -43,6 +45,9 @@ CSysMatrix<ScalarType>::CSysMatrix(void) {
   nPoint = nPointDomain = nVar = nEqn = 0;
   nnz = nnz_ilu = 0;
   ilu_fill_in = 0;
+  ilu_level_sched = false;
+  diag_only = false;
+  spmv_num_send_rows = 0;
   nLinelet = 0;
 
   omp_partitions    = nullptr;
@@ -59,6 +64,11 @@ CSysMatrix<ScalarType>::CSysMatrix(void) {
 
   invM              = nullptr;
 
+  poly_degree       = 0;
+  cheby_lmin        = 0.0;
+  cheby_lmax        = 0.0;
+  SPAI_matrix       = nullptr;
+
 #ifdef USE_MKL
   MatrixMatrixProductJitter              = nullptr;
   MatrixVectorProductJitterBetaOne       = nullptr;
@@ -76,6 +86,7 @@ CSysMatrix<ScalarType>::~CSysMatrix(void) {
   if (ILU_matrix != nullptr) MemoryAllocation::aligned_free(ILU_matrix);
   if (matrix != nullptr) MemoryAllocation::aligned_free(matrix);
   if (invM != nullptr) MemoryAllocation::aligned_free(invM);
+  if (SPAI_matrix != nullptr) MemoryAllocation::aligned_free(SPAI_matrix);
 
 #ifdef USE_MKL
   if ( MatrixMatrixProductJitter != nullptr )              mkl_jit_destroy( MatrixMatrixProductJitter );
@@ -109,12 +120,14 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
   auto type = EdgeConnect? ConnectivityType::FiniteVolume : ConnectivityType::FiniteElement;
 
   /*--- Types of preconditioner the matrix will be asked to build. ---*/
-  unsigned short sol_prec = config->GetKind_Linear_Solver_Prec();
+  unsigned short sol_prec = config->GetKind_Linear_Solver_Prec(geometry->GetMGLevel());
   unsigned short def_prec = config->GetKind_Deform_Linear_Solver_Prec();
   unsigned short adj_prec = config->GetKind_DiscAdj_Linear_Prec();
   bool adjoint = config->GetDiscrete_Adjoint();
 
   bool ilu_needed = (sol_prec==ILU) || (def_prec==ILU) || (adjoint && (adj_prec==ILU));
+  bool poly_needed = (sol_prec==NEUMANN_PREC) || (sol_prec==CHEBYSHEV) || (def_prec==NEUMANN_PREC) || (def_prec==CHEBYSHEV);
+  bool spai_needed = (sol_prec==SPAI) || (def_prec==SPAI);
 
   /*--- Basic dimensions. ---*/
   nVar = nvar;
@@ -122,55 +135,67 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
   nPoint = npoint;
   nPointDomain = npointdomain;
 
+  /*--- Diagonal-only mode, the matrix is block diagonal, the pattern is owned by the matrix. ---*/
+
+  diag_only = diag_only || ((type == ConnectivityType::FiniteVolume) && config->GetJacobian_DiagonalOnly(geometry->GetMGLevel()));
+
+  if (diag_only) {
+    if (needTranspPtr) {
+      SU2_OMP_MASTER
+      SU2_MPI::Error("JACOBIAN_DIAGONAL_ONLY is not compatible with the reduction strategy used when\n"
+                     "the edge coloring is not efficient, try a different EDGE_COLORING_GROUP_SIZE.", CURRENT_FUNCTION);
+    }
+    su2vector<su2localidx> outerPtr(nPoint+1), innerIdx(nPoint);
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      outerPtr(iPoint) = iPoint;
+      innerIdx(iPoint) = iPoint;
+    }
+    outerPtr(nPoint) = nPoint;
+
+    diag_pattern = CCompressedSparsePatternLocal(move(outerPtr), move(innerIdx));
+    diag_pattern.buildDiagPtr();
+  }
+
   /*--- Get sparse structure pointers from geometry,
    *    the data is managed by CGeometry to allow re-use. ---*/
 
-  const auto& csr = geometry->GetSparsePattern(type,0);
+  const bool user = !user_pattern.empty();
+
+  const auto& csr = diag_only? diag_pattern : user? user_pattern : geometry->GetSparsePattern(type,0);
 
   nnz = csr.getNumNonZeros();
   row_ptr = csr.outerPtr();
   col_ind = csr.innerIdx();
   dia_ptr = csr.diagPtr();
 
-  if (needTranspPtr)
+  if (needTranspPtr && !diag_only && !user)
     col_ptr = geometry->GetTransposeSparsePatternMap(type).data();
 
-  if (type == ConnectivityType::FiniteVolume)
+  if ((type == ConnectivityType::FiniteVolume) && !diag_only && !user)
     edge_ptr.ptr = geometry->GetEdgeToSparsePatternMap().data();
 
   /*--- Get ILU sparse pattern, if fill is 0 no new data is allocated. --*/
 
   if(ilu_needed)
   {
-    ilu_fill_in = config->GetLinear_Solver_ILU_n();
+    ilu_fill_in = (diag_only || user)? 0 : config->GetLinear_Solver_ILU_n();
 
-    const auto& csr_ilu = geometry->GetSparsePattern(type, ilu_fill_in);
+    const auto& csr_ilu = diag_only? diag_pattern : user? user_pattern : geometry->GetSparsePattern(type, ilu_fill_in);
 
     row_ptr_ilu = csr_ilu.outerPtr();
     col_ind_ilu = csr_ilu.innerIdx();
     dia_ptr_ilu = csr_ilu.diagPtr();
     nnz_ilu = csr_ilu.getNumNonZeros();
-  }
 
-  /*--- Allocate data. ---*/
-#define ALLOC_AND_INIT(ptr,num) {\
-  ptr = MemoryAllocation::aligned_alloc<ScalarType>(64,num*sizeof(ScalarType));\
-  for(size_t k=0; k<num; ++k) ptr[k]=0.0; }
+    /*--- Group the rows of the pattern in levels of independent rows. ---*/
 
-  ALLOC_AND_INIT(matrix, nnz*nVar*nEqn)
+    ilu_level_sched = config->GetLinear_Solver_ILU_LevelScheduling();
 
-  /*--- Preconditioners. ---*/
-
-  if (ilu_needed) {
-    ALLOC_AND_INIT(ILU_matrix, nnz_ilu*nVar*nEqn)
-  }
-
-  if (ilu_needed || (sol_prec==JACOBI) || (sol_prec==LINELET) ||
-      (adjoint && (adj_prec==JACOBI)) || (def_prec==JACOBI))
-  {
-    ALLOC_AND_INIT(invM, nPointDomain*nVar*nEqn);
+    if (ilu_level_sched) {
+      ilu_lower_levels = levelScheduleSparsePattern(csr_ilu, nPointDomain, false);
+      ilu_upper_levels = levelScheduleSparsePattern(csr_ilu, nPointDomain, true);
+    }
   }
-#undef ALLOC_AND_INIT
 
   /*--- Thread parallel initialization. ---*/
 
@@ -181,6 +206,47 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
   omp_light_size = computeStaticChunkSize(nnz*nVar*nEqn, num_threads, OMP_MAX_SIZE_L);
   omp_heavy_size = computeStaticChunkSize(nPointDomain, num_threads, OMP_MAX_SIZE_H);
 
+  /*--- Allocate data. The blocks are first touched by rows (see parallelFirstTouch), with the static
+   *    schedule of the loops over rows (e.g. the factorization and application of the preconditioners). ---*/
+
+  auto allocRows = [&](const su2localidx* rowPtr, unsigned long numBlk, int category) {
+    const auto blkSize = nVar*nEqn;
+    auto ptr = MemoryAllocation::aligned_alloc<ScalarType>(64, numBlk*blkSize*sizeof(ScalarType), category);
+#ifdef HAVE_OMP
+    if (is_arithmetic<ScalarType>::value && !omp_in_parallel() && (num_threads > 1)) {
+      SU2_OMP_PARALLEL_(for schedule(static,omp_heavy_size))
+      for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+        for (auto k = rowPtr[iPoint]*blkSize; k < rowPtr[iPoint+1]*blkSize; ++k)
+          ptr[k] = 0.0;
+      return ptr;
+    }
+#endif
+    for (auto k = 0ul; k < numBlk*blkSize; ++k) ptr[k] = 0.0;
+    return ptr;
+  };
+
+  matrix = allocRows(row_ptr, nnz, MemoryAllocation::MEMORY_JACOBIAN);
+
+  /*--- Preconditioners. ---*/
+
+  if (ilu_needed) {
+    ILU_matrix = allocRows(row_ptr_ilu, nnz_ilu, MemoryAllocation::MEMORY_PRECONDITIONER);
+  }
+
+  if (spai_needed) {
+    SPAI_matrix = allocRows(row_ptr, nnz, MemoryAllocation::MEMORY_PRECONDITIONER);
+  }
+
+  if (poly_needed) poly_degree = config->GetLinear_Solver_Prec_Degree();
+
+  if (ilu_needed || poly_needed || (sol_prec==JACOBI) || (sol_prec==LINELET) ||
+      (adjoint && (adj_prec==JACOBI)) || (def_prec==JACOBI))
+  {
+    const auto num = nPointDomain*nVar*nEqn;
+    invM = MemoryAllocation::aligned_alloc<ScalarType>(64, num*sizeof(ScalarType), MemoryAllocation::MEMORY_PRECONDITIONER);
+    parallelFirstTouch(num, 0.0, invM, OMP_MAX_SIZE_H, nVar*nEqn);
+  }
+
   omp_num_parts = config->GetLinear_Solver_Prec_Threads();
   if (omp_num_parts == 0) omp_num_parts = num_threads;
 
@@ -193,6 +259,29 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
     omp_partitions[part] = part * pts_per_part;
   omp_partitions[omp_num_parts] = nPointDomain;
 
+  /*--- Classify the rows for the product, the rows whose results are sent to other ranks are computed
+   *    first, the other ones are then computed while the halo exchange is in progress. ---*/
+
+  vector<bool> isSendRow(nPointDomain, false);
+
+  if (geometry->nP2PSend > 0) {
+    for (auto iSend = 0; iSend < geometry->nPoint_P2PSend[geometry->nP2PSend]; ++iSend) {
+      const auto iPoint = geometry->Local_Point_P2PSend[iSend];
+      if (iPoint < nPointDomain) isSendRow[iPoint] = true;
+    }
+  }
+
+  spmv_row_order.clear();
+  spmv_row_order.reserve(nPointDomain);
+
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
+    if (isSendRow[iPoint]) spmv_row_order.push_back(iPoint);
+
+  spmv_num_send_rows = spmv_row_order.size();
+
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
+    if (!isSendRow[iPoint]) spmv_row_order.push_back(iPoint);
+
   /*--- Generate MKL Kernels ---*/
 
 #ifdef USE_MKL
@@ -214,6 +303,19 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
 
 }
 
+template<class ScalarType>
+void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned short nvar, unsigned short neqn,
+                                        CCompressedSparsePatternLocal pattern, CGeometry *geometry,
+                                        CConfig *config) {
+
+  /*--- The pattern must be set before the matrix is initialized (as if its pattern came from the geometry). ---*/
+
+  user_pattern = move(pattern);
+  user_pattern.buildDiagPtr();
+
+  Initialize(npoint, npoint, nvar, neqn, false, geometry, config);
+}
+
 template<class ScalarType>
 template<class OtherType>
 void CSysMatrix<ScalarType>::InitiateComms(const CSysVector<OtherType> & x,
@@ -221,6 +323,8 @@ void CSysMatrix<ScalarType>::InitiateComms(const CSysVector<OtherType> & x,
                                            CConfig *config,
                                            unsigned short commType) const {
 
+  CCommProfiler::SetKind(CCommProfiler::LINEAR_SYSTEM_COMMS);
+
   /*--- Local variables ---*/
 
   unsigned short iVar;
@@ -376,8 +480,7 @@ void CSysMatrix<ScalarType>::CompleteComms(CSysVector<OtherType> & x,
   unsigned short iVar;
   unsigned long iPoint, iRecv, nRecv, msg_offset, buf_offset;
 
-  int ind, source, iMessage, jRecv;
-  SU2_MPI::Status status;
+  int iMessage, jRecv;
 
   /*--- Set some local pointers to make access simpler. ---*/
 
@@ -391,22 +494,13 @@ void CSysMatrix<ScalarType>::CompleteComms(CSysVector<OtherType> & x,
     for (iMessage = 0; iMessage < geometry->nP2PRecv; iMessage++) {
 
       /*--- For efficiency, recv the messages dynamically based on
-       the order they arrive. ---*/
-
-      SU2_MPI::Waitany(geometry->nP2PRecv, geometry->req_P2PRecv,
-                       &ind, &status);
+       the order they arrive, we know the offsets based on the message. ---*/
 
-      /*--- Once we have recv'd a message, get the source rank. ---*/
-
-      source = status.MPI_SOURCE;
+      jRecv = geometry->WaitAnyP2PRecv();
 
       switch (commType) {
         case SOLUTION_MATRIX:
 
-          /*--- We know the offsets based on the source rank. ---*/
-
-          jRecv = geometry->P2PRecv2Neighbor[source];
-
           /*--- Get the offset for the start of this message. ---*/
 
           msg_offset = geometry->nPoint_P2PRecv[jRecv];
@@ -442,10 +536,6 @@ void CSysMatrix<ScalarType>::CompleteComms(CSysVector<OtherType> & x,
 
           bufDRecv = geometry->bufD_P2PSend;
 
-          /*--- We know the offsets based on the source rank. ---*/
-
-          jRecv = geometry->P2PSend2Neighbor[source];
-
           /*--- Get the offset for the start of this message. ---*/
 
           msg_offset = geometry->nPoint_P2PSend[jRecv];
@@ -483,14 +573,74 @@ void CSysMatrix<ScalarType>::CompleteComms(CSysVector<OtherType> & x,
      Note that this should be satisfied, as we have received all of the
      data in the loop above at this point. ---*/
 
-#ifdef HAVE_MPI
-    SU2_MPI::Waitall(geometry->nP2PSend, geometry->req_P2PSend, MPI_STATUS_IGNORE);
-#endif
+    geometry->WaitAllP2PSends();
 
   }
 
 }
 
+template<class ScalarType>
+void CSysMatrix<ScalarType>::CommunicateHalos(CSysVector<ScalarType> & x,
+                                              CGeometry *geometry,
+                                              CConfig *config) const {
+
+  /*--- Make sure the buffers are large enough, all threads need a
+   coherent view of them (and of x) before packing. ---*/
+
+  SU2_OMP_MASTER
+  if (nVar > static_cast<unsigned long>(geometry->countPerPoint)) {
+    geometry->AllocateP2PComms(nVar);
+  }
+  SU2_OMP_BARRIER
+
+  const int nSendMsg = geometry->nP2PSend;
+  const int nRecvMsg = geometry->nP2PRecv;
+  const unsigned long nSend = geometry->nPoint_P2PSend[nSendMsg];
+  const unsigned long nRecv = geometry->nPoint_P2PRecv[nRecvMsg];
+  const unsigned long countPerPoint = geometry->countPerPoint;
+
+  su2double *bufDSend = geometry->bufD_P2PSend;
+  const su2double *bufDRecv = geometry->bufD_P2PRecv;
+
+  /*--- The messages are contiguous in the buffer, the threads pack all
+   of them at once (instead of message by message as InitiateComms). ---*/
+
+  SU2_OMP_FOR_STAT(omp_light_size)
+  for (auto iSend = 0ul; iSend < nSend; iSend++) {
+    const auto iPoint = geometry->Local_Point_P2PSend[iSend];
+    for (auto iVar = 0ul; iVar < nVar; iVar++)
+      bufDSend[iSend*countPerPoint+iVar] = x[iPoint*nVar+iVar];
+  }
+
+  /*--- The master thread exchanges the messages. ---*/
+
+  SU2_OMP_MASTER
+  {
+    CCommProfiler::SetKind(CCommProfiler::LINEAR_SYSTEM_COMMS);
+    if (nSendMsg > 0) {
+      geometry->PostP2PRecvs(geometry, config, COMM_TYPE_DOUBLE, false);
+      for (int iMessage = 0; iMessage < nSendMsg; iMessage++)
+        geometry->PostP2PSends(geometry, config, COMM_TYPE_DOUBLE, iMessage, false);
+    }
+    if (nRecvMsg > 0) {
+      for (int iMessage = 0; iMessage < nRecvMsg; iMessage++)
+        geometry->WaitAnyP2PRecv();
+      geometry->WaitAllP2PSends();
+    }
+  }
+  SU2_OMP_BARRIER
+
+  /*--- Each halo point is received only once, the threads can unpack in parallel. ---*/
+
+  SU2_OMP_FOR_STAT(omp_light_size)
+  for (auto iRecv = 0ul; iRecv < nRecv; iRecv++) {
+    const auto iPoint = geometry->Local_Point_P2PRecv[iRecv];
+    for (auto iVar = 0ul; iVar < nVar; iVar++)
+      x[iPoint*nVar+iVar] = ActiveAssign<ScalarType,su2double>(bufDRecv[iRecv*countPerPoint+iVar]);
+  }
+
+}
+
 template<class ScalarType>
 void CSysMatrix<ScalarType>::SetValZero() {
   SU2_OMP_FOR_STAT(omp_light_size)
@@ -506,21 +656,19 @@ void CSysMatrix<ScalarType>::SetValDiagonalZero() {
       matrix[dia_ptr[iPoint]*nVar*nEqn + index] = 0.0;
 }
 
-template<class ScalarType>
-void CSysMatrix<ScalarType>::Gauss_Elimination(ScalarType* matrix, ScalarType* vec) const {
+namespace {
+/*--- Block size specialized versions of the Gaussian elimination and inversion (N=0 uses the runtime size). ---*/
 
-#ifdef USE_MKL_LAPACK
-  // With MKL_DIRECT_CALL enabled, this is significantly faster than native code on Intel Architectures.
-  lapack_int ipiv[MAXNVAR];
-  LAPACKE_dgetrf( LAPACK_ROW_MAJOR, nVar, nVar, matrix, nVar, ipiv);
-  LAPACKE_dgetrs( LAPACK_ROW_MAJOR, 'N', nVar, 1, matrix, nVar, ipiv, vec, 1 );
-#else
+template<class T, unsigned long N>
+void gauss_elimination_impl(const unsigned long n_, T* matrix, T* vec) {
+
+  const unsigned long nVar = N? N : n_;
 #define A(I,J) matrix[(I)*nVar+(J)]
 
   /*--- Transform system in Upper Matrix ---*/
   for (auto iVar = 1ul; iVar < nVar; iVar++) {
     for (auto jVar = 0ul; jVar < iVar; jVar++) {
-      ScalarType weight = A(iVar,jVar) / A(jVar,jVar);
+      T weight = A(iVar,jVar) / A(jVar,jVar);
       for (auto kVar = jVar; kVar < nVar; kVar++)
         A(iVar,kVar) -= weight * A(jVar,kVar);
       vec[iVar] -= weight * vec[jVar];
@@ -535,40 +683,25 @@ void CSysMatrix<ScalarType>::Gauss_Elimination(ScalarType* matrix, ScalarType* v
     vec[iVar] /= A(iVar,iVar);
   }
 #undef A
-#endif
 }
 
-template<class ScalarType>
-void CSysMatrix<ScalarType>::MatrixInverse(ScalarType *matrix, ScalarType *inverse) const {
-
-  /*--- This is a generalization of Gaussian elimination for multiple rhs' (the basis vectors).
-   We could call "Gauss_Elimination" multiple times or fully generalize it for multiple rhs,
-   the performance of both routines would suffer in both cases without the use of exotic templating.
-   And so it feels reasonable to have some duplication here. ---*/
-
-  assert((matrix != inverse) && "Output cannot be the same as the input.");
+template<class T, unsigned long N>
+void matrix_inverse_impl(const unsigned long n_, T* matrix, T* inverse) {
 
+  const unsigned long nVar = N? N : n_;
+#define A(I,J) matrix[(I)*nVar+(J)]
 #define M(I,J) inverse[(I)*nVar+(J)]
 
   /*--- Initialize the inverse with the identity. ---*/
   for (auto iVar = 0ul; iVar < nVar; iVar++)
     for (auto jVar = 0ul; jVar < nVar; jVar++)
-      M(iVar,jVar) = ScalarType(iVar==jVar);
-
-  /*--- Inversion ---*/
-#ifdef USE_MKL_LAPACK
-  // With MKL_DIRECT_CALL enabled, this is significantly faster than native code on Intel Architectures.
-  lapack_int ipiv[MAXNVAR];
-  LAPACKE_dgetrf( LAPACK_ROW_MAJOR, nVar, nVar, matrix, nVar, ipiv );
-  LAPACKE_dgetrs( LAPACK_ROW_MAJOR, 'N', nVar, nVar, matrix, nVar, ipiv, inverse, nVar );
-#else
-#define A(I,J) matrix[(I)*nVar+(J)]
+      M(iVar,jVar) = T(iVar==jVar);
 
   /*--- Transform system in Upper Matrix ---*/
   for (auto iVar = 1ul; iVar < nVar; iVar++) {
     for (auto jVar = 0ul; jVar < iVar; jVar++)
     {
-      ScalarType weight = A(iVar,jVar) / A(jVar,jVar);
+      T weight = A(iVar,jVar) / A(jVar,jVar);
 
       for (auto kVar = jVar; kVar < nVar; kVar++)
         A(iVar,kVar) -= weight * A(jVar,kVar);
@@ -583,15 +716,58 @@ void CSysMatrix<ScalarType>::MatrixInverse(ScalarType *matrix, ScalarType *inver
   for (auto iVar = nVar; iVar > 0ul;) {
     iVar--; // unsigned type
     for (auto jVar = iVar+1; jVar < nVar; jVar++)
+      BLOCK_SIMD
       for (auto kVar = 0ul; kVar < nVar; kVar++)
         M(iVar,kVar) -= A(iVar,jVar) * M(jVar,kVar);
 
+    BLOCK_SIMD
     for (auto kVar = 0ul; kVar < nVar; kVar++)
       M(iVar,kVar) /= A(iVar,iVar);
   }
+#undef M
 #undef A
+}
+}
+
+template<class ScalarType>
+void CSysMatrix<ScalarType>::Gauss_Elimination(ScalarType* matrix, ScalarType* vec) const {
+
+#ifdef USE_MKL_LAPACK
+  // With MKL_DIRECT_CALL enabled, this is significantly faster than native code on Intel Architectures.
+  lapack_int ipiv[MAXNVAR];
+  LAPACKE_dgetrf( LAPACK_ROW_MAJOR, nVar, nVar, matrix, nVar, ipiv);
+  LAPACKE_dgetrs( LAPACK_ROW_MAJOR, 'N', nVar, 1, matrix, nVar, ipiv, vec, 1 );
+#else
+#define GAUSS_KERNEL(SIZE, ...) gauss_elimination_impl<ScalarType,SIZE>(__VA_ARGS__)
+  BLOCK_SIZE_DISPATCH(nVar, GAUSS_KERNEL, nVar, matrix, vec)
+#undef GAUSS_KERNEL
+#endif
+}
+
+template<class ScalarType>
+void CSysMatrix<ScalarType>::MatrixInverse(ScalarType *matrix, ScalarType *inverse) const {
+
+  /*--- This is a generalization of Gaussian elimination for multiple rhs' (the basis vectors).
+   We could call "Gauss_Elimination" multiple times or fully generalize it for multiple rhs,
+   the performance of both routines would suffer in both cases without the use of exotic templating.
+   And so it feels reasonable to have some duplication here. ---*/
+
+  assert((matrix != inverse) && "Output cannot be the same as the input.");
+
+#ifdef USE_MKL_LAPACK
+  // With MKL_DIRECT_CALL enabled, this is significantly faster than native code on Intel Architectures.
+  for (auto iVar = 0ul; iVar < nVar; iVar++)
+    for (auto jVar = 0ul; jVar < nVar; jVar++)
+      inverse[iVar*nVar+jVar] = ScalarType(iVar==jVar);
+
+  lapack_int ipiv[MAXNVAR];
+  LAPACKE_dgetrf( LAPACK_ROW_MAJOR, nVar, nVar, matrix, nVar, ipiv );
+  LAPACKE_dgetrs( LAPACK_ROW_MAJOR, 'N', nVar, nVar, matrix, nVar, ipiv, inverse, nVar );
+#else
+#define INVERSE_KERNEL(SIZE, ...) matrix_inverse_impl<ScalarType,SIZE>(__VA_ARGS__)
+  BLOCK_SIZE_DISPATCH(nVar, INVERSE_KERNEL, nVar, matrix, inverse)
+#undef INVERSE_KERNEL
 #endif
-#undef M
 }
 
 template<class ScalarType>
@@ -640,31 +816,40 @@ void CSysMatrix<ScalarType>::MatrixVectorProduct(const CSysVector<ScalarType> &
   }
 #endif
 
+  /*--- Minimum traffic, one pass over the blocks, column indices and row pointers, and the two vectors. ---*/
+
+  SU2_PROFILE_REGION_BYTES("Matrix-vector product",
+    passivedouble(nnz*(nVar*nEqn*sizeof(ScalarType) + sizeof(su2localidx)) +
+                  nPointDomain*(sizeof(su2localidx) + nEqn*sizeof(ScalarType)) + nPoint*nVar*sizeof(ScalarType)));
+
   /*--- OpenMP parallelization. First need to make view of vectors
    *    consistent, a barrier is implicit at the end of FOR section
    *    (and it is required before master thread communicates). ---*/
 
   SU2_OMP_BARRIER
 
+  /*--- Split-phase product, first the rows that are sent to other ranks. ---*/
+
   SU2_OMP_FOR_DYN(omp_heavy_size)
-  for (auto row_i = 0ul; row_i < nPointDomain; row_i++) {
-    auto prod_begin = row_i*nVar; // offset to beginning of block row_i
-    for(auto iVar = 0ul; iVar < nVar; iVar++)
-      prod[prod_begin+iVar] = 0.0;
-    for (auto index = row_ptr[row_i]; index < row_ptr[row_i+1]; index++) {
-      auto vec_begin = col_ind[index]*nVar; // offset to beginning of block col_ind[index]
-      auto mat_begin = index*nVar*nVar; // offset to beginning of matrix block[row_i][col_ind[indx]]
-      MatrixVectorProductAdd(&matrix[mat_begin], &vec[vec_begin], &prod[prod_begin]);
-    }
+  for (auto k = 0ul; k < spmv_num_send_rows; k++) {
+    const auto row_i = spmv_row_order[k];
+    RowProduct(vec, row_i, &prod[row_i*nVar]);
   }
 
-  /*--- MPI Parallelization by master thread. ---*/
+  /*--- MPI Parallelization by master thread, the messages are posted and while
+   *    they are in flight the other threads start on the remaining rows. ---*/
 
   SU2_OMP_MASTER
-  {
-    InitiateComms(prod, geometry, config, SOLUTION_MATRIX);
-    CompleteComms(prod, geometry, config, SOLUTION_MATRIX);
+  InitiateComms(prod, geometry, config, SOLUTION_MATRIX);
+
+  SU2_OMP_FOR_DYN(omp_heavy_size)
+  for (auto k = spmv_num_send_rows; k < nPointDomain; k++) {
+    const auto row_i = spmv_row_order[k];
+    RowProduct(vec, row_i, &prod[row_i*nVar]);
   }
+
+  SU2_OMP_MASTER
+  CompleteComms(prod, geometry, config, SOLUTION_MATRIX);
   SU2_OMP_BARRIER
 }
 
@@ -725,12 +910,7 @@ void CSysMatrix<ScalarType>::ComputeJacobiPreconditioner(const CSysVector<Scalar
     MatrixVectorProduct(&(invM[iPoint*nVar*nVar]), &vec[iPoint*nVar], &prod[iPoint*nVar]);
 
   /*--- MPI Parallelization ---*/
-  SU2_OMP_MASTER
-  {
-    InitiateComms(prod, geometry, config, SOLUTION_MATRIX);
-    CompleteComms(prod, geometry, config, SOLUTION_MATRIX);
-  }
-  SU2_OMP_BARRIER
+  CommunicateHalos(prod, geometry, config);
 }
 
 template<class ScalarType>
@@ -770,6 +950,24 @@ void CSysMatrix<ScalarType>::BuildILUPreconditioner(bool transposed) {
 
   /*--- Transform system in Upper Matrix ---*/
 
+  if (ilu_level_sched) {
+
+    /*--- Level-scheduled factorization, the rows of each level only depend on rows of the
+     *    previous levels, the result is the same as for the MPI-only implementation. The
+     *    barrier at the end of each loop makes the finished rows visible to all threads. ---*/
+
+    for (auto level = 0ul; level < ilu_lower_levels.getOuterSize(); ++level) {
+
+      const auto rows = ilu_lower_levels.innerIdx(level);
+      const auto nRows = ilu_lower_levels.getNumNonZeros(level);
+
+      SU2_OMP_FOR_DYN(roundUpDiv(nRows, 2*omp_get_num_threads()))
+      for (auto k = 0ul; k < nRows; ++k)
+        FactorizeRow_ILUMatrix(rows[k], 0, nPointDomain);
+    }
+    return;
+  }
+
   /*--- OpenMP Parallelization, a loop construct is used to ensure
    *    the preconditioner is computed correctly even if called
    *    outside of a parallel section. ---*/
@@ -784,124 +982,352 @@ void CSysMatrix<ScalarType>::BuildILUPreconditioner(bool transposed) {
      *    to row/col "end-1" (i.e. the range [begin,end[). Which is exactly
      *    what the MPI-only implementation does. ---*/
 
-    ScalarType weight[MAXNVAR*MAXNVAR], aux_block[MAXNVAR*MAXNVAR];
+    for (auto iPoint = begin; iPoint < end; iPoint++)
+      FactorizeRow_ILUMatrix(iPoint, begin, end);
 
-    for (auto iPoint = begin+1; iPoint < end; iPoint++) {
-
-      /*--- Invert and store the previous diagonal block to later compute the weight. ---*/
+  } // end parallel
 
-      InverseDiagonalBlock_ILUMatrix(iPoint-1, &invM[(iPoint-1)*nVar*nVar]);
+}
 
-      /*--- For this row (unknown), loop over its lower diagonal entries. ---*/
+template<class ScalarType>
+void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+                                                      CGeometry *geometry, CConfig *config) const {
+  /*--- Coherent view of vectors. ---*/
+  SU2_OMP_BARRIER
 
-      for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
+  if (ilu_level_sched) {
 
-        /*--- jPoint is the column index (jPoint < iPoint). ---*/
+    /*--- Copy vector to then work on prod in place. ---*/
 
-        auto jPoint = col_ind_ilu[index];
+    SU2_OMP_FOR_STAT(omp_heavy_size)
+    for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++)
+      for (auto iVar = 0ul; iVar < nVar; iVar++)
+        prod[iPoint*nVar+iVar] = vec[iPoint*nVar+iVar];
 
-        /*--- We only care about the sub matrix within "begin" and "end-1". ---*/
+    /*--- Forward solve and backward substitution, level by level. ---*/
 
-        if (jPoint < begin) continue;
+    for (auto level = 0ul; level < ilu_lower_levels.getOuterSize(); ++level) {
 
-        /*--- Multiply the block by the inverse of the corresponding diagonal block. ---*/
+      const auto rows = ilu_lower_levels.innerIdx(level);
+      const auto nRows = ilu_lower_levels.getNumNonZeros(level);
 
-        auto Block_ij = &ILU_matrix[index*nVar*nVar];
-        MatrixMatrixProduct(Block_ij, &invM[jPoint*nVar*nVar], weight);
+      SU2_OMP_FOR_STAT(roundUpDiv(nRows, omp_get_num_threads()))
+      for (auto k = 0ul; k < nRows; ++k)
+        ForwardSolveRow_ILUMatrix(rows[k], 0, prod);
+    }
 
-        /*--- "weight" holds Aij*inv(Ajj). Jump to the upper part of the jPoint row. ---*/
+    for (auto level = 0ul; level < ilu_upper_levels.getOuterSize(); ++level) {
 
-        for (auto index_ = dia_ptr_ilu[jPoint]+1; index_ < row_ptr_ilu[jPoint+1]; index_++) {
+      const auto rows = ilu_upper_levels.innerIdx(level);
+      const auto nRows = ilu_upper_levels.getNumNonZeros(level);
 
-          /*--- Get the column index (kPoint > jPoint). ---*/
+      SU2_OMP_FOR_STAT(roundUpDiv(nRows, omp_get_num_threads()))
+      for (auto k = 0ul; k < nRows; ++k)
+        BackwardSolveRow_ILUMatrix(rows[k], nPointDomain, prod);
+    }
+  }
+  else {
 
-          auto kPoint = col_ind_ilu[index_];
+    /*--- OpenMP Parallelization ---*/
+    SU2_OMP_FOR_STAT(1)
+    for(unsigned long thread = 0; thread < omp_num_parts; ++thread)
+    {
+      const auto begin = omp_partitions[thread];
+      const auto end = omp_partitions[thread+1];
 
-          if (kPoint >= end) break;
+      /*--- Copy vector to then work on prod in place ---*/
 
-          /*--- If Aik exists, update it: Aik -= Aij*inv(Ajj)*Ajk ---*/
+      for (auto iVar = begin*nVar; iVar < end*nVar; iVar++)
+        prod[iVar] = vec[iVar];
 
-          auto Block_ik = GetBlock_ILUMatrix(iPoint, kPoint);
+      /*--- Forward solve the system using the lower matrix entries that
+       were computed and stored during the ILU preprocessing. Note
+       that we are overwriting the residual vector as we go. ---*/
 
-          if (Block_ik != nullptr) {
-            auto Block_jk = &ILU_matrix[index_*nVar*nVar];
-            MatrixMatrixProduct(weight, Block_jk, aux_block);
-            MatrixSubtraction(Block_ik, aux_block, Block_ik);
-          }
-        }
+      for (auto iPoint = begin+1; iPoint < end; iPoint++)
+        ForwardSolveRow_ILUMatrix(iPoint, begin, prod);
 
-        /*--- Lastly, store "weight" in the lower triangular part, which
-         will be reused during the forward solve in the precon/smoother. ---*/
+      /*--- Backwards substitution (starts at the last row) ---*/
 
-        for (auto iVar = 0ul; iVar < nVar*nVar; ++iVar)
-          Block_ij[iVar] = weight[iVar];
+      for (auto iPoint = end; iPoint > begin;) {
+        iPoint--; // unsigned type
+        BackwardSolveRow_ILUMatrix(iPoint, end, prod);
       }
-    }
-    InverseDiagonalBlock_ILUMatrix(end-1, &invM[(end-1)*nVar*nVar]);
+    } // end parallel
+  }
 
-  } // end parallel
+  /*--- MPI Parallelization ---*/
 
+  CommunicateHalos(prod, geometry, config);
 }
 
 template<class ScalarType>
-void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+void CSysMatrix<ScalarType>::BuildAMGPreconditioner(bool transposed) {
+
+  /*--- The setup is sequential (per rank), the other threads wait. ---*/
+
+  SU2_OMP_MASTER
+  amg_hierarchy.Build(nVar, nPointDomain, row_ptr, col_ind, matrix, transposed);
+  SU2_OMP_BARRIER
+}
+
+template<class ScalarType>
+void CSysMatrix<ScalarType>::ComputeAMGPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
                                                       CGeometry *geometry, CConfig *config) const {
-  /*--- Coherent view of vectors. ---*/
+
+  /*--- One V-cycle on the rank-local hierarchy, the threads share the work of each level. ---*/
+
+  amg_hierarchy.Apply(&vec[0], &prod[0]);
+
+  /*--- MPI Parallelization ---*/
+
+  CommunicateHalos(prod, geometry, config);
+}
+
+template<class ScalarType>
+void CSysMatrix<ScalarType>::BuildPolynomialPreconditioner(bool chebyshev, CGeometry *geometry, CConfig *config) {
+
+  BuildJacobiPreconditioner(false);
+
+  SU2_OMP_MASTER
+  {
+    for (auto& work : poly_work)
+      if (work.GetLocSize() != nPoint*nVar) work.Initialize(nPoint, nPointDomain, nVar, nullptr);
+  }
   SU2_OMP_BARRIER
 
-  /*--- OpenMP Parallelization ---*/
-  SU2_OMP_FOR_STAT(1)
-  for(unsigned long thread = 0; thread < omp_num_parts; ++thread)
+  if (!chebyshev) return;
+
+  /*--- Largest eigenvalue of D^{-1}A by power iterations, from a pseudo-random vector (a smooth one would
+   *    have small components along the oscillatory modes that have the largest eigenvalues). ---*/
+
+  auto& x = poly_work[0];
+  auto& Ax = poly_work[2];
+  auto& DinvAx = poly_work[3];
+
+  SU2_OMP_FOR_STAT(omp_heavy_size)
+  for (auto i = 0ul; i < nPoint*nVar; ++i)
+    x[i] = 0.5 + passivedouble((i*2654435761ul) % 1024) / 1024.0;
+
+  ScalarType lambda = 1.0;
+
+  for (int iter = 0; iter < 10; ++iter) {
+    const ScalarType norm = x.norm();
+    if (norm <= 0.0) break;
+    x *= 1.0/norm;
+    MatrixVectorProduct(x, Ax, geometry, config);
+    ComputeJacobiPreconditioner(Ax, DinvAx, geometry, config);
+    lambda = DinvAx.norm();
+    x = DinvAx;
+  }
+
+  /*--- Safety margin above the estimate, the polynomial then damps the interval below lmax/30. ---*/
+
+  SU2_OMP_MASTER
   {
-    const auto begin = omp_partitions[thread];
-    const auto end = omp_partitions[thread+1];
+    cheby_lmax = 1.1*lambda;
+    cheby_lmin = cheby_lmax/30.0;
+  }
+  SU2_OMP_BARRIER
+}
 
-    ScalarType aux_vec[MAXNVAR];
+template<class ScalarType>
+void CSysMatrix<ScalarType>::ComputeNeumannPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+                                                          CGeometry *geometry, CConfig *config) const {
+
+  /*--- prod = sum_{k=0}^{degree} (I - D^{-1}A)^k D^{-1} vec, as Jacobi iterations from prod = D^{-1} vec. ---*/
+
+  auto& res = poly_work[2];
+  auto& update = poly_work[3];
+
+  ComputeJacobiPreconditioner(vec, prod, geometry, config);
+
+  for (auto k = 0u; k < poly_degree; ++k) {
+    MatrixVectorProduct(prod, res, geometry, config);
+    res.Equals_AX_Plus_BY(1.0, vec, -1.0, res);
+    ComputeJacobiPreconditioner(res, update, geometry, config);
+    prod += update;
+  }
+}
+
+template<class ScalarType>
+void CSysMatrix<ScalarType>::ComputeChebyshevPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+                                                            CGeometry *geometry, CConfig *config) const {
+
+  /*--- Chebyshev iterations for D^{-1}A prod = D^{-1}vec from prod = 0 (Saad, Iterative Methods for Sparse
+   *    Linear Systems, Alg. 12.1), the residual is the one preconditioned by the block Jacobi method. ---*/
+
+  auto& res = poly_work[0];
+  auto& dir = poly_work[1];
+  auto& Adir = poly_work[2];
+  auto& DinvAdir = poly_work[3];
 
-    /*--- Copy vector to then work on prod in place ---*/
+  const ScalarType theta = 0.5*(cheby_lmax + cheby_lmin);
+  const ScalarType delta = 0.5*(cheby_lmax - cheby_lmin);
+  const ScalarType sigma = theta/delta;
+  ScalarType rho = 1.0/sigma;
 
-    for (auto iVar = begin*nVar; iVar < end*nVar; iVar++)
-      prod[iVar] = vec[iVar];
+  ComputeJacobiPreconditioner(vec, res, geometry, config);
+  dir.Equals_AX(1.0/theta, res);
+  prod = dir;
 
-    /*--- Forward solve the system using the lower matrix entries that
-     were computed and stored during the ILU preprocessing. Note
-     that we are overwriting the residual vector as we go. ---*/
+  for (auto k = 0u; k < poly_degree; ++k) {
+    MatrixVectorProduct(dir, Adir, geometry, config);
+    ComputeJacobiPreconditioner(Adir, DinvAdir, geometry, config);
+    res -= DinvAdir;
 
-    for (auto iPoint = begin+1; iPoint < end; iPoint++) {
-      for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
-        auto jPoint = col_ind_ilu[index];
-        if (jPoint < begin) continue;
-        auto Block_ij = &ILU_matrix[index*nVar*nVar];
-        MatrixVectorProductSub(Block_ij, &prod[jPoint*nVar], &prod[iPoint*nVar]);
+    const ScalarType rhoNew = 1.0/(2.0*sigma - rho);
+    dir.Equals_AX_Plus_BY(rhoNew*rho, dir, 2.0*rhoNew/delta, res);
+    rho = rhoNew;
+
+    prod += dir;
+  }
+}
+
+template<class ScalarType>
+void CSysMatrix<ScalarType>::BuildSPAIPreconditioner() {
+
+  if (nVar != nEqn) {
+    SU2_OMP_MASTER
+    SU2_MPI::Error("The SPAI preconditioner requires square blocks.", CURRENT_FUNCTION);
+  }
+
+  const auto blkSize = nVar*nVar;
+
+  /*--- Each block row of M, on the columns J of the row (points of the rank), solves the normal equations
+   *    sum_k M_ik G_kl = A_li^T, G_kl = sum_c A_kc A_lc^T, i.e. G X = B with X_k = M_ik^T and B_l = A_li.
+   *    G is symmetric positive definite, it is factorized by Cholesky. The rows are independent. ---*/
+
+  vector<su2localidx> cols, index;
+  vector<ScalarType> G, B;
+
+  SU2_OMP_FOR_DYN(omp_heavy_size)
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+
+    cols.clear(); index.clear();
+    for (auto k = row_ptr[iPoint]; k < row_ptr[iPoint+1]; ++k) {
+      for (auto j = 0ul; j < blkSize; ++j) SPAI_matrix[k*blkSize+j] = 0.0;
+      if (col_ind[k] < nPointDomain) {
+        cols.push_back(col_ind[k]);
+        index.push_back(k);
       }
     }
 
-    /*--- Backwards substitution (starts at the last row) ---*/
+    const auto nCol = cols.size();
+    const auto n = nCol*nVar;
+    G.assign(n*n, 0.0);
+    B.assign(n*nVar, 0.0);
+
+    for (auto a = 0ul; a < nCol; ++a) {
+      const auto rowA = cols[a];
+
+      /*--- B_a = A_{rowA,i}, the columns of a row are sorted. ---*/
+      const auto end = col_ind+row_ptr[rowA+1];
+      const auto it = lower_bound(col_ind+row_ptr[rowA], end, su2localidx(iPoint));
+      if ((it != end) && (*it == iPoint)) {
+        const ScalarType* blk = &matrix[(it-col_ind)*blkSize];
+        for (auto r = 0ul; r < nVar; ++r)
+          for (auto s = 0ul; s < nVar; ++s)
+            B[(a*nVar+r)*nVar+s] = blk[r*nVar+s];
+      }
 
-    for (auto iPoint = end; iPoint > begin;) {
-      iPoint--; // unsigned type
-      for (auto iVar = 0ul; iVar < nVar; iVar++)
-        aux_vec[iVar] = prod[iPoint*nVar+iVar];
+      /*--- Lower triangle of G, merge of the sorted columns of the two rows. ---*/
+      for (auto b = 0ul; b <= a; ++b) {
+        const auto rowB = cols[b];
+        auto ka = row_ptr[rowA], kb = row_ptr[rowB];
+
+        while ((ka < row_ptr[rowA+1]) && (kb < row_ptr[rowB+1])) {
+          if (col_ind[ka] < col_ind[kb]) { ++ka; continue; }
+          if (col_ind[kb] < col_ind[ka]) { ++kb; continue; }
+
+          const ScalarType* blkA = &matrix[ka*blkSize];
+          const ScalarType* blkB = &matrix[kb*blkSize];
+          for (auto r = 0ul; r < nVar; ++r)
+            for (auto s = 0ul; s < nVar; ++s) {
+              ScalarType sum = 0.0;
+              for (auto t = 0ul; t < nVar; ++t) sum += blkA[r*nVar+t] * blkB[s*nVar+t];
+              G[(a*nVar+r)*n + b*nVar+s] += sum;
+            }
+          ++ka; ++kb;
+        }
+      }
+    }
+
+    /*--- Cholesky factorization (in the lower triangle), with a small shift of the diagonal. ---*/
+
+    ScalarType maxDiag = 0.0;
+    for (auto j = 0ul; j < n; ++j) maxDiag = (G[j*n+j] > maxDiag)? G[j*n+j] : maxDiag;
+    for (auto j = 0ul; j < n; ++j) G[j*n+j] += 1e-8*maxDiag;
 
-      for (auto index = dia_ptr_ilu[iPoint]+1; index < row_ptr_ilu[iPoint+1]; index++) {
-        auto jPoint = col_ind_ilu[index];
-        if (jPoint >= end) break;
-        auto Block_ij = &ILU_matrix[index*nVar*nVar];
-        MatrixVectorProductSub(Block_ij, &prod[jPoint*nVar], aux_vec);
+    bool positive = (maxDiag > 0.0);
+
+    for (auto j = 0ul; (j < n) && positive; ++j) {
+      ScalarType d = G[j*n+j];
+      for (auto k = 0ul; k < j; ++k) d -= G[j*n+k]*G[j*n+k];
+      if (d <= 0.0) { positive = false; break; }
+      G[j*n+j] = sqrt(d);
+      for (auto i = j+1; i < n; ++i) {
+        ScalarType sum = G[i*n+j];
+        for (auto k = 0ul; k < j; ++k) sum -= G[i*n+k]*G[j*n+k];
+        G[i*n+j] = sum / G[j*n+j];
       }
+    }
+
+    /*--- If the normal equations are not well posed the row falls back to the block Jacobi inverse. ---*/
 
-      MatrixVectorProduct(&invM[iPoint*nVar*nVar], aux_vec, &prod[iPoint*nVar]);
+    if (!positive) {
+      InverseDiagonalBlock(iPoint, &SPAI_matrix[dia_ptr[iPoint]*blkSize]);
+      continue;
     }
-  } // end parallel
 
-  /*--- MPI Parallelization ---*/
+    /*--- Forward and backward substitution for each column of B. ---*/
 
-  SU2_OMP_MASTER
-  {
-    InitiateComms(prod, geometry, config, SOLUTION_MATRIX);
-    CompleteComms(prod, geometry, config, SOLUTION_MATRIX);
+    for (auto s = 0ul; s < nVar; ++s) {
+      for (auto i = 0ul; i < n; ++i) {
+        ScalarType sum = B[i*nVar+s];
+        for (auto k = 0ul; k < i; ++k) sum -= G[i*n+k]*B[k*nVar+s];
+        B[i*nVar+s] = sum / G[i*n+i];
+      }
+      for (auto i = n; i-- > 0;) {
+        ScalarType sum = B[i*nVar+s];
+        for (auto k = i+1; k < n; ++k) sum -= G[k*n+i]*B[k*nVar+s];
+        B[i*nVar+s] = sum / G[i*n+i];
+      }
+    }
+
+    /*--- M_ik = X_k^T. ---*/
+
+    for (auto a = 0ul; a < nCol; ++a) {
+      ScalarType* blk = &SPAI_matrix[index[a]*blkSize];
+      for (auto r = 0ul; r < nVar; ++r)
+        for (auto s = 0ul; s < nVar; ++s)
+          blk[r*nVar+s] = B[(a*nVar+s)*nVar+r];
+    }
   }
+}
+
+template<class ScalarType>
+void CSysMatrix<ScalarType>::ComputeSPAIPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+                                                       CGeometry *geometry, CConfig *config) const {
+
+  /*--- Sparse product with M, the blocks of the halo columns are zero and skipped. ---*/
+
   SU2_OMP_BARRIER
+  SU2_OMP_FOR_DYN(omp_heavy_size)
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+    ScalarType* prod_i = &prod[iPoint*nVar];
+    for (auto iVar = 0ul; iVar < nVar; iVar++) prod_i[iVar] = 0.0;
+
+    for (auto k = row_ptr[iPoint]; k < row_ptr[iPoint+1]; ++k) {
+      const auto jPoint = col_ind[k];
+      if (jPoint < nPointDomain)
+        MatrixVectorProductAdd(&SPAI_matrix[k*nVar*nVar], &vec[jPoint*nVar], prod_i);
+    }
+  }
+
+  /*--- MPI Parallelization ---*/
+
+  CommunicateHalos(prod, geometry, config);
 }
 
 template<class ScalarType>
@@ -936,12 +1362,7 @@ void CSysMatrix<ScalarType>::ComputeLU_SGSPreconditioner(const CSysVector<Scalar
   } // end parallel
 
   /*--- MPI Parallelization ---*/
-  SU2_OMP_MASTER
-  {
-    InitiateComms(prod, geometry, config, SOLUTION_MATRIX);
-    CompleteComms(prod, geometry, config, SOLUTION_MATRIX);
-  }
-  SU2_OMP_BARRIER
+  CommunicateHalos(prod, geometry, config);
 
   /*--- Second part of the symmetric iteration: (D+U).x_(1) = D.x* ---*/
 
@@ -968,12 +1389,7 @@ void CSysMatrix<ScalarType>::ComputeLU_SGSPreconditioner(const CSysVector<Scalar
   } // end parallel
 
   /*--- MPI Parallelization ---*/
-  SU2_OMP_MASTER
-  {
-    InitiateComms(prod, geometry, config, SOLUTION_MATRIX);
-    CompleteComms(prod, geometry, config, SOLUTION_MATRIX);
-  }
-  SU2_OMP_BARRIER
+  CommunicateHalos(prod, geometry, config);
 }
 
 template<class ScalarType>
@@ -981,166 +1397,96 @@ unsigned long CSysMatrix<ScalarType>::BuildLineletPreconditioner(CGeometry *geom
 
   assert(omp_get_thread_num()==0 && "Linelet preconditioner cannot be built by multiple threads.");
 
-  bool add_point;
-  unsigned long iEdge, iPoint, jPoint, index_Point, iLinelet, iVertex, next_Point, counter, iElem;
-  unsigned short iMarker, iNode;
-  su2double alpha = 0.9, weight, max_weight, *normal, area, volume_iPoint, volume_jPoint;
-  unsigned long Local_nPoints, Local_nLineLets, Global_nPoints, Global_nLineLets, max_nElem;
+  /*--- The linelets depend only on the grid, they are computed once and shared by the solvers. ---*/
 
-  /*--- Memory allocation --*/
+  LineletPoint = geometry->GetLinelets(config);
+  nLinelet = LineletPoint.size();
 
-  vector<bool> check_Point(nPoint,true);
+  /*--- Identify the points that belong to a Linelet, and the storage of the factorization. ---*/
 
   LineletBool.clear();
   LineletBool.resize(nPoint,false);
 
-  nLinelet = 0;
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-    if ((config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX              ) ||
-        (config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL             ) ||
-        (config->GetMarker_All_KindBC(iMarker) == EULER_WALL             ) ||
-        (config->GetMarker_All_KindBC(iMarker) == DISPLACEMENT_BOUNDARY)) {
-      nLinelet += geometry->nVertex[iMarker];
-    }
-  }
-
-  /*--- If the domain contains well defined Linelets ---*/
-
-  if (nLinelet != 0) {
+  LineletPtr.resize(nLinelet+1);
+  LineletPtr[0] = 0;
 
-    /*--- Basic initial allocation ---*/
+  unsigned long max_nElem = 0;
 
-    LineletPoint.resize(nLinelet);
-
-    /*--- Define the basic linelets, starting from each vertex ---*/
+  for (auto iLinelet = 0ul; iLinelet < nLinelet; iLinelet++) {
+    for (auto iPoint : LineletPoint[iLinelet]) LineletBool[iPoint] = true;
+    max_nElem = max<unsigned long>(max_nElem, LineletPoint[iLinelet].size());
+    LineletPtr[iLinelet+1] = LineletPtr[iLinelet] + LineletPoint[iLinelet].size();
+  }
 
-    iLinelet = 0;
+  unsigned long Local_nPoints = LineletPtr[nLinelet];
 
-    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-      if ((config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX              ) ||
-          (config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL             ) ||
-          (config->GetMarker_All_KindBC(iMarker) == EULER_WALL             ) ||
-          (config->GetMarker_All_KindBC(iMarker) == DISPLACEMENT_BOUNDARY))
-      {
-        for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-          LineletPoint[iLinelet].push_back(iPoint);
-          check_Point[iPoint] = false;
-          iLinelet++;
-        }
-      }
-    }
+  LineletUpper.assign(Local_nPoints, nullptr);
+  LineletInvDiag.assign(Local_nPoints*nVar*nVar, 0.0);
+  LineletWeight.assign(Local_nPoints*nVar*nVar, 0.0);
 
-    /*--- Create the linelet structure ---*/
-
-    iLinelet = 0;
+  /*--- Screen output ---*/
 
-    do {
+  unsigned long Local_nLineLets = nLinelet, Global_nPoints, Global_nLineLets;
 
-      index_Point = 0;
+  SU2_MPI::Allreduce(&Local_nPoints, &Global_nPoints, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&Local_nLineLets, &Global_nLineLets, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
 
-      do {
+  /*--- Memory allocation --*/
 
-        /*--- Compute the value of the max weight ---*/
+  LineletVector.resize(omp_get_max_threads(), vector<ScalarType>(max_nElem*nVar,0.0));
 
-        iPoint = LineletPoint[iLinelet][index_Point];
-        max_weight = 0.0;
-        for (iNode = 0; iNode < geometry->node[iPoint]->GetnPoint(); iNode++) {
-          jPoint = geometry->node[iPoint]->GetPoint(iNode);
-          if ((check_Point[jPoint]) && geometry->node[jPoint]->GetDomain()) {
-            iEdge = geometry->FindEdge(iPoint, jPoint);
-            normal = geometry->edge[iEdge]->GetNormal();
-            if (geometry->GetnDim() == 3) area = sqrt(normal[0]*normal[0]+normal[1]*normal[1]+normal[2]*normal[2]);
-            else area = sqrt(normal[0]*normal[0]+normal[1]*normal[1]);
-            volume_iPoint = geometry->node[iPoint]->GetVolume();
-            volume_jPoint = geometry->node[jPoint]->GetVolume();
-            weight = 0.5*area*((1.0/volume_iPoint)+(1.0/volume_jPoint));
-            max_weight = max(max_weight, weight);
-          }
-        }
+  return (unsigned long)(passivedouble(Global_nPoints) / max<unsigned long>(Global_nLineLets,1));
 
-        /*--- Verify if any face of the control volume must be added ---*/
-
-        add_point = false;
-        counter = 0;
-        next_Point = geometry->node[iPoint]->GetPoint(0);
-        for (iNode = 0; iNode < geometry->node[iPoint]->GetnPoint(); iNode++) {
-          jPoint = geometry->node[iPoint]->GetPoint(iNode);
-          iEdge = geometry->FindEdge(iPoint, jPoint);
-          normal = geometry->edge[iEdge]->GetNormal();
-          if (geometry->GetnDim() == 3) area = sqrt(normal[0]*normal[0]+normal[1]*normal[1]+normal[2]*normal[2]);
-          else area = sqrt(normal[0]*normal[0]+normal[1]*normal[1]);
-          volume_iPoint = geometry->node[iPoint]->GetVolume();
-          volume_jPoint = geometry->node[jPoint]->GetVolume();
-          weight = 0.5*area*((1.0/volume_iPoint)+(1.0/volume_jPoint));
-          if (((check_Point[jPoint]) && (weight/max_weight > alpha) && (geometry->node[jPoint]->GetDomain())) &&
-              ((index_Point == 0) || ((index_Point > 0) && (jPoint != LineletPoint[iLinelet][index_Point-1])))) {
-            add_point = true;
-            next_Point = jPoint;
-            counter++;
-          }
-        }
+}
 
-        /*--- We have arrived to an isotropic zone ---*/
+template<class ScalarType>
+void CSysMatrix<ScalarType>::BuildLineletFactorization() {
 
-        if (counter > 1) add_point = false;
+  /*--- Block LU factorization (Thomas algorithm) of the tri-diagonal system of each linelet,
+   *    the applications of the preconditioner only do the forward and backward substitutions. ---*/
 
-        /*--- Add a typical point to the linelet, no leading edge ---*/
+  SU2_OMP_FOR_DYN(1)
+  for (auto iLinelet = 0ul; iLinelet < nLinelet; iLinelet++) {
 
-        if (add_point) {
-          LineletPoint[iLinelet].push_back(next_Point);
-          check_Point[next_Point] = false;
-          index_Point++;
-        }
+    const auto& linelet = LineletPoint[iLinelet];
+    const auto nElem = linelet.size();
+    const auto offset = LineletPtr[iLinelet];
 
-      } while (add_point);
-      iLinelet++;
-    } while (iLinelet < nLinelet);
+    ScalarType aux_block[MAXNVAR*MAXNVAR];
 
-    /*--- Identify the points that belong to a Linelet ---*/
+    /*--- Copy diagonal block for first point in this linelet. ---*/
+    MatrixCopy(&matrix[dia_ptr[linelet[0]]*nVar*nVar], aux_block);
 
-    for (iLinelet = 0; iLinelet < nLinelet; iLinelet++) {
-      for (iElem = 0; iElem < LineletPoint[iLinelet].size(); iElem++) {
-        iPoint = LineletPoint[iLinelet][iElem];
-        LineletBool[iPoint] = true;
-      }
-    }
+    for (auto iElem = 0ul; iElem < nElem; iElem++) {
 
-    /*--- Identify the maximum number of elements in a Linelet ---*/
+      auto inv_d = &LineletInvDiag[(offset+iElem)*nVar*nVar];
 
-    max_nElem = LineletPoint[0].size();
-    for (iLinelet = 1; iLinelet < nLinelet; iLinelet++)
-      if (LineletPoint[iLinelet].size() > max_nElem)
-        max_nElem = LineletPoint[iLinelet].size();
+      /*--- Invert current modified diagonal, aux_block holds it. ---*/
+      MatrixInverse(aux_block, inv_d);
 
-  }
+      if (iElem+1 == nElem) break;
 
-  /*--- The domain doesn't have well defined linelets ---*/
+      /*--- Setup pointers to the blocks coupling with the next point ---*/
+      const auto iPoint = linelet[iElem];
+      const auto ip1Point = linelet[iElem+1];
 
-  else {
+      const auto d = &matrix[dia_ptr[ip1Point]*nVar*nVar];
+      const auto l = GetBlock(ip1Point, iPoint);
+      const auto u = GetBlock(iPoint, ip1Point);
 
-    max_nElem = 0;
+      auto weight = &LineletWeight[(offset+iElem+1)*nVar*nVar];
 
-  }
+      /*--- Left-multiply by lower block to obtain the weight ---*/
+      MatrixMatrixProduct(l, inv_d, weight);
 
-  /*--- Screen output ---*/
+      /*--- Multiply weight by upper block to modify next diagonal ---*/
+      MatrixMatrixProduct(weight, u, aux_block);
+      MatrixSubtraction(d, aux_block, aux_block);
 
-  Local_nPoints = 0;
-  for (iLinelet = 0; iLinelet < nLinelet; iLinelet++) {
-    Local_nPoints += LineletPoint[iLinelet].size();
+      /*--- Cache upper block pointer for the backward substitution phase ---*/
+      LineletUpper[offset+iElem] = u;
+    }
   }
-  Local_nLineLets = nLinelet;
-
-  SU2_MPI::Allreduce(&Local_nPoints, &Global_nPoints, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&Local_nLineLets, &Global_nLineLets, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
-
-  /*--- Memory allocation --*/
-
-  LineletUpper.resize(omp_get_max_threads(), vector<const ScalarType*>(max_nElem,nullptr));
-  LineletVector.resize(omp_get_max_threads(), vector<ScalarType>(max_nElem*nVar,0.0));
-  LineletInvDiag.resize(omp_get_max_threads(), vector<ScalarType>(max_nElem*nVar*nVar,0.0));
-
-  return (unsigned long)(passivedouble(Global_nPoints) / Global_nLineLets);
 
 }
 
@@ -1157,101 +1503,52 @@ void CSysMatrix<ScalarType>::ComputeLineletPreconditioner(const CSysVector<Scala
     if (!LineletBool[iPoint])
       MatrixVectorProduct(&(invM[iPoint*nVar*nVar]), &vec[iPoint*nVar], &prod[iPoint*nVar]);
 
-  /*--- Solve each linelet using the Thomas algorithm ---*/
+  /*--- Solve each linelet with the factorization of its tri-diagonal system, the
+   *    linelets are sorted by decreasing length to balance the dynamic schedule. ---*/
 
   SU2_OMP_FOR_DYN(1)
   for (auto iLinelet = 0ul; iLinelet < nLinelet; iLinelet++) {
 
-    /*--- Get references to the working vectors allocated for this thread. ---*/
+    /*--- Get reference to the working vector allocated for this thread. ---*/
 
-    int thread = omp_get_thread_num();
-    vector<const ScalarType*>& lineletUpper = LineletUpper[thread];
-    vector<ScalarType>& lineletInvDiag = LineletInvDiag[thread];
-    vector<ScalarType>& lineletVector = LineletVector[thread];
+    vector<ScalarType>& lineletVector = LineletVector[omp_get_thread_num()];
 
-    /*--- Initialize the solution vector with the rhs ---*/
+    const auto& linelet = LineletPoint[iLinelet];
+    const auto nElem = linelet.size();
+    const auto offset = LineletPtr[iLinelet];
 
-    auto nElem = LineletPoint[iLinelet].size();
+    /*--- Forward pass, b_i = r_i - w_i * b_{i-1}. ---*/
 
-    for (auto iElem = 0ul; iElem < nElem; iElem++) {
-      auto iPoint = LineletPoint[iLinelet][iElem];
-      for (auto iVar = 0ul; iVar < nVar; iVar++)
-        lineletVector[iElem*nVar+iVar] = vec[iPoint*nVar+iVar];
-    }
-
-    /*--- Forward pass, eliminate lower entries, modify diagonal and rhs. ---*/
-
-    /*--- Small temporaries. ---*/
-    ScalarType aux_block[MAXNVAR*MAXNVAR], aux_vector[MAXNVAR];
-
-    /*--- Copy diagonal block for first point in this linelet. ---*/
-    MatrixCopy(&matrix[dia_ptr[LineletPoint[iLinelet][0]]*nVar*nVar],
-               lineletInvDiag.data());
+    for (auto iVar = 0ul; iVar < nVar; iVar++)
+      lineletVector[iVar] = vec[linelet[0]*nVar+iVar];
 
     for (auto iElem = 1ul; iElem < nElem; iElem++) {
-
-      /*--- Setup pointers to required matrices and vectors ---*/
-      auto im1Point = LineletPoint[iLinelet][iElem-1];
-      auto iPoint = LineletPoint[iLinelet][iElem];
-
-      auto d = &matrix[dia_ptr[iPoint]*nVar*nVar];
-      auto l = GetBlock(iPoint, im1Point);
-      auto u = GetBlock(im1Point, iPoint);
-
-      auto inv_dm1 = &lineletInvDiag[(iElem-1)*nVar*nVar];
-      auto d_prime = &lineletInvDiag[iElem*nVar*nVar];
       auto b_prime = &lineletVector[iElem*nVar];
-
-      /*--- Invert previous modified diagonal ---*/
-      MatrixCopy(inv_dm1, aux_block);
-      MatrixInverse(aux_block, inv_dm1);
-
-      /*--- Left-multiply by lower block to obtain the weight ---*/
-      MatrixMatrixProduct(l, inv_dm1, aux_block);
-
-      /*--- Multiply weight by upper block to modify current diagonal ---*/
-      MatrixMatrixProduct(aux_block, u, d_prime);
-      MatrixSubtraction(d, d_prime, d_prime);
-
-      /*--- Update the rhs ---*/
-      MatrixVectorProduct(aux_block, &lineletVector[(iElem-1)*nVar], aux_vector);
-      VectorSubtraction(b_prime, aux_vector, b_prime);
-
-      /*--- Cache upper block pointer for the backward substitution phase ---*/
-      lineletUpper[iElem-1] = u;
+      for (auto iVar = 0ul; iVar < nVar; iVar++)
+        b_prime[iVar] = vec[linelet[iElem]*nVar+iVar];
+      MatrixVectorProductSub(&LineletWeight[(offset+iElem)*nVar*nVar], &lineletVector[(iElem-1)*nVar], b_prime);
     }
 
-    /*--- Backwards substitution, LineletVector becomes the solution ---*/
+    /*--- Backwards substitution, the result goes directly to the product vector. ---*/
 
     /*--- x_n = d_n^{-1} * b_n ---*/
-    Gauss_Elimination(&lineletInvDiag[(nElem-1)*nVar*nVar], &lineletVector[(nElem-1)*nVar]);
+    auto iPoint = linelet[nElem-1];
+    MatrixVectorProduct(&LineletInvDiag[(offset+nElem-1)*nVar*nVar], &lineletVector[(nElem-1)*nVar], &prod[iPoint*nVar]);
 
     /*--- x_i = d_i^{-1}*(b_i - u_i*x_{i+1}) ---*/
     for (auto iElem = nElem-1; iElem > 0; --iElem) {
-      auto inv_dm1 = &lineletInvDiag[(iElem-1)*nVar*nVar];
-      MatrixVectorProduct(lineletUpper[iElem-1], &lineletVector[iElem*nVar], aux_vector);
-      VectorSubtraction(&lineletVector[(iElem-1)*nVar], aux_vector, aux_vector);
-      MatrixVectorProduct(inv_dm1, aux_vector, &lineletVector[(iElem-1)*nVar]);
-    }
-
-    /*--- Copy results to product vector ---*/
-
-    for (auto iElem = 0ul; iElem < nElem; iElem++) {
-      auto iPoint = LineletPoint[iLinelet][iElem];
-      for (auto iVar = 0ul; iVar < nVar; iVar++)
-        prod[iPoint*nVar+iVar] = lineletVector[iElem*nVar+iVar];
+      const auto ip1Point = iPoint;
+      iPoint = linelet[iElem-1];
+      auto b_prime = &lineletVector[(iElem-1)*nVar];
+      MatrixVectorProductSub(LineletUpper[offset+iElem-1], &prod[ip1Point*nVar], b_prime);
+      MatrixVectorProduct(&LineletInvDiag[(offset+iElem-1)*nVar*nVar], b_prime, &prod[iPoint*nVar]);
     }
 
   }
 
   /*--- MPI Parallelization ---*/
 
-  SU2_OMP_MASTER
-  {
-    InitiateComms(prod, geometry, config, SOLUTION_MATRIX);
-    CompleteComms(prod, geometry, config, SOLUTION_MATRIX);
-  }
-  SU2_OMP_BARRIER
+  CommunicateHalos(prod, geometry, config);
 
 }
 
@@ -1398,6 +1695,21 @@ void CSysMatrix<su2double>::ComputePastixPreconditioner(const CSysVector<su2doub
 }
 #endif
 
+#ifdef USE_MIXED_PRECISION
+template<>
+void CSysMatrix<float>::BuildPastixPreconditioner(CGeometry *geometry, CConfig *config,
+                                                  unsigned short kind_fact, bool transposed) {
+  SU2_OMP_MASTER
+  SU2_MPI::Error("The PaStiX preconditioner is not available with mixed precision", CURRENT_FUNCTION);
+}
+template<>
+void CSysMatrix<float>::ComputePastixPreconditioner(const CSysVector<float> & vec, CSysVector<float> & prod,
+                                                    CGeometry *geometry, CConfig *config) const {
+  SU2_OMP_MASTER
+  SU2_MPI::Error("The PaStiX preconditioner is not available with mixed precision", CURRENT_FUNCTION);
+}
+#endif
+
 /*--- Explicit instantiations ---*/
 template class CSysMatrix<su2double>;
 template void  CSysMatrix<su2double>::InitiateComms(const CSysVector<su2double>&, CGeometry*, CConfig*, unsigned short) const;
@@ -1416,3 +1728,13 @@ template void  CSysMatrix<passivedouble>::EnforceSolutionAtNode(unsigned long, c
 template void  CSysMatrix<passivedouble>::MatrixMatrixAddition(passivedouble, const CSysMatrix<passivedouble>&);
 template void  CSysMatrix<passivedouble>::MatrixMatrixAddition(su2double, const CSysMatrix<su2double>&);
 #endif
+
+#ifdef USE_MIXED_PRECISION
+template class CSysMatrix<float>;
+template void  CSysMatrix<float>::InitiateComms(const CSysVector<float>&, CGeometry*, CConfig*, unsigned short) const;
+template void  CSysMatrix<float>::CompleteComms(CSysVector<float>&, CGeometry*, CConfig*, unsigned short) const;
+template void  CSysMatrix<float>::EnforceSolutionAtNode(unsigned long, const float*, CSysVector<float>&);
+template void  CSysMatrix<float>::EnforceSolutionAtNode(unsigned long, const su2double*, CSysVector<su2double>&);
+template void  CSysMatrix<float>::MatrixMatrixAddition(float, const CSysMatrix<float>&);
+template void  CSysMatrix<float>::MatrixMatrixAddition(su2double, const CSysMatrix<su2double>&);
+#endif
@@ -28,6 +28,8 @@
 #include "../../include/linear_algebra/CSysSolve.hpp"
 #include "../../include/linear_algebra/CSysSolve_b.hpp"
 #include "../../include/omp_structure.hpp"
+#include "../../include/toolboxes/CRegionProfiler.hpp"
+#include "../../include/toolboxes/allocation_toolbox.hpp"
 #include "../../include/option_structure.hpp"
 #include "../../include/CConfig.hpp"
 #include "../../include/geometry/CGeometry.hpp"
@@ -41,11 +43,18 @@ const su2double eps = numeric_limits<passivedouble>::epsilon(); /*!< \brief mach
 
 template<class ScalarType>
 CSysSolve<ScalarType>::CSysSolve(const bool mesh_deform_mode) : cg_ready(false), bcg_ready(false),
-                                                                gmres_ready(false), smooth_ready(false) {
+                                                                gmres_ready(false), smooth_ready(false),
+                                                                gcro_ready(false), nRecycled(0), oldestRecycled(0) {
   mesh_deform = mesh_deform_mode;
   LinSysRes_ptr = nullptr;
   LinSysSol_ptr = nullptr;
   Residual = 0.0;
+  PrecondAge = 0;
+  PrecondIter = 0;
+  PrecondRebuild = true;
+  MatrixUnchanged = false;
+  Tolerance = 0.0;
+  ResNorm_Old = 0.0;
 }
 
 template<class ScalarType>
@@ -123,21 +132,24 @@ void CSysSolve<ScalarType>::ModGramSchmidt(int i, vector<vector<ScalarType> > &
     SU2_MPI::Error("FGMRES orthogonalization failed, linear solver diverged.", CURRENT_FUNCTION);
   }
 
-  /*--- Begin main Gram-Schmidt loop ---*/
+  /*--- Begin main Gram-Schmidt loop, each update of w[i+1] is fused with the
+   *    product needed next (with w[k+1], or the norm after the last direction). ---*/
+
+  ScalarType prod = w[i+1].dot(w[0]);
 
   for (int k = 0; k < i+1; k++) {
-    ScalarType prod = w[i+1].dot(w[k]);
     Hsbg[k][i] = prod;
-    w[i+1].Plus_AX(-prod, w[k]);
 
     /*--- Check if reorthogonalization is necessary ---*/
 
     if (prod*prod > thr) {
-      prod = w[i+1].dot(w[k]);
+      prod = w[i+1].Plus_AX_Dot(-prod, w[k], w[k]);
       Hsbg[k][i] += prod;
-      w[i+1].Plus_AX(-prod, w[k]);
     }
 
+    const auto& next = (k < i)? w[k+1] : w[i+1];
+    prod = w[i+1].Plus_AX_Dot(-prod, w[k], next);
+
     /*--- Update the norm and check its size ---*/
 
     nrm -= Hsbg[k][i]*Hsbg[k][i];
@@ -147,7 +159,7 @@ void CSysSolve<ScalarType>::ModGramSchmidt(int i, vector<vector<ScalarType> > &
 
   /*--- Test the resulting vector ---*/
 
-  nrm = w[i+1].norm();
+  nrm = sqrt(prod);
   Hsbg[i+1][i] = nrm;
 
   /*--- Scale the resulting vector ---*/
@@ -156,6 +168,101 @@ void CSysSolve<ScalarType>::ModGramSchmidt(int i, vector<vector<ScalarType> > &
 
 }
 
+template<class ScalarType>
+void CSysSolve<ScalarType>::MultiDot(int i, const vector<CSysVector<ScalarType> > & w,
+                                     ScalarType* dots) const {
+
+  const int nDots = i+2;
+  const auto& wi = w[i+1];
+  const auto nElmDomain = wi.GetNElmDomain();
+
+  /*--- All threads get the same "view" of the vectors and shared results. ---*/
+  SU2_OMP_BARRIER
+  SU2_OMP_MASTER
+  for (int k = 0; k < nDots; k++) cgs_dots[k] = 0.0;
+  SU2_OMP_BARRIER
+
+  /*--- Local dot products for each thread, the vector being orthogonalized
+   *    is only read once, the Krylov vectors are streamed concurrently. ---*/
+  MemoryAllocation::CScratchScope scratch;
+  ScalarType* sum = scratch.alloc<ScalarType>(nDots);
+
+  SU2_OMP_FOR_STAT(computeStaticChunkSize(nElmDomain, omp_get_num_threads(), 4096))
+  for (auto j = 0ul; j < nElmDomain; j++) {
+    const ScalarType wij = wi[j];
+    for (int k = 0; k <= i; k++) sum[k] += wij * w[k][j];
+    sum[i+1] += wij * wij;
+  }
+
+  /*--- Update the shared results with "our" partial sums. ---*/
+  SU2_OMP_CRITICAL
+  for (int k = 0; k < nDots; k++) cgs_dots[k] += sum[k];
+
+#ifdef HAVE_MPI
+  /*--- Reduce across all mpi ranks (all dot products at once), only master thread communicates. ---*/
+  SU2_OMP_BARRIER
+  SU2_OMP_MASTER
+  {
+    for (int k = 0; k < nDots; k++) sum[k] = cgs_dots[k];
+    const auto mpi_type = (sizeof(ScalarType) < sizeof(double))? MPI_FLOAT : MPI_DOUBLE;
+    SelectMPIWrapper<ScalarType>::W::Allreduce(sum, cgs_dots.data(), nDots, mpi_type, MPI_SUM, MPI_COMM_WORLD);
+  }
+#endif
+  /*--- Make view of results consistent across threads. ---*/
+  SU2_OMP_BARRIER
+
+  for (int k = 0; k < nDots; k++) dots[k] = cgs_dots[k];
+}
+
+template<class ScalarType>
+void CSysSolve<ScalarType>::ClassicalGramSchmidt(int i, vector<vector<ScalarType> > & Hsbg,
+                                                 vector<CSysVector<ScalarType> > & w) const {
+
+  auto& wi = w[i+1];
+  const auto nElm = wi.GetLocSize();
+
+  MemoryAllocation::CScratchScope scratch;
+  ScalarType* dots = scratch.alloc<ScalarType>(i+2);
+
+  /*--- Two passes of classical Gram-Schmidt, the second restores orthogonality that may be lost in the first. ---*/
+
+  for (int pass = 0; pass < 2; pass++) {
+
+    MultiDot(i, w, dots);
+
+    /*--- The norm of w[i+1] < 0.0 or w[i+1] = NaN ---*/
+
+    if ((pass == 0) && ((dots[i+1] <= 0.0) || (dots[i+1] != dots[i+1]))) {
+      /*--- dots is the result of a reduction, all threads and ranks agree. ---*/
+      SU2_OMP_MASTER
+      SU2_MPI::Error("FGMRES orthogonalization failed, linear solver diverged.", CURRENT_FUNCTION);
+    }
+
+    /*--- w[i+1] -= sum_k (w[i+1].w[k]) w[k] ---*/
+
+    SU2_OMP_FOR_STAT(computeStaticChunkSize(nElm, omp_get_num_threads(), 4096))
+    for (auto j = 0ul; j < nElm; j++) {
+      ScalarType wij = wi[j];
+      for (int k = 0; k <= i; k++) wij -= dots[k] * w[k][j];
+      wi[j] = wij;
+    }
+
+    for (int k = 0; k <= i; k++) Hsbg[k][i] += dots[k];
+  }
+
+  /*--- The norm after the second pass follows from the orthonormality of w[0:i]. ---*/
+
+  ScalarType nrm = dots[i+1];
+  for (int k = 0; k <= i; k++) nrm -= dots[k]*dots[k];
+  nrm = sqrt(max(nrm, ScalarType(0.0)));
+  Hsbg[i+1][i] = nrm;
+
+  /*--- Scale the resulting vector ---*/
+
+  wi /= nrm;
+
+}
+
 template<class ScalarType>
 void CSysSolve<ScalarType>::WriteHeader(string solver, ScalarType restol, ScalarType resinit) const {
 
@@ -272,7 +379,6 @@ unsigned long CSysSolve<ScalarType>::CG_LinSolver(const CSysVector<ScalarType> &
     /*--- Update solution and residual: ---*/
 
     x.Plus_AX(alpha, p);
-    r.Plus_AX(-alpha, A_x);
 
     /*--- Only compute the residuals in full communication mode. ---*/
 
@@ -280,12 +386,15 @@ unsigned long CSysSolve<ScalarType>::CG_LinSolver(const CSysVector<ScalarType> &
 
       /*--- Check if solution has converged, else output the relative residual if necessary ---*/
 
-      norm_r = r.norm();
+      norm_r = sqrt(r.Plus_AX_Dot(-alpha, A_x, r));
       if (norm_r < tol*norm0) break;
       if (((monitoring) && (master)) && ((i+1) % 10 == 0))
         WriteHistory(i+1, norm_r/norm0);
 
     }
+    else {
+      r.Plus_AX(-alpha, A_x);
+    }
 
     precond(r, z);
 
@@ -328,7 +437,8 @@ unsigned long CSysSolve<ScalarType>::CG_LinSolver(const CSysVector<ScalarType> &
 template<class ScalarType>
 unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarType> & b, CSysVector<ScalarType> & x,
                                                       const CMatrixVectorProduct<ScalarType> & mat_vec, const CPreconditioner<ScalarType> & precond,
-                                                      ScalarType tol, unsigned long m, ScalarType & residual, bool monitoring, CConfig *config) const {
+                                                      ScalarType tol, unsigned long m, ScalarType & residual, bool monitoring, CConfig *config,
+                                                      bool classicalGS) const {
 
   const bool master = (SU2_MPI::GetRank() == MASTER_NODE) && (omp_get_thread_num() == 0);
 
@@ -354,6 +464,7 @@ unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarTyp
     {
       W.resize(m+1, x);
       Z.resize(m+1, x);
+      cgs_dots.resize(m+2);
       gmres_ready = true;
     }
     SU2_OMP_BARRIER
@@ -376,9 +487,7 @@ unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarTyp
   /*--- Calculate the initial residual (actually the negative residual) and compute its norm. ---*/
 
   mat_vec(x, W[0]);
-  W[0] -= b;
-
-  ScalarType beta = W[0].norm();
+  ScalarType beta = sqrt(W[0].Plus_AX_Dot(-1.0, b, W[0]));
 
   if ((beta < tol*norm0) || (beta < eps)) {
 
@@ -426,9 +535,10 @@ unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarTyp
 
     mat_vec(Z[i], W[i+1]);
 
-    /*---  Modified Gram-Schmidt orthogonalization ---*/
+    /*---  Modified or classical Gram-Schmidt orthogonalization ---*/
 
-    ModGramSchmidt(i, H, W);
+    if (classicalGS) ClassicalGramSchmidt(i, H, W);
+    else ModGramSchmidt(i, H, W);
 
     /*---  Apply old Givens rotations to new column of the Hessenberg matrix then generate the
      new Givens rotation matrix and apply it to the last two elements of H[:][i] and g ---*/
@@ -478,6 +588,473 @@ unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarTyp
 
 }
 
+template<class ScalarType>
+unsigned long CSysSolve<ScalarType>::FGMRES_Device_LinSolver(const CSysVector<ScalarType> & b, CSysVector<ScalarType> & x,
+                                                             const CSysMatrix<ScalarType> & Jacobian, bool newPrecond,
+                                                             ScalarType tol, unsigned long m, ScalarType & residual,
+                                                             bool monitoring, CGeometry *geometry, CConfig *config) const {
+
+  const bool master = (SU2_MPI::GetRank() == MASTER_NODE) && (omp_get_thread_num() == 0);
+  const bool halos = (SU2_MPI::GetSize() > 1);
+
+  /*---  Check the subspace size ---*/
+
+  if (m < 1) {
+    SU2_OMP_MASTER
+    SU2_MPI::Error("Number of linear solver iterations must be greater than 0.", CURRENT_FUNCTION);
+  }
+
+  if (m > 5000) {
+    SU2_OMP_MASTER
+    SU2_MPI::Error("FGMRES subspace is too large.", CURRENT_FUNCTION);
+  }
+
+  const auto nElm = x.GetLocSize();
+  const auto nElmDomain = x.GetNElmDomain();
+
+  /*--- Position of the vectors on the device, b, x, w[0:m], and z[0:m-1]. ---*/
+
+  const unsigned long B = 0, X = 1;
+  auto W = [](unsigned long k) { return 2+k; };
+  auto Z = [m](unsigned long k) { return m+3+k; };
+
+  /*--- Upload the system, only the master thread works with the device. ---*/
+
+  SU2_OMP_BARRIER
+  SU2_OMP_MASTER
+  {
+    if (DeviceBuffer.GetLocSize() != nElm)
+      DeviceBuffer.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+    if (cgs_dots.size() < m+2) cgs_dots.resize(m+2);
+
+    DeviceSystem.SetMatrix(Jacobian, newPrecond, 2*m+3);
+    DeviceSystem.Upload(&b[0], B, 0, nElm);
+    DeviceSystem.Upload(&x[0], X, 0, nElm);
+  }
+  SU2_OMP_BARRIER
+
+  /*--- Exchange the halos of a device vector through the host (called by all threads). ---*/
+
+  auto DeviceHalos = [&](unsigned long iVec) {
+    if (!halos) return;
+    SU2_OMP_MASTER
+    DeviceSystem.Download(iVec, &DeviceBuffer[0], 0, nElmDomain);
+    SU2_OMP_BARRIER
+    Jacobian.CommunicateHalos(DeviceBuffer, geometry, config);
+    SU2_OMP_BARRIER
+    SU2_OMP_MASTER
+    DeviceSystem.Upload(&DeviceBuffer[0], iVec, nElmDomain, nElm);
+  };
+
+  /*--- Dot products of v with vectors [first, first+n) and with itself, reduced across ranks
+   *    (all at once), the result is shared by all threads. ---*/
+
+  vector<ScalarType> dots(m+2);
+
+  auto DeviceDots = [&](unsigned long first, unsigned long n, unsigned long v) {
+    SU2_OMP_BARRIER
+    SU2_OMP_MASTER
+    {
+#ifdef HAVE_MPI
+      DeviceSystem.MultiDot(first, n, v, dots.data());
+      const auto mpi_type = (sizeof(ScalarType) < sizeof(double))? MPI_FLOAT : MPI_DOUBLE;
+      SelectMPIWrapper<ScalarType>::W::Allreduce(dots.data(), cgs_dots.data(), n+1, mpi_type, MPI_SUM, MPI_COMM_WORLD);
+#else
+      DeviceSystem.MultiDot(first, n, v, cgs_dots.data());
+#endif
+    }
+    SU2_OMP_BARRIER
+    for (unsigned long k = 0; k <= n; k++) dots[k] = cgs_dots[k];
+  };
+
+  /*--- Define various arrays, all threads do the same computations (see FGMRES_LinSolver). ---*/
+
+  vector<ScalarType> g(m+1, 0.0);
+  vector<ScalarType> sn(m+1, 0.0);
+  vector<ScalarType> cs(m+1, 0.0);
+  vector<ScalarType> y(m, 0.0);
+  vector<vector<ScalarType> > H(m+1, vector<ScalarType>(m, 0.0));
+
+  /*--- Calculate the norm of the rhs vector. ---*/
+
+  DeviceDots(B, 0, B);
+  ScalarType norm0 = sqrt(dots[0]);
+
+  /*--- Calculate the initial residual (actually the negative residual) and compute its norm. ---*/
+
+  DeviceHalos(X);
+  SU2_OMP_MASTER
+  {
+    DeviceSystem.MatVec(X, W(0));
+    DeviceSystem.Axpby(-1.0, B, 1.0, W(0));
+  }
+  DeviceDots(W(0), 0, W(0));
+
+  ScalarType beta = sqrt(dots[0]);
+
+  if ((beta < tol*norm0) || (beta < eps)) {
+
+    /*--- System is already solved ---*/
+
+    if (master) cout << "CSysSolve::FGMRES(): system solved by initial guess." << endl;
+    residual = beta;
+    return 0;
+  }
+
+  /*--- Normalize residual to get w_{0} (the negative sign is because w[0]
+        holds the negative residual, as mentioned above). ---*/
+
+  SU2_OMP_MASTER
+  DeviceSystem.Axpby(0.0, B, -1.0/beta, W(0));
+
+  /*--- Initialize the RHS of the reduced system ---*/
+
+  g[0] = beta;
+
+  /*--- Set the norm to the initial residual value ---*/
+
+  norm0 = beta;
+
+  /*--- Output header information including initial residual ---*/
+
+  unsigned long i = 0;
+  if ((monitoring) && (master)) {
+    WriteHeader("FGMRES", tol, beta);
+    WriteHistory(i, beta/norm0);
+  }
+
+  /*---  Loop over all search directions ---*/
+
+  for (i = 0; i < m; i++) {
+
+    /*---  Check if solution has converged ---*/
+
+    if (beta < tol*norm0) break;
+
+    /*---  Precondition w[i], store the result in z[i], and add to the Krylov subspace ---*/
+
+    SU2_OMP_MASTER
+    DeviceSystem.Jacobi(W(i), Z(i));
+
+    DeviceHalos(Z(i));
+
+    SU2_OMP_MASTER
+    DeviceSystem.MatVec(Z(i), W(i+1));
+
+    /*--- Two passes of classical Gram-Schmidt, the second restores orthogonality that may be lost in the first. ---*/
+
+    for (int pass = 0; pass < 2; pass++) {
+
+      DeviceDots(W(0), i+1, W(i+1));
+
+      /*--- The norm of w[i+1] < 0.0 or w[i+1] = NaN ---*/
+
+      if ((pass == 0) && ((dots[i+1] <= 0.0) || (dots[i+1] != dots[i+1]))) {
+        SU2_OMP_MASTER
+        SU2_MPI::Error("FGMRES orthogonalization failed, linear solver diverged.", CURRENT_FUNCTION);
+      }
+
+      SU2_OMP_MASTER
+      DeviceSystem.MultiAxpy(W(0), i+1, dots.data(), W(i+1));
+
+      for (unsigned long k = 0; k <= i; k++) H[k][i] += dots[k];
+    }
+
+    /*--- The norm after the second pass follows from the orthonormality of w[0:i]. ---*/
+
+    ScalarType nrm = dots[i+1];
+    for (unsigned long k = 0; k <= i; k++) nrm -= dots[k]*dots[k];
+    nrm = sqrt(max(nrm, ScalarType(0.0)));
+    H[i+1][i] = nrm;
+
+    SU2_OMP_MASTER
+    DeviceSystem.Axpby(0.0, B, 1.0/nrm, W(i+1));
+
+    /*---  Apply old Givens rotations to new column of the Hessenberg matrix then generate the
+     new Givens rotation matrix and apply it to the last two elements of H[:][i] and g ---*/
+
+    for (unsigned long k = 0; k < i; k++)
+      ApplyGivens(sn[k], cs[k], H[k][i], H[k+1][i]);
+    GenerateGivens(H[i][i], H[i+1][i], sn[i], cs[i]);
+    ApplyGivens(sn[i], cs[i], g[i], g[i+1]);
+
+    /*---  Set L2 norm of residual and check if solution has converged ---*/
+
+    beta = fabs(g[i+1]);
+
+    /*---  Output the relative residual if necessary ---*/
+
+    if (((monitoring) && (master)) && ((i+1) % 10 == 0))
+      WriteHistory(i+1, beta/norm0);
+  }
+
+  /*---  Solve the least-squares system, update the solution and download it ---*/
+
+  SolveReduced(i, H, g, y);
+
+  SU2_OMP_MASTER
+  {
+    for (unsigned long k = 0; k < i; k++)
+      DeviceSystem.Axpby(y[k], Z(k), 1.0, X);
+    DeviceSystem.Download(X, &x[0], 0, nElmDomain);
+  }
+  SU2_OMP_BARRIER
+
+  /*--- The kernels do not update the halos of x. ---*/
+
+  if (halos) Jacobian.CommunicateHalos(x, geometry, config);
+
+  /*---  Recalculate final (neg.) residual (this should be optional) ---*/
+
+  if ((monitoring) && (config->GetComm_Level() == COMM_FULL)) {
+
+    if (master) WriteFinalResidual("FGMRES", i, beta/norm0);
+
+    DeviceHalos(X);
+    SU2_OMP_MASTER
+    {
+      DeviceSystem.MatVec(X, W(0));
+      DeviceSystem.Axpby(-1.0, B, 1.0, W(0));
+    }
+    DeviceDots(W(0), 0, W(0));
+    ScalarType res = sqrt(dots[0]);
+
+    if (fabs(res - beta) > tol*10) {
+      if (master) {
+        WriteWarning(beta, res, tol);
+      }
+    }
+
+  }
+
+  residual = beta/norm0;
+  return i;
+
+}
+
+template<class ScalarType>
+unsigned long CSysSolve<ScalarType>::GCRODR_LinSolver(const CSysVector<ScalarType> & b, CSysVector<ScalarType> & x,
+                                                      const CMatrixVectorProduct<ScalarType> & mat_vec, const CPreconditioner<ScalarType> & precond,
+                                                      ScalarType tol, unsigned long m, ScalarType & residual, bool monitoring, CConfig *config) const {
+
+  const bool master = (SU2_MPI::GetRank() == MASTER_NODE) && (omp_get_thread_num() == 0);
+
+  const unsigned long k = config->GetLinear_Solver_Recycle_Size();
+
+  /*---  Check the subspace size ---*/
+
+  if (m < 1) {
+    SU2_OMP_MASTER
+    SU2_MPI::Error("Number of linear solver iterations must be greater than 0.", CURRENT_FUNCTION);
+  }
+
+  if (m+k > 5000) {
+    SU2_OMP_MASTER
+    SU2_MPI::Error("GCRO_DR subspace is too large.", CURRENT_FUNCTION);
+  }
+
+  /*--- Allocate if not allocated yet, W and Z are shared with FGMRES, the last Z
+   *    (not used by the Arnoldi process) holds the solution correction. ---*/
+
+  if (!gcro_ready) {
+    SU2_OMP_BARRIER
+    SU2_OMP_MASTER
+    {
+      if (!gmres_ready) {
+        W.resize(m+1, x);
+        Z.resize(m+1, x);
+        cgs_dots.resize(m+2);
+        gmres_ready = true;
+      }
+      U.resize(k, x);
+      C.resize(k, x);
+      gcro_ready = true;
+    }
+    SU2_OMP_BARRIER
+  }
+
+  /*--- Local arrays, each thread does the same computations, see FGMRES. ---*/
+
+  vector<ScalarType> g(m+1, 0.0);
+  vector<ScalarType> sn(m+1, 0.0);
+  vector<ScalarType> cs(m+1, 0.0);
+  vector<ScalarType> y(m, 0.0);
+  vector<vector<ScalarType> > H(m+1, vector<ScalarType>(m, 0.0));
+  vector<vector<ScalarType> > B(k, vector<ScalarType>(m, 0.0));
+
+  /*--- The operator changes between calls, re-project the recycled subspace, i.e. C = A * U,
+   *    and orthonormalize C applying the same operations to U (to keep C = A * U).
+   *    Directions that became (numerically) dependent are removed. ---*/
+
+  unsigned long nRec = nRecycled;
+
+  for (unsigned long j = 0; j < nRec; j++)
+    mat_vec(U[j], C[j]);
+
+  for (unsigned long j = 0; j < nRec; ) {
+    ScalarType nrm0 = 0.0, prod = 0.0;
+    if (j > 0) C[j].Dot2(C[j], C[0], nrm0, prod);
+    else nrm0 = C[j].squaredNorm();
+    nrm0 = sqrt(nrm0);
+
+    /*--- Each update is fused with the next product (the norm after the last). ---*/
+    ScalarType nrm = nrm0;
+    for (unsigned long i = 0; i < j; i++) {
+      U[j].Plus_AX(-prod, U[i]);
+      prod = C[j].Plus_AX_Dot(-prod, C[i], (i+1 < j)? C[i+1] : C[j]);
+      if (i+1 == j) nrm = sqrt(prod);
+    }
+
+    if ((nrm <= sqrt(eps)*nrm0) || (nrm < eps)) {
+      /*--- Move the last direction into this position and test it instead. ---*/
+      nRec--;
+      if (j != nRec) {
+        U[j] = U[nRec];
+        C[j] = C[nRec];
+      }
+      SU2_OMP_BARRIER
+      continue;
+    }
+    C[j] /= nrm;
+    U[j] /= nrm;
+    j++;
+  }
+
+  SU2_OMP_BARRIER
+  SU2_OMP_MASTER
+  nRecycled = nRec;
+  SU2_OMP_BARRIER
+
+  /*--- Initial residual (stored in W[0]) and its norm. ---*/
+
+  mat_vec(x, W[0]);
+  W[0].Equals_AX_Plus_BY(1.0, b, -1.0, W[0]);
+
+  ScalarType norm0 = W[0].norm();
+
+  if (norm0 < eps) {
+
+    /*--- System is already solved ---*/
+
+    if (master) cout << "CSysSolve::GCRO_DR(): system solved by initial guess." << endl;
+    residual = norm0;
+    return 0;
+  }
+
+  /*--- Minimize the residual over the recycled subspace, x += U C^T r, r -= C C^T r. ---*/
+
+  ScalarType beta = norm0;
+  if (nRec > 0) {
+    ScalarType prod = C[0].dot(W[0]);
+    for (unsigned long j = 0; j < nRec; j++) {
+      x.Plus_AX(prod, U[j]);
+      prod = W[0].Plus_AX_Dot(-prod, C[j], (j+1 < nRec)? C[j+1] : W[0]);
+    }
+    beta = sqrt(prod);
+  }
+
+  unsigned long i = 0;
+  if ((monitoring) && (master)) {
+    WriteHeader("GCRO_DR", tol, norm0);
+    WriteHistory(i, beta/norm0);
+  }
+
+  if (beta < tol*norm0) {
+    residual = beta/norm0;
+    return 0;
+  }
+
+  W[0] /= beta;
+  g[0] = beta;
+
+  /*---  Arnoldi process for the deflated operator (I - C C^T) A M^-1. ---*/
+
+  for (i = 0; i < m; i++) {
+
+    if (beta < tol*norm0) break;
+
+    precond(W[i], Z[i]);
+
+    mat_vec(Z[i], W[i+1]);
+
+    /*--- Orthogonalize with respect to the recycled subspace, then to the Krylov subspace. ---*/
+
+    for (unsigned long j = 0; j < nRec; j++) {
+      B[j][i] = C[j].dot(W[i+1]);
+      W[i+1].Plus_AX(-B[j][i], C[j]);
+    }
+
+    ModGramSchmidt(i, H, W);
+
+    for (unsigned long l = 0; l < i; l++)
+      ApplyGivens(sn[l], cs[l], H[l][i], H[l+1][i]);
+    GenerateGivens(H[i][i], H[i+1][i], sn[i], cs[i]);
+    ApplyGivens(sn[i], cs[i], g[i], g[i+1]);
+
+    beta = fabs(g[i+1]);
+
+    if ((monitoring) && (master) && ((i+1) % 10 == 0))
+      WriteHistory(i+1, beta/norm0);
+  }
+
+  /*--- Solve the least-squares system, the correction is d = Z y - U B y. ---*/
+
+  SolveReduced(i, H, g, y);
+
+  auto& d = Z[m];
+  d = ScalarType(0.0);
+  for (unsigned long l = 0; l < i; l++)
+    d.Plus_AX(y[l], Z[l]);
+
+  for (unsigned long j = 0; j < nRec; j++) {
+    ScalarType coeff = 0.0;
+    for (unsigned long l = 0; l < i; l++) coeff += B[j][l]*y[l];
+    d.Plus_AX(-coeff, U[j]);
+  }
+
+  x += d;
+
+  /*--- Update the recycled subspace with the normalized correction, replacing
+   *    the oldest direction when full (C is recomputed on the next call). ---*/
+
+  const ScalarType nrm_d = d.norm();
+
+  if ((k > 0) && (nrm_d > eps)) {
+    const unsigned long pos = (nRec < k)? nRec : oldestRecycled;
+    U[pos] = d;
+    U[pos] /= nrm_d;
+    SU2_OMP_BARRIER
+    SU2_OMP_MASTER
+    {
+      if (nRec < k) nRecycled = nRec+1;
+      else oldestRecycled = (oldestRecycled+1) % k;
+    }
+    SU2_OMP_BARRIER
+  }
+
+  /*---  Recalculate final residual (this should be optional) ---*/
+
+  if ((monitoring) && (config->GetComm_Level() == COMM_FULL)) {
+
+    if (master) WriteFinalResidual("GCRO_DR", i, beta/norm0);
+
+    mat_vec(x, W[0]);
+    W[0] -= b;
+    ScalarType res = W[0].norm();
+
+    if (fabs(res - beta) > tol*10) {
+      if (master) {
+        WriteWarning(beta, res, tol);
+      }
+    }
+
+  }
+
+  residual = beta/norm0;
+  return i;
+
+}
+
 template<class ScalarType>
 unsigned long CSysSolve<ScalarType>::BCGSTAB_LinSolver(const CSysVector<ScalarType> & b, CSysVector<ScalarType> & x,
                                                        const CMatrixVectorProduct<ScalarType> & mat_vec, const CPreconditioner<ScalarType> & precond,
@@ -550,6 +1127,10 @@ unsigned long CSysSolve<ScalarType>::BCGSTAB_LinSolver(const CSysVector<ScalarTy
   ScalarType alpha = 1.0, beta = 1.0, omega = 1.0, rho = 1.0, rho_prime = 1.0;
   p = ScalarType(0.0); v = ScalarType(0.0); r_0 = r;
 
+  /*--- The product of r and r_0 is computed with the update of r at the end of each iteration. ---*/
+
+  ScalarType r_dot_r_0 = r.squaredNorm();
+
   /*--- Loop over all search directions ---*/
 
   for (i = 0; i < m; i++) {
@@ -560,7 +1141,7 @@ unsigned long CSysSolve<ScalarType>::BCGSTAB_LinSolver(const CSysVector<ScalarTy
 
     /*--- Compute rho_i ---*/
 
-    rho = r.dot(r_0);
+    rho = r_dot_r_0;
 
     /*--- Compute beta ---*/
 
@@ -596,14 +1177,22 @@ unsigned long CSysSolve<ScalarType>::BCGSTAB_LinSolver(const CSysVector<ScalarTy
 
     /*--- Calculate step-length omega ---*/
 
-    omega = A_x.dot(r) / A_x.squaredNorm();
+    ScalarType A_x_dot_r, A_x_dot_A_x;
+    A_x.Dot2(r, A_x, A_x_dot_r, A_x_dot_A_x);
+    omega = A_x_dot_r / A_x_dot_A_x;
 
     /*--- Update solution and residual: ---*/
 
     /*--- x_{i} = x_{i-1/2} + omega * z ---*/
     x.Plus_AX(omega, z);
     /*--- r_{i} = r_{i-1/2} - omega * A * z ---*/
-    r.Plus_AX(-omega, A_x);
+    if (config->GetComm_Level() == COMM_FULL) {
+      r.Plus_AX_Dot2(-omega, A_x, r_0, r, r_dot_r_0, norm_r);
+      norm_r = sqrt(norm_r);
+    }
+    else {
+      r_dot_r_0 = r.Plus_AX_Dot(-omega, A_x, r_0);
+    }
 
     /*--- Only compute the residuals in full communication mode. ---*/
 
@@ -611,7 +1200,6 @@ unsigned long CSysSolve<ScalarType>::BCGSTAB_LinSolver(const CSysVector<ScalarTy
 
       /*--- Check if solution has converged, else output the relative residual if necessary ---*/
 
-      norm_r = r.norm();
       if (norm_r < tol*norm0) break;
       if (((monitoring) && (master)) && ((i+1) % 10 == 0) && (master))
         WriteHistory(i+1, norm_r/norm0);
@@ -729,13 +1317,15 @@ unsigned long CSysSolve<ScalarType>::Smoother_LinSolver(const CSysVector<ScalarT
      with a Gauss-Seidel preconditioner and w>1 is NOT equivalent to SOR. ---*/
 
     x.Plus_AX(omega, z);
-    r.Plus_AX(-omega, A_x);
 
     /*--- Only compute the residuals in full communication mode. ---*/
     /*--- Check if solution has converged, else output the relative residual if necessary. ---*/
 
-    if (config->GetComm_Level() == COMM_FULL) {
-      norm_r = r.norm();
+    if (config->GetComm_Level() != COMM_FULL) {
+      r.Plus_AX(-omega, A_x);
+    }
+    else {
+      norm_r = sqrt(r.Plus_AX_Dot(-omega, A_x, r));
       if (norm_r < tol*norm0) break;
       if (((monitoring) && (master)) && ((i+1) % 5 == 0))
         WriteHistory(i+1, norm_r/norm0);
@@ -776,9 +1366,8 @@ void CSysSolve<su2double>::HandleTemporariesOut(CSysVector<su2double> & LinSysSo
   SU2_OMP_BARRIER
 }
 
-#ifdef CODI_REVERSE_TYPE
-template<>
-void CSysSolve<passivedouble>::HandleTemporariesIn(const CSysVector<su2double> & LinSysRes, CSysVector<su2double> & LinSysSol) {
+template<class ScalarType>
+void CSysSolve<ScalarType>::HandleTemporariesIn(const CSysVector<su2double> & LinSysRes, CSysVector<su2double> & LinSysSol) {
 
   /*--- When the type is different we need to copy data to the temporaries ---*/
   /*--- Copy data, the solution is also copied because it serves as initial conditions ---*/
@@ -794,8 +1383,8 @@ void CSysSolve<passivedouble>::HandleTemporariesIn(const CSysVector<su2double> &
   SU2_OMP_BARRIER
 }
 
-template<>
-void CSysSolve<passivedouble>::HandleTemporariesOut(CSysVector<su2double> & LinSysSol) {
+template<class ScalarType>
+void CSysSolve<ScalarType>::HandleTemporariesOut(CSysVector<su2double> & LinSysSol) {
 
   /*--- When the type is different we need to copy data from the temporaries ---*/
   /*--- Copy data, only the solution needs to be copied ---*/
@@ -809,36 +1398,51 @@ void CSysSolve<passivedouble>::HandleTemporariesOut(CSysVector<su2double> & LinS
   }
   SU2_OMP_BARRIER
 }
-#endif
 
 template<class ScalarType>
 unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, const CSysVector<su2double> & LinSysRes,
-                                           CSysVector<su2double> & LinSysSol, CGeometry *geometry, CConfig *config) {
+                                           CSysVector<su2double> & LinSysSol, CGeometry *geometry, CConfig *config,
+                                           const CMatrixVectorProduct<ScalarType>* product) {
   /*---
    A word about the templated types. It is assumed that the residual and solution vectors are always of su2doubles,
    meaning that they are active in the discrete adjoint. The same assumption is made in SetExternalSolve.
-   When the Jacobian is passive (and therefore not compatible with the vectors) we go through the "HandleTemporaries"
+   When the Jacobian is passive or of lower precision (and therefore not compatible with the vectors) we go through the "HandleTemporaries"
    mechanisms. Note that CG, BCGSTAB, and FGMRES, all expect the vector to be compatible with the Product and
    Preconditioner (and therefore with the Matrix). Likewise for Solve_b (which is used by CSysSolve_b).
    There are no provisions here for active Matrix and passive Vectors as that makes no sense since we only handle the
    derivatives of the residual in CSysSolve_b.
   ---*/
 
+  SU2_PROFILE_REGION("Linear solver");
+
   unsigned short KindSolver, KindPrecond;
-  unsigned long MaxIter, RestartIter;
+  unsigned long MaxIter, RestartIter, MaxReuse = 0;
   ScalarType SolverTol;
-  bool ScreenOutput;
+  passivedouble ReuseGrowth = 1.0;
+  bool ScreenOutput, AdaptiveTol = false;
 
   /*--- Normal mode ---*/
 
   if(!mesh_deform) {
 
+    /*--- The coarse multigrid levels may have their own settings. ---*/
+    const auto iMesh = geometry->GetMGLevel();
+
     KindSolver   = config->GetKind_Linear_Solver();
-    KindPrecond  = config->GetKind_Linear_Solver_Prec();
-    MaxIter      = config->GetLinear_Solver_Iter();
+    KindPrecond  = config->GetKind_Linear_Solver_Prec(iMesh);
+    MaxIter      = config->GetLinear_Solver_Iter(iMesh);
     RestartIter  = config->GetLinear_Solver_Restart_Frequency();
-    SolverTol    = SU2_TYPE::GetValue(config->GetLinear_Solver_Error());
+    SolverTol    = SU2_TYPE::GetValue(config->GetLinear_Solver_Error(iMesh));
     ScreenOutput = false;
+    MaxReuse     = config->GetLinear_Solver_Prec_Reuse();
+    ReuseGrowth  = SU2_TYPE::GetValue(config->GetLinear_Solver_Prec_Reuse_Growth());
+    AdaptiveTol  = config->GetLinear_Solver_Adaptive_Error() && (iMesh == MESH_0);
+
+    /*--- Same as below, the matrix was not modified since the last call. ---*/
+    if (MatrixUnchanged) {
+      MaxReuse    = numeric_limits<unsigned long>::max();
+      ReuseGrowth = numeric_limits<passivedouble>::max();
+    }
   }
 
   /*--- Mesh Deformation mode ---*/
@@ -851,6 +1455,12 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
     RestartIter  = config->GetLinear_Solver_Restart_Frequency();
     SolverTol    = SU2_TYPE::GetValue(config->GetDeform_Linear_Solver_Error());
     ScreenOutput = config->GetDeform_Output();
+
+    /*--- The matrix does not change when the stiffness is reused, neither should the preconditioner. ---*/
+    if (config->GetDeform_Reuse_Stiffness()) {
+      MaxReuse    = numeric_limits<unsigned long>::max();
+      ReuseGrowth = numeric_limits<passivedouble>::max();
+    }
   }
 
   /*--- Stop the recording for the linear solver ---*/
@@ -874,7 +1484,30 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
 
   HandleTemporariesIn(LinSysRes, LinSysSol);
 
-  auto mat_vec = CSysMatrixVectorProduct<ScalarType>(Jacobian, geometry, config);
+  /*--- Adaptive tolerance (Eisenstat-Walker, choice 2), from the ratio of the norms of the right hand
+   *    side (the nonlinear residual) of successive calls, safeguarded against sudden decreases. ---*/
+
+  ScalarType ResNorm = 0.0;
+
+  if (AdaptiveTol) {
+    const ScalarType gamma  = SU2_TYPE::GetValue(config->GetLinear_Solver_Adaptive_Param(0));
+    const ScalarType alpha  = SU2_TYPE::GetValue(config->GetLinear_Solver_Adaptive_Param(1));
+    const ScalarType tolMin = SU2_TYPE::GetValue(config->GetLinear_Solver_Adaptive_Param(2));
+    const ScalarType tolMax = SU2_TYPE::GetValue(config->GetLinear_Solver_Adaptive_Param(3));
+
+    ResNorm = LinSysRes_ptr->norm();
+    SolverTol = tolMax;
+
+    if ((ResNorm_Old > 0.0) && (Tolerance > 0.0)) {
+      SolverTol = gamma * pow(ResNorm / ResNorm_Old, alpha);
+      const ScalarType safeguard = gamma * pow(Tolerance, alpha);
+      if (safeguard > 0.1) SolverTol = max(SolverTol, safeguard);
+    }
+    SolverTol = min(max(SolverTol, tolMin), tolMax);
+  }
+
+  auto jacobian_product = CSysMatrixVectorProduct<ScalarType>(Jacobian, geometry, config);
+  const auto& mat_vec = product? *product : jacobian_product;
   CPreconditioner<ScalarType>* precond = nullptr;
 
   switch (KindPrecond) {
@@ -884,6 +1517,15 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
     case ILU:
       precond = new CILUPreconditioner<ScalarType>(Jacobian, geometry, config, false);
       break;
+    case AMG:
+      precond = new CAMGPreconditioner<ScalarType>(Jacobian, geometry, config, false);
+      break;
+    case NEUMANN_PREC: case CHEBYSHEV:
+      precond = new CPolynomialPreconditioner<ScalarType>(Jacobian, geometry, config, KindPrecond);
+      break;
+    case SPAI:
+      precond = new CSPAIPreconditioner<ScalarType>(Jacobian, geometry, config);
+      break;
     case LU_SGS:
       precond = new CLU_SGSPreconditioner<ScalarType>(Jacobian, geometry, config);
       break;
@@ -898,22 +1540,44 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
       break;
   }
 
-  /*--- Build preconditioner. ---*/
+  /*--- Build preconditioner, unless it can be reused, i.e. it was built less than MaxReuse
+   *    calls ago and the linear solver did not (relatively) degrade since then. PaStiX has
+   *    its own factorization frequency. The factors are kept by the matrix across calls. ---*/
+
+  const bool BuildPrecond = PrecondRebuild || (PrecondAge >= MaxReuse) ||
+                            (KindPrecond == PASTIX_ILU) || (KindPrecond == PASTIX_LU_P) ||
+                            (KindPrecond == PASTIX_LDLT_P);
 
-  precond->Build();
+  if (BuildPrecond) precond->Build();
 
   /*--- Solve system. ---*/
 
   unsigned long IterLinSol = 0;
   ScalarType residual = 0.0, norm0 = 0.0;
 
-  switch (KindSolver) {
+  /*--- The device solver handles FGMRES with Jacobi preconditioning of the Jacobian (not matrix-free),
+   *    e.g. coarse multigrid levels with other preconditioners are solved on the host. ---*/
+
+  const bool DeviceSolve = !mesh_deform && config->GetLinear_Solver_Device() && (product == nullptr) &&
+                           (KindPrecond == JACOBI) && ((KindSolver == FGMRES) || (KindSolver == FGMRES_CGS));
+
+  if (DeviceSolve) {
+    IterLinSol = FGMRES_Device_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, Jacobian, BuildPrecond, SolverTol,
+                                         MaxIter, residual, ScreenOutput, geometry, config);
+  }
+  else switch (KindSolver) {
     case BCGSTAB:
       IterLinSol = BCGSTAB_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
       break;
     case FGMRES:
       IterLinSol = FGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
       break;
+    case FGMRES_CGS:
+      IterLinSol = FGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config, true);
+      break;
+    case GCRO_DR:
+      IterLinSol = GCRODR_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+      break;
     case CONJUGATE_GRADIENT:
       IterLinSol = CG_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
       break;
@@ -939,7 +1603,23 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
   }
 
   SU2_OMP_MASTER
-  Residual = residual;
+  {
+    Residual = residual;
+    Tolerance = SolverTol;
+    if (AdaptiveTol) ResNorm_Old = ResNorm;
+
+    /*--- Decide if the preconditioner needs to be rebuilt on the next call. ---*/
+
+    if (BuildPrecond) {
+      PrecondAge = 0;
+      PrecondIter = IterLinSol;
+    }
+    else {
+      PrecondAge++;
+    }
+    PrecondRebuild = (IterLinSol >= MaxIter) || (IterLinSol > ReuseGrowth*max(PrecondIter, 1ul));
+    MatrixUnchanged = false;
+  }
 
   HandleTemporariesOut(LinSysSol);
 
@@ -973,6 +1653,9 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
       case ILU:
         Jacobian.BuildILUPreconditioner(RequiresTranspose);
         break;
+      case AMG:
+        Jacobian.BuildAMGPreconditioner(RequiresTranspose);
+        break;
       case JACOBI:
         Jacobian.BuildJacobiPreconditioner(RequiresTranspose);
         break;
@@ -995,6 +1678,8 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType> & Jacobian,
                                              CSysVector<su2double> & LinSysSol, CGeometry *geometry, CConfig *config) {
 #ifdef CODI_REVERSE_TYPE
 
+  SU2_PROFILE_REGION("Linear solver");
+
   unsigned short KindSolver, KindPrecond;
   unsigned long MaxIter, RestartIter, IterLinSol = 0;
   ScalarType SolverTol, Norm0 = 0.0;
@@ -1032,6 +1717,9 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType> & Jacobian,
     case ILU:
       precond = new CILUPreconditioner<ScalarType>(Jacobian, geometry, config, RequiresTranspose);
       break;
+    case AMG:
+      precond = new CAMGPreconditioner<ScalarType>(Jacobian, geometry, config, RequiresTranspose);
+      break;
     case JACOBI:
       precond = new CJacobiPreconditioner<ScalarType>(Jacobian, geometry, config, RequiresTranspose);
       break;
@@ -1050,6 +1738,9 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType> & Jacobian,
     case FGMRES:
       IterLinSol = FGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol , MaxIter, Residual, ScreenOutput, config);
       break;
+    case FGMRES_CGS:
+      IterLinSol = FGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol , MaxIter, Residual, ScreenOutput, config, true);
+      break;
     case BCGSTAB:
       IterLinSol = BCGSTAB_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol , MaxIter, Residual, ScreenOutput, config);
       break;
@@ -1092,3 +1783,6 @@ template class CSysSolve<su2double>;
 #ifdef CODI_REVERSE_TYPE
 template class CSysSolve<passivedouble>;
 #endif
+#ifdef USE_MIXED_PRECISION
+template class CSysSolve<float>;
+#endif
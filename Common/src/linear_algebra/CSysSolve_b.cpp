@@ -71,5 +71,8 @@ void CSysSolve_b<ScalarType>::Solve_b(const codi::RealReverse::Real* x, codi::Re
 
 template class CSysSolve_b<su2double>;
 template class CSysSolve_b<passivedouble>;
+#ifdef USE_MIXED_PRECISION
+template class CSysSolve_b<float>;
+#endif
 
 #endif
@@ -50,7 +50,7 @@ CSysVector<ScalarType>::CSysVector(void) {
   nElmDomain = 0;
   nVar = 0;
   omp_chunk_size = OMP_MAX_SIZE;
-  dotRes = 0.0;
+  dotRes[0] = dotRes[1] = 0.0;
 }
 
 template<class ScalarType>
@@ -72,11 +72,14 @@ void CSysVector<ScalarType>::Initialize(unsigned long numBlk, unsigned long numB
   omp_chunk_size = computeStaticChunkSize(nElm, omp_get_max_threads(), OMP_MAX_SIZE);
 
   if (vec_val == nullptr)
-    vec_val = MemoryAllocation::aligned_alloc<ScalarType>(64, nElm*sizeof(ScalarType));
+    vec_val = MemoryAllocation::aligned_alloc<ScalarType>(64, nElm*sizeof(ScalarType),
+                                                          MemoryAllocation::MEMORY_LINEAR_SOLVER);
+
+  /*--- Without a value the memory is first touched by the (static) loops of the methods. ---*/
 
   if(val != nullptr) {
     if(!valIsArray) {
-      for(auto i=0ul; i<nElm; i++) vec_val[i] = *val;
+      parallelFirstTouch(nElm, *val, vec_val, OMP_MAX_SIZE);
     }
     else {
       for(auto i=0ul; i<nElm; i++) vec_val[i] = val[i];
@@ -205,12 +208,35 @@ void CSysVector<ScalarType>::CopyToArray(ScalarType* u_array) const {
   for(auto i=0ul; i<nElm; i++) u_array[i] = vec_val[i];
 }
 
+template<class ScalarType>
+void CSysVector<ScalarType>::ReduceDots(ScalarType* sum, unsigned short n) const {
+
+  /*--- Update shared variables with "our" partial sums. ---*/
+  for (unsigned short k = 0; k < n; ++k)
+    atomicAdd(sum[k], dotRes[k]);
+
+#ifdef HAVE_MPI
+  /*--- Reduce across all mpi ranks, only master thread communicates. ---*/
+  SU2_OMP_BARRIER
+  SU2_OMP_MASTER
+  {
+    for (unsigned short k = 0; k < n; ++k) sum[k] = dotRes[k];
+    const auto mpi_type = (sizeof(ScalarType) < sizeof(double))? MPI_FLOAT : MPI_DOUBLE;
+    SelectMPIWrapper<ScalarType>::W::Allreduce(sum, dotRes, n, mpi_type, MPI_SUM, MPI_COMM_WORLD);
+  }
+#endif
+  /*--- Make view of result consistent across threads. ---*/
+  SU2_OMP_BARRIER
+
+  for (unsigned short k = 0; k < n; ++k) sum[k] = dotRes[k];
+}
+
 template<class ScalarType>
 ScalarType CSysVector<ScalarType>::dot(const CSysVector<ScalarType> & u) const {
 
   /*--- All threads get the same "view" of the vectors and shared variable. ---*/
   SU2_OMP_BARRIER
-  dotRes = 0.0;
+  dotRes[0] = 0.0;
   SU2_OMP_BARRIER
 
   /*--- Local dot product for each thread. ---*/
@@ -220,22 +246,86 @@ ScalarType CSysVector<ScalarType>::dot(const CSysVector<ScalarType> & u) const {
   for(auto i=0ul; i<nElmDomain; ++i)
     sum += vec_val[i]*u.vec_val[i];
 
-  /*--- Update shared variable with "our" partial sum. ---*/
-  atomicAdd(sum, dotRes);
+  ReduceDots(&sum, 1);
+
+  return sum;
+}
+
+template<class ScalarType>
+void CSysVector<ScalarType>::Dot2(const CSysVector<ScalarType> & u, const CSysVector<ScalarType> & v,
+                                  ScalarType & dot_u, ScalarType & dot_v) const {
 
-#ifdef HAVE_MPI
-  /*--- Reduce across all mpi ranks, only master thread communicates. ---*/
   SU2_OMP_BARRIER
-  SU2_OMP_MASTER
-  {
-    sum = dotRes;
-    SelectMPIWrapper<ScalarType>::W::Allreduce(&sum, &dotRes, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  dotRes[0] = dotRes[1] = 0.0;
+  SU2_OMP_BARRIER
+
+  ScalarType sum[2] = {0.0, 0.0};
+
+  PARALLEL_FOR
+  for(auto i=0ul; i<nElmDomain; ++i) {
+    sum[0] += vec_val[i]*u.vec_val[i];
+    sum[1] += vec_val[i]*v.vec_val[i];
   }
-#endif
-  /*--- Make view of result consistent across threads. ---*/
+
+  ReduceDots(sum, 2);
+
+  dot_u = sum[0];
+  dot_v = sum[1];
+}
+
+template<class ScalarType>
+ScalarType CSysVector<ScalarType>::Plus_AX_Dot(ScalarType a, const CSysVector<ScalarType> & x,
+                                               const CSysVector<ScalarType> & u) {
+
+  assert(nElm == x.nElm && "Sizes do not match");
+
+  SU2_OMP_BARRIER
+  dotRes[0] = 0.0;
+  SU2_OMP_BARRIER
+
+  ScalarType sum = 0.0;
+
+  /*--- The update of the halos does not contribute to the product, the
+   *    barriers of the reduction make them consistent across threads. ---*/
+  PARALLEL_FOR
+  for(auto i=0ul; i<nElmDomain; ++i) {
+    vec_val[i] += a * x.vec_val[i];
+    sum += vec_val[i]*u.vec_val[i];
+  }
+  PARALLEL_FOR
+  for(auto i=nElmDomain; i<nElm; ++i) vec_val[i] += a * x.vec_val[i];
+
+  ReduceDots(&sum, 1);
+
+  return sum;
+}
+
+template<class ScalarType>
+void CSysVector<ScalarType>::Plus_AX_Dot2(ScalarType a, const CSysVector<ScalarType> & x,
+                                          const CSysVector<ScalarType> & u, const CSysVector<ScalarType> & v,
+                                          ScalarType & dot_u, ScalarType & dot_v) {
+
+  assert(nElm == x.nElm && "Sizes do not match");
+
+  SU2_OMP_BARRIER
+  dotRes[0] = dotRes[1] = 0.0;
   SU2_OMP_BARRIER
 
-  return dotRes;
+  ScalarType sum[2] = {0.0, 0.0};
+
+  PARALLEL_FOR
+  for(auto i=0ul; i<nElmDomain; ++i) {
+    vec_val[i] += a * x.vec_val[i];
+    sum[0] += vec_val[i]*u.vec_val[i];
+    sum[1] += vec_val[i]*v.vec_val[i];
+  }
+  PARALLEL_FOR
+  for(auto i=nElmDomain; i<nElm; ++i) vec_val[i] += a * x.vec_val[i];
+
+  ReduceDots(sum, 2);
+
+  dot_u = sum[0];
+  dot_v = sum[1];
 }
 
 /*--- Explicit instantiations ---*/
@@ -247,3 +337,9 @@ template class CSysVector<passivedouble>;
 template void CSysVector<su2double>::PassiveCopy(const CSysVector<passivedouble>&);
 template void CSysVector<passivedouble>::PassiveCopy(const CSysVector<su2double>&);
 #endif
+
+#ifdef USE_MIXED_PRECISION
+template class CSysVector<float>;
+template void CSysVector<su2double>::PassiveCopy(const CSysVector<float>&);
+template void CSysVector<float>::PassiveCopy(const CSysVector<su2double>&);
+#endif
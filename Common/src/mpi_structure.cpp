@@ -25,6 +25,8 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 
+/*--- The default communicator is the actual world communicator. ---*/
+#define SU2_KEEP_MPI_COMM_WORLD
 #include "../include/mpi_structure.hpp"
 
 int CBaseMPIWrapper::Rank = 0;
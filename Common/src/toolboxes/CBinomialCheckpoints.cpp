@@ -0,0 +1,144 @@
+/*!
+ * \file CBinomialCheckpoints.cpp
+ * \brief Storage and binomial placement of the checkpoints of a time-marching computation.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/CBinomialCheckpoints.hpp"
+
+#include <fstream>
+#include <cstdio>
+#include <algorithm>
+
+CBinomialCheckpoints::CBinomialCheckpoints(unsigned short nCheckpoints, unsigned short nDisk, string diskFolder) :
+  slots(nCheckpoints), folder(diskFolder) {
+
+  for (unsigned short iSlot = nCheckpoints - min(nDisk, nCheckpoints); iSlot < nCheckpoints; iSlot++)
+    slots[iSlot].onDisk = true;
+}
+
+CBinomialCheckpoints::~CBinomialCheckpoints() {
+
+  for (unsigned short iSlot = 0; iSlot < slots.size(); iSlot++)
+    if (slots[iSlot].onDisk && (slots[iSlot].step >= 0)) remove(FileName(iSlot).c_str());
+}
+
+string CBinomialCheckpoints::FileName(unsigned short iSlot) const {
+
+  return folder + "/su2_checkpoint_" + to_string(iSlot) + "_" + to_string(SU2_MPI::GetRank()) + ".dat";
+}
+
+passivedouble CBinomialCheckpoints::Beta(unsigned long nCheckpoints, unsigned long nRepeats) {
+
+  /*--- Binomial coefficient (s+t)! / (s! t!), in floating point as only comparisons are needed. ---*/
+
+  passivedouble beta = 1.0;
+  for (unsigned long i = 1; i <= nCheckpoints; i++)
+    beta *= passivedouble(nRepeats + i) / i;
+  return beta;
+}
+
+long CBinomialCheckpoints::Restore(long target, vector<passivedouble>& state) {
+
+  long latest = -1;
+  unsigned short iLatest = 0;
+
+  for (unsigned short iSlot = 0; iSlot < slots.size(); iSlot++) {
+    auto& slot = slots[iSlot];
+    if (slot.step > target) {
+      if (slot.onDisk) remove(FileName(iSlot).c_str());
+      slot.step = -1;
+      slot.state.clear();
+    }
+    else if (slot.step > latest) {
+      latest = slot.step;
+      iLatest = iSlot;
+    }
+  }
+
+  if (latest < 0) return latest;
+
+  const auto& slot = slots[iLatest];
+
+  if (!slot.onDisk) {
+    state = slot.state;
+  }
+  else {
+    ifstream file(FileName(iLatest), ios::binary);
+    if (!file.is_open())
+      SU2_MPI::Error("Could not open the checkpoint file " + FileName(iLatest), CURRENT_FUNCTION);
+
+    unsigned long size = 0;
+    file.read(reinterpret_cast<char*>(&size), sizeof(unsigned long));
+    state.resize(size);
+    file.read(reinterpret_cast<char*>(state.data()), size*sizeof(passivedouble));
+  }
+
+  return latest;
+}
+
+long CBinomialCheckpoints::NextCheckpoint(long current, long target) const {
+
+  const unsigned long nFree = count_if(slots.begin(), slots.end(), [](const CSlot& slot) { return slot.step < 0; });
+  const unsigned long nSteps = target - current;
+
+  if ((nFree == 0) || (nSteps < 2)) return target;
+
+  /*--- With s free checkpoints find the minimum number of repetitions t to reverse the nSteps,
+   *    then leave beta(s-1,t) steps after the next checkpoint (the rest are reversed later with s). ---*/
+
+  unsigned long nRepeats = 0;
+  while (Beta(nFree, nRepeats) < nSteps) nRepeats++;
+
+  const auto nAfter = static_cast<unsigned long>(min<passivedouble>(Beta(nFree-1, nRepeats), nSteps));
+
+  return current + max<long>(1, nSteps - nAfter);
+}
+
+void CBinomialCheckpoints::Store(long step, const vector<passivedouble>& state) {
+
+  /*--- The slots in memory come first. ---*/
+
+  unsigned short iSlot = 0;
+  while ((iSlot < slots.size()) && (slots[iSlot].step >= 0)) iSlot++;
+
+  if (iSlot == slots.size())
+    SU2_MPI::Error("There are no free checkpoints.", CURRENT_FUNCTION);
+
+  auto& slot = slots[iSlot];
+  slot.step = step;
+
+  if (!slot.onDisk) {
+    slot.state = state;
+    return;
+  }
+
+  ofstream file(FileName(iSlot), ios::binary);
+  if (!file.is_open())
+    SU2_MPI::Error("Could not open the checkpoint file " + FileName(iSlot), CURRENT_FUNCTION);
+
+  const unsigned long size = state.size();
+  file.write(reinterpret_cast<const char*>(&size), sizeof(unsigned long));
+  file.write(reinterpret_cast<const char*>(state.data()), size*sizeof(passivedouble));
+}
@@ -0,0 +1,190 @@
+/*!
+ * \file CCommProfiler.cpp
+ * \brief Report of the MPI communication and of the load imbalance of the ranks.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/CCommProfiler.hpp"
+#include "../../include/mpi_structure.hpp"
+#include "../../include/option_structure.hpp"
+#include "../../include/toolboxes/printing_toolbox.hpp"
+
+#include <map>
+#include <vector>
+#include <iostream>
+#include <algorithm>
+
+bool CCommProfiler::active = false;
+int CCommProfiler::currentKind = CCommProfiler::GEOMETRY_COMMS;
+CCommProfiler::CCounter CCommProfiler::counters[CCommProfiler::N_KIND];
+CCommProfiler::Clock::time_point CCommProfiler::start;
+
+void CCommProfiler::Enable() {
+
+  for (auto& counter : counters) counter = CCounter();
+  currentKind = GEOMETRY_COMMS;
+  start = Clock::now();
+  active = true;
+}
+
+passivedouble CCommProfiler::GetComputeTime() {
+
+  if (!active) return 0.0;
+
+  passivedouble wait = 0.0;
+  for (const auto& counter : counters) wait += counter.time;
+
+  return std::chrono::duration<passivedouble>(Clock::now() - start).count() - wait;
+}
+
+void CCommProfiler::Report(unsigned long nPointDomain, int nNeighbor) {
+
+  if (!active) return;
+
+  const passivedouble elapsed = std::chrono::duration<passivedouble>(Clock::now() - start).count();
+
+  /*--- The comms of the report are not counted. ---*/
+
+  active = false;
+
+  const int rank = SU2_MPI::GetRank();
+  const int size = SU2_MPI::GetSize();
+
+  /*--- Values of the rank: computation and wait time, work, neighbors, and the
+   *    exchanges, messages, bytes and wait time of each kind of comms. ---*/
+
+  enum : int {COMPUTE = 0, WAIT = 1, POINTS = 2, NEIGHBORS = 3, KINDS = 4};
+  constexpr int nValue = KINDS + 4*N_KIND;
+
+  std::vector<passivedouble> local(nValue, 0.0);
+  for (int iKind = 0; iKind < N_KIND; ++iKind) {
+    local[WAIT] += counters[iKind].time;
+    local[KINDS + 4*iKind + 0] = counters[iKind].exchanges;
+    local[KINDS + 4*iKind + 1] = counters[iKind].messages;
+    local[KINDS + 4*iKind + 2] = counters[iKind].bytes;
+    local[KINDS + 4*iKind + 3] = counters[iKind].time;
+  }
+  local[COMPUTE] = std::max(elapsed - local[WAIT], passivedouble(0.0));
+  local[POINTS] = nPointDomain;
+  local[NEIGHBORS] = nNeighbor;
+
+  std::vector<passivedouble> all((rank == MASTER_NODE)? nValue*size : 0);
+#ifdef HAVE_MPI
+  SelectMPIWrapper<passivedouble>::W::Gather(local.data(), nValue, MPI_DOUBLE, all.data(), nValue, MPI_DOUBLE,
+                                             MASTER_NODE, SU2_MPI::GetComm());
+#else
+  all = local;
+#endif
+
+  if (rank != MASTER_NODE) return;
+
+  /*--- Minimum, average and maximum over the ranks, and the slowest rank. ---*/
+
+  struct CStats { passivedouble min, avg, max; int maxRank; };
+
+  auto stats = [&](int iValue) {
+    CStats s = {all[iValue], 0.0, all[iValue], 0};
+    for (int iRank = 0; iRank < size; ++iRank) {
+      const passivedouble x = all[iRank*nValue + iValue];
+      s.avg += x / size;
+      s.min = std::min(s.min, x);
+      if (x > s.max) { s.max = x; s.maxRank = iRank; }
+    }
+    return s;
+  };
+
+  auto ratio = [](const CStats& s) { return (s.avg > 0.0)? s.max/s.avg : 1.0; };
+
+  const char* kindNames[N_KIND] = {"Geometry", "Solver", "Linear system", "Allreduce"};
+
+  std::cout << std::endl << "-- MPI communication of the " << size << " ranks (per rank, since the end of the "
+            << "preprocessing):" << std::endl;
+
+  PrintingToolbox::CTablePrinter CommTable(&std::cout);
+  CommTable.AddColumn("Comms", 16);
+  CommTable.AddColumn("Exchanges", 10);
+  CommTable.AddColumn("Msgs/exch.", 10);
+  CommTable.AddColumn("Avg. MB", 10);
+  CommTable.AddColumn("Max. MB", 10);
+  CommTable.AddColumn("Avg. wait [s]", 13);
+  CommTable.AddColumn("Max. wait [s]", 13);
+  CommTable.SetAlign(PrintingToolbox::CTablePrinter::LEFT);
+  CommTable.PrintHeader();
+
+  for (int iKind = 0; iKind < N_KIND; ++iKind) {
+    const CStats exchanges = stats(KINDS + 4*iKind + 0);
+    const CStats messages = stats(KINDS + 4*iKind + 1);
+    const CStats bytes = stats(KINDS + 4*iKind + 2);
+    const CStats wait = stats(KINDS + 4*iKind + 3);
+    const passivedouble perExchange = (exchanges.avg > 0.0)? messages.avg/exchanges.avg : 0.0;
+
+    CommTable << kindNames[iKind] << exchanges.avg << perExchange << bytes.avg*1e-6 << bytes.max*1e-6
+              << wait.avg << wait.max;
+  }
+  CommTable.PrintFooter();
+
+  std::cout << std::endl << "-- Load imbalance of the ranks (Max/Avg is 1 when perfectly balanced):" << std::endl;
+
+  PrintingToolbox::CTablePrinter ImbalanceTable(&std::cout);
+  ImbalanceTable.AddColumn("Quantity", 16);
+  ImbalanceTable.AddColumn("Min.", 12);
+  ImbalanceTable.AddColumn("Avg.", 12);
+  ImbalanceTable.AddColumn("Max.", 12);
+  ImbalanceTable.AddColumn("Max/Avg", 10);
+  ImbalanceTable.AddColumn("Max. rank", 10);
+  ImbalanceTable.SetAlign(PrintingToolbox::CTablePrinter::LEFT);
+  ImbalanceTable.PrintHeader();
+
+  const CStats compute = stats(COMPUTE), wait = stats(WAIT), points = stats(POINTS), neighbors = stats(NEIGHBORS);
+
+  ImbalanceTable << "Compute [s]" << compute.min << compute.avg << compute.max << ratio(compute) << compute.maxRank;
+  ImbalanceTable << "Wait [s]" << wait.min << wait.avg << wait.max << ratio(wait) << wait.maxRank;
+  ImbalanceTable << "Domain points" << points.min << points.avg << points.max << ratio(points) << points.maxRank;
+  ImbalanceTable << "Neighbors" << neighbors.min << neighbors.avg << neighbors.max << ratio(neighbors)
+                 << neighbors.maxRank;
+  ImbalanceTable.PrintFooter();
+
+  /*--- Number of ranks with each number of neighbors. ---*/
+
+  std::map<int,int> distribution;
+  for (int iRank = 0; iRank < size; ++iRank)
+    distribution[int(all[iRank*nValue + NEIGHBORS])]++;
+
+  std::cout << std::endl << "-- Distribution of the number of neighbors of the ranks:" << std::endl;
+
+  PrintingToolbox::CTablePrinter NeighborTable(&std::cout);
+  NeighborTable.AddColumn("Neighbors", 10);
+  NeighborTable.AddColumn("Ranks", 10);
+  NeighborTable.SetAlign(PrintingToolbox::CTablePrinter::LEFT);
+  NeighborTable.PrintHeader();
+  for (const auto& entry : distribution) NeighborTable << entry.first << entry.second;
+  NeighborTable.PrintFooter();
+
+  /*--- The computation is imbalanced although the points are not, their work differs. ---*/
+
+  if ((ratio(compute) > 1.1) && (ratio(points) < 1.05))
+    std::cout << "The computation is imbalanced for balanced points, consider PARTITION_WEIGHTS." << std::endl;
+
+  std::cout << std::endl;
+}
@@ -0,0 +1,159 @@
+/*!
+ * \file CQuasiNewtonInvLeastSquares.cpp
+ * \brief Implementation of the quasi-Newton (Anderson) acceleration of fixed-point iterations.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/CQuasiNewtonInvLeastSquares.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+void CQuasiNewtonInvLeastSquares::resize(unsigned short nHistory, unsigned long size, unsigned long owned) {
+
+  nMaxSamples = (nHistory > 0)? nHistory+1 : 0;
+  nSamples = 0;
+  iNewest = 0;
+  nOwned = owned;
+
+  fpSample.assign(nMaxSamples, vector<passivedouble>(size, 0.0));
+  resSample.assign(nMaxSamples, vector<passivedouble>(size, 0.0));
+  gram.assign(nMaxSamples*nMaxSamples, 0.0);
+
+  current.assign(size, 0.0);
+  fpResult.assign(size, 0.0);
+}
+
+const vector<passivedouble>& CQuasiNewtonInvLeastSquares::compute() {
+
+  const auto size = current.size();
+
+  if (!active()) {
+    current = fpResult;
+    return current;
+  }
+
+  /*--- Store the new sample, replacing the oldest when full. ---*/
+
+  iNewest = (nSamples == 0)? 0 : (iNewest+1) % nMaxSamples;
+  nSamples = min<unsigned short>(nSamples+1, nMaxSamples);
+  const auto k = iNewest;
+
+  auto position = [&](unsigned short age) { return (k + nMaxSamples - age) % nMaxSamples; };
+
+  fpSample[k] = fpResult;
+  for (auto i = 0ul; i < size; ++i)
+    resSample[k][i] = fpResult[i] - current[i];
+
+  /*--- Inner products of the new residual with those of all samples, the others are known. ---*/
+
+  vector<passivedouble> localDot(nSamples, 0.0), dot(nSamples, 0.0);
+
+  for (auto age = 0u; age < nSamples; ++age) {
+    const auto& res = resSample[position(age)];
+    passivedouble sum = 0.0;
+    for (auto i = 0ul; i < nOwned; ++i) sum += resSample[k][i] * res[i];
+    localDot[age] = sum;
+  }
+
+  SelectMPIWrapper<passivedouble>::W::Allreduce(localDot.data(), dot.data(), nSamples,
+                                                MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+
+  for (auto age = 0u; age < nSamples; ++age) {
+    const auto s = position(age);
+    gram[k*nMaxSamples+s] = gram[s*nMaxSamples+k] = dot[age];
+  }
+
+  auto G = [&](unsigned short a, unsigned short b) { return gram[a*nMaxSamples+b]; };
+
+  /*--- Least squares for the coefficients of the differences of residuals (newest minus older),
+   *    via the normal equations which are small. Nearly dependent differences are removed by
+   *    discarding the oldest samples until the elimination has no small pivots. ---*/
+
+  vector<passivedouble> coeff;
+
+  while (nSamples > 1) {
+    const unsigned short nCol = nSamples-1;
+
+    vector<passivedouble> A(nCol*nCol), b(nCol);
+    passivedouble maxDiag = 0.0;
+
+    for (auto i = 0u; i < nCol; ++i) {
+      const auto si = position(i+1);
+      b[i] = G(k,k) - G(si,k);
+      for (auto j = 0u; j < nCol; ++j) {
+        const auto sj = position(j+1);
+        A[i*nCol+j] = G(k,k) - G(k,sj) - G(si,k) + G(si,sj);
+      }
+      maxDiag = max(maxDiag, A[i*nCol+i]);
+    }
+
+    /*--- Gaussian elimination with partial pivoting. ---*/
+
+    bool singular = (maxDiag <= 0.0);
+
+    for (auto i = 0u; i < nCol && !singular; ++i) {
+      auto p = i;
+      for (auto r = i+1; r < nCol; ++r)
+        if (fabs(A[r*nCol+i]) > fabs(A[p*nCol+i])) p = r;
+
+      if (fabs(A[p*nCol+i]) <= 1e-12*maxDiag) { singular = true; break; }
+
+      if (p != i) {
+        for (auto j = 0u; j < nCol; ++j) swap(A[i*nCol+j], A[p*nCol+j]);
+        swap(b[i], b[p]);
+      }
+      for (auto r = i+1; r < nCol; ++r) {
+        const passivedouble f = A[r*nCol+i] / A[i*nCol+i];
+        for (auto j = i; j < nCol; ++j) A[r*nCol+j] -= f * A[i*nCol+j];
+        b[r] -= f * b[i];
+      }
+    }
+
+    if (singular) {
+      --nSamples;
+      continue;
+    }
+
+    coeff.resize(nCol);
+    for (auto i = nCol; i-- > 0; ) {
+      passivedouble sum = b[i];
+      for (auto j = i+1; j < nCol; ++j) sum -= A[i*nCol+j] * coeff[j];
+      coeff[i] = sum / A[i*nCol+i];
+    }
+    break;
+  }
+
+  /*--- New iterate, the same combination of the results of G. ---*/
+
+  current = fpSample[k];
+
+  for (auto j = 0u; j < coeff.size(); ++j) {
+    const auto& fp = fpSample[position(j+1)];
+    for (auto i = 0ul; i < size; ++i)
+      current[i] -= coeff[j] * (fpSample[k][i] - fp[i]);
+  }
+
+  return current;
+}
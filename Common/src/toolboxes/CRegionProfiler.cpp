@@ -0,0 +1,308 @@
+/*!
+ * \file CRegionProfiler.cpp
+ * \brief Lightweight profiler of named code regions.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/CRegionProfiler.hpp"
+#include "../../include/toolboxes/printing_toolbox.hpp"
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#ifdef VTUNEPROF
+#include <ittnotify.h>
+static __itt_domain* ittDomain = nullptr;
+static vector<__itt_string_handle*> ittHandles;
+#endif
+#ifdef HAVE_NVTX
+#include <nvToolsExt.h>
+#endif
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+bool CRegionProfiler::active = false;
+int CRegionProfiler::nThread = 0;
+vector<string> CRegionProfiler::names;
+vector<CRegionProfiler::CCounter> CRegionProfiler::counters;
+int CRegionProfiler::nEvent = 0;
+vector<int> CRegionProfiler::eventFds;
+string CRegionProfiler::eventStatus;
+
+/*--- Names of the hardware counters, in the order of the events. ---*/
+static const char* eventNames[CRegionProfiler::MAX_EVENTS] = {"Cycles", "Instructions", "LLC misses", "FLOP"};
+
+/*--- Bytes moved per last level cache miss (one cache line). ---*/
+static constexpr passivedouble lineBytes = 64.0;
+
+int CRegionProfiler::Register(const char* name) {
+
+  int id = -1;
+
+  SU2_OMP(critical(su2RegionProfiler))
+  {
+    for (size_t i = 0; (i < names.size()) && (id < 0); ++i)
+      if (names[i] == name) id = i;
+
+    if ((id < 0) && (names.size() < size_t(MAX_REGIONS))) {
+      id = names.size();
+      names.push_back(name);
+#ifdef VTUNEPROF
+      ittHandles.push_back(__itt_string_handle_create(name));
+#endif
+    }
+  }
+  return id;
+}
+
+void CRegionProfiler::Enable(bool hardwareCounters, unsigned long long flopEvent) {
+
+  if (active) return;
+
+  /*--- The counters are allocated once, for all the possible regions, such that the
+   *    regions registered later (from any thread) do not reallocate them. ---*/
+
+  nThread = omp_get_max_threads();
+  counters.assign(nThread*MAX_REGIONS, CCounter());
+
+  if (hardwareCounters) OpenEvents(flopEvent);
+
+#ifdef VTUNEPROF
+  ittDomain = __itt_domain_create("SU2");
+#endif
+
+  active = true;
+}
+
+void CRegionProfiler::OpenEvents(unsigned long long flopEvent) {
+
+#ifdef __linux__
+  const int nTry = (flopEvent != 0)? 4 : 3;
+  const uint32_t types[MAX_EVENTS] = {PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_RAW};
+  const uint64_t configs[MAX_EVENTS] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                        PERF_COUNT_HW_CACHE_MISSES, flopEvent};
+
+  eventFds.assign(nThread*MAX_EVENTS, -1);
+  int nFailed = 0;
+
+  /*--- The counters only count the thread that opens them (and the OpenMP threads are persistent),
+   *    the events of a thread are one group, read at once at the start and end of the regions. ---*/
+
+  SU2_OMP_PARALLEL
+  {
+    const int iThread = omp_get_thread_num();
+    int* fds = &eventFds[iThread*MAX_EVENTS];
+
+    for (int iEvent = 0; iEvent < nTry; ++iEvent) {
+      perf_event_attr attr;
+      memset(&attr, 0, sizeof(attr));
+      attr.size = sizeof(attr);
+      attr.type = types[iEvent];
+      attr.config = configs[iEvent];
+      attr.disabled = (iEvent == 0);
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      attr.read_format = PERF_FORMAT_GROUP;
+
+      fds[iEvent] = syscall(__NR_perf_event_open, &attr, 0, -1, (iEvent == 0)? -1 : fds[0], 0);
+      if (fds[iEvent] < 0) {
+        SU2_OMP_ATOMIC
+        nFailed++;
+        break;
+      }
+    }
+
+    if (fds[nTry-1] >= 0) {
+      ioctl(fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+      ioctl(fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+  }
+
+  if (nFailed == 0) {
+    nEvent = nTry;
+    return;
+  }
+
+  for (int fd : eventFds) if (fd >= 0) close(fd);
+  eventFds.clear();
+  eventStatus = "perf_event_open failed, counters not supported or not allowed (see /proc/sys/kernel/perf_event_paranoid).";
+#else
+  eventStatus = "hardware counters are only supported on Linux (perf_event).";
+#endif
+}
+
+void CRegionProfiler::ReadEvents(unsigned long long* values) {
+
+  for (int iEvent = 0; iEvent < nEvent; ++iEvent) values[iEvent] = 0;
+
+#ifdef __linux__
+  const int iThread = omp_get_thread_num();
+  if (iThread >= nThread) return;
+
+  /*--- Layout of PERF_FORMAT_GROUP, the number of events followed by their values. ---*/
+  struct { uint64_t nr; uint64_t values[MAX_EVENTS]; } data;
+
+  const auto size = ssize_t((1+nEvent)*sizeof(uint64_t));
+  if (read(eventFds[iThread*MAX_EVENTS], &data, size) != size) return;
+
+  for (int iEvent = 0; iEvent < nEvent; ++iEvent) values[iEvent] = data.values[iEvent];
+#endif
+}
+
+void CRegionProfiler::BeginHook(int id) {
+#ifdef VTUNEPROF
+  __itt_task_begin(ittDomain, __itt_null, __itt_null, ittHandles[id]);
+#endif
+#ifdef HAVE_NVTX
+  nvtxRangePushA(names[id].c_str());
+#endif
+}
+
+void CRegionProfiler::EndHook(int) {
+#ifdef VTUNEPROF
+  __itt_task_end(ittDomain);
+#endif
+#ifdef HAVE_NVTX
+  nvtxRangePop();
+#endif
+}
+
+void CRegionProfiler::Write(const string& fileName, int rank) {
+
+  if (!active) return;
+
+  /*--- Combine the threads, the time of a region is the one of the slowest thread,
+   *    the thread time is the sum over the threads (e.g. to see the load imbalance),
+   *    and the hardware counts are summed over the threads. ---*/
+
+  struct CSummary {
+    unsigned long calls = 0;
+    int threads = 0;
+    passivedouble time = 0.0, threadTime = 0.0, maxTime = 0.0, bytes = 0.0;
+    unsigned long long events[MAX_EVENTS] = {};
+  };
+  vector<CSummary> summary(names.size());
+
+  for (size_t id = 0; id < names.size(); ++id) {
+    for (int iThread = 0; iThread < nThread; ++iThread) {
+      const auto& counter = counters[iThread*MAX_REGIONS + id];
+      if (counter.calls == 0) continue;
+      summary[id].calls += counter.calls;
+      summary[id].threads++;
+      summary[id].time = max(summary[id].time, counter.time);
+      summary[id].threadTime += counter.time;
+      summary[id].maxTime = max(summary[id].maxTime, counter.maxTime);
+      summary[id].bytes += counter.bytes;
+      for (int iEvent = 0; iEvent < nEvent; ++iEvent)
+        summary[id].events[iEvent] += counter.events[iEvent];
+    }
+  }
+
+  ofstream file(fileName + "_" + to_string(rank) + ".csv");
+  file.precision(8);
+  file << "\"Region\",\"Calls\",\"Time [s]\",\"Thread time [s]\",\"Max time per call [s]\",\"Threads\",\"Est. bytes\"";
+  for (int iEvent = 0; iEvent < nEvent; ++iEvent) file << ",\"" << eventNames[iEvent] << "\"";
+  file << "\n";
+  for (size_t id = 0; id < names.size(); ++id) {
+    if (summary[id].calls == 0) continue;
+    file << "\"" << names[id] << "\"," << summary[id].calls << "," << summary[id].time << ","
+         << summary[id].threadTime << "," << summary[id].maxTime << "," << summary[id].threads << ","
+         << summary[id].bytes;
+    for (int iEvent = 0; iEvent < nEvent; ++iEvent) file << "," << summary[id].events[iEvent];
+    file << "\n";
+  }
+
+  if (rank != 0) return;
+
+  cout << endl << "-- Region profiling of rank 0 (inclusive wall time of the slowest thread, all ranks in "
+       << fileName << "_<rank>.csv):" << endl;
+
+  PrintingToolbox::CTablePrinter ProfileTable(&cout);
+  ProfileTable.AddColumn("Region", 28);
+  ProfileTable.AddColumn("Calls", 10);
+  ProfileTable.AddColumn("Time [s]", 12);
+  ProfileTable.AddColumn("Per call [ms]", 14);
+  ProfileTable.AddColumn("Threads", 8);
+  ProfileTable.SetAlign(PrintingToolbox::CTablePrinter::LEFT);
+  ProfileTable.PrintHeader();
+  for (size_t id = 0; id < names.size(); ++id) {
+    if (summary[id].calls == 0) continue;
+    const passivedouble perCall = 1e3*summary[id].threadTime/summary[id].calls;
+    ProfileTable << names[id] << summary[id].calls << summary[id].time << perCall << summary[id].threads;
+  }
+  ProfileTable.PrintFooter();
+
+  if (!eventStatus.empty()) cout << "No hardware counters, " << eventStatus << endl;
+
+  /*--- Roofline metrics of the regions with a traffic estimate or hardware counters. The bandwidths are
+   *    per rank, from the estimated bytes and from the last level cache misses (cache lines), the
+   *    arithmetic intensity uses the measured traffic when available. ---*/
+
+  bool roofline = (nEvent > 0);
+  for (size_t id = 0; id < names.size(); ++id) roofline |= (summary[id].bytes > 0.0);
+  if (!roofline) return;
+
+  cout << endl << "-- Achieved bandwidth and arithmetic intensity of rank 0 ("
+       << ((nEvent > 3)? "FLOP counted" : "no FLOP event, see REGION_PROFILING_FLOP_EVENT") << "):" << endl;
+
+  PrintingToolbox::CTablePrinter RooflineTable(&cout);
+  RooflineTable.AddColumn("Region", 28);
+  RooflineTable.AddColumn("Est. GB/s", 10);
+  RooflineTable.AddColumn("LLC GB/s", 10);
+  RooflineTable.AddColumn("GFLOP/s", 10);
+  RooflineTable.AddColumn("FLOP/byte", 10);
+  RooflineTable.AddColumn("IPC", 8);
+  RooflineTable.SetAlign(PrintingToolbox::CTablePrinter::LEFT);
+  RooflineTable.PrintHeader();
+  for (size_t id = 0; id < names.size(); ++id) {
+    const auto& region = summary[id];
+    if ((region.calls == 0) || (region.time <= 0.0) || ((region.bytes <= 0.0) && (nEvent == 0))) continue;
+
+    const passivedouble measuredBytes = (nEvent > 2)? lineBytes*region.events[2] : 0.0;
+    const passivedouble flop = (nEvent > 3)? passivedouble(region.events[3]) : 0.0;
+    const passivedouble bytes = (measuredBytes > 0.0)? measuredBytes : region.bytes;
+
+    auto value = [](bool valid, passivedouble x) {
+      if (!valid) return string("-");
+      ostringstream str;
+      str.precision(4);
+      str << x;
+      return str.str();
+    };
+
+    RooflineTable << names[id]
+                  << value(region.bytes > 0.0, region.bytes/region.time*1e-9)
+                  << value(measuredBytes > 0.0, measuredBytes/region.time*1e-9)
+                  << value(flop > 0.0, flop/region.time*1e-9)
+                  << value((flop > 0.0) && (bytes > 0.0), flop/bytes)
+                  << value((nEvent > 1) && (region.events[0] > 0), passivedouble(region.events[1])/max(region.events[0], 1ull));
+  }
+  RooflineTable.PrintFooter();
+}
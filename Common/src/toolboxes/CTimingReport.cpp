@@ -0,0 +1,132 @@
+/*!
+ * \file CTimingReport.cpp
+ * \brief Wall time and memory high-water mark of nested phases.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/CTimingReport.hpp"
+#include "../../include/toolboxes/printing_toolbox.hpp"
+#include "../../include/option_structure.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+#if defined(__linux__)
+#include <cstdio>
+#include <unistd.h>
+#endif
+
+void CTimingReport::Start(const string& name) {
+
+  CPhase phase;
+  phase.name = name;
+  phase.depth = open.size();
+
+  open.emplace_back(phases.size(), Clock::now());
+  phases.push_back(phase);
+}
+
+void CTimingReport::Stop() {
+
+  if (open.empty()) return;
+
+  auto& phase = phases[open.back().first];
+  phase.time = chrono::duration<passivedouble>(Clock::now() - open.back().second).count();
+  phase.memory = GetPeakMemory();
+  open.pop_back();
+}
+
+passivedouble CTimingReport::GetPeakMemory() {
+
+#if defined(__unix__) || defined(__APPLE__)
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) return 0.0;
+#ifdef __APPLE__
+  return passivedouble(usage.ru_maxrss) / 1048576.0; // bytes
+#else
+  return passivedouble(usage.ru_maxrss) / 1024.0;    // kilobytes
+#endif
+#else
+  return 0.0;
+#endif
+}
+
+passivedouble CTimingReport::GetCurrentMemory() {
+
+#if defined(__linux__)
+  /*--- The second field of statm is the number of resident pages. ---*/
+  FILE* statm = fopen("/proc/self/statm", "r");
+  if (statm == nullptr) return 0.0;
+  unsigned long size = 0, resident = 0;
+  const int nRead = fscanf(statm, "%lu %lu", &size, &resident);
+  fclose(statm);
+  if (nRead != 2) return 0.0;
+  return passivedouble(resident) * sysconf(_SC_PAGESIZE) / 1048576.0;
+#else
+  return 0.0;
+#endif
+}
+
+void CTimingReport::Print(const string& title, SU2_MPI::Comm comm) const {
+
+  int rank = SU2_MPI::GetRank(), size = SU2_MPI::GetSize();
+
+  /*--- Pack the times and memory of all the phases to reduce them with few calls. ---*/
+
+  const auto nPhase = phases.size();
+  vector<passivedouble> local(2*nPhase), minimum(2*nPhase), maximum(2*nPhase), sum(2*nPhase);
+
+  for (auto i = 0ul; i < nPhase; ++i) {
+    local[2*i] = phases[i].time;
+    local[2*i+1] = phases[i].memory;
+  }
+
+#ifdef HAVE_MPI
+  MPI_Reduce(local.data(), minimum.data(), 2*nPhase, MPI_DOUBLE, MPI_MIN, MASTER_NODE, comm);
+  MPI_Reduce(local.data(), maximum.data(), 2*nPhase, MPI_DOUBLE, MPI_MAX, MASTER_NODE, comm);
+  MPI_Reduce(local.data(), sum.data(), 2*nPhase, MPI_DOUBLE, MPI_SUM, MASTER_NODE, comm);
+#else
+  minimum = maximum = sum = local;
+#endif
+
+  if (rank != MASTER_NODE) return;
+
+  cout << endl << "-- " << title << " (wall time over the ranks, memory high-water mark at the end of each phase):" << endl;
+
+  PrintingToolbox::CTablePrinter TimingTable(&cout);
+  TimingTable.AddColumn("Phase", 36);
+  TimingTable.AddColumn("Min [s]", 10);
+  TimingTable.AddColumn("Avg [s]", 10);
+  TimingTable.AddColumn("Max [s]", 10);
+  TimingTable.AddColumn("Max mem [MB]", 13);
+  TimingTable.AddColumn("Total mem [MB]", 15);
+  TimingTable.SetAlign(PrintingToolbox::CTablePrinter::LEFT);
+  TimingTable.PrintHeader();
+
+  for (auto i = 0ul; i < nPhase; ++i) {
+    const string name = string(2*phases[i].depth, ' ') + phases[i].name;
+    TimingTable << name << minimum[2*i] << sum[2*i]/size << maximum[2*i] << maximum[2*i+1] << sum[2*i+1];
+  }
+  TimingTable.PrintFooter();
+}
@@ -0,0 +1,267 @@
+/*!
+ * \file allocation_toolbox.cpp
+ * \brief Accounting and report of the memory by category.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/allocation_toolbox.hpp"
+#include "../../include/toolboxes/CTimingReport.hpp"
+#include "../../include/toolboxes/printing_toolbox.hpp"
+#include "../../include/option_structure.hpp"
+
+#include "../../include/omp_structure.hpp"
+
+#include <vector>
+#include <iostream>
+#include <algorithm>
+#include <string>
+#include <cctype>
+#if defined(__linux__)
+#include <sched.h>
+#include <dirent.h>
+#endif
+
+namespace MemoryAllocation
+{
+
+/*--- Zero initialized before any dynamic initialization, as the allocations of global objects may need it. ---*/
+CMemoryCounters memoryCounters;
+
+const char* memory_category_name(int category)
+{
+  static const char* names[N_MEMORY_CATEGORY] = {"Other", "Geometry", "Variables", "Jacobian",
+                                                 "Preconditioner", "Linear solver", "Output", "AD tape"};
+  return names[category];
+}
+
+long long resident_memory()
+{
+  return static_cast<long long>(CTimingReport::GetCurrentMemory() * 1048576.0);
+}
+
+void* CScratchArena::allocate(size_t bytes)
+{
+  bytes = round_up(ALIGNMENT, bytes);
+
+  /*--- Move to the next block (existing or new) if the current one does not have space. ---*/
+
+  if (blocks.empty() || offset+bytes > blocks[current].size) {
+    const size_t next = blocks.empty()? 0 : current+1;
+
+    if (next == blocks.size() || bytes > blocks[next].size) {
+      const size_t size = std::max<size_t>(std::max<size_t>(MIN_BLOCK_SIZE, bytes),
+                                           blocks.empty()? 0 : 2*blocks.back().size);
+      char* data = aligned_alloc<char>(ALIGNMENT, size, MEMORY_OTHER);
+      if (data == nullptr)
+        SU2_MPI::Error("Could not allocate the arena of temporaries.", CURRENT_FUNCTION);
+      blocks.insert(blocks.begin()+next, {data, size});
+    }
+    current = next;
+    offset = 0;
+  }
+
+  void* ptr = blocks[current].data + offset;
+  offset += bytes;
+  return ptr;
+}
+
+void CScratchArena::release(const CMark& start) noexcept
+{
+  while (destructors.size() > start.nDestructor) {
+    const auto& d = destructors.back();
+    d.destroy(d.ptr, d.n);
+    destructors.pop_back();
+  }
+  current = start.block;
+  offset = start.offset;
+
+  /*--- Consolidate the blocks when the arena is empty, the next uses will fit in one. ---*/
+
+  if (current == 0 && offset == 0 && blocks.size() > 1) {
+    size_t size = 0;
+    for (const auto& block : blocks) size += block.size;
+    clear();
+    char* data = aligned_alloc<char>(ALIGNMENT, size, MEMORY_OTHER);
+    if (data != nullptr) blocks.push_back({data, size});
+  }
+}
+
+void CScratchArena::clear() noexcept
+{
+  for (auto& block : blocks) aligned_free(block.data);
+  blocks.clear();
+  current = offset = 0;
+}
+
+CScratchArena& scratch_arena()
+{
+  static thread_local CScratchArena arena;
+  return arena;
+}
+
+void print_memory_report(const std::string& title)
+{
+  const int rank = SU2_MPI::GetRank(), size = SU2_MPI::GetSize();
+
+  /*--- The tape is not allocated by this toolbox, its current size is accounted now. ---*/
+
+  const auto tapeBytes = static_cast<long long>(AD::GetTapeMemory());
+  track_memory(MEMORY_AD_TAPE, tapeBytes - memory_in_use(MEMORY_AD_TAPE));
+
+  /*--- Current and peak MB of each category, of all the tracked memory, and of the process. ---*/
+
+  constexpr passivedouble MB = 1.0/1048576.0;
+  constexpr int TRACKED = N_MEMORY_CATEGORY, UNTRACKED = N_MEMORY_CATEGORY+1, RESIDENT = N_MEMORY_CATEGORY+2;
+  constexpr int nRow = N_MEMORY_CATEGORY+3;
+
+  std::vector<passivedouble> local(2*nRow, 0.0), maximum(2*nRow), sum(2*nRow);
+
+  for (int iCat = 0; iCat < N_MEMORY_CATEGORY; ++iCat) {
+    local[2*iCat] = memoryCounters.current[iCat].load(std::memory_order_relaxed) * MB;
+    local[2*iCat+1] = memoryCounters.peak[iCat].load(std::memory_order_relaxed) * MB;
+  }
+  local[2*TRACKED] = memoryCounters.totalCurrent.load(std::memory_order_relaxed) * MB;
+  local[2*TRACKED+1] = memoryCounters.totalPeak.load(std::memory_order_relaxed) * MB;
+  local[2*RESIDENT] = CTimingReport::GetCurrentMemory();
+  local[2*RESIDENT+1] = CTimingReport::GetPeakMemory();
+  local[2*UNTRACKED] = std::max(local[2*RESIDENT] - local[2*TRACKED], passivedouble(0.0));
+
+#ifdef HAVE_MPI
+  MPI_Reduce(local.data(), maximum.data(), 2*nRow, MPI_DOUBLE, MPI_MAX, MASTER_NODE, MPI_COMM_WORLD);
+  MPI_Reduce(local.data(), sum.data(), 2*nRow, MPI_DOUBLE, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
+#else
+  maximum = local;
+  sum = local;
+#endif
+
+  if (rank != MASTER_NODE) return;
+
+  std::cout << std::endl << "-- " << title << " (MB, over the " << size << " ranks, the peaks are the "
+            << "high-water marks of each rank):" << std::endl;
+
+  PrintingToolbox::CTablePrinter MemoryTable(&std::cout);
+  MemoryTable.AddColumn("Category", 16);
+  MemoryTable.AddColumn("Avg.", 11);
+  MemoryTable.AddColumn("Max.", 11);
+  MemoryTable.AddColumn("Total", 11);
+  MemoryTable.AddColumn("Max. peak", 11);
+  MemoryTable.AddColumn("Total peak", 11);
+  MemoryTable.SetAlign(PrintingToolbox::CTablePrinter::LEFT);
+  MemoryTable.PrintHeader();
+
+  auto PrintRow = [&](const char* name, int iRow, bool hasPeak) {
+    MemoryTable << name << sum[2*iRow]/size << maximum[2*iRow] << sum[2*iRow];
+    if (hasPeak) MemoryTable << maximum[2*iRow+1] << sum[2*iRow+1];
+    else MemoryTable << "-" << "-";
+  };
+
+  for (int iCat = 0; iCat < N_MEMORY_CATEGORY; ++iCat) PrintRow(memory_category_name(iCat), iCat, true);
+  MemoryTable.PrintFooter();
+  PrintRow("Tracked", TRACKED, true);
+  PrintRow("Untracked", UNTRACKED, false);
+  PrintRow("Resident", RESIDENT, true);
+  MemoryTable.PrintFooter();
+
+  std::cout << "Untracked is the resident memory of the process that is not attributed to a category." << std::endl;
+}
+
+/*!
+ * \brief NUMA node of a CPU from the sysfs entries (-1 if not available).
+ */
+static int numa_node_of_cpu(int cpu)
+{
+  int node = -1;
+#if defined(__linux__)
+  if (cpu < 0) return node;
+  const std::string path = "/sys/devices/system/cpu/cpu" + std::to_string(cpu);
+  DIR* dir = opendir(path.c_str());
+  if (dir == nullptr) return node;
+  while (const dirent* entry = readdir(dir)) {
+    const std::string name = entry->d_name;
+    if ((name.size() > 4) && (name.compare(0, 4, "node") == 0) && isdigit(name[4])) {
+      node = std::stoi(name.substr(4));
+      break;
+    }
+  }
+  closedir(dir);
+#endif
+  return node;
+}
+
+void print_thread_placement()
+{
+  const int rank = SU2_MPI::GetRank(), size = SU2_MPI::GetSize();
+  const int nThread = omp_get_max_threads();
+
+  /*--- CPU and NUMA node of each thread (-1 if not known). ---*/
+
+  std::vector<int> local(2*nThread, -1), all(2*nThread*size, -1);
+
+#if defined(__linux__)
+  SU2_OMP_PARALLEL
+  {
+    const int iThread = omp_get_thread_num();
+    local[2*iThread] = sched_getcpu();
+    local[2*iThread+1] = numa_node_of_cpu(local[2*iThread]);
+  }
+#endif
+
+#ifdef HAVE_MPI
+  MPI_Gather(local.data(), 2*nThread, MPI_INT, all.data(), 2*nThread, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+#else
+  all = local;
+#endif
+
+  if (rank != MASTER_NODE) return;
+
+  /*--- One line per rank (the first ranks only for large runs), CPU(NUMA node) of each thread. ---*/
+
+  constexpr int maxRanks = 16;
+  int nShared = 0;
+
+  std::cout << std::endl << "-- Placement of the " << nThread << " threads of each rank, CPU(NUMA node):" << std::endl;
+
+  for (int iRank = 0; iRank < size; ++iRank) {
+    const int* data = &all[2*nThread*iRank];
+
+    std::vector<int> cpus;
+    for (int iThread = 0; iThread < nThread; ++iThread) cpus.push_back(data[2*iThread]);
+    std::sort(cpus.begin(), cpus.end());
+    if ((cpus[0] >= 0) && (std::adjacent_find(cpus.begin(), cpus.end()) != cpus.end())) ++nShared;
+
+    if (iRank >= maxRanks) continue;
+    std::cout << "Rank " << iRank << ":";
+    for (int iThread = 0; iThread < nThread; ++iThread)
+      std::cout << " " << data[2*iThread] << "(" << data[2*iThread+1] << ")";
+    std::cout << std::endl;
+  }
+  if (size > maxRanks) std::cout << "(" << size-maxRanks << " more ranks)" << std::endl;
+
+  if (nShared > 0) {
+    std::cout << "WARNING: On " << nShared << " ranks some threads share a CPU, they are probably not bound,\n"
+              << "         consider OMP_PROC_BIND=close and OMP_PLACES=cores (and binding the ranks)." << std::endl;
+  }
+}
+
+} // namespace
@@ -0,0 +1,276 @@
+/*!
+ * \file compression_toolbox.cpp
+ * \brief Compression of the data of the SU2 binary restart files.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/compression_toolbox.hpp"
+#include "../../include/geometry/CGeometry.hpp"
+#include "../../include/option_structure.hpp"
+
+#include <fstream>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+void CompressionToolbox::CompressBlock(const passivedouble* data, unsigned long nPoint, unsigned long nVar,
+                                       const passivedouble* errorBound, int level, std::vector<char>& block) {
+
+#ifdef HAVE_ZLIB
+
+  /*--- The uncompressed stream holds a flag per field (1 if it is quantized)
+   and the bytes of the values of each field, shuffled by significance. ---*/
+
+  const unsigned long nValue = nPoint*nVar;
+  std::vector<unsigned char> shuffled(nVar + sizeof(uint64_t)*nValue);
+  unsigned char* lossy = shuffled.data();
+  unsigned char* planes = lossy + nVar;
+
+  for (unsigned long iVar = 0; iVar < nVar; ++iVar) {
+
+    /*--- The quantized values must fit into the mantissa, otherwise the field is lossless. ---*/
+
+    const passivedouble bound = (errorBound != nullptr)? errorBound[iVar] : 0.0;
+    const passivedouble maxValue = 2.0*bound*4503599627370496.0;
+
+    lossy[iVar] = (bound > 0.0);
+    for (unsigned long iPoint = 0; lossy[iVar] && iPoint < nPoint; ++iPoint) {
+      const passivedouble value = data[iPoint*nVar+iVar];
+      lossy[iVar] = std::isfinite(value) && (fabs(value) < maxValue);
+    }
+
+    int64_t prevQuant = 0;
+
+    for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+
+      const passivedouble value = data[iPoint*nVar+iVar];
+      uint64_t word;
+
+      if (lossy[iVar]) {
+        /*--- Difference to the previous point, zig-zag encoded to keep small values small. ---*/
+        const int64_t quant = llround(value/(2.0*bound));
+        const int64_t delta = quant - prevQuant;
+        prevQuant = quant;
+        word = (uint64_t(delta) << 1) ^ uint64_t(delta >> 63);
+      }
+      else {
+        memcpy(&word, &value, sizeof(uint64_t));
+      }
+
+      const unsigned long iValue = iVar*nPoint + iPoint;
+      for (unsigned long iByte = 0; iByte < sizeof(uint64_t); ++iByte)
+        planes[iByte*nValue + iValue] = (word >> (8*iByte)) & 0xFF;
+    }
+  }
+
+  uLongf nBytes = compressBound(shuffled.size());
+  block.resize(nBytes);
+
+  if (compress2(reinterpret_cast<Bytef*>(block.data()), &nBytes, shuffled.data(), shuffled.size(), level) != Z_OK)
+    SU2_MPI::Error("Compression of the restart data failed.", CURRENT_FUNCTION);
+
+  block.resize(nBytes);
+
+#else
+  SU2_MPI::Error("Compressed restart files require SU2 to be built with zlib.", CURRENT_FUNCTION);
+#endif
+
+}
+
+void CompressionToolbox::DecompressBlock(const char* block, unsigned long nBytes, unsigned long nPoint, unsigned long nVar,
+                                         const passivedouble* errorBound, passivedouble* data) {
+
+#ifdef HAVE_ZLIB
+
+  const unsigned long nValue = nPoint*nVar;
+  std::vector<unsigned char> shuffled(nVar + sizeof(uint64_t)*nValue);
+  const unsigned char* lossy = shuffled.data();
+  const unsigned char* planes = lossy + nVar;
+
+  uLongf size = shuffled.size();
+
+  if ((uncompress(shuffled.data(), &size, reinterpret_cast<const Bytef*>(block), nBytes) != Z_OK) ||
+      (size != shuffled.size()))
+    SU2_MPI::Error("Decompression of the restart data failed, the file may be corrupted.", CURRENT_FUNCTION);
+
+  for (unsigned long iVar = 0; iVar < nVar; ++iVar) {
+
+    int64_t quant = 0;
+
+    for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+
+      const unsigned long iValue = iVar*nPoint + iPoint;
+      uint64_t word = 0;
+      for (unsigned long iByte = 0; iByte < sizeof(uint64_t); ++iByte)
+        word |= uint64_t(planes[iByte*nValue + iValue]) << (8*iByte);
+
+      passivedouble& value = data[iPoint*nVar+iVar];
+
+      if (lossy[iVar]) {
+        quant += int64_t(word >> 1) ^ -int64_t(word & 1);
+        value = quant*2.0*errorBound[iVar];
+      }
+      else {
+        memcpy(&value, &word, sizeof(uint64_t));
+      }
+    }
+  }
+
+#else
+  SU2_MPI::Error("Compressed restart files require SU2 to be built with zlib.", CURRENT_FUNCTION);
+#endif
+
+}
+
+passivedouble* CompressionToolbox::ReadRestartData(const std::string& fileName, const int* header,
+                                                   const CGeometry* geometry) {
+
+  const int rank = SU2_MPI::GetRank();
+  const int size = SU2_MPI::GetSize();
+
+  const unsigned long nVar = header[1];
+  const unsigned long nPointFile = header[2];
+  const unsigned long nBlock = header[4];
+
+  /*--- The master reads the error bounds and the table of the blocks. ---*/
+
+  std::vector<passivedouble> errorBound(nVar);
+  std::vector<unsigned long> table(2*nBlock);
+
+  const unsigned long tableOffset = 5*sizeof(int) + nVar*CGNS_STRING_SIZE*sizeof(char);
+  const unsigned long dataOffset = tableOffset + nVar*sizeof(passivedouble) + table.size()*sizeof(unsigned long);
+
+  if (rank == MASTER_NODE) {
+    std::ifstream file(fileName, std::ios::binary);
+    file.seekg(tableOffset);
+    file.read(reinterpret_cast<char*>(errorBound.data()), nVar*sizeof(passivedouble));
+    file.read(reinterpret_cast<char*>(table.data()), table.size()*sizeof(unsigned long));
+    if (!file) SU2_MPI::Error("Error reading restart file " + fileName, CURRENT_FUNCTION);
+  }
+
+  /*--- The passive values are communicated as bytes (MPI_DOUBLE is the active type with AD). ---*/
+
+  SU2_MPI::Bcast(errorBound.data(), nVar*sizeof(passivedouble), MPI_CHAR, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Bcast(table.data(), table.size()*sizeof(unsigned long), MPI_CHAR, MASTER_NODE, MPI_COMM_WORLD);
+
+  std::vector<unsigned long> firstPoint(nBlock+1, 0), blockOffset(nBlock+1, dataOffset);
+  for (unsigned long iBlock = 0; iBlock < nBlock; ++iBlock) {
+    firstPoint[iBlock+1] = firstPoint[iBlock] + table[2*iBlock];
+    blockOffset[iBlock+1] = blockOffset[iBlock] + table[2*iBlock+1];
+  }
+  if (firstPoint[nBlock] != nPointFile)
+    SU2_MPI::Error("The blocks of restart file " + fileName + " do not match its number of points.", CURRENT_FUNCTION);
+
+  auto BlockOfPoint = [&firstPoint](unsigned long iPoint) {
+    return (std::upper_bound(firstPoint.begin(), firstPoint.end(), iPoint) - firstPoint.begin()) - 1;
+  };
+
+  /*--- Block i is decompressed by rank i%size, which is sent the global indices that it holds for each rank. ---*/
+
+  std::vector<unsigned long> myPoints;
+  myPoints.reserve(geometry->GetnPointDomain());
+
+  for (const auto& globalToLocal : geometry->GetGlobal_to_Local_Map()) {
+    if (globalToLocal.first >= nPointFile)
+      SU2_MPI::Error("Restart file " + fileName + " has fewer points than the mesh.", CURRENT_FUNCTION);
+    myPoints.push_back(globalToLocal.first);
+  }
+  const unsigned long nMyPoint = myPoints.size();
+
+  std::vector<int> nSend(size, 0), nRecv(size, 0), sendDisp(size+1, 0), recvDisp(size+1, 0);
+
+  for (auto iPoint : myPoints) nSend[BlockOfPoint(iPoint) % size]++;
+
+  SU2_MPI::Alltoall(nSend.data(), 1, MPI_INT, nRecv.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+  for (int iRank = 0; iRank < size; ++iRank) {
+    sendDisp[iRank+1] = sendDisp[iRank] + nSend[iRank];
+    recvDisp[iRank+1] = recvDisp[iRank] + nRecv[iRank];
+  }
+
+  std::vector<unsigned long> sendPoints(nMyPoint), position(nMyPoint), recvPoints(recvDisp[size]);
+  std::vector<int> counter(sendDisp.begin(), sendDisp.end()-1);
+
+  for (unsigned long iPoint = 0; iPoint < nMyPoint; ++iPoint) {
+    const int iRank = BlockOfPoint(myPoints[iPoint]) % size;
+    sendPoints[counter[iRank]] = myPoints[iPoint];
+    position[counter[iRank]] = iPoint;
+    counter[iRank]++;
+  }
+
+  SU2_MPI::Alltoallv(sendPoints.data(), nSend.data(), sendDisp.data(), MPI_UNSIGNED_LONG,
+                     recvPoints.data(), nRecv.data(), recvDisp.data(), MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+
+  /*--- Decompress the blocks of this rank. ---*/
+
+  std::vector<std::vector<passivedouble> > blockData(nBlock);
+
+  if (unsigned(rank) < nBlock) {
+    std::ifstream file(fileName, std::ios::binary);
+    std::vector<char> block;
+
+    for (unsigned long iBlock = rank; iBlock < nBlock; iBlock += size) {
+      block.resize(table[2*iBlock+1]);
+      file.seekg(blockOffset[iBlock]);
+      file.read(block.data(), block.size());
+      if (!file) SU2_MPI::Error("Error reading restart file " + fileName, CURRENT_FUNCTION);
+
+      blockData[iBlock].resize(table[2*iBlock]*nVar);
+      DecompressBlock(block.data(), block.size(), table[2*iBlock], nVar, errorBound.data(), blockData[iBlock].data());
+    }
+  }
+
+  /*--- Send back the values of the requested points. ---*/
+
+  std::vector<passivedouble> sendData(recvPoints.size()*nVar), recvData(nMyPoint*nVar);
+
+  for (unsigned long iPoint = 0; iPoint < recvPoints.size(); ++iPoint) {
+    const auto iBlock = BlockOfPoint(recvPoints[iPoint]);
+    const passivedouble* values = &blockData[iBlock][(recvPoints[iPoint]-firstPoint[iBlock])*nVar];
+    std::copy(values, values+nVar, &sendData[iPoint*nVar]);
+  }
+
+  const int pointBytes = nVar*sizeof(passivedouble);
+
+  for (int iRank = 0; iRank <= size; ++iRank) {
+    if (iRank < size) { nSend[iRank] *= pointBytes; nRecv[iRank] *= pointBytes; }
+    sendDisp[iRank] *= pointBytes; recvDisp[iRank] *= pointBytes;
+  }
+
+  SU2_MPI::Alltoallv(sendData.data(), nRecv.data(), recvDisp.data(), MPI_CHAR,
+                     recvData.data(), nSend.data(), sendDisp.data(), MPI_CHAR, MPI_COMM_WORLD);
+
+  passivedouble* data = new passivedouble[nMyPoint*nVar];
+
+  for (unsigned long iPoint = 0; iPoint < nMyPoint; ++iPoint)
+    std::copy(&recvData[iPoint*nVar], &recvData[iPoint*nVar]+nVar, &data[position[iPoint]*nVar]);
+
+  return data;
+
+}
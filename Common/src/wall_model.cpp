@@ -27,6 +27,7 @@
  */
 
 #include "../include/wall_model.hpp"
+#include "../include/omp_structure.hpp"
 #include "../../SU2_CFD/include/fluid_model.hpp"
 
 /* Prototypes for Lapack functions, if MKL or LAPACK is used. */
@@ -58,6 +59,29 @@ void CWallModel::WallShearStressAndHeatFlux(const su2double rhoExchange,
                                             su2double       &ViscosityWall,
                                             su2double       &kOverCvWall) {}
 
+void CWallModel::WallShearStressAndHeatFlux(const unsigned short nPoints,
+                                            const su2double      *tExchange,
+                                            const su2double      *velExchange,
+                                            const su2double      *muExchange,
+                                            const su2double      *pExchange,
+                                            const su2double      Wall_HeatFlux,
+                                            const bool           HeatFlux_Prescribed,
+                                            const su2double      Wall_Temperature,
+                                            const bool           Temperature_Prescribed,
+                                            CFluidModel          *FluidModel,
+                                            su2double            *tauWall,
+                                            su2double            *qWall,
+                                            su2double            *ViscosityWall,
+                                            su2double            *kOverCvWall) {
+
+  /* Default implementation, loop over the points and call the pointwise version. */
+  for(unsigned short i=0; i<nPoints; ++i)
+    WallShearStressAndHeatFlux(tExchange[i], velExchange[i], muExchange[i], pExchange[i],
+                               Wall_HeatFlux, HeatFlux_Prescribed, Wall_Temperature,
+                               Temperature_Prescribed, FluidModel, tauWall[i], qWall[i],
+                               ViscosityWall[i], kOverCvWall[i]);
+}
+
 CWallModel1DEQ::CWallModel1DEQ(CConfig      *config,
                                const string &Marker_Tag)
   :  CWallModel(config) {
@@ -114,9 +138,10 @@ void CWallModel1DEQ::WallShearStressAndHeatFlux(const su2double tExchange,
                                                 su2double &kOverCvWall) {
 
   
-  /* Set tau wall to initial guess
+  /* Set tau wall to initial guess, unless a guess is provided,
+     e.g. the value of the previous stage.
    */
-  tauWall = 0.5;
+  if(tauWall <= 0.0) tauWall = 0.5;
   qWall = 0.0;
   ViscosityWall = 0.0;
   kOverCvWall = 0.0;
@@ -377,8 +402,9 @@ void CWallModelLogLaw::WallShearStressAndHeatFlux(const su2double tExchange,
   const su2double c_v      = FluidModel->GetCv();
   const su2double nu_wall  = mu_wall / rho_wall;
 
-  /* Initial guess of the friction velocity. */ 
-  su2double u_tau = max(0.01*velExchange, 1.e-5);
+  /* Initial guess of the friction velocity, obtained from the provided
+     wall shear stress if possible. */
+  su2double u_tau = (tauWall > 0.0) ? sqrt(tauWall/rho_wall) : max(0.01*velExchange, 1.e-5);
   
   /* Set parameters for control of the Newton iteration. */
   bool converged = false;
@@ -433,3 +459,110 @@ void CWallModelLogLaw::WallShearStressAndHeatFlux(const su2double tExchange,
   ViscosityWall = mu_wall;
   kOverCvWall   = FluidModel->GetThermalConductivity()/c_v;
 }
+
+void CWallModelLogLaw::WallShearStressAndHeatFlux(const unsigned short nPoints,
+                                                  const su2double      *tExchange,
+                                                  const su2double      *velExchange,
+                                                  const su2double      *muExchange,
+                                                  const su2double      *pExchange,
+                                                  const su2double      Wall_HeatFlux,
+                                                  const bool           HeatFlux_Prescribed,
+                                                  const su2double      Wall_Temperature,
+                                                  const bool           Temperature_Prescribed,
+                                                  CFluidModel          *FluidModel,
+                                                  su2double            *tauWall,
+                                                  su2double            *qWall,
+                                                  su2double            *ViscosityWall,
+                                                  su2double            *kOverCvWall) {
+
+  /* Parameters for control of the Newton iteration, identical to the pointwise version. */
+  const unsigned short max_iter = 50;
+  const su2double tol = 1e-3;
+
+  /* Constants of the Reichardt law. */
+  const su2double cLaw = C - log(karman)/karman;
+
+  /*--- Loop over the points in chunks, such that the working arrays
+        can be allocated on the stack. ---*/
+  for(unsigned short iBeg=0; iBeg<nPoints; iBeg+=SIZE_BATCH_WALL_MODEL) {
+    const unsigned short nBatch = min(SIZE_BATCH_WALL_MODEL, nPoints-iBeg);
+
+    su2double TWall[SIZE_BATCH_WALL_MODEL], rhoWall[SIZE_BATCH_WALL_MODEL];
+    su2double cpWall[SIZE_BATCH_WALL_MODEL], nuWall[SIZE_BATCH_WALL_MODEL];
+    su2double uTau[SIZE_BATCH_WALL_MODEL];
+    bool      converged[SIZE_BATCH_WALL_MODEL];
+
+    /*--- Compute the wall properties with the fluid model, which cannot
+          be done simultaneously, and the initial guess of the friction velocity. ---*/
+    for(unsigned short i=0; i<nBatch; ++i) {
+      const unsigned short ii = iBeg + i;
+
+      TWall[i] = Temperature_Prescribed ? Wall_Temperature : tExchange[ii];
+      FluidModel->SetTDState_PT(pExchange[ii], TWall[i]);
+
+      rhoWall[i] = FluidModel->GetDensity();
+      cpWall[i]  = FluidModel->GetCp();
+      nuWall[i]  = FluidModel->GetLaminarViscosity()/rhoWall[i];
+
+      ViscosityWall[ii] = FluidModel->GetLaminarViscosity();
+      kOverCvWall[ii]   = FluidModel->GetThermalConductivity()/FluidModel->GetCv();
+
+      uTau[i] = (tauWall[ii] > 0.0) ? sqrt(tauWall[ii]/rhoWall[i]) : max(0.01*velExchange[ii], 1.e-5);
+      converged[i] = false;
+    }
+
+    /*--- Newton iterations for all points of the batch simultaneously. Points
+          that have converged are not updated anymore, such that the results
+          are the same as for the pointwise version. ---*/
+    for(unsigned short iter=0; iter<max_iter; ++iter) {
+
+      SU2_OMP_SIMD
+      for(unsigned short i=0; i<nBatch; ++i) {
+        const su2double vel    = velExchange[iBeg+i];
+        const su2double u_tau0 = uTau[i];
+        const su2double y_plus = u_tau0*h_wm/nuWall[i];
+        const su2double e1     = exp(-y_plus/11.0);
+        const su2double e2     = exp(-0.33*y_plus);
+
+        const su2double fval   = vel/u_tau0 - cLaw*(1.0 - e1 - (y_plus/11.0)*e2)
+                               - log(karman*y_plus + 1.0)/karman;
+        const su2double fprime = -vel/(u_tau0*u_tau0)
+                               - cLaw*(-(1.0/11.0)*h_wm*e2/nuWall[i]
+                               +        (1.0/11.0)*h_wm*e1/nuWall[i]
+                               +        (1.0/33.0)*u_tau0*h_wm*h_wm*e2/(nuWall[i]*nuWall[i]))
+                               - h_wm/(nuWall[i]*(karman*y_plus + 1.0));
+
+        const su2double u_tau = u_tau0 - fval/fprime;
+        const bool conv = converged[i] || (abs(1.0 - u_tau/u_tau0) < tol);
+
+        uTau[i]      = converged[i] ? u_tau0 : u_tau;
+        converged[i] = conv;
+      }
+
+      bool allConverged = true;
+      for(unsigned short i=0; i<nBatch; ++i) allConverged = allConverged && converged[i];
+      if( allConverged ) break;
+    }
+
+    /*--- Compute the wall shear stress and heat flux. ---*/
+    for(unsigned short i=0; i<nBatch; ++i) {
+      const unsigned short ii = iBeg + i;
+
+      tauWall[ii] = rhoWall[i]*uTau[i]*uTau[i];
+
+      if (Temperature_Prescribed){
+        /* The Kader's law will be used to approximate the variations of the temperature inside the boundary layer.
+         */
+        const su2double y_plus = uTau[i]*h_wm/nuWall[i];
+        const su2double lhs = - ((tExchange[ii] - TWall[i]) * rhoWall[i] * cpWall[i] * uTau[i]);
+        const su2double Gamma = - (0.01 * (Pr_lam * pow(y_plus,4.0))/(1.0 + 5.0*y_plus*pow(Pr_lam,3.0)));
+        const su2double rhs_1 = Pr_lam * y_plus * exp(Gamma);
+        const su2double rhs_2 = (2.12*log(1.0+y_plus) + pow((3.85*pow(Pr_lam,(1.0/3.0)) - 1.3),2.0) + 2.12*log(Pr_lam)) * exp(1./Gamma);
+        qWall[ii] = lhs/(rhs_1 + rhs_2);
+      }
+      else{
+        qWall[ii] = Wall_HeatFlux;
+      }
+    }
+  }
+}
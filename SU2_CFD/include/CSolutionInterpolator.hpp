@@ -0,0 +1,110 @@
+/*!
+ * \file CSolutionInterpolator.hpp
+ * \brief Header file for the class CSolutionInterpolator.
+ *        The implementations are in the <i>CSolutionInterpolator.cpp</i> file.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "../../Common/include/mpi_structure.hpp"
+#include "../../Common/include/CConfig.hpp"
+#include "../../Common/include/geometry/CGeometry.hpp"
+#include "../../Common/include/adt_structure.hpp"
+
+using namespace std;
+
+class CSolver;
+
+/*!
+ * \class CSolutionInterpolator
+ * \brief Interpolation of the values of the points of a (distributed) donor grid to the points of another grid.
+ * \details The elements of the donor grid of all ranks are in one global ADT, each target point takes the
+ *          values interpolated with the weights of the donor element that contains it, the target points out
+ *          of the donor elements (e.g. boundary points missed by the tolerance of the search, or out of a
+ *          different geometry) take the values of the nearest donor point. The donor grid is not needed
+ *          once the object is constructed.
+ */
+class CSolutionInterpolator {
+private:
+  unsigned short nVar;                     /*!< \brief Number of values of each point. */
+  vector<unsigned long> elemStart;         /*!< \brief Start of the nodes of each owned element (CSR). */
+  vector<unsigned long> elemNodes;         /*!< \brief Local points of the owned elements. */
+  vector<passivedouble> donorValues;       /*!< \brief Values of the local points of the donor grid. */
+  CADTElemClass* elemTree = nullptr;       /*!< \brief Global ADT of the owned elements of all ranks. */
+  CADTPointsOnlyClass* pointTree = nullptr; /*!< \brief Global ADT of the domain points, for points out of the grid. */
+
+public:
+  /*!
+   * \brief Constructor of the class, builds the search trees of the donor grid.
+   * \param[in] donor - Donor grid (finest level).
+   * \param[in] val_nVar - Number of values of each point.
+   * \param[in] values - Values of the local points of the donor grid (iPoint, iVar), the halos up to date.
+   */
+  CSolutionInterpolator(CGeometry *donor, unsigned short val_nVar, vector<passivedouble> values);
+
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CSolutionInterpolator(void);
+
+  /*!
+   * \brief Get the number of values of each point.
+   */
+  inline unsigned short GetnVar(void) const { return nVar; }
+
+  /*!
+   * \brief Interpolate the donor values to the domain points of a grid (collective call).
+   * \param[in] target - Target grid (finest level).
+   * \param[out] values - Values of the domain points of the target grid (iPoint, iVar).
+   * \return Number of target points (of all ranks) that take the values of the nearest donor point.
+   */
+  unsigned long Interpolate(CGeometry *target, vector<passivedouble>& values) const;
+
+  /*!
+   * \brief Copy the values of the domain points to the halos of other ranks, with the send-receive markers of
+   *        the grid (e.g. a grid without dual grid and solvers, whose values were read from a file).
+   * \param[in] geometry - Grid of the values.
+   * \param[in] config - Definition of the particular problem (set by the grid).
+   * \param[in] val_nVar - Number of values of each point.
+   * \param[in,out] values - Values of the local points (iPoint, iVar), the values of the halos are received.
+   */
+  static void CompleteHalos(const CGeometry *geometry, const CConfig *config,
+                            unsigned short val_nVar, vector<passivedouble>& values);
+
+  /*!
+   * \brief Set the flow and turbulence solution of all the multigrid levels as a restart would,
+   *        from the values of the domain points of the finest grid.
+   * \param[in] geometry - Geometrical definition of the problem (all levels).
+   * \param[in] solver - Container vector with all the solvers (all levels).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] values - Values of the domain points of the finest grid, the flow variables followed by the
+   *            turbulence variables, with a stride of stride values.
+   * \param[in] stride - Number of values of each point (at least the number of flow and turbulence variables).
+   */
+  static void SetRestartSolution(CGeometry **geometry, CSolver ***solver, CConfig *config,
+                                 const vector<passivedouble>& values, unsigned short stride);
+};
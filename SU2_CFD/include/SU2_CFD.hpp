@@ -39,6 +39,10 @@
 #include "drivers/CDiscAdjSinglezoneDriver.hpp"
 #include "drivers/CDiscAdjMultizoneDriver.hpp"
 #include "drivers/CDummyDriver.hpp"
+#include "drivers/CBenchmarkDriver.hpp"
+#include "drivers/CAdaptationDriver.hpp"
+#include "drivers/CLoadBalancingDriver.hpp"
+#include "drivers/CEnsembleDriver.hpp"
 #include "output/COutput.hpp"
 #include "../../Common/include/fem_geometry_structure.hpp"
 #include "../../Common/include/geometry/CGeometry.hpp"
@@ -0,0 +1,78 @@
+/*!
+ * \file CAdaptationDriver.hpp
+ * \brief Headers of the driver of the in-process (metric-based) adaptation cycles.
+ *        The implementation is in the <i>CAdaptationDriver.cpp</i> file.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include "CSinglezoneDriver.hpp"
+
+/*!
+ * \class CAdaptationDriver
+ * \brief Single zone driver of the cycles of solution and refinement of the grid (ADAPT_CYCLES), without files.
+ * \details After the solution of a cycle, the metric |H| of the Hessian of the density (the Green-Gauss gradient
+ *          of the density gradient of the flow solver) marks the elements whose edges are the longest in the metric
+ *          (NEW_ELEMS percent of the grid). The distributed grid is refined by CParallelGridAdaptation and held in
+ *          memory for the geometry of the next driver (CMemoryMeshReaderFVM). The old grid and solution are kept
+ *          in an ADT of its elements (CADTElemClass), the solution of the next driver is interpolated from the
+ *          elements that contain its points, instead of the free-stream initialization.
+ * \note The cycles rebuild the geometry and solver containers of the next grid (partitioning, dual grid,
+ *       multigrid), only the file round trip and the solution initialization are avoided.
+ * \author SU2 Contributors
+ */
+class CAdaptationDriver final : public CSinglezoneDriver {
+
+  struct CSolutionTransfer;               /*!< \brief Old grid and solution, from one driver to the next. */
+  static CSolutionTransfer* transfer;     /*!< \brief Pending transfer of the solution, owned by the class. */
+
+  /*!
+   * \brief Compute the metric of each domain point, the absolute value of the Hessian of the density.
+   * \return The symmetric tensors (nDim x nDim) of the domain points.
+   */
+  vector<passivedouble> ComputeMetric();
+
+  /*!
+   * \brief Interpolate the pending solution of the previous grid onto the grid of this driver (collective).
+   */
+  void InterpolateSolution();
+
+public:
+
+  /*!
+   * \brief Constructor of the class, the grid held in memory is read and the pending solution interpolated.
+   * \param[in] confFile - Configuration file name.
+   * \param[in] val_nZone - Total number of zones.
+   * \param[in] MPICommunicator - MPI communicator for SU2.
+   */
+  CAdaptationDriver(char* confFile,
+                    unsigned short val_nZone,
+                    SU2_Comm MPICommunicator);
+
+  /*!
+   * \brief Refine the grid by the metric of the solution, and keep the grid and the solution for the next driver.
+   */
+  void Adapt();
+
+};
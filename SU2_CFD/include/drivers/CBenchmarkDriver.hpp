@@ -0,0 +1,108 @@
+/*!
+ * \file CBenchmarkDriver.hpp
+ * \brief Headers of the driver that measures the throughput of the main kernels of the flow solver.
+ *        The implementation is in the <i>CBenchmarkDriver.cpp</i> file.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include "CSinglezoneDriver.hpp"
+
+#include <functional>
+
+namespace PrintingToolbox { class CTablePrinter; }
+
+/*!
+ * \class CBenchmarkDriver
+ * \brief Micro-benchmarks of the numerics, gradient, limiter and sparse linear algebra kernels of the
+ *        compressible flow solver, on the grid and state of a config (e.g. MESH_FORMAT= BOX).
+ * \details The driver is preprocessed like a single zone problem and runs one iteration, such that the
+ *          primitive variables, gradients and Jacobian hold realistic values. Each kernel is then repeated
+ *          for (at least) a fixed wall time and its time per call (the slowest rank) is reported with its
+ *          throughput, edges/s for the edge loops and GB/s (minimum memory traffic) for the algebra.
+ * \note The numerics are evaluated by one thread per rank, the other kernels use all the threads.
+ */
+class CBenchmarkDriver final : public CSinglezoneDriver {
+
+  static constexpr passivedouble MinKernelTime = 1.0;   /*!< \brief Minimum wall time of the repetitions of a kernel [s]. */
+  static constexpr unsigned long MaxRepetitions = 10000; /*!< \brief Maximum number of repetitions of a kernel. */
+
+  /*!
+   * \brief Time a (collective) kernel, the number of repetitions is the same on all ranks.
+   * \param[in] kernel - The kernel.
+   * \param[out] nRep - Number of timed repetitions.
+   * \return Wall time per call of the slowest rank [s].
+   */
+  passivedouble TimeKernel(const std::function<void()>& kernel, unsigned long& nRep) const;
+
+  /*!
+   * \brief Print a row of the benchmark table (master only).
+   * \param[in] table - The table.
+   * \param[in] name - Name of the kernel.
+   * \param[in] nRep - Number of timed repetitions.
+   * \param[in] time - Wall time per call [s].
+   * \param[in] work - Work of one call of all ranks (edges or bytes).
+   * \param[in] unit - Unit of the throughput, "edges/s" or "GB/s".
+   */
+  void PrintRow(PrintingToolbox::CTablePrinter& table, const string& name, unsigned long nRep,
+                passivedouble time, passivedouble work, const string& unit) const;
+
+  /*!
+   * \brief Convective (Roe, HLLC, AUSM) and viscous (AvgGrad) numerics, evaluated for all the edges.
+   * \param[in] table - The table of results.
+   */
+  void BenchmarkNumerics(PrintingToolbox::CTablePrinter& table);
+
+  /*!
+   * \brief Green-Gauss and least squares gradients, and the limiters, of the primitive variables.
+   * \param[in] table - The table of results.
+   */
+  void BenchmarkGradients(PrintingToolbox::CTablePrinter& table);
+
+  /*!
+   * \brief Product, LU-SGS and ILU of the Jacobian, and BLAS-1 operations of the linear system vectors.
+   * \param[in] table - The table of results.
+   * \param[in] Jacobian - The Jacobian of the flow solver.
+   */
+  template<class ScalarType>
+  void BenchmarkLinearAlgebra(PrintingToolbox::CTablePrinter& table, CSysMatrix<ScalarType>& Jacobian);
+
+public:
+
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] confFile - Configuration file name.
+   * \param[in] val_nZone - Total number of zones.
+   * \param[in] MPICommunicator - MPI communicator for SU2.
+   */
+  CBenchmarkDriver(char* confFile,
+                   unsigned short val_nZone,
+                   SU2_Comm MPICommunicator);
+
+  /*!
+   * \brief Run one iteration and the benchmarks of the kernels.
+   */
+  void StartSolver() override;
+
+};
@@ -28,6 +28,9 @@
 
 #pragma once
 #include "CSinglezoneDriver.hpp"
+#include "../../../Common/include/linear_algebra/CSysSolve.hpp"
+#include "../../../Common/include/linear_algebra/CMatrixVectorProduct.hpp"
+#include "../../../Common/include/toolboxes/CQuasiNewtonInvLeastSquares.hpp"
 
 /*!
  * \class CDiscAdjSinglezoneDriver
@@ -38,11 +41,20 @@
 class CDiscAdjSinglezoneDriver : public CSinglezoneDriver {
 protected:
 
+  /*!
+   * \brief Position markers within a combined recording (DISCADJ_COMBINED_RECORDING).
+   */
+  enum Tape_Positions {
+    GEOMETRY = 0,     /*!< \brief The inputs are registered and the geometry (metrics or mesh deformation) is recorded. */
+    ITERATION = 1     /*!< \brief The iteration and the objective function are recorded. */
+  };
+
   unsigned long nAdjoint_Iter;                  /*!< \brief The number of adjoint iterations that are run on the fixed-point solver.*/
   unsigned short RecordingState;                /*!< \brief The kind of recording the tape currently holds.*/
   unsigned short MainVariables,                 /*!< \brief The kind of recording linked to the main variables of the problem.*/
                  SecondaryVariables;            /*!< \brief The kind of recording linked to the secondary variables of the problem.*/
   su2double ObjFunc;                            /*!< \brief The value of the objective function.*/
+  vector<su2double> ObjFunc_Separate;           /*!< \brief Values of the objective functions converged separately.*/
   CIteration* direct_iteration;                 /*!< \brief A pointer to the direct iteration.*/
 
   CConfig *config;                              /*!< \brief Definition of the particular problem. */
@@ -55,6 +67,78 @@ protected:
 
   COutputLegacy* output_legacy;
 
+  /*!
+   * \brief Product with the operator of the adjoint fixed point, evaluated with the tape.
+   */
+  class CAdjointProduct final : public CMatrixVectorProduct<passivedouble> {
+  private:
+    CDiscAdjSinglezoneDriver& driver; /*!< \brief Driver that evaluates the products. */
+  public:
+    CAdjointProduct(CDiscAdjSinglezoneDriver& driver_ref) : driver(driver_ref) {}
+
+    inline void operator()(const CSysVector<passivedouble> & u, CSysVector<passivedouble> & v) const override {
+      driver.AdjointProduct(u, v);
+    }
+  };
+
+  /*--- Krylov acceleration of the fixed-point iterations (DISCADJ_KRYLOV). The adjoint solution x satisfies
+   *    x = G^T x + b, where G^T is applied by an evaluation of the tape, each adjoint iteration is preceded
+   *    by a FGMRES cycle for (I - G^T) d = r, with r the residual of the previous iteration. ---*/
+
+  vector<unsigned short> adjointSolvers;   /*!< \brief Adjoint solvers whose solution is part of the fixed point. */
+  unsigned short adjointNVar = 0;          /*!< \brief Number of variables per point of all those solvers. */
+  CSysSolve<passivedouble> krylovSolver;  /*!< \brief Linear solver (for the FGMRES method). */
+  CSysVector<passivedouble> krylovRHS;    /*!< \brief Residual of the last fixed-point iteration. */
+  CSysVector<passivedouble> krylovSol;    /*!< \brief Correction of the adjoint solution. */
+  CSysVector<passivedouble> adjointOld;   /*!< \brief Adjoint solution before the last fixed-point iteration. */
+
+  CQuasiNewtonInvLeastSquares quasiNewton; /*!< \brief Quasi-Newton acceleration of the fixed point (QUASI_NEWTON_NUM_SAMPLES). */
+
+  /*--- Separate objectives (DISCADJ_SEPARATE_OBJECTIVES). The adjoint of objective i is seeded and extracted
+   *    on direction i of the vector reverse mode, such that one evaluation of the tape per iteration advances all
+   *    of them. The solvers hold the adjoint solution of the active objective, those of the others are stored here. ---*/
+
+  vector<CSysVector<passivedouble> > adjointStates;  /*!< \brief Adjoint solutions of the inactive objectives. */
+  unsigned short activeObj = 0;                      /*!< \brief Objective whose adjoint is in the solvers. */
+
+  /*!
+   * \brief Copy the adjoint solution of the fixed-point solvers into a vector.
+   */
+  void GetAdjointSolution(CSysVector<passivedouble>& u) const;
+
+  /*!
+   * \brief Set the adjoint solution of the fixed-point solvers from a vector.
+   */
+  void SetAdjointSolution(const CSysVector<passivedouble>& u);
+
+  /*!
+   * \brief Swap the adjoint solution of an objective into the solvers and set the corresponding AD direction.
+   * \param[in] iObj - Index of the objective function.
+   */
+  void SetActiveObjective(unsigned short iObj);
+
+  /*!
+   * \brief Evaluate the tape of the iteration, for a combined recording only the part after the geometry.
+   * \note The adjoints of the geometric inputs are then incomplete, they are only extracted from a full evaluation.
+   */
+  void ComputeAdjoint_Iteration();
+
+  /*!
+   * \brief Product v = (I - G^T) u, where G^T u is computed by an evaluation of the tape seeded with u.
+   * \note The objective function is not seeded, the adjoint solutions are overwritten.
+   */
+  void AdjointProduct(const CSysVector<passivedouble>& u, CSysVector<passivedouble>& v);
+
+  /*!
+   * \brief Krylov cycle for the correction of the adjoint solution (see DISCADJ_KRYLOV).
+   */
+  void KrylovIteration();
+
+  /*!
+   * \brief Replace the result of the last fixed-point iteration by the quasi-Newton update (see QUASI_NEWTON_NUM_SAMPLES).
+   */
+  void QuasiNewtonIteration();
+
 public:
 
   /*!
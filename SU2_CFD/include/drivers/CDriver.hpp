@@ -38,6 +38,7 @@
 #include "../../../Common/include/geometry/CGeometry.hpp"
 #include "../../../Common/include/grid_movement_structure.hpp"
 #include "../../../Common/include/interpolation_structure.hpp"
+#include "../../../Common/include/toolboxes/CTimingReport.hpp"
 
 using namespace std;
 
@@ -100,7 +101,11 @@ protected:
             PyWrapNodalForce[3],                /*!< \brief This is used to store the force at each vertex. */
             PyWrapNodalForceDensity[3],         /*!< \brief This is used to store the force density at each vertex. */
             PyWrapNodalHeatFlux[3];             /*!< \brief This is used to store the heat flux at each vertex. */
+  vector<vector<su2double> > PyWrapSolverStates; /*!< \brief Stored solutions of all the solvers, see SaveSolverState. */
+  vector<unsigned long> PyWrapSolverStatesIter; /*!< \brief Time iteration of each stored solver state. */
+  vector<su2activematrix> Design_Coord;         /*!< \brief Coordinates of the undeformed grid of each zone, see DEFORM_DESIGN. */
   bool dry_run;                                 /*!< \brief Flag if SU2_CFD was started as dry-run via "SU2_CFD -d <config>.cfg" */
+  CTimingReport PreprocTiming;                  /*!< \brief Wall time and memory of the phases of the preprocessing. */
 
 public:
 
@@ -176,6 +181,17 @@ protected:
    */
   void Solver_Restart(CSolver ***solver, CGeometry **geometry, CConfig *config, bool update_geo);
 
+  /*!
+   * \brief Restart of the flow and turbulence solvers from the solution on another grid (SOLUTION_DONOR_MESH_FILENAME).
+   * \details The donor grid is read and partitioned, its restart file is interpolated (CSolutionInterpolator) to
+   *          the domain points, the turbulence variables are then corrected by the ratio of the wall distance of
+   *          the point and the wall distance interpolated from the donor grid.
+   * \param[in] solver - Container vector with all the solutions.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Solver_Interpolated_Restart(CSolver ***solver, CGeometry **geometry, CConfig *config);
+
   /*!
    * \brief Definition and allocation of all solution classes.
    * \param[in] solver_container - Container vector with all the solutions.
@@ -236,6 +252,20 @@ protected:
    */
   void DynamicMesh_Preprocessing(CConfig *config, CGeometry **geometry, CSolver ***solver, CIteration *iteration, CVolumetricMovement *&grid_movement, CSurfaceMovement *&surface_movement);
 
+  /*!
+   * \brief Deform the grid of a zone in memory by its design variables (DV_KIND, DV_VALUE), as SU2_DEF does.
+   * \details The deformation is applied to the undeformed grid, whose coordinates are stored by the first call,
+   *          hence the deformations of successive designs do not accumulate. The dual grid of all the multigrid
+   *          levels and the wall distance are updated, the solution is kept.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem (all the multigrid levels).
+   * \param[in,out] grid_movement - Volume grid movement class, allocated if needed.
+   * \param[in,out] surface_movement - Surface movement class, allocated if needed (it keeps the FFD boxes).
+   * \param[in,out] coordOrig - Coordinates of the undeformed grid, stored by the first call.
+   */
+  void Design_Deformation(CConfig *config, CGeometry **geometry, CVolumetricMovement *&grid_movement,
+                          CSurfaceMovement *&surface_movement, su2activematrix& coordOrig);
+
   /*!
    * \brief Initialize Python interface functionalities
    */
@@ -416,6 +446,12 @@ public:
    */
   passivedouble Get_LiftCoeff();
 
+  /*!
+   * \brief Get the values of all the history output fields of the last iteration (all the zones for multizone).
+   * \return Value of each field, by name (e.g. "LIFT", "RMS_DENSITY").
+   */
+  map<string, passivedouble> GetHistoryOutputValues();
+
   /*!
    * \brief Get the moving marker identifier.
    * \return Moving marker identifier.
@@ -671,6 +707,98 @@ public:
    */
   vector<passivedouble> GetVertexUnitNormal(unsigned short iMarker, unsigned long iVertex);
 
+  /*--- Bulk accessors of the markers, they read or write the values of all the vertices of a marker
+   *    (in the order of the vertices, nDim values per vertex for vectors) in a contiguous array,
+   *    e.g. a numpy array passed in place from Python, instead of one call per vertex and component. ---*/
+
+  /*!
+   * \brief Get the coordinates of the vertices of a marker.
+   * \param[in] iMarker - Marker identifier.
+   * \param[out] values - Coordinates, nDim per vertex.
+   * \param[in] nValues - Size of the array, nVertex*nDim.
+   */
+  void GetMarkerCoordinates(unsigned short iMarker, passivedouble* values, unsigned long nValues);
+
+  /*!
+   * \brief Get the fluid forces (pressure and viscous) at the vertices of a marker, 0 at the halo vertices.
+   * \param[in] iMarker - Marker identifier.
+   * \param[out] values - Forces, nDim per vertex.
+   * \param[in] nValues - Size of the array, nVertex*nDim.
+   */
+  void GetMarkerForces(unsigned short iMarker, passivedouble* values, unsigned long nValues);
+
+  /*!
+   * \brief Get the temperature at the vertices of a marker.
+   * \param[in] iMarker - Marker identifier.
+   * \param[out] values - Temperatures, one per vertex.
+   * \param[in] nValues - Size of the array, nVertex.
+   */
+  void GetMarkerTemperatures(unsigned short iMarker, passivedouble* values, unsigned long nValues);
+
+  /*!
+   * \brief Set the temperature at the vertices of a marker.
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] values - Temperatures, one per vertex.
+   * \param[in] nValues - Size of the array, nVertex.
+   */
+  void SetMarkerTemperatures(unsigned short iMarker, const passivedouble* values, unsigned long nValues);
+
+  /*!
+   * \brief Get the wall normal component of the heat flux at the vertices of a marker.
+   * \param[in] iMarker - Marker identifier.
+   * \param[out] values - Normal heat fluxes, one per vertex.
+   * \param[in] nValues - Size of the array, nVertex.
+   */
+  void GetMarkerNormalHeatFluxes(unsigned short iMarker, passivedouble* values, unsigned long nValues);
+
+  /*!
+   * \brief Set the wall normal component of the heat flux at the vertices of a marker.
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] values - Normal heat fluxes, one per vertex.
+   * \param[in] nValues - Size of the array, nVertex.
+   */
+  void SetMarkerNormalHeatFluxes(unsigned short iMarker, const passivedouble* values, unsigned long nValues);
+
+  /*!
+   * \brief Set the displacements of the vertices of a marker for the mesh solver.
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] values - Displacements, nDim per vertex.
+   * \param[in] nValues - Size of the array, nVertex*nDim.
+   */
+  void SetMarkerMeshDisplacements(unsigned short iMarker, const passivedouble* values, unsigned long nValues);
+
+  /*!
+   * \brief Set the loads at the vertices of a marker for the structural solver.
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] values - Loads, nDim per vertex.
+   * \param[in] nValues - Size of the array, nVertex*nDim.
+   */
+  void SetMarkerFEA_Loads(unsigned short iMarker, const passivedouble* values, unsigned long nValues);
+
+  /*!
+   * \brief Get the displacements of the vertices of a marker from the structural solver.
+   * \param[in] iMarker - Marker identifier.
+   * \param[out] values - Displacements, nDim per vertex.
+   * \param[in] nValues - Size of the array, nVertex*nDim.
+   */
+  void GetMarkerFEA_Displacements(unsigned short iMarker, passivedouble* values, unsigned long nValues);
+
+  /*!
+   * \brief Get the number of solution variables of a solver.
+   * \param[in] iSol - Solver identifier (e.g. FLOW_SOL).
+   * \return Number of variables, 0 if the solver does not exist.
+   */
+  unsigned short GetNumberSolverVars(unsigned short iSol);
+
+  /*!
+   * \brief Get the solution of a solver at the vertices of a marker.
+   * \param[in] iSol - Solver identifier (e.g. FLOW_SOL).
+   * \param[in] iMarker - Marker identifier.
+   * \param[out] values - Solution, nVar per vertex.
+   * \param[in] nValues - Size of the array, nVertex*nVar.
+   */
+  void GetMarkerSolution(unsigned short iSol, unsigned short iMarker, passivedouble* values, unsigned long nValues);
+
   /*!
    * \brief Get all the boundary markers tags.
    * \return List of boundary markers tags.
@@ -842,6 +970,68 @@ public:
    */
   void SetInlet_Angle(unsigned short iMarker, passivedouble alpha);
 
+  /*!
+   * \brief Store in memory the solution of all the solvers (all zones, instances and grid levels).
+   * \note Only the solution, and the solutions at time n and n-1 of dual time-stepping, are stored.
+   *       The geometry and the rest of the solver data are not, hence e.g. the grid must not be deformed
+   *       between the save and the restore of a state.
+   * \return Identifier of the stored state.
+   */
+  unsigned short SaveSolverState();
+
+  /*!
+   * \brief Restore a solver state stored with SaveSolverState (e.g. to warm-start the next point of a polar).
+   * \details The convergence flags are reset, for steady problems the time iteration is set to 0 such that
+   *          the solver can be started again, for unsteady problems it is set to the one of the state.
+   * \param[in] iState - Identifier of the state.
+   */
+  void RestoreSolverState(unsigned short iState);
+
+  /*!
+   * \brief Free the memory of a solver state, its identifier is not reused.
+   * \param[in] iState - Identifier of the state.
+   */
+  void DeleteSolverState(unsigned short iState);
+
+  /*!
+   * \brief Set a value of a design variable (DV_VALUE) of all the zones, it is applied by DeformDesign.
+   * \param[in] iDV - Index of the design variable.
+   * \param[in] iValue - Index of the value of the design variable.
+   * \param[in] val - Value, relative to the undeformed grid.
+   */
+  void SetDV_Value(unsigned short iDV, unsigned short iValue, passivedouble val);
+
+  /*!
+   * \brief Deform the grid of all the zones in memory by the current design variables, from the undeformed grid.
+   * \note This replaces SU2_DEF and the preprocessing of a new grid for a design update, the solution of the
+   *       previous design is kept as the initial solution of the next run.
+   */
+  void DeformDesign();
+
+  /*!
+   * \brief Set the angle of attack of the freestream, keeping its velocity magnitude.
+   * \param[in] AoA - Angle of attack (degrees).
+   */
+  void SetAngleOfAttack(passivedouble AoA);
+
+  /*!
+   * \brief Set the sideslip angle of the freestream (3D), keeping its velocity magnitude.
+   * \param[in] AoS - Sideslip angle (degrees).
+   */
+  void SetSideslipAngle(passivedouble AoS);
+
+  /*!
+   * \brief Get the memory in use by this rank, by category (e.g. "Geometry", "Jacobian", "AD tape"), the high-water
+   *        mark of each category ("Geometry peak", etc.), and the resident memory of the process ("Resident").
+   * \return Memory in MB of each entry.
+   */
+  map<string, passivedouble> GetMemoryUsage() const;
+
+  /*!
+   * \brief Print the memory by category, over the ranks, on the master (collective, see MEMORY_REPORT).
+   */
+  void PrintMemoryReport() const;
+
 
 };
 
@@ -1054,11 +1244,11 @@ public:
   void Run();
 
   /*!
-   * \brief Computation and storage of the Harmonic Balance method source terms.
+   * \brief Computation and storage of the Harmonic Balance method source terms of all the time instances.
+   * \note The sources of all instances are computed in a single pass over the points.
    * \author T. Economon, K. Naik
-   * \param[in] iZone - Current zone number.
    */
-  void SetHarmonicBalance(unsigned short iZone);
+  void SetHarmonicBalance();
 
   /*!
    * \brief Precondition Harmonic Balance source term for stability
@@ -0,0 +1,89 @@
+/*!
+ * \file CEnsembleDriver.hpp
+ * \brief Headers of the driver of the ensembles of instances sharing one geometry (UQ_ENSEMBLE).
+ *        The implementation is in the <i>CEnsembleDriver.cpp</i> file.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include "CSinglezoneDriver.hpp"
+
+/*!
+ * \class CEnsembleDriver
+ * \brief Single zone driver of an ensemble of solutions on the same grid, the members of the RANS uncertainty
+ *        quantification study (UQ_ENSEMBLE), one per eigenspace perturbation.
+ * \details Each member is an instance of the zone with its own solvers, numerics, and integration, the geometry
+ *          (with its multigrid levels) is that of the first instance, preprocessed once. The members are iterated
+ *          together, one inner iteration of each after the other, a converged member is no longer iterated.
+ *          The first member writes the screen and history output, the others are monitored silently.
+ * \author SU2 Contributors
+ */
+class CEnsembleDriver final : public CSinglezoneDriver {
+
+  vector<COutput*> memberOutput;  /*!< \brief Output of each member (that of the zone for the first one). */
+  vector<bool> memberConverged;   /*!< \brief Whether each member of the ensemble is converged. */
+
+public:
+
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] confFile - Configuration file name.
+   * \param[in] val_nZone - Total number of zones.
+   * \param[in] MPICommunicator - MPI communicator for SU2.
+   */
+  CEnsembleDriver(char* confFile,
+                  unsigned short val_nZone,
+                  SU2_Comm MPICommunicator);
+
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CEnsembleDriver(void) override;
+
+  /*!
+   * \brief Preprocess the iteration of all the members.
+   */
+  void Preprocess(unsigned long TimeIter) override;
+
+  /*!
+   * \brief Run the inner iterations of all the members, until all of them are converged.
+   */
+  void Run() override;
+
+  /*!
+   * \brief Postprocess the iteration of all the members.
+   */
+  void Postprocess() override;
+
+  /*!
+   * \brief Update the solution of all the members.
+   */
+  void Update() override;
+
+  /*!
+   * \brief Output the solution files of all the members.
+   */
+  void Output(unsigned long TimeIter) override;
+
+};
@@ -0,0 +1,101 @@
+/*!
+ * \file CLoadBalancingDriver.hpp
+ * \brief Headers of the driver of the unsteady runs that repartition the grid when the ranks are imbalanced.
+ *        The implementation is in the <i>CLoadBalancingDriver.cpp</i> file.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include "CSinglezoneDriver.hpp"
+
+struct CAdaptedMesh;
+
+/*!
+ * \class CLoadBalancingDriver
+ * \brief Single zone driver of the unsteady (dual time) flow problems that repartition the grid during the run
+ *        when the computation time of the ranks becomes imbalanced (LOAD_BALANCING_FREQ).
+ * \details Every LOAD_BALANCING_FREQ time steps the computation time of the ranks (wall time minus the time spent
+ *          waiting for communication, see CCommProfiler) of the last steps is compared, if the slowest rank exceeds
+ *          LOAD_BALANCING_TOL times the average, the time loop stops. The current grid (moved coordinates included)
+ *          is held in memory for the geometry of the next driver (CMemoryMeshReaderFVM), with the work per point
+ *          measured on each rank as ParMETIS vertex weights, and the solution and its time levels are migrated
+ *          exactly, by global index, to the new partition. The next driver continues the time loop.
+ * \note The segments of the run rebuild the geometry and solver containers of the new partition (halos, dual
+ *       grid, multigrid, sparsity pattern of the Jacobian), only the file round trip and the restart are avoided.
+ *       Each segment writes its own history file, named with its first time iteration as for a restart.
+ * \author SU2 Contributors
+ */
+class CLoadBalancingDriver final : public CSinglezoneDriver {
+
+  struct CSolutionMigration;              /*!< \brief Solution and state of the motion, from one driver to the next. */
+  static CSolutionMigration* migration;   /*!< \brief Pending migration of the solution, owned by the class. */
+
+  unsigned long startIter = 0;            /*!< \brief First time iteration of this driver. */
+  passivedouble computeTime = 0.0;        /*!< \brief Computation time of the rank since the last check. */
+  bool rebalance = false;                 /*!< \brief Whether the time loop stopped to repartition the grid. */
+  bool solved = false;                    /*!< \brief Whether the time loop of this driver was run. */
+
+  /*!
+   * \brief Compare the computation time of the ranks since the last check (collective).
+   * \return Whether the imbalance exceeds the tolerance.
+   */
+  bool CheckBalance();
+
+  /*!
+   * \brief Copy the current grid, and the solution of the points, to the linear partitions (collective).
+   * \param[in] work - Work of the points of this rank relative to an average point.
+   * \param[out] mesh - Grid for the next driver.
+   */
+  void SetPendingGrid(passivedouble work, CAdaptedMesh& mesh);
+
+  /*!
+   * \brief Set the pending solution and state of the motion on the partition of this driver (collective).
+   */
+  void MigrateSolution();
+
+public:
+
+  /*!
+   * \brief Constructor of the class, the grid held in memory is read and the pending solution migrated.
+   * \param[in] confFile - Configuration file name.
+   * \param[in] val_nZone - Total number of zones.
+   * \param[in] MPICommunicator - MPI communicator for SU2.
+   */
+  CLoadBalancingDriver(char* confFile,
+                       unsigned short val_nZone,
+                       SU2_Comm MPICommunicator);
+
+  /*!
+   * \brief Run the time steps until the end of the run or until the ranks are imbalanced.
+   * \note The time loop runs once, calling the method again after it returns does nothing.
+   */
+  void StartSolver() override;
+
+  /*!
+   * \brief Keep the grid and the solution for the next driver if the time loop stopped to repartition.
+   * \return Whether the run continues with a new driver.
+   */
+  bool Rebalance();
+
+};
@@ -29,6 +29,7 @@
 #pragma once
 
 #include "CDriver.hpp"
+#include "../../../Common/include/toolboxes/CQuasiNewtonInvLeastSquares.hpp"
 
 /*!
  * \class CMultizoneDriver
@@ -56,6 +57,8 @@ protected:
 
   bool *prefixed_motion;     /*!< \brief Determines if a fixed motion is imposed in the config file. */
 
+  CQuasiNewtonInvLeastSquares quasiNewton;  /*!< \brief Quasi-Newton acceleration of the outer iterations (QUASI_NEWTON_NUM_SAMPLES). */
+
 public:
 
   /*!
@@ -113,6 +116,24 @@ public:
    */
   bool OuterConvergence(unsigned long OuterIter);
 
+  /*!
+   * \brief Copy the BGS solution of all zones into a flat vector for the quasi-Newton acceleration, or the opposite.
+   * \note The mesh solvers are not part of the fixed point, their state follows from the others. The values of the
+   *       domain points come first (those of the halo points are only combined), for the adjoint all points enter
+   *       the inner products since the halo adjoints are unknowns of the fixed point like the domain ones.
+   * \param[in] adjoint - Use the adjoint solvers, otherwise the primal ones.
+   * \param[in] toVector - Copy into the vector, otherwise copy the vector into the BGS solution (and into the solution
+   *            of the primal solvers).
+   * \param[in,out] values - Flat vector of all the values.
+   */
+  void QuasiNewtonBGSVector(bool adjoint, bool toVector, vector<passivedouble>& values);
+
+  /*!
+   * \brief Allocate the quasi-Newton acceleration of the outer iterations, if it is enabled.
+   * \param[in] adjoint - Accelerate the adjoint solvers, otherwise the primal ones.
+   */
+  void InitializeQuasiNewton(bool adjoint);
+
   /*!
    * \brief Perform a dynamic mesh deformation, included grid velocity computation and the update of the multigrid structure (multiple zone).
    */
@@ -125,9 +146,13 @@ public:
 
   /*!
    * \brief Routine to provide all the desired physical transfers between the different zones during one iteration.
+   * \param[in] donorZone - Index of the donor zone.
+   * \param[in] targetZone - Index of the target zone.
+   * \param[in] completeTransfer - If false the messages are only posted, the transfer is completed by
+   *            CInterface::CompleteTransfers (used to overlap the transfers of all zones in Jacobi mode).
    * \return Boolean that determines whether the mesh needs to be updated for this particular transfer
    */
-  bool Transfer_Data(unsigned short donorZone, unsigned short targetZone);
+  bool Transfer_Data(unsigned short donorZone, unsigned short targetZone, bool completeTransfer = true);
 
   bool Monitor(unsigned long TimeIter);
 
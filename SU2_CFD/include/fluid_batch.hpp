@@ -0,0 +1,64 @@
+/*!
+ * \file fluid_batch.hpp
+ * \brief Thermodynamic and transport states of a batch of points.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../Common/include/datatype_structure.hpp"
+
+/*!
+ * \struct CFluidBatch
+ * \brief States of a batch of points in "structure of arrays" layout (the index is the point in the
+ *        batch), such that the (non-virtual) batch evaluations of the fluid and transport models
+ *        vectorize across points.
+ * \note The batch evaluations compute all SIZE lanes, unused lanes must hold valid states
+ *       (e.g. copies of the last point). The inputs are the density and static energy, or the
+ *       temperature for the incompressible models (SetTDState_T).
+ */
+struct CFluidBatch {
+  enum : size_t {SIZE = 8};  /*!< \brief Number of points per batch (a multiple of the SIMD width). */
+
+  su2double Density[SIZE];       /*!< \brief Density (input). */
+  su2double StaticEnergy[SIZE];  /*!< \brief Static energy (input). */
+
+  su2double Pressure[SIZE];      /*!< \brief Pressure. */
+  su2double Temperature[SIZE];   /*!< \brief Temperature. */
+  su2double SoundSpeed2[SIZE];   /*!< \brief Square of the speed of sound. */
+  su2double Cp[SIZE];            /*!< \brief Specific heat at constant pressure. */
+  su2double Cv[SIZE];            /*!< \brief Specific heat at constant volume (incompressible models). */
+  su2double dPdrho_e[SIZE];      /*!< \brief Derivative of pressure w.r.t. density at constant energy. */
+  su2double dPde_rho[SIZE];      /*!< \brief Derivative of pressure w.r.t. energy at constant density. */
+  su2double dTdrho_e[SIZE];      /*!< \brief Derivative of temperature w.r.t. density at constant energy. */
+  su2double dTde_rho[SIZE];      /*!< \brief Derivative of temperature w.r.t. energy at constant density. */
+
+  su2double Mu[SIZE];            /*!< \brief Laminar viscosity. */
+  su2double Mu_Turb[SIZE];       /*!< \brief Eddy viscosity (input of the RANS conductivity models). */
+  su2double dmudrho_T[SIZE];     /*!< \brief Derivative of the viscosity w.r.t. density at constant temperature. */
+  su2double dmudT_rho[SIZE];     /*!< \brief Derivative of the viscosity w.r.t. temperature at constant density. */
+  su2double Kt[SIZE];            /*!< \brief Thermal conductivity. */
+  su2double dktdrho_T[SIZE];     /*!< \brief Derivative of the conductivity w.r.t. density at constant temperature. */
+  su2double dktdT_rho[SIZE];     /*!< \brief Derivative of the conductivity w.r.t. temperature at constant density. */
+};
@@ -34,6 +34,8 @@
 #include <iostream>
 #include <string>
 #include <cmath>
+#include <vector>
+#include <memory>
 
 #define LEN_COMPONENTS 32
 
@@ -225,6 +227,16 @@ public:
    */
   void SetThermalConductivityModel (CConfig *config);
 
+  /*!
+   * \brief Get the laminar viscosity model (e.g. to evaluate it for batches of points).
+   */
+  inline const CViscosityModel* GetViscosityModel(void) const { return LaminarViscosity; }
+
+  /*!
+   * \brief Get the thermal conductivity model (e.g. to evaluate it for batches of points).
+   */
+  inline const CConductivityModel* GetConductivityModel(void) const { return ThermalConductivity; }
+
   /*!
    * \brief virtual member that would be different for each gas model implemented
    * \param[in] InputSpec - Input pair for FLP calls ("e, rho").
@@ -350,6 +362,12 @@ public:
    */
   void SetTDState_rhoe (su2double rho, su2double e );
 
+  /*!
+   * \brief Set the states of a batch of points from their density and static energy (non-virtual, vectorizable).
+   * \param[in,out] batch - States of the points, the thermodynamic properties and derivatives are set.
+   */
+  inline void SetTDState_rhoe (CFluidBatch& batch) const;
+
   /*!
    * \brief Set the Dimensionless State using Pressure  and Temperature
    * \param[in] P - first thermodynamic variable.
@@ -441,6 +459,13 @@ public:
    */
   void SetTDState_rhoe (su2double rho, su2double e );
 
+  /*!
+   * \brief Set the states of a batch of points from their density and static energy (non-virtual, vectorizable).
+   * \note The compressibility factor (initial guess of SetTDState_PT) is that of the last lane.
+   * \param[in,out] batch - States of the points, the thermodynamic properties and derivatives are set.
+   */
+  inline void SetTDState_rhoe (CFluidBatch& batch);
+
   /*!
    * \brief Set the Dimensionless State using Pressure and Temperature
    * \param[in] P - first thermodynamic variable.
@@ -551,6 +576,13 @@ public:
    */
   void SetTDState_rhoe (su2double rho, su2double e );
 
+  /*!
+   * \brief Set the states of a batch of points from their density and static energy (non-virtual).
+   * \note Evaluated point by point, the model has no closed form in terms of density and energy.
+   * \param[in,out] batch - States of the points, the thermodynamic properties and derivatives are set.
+   */
+  void SetTDState_rhoe (CFluidBatch& batch);
+
   /*!
    * \brief Set the Dimensionless State using Pressure and Temperature
    * \param[in] P - first thermodynamic variable.
@@ -608,6 +640,209 @@ public:
 
 };
 
+/*!
+ * \class CFluidTable
+ * \brief Immutable table of the non-dimensional thermodynamic state of a fluid on a grid of
+ *        density and static energy, uniformly spaced in log(density) and static energy.
+ * \note The quantities of each node are contiguous, and the nodes of a density level are stored in order of
+ *       increasing energy, such that the 4x4 stencil of a bicubic (Catmull-Rom) interpolation touches
+ *       4 contiguous blocks of memory. Being read-only after construction, the table is shared by the
+ *       fluid models of all threads and the lookups need no synchronization.
+ * \author SU2 Contributors
+ */
+class CFluidTable {
+public:
+  /*!
+   * \brief Quantities stored at each node of the table.
+   */
+  enum : unsigned short {PRESSURE = 0, TEMPERATURE, SOUNDSPEED2, DPDRHO_E, DPDE_RHO,
+                         DTDRHO_E, DTDE_RHO, ENTROPY, NQUANT};
+
+private:
+  unsigned long nDensity = 0,  /*!< \brief Number of density levels. */
+  nEnergy = 0;                 /*!< \brief Number of static energy levels. */
+
+  su2double LogDensityMin = 0.0,  /*!< \brief Logarithm of the minimum density. */
+  DeltaLogDensity = 0.0,          /*!< \brief Spacing of the logarithm of the density. */
+  EnergyMin = 0.0,                /*!< \brief Minimum static energy. */
+  DeltaEnergy = 0.0;              /*!< \brief Spacing of the static energy. */
+
+  vector<su2double> Data;  /*!< \brief Quantities of the nodes, NQUANT per node. */
+
+  /*!
+   * \brief Set the size and the (non-dimensional) ranges of the table.
+   */
+  void Allocate(unsigned long nRho, unsigned long nE, su2double rhoMin, su2double rhoMax, su2double eMin, su2double eMax);
+
+  /*!
+   * \brief Factors that convert the non-dimensional quantities (and density and energy) to dimensional.
+   * \param[in] refValues - Reference density, pressure, and temperature.
+   * \param[out] factors - NQUANT factors of the quantities followed by those of the density and the energy.
+   */
+  static void GetScaleFactors(const su2double* refValues, su2double* factors);
+
+public:
+  /*!
+   * \brief Generate the table by evaluating a fluid model at the nodes.
+   * \note The derivative of the temperature w.r.t. density is obtained from finite differences
+   *       of the nodal temperatures, as not all models compute it.
+   * \param[in] model - Non-dimensional fluid model from which the table is generated.
+   * \param[in] nRho - Number of density levels.
+   * \param[in] nE - Number of static energy levels.
+   * \param[in] densityRange - Minimum and maximum (non-dimensional) density.
+   * \param[in] energyRange - Minimum and maximum (non-dimensional) static energy.
+   */
+  CFluidTable(CFluidModel& model, unsigned long nRho, unsigned long nE,
+              const su2double* densityRange, const su2double* energyRange);
+
+  /*!
+   * \brief Read the table from a (dimensional) file, the master rank reads it and broadcasts it.
+   * \param[in] fileName - Name of the file.
+   * \param[in] refValues - Reference density, pressure, and temperature of the non-dimensionalization.
+   */
+  CFluidTable(const string& fileName, const su2double* refValues);
+
+  /*!
+   * \brief Write the table to a file, in dimensional form such that it may be reused by other cases.
+   * \param[in] fileName - Name of the file.
+   * \param[in] refValues - Reference density, pressure, and temperature of the non-dimensionalization.
+   */
+  void Write(const string& fileName, const su2double* refValues) const;
+
+  /*!
+   * \brief Interpolate all the quantities of the table at a state.
+   * \note States outside of the table are extrapolated with the boundary cells.
+   * \param[in] rho - Density.
+   * \param[in] e - Static energy.
+   * \param[out] values - NQUANT interpolated quantities.
+   */
+  void Interpolate(su2double rho, su2double e, su2double* values) const;
+};
+
+/*!
+ * \class CTabulatedGas
+ * \brief Child class for a compressible fluid model whose state is interpolated from a table
+ *        of density and static energy (see CFluidTable), generated from another model or read from a file.
+ * \note The inverse relations (e.g. pressure-temperature) start from the base model and are then
+ *       solved by Newton iterations on the table, such that all the states are consistent with it.
+ * \author SU2 Contributors
+ */
+class CTabulatedGas : public CFluidModel {
+
+protected:
+  shared_ptr<const CFluidTable> Table;  /*!< \brief Table of the states, shared by the models of all threads. */
+  unique_ptr<CFluidModel> BaseModel;    /*!< \brief Model from which the initial guesses of inverse relations are taken. */
+
+private:
+  /*!
+   * \brief Pairs of inputs of the inverse relations.
+   */
+  enum INPUT_PAIR {PRHO_INPUT, RHOT_INPUT, PT_INPUT, PS_INPUT, HS_INPUT};
+
+  /*!
+   * \brief Solve an inverse relation by Newton iterations in density and energy, the state is set.
+   * \param[in] pair - Pair of inputs.
+   * \param[in] th1 - First input.
+   * \param[in] th2 - Second input.
+   * \param[in] rho - Initial density.
+   * \param[in] e - Initial static energy.
+   */
+  void SolveInverse(INPUT_PAIR pair, su2double th1, su2double th2, su2double rho, su2double e);
+
+public:
+
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] table - Table of the states.
+   * \param[in] baseModel - Non-dimensional model for the initial guesses (ownership is taken).
+   */
+  CTabulatedGas(shared_ptr<const CFluidTable> table, CFluidModel* baseModel);
+
+  /*!
+   * \brief Create the fluid model from which the table is generated (option TABULATED_FLUID_MODEL).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] nonDimensional - Whether to create the model with the non-dimensional parameters.
+   * \return Pointer to the model, owned by the caller.
+   */
+  static CFluidModel* CreateBaseModel(const CConfig* config, bool nonDimensional);
+
+  /*!
+   * \brief Read the table (if the file exists) or generate it from the base model (and write it to the file).
+   * \note Without explicit ranges the table spans 0.02 to 5 times the free-stream density, and the energies
+   *       of 0.5 to 2 times the free-stream temperature.
+   * \param[in] config - Definition of the particular problem, the reference values must be set.
+   * \param[in] densityFreeStream - Non-dimensional free-stream density.
+   * \param[in] temperatureFreeStream - Non-dimensional free-stream temperature.
+   * \param[in] writeFile - Whether to write a generated table to the file (if a file name is set).
+   * \return Shared (read only) table.
+   */
+  static shared_ptr<const CFluidTable> CreateTable(const CConfig* config, su2double densityFreeStream,
+                                                   su2double temperatureFreeStream, bool writeFile);
+
+  /*!
+   * \brief Set the Dimensionless State using Density and Internal Energy
+   * \param[in] rho - first thermodynamic variable.
+   * \param[in] e - second thermodynamic variable.
+   */
+  void SetTDState_rhoe (su2double rho, su2double e );
+
+  /*!
+   * \brief Set the states of a batch of points from their density and static energy (non-virtual).
+   * \param[in,out] batch - States of the points, the thermodynamic properties and derivatives are set.
+   */
+  inline void SetTDState_rhoe (CFluidBatch& batch) const;
+
+  /*!
+   * \brief Set the Dimensionless State using Pressure and Temperature
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] T - second thermodynamic variable.
+   */
+  void SetTDState_PT (su2double P, su2double T );
+
+  /*!
+   * \brief Set the Dimensionless State using Pressure and Density
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] rho - second thermodynamic variable.
+   */
+  void SetTDState_Prho (su2double P, su2double rho );
+
+  /*!
+   * \brief Set the Dimensionless Energy using Pressure and Density
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] rho - second thermodynamic variable.
+   */
+  void SetEnergy_Prho (su2double P, su2double rho );
+
+  /*!
+   * \brief Set the Dimensionless State using Enthalpy and Entropy
+   * \param[in] h - first thermodynamic variable.
+   * \param[in] s - second thermodynamic variable.
+   */
+  void SetTDState_hs (su2double h, su2double s );
+
+  /*!
+   * \brief Set the Dimensionless State using Density and Temperature
+   * \param[in] rho - first thermodynamic variable.
+   * \param[in] T - second thermodynamic variable.
+   */
+  void SetTDState_rhoT (su2double rho, su2double T );
+
+  /*!
+   * \brief Set the Dimensionless State using Pressure and Entropy
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] s - second thermodynamic variable.
+   */
+  void SetTDState_Ps (su2double P, su2double s );
+
+  /*!
+   * \brief compute some derivatives of enthalpy and entropy needed for subsonic inflow BC
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] rho - second thermodynamic variable.
+   */
+  void ComputeDerivativeNRBC_Prho (su2double P, su2double rho );
+
+};
+
 /*!
  * \class CConstantDensity
  * \brief Child class for defining a constant density gas model (incompressible only).
@@ -720,7 +955,13 @@ public:
    * \param[in] T - Temperature value at the point.
    */
   void SetTDState_T(su2double val_temperature);
-  
+
+  /*!
+   * \brief Set the state of a batch of points from their temperature (non-virtual).
+   * \param[in,out] batch - States of the points, Temperature is the input, Density, Cp, and Cv are set.
+   */
+  inline void SetTDState_T(CFluidBatch& batch) const;
+
 };
 
 #include "fluid_model.inl"
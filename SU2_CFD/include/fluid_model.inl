@@ -91,3 +91,60 @@ inline void CFluidModel::SetTDState_Ps (su2double P, su2double s ) { }
 inline void CFluidModel::ComputeDerivativeNRBC_Prho (su2double P, su2double rho ){ }
 inline void CFluidModel::SetTDState_T (su2double val_Temperature) { }
 inline void CFluidModel::SetEddyViscosity (su2double val_Mu_Turb) { Mu_Turb = val_Mu_Turb; }
+
+inline void CIncIdealGasPolynomial::SetTDState_T (CFluidBatch& batch) const {
+  for (size_t k = 0; k < CFluidBatch::SIZE; ++k) {
+    const su2double T = batch.Temperature[k];
+    batch.Density[k] = Pressure/(T*Gas_Constant);
+    su2double cp = b[nPolyCoeffs-1];
+    for (int iVar = nPolyCoeffs-2; iVar >= 0; --iVar) cp = cp*T + b[iVar];
+    batch.Cp[k] = cp;
+    batch.Cv[k] = cp/Gamma;
+  }
+}
+
+inline void CIdealGas::SetTDState_rhoe (CFluidBatch& batch) const {
+  for (size_t k = 0; k < CFluidBatch::SIZE; ++k) {
+    const su2double rho = batch.Density[k], e = batch.StaticEnergy[k];
+    batch.Pressure[k] = Gamma_Minus_One*rho*e;
+    batch.Temperature[k] = Gamma_Minus_One*e/Gas_Constant;
+    batch.SoundSpeed2[k] = Gamma*batch.Pressure[k]/rho;
+    batch.Cp[k] = Cp;
+    batch.dPdrho_e[k] = Gamma_Minus_One*e;
+    batch.dPde_rho[k] = Gamma_Minus_One*rho;
+    batch.dTdrho_e[k] = 0.0;
+    batch.dTde_rho[k] = Gamma_Minus_One/Gas_Constant;
+  }
+}
+
+inline void CVanDerWaalsGas::SetTDState_rhoe (CFluidBatch& batch) {
+  for (size_t k = 0; k < CFluidBatch::SIZE; ++k) {
+    const su2double rho = batch.Density[k], e = batch.StaticEnergy[k];
+    const su2double P = Gamma_Minus_One*rho/(1.0-rho*b)*(e + rho*a) - a*rho*rho;
+    batch.Pressure[k] = P;
+    batch.Temperature[k] = (P+rho*rho*a)*((1-rho*b)/(rho*Gas_Constant));
+    batch.Cp[k] = Cp;
+    batch.dPde_rho[k] = rho*Gamma_Minus_One/(1.0 - rho*b);
+    batch.dPdrho_e[k] = Gamma_Minus_One/(1.0 - rho*b)*((e + 2*rho*a) + rho*b*(e + rho*a)/(1.0 - rho*b)) - 2*rho*a;
+    batch.dTdrho_e[k] = Gamma_Minus_One/Gas_Constant*a;
+    batch.dTde_rho[k] = Gamma_Minus_One/Gas_Constant;
+    batch.SoundSpeed2[k] = batch.dPdrho_e[k] + P/(rho*rho)*batch.dPde_rho[k];
+  }
+  const size_t last = CFluidBatch::SIZE-1;
+  Zed = batch.Pressure[last]/(Gas_Constant*batch.Temperature[last]*batch.Density[last]);
+}
+
+inline void CTabulatedGas::SetTDState_rhoe (CFluidBatch& batch) const {
+  su2double values[CFluidTable::NQUANT];
+  for (size_t k = 0; k < CFluidBatch::SIZE; ++k) {
+    Table->Interpolate(batch.Density[k], batch.StaticEnergy[k], values);
+    batch.Pressure[k] = values[CFluidTable::PRESSURE];
+    batch.Temperature[k] = values[CFluidTable::TEMPERATURE];
+    batch.SoundSpeed2[k] = values[CFluidTable::SOUNDSPEED2];
+    batch.Cp[k] = Cp;
+    batch.dPdrho_e[k] = values[CFluidTable::DPDRHO_E];
+    batch.dPde_rho[k] = values[CFluidTable::DPDE_RHO];
+    batch.dTdrho_e[k] = values[CFluidTable::DTDRHO_E];
+    batch.dTde_rho[k] = values[CFluidTable::DTDE_RHO];
+  }
+}
@@ -28,27 +28,16 @@
  */
 
 #include "../../../Common/include/omp_structure.hpp"
+#include "../../../Common/include/toolboxes/CRegionProfiler.hpp"
 
 
+namespace detail {
+
 /*!
- * \brief Compute the gradient of a field using the Green-Gauss theorem.
- * \note Gradients can be computed only for a contiguous range of variables, defined
- *       by [varBegin, varEnd[ (e.g. 0,1 computes the gradient of the 1st variable).
- *       This can be used, for example, to compute only velocity gradients.
- * \note The function uses an optional solver object to perform communications, if
- *       none (nullptr) is provided the function does not fail (the objective of
- *       this is to improve test-ability).
- * \param[in] solver - Optional, solver associated with the field (used only for MPI).
- * \param[in] kindMpiComm - Type of MPI communication required.
- * \param[in] kindPeriodicComm - Type of periodic communication required.
- * \param[in] geometry - Geometric grid properties.
- * \param[in] config - Configuration of the problem, used to identify types of boundaries.
- * \param[in] field - Generic object implementing operator (iPoint, iVar).
- * \param[in] varBegin - Index of first variable for which to compute the gradient.
- * \param[in] varEnd - Index of last variable for which to compute the gradient.
- * \param[out] gradient - Generic object implementing operator (iPoint, iVar, iDim).
+ * \brief Green-Gauss gradient with the number of dimensions known at compile time,
+ *        such that the loops over dimensions are unrolled, see computeGradientsGreenGauss.
  */
-template<class FieldType, class GradientType>
+template<size_t nDim, class FieldType, class GradientType, class MinMaxType>
 void computeGradientsGreenGauss(CSolver* solver,
                                 MPI_QUANTITIES kindMpiComm,
                                 PERIODIC_QUANTITIES kindPeriodicComm,
@@ -57,10 +46,14 @@ void computeGradientsGreenGauss(CSolver* solver,
                                 const FieldType& field,
                                 size_t varBegin,
                                 size_t varEnd,
-                                GradientType& gradient)
+                                GradientType& gradient,
+                                bool deferComms,
+                                MinMaxType* fieldMin,
+                                MinMaxType* fieldMax)
 {
   size_t nPointDomain = geometry.GetnPointDomain();
-  size_t nDim = geometry.GetnDim();
+
+  const bool minMax = (fieldMin != nullptr) && (fieldMax != nullptr);
 
 #ifdef HAVE_OMP
   constexpr size_t OMP_MAX_CHUNK = 512;
@@ -89,6 +82,11 @@ void computeGradientsGreenGauss(CSolver* solver,
       for (size_t iDim = 0; iDim < nDim; ++iDim)
         gradient(iPoint, iVar, iDim) = 0.0;
 
+    if (minMax) {
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        (*fieldMin)(iPoint,iVar) = (*fieldMax)(iPoint,iVar) = field(iPoint,iVar);
+    }
+
     /*--- Handle averaging and division by volume in one constant. ---*/
 
     su2double halfOnVol = 0.5 / (node->GetVolume()+node->GetPeriodicVolume());
@@ -117,6 +115,11 @@ void computeGradientsGreenGauss(CSolver* solver,
 
         for (size_t iDim = 0; iDim < nDim; ++iDim)
           gradient(iPoint, iVar, iDim) += flux * area[iDim];
+
+        if (minMax) {
+          (*fieldMin)(iPoint,iVar) = min((*fieldMin)(iPoint,iVar), field(jPoint,iVar));
+          (*fieldMax)(iPoint,iVar) = max((*fieldMax)(iPoint,iVar), field(jPoint,iVar));
+        }
       }
 
     }
@@ -125,6 +128,13 @@ void computeGradientsGreenGauss(CSolver* solver,
       for (size_t iDim = 0; iDim < nDim; ++iDim)
         AD::SetPreaccOut(gradient(iPoint,iVar,iDim));
 
+    if (minMax) {
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar) {
+        AD::SetPreaccOut((*fieldMin)(iPoint,iVar));
+        AD::SetPreaccOut((*fieldMax)(iPoint,iVar));
+      }
+    }
+
     AD::EndPreacc();
   }
 
@@ -179,8 +189,69 @@ void computeGradientsGreenGauss(CSolver* solver,
     /*--- Obtain the gradients at halo points from the MPI ranks that own them. ---*/
 
     solver->InitiateComms(&geometry, &config, kindMpiComm);
-    solver->CompleteComms(&geometry, &config, kindMpiComm);
+    if (deferComms) solver->SetPendingComms(kindMpiComm);
+    else solver->CompleteComms(&geometry, &config, kindMpiComm);
   }
   SU2_OMP_BARRIER
 
 }
+
+} // end namespace detail
+
+/*!
+ * \brief Compute the gradient of a field using the Green-Gauss theorem.
+ * \note Gradients can be computed only for a contiguous range of variables, defined
+ *       by [varBegin, varEnd[ (e.g. 0,1 computes the gradient of the 1st variable).
+ *       This can be used, for example, to compute only velocity gradients.
+ * \note The function uses an optional solver object to perform communications, if
+ *       none (nullptr) is provided the function does not fail (the objective of
+ *       this is to improve test-ability).
+ * \param[in] solver - Optional, solver associated with the field (used only for MPI).
+ * \param[in] kindMpiComm - Type of MPI communication required.
+ * \param[in] kindPeriodicComm - Type of periodic communication required.
+ * \param[in] geometry - Geometric grid properties.
+ * \param[in] config - Configuration of the problem, used to identify types of boundaries.
+ * \param[in] field - Generic object implementing operator (iPoint, iVar).
+ * \param[in] varBegin - Index of first variable for which to compute the gradient.
+ * \param[in] varEnd - Index of last variable for which to compute the gradient.
+ * \param[out] gradient - Generic object implementing operator (iPoint, iVar, iDim).
+ * \param[in] deferComms - Only initiate the MPI communication, see CSolver::SetPendingComms.
+ * \param[out] fieldMin - Optional, minimum field values over each point and its direct neighbors.
+ * \param[out] fieldMax - Optional, as above but maximum values.
+ * \note The min/max values are the stencils of the limiters (see computeLimiters_impl.hpp), computing
+ *       them here avoids a second traversal of the neighbors (periodic corrections are not applied).
+ */
+template<class FieldType, class GradientType, class MinMaxType = su2activematrix>
+void computeGradientsGreenGauss(CSolver* solver,
+                                MPI_QUANTITIES kindMpiComm,
+                                PERIODIC_QUANTITIES kindPeriodicComm,
+                                CGeometry& geometry,
+                                CConfig& config,
+                                const FieldType& field,
+                                size_t varBegin,
+                                size_t varEnd,
+                                GradientType& gradient,
+                                bool deferComms = false,
+                                MinMaxType* fieldMin = nullptr,
+                                MinMaxType* fieldMax = nullptr)
+{
+  /*--- Estimated traffic, field and gradient of the points, and field, normal and indices of the neighbors. ---*/
+
+  SU2_PROFILE_REGION_BYTES("Gradients",
+    passivedouble(geometry.GetnPointDomain()*(varEnd-varBegin)*(1+geometry.GetnDim())*sizeof(su2double) +
+                  2*geometry.GetnEdge()*(3*sizeof(unsigned long) + (geometry.GetnDim()+varEnd-varBegin)*sizeof(su2double))));
+
+  switch (geometry.GetnDim()) {
+  case 2:
+    detail::computeGradientsGreenGauss<2>(solver, kindMpiComm, kindPeriodicComm, geometry, config, field, varBegin, varEnd,
+      gradient, deferComms, fieldMin, fieldMax);
+    break;
+  case 3:
+    detail::computeGradientsGreenGauss<3>(solver, kindMpiComm, kindPeriodicComm, geometry, config, field, varBegin, varEnd,
+      gradient, deferComms, fieldMin, fieldMax);
+    break;
+  default:
+    SU2_MPI::Error("Too many dimensions to compute gradients.", CURRENT_FUNCTION);
+    break;
+  }
+}
@@ -27,25 +27,114 @@
  */
 
 #include "../../../Common/include/omp_structure.hpp"
+#include "../../../Common/include/toolboxes/CRegionProfiler.hpp"
 
 
+namespace detail {
+
 /*!
- * \brief Compute the gradient of a field using inverse-distance-weighted or
- *        unweighted Least-Squares approximation.
- * \note See notes from computeGradientsGreenGauss.hpp.
- * \param[in] solver - Optional, solver associated with the field (used only for MPI).
- * \param[in] kindMpiComm - Type of MPI communication required.
- * \param[in] kindPeriodicComm - Type of periodic communication required.
- * \param[in] geometry - Geometric grid properties.
- * \param[in] weighted - Use inverse-distance weights.
- * \param[in] config - Configuration of the problem, used to identify types of boundaries.
- * \param[in] field - Generic object implementing operator (iPoint, iVar).
- * \param[in] varBegin - Index of first variable for which to compute the gradient.
- * \param[in] varEnd - Index of last variable for which to compute the gradient.
- * \param[out] gradient - Generic object implementing operator (iPoint, iVar, iDim).
- * \param[out] Rmatrix - Generic object implementing operator (iPoint, iDim, iDim).
+ * \brief Least-Squares gradient with the weights stored by the geometry, the gradient of each point
+ *        is the sum over neighbors of weight times difference of the field.
+ * \note See computeGradientsLeastSquares for the arguments, this computes the same gradient.
+ */
+template<size_t nDim, class FieldType, class GradientType, class MinMaxType>
+void computeGradientsLeastSquaresStored(CSolver* solver,
+                                        MPI_QUANTITIES kindMpiComm,
+                                        CGeometry& geometry,
+                                        CConfig& config,
+                                        bool weighted,
+                                        const FieldType& field,
+                                        size_t varBegin,
+                                        size_t varEnd,
+                                        GradientType& gradient,
+                                        bool deferComms,
+                                        MinMaxType* fieldMin,
+                                        MinMaxType* fieldMax)
+{
+  size_t nPointDomain = geometry.GetnPointDomain();
+
+  const bool minMax = (fieldMin != nullptr) && (fieldMax != nullptr);
+
+#ifdef HAVE_OMP
+  constexpr size_t OMP_MAX_CHUNK = 512;
+
+  size_t chunkSize = computeStaticChunkSize(nPointDomain,
+                     omp_get_max_threads(), OMP_MAX_CHUNK);
+#endif
+
+  SU2_OMP_FOR_DYN(chunkSize)
+  for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
+  {
+    auto node = geometry.node[iPoint];
+    const su2double* weights = geometry.GetLeastSquaresWeights(weighted, iPoint);
+
+    AD::StartPreacc();
+    AD::SetPreaccIn(weights, node->GetnPoint()*nDim);
+
+    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+    {
+      AD::SetPreaccIn(field(iPoint,iVar));
+
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        gradient(iPoint, iVar, iDim) = 0.0;
+
+      if (minMax) (*fieldMin)(iPoint,iVar) = (*fieldMax)(iPoint,iVar) = field(iPoint,iVar);
+    }
+
+    for (size_t iNeigh = 0; iNeigh < node->GetnPoint(); ++iNeigh)
+    {
+      size_t jPoint = node->GetPoint(iNeigh);
+      const su2double* weight = &weights[iNeigh*nDim];
+
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+      {
+        AD::SetPreaccIn(field(jPoint,iVar));
+
+        su2double delta_ij = field(jPoint,iVar) - field(iPoint,iVar);
+
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          gradient(iPoint, iVar, iDim) += weight[iDim] * delta_ij;
+
+        if (minMax) {
+          (*fieldMin)(iPoint,iVar) = min((*fieldMin)(iPoint,iVar), field(jPoint,iVar));
+          (*fieldMax)(iPoint,iVar) = max((*fieldMax)(iPoint,iVar), field(jPoint,iVar));
+        }
+      }
+    }
+
+    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+    {
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        AD::SetPreaccOut(gradient(iPoint, iVar, iDim));
+
+      if (minMax) {
+        AD::SetPreaccOut((*fieldMin)(iPoint,iVar));
+        AD::SetPreaccOut((*fieldMax)(iPoint,iVar));
+      }
+    }
+
+    AD::EndPreacc();
+  }
+
+  /*--- If no solver was provided we do not communicate ---*/
+
+  SU2_OMP_MASTER
+  if (solver != nullptr)
+  {
+    solver->InitiateComms(&geometry, &config, kindMpiComm);
+    if (deferComms) solver->SetPendingComms(kindMpiComm);
+    else solver->CompleteComms(&geometry, &config, kindMpiComm);
+  }
+  SU2_OMP_BARRIER
+
+}
+
+
+/*!
+ * \brief Least-Squares gradient with the number of dimensions known at compile time,
+ *        such that the loops over dimensions are unrolled, see computeGradientsLeastSquares.
  */
-template<class FieldType, class GradientType, class RMatrixType>
+template<size_t nDim, class FieldType, class GradientType, class RMatrixType, class MinMaxType>
 void computeGradientsLeastSquares(CSolver* solver,
                                   MPI_QUANTITIES kindMpiComm,
                                   PERIODIC_QUANTITIES kindPeriodicComm,
@@ -56,12 +145,27 @@ void computeGradientsLeastSquares(CSolver* solver,
                                   size_t varBegin,
                                   size_t varEnd,
                                   GradientType& gradient,
-                                  RMatrixType& Rmatrix)
+                                  RMatrixType& Rmatrix,
+                                  bool deferComms,
+                                  MinMaxType* fieldMin,
+                                  MinMaxType* fieldMax)
 {
   constexpr size_t MAXNDIM = 3;
 
   size_t nPointDomain = geometry.GetnPointDomain();
-  size_t nDim = geometry.GetnDim();
+
+  const bool minMax = (fieldMin != nullptr) && (fieldMax != nullptr);
+
+  /*--- The periodic corrections of the matrices involve the other side of the boundary. ---*/
+
+  const bool storeWeights = (config.GetnMarker_Periodic() == 0) && (nPointDomain > 0) &&
+                            (geometry.GetLeastSquaresWeights(weighted, 0) != nullptr);
+
+  if (storeWeights && geometry.GetLeastSquaresWeightsValid(weighted)) {
+    computeGradientsLeastSquaresStored<nDim>(solver, kindMpiComm, geometry, config, weighted, field,
+                                             varBegin, varEnd, gradient, deferComms, fieldMin, fieldMax);
+    return;
+  }
 
 #ifdef HAVE_OMP
   constexpr size_t OMP_MAX_CHUNK = 512;
@@ -94,6 +198,10 @@ void computeGradientsLeastSquares(CSolver* solver,
       for (size_t jDim = 0; jDim < nDim; ++jDim)
         Rmatrix(iPoint, iDim, jDim) = 0.0;
 
+    if (minMax) {
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        (*fieldMin)(iPoint,iVar) = (*fieldMax)(iPoint,iVar) = field(iPoint,iVar);
+    }
 
     for (size_t iNeigh = 0; iNeigh < node->GetnPoint(); ++iNeigh)
     {
@@ -102,6 +210,16 @@ void computeGradientsLeastSquares(CSolver* solver,
       const su2double* coord_j = geometry.node[jPoint]->GetCoord();
       AD::SetPreaccIn(coord_j, nDim);
 
+      /*--- Stencil of the limiters, independent of the weights. ---*/
+
+      if (minMax) {
+        for (size_t iVar = varBegin; iVar < varEnd; ++iVar) {
+          AD::SetPreaccIn(field(jPoint,iVar));
+          (*fieldMin)(iPoint,iVar) = min((*fieldMin)(iPoint,iVar), field(jPoint,iVar));
+          (*fieldMax)(iPoint,iVar) = max((*fieldMax)(iPoint,iVar), field(jPoint,iVar));
+        }
+      }
+
       /*--- Distance vector from iPoint to jPoint ---*/
 
       su2double dist_ij[MAXNDIM] = {0.0};
@@ -160,6 +278,13 @@ void computeGradientsLeastSquares(CSolver* solver,
       for (size_t iDim = 0; iDim < nDim; ++iDim)
         AD::SetPreaccOut(gradient(iPoint, iVar, iDim));
 
+    if (minMax) {
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar) {
+        AD::SetPreaccOut((*fieldMin)(iPoint,iVar));
+        AD::SetPreaccOut((*fieldMax)(iPoint,iVar));
+      }
+    }
+
     AD::EndPreacc();
   }
 
@@ -293,8 +418,47 @@ void computeGradientsLeastSquares(CSolver* solver,
       for (size_t iDim = 0; iDim < nDim; ++iDim)
         gradient(iPoint, iVar, iDim) = Cvector[iDim];
     }
+
+    /*--- Weights of each neighbor for the next calls, S * dist_ij * weight. ---*/
+
+    if (storeWeights)
+    {
+      auto node = geometry.node[iPoint];
+      const su2double* coord_i = node->GetCoord();
+      su2double* weights = geometry.GetLeastSquaresWeights(weighted, iPoint);
+
+      for (size_t iNeigh = 0; iNeigh < node->GetnPoint(); ++iNeigh)
+      {
+        const su2double* coord_j = geometry.node[node->GetPoint(iNeigh)]->GetCoord();
+
+        su2double dist_ij[MAXNDIM] = {0.0}, weight = 1.0;
+
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          dist_ij[iDim] = coord_j[iDim] - coord_i[iDim];
+
+        if (weighted)
+        {
+          weight = 0.0;
+          for (size_t iDim = 0; iDim < nDim; ++iDim)
+            weight += dist_ij[iDim] * dist_ij[iDim];
+        }
+
+        if (weight > 0.0) weight = 1.0 / weight;
+
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+        {
+          su2double sum = 0.0;
+          for (size_t jDim = 0; jDim < nDim; ++jDim)
+            sum += Smatrix[iDim][jDim] * dist_ij[jDim];
+          weights[iNeigh*nDim+iDim] = weight * sum;
+        }
+      }
+    }
   }
 
+  SU2_OMP_MASTER
+  if (storeWeights) geometry.SetLeastSquaresWeightsValid(weighted);
+
   /*--- If no solver was provided we do not communicate ---*/
 
   SU2_OMP_MASTER
@@ -303,8 +467,70 @@ void computeGradientsLeastSquares(CSolver* solver,
     /*--- Obtain the gradients at halo points from the MPI ranks that own them. ---*/
 
     solver->InitiateComms(&geometry, &config, kindMpiComm);
-    solver->CompleteComms(&geometry, &config, kindMpiComm);
+    if (deferComms) solver->SetPendingComms(kindMpiComm);
+    else solver->CompleteComms(&geometry, &config, kindMpiComm);
   }
   SU2_OMP_BARRIER
 
 }
+
+} // end namespace detail
+
+/*!
+ * \brief Compute the gradient of a field using inverse-distance-weighted or
+ *        unweighted Least-Squares approximation.
+ * \note See notes from computeGradientsGreenGauss.hpp.
+ * \param[in] solver - Optional, solver associated with the field (used only for MPI).
+ * \param[in] kindMpiComm - Type of MPI communication required.
+ * \param[in] kindPeriodicComm - Type of periodic communication required.
+ * \param[in] geometry - Geometric grid properties.
+ * \param[in] weighted - Use inverse-distance weights.
+ * \param[in] config - Configuration of the problem, used to identify types of boundaries.
+ * \param[in] field - Generic object implementing operator (iPoint, iVar).
+ * \param[in] varBegin - Index of first variable for which to compute the gradient.
+ * \param[in] varEnd - Index of last variable for which to compute the gradient.
+ * \param[out] gradient - Generic object implementing operator (iPoint, iVar, iDim).
+ * \param[out] Rmatrix - Generic object implementing operator (iPoint, iDim, iDim).
+ * \param[in] deferComms - Only initiate the MPI communication, see CSolver::SetPendingComms.
+ * \param[out] fieldMin - Optional, minimum field values over each point and its direct neighbors.
+ * \param[out] fieldMax - Optional, as above but maximum values.
+ * \note Without periodic boundaries, if the geometry stores the weights (LEAST_SQUARES_CACHE), they are
+ *       computed by the first call after the points move, and the next calls only use the weights.
+ */
+template<class FieldType, class GradientType, class RMatrixType, class MinMaxType = su2activematrix>
+void computeGradientsLeastSquares(CSolver* solver,
+                                  MPI_QUANTITIES kindMpiComm,
+                                  PERIODIC_QUANTITIES kindPeriodicComm,
+                                  CGeometry& geometry,
+                                  CConfig& config,
+                                  bool weighted,
+                                  const FieldType& field,
+                                  size_t varBegin,
+                                  size_t varEnd,
+                                  GradientType& gradient,
+                                  RMatrixType& Rmatrix,
+                                  bool deferComms = false,
+                                  MinMaxType* fieldMin = nullptr,
+                                  MinMaxType* fieldMax = nullptr)
+{
+  /*--- Estimated traffic, field, gradient and matrix of the points, and field, coordinates and indices of the neighbors. ---*/
+
+  SU2_PROFILE_REGION_BYTES("Gradients",
+    passivedouble(geometry.GetnPointDomain()*((varEnd-varBegin)*(1+geometry.GetnDim()) +
+                                               geometry.GetnDim()*geometry.GetnDim())*sizeof(su2double) +
+                  2*geometry.GetnEdge()*(sizeof(unsigned long) + (geometry.GetnDim()+varEnd-varBegin)*sizeof(su2double))));
+
+  switch (geometry.GetnDim()) {
+  case 2:
+    detail::computeGradientsLeastSquares<2>(solver, kindMpiComm, kindPeriodicComm, geometry, config, weighted, field,
+      varBegin, varEnd, gradient, Rmatrix, deferComms, fieldMin, fieldMax);
+    break;
+  case 3:
+    detail::computeGradientsLeastSquares<3>(solver, kindMpiComm, kindPeriodicComm, geometry, config, weighted, field,
+      varBegin, varEnd, gradient, Rmatrix, deferComms, fieldMin, fieldMax);
+    break;
+  default:
+    SU2_MPI::Error("Too many dimensions to compute gradients.", CURRENT_FUNCTION);
+    break;
+  }
+}
@@ -0,0 +1,88 @@
+/*!
+ * \file CCoupledTurbIntegration.hpp
+ * \brief Declaration of the integration of the (monolithically) coupled mean flow and turbulence equations.
+ *        The implementations are in the <i>CCoupledTurbIntegration.cpp</i> file.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "CMultiGridIntegration.hpp"
+
+/*!
+ * \class CCoupledTurbIntegration
+ * \brief Implicit iteration of the mean flow and turbulence equations as one block system.
+ * \note Both residuals are evaluated at the same state, and the blocks of the flow and turbulence
+ *       Jacobians are placed on the diagonal of a matrix of block size nVarFlow + nVarTurb, which
+ *       is solved once with the flow linear solver settings. The numerics only provide the
+ *       derivatives of each residual w.r.t. its own variables, the cross-coupling blocks are zero.
+ *       The rest of the multigrid machinery is reused (on the finest grid only).
+ */
+class CCoupledTurbIntegration final : public CMultiGridIntegration {
+private:
+#ifndef CODI_FORWARD_TYPE
+  using Scalar = su2mixedfloat;
+#else
+  using Scalar = su2double;
+#endif
+
+  CNumerics** turbNumerics = nullptr;  /*!< \brief Numerics of the turbulence solver on the finest grid. */
+  CSolver** solvers = nullptr;         /*!< \brief Solvers on the finest grid. */
+  CGeometry* geometry = nullptr;       /*!< \brief Finest grid. */
+
+  CSysMatrix<Scalar> Jacobian;         /*!< \brief Jacobian of the coupled system. */
+  CSysSolve<Scalar> System;            /*!< \brief Linear solver of the coupled system. */
+  CSysVector<su2double> LinSysRes;     /*!< \brief Right hand side of the coupled system. */
+  CSysVector<su2double> LinSysSol;     /*!< \brief Solution of the coupled system. */
+
+  /*!
+   * \brief Build the turbulence residual and Jacobian at the current state.
+   */
+  void ComputeTurbulenceSystem(CConfig *config);
+
+  /*!
+   * \brief Copy the flow and turbulence systems into the coupled one, solve it, and update both solutions.
+   */
+  void CoupledIteration(CConfig *config);
+
+  /*!
+   * \brief Use the coupled iteration on the finest grid, otherwise the standard time integration.
+   */
+  void Time_Integration(CGeometry *geometry, CSolver **solver_container, CConfig *config,
+                        unsigned short iRKStep, unsigned short RunTime_EqSystem) override;
+
+public:
+  /*!
+   * \brief Constructor of the class.
+   */
+  CCoupledTurbIntegration();
+
+  /*!
+   * \brief Keep references to the finest grid entities, allocate the coupled system, and run
+   *        the (single grid) multigrid iteration.
+   */
+  void MultiGrid_Iteration(CGeometry ****geometry, CSolver *****solver_container,
+                           CNumerics ******numerics_container, CConfig **config,
+                           unsigned short RunTime_EqSystem, unsigned short iZone, unsigned short iInst) override;
+};
@@ -52,7 +52,54 @@ public:
                             CNumerics ******numerics_container, CConfig **config,
                             unsigned short RunTime_EqSystem, unsigned short iZone, unsigned short iInst) override;
 
+  /*!
+   * \brief Do the p-multigrid iteration for steady problems. The coarse levels have the same elements,
+            but a solution polynomial degree that is decreased by one per level. Without coarse levels
+            the single grid iteration is carried out.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics_container - Description of the numerical method (the way in which the equations are solved).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] RunTime_EqSystem - System of equations which is going to be solved.
+   * \param[in] iZone - Current zone.
+   * \param[in] iInst - Current instance.
+   */
+  void MultiGrid_Iteration(CGeometry ****geometry, CSolver *****solver_container,
+                           CNumerics ******numerics_container, CConfig **config,
+                           unsigned short RunTime_EqSystem, unsigned short iZone, unsigned short iInst) override;
+
 private:
+  /*!
+   * \brief Perform a p-multigrid cycle (Full Approximation Scheme), recursive function.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics_container - Description of the numerical method (the way in which the equations are solved).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the p-multigrid level.
+   * \param[in] RecursiveParam - Type of cycle, V, W or F.
+   * \param[in] RunTime_EqSystem - System of equations which is going to be solved.
+   * \param[in] iZone - Current zone.
+   * \param[in] iInst - Current instance.
+   */
+  void MultiGrid_Cycle(CGeometry ****geometry, CSolver *****solver_container,
+                       CNumerics ******numerics_container, CConfig **config,
+                       unsigned short iMesh, unsigned short RecursiveParam,
+                       unsigned short RunTime_EqSystem, unsigned short iZone, unsigned short iInst);
+
+  /*!
+   * \brief Perform the smoothing iterations, i.e. explicit Runge-Kutta steps, on a p-multigrid level.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the p-multigrid level.
+   * \param[in] nIter - Number of smoothing iterations.
+   * \param[in] RunTime_EqSystem - System of equations which is going to be solved.
+   */
+  void Smoothing_Iterations(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics,
+                            CConfig *config, unsigned short iMesh, unsigned short nIter,
+                            unsigned short RunTime_EqSystem);
+
   /*!
    * \brief Perform the spatial integration of the numerical system.
    * \param[in] geometry - Geometrical definition of the problem.
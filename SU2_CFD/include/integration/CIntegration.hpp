@@ -65,6 +65,18 @@ protected:
                          CConfig *config, unsigned short iMesh, unsigned short iRKStep,
                          unsigned short RunTime_EqSystem);
 
+  /*!
+   * \brief Apply the weak boundary condition of a marker.
+   * \param[in] iMarker - Index of the marker.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics - Description of the numerical method (of the calling thread).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] MainSolver - Position of the solver in the container.
+   */
+  void Weak_BoundaryCondition(unsigned short iMarker, CGeometry *geometry, CSolver **solver_container,
+                              CNumerics **numerics, CConfig *config, unsigned short MainSolver);
+
   /*!
    * \brief Do the time integration (explicit or implicit) of the numerical system.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -73,8 +85,20 @@ protected:
    * \param[in] iRKStep - Current step of the Runge-Kutta iteration.
    * \param[in] RunTime_EqSystem - System of equations which is going to be solved.
    */
-  void Time_Integration(CGeometry *geometry, CSolver **solver_container, CConfig *config,
-                        unsigned short iRKStep, unsigned short RunTime_EqSystem);
+  virtual void Time_Integration(CGeometry *geometry, CSolver **solver_container, CConfig *config,
+                                unsigned short iRKStep, unsigned short RunTime_EqSystem);
+
+  /*!
+   * \brief Restrict the eddy viscosity from fine grid to a coarse grid.
+   * \param[in] RunTime_EqSystem - System of equations which is going to be solved.
+   * \param[in] sol_fine - Pointer to the solution on the fine grid.
+   * \param[out] sol_coarse - Pointer to the solution on the coarse grid.
+   * \param[in] geo_fine - Geometrical definition of the fine grid.
+   * \param[in] geo_coarse - Geometrical definition of the coarse grid.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetRestricted_EddyVisc(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse,
+                              CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config);
 
 public:
   /*!
@@ -129,8 +153,11 @@ public:
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] solution - Flow solution.
    * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   * \param[in] predictor - Extrapolate the initial guess of the next time step (see TIME_PREDICTOR_ORDER).
    */
-  void SetDualTime_Solver(CGeometry *geometry, CSolver *solver, CConfig *config, unsigned short iMesh);
+  void SetDualTime_Solver(CGeometry *geometry, CSolver *solver, CConfig *config, unsigned short iMesh,
+                          bool predictor = false);
 
   /*!
    * \brief Save the structural solution at different time steps.
@@ -25,6 +25,8 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#pragma once
+
 #include "CIntegration.hpp"
 
 /*!
@@ -32,13 +34,22 @@
  * \brief Class for time integration using a multigrid method.
  * \author F. Palacios
  */
-class CMultiGridIntegration final : public CIntegration {
+class CMultiGridIntegration : public CIntegration {
+private:
+  vector<passivedouble> levelTime;    /*!< \brief Wall time spent in each level, excluding the coarser levels. */
+  vector<unsigned long> levelVisits;  /*!< \brief Number of visits of each level by the cycles. */
+
 public:
   /*!
    * \brief Constructor of the class.
    */
   CMultiGridIntegration();
 
+  /*!
+   * \brief Destructor of the class, reports the time spent in each multigrid level.
+   */
+  ~CMultiGridIntegration() override;
+
   /*!
    * \brief This subroutine calls the MultiGrid_Cycle and also prepare the multigrid levels and the monitoring.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -60,7 +71,7 @@ private:
    * \param[in] numerics_container - Description of the numerical method (the way in which the equations are solved).
    * \param[in] config - Definition of the particular problem.
    * \param[in] iMesh - Index of the mesh in multigrid computations.
-   * \param[in] mu - Variable for controlling the kind of multigrid algorithm.
+   * \param[in] mu - Kind of cycle from this level (V_CYCLE, W_CYCLE, or F_CYCLE).
    * \param[in] RunTime_EqSystem - System of equations which is going to be solved.
    * \param[in] Iteration - Current iteration.
    */
@@ -71,14 +82,15 @@ private:
 
   /*!
    * \brief Compute the forcing term.
+   * \param[in] RunTime_EqSystem - System of equations which is going to be solved.
    * \param[in] sol_fine - Pointer to the solution on the fine grid.
    * \param[in] sol_coarse - Pointer to the solution on the coarse grid.
    * \param[in] geo_fine - Geometrical definition of the fine grid.
    * \param[in] geo_coarse - Geometrical definition of the coarse grid.
    * \param[in] config - Definition of the particular problem.
    */
-  void SetForcing_Term(CSolver *sol_fine, CSolver *sol_coarse, CGeometry *geo_fine,
-                       CGeometry *geo_coarse, CConfig *config, unsigned short iMesh);
+  void SetForcing_Term(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse,
+                       CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config, unsigned short iMesh);
 
   /*!
    * \brief Add the truncation error to the residual.
@@ -89,11 +101,13 @@ private:
 
   /*!
    * \brief Set the value of the corrected fine grid solution.
+   * \param[in] RunTime_EqSystem - System of equations which is going to be solved.
    * \param[out] sol_fine - Pointer to the solution on the fine grid.
    * \param[in] geo_fine - Geometrical definition of the fine grid.
    * \param[in] config - Definition of the particular problem.
    */
-  void SetProlongated_Correction(CSolver *sol_fine, CGeometry *geo_fine, CConfig *config, unsigned short iMesh);
+  void SetProlongated_Correction(unsigned short RunTime_EqSystem, CSolver *sol_fine, CGeometry *geo_fine,
+                                 CConfig *config, unsigned short iMesh);
 
   /*!
    * \brief Compute the gradient in coarse grid using the fine grid information.
@@ -0,0 +1,123 @@
+/*!
+ * \file CNewtonIntegration.hpp
+ * \brief Newton-Krylov integration with matrix-free Jacobian-vector products.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "CMultiGridIntegration.hpp"
+#include "../../../Common/include/linear_algebra/CMatrixVectorProduct.hpp"
+#include "../../../Common/include/toolboxes/graph_toolbox.hpp"
+
+/*!
+ * \class CNewtonIntegration
+ * \brief Newton-Krylov method for the flow equations.
+ * \note The implicit system is solved with a matrix-free approximation of the full (e.g. second order)
+ *       Jacobian, (R(U+eps*u) - R(U)) / eps, plus the pseudo time term. The assembled (approximate)
+ *       Jacobian is only used as preconditioner. The first iterations (startup) use the standard
+ *       implicit method, the rest of the multigrid machinery is reused (on the finest grid only).
+ */
+class CNewtonIntegration final : public CMultiGridIntegration {
+private:
+#ifndef CODI_FORWARD_TYPE
+  using Scalar = su2mixedfloat;
+#else
+  using Scalar = su2double;
+#endif
+
+  /*!
+   * \brief Matrix-free product that calls back the integration to evaluate the residuals.
+   */
+  class CMatrixFreeProduct final : public CMatrixVectorProduct<Scalar> {
+  private:
+    CNewtonIntegration& newton; /*!< \brief Integration object that evaluates the products. */
+  public:
+    CMatrixFreeProduct(CNewtonIntegration& newton_ref) : newton(newton_ref) {}
+
+    inline void operator()(const CSysVector<Scalar> & u, CSysVector<Scalar> & v) const override {
+      newton.MatrixFreeProduct(u, v);
+    }
+  };
+
+  CNumerics** numerics = nullptr;      /*!< \brief Numerics of the flow solver on the finest grid. */
+  CSolver** solvers = nullptr;         /*!< \brief Solvers on the finest grid. */
+  CGeometry* geometry = nullptr;       /*!< \brief Finest grid. */
+  CConfig* config = nullptr;           /*!< \brief Definition of the problem. */
+
+  CSysVector<su2double> solution0;     /*!< \brief Solution around which the products are computed. */
+  CSysVector<su2double> residual0;     /*!< \brief Residual of the unperturbed solution. */
+  CSysVector<su2double> rhs;           /*!< \brief Right hand side of the Newton system (the residual vector is overwritten). */
+  su2double finDiffStep = 0.0;         /*!< \brief Absolute perturbation step (for a unit rms direction). */
+  su2double sqrtNumUnknowns = 0.0;     /*!< \brief Square root of the global number of unknowns. */
+
+  CCompressedSparsePatternUL stencil;  /*!< \brief Dependency stencil of the residual (AD Jacobian). */
+  CCompressedSparsePatternUL coloring; /*!< \brief Coloring of the stencil (AD Jacobian). */
+  vector<unsigned short> pointColor;   /*!< \brief Color of each point (AD Jacobian). */
+
+  /*!
+   * \brief Compute the residual of the current flow solution without updating the Jacobian.
+   */
+  void ComputeResiduals();
+
+  /*!
+   * \brief Assemble the Jacobian of the residual with forward AD (SU2_CFD_DIRECTDIFF), seeding the
+   *        points of each color of the stencil together, instead of the approximate numerics Jacobians.
+   * \note The blocks outside of the pattern of the matrix (e.g. due to the gradients) are dropped.
+   *       In parallel the coloring is local, the blocks coupled through halo gradients are approximate.
+   *       To be called by all threads.
+   */
+  void ComputeADJacobian();
+
+  /*!
+   * \brief Jacobian-vector product by finite differences, v = (V/dt) u + (R(U+eps*u) - R(U)) / eps.
+   * \note To be called by all threads.
+   */
+  void MatrixFreeProduct(const CSysVector<Scalar>& u, CSysVector<Scalar>& v);
+
+  /*!
+   * \brief Perform one Newton-Krylov iteration (replaces the implicit Euler iteration of the flow solver).
+   */
+  void NewtonIteration();
+
+  /*!
+   * \brief Use the Newton-Krylov method for the flow equations on the finest grid after the startup
+   *        iterations, otherwise the standard time integration.
+   */
+  void Time_Integration(CGeometry *geometry, CSolver **solver_container, CConfig *config,
+                        unsigned short iRKStep, unsigned short RunTime_EqSystem) override;
+
+public:
+  /*!
+   * \brief Constructor of the class.
+   */
+  CNewtonIntegration();
+
+  /*!
+   * \brief Keep references to the finest grid entities and run the (single grid) multigrid iteration.
+   */
+  void MultiGrid_Iteration(CGeometry ****geometry, CSolver *****solver_container,
+                           CNumerics ******numerics_container, CConfig **config,
+                           unsigned short RunTime_EqSystem, unsigned short iZone, unsigned short iInst) override;
+};
@@ -37,6 +37,8 @@
 #include <algorithm>
 #include <iostream>
 #include <stdlib.h>
+#include <vector>
+#include <list>
 #include <stdio.h>
 
 #include "../../../Common/include/CConfig.hpp"
@@ -71,6 +73,50 @@ protected:
 
   unsigned short nVar;
 
+  /*!
+   * \brief Communication pattern of the transfer on one interface marker, i.e. which owned donor
+   * vertices are sent to which ranks, and the positions of the donor points of the owned target
+   * vertices in the buffer of received donor variables.
+   */
+  struct CTransferPattern {
+    int markerDonor = -1;                   /*!< \brief Local index of the donor marker, -1 if not on this rank. */
+    int markerTarget = -1;                  /*!< \brief Local index of the target marker, -1 if not on this rank. */
+    bool active = false;                    /*!< \brief Whether the interface exists in both zones. */
+    vector<int> sendRank;                   /*!< \brief Ranks to which donor variables are sent. */
+    vector<unsigned long> sendStart;        /*!< \brief Start of the vertices of each destination in sendVertex. */
+    vector<unsigned long> sendVertex;       /*!< \brief Donor vertices sent to each destination. */
+    vector<int> recvRank;                   /*!< \brief Ranks from which donor variables are received. */
+    vector<unsigned long> recvStart;        /*!< \brief Start of the vertices of each source in the receive buffer. */
+    vector<unsigned long> donorPosition;    /*!< \brief Buffer positions of the donor points of the owned target vertices. */
+  };
+
+  vector<CTransferPattern> transferPattern; /*!< \brief Transfer pattern of each interface marker. */
+  bool transferPatternOutdated = true;      /*!< \brief Whether the transfer pattern must be (re)built. */
+
+  /*!
+   * \brief Transfer whose messages have been posted but whose target variables are not set yet.
+   */
+  struct CPendingTransfer {
+    CSolver *target_solution = nullptr;      /*!< \brief Solution of the target mesh. */
+    CGeometry *target_geometry = nullptr;    /*!< \brief Geometry of the target mesh. */
+    CConfig *target_config = nullptr;        /*!< \brief Definition of the problem at the target mesh. */
+    vector<vector<su2double> > sendBuffer;   /*!< \brief Donor variables sent, per interface marker. */
+    vector<vector<su2double> > recvBuffer;   /*!< \brief Donor variables received, per interface marker. */
+    vector<SU2_MPI::Request> request;        /*!< \brief Requests of the point-to-point messages. */
+  };
+
+  list<CPendingTransfer> pendingTransfers;  /*!< \brief Transfers initiated and not completed. */
+
+  /*!
+   * \brief Build the transfer pattern of BroadcastData from the donor information of the target vertices.
+   * \param[in] donor_geometry - Geometry of the donor mesh.
+   * \param[in] target_geometry - Geometry of the target mesh.
+   * \param[in] donor_config - Definition of the problem at the donor mesh.
+   * \param[in] target_config - Definition of the problem at the target mesh.
+   */
+  void SetTransferPattern(CGeometry *donor_geometry, CGeometry *target_geometry,
+                          CConfig *donor_config, CConfig *target_config);
+
 public:
   /*!
    * \brief Constructor of the class.
@@ -91,7 +137,13 @@ public:
   virtual ~CInterface(void);
 
   /*!
-   * \brief Interpolate data and broadcast it into all processors, for nonmatching meshes.
+   * \brief Mark the transfer pattern for rebuilding, needed after the donor information of
+   * the target vertices changes (i.e. after the transfer coefficients are recomputed).
+   */
+  inline void SetTransferPatternOutdated(void) { transferPatternOutdated = true; }
+
+  /*!
+   * \brief Interpolate data and send it to the ranks that need it, for nonmatching meshes.
    * \param[in] donor_solution - Solution from the donor mesh.
    * \param[in] target_solution - Solution from the target mesh.
    * \param[in] donor_geometry - Geometry of the donor mesh.
@@ -102,6 +154,27 @@ public:
   void BroadcastData(CSolver *donor_solution, CSolver *target_solution,
                      CGeometry *donor_geometry, CGeometry *target_geometry,
                      CConfig *donor_config, CConfig *target_config);
+
+  /*!
+   * \brief First half of BroadcastData, evaluates the donor variables and posts the messages
+   * without waiting for them, so that several transfers can overlap. The target variables are
+   * set by CompleteTransfers, which must be called by all ranks after the same sequence of transfers.
+   * \param[in] donor_solution - Solution from the donor mesh.
+   * \param[in] target_solution - Solution from the target mesh.
+   * \param[in] donor_geometry - Geometry of the donor mesh.
+   * \param[in] target_geometry - Geometry of the target mesh.
+   * \param[in] donor_config - Definition of the problem at the donor mesh.
+   * \param[in] target_config - Definition of the problem at the target mesh.
+   */
+  void InitiateTransfer(CSolver *donor_solution, CSolver *target_solution,
+                        CGeometry *donor_geometry, CGeometry *target_geometry,
+                        CConfig *donor_config, CConfig *target_config);
+
+  /*!
+   * \brief Second half of BroadcastData, waits for the messages of all the initiated transfers
+   * and sets the target variables, in the order in which the transfers were initiated.
+   */
+  void CompleteTransfers(void);
   /*!
    * \brief A virtual member.
    */
@@ -159,6 +232,16 @@ public:
                                          CConfig *target_config, unsigned long Marker_Target,
                                          unsigned long Vertex_Target, unsigned long Point_Target) { }
 
+  /*!
+   * \brief A virtual member, called by all ranks once all the target variables of a transfer have been set,
+   *        for operations that depend on the whole interface (e.g. a dynamic relaxation).
+   * \param[in] target_solution - Solution from the target mesh.
+   * \param[in] target_geometry - Geometry of the target mesh.
+   * \param[in] target_config - Definition of the problem at the target mesh.
+   */
+  inline virtual void FinalizeTarget_Variables(CSolver *target_solution, CGeometry *target_geometry,
+                                               CConfig *target_config) { }
+
   /*!
    * \brief A virtual member.
    * \param[in] target_solution - Solution from the target mesh.
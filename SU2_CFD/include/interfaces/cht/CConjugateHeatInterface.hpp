@@ -33,6 +33,22 @@
 class CConjugateHeatInterface : public CInterface {
 
 protected:
+  vector<vector<su2double> > Staged_Variable;  /*!< \brief New target variables, per marker and vertex, before the dynamic relaxation. */
+  vector<vector<su2double> > Residual_Old;     /*!< \brief Change of the interface temperature proposed by the previous transfer. */
+  bool Residual_Old_Set = false;               /*!< \brief Whether there was a previous transfer. */
+  su2double Relaxation_Factor = 1.0;           /*!< \brief Dynamic relaxation factor of the last transfer. */
+
+  /*!
+   * \brief Relax the conjugate heat variables of a target vertex towards new values.
+   * \param[in] target_solution - Solution from the target mesh.
+   * \param[in] target_config - Definition of the problem at the target mesh.
+   * \param[in] Marker_Target - Index of the target marker.
+   * \param[in] Vertex_Target - Index of the target vertex.
+   * \param[in] relaxation - Relaxation factor.
+   * \param[in] values - New values of the variables.
+   */
+  void SetConjugateHeatVariables(CSolver *target_solution, const CConfig *target_config, unsigned long Marker_Target,
+                                 unsigned long Vertex_Target, su2double relaxation, const su2double *values) const;
 
 public:
 
@@ -76,4 +92,13 @@ public:
    */
   void SetTarget_Variable(CSolver *target_solution, CGeometry *target_geometry, CConfig *target_config,
                           unsigned long Marker_Target, unsigned long Vertex_Target, unsigned long Point_Target);
+
+  /*!
+   * \brief With Aitken's relaxation, compute the dynamic factor from the change of the interface temperature
+   *        over the whole interface, and apply it to the variables that were staged by SetTarget_Variable.
+   * \param[in] target_solution - Solution from the target mesh.
+   * \param[in] target_geometry - Geometry of the target mesh.
+   * \param[in] target_config - Definition of the problem at the target mesh.
+   */
+  void FinalizeTarget_Variables(CSolver *target_solution, CGeometry *target_geometry, CConfig *target_config) override;
 };
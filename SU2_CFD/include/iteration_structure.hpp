@@ -36,6 +36,7 @@
 #include "output/COutput.hpp"
 #include "../../Common/include/CConfig.hpp"
 #include "../include/integration/CIntegration.hpp"
+#include "../../Common/include/toolboxes/CBinomialCheckpoints.hpp"
 
 using namespace std;
 
@@ -1025,10 +1026,48 @@ class CDiscAdjFluidIteration : public CIteration {
 
 private:
 
-  CFluidIteration* meanflow_iteration; /*!< \brief Pointer to the mean flow iteration class. */
+  CFluidIteration* meanflow_iteration = nullptr; /*!< \brief Pointer to the mean flow iteration class (recomputes the direct time steps). */
+  CBinomialCheckpoints* checkpoints = nullptr;   /*!< \brief Checkpoints of the direct solution, if it is not read from restart files. */
   unsigned short CurrentRecording; /*!< \brief Stores the current status of the recording. */
   bool turbulent;       /*!< \brief Stores the turbulent flag. */
 
+  /*!
+   * \brief Pack (or unpack) the direct state of a time step, i.e. the time levels and optionally the solution
+   *        of the flow and turbulence solvers on all grid levels.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_iZone - Index of the zone.
+   * \param[in] val_iInst - Index of the instance.
+   * \param[in] pack - Whether the state is packed (read from the solvers) or unpacked (written to them).
+   * \param[in] withSolution - Whether the state includes the solution.
+   * \param[in,out] state - The state.
+   */
+  void CheckpointState(CGeometry ****geometry, CSolver *****solver, CConfig **config,
+                       unsigned short val_iZone, unsigned short val_iInst,
+                       bool pack, bool withSolution, vector<passivedouble>& state) const;
+
+  /*!
+   * \brief Recompute the direct solution of a time step from the latest checkpoint (or the freestream),
+   *        taking new checkpoints on the way, instead of loading it from a restart file.
+   * \note The time levels (solutions at n and n-1) of the solvers are not modified.
+   * \param[in] integration - Container vector with all the integration methods.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver - Container vector with all the solutions.
+   * \param[in] numerics - Description of the numerical method (the way in which the equations are solved).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] surface_movement - Surface movement classes of the problem.
+   * \param[in] grid_movement - Volume grid movement classes of the problem.
+   * \param[in] FFDBox - FFD FFDBoxes of the problem.
+   * \param[in] val_iZone - Index of the zone.
+   * \param[in] val_iInst - Index of the instance.
+   * \param[in] val_DirectIter - Direct iteration to recompute.
+   */
+  void RecomputeUnsteady_Solution(CIntegration ****integration, CGeometry ****geometry, CSolver *****solver,
+                                  CNumerics ******numerics, CConfig **config, CSurfaceMovement **surface_movement,
+                                  CVolumetricMovement ***grid_movement, CFreeFormDefBox*** FFDBox,
+                                  unsigned short val_iZone, unsigned short val_iInst, int val_DirectIter);
+
 public:
 
   /*!
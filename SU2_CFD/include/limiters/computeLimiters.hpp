@@ -27,6 +27,7 @@
 
 #include "CLimiterDetails.hpp"
 #include "computeLimiters_impl.hpp"
+#include "../../../Common/include/toolboxes/CRegionProfiler.hpp"
 
 /*!
  * \brief A wrapper funtion that calls specialized implementations depending
@@ -48,12 +49,21 @@ void computeLimiters(ENUM_LIMITER LimiterKind,
                      const GradientType& gradient,
                      FieldType& fieldMin,
                      FieldType& fieldMax,
-                     FieldType& limiter)
+                     FieldType& limiter,
+                     bool deferComms = false,
+                     bool minMaxReady = false,
+                     const su2vector<bool>* pointMask = nullptr)
 {
-#define INSTANTIATE(KIND) \
-computeLimiters_impl<FieldType, GradientType, KIND>(solver, kindMpiComm, \
+  SU2_PROFILE_REGION("Limiters");
+
+#define INSTANTIATE_NDIM(NDIM, KIND) \
+computeLimiters_impl<NDIM, FieldType, GradientType, KIND>(solver, kindMpiComm, \
   kindPeriodicComm1, kindPeriodicComm2, geometry, config, varBegin, \
-  varEnd, field, gradient, fieldMin, fieldMax, limiter)
+  varEnd, field, gradient, fieldMin, fieldMax, limiter, deferComms, minMaxReady, pointMask)
+
+#define INSTANTIATE(KIND) \
+if (geometry.GetnDim() == 2) INSTANTIATE_NDIM(2, KIND); \
+else INSTANTIATE_NDIM(3, KIND)
 
   switch (LimiterKind) {
     case NO_LIMITER:
@@ -96,4 +106,5 @@ computeLimiters_impl<FieldType, GradientType, KIND>(solver, kindMpiComm, \
     }
   }
 #undef INSTANTIATE
+#undef INSTANTIATE_NDIM
 }
@@ -50,16 +50,22 @@
  * \param[in] varEnd - End of computation range (nVar = end-begin).
  * \param[in] field - Variable field.
  * \param[in] gradient - Gradient of the field.
- * \param[out] fieldMin - Minimum field values over direct neighbors of each point.
- * \param[out] fieldMax - As above but maximum values.
+ * \param[in,out] fieldMin - Minimum field values over direct neighbors of each point.
+ * \param[in,out] fieldMax - As above but maximum values.
  * \param[out] limiter - Reconstruction limiter for the field.
+ * \param[in] deferComms - Only initiate the MPI communication, see CSolver::SetPendingComms.
+ * \param[in] minMaxReady - The min/max values were computed with the gradient (no periodicity),
+ *            the loop over neighbors then only projects the gradient.
+ * \param[in] pointMask - Optional, only the limiters of the points set in the mask are computed,
+ *            the others keep their values (see LIMITER_FREEZE).
  *
  * Template parameters:
+ * \param nDim - Number of dimensions, known at compile time such that the loops over dimensions are unrolled.
  * \param FieldType - Generic object with operator (iPoint,iVar)
  * \param GradientType - Generic object with operator (iPoint,iVar,iDim)
  * \param LimiterKind - Used to instantiate the right details class.
  */
-template<class FieldType, class GradientType, ENUM_LIMITER LimiterKind>
+template<size_t nDim, class FieldType, class GradientType, ENUM_LIMITER LimiterKind>
 void computeLimiters_impl(CSolver* solver,
                           MPI_QUANTITIES kindMpiComm,
                           PERIODIC_QUANTITIES kindPeriodicComm1,
@@ -72,9 +78,11 @@ void computeLimiters_impl(CSolver* solver,
                           const GradientType& gradient,
                           FieldType& fieldMin,
                           FieldType& fieldMax,
-                          FieldType& limiter)
+                          FieldType& limiter,
+                          bool deferComms,
+                          bool minMaxReady,
+                          const su2vector<bool>* pointMask)
 {
-  constexpr size_t MAXNDIM = 3;
   constexpr size_t MAXNVAR = 8;
 
   if (varEnd > MAXNVAR)
@@ -82,7 +90,6 @@ void computeLimiters_impl(CSolver* solver,
 
   size_t nPointDomain = geometry.GetnPointDomain();
   size_t nPoint = geometry.GetnPoint();
-  size_t nDim = geometry.GetnDim();
 
   /*--- If we do not have periodicity we can use a
    *    more efficient access pattern to memory. ---*/
@@ -91,6 +98,9 @@ void computeLimiters_impl(CSolver* solver,
                   (kindPeriodicComm1 != PERIODIC_NONE) &&
                   (config.GetnMarker_Periodic() > 0);
 
+  if (minMaxReady && periodic)
+    SU2_MPI::Error("The min/max values must include the periodic corrections.", CURRENT_FUNCTION);
+
 #ifdef HAVE_OMP
   constexpr size_t OMP_MAX_CHUNK = 512;
 
@@ -138,6 +148,8 @@ void computeLimiters_impl(CSolver* solver,
   SU2_OMP_FOR_DYN(chunkSize)
   for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
   {
+    if ((pointMask != nullptr) && !(*pointMask)(iPoint)) continue;
+
     auto node = geometry.node[iPoint];
     const su2double* coord_i = node->GetCoord();
 
@@ -148,7 +160,7 @@ void computeLimiters_impl(CSolver* solver,
     {
       AD::SetPreaccIn(field(iPoint,iVar));
 
-      if (periodic) {
+      if (periodic || minMaxReady) {
         /*--- Started outside loop, so counts as input. ---*/
         AD::SetPreaccIn(fieldMax(iPoint,iVar));
         AD::SetPreaccIn(fieldMin(iPoint,iVar));
@@ -181,7 +193,7 @@ void computeLimiters_impl(CSolver* solver,
 
       /*--- Distance vector from iPoint to face (middle of the edge). ---*/
 
-      su2double dist_ij[MAXNDIM] = {0.0};
+      su2double dist_ij[nDim];
 
       for(size_t iDim = 0; iDim < nDim; ++iDim)
         dist_ij[iDim] = 0.5 * (coord_j[iDim] - coord_i[iDim]);
@@ -198,6 +210,8 @@ void computeLimiters_impl(CSolver* solver,
         projMax[iVar] = max(projMax[iVar], proj);
         projMin[iVar] = min(projMin[iVar], proj);
 
+        if (minMaxReady) continue;
+
         AD::SetPreaccIn(field(jPoint,iVar));
 
         fieldMax(iPoint,iVar) = max(fieldMax(iPoint,iVar), field(jPoint,iVar));
@@ -244,7 +258,8 @@ void computeLimiters_impl(CSolver* solver,
     /*--- Obtain the limiters at halo points from the MPI ranks that own them. ---*/
 
     solver->InitiateComms(&geometry, &config, kindMpiComm);
-    solver->CompleteComms(&geometry, &config, kindMpiComm);
+    if (deferComms) solver->SetPendingComms(kindMpiComm);
+    else solver->CompleteComms(&geometry, &config, kindMpiComm);
   }
   SU2_OMP_BARRIER
 
@@ -34,6 +34,7 @@
 #include <cstdlib>
 
 #include "../../../Common/include/CConfig.hpp"
+#include "../../../Common/include/toolboxes/C2DContainer.hpp"
 
 using namespace std;
 
@@ -182,6 +183,10 @@ protected:
   su2double
   *Coord_i,      /*!< \brief Cartesians coordinates of point i. */
   *Coord_j;      /*!< \brief Cartesians coordinates of point j. */
+  const su2double
+  *EdgeGeometry = nullptr; /*!< \brief Stored geometric factors of the edge (see CGeometry::GetEdgeGeometry), if available. */
+  const su2double
+  *GridFlux = nullptr;     /*!< \brief Stored projected grid velocity of the edge (see CGeometry::GetEdgeGridFlux), if available. */
   unsigned short
   Neighbor_i,  /*!< \brief Number of neighbors of the point i. */
   Neighbor_j;  /*!< \brief Number of neighbors of the point j. */
@@ -220,6 +225,38 @@ protected:
   su2double **A_ij, **newA_ij, **Eig_Vec, **New_Eig_Vec, **Corners;
   su2double *Eig_Val, *Barycentric_Coord, *New_Coord;
 
+public:
+  enum : size_t { MAXNVAR = 8 }; /*!< \brief Maximum number of variables of the fixed size residuals. */
+
+  /*!
+   * \brief Fixed size, contiguous, storage of the flux and of the Jacobians of a numerics object,
+   * used by the solvers to update the residual and the linear system without the row indirection.
+   * \note The leading nVar (x nVar) entries are valid, the Jacobians are row-major with MAXNVAR columns.
+   */
+  using StaticVector = C2DContainer<unsigned long, su2double, StorageType::ColumnMajor, alignof(su2double), MAXNVAR, 1>;
+  using StaticMatrix = C2DContainer<unsigned long, su2double, StorageType::RowMajor, alignof(su2double), MAXNVAR, MAXNVAR>;
+
+  struct StaticResidualType {
+    StaticVector residual;
+    StaticMatrix jacobian_i;
+    StaticMatrix jacobian_j;
+  };
+
+protected:
+  StaticResidualType staticResidual;   /*!< \brief Fixed size storage of the flux and Jacobians. */
+  su2double* staticRows_i[MAXNVAR];    /*!< \brief Pointers to the rows of staticResidual.jacobian_i. */
+  su2double* staticRows_j[MAXNVAR];    /*!< \brief Pointers to the rows of staticResidual.jacobian_j. */
+  bool staticInPlace = false;          /*!< \brief The scheme computes its residual directly in staticResidual. */
+
+  /*!
+   * \brief Make the flux and Jacobians of a scheme point to the fixed size storage, this avoids
+   *        the copy in ComputeStaticResidual, the scheme must not delete them.
+   * \param[out] flux - Flux of the scheme.
+   * \param[out] jacobian_i - Jacobian w.r.t. point i of the scheme.
+   * \param[out] jacobian_j - Jacobian w.r.t. point j of the scheme.
+   */
+  void SetStaticResidualStorage(su2double*& flux, su2double**& jacobian_i, su2double**& jacobian_j);
+
 public:
   /*!
    * \brief Return type used in some "ComputeResidual" overloads to give a
@@ -566,6 +603,12 @@ public:
     Coord_j = val_coord_j;
   }
 
+  /*!
+   * \brief Set the stored geometric factors of the edge, consistent with the coordinates and normal.
+   * \param[in] val_edge_geometry - Factors of the edge, nullptr to compute them from the coordinates.
+   */
+  inline void SetEdgeGeometry(const su2double *val_edge_geometry) { EdgeGeometry = val_edge_geometry; }
+
   /*!
    * \brief Set the velocity of the computational grid.
    * \param[in] val_gridvel_i - Grid velocity of the point i.
@@ -574,6 +617,28 @@ public:
   inline void SetGridVel(su2double *val_gridvel_i, su2double *val_gridvel_j) {
     GridVel_i = val_gridvel_i;
     GridVel_j = val_gridvel_j;
+    GridFlux = nullptr;
+  }
+
+  /*!
+   * \brief Set the stored projected grid velocity of the edge, instead of the grid velocities of its points.
+   * \note Only for the numerics that use the grid velocity through GetProjGridVel.
+   * \param[in] val_gridflux - Average grid velocity of the points dotted with the normal.
+   */
+  inline void SetGridFlux(const su2double *val_gridflux) { GridFlux = val_gridflux; }
+
+  /*!
+   * \brief Get the projected grid velocity of the edge, stored or computed from the grid velocities of the points.
+   * \param[in] val_normal - Normal, or unit normal, of the dual face.
+   * \param[in] val_area - Area of the dual face when val_normal is the unit normal.
+   * \return Average grid velocity of the points dotted with val_normal.
+   */
+  inline su2double GetProjGridVel(const su2double *val_normal, su2double val_area = 1.0) const {
+    if (GridFlux) return *GridFlux / val_area;
+    su2double ProjGridVel = 0.0;
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      ProjGridVel += 0.5*(GridVel_i[iDim]+GridVel_j[iDim])*val_normal[iDim];
+    return ProjGridVel;
   }
 
   /*!
@@ -1053,6 +1118,63 @@ public:
    */
   inline virtual ResidualType<> ComputeResidual(const CConfig* config) { return ResidualType<>(nullptr,nullptr,nullptr); }
 
+  /*!
+   * \brief Wrapper of ComputeResidual(const CConfig*) used by the solvers. When the tape is
+   *        recording, the kernel is preaccumulated if it registers its inputs (SetPreaccInputs),
+   *        and the statements it records are accounted for in the tape report.
+   * \param[in] config - Definition of the particular problem.
+   * \return A lightweight const-view (read-only) of the residual/flux and Jacobians.
+   */
+  inline ResidualType<> ComputeResidualPreacc(const CConfig* config) {
+#ifdef CODI_REVERSE_TYPE
+    if (AD::TapeActive()) return RecordResidual(config);
+#endif
+    return ComputeResidual(config);
+  }
+
+  /*!
+   * \brief Compute the residual (see ComputeResidualPreacc) and return it in the fixed size storage.
+   *        Schemes that do not use that storage directly (SetStaticResidualStorage) have it copied.
+   * \param[in] config - Definition of the particular problem.
+   * \return Const reference to the flux and Jacobians, valid until the next call.
+   */
+  const StaticResidualType& ComputeStaticResidual(const CConfig* config);
+
+  /*!
+   * \brief Register the inputs of ComputeResidual(const CConfig*) for its preaccumulation,
+   *        i.e. all active values it reads that are computed outside of it.
+   * \note Kernels that do not override this (e.g. those that preaccumulate internally) are recorded as is.
+   * \return True if the kernel registered its inputs.
+   */
+  inline virtual bool SetPreaccInputs() { return false; }
+
+  /*!
+   * \brief Register outputs of ComputeResidual(const CConfig*) other than the residual,
+   *        i.e. values kept by the numerics that the solvers retrieve afterwards.
+   */
+  inline virtual void SetPreaccOutputs() { }
+
+  /*!
+   * \brief Clear the tape report (number of calls and statements recorded by each kernel).
+   */
+  static void ResetTapeReport();
+
+  /*!
+   * \brief Print the tape report of this rank.
+   */
+  static void PrintTapeReport();
+
+private:
+#ifdef CODI_REVERSE_TYPE
+  /*!
+   * \brief Recording of ComputeResidual(const CConfig*), see ComputeResidualPreacc.
+   * \param[in] config - Definition of the particular problem.
+   */
+  ResidualType<> RecordResidual(const CConfig* config);
+#endif
+
+public:
+
   /*!
    * \overload
    * \param[out] val_residual_i - Pointer to the total residual at point i.
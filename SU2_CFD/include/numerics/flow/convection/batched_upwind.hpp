@@ -0,0 +1,152 @@
+/*!
+ * \file batched_upwind.hpp
+ * \brief Declaration of the edge-batched upwind numerics classes, implemented in batched_upwind.cpp.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../../../../Common/include/CConfig.hpp"
+
+/*!
+ * \struct CUpwindEdgeBatch
+ * \brief Inputs and outputs of the upwind fluxes of a batch of edges, in "structure of arrays" layout
+ *        (the last index is the edge in the batch) such that the kernels vectorize across edges.
+ * \note The edges of a batch must be of the same color (or the fluxes must be stored per edge),
+ *       the lanes past nEdge must hold valid states (e.g. copies of the last edge).
+ * \ingroup ConvDiscr
+ */
+struct CUpwindEdgeBatch {
+  enum : size_t {SIZE = 8};           /*!< \brief Number of edges per batch (a multiple of the SIMD width). */
+  enum : size_t {MAXNDIM = 3};        /*!< \brief Max number of space dimensions. */
+  enum : size_t {MAXNVAR = MAXNDIM+2};/*!< \brief Max number of conservative variables. */
+  enum : size_t {MAXNPRIM = MAXNDIM+4};/*!< \brief Number of primitives used (T, velocity, p, rho, h). */
+
+  unsigned long nEdge = 0;            /*!< \brief Number of valid edges in the batch. */
+
+  su2double Normal[MAXNDIM][SIZE];    /*!< \brief Area-weighted normals of the edges. */
+  su2double V_i[MAXNPRIM][SIZE];      /*!< \brief Primitive variables at the first point of the edges. */
+  su2double V_j[MAXNPRIM][SIZE];      /*!< \brief Primitive variables at the second point of the edges. */
+
+  su2double Flux[MAXNVAR][SIZE];                /*!< \brief Fluxes from i to j. */
+  su2double Jacobian_i[MAXNVAR][MAXNVAR][SIZE]; /*!< \brief Jacobians of the fluxes w.r.t. the conservatives at i. */
+  su2double Jacobian_j[MAXNVAR][MAXNVAR][SIZE]; /*!< \brief Jacobians of the fluxes w.r.t. the conservatives at j. */
+};
+
+/*!
+ * \class CUpwindBatchNumerics
+ * \brief Interface of the upwind schemes that compute the fluxes of a batch of edges at a time.
+ * \note Only for ideal gas and static grids (no low dissipation, low Mach, or preconditioning
+ *       options), the solver falls back to the edge-by-edge numerics otherwise (see CreateNumerics).
+ *       The objects are stateless, one object can be used by all threads.
+ * \ingroup ConvDiscr
+ */
+class CUpwindBatchNumerics {
+public:
+  /*!
+   * \brief Destructor of the class.
+   */
+  virtual ~CUpwindBatchNumerics(void) = default;
+
+  /*!
+   * \brief Compute the fluxes (and their Jacobians if implicit) of a batch of edges.
+   * \param[in,out] batch - Inputs and outputs of the computation.
+   */
+  virtual void ComputeResidual(CUpwindEdgeBatch& batch) const = 0;
+
+  /*!
+   * \brief Create the batched version of the upwind scheme of the flow solver.
+   * \param[in] nDim - Number of dimensions of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \return Batched numerics, or nullptr if the scheme or the options are not supported.
+   */
+  static CUpwindBatchNumerics* CreateNumerics(unsigned short nDim, const CConfig* config);
+};
+
+/*!
+ * \class CUpwRoeBatch_Flow
+ * \brief Roe's scheme (with Mavriplis' entropy fix), equivalent to CUpwRoe_Flow, for batches of edges.
+ * \note The dissipation matrix |A| = P |Lambda| P^-1 is formed from the acoustic eigenvectors only,
+ *       |A| = |lambda_u| I + sum_{+,-} (|lambda_{+,-}| - |lambda_u|) r_{+,-} l_{+,-}^T.
+ * \ingroup ConvDiscr
+ */
+template<unsigned short NDIM>
+class CUpwRoeBatch_Flow final : public CUpwindBatchNumerics {
+private:
+  su2double gamma;       /*!< \brief Ratio of specific heats. */
+  su2double kappa;       /*!< \brief Blending of the central and upwind fluxes (ROE_KAPPA). */
+  su2double entropyFix;  /*!< \brief Entropy fix coefficient. */
+  bool implicit;         /*!< \brief Whether to compute the Jacobians. */
+
+  /*!
+   * \brief Implementation of ComputeResidual, with or without Jacobians.
+   */
+  template<bool Implicit>
+  void ComputeBatch(CUpwindEdgeBatch& batch) const;
+
+public:
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] config - Definition of the particular problem.
+   */
+  CUpwRoeBatch_Flow(const CConfig* config);
+
+  /*!
+   * \brief Compute the Roe fluxes of a batch of edges.
+   * \param[in,out] batch - Inputs and outputs of the computation.
+   */
+  void ComputeResidual(CUpwindEdgeBatch& batch) const override;
+};
+
+/*!
+ * \class CUpwHLLCBatch_Flow
+ * \brief HLLC scheme, equivalent to CUpwHLLC_Flow (including its Jacobians), for batches of edges.
+ * \ingroup ConvDiscr
+ */
+template<unsigned short NDIM>
+class CUpwHLLCBatch_Flow final : public CUpwindBatchNumerics {
+private:
+  su2double gamma;       /*!< \brief Ratio of specific heats. */
+  su2double kappa;       /*!< \brief Scaling of the Jacobians (ROE_KAPPA). */
+  bool implicit;         /*!< \brief Whether to compute the Jacobians. */
+
+  /*!
+   * \brief Implementation of ComputeResidual, with or without Jacobians.
+   */
+  template<bool Implicit>
+  void ComputeBatch(CUpwindEdgeBatch& batch) const;
+
+public:
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] config - Definition of the particular problem.
+   */
+  CUpwHLLCBatch_Flow(const CConfig* config);
+
+  /*!
+   * \brief Compute the HLLC fluxes of a batch of edges.
+   * \param[in,out] batch - Inputs and outputs of the computation.
+   */
+  void ComputeResidual(CUpwindEdgeBatch& batch) const override;
+};
@@ -72,6 +72,12 @@ public:
    */
   ~CUpwHLLC_Flow(void);
 
+  /*!
+   * \brief Register the inputs of the flux for preaccumulation.
+   * \return True, the flux is preaccumulated.
+   */
+  bool SetPreaccInputs() override;
+
   /*!
    * \brief Compute the Roe's flux between two nodes i and j.
    * \param[in] config - Definition of the particular problem.
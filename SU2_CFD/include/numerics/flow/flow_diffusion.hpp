@@ -81,6 +81,23 @@ protected:
    */
   void AddQCR(const su2double* const *val_gradprimvar);
 
+  /*!
+   * \brief Set the area, unit normal, edge vector and squared edge length, from the stored
+   *        geometric factors of the edge if they are available, otherwise from the coordinates.
+   */
+  void SetEdgeGeometricFactors();
+
+  /*!
+   * \brief Register the geometric inputs of the edge (stored factors or coordinates) for preaccumulation.
+   */
+  inline void SetPreaccEdgeGeometry() {
+    if (EdgeGeometry) {
+      AD::SetPreaccIn(EdgeGeometry, nDim+3);
+    } else {
+      AD::SetPreaccIn(Coord_i, nDim); AD::SetPreaccIn(Coord_j, nDim);
+    }
+  }
+
   /*!
    * \brief Scale the stress tensor using a predefined wall stress.
    *
@@ -28,6 +28,8 @@
 #pragma once
 
 #include "CNumerics.hpp"
+#include "turbulent/turb_convection.hpp"
+#include "turbulent/turb_diffusion.hpp"
 
 /*!
  * \class CUpwLin_TransLM
@@ -70,121 +72,68 @@ public:
 
 /*!
  * \class CUpwSca_TransLM
- * \brief Class for doing a scalar upwind solver for the Spalart-Allmaras turbulence model equations with transition.
+ * \brief Class for doing a scalar upwind solver for the Langtry-Menter transition model equations,
+ *        fed by the edge loop of CTurbSolver (primitive flow variables and TurbVar).
  * \ingroup ConvDiscr
  * \author A. Aranake.
  */
-class CUpwSca_TransLM : public CNumerics {
+class CUpwSca_TransLM final : public CUpwScalar {
 private:
-  su2double *Velocity_i, *Velocity_j;
-  bool implicit;
-  su2double q_ij, a0, a1;
-  unsigned short iDim;
-
-public:
-
   /*!
-   * \brief Constructor of the class.
-   * \param[in] val_nDim - Number of dimensions of the problem.
-   * \param[in] val_nVar - Number of variables of the problem.
-   * \param[in] config - Definition of the particular problem.
-   */
-  CUpwSca_TransLM(unsigned short val_nDim, unsigned short val_nVar, CConfig *config);
-
-  /*!
-   * \brief Destructor of the class.
+   * \brief Adds any extra variables to AD
    */
-  ~CUpwSca_TransLM(void);
+  void ExtraADPreaccIn() override;
 
   /*!
-   * \brief Compute the scalar upwind flux between two nodes i and j.
-   * \param[out] val_residual - Pointer to the total residual.
-   * \param[out] val_Jacobian_i - Jacobian of the numerical method at node i (implicit computation).
-   * \param[out] val_Jacobian_j - Jacobian of the numerical method at node j (implicit computation).
+   * \brief LM specific steps in the ComputeResidual method
    * \param[in] config - Definition of the particular problem.
    */
-  void ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j, CConfig *config);
-};
-
-/*!
- * \class CAvgGrad_TransLM
- * \brief Class for computing viscous term using average of gradients (Spalart-Allmaras Turbulence model).
- * \ingroup ViscDiscr
- * \author A. Bueno.
- */
-class CAvgGrad_TransLM : public CNumerics {
-private:
-  su2double **Mean_GradTransVar;
-  su2double *Proj_Mean_GradTransVar_Kappa, *Proj_Mean_GradTransVar_Edge;
-  su2double *Edge_Vector;
-  bool implicit, incompressible;
-  su2double sigma;
-  //su2double dist_ij_2;
-  //su2double proj_vector_ij;
-  //unsigned short iVar, iDim;
+  void FinishResidualCalc(const CConfig* config) override;
 
 public:
-
   /*!
    * \brief Constructor of the class.
    * \param[in] val_nDim - Number of dimensions of the problem.
    * \param[in] val_nVar - Number of variables of the problem.
    * \param[in] config - Definition of the particular problem.
    */
-  CAvgGrad_TransLM(unsigned short val_nDim, unsigned short val_nVar, CConfig *config);
+  CUpwSca_TransLM(unsigned short val_nDim, unsigned short val_nVar, const CConfig* config);
 
-  /*!
-   * \brief Destructor of the class.
-   */
-  ~CAvgGrad_TransLM(void);
-
-  /*!
-   * \brief Compute the viscous turbulence terms residual using an average of gradients.
-   * \param[out] val_residual - Pointer to the total residual.
-   * \param[out] Jacobian_i - Jacobian of the numerical method at node i (implicit computation).
-   * \param[out] Jacobian_j - Jacobian of the numerical method at node j (implicit computation).
-   * \param[in] config - Definition of the particular problem.
-   */
-  void ComputeResidual(su2double *val_residual, su2double **Jacobian_i, su2double **Jacobian_j, CConfig *config);
 };
 
 /*!
- * \class CAvgGradCorrected_TransLM
- * \brief Class for computing viscous term using average of gradients with correction (Spalart-Allmaras turbulence model).
+ * \class CAvgGrad_TransLM
+ * \brief Class for computing the viscous terms of the Langtry-Menter transition model
+ *        using average of gradients (with correction if required).
  * \ingroup ViscDiscr
  * \author A. Bueno.
  */
-class CAvgGradCorrected_TransLM : public CNumerics {
+class CAvgGrad_TransLM final : public CAvgGrad_Scalar {
 private:
-  su2double **Mean_GradTurbVar;
-  su2double *Proj_Mean_GradTurbVar_Kappa, *Proj_Mean_GradTurbVar_Edge, *Proj_Mean_GradTurbVar_Corrected;
-  su2double *Edge_Vector;
-  bool implicit, incompressible;
-  su2double sigma;
-
-public:
+  const su2double sigmaf = 1.0;       /*!< \brief Diffusion coefficient of the intermittency. */
+  const su2double sigma_thetat = 2.0; /*!< \brief Diffusion coefficient of the transition momentum thickness Reynolds number. */
 
   /*!
-   * \brief Constructor of the class.
-   * \param[in] val_nDim - Number of dimensions of the problem.
-   * \param[in] val_nVar - Number of variables of the problem.
-   * \param[in] config - Definition of the particular problem.
+   * \brief Adds any extra variables to AD
    */
-  CAvgGradCorrected_TransLM(unsigned short val_nDim, unsigned short val_nVar, CConfig *config);
+  void ExtraADPreaccIn(void) override;
 
   /*!
-   * \brief Destructor of the class.
+   * \brief LM specific steps in the ComputeResidual method
+   * \param[in] config - Definition of the particular problem.
    */
-  ~CAvgGradCorrected_TransLM(void);
+  void FinishResidualCalc(const CConfig* config) override;
 
+public:
   /*!
-   * \brief Compute the viscous turbulent residual using an average of gradients with correction.
-   * \param[out] val_residual - Pointer to the total residual.
-   * \param[out] Jacobian_i - Jacobian of the numerical method at node i (implicit computation).
-   * \param[out] Jacobian_j - Jacobian of the numerical method at node j (implicit computation).
+   * \brief Constructor of the class.
+   * \param[in] val_nDim - Number of dimensions of the problem.
+   * \param[in] val_nVar - Number of variables of the problem.
+   * \param[in] correct_grad - Whether to correct gradient for skewness.
    * \param[in] config - Definition of the particular problem.
    */
-  void ComputeResidual(su2double *val_residual, su2double **Jacobian_i, su2double **Jacobian_j, CConfig *config);
+  CAvgGrad_TransLM(unsigned short val_nDim, unsigned short val_nVar,
+                   bool correct_grad, const CConfig* config);
 };
 
 /*!
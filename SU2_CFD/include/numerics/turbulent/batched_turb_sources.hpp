@@ -0,0 +1,169 @@
+/*!
+ * \file batched_turb_sources.hpp
+ * \brief Declaration of the point-batched source terms of the turbulence models,
+ *        implemented in batched_turb_sources.cpp.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../../../Common/include/CConfig.hpp"
+
+/*!
+ * \struct CTurbSourceBatch
+ * \brief Inputs and outputs of the turbulence source terms of a batch of points, in "structure of arrays"
+ *        layout (the last index is the point in the batch) such that the kernels vectorize across points.
+ * \note The lanes past nPoint must hold valid states (e.g. copies of the last point).
+ * \ingroup SourceDiscr
+ */
+struct CTurbSourceBatch {
+  enum : size_t {SIZE = 8};           /*!< \brief Number of points per batch (a multiple of the SIMD width). */
+  enum : size_t {MAXNDIM = 3};        /*!< \brief Max number of space dimensions. */
+  enum : size_t {MAXNVAR = 2};        /*!< \brief Max number of turbulence variables. */
+
+  unsigned long nPoint = 0;           /*!< \brief Number of valid points in the batch. */
+
+  su2double Density[SIZE];            /*!< \brief Flow density. */
+  su2double LamVisc[SIZE];            /*!< \brief Laminar viscosity. */
+  su2double EddyVisc[SIZE];           /*!< \brief Eddy viscosity. */
+  su2double Pressure[SIZE];           /*!< \brief Static pressure. */
+  su2double Vorticity[3][SIZE];       /*!< \brief Vorticity vector (always 3 components). */
+  su2double StrainMag[SIZE];          /*!< \brief Magnitude of the rate of strain tensor. */
+  su2double VelGrad[MAXNDIM][MAXNDIM][SIZE]; /*!< \brief Velocity gradient (only used by SA_COMP and SST). */
+  su2double TurbVar[MAXNVAR][SIZE];   /*!< \brief Turbulence variables. */
+  su2double TurbVarGrad[MAXNDIM][SIZE];/*!< \brief Gradient of the first turbulence variable (only used by SA). */
+  su2double Volume[SIZE];             /*!< \brief Dual volume of the points. */
+  su2double Dist[SIZE];               /*!< \brief Wall distance (or DES length scale). */
+  su2double F1[SIZE];                 /*!< \brief Menter's first blending function (SST). */
+  su2double F2[SIZE];                 /*!< \brief Menter's second blending function (SST). */
+  su2double CDkw[SIZE];               /*!< \brief Cross diffusion (SST). */
+
+  su2double Residual[MAXNVAR][SIZE];           /*!< \brief Source terms. */
+  su2double Jacobian[MAXNVAR][MAXNVAR][SIZE];  /*!< \brief Jacobians of the source terms. */
+};
+
+/*!
+ * \class CTurbSourceBatchNumerics
+ * \brief Interface of the turbulence source terms that are computed for a batch of points at a time.
+ * \note The variant of the model is a template parameter of the implementations, the solver falls back
+ *       to the point-by-point numerics for the unsupported variants (see CreateNumerics).
+ *       The objects are stateless, one object can be used by all threads.
+ * \ingroup SourceDiscr
+ */
+class CTurbSourceBatchNumerics {
+public:
+  /*!
+   * \brief Destructor of the class.
+   */
+  virtual ~CTurbSourceBatchNumerics(void) = default;
+
+  /*!
+   * \brief Compute the source terms, and their Jacobians, of a batch of points.
+   * \param[in,out] batch - Inputs and outputs of the computation.
+   */
+  virtual void ComputeResidual(CTurbSourceBatch& batch) const = 0;
+
+  /*!
+   * \brief Whether the kernel uses the velocity gradient, to skip gathering it otherwise.
+   */
+  virtual bool NeedsVelocityGradient(void) const { return false; }
+
+  /*!
+   * \brief Create the batched version of the source terms of the turbulence model.
+   * \param[in] nDim - Number of dimensions of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] constants - Closure constants of the model (SST only).
+   * \param[in] kine_Inf - Free stream turbulence kinetic energy (SST only).
+   * \param[in] omega_Inf - Free stream specific dissipation (SST only).
+   * \return Batched numerics, or nullptr if the model or the options are not supported.
+   */
+  static CTurbSourceBatchNumerics* CreateNumerics(unsigned short nDim, const CConfig* config,
+                                                  const su2double* constants = nullptr,
+                                                  su2double kine_Inf = 0.0, su2double omega_Inf = 0.0);
+};
+
+/*!
+ * \class CSourceBatch_TurbSA
+ * \brief Source terms of the SA, SA_NEG, and SA_COMP models, equivalent to CSourcePieceWise_TurbSA,
+ *        CSourcePieceWise_TurbSA_Neg, and CSourcePieceWise_TurbSA_COMP, for batches of points.
+ * \ingroup SourceDiscr
+ */
+template<unsigned short NDIM, unsigned short MODEL>
+class CSourceBatch_TurbSA final : public CTurbSourceBatchNumerics {
+private:
+  su2double cv1_3, k2, cb1, cw2, ct3, cw3_6, cb2_sigma, cw1; /*!< \brief Closure constants. */
+  su2double gamma;       /*!< \brief Ratio of specific heats (compressibility correction). */
+  bool rotating_frame;   /*!< \brief Rotational correction of the vorticity. */
+
+public:
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] config - Definition of the particular problem.
+   */
+  CSourceBatch_TurbSA(const CConfig* config);
+
+  /*!
+   * \brief Compute the source terms of a batch of points.
+   * \param[in,out] batch - Inputs and outputs of the computation.
+   */
+  void ComputeResidual(CTurbSourceBatch& batch) const override;
+
+  /*!
+   * \brief Only the compressibility correction uses the velocity gradient.
+   */
+  bool NeedsVelocityGradient(void) const override { return MODEL == SA_COMP; }
+};
+
+/*!
+ * \class CSourceBatch_TurbSST
+ * \brief Source terms of the SST and SST_SUST models, equivalent to CSourcePieceWise_TurbSST
+ *        (without uncertainty quantification), for batches of points.
+ * \ingroup SourceDiscr
+ */
+template<unsigned short NDIM, unsigned short MODEL>
+class CSourceBatch_TurbSST final : public CTurbSourceBatchNumerics {
+private:
+  su2double beta_star, beta_1, beta_2, alfa_1, alfa_2, a1; /*!< \brief Closure constants. */
+  su2double kAmb, omegaAmb;  /*!< \brief Ambient values of k and omega (sustaining terms). */
+
+public:
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] constants - Closure constants of the model.
+   * \param[in] kine_Inf - Free stream turbulence kinetic energy.
+   * \param[in] omega_Inf - Free stream specific dissipation.
+   */
+  CSourceBatch_TurbSST(const su2double* constants, su2double kine_Inf, su2double omega_Inf);
+
+  /*!
+   * \brief Compute the source terms of a batch of points.
+   * \param[in,out] batch - Inputs and outputs of the computation.
+   */
+  void ComputeResidual(CTurbSourceBatch& batch) const override;
+
+  /*!
+   * \brief The divergence of the velocity is part of the production terms.
+   */
+  bool NeedsVelocityGradient(void) const override { return true; }
+};
@@ -114,6 +114,17 @@ public:
    * \brief  ______________.
    */
   inline su2double GetCrossProduction(void) const final { return CrossProduction; }
+
+  /*!
+   * \brief Register the inputs of the source terms (those of all the variants) for preaccumulation.
+   * \return True, the source terms are preaccumulated.
+   */
+  bool SetPreaccInputs() final;
+
+  /*!
+   * \brief The intermittency of the BC transition model is retrieved by the solver.
+   */
+  inline void SetPreaccOutputs() final { AD::SetPreaccOut(gamma_BC); }
 };
 
 
@@ -35,6 +35,9 @@
 #include <iomanip>
 #include <limits>
 #include <vector>
+#include <thread>
+#include <atomic>
+#include <csignal>
 
 #include "../../../Common/include/toolboxes/printing_toolbox.hpp"
 #include "tools/CWindowingTools.hpp"
@@ -43,7 +46,10 @@
 class CGeometry;
 class CSolver;
 class CFileWriter;
+class CADIOS2StreamWriter;
+class CSurfaceSamplingWriter;
 class CParallelDataSorter;
+class CProbeOutput;
 class CConfig;
 
 using namespace std;
@@ -80,6 +86,25 @@ protected:
   string historyFilename;   /*!< \brief The history filename*/
   char char_histfile[200];  /*! \brief Temporary variable to store the history filename */
   ofstream histFile;        /*! \brief Output file stream for the history */
+  bool historyBinary;               /*!< \brief Boolean to store whether the history file is written in binary format */
+  unsigned long historyFlushFreq;   /*!< \brief Number of history file writes between flushes of the file */
+  unsigned long nHistoryWrites;     /*!< \brief Number of history file writes so far */
+  vector<passivedouble> historyBuffer; /*!< \brief Values of the binary history lines that were not written yet */
+
+  static unsigned long continuationIter; /*!< \brief Time iteration the run continues from in memory (0 if it does not) */
+
+  /*--- Restart checkpoints before the walltime limit and on SIGUSR1/SIGTERM (see WALLTIME_CHECKPOINT),
+   *    the deadline and the signals are common to all the outputs, each output writes its own restart. ---*/
+
+  static int checkpointActive;                          /*!< \brief Whether checkpoints are enabled (-1 before the first call) */
+  static passivedouble checkpointDeadline;              /*!< \brief Time of the walltime limit minus the margin, since the start (master only, 0 if none) */
+  static volatile std::sig_atomic_t checkpointSignals;  /*!< \brief Number of checkpoint signals received */
+  static volatile std::sig_atomic_t terminateSignal;    /*!< \brief Whether SIGTERM was received */
+  std::sig_atomic_t signalsHandled = 0;                 /*!< \brief Number of signals this output has written a checkpoint for */
+  bool wallTimeCheckpointDone = false;                  /*!< \brief Whether this output wrote the checkpoint before the walltime limit */
+  passivedouble lastResultTime = -1.0;                  /*!< \brief Time of the previous call to SetResult_Files */
+  passivedouble iterTimeSum = 0.0;                      /*!< \brief Sum of the times between calls to SetResult_Files */
+  unsigned long nIterTime = 0;                          /*!< \brief Number of times in iterTimeSum */
 
   /** \brief Enum to identify the screen output format. */
   enum class ScreenOutputFormat {
@@ -134,6 +159,11 @@ protected:
   /*! \brief Vector that contains the keys of the ::historyOutputPerSurface_Map in the order of their insertion. */
   std::vector<string>                           historyOutputPerSurface_List;
 
+  /*! \brief Fields of the history file in the order of its columns, resolved once from the requested history groups. */
+  std::vector<const HistoryOutputField*>        historyFileFields;
+  /*! \brief Fields of the screen output in the order of its columns, resolved once from the requested screen fields. */
+  std::vector<const HistoryOutputField*>        screenOutputFields;
+
   /*! \brief Requested history field names in the config file. */
   std::vector<string> requestedHistoryFields;
   /*! \brief Number of requested history field names in the config file. */
@@ -163,11 +193,32 @@ protected:
 
    vector<string> volumeFieldNames;     //!< Vector containing the volume field names
    unsigned short nVolumeFields;        /*!< \brief Number of fields in the volume output */
+   vector<passivedouble> restartErrorBound; //!< Error bound of each volume field for the lossy compression of the restart files
+   vector<unsigned short> surfaceSamplingFields; //!< Volume fields streamed to the surface sampling file
 
    string volumeFilename,               //!< Volume output filename
    surfaceFilename,                     //!< Surface output filename
    restartFilename;                     //!< Restart output filename
 
+   /*--- Asynchronous output, the data is copied in the sorter and a helper thread sorts and writes it,
+    *    using a duplicate of MPI_COMM_WORLD since the solver keeps communicating on the main thread. ---*/
+
+   bool asyncOutput;                    //!< Whether the volume files are written asynchronously
+   std::thread asyncWriter;             //!< Helper thread that sorts and writes the volume files
+   std::atomic<bool> asyncDone;         //!< Whether the helper thread has finished writing
+   SU2_MPI::Comm asyncComm;             //!< Communicator of the data sorters and writers for asynchronous output
+   stringstream asyncFileTable;         //!< Buffer for the file writing table, printed by the main thread
+   su2double asyncBandwidth;            //!< Restart bandwidth of the asynchronous writes, added to the config once done
+
+   CADIOS2StreamWriter* volumeStream;   //!< In-situ stream of the volume data, open until the end of the run
+   CADIOS2StreamWriter* surfaceStream;  //!< In-situ stream of the surface data, open until the end of the run
+
+   CProbeOutput* probeOutput;           //!< Output of the volume fields at probes and in boxes, located at the first write
+   CSurfaceSamplingWriter* surfaceSampling; //!< Time series of some volume fields on some markers, open until the end of the run
+
+   unsigned long writeTimeIter;         //!< Time iteration of the data loaded in the sorters (for file names)
+   su2double writeTimeStep;             //!< Time step of the data loaded in the sorters (for file headers)
+
   /** \brief Structure to store information for a volume output field.
    *
    *  The stored information is used to create the volume solution file.
@@ -200,6 +251,12 @@ protected:
   unsigned short                                cachePosition;
   /*! \brief Boolean to store whether the field index cache should be build. */
   bool                                          buildFieldIndexCache;
+  /*! \brief Whether the time averaged volume fields are updated by the current load of the data. */
+  bool                                          sampleTimeAverages = false;
+  /*! \brief Number of samples of the time averaged volume fields. */
+  unsigned long                                 nTimeAverageSamples = 0;
+  /*! \brief Time iteration of the last sample of the time averaged volume fields. */
+  unsigned long                                 lastTimeAverageIter = std::numeric_limits<unsigned long>::max();
   /*! \brief Vector to cache the positions of the field in the data array */
   std::vector<short>                            fieldGetIndexCache;
   /*! \brief Current value of the cache index */
@@ -251,6 +308,13 @@ public:
    */
   COutput(CConfig *config, unsigned short nDim, bool femOutput);
 
+  /*!
+   * \brief Set the time iteration from which the next outputs continue a run in memory (e.g. after the grid
+   *        was repartitioned), the iteration is appended to the history filename as for a restart.
+   * \param[in] iter - Time iteration, 0 if the run starts from the beginning or from a restart.
+   */
+  static void SetContinuationIter(unsigned long iter) { continuationIter = iter; }
+
   /*!
    * \brief Preprocess the volume output by setting the requested volume output fields.
    * \param[in] config - Definition of the particular problem.
@@ -482,6 +546,53 @@ protected:
 
   /*----------------------------- Protected member functions ----------------------------*/
 
+  /*!
+   * \brief Sort the data loaded in the sorters and write all requested volume output files.
+   * \note Runs on the helper thread for asynchronous output, it must only access the sorters.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] restartOnly - Only the restart files (checkpoints), binary if no restart format is requested.
+   */
+  void WriteVolumeFiles(CConfig *config, CGeometry *geometry, bool restartOnly = false);
+
+  /*!
+   * \brief Set the walltime deadline (from WALLTIME_LIMIT or the SLURM_JOB_END_TIME of the scheduler) and
+   *        the signal handlers of the checkpoints, once for all the outputs.
+   * \param[in] config - Definition of the particular problem.
+   */
+  static void InitCheckpoints(const CConfig *config);
+
+  /*!
+   * \brief Handler of SIGUSR1 and SIGTERM, it only counts the signals, the restart is written by SetResult_Files.
+   * \param[in] signum - Number of the signal.
+   */
+  static void CheckpointSignalHandler(int signum);
+
+  /*!
+   * \brief Update the average time between calls to SetResult_Files and decide (collectively) whether a restart
+   *        must be written, i.e. the next iteration could end past the deadline, or a signal was received.
+   * \param[in] config - Definition of the particular problem.
+   * \param[out] terminate - Whether SIGTERM was received, the restart is then written before returning.
+   * \return <TRUE> if a checkpoint restart is due.
+   */
+  bool CheckpointDue(const CConfig *config, bool& terminate);
+
+  /*!
+   * \brief Wait for the asynchronous output to finish, then print its file writing table and store the bandwidth.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void CompleteAsyncOutput(CConfig *config);
+
+  /*!
+   * \brief Store the time iteration and time step of the data being loaded, the writers use these values
+   *        since the current ones may change while the data is written asynchronously.
+   */
+  void StoreWriteTimeInfo() {
+    writeTimeIter = curTimeIter;
+    const auto it = historyOutput_Map.find("TIME_STEP");
+    writeTimeStep = (it != historyOutput_Map.end())? it->second.value : su2double(0.0);
+  }
+
   /*!
    * \brief Set the history file header
    * \param[in] config - Definition of the particular problem.
@@ -494,6 +605,11 @@ protected:
    */
   void SetHistoryFile_Output(CConfig *config);
 
+  /*!
+   * \brief Write the buffered lines of the history file to disk.
+   */
+  void FlushHistoryFile();
+
   /*!
    * \brief Write the screen header.
    * \param[in] config - Definition of the particular problem.
@@ -528,9 +644,10 @@ protected:
    * \param[in] name - Name of the field.
    * \param[in] value - The new value of this field.
    */
-  inline void SetHistoryOutputValue(string name, su2double value){
-    if (historyOutput_Map.count(name) > 0){
-      historyOutput_Map[name].value = value;
+  inline void SetHistoryOutputValue(const string& name, su2double value){
+    const auto it = historyOutput_Map.find(name);
+    if (it != historyOutput_Map.end()){
+      it->second.value = value;
     } else {
       SU2_MPI::Error(string("Cannot find output field with name ") + name, CURRENT_FUNCTION);
     }
@@ -562,9 +679,10 @@ protected:
    * \param[in] value - The new value of this field.
    * \param[in] iMarker - The index of the marker.
    */
-  inline void SetHistoryOutputPerSurfaceValue(string name, su2double value, unsigned short iMarker){
-    if (historyOutputPerSurface_Map.count(name) > 0){
-      historyOutputPerSurface_Map[name][iMarker].value = value;
+  inline void SetHistoryOutputPerSurfaceValue(const string& name, su2double value, unsigned short iMarker){
+    const auto it = historyOutputPerSurface_Map.find(name);
+    if (it != historyOutputPerSurface_Map.end()){
+      it->second[iMarker].value = value;
     } else {
       SU2_MPI::Error(string("Cannot find output field with name ") + name, CURRENT_FUNCTION);
     }
@@ -604,6 +722,13 @@ protected:
    */
   void SetAvgVolumeOutputValue(string name, unsigned long iPoint, su2double value);
 
+  /*!
+   * \brief Whether the time averaged volume fields are due for a sample (once every
+   *        TIME_AVERAGE_FREQ time iterations), used to avoid loading the volume data otherwise.
+   * \param[in] config - Definition of the particular problem.
+   */
+  bool TimeAverageSampleDue(const CConfig *config) const;
+
   /*!
    * \brief CheckHistoryOutput
    */
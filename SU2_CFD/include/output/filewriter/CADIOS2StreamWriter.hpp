@@ -0,0 +1,89 @@
+/*!
+ * \file CADIOS2StreamWriter.hpp
+ * \brief Headers for the ADIOS2 (in-situ / staging) stream writer class.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include "CFileWriter.hpp"
+
+/*!
+ * \class CADIOS2StreamWriter
+ * \brief Hands the sorted data to an ADIOS2 stream, one ADIOS2 step per output, for in-situ processing
+ *        (e.g. the SST engine read by a ParaView/Python consumer) or staging to BP files.
+ * \details Unlike the file writers the stream stays open between outputs, hence the writer is owned by the
+ *          output class. The variables are put directly from the buffers of the data sorter (no copy):
+ *          "Fields" is the (points x fields) array of the sorted data, named by the attribute "FieldNames",
+ *          "Time" and "TimeIter" are global values, and "Connectivity/<element type>" (1-based point IDs,
+ *          constant mesh topology) is only put in the first step.
+ */
+class CADIOS2StreamWriter final: public CFileWriter{
+
+  struct CStream;                //!< ADIOS2 objects of the stream, defined in the source file
+  CStream* stream = nullptr;     //!< Stream, opened by the first write
+
+  string engineType;             //!< Engine used if the IO is not set in the configuration file
+  string configFile;             //!< ADIOS2 XML configuration file (may be empty)
+  unsigned long timeIter = 0;    //!< Current value of the time iteration
+  su2double timeStep = 0.0;      //!< Current value of the time step
+  unsigned long nStep = 0;       //!< Number of steps written to the stream
+
+public:
+
+  /*!
+   * \brief File extension
+   */
+  const static string fileExt;
+
+  /*!
+   * \brief Construct a stream writer using the data sorter.
+   * \param[in] valFileName - The name of the stream (also the name of its IO in the configuration file)
+   * \param[in] valDataSorter - The parallel sorted data to write
+   * \param[in] valEngine - The ADIOS2 engine type
+   * \param[in] valConfigFile - The ADIOS2 XML configuration file, empty for none
+   */
+  CADIOS2StreamWriter(string valFileName, CParallelDataSorter* valDataSorter,
+                      string valEngine, string valConfigFile);
+
+  /*!
+   * \brief Destructor, closes the stream.
+   */
+  ~CADIOS2StreamWriter() override;
+
+  /*!
+   * \brief Set the time of the next step.
+   * \param[in] valTimeIter - The current time iteration
+   * \param[in] valTimeStep - The current physical time step value
+   */
+  void SetTime(unsigned long valTimeIter, su2double valTimeStep) {
+    timeIter = valTimeIter;
+    timeStep = valTimeStep;
+  }
+
+  /*!
+   * \brief Write the sorted data as the next step of the stream.
+   */
+  void Write_Data() override;
+
+};
@@ -35,6 +35,7 @@ class CFVMDataSorter final: public CParallelDataSorter{
 private:
 
   int* Local_Halo; //!< Array containing the flag whether a point is a halo node
+  bool connSortedByRank; //!< Whether the stored connectivity was loaded by owning rank (val_sort = false)
 
 public:
 
@@ -83,6 +83,11 @@ protected:
    * \brief The parallel data sorter
    */
   CParallelDataSorter* dataSorter;
+
+  /*!
+   * \brief The communicator used for writing, the one of the data sorter if there is one.
+   */
+  SU2_MPI::Comm comm;
   
 #ifdef HAVE_MPI
   /*!
@@ -0,0 +1,99 @@
+/*!
+ * \file CHDF5FileWriter.hpp
+ * \brief Headers for the parallel HDF5/XDMF file writer class.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include "CFileWriter.hpp"
+
+/*!
+ * \class CHDF5FileWriter
+ * \brief Writes the sorted data as a time series into one HDF5 file, described for visualization by an XDMF file.
+ * \details The file holds the coordinates and the (mixed) topology in the group /Mesh, written once, and
+ *          the fields of every output in a group /Steps/<time iteration>. A file that already holds the same
+ *          mesh is appended to, a step that already exists is replaced. The datasets are written collectively
+ *          with parallel HDF5 (MPI-IO), or by one rank after the other if HDF5 was built without MPI support.
+ */
+class CHDF5FileWriter final: public CFileWriter{
+
+  unsigned long timeIter;      //!< Current value of the time iteration
+  su2double timeStep;          //!< Current value of the time step
+  bool dynamicGrid;            //!< Whether the coordinates are written with every step
+  unsigned short compression;  //!< Deflate level of the chunked datasets, 0 for contiguous uncompressed ones
+
+  /*!
+   * \brief Number of points in one chunk of the compressed datasets.
+   */
+  static constexpr unsigned long CHUNK_SIZE = 65536;
+
+public:
+
+  /*!
+   * \brief File extension
+   */
+  const static string fileExt;
+
+  /*!
+   * \brief File extension of the XDMF descriptor
+   */
+  const static string xdmfExt;
+
+  /*!
+   * \brief Construct a file writer using field names and the data sorter.
+   * \param[in] valFileName - The name of the file
+   * \param[in] valDataSorter - The parallel sorted data to write
+   * \param[in] valTimeIter - The current time iteration
+   * \param[in] valTimeStep - The current physical time step value
+   * \param[in] valDynamicGrid - Whether the grid moves or deforms, i.e. if each step has its coordinates
+   * \param[in] valCompression - Deflate level (0-9) of the datasets
+   */
+  CHDF5FileWriter(string valFileName, CParallelDataSorter* valDataSorter,
+                  unsigned long valTimeIter, su2double valTimeStep,
+                  bool valDynamicGrid, unsigned short valCompression);
+
+  /*!
+   * \brief Destructor
+   */
+  ~CHDF5FileWriter() override;
+
+  /*!
+   * \brief Write the mesh (if needed) and the current step to the HDF5 file and update the XDMF file.
+   */
+  void Write_Data() override;
+
+private:
+
+  /*!
+   * \brief Check (on one rank) whether the file exists and already holds the current mesh.
+   * \return <TRUE> if only the step has to be appended.
+   */
+  bool MeshIsStored() const;
+
+  /*!
+   * \brief Write the XDMF descriptor of all the steps stored in the HDF5 file (on one rank).
+   */
+  void WriteXDMF() const;
+
+};
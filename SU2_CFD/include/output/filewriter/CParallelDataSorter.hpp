@@ -93,12 +93,18 @@ protected:
   su2double     *doubleBuffer;         //!< Buffer holding the sorted, partitioned data as su2double types
   /// Pointer used to allocate the memory used for ::passiveDoubleBuffer and ::doubleBuffer.
   char *dataBuffer;
+  long long bufferBytes = 0;           //!< Size of ::connSend and ::dataBuffer, for the memory report
   unsigned long *idSend;               //!< Send buffer holding global indices that will be send to other processors
   int nSends,                          //!< Number of sends
   nRecvs;                              //!< Number of receives
 
   vector<string> fieldNames;           //!< Vector with names of the output fields
 
+  SU2_MPI::Comm comm;                  //!< Communicator used to sort the data (and by the writers of this data)
+  vector<su2double> connSnapshot;      //!< Copy of the unsorted data, sorted instead of ::connSend if not empty
+  vector<unsigned long> sortOrder;     //!< Position of each received point in the linear partition, built by the first sort
+  bool sortPlanStored;                 //!< Boolean to store information on whether ::sortOrder is up to date
+
   unsigned short nDim;                 //!< Spatial dimension of the data
 
   /*!
@@ -237,6 +243,13 @@ public:
    */
   unsigned long GetElem_Connectivity(GEO_TYPE type, unsigned long iElem, unsigned long iNode) const ;
 
+  /*!
+   * \brief Get the (1-based) connectivity of all the local elements of a type.
+   * \input type - The type of element, ref GEO_TYPE
+   * \return Pointer to the nodes of the elements, stored element after element.
+   */
+  const int* GetConnectivity(GEO_TYPE type) const;
+
   /*!
    * \brief Beginning node ID of the linear partition owned by a specific processor.
    * \input rank - the processor rank.
@@ -342,4 +355,22 @@ public:
    */
   void SetTotalElements();
 
+  /*!
+   * \brief Copy the unsorted data to a separate buffer, from then on SortOutputData operates on this copy,
+   *        which allows loading new data while the previous one is sorted (asynchronous output).
+   */
+  void SnapshotData();
+
+  /*!
+   * \brief Set the communicator used to sort the data, and by the file writers.
+   * \param[in] valComm - The communicator, it must have the same ranks as MPI_COMM_WORLD.
+   */
+  void SetComm(SU2_MPI::Comm valComm) { comm = valComm; }
+
+  /*!
+   * \brief Get the communicator used to sort the data.
+   * \return The communicator.
+   */
+  SU2_MPI::Comm GetComm() const { return comm; }
+
 };
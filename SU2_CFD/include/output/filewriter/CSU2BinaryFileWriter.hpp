@@ -28,8 +28,20 @@
 #pragma once
 #include "CFileWriter.hpp"
 
+/*!
+ * \class CSU2BinaryFileWriter
+ * \brief Writes the sorted data as an SU2 binary restart file, the data of each rank may be compressed
+ *        (see CompressionToolbox), in which case the file starts with SU2_COMPRESSED_RESTART_ID.
+ */
 class CSU2BinaryFileWriter final: public CFileWriter{
 
+  unsigned short compression;        //!< Kind of compression of the data (ENUM_RESTART_COMPRESSION)
+  vector<passivedouble> errorBound;  //!< Absolute error bound of each field for lossy compression (0 is lossless)
+
+  /*!
+   * \brief Deflate level of the compressed data, the shuffle does most of the work.
+   */
+  static constexpr int DEFLATE_LEVEL = 1;
 
 public:
 
@@ -42,8 +54,11 @@ public:
    * \brief Construct a file writer using field names and the data sorter.
    * \param[in] valFileName - The name of the file
    * \param[in] valDataSorter - The parallel sorted data to write
+   * \param[in] valCompression - Kind of compression of the data
+   * \param[in] valErrorBound - Absolute error bound of each field for lossy compression (empty or 0 is lossless)
    */
-  CSU2BinaryFileWriter(string valFileName, CParallelDataSorter* valDataSorter);
+  CSU2BinaryFileWriter(string valFileName, CParallelDataSorter* valDataSorter,
+                       unsigned short valCompression = NO_COMPRESSION, vector<passivedouble> valErrorBound = {});
 
   /*!
    * \brief Destructor
@@ -33,6 +33,9 @@ class CSurfaceFVMDataSorter final: public CParallelDataSorter{
 
   CFVMDataSorter* volumeSorter;                    //!< Pointer to the volume sorter instance
   map<unsigned long,unsigned long> Renumber2Global; //! Structure to map the local sorted point ID to the global point ID
+  vector<unsigned long> surfacePoints;             //!< Local point indices (of the volume sorter) of the surface points
+  vector<string> sortedMarkers;                    //!< Markers for which the connectivity is currently sorted
+  bool surfacePlanStored;                          //!< Whether the surface points and connectivity numbering are up to date
 public:
 
   /*!
@@ -0,0 +1,106 @@
+/*!
+ * \file CSurfaceSamplingWriter.hpp
+ * \brief Headers for the surface sampling writer class.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include "CFileWriter.hpp"
+
+class CConfig;
+class CGeometry;
+
+/*!
+ * \class CSurfaceSamplingWriter
+ * \brief Appends some volume output fields of the points of some markers to a single time series file,
+ *        e.g. the pressure and velocity on a permeable surface for FW-H acoustics.
+ * \details The points are the local domain points of the markers, each rank writes them in its own
+ *          contiguous block, in the order of the ranks. This layout is set once, hence the data is neither
+ *          sorted nor is a header or connectivity written per step. The file starts with the ints
+ *          [SU2_SURFACE_SAMPLING_ID nDim nField nPoint], the field names (33 characters), the global index
+ *          (unsigned long) and the coordinates of the points. Each step is [iteration time] followed by the
+ *          nField values of each point, all as doubles, and is written with one collective MPI-IO call.
+ * \note The writer stays open between the steps, it is owned by the output class, and it reads the unsorted
+ *       data of the volume data sorter (loaded by the output in the same iteration).
+ */
+class CSurfaceSamplingWriter final: public CFileWriter{
+
+  vector<unsigned long> points;    //!< Local domain points of the markers
+  vector<unsigned short> fields;   //!< Indices of the written fields in the data sorter
+  vector<unsigned long> globalIndex; //!< Global index of the points
+  vector<passivedouble> coords;    //!< Coordinates of the points
+  vector<passivedouble> buffer;    //!< Values of the current step
+
+  unsigned short nDim;             //!< Number of dimensions
+  unsigned long nPointGlobal;      //!< Number of points of all the ranks
+  unsigned long pointOffset;       //!< Number of points of the lower ranks
+  unsigned long nStep = 0;         //!< Number of steps written to the file
+  bool fileOpen = false;           //!< Whether the header has been written
+  unsigned long timeIter = 0;      //!< Current iteration
+  su2double time = 0.0;            //!< Current physical time
+
+  /*!
+   * \brief Write the header of the file, with the points and their coordinates.
+   */
+  void WriteHeader();
+
+public:
+
+  /*!
+   * \brief File extension
+   */
+  const static string fileExt;
+
+  /*!
+   * \brief Construct the writer and set the (constant) layout of the points.
+   * \param[in] valFileName - The name of the file (without extension)
+   * \param[in] valDataSorter - The volume data sorter, whose unsorted data is written
+   * \param[in] valFields - Indices of the written fields in the data sorter
+   * \param[in] geometry - Geometrical definition of the problem
+   * \param[in] config - Definition of the particular problem
+   */
+  CSurfaceSamplingWriter(string valFileName, CParallelDataSorter* valDataSorter, vector<unsigned short> valFields,
+                         CGeometry* geometry, CConfig* config);
+
+  /*!
+   * \brief Destructor, closes the file.
+   */
+  ~CSurfaceSamplingWriter() override;
+
+  /*!
+   * \brief Set the iteration and time of the next step.
+   * \param[in] valTimeIter - The current iteration
+   * \param[in] valTime - The current physical time
+   */
+  void SetTime(unsigned long valTimeIter, su2double valTime) {
+    timeIter = valTimeIter;
+    time = valTime;
+  }
+
+  /*!
+   * \brief Append the current values of the points as the next step of the file.
+   */
+  void Write_Data() override;
+
+};
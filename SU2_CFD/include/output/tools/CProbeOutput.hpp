@@ -0,0 +1,117 @@
+/*!
+ * \file CProbeOutput.hpp
+ * \brief Headers of the class for the output of the volume fields at probes and in boxes.
+ *        The implementations are in the <i>CProbeOutput.cpp</i> file.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../../../Common/include/mpi_structure.hpp"
+
+#include <vector>
+#include <string>
+#include <fstream>
+
+class CConfig;
+class CGeometry;
+class CParallelDataSorter;
+
+using namespace std;
+
+/*!
+ * \class CProbeOutput
+ * \brief Writes the volume output fields at a few locations, much more often than the volume files.
+ * \details The probes (OUTPUT_PROBES, and the regular grids of probes of OUTPUT_PROBE_PLANES) are located
+ *          once in the grid elements, their values are interpolated from the nodes of the containing element
+ *          and written by the master to one CSV file, one line per write. The boxes (OUTPUT_PROBE_BOXES)
+ *          write the values of the grid points inside them, one CSV file per box and write.
+ * \note Each node of the containing element is a domain point of exactly one rank, hence every rank only
+ *       interpolates its own (unsorted) data and the partial values of the probes are summed on the master.
+ */
+class CProbeOutput {
+
+  int rank, size;
+
+  string fileName;                         /*!< \brief Base name of the files. */
+  unsigned short nDim;                     /*!< \brief Number of dimensions of the problem. */
+  bool timeDomain;                         /*!< \brief Whether the physical time is written. */
+
+  unsigned long nProbe;                    /*!< \brief Number of probes located in the grid. */
+  vector<passivedouble> probeCoord;        /*!< \brief Coordinates of the located probes (nDim per probe). */
+  vector<unsigned long> probeNode;         /*!< \brief Probe of each local interpolation node. */
+  vector<unsigned long> probePoint;        /*!< \brief Local (domain) point of each interpolation node. */
+  vector<passivedouble> probeWeight;       /*!< \brief Interpolation weight of each interpolation node. */
+
+  vector<vector<unsigned long> > boxPoints; /*!< \brief Local (domain) points in each box. */
+
+  ofstream probeFile;                      /*!< \brief File of the probe values, open until the end of the run. */
+  vector<passivedouble> sendBuffer;        /*!< \brief Partial values of the probes, or values of the box points. */
+  vector<passivedouble> recvBuffer;        /*!< \brief Values received by the master. */
+
+  /*!
+   * \brief Locate the probes in the local elements and set the interpolation nodes.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] coord - Coordinates of the probes (nDim per probe).
+   */
+  void LocateProbes(CGeometry *geometry, const vector<su2double>& coord);
+
+  /*!
+   * \brief Write the interpolated values of the probes.
+   * \param[in] dataSorter - Sorter holding the (unsorted) volume output data.
+   * \param[in] iter - Current iteration.
+   * \param[in] time - Current physical time.
+   */
+  void WriteProbes(const CParallelDataSorter* dataSorter, unsigned long iter, su2double time);
+
+  /*!
+   * \brief Write the values of the grid points of the boxes.
+   * \param[in] dataSorter - Sorter holding the (unsorted) volume output data.
+   * \param[in] iter - Current iteration.
+   */
+  void WriteBoxes(const CParallelDataSorter* dataSorter, unsigned long iter);
+
+public:
+
+  /*!
+   * \brief Constructor of the class, locates the probes and boxes of the config in the grid.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   */
+  CProbeOutput(CConfig *config, CGeometry *geometry);
+
+  /*!
+   * \brief Get whether there is something to write.
+   */
+  inline bool HasOutput() const { return (nProbe > 0) || !boxPoints.empty(); }
+
+  /*!
+   * \brief Write the values of the probes and boxes (collective).
+   * \param[in] dataSorter - Sorter holding the (unsorted) volume output data, loaded for this iteration.
+   * \param[in] iter - Current iteration.
+   * \param[in] time - Current physical time.
+   */
+  void Write(const CParallelDataSorter* dataSorter, unsigned long iter, su2double time);
+
+};
@@ -68,6 +68,8 @@ class CWindowedAverage:CWindowingTools{
 private:
   su2double val;                  /*!< \brief Value of the windowed-time average (of the instantaneous output) from starting time to the current time iteration. */
   std::vector<su2double> values;  /*!< \brief Vector of instantatneous output values from starting time to the current time iteration.*/
+  su2double weightedSum;          /*!< \brief Sum of the weighted values (streaming updates). */
+  unsigned long nSamples;         /*!< \brief Number of values added by streaming updates. */
 
 public:
   CWindowedAverage();
@@ -97,6 +99,17 @@ public:
   */
   su2double WindowedUpdate(WINDOW_FUNCTION windowId);
 
+  /*! \brief Adds a value to the windowed-time average without storing it (constant memory). The window spans a
+   *         known number of samples, the average is the one of WindowedUpdate once all samples were added.
+   *         Without windowing (SQUARE) this is the running mean, and the number of samples is not needed.
+  * \param windowId - specified windowing-function
+  * \param valIn - value of the instantaneous output
+  * \param iSample - index of the sample in the window
+  * \param nSample - number of samples of the window
+  * \return windowed-time average of the values added so far
+  */
+  su2double StreamingUpdate(WINDOW_FUNCTION windowId, su2double valIn, unsigned long iSample, unsigned long nSample);
+
 private:
   /*! \brief Computes a Square-windowed-time average of the values stored in the vector "values" with the Midpoint-integration rule (for consistency with the adjoint solver).
   * \return  Squarewindowed-time average of the values stored in the vector "values"
@@ -28,6 +28,7 @@
 #pragma once
 
 #include "../../Common/include/mpi_structure.hpp"
+#include "../../Common/include/omp_structure.hpp"
 
 #include <iostream>
 #include <cmath>
@@ -218,6 +219,86 @@ public:
                                                  su2double &dMuTdx,
                                                  su2double &dMuTdy,
                                                  su2double &dMuTdz);
+
+  /*!
+   * \brief Virtual function to determine the eddy viscosity in a batch of
+            points for a 2D simulation. For the base class 0 is returned.
+   * \param[in]  nPoints    - Number of points in the batch.
+   * \param[in]  rho        - Densities of the points.
+   * \param[in]  velGrad    - Velocity gradients of the points, stored as dudx, dudy,
+                               dvdx, dvdy, each for all points consecutively.
+   * \param[in]  lenScale   - Length scale of the corresponding element.
+   * \param[in]  distToWall - Distances to the nearest wall of the points.
+   * \param[out] muTurb     - Values of the dynamic eddy viscosity.
+   */
+  virtual void ComputeEddyViscosity_2D(const unsigned short nPoints,
+                                       const su2double      *rho,
+                                       const su2double      *velGrad,
+                                       const su2double      lenScale,
+                                       const su2double      *distToWall,
+                                             su2double      *muTurb);
+
+  /*!
+   * \brief Virtual function to determine the eddy viscosity in a batch of
+            points for a 3D simulation. For the base class 0 is returned.
+   * \param[in]  nPoints    - Number of points in the batch.
+   * \param[in]  rho        - Densities of the points.
+   * \param[in]  velGrad    - Velocity gradients of the points, stored as dudx, dudy,
+                               dudz, dvdx, ..., dwdz, each for all points consecutively.
+   * \param[in]  lenScale   - Length scale of the corresponding element.
+   * \param[in]  distToWall - Distances to the nearest wall of the points.
+   * \param[out] muTurb     - Values of the dynamic eddy viscosity.
+   */
+  virtual void ComputeEddyViscosity_3D(const unsigned short nPoints,
+                                       const su2double      *rho,
+                                       const su2double      *velGrad,
+                                       const su2double      lenScale,
+                                       const su2double      *distToWall,
+                                             su2double      *muTurb);
+
+protected:
+
+  /*!
+   * \brief Function to determine the eddy viscosity in a batch of points for
+            a 2D simulation, in which the pointwise function of the given model
+            is called without virtual dispatch, such that it can be inlined.
+   * \param[in]  model      - The SGS model, whose pointwise function is used.
+   * \param[in]  nPoints    - Number of points in the batch.
+   * \param[in]  rho        - Densities of the points.
+   * \param[in]  velGrad    - Velocity gradients of the points, see ComputeEddyViscosity_2D.
+   * \param[in]  lenScale   - Length scale of the corresponding element.
+   * \param[in]  distToWall - Distances to the nearest wall of the points.
+   * \param[out] muTurb     - Values of the dynamic eddy viscosity.
+   */
+  template<class SGSModelType>
+  static void EddyViscosityBatch_2D(SGSModelType         *model,
+                                    const unsigned short nPoints,
+                                    const su2double      *rho,
+                                    const su2double      *velGrad,
+                                    const su2double      lenScale,
+                                    const su2double      *distToWall,
+                                          su2double      *muTurb);
+
+  /*!
+   * \brief Function to determine the eddy viscosity in a batch of points for
+            a 3D simulation, in which the pointwise function of the given model
+            is called without virtual dispatch, such that it can be inlined.
+   * \param[in]  model      - The SGS model, whose pointwise function is used.
+   * \param[in]  nPoints    - Number of points in the batch.
+   * \param[in]  rho        - Densities of the points.
+   * \param[in]  velGrad    - Velocity gradients of the points, see ComputeEddyViscosity_3D.
+   * \param[in]  lenScale   - Length scale of the corresponding element.
+   * \param[in]  distToWall - Distances to the nearest wall of the points.
+   * \param[out] muTurb     - Values of the dynamic eddy viscosity.
+   */
+  template<class SGSModelType>
+  static void EddyViscosityBatch_3D(SGSModelType         *model,
+                                    const unsigned short nPoints,
+                                    const su2double      *rho,
+                                    const su2double      *velGrad,
+                                    const su2double      lenScale,
+                                    const su2double      *distToWall,
+                                          su2double      *muTurb);
 };
 
 /*!
@@ -407,6 +488,28 @@ public:
                                          su2double &dMuTdx,
                                          su2double &dMuTdy,
                                          su2double &dMuTdz);
+
+  /*!
+   * \brief Function to determine the eddy viscosity in a batch of points
+            for a 2D simulation, see CSGSModel::ComputeEddyViscosity_2D.
+   */
+  void ComputeEddyViscosity_2D(const unsigned short nPoints,
+                               const su2double      *rho,
+                               const su2double      *velGrad,
+                               const su2double      lenScale,
+                               const su2double      *distToWall,
+                                     su2double      *muTurb);
+
+  /*!
+   * \brief Function to determine the eddy viscosity in a batch of points
+            for a 3D simulation, see CSGSModel::ComputeEddyViscosity_3D.
+   */
+  void ComputeEddyViscosity_3D(const unsigned short nPoints,
+                               const su2double      *rho,
+                               const su2double      *velGrad,
+                               const su2double      lenScale,
+                               const su2double      *distToWall,
+                                     su2double      *muTurb);
 };
 
 /*!
@@ -595,6 +698,28 @@ public:
                                          su2double &dMuTdx,
                                          su2double &dMuTdy,
                                          su2double &dMuTdz);
+
+  /*!
+   * \brief Function to determine the eddy viscosity in a batch of points
+            for a 2D simulation, see CSGSModel::ComputeEddyViscosity_2D.
+   */
+  void ComputeEddyViscosity_2D(const unsigned short nPoints,
+                               const su2double      *rho,
+                               const su2double      *velGrad,
+                               const su2double      lenScale,
+                               const su2double      *distToWall,
+                                     su2double      *muTurb);
+
+  /*!
+   * \brief Function to determine the eddy viscosity in a batch of points
+            for a 3D simulation, see CSGSModel::ComputeEddyViscosity_3D.
+   */
+  void ComputeEddyViscosity_3D(const unsigned short nPoints,
+                               const su2double      *rho,
+                               const su2double      *velGrad,
+                               const su2double      lenScale,
+                               const su2double      *distToWall,
+                                     su2double      *muTurb);
 };
 
 /*!
@@ -783,5 +908,27 @@ public:
                                    su2double &dMuTdx,
                                    su2double &dMuTdy,
                                    su2double &dMuTdz);
+
+  /*!
+   * \brief Function to determine the eddy viscosity in a batch of points
+            for a 2D simulation, see CSGSModel::ComputeEddyViscosity_2D.
+   */
+  void ComputeEddyViscosity_2D(const unsigned short nPoints,
+                               const su2double      *rho,
+                               const su2double      *velGrad,
+                               const su2double      lenScale,
+                               const su2double      *distToWall,
+                                     su2double      *muTurb);
+
+  /*!
+   * \brief Function to determine the eddy viscosity in a batch of points
+            for a 3D simulation, see CSGSModel::ComputeEddyViscosity_3D.
+   */
+  void ComputeEddyViscosity_3D(const unsigned short nPoints,
+                               const su2double      *rho,
+                               const su2double      *velGrad,
+                               const su2double      lenScale,
+                               const su2double      *distToWall,
+                                     su2double      *muTurb);
 };
 #include "sgs_model.inl"
@@ -114,6 +114,77 @@ inline void CSGSModel::ComputeGradEddyViscosity_3D(const su2double rho,
   dMuTdx = dMuTdy = dMuTdz = 0.0;
 }
 
+inline void CSGSModel::ComputeEddyViscosity_2D(const unsigned short nPoints,
+                                               const su2double      *rho,
+                                               const su2double      *velGrad,
+                                               const su2double      lenScale,
+                                               const su2double      *distToWall,
+                                                     su2double      *muTurb) {
+  for(unsigned short i=0; i<nPoints; ++i) muTurb[i] = 0.0;
+}
+
+inline void CSGSModel::ComputeEddyViscosity_3D(const unsigned short nPoints,
+                                               const su2double      *rho,
+                                               const su2double      *velGrad,
+                                               const su2double      lenScale,
+                                               const su2double      *distToWall,
+                                                     su2double      *muTurb) {
+  for(unsigned short i=0; i<nPoints; ++i) muTurb[i] = 0.0;
+}
+
+template<class SGSModelType>
+inline void CSGSModel::EddyViscosityBatch_2D(SGSModelType         *model,
+                                             const unsigned short nPoints,
+                                             const su2double      *rho,
+                                             const su2double      *velGrad,
+                                             const su2double      lenScale,
+                                             const su2double      *distToWall,
+                                                   su2double      *muTurb) {
+
+  /* Set the pointers to the individual velocity gradients. */
+  const su2double *dudx = velGrad;
+  const su2double *dudy = dudx + nPoints;
+  const su2double *dvdx = dudy + nPoints;
+  const su2double *dvdy = dvdx + nPoints;
+
+  /* Loop over the points and call the pointwise function of the model
+     explicitly, i.e. without virtual dispatch. */
+  SU2_OMP_SIMD
+  for(unsigned short i=0; i<nPoints; ++i)
+    muTurb[i] = model->SGSModelType::ComputeEddyViscosity_2D(rho[i], dudx[i], dudy[i], dvdx[i],
+                                                             dvdy[i], lenScale, distToWall[i]);
+}
+
+template<class SGSModelType>
+inline void CSGSModel::EddyViscosityBatch_3D(SGSModelType         *model,
+                                             const unsigned short nPoints,
+                                             const su2double      *rho,
+                                             const su2double      *velGrad,
+                                             const su2double      lenScale,
+                                             const su2double      *distToWall,
+                                                   su2double      *muTurb) {
+
+  /* Set the pointers to the individual velocity gradients. */
+  const su2double *dudx = velGrad;
+  const su2double *dudy = dudx + nPoints;
+  const su2double *dudz = dudy + nPoints;
+  const su2double *dvdx = dudz + nPoints;
+  const su2double *dvdy = dvdx + nPoints;
+  const su2double *dvdz = dvdy + nPoints;
+  const su2double *dwdx = dvdz + nPoints;
+  const su2double *dwdy = dwdx + nPoints;
+  const su2double *dwdz = dwdy + nPoints;
+
+  /* Loop over the points and call the pointwise function of the model
+     explicitly, i.e. without virtual dispatch. */
+  SU2_OMP_SIMD
+  for(unsigned short i=0; i<nPoints; ++i)
+    muTurb[i] = model->SGSModelType::ComputeEddyViscosity_3D(rho[i], dudx[i], dudy[i], dudz[i],
+                                                             dvdx[i], dvdy[i], dvdz[i],
+                                                             dwdx[i], dwdy[i], dwdz[i],
+                                                             lenScale, distToWall[i]);
+}
+
 inline CSmagorinskyModel::CSmagorinskyModel(void) : CSGSModel() {
   const_smag  = 0.1;
   filter_mult = 2.0;
@@ -235,6 +306,24 @@ inline void CSmagorinskyModel::ComputeGradEddyViscosity_3D(const su2double rho,
   exit(1);
 }
 
+inline void CSmagorinskyModel::ComputeEddyViscosity_2D(const unsigned short nPoints,
+                                                       const su2double      *rho,
+                                                       const su2double      *velGrad,
+                                                       const su2double      lenScale,
+                                                       const su2double      *distToWall,
+                                                             su2double      *muTurb) {
+  EddyViscosityBatch_2D(this, nPoints, rho, velGrad, lenScale, distToWall, muTurb);
+}
+
+inline void CSmagorinskyModel::ComputeEddyViscosity_3D(const unsigned short nPoints,
+                                                       const su2double      *rho,
+                                                       const su2double      *velGrad,
+                                                       const su2double      lenScale,
+                                                       const su2double      *distToWall,
+                                                             su2double      *muTurb) {
+  EddyViscosityBatch_3D(this, nPoints, rho, velGrad, lenScale, distToWall, muTurb);
+}
+
 inline CWALEModel::CWALEModel(void) : CSGSModel() {
   const_WALE = 0.325;
 }
@@ -407,6 +496,24 @@ inline void CWALEModel::ComputeGradEddyViscosity_3D(const su2double rho,
   exit(1);
 }
 
+inline void CWALEModel::ComputeEddyViscosity_2D(const unsigned short nPoints,
+                                                const su2double      *rho,
+                                                const su2double      *velGrad,
+                                                const su2double      lenScale,
+                                                const su2double      *distToWall,
+                                                      su2double      *muTurb) {
+  EddyViscosityBatch_2D(this, nPoints, rho, velGrad, lenScale, distToWall, muTurb);
+}
+
+inline void CWALEModel::ComputeEddyViscosity_3D(const unsigned short nPoints,
+                                                const su2double      *rho,
+                                                const su2double      *velGrad,
+                                                const su2double      lenScale,
+                                                const su2double      *distToWall,
+                                                      su2double      *muTurb) {
+  EddyViscosityBatch_3D(this, nPoints, rho, velGrad, lenScale, distToWall, muTurb);
+}
+
 inline CVremanModel::CVremanModel(void) : CSGSModel() {
   
   /* const_Vreman = 2.5*Cs*Cs where Cs is the Smagorinsky constant */
@@ -538,3 +645,21 @@ inline void CVremanModel::ComputeGradEddyViscosity_3D(const su2double rho,
   cout << "CWALEModel::ComputeGradEddyViscosity_3D: Not implemented yet" << endl;
   exit(1);
 }
+
+inline void CVremanModel::ComputeEddyViscosity_2D(const unsigned short nPoints,
+                                                  const su2double      *rho,
+                                                  const su2double      *velGrad,
+                                                  const su2double      lenScale,
+                                                  const su2double      *distToWall,
+                                                        su2double      *muTurb) {
+  EddyViscosityBatch_2D(this, nPoints, rho, velGrad, lenScale, distToWall, muTurb);
+}
+
+inline void CVremanModel::ComputeEddyViscosity_3D(const unsigned short nPoints,
+                                                  const su2double      *rho,
+                                                  const su2double      *velGrad,
+                                                  const su2double      lenScale,
+                                                  const su2double      *distToWall,
+                                                        su2double      *muTurb) {
+  EddyViscosityBatch_3D(this, nPoints, rho, velGrad, lenScale, distToWall, muTurb);
+}
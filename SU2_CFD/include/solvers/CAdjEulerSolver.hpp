@@ -29,6 +29,7 @@
 
 #include "CSolver.hpp"
 #include "../variables/CAdjEulerVariable.hpp"
+#include "../../../Common/include/omp_structure.hpp"
 
 /*!
  * \class CAdjEulerSolver
@@ -38,6 +39,26 @@
  */
 class CAdjEulerSolver : public CSolver {
 protected:
+  enum : size_t {MAXNDIM = 3};         /*!< \brief Max number of space dimensions, used in some static arrays. */
+  enum : size_t {MAXNVAR = 5};         /*!< \brief Max number of variables, used in some static arrays. */
+
+  enum : size_t {OMP_MAX_SIZE = 512};  /*!< \brief Max chunk size for light point loops. */
+  enum : size_t {OMP_MIN_SIZE = 32};   /*!< \brief Min chunk size for edge loops (max is color group size). */
+
+  unsigned long omp_chunk_size = 1;    /*!< \brief Chunk size used in light point loops. */
+
+  unsigned long ErrorCounter = 0;      /*!< \brief Counter for number of un-physical states. */
+
+  /*--- Shallow copy of grid coloring for OpenMP parallelization. The adjoint fluxes are not
+   *    conservative (four independent Jacobian blocks per edge), therefore there is no reducer
+   *    strategy, when the coloring is not efficient the edge loops run on a single color. ---*/
+
+#ifdef HAVE_OMP
+  vector<GridColor<> > EdgeColoring;   /*!< \brief Edge colors. */
+#else
+  array<DummyGridColor<>,1> EdgeColoring;
+#endif
+
   su2double
   PsiRho_Inf,     /*!< \brief PsiRho variable at the infinity. */
   PsiE_Inf,       /*!< \brief PsiE variable at the infinity. */
@@ -78,6 +99,13 @@ protected:
    */
   inline CVariable* GetBaseClassPointerToNodes() override { return nodes; }
 
+  /*!
+   * \brief Get the edge coloring of the grid and the chunk size of the point loops (OpenMP).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetEdgeColoring(CGeometry *geometry, CConfig *config);
+
 public:
 
   /*!
@@ -709,4 +737,9 @@ public:
                    int val_iter,
                    bool val_update_geo) final;
 
+  /*!
+   * \brief The continuous adjoint solver supports MPI+OpenMP (except for the BCs and sensitivities).
+   */
+  inline bool GetHasHybridParallel() const final { return true; }
+
 };
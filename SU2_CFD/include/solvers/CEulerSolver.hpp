@@ -31,6 +31,8 @@
 #include "../variables/CEulerVariable.hpp"
 #include "../../../Common/include/omp_structure.hpp"
 
+class CUpwindBatchNumerics;
+
 /*!
  * \class CSolver
  * \brief Main class for defining the PDE solution, it requires
@@ -47,6 +49,8 @@ protected:
 
   unsigned long omp_chunk_size;  /*!< \brief Chunk size used in light point loops. */
 
+  bool SpectralRadiiReady = false;  /*!< \brief The spectral radii of the time step were computed by the preprocessing. */
+
   su2double
   Mach_Inf = 0.0,            /*!< \brief Mach number at the infinity. */
   Density_Inf = 0.0,         /*!< \brief Density at the infinity. */
@@ -202,6 +206,11 @@ protected:
   Update_AoA = false;         /*!< \brief Boolean to signal Angle of Attack Update */
   unsigned long Iter_Update_AoA = 0; /*!< \brief Iteration at which AoA was updated last */
   su2double dCL_dAlpha;              /*!< \brief Value of dCL_dAlpha used to control CL in fixed CL mode */
+  su2double AoA_Newton_Prev = 0.0,   /*!< \brief AoA at the previous Newton update (FIXED_CL_NEWTON). */
+  CL_Newton_Prev = 0.0,              /*!< \brief CL at the previous Newton update. */
+  AoA_Ramp_inc = 0.0;                /*!< \brief Increment of the AoA per iteration while ramping an update. */
+  unsigned long AoA_Ramp_Left = 0;   /*!< \brief Remaining iterations of the ramp. */
+  bool Newton_Prev_Valid = false;    /*!< \brief Whether there was a previous Newton update (for the secant). */
   unsigned long BCThrust_Counter;
   unsigned short nSpanWiseSections;  /*!< \brief Number of span-wise sections. */
   unsigned short nSpanMax;           /*!< \brief Max number of maximum span-wise sections for all zones. */
@@ -265,10 +274,12 @@ protected:
 #ifdef HAVE_OMP
   vector<GridColor<> > EdgeColoring;   /*!< \brief Edge colors. */
   bool ReducerStrategy = false;        /*!< \brief If the reducer strategy is in use. */
+  bool OwnerComputes = false;          /*!< \brief If the convective loops use the owner-computes strategy. */
 #else
   array<DummyGridColor<>,1> EdgeColoring;
-  /*--- Never use the reducer strategy if compiling for MPI-only. ---*/
+  /*--- Never use the reducer or owner-computes strategies if compiling for MPI-only. ---*/
   static constexpr bool ReducerStrategy = false;
+  static constexpr bool OwnerComputes = false;
 #endif
 
   /*--- Edge fluxes, for OpenMP parallelization off difficult-to-color grids.
@@ -279,6 +290,73 @@ protected:
 
   CSysVector<su2double> EdgeFluxes; /*!< \brief Flux across each edge. */
 
+  CUpwindBatchNumerics* BatchNumerics = nullptr; /*!< \brief Edge-batched (vectorized) upwind scheme, when supported by the options. */
+
+  bool PackedEdgeData = false;    /*!< \brief Whether the MUSCL edge loops read the packed records of the points. */
+  su2activematrix EdgeLoopData;   /*!< \brief Primitives, reconstruction gradients [iVar*nDim+iDim], and limiters of each point. */
+
+  /*--- Freezing of the limiters once the residual is low enough (LIMITER_FREEZE), they are then
+   *    re-evaluated periodically for all points, or in between for the points whose solution changed. ---*/
+
+  enum class LimiterUpdate {ALL, SOME, NONE};
+
+  LimiterUpdate limiterUpdate = LimiterUpdate::ALL;  /*!< \brief Which limiters are computed in the current iteration. */
+  unsigned long limiterUpdateIter = numeric_limits<unsigned long>::max(); /*!< \brief Iteration for which limiterUpdate was set. */
+  unsigned long limiterFreezeIter = 0;  /*!< \brief Iteration of the last full evaluation with frozen limiters. */
+  bool limiterFrozen = false;           /*!< \brief Whether the limiters are frozen. */
+  su2activematrix limiterSolution;      /*!< \brief Solution of each point when its limiters were last computed. */
+  su2vector<bool> limiterPoints;        /*!< \brief Points whose limiters are computed in a partial update. */
+  unsigned long limiterUpdatePoints = 0; /*!< \brief Number of points (of this rank) whose limiters were computed. */
+  su2double limiterUpdateFraction = 1.0; /*!< \brief Fraction of the points whose limiters were computed. */
+
+  /*--- Implicit residual smoothing of the explicit schemes (RES_SMOOTHING_ITER), Jacobi sweeps over the
+   *    neighbors of each point, the last sweep is fused with the update of the solution. ---*/
+
+  su2activematrix resSmoothRHS;          /*!< \brief Residual (plus truncation error) before the smoothing. */
+  su2activematrix resSmooth[2];          /*!< \brief Smoothed residuals of consecutive sweeps. */
+  const su2activematrix* resSmoothLast = nullptr; /*!< \brief Input of the last (fused) sweep. */
+  su2vector<bool> resSmoothFixed;        /*!< \brief Points whose residual is not smoothed (no-slip walls). */
+
+  /*--- Active set updates (ACTIVE_SET), the points whose residual stays low w.r.t. the global rms are frozen,
+   *    edges between frozen points are skipped and frozen points are not updated. Their residual is the one
+   *    of the last complete evaluation, all points are re-evaluated by periodic full sweeps. ---*/
+
+  su2vector<bool> activeSetFrozen;       /*!< \brief Points frozen in the current iteration. */
+  su2vector<unsigned long> activeSetCount; /*!< \brief Consecutive iterations with low residual of each point. */
+  su2activematrix activeSetResidual;     /*!< \brief Residual of the frozen points (for the norms). */
+  su2double activeSetRMS[MAXNVAR] = {0.0}; /*!< \brief Global rms residual of the previous iteration. */
+  unsigned long activeSetIter = numeric_limits<unsigned long>::max(); /*!< \brief Iteration for which the set was updated. */
+  unsigned long activeSetSweepIter = 0;  /*!< \brief Iteration of the last full sweep. */
+  bool activeSetSkip = false;            /*!< \brief Whether frozen points are skipped in the current iteration. */
+  unsigned long activeSetPoints = 0;     /*!< \brief Number of points (of this rank) that are not frozen. */
+  su2double activeSetFraction = 1.0;     /*!< \brief Fraction of the points that are not frozen. */
+
+  /*!
+   * \brief Pattern of the exchange of the states of the actuator disk (or near-field) vertices with the ranks
+   *        of their donors. The pairing is fixed by the geometry, so the lists of points and ranks are
+   *        computed once, each exchange then only packs the values and starts point-to-point requests.
+   * \note The points sent to each rank are contiguous in the buffers, this rank is one of the ranks.
+   */
+  struct CDonorExchange {
+    bool ready = false;                 /*!< \brief Whether the pattern was computed. */
+    unsigned short nVarPoint = 0;       /*!< \brief Number of values per point. */
+    vector<int> sendRank, recvRank;     /*!< \brief Ranks to which values are sent, and from which they are received. */
+    vector<unsigned long> sendPtr, recvPtr; /*!< \brief First point of each rank in the buffers (size nRank+1). */
+    vector<unsigned long> sendPoint;    /*!< \brief Local point of each sent value. */
+    vector<unsigned short> recvMarker;  /*!< \brief Marker of the vertex of each received value. */
+    vector<unsigned long> recvVertex;   /*!< \brief Vertex of each received value. */
+    vector<su2double> sendBuf, recvBuf; /*!< \brief Packed values. */
+    vector<SU2_MPI::Request> sendReq, recvReq; /*!< \brief Requests (persistent if supported). */
+
+    CDonorExchange() = default;
+    CDonorExchange(const CDonorExchange&) = delete;
+    CDonorExchange& operator=(const CDonorExchange&) = delete;
+    ~CDonorExchange();
+  };
+
+  CDonorExchange ActDiskExchange;    /*!< \brief Exchange of the actuator disk states. */
+  CDonorExchange NearfieldExchange;  /*!< \brief Exchange of the near-field states. */
+
   /*!
    * \brief The highest level in the variable hierarchy this solver can safely use.
    */
@@ -295,12 +373,62 @@ protected:
   template<ENUM_TIME_INT IntegrationType>
   void Explicit_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iRKStep);
 
+  /*!
+   * \brief Jacobi sweeps of the implicit residual smoothing, all but the last one (see GetSmoothedResidual).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SmoothResidual(CGeometry *geometry, const CConfig *config);
+
+  /*!
+   * \brief Last Jacobi sweep of the implicit residual smoothing for one point.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] iPoint - Point index.
+   * \param[in] coeff - Smoothing coefficient.
+   * \param[out] residual - Smoothed residual of the point.
+   */
+  inline void GetSmoothedResidual(CGeometry *geometry, unsigned long iPoint,
+                                  su2double coeff, su2double *residual) const {
+    if (resSmoothFixed(iPoint)) {
+      for (unsigned short iVar = 0; iVar < nVar; iVar++)
+        residual[iVar] = resSmoothRHS(iPoint,iVar);
+      return;
+    }
+    su2double sum[MAXNVAR] = {0.0};
+    unsigned short nNeigh = 0;
+    for (unsigned short iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); iNeigh++) {
+      const unsigned long jPoint = geometry->node[iPoint]->GetPoint(iNeigh);
+      if (jPoint >= nPointDomain) continue;
+      for (unsigned short iVar = 0; iVar < nVar; iVar++)
+        sum[iVar] += (*resSmoothLast)(jPoint,iVar);
+      ++nNeigh;
+    }
+    const su2double factor = 1.0 / (1.0 + coeff*nNeigh);
+    for (unsigned short iVar = 0; iVar < nVar; iVar++)
+      residual[iVar] = (resSmoothRHS(iPoint,iVar) + coeff*sum[iVar]) * factor;
+  }
+
   /*!
    * \brief Sum the edge fluxes for each cell to populate the residual vector, only used on coarse grids.
    * \param[in] geometry - Geometrical definition of the problem.
    */
   void SumEdgeFluxes(CGeometry* geometry);
 
+  /*!
+   * \brief Edge loop of the owner-computes strategy, each point computes the (convective and viscous)
+   *        fluxes of all its edges and updates its row of the system. There is no synchronization and the
+   *        writes are local, but each flux is computed twice, this suits the cheap schemes.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics_container - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] implicit - Whether to update the Jacobian.
+   * \param[in] computeEdge - Functor (iEdge, node 0, node 1) that sets the convective numerics and returns its residual.
+   */
+  template<class EdgeResidualFunc>
+  void OwnerComputesEdgeLoop(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
+                             CConfig *config, bool implicit, EdgeResidualFunc computeEdge);
+
   /*!
    * \brief Preprocessing actions common to the Euler and NS solvers.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -347,6 +475,34 @@ protected:
    */
   void Set_MPI_ActDisk(CSolver **solver_container, CGeometry *geometry, CConfig *config);
 
+  /*!
+   * \brief Newton update of the AoA in fixed CL mode (FIXED_CL_NEWTON), sets AoA_inc and starts
+   *        the finite differencing of the coefficients once CL is converged to the target.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] convergence - boolean for whether the solution is converged
+   * \return boolean for whether the Fixed CL mode is converged to target CL (no finite differencing)
+   */
+  bool FixedCL_NewtonUpdate(CConfig *config, bool convergence);
+
+  /*!
+   * \brief Compute the pattern of an exchange of donor states, and set the donor global indices.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] nearfield - Near-field boundaries if true, actuator disks otherwise.
+   * \param[in] nVarPoint - Number of values per point.
+   * \param[out] exchange - The pattern.
+   */
+  void SetDonorExchange(CGeometry *geometry, const CConfig *config, bool nearfield,
+                        unsigned short nVarPoint, CDonorExchange& exchange);
+
+  /*!
+   * \brief Exchange the donor states and store them with SetDonorPrimVar.
+   * \param[in,out] exchange - Pattern of the exchange.
+   * \param[in] packPoint - Functor packing the values of a point, (iPoint, su2double* values).
+   */
+  template<class F>
+  void DonorExchange(CDonorExchange& exchange, const F& packPoint);
+
   /*!
    * \brief Update the AoA and freestream velocity at the farfield.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -359,20 +515,15 @@ protected:
                            CConfig *config, unsigned short iMesh, bool Output);
 
   /*!
-   * \brief Compute the max eigenvalue.
+   * \brief Compute the max eigenvalue of the centered schemes and, optionally, the undivided laplacian
+   *        of the solution and the dissipation sensor (JST) and the spectral radii of the time step,
+   *        with one sweep over the neighbors of the points and one over the boundary vertices.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
+   * \param[in] jst - Compute the undivided laplacian and the dissipation sensor.
+   * \param[in] timeStep - Compute the spectral radii used by the next call to SetTime_Step.
    */
-  void SetMax_Eigenvalue(CGeometry *geometry, CConfig *config);
-
-  /*!
-   * \brief Compute the undivided laplacian for the solution and the
-   *        dissipation sensor for centered schemes.
-   * \param[in] geometry - Geometrical definition of the problem.
-   * \param[in] config - Definition of the particular problem.
-   */
-  void SetUndivided_Laplacian_And_Centered_Dissipation_Sensor(CGeometry *geometry,
-                                                              CConfig *config);
+  void SetCentered_Dissipation_Quantities(CGeometry *geometry, CConfig *config, bool jst, bool timeStep);
 
   /*!
    * \brief A virtual member.
@@ -393,6 +544,40 @@ protected:
 
 protected:
 
+  /*!
+   * \brief Point loop of SetPrimitive_Variables with the fluid and transport models known at compile
+   *        time, their (non-virtual) evaluations are inlined and vectorize across batches of points.
+   * \note Non-physical states are handled point by point as in the generic loop.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   * \tparam FluidModelType - Type of the fluid model (ideal gas, Van der Waals, Peng-Robinson).
+   * \tparam ViscosityModelType - Type of the viscosity model (unused if not viscous).
+   * \tparam Viscous - Whether the transport properties are computed (constant Prandtl conductivity).
+   * \return The number of non-physical points (of this thread).
+   */
+  template<class FluidModelType, class ViscosityModelType, bool Viscous>
+  unsigned long SetPrimitive_Variables_Batched(CSolver **solver_container, const CConfig *config);
+
+  /*!
+   * \brief Select the SetPrimitive_Variables_Batched specialization for the transport models.
+   * \param[out] nonPhysicalPoints - The number of non-physical points (of this thread).
+   * \return False if the models are not supported by the specialized loops.
+   */
+  template<class FluidModelType>
+  bool SetPrimitive_Variables_Transport(CSolver **solver_container, const CConfig *config,
+                                        unsigned long &nonPhysicalPoints);
+
+  /*!
+   * \brief Update the primitive variables with the specialized point loops when the fluid and
+   *        transport models of the problem are supported.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   * \param[out] nonPhysicalPoints - The number of non-physical points (of this thread).
+   * \return False if the generic (virtual) point loop must be used.
+   */
+  bool SetPrimitive_Variables_Specialized(CSolver **solver_container, const CConfig *config,
+                                          unsigned long &nonPhysicalPoints);
+
 public:
 
   /*!
@@ -521,9 +706,56 @@ public:
                        unsigned short iMesh) final;
 
   /*!
-   * \brief Compute the viscous contribution for a particular edge.
-   * \note The convective residual methods include a call to this for each edge,
-   *       this allows convective and viscous loops to be "fused".
+   * \brief MUSCL reconstruction of the primitive (and secondary) variables at the two ends of an edge.
+   * \note Checks for non-physical reconstructions and updates the non-physical flags of the points,
+   *       if set the cell values must be used instead of the reconstructed ones.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iEdge - Edge index.
+   * \param[in] iPoint - First point of the edge.
+   * \param[in] jPoint - Second point of the edge.
+   * \param[in] limiter - Whether to apply the slope limiter.
+   * \param[out] Primitive_i - Reconstructed primitives at i.
+   * \param[out] Primitive_j - Reconstructed primitives at j.
+   * \param[out] Secondary_i - Reconstructed secondaries at i.
+   * \param[out] Secondary_j - Reconstructed secondaries at j.
+   * \param[out] bad_i - Whether the reconstruction at i is non-physical.
+   * \param[out] bad_j - Whether the reconstruction at j is non-physical.
+   */
+  void ReconstructEdgeVariables(CGeometry *geometry, const CConfig *config, unsigned long iEdge,
+                                unsigned long iPoint, unsigned long jPoint, bool limiter,
+                                su2double *Primitive_i, su2double *Primitive_j,
+                                su2double *Secondary_i, su2double *Secondary_j,
+                                bool &bad_i, bool &bad_j);
+
+  /*!
+   * \brief Copy the primitives, reconstruction gradients, and limiters of a range of points to
+   *        their records of EdgeLoopData (see PACKED_EDGE_DATA), called by the upwind residual
+   *        after the gradients and limiters are computed (and communicated).
+   * \param[in] limiter - Whether the limiters are used.
+   * \param[in] pointBegin - First point.
+   * \param[in] pointEnd - End of the range of points.
+   */
+  void PackEdgeLoopData(bool limiter, unsigned long pointBegin, unsigned long pointEnd);
+
+  /*!
+   * \brief Edge loop of Upwind_Residual with the batched numerics, the fluxes of groups of
+   *        edges of the same color are computed at a time by vectorized kernels.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics_container - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   * \return Number of non-physical reconstructions (of this thread).
+   */
+  unsigned long Upwind_Residual_Batched(CGeometry *geometry, CSolver **solver_container,
+                                        CNumerics **numerics_container, CConfig *config,
+                                        unsigned short iMesh);
+
+  /*!
+   * \brief Compute the viscous contribution for a particular edge and update the system.
+   * \note The convective residual methods do not call this, they use ViscousEdgeResidual
+   *       to "fuse" the convective and viscous loops and updates.
    * \param[in] iEdge - Edge for which the flux and Jacobians are to be computed.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] solver_container - Container vector with all the solutions.
@@ -533,6 +765,68 @@ public:
   inline virtual void Viscous_Residual(unsigned long iEdge, CGeometry *geometry, CSolver **solver_container,
                                        CNumerics *numerics, CConfig *config) { }
 
+  /*!
+   * \brief Compute the viscous flux and Jacobians for a particular edge, without updating the system.
+   * \note The convective residual methods combine this with the convective contribution, such that
+   *       the residual and Jacobian are updated once per edge (see UpdateEdgeContribution).
+   * \param[in] iEdge - Edge for which the flux and Jacobians are to be computed.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \return View of the flux and Jacobians stored by the numerics, null for inviscid problems.
+   */
+  inline virtual CNumerics::ResidualType<> ViscousEdgeResidual(unsigned long iEdge, CGeometry *geometry,
+                                                               CSolver **solver_container,
+                                                               CNumerics *numerics, CConfig *config) {
+    return CNumerics::ResidualType<>(nullptr, nullptr, nullptr);
+  }
+
+  /*!
+   * \brief Update the residual and Jacobian with the convective and (optional) viscous contributions
+   *        of an edge, the two are summed before updating the system to traverse its data once.
+   * \param[in] iEdge - Edge of the contributions.
+   * \param[in] iPoint - First point of the edge.
+   * \param[in] jPoint - Second point of the edge.
+   * \param[in] implicit - Whether to update the Jacobian.
+   * \param[in] flux - Convective flux from i to j.
+   * \param[in] jacobian_i - Jacobian of the convective flux w.r.t. the variables at i.
+   * \param[in] jacobian_j - Jacobian of the convective flux w.r.t. the variables at j.
+   * \param[in] viscous - Viscous contribution (subtracted), ignored if null.
+   */
+  void UpdateEdgeContribution(unsigned long iEdge, unsigned long iPoint, unsigned long jPoint, bool implicit,
+                              const su2double *flux, const su2double* const* jacobian_i,
+                              const su2double* const* jacobian_j, const CNumerics::ResidualType<>& viscous);
+
+  /*!
+   * \overload For convective contributions in the fixed size storage of the numerics (see
+   *           CNumerics::ComputeStaticResidual), the matrix is updated from the contiguous blocks.
+   */
+  void UpdateEdgeContribution(unsigned long iEdge, unsigned long iPoint, unsigned long jPoint, bool implicit,
+                              const CNumerics::StaticResidualType& convective, const CNumerics::ResidualType<>& viscous);
+
+  /*!
+   * \brief Update the row of one of the points of an edge with its convective and (optional) viscous
+   *        contributions, for the owner-computes strategy.
+   * \param[in] iEdge - Edge of the contributions.
+   * \param[in] iPoint - Point (row) to update.
+   * \param[in] first - Whether iPoint is the first point of the edge.
+   * \param[in] implicit - Whether to update the Jacobian.
+   * \param[in] convective - Convective contribution.
+   * \param[in] viscous - Viscous contribution (subtracted), ignored if null.
+   */
+  void UpdateOwnerContribution(unsigned long iEdge, unsigned long iPoint, bool first, bool implicit,
+                               const CNumerics::StaticResidualType& convective, const CNumerics::ResidualType<>& viscous);
+
+  /*!
+   * \brief Sum of the convective and viscous (subtracted) contributions of an edge.
+   * \param[out] sum - Storage for the sum, only used if there is a viscous contribution.
+   * \return The convective contribution, or the sum.
+   */
+  const CNumerics::StaticResidualType& SumEdgeContributions(bool implicit, const CNumerics::StaticResidualType& convective,
+                                                            const CNumerics::ResidualType<>& viscous,
+                                                            CNumerics::StaticResidualType& sum) const;
+
   /*!
    * \brief Recompute the extrapolated quantities, after MUSCL reconstruction,
    *        in a more thermodynamically consistent way.
@@ -637,6 +931,71 @@ public:
    */
   void SetPrimitive_Limiter(CGeometry *geometry, CConfig *config) final;
 
+  /*!
+   * \brief Compute the gradient and the limiter of the primitive variables with one traversal of the
+   *        neighbors (the min/max stencils are built with the gradient) and one MPI communication.
+   * \note Falls back to SetPrimitive_Gradient_GG/LS plus SetPrimitive_Limiter with periodic boundaries.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] reconstruction - indicator that the gradient being computed is for upwind reconstruction.
+   */
+  void SetPrimitive_Gradient_Limiter(CGeometry *geometry, CConfig *config, bool reconstruction);
+
+  /*!
+   * \brief Decide which limiters are computed in this iteration (see LIMITER_FREEZE).
+   * \note Called by all threads before the limiters, once or more per iteration.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetLimiterUpdate(CGeometry *geometry, const CConfig *config);
+
+  /*!
+   * \brief Get the fraction of the points whose limiters were computed in the last iteration.
+   * \return Value of the fraction.
+   */
+  inline su2double GetLimiterUpdateFraction(void) const final { return limiterUpdateFraction; }
+
+  /*!
+   * \brief Decide whether the frozen points are skipped in this iteration (see ACTIVE_SET).
+   * \note Called by all threads before the residual evaluation, once or more per iteration.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetActiveSet(CGeometry *geometry, const CConfig *config);
+
+  /*!
+   * \brief Whether an edge is skipped by the residual loops, i.e. both its points are frozen.
+   */
+  inline bool SkipEdge(unsigned long iPoint, unsigned long jPoint) const {
+    return activeSetSkip && activeSetFrozen(iPoint) && activeSetFrozen(jPoint);
+  }
+
+  /*!
+   * \brief Update the state of a point in the active set from its residual (see ACTIVE_SET).
+   * \note The residual of the points skipped in this iteration is incomplete, it is replaced by the stored one.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iPoint - Point (owned by this rank).
+   * \param[in,out] residual - Residual of the point.
+   * \param[in,out] nActive - Number of points that are not frozen (thread local).
+   * \param[in] evaluate - Whether the criterion is evaluated (once per iteration, e.g. first RK stage).
+   * \return Whether the point is frozen, i.e. it is not updated.
+   */
+  bool UpdateActiveSet(const CConfig *config, unsigned long iPoint, su2double* residual,
+                       unsigned long& nActive, bool evaluate);
+
+  /*!
+   * \brief Reduce the number of active points over threads and ranks.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] nActive - Number of points that are not frozen (thread local).
+   */
+  void SetActiveSetFraction(CGeometry *geometry, unsigned long nActive);
+
+  /*!
+   * \brief Get the fraction of the points that are not frozen by the active set updates.
+   * \return Value of the fraction.
+   */
+  inline su2double GetActiveSetFraction(void) const final { return activeSetFraction; }
+
   /*!
    * \brief Compute the preconditioner for convergence acceleration by Roe-Turkel method.
    * \param[in] config - Definition of the particular problem.
@@ -1086,6 +1445,26 @@ public:
                                CSolver **solver_container,
                                CConfig *config) final;
 
+  /*!
+   * \brief Build the implicit system (pseudo time term, right hand side, initial guess) and monitor the residuals.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void PrepareImplicitIteration(CGeometry *geometry,
+                                CSolver **solver_container,
+                                CConfig *config) final;
+
+  /*!
+   * \brief Update the solution with the (under-relaxed) solution of the implicit system.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void CompleteImplicitIteration(CGeometry *geometry,
+                                 CSolver **solver_container,
+                                 CConfig *config) final;
+
   /*!
    * \brief Compute a suitable under-relaxation parameter to limit the change in the solution variables over a nonlinear iteration for stability.
    * \param[in] solver - Container vector with all the solutions.
@@ -2885,8 +3264,15 @@ public:
   void ComputeVerificationError(CGeometry *geometry, CConfig *config) final;
 
   /*!
-   * \brief The Euler and NS solvers support MPI+OpenMP (except the BC bits).
+   * \brief The Euler and NS solvers support MPI+OpenMP.
    */
   inline bool GetHasHybridParallel() const final { return true; }
 
+  /*!
+   * \brief The weak BCs of the Euler and NS solvers support MPI+OpenMP (except the turbomachinery ones).
+   * \note Within a marker each vertex is a unique point, the updates of the residual and of the
+   *       Jacobian diagonal are therefore free of races. Markers are processed one after the other.
+   */
+  inline bool GetHasHybridParallelBC() const final { return true; }
+
 };
@@ -29,6 +29,7 @@
 
 #include "CSolver.hpp"
 #include "../../../Common/include/omp_structure.hpp"
+#include "../../../Common/include/linear_algebra/CMatrixVectorProduct.hpp"
 
 /*!
  * \class CFEASolver
@@ -59,6 +60,14 @@ protected:
   su2double WAitken_Dyn;            /*!< \brief Aitken's dynamic coefficient */
   su2double WAitken_Dyn_tn1;        /*!< \brief Aitken's dynamic coefficient in the previous iteration */
 
+  bool IQN_Initialized = false;             /*!< \brief The interface points of the IQN-ILS coupling have been gathered. */
+  vector<unsigned long> IQN_Point;          /*!< \brief Domain points of the FSI interface, where IQN-ILS is applied. */
+  vector<vector<su2double> > IQN_V;         /*!< \brief Differences of interface residuals, newest first. */
+  vector<vector<su2double> > IQN_W;         /*!< \brief Differences of calculated interface displacements, newest first. */
+  vector<unsigned long> IQN_TimeIter;       /*!< \brief Time step in which each pair of columns was created. */
+  vector<su2double> IQN_Res_Old;            /*!< \brief Interface residual of the previous coupling iteration. */
+  vector<su2double> IQN_Calc_Old;           /*!< \brief Calculated interface displacements of the previous coupling iteration. */
+
   su2double PenaltyValue;           /*!< \brief Penalty value to maintain total stiffness constant */
 
   su2double Total_OFRefGeom;        /*!< \brief Total Objective Function: Reference Geometry. */
@@ -90,6 +99,54 @@ protected:
 
   unsigned long nElement;      /*!< \brief Number of elements. */
 
+#ifndef CODI_FORWARD_TYPE
+  using ScalarImplicit = su2mixedfloat;
+#else
+  using ScalarImplicit = su2double;
+#endif
+
+  bool matrix_free = false;                 /*!< \brief Apply the stiffness element by element, only the diagonal blocks are stored. */
+  bool tangent_nonlinear = false;           /*!< \brief The last tangent was of a nonlinear analysis (stress and DE terms, prestretch). */
+  CNumerics **tangent_numerics = nullptr;   /*!< \brief Numerics of the last assembly, used to recompute the element tangents. */
+  vector<bool> DirichletNode;               /*!< \brief Nodes whose solution is enforced, i.e. identity rows and eliminated columns. */
+
+  bool grad_cache_ready = false;            /*!< \brief The records of the reference gradients of all elements are filled. */
+  su2activevector GradCache[MAX_FE_KINDS];  /*!< \brief Reference gradients at the Gauss points, by kind of element (FEA_GRADIENT_CACHE). */
+  vector<unsigned long> GradCachePos;       /*!< \brief Position of the record of each element in the store of its kind. */
+
+  bool tangent_updated = false;             /*!< \brief The tangent was computed on the current iteration. */
+  bool tangent_refresh = false;             /*!< \brief The frozen tangent should be recomputed on the next iteration. */
+  unsigned long tangent_age = 0;            /*!< \brief Iterations since the frozen tangent was computed. */
+  su2double tangent_resNorm = 0.0;          /*!< \brief Norm of the residual of the last iteration (stall criterion). */
+
+  vector<CSysVector<su2double> > qn_Step;   /*!< \brief Steps (s) of the BFGS updates of the quasi-Newton method. */
+  vector<CSysVector<su2double> > qn_ResChange; /*!< \brief Decrease of the residual over the steps (y). */
+  vector<su2double> qn_Rho;                 /*!< \brief Inverse of s.y of the updates. */
+  unsigned short qn_nPairs = 0;             /*!< \brief Number of updates kept. */
+  unsigned short qn_iNext = 0;              /*!< \brief Position of the next update in the circular buffer. */
+  CSysVector<su2double> qn_LastStep;        /*!< \brief Step applied since the last residual used to compute a step. */
+  CSysVector<su2double> qn_LastRes;         /*!< \brief That residual. */
+  CSysVector<su2double> qn_Work;            /*!< \brief Work vector of the two-loop recursion. */
+  bool qn_pending = false;                  /*!< \brief The last step has not become an update yet. */
+  bool qn_searched = false;                 /*!< \brief The length of the last step was corrected by the line search. */
+
+  /*!
+   * \brief Matrix-free product by the stiffness matrix, which calls back the solver to apply the element tangents.
+   */
+  class CMatrixFreeProduct final : public CMatrixVectorProduct<ScalarImplicit> {
+  private:
+    CFEASolver& solver;  /*!< \brief Solver that evaluates the products. */
+    CGeometry *geometry; /*!< \brief Geometrical definition of the problem. */
+    CConfig *config;     /*!< \brief Definition of the particular problem. */
+  public:
+    CMatrixFreeProduct(CFEASolver& solver_ref, CGeometry *geometry_ptr, CConfig *config_ptr) :
+      solver(solver_ref), geometry(geometry_ptr), config(config_ptr) {}
+
+    inline void operator()(const CSysVector<ScalarImplicit> & u, CSysVector<ScalarImplicit> & v) const override {
+      solver.MatrixFreeProduct(u, v, geometry, config);
+    }
+  };
+
   /*!
    * \brief The highest level in the variable hierarchy this solver can safely use,
    * CVariable is the common denominator between the FEA and Mesh deformation variables.
@@ -152,6 +209,68 @@ protected:
    */
   void Compute_IntegrationConstants(CConfig *config);
 
+  /*!
+   * \brief Multiply a vector by the stiffness matrix (as modified by the essential BCs) without assembling it,
+   *        the tangent of each element is recomputed as in the last call to Compute_StiffMatrix(_NodalStressRes).
+   * \note Only the domain rows are computed, must be called from within a parallel region.
+   * \param[in] u - Vector being multiplied.
+   * \param[out] v - Result of the product.
+   * \param[in] dirichletColumns - If true, multiply only the columns of the enforced nodes that the BCs eliminated
+   *            (to move them to the right hand side), the rows of the enforced nodes are then zero.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  template<class ScalarType>
+  void ElementMatrixProduct(const CSysVector<ScalarType>& u, CSysVector<ScalarType>& v, bool dirichletColumns,
+                            CGeometry *geometry, const CConfig *config);
+
+  /*!
+   * \brief Matrix-free product used by the linear solvers, the halo values of the result are communicated.
+   * \param[in] u - Vector being multiplied.
+   * \param[out] v - Result of the product.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void MatrixFreeProduct(const CSysVector<ScalarImplicit>& u, CSysVector<ScalarImplicit>& v,
+                         CGeometry *geometry, CConfig *config);
+
+  /*!
+   * \brief Enforce the solution at a node, on the assembled matrix or, when matrix-free, marking the node for the products.
+   * \param[in] iPoint - Index of the node.
+   * \param[in] x_i - Value of the solution.
+   */
+  void EnforceSolutionAtNode(unsigned long iPoint, const su2double* x_i);
+
+  /*!
+   * \brief Allocate the records of the reference gradients of the elements (FEA_GRADIENT_CACHE),
+   *        they are filled by the next assembly of the stiffness matrix.
+   * \param[in] geometry - Geometrical definition of the problem.
+   */
+  void InitializeGradCache(CGeometry *geometry);
+
+  /*!
+   * \brief Point an element to its record of reference gradients, for its next ComputeGrad_Linear.
+   * \param[in] element - Element (of the calling thread) set with the coordinates of iElem.
+   * \param[in] EL_KIND - Kind of element.
+   * \param[in] iElem - Index of the element.
+   * \param[in] fill - The caller visits all elements, the records can be filled if they are not yet.
+   */
+  inline void SetElementGradCache(CElement* element, int EL_KIND, unsigned long iElem, bool fill) {
+    if (grad_cache_ready || (fill && !GradCachePos.empty()))
+      element->SetGradCache(GradCache[EL_KIND].data() + GradCachePos[iElem], grad_cache_ready);
+  }
+
+  /*!
+   * \brief Quasi-Newton (L-BFGS) step, the inverse of the frozen tangent corrected by the updates of the last steps.
+   *        Or, if the line search is active and the residual along the last step did not drop enough, a correction
+   *        of the length of that step (secant method) that does not require a linear solve.
+   * \note Called by all threads of the parallel region of Solve_System, with the residual (and BCs) in LinSysRes.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \return Number of linear iterations.
+   */
+  unsigned long QuasiNewtonStep(CGeometry *geometry, CConfig *config);
+
   /*!
    * \brief Write the forward mode gradient to file.
    * \param[in] config - Definition of the particular problem.
@@ -564,6 +683,11 @@ public:
    */
   inline su2double GetRes_FEM(unsigned short val_var) const final { return Conv_Check[val_var]; }
 
+  /*!
+   * \brief Whether the frozen tangent should be recomputed, decided on the last call to Solve_System.
+   */
+  inline bool GetTangentRefresh(void) const final { return tangent_refresh; }
+
   /*!
    * \brief Provide the maximum Von Mises Stress for structural analysis.
    * \return Value of the maximum Von Mises Stress.
@@ -689,6 +813,16 @@ public:
                             CConfig *fea_config,
                             CSolver ***fea_solution) final;
 
+  /*!
+   * \brief Interface quasi-Newton (IQN-ILS) update of the predicted displacements of the FSI interface.
+   * \note The inverse Jacobian of the interface residual is modelled by least squares from the differences
+   *       of the previous coupling iterations (optionally of previous time steps). Without history the
+   *       update reduces to a relaxation with the static parameter.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetIQN_Relaxation(CGeometry *geometry, const CConfig *config);
+
   /*!
    * \brief Aitken's relaxation of the solution.
    * \param[in] fea_geometry - Geometrical definition of the problem.
@@ -29,6 +29,7 @@
 #pragma once
 
 #include "CSolver.hpp"
+#include "../../../Common/include/linear_algebra/CMatrixVectorProduct.hpp"
 
 /*!
  * \class CFEM_DG_EulerSolver
@@ -44,6 +45,8 @@ protected:
   su2double Gamma_Minus_One; /*!< \brief Fluids's Gamma - 1.0  . */
 
   CFluidModel  *FluidModel; /*!< \brief fluid model used in the solver */
+  vector<CFluidModel*> FluidModelThreads; /*!< \brief Fluid model of each thread that carries out tasks,
+                                               the first one is FluidModel. */
 
   su2double
   Mach_Inf,         /*!< \brief Mach number at infinity. */
@@ -178,6 +181,8 @@ protected:
 
   vector<su2double> VecSolDOFsPredictorADER; /*!< \brief Vector, which stores the ADER predictor solution in the owned
                                                          DOFs. These are both space and time DOFs. */
+  vector<float> VecSolDOFsPredictorADERFloat; /*!< \brief Single precision version of VecSolDOFsPredictorADER, which is
+                                                           used instead when ADER_PREDICTOR_SINGLE_PRECISION is set. */
 
   vector<vector<su2double> > VecWorkSolDOFs; /*!< \brief Working double vector to store the conserved variables for
                                                          the DOFs for the different time levels. */
@@ -188,6 +193,24 @@ protected:
   vector<su2double> VecTotResDOFsADER;  /*!< \brief Vector, which stores the accumulated residuals of the
                                                     owned DOFs for the ADER corrector step. */
 
+  vector<su2double> VecResDOFsMG;           /*!< \brief Vector, which stores the residuals of the owned DOFs before the
+                                                        multiplication with the inverse mass matrix (p-multigrid). */
+  vector<su2double> VecForcingTermMG;       /*!< \brief Vector, which stores the forcing term of the owned DOFs on a
+                                                        coarse p-multigrid level. */
+  vector<su2double> VecSolDOFsRestrictedMG; /*!< \brief Vector, which stores the restricted solution of the owned DOFs
+                                                        on a coarse p-multigrid level. */
+
+  vector<unsigned long>  elemFineMG;    /*!< \brief The owned element of the next finer p-multigrid level for
+                                                    every owned element. */
+  vector<unsigned short> indTransferMG; /*!< \brief The index of the transfer operators for every owned element. */
+
+  vector<vector<su2double> > matProlongationMG;   /*!< \brief Prolongation matrices to the next finer level, i.e. the
+                                                              basis functions of this level in the fine DOFs. */
+  vector<vector<su2double> > matResRestrictionMG; /*!< \brief Restriction matrices of the residual, the transpose
+                                                              of the prolongation matrices. */
+  vector<vector<su2double> > matSolRestrictionMG; /*!< \brief Restriction matrices of the solution, i.e. the basis
+                                                              functions of the finer level in the DOFs of this level. */
+
 
   vector<unsigned long> nEntriesResFaces; /*!< \brief Number of entries for the DOFs in the
                                                       residual of the faces. Cumulative storage. */
@@ -228,10 +251,47 @@ protected:
                                                                   the color does not contribute to the Jacobian
                                                                   of the DOF. */
 
+  vector<su2double> VecResDOFsImplicit;   /*!< \brief Residual of the owned DOFs of the state around which the
+                                                     implicit system is linearized. */
+  vector<su2double> timeTermJacobian;     /*!< \brief Pseudo time term of the owned DOFs present in the Jacobian. */
+  su2double finDiffStepImplicit = 0.0;    /*!< \brief Absolute step of the finite differences of the matrix-free
+                                                     products, for a direction with unit rms. */
+  unsigned long nIterImplicit = 0;        /*!< \brief Number of implicit iterations carried out, to determine
+                                                     when the Jacobian must be updated. */
+
   CBlasStructure *blasFunctions; /*!< \brief  Pointer to the object to carry out the BLAS functionalities. */
 
 private:
 
+#ifndef CODI_FORWARD_TYPE
+  using ScalarImplicit = su2mixedfloat;
+#else
+  using ScalarImplicit = su2double;
+#endif
+
+  /*!
+   * \brief Matrix-free product of the implicit system, which calls back the solver to evaluate the residuals.
+   */
+  class CMatrixFreeProduct final : public CMatrixVectorProduct<ScalarImplicit> {
+  private:
+    CFEM_DG_EulerSolver& solver;  /*!< \brief Solver that evaluates the products. */
+    CGeometry *geometry;          /*!< \brief Geometrical definition of the problem. */
+    CSolver **solver_container;   /*!< \brief Container vector with all the solutions. */
+    CNumerics **numerics;         /*!< \brief Description of the numerical method. */
+    CConfig *config;              /*!< \brief Definition of the particular problem. */
+    unsigned short iMesh;         /*!< \brief Index of the mesh in multigrid computations. */
+  public:
+    CMatrixFreeProduct(CFEM_DG_EulerSolver& solver_ref, CGeometry *geometry_ptr,
+                       CSolver **solver_container_ptr, CNumerics **numerics_ptr,
+                       CConfig *config_ptr, unsigned short val_iMesh) :
+      solver(solver_ref), geometry(geometry_ptr), solver_container(solver_container_ptr),
+      numerics(numerics_ptr), config(config_ptr), iMesh(val_iMesh) {}
+
+    inline void operator()(const CSysVector<ScalarImplicit> & u, CSysVector<ScalarImplicit> & v) const override {
+      solver.MatrixFreeProduct(u, v, geometry, solver_container, numerics, config, iMesh);
+    }
+  };
+
 #ifdef HAVE_MPI
   vector<vector<SU2_MPI::Request> > commRequests;  /*!< \brief Communication requests in the communication of the solution for all
                                                                time levels. These are both sending and receiving requests. */
@@ -267,6 +327,11 @@ private:
   vector<CTaskDefinition> tasksList; /*!< \brief List of tasks to be carried out in the computationally
                                                  intensive part of the solver. */
 
+  vector<vector<passivedouble> > elemCostThreads; /*!< \brief Measured cost of the owned elements, accumulated
+                                                               per thread, when the element cost is measured. */
+  long nTimeStepsElemCost = -1;                   /*!< \brief Number of time steps over which the cost is accumulated,
+                                                               negative during the first (warm up) time step. */
+
   CVariable* GetBaseClassPointerToNodes() final {return nullptr;}
 
 public:
@@ -456,6 +521,43 @@ public:
                           CConfig        *config,
                           unsigned short iMesh) final;
 
+  /*!
+   * \brief Function, which carries out a task of the list of tasks of the DG solver.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] task - The task to be carried out.
+   * \param[in] elemBeg - Begin index of the element range, only for the tasks that
+                          are split in chunks of elements.
+   * \param[in] elemEnd - End index (not included) of the element range, idem.
+   * \param[out] workArray - Work array of the calling thread.
+   */
+  void CarryOutTask_DG(CConfig               *config,
+                       CNumerics             **numerics,
+                       const CTaskDefinition &task,
+                       const unsigned long   elemBeg,
+                       const unsigned long   elemEnd,
+                       su2double             *workArray);
+
+  /*!
+   * \brief Function, which adds the measured time of a task to the cost of the owned
+            elements it concerns, proportional to their number of DOFs.
+   * \param[in] task    - The task that has been carried out.
+   * \param[in] elemBeg - Begin index of the element range, see CarryOutTask_DG.
+   * \param[in] elemEnd - End index (not included) of the element range, idem.
+   * \param[in] time    - Measured time of the task.
+   */
+  void AddElementCost(const CTaskDefinition &task,
+                      const unsigned long   elemBeg,
+                      const unsigned long   elemEnd,
+                      const passivedouble   time);
+
+  /*!
+   * \brief Function, which writes the measured cost per update of all elements, in the order
+            of the global element ID, such that it can be used to partition a restart.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void WriteElementCost(CConfig *config);
+
   /*!
    * \brief Function, to carry out the space time integration for ADER
             with time accurate local time stepping.
@@ -487,6 +589,82 @@ public:
                               unsigned short iMesh,
                               unsigned short RunTime_EqSystem) final;
 
+  /*!
+   * \brief Function, which carries out one iteration of the implicit (Newton-Krylov) method for
+            steady problems. The system (I/dt + dR/dU) dU = -R, with R the residual multiplied
+            by the inverse mass matrix, is solved with the matrix-free products. Its matrix,
+            assembled for the couplings of the owned DOFs, is used as preconditioner.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   */
+  void ImplicitNewtonKrylov_Iteration(CGeometry      *geometry,
+                                      CSolver        **solver_container,
+                                      CNumerics      **numerics,
+                                      CConfig        *config,
+                                      unsigned short iMesh) final;
+
+  /*!
+   * \brief Function, which restricts the solution of the next finer p-multigrid level to this
+            level by interpolation in the DOFs. The restricted solution is stored and the forcing
+            term is reset, such that the residual of the restricted solution can be computed.
+   * \param[in] sol_fine - Solver of the next finer p-multigrid level.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetRestricted_Solution_FEM(CSolver *sol_fine, CConfig *config) final;
+
+  /*!
+   * \brief Function, which computes the forcing term of the Full Approximation Scheme,
+            P = I(r_fine) - r(I(u_fine)), with I(r_fine) the Galerkin restriction of the fine residual.
+   * \param[in] sol_fine - Solver of the next finer p-multigrid level.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetForcing_Term_FEM(CSolver *sol_fine, CConfig *config) final;
+
+  /*!
+   * \brief Function, which adds the prolongation of the correction of this p-multigrid level,
+            u - I(u_fine), to the solution of the next finer level.
+   * \param[in] sol_fine - Solver of the next finer p-multigrid level.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetProlongated_Correction_FEM(CSolver *sol_fine, CConfig *config) final;
+
+  /*!
+   * \brief Function, which computes the Jacobian of the implicit system by finite differences
+            with the coloring of the DOFs. Only the couplings between the owned DOFs are stored.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   */
+  void ComputeJacobianImplicit(CGeometry      *geometry,
+                               CSolver        **solver_container,
+                               CNumerics      **numerics,
+                               CConfig        *config,
+                               unsigned short iMesh);
+
+  /*!
+   * \brief Function, which computes the product of the matrix of the implicit system and a vector
+            by finite differences, v = u/dt + (R(U+eps*u) - R(U))/eps.
+   * \param[in]  u - Vector to multiply.
+   * \param[out] v - Result of the product.
+   * \param[in]  geometry - Geometrical definition of the problem.
+   * \param[in]  solver_container - Container vector with all the solutions.
+   * \param[in]  numerics - Description of the numerical method.
+   * \param[in]  config - Definition of the particular problem.
+   * \param[in]  iMesh - Index of the mesh in multigrid computations.
+   */
+  void MatrixFreeProduct(const CSysVector<ScalarImplicit> &u,
+                         CSysVector<ScalarImplicit>       &v,
+                         CGeometry                        *geometry,
+                         CSolver                          **solver_container,
+                         CNumerics                        **numerics,
+                         CConfig                          *config,
+                         unsigned short                   iMesh);
+
   /*!
    * \brief Function, which determines the values of the tolerances in
             the predictor step of ADER-DG.
@@ -635,7 +813,7 @@ public:
                     bool           Output) final;
 
   /*!
-   * \brief
+   * \brief Function, which writes the measured cost of the elements, if needed.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] solver_container - Container vector with all the solutions.
    * \param[in] config - Definition of the particular problem.
@@ -1602,6 +1780,13 @@ private:
                                            const unsigned long elemEnd,
                                            su2double           *workArray);
 
+  /*!
+   * \brief Function, which creates the mapping to the elements of the next finer p-multigrid
+            level and the transfer operators between the standard elements of both levels.
+   * \param[in] solFine - Solver of the next finer p-multigrid level.
+   */
+  void SetTransferOperatorsMG(const CFEM_DG_EulerSolver *solFine);
+
   /*!
    * \brief Function, which computes the residual contribution from a boundary
             face in an inviscid computation when the boundary conditions have
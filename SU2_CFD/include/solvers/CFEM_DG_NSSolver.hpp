@@ -861,6 +861,44 @@ private:
                                    su2double         *viscosityInt,
                                    su2double         *kOverCvInt);
 
+  /*!
+   * \brief Function to compute the viscous normal fluxes in the integration points of a face
+            in batches of SIZE_BATCH_FACE points. The data of a batch is gathered in
+            "structure of arrays" layout, such that the arithmetic vectorizes across the
+            points. Only the fluid model and the SGS model are evaluated per point.
+   * \param[in]   indFaceChunk        - Index of the face in the chunk of fused faces.
+   * \param[in]   nInt                - Number of integration points of the face.
+   * \param[in]   NPad                - Value of the padding parameter to obtain optimal
+                                        performance in the gemm computations.
+   * \param[in]   HeatFlux            - Value of the prescribed heat flux, zero if not prescribed.
+   * \param[in]   factHeatFlux        - Multiplication factor for the computed heat flux.
+   * \param[in]   lenScale_LES        - LES length scale of the adjacent element.
+   * \param[in]   solInt              - Solution in the integration points.
+   * \param[in]   gradSolInt          - Gradient of the solution in the integration points.
+   * \param[in]   metricCoorDerivFace - Derivatives of the parametric coordinates w.r.t. the
+                                        Cartesian coordinates in the integration points.
+   * \param[in]   metricNormalsFace   - Normals in the integration points.
+   * \param[in]   wallDistanceInt     - Wall distances in the integration points of the face.
+   * \param[out]  viscNormFluxes      - Viscous normal fluxes in the integration points.
+   * \param[out]  viscosityInt        - Viscosity in the integration points.
+   * \param[out]  kOverCvInt          - Thermal conductivity over Cv in the integration points.
+   */
+  template<unsigned short NDIM>
+  void ViscousNormalFluxFaceBatch(const unsigned short indFaceChunk,
+                                  const unsigned short nInt,
+                                  const unsigned short NPad,
+                                  const su2double      HeatFlux,
+                                  const su2double      factHeatFlux,
+                                  const su2double      lenScale_LES,
+                                  const su2double      *solInt,
+                                  const su2double      *gradSolInt,
+                                  const su2double      *metricCoorDerivFace,
+                                  const su2double      *metricNormalsFace,
+                                  const su2double      *wallDistanceInt,
+                                        su2double      *viscNormFluxes,
+                                        su2double      *viscosityInt,
+                                        su2double      *kOverCvInt);
+
   /*!
    * \brief Function to compute the viscous normal flux in one integration point for a
             2D simulation.
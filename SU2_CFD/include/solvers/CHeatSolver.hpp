@@ -29,6 +29,7 @@
 
 #include "CSolver.hpp"
 #include "../variables/CHeatVariable.hpp"
+#include "../../../Common/include/omp_structure.hpp"
 
 /*!
  * \class CHeatSolver
@@ -38,13 +39,37 @@
  */
 class CHeatSolver final : public CSolver {
 protected:
-  unsigned short nVarFlow, nMarker, CurrentMesh;
+  enum : size_t {MAXNDIM = 3};         /*!< \brief Max number of space dimensions, used in some static arrays. */
+  enum : size_t {MAXNVAR = 1};         /*!< \brief Max number of variables, used in some static arrays. */
+  enum : size_t {MAXNVARFLOW = 12};    /*!< \brief Max number of flow variables, used in some static arrays. */
+
+  enum : size_t {OMP_MAX_SIZE = 512};  /*!< \brief Max chunk size for light point loops. */
+  enum : size_t {OMP_MIN_SIZE = 32};   /*!< \brief Min chunk size for edge loops (max is color group size). */
+
+  unsigned long omp_chunk_size; /*!< \brief Chunk size used in light point loops. */
+
+  unsigned short nMarker, CurrentMesh;
   su2double **HeatFlux, *HeatFlux_per_Marker, *Surface_HF, Total_HeatFlux, AllBound_HeatFlux,
             *AverageT_per_Marker, Total_AverageT, AllBound_AverageT,
-            *Primitive, *Primitive_Flow_i, *Primitive_Flow_j,
-            *Surface_Areas, Total_HeatFlux_Areas, Total_HeatFlux_Areas_Monitor;
+            *Primitive, *Surface_Areas, Total_HeatFlux_Areas, Total_HeatFlux_Areas_Monitor;
   su2double ***ConjugateVar, ***InterfaceVar;
 
+  su2double Global_Delta_Time = 0.0; /*!< \brief Time-step for TIME_STEPPING time marching strategy. */
+
+  /*--- Shallow copy of grid coloring for OpenMP parallelization. ---*/
+
+#ifdef HAVE_OMP
+  vector<GridColor<> > EdgeColoring;   /*!< \brief Edge colors. */
+  bool ReducerStrategy = false;        /*!< \brief If the reducer strategy is in use. */
+#else
+  array<DummyGridColor<>,1> EdgeColoring;
+  /*--- Never use the reducer strategy if compiling for MPI-only. ---*/
+  static constexpr bool ReducerStrategy = false;
+#endif
+
+  /*--- Edge fluxes for reducer strategy (see the notes in CEulerSolver.hpp). ---*/
+  CSysVector<su2double> EdgeFluxes; /*!< \brief Flux across each edge. */
+
   CHeatVariable* nodes = nullptr;  /*!< \brief The highest level in the variable hierarchy this solver can safely use. */
 
   /*!
@@ -52,6 +77,12 @@ protected:
    */
   inline CVariable* GetBaseClassPointerToNodes() override { return nodes; }
 
+  /*!
+   * \brief Sum the edge fluxes for each cell to populate the residual vector (reducer strategy).
+   * \param[in] geometry - Geometrical definition of the problem.
+   */
+  void SumEdgeFluxes(CGeometry* geometry);
+
 public:
 
   /*!
@@ -366,4 +397,14 @@ public:
    */
   inline su2double GetHeatFlux(unsigned short val_marker, unsigned long val_vertex) const override { return HeatFlux[val_marker][val_vertex]; }
 
+  /*!
+   * \brief The heat solver supports MPI+OpenMP.
+   */
+  inline bool GetHasHybridParallel() const override { return true; }
+
+  /*!
+   * \brief The weak BCs of the heat solver (inlet and outlet) support MPI+OpenMP.
+   */
+  inline bool GetHasHybridParallelBC() const override { return true; }
+
 };
@@ -30,6 +30,7 @@
 
 #include "CSolver.hpp"
 #include "../variables/CIncEulerVariable.hpp"
+#include "../../../Common/include/omp_structure.hpp"
 
 /*!
  * \class CIncEulerSolver
@@ -39,6 +40,13 @@
  */
 class CIncEulerSolver : public CSolver {
 protected:
+  enum : size_t {MAXNDIM = 3};    /*!< \brief Max number of space dimensions, used in some static arrays. */
+  enum : size_t {MAXNVAR = 12};   /*!< \brief Max number of variables, used in some static arrays. */
+
+  enum : size_t {OMP_MAX_SIZE = 512};  /*!< \brief Max chunk size for light point loops. */
+  enum : size_t {OMP_MIN_SIZE = 32};   /*!< \brief Min chunk size for edge loops (max is color group size). */
+
+  unsigned long omp_chunk_size;  /*!< \brief Chunk size used in light point loops. */
 
   su2double
   Density_Inf,      /*!< \brief Density at the infinity. */
@@ -204,14 +212,35 @@ protected:
   *Primitive_i,          /*!< \brief Auxiliary nPrimVar vector for storing the primitive at point i. */
   *Primitive_j;          /*!< \brief Auxiliary nPrimVar vector for storing the primitive at point j. */
 
-  CFluidModel  *FluidModel;   /*!< \brief fluid model used in the solver */
-  su2double **Preconditioner; /*!< \brief Auxiliary matrix for storing the low speed preconditioner. */
+  vector<CFluidModel*> FluidModel;   /*!< \brief fluid model used in the solver (one per thread). */
+  su2double **Preconditioner;        /*!< \brief Auxiliary matrix for storing the low speed preconditioner. */
+
+  unsigned long ErrorCounter = 0;    /*!< \brief Counter for number of un-physical states. */
+
+  su2double Global_Delta_Time = 0.0, /*!< \brief Time-step for TIME_STEPPING time marching strategy. */
+  Global_Delta_UnstTimeND = 0.0,     /*!< \brief Unsteady time step for the dual time strategy. */
+  MaxVel2 = 0.0;                     /*!< \brief Maximum squared velocity, for the artificial compressibility parameter. */
 
   /* Sliding meshes variables */
 
   su2double ****SlidingState;
   int **SlidingStateNodes;
 
+  /*--- Shallow copy of grid coloring for OpenMP parallelization. ---*/
+
+#ifdef HAVE_OMP
+  vector<GridColor<> > EdgeColoring;   /*!< \brief Edge colors. */
+  bool ReducerStrategy = false;        /*!< \brief If the reducer strategy is in use. */
+#else
+  array<DummyGridColor<>,1> EdgeColoring;
+  /*--- Never use the reducer strategy if compiling for MPI-only. ---*/
+  static constexpr bool ReducerStrategy = false;
+#endif
+
+  /*--- Edge fluxes, for OpenMP parallelization of difficult-to-color grids (see CEulerSolver). ---*/
+
+  CSysVector<su2double> EdgeFluxes; /*!< \brief Flux across each edge. */
+
   CIncEulerVariable* nodes = nullptr;  /*!< \brief The highest level in the variable hierarchy this solver can safely use. */
 
   /*!
@@ -219,6 +248,64 @@ protected:
    */
   inline CVariable* GetBaseClassPointerToNodes() final { return nodes; }
 
+  /*!
+   * \brief Set up the edge coloring (or the reducer strategy) and the chunk size of point loops
+   *        for the hybrid parallel (MPI+OpenMP) execution, common to the Euler and NS constructors.
+   * \note Must be called before the Jacobian is initialized.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void HybridParallelInitialization(CGeometry *geometry, CConfig *config);
+
+  /*!
+   * \brief Sum the edge fluxes for each cell to populate the residual vector, only used on coarse grids.
+   * \param[in] geometry - Geometrical definition of the problem.
+   */
+  void SumEdgeFluxes(CGeometry* geometry);
+
+  /*!
+   * \brief Compute the viscous flux and Jacobians for a particular edge, without updating the system.
+   * \note The convective residual methods combine this with the convective contribution, such that
+   *       the residual and Jacobian are updated once per edge (see UpdateEdgeContribution).
+   * \param[in] iEdge - Edge for which the flux and Jacobians are to be computed.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \return View of the flux and Jacobians stored by the numerics, null for inviscid problems.
+   */
+  inline virtual CNumerics::ResidualType<> ViscousEdgeResidual(unsigned long iEdge, CGeometry *geometry,
+                                                               CSolver **solver_container,
+                                                               CNumerics *numerics, CConfig *config) {
+    return CNumerics::ResidualType<>(nullptr, nullptr, nullptr);
+  }
+
+  /*!
+   * \brief Update the residual and Jacobian with the convective and (optional) viscous contributions
+   *        of an edge, the two are summed before updating the system to traverse its data once.
+   * \param[in] iEdge - Edge of the contributions.
+   * \param[in] iPoint - First point of the edge.
+   * \param[in] jPoint - Second point of the edge.
+   * \param[in] implicit - Whether to update the Jacobian.
+   * \param[in] flux - Convective flux from i to j.
+   * \param[in] jacobian_i - Convective Jacobian w.r.t. the state at i.
+   * \param[in] jacobian_j - Convective Jacobian w.r.t. the state at j.
+   * \param[in] viscous - Viscous contribution (see ViscousEdgeResidual), may be null.
+   */
+  void UpdateEdgeContribution(unsigned long iEdge, unsigned long iPoint, unsigned long jPoint,
+                              bool implicit, const su2double* flux, const su2double* const* jacobian_i,
+                              const su2double* const* jacobian_j, const CNumerics::ResidualType<>& viscous);
+
+  /*!
+   * \brief Compute the preconditioner for low-Mach flows.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iPoint - Index of the grid point.
+   * \param[in] delta - Volume over delta t (scaling factor of the matrix).
+   * \param[in,out] preconditioner - The preconditioner matrix, must be allocated outside.
+   */
+  void SetPreconditioner(const CConfig *config, unsigned long iPoint,
+                         su2double delta, su2double** preconditioner) const;
+
 public:
 
   /*!
@@ -249,7 +336,7 @@ public:
    * \brief Compute the pressure at the infinity.
    * \return Value of the pressure at the infinity.
    */
-  inline CFluidModel* GetFluidModel(void) const final { return FluidModel;}
+  inline CFluidModel* GetFluidModel(void) const final { return FluidModel[omp_get_thread_num()]; }
 
   /*!
    * \brief Compute the density at the infinity.
@@ -311,7 +398,7 @@ public:
   }
 
   /*!
-   * \brief Compute the time step for solving the Euler equations.
+   * \brief Compute the time step for solving the Euler and Navier-Stokes equations.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] solver_container - Container vector with all the solutions.
    * \param[in] config - Definition of the particular problem.
@@ -322,7 +409,7 @@ public:
                     CSolver **solver_container,
                     CConfig *config,
                     unsigned short iMesh,
-                    unsigned long Iteration) override;
+                    unsigned long Iteration) final;
 
   /*!
    * \brief Compute the spatial integration using a centered scheme.
@@ -656,6 +743,26 @@ public:
                                CSolver **solver_container,
                                CConfig *config) final;
 
+  /*!
+   * \brief Build the implicit system (pseudo time term, right hand side, initial guess) and monitor the residuals.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void PrepareImplicitIteration(CGeometry *geometry,
+                                CSolver **solver_container,
+                                CConfig *config) final;
+
+  /*!
+   * \brief Update the solution with the (under-relaxed) solution of the implicit system.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void CompleteImplicitIteration(CGeometry *geometry,
+                                 CSolver **solver_container,
+                                 CConfig *config) final;
+
   /*!
    * \brief Compute a suitable under-relaxation parameter to limit the change in the solution variables over a nonlinear iteration for stability.
    * \param[in] solver - Container vector with all the solutions.
@@ -1370,13 +1477,6 @@ public:
                          CConfig *config,
                          unsigned short iMesh) final;
 
-  /*!
-   * \brief Compute the preconditioner for low-Mach flows.
-   * \param[in] iPoint - Index of the grid point
-   * \param[in] config - Definition of the particular problem.
-   */
-  void SetPreconditioner(CConfig *config, unsigned long iPoint) final;
-
   /*!
    * \brief Value of the total temperature at an inlet boundary.
    * \param[in] val_marker - Surface marker where the total temperature is evaluated.
@@ -1548,4 +1648,9 @@ public:
    */
   void ComputeVerificationError(CGeometry *geometry, CConfig *config) final;
 
+  /*!
+   * \brief The incompressible Euler and NS solvers support MPI+OpenMP (except the BC bits).
+   */
+  inline bool GetHasHybridParallel() const final { return true; }
+
 };
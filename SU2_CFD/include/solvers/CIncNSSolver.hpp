@@ -96,6 +96,19 @@ private:
   StrainMag_Max,
   Omega_Max;            /*!< \brief Maximum Strain Rate magnitude and Omega. */
 
+  /*!
+   * \brief Point loop of SetPrimitive_Variables for the polynomial ideal gas with polynomial viscosity and
+   *        conductivity, the (non-virtual) evaluations of the models are inlined and vectorize across batches of points.
+   * \note Non-physical states are handled point by point as in the generic loop.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] Output - boolean to determine whether to print output.
+   * \tparam ConductivityModelType - Type of the conductivity model (laminar or RANS polynomial conductivity).
+   * \return The number of non-physical points (of this thread).
+   */
+  template<class ConductivityModelType>
+  unsigned long SetPrimitive_Variables_Batched(CSolver **solver_container, const CConfig *config, bool Output);
+
 public:
 
   /*!
@@ -275,20 +288,6 @@ public:
    */
   inline su2double GetTke_Inf(void) const override { return Tke_Inf; }
 
-  /*!
-   * \brief Compute the time step for solving the Navier-Stokes equations with turbulence model.
-   * \param[in] geometry - Geometrical definition of the problem.
-   * \param[in] solver_container - Container vector with all the solutions.
-   * \param[in] config - Definition of the particular problem.
-   * \param[in] iMesh - Index of the mesh in multigrid computations.
-   * \param[in] Iteration - Index of the current iteration.
-   */
-  void SetTime_Step(CGeometry *geometry,
-                    CSolver **solver_container,
-                    CConfig *config,
-                    unsigned short iMesh,
-                    unsigned long Iteration) override;
-
   /*!
    * \brief Restart residual and compute gradients.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -434,20 +433,17 @@ public:
   inline su2double GetCD_Visc(unsigned short val_marker) const override { return CD_Visc[val_marker]; }
 
   /*!
-   * \brief Compute the viscous residuals.
+   * \brief Compute the viscous flux and Jacobians for a particular edge, without updating the system.
+   * \param[in] iEdge - Edge for which the flux and Jacobians are to be computed.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] solver_container - Container vector with all the solutions.
-   * \param[in] numerics_container - Description of the numerical method.
+   * \param[in] numerics - Description of the numerical method.
    * \param[in] config - Definition of the particular problem.
-   * \param[in] iMesh - Index of the mesh in multigrid computations.
-   * \param[in] iRKStep - Current step of the Runge-Kutta iteration.
+   * \return View of the flux and Jacobians stored by the numerics.
    */
-  void Viscous_Residual(CGeometry *geometry,
-                        CSolver **solver_container,
-                        CNumerics **numerics_container,
-                        CConfig *config,
-                        unsigned short iMesh,
-                        unsigned short iRKStep) override;
+  CNumerics::ResidualType<> ViscousEdgeResidual(unsigned long iEdge, CGeometry *geometry,
+                                                CSolver **solver_container,
+                                                CNumerics *numerics, CConfig *config) override;
 
   /*!
    * \brief Get the skin friction coefficient.
@@ -39,6 +39,14 @@ protected:
 
   bool stiffness_set;          /*!< \brief Element-based stiffness is set. */
 
+  bool reuse_stiffness;        /*!< \brief The stiffness matrix is only assembled for the first deformation. */
+  bool stiffness_assembled;    /*!< \brief The stiffness matrix, with the boundary conditions, is assembled. */
+
+  vector<unsigned long> liftNode;  /*!< \brief Nodes with imposed displacement, whose columns the boundary conditions eliminate. */
+  vector<unsigned long> liftPtr;   /*!< \brief Start of the eliminated blocks of every node of liftNode. */
+  vector<unsigned long> liftRow;   /*!< \brief Row (free node) of every eliminated block. */
+  vector<su2double> liftBlock;     /*!< \brief Eliminated blocks, nVar*nVar values each. */
+
   su2double MinVolume_Ref,     /*!< \brief Minimum volume in reference and current (deformed) configuration. */
             MinVolume_Curr;
 
@@ -101,6 +109,20 @@ protected:
    */
   void SetBoundaryDisplacements(CGeometry *geometry, CNumerics *numerics, CConfig *config);
 
+  /*!
+   * \brief Store the blocks of the assembled stiffness matrix that the boundary conditions move to the
+   *        right hand side, i.e. the columns of the nodes with imposed displacement on the free rows.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetLiftingBlocks(CGeometry *geometry, CConfig *config);
+
+  /*!
+   * \brief Add the contribution of the imposed displacements to the free rows of the right hand side,
+   *        which is what the boundary conditions do when they are applied to the assembled matrix.
+   */
+  void AddLiftingResidual();
+
 public:
   /*!
    * \brief Constructor of the class.
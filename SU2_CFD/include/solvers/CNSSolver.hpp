@@ -430,6 +430,19 @@ public:
   void Viscous_Residual(unsigned long iEdge, CGeometry *geometry, CSolver **solver_container,
                         CNumerics *numerics, CConfig *config) override;
 
+  /*!
+   * \brief Compute the viscous flux and Jacobians for a particular edge, without updating the system.
+   * \param[in] iEdge - Edge for which the flux and Jacobians are to be computed.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \return View of the flux and Jacobians stored by the numerics.
+   */
+  CNumerics::ResidualType<> ViscousEdgeResidual(unsigned long iEdge, CGeometry *geometry,
+                                                CSolver **solver_container,
+                                                CNumerics *numerics, CConfig *config) override;
+
   /*!
    * \brief Get the skin friction coefficient.
    * \param[in] val_marker - Surface marker where the coefficient is computed.
@@ -506,6 +519,7 @@ public:
 
   /*!
    * \brief Computes the wall shear stress (Tau_Wall) on the surface using a wall function.
+   * \note Called by all threads, the iterations start from the previous values.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] solver_container - Container vector with all the solutions.
    * \param[in] config - Definition of the particular problem.
@@ -256,4 +256,9 @@ public:
    */
   inline su2double GetTemperature_Inf(void) const { return Temperature_Inf; }
 
+  /*!
+   * \brief The P1 solver supports MPI+OpenMP (the boundary conditions are applied by the master thread).
+   */
+  inline bool GetHasHybridParallel() const override { return true; }
+
 };
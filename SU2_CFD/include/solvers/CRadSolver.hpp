@@ -29,6 +29,7 @@
 
 #include "CSolver.hpp"
 #include "../variables/CRadVariable.hpp"
+#include "../../../Common/include/omp_structure.hpp"
 
 class CRadSolver : public CSolver {
 protected:
@@ -36,6 +37,27 @@ protected:
   su2double Absorption_Coeff;  /*!< \brief Absorption coefficient. */
   su2double Scattering_Coeff;  /*!< \brief Scattering coefficient. */
 
+  enum : size_t {MAXNVAR = 1};         /*!< \brief Max number of variables, used in some static arrays. */
+
+  enum : size_t {OMP_MAX_SIZE = 512};  /*!< \brief Max chunk size for light point loops. */
+  enum : size_t {OMP_MIN_SIZE = 32};   /*!< \brief Min chunk size for edge loops (max is color group size). */
+
+  unsigned long omp_chunk_size; /*!< \brief Chunk size used in light point loops. */
+
+  /*--- Shallow copy of grid coloring for OpenMP parallelization. ---*/
+
+#ifdef HAVE_OMP
+  vector<GridColor<> > EdgeColoring;   /*!< \brief Edge colors. */
+  bool ReducerStrategy = false;        /*!< \brief If the reducer strategy is in use. */
+#else
+  array<DummyGridColor<>,1> EdgeColoring;
+  /*--- Never use the reducer strategy if compiling for MPI-only. ---*/
+  static constexpr bool ReducerStrategy = false;
+#endif
+
+  /*--- Edge fluxes for reducer strategy (see the notes in CEulerSolver.hpp). ---*/
+  CSysVector<su2double> EdgeFluxes; /*!< \brief Flux across each edge. */
+
   CRadVariable* nodes = nullptr;  /*!< \brief The highest level in the variable hierarchy this solver can safely use. */
 
   /*!
@@ -43,6 +65,12 @@ protected:
    */
   inline CVariable* GetBaseClassPointerToNodes() override { return nodes; }
 
+  /*!
+   * \brief Sum the edge fluxes for each cell to populate the residual vector (reducer strategy).
+   * \param[in] geometry - Geometrical definition of the problem.
+   */
+  void SumEdgeFluxes(CGeometry* geometry);
+
 public:
 
   /*!
@@ -132,8 +132,26 @@ protected:
   bool rotate_periodic;    /*!< \brief Flag that controls whether the periodic solution needs to be rotated for the solver. */
   bool implicit_periodic;  /*!< \brief Flag that controls whether the implicit system should be treated by the periodic BC comms. */
 
+  bool commPending = false;         /*!< \brief Whether a halo exchange was initiated but not completed (see SetPendingComms). */
+  unsigned short pendingCommType;   /*!< \brief Type of the pending halo exchange. */
+  bool allowPendingComms = false;   /*!< \brief Whether the preprocessing may leave halo exchanges pending for the residuals. */
+
   bool dynamic_grid;       /*!< \brief Flag that determines whether the grid is dynamic (moving or deforming + grid velocities). */
 
+  vector<unsigned long> SurfGrad_Point;     /*!< \brief Wall points where the surface gradient of the auxiliary variable is computed. */
+  vector<unsigned long> SurfGrad_Ptr;       /*!< \brief Start of the stencil of each wall point in SurfGrad_Neighbor. */
+  vector<unsigned long> SurfGrad_Neighbor;  /*!< \brief Neighbors of the wall points (gradient stencils). */
+  vector<su2double> SurfGrad_Coeff;         /*!< \brief Least squares coefficients of each neighbor (nDim per neighbor). */
+  vector<unsigned long> SurfGrad_AuxPoint;  /*!< \brief Points of the stencils, each point only once. */
+
+  vector<unsigned long> WallFunc_Ptr;       /*!< \brief Start of the wall function stencils of each marker. */
+  vector<unsigned long> WallFunc_Point;     /*!< \brief Wall point of each wall function stencil. */
+  vector<unsigned long> WallFunc_Neighbor;  /*!< \brief Interior point of each wall function stencil. */
+  vector<su2double> WallFunc_UnitNormal;    /*!< \brief Unit normal into the domain at the wall point (nDim per stencil). */
+  vector<su2double> WallFunc_Dist;          /*!< \brief Distance between the interior point and the wall point. */
+  vector<su2double> WallFunc_TauWall;       /*!< \brief Last wall shear stress of each stencil, to warm start the iterations. */
+  vector<su2double> WallFunc_Value;         /*!< \brief Result of the wall function for each stencil (e.g. nu tilde). */
+
   su2double ***VertexTraction;          /*- Temporary, this will be moved to a new postprocessing structure once in place -*/
   su2double ***VertexTractionAdjoint;   /*- Also temporary -*/
 
@@ -166,8 +184,8 @@ public:
   CSysVector<su2double> LinSysRes;    /*!< \brief vector to store iterative residual of implicit linear system. */
   CSysVector<su2double> LinSysAux;    /*!< \brief vector to store iterative residual of implicit linear system. */
 #ifndef CODI_FORWARD_TYPE
-  CSysMatrix<passivedouble> Jacobian; /*!< \brief Complete sparse Jacobian structure for implicit computations. */
-  CSysSolve<passivedouble>  System;   /*!< \brief Linear solver/smoother. */
+  CSysMatrix<su2mixedfloat> Jacobian; /*!< \brief Complete sparse Jacobian structure for implicit computations. */
+  CSysSolve<su2mixedfloat>  System;   /*!< \brief Linear solver/smoother. */
 #else
   CSysMatrix<su2double> Jacobian;
   CSysSolve<su2double>  System;
@@ -200,6 +218,12 @@ public:
     return base_nodes;
   }
 
+  /*!
+   * \brief Print the memory used by each (allocated) container of the nodes, summed over all ranks.
+   * \param[in] geometry - Geometrical definition of the problem.
+   */
+  void ReportVariableMemory(const CGeometry *geometry) const;
+
   /*!
    * \brief Routine to load a solver quantity into the data structures for MPI point-to-point communication and to launch non-blocking sends and recvs.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -220,6 +244,39 @@ public:
                      CConfig *config,
                      unsigned short commType);
 
+  /*!
+   * \brief Mark an exchange started with InitiateComms() as pending, it is completed by CompletePendingComms(),
+   *        or before the next exchange is initiated (the buffers are shared).
+   * \note This allows computations that do not depend on halo data to overlap the communications.
+   * \param[in] commType - Enumerated type of the initiated exchange.
+   */
+  inline void SetPendingComms(unsigned short commType) {
+    commPending = true;
+    pendingCommType = commType;
+  }
+
+  /*!
+   * \brief Allow (or not) the preprocessing to leave halo exchanges pending, to be completed in the
+   *        computation of the residuals (see OVERLAP_HALO_COMMS), to be called by a single thread.
+   * \note The caller guarantees that the residuals are computed after each preprocessing.
+   * \param[in] allow - Whether exchanges may be left pending.
+   */
+  inline void SetAllowPendingComms(bool allow) { allowPendingComms = allow; }
+
+  /*!
+   * \brief Get whether a halo exchange is pending.
+   */
+  inline bool GetPendingComms(void) const { return commPending; }
+
+  /*!
+   * \brief Complete the pending exchange, if any, to be called by a single thread.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config   - Definition of the particular problem.
+   */
+  inline void CompletePendingComms(CGeometry *geometry, CConfig *config) {
+    if (commPending) CompleteComms(geometry, config, pendingCommType);
+  }
+
   /*!
    * \brief Routine to load a solver quantity into the data structures for MPI periodic communication and to launch non-blocking sends and recvs.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -345,6 +402,18 @@ public:
    */
   inline su2double GetAvg_CFL_Local(void) const { return Avg_CFL_Local; }
 
+  /*!
+   * \brief Get the fraction of the points whose limiters were computed in the last iteration (see LIMITER_FREEZE).
+   * \return Value of the fraction.
+   */
+  inline virtual su2double GetLimiterUpdateFraction(void) const { return 1.0; }
+
+  /*!
+   * \brief Get the fraction of the points that are not frozen by the active set updates (see ACTIVE_SET).
+   * \return Value of the fraction.
+   */
+  inline virtual su2double GetActiveSetFraction(void) const { return 1.0; }
+
   /*!
    * \brief Get the number of variables of the problem.
    */
@@ -564,6 +633,23 @@ public:
    */
   void SetAuxVar_Gradient_LS(CGeometry *geometry, CConfig *config);
 
+  /*!
+   * \brief Build the stencils of the Least Squares gradient on the walls (once, unless the grid is dynamic).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \return Points whose auxiliary variable is used by the surface gradient (wall points and their neighbors).
+   */
+  const vector<unsigned long>& SetAuxVar_Surface_Stencil(CGeometry *geometry, CConfig *config);
+
+  /*!
+   * \brief Build the stencils of the wall functions, pairs of wall (domain) point and interior point of the
+   *        viscous walls, grouped by marker (once, unless the grid is dynamic).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] allNeighbors - Use all the interior neighbors of the wall points instead of the normal neighbor.
+   */
+  void SetWallFunction_Stencil(CGeometry *geometry, const CConfig *config, bool allNeighbors);
+
   /*!
    * \brief Compute the Least Squares gradient of an auxiliar variable on the profile surface.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -713,6 +799,41 @@ public:
                                              CNumerics **numerics, CConfig *config,
                                              unsigned short iMesh, unsigned short RunTime_EqSystem) {}
 
+  /*!
+   * \brief A virtual member.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   */
+  inline virtual void ImplicitNewtonKrylov_Iteration(CGeometry *geometry,
+                                                     CSolver **solver_container,
+                                                     CNumerics **numerics,
+                                                     CConfig *config,
+                                                     unsigned short iMesh) {}
+
+  /*!
+   * \brief A virtual member.
+   * \param[in] sol_fine - Solver of the next finer p-multigrid level.
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline virtual void SetRestricted_Solution_FEM(CSolver *sol_fine, CConfig *config) {}
+
+  /*!
+   * \brief A virtual member.
+   * \param[in] sol_fine - Solver of the next finer p-multigrid level.
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline virtual void SetForcing_Term_FEM(CSolver *sol_fine, CConfig *config) {}
+
+  /*!
+   * \brief A virtual member.
+   * \param[in] sol_fine - Solver of the next finer p-multigrid level.
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline virtual void SetProlongated_Correction_FEM(CSolver *sol_fine, CConfig *config) {}
+
   /*!
    * \brief A virtual member.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -1503,6 +1624,27 @@ public:
                                               CSolver **solver_container,
                                               CConfig *config) { }
 
+  /*!
+   * \brief A virtual member, build the implicit system (first part of ImplicitEuler_Iteration).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline virtual void PrepareImplicitIteration(CGeometry *geometry,
+                                               CSolver **solver_container,
+                                               CConfig *config) { }
+
+  /*!
+   * \brief A virtual member, update the solution with the solution of the implicit system
+   *        (last part of ImplicitEuler_Iteration).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline virtual void CompleteImplicitIteration(CGeometry *geometry,
+                                                CSolver **solver_container,
+                                                CConfig *config) { }
+
   /*!
    * \brief A virtual member.
    * \param[in] solver - Container vector with all the solutions.
@@ -3670,6 +3812,22 @@ public:
                                CConfig *config,
                                string val_filename);
 
+  /*!
+   * \brief Read some of the fields of a native SU2 restart file (ASCII or binary), on any grid
+   *        (e.g. the grid of a solution to interpolate from).
+   * \param[in] geometry - Geometrical definition of the grid of the restart file.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_filename - String name of the restart file.
+   * \param[in] offset - Index of the first field read, after the coordinates.
+   * \param[in] nFields - Number of fields read.
+   * \return The fields of the domain points of the grid (iPoint, iField).
+   */
+  vector<passivedouble> ReadRestartFields(CGeometry *geometry,
+                                          CConfig *config,
+                                          string val_filename,
+                                          unsigned short offset,
+                                          unsigned short nFields);
+
   /*!
    * \brief Read the metadata from a native SU2 restart file (ASCII or binary).
    * \param[in] geometry - Geometrical definition of the problem.
@@ -4032,6 +4190,12 @@ public:
                                              CNumerics **numerics,
                                              CConfig *config) { }
 
+  /*!
+   * \brief A virtual member.
+   * \return Whether the frozen tangent (modified Newton and quasi-Newton methods) should be recomputed.
+   */
+  inline virtual bool GetTangentRefresh(void) const { return false; }
+
   /*!
    * \brief A virtual member.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -4720,6 +4884,13 @@ public:
    */
   inline virtual bool GetHasHybridParallel() const { return false; }
 
+  /*!
+   * \brief Whether the weak boundary conditions of the solver can be executed by multiple threads,
+   *        i.e. their vertex loops are work-shared and they use the numerics of the calling thread.
+   * \return Should return true if "yes", false if "no".
+   */
+  inline virtual bool GetHasHybridParallelBC() const { return false; }
+
 protected:
   /*!
    * \brief Allocate the memory for the verification solution, if necessary.
@@ -64,6 +64,8 @@ enum class SUB_SOLVER_TYPE {
 
 enum class INTEGRATION_TYPE{
   MULTIGRID,
+  NEWTON,
+  COUPLED_TURB,
   SINGLEGRID,
   DEFAULT,
   FEM_DG,
@@ -31,7 +31,9 @@
 
 /*!
  * \class CTransLMSolver
- * \brief Main class for defining the turbulence model solver.
+ * \brief Main class for defining the Langtry-Menter transition model solver, the edge loops
+ *        (convection and diffusion), the gradients and limiters, and the implicit iteration are
+ *        those of CTurbSolver.
  * \ingroup Turbulence_Model
  * \author A. Aranake.
  */
@@ -88,36 +90,6 @@ public:
                       CConfig *config,
                       unsigned short iMesh) override;
 
-  /*!
-   * \brief Compute the spatial integration using a upwind scheme.
-   * \param[in] geometry - Geometrical definition of the problem.
-   * \param[in] solver_container - Container vector with all the solutions.
-   * \param[in] numerics_container - Description of the numerical method.
-   * \param[in] config - Definition of the particular problem.
-   * \param[in] iMesh - Index of the mesh in multigrid computations.
-   */
-  void Upwind_Residual(CGeometry *geometry,
-                       CSolver **solver_container,
-                       CNumerics **numerics_container,
-                       CConfig *config,
-                       unsigned short iMesh) override;
-
-  /*!
-   * \brief Compute the viscous residuals for the turbulent equation.
-   * \param[in] geometry - Geometrical definition of the problem.
-   * \param[in] solver_container - Container vector with all the solutions.
-   * \param[in] numerics_container - Description of the numerical method.
-   * \param[in] config - Definition of the particular problem.
-   * \param[in] iMesh - Index of the mesh in multigrid computations.
-   * \param[in] iRKStep - Current step of the Runge-Kutta iteration.
-   */
-  void Viscous_Residual(CGeometry *geometry,
-                        CSolver **solver_container,
-                        CNumerics **numerics_container,
-                        CConfig *config,
-                        unsigned short iMesh,
-                        unsigned short iRKStep) override;
-
   /*!
    * \brief Source term computation.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -235,19 +207,4 @@ public:
   void ImplicitEuler_Iteration(CGeometry *geometry,
                                CSolver **solver_container,
                                CConfig *config) override;
-
-  /*!
-   * \brief No support for OpenMP+MPI.
-   */
-  inline bool GetHasHybridParallel() const override { return false; }
-
-  // Another set of matrix structures for the Lm equations
-  CSysMatrix<su2double> JacobianItmc;  /*!< \brief Complete sparse Jacobian structure for implicit computations. */
-  su2double *LinSysSolItmc;            /*!< \brief vector to store iterative solution of implicit linear system. */
-  su2double *LinSysResItmc;            /*!< \brief vector to store iterative residual of implicit linear system. */
-  su2double *rhsItmc;                  /*!< \brief right hand side of implicit linear system. */
-  CSysMatrix<su2double> JacobianReth;  /*!< \brief Complete sparse Jacobian structure for implicit computations. */
-  su2double *LinSysSolReth;            /*!< \brief vector to store iterative solution of implicit linear system. */
-  su2double *LinSysResReth;            /*!< \brief vector to store iterative residual of implicit linear system. */
-  su2double *rhsReth;                  /*!< \brief right hand side of implicit linear system. */
 };
@@ -41,6 +41,14 @@ class CTurbSASolver final : public CTurbSolver {
 private:
   su2double nu_tilde_Inf, nu_tilde_Engine, nu_tilde_ActDisk;
 
+  /*--- Geometric parts of the DES length scales (see SetDES_GeometricScales). ---*/
+  vector<su2double> DES_WallDist;       /*!< \brief Wall distance of the domain points. */
+  vector<su2double> DES_MaxLength;      /*!< \brief Max length of the dual cells of the domain points. */
+  vector<su2double> DES_Delta;          /*!< \brief ZDES, max extent of the neighborhood in each direction (3 per point). */
+  vector<unsigned long> DES_NeighPtr;   /*!< \brief EDDES, start of the neighbors of each point. */
+  vector<unsigned long> DES_Neighbor;   /*!< \brief EDDES, neighbors of the points. */
+  vector<su2double> DES_NeighDelta;     /*!< \brief EDDES, absolute coordinate differences with each neighbor (3 per neighbor). */
+
   /*!
    * \brief A virtual member.
    * \param[in] solver - Solver container
@@ -51,6 +59,25 @@ private:
                           CGeometry *geometry,
                           CConfig *config);
 
+  /*!
+   * \brief Compute the parts of the DES length scales that only depend on the grid, once
+   *        (unless the grid is dynamic), in contiguous arrays.
+   * \param[in] geometry - Geometrical definition.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetDES_GeometricScales(CGeometry *geometry, const CConfig *config);
+
+  /*!
+   * \brief Evaluate the wall functions (nu tilde at the interior points next to the viscous walls),
+   *        all threads share the stencils, the values are applied by SetNuTilde_WF.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeNuTilde_WF(CGeometry *geometry,
+                         CSolver **solver_container,
+                         const CConfig *config);
+
 public:
   /*!
    * \brief Constructor of the class.
@@ -415,7 +442,7 @@ public:
   inline su2double GetNuTilde_Inf(void) const override { return nu_tilde_Inf; }
 
   /*!
-   * \brief Compute nu tilde from the wall functions.
+   * \brief Apply the values of nu tilde from the wall functions (see ComputeNuTilde_WF).
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] solver_container - Container vector with all the solutions.
    * \param[in] conv_numerics - Description of the numerical method.
@@ -31,6 +31,8 @@
 #include "../variables/CTurbVariable.hpp"
 #include "../../../Common/include/omp_structure.hpp"
 
+class CTurbSourceBatchNumerics;
+
 /*!
  * \class CTurbSolver
  * \brief Main class for defining the turbulence model solver.
@@ -74,6 +76,8 @@ protected:
   /*--- Edge fluxes for reducer strategy (see the notes in CEulerSolver.hpp). ---*/
   CSysVector<su2double> EdgeFluxes; /*!< \brief Flux across each edge. */
 
+  CTurbSourceBatchNumerics* SourceBatch = nullptr; /*!< \brief Point-batched (vectorized) source terms, when supported by the options. */
+
   /*!
    * \brief The highest level in the variable hierarchy this solver can safely use.
    */
@@ -84,6 +88,15 @@ protected:
    */
   inline CVariable* GetBaseClassPointerToNodes() final { return nodes; }
 
+  /*!
+   * \brief Point loop of Source_Residual with the batched numerics, the source terms of
+   *        groups of points are computed at a time by vectorized kernels.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Source_Residual_Batched(CGeometry *geometry, CSolver **solver_container, const CConfig *config);
+
 private:
 
   /*!
@@ -236,6 +249,26 @@ public:
   void ImplicitEuler_Iteration(CGeometry *geometry,
                                CSolver **solver_container,
                                CConfig *config) override;
+
+  /*!
+   * \brief Build the implicit system (pseudo time term, right hand side, initial guess) and monitor the residuals.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void PrepareImplicitIteration(CGeometry *geometry,
+                                CSolver **solver_container,
+                                CConfig *config) final;
+
+  /*!
+   * \brief Update the solution with the (under-relaxed) solution of the implicit system.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void CompleteImplicitIteration(CGeometry *geometry,
+                                 CSolver **solver_container,
+                                 CConfig *config) final;
   /*!
    * \brief Set the total residual adding the term that comes from the Dual Time-Stepping Strategy.
    * \param[in] geometry - Geometric definition of the problem.
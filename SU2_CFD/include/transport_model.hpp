@@ -42,6 +42,7 @@
 #include "math.h"
 
 #include "../../Common/include/datatype_structure.hpp"
+#include "fluid_batch.hpp"
 
 using namespace std;
 
@@ -122,7 +123,13 @@ public:
    * \brief Destructor of the class.
    */
   virtual ~CConstantViscosity(void);
-   
+
+  /*!
+   * \brief Set the viscosity and its derivatives of a batch of points (non-virtual).
+   * \param[in,out] batch - States of the points, Mu and its derivatives are set.
+   */
+  inline void SetViscosity(CFluidBatch& batch) const;
+
 };
 
 /*!
@@ -164,7 +171,13 @@ public:
    * \brief Set Viscosity Derivatives.
    */
   void SetDerViscosity(su2double T, su2double rho);
-  
+
+  /*!
+   * \brief Set the viscosity and its derivatives of a batch of points (non-virtual).
+   * \param[in,out] batch - States of the points (temperature is used), Mu and its derivatives are set.
+   */
+  inline void SetViscosity(CFluidBatch& batch) const;
+
 };
 
 /*!
@@ -198,7 +211,13 @@ public:
    * \brief Set Viscosity.
    */
   void SetViscosity(su2double T, su2double rho);
-  
+
+  /*!
+   * \brief Set the viscosity of a batch of points (non-virtual).
+   * \param[in,out] batch - States of the points, Mu is set (the derivatives are not used by the incompressible solvers).
+   */
+  inline void SetViscosity(CFluidBatch& batch) const;
+
 };
 
 /*!
@@ -354,6 +373,12 @@ public:
    */
   void SetDerConductivity(su2double T, su2double rho, su2double dmudrho_T, su2double dmudT_rho, su2double cp);
 
+  /*!
+   * \brief Set the conductivity and its derivatives of a batch of points (non-virtual).
+   * \param[in,out] batch - States of the points (viscosity, its derivatives, and Cp are used).
+   */
+  inline void SetConductivity(CFluidBatch& batch) const;
+
 };
 
 /*!
@@ -423,7 +448,13 @@ public:
    * \brief Set Thermal conductivity.
    */
   void SetConductivity(su2double T, su2double rho, su2double mu_lam, su2double mu_turb, su2double cp);
-  
+
+  /*!
+   * \brief Set the thermal conductivity of a batch of points (non-virtual).
+   * \param[in,out] batch - States of the points, Kt is set.
+   */
+  inline void SetConductivity(CFluidBatch& batch) const;
+
 };
 
 /*!
@@ -458,7 +489,13 @@ public:
    * \brief Set Thermal conductivity.
    */
   void SetConductivity(su2double T, su2double rho, su2double mu_lam, su2double mu_turb, su2double cp);
-  
+
+  /*!
+   * \brief Set the effective thermal conductivity of a batch of points (non-virtual).
+   * \param[in,out] batch - States of the points (Mu_Turb and Cp are inputs), Kt is set.
+   */
+  inline void SetConductivity(CFluidBatch& batch) const;
+
 };
 
 #include "transport_model.inl"
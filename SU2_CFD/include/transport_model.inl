@@ -38,3 +38,58 @@ inline su2double CConductivityModel::Getdktdrho_T () { return dktdrho_T; }
 inline su2double CConductivityModel::GetdktdT_rho () { return dktdT_rho; }
 inline void CConductivityModel::SetConductivity(su2double T, su2double rho, su2double mu_lam, su2double mu_turb, su2double cp) {}
 inline void CConductivityModel::SetDerConductivity(su2double T, su2double rho, su2double dmudrho_T, su2double dmudT_rho, su2double cp) {}
+
+inline void CConstantViscosity::SetViscosity(CFluidBatch& batch) const {
+  for (size_t k = 0; k < CFluidBatch::SIZE; ++k) {
+    batch.Mu[k] = Mu;
+    batch.dmudrho_T[k] = 0.0;
+    batch.dmudT_rho[k] = 0.0;
+  }
+}
+
+inline void CSutherland::SetViscosity(CFluidBatch& batch) const {
+  const su2double T_refInv = 1.0/T_ref;
+  for (size_t k = 0; k < CFluidBatch::SIZE; ++k) {
+    const su2double T = batch.Temperature[k];
+    const su2double TnonDim = T/T_ref;
+    batch.Mu[k] = Mu_ref*TnonDim*sqrt(TnonDim)*((T_ref + S)/(T + S));
+    batch.dmudrho_T[k] = 0.0;
+    const su2double TSInv = 1.0/(T + S);
+    batch.dmudT_rho[k] = Mu_ref*(T_ref + S)*TSInv*sqrt(T_refInv*T) * (1.5*T_refInv - T_refInv*T*TSInv);
+  }
+}
+
+inline void CPolynomialViscosity::SetViscosity(CFluidBatch& batch) const {
+  for (size_t k = 0; k < CFluidBatch::SIZE; ++k) {
+    const su2double T = batch.Temperature[k];
+    su2double mu = b[nPolyCoeffs-1];
+    for (int iVar = nPolyCoeffs-2; iVar >= 0; --iVar) mu = mu*T + b[iVar];
+    batch.Mu[k] = mu;
+  }
+}
+
+inline void CPolynomialConductivity::SetConductivity(CFluidBatch& batch) const {
+  for (size_t k = 0; k < CFluidBatch::SIZE; ++k) {
+    const su2double T = batch.Temperature[k];
+    su2double kt = b[nPolyCoeffs-1];
+    for (int iVar = nPolyCoeffs-2; iVar >= 0; --iVar) kt = kt*T + b[iVar];
+    batch.Kt[k] = kt;
+  }
+}
+
+inline void CPolynomialConductivityRANS::SetConductivity(CFluidBatch& batch) const {
+  for (size_t k = 0; k < CFluidBatch::SIZE; ++k) {
+    const su2double T = batch.Temperature[k];
+    su2double kt = b[nPolyCoeffs-1];
+    for (int iVar = nPolyCoeffs-2; iVar >= 0; --iVar) kt = kt*T + b[iVar];
+    batch.Kt[k] = kt + batch.Cp[k]*batch.Mu_Turb[k]/Prandtl_Turb;
+  }
+}
+
+inline void CConstantPrandtl::SetConductivity(CFluidBatch& batch) const {
+  for (size_t k = 0; k < CFluidBatch::SIZE; ++k) {
+    batch.Kt[k] = batch.Mu[k]*batch.Cp[k]/Pr_const;
+    batch.dktdrho_T[k] = batch.dmudrho_T[k]*batch.Cp[k]/Pr_const;
+    batch.dktdT_rho[k] = batch.dmudT_rho[k]*batch.Cp[k]/Pr_const;
+  }
+}
@@ -80,6 +80,13 @@ public:
    */
   inline su2double GetSolution_New(unsigned long iPoint, unsigned long iVar) const final { return Solution_New(iPoint,iVar); }
 
+  /*!
+   * \brief Get the new solution of a point (Classical RK4).
+   * \param[in] iPoint - Point index.
+   * \return Pointer to the new solution of the point, the points are contiguous.
+   */
+  inline su2double *GetSolution_New(unsigned long iPoint) { return Solution_New[iPoint]; }
+
   /*!
    * \brief Set the new solution container for Classical RK4.
    */
@@ -125,7 +132,9 @@ public:
    * \param[in] iVar - Index of the variable.
    * \return Value of the primitive variables gradient.
    */
-  inline su2double GetLimiter_Primitive(unsigned long iPoint, unsigned long iVar) const final {return Limiter_Primitive(iPoint,iVar); }
+  inline su2double GetLimiter_Primitive(unsigned long iPoint, unsigned long iVar) const final {
+    return Limiter_Primitive.empty()? su2double(0.0) : Limiter_Primitive(iPoint,iVar);
+  }
 
   /*!
    * \brief Set the gradient of the primitive variables.
@@ -460,4 +469,10 @@ public:
       WindGustDer(iPoint,iDim) = val_WindGustDer[iDim];
   }
 
+  /*!
+   * \brief Get the name and size in bytes of each container of the class.
+   * \param[out] memory - List of names and sizes.
+   */
+  void GetContainerMemory(MemoryList& memory) const override;
+
 };
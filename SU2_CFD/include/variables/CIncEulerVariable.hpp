@@ -292,6 +292,12 @@ public:
    */
   inline su2double GetDensity_Old(unsigned long iPoint) const final { return Density_Old(iPoint); }
 
+  /*!
+   * \brief Store the current density as the density from the previous iteration.
+   * \param[in] iPoint - Point index.
+   */
+  inline void SetDensity_Old(unsigned long iPoint) { Density_Old(iPoint) = GetDensity(iPoint); }
+
   /*!
    * \brief Get the temperature of the flow.
    * \return Value of the temperature of the flow.
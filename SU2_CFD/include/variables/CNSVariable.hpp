@@ -229,4 +229,10 @@ public:
     Roe_Dissipation(iPoint) = val_dissipation;
   }
 
+  /*!
+   * \brief Get the name and size in bytes of each container of the class.
+   * \param[out] memory - List of names and sizes.
+   */
+  void GetContainerMemory(MemoryList& memory) const override;
+
 };
@@ -38,6 +38,7 @@
 #include "../../../Common/include/CConfig.hpp"
 #include "../fluid_model.hpp"
 #include "../../../Common/include/toolboxes/C2DContainer.hpp"
+#include "../../../Common/include/toolboxes/C3DContainer.hpp"
 
 
 using namespace std;
@@ -51,28 +52,25 @@ class CVariable {
 protected:
   using VectorType = C2DContainer<unsigned long, su2double, StorageType::ColumnMajor, 64, DynamicSize, 1>;
   using MatrixType = C2DContainer<unsigned long, su2double, StorageType::RowMajor,    64, DynamicSize, DynamicSize>;
+  using PassiveFloatMatrix = C2DContainer<unsigned long, float, StorageType::RowMajor, 64, DynamicSize, DynamicSize>;
 
-  /*--- This contrived container is used to store matrices in a contiguous manner but still present the
-   "su2double**" interface to the outside world, it will be replaced by something more efficient. ---*/
-  struct VectorOfMatrix {
-    su2activevector storage;
+  /*--- The gradients (point x var x dim) are padded such that the gradient of each point starts on a multiple
+   of 4 entries (one AVX register of doubles). The kernels (gradients, limiters) only use the (i,j,k) access,
+   but the numerics take the "su2double**" interface to the rows of the points, hence the layout is fixed. ---*/
+  using GradientStorage = C3DContainer<unsigned long, su2double, StorageType3D::LastContiguous, 4>;
+
+  struct VectorOfMatrix : public GradientStorage {
     su2matrix<su2double*> interface;
-    unsigned long M, N;
 
     void resize(unsigned long length, unsigned long rows, unsigned long cols, su2double value) {
-      M = rows;
-      N = cols;
-      storage.resize(length*rows*cols) = value;
+      GradientStorage::resize(length, rows, cols, value);
       interface.resize(length,rows);
 
       for(unsigned long i=0; i<length; ++i)
         for(unsigned long j=0; j<rows; ++j)
-          interface(i,j) = &(*this)(i,j,0);
+          interface(i,j) = innerData(i,j);
     }
 
-    su2double& operator() (unsigned long i, unsigned long j, unsigned long k) { return storage(i*M*N + j*N + k); }
-    const su2double& operator() (unsigned long i, unsigned long j, unsigned long k) const { return storage(i*M*N + j*N + k); }
-
     su2double** operator[] (unsigned long i) { return interface[i]; }
   };
 
@@ -91,6 +89,8 @@ protected:
 
   MatrixType Solution_time_n;    /*!< \brief Solution of the problem at time n for dual-time stepping technique. */
   MatrixType Solution_time_n1;   /*!< \brief Solution of the problem at time n-1 for dual-time stepping technique. */
+  MatrixType Solution_time_n2;   /*!< \brief Solution at time n-2 for the quadratic predictor (see TIME_PREDICTOR_ORDER). */
+  PassiveFloatMatrix Solution_time_n2_LowPrec; /*!< \brief Single precision version of Solution_time_n2. */
   VectorType Delta_Time;         /*!< \brief Time step. */
 
   VectorOfMatrix Gradient;  /*!< \brief Gradient of the solution of the problem. */
@@ -129,6 +129,24 @@ protected:
   unsigned long nSecondaryVar = 0;     /*!< \brief Number of secondary variables. */
   unsigned long nSecondaryVarGrad = 0;   /*!< \brief Number of secondaries for which a gradient is computed. */
 
+  using MemoryList = vector<pair<string, unsigned long> >;
+
+  /*!
+   * \brief Append the name and size in bytes of a container to a list.
+   */
+  template<class Container>
+  static void AddContainerMemory(const string& name, const Container& container, MemoryList& memory) {
+    memory.emplace_back(name, container.size()*sizeof(*container.data()));
+  }
+
+  /*!
+   * \overload For the matrix containers, includes the pointer interface.
+   */
+  static void AddContainerMemory(const string& name, const VectorOfMatrix& container, MemoryList& memory) {
+    memory.emplace_back(name, container.size()*sizeof(su2double) +
+                              container.interface.size()*sizeof(su2double*));
+  }
+
 public:
 
   /*--- Disable default construction copy and assignment. ---*/
@@ -271,6 +289,20 @@ public:
    */
   void Set_Solution_time_n1();
 
+  /*!
+   * \brief Set the variable solution at time n-2 from the one at time n-1 (before the latter is updated).
+   * \note Only used by the quadratic predictor, the storage is allocated on the first call.
+   * \param[in] lowPrec - Store the solution in single precision.
+   */
+  void Set_Solution_time_n2(bool lowPrec);
+
+  /*!
+   * \brief Set the solution to the extrapolation of the stored time levels, as initial guess of a time step.
+   * \note Assumes a constant time step, order 3 requires the solution at time n-2 (see Set_Solution_time_n2).
+   * \param[in] order - 2 for the linear extrapolation from n and n-1, 3 for the quadratic one from n, n-1, and n-2.
+   */
+  void SetSolution_Extrapolated(unsigned short order);
+
   /*!
    * \brief Set the variable solution at time n.
    * \param[in] iPoint - Point index.
@@ -672,6 +704,7 @@ public:
    * \param[in] iPoint - Point index.
    */
   inline void SetRes_TruncErrorZero(unsigned long iPoint) {
+    if (Res_TruncError.empty()) return;
     for (unsigned long iVar = 0; iVar < nVar; iVar++) Res_TruncError(iPoint, iVar) = 0.0;
   }
 
@@ -679,13 +712,16 @@ public:
    * \brief Set the truncation error to zero.
    * \param[in] iPoint - Point index.
    */
-  inline void SetVal_ResTruncError_Zero(unsigned long iPoint, unsigned long iVar) {Res_TruncError(iPoint, iVar) = 0.0;}
+  inline void SetVal_ResTruncError_Zero(unsigned long iPoint, unsigned long iVar) {
+    if (!Res_TruncError.empty()) Res_TruncError(iPoint, iVar) = 0.0;
+  }
 
   /*!
    * \brief Set the velocity of the truncation error to zero.
    * \param[in] iPoint - Point index.
    */
   inline void SetVel_ResTruncError_Zero(unsigned long iPoint) {
+    if (Res_TruncError.empty()) return;
     for (unsigned long iDim = 0; iDim < nDim; iDim++) Res_TruncError(iPoint,iDim+1) = 0.0;
   }
 
@@ -693,7 +729,14 @@ public:
    * \brief Set the velocity of the truncation error to zero.
    * \param[in] iPoint - Point index.
    */
-  inline void SetEnergy_ResTruncError_Zero(unsigned long iPoint) { Res_TruncError(iPoint,nDim+1) = 0.0;}
+  inline void SetEnergy_ResTruncError_Zero(unsigned long iPoint) {
+    if (!Res_TruncError.empty()) Res_TruncError(iPoint,nDim+1) = 0.0;
+  }
+
+  /*!
+   * \brief Get whether the truncation error is allocated (it may not be without multigrid, see LEAN_VARIABLE_STORAGE).
+   */
+  inline bool GetResTruncErrorAllocated(void) const { return !Res_TruncError.empty(); }
 
   /*!
    * \brief Get the truncation error.
@@ -2804,4 +2847,11 @@ public:
    */
   virtual su2double GetSourceTerm_DispAdjoint(unsigned long iPoint, unsigned long iDim) const { return 0.0; }
 
+  /*!
+   * \brief Get the name and size in bytes of each container of the class.
+   * \note All containers are listed (also if not allocated) such that the lists match across ranks.
+   * \param[out] memory - List of names and sizes, the derived classes append their containers.
+   */
+  virtual void GetContainerMemory(vector<pair<string, unsigned long> >& memory) const;
+
 };
@@ -46,15 +46,20 @@ CMarkerProfileReaderFVM::CMarkerProfileReaderFVM(CGeometry      *val_geometry,
   markerType   = val_kind_marker;
   numberOfVars = val_number_vars;
   
-  /* Attempt to open the specified file. */
-  ifstream profile_file;
-  profile_file.open(filename.data(), ios::in);
+  /* Attempt to open the specified file, only the master reads it. */
+  int fileFound = 0;
+  if (rank == MASTER_NODE) {
+    ifstream profile_file;
+    profile_file.open(filename.data(), ios::in);
+    fileFound = !profile_file.fail();
+  }
+  SU2_MPI::Bcast(&fileFound, 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
   
   /* If the file is not found, then we merge the information necessary
    and write a template marker profile file. Otherwise, we read and
    store the information in the marker profile file. */
   
-  if (profile_file.fail()) {
+  if (!fileFound) {
     MergeProfileMarkers();
     WriteMarkerProfileTemplate();
   } else {
@@ -67,100 +72,142 @@ CMarkerProfileReaderFVM::~CMarkerProfileReaderFVM(void) { }
 
 void CMarkerProfileReaderFVM::ReadMarkerProfile() {
   
-  /*--- Open the profile file (we have already error checked) ---*/
+  /*--- The master reads the file and broadcasts the profiles. ---*/
+  
+  if (rank == MASTER_NODE) {
+  
+    /*--- Open the profile file (we have already error checked) ---*/
   
-  ifstream profile_file;
-  profile_file.open(filename.data(), ios::in);
+    ifstream profile_file;
+    profile_file.open(filename.data(), ios::in);
   
-  /*--- Identify the markers and data set in the profile file ---*/
+    /*--- Identify the markers and data set in the profile file ---*/
   
-  string text_line;
-  while (getline (profile_file, text_line)) {
+    string text_line;
+    while (getline (profile_file, text_line)) {
     
-    string::size_type position = text_line.find ("NMARK=",0);
-    if (position != string::npos) {
-      text_line.erase (0,6); numberOfProfiles = atoi(text_line.c_str());
+      string::size_type position = text_line.find ("NMARK=",0);
+      if (position != string::npos) {
+        text_line.erase (0,6); numberOfProfiles = atoi(text_line.c_str());
       
-      numberOfRowsInProfile.resize(numberOfProfiles);
-      numberOfColumnsInProfile.resize(numberOfProfiles);
+        numberOfRowsInProfile.resize(numberOfProfiles);
+        numberOfColumnsInProfile.resize(numberOfProfiles);
       
-      for (unsigned short iMarker = 0 ; iMarker < numberOfProfiles; iMarker++) {
+        for (unsigned short iMarker = 0 ; iMarker < numberOfProfiles; iMarker++) {
         
-        getline (profile_file, text_line);
-        text_line.erase (0,11);
-        for (unsigned short iChar = 0; iChar < 20; iChar++) {
-          position = text_line.find( " ", 0 );  if (position != string::npos) text_line.erase (position,1);
-          position = text_line.find( "\r", 0 ); if (position != string::npos) text_line.erase (position,1);
-          position = text_line.find( "\n", 0 ); if (position != string::npos) text_line.erase (position,1);
-        }
-        profileTags.push_back(text_line.c_str());
+          getline (profile_file, text_line);
+          text_line.erase (0,11);
+          for (unsigned short iChar = 0; iChar < 20; iChar++) {
+            position = text_line.find( " ", 0 );  if (position != string::npos) text_line.erase (position,1);
+            position = text_line.find( "\r", 0 ); if (position != string::npos) text_line.erase (position,1);
+            position = text_line.find( "\n", 0 ); if (position != string::npos) text_line.erase (position,1);
+          }
+          profileTags.push_back(text_line.c_str());
         
-        getline (profile_file, text_line);
-        text_line.erase (0,5); numberOfRowsInProfile[iMarker] = atoi(text_line.c_str());
+          getline (profile_file, text_line);
+          text_line.erase (0,5); numberOfRowsInProfile[iMarker] = atoi(text_line.c_str());
         
-        getline (profile_file, text_line);
-        text_line.erase (0,5); numberOfColumnsInProfile[iMarker] = atoi(text_line.c_str());
+          getline (profile_file, text_line);
+          text_line.erase (0,5); numberOfColumnsInProfile[iMarker] = atoi(text_line.c_str());
         
-        /*--- Skip the data. This is read in the next loop. ---*/
+          /*--- Skip the data. This is read in the next loop. ---*/
         
-        for (unsigned long iRow = 0; iRow < numberOfRowsInProfile[iMarker]; iRow++) getline (profile_file, text_line);
+          for (unsigned long iRow = 0; iRow < numberOfRowsInProfile[iMarker]; iRow++) getline (profile_file, text_line);
         
+        }
+      } else {
+        SU2_MPI::Error("While opening profile file, no \"NMARK=\" specification was found", CURRENT_FUNCTION);
       }
-    } else {
-      SU2_MPI::Error("While opening profile file, no \"NMARK=\" specification was found", CURRENT_FUNCTION);
     }
-  }
   
-  profile_file.close();
+    profile_file.close();
   
-  /*--- Compute array bounds and offsets. Allocate data structure. ---*/
+    /*--- Compute array bounds and offsets. Allocate data structure. ---*/
   
-  profileData.resize(numberOfProfiles);
-  for (unsigned short iMarker = 0; iMarker < numberOfProfiles; iMarker++) {
-    profileData[iMarker].resize(numberOfRowsInProfile[iMarker]*numberOfColumnsInProfile[iMarker], 0.0);
-  }
+    profileData.resize(numberOfProfiles);
+    for (unsigned short iMarker = 0; iMarker < numberOfProfiles; iMarker++) {
+      profileData[iMarker].resize(numberOfRowsInProfile[iMarker]*numberOfColumnsInProfile[iMarker], 0.0);
+    }
   
-  /*--- Read all lines in the profile file and extract data. ---*/
+    /*--- Read all lines in the profile file and extract data. ---*/
   
-  profile_file.open(filename.data(), ios::in);
+    profile_file.open(filename.data(), ios::in);
   
-  int counter = 0;
-  while (getline (profile_file, text_line)) {
+    int counter = 0;
+    while (getline (profile_file, text_line)) {
     
-    string::size_type position = text_line.find ("NMARK=",0);
-    if (position != string::npos) {
+      string::size_type position = text_line.find ("NMARK=",0);
+      if (position != string::npos) {
       
-      for (unsigned short iMarker = 0; iMarker < numberOfProfiles; iMarker++) {
+        for (unsigned short iMarker = 0; iMarker < numberOfProfiles; iMarker++) {
         
-        /*--- Skip the tag, nRow, and nCol lines. ---*/
+          /*--- Skip the tag, nRow, and nCol lines. ---*/
         
-        getline (profile_file, text_line);
-        getline (profile_file, text_line);
-        getline (profile_file, text_line);
+          getline (profile_file, text_line);
+          getline (profile_file, text_line);
+          getline (profile_file, text_line);
         
-        /*--- Now read the data for each row and store. ---*/
+          /*--- Now read the data for each row and store. ---*/
         
-        for (unsigned long iRow = 0; iRow < numberOfRowsInProfile[iMarker]; iRow++) {
+          for (unsigned long iRow = 0; iRow < numberOfRowsInProfile[iMarker]; iRow++) {
           
-          getline (profile_file, text_line);
+            getline (profile_file, text_line);
           
-          istringstream point_line(text_line);
+            /*--- Store the values (starting with node coordinates) --*/
           
-          /*--- Store the values (starting with node coordinates) --*/
+            const char* str = text_line.c_str();
+            char* end = nullptr;
           
-          for (unsigned short iVar = 0; iVar < numberOfColumnsInProfile[iMarker]; iVar++)
-            point_line >> profileData[iMarker][iRow*numberOfColumnsInProfile[iMarker] + iVar];
+            for (unsigned short iVar = 0; iVar < numberOfColumnsInProfile[iMarker]; iVar++) {
+              profileData[iMarker][iRow*numberOfColumnsInProfile[iMarker] + iVar] = strtod(str, &end);
+              str = end;
+            }
           
-          /*--- Increment our local row counter. ---*/
+            /*--- Increment our local row counter. ---*/
           
-          counter++;
+            counter++;
           
+          }
         }
       }
     }
+  
+    profile_file.close();
+  
+  }
+  
+  /*--- Sizes, then the tags (separated by new lines) of the profiles. ---*/
+  
+  SU2_MPI::Bcast(&numberOfProfiles, 1, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+  
+  numberOfRowsInProfile.resize(numberOfProfiles);
+  numberOfColumnsInProfile.resize(numberOfProfiles);
+  
+  SU2_MPI::Bcast(numberOfRowsInProfile.data(), numberOfProfiles, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Bcast(numberOfColumnsInProfile.data(), numberOfProfiles, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+  
+  string allTags;
+  for (const auto& tag : profileTags) allTags += tag + "\n";
+  
+  int nChar = allTags.size();
+  SU2_MPI::Bcast(&nChar, 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+  allTags.resize(nChar);
+  SU2_MPI::Bcast(&allTags[0], nChar, MPI_CHAR, MASTER_NODE, MPI_COMM_WORLD);
+  
+  if (rank != MASTER_NODE) {
+    istringstream tags(allTags);
+    string tag;
+    while (getline(tags, tag)) profileTags.push_back(tag);
   }
   
-  profile_file.close();
+  /*--- The data is passive (the wrapper must not treat it as AD type). ---*/
+  
+  profileData.resize(numberOfProfiles);
+  for (unsigned short iMarker = 0; iMarker < numberOfProfiles; iMarker++) {
+    profileData[iMarker].resize(numberOfRowsInProfile[iMarker]*numberOfColumnsInProfile[iMarker]);
+    SelectMPIWrapper<passivedouble>::W::Bcast(profileData[iMarker].data(), profileData[iMarker].size(),
+                                              MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+  }
   
 }
 
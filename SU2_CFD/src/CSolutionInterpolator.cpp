@@ -0,0 +1,312 @@
+/*!
+ * \file CSolutionInterpolator.cpp
+ * \brief Interpolation of a solution between the points of different grids.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../include/CSolutionInterpolator.hpp"
+#include "../include/solvers/CSolver.hpp"
+
+namespace {
+
+/*--- Size of the requests of interpolation: the kind (element or point), its index, and the weights. ---*/
+constexpr unsigned short REQUEST_SIZE = 2 + N_POINTS_HEXAHEDRON;
+
+/*--- Send the buffers to each rank and receive the buffers sent by each rank (all-to-all). ---*/
+void ExchangeBuffers(const vector<vector<passivedouble> >& sendBuf, vector<vector<passivedouble> >& recvBuf) {
+
+  const int size = SU2_MPI::GetSize();
+
+  recvBuf.clear();
+  recvBuf.resize(size);
+
+  if (size == SINGLE_NODE) {
+    recvBuf[0] = sendBuf[0];
+    return;
+  }
+
+#ifdef HAVE_MPI
+  vector<int> nSend(size), nRecv(size), sendDispl(size+1, 0), recvDispl(size+1, 0);
+
+  for (int iRank = 0; iRank < size; iRank++) nSend[iRank] = sendBuf[iRank].size();
+
+  SU2_MPI::Alltoall(nSend.data(), 1, MPI_INT, nRecv.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+  for (int iRank = 0; iRank < size; iRank++) {
+    sendDispl[iRank+1] = sendDispl[iRank] + nSend[iRank];
+    recvDispl[iRank+1] = recvDispl[iRank] + nRecv[iRank];
+  }
+
+  vector<passivedouble> sendData(sendDispl[size]), recvData(recvDispl[size]);
+  for (int iRank = 0; iRank < size; iRank++)
+    copy(sendBuf[iRank].begin(), sendBuf[iRank].end(), sendData.begin()+sendDispl[iRank]);
+
+  SelectMPIWrapper<passivedouble>::W::Alltoallv(sendData.data(), nSend.data(), sendDispl.data(), MPI_DOUBLE,
+                                                recvData.data(), nRecv.data(), recvDispl.data(), MPI_DOUBLE,
+                                                MPI_COMM_WORLD);
+
+  for (int iRank = 0; iRank < size; iRank++)
+    recvBuf[iRank].assign(recvData.begin()+recvDispl[iRank], recvData.begin()+recvDispl[iRank+1]);
+#endif
+
+}
+
+}
+
+CSolutionInterpolator::CSolutionInterpolator(CGeometry *donor, unsigned short val_nVar, vector<passivedouble> values) :
+  nVar(val_nVar), donorValues(move(values)) {
+
+  const int rank = SU2_MPI::GetRank();
+  const unsigned short nDim = donor->GetnDim();
+  const unsigned long nPoint = donor->GetnPoint();
+  const unsigned long nPointDomain = donor->GetnPointDomain();
+
+  if (donorValues.size() < nPoint*nVar)
+    SU2_MPI::Error("The values of the donor grid are not defined for all its points.", CURRENT_FUNCTION);
+
+  /*--- Elements owned by this rank (the owner of their node of lowest global index), once over the ranks. ---*/
+
+  vector<su2double> coor(nPoint*nDim);
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      coor[iPoint*nDim + iDim] = donor->node[iPoint]->GetCoord(iDim);
+
+  vector<unsigned long> connElem, elemID;
+  vector<unsigned short> VTK_Type, markerID;
+
+  elemStart.push_back(0);
+
+  for (unsigned long iElem = 0; iElem < donor->GetnElem(); iElem++) {
+
+    CPrimalGrid* elem = donor->elem[iElem];
+    const unsigned short nNodes = elem->GetnNodes();
+
+    unsigned long lowest = elem->GetNode(0);
+    for (unsigned short iNode = 1; iNode < nNodes; iNode++)
+      if (donor->node[elem->GetNode(iNode)]->GetGlobalIndex() < donor->node[lowest]->GetGlobalIndex())
+        lowest = elem->GetNode(iNode);
+    if (donor->node[lowest]->GetColor() != (unsigned long)rank) continue;
+
+    for (unsigned short iNode = 0; iNode < nNodes; iNode++) {
+      connElem.push_back(elem->GetNode(iNode));
+      elemNodes.push_back(elem->GetNode(iNode));
+    }
+    elemStart.push_back(elemNodes.size());
+
+    elemID.push_back(VTK_Type.size());
+    VTK_Type.push_back(elem->GetVTK_Type());
+    markerID.push_back(0);
+  }
+
+  elemTree = new CADTElemClass(nDim, coor, connElem, VTK_Type, markerID, elemID, true);
+
+  /*--- The domain points are the first ones. ---*/
+
+  vector<unsigned long> pointID(nPointDomain);
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) pointID[iPoint] = iPoint;
+
+  pointTree = new CADTPointsOnlyClass(nDim, nPointDomain, coor.data(), pointID.data(), true);
+}
+
+CSolutionInterpolator::~CSolutionInterpolator(void) {
+  delete elemTree;
+  delete pointTree;
+}
+
+unsigned long CSolutionInterpolator::Interpolate(CGeometry *target, vector<passivedouble>& values) const {
+
+  const int size = SU2_MPI::GetSize();
+  const unsigned long nPointDomain = target->GetnPointDomain();
+
+  /*--- Locate the domain points in the donor grid, in the element that contains them, or else
+   *    the nearest donor point. ---*/
+
+  vector<vector<passivedouble> > requests(size), replies;
+  vector<int> pointRank(nPointDomain);
+  unsigned long nNearest = 0;
+
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+
+    su2double parCoor[3] = {0.0}, weights[N_POINTS_HEXAHEDRON] = {0.0};
+    unsigned short markerID;
+    unsigned long index;
+    int rankID;
+
+    const su2double* coor = target->node[iPoint]->GetCoord();
+    const bool found = elemTree->DetermineContainingElement(coor, markerID, index, rankID, parCoor, weights);
+    if (!found) {
+      su2double dist;
+      pointTree->DetermineNearestNode(coor, dist, index, rankID);
+      nNearest++;
+    }
+
+    pointRank[iPoint] = rankID;
+
+    auto& request = requests[rankID];
+    request.push_back(index);
+    request.push_back(found? 0.0 : 1.0);
+    for (unsigned short iNode = 0; iNode < N_POINTS_HEXAHEDRON; iNode++)
+      request.push_back(SU2_TYPE::GetValue(weights[iNode]));
+  }
+
+  ExchangeBuffers(requests, replies);
+
+  /*--- Interpolate the donor values for the requests of each rank, in their order. ---*/
+
+  requests.swap(replies);
+  for (int iRank = 0; iRank < size; iRank++) {
+    replies[iRank].clear();
+    for (size_t iRequest = 0; iRequest < requests[iRank].size(); iRequest += REQUEST_SIZE) {
+
+      const passivedouble* request = &requests[iRank][iRequest];
+      const auto index = static_cast<unsigned long>(request[0]);
+      vector<passivedouble> pointValues(nVar, 0.0);
+
+      if (request[1] == 0.0) {
+        for (unsigned long iNode = elemStart[index]; iNode < elemStart[index+1]; iNode++) {
+          const passivedouble weight = request[2 + iNode - elemStart[index]];
+          const passivedouble* donor = &donorValues[elemNodes[iNode]*nVar];
+          for (unsigned short iVar = 0; iVar < nVar; iVar++) pointValues[iVar] += weight*donor[iVar];
+        }
+      }
+      else {
+        copy(&donorValues[index*nVar], &donorValues[(index+1)*nVar], pointValues.begin());
+      }
+      replies[iRank].insert(replies[iRank].end(), pointValues.begin(), pointValues.end());
+    }
+  }
+
+  ExchangeBuffers(replies, requests);
+
+  values.resize(nPointDomain*nVar);
+
+  vector<unsigned long> counter(size, 0);
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    const int iRank = pointRank[iPoint];
+    copy_n(&requests[iRank][counter[iRank]], nVar, &values[iPoint*nVar]);
+    counter[iRank] += nVar;
+  }
+
+  unsigned long nNearestGlobal = nNearest;
+  SU2_MPI::Allreduce(&nNearest, &nNearestGlobal, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+
+  return nNearestGlobal;
+}
+
+void CSolutionInterpolator::CompleteHalos(const CGeometry *geometry, const CConfig *config,
+                                          unsigned short val_nVar, vector<passivedouble>& values) {
+
+  values.resize(geometry->GetnPoint()*val_nVar, 0.0);
+
+#ifdef HAVE_MPI
+  /*--- Each send marker is followed by the receive marker of the same rank, the points of
+   *    the markers (vertex elements) are in the same order on both sides. ---*/
+
+  for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+
+    if ((config->GetMarker_All_KindBC(iMarker) != SEND_RECEIVE) ||
+        (config->GetMarker_All_SendRecv(iMarker) <= 0)) continue;
+
+    const unsigned short MarkerS = iMarker, MarkerR = iMarker+1;
+
+    const int send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
+    const int receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
+
+    const unsigned long nSend = geometry->nElem_Bound[MarkerS], nRecv = geometry->nElem_Bound[MarkerR];
+    vector<passivedouble> bufSend(nSend*val_nVar), bufRecv(nRecv*val_nVar);
+
+    for (unsigned long iElem = 0; iElem < nSend; iElem++) {
+      const unsigned long iPoint = geometry->bound[MarkerS][iElem]->GetNode(0);
+      copy_n(&values[iPoint*val_nVar], val_nVar, &bufSend[iElem*val_nVar]);
+    }
+
+    SelectMPIWrapper<passivedouble>::W::Sendrecv(bufSend.data(), bufSend.size(), MPI_DOUBLE, send_to, 0,
+                                                 bufRecv.data(), bufRecv.size(), MPI_DOUBLE, receive_from, 0,
+                                                 MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+
+    for (unsigned long iElem = 0; iElem < nRecv; iElem++) {
+      const unsigned long iPoint = geometry->bound[MarkerR][iElem]->GetNode(0);
+      copy_n(&bufRecv[iElem*val_nVar], val_nVar, &values[iPoint*val_nVar]);
+    }
+  }
+#endif
+
+}
+
+void CSolutionInterpolator::SetRestartSolution(CGeometry **geometry, CSolver ***solver, CConfig *config,
+                                               const vector<passivedouble>& values, unsigned short stride) {
+
+  const bool turbulent = (config->GetKind_Turb_Model() != NONE) && (solver[MESH_0][TURB_SOL] != nullptr);
+  const unsigned short nVarFlow = solver[MESH_0][FLOW_SOL]->GetnVar();
+  const unsigned short nVarTurb = turbulent? solver[MESH_0][TURB_SOL]->GetnVar() : 0;
+
+  if (stride < nVarFlow+nVarTurb)
+    SU2_MPI::Error("Not enough values per point for the flow and turbulence solvers.", CURRENT_FUNCTION);
+
+  for (unsigned long iPoint = 0; iPoint < geometry[MESH_0]->GetnPointDomain(); iPoint++) {
+    const passivedouble* pointValues = &values[iPoint*stride];
+    for (unsigned short iVar = 0; iVar < nVarFlow; iVar++)
+      solver[MESH_0][FLOW_SOL]->GetNodes()->SetSolution(iPoint, iVar, pointValues[iVar]);
+    for (unsigned short iVar = 0; iVar < nVarTurb; iVar++)
+      solver[MESH_0][TURB_SOL]->GetNodes()->SetSolution(iPoint, iVar, pointValues[nVarFlow+iVar]);
+  }
+
+  /*--- Finalize the solution as a restart, halos, primitive variables and eddy viscosity, and
+   *    the coarse multigrid levels by the volume weighted average of their children. ---*/
+
+  auto Finalize = [&](unsigned short iMesh) {
+    solver[iMesh][FLOW_SOL]->InitiateComms(geometry[iMesh], config, SOLUTION);
+    solver[iMesh][FLOW_SOL]->CompleteComms(geometry[iMesh], config, SOLUTION);
+    if (turbulent) {
+      solver[iMesh][TURB_SOL]->InitiateComms(geometry[iMesh], config, SOLUTION_EDDY);
+      solver[iMesh][TURB_SOL]->CompleteComms(geometry[iMesh], config, SOLUTION_EDDY);
+    }
+    solver[iMesh][FLOW_SOL]->Preprocessing(geometry[iMesh], solver[iMesh], config, iMesh, NO_RK_ITER, RUNTIME_FLOW_SYS, false);
+    if (turbulent)
+      solver[iMesh][TURB_SOL]->Postprocessing(geometry[iMesh], solver[iMesh], config, iMesh);
+  };
+
+  Finalize(MESH_0);
+
+  for (unsigned short iMesh = 1; iMesh <= config->GetnMGLevels(); iMesh++) {
+    for (unsigned long iPoint = 0; iPoint < geometry[iMesh]->GetnPoint(); iPoint++) {
+      const su2double volume = geometry[iMesh]->node[iPoint]->GetVolume();
+      for (auto iSol : {FLOW_SOL, TURB_SOL}) {
+        if ((iSol == TURB_SOL) && !turbulent) continue;
+        CVariable* nodes = solver[iMesh][iSol]->GetNodes();
+        CVariable* fineNodes = solver[iMesh-1][iSol]->GetNodes();
+        for (unsigned short iVar = 0; iVar < solver[iMesh][iSol]->GetnVar(); iVar++) {
+          su2double value = 0.0;
+          for (unsigned short iChildren = 0; iChildren < geometry[iMesh]->node[iPoint]->GetnChildren_CV(); iChildren++) {
+            const unsigned long Point_Fine = geometry[iMesh]->node[iPoint]->GetChildren_CV(iChildren);
+            value += fineNodes->GetSolution(Point_Fine,iVar)*geometry[iMesh-1]->node[Point_Fine]->GetVolume()/volume;
+          }
+          nodes->SetSolution(iPoint, iVar, value);
+        }
+      }
+    }
+    Finalize(iMesh);
+  }
+
+}
@@ -42,6 +42,7 @@ int main(int argc, char *argv[]) {
 
   char config_file_name[MAX_STRING_SIZE];
   bool dry_run = false;
+  bool benchmark = false;
   int num_threads = omp_get_max_threads();
   bool use_thread_mult = false;
   std::string filename = "default.cfg";
@@ -51,6 +52,8 @@ int main(int argc, char *argv[]) {
   CLI::App app{"SU2 v7.0.3 \"Blackbird\", The Open-Source CFD Code"};
   app.add_flag("-d,--dryrun", dry_run, "Enable dry run mode.\n"
                                        "Only execute preprocessing steps using a dummy geometry.");
+  app.add_flag("-b,--benchmark", benchmark, "Enable benchmark mode.\n"
+                                            "Measure the throughput of the main kernels of the flow solver.");
   app.add_option("-t,--threads", num_threads, "Number of OpenMP threads per MPI rank.");
   app.add_flag("--thread_multiple", use_thread_mult, "Request MPI_THREAD_MULTIPLE thread support.");
   app.add_option("configfile", filename, "A config file.")->check(CLI::ExistingFile);
@@ -117,6 +120,83 @@ int main(int argc, char *argv[]) {
     /*--- Dry Run. ---*/
     driver = new CDummyDriver(config_file_name, nZone, MPICommunicator);
 
+  }
+  else if (benchmark) {
+
+    /*--- Micro-benchmarks of the kernels on the grid and state of the config. ---*/
+    if (nZone != 1 || multizone)
+      SU2_MPI::Error("The benchmark mode only supports single zone problems.", CURRENT_FUNCTION);
+
+    driver = new CBenchmarkDriver(config_file_name, nZone, MPICommunicator);
+
+  }
+  else if (config->GetnAdapt_Cycles() > 0) {
+
+    /*--- Cycles of solution and adaptation of the grid in memory, the last grid is solved by the main loop. ---*/
+    const auto kindSolver = config->GetKind_Solver();
+    if (nZone != 1 || multizone)
+      SU2_MPI::Error("ADAPT_CYCLES only supports single zone problems.", CURRENT_FUNCTION);
+    if ((kindSolver != EULER && kindSolver != NAVIER_STOKES && kindSolver != RANS) ||
+        config->GetTime_Domain() || disc_adj)
+      SU2_MPI::Error("ADAPT_CYCLES only supports steady compressible flow problems.", CURRENT_FUNCTION);
+    if (config->GetRestart())
+      SU2_MPI::Error("ADAPT_CYCLES starts from the initial grid, set RESTART_SOL= NO.", CURRENT_FUNCTION);
+
+    for (unsigned short iCycle = 0; iCycle < config->GetnAdapt_Cycles(); iCycle++) {
+      auto cycleDriver = new CAdaptationDriver(config_file_name, nZone, MPICommunicator);
+      cycleDriver->StartSolver();
+      cycleDriver->Adapt();
+      cycleDriver->Postprocessing();
+      delete cycleDriver;
+    }
+
+    driver = new CAdaptationDriver(config_file_name, nZone, MPICommunicator);
+
+  }
+  else if (config->GetLoadBalancing_Freq() > 0) {
+
+    /*--- Segments of the time loop on the partitions of the measured work, the grid and the solution
+     *    are passed in memory, the main loop finds the last segment already solved. ---*/
+    const auto kindSolver = config->GetKind_Solver();
+    const auto kindMovement = config->GetKind_GridMovement();
+    const bool dualTime = (config->GetTime_Marching() == DT_STEPPING_1ST) ||
+                          (config->GetTime_Marching() == DT_STEPPING_2ND);
+    if (nZone != 1 || multizone)
+      SU2_MPI::Error("LOAD_BALANCING_FREQ only supports single zone problems.", CURRENT_FUNCTION);
+    if ((kindSolver != EULER && kindSolver != NAVIER_STOKES && kindSolver != RANS) || !dualTime || disc_adj)
+      SU2_MPI::Error("LOAD_BALANCING_FREQ only supports unsteady (dual time) compressible flow problems.",
+                     CURRENT_FUNCTION);
+    if ((kindMovement != NO_MOVEMENT && kindMovement != RIGID_MOTION && kindMovement != ROTATING_FRAME) ||
+        config->GetDeform_Mesh() || config->GetDeform_Design() || (config->GetnMarker_Periodic() > 0))
+      SU2_MPI::Error("LOAD_BALANCING_FREQ only supports fixed, rigidly moving or rotating grids without periodicity.",
+                     CURRENT_FUNCTION);
+    if (config->GetPartition_Cache() || (config->GetTimePredictor_Order() > 2))
+      SU2_MPI::Error("LOAD_BALANCING_FREQ is not compatible with PARTITION_CACHE and TIME_PREDICTOR_ORDER= 3.",
+                     CURRENT_FUNCTION);
+    if (config->GetLoadBalancing_Tol() <= 1.0)
+      SU2_MPI::Error("LOAD_BALANCING_TOL must be larger than 1.", CURRENT_FUNCTION);
+
+    auto segmentDriver = new CLoadBalancingDriver(config_file_name, nZone, MPICommunicator);
+    segmentDriver->StartSolver();
+
+    while (segmentDriver->Rebalance()) {
+      segmentDriver->Postprocessing();
+      delete segmentDriver;
+      segmentDriver = new CLoadBalancingDriver(config_file_name, nZone, MPICommunicator);
+      segmentDriver->StartSolver();
+    }
+
+    driver = segmentDriver;
+
+  }
+  else if (config->GetUQ_Ensemble()) {
+
+    /*--- Members of the UQ study solved at once, on one geometry. ---*/
+    if (nZone != 1)
+      SU2_MPI::Error("UQ_ENSEMBLE only supports single zone problems.", CURRENT_FUNCTION);
+
+    driver = new CEnsembleDriver(config_file_name, nZone, MPICommunicator);
+
   }
   else if ((!multizone && !harmonic_balance && !turbo) || (turbo && disc_adj)) {
 
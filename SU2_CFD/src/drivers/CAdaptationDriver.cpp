@@ -0,0 +1,203 @@
+/*!
+ * \file CAdaptationDriver.cpp
+ * \brief Cycles of solution and refinement of the grid, with the grid and the solution passed in memory.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "../../include/drivers/CAdaptationDriver.hpp"
+#include "../../include/gradients/computeGradientsGreenGauss.hpp"
+#include "../../include/numerics/CNumerics.hpp"
+#include "../../../Common/include/geometry/CParallelGridAdaptation.hpp"
+#include "../../../Common/include/geometry/meshreader/CMemoryMeshReaderFVM.hpp"
+#include "../../include/CSolutionInterpolator.hpp"
+
+#include <cmath>
+
+namespace {
+
+/*--- Hessian of a scalar, the Green-Gauss gradient of its gradient (iPoint, iVar, iDim). ---*/
+struct CHessian {
+  unsigned short nDim;
+  vector<su2double> values;
+
+  CHessian(unsigned long nPoint, unsigned short val_nDim) : nDim(val_nDim), values(nPoint*nDim*nDim, 0.0) {}
+
+  su2double& operator() (unsigned long iPoint, unsigned long iVar, unsigned long iDim) {
+    return values[(iPoint*nDim + iVar)*nDim + iDim];
+  }
+};
+
+}
+
+/*!
+ * \brief Old grid and solution, kept between the driver that adapts the grid and the driver of the adapted grid.
+ */
+struct CAdaptationDriver::CSolutionTransfer {
+  unsigned short nVarFlow = 0;                  /*!< \brief Number of variables of the flow solver. */
+  unsigned short nVarTurb = 0;                  /*!< \brief Number of variables of the turbulence solver. */
+  CSolutionInterpolator* interpolator = nullptr; /*!< \brief Old grid and solution. */
+
+  ~CSolutionTransfer() { delete interpolator; }
+};
+
+CAdaptationDriver::CSolutionTransfer* CAdaptationDriver::transfer = nullptr;
+
+CAdaptationDriver::CAdaptationDriver(char* confFile,
+                                     unsigned short val_nZone,
+                                     SU2_Comm MPICommunicator) : CSinglezoneDriver(confFile,
+                                                                                   val_nZone,
+                                                                                   MPICommunicator) {
+  if (transfer != nullptr) InterpolateSolution();
+}
+
+vector<passivedouble> CAdaptationDriver::ComputeMetric() {
+
+  CConfig* config = config_container[ZONE_0];
+  CGeometry* geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  CVariable* nodes = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->GetNodes();
+
+  const unsigned short nDim = geometry->GetnDim();
+  const unsigned long nPoint = geometry->GetnPoint();
+  const unsigned long nPointDomain = geometry->GetnPointDomain();
+
+  /*--- Gradient of the density (a primitive variable), from the last iteration, with the halos. ---*/
+
+  su2activematrix densityGradient(nPoint, nDim);
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      densityGradient(iPoint,iDim) = nodes->GetGradient_Primitive(iPoint, nDim+2, iDim);
+
+  /*--- Its Green-Gauss gradient is the Hessian, only needed at the domain points (no comms). ---*/
+
+  CHessian hessian(nPoint, nDim);
+  computeGradientsGreenGauss(nullptr, PRIMITIVE_GRADIENT, PERIODIC_NONE, *geometry, *config,
+                             densityGradient, 0, nDim, hessian);
+
+  /*--- Metric |H| = V |Lambda| V^T of the symmetric part of the Hessian. ---*/
+
+  vector<passivedouble> metric(nPointDomain*nDim*nDim);
+
+  su2double A[3][3] = {{0.0}}, V[3][3] = {{0.0}}, lambda[3] = {0.0};
+  su2double *A_ij[3] = {A[0], A[1], A[2]}, *V_ij[3] = {V[0], V[1], V[2]};
+
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      for (unsigned short jDim = 0; jDim < nDim; jDim++)
+        A[iDim][jDim] = 0.5*(hessian(iPoint,iDim,jDim) + hessian(iPoint,jDim,iDim));
+
+    CNumerics::EigenDecomposition(A_ij, V_ij, lambda, nDim);
+
+    for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+      for (unsigned short jDim = 0; jDim < nDim; jDim++) {
+        su2double M_ij = 0.0;
+        for (unsigned short kDim = 0; kDim < nDim; kDim++)
+          M_ij += V[iDim][kDim]*fabs(lambda[kDim])*V[jDim][kDim];
+        metric[(iPoint*nDim + iDim)*nDim + jDim] = SU2_TYPE::GetValue(M_ij);
+      }
+    }
+  }
+
+  return metric;
+}
+
+void CAdaptationDriver::Adapt() {
+
+  CConfig* config = config_container[ZONE_0];
+  CGeometry* geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  CSolver** solver = solver_container[ZONE_0][INST_0][MESH_0];
+
+  const bool turbulent = (config->GetKind_Solver() == RANS);
+
+  /*--- Refine the grid by the metric, the adapted grid is held in memory for the next driver. ---*/
+
+  {
+    CParallelGridAdaptation adaptation(geometry, config);
+    adaptation.SetMarking(geometry, ComputeMetric(), 0.01*SU2_TYPE::GetValue(config->GetNew_Elem_Adapt()));
+    adaptation.SetEdgeSplitting(geometry);
+    adaptation.SetRefinement(geometry, config);
+
+    CAdaptedMesh mesh;
+    adaptation.GetMesh(geometry, config, mesh);
+    CMemoryMeshReaderFVM::SetMesh(move(mesh));
+  }
+
+  /*--- Keep the solution of the local points (the halos are up to date after the last iteration). ---*/
+
+  delete transfer;
+  transfer = new CSolutionTransfer;
+
+  const unsigned long nPoint = geometry->GetnPoint();
+
+  transfer->nVarFlow = solver[FLOW_SOL]->GetnVar();
+  transfer->nVarTurb = turbulent? solver[TURB_SOL]->GetnVar() : 0;
+  const unsigned short nVar = transfer->nVarFlow + transfer->nVarTurb;
+
+  vector<passivedouble> solution(nPoint*nVar);
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+    passivedouble* values = &solution[iPoint*nVar];
+    for (unsigned short iVar = 0; iVar < transfer->nVarFlow; iVar++)
+      values[iVar] = SU2_TYPE::GetValue(solver[FLOW_SOL]->GetNodes()->GetSolution(iPoint,iVar));
+    for (unsigned short iVar = 0; iVar < transfer->nVarTurb; iVar++)
+      values[transfer->nVarFlow+iVar] = SU2_TYPE::GetValue(solver[TURB_SOL]->GetNodes()->GetSolution(iPoint,iVar));
+  }
+
+  /*--- The elements of the old grid are kept in an ADT (CSolutionInterpolator). ---*/
+
+  transfer->interpolator = new CSolutionInterpolator(geometry, nVar, move(solution));
+}
+
+void CAdaptationDriver::InterpolateSolution() {
+
+  CConfig* config = config_container[ZONE_0];
+  CGeometry** geometry = geometry_container[ZONE_0][INST_0];
+  CSolver*** solver = solver_container[ZONE_0][INST_0];
+
+  const unsigned short nVarFlow = transfer->nVarFlow, nVarTurb = transfer->nVarTurb;
+
+  if ((solver[MESH_0][FLOW_SOL]->GetnVar() != nVarFlow) ||
+      ((nVarTurb > 0) && (solver[MESH_0][TURB_SOL]->GetnVar() != nVarTurb)))
+    SU2_MPI::Error("The solvers of the adapted grid differ from those of the previous grid.", CURRENT_FUNCTION);
+
+  /*--- Interpolate from the elements of the old grid that contain the domain points, or else
+   *    the nearest old point (a boundary point missed by the tolerance of the search). ---*/
+
+  vector<passivedouble> solution;
+  const unsigned long nNearest = transfer->interpolator->Interpolate(geometry[MESH_0], solution);
+
+  /*--- The old grid and solution are no longer needed. ---*/
+
+  delete transfer;
+  transfer = nullptr;
+
+  if (rank == MASTER_NODE) {
+    cout << "Solution interpolated from the previous grid";
+    if (nNearest > 0) cout << " (" << nNearest << " points out of the old elements take the nearest point)";
+    cout << "." << endl;
+  }
+
+  CSolutionInterpolator::SetRestartSolution(geometry, solver, config, solution, nVarFlow+nVarTurb);
+
+}
@@ -0,0 +1,357 @@
+/*!
+ * \file CBenchmarkDriver.cpp
+ * \brief Micro-benchmarks of the main kernels of the flow solver.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/drivers/CBenchmarkDriver.hpp"
+#include "../../include/variables/CEulerVariable.hpp"
+#include "../../include/numerics/flow/convection/roe.hpp"
+#include "../../include/numerics/flow/convection/hllc.hpp"
+#include "../../include/numerics/flow/convection/ausm_slau.hpp"
+#include "../../include/numerics/flow/flow_diffusion.hpp"
+#include "../../include/limiters/computeLimiters.hpp"
+
+#include <chrono>
+#include <cmath>
+
+CBenchmarkDriver::CBenchmarkDriver(char* confFile,
+                                   unsigned short val_nZone,
+                                   SU2_Comm MPICommunicator) : CSinglezoneDriver(confFile,
+                                                                                 val_nZone,
+                                                                                 MPICommunicator) {
+}
+
+passivedouble CBenchmarkDriver::TimeKernel(const std::function<void()>& kernel, unsigned long& nRep) const {
+
+  using Clock = chrono::steady_clock;
+
+  auto maxOverRanks = [](passivedouble local) {
+    passivedouble global = local;
+#ifdef HAVE_MPI
+    SelectMPIWrapper<passivedouble>::W::Allreduce(&local, &global, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+#endif
+    return global;
+  };
+
+  /*--- The first call is a warm-up, its (slowest) time sets the number of repetitions of all ranks,
+   *    as the kernels may communicate. ---*/
+
+  SU2_MPI::Barrier(MPI_COMM_WORLD);
+  auto start = Clock::now();
+  kernel();
+  const passivedouble warmUp = maxOverRanks(chrono::duration<passivedouble>(Clock::now() - start).count());
+
+  nRep = MaxRepetitions;
+  if (warmUp*MaxRepetitions > MinKernelTime)
+    nRep = max<unsigned long>(1, static_cast<unsigned long>(ceil(MinKernelTime / warmUp)));
+
+  SU2_MPI::Barrier(MPI_COMM_WORLD);
+  start = Clock::now();
+  for (auto iRep = 0ul; iRep < nRep; ++iRep) kernel();
+  const passivedouble elapsed = chrono::duration<passivedouble>(Clock::now() - start).count();
+
+  return maxOverRanks(elapsed) / nRep;
+}
+
+void CBenchmarkDriver::PrintRow(PrintingToolbox::CTablePrinter& table, const string& name, unsigned long nRep,
+                                passivedouble time, passivedouble work, const string& unit) const {
+
+  if (rank != MASTER_NODE) return;
+
+  const passivedouble throughput = (unit == "GB/s")? work / time / 1e9 : work / time;
+
+  table << name << nRep << time*1e3 << throughput << unit;
+}
+
+void CBenchmarkDriver::StartSolver() {
+
+  CConfig* config = config_container[ZONE_0];
+
+  const auto kindSolver = config->GetKind_Solver();
+  if ((kindSolver != EULER) && (kindSolver != NAVIER_STOKES) && (kindSolver != RANS)) {
+    SU2_MPI::Error("The benchmark mode requires a compressible flow problem (SOLVER= EULER, NAVIER_STOKES or RANS).",
+                   CURRENT_FUNCTION);
+  }
+
+  if (rank == MASTER_NODE) {
+    cout << endl <<"------------------------------ Begin Benchmark --------------------------" << endl;
+    cout << "One iteration is run to set the state, gradients and Jacobian of the kernels." << endl;
+  }
+
+  /*--- One iteration, the kernels then work on realistic values. ---*/
+
+  Preprocess(0);
+  Run();
+
+  PrintingToolbox::CTablePrinter table(&cout);
+  table.AddColumn("Kernel", 28);
+  table.AddColumn("Calls", 8);
+  table.AddColumn("Time/call [ms]", 15);
+  table.AddColumn("Throughput", 13);
+  table.AddColumn("Unit", 8);
+  table.SetAlign(PrintingToolbox::CTablePrinter::LEFT);
+
+  if (rank == MASTER_NODE) {
+    cout << endl << "-- Kernel benchmarks (slowest rank, numerics on one thread per rank, "
+         << size << " rank(s) x " << omp_get_max_threads() << " thread(s)):" << endl;
+    table.PrintHeader();
+  }
+
+  BenchmarkNumerics(table);
+
+  BenchmarkGradients(table);
+
+  if (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) {
+    BenchmarkLinearAlgebra(table, solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->Jacobian);
+  }
+
+  if (rank == MASTER_NODE) {
+    table.PrintFooter();
+    if (config->GetKind_TimeIntScheme_Flow() != EULER_IMPLICIT)
+      cout << "The sparse linear algebra is not benchmarked, it requires TIME_DISCRE_FLOW= EULER_IMPLICIT." << endl;
+  }
+
+}
+
+void CBenchmarkDriver::BenchmarkNumerics(PrintingToolbox::CTablePrinter& table) {
+
+  CConfig* config = config_container[ZONE_0];
+  CGeometry* geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  CSolver* solver = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL];
+  CSolver* turbSolver = solver_container[ZONE_0][INST_0][MESH_0][TURB_SOL];
+  auto nodes = static_cast<CEulerVariable*>(solver->GetNodes());
+
+  const auto nDim = geometry->GetnDim();
+  const auto nVar = solver->GetnVar();
+  const auto nEdge = geometry->GetnEdge();
+  const bool tkeNeeded = (config->GetKind_Turb_Model() == SST) || (config->GetKind_Turb_Model() == SST_SUST);
+
+  unsigned long nEdgeLocal = nEdge, nEdgeGlobal = 0;
+  SU2_MPI::Allreduce(&nEdgeLocal, &nEdgeGlobal, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+
+  /*--- Convective schemes, first order (no reconstruction). ---*/
+
+  const unsigned short nScheme = 3;
+  const string schemeName[nScheme] = {"Roe", "HLLC", "AUSM"};
+  CNumerics* scheme[nScheme] = {new CUpwRoe_Flow(nDim, nVar, config, false),
+                                new CUpwHLLC_Flow(nDim, nVar, config),
+                                new CUpwAUSM_Flow(nDim, nVar, config)};
+
+  for (unsigned short iScheme = 0; iScheme < nScheme; ++iScheme) {
+    CNumerics* numerics = scheme[iScheme];
+
+    auto kernel = [&]() {
+      for (auto iEdge = 0ul; iEdge < nEdge; ++iEdge) {
+        const auto iPoint = geometry->GetEdgeNode(iEdge,0);
+        const auto jPoint = geometry->GetEdgeNode(iEdge,1);
+
+        numerics->SetNormal(geometry->GetEdgeNormal(iEdge));
+        numerics->SetPrimitive(nodes->GetPrimitive(iPoint), nodes->GetPrimitive(jPoint));
+        numerics->SetSecondary(nodes->GetSecondary(iPoint), nodes->GetSecondary(jPoint));
+
+        numerics->ComputeResidual(config);
+      }
+    };
+
+    unsigned long nRep = 0;
+    const auto time = TimeKernel(kernel, nRep);
+    PrintRow(table, "Numerics " + schemeName[iScheme], nRep, time, nEdgeGlobal, "edges/s");
+
+    delete numerics;
+  }
+
+  /*--- Viscous fluxes, with the corrected average of the gradients. ---*/
+
+  CNumerics* numerics = new CAvgGrad_Flow(nDim, nVar, true, config);
+
+  auto kernel = [&]() {
+    for (auto iEdge = 0ul; iEdge < nEdge; ++iEdge) {
+      const auto iPoint = geometry->GetEdgeNode(iEdge,0);
+      const auto jPoint = geometry->GetEdgeNode(iEdge,1);
+
+      numerics->SetCoord(geometry->node[iPoint]->GetCoord(), geometry->node[jPoint]->GetCoord());
+      numerics->SetNormal(geometry->GetEdgeNormal(iEdge));
+      numerics->SetEdgeGeometry(geometry->GetEdgeGeometry(iEdge));
+
+      numerics->SetPrimitive(nodes->GetPrimitive(iPoint), nodes->GetPrimitive(jPoint));
+      numerics->SetSecondary(nodes->GetSecondary(iPoint), nodes->GetSecondary(jPoint));
+      numerics->SetPrimVarGradient(nodes->GetGradient_Primitive(iPoint), nodes->GetGradient_Primitive(jPoint));
+
+      if (tkeNeeded)
+        numerics->SetTurbKineticEnergy(turbSolver->GetNodes()->GetSolution(iPoint,0),
+                                       turbSolver->GetNodes()->GetSolution(jPoint,0));
+
+      numerics->SetTauWall(nodes->GetTauWall(iPoint), nodes->GetTauWall(jPoint));
+
+      numerics->ComputeResidual(config);
+    }
+  };
+
+  unsigned long nRep = 0;
+  const auto time = TimeKernel(kernel, nRep);
+  PrintRow(table, "Numerics AvgGrad", nRep, time, nEdgeGlobal, "edges/s");
+
+  delete numerics;
+}
+
+void CBenchmarkDriver::BenchmarkGradients(PrintingToolbox::CTablePrinter& table) {
+
+  CConfig* config = config_container[ZONE_0];
+  CGeometry* geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  CSolver* solver = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL];
+  auto nodes = static_cast<CEulerVariable*>(solver->GetNodes());
+
+  const bool hybrid = solver->GetHasHybridParallel();
+  const auto nEdge = geometry->GetnEdge();
+
+  unsigned long nEdgeLocal = nEdge, nEdgeGlobal = 0;
+  SU2_MPI::Allreduce(&nEdgeLocal, &nEdgeGlobal, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+
+  unsigned long nRep = 0;
+  passivedouble time = 0.0;
+
+  time = TimeKernel([&]() {
+    SU2_OMP_PARALLEL_(if(hybrid))
+    solver->SetPrimitive_Gradient_GG(geometry, config);
+  }, nRep);
+  PrintRow(table, "Gradient Green-Gauss", nRep, time, nEdgeGlobal, "edges/s");
+
+  /*--- The least squares matrices are only allocated if some gradient of the config needs them. ---*/
+
+  if (config->GetLeastSquaresRequired()) {
+    time = TimeKernel([&]() {
+      SU2_OMP_PARALLEL_(if(hybrid))
+      solver->SetPrimitive_Gradient_LS(geometry, config);
+    }, nRep);
+    PrintRow(table, "Gradient least squares", nRep, time, nEdgeGlobal, "edges/s");
+  }
+
+  /*--- Limiters of the reconstruction gradients (also allocated if the limiters are not used). ---*/
+
+  if (nodes->GetLimiter_Primitive().empty()) return;
+
+  const unsigned short nLimiter = 3;
+  const string limiterName[nLimiter] = {"Barth-Jespersen", "Venkatakrishnan", "Venkatakrishnan-Wang"};
+  const ENUM_LIMITER limiterKind[nLimiter] = {BARTH_JESPERSEN, VENKATAKRISHNAN, VENKATAKRISHNAN_WANG};
+
+  for (unsigned short iLimiter = 0; iLimiter < nLimiter; ++iLimiter) {
+    time = TimeKernel([&]() {
+      SU2_OMP_PARALLEL_(if(hybrid))
+      computeLimiters(limiterKind[iLimiter], solver, PRIMITIVE_LIMITER, PERIODIC_LIM_PRIM_1, PERIODIC_LIM_PRIM_2,
+                      *geometry, *config, 0, solver->GetnPrimVarGrad(), nodes->GetPrimitive(),
+                      nodes->GetGradient_Reconstruction(), nodes->GetSolution_Min(), nodes->GetSolution_Max(),
+                      nodes->GetLimiter_Primitive());
+    }, nRep);
+    PrintRow(table, "Limiter " + limiterName[iLimiter], nRep, time, nEdgeGlobal, "edges/s");
+  }
+}
+
+template<class ScalarType>
+void CBenchmarkDriver::BenchmarkLinearAlgebra(PrintingToolbox::CTablePrinter& table, CSysMatrix<ScalarType>& Jacobian) {
+
+  CConfig* config = config_container[ZONE_0];
+  CGeometry* geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  CSolver* solver = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL];
+
+  const bool hybrid = solver->GetHasHybridParallel();
+  const auto nVar = solver->GetnVar();
+  const auto nPoint = geometry->GetnPoint();
+  const auto nPointDomain = geometry->GetnPointDomain();
+
+  auto sumOverRanks = [](passivedouble local) {
+    passivedouble global = local;
+#ifdef HAVE_MPI
+    SelectMPIWrapper<passivedouble>::W::Allreduce(&local, &global, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#endif
+    return global;
+  };
+
+  /*--- Minimum traffic of one pass over the blocks and column indices of a pattern, and two vectors. ---*/
+
+  auto matrixBytes = [&](unsigned long fillLevel) {
+    const auto nnz = geometry->GetSparsePattern(ConnectivityType::FiniteVolume, fillLevel).getNumNonZeros();
+    return sumOverRanks(passivedouble(nnz*(nVar*nVar*sizeof(ScalarType) + sizeof(unsigned long)) +
+                                      nPointDomain*(sizeof(unsigned long) + 2*nVar*sizeof(ScalarType))));
+  };
+
+  CSysVector<ScalarType> x(nPoint, nPointDomain, nVar, 1.0), y(nPoint, nPointDomain, nVar, 0.0);
+
+  unsigned long nRep = 0;
+  passivedouble time = 0.0;
+  const passivedouble bytes = matrixBytes(0);
+
+  time = TimeKernel([&]() {
+    SU2_OMP_PARALLEL_(if(hybrid))
+    Jacobian.MatrixVectorProduct(x, y, geometry, config);
+  }, nRep);
+  PrintRow(table, "Matrix-vector product", nRep, time, bytes, "GB/s");
+
+  time = TimeKernel([&]() {
+    SU2_OMP_PARALLEL_(if(hybrid))
+    Jacobian.ComputeLU_SGSPreconditioner(x, y, geometry, config);
+  }, nRep);
+  PrintRow(table, "LU-SGS application", nRep, time, bytes, "GB/s");
+
+  /*--- The ILU factors are only allocated if the config uses them. ---*/
+
+  if (config->GetKind_Linear_Solver_Prec() == ILU) {
+    const passivedouble bytesILU = matrixBytes(config->GetLinear_Solver_ILU_n());
+
+    time = TimeKernel([&]() {
+      SU2_OMP_PARALLEL_(if(hybrid))
+      Jacobian.BuildILUPreconditioner();
+    }, nRep);
+    PrintRow(table, "ILU factorization", nRep, time, bytesILU, "GB/s");
+
+    time = TimeKernel([&]() {
+      SU2_OMP_PARALLEL_(if(hybrid))
+      Jacobian.ComputeILUPreconditioner(x, y, geometry, config);
+    }, nRep);
+    PrintRow(table, "ILU application", nRep, time, bytesILU, "GB/s");
+  }
+
+  /*--- BLAS-1 on the vectors of the linear system, bytes read and written per entry. ---*/
+
+  CSysVector<su2double> u(nPoint, nPointDomain, nVar, 1.0), v(nPoint, nPointDomain, nVar, 1e-3);
+  const passivedouble entryBytes = sumOverRanks(passivedouble(nPointDomain*nVar*sizeof(su2double)));
+
+  time = TimeKernel([&]() {
+    SU2_OMP_PARALLEL_(if(hybrid))
+    u.dot(v);
+  }, nRep);
+  PrintRow(table, "Vector dot product", nRep, time, 2*entryBytes, "GB/s");
+
+  time = TimeKernel([&]() {
+    SU2_OMP_PARALLEL_(if(hybrid))
+    u.Plus_AX(0.5, v);
+  }, nRep);
+  PrintRow(table, "Vector axpy", nRep, time, 3*entryBytes, "GB/s");
+
+  time = TimeKernel([&]() {
+    SU2_OMP_PARALLEL_(if(hybrid))
+    u *= 0.999;
+  }, nRep);
+  PrintRow(table, "Vector scaling", nRep, time, 2*entryBytes, "GB/s");
+}
@@ -196,6 +196,10 @@ void CDiscAdjMultizoneDriver::Run() {
     Add_Solution_To_External(iZone);
   }
 
+  /*--- The quasi-Newton acceleration starts from the initial (or restart) adjoint solution. ---*/
+
+  InitializeQuasiNewton(true);
+
   /*--- Loop over the number of outer iterations. ---*/
 
   for (unsigned long iOuterIter = 0, StopCalc = false; !StopCalc; iOuterIter++) {
@@ -205,6 +209,21 @@ void CDiscAdjMultizoneDriver::Run() {
     for (iZone = 0; iZone < nZone; iZone++)
       config_container[iZone]->SetOuterIter(iOuterIter);
 
+    /*--- The previous outer iteration computed G(x_k) in the BGS solution of all zones, it is replaced by the
+     *    quasi-Newton update. The cross terms (External) are not part of the update, they follow from the
+     *    adjoint solutions by the next iteration. ---*/
+
+    if (quasiNewton.active()) {
+      if (iOuterIter > 0) {
+        QuasiNewtonBGSVector(true, true, quasiNewton.FPresult());
+        quasiNewton.compute();
+        QuasiNewtonBGSVector(true, false, quasiNewton.CurrentSolution());
+      }
+      else {
+        QuasiNewtonBGSVector(true, true, quasiNewton.CurrentSolution());
+      }
+    }
+
     /*--- For the adjoint iteration we need the derivatives of the iteration function with
      *    respect to the state (and possibly the mesh coordinate) variables.
      *    Since these derivatives do not change in the steady state case we only have to record
@@ -223,9 +242,11 @@ void CDiscAdjMultizoneDriver::Run() {
     /*--- If we want to set up zone-specific tapes (retape), we do not need to record
      *    here. Otherwise, the whole tape of a coupled run will be created. ---*/
 
-    if (!retape && (RecordingState != FLOW_CONS_VARS)) {
+    const unsigned short mainRecording = driver_config->GetDiscAdj_Combined_Recording()? COMBINED : FLOW_CONS_VARS;
+
+    if (!retape && (RecordingState != mainRecording)) {
       SetRecording(NONE, Kind_Tape::FULL_TAPE, ZONE_0);
-      SetRecording(FLOW_CONS_VARS, Kind_Tape::FULL_TAPE, ZONE_0);
+      SetRecording(mainRecording, Kind_Tape::FULL_TAPE, ZONE_0);
     }
 
     /*-- Start loop over zones. ---*/
@@ -339,11 +360,16 @@ void CDiscAdjMultizoneDriver::EvaluateSensitivities(unsigned long iOuterIter, bo
   /*--- SetRecording stores the computational graph on one iteration of the direct problem. Calling it with NONE
    *    as argument ensures that all information from a previous recording is removed. ---*/
 
-  SetRecording(NONE, Kind_Tape::FULL_TAPE, ZONE_0);
+  /*--- A combined recording already has the mesh coordinates as input. ---*/
+
+  if (RecordingState != COMBINED) {
+
+    SetRecording(NONE, Kind_Tape::FULL_TAPE, ZONE_0);
 
-  /*--- Store the computational graph of one direct iteration with the mesh coordinates as input. ---*/
+    /*--- Store the computational graph of one direct iteration with the mesh coordinates as input. ---*/
 
-  SetRecording(MESH_COORDS, Kind_Tape::FULL_TAPE, ZONE_0);
+    SetRecording(MESH_COORDS, Kind_Tape::FULL_TAPE, ZONE_0);
+  }
 
   /*--- Initialize the adjoint of the output variables of the iteration with the adjoint solution
    *    of the current iteration. The values are passed to the AD tool. ---*/
@@ -418,6 +444,7 @@ void CDiscAdjMultizoneDriver::EvaluateSensitivities(unsigned long iOuterIter, bo
 void CDiscAdjMultizoneDriver::SetRecording(unsigned short kind_recording, Kind_Tape tape_type, unsigned short record_zone) {
 
   AD::Reset();
+  CNumerics::ResetTapeReport();
 
   /*--- Prepare for recording by resetting the flow solution to the initial converged solution---*/
 
@@ -438,6 +465,7 @@ void CDiscAdjMultizoneDriver::SetRecording(unsigned short kind_recording, Kind_T
     case NONE:           cout << "Clearing the computational graph." << endl; break;
     case MESH_COORDS:    cout << "Storing computational graph wrt MESH COORDINATES." << endl; break;
     case FLOW_CONS_VARS: cout << "Storing computational graph wrt CONSERVATIVE VARIABLES." << endl; break;
+    case COMBINED:       cout << "Storing computational graph wrt CONSERVATIVE VARIABLES and MESH COORDINATES." << endl; break;
     }
   }
 
@@ -457,7 +485,15 @@ void CDiscAdjMultizoneDriver::SetRecording(unsigned short kind_recording, Kind_T
 
       unsigned short type_recording = kind_recording;
 
-      if (Has_Deformation(iZone) && (kind_recording == MESH_COORDS)) {
+      /*--- A combined recording registers the state variables and the geometric inputs. ---*/
+
+      if (kind_recording == COMBINED) {
+        iteration_container[iZone][INST_0]->RegisterInput(solver_container, geometry_container,
+                                                          config_container, iZone, INST_0, FLOW_CONS_VARS);
+        type_recording = MESH_COORDS;
+      }
+
+      if (Has_Deformation(iZone) && (type_recording == MESH_COORDS)) {
         type_recording = MESH_DEFORM;
       }
 
@@ -517,6 +553,7 @@ void CDiscAdjMultizoneDriver::SetRecording(unsigned short kind_recording, Kind_T
   if (rank == MASTER_NODE) {
     if(kind_recording != NONE && config_container[record_zone]->GetWrt_AD_Statistics()) {
       AD::PrintStatistics();
+      CNumerics::PrintTapeReport();
     }
     cout << "-------------------------------------------------------------------------\n" << endl;
   }
@@ -540,7 +577,7 @@ void CDiscAdjMultizoneDriver::DirectIteration(unsigned short iZone, unsigned sho
 
   /*--- Print residuals in the first iteration ---*/
 
-  if (rank == MASTER_NODE && kind_recording == FLOW_CONS_VARS) {
+  if (rank == MASTER_NODE && (kind_recording == FLOW_CONS_VARS || kind_recording == COMBINED)) {
 
     auto solvers = solver_container[iZone][INST_0][MESH_0];
 
@@ -769,14 +806,14 @@ void CDiscAdjMultizoneDriver::SetObjFunction(unsigned short kind_recording) {
         break;
     }
 
-    if (ObjectiveNotCovered && (rank == MASTER_NODE) && (kind_recording == FLOW_CONS_VARS))
+    if (ObjectiveNotCovered && (rank == MASTER_NODE) && (kind_recording == FLOW_CONS_VARS || kind_recording == COMBINED))
       cout << " Objective function not covered in Zone " << iZone << endl;
   }
 
   if (rank == MASTER_NODE) {
     AD::RegisterOutput(ObjFunc);
     AD::SetIndex(ObjFunc_Index, ObjFunc);
-    if (kind_recording == FLOW_CONS_VARS) {
+    if (kind_recording == FLOW_CONS_VARS || kind_recording == COMBINED) {
       cout << " Objective function                   : " << ObjFunc;
       if (driver_config->GetWrt_AD_Statistics()){
         cout << " (" << ObjFunc_Index << ")\n";
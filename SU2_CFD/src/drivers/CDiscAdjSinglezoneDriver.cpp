@@ -29,6 +29,15 @@
 #include "../../include/output/tools/CWindowingTools.hpp"
 #include "../../include/output/COutputFactory.hpp"
 #include "../../include/output/COutputLegacy.hpp"
+#include "../../../Common/include/linear_algebra/CPreconditioner.hpp"
+
+namespace {
+/*--- The fixed-point operator (the tape) already includes the approximate inverse of the Jacobian. ---*/
+class CIdentityPreconditioner final : public CPreconditioner<passivedouble> {
+public:
+  inline void operator()(const CSysVector<passivedouble> & u, CSysVector<passivedouble> & v) const override { v = u; }
+};
+}
 
 CDiscAdjSinglezoneDriver::CDiscAdjSinglezoneDriver(char* confFile,
                                                    unsigned short val_nZone,
@@ -111,6 +120,61 @@ CDiscAdjSinglezoneDriver::CDiscAdjSinglezoneDriver(char* confFile,
 
  direct_output->PreprocessHistoryOutput(config, false);
 
+  /*--- Adjoint solvers of the fixed point (accelerated by the Krylov or quasi-Newton methods, or with separate
+   *    objectives), as in CDiscAdjFluidIteration::Iterate. ---*/
+
+  const bool separate = config->GetDiscAdj_Separate_Objectives();
+  const auto nQuasiNewton = config->GetnQuasiNewtonSamples();
+
+  if ((nQuasiNewton > 0) && (config->GetKind_Solver() == DISC_ADJ_FEM)) {
+    adjointSolvers.push_back(ADJFEA_SOL);
+  }
+  else if ((nQuasiNewton > 0) && (config->GetKind_Solver() == DISC_ADJ_HEAT)) {
+    adjointSolvers.push_back(ADJHEAT_SOL);
+  }
+  else if (config->GetDiscAdj_Krylov() || separate || (nQuasiNewton > 0)) {
+    const bool turbulent = (config->GetKind_Solver() == DISC_ADJ_RANS) || (config->GetKind_Solver() == DISC_ADJ_INC_RANS);
+
+    adjointSolvers.push_back(ADJFLOW_SOL);
+    if (turbulent && !config->GetFrozen_Visc_Disc()) adjointSolvers.push_back(ADJTURB_SOL);
+    if (config->GetWeakly_Coupled_Heat()) adjointSolvers.push_back(ADJHEAT_SOL);
+    if (config->AddRadiation()) adjointSolvers.push_back(ADJRAD_SOL);
+
+    for (auto iSol : adjointSolvers) adjointNVar += solver[iSol]->GetnVar();
+  }
+
+  /*--- The halo entries are unknowns of the fixed point like the domain ones (their adjoints
+   *    are extracted and seeded back), hence they are also part of the inner products. ---*/
+
+  const auto nPoint = geometry->GetnPoint();
+
+  if (config->GetDiscAdj_Krylov()) {
+    krylovRHS.Initialize(nPoint, nPoint, adjointNVar, 0.0);
+    krylovSol.Initialize(nPoint, nPoint, adjointNVar, 0.0);
+    adjointOld.Initialize(nPoint, nPoint, adjointNVar, 0.0);
+  }
+
+  if (nQuasiNewton > 0) {
+    quasiNewton.resize(nQuasiNewton, nPoint*adjointNVar, nPoint*adjointNVar);
+  }
+
+  /*--- All objectives start from the initial adjoint solution, the restart of objective 0 is written
+   *    by the output as usual (under the name of that objective), the others by SecondaryRecording. ---*/
+
+  if (separate) {
+    const auto nObj = config->GetnObj();
+    ObjFunc_Separate.resize(nObj, 0.0);
+    adjointStates.resize(nObj);
+    for (auto& state : adjointStates) {
+      state.Initialize(nPoint, nPoint, adjointNVar, 0.0);
+      GetAdjointSolution(state);
+    }
+    output_container[ZONE_0]->SetRestart_Filename(config->GetObjFunc_Extension(config->GetRestart_AdjFileName(), 0));
+
+    if (rank == MASTER_NODE)
+      cout << "The adjoints of the " << nObj << " objective functions are converged separately (one direction each)." << endl;
+  }
+
 }
 
 CDiscAdjSinglezoneDriver::~CDiscAdjSinglezoneDriver(void) {
@@ -133,7 +197,9 @@ void CDiscAdjSinglezoneDriver::Preprocess(unsigned long TimeIter) {
    *--- respect to the conservative variables. Since these derivatives do not change in the steady state case
    *--- we only have to record if the current recording is different from the main variables. ---*/
 
-  if (RecordingState != MainVariables){
+  const unsigned short mainRecording = config->GetDiscAdj_Combined_Recording()? COMBINED : MainVariables;
+
+  if (RecordingState != mainRecording){
 
     MainRecording();
 
@@ -146,6 +212,10 @@ void CDiscAdjSinglezoneDriver::Run() {
   bool steady = !config->GetTime_Domain();
   unsigned long Adjoint_Iter;
 
+  /*--- The fixed point changes with each time step. ---*/
+
+  quasiNewton.reset();
+
   for (Adjoint_Iter = 0; Adjoint_Iter < nAdjoint_Iter; Adjoint_Iter++) {
 
     /*--- Initialize the adjoint of the output variables of the iteration with the adjoint solution
@@ -154,6 +224,22 @@ void CDiscAdjSinglezoneDriver::Run() {
 
     config->SetInnerIter(Adjoint_Iter);
 
+    /*--- Correct the adjoint solution with the residual of the previous iteration. ---*/
+
+    if (config->GetDiscAdj_Krylov() && (Adjoint_Iter > 0)) KrylovIteration();
+
+    if (quasiNewton.active() && (Adjoint_Iter > 0)) QuasiNewtonIteration();
+
+    /*--- With separate objectives each one is seeded on its direction, the last is objective 0 such that
+     *    the solvers hold its adjoint for the monitoring and output (the convergence is that of objective 0). ---*/
+
+    for (auto iObj = ObjFunc_Separate.size(); iObj-- > 1;) {
+      SetActiveObjective(iObj);
+      iteration->InitializeAdjoint(solver_container, geometry_container, config_container, ZONE_0, INST_0);
+      SetAdj_ObjFunction();
+    }
+    if (!ObjFunc_Separate.empty()) SetActiveObjective(0);
+
     iteration->InitializeAdjoint(solver_container, geometry_container, config_container, ZONE_0, INST_0);
 
     /*--- Initialize the adjoint of the objective function with 1.0. ---*/
@@ -162,10 +248,18 @@ void CDiscAdjSinglezoneDriver::Run() {
 
     /*--- Interpret the stored information by calling the corresponding routine of the AD tool. ---*/
 
-    AD::ComputeAdjoint();
+    ComputeAdjoint_Iteration();
 
     /*--- Extract the computed adjoint values of the input variables and store them for the next iteration. ---*/
 
+    for (auto iObj = ObjFunc_Separate.size(); iObj-- > 1;) {
+      SetActiveObjective(iObj);
+      iteration->Iterate(output_container[ZONE_0], integration_container, geometry_container,
+                         solver_container, numerics_container, config_container,
+                         surface_movement, grid_movement, FFDBox, ZONE_0, INST_0);
+    }
+    if (!ObjFunc_Separate.empty()) SetActiveObjective(0);
+
     iteration->Iterate(output_container[ZONE_0], integration_container, geometry_container,
                          solver_container, numerics_container, config_container,
                          surface_movement, grid_movement, FFDBox, ZONE_0, INST_0);
@@ -193,6 +287,173 @@ void CDiscAdjSinglezoneDriver::Run() {
 
 }
 
+void CDiscAdjSinglezoneDriver::ComputeAdjoint_Iteration() {
+
+  /*--- The geometric inputs only influence the iteration through the geometry section, its evaluation
+   *    (e.g. the adjoint of the mesh deformation) is left for the sensitivities. ---*/
+
+  if (RecordingState == COMBINED) AD::ComputeAdjoint(ITERATION, GEOMETRY);
+  else AD::ComputeAdjoint();
+}
+
+void CDiscAdjSinglezoneDriver::GetAdjointSolution(CSysVector<passivedouble>& u) const {
+
+  const auto nPoint = geometry->GetnPoint();
+
+  unsigned short offset = 0;
+  for (auto iSol : adjointSolvers) {
+    const auto nodes = solver[iSol]->GetNodes();
+    const auto nVar = solver[iSol]->GetnVar();
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
+      for (auto iVar = 0u; iVar < nVar; iVar++)
+        u(iPoint, offset+iVar) = SU2_TYPE::GetValue(nodes->GetSolution(iPoint, iVar));
+    offset += nVar;
+  }
+}
+
+void CDiscAdjSinglezoneDriver::SetAdjointSolution(const CSysVector<passivedouble>& u) {
+
+  const auto nPoint = geometry->GetnPoint();
+
+  unsigned short offset = 0;
+  for (auto iSol : adjointSolvers) {
+    auto nodes = solver[iSol]->GetNodes();
+    const auto nVar = solver[iSol]->GetnVar();
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
+      for (auto iVar = 0u; iVar < nVar; iVar++)
+        nodes->SetSolution(iPoint, iVar, u(iPoint, offset+iVar));
+    offset += nVar;
+  }
+}
+
+void CDiscAdjSinglezoneDriver::SetActiveObjective(unsigned short iObj) {
+
+  if (iObj != activeObj) {
+    GetAdjointSolution(adjointStates[activeObj]);
+    SetAdjointSolution(adjointStates[iObj]);
+    activeObj = iObj;
+  }
+  AD::SetDirection(iObj);
+}
+
+void CDiscAdjSinglezoneDriver::AdjointProduct(const CSysVector<passivedouble>& u, CSysVector<passivedouble>& v) {
+
+  const auto nPoint = geometry->GetnPoint();
+
+  /*--- Save a tape evaluation for the initial guess of FGMRES. ---*/
+
+  if (u.norm() == 0.0) {
+    v = 0.0;
+    return;
+  }
+
+  /*--- Seed the outputs of the iteration with u. ---*/
+
+  SetAdjointSolution(u);
+
+  iteration->InitializeAdjoint(solver_container, geometry_container, config_container, ZONE_0, INST_0);
+
+  ComputeAdjoint_Iteration();
+
+  /*--- The adjoints of the inputs are G^T u. ---*/
+
+  unsigned short offset = 0;
+  for (auto iSol : adjointSolvers) {
+    solver[iSol]->ExtractAdjoint_Solution(geometry, config);
+
+    auto nodes = solver[iSol]->GetNodes();
+    const auto nVar = solver[iSol]->GetnVar();
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
+      for (auto iVar = 0u; iVar < nVar; iVar++)
+        v(iPoint, offset+iVar) = u(iPoint, offset+iVar) - SU2_TYPE::GetValue(nodes->GetSolution(iPoint, iVar));
+    offset += nVar;
+  }
+
+  AD::ClearAdjoints();
+}
+
+void CDiscAdjSinglezoneDriver::KrylovIteration() {
+
+  const auto nPoint = geometry->GetnPoint();
+
+  /*--- The last iteration computed x_k+1 = G^T x_k + b from x_k (the old solution), hence
+   *    r = x_k+1 - x_k = b - (I - G^T) x_k, and the correction d of x_k solves (I - G^T) d = r. ---*/
+
+  unsigned short offset = 0;
+  for (auto iSol : adjointSolvers) {
+    auto nodes = solver[iSol]->GetNodes();
+    const auto nVar = solver[iSol]->GetnVar();
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+      for (auto iVar = 0u; iVar < nVar; iVar++) {
+        const passivedouble old = SU2_TYPE::GetValue(nodes->GetSolution_Old(iPoint, iVar));
+        adjointOld(iPoint, offset+iVar) = old;
+        krylovRHS(iPoint, offset+iVar) = SU2_TYPE::GetValue(nodes->GetSolution(iPoint, iVar)) - old;
+      }
+    }
+    offset += nVar;
+  }
+
+  krylovSol = passivedouble(0.0);
+
+  const CAdjointProduct product(*this);
+  const CIdentityPreconditioner precond;
+  passivedouble residual = 0.0;
+
+  krylovSolver.FGMRES_LinSolver(krylovRHS, krylovSol, product, precond,
+                                SU2_TYPE::GetValue(config->GetDiscAdj_Krylov_Error()),
+                                config->GetDiscAdj_Krylov_Size(), residual, false, config);
+
+  /*--- Corrected solution, the fixed-point iteration that follows starts from it. ---*/
+
+  offset = 0;
+  for (auto iSol : adjointSolvers) {
+    auto nodes = solver[iSol]->GetNodes();
+    const auto nVar = solver[iSol]->GetnVar();
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
+      for (auto iVar = 0u; iVar < nVar; iVar++)
+        nodes->SetSolution(iPoint, iVar, adjointOld(iPoint, offset+iVar) + krylovSol(iPoint, offset+iVar));
+    offset += nVar;
+  }
+}
+
+void CDiscAdjSinglezoneDriver::QuasiNewtonIteration() {
+
+  const auto nPoint = geometry->GetnPoint();
+
+  /*--- The last iteration computed G(x_k) (the solution) from x_k (the old solution). ---*/
+
+  auto& current = quasiNewton.CurrentSolution();
+  auto& fpResult = quasiNewton.FPresult();
+
+  unsigned short offset = 0;
+  for (auto iSol : adjointSolvers) {
+    const auto nodes = solver[iSol]->GetNodes();
+    const auto nVar = solver[iSol]->GetnVar();
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+      for (auto iVar = 0u; iVar < nVar; iVar++) {
+        const auto i = iPoint*adjointNVar + offset+iVar;
+        current[i] = SU2_TYPE::GetValue(nodes->GetSolution_Old(iPoint, iVar));
+        fpResult[i] = SU2_TYPE::GetValue(nodes->GetSolution(iPoint, iVar));
+      }
+    }
+    offset += nVar;
+  }
+
+  quasiNewton.compute();
+
+  /*--- The fixed-point iteration that follows starts from x_k+1. ---*/
+
+  offset = 0;
+  for (auto iSol : adjointSolvers) {
+    auto nodes = solver[iSol]->GetNodes();
+    const auto nVar = solver[iSol]->GetnVar();
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
+      for (auto iVar = 0u; iVar < nVar; iVar++)
+        nodes->SetSolution(iPoint, iVar, current[iPoint*adjointNVar + offset+iVar]);
+    offset += nVar;
+  }
+}
+
 void CDiscAdjSinglezoneDriver::Postprocess() {
 
   switch(config->GetKind_Solver())
@@ -220,6 +481,7 @@ void CDiscAdjSinglezoneDriver::Postprocess() {
 void CDiscAdjSinglezoneDriver::SetRecording(unsigned short kind_recording){
 
   AD::Reset();
+  CNumerics::ResetTapeReport();
 
   /*--- Prepare for recording by resetting the solution to the initial converged solution---*/
 
@@ -231,19 +493,43 @@ void CDiscAdjSinglezoneDriver::SetRecording(unsigned short kind_recording){
 
     AD::StartRecording();
 
-    if (rank == MASTER_NODE && kind_recording == MainVariables) {
+    if (rank == MASTER_NODE && (kind_recording == MainVariables || kind_recording == COMBINED)) {
       cout << endl << "-------------------------------------------------------------------------" << endl;
       cout << "Direct iteration to store the primal computational graph." << endl;
       cout << "Compute residuals to check the convergence of the direct problem." << endl;
     }
-    iteration->RegisterInput(solver_container, geometry_container, config_container, ZONE_0, INST_0, kind_recording);
+    /*--- A combined recording registers the main variables first, such that their adjoints are extracted
+     *    as usual, followed by the secondary ones. ---*/
+
+    if (kind_recording == COMBINED) {
+      iteration->RegisterInput(solver_container, geometry_container, config_container, ZONE_0, INST_0, MainVariables);
+      iteration->RegisterInput(solver_container, geometry_container, config_container, ZONE_0, INST_0, SecondaryVariables);
+    }
+    else {
+      iteration->RegisterInput(solver_container, geometry_container, config_container, ZONE_0, INST_0, kind_recording);
+    }
 
   }
 
+  /*--- The geometry of a combined recording comes first, such that the adjoint iterations can skip it. ---*/
+
+  if (kind_recording == COMBINED) {
+    AD::StartSection("Geometry");
+    if (SecondaryVariables == MESH_DEFORM)
+      direct_iteration->SetMesh_Deformation(geometry_container[ZONE_0][INST_0], solver, numerics, config, MESH_DEFORM);
+    else
+      geometry->UpdateGeometry(geometry_container[ZONE_0][INST_0], config);
+    AD::EndSection();
+
+    AD::Push_TapePosition(); /// GEOMETRY
+  }
+
   /*--- Set the dependencies of the iteration ---*/
 
+  AD::StartSection("Dependencies");
   iteration->SetDependencies(solver_container, geometry_container, numerics_container, config_container, ZONE_0,
-                             INST_0, kind_recording);
+                             INST_0, (kind_recording == COMBINED)? MainVariables : kind_recording);
+  AD::EndSection();
 
   /*--- Do one iteration of the direct solver ---*/
 
@@ -261,7 +547,16 @@ void CDiscAdjSinglezoneDriver::SetRecording(unsigned short kind_recording){
 
   /*--- Extract the objective function and store it --- */
 
+  AD::StartSection("Objective function");
   SetObjFunction();
+  AD::EndSection();
+
+  if (kind_recording == COMBINED) AD::Push_TapePosition(); /// ITERATION
+
+  if (rank == MASTER_NODE && kind_recording != NONE && config->GetWrt_AD_Statistics()) {
+    AD::PrintStatistics();
+    CNumerics::PrintTapeReport();
+  }
 
   AD::StopRecording();
 
@@ -285,10 +580,14 @@ void CDiscAdjSinglezoneDriver::SetAdj_ObjFunction(){
     }
   }
 
+  /*--- With separate objectives the active one is seeded on its direction. ---*/
+
+  su2double& objective = ObjFunc_Separate.empty()? ObjFunc : ObjFunc_Separate[activeObj];
+
   if (rank == MASTER_NODE){
-    SU2_TYPE::SetDerivative(ObjFunc, SU2_TYPE::GetValue(seeding));
+    SU2_TYPE::SetDerivative(objective, SU2_TYPE::GetValue(seeding));
   } else {
-    SU2_TYPE::SetDerivative(ObjFunc, 0.0);
+    SU2_TYPE::SetDerivative(objective, 0.0);
   }
 }
 
@@ -327,6 +626,21 @@ void CDiscAdjSinglezoneDriver::SetObjFunction(){
 
     /*--- Surface based obj. function ---*/
 
+    /*--- Separate objectives, each is the combination with the weights of the others set to zero. ---*/
+
+    if (!ObjFunc_Separate.empty()) {
+      vector<su2double> weights(config->GetnObj());
+      for (auto iObj = 0u; iObj < weights.size(); iObj++) weights[iObj] = config->GetWeight_ObjFunc(iObj);
+
+      for (auto iObj = 0u; iObj < weights.size(); iObj++) {
+        for (auto jObj = 0u; jObj < weights.size(); jObj++)
+          config->SetWeight_ObjFunc(jObj, (jObj == iObj)? weights[jObj] : su2double(0.0));
+        solver[FLOW_SOL]->Evaluate_ObjFunc(config);
+        ObjFunc_Separate[iObj] = solver[FLOW_SOL]->GetTotal_ComboObj();
+      }
+      for (auto iObj = 0u; iObj < weights.size(); iObj++) config->SetWeight_ObjFunc(iObj, weights[iObj]);
+    }
+
     solver[FLOW_SOL]->Evaluate_ObjFunc(config);
     ObjFunc += solver[FLOW_SOL]->GetTotal_ComboObj();
     if (heat){
@@ -391,6 +705,7 @@ void CDiscAdjSinglezoneDriver::SetObjFunction(){
 
   if (rank == MASTER_NODE){
     AD::RegisterOutput(ObjFunc);
+    for (auto& objective : ObjFunc_Separate) AD::RegisterOutput(objective);
   }
 
 }
@@ -399,7 +714,13 @@ void CDiscAdjSinglezoneDriver::DirectRun(unsigned short kind_recording){
 
   /*--- Mesh movement ---*/
 
-  direct_iteration->SetMesh_Deformation(geometry_container[ZONE_0][INST_0], solver, numerics, config, kind_recording);
+  /*--- In a combined recording the deformation was recorded before the dependencies. ---*/
+
+  if (kind_recording != COMBINED) {
+    AD::StartSection("Mesh deformation");
+    direct_iteration->SetMesh_Deformation(geometry_container[ZONE_0][INST_0], solver, numerics, config, kind_recording);
+    AD::EndSection();
+  }
 
   /*--- Zone preprocessing ---*/
 
@@ -423,7 +744,7 @@ void CDiscAdjSinglezoneDriver::Print_DirectResidual(unsigned short kind_recordin
 
   /*--- Print the residuals of the direct iteration that we just recorded ---*/
   /*--- This routine should be moved to the output, once the new structure is in place ---*/
-  if ((rank == MASTER_NODE) && (kind_recording == MainVariables)){
+  if ((rank == MASTER_NODE) && ((kind_recording == MainVariables) || (kind_recording == COMBINED))){
 
     switch (config->GetKind_Solver()) {
 
@@ -495,26 +816,41 @@ void CDiscAdjSinglezoneDriver::MainRecording(){
 
   SetRecording(NONE);
 
-  /*--- Store the computational graph of one direct iteration with the conservative variables as input. ---*/
+  /*--- Store the computational graph of one direct iteration with the conservative variables as input
+   *    (and the secondary variables for a combined recording). ---*/
 
-  SetRecording(MainVariables);
+  SetRecording(config->GetDiscAdj_Combined_Recording()? COMBINED : MainVariables);
 
 }
 
 void CDiscAdjSinglezoneDriver::SecondaryRecording(){
 
-  /*--- SetRecording stores the computational graph on one iteration of the direct problem. Calling it with NONE
-   *    as argument ensures that all information from a previous recording is removed. ---*/
+  /*--- A combined recording already has the secondary variables as input, it is evaluated in full. ---*/
 
-  SetRecording(NONE);
+  const bool combined = (RecordingState == COMBINED);
+
+  if (!combined) {
+
+    /*--- SetRecording stores the computational graph on one iteration of the direct problem. Calling it with NONE
+     *    as argument ensures that all information from a previous recording is removed. ---*/
 
-  /*--- Store the computational graph of one direct iteration with the secondary variables as input. ---*/
+    SetRecording(NONE);
 
-  SetRecording(SecondaryVariables);
+    /*--- Store the computational graph of one direct iteration with the secondary variables as input. ---*/
+
+    SetRecording(SecondaryVariables);
+  }
 
   /*--- Initialize the adjoint of the output variables of the iteration with the adjoint solution
    *    of the current iteration. The values are passed to the AD tool. ---*/
 
+  for (auto iObj = ObjFunc_Separate.size(); iObj-- > 1;) {
+    SetActiveObjective(iObj);
+    iteration->InitializeAdjoint(solver_container, geometry_container, config_container, ZONE_0, INST_0);
+    SetAdj_ObjFunction();
+  }
+  if (!ObjFunc_Separate.empty()) SetActiveObjective(0);
+
   iteration->InitializeAdjoint(solver_container, geometry_container, config_container, ZONE_0, INST_0);
 
   /*--- Initialize the adjoint of the objective function with 1.0. ---*/
@@ -539,6 +875,31 @@ void CDiscAdjSinglezoneDriver::SecondaryRecording(){
     IDX_SOL = -1;
   }
 
+  /*--- With separate objectives the files of objectives > 0 are written here, with their sensitivities
+   *    (all volume output files are written, those of objective 0 are written last by the output). ---*/
+
+  /*--- The adjoints are extracted in the order of registration, with a combined recording those of the
+   *    main variables come first (their extraction is one more adjoint iteration). ---*/
+
+  for (auto iObj = ObjFunc_Separate.size(); iObj-- > 1;) {
+    SetActiveObjective(iObj);
+    if (combined)
+      iteration->Iterate(output_container[ZONE_0], integration_container, geometry_container, solver_container,
+                         numerics_container, config_container, surface_movement, grid_movement, FFDBox, ZONE_0, INST_0);
+    if(IDX_SOL >= 0)
+      solver[IDX_SOL]->SetSensitivity(geometry, solver, config);
+
+    auto output = output_container[ZONE_0];
+    output->SetRestart_Filename(config->GetObjFunc_Extension(config->GetRestart_AdjFileName(), iObj));
+    output->SetResult_Files(geometry, config, solver, config->GetTimeIter(), true);
+    output->SetRestart_Filename(config->GetObjFunc_Extension(config->GetRestart_AdjFileName(), 0));
+  }
+  if (!ObjFunc_Separate.empty()) SetActiveObjective(0);
+
+  if (combined)
+    iteration->Iterate(output_container[ZONE_0], integration_container, geometry_container, solver_container,
+                       numerics_container, config_container, surface_movement, grid_movement, FFDBox, ZONE_0, INST_0);
+
   if(IDX_SOL >= 0)
     solver[IDX_SOL]->SetSensitivity(geometry, solver, config);
 
@@ -34,6 +34,7 @@
 
 #include "../../include/solvers/CSolverFactory.hpp"
 #include "../../include/solvers/CFEM_DG_EulerSolver.hpp"
+#include "../../include/CSolutionInterpolator.hpp"
 
 #include "../../include/output/COutputFactory.hpp"
 #include "../../include/output/COutputLegacy.hpp"
@@ -75,6 +76,9 @@
 #include "../../include/integration/CIntegrationFactory.hpp"
 
 #include "../../../Common/include/omp_structure.hpp"
+#include "../../../Common/include/toolboxes/CRegionProfiler.hpp"
+#include "../../../Common/include/toolboxes/CCommProfiler.hpp"
+#include "../../../Common/include/toolboxes/allocation_toolbox.hpp"
 
 #include <cassert>
 
@@ -114,10 +118,23 @@ CDriver::CDriver(char* confFile,
 
   SetContainers_Null();
 
+  PreprocTiming.Start("Preprocessing");
+
   /*--- Preprocessing of the config files. In this routine, the config file is read
    and it is determined whether a problem is single physics or multiphysics. . ---*/
 
+  PreprocTiming.Start("Input preprocessing");
   Input_Preprocessing(config_container, driver_config);
+  PreprocTiming.Stop();
+
+  if (config_container[ZONE_0]->GetRegion_Profiling())
+    CRegionProfiler::Enable(config_container[ZONE_0]->GetRegion_Profiling_Counters(),
+                            config_container[ZONE_0]->GetRegion_Profiling_FLOP_Event());
+
+  /*--- Where the threads run determines where the memory they initialize is placed. ---*/
+
+  if ((omp_get_max_threads() > 1) || config_container[ZONE_0]->GetMemory_Report())
+    MemoryAllocation::print_thread_placement();
 
   /*--- Retrieve dimension from mesh file ---*/
 
@@ -126,7 +143,9 @@ CDriver::CDriver(char* confFile,
 
   /*--- Output preprocessing ---*/
 
+  PreprocTiming.Start("Output preprocessing");
   Output_Preprocessing(config_container, driver_config, output_container, driver_output);
+  PreprocTiming.Stop();
 
 
   for (iZone = 0; iZone < nZone; iZone++) {
@@ -156,6 +175,14 @@ CDriver::CDriver(char* confFile,
 
       config_container[iZone]->SetiInst(iInst);
 
+      /*--- The members of the UQ ensemble have their own perturbation (set in their numerics),
+       *    the grid is the same for all of them, the geometry of the first instance is shared. ---*/
+
+      const bool sharedGeometry = config_container[iZone]->GetUQ_Ensemble() && (iInst > 0);
+
+      if (config_container[iZone]->GetUQ_Ensemble())
+        config_container[iZone]->SetUQ_EnsembleMember(iInst);
+
       geometry_container[iZone][iInst]    = NULL;
       iteration_container[iZone][iInst]   = NULL;
       solver_container[iZone][iInst]      = NULL;
@@ -167,7 +194,18 @@ CDriver::CDriver(char* confFile,
        identified and linked, face areas and volumes of the dual mesh cells are
        computed, and the multigrid levels are created using an agglomeration procedure. ---*/
 
-      Geometrical_Preprocessing(config_container[iZone], geometry_container[iZone][iInst], dry_run);
+      if (sharedGeometry) {
+        geometry_container[iZone][iInst] = geometry_container[iZone][INST_0];
+      }
+      else {
+        PreprocTiming.Start("Geometry (zone " + to_string(iZone) + ")");
+        {
+          /*--- Most of the geometry is allocated with new, its resident memory is attributed. ---*/
+          MemoryAllocation::CMemoryCategoryScope memoryScope(MemoryAllocation::MEMORY_GEOMETRY, true);
+          Geometrical_Preprocessing(config_container[iZone], geometry_container[iZone][iInst], dry_run);
+        }
+        PreprocTiming.Stop();
+      }
 
       /*--- Definition of the solver class: solver_container[#ZONES][#INSTANCES][#MG_GRIDS][#EQ_SYSTEMS].
        The solver classes are specific to a particular set of governing equations,
@@ -176,7 +214,12 @@ CDriver::CDriver(char* confFile,
        fluxes, loops over the nodes to compute source terms, and routines for
        imposing various boundary condition type for the PDE. ---*/
 
-      Solver_Preprocessing(config_container[iZone], geometry_container[iZone][iInst], solver_container[iZone][iInst]);
+      PreprocTiming.Start("Solvers (zone " + to_string(iZone) + ")");
+      {
+        MemoryAllocation::CMemoryCategoryScope memoryScope(MemoryAllocation::MEMORY_VARIABLES);
+        Solver_Preprocessing(config_container[iZone], geometry_container[iZone][iInst], solver_container[iZone][iInst]);
+      }
+      PreprocTiming.Stop();
 
       /*--- Definition of the numerical method class:
        numerics_container[#ZONES][#INSTANCES][#MG_GRIDS][#EQ_SYSTEMS][#EQ_TERMS].
@@ -185,6 +228,7 @@ CDriver::CDriver(char* confFile,
        data structure (centered, upwind, galerkin), as well as any source terms
        (piecewise constant reconstruction) evaluated in each dual mesh volume. ---*/
 
+      PreprocTiming.Start("Numerics, integration and iteration (zone " + to_string(iZone) + ")");
       Numerics_Preprocessing(config_container[iZone], geometry_container[iZone][iInst],
                              solver_container[iZone][iInst], numerics_container[iZone][iInst]);
 
@@ -203,14 +247,19 @@ CDriver::CDriver(char* confFile,
        systems tightly within a single zone by creating a new iteration class (e.g., RANS). ---*/
 
       Iteration_Preprocessing(config_container[iZone], iteration_container[iZone][iInst]);
+      PreprocTiming.Stop();
 
-      /*--- Dynamic mesh processing.  ---*/
+      /*--- Dynamic mesh processing (the ensemble is on a fixed grid, processed once). ---*/
 
+      if (sharedGeometry) continue;
+
+      PreprocTiming.Start("Grid movement (zone " + to_string(iZone) + ")");
       DynamicMesh_Preprocessing(config_container[iZone], geometry_container[iZone][iInst], solver_container[iZone][iInst],
                                  iteration_container[iZone][iInst], grid_movement[iZone][iInst], surface_movement[iZone]);
       /*--- Static mesh processing.  ---*/
 
       StaticMesh_Preprocessing(config_container[iZone], geometry_container[iZone][iInst], surface_movement[iZone]);
+      PreprocTiming.Stop();
 
     }
 
@@ -226,8 +275,10 @@ CDriver::CDriver(char* confFile,
     if (rank == MASTER_NODE)
       cout << endl <<"------------------- Multizone Interface Preprocessing -------------------" << endl;
 
+    PreprocTiming.Start("Interfaces");
     Interface_Preprocessing(config_container, solver_container, geometry_container,
                             interface_types, interface_container, interpolator_container);
+    PreprocTiming.Stop();
   }
 
   if(fsi && (config_container[ZONE_0]->GetRestart() || config_container[ZONE_0]->GetDiscrete_Adjoint())){
@@ -249,6 +300,14 @@ CDriver::CDriver(char* confFile,
 
   PythonInterface_Preprocessing(config_container, geometry_container, solver_container);
 
+  /*--- Report where the preprocessing time and memory went. ---*/
+
+  PreprocTiming.Stop();
+  if (config_container[ZONE_0]->GetPreprocessing_Timing_Report())
+    PreprocTiming.Print("Preprocessing timing report");
+  if (config_container[ZONE_0]->GetMemory_Report())
+    MemoryAllocation::print_memory_report("Memory at the end of the preprocessing");
+
   /*--- Open the FSI convergence history file ---*/
 
 //  if (fsi){
@@ -305,6 +364,10 @@ CDriver::CDriver(char* confFile,
   StartTime = MPI_Wtime();
 #endif
 
+  /*--- The communication is profiled from the end of the preprocessing. ---*/
+
+  if (config_container[ZONE_0]->GetComm_Profiling()) CCommProfiler::Enable();
+
 }
 
 void CDriver::SetContainers_Null(){
@@ -389,6 +452,16 @@ void CDriver::Postprocessing() {
       cout << "Warning: " << config_container[ZONE_0]->GetNonphysical_Reconstr() << " reconstructed states for upwinding are non-physical." << endl;
   }
 
+  /*--- Communication and load imbalance of the ranks (collective). ---*/
+
+  if (config_container[ZONE_0]->GetMemory_Report())
+    MemoryAllocation::print_memory_report("Memory at the end of the run");
+
+  if (config_container[ZONE_0]->GetComm_Profiling()) {
+    CGeometry* geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+    CCommProfiler::Report(geometry->GetnPointDomain(), geometry->nP2PSend);
+  }
+
   if (rank == MASTER_NODE)
     cout << endl <<"------------------------- Solver Postprocessing -------------------------" << endl;
 
@@ -471,6 +544,8 @@ void CDriver::Postprocessing() {
   for (iZone = 0; iZone < nZone; iZone++) {
     if (geometry_container[iZone] != NULL) {
       for (iInst = 0; iInst < nInst[iZone]; iInst++){
+        /*--- Geometry shared with the first instance (UQ ensemble). ---*/
+        if ((iInst > 0) && (geometry_container[iZone][iInst] == geometry_container[iZone][INST_0])) continue;
         for (unsigned short iMGlevel = 0; iMGlevel < config_container[iZone]->GetnMGLevels()+1; iMGlevel++) {
           if (geometry_container[iZone][iInst][iMGlevel] != NULL) delete geometry_container[iZone][iInst][iMGlevel];
         }
@@ -509,6 +584,7 @@ void CDriver::Postprocessing() {
 
   config_container[ZONE_0]->SetProfilingCSV();
   config_container[ZONE_0]->GEMMProfilingCSV();
+  CRegionProfiler::Write(config_container[ZONE_0]->GetRegion_Profiling_FileName(), rank);
 
   /*--- Deallocate config container ---*/
   if (config_container!= NULL) {
@@ -555,6 +631,17 @@ void CDriver::Postprocessing() {
   UsedTime = StopTime-StartTime;
   UsedTimeCompute += UsedTime;
 
+  /*--- Memory high-water mark of the ranks. ---*/
+
+  passivedouble PeakMemoryLocal = CTimingReport::GetPeakMemory();
+  passivedouble PeakMemory[2] = {PeakMemoryLocal, PeakMemoryLocal};
+#ifdef HAVE_MPI
+  if (wrt_perf) {
+    SelectMPIWrapper<passivedouble>::W::Reduce(&PeakMemoryLocal, &PeakMemory[0], 1, MPI_DOUBLE, MPI_MAX, MASTER_NODE, MPI_COMM_WORLD);
+    SelectMPIWrapper<passivedouble>::W::Reduce(&PeakMemoryLocal, &PeakMemory[1], 1, MPI_DOUBLE, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
+  }
+#endif
+
   if ((rank == MASTER_NODE) && (wrt_perf)) {
     su2double TotalTime = UsedTimePreproc + UsedTimeCompute + UsedTimeOutput;
     cout.precision(6);
@@ -567,6 +654,8 @@ void CDriver::Postprocessing() {
     cout << setw(25) << "Points/core:" << setw(12) << 1.0e6*MpointsDomain/(su2double)size << " | ";
     cout << setw(20) << "Ghost points/core:" << setw(12) << 1.0e6*(Mpoints-MpointsDomain)/(su2double)size << endl;
     cout << setw(25) << "Ghost/Owned Point Ratio:" << setw(12) << (Mpoints-MpointsDomain)/MpointsDomain << " | " << endl;
+    cout << setw(25) << "Peak memory/core (MB):" << setw(12) << PeakMemory[0] << " | ";
+    cout << setw(20) << "Peak memory (MB):" << setw(12) << PeakMemory[1] << endl;
     cout << endl;
     cout << "Preprocessing phase:" << endl;
     cout << setw(25) << "Preproc. Time (s):"  << setw(12)<< UsedTimePreproc << " | ";
@@ -708,7 +797,22 @@ void CDriver::Geometrical_Preprocessing(CConfig* config, CGeometry **&geometry,
     if (rank == MASTER_NODE)
       cout << "Computing wall distances." << endl;
 
+    PreprocTiming.Start("Wall distance");
     geometry[MESH_0]->ComputeWall_Distance(config);
+
+    /*--- The p-multigrid levels of the DG solver consist of the same elements,
+          hence the wall distances are computed directly. The turbulence models
+          on the coarse levels of the finite volume solver use the restricted distances. ---*/
+
+    if (fem_solver) {
+      for (iMesh = 1; iMesh <= config->GetnMGLevels(); iMesh++)
+        geometry[iMesh]->ComputeWall_Distance(config);
+    }
+    else if (config->GetMG_Turbulence()) {
+      for (iMesh = 1; iMesh <= config->GetnMGLevels(); iMesh++)
+        geometry[iMesh]->SetRestricted_WallDistance(geometry[iMesh-1]);
+    }
+    PreprocTiming.Stop();
   }
 
   /*--- Computation of positive surface area in the z-plane which is used for
@@ -777,36 +881,63 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
   unsigned long iPoint;
   bool fea = false;
 
-  /*--- Definition of the geometry class to store the primal grid in the
-     partitioning process. ---*/
+  /*--- Allocate the memory of the current domain. ---*/
 
-  CGeometry *geometry_aux = NULL;
+  geometry = NULL;
+  geometry = new CGeometry *[config->GetnMGLevels()+1];
 
-  /*--- All ranks process the grid and call ParMETIS for partitioning ---*/
+  /*--- Use the partition of a previous run when possible. ---*/
 
-  geometry_aux = new CPhysicalGeometry(config, iZone, nZone);
+  const string cacheFilename = CPhysicalGeometry::GetPartitionCacheName(config);
 
-  /*--- Set the dimension --- */
+  if (config->GetPartition_Cache() && CPhysicalGeometry::CheckPartitionCache(config, cacheFilename)) {
 
-  nDim = geometry_aux->GetnDim();
+    if (rank == MASTER_NODE) cout << "Reading the partitioned grid from the partition cache files." << endl;
 
-  /*--- Color the initial grid and set the send-receive domains (ParMETIS) ---*/
+    PreprocTiming.Start("Partition cache reading");
+    geometry[MESH_0] = new CPhysicalGeometry(config, cacheFilename);
+    PreprocTiming.Stop();
 
-  geometry_aux->SetColorGrid_Parallel(config);
+    /*--- Set the dimension --- */
 
-  /*--- Allocate the memory of the current domain, and divide the grid
-     between the ranks. ---*/
+    nDim = geometry[MESH_0]->GetnDim();
+  }
+  else {
 
-  geometry = NULL;
-  geometry = new CGeometry *[config->GetnMGLevels()+1];
+    /*--- Definition of the geometry class to store the primal grid in the
+       partitioning process. ---*/
 
-  /*--- Build the grid data structures using the ParMETIS coloring. ---*/
+    CGeometry *geometry_aux = NULL;
 
-  geometry[MESH_0] = new CPhysicalGeometry(geometry_aux, config);
+    /*--- All ranks process the grid and call ParMETIS for partitioning ---*/
 
-  /*--- Deallocate the memory of geometry_aux and solver_aux ---*/
+    PreprocTiming.Start("Mesh reading");
+    geometry_aux = new CPhysicalGeometry(config, iZone, nZone);
+    PreprocTiming.Stop();
 
-  delete geometry_aux;
+    /*--- Set the dimension --- */
+
+    nDim = geometry_aux->GetnDim();
+
+    /*--- Color the initial grid and set the send-receive domains (ParMETIS) ---*/
+
+    PreprocTiming.Start("Partitioning");
+    geometry_aux->SetColorGrid_Parallel(config);
+    PreprocTiming.Stop();
+
+    /*--- Build the grid data structures using the ParMETIS coloring,
+       dividing the grid between the ranks. ---*/
+
+    PreprocTiming.Start("Redistribution");
+    geometry[MESH_0] = new CPhysicalGeometry(geometry_aux, config);
+    PreprocTiming.Stop();
+
+    /*--- Deallocate the memory of geometry_aux and solver_aux ---*/
+
+    delete geometry_aux;
+  }
+
+  PreprocTiming.Start("Connectivity and renumbering");
 
   /*--- Add the Send/Receive boundaries ---*/
   geometry[MESH_0]->SetSendReceive(config);
@@ -822,10 +953,16 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
   if (rank == MASTER_NODE) cout << "Setting point connectivity." << endl;
   geometry[MESH_0]->SetPoint_Connectivity();
 
-  /*--- Renumbering points using Reverse Cuthill McKee ordering ---*/
+  /*--- Renumbering points using Reverse Cuthill McKee or space-filling curve ordering ---*/
 
-  if (rank == MASTER_NODE) cout << "Renumbering points (Reverse Cuthill McKee Ordering)." << endl;
-  geometry[MESH_0]->SetRCM_Ordering(config);
+  if (config->GetKind_Point_Ordering() == RCM_ORDERING) {
+    if (rank == MASTER_NODE) cout << "Renumbering points (Reverse Cuthill McKee Ordering)." << endl;
+    geometry[MESH_0]->SetRCM_Ordering(config);
+  }
+  else {
+    if (rank == MASTER_NODE) cout << "Renumbering points (Space-Filling Curve Ordering)." << endl;
+    geometry[MESH_0]->SetSFC_Ordering(config);
+  }
 
   /*--- recompute elements surrounding points, points surrounding points ---*/
 
@@ -846,14 +983,19 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
     geometry[MESH_0]->Check_BoundElem_Orientation(config);
   }
 
+  PreprocTiming.Stop();
+
   /*--- Create the edge structure ---*/
 
+  PreprocTiming.Start("Edges and vertices");
   if (rank == MASTER_NODE) cout << "Identifying edges and vertices." << endl;
   geometry[MESH_0]->SetEdges();
   geometry[MESH_0]->SetVertex(config);
+  PreprocTiming.Stop();
 
   /*--- Compute cell center of gravity ---*/
 
+  PreprocTiming.Start("Control volumes");
   if ((rank == MASTER_NODE) && (!fea)) cout << "Computing centers of gravity." << endl;
   geometry[MESH_0]->SetCoord_CG();
 
@@ -862,6 +1004,7 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
   if ((rank == MASTER_NODE) && (!fea)) cout << "Setting the control volume structure." << endl;
   geometry[MESH_0]->SetControlVolume(config, ALLOCATE);
   geometry[MESH_0]->SetBoundControlVolume(config, ALLOCATE);
+  PreprocTiming.Stop();
 
   /*--- Visualize a dual control volume if requested ---*/
 
@@ -871,6 +1014,7 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
 
   /*--- Identify closest normal neighbor ---*/
 
+  PreprocTiming.Start("Surface data and mesh quality");
   if (rank == MASTER_NODE) cout << "Searching for the closest normal neighbors to the surfaces." << endl;
   geometry[MESH_0]->FindNormal_Neighbor(config);
 
@@ -891,12 +1035,14 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
 
   /*--- Compute mesh quality statistics on the fine grid. ---*/
 
-  if (!fea) {
+  if (!fea && config->GetMeshQuality_Statistics()) {
     if (rank == MASTER_NODE)
       cout << "Computing mesh quality statistics for the dual control volumes." << endl;
     geometry[MESH_0]->ComputeMeshQualityStatistics(config);
   }
+  PreprocTiming.Stop();
 
+  PreprocTiming.Start("Multigrid");
   geometry[MESH_0]->SetMGLevel(MESH_0);
   if ((config->GetnMGLevels() != 0) && (rank == MASTER_NODE))
     cout << "Setting the multigrid structure." << endl;
@@ -943,6 +1089,7 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
     }
 
   }
+  PreprocTiming.Stop();
 
   /*--- For unsteady simulations, initialize the grid volumes
    and coordinates for previous solutions. Loop over all zones/grids ---*/
@@ -967,6 +1114,7 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
 
   /*--- Create the data structure for MPI point-to-point communications. ---*/
 
+  PreprocTiming.Start("Communication patterns");
   for (iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++)
     geometry[iMGlevel]->PreprocessP2PComms(geometry[iMGlevel], config);
 
@@ -987,6 +1135,7 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
     geometry[iMGlevel]->InitiateComms(geometry[iMGlevel], config, NEIGHBORS);
     geometry[iMGlevel]->CompleteComms(geometry[iMGlevel], config, NEIGHBORS);
   }
+  PreprocTiming.Stop();
 
 }
 
@@ -1023,67 +1172,80 @@ void CDriver::Geometrical_Preprocessing_DGFEM(CConfig* config, CGeometry **&geom
 
   geometry[MESH_0] = new CMeshFEM_DG(geometry_aux, config);
 
+  /*--- Create the coarser levels of the p-multigrid algorithm. The elements are
+        identical on every level, but the polynomial degree of the solution is
+        decreased by one per level. ---*/
+  for(unsigned short iMGlevel=1; iMGlevel<=config->GetnMGLevels(); iMGlevel++) {
+
+    if( !geometry_aux->DecreasePolySolFEM() )
+      SU2_MPI::Error(string("Too many p-multigrid levels specified. The solution is ") +
+                     string("piecewise constant on level ") + to_string(iMGlevel-1) +
+                     string(", reduce MGLEVEL."), CURRENT_FUNCTION);
+
+    if (rank == MASTER_NODE) cout << "Creating p-multigrid level " << iMGlevel << "." << endl;
+    geometry[iMGlevel] = new CMeshFEM_DG(geometry_aux, config);
+  }
+
   /*--- Deallocate the memory of geometry_aux and solver_aux ---*/
 
   delete geometry_aux;
   if (solver_aux != NULL) delete solver_aux;
 
-  /*--- Add the Send/Receive boundaries ---*/
-  geometry[MESH_0]->SetSendReceive(config);
+  /*--- Loop over the (p-multigrid) levels to carry out the preprocessing. ---*/
 
-  /*--- Add the Send/Receive boundaries ---*/
-  geometry[MESH_0]->SetBoundaries(config);
+  for(unsigned short iMGlevel=0; iMGlevel<=config->GetnMGLevels(); iMGlevel++) {
 
-  /*--- Carry out a dynamic cast to CMeshFEM_DG, such that it is not needed to
-       define all virtual functions in the base class CGeometry. ---*/
-  CMeshFEM_DG *DGMesh = dynamic_cast<CMeshFEM_DG *>(geometry[MESH_0]);
+    if ((config->GetnMGLevels() > 0) && (rank == MASTER_NODE))
+      cout << "Preprocessing of p-multigrid level " << iMGlevel << "." << endl;
 
-  /*--- Determine the standard elements for the volume elements. ---*/
-  if (rank == MASTER_NODE) cout << "Creating standard volume elements." << endl;
-  DGMesh->CreateStandardVolumeElements(config);
+    /*--- Add the Send/Receive boundaries ---*/
+    geometry[iMGlevel]->SetSendReceive(config);
 
-  /*--- Create the face information needed to compute the contour integral
-       for the elements in the Discontinuous Galerkin formulation. ---*/
-  if (rank == MASTER_NODE) cout << "Creating face information." << endl;
-  DGMesh->CreateFaces(config);
+    /*--- Add the Send/Receive boundaries ---*/
+    geometry[iMGlevel]->SetBoundaries(config);
 
-  /*--- Compute the metric terms of the volume elements. ---*/
-  if (rank == MASTER_NODE) cout << "Computing metric terms volume elements." << endl;
-  DGMesh->MetricTermsVolumeElements(config);
+    /*--- Carry out a dynamic cast to CMeshFEM_DG, such that it is not needed to
+         define all virtual functions in the base class CGeometry. ---*/
+    CMeshFEM_DG *DGMesh = dynamic_cast<CMeshFEM_DG *>(geometry[iMGlevel]);
 
-  /*--- Compute the metric terms of the surface elements. ---*/
-  if (rank == MASTER_NODE) cout << "Computing metric terms surface elements." << endl;
-  DGMesh->MetricTermsSurfaceElements(config);
+    /*--- Determine the standard elements for the volume elements. ---*/
+    if (rank == MASTER_NODE) cout << "Creating standard volume elements." << endl;
+    DGMesh->CreateStandardVolumeElements(config);
 
-  /*--- Compute a length scale of the volume elements. ---*/
-  if (rank == MASTER_NODE) cout << "Computing length scale volume elements." << endl;
-  DGMesh->LengthScaleVolumeElements();
+    /*--- Create the face information needed to compute the contour integral
+         for the elements in the Discontinuous Galerkin formulation. ---*/
+    if (rank == MASTER_NODE) cout << "Creating face information." << endl;
+    DGMesh->CreateFaces(config);
 
-  /*--- Compute the coordinates of the integration points. ---*/
-  if (rank == MASTER_NODE) cout << "Computing coordinates of the integration points." << endl;
-  DGMesh->CoordinatesIntegrationPoints();
+    /*--- Compute the metric terms of the volume elements. ---*/
+    if (rank == MASTER_NODE) cout << "Computing metric terms volume elements." << endl;
+    DGMesh->MetricTermsVolumeElements(config);
 
-  /*--- Compute the coordinates of the location of the solution DOFs. This is different
-            from the grid points when a different polynomial degree is used to represent the
-            geometry and solution. ---*/
-  if (rank == MASTER_NODE) cout << "Computing coordinates of the solution DOFs." << endl;
-  DGMesh->CoordinatesSolDOFs();
+    /*--- Compute the metric terms of the surface elements. ---*/
+    if (rank == MASTER_NODE) cout << "Computing metric terms surface elements." << endl;
+    DGMesh->MetricTermsSurfaceElements(config);
 
-  /*--- Perform the preprocessing tasks when wall functions are used. ---*/
-  if (rank == MASTER_NODE) cout << "Preprocessing for the wall functions. " << endl;
-  DGMesh->WallFunctionPreprocessing(config);
-
-  /*--- Store the global to local mapping. ---*/
-  if (rank == MASTER_NODE) cout << "Storing a mapping from global to local DOF index." << endl;
-  geometry[MESH_0]->SetGlobal_to_Local_Point();
+    /*--- Compute a length scale of the volume elements. ---*/
+    if (rank == MASTER_NODE) cout << "Computing length scale volume elements." << endl;
+    DGMesh->LengthScaleVolumeElements();
 
+    /*--- Compute the coordinates of the integration points. ---*/
+    if (rank == MASTER_NODE) cout << "Computing coordinates of the integration points." << endl;
+    DGMesh->CoordinatesIntegrationPoints();
 
-  /*--- Loop to create the coarser grid levels. ---*/
+    /*--- Compute the coordinates of the location of the solution DOFs. This is different
+              from the grid points when a different polynomial degree is used to represent the
+              geometry and solution. ---*/
+    if (rank == MASTER_NODE) cout << "Computing coordinates of the solution DOFs." << endl;
+    DGMesh->CoordinatesSolDOFs();
 
-  for(unsigned short iMGlevel=1; iMGlevel<=config->GetnMGLevels(); iMGlevel++) {
+    /*--- Perform the preprocessing tasks when wall functions are used. ---*/
+    if (rank == MASTER_NODE) cout << "Preprocessing for the wall functions. " << endl;
+    DGMesh->WallFunctionPreprocessing(config);
 
-    SU2_MPI::Error("Geometrical_Preprocessing_DGFEM: Coarse grid levels not implemented yet.",
-                   CURRENT_FUNCTION);
+    /*--- Store the global to local mapping. ---*/
+    if (rank == MASTER_NODE) cout << "Storing a mapping from global to local DOF index." << endl;
+    geometry[iMGlevel]->SetGlobal_to_Local_Point();
   }
 
 }
@@ -1097,9 +1259,22 @@ void CDriver::Solver_Preprocessing(CConfig* config, CGeometry** geometry, CSolve
 
   solver = new CSolver**[config->GetnMGLevels()+1];
 
+#ifdef HAVE_OMP
+  /*--- The edge coloring is computed on first use, by the solvers, it is done here to be timed separately. ---*/
+
+  if (!fem_solver && (kindSolver != FEM_ELASTICITY) && (kindSolver != DISC_ADJ_FEM)) {
+    PreprocTiming.Start("Edge coloring");
+    for (iMesh = 0; iMesh <= config->GetnMGLevels(); iMesh++)
+      geometry[iMesh]->GetEdgeColoring();
+    PreprocTiming.Stop();
+  }
+#endif
+
+  PreprocTiming.Start("Solver allocation");
   for (iMesh = 0; iMesh <= config->GetnMGLevels(); iMesh++){
     solver[iMesh] = CSolverFactory::createSolverContainer(kindSolver, config, geometry[iMesh], iMesh);
   }
+  PreprocTiming.Stop();
 
   /*--- Count the number of DOFs per solution point. ---*/
 
@@ -1114,7 +1289,9 @@ void CDriver::Solver_Preprocessing(CConfig* config, CGeometry** geometry, CSolve
   bool update_geo = true;
   if (config->GetFSI_Simulation()) update_geo = false;
 
+  PreprocTiming.Start("Restart");
   Solver_Restart(solver, geometry, config, update_geo);
+  PreprocTiming.Stop();
 
   /*--- Set up any necessary inlet profiles ---*/
 
@@ -1329,11 +1506,16 @@ void CDriver::Solver_Restart(CSolver ***solver, CGeometry **geometry,
   /*--- Load restarts for any of the active solver containers. Note that
    these restart routines fill the fine grid and interpolate to all MG levels. ---*/
 
+  const bool interpolated = !config->GetSolution_Donor_Mesh_FileName().empty();
+
   if (restart || restart_flow) {
-    if (euler || ns) {
+    if ((euler || ns) && interpolated) {
+      Solver_Interpolated_Restart(solver, geometry, config);
+    }
+    else if (euler || ns) {
       solver[MESH_0][FLOW_SOL]->LoadRestart(geometry, solver, config, val_iter, update_geo);
     }
-    if (turbulent) {
+    if (turbulent && !interpolated) {
       solver[MESH_0][TURB_SOL]->LoadRestart(geometry, solver, config, val_iter, update_geo);
     }
     if (config->AddRadiation()) {
@@ -1401,6 +1583,104 @@ void CDriver::Solver_Restart(CSolver ***solver, CGeometry **geometry,
 
 }
 
+void CDriver::Solver_Interpolated_Restart(CSolver ***solver, CGeometry **geometry, CConfig *config) {
+
+  const unsigned short iZone = config->GetiZone();
+  const unsigned short turb_model = config->GetKind_Turb_Model();
+  const bool turbulent = (turb_model != NONE);
+  const bool sst = (turb_model == SST) || (turb_model == SST_SUST);
+
+  const unsigned short nVarFlow = solver[MESH_0][FLOW_SOL]->GetnVar();
+  const unsigned short nVarTurb = turbulent? solver[MESH_0][TURB_SOL]->GetnVar() : 0;
+
+  /*--- The wall distance of the donor points is interpolated with the solution. ---*/
+  const unsigned short nVarSol = nVarFlow + nVarTurb;
+  const unsigned short nVar = nVarSol + (turbulent? 1 : 0);
+
+  const string donor_filename = config->GetSolution_Donor_Mesh_FileName();
+  const string restart_filename = config->GetFilename(config->GetSolution_FileName(), "", 0);
+
+  if (rank == MASTER_NODE)
+    cout << "Interpolating the restart file " << restart_filename << " from the grid " << donor_filename << "." << endl;
+
+  /*--- The donor grid sets the markers of its configuration, a copy of the configuration
+   *    of the zone reads it, like the grid of the problem (reading and partitioning). ---*/
+
+  char zone_file_name[MAX_STRING_SIZE];
+  if (driver_config->GetnConfigFiles() > 0)
+    strcpy(zone_file_name, driver_config->GetConfigFilename(iZone).c_str());
+  else
+    strcpy(zone_file_name, config_file_name);
+
+  CConfig* donor_config = new CConfig(driver_config, zone_file_name, SU2_CFD, iZone, nZone, false);
+  donor_config->SetMPICommunicator(SU2_MPI::GetComm());
+  donor_config->SetMesh_FileName(donor_filename);
+
+  CGeometry* geometry_aux = new CPhysicalGeometry(donor_config, iZone, nZone);
+  if (geometry_aux->GetnDim() != geometry[MESH_0]->GetnDim())
+    SU2_MPI::Error(string("The grid ") + donor_filename + string(" does not have the dimensions of the problem."), CURRENT_FUNCTION);
+  geometry_aux->SetColorGrid_Parallel(donor_config);
+
+  CGeometry* donor = new CPhysicalGeometry(geometry_aux, donor_config);
+  delete geometry_aux;
+
+  donor->SetSendReceive(donor_config);
+  donor->SetBoundaries(donor_config);
+
+  /*--- Flow and turbulence variables of the donor points, and their wall distance. ---*/
+
+  vector<passivedouble> values(donor->GetnPoint()*nVar, 0.0);
+  {
+    const auto fields = solver[MESH_0][FLOW_SOL]->ReadRestartFields(donor, donor_config, restart_filename, 0, nVarSol);
+    for (unsigned long iPoint = 0; iPoint < donor->GetnPointDomain(); iPoint++)
+      copy_n(&fields[iPoint*nVarSol], nVarSol, &values[iPoint*nVar]);
+  }
+
+  if (turbulent) {
+    donor->ComputeWall_Distance(donor_config);
+    for (unsigned long iPoint = 0; iPoint < donor->GetnPointDomain(); iPoint++)
+      values[iPoint*nVar+nVarSol] = SU2_TYPE::GetValue(donor->node[iPoint]->GetWall_Distance());
+  }
+
+  CSolutionInterpolator::CompleteHalos(donor, donor_config, nVar, values);
+
+  vector<passivedouble> solution;
+  unsigned long nNearest = 0;
+  {
+    CSolutionInterpolator interpolator(donor, nVar, move(values));
+
+    delete donor;
+    delete donor_config;
+
+    nNearest = interpolator.Interpolate(geometry[MESH_0], solution);
+  }
+
+  if ((rank == MASTER_NODE) && (nNearest > 0))
+    cout << nNearest << " points out of the elements of the donor grid take the values of the nearest donor point." << endl;
+
+  /*--- Near the walls the turbulence variables vary faster than linearly, and the walls of the grids may
+   *    differ (other geometry, curved walls, points out of the donor elements). The variables are scaled
+   *    to the wall distance d of the point from the interpolated distance d_i of the donor grid, as in the
+   *    log layer: nu_tilde ~ d (SA), k ~ const and omega ~ 1/d (SST), with the ratio d/d_i limited. ---*/
+
+  if (turbulent) {
+    constexpr passivedouble MAX_RATIO = 4.0;
+    for (unsigned long iPoint = 0; iPoint < geometry[MESH_0]->GetnPointDomain(); iPoint++) {
+      passivedouble* pointValues = &solution[iPoint*nVar];
+      const passivedouble dist = SU2_TYPE::GetValue(geometry[MESH_0]->node[iPoint]->GetWall_Distance());
+      const passivedouble donorDist = pointValues[nVarSol];
+      if ((dist <= 0.0) || (donorDist <= 0.0)) continue;
+
+      const passivedouble ratio = min(max(dist/donorDist, 1.0/MAX_RATIO), MAX_RATIO);
+      if (sst) pointValues[nVarFlow+1] /= ratio;
+      else pointValues[nVarFlow] *= ratio;
+    }
+  }
+
+  CSolutionInterpolator::SetRestartSolution(geometry, solver, config, solution, nVar);
+
+}
+
 void CDriver::Solver_Postprocessing(CSolver ****solver, CGeometry **geometry,
                                     CConfig *config, unsigned short val_iInst) {
 
@@ -2052,7 +2332,7 @@ void CDriver::Numerics_Preprocessing(CConfig *config, CGeometry **geometry, CSol
 
     /*--- Definition of the viscous scheme for each equation and mesh level ---*/
     for (iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++) {
-      numerics[iMGlevel][TRANS_SOL][visc_term] = new CAvgGradCorrected_TransLM(nDim, nVar_Trans, config);
+      numerics[iMGlevel][TRANS_SOL][visc_term] = new CAvgGrad_TransLM(nDim, nVar_Trans, true, config);
     }
 
     /*--- Definition of the source term integration scheme for each equation and mesh level ---*/
@@ -2100,13 +2380,13 @@ void CDriver::Numerics_Preprocessing(CConfig *config, CGeometry **geometry, CSol
 
   if (config->AddRadiation()) {
     /*--- Definition of the viscous scheme for each equation and mesh level ---*/
-    numerics[MESH_0][RAD_SOL][VISC_TERM] = new CAvgGradCorrected_P1(nDim, nVar_Rad, config);
+    numerics[MESH_0][RAD_SOL][visc_term] = new CAvgGradCorrected_P1(nDim, nVar_Rad, config);
 
     /*--- Definition of the source term integration scheme for each equation and mesh level ---*/
-    numerics[MESH_0][RAD_SOL][SOURCE_FIRST_TERM] = new CSourceP1(nDim, nVar_Rad, config);
+    numerics[MESH_0][RAD_SOL][source_first_term] = new CSourceP1(nDim, nVar_Rad, config);
 
     /*--- Definition of the boundary condition method ---*/
-    numerics[MESH_0][RAD_SOL][VISC_BOUND_TERM] = new CAvgGradCorrected_P1(nDim, nVar_Rad, config);
+    numerics[MESH_0][RAD_SOL][visc_bound_term] = new CAvgGradCorrected_P1(nDim, nVar_Rad, config);
   }
 
   /*--- Solver definition for the flow adjoint problem ---*/
@@ -2481,19 +2761,28 @@ void CDriver::DynamicMesh_Preprocessing(CConfig *config, CGeometry **geometry, C
     }
   }
 
+  /*--- Deformation of the grid by the design variables, which replaces SU2_DEF (DEFORM_DESIGN= YES). ---*/
+
+  if (config->GetDeform_Design()) {
+    if (Design_Coord.size() != nZone) Design_Coord.resize(nZone);
+    Design_Deformation(config, geometry, grid_movement, surface_movement, Design_Coord[iZone]);
+  }
+
   if (config->GetDirectDiff() == D_DESIGN) {
     if (rank == MASTER_NODE)
       cout << "Setting surface/volume derivatives." << endl;
 
     /*--- Set the surface derivatives, i.e. the derivative of the surface mesh nodes with respect to the design variables ---*/
 
-    surface_movement->SetSurface_Derivative(geometry[MESH_0],config);
+    const auto nDirections = surface_movement->SetSurface_Derivative(geometry[MESH_0],config);
 
-    /*--- Call the volume deformation routine with derivative mode enabled.
-       This computes the derivative of the volume mesh with respect to the surface nodes ---*/
+    /*--- Call the volume deformation routine with derivative mode enabled (once per direction of the
+       vector forward mode). This computes the derivative of the volume mesh with respect to the surface nodes ---*/
 
-
-    grid_movement->SetVolume_Deformation(geometry[MESH_0],config, true, true);
+    for (unsigned short iDir = 0; iDir < nDirections; iDir++) {
+      grid_movement->SetDerivative_Direction(iDir);
+      grid_movement->SetVolume_Deformation(geometry[MESH_0],config, true, true);
+    }
 
     /*--- Update the multi-grid structure to propagate the derivative information to the coarser levels ---*/
 
@@ -2519,6 +2808,106 @@ void CDriver::DynamicMesh_Preprocessing(CConfig *config, CGeometry **geometry, C
 
 }
 
+void CDriver::Design_Deformation(CConfig *config, CGeometry **geometry, CVolumetricMovement *&grid_movement,
+                                 CSurfaceMovement *&surface_movement, su2activematrix& coordOrig){
+
+  const unsigned short Kind_DV = config->GetDesign_Variable(0);
+
+  if (fem_solver || (config->GetnTimeInstances() > 1))
+    SU2_MPI::Error("DEFORM_DESIGN is only available for the finite volume solvers without harmonic balance.",
+                   CURRENT_FUNCTION);
+
+  if (Kind_DV == FFD_SETTING)
+    SU2_MPI::Error("DV_KIND= FFD_SETTING writes the FFD boxes to the grid file, it has to be run with SU2_DEF.",
+                   CURRENT_FUNCTION);
+
+  if (Kind_DV == NO_DEFORMATION) return;
+
+  if (rank == MASTER_NODE)
+    cout << endl << "------------------------ Design deformation (zone " << config->GetiZone() << ") -----------------------" << endl;
+
+  CGeometry *geometry_fine = geometry[MESH_0];
+  const unsigned long nPoint = geometry_fine->GetnPoint();
+  const unsigned short nDim = geometry_fine->GetnDim();
+  unsigned long iPoint, iVertex;
+  unsigned short iDim, iMarker, iMesh;
+
+  /*--- Store the undeformed grid (halos included) on the first call, and reset it on the next ones,
+   the design variables are always relative to the undeformed grid. ---*/
+
+  if (coordOrig.rows() == 0) {
+    coordOrig.resize(nPoint, nDim);
+    for (iPoint = 0; iPoint < nPoint; iPoint++)
+      for (iDim = 0; iDim < nDim; iDim++)
+        coordOrig(iPoint, iDim) = geometry_fine->node[iPoint]->GetCoord(iDim);
+  }
+  else {
+    for (iPoint = 0; iPoint < nPoint; iPoint++)
+      for (iDim = 0; iDim < nDim; iDim++)
+        geometry_fine->node[iPoint]->SetCoord(iDim, coordOrig(iPoint, iDim));
+  }
+
+  /*--- Clear the surface displacements of a previous design or grid movement. ---*/
+
+  const su2double zeroCoord[3] = {0.0, 0.0, 0.0};
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
+    for (iVertex = 0; iVertex < geometry_fine->nVertex[iMarker]; iVertex++)
+      geometry_fine->vertex[iMarker][iVertex]->SetVarCoord(zeroCoord);
+
+  /*--- The movement classes are kept for the next designs (stiffness matrix, see DEFORM_REUSE_STIFFNESS,
+   and cartesian FFD boxes). ---*/
+
+  if (grid_movement == nullptr) grid_movement = new CVolumetricMovement(geometry_fine, config);
+  if (surface_movement == nullptr) surface_movement = new CSurfaceMovement();
+
+  surface_movement->CopyBoundary(geometry_fine, config);
+
+  switch (Kind_DV) {
+    case SCALE_GRID:
+      grid_movement->SetVolume_Scaling(geometry_fine, config, true);
+      break;
+    case TRANSLATE_GRID:
+      grid_movement->SetVolume_Translation(geometry_fine, config, true);
+      break;
+    case ROTATE_GRID:
+      grid_movement->SetVolume_Rotation(geometry_fine, config, true);
+      break;
+    default:
+      if (rank == MASTER_NODE) cout << "Performing the deformation of the surface grid." << endl;
+      surface_movement->SetSurface_Deformation(geometry_fine, config);
+
+      if (rank == MASTER_NODE) cout << "Performing the deformation of the volumetric grid." << endl;
+      grid_movement->SetVolume_Deformation(geometry_fine, config, true);
+      break;
+  }
+
+  /*--- Update the dual grid of the coarse levels, the wall distances, and the reference area. ---*/
+
+  grid_movement->UpdateMultiGrid(geometry, config);
+
+  if ((config->GetKind_Solver() == RANS) ||
+      (config->GetKind_Solver() == INC_RANS) ||
+      (config->GetKind_Solver() == ADJ_RANS) ||
+      (config->GetKind_Solver() == DISC_ADJ_INC_RANS) ||
+      (config->GetKind_Solver() == DISC_ADJ_RANS)) {
+
+    if (rank == MASTER_NODE) cout << "Computing wall distances." << endl;
+    geometry_fine->ComputeWall_Distance(config);
+
+    if (config->GetMG_Turbulence()) {
+      for (iMesh = 1; iMesh <= config->GetnMGLevels(); iMesh++)
+        geometry[iMesh]->SetRestricted_WallDistance(geometry[iMesh-1]);
+    }
+  }
+
+  geometry_fine->SetPositive_ZArea(config);
+
+  /*--- The deformed surface is the reference of any further movement of the grid. ---*/
+
+  surface_movement->CopyBoundary(geometry_fine, config);
+
+}
+
 void CDriver::Interface_Preprocessing(CConfig **config, CSolver***** solver, CGeometry**** geometry,
                                       unsigned short** interface_types, CInterface ***&interface,
                                       CInterpolator ***&interpolation) {
@@ -2925,6 +3314,15 @@ void CDriver::StaticMesh_Preprocessing(CConfig *config, CGeometry** geometry, CS
         geometry[iMGlevel]->SetRestricted_GridVelocity(geometry[iMGfine], config);
       }
     }
+
+    /*--- The grid velocities of a steady rotation or translation do not change, the
+     projected grid velocity of the edges is stored once on all multigrid levels. ---*/
+
+    if (((Kind_Grid_Movement == ROTATING_FRAME) || (Kind_Grid_Movement == STEADY_TRANSLATION)) &&
+        !config->GetDeform_Mesh()) {
+      for (iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++)
+        geometry[iMGlevel]->SetEdgeGridFlux();
+    }
   } else {
 
     /*--- Carry out a dynamic cast to CMeshFEM_DG, such that it is not needed to
@@ -3260,8 +3658,11 @@ void CFluidDriver::Run() {
   if ( unsteady ) {
     for (iZone = 0; iZone < nZone; iZone++) {
       for (jZone = 0; jZone < nZone; jZone++)
-        if(jZone != iZone && interpolator_container[iZone][jZone] != NULL)
-        interpolator_container[iZone][jZone]->Set_TransferCoeff(config_container);
+        if(jZone != iZone && interpolator_container[iZone][jZone] != NULL) {
+          interpolator_container[iZone][jZone]->Set_TransferCoeff(config_container);
+          if (interface_container[iZone][jZone] != NULL)
+            interface_container[iZone][jZone]->SetTransferPatternOutdated();
+        }
     }
   }
 
@@ -3564,6 +3965,8 @@ bool CTurbomachineryDriver::Monitor(unsigned long ExtIter) {
           }
           geometry_container[iZone][INST_0][MESH_0]->SetRotationalVelocity(config_container[iZone], print);
           geometry_container[iZone][INST_0][MESH_0]->SetShroudVelocity(config_container[iZone]);
+          if (!config_container[iZone]->GetDeform_Mesh())
+            geometry_container[iZone][INST_0][MESH_0]->SetEdgeGridFlux();
         }
       }
 
@@ -3719,11 +4122,8 @@ void CHBDriver::Run() {
 
 void CHBDriver::Update() {
 
-  for (iInst = 0; iInst < nInstHB; iInst++) {
-    /*--- Compute the harmonic balance terms across all zones ---*/
-    SetHarmonicBalance(iInst);
-
-  }
+  /*--- Compute the harmonic balance terms across all instances ---*/
+  SetHarmonicBalance();
 
   /*--- Precondition the harmonic balance source terms ---*/
   if (config_container[ZONE_0]->GetHB_Precondition() == YES) {
@@ -3767,286 +4167,194 @@ void CHBDriver::ResetConvergence() {
 
 }
 
-void CHBDriver::SetHarmonicBalance(unsigned short iInst) {
+void CHBDriver::SetHarmonicBalance() {
 
-  unsigned short iVar, jInst, iMGlevel;
-  unsigned short nVar = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->GetnVar();
-  unsigned long iPoint;
+  unsigned short iMGlevel;
+  const unsigned short nVar = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->GetnVar();
   bool implicit = (config_container[ZONE_0]->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
-  bool adjoint = (config_container[ZONE_0]->GetContinuous_Adjoint());
+  const bool adjoint = (config_container[ZONE_0]->GetContinuous_Adjoint());
   if (adjoint) {
     implicit = (config_container[ZONE_0]->GetKind_TimeIntScheme_AdjFlow() == EULER_IMPLICIT);
   }
+  const unsigned short solIndex = adjoint? ADJFLOW_SOL : FLOW_SOL;
 
   unsigned long InnerIter = config_container[ZONE_0]->GetInnerIter();
 
-  /*--- Retrieve values from the config file ---*/
-  su2double *U = new su2double[nVar];
-  su2double *U_old = new su2double[nVar];
-  su2double *Psi = new su2double[nVar];
-  su2double *Psi_old = new su2double[nVar];
-  su2double *Source = new su2double[nVar];
-  su2double deltaU, deltaPsi;
-
-  /*--- Compute period of oscillation ---*/
-  su2double period = config_container[ZONE_0]->GetHarmonicBalance_Period();
-
-  /*--- Non-dimensionalize the input period, if necessary.  */
-  period /= config_container[ZONE_0]->GetTime_Ref();
-
   if (InnerIter == 0)
     ComputeHB_Operator();
 
-  /*--- Compute various source terms for explicit direct, implicit direct, and adjoint problems ---*/
+  /*--- The sources of all instances are computed in one pass over the points, the solutions of all
+   *    instances at a point are gathered once and multiplied by the operator, S_i = sum_j D_ij U_j
+   *    (D_ji for the adjoint). With an implicit scheme U_j is augmented by its last change. ---*/
+
   /*--- Loop over all grid levels ---*/
   for (iMGlevel = 0; iMGlevel <= config_container[ZONE_0]->GetnMGLevels(); iMGlevel++) {
 
-    /*--- Loop over each node in the volume mesh ---*/
-    for (iPoint = 0; iPoint < geometry_container[ZONE_0][iInst][iMGlevel]->GetnPoint(); iPoint++) {
-
-      for (iVar = 0; iVar < nVar; iVar++) {
-        Source[iVar] = 0.0;
-      }
-
-      /*--- Step across the columns ---*/
-      for (jInst = 0; jInst < nInstHB; jInst++) {
+    const unsigned long nPoint = geometry_container[ZONE_0][INST_0][iMGlevel]->GetnPoint();
 
-        /*--- Retrieve solution at this node in current zone ---*/
-        for (iVar = 0; iVar < nVar; iVar++) {
+    SU2_OMP_PARALLEL
+    {
+      vector<su2double> U(nInstHB*nVar);
 
-          if (!adjoint) {
-            U[iVar] = solver_container[ZONE_0][jInst][iMGlevel][FLOW_SOL]->GetNodes()->GetSolution(iPoint, iVar);
-            Source[iVar] += U[iVar]*D[iInst][jInst];
-
-            if (implicit) {
-              U_old[iVar] = solver_container[ZONE_0][jInst][iMGlevel][FLOW_SOL]->GetNodes()->GetSolution_Old(iPoint, iVar);
-              deltaU = U[iVar] - U_old[iVar];
-              Source[iVar] += deltaU*D[iInst][jInst];
-            }
+      SU2_OMP_FOR_STAT(computeStaticChunkSize(nPoint, omp_get_num_threads(), 512))
+      for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
 
-          }
-
-          else {
-            Psi[iVar] = solver_container[ZONE_0][jInst][iMGlevel][ADJFLOW_SOL]->GetNodes()->GetSolution(iPoint, iVar);
-            Source[iVar] += Psi[iVar]*D[jInst][iInst];
-
-            if (implicit) {
-              Psi_old[iVar] = solver_container[ZONE_0][jInst][iMGlevel][ADJFLOW_SOL]->GetNodes()->GetSolution_Old(iPoint, iVar);
-              deltaPsi = Psi[iVar] - Psi_old[iVar];
-              Source[iVar] += deltaPsi*D[jInst][iInst];
-            }
+        /*--- Retrieve the solution at this node in all instances ---*/
+        for (unsigned short jInst = 0; jInst < nInstHB; jInst++) {
+          const auto nodes = solver_container[ZONE_0][jInst][iMGlevel][solIndex]->GetNodes();
+          for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+            U[jInst*nVar+iVar] = nodes->GetSolution(iPoint, iVar);
+            if (implicit) U[jInst*nVar+iVar] += nodes->GetSolution(iPoint, iVar) - nodes->GetSolution_Old(iPoint, iVar);
           }
         }
 
-        /*--- Store sources for current row ---*/
-        for (iVar = 0; iVar < nVar; iVar++) {
-          if (!adjoint) {
-            solver_container[ZONE_0][iInst][iMGlevel][FLOW_SOL]->GetNodes()->SetHarmonicBalance_Source(iPoint, iVar, Source[iVar]);
-          }
-          else {
-            solver_container[ZONE_0][iInst][iMGlevel][ADJFLOW_SOL]->GetNodes()->SetHarmonicBalance_Source(iPoint, iVar, Source[iVar]);
+        /*--- Store the sources of each instance ---*/
+        for (unsigned short iInst = 0; iInst < nInstHB; iInst++) {
+          for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+            su2double Source = 0.0;
+            for (unsigned short jInst = 0; jInst < nInstHB; jInst++)
+              Source += U[jInst*nVar+iVar] * (adjoint? D[jInst][iInst] : D[iInst][jInst]);
+            solver_container[ZONE_0][iInst][iMGlevel][solIndex]->GetNodes()->SetHarmonicBalance_Source(iPoint, iVar, Source);
           }
         }
-
       }
-    }
+    } // end SU2_OMP_PARALLEL
   }
 
   /*--- Source term for a turbulence model ---*/
   if (config_container[ZONE_0]->GetKind_Solver() == RANS) {
 
     /*--- Extra variables needed if we have a turbulence model. ---*/
-    unsigned short nVar_Turb = solver_container[ZONE_0][INST_0][MESH_0][TURB_SOL]->GetnVar();
-    su2double *U_Turb = new su2double[nVar_Turb];
-    su2double *Source_Turb = new su2double[nVar_Turb];
+    const unsigned short nVar_Turb = solver_container[ZONE_0][INST_0][MESH_0][TURB_SOL]->GetnVar();
+    const unsigned long nPoint = geometry_container[ZONE_0][INST_0][MESH_0]->GetnPoint();
 
     /*--- Loop over only the finest mesh level (turbulence is always solved
      on the original grid only). ---*/
-    for (iPoint = 0; iPoint < geometry_container[ZONE_0][INST_0][MESH_0]->GetnPoint(); iPoint++) {
-      for (iVar = 0; iVar < nVar_Turb; iVar++) Source_Turb[iVar] = 0.0;
-      for (jInst = 0; jInst < nInstHB; jInst++) {
-
-        /*--- Retrieve solution at this node in current zone ---*/
-        for (iVar = 0; iVar < nVar_Turb; iVar++) {
-          U_Turb[iVar] = solver_container[ZONE_0][jInst][MESH_0][TURB_SOL]->GetNodes()->GetSolution(iPoint, iVar);
-          Source_Turb[iVar] += U_Turb[iVar]*D[iInst][jInst];
+    SU2_OMP_PARALLEL
+    {
+      vector<su2double> U_Turb(nInstHB*nVar_Turb);
+
+      SU2_OMP_FOR_STAT(computeStaticChunkSize(nPoint, omp_get_num_threads(), 512))
+      for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+
+        /*--- Retrieve the solution at this node in all instances ---*/
+        for (unsigned short jInst = 0; jInst < nInstHB; jInst++)
+          for (unsigned short iVar = 0; iVar < nVar_Turb; iVar++)
+            U_Turb[jInst*nVar_Turb+iVar] = solver_container[ZONE_0][jInst][MESH_0][TURB_SOL]->GetNodes()->GetSolution(iPoint, iVar);
+
+        /*--- Store sources of each instance ---*/
+        for (unsigned short iInst = 0; iInst < nInstHB; iInst++) {
+          for (unsigned short iVar = 0; iVar < nVar_Turb; iVar++) {
+            su2double Source_Turb = 0.0;
+            for (unsigned short jInst = 0; jInst < nInstHB; jInst++)
+              Source_Turb += U_Turb[jInst*nVar_Turb+iVar]*D[iInst][jInst];
+            solver_container[ZONE_0][iInst][MESH_0][TURB_SOL]->GetNodes()->SetHarmonicBalance_Source(iPoint, iVar, Source_Turb);
+          }
         }
       }
-
-      /*--- Store sources for current iZone ---*/
-      for (iVar = 0; iVar < nVar_Turb; iVar++)
-        solver_container[ZONE_0][iInst][MESH_0][TURB_SOL]->GetNodes()->SetHarmonicBalance_Source(iPoint, iVar, Source_Turb[iVar]);
-    }
-
-    delete [] U_Turb;
-    delete [] Source_Turb;
+    } // end SU2_OMP_PARALLEL
   }
 
-  delete [] Source;
-  delete [] U;
-  delete [] U_old;
-  delete [] Psi;
-  delete [] Psi_old;
-
 }
 
 void CHBDriver::StabilizeHarmonicBalance() {
 
-  unsigned short i, j, k, iVar, iInst, jInst, iMGlevel;
-  unsigned short nVar = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->GetnVar();
-  unsigned long iPoint;
-  bool adjoint = (config_container[ZONE_0]->GetContinuous_Adjoint());
-
-  /*--- Retrieve values from the config file ---*/
-  su2double *Source     = new su2double[nInstHB];
-  su2double *Source_old = new su2double[nInstHB];
-  su2double Delta;
-
-  su2double **Pinv     = new su2double*[nInstHB];
-  su2double **P        = new su2double*[nInstHB];
-  for (iInst = 0; iInst < nInstHB; iInst++) {
-    Pinv[iInst]       = new su2double[nInstHB];
-    P[iInst]          = new su2double[nInstHB];
-  }
+  unsigned short iMGlevel;
+  const unsigned short nVar = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->GetnVar();
+  const bool adjoint = (config_container[ZONE_0]->GetContinuous_Adjoint());
+  const unsigned short n = nInstHB, n2 = 2*nInstHB;
 
   /*--- Loop over all grid levels ---*/
   for (iMGlevel = 0; iMGlevel <= config_container[ZONE_0]->GetnMGLevels(); iMGlevel++) {
 
-    /*--- Loop over each node in the volume mesh ---*/
-    for (iPoint = 0; iPoint < geometry_container[ZONE_0][INST_0][iMGlevel]->GetnPoint(); iPoint++) {
+    const unsigned long nPoint = geometry_container[ZONE_0][INST_0][iMGlevel]->GetnPoint();
 
-      /*--- Get time step for current node ---*/
-      Delta = solver_container[ZONE_0][INST_0][iMGlevel][FLOW_SOL]->GetNodes()->GetDelta_Time(iPoint);
+    SU2_OMP_PARALLEL
+    {
+      /*--- Work arrays of each thread, the stabilization matrix is augmented with the identity (temp)
+       *    to be inverted in place (P). ---*/
+      vector<su2double> temp(n*n2), P(n*n), Source(n), Source_old(n);
 
-      /*--- Setup stabilization matrix for this node ---*/
-      for (iInst = 0; iInst < nInstHB; iInst++) {
-        for (jInst = 0; jInst < nInstHB; jInst++) {
-          if (jInst == iInst ) {
-            Pinv[iInst][jInst] = 1.0 + Delta*D[iInst][jInst];
-          }
-          else {
-            Pinv[iInst][jInst] = Delta*D[iInst][jInst];
-          }
-        }
-      }
+      SU2_OMP_FOR_STAT(computeStaticChunkSize(nPoint, omp_get_num_threads(), 256))
+      for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
 
-      /*--- Invert stabilization matrix Pinv with Gauss elimination---*/
+        unsigned short i, j, k;
 
-      /*--  A temporary matrix to hold the inverse, dynamically allocated ---*/
-      su2double **temp = new su2double*[nInstHB];
-      for (i = 0; i < nInstHB; i++) {
-        temp[i] = new su2double[2 * nInstHB];
-      }
+        /*--- Get time step for current node ---*/
+        const su2double Delta = solver_container[ZONE_0][INST_0][iMGlevel][FLOW_SOL]->GetNodes()->GetDelta_Time(iPoint);
 
-      /*---  Copy the desired matrix into the temporary matrix ---*/
-      for (i = 0; i < nInstHB; i++) {
-        for (j = 0; j < nInstHB; j++) {
-          temp[i][j] = Pinv[i][j];
-          temp[i][nInstHB + j] = 0;
+        /*--- Setup stabilization matrix Pinv = I + Delta*D for this node, augmented with the identity ---*/
+        for (i = 0; i < n; i++) {
+          for (j = 0; j < n; j++) {
+            temp[i*n2+j] = Delta*D[i][j] + su2double(i == j);
+            temp[i*n2+n+j] = su2double(i == j);
+          }
         }
-        temp[i][nInstHB + i] = 1;
-      }
 
-      su2double max_val;
-      unsigned short max_idx;
-
-      /*---  Pivot each column such that the largest number possible divides the other rows  ---*/
-      for (k = 0; k < nInstHB - 1; k++) {
-        max_idx = k;
-        max_val = abs(temp[k][k]);
-        /*---  Find the largest value (pivot) in the column  ---*/
-        for (j = k; j < nInstHB; j++) {
-          if (abs(temp[j][k]) > max_val) {
-            max_idx = j;
-            max_val = abs(temp[j][k]);
+        /*--- Invert stabilization matrix Pinv with Gauss elimination---*/
+
+        /*---  Pivot each column such that the largest number possible divides the other rows  ---*/
+        for (k = 0; k < n - 1; k++) {
+          unsigned short max_idx = k;
+          su2double max_val = abs(temp[k*n2+k]);
+          /*---  Find the largest value (pivot) in the column  ---*/
+          for (j = k; j < n; j++) {
+            if (abs(temp[j*n2+k]) > max_val) {
+              max_idx = j;
+              max_val = abs(temp[j*n2+k]);
+            }
           }
-        }
 
-        /*---  Move the row with the highest value up  ---*/
-        for (j = 0; j < (nInstHB * 2); j++) {
-          su2double d = temp[k][j];
-          temp[k][j] = temp[max_idx][j];
-          temp[max_idx][j] = d;
-        }
-        /*---  Subtract the moved row from all other rows ---*/
-        for (i = k + 1; i < nInstHB; i++) {
-          su2double c = temp[i][k] / temp[k][k];
-          for (j = 0; j < (nInstHB * 2); j++) {
-            temp[i][j] = temp[i][j] - temp[k][j] * c;
+          /*---  Move the row with the highest value up  ---*/
+          for (j = 0; j < n2; j++) swap(temp[k*n2+j], temp[max_idx*n2+j]);
+
+          /*---  Subtract the moved row from all other rows ---*/
+          for (i = k + 1; i < n; i++) {
+            su2double c = temp[i*n2+k] / temp[k*n2+k];
+            for (j = 0; j < n2; j++) temp[i*n2+j] -= temp[k*n2+j] * c;
           }
         }
-      }
 
-      /*---  Back-substitution  ---*/
-      for (k = nInstHB - 1; k > 0; k--) {
-        if (temp[k][k] != su2double(0.0)) {
-          for (int i = k - 1; i > -1; i--) {
-            su2double c = temp[i][k] / temp[k][k];
-            for (j = 0; j < (nInstHB * 2); j++) {
-              temp[i][j] = temp[i][j] - temp[k][j] * c;
+        /*---  Back-substitution  ---*/
+        for (k = n - 1; k > 0; k--) {
+          if (temp[k*n2+k] != su2double(0.0)) {
+            for (int ii = k - 1; ii > -1; ii--) {
+              su2double c = temp[ii*n2+k] / temp[k*n2+k];
+              for (j = 0; j < n2; j++) temp[ii*n2+j] -= temp[k*n2+j] * c;
             }
           }
         }
-      }
-
-      /*---  Normalize the inverse  ---*/
-      for (i = 0; i < nInstHB; i++) {
-        su2double c = temp[i][i];
-        for (j = 0; j < nInstHB; j++) {
-          temp[i][j + nInstHB] = temp[i][j + nInstHB] / c;
-        }
-      }
 
-      /*---  Copy the inverse back to the main program flow ---*/
-      for (i = 0; i < nInstHB; i++) {
-        for (j = 0; j < nInstHB; j++) {
-          P[i][j] = temp[i][j + nInstHB];
+        /*---  Normalize the inverse and copy it back  ---*/
+        for (i = 0; i < n; i++) {
+          su2double c = temp[i*n2+i];
+          for (j = 0; j < n; j++) P[i*n+j] = temp[i*n2+n+j] / c;
         }
-      }
-
-      /*---  Delete dynamic template  ---*/
-      for (iInst = 0; iInst < nInstHB; iInst++) {
-        delete[] temp[iInst];
-      }
-      delete[] temp;
 
-      /*--- Loop through variables to precondition ---*/
-      for (iVar = 0; iVar < nVar; iVar++) {
+        /*--- Loop through variables to precondition ---*/
+        for (unsigned short iVar = 0; iVar < nVar; iVar++) {
 
-        /*--- Get current source terms (not yet preconditioned) and zero source array to prepare preconditioning ---*/
-        for (iInst = 0; iInst < nInstHB; iInst++) {
-          Source_old[iInst] = solver_container[ZONE_0][iInst][iMGlevel][FLOW_SOL]->GetNodes()->GetHarmonicBalance_Source(iPoint, iVar);
-          Source[iInst] = 0;
-        }
+          /*--- Get current source terms (not yet preconditioned) ---*/
+          for (i = 0; i < n; i++)
+            Source_old[i] = solver_container[ZONE_0][i][iMGlevel][FLOW_SOL]->GetNodes()->GetHarmonicBalance_Source(iPoint, iVar);
 
-        /*--- Step through columns ---*/
-        for (iInst = 0; iInst < nInstHB; iInst++) {
-          for (jInst = 0; jInst < nInstHB; jInst++) {
-            Source[iInst] += P[iInst][jInst]*Source_old[jInst];
-          }
+          /*--- Step through columns ---*/
+          for (i = 0; i < n; i++) {
+            Source[i] = 0.0;
+            for (j = 0; j < n; j++) Source[i] += P[i*n+j]*Source_old[j];
 
-          /*--- Store updated source terms for current node ---*/
-          if (!adjoint) {
-            solver_container[ZONE_0][iInst][iMGlevel][FLOW_SOL]->GetNodes()->SetHarmonicBalance_Source(iPoint, iVar, Source[iInst]);
-          }
-          else {
-            solver_container[ZONE_0][iInst][iMGlevel][ADJFLOW_SOL]->GetNodes()->SetHarmonicBalance_Source(iPoint, iVar, Source[iInst]);
+            /*--- Store updated source terms for current node ---*/
+            if (!adjoint) {
+              solver_container[ZONE_0][i][iMGlevel][FLOW_SOL]->GetNodes()->SetHarmonicBalance_Source(iPoint, iVar, Source[i]);
+            }
+            else {
+              solver_container[ZONE_0][i][iMGlevel][ADJFLOW_SOL]->GetNodes()->SetHarmonicBalance_Source(iPoint, iVar, Source[i]);
+            }
           }
         }
-
       }
-    }
-  }
-
-  /*--- Deallocate dynamic memory ---*/
-  for (iInst = 0; iInst < nInstHB; iInst++){
-    delete [] P[iInst];
-    delete [] Pinv[iInst];
+    } // end SU2_OMP_PARALLEL
   }
-  delete [] P;
-  delete [] Pinv;
-  delete [] Source;
-  delete [] Source_old;
 
 }
 
@@ -0,0 +1,178 @@
+/*!
+ * \file CEnsembleDriver.cpp
+ * \brief Driver of the ensembles of instances sharing one geometry (UQ_ENSEMBLE).
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "../../include/drivers/CEnsembleDriver.hpp"
+#include "../../include/output/COutputFactory.hpp"
+#include "../../include/output/COutput.hpp"
+
+CEnsembleDriver::CEnsembleDriver(char* confFile,
+                                 unsigned short val_nZone,
+                                 SU2_Comm MPICommunicator) : CSinglezoneDriver(confFile,
+                                                                               val_nZone,
+                                                                               MPICommunicator) {
+  auto config = config_container[ZONE_0];
+  const auto nMember = nInst[ZONE_0];
+
+  /*--- The other members have their own convergence monitoring and volume output, without screen and history. ---*/
+
+  memberOutput.resize(nMember, nullptr);
+  memberOutput[0] = output_container[ZONE_0];
+
+  for (unsigned short iInst = 1; iInst < nMember; iInst++) {
+    config->SetiInst(iInst);
+    const auto kindSolver = static_cast<ENUM_MAIN_SOLVER>(config->GetKind_Solver());
+    memberOutput[iInst] = COutputFactory::createOutput(kindSolver, config, nDim);
+    memberOutput[iInst]->PreprocessHistoryOutput(config, false);
+    memberOutput[iInst]->PreprocessVolumeOutput(config);
+  }
+  config->SetiInst(INST_0);
+
+  memberConverged.resize(nMember, false);
+
+  if (rank == MASTER_NODE) {
+    cout << endl << "UQ ensemble of " << nMember << " members sharing the geometry of instance 0:" << endl;
+    for (unsigned short iInst = 0; iInst < nMember; iInst++) {
+      config->SetUQ_EnsembleMember(iInst);
+      cout << "  Member " << iInst << ": UQ_COMPONENT= " << config->GetEig_Val_Comp()
+           << ", UQ_PERMUTE= " << (config->GetUQ_Permute()? "YES" : "NO") << endl;
+    }
+  }
+  config->SetUQ_EnsembleMember(INST_0);
+}
+
+CEnsembleDriver::~CEnsembleDriver(void) {
+
+  for (auto iInst = 1ul; iInst < memberOutput.size(); iInst++) delete memberOutput[iInst];
+}
+
+void CEnsembleDriver::Preprocess(unsigned long TimeIter) {
+
+  CSinglezoneDriver::Preprocess(TimeIter);
+
+  auto config = config_container[ZONE_0];
+
+  for (unsigned short iInst = 1; iInst < nInst[ZONE_0]; iInst++) {
+    config->SetiInst(iInst);
+    solver_container[ZONE_0][iInst][MESH_0][FLOW_SOL]->SetInitialCondition(geometry_container[ZONE_0][iInst],
+                                                                           solver_container[ZONE_0][iInst], config, TimeIter);
+  }
+  config->SetiInst(INST_0);
+}
+
+void CEnsembleDriver::Run() {
+
+  auto config = config_container[ZONE_0];
+  const auto nMember = nInst[ZONE_0];
+  const auto nInner_Iter = config->GetnInner_Iter();
+
+  config->SetOuterIter(0);
+
+  for (unsigned short iInst = 0; iInst < nMember; iInst++) {
+    config->SetiInst(iInst);
+    iteration_container[ZONE_0][iInst]->Preprocess(memberOutput[iInst], integration_container, geometry_container,
+                                                   solver_container, numerics_container, config_container,
+                                                   surface_movement, grid_movement, FFDBox, ZONE_0, iInst);
+  }
+
+  bool allConverged = false;
+
+  for (unsigned long Inner_Iter = 0; Inner_Iter < nInner_Iter && !allConverged; Inner_Iter++) {
+
+    config->SetInnerIter(Inner_Iter);
+    allConverged = true;
+
+    /*--- One iteration of each member, the members go through the same edges and points (of the shared
+     *    geometry) one after the other, while they are still in the cache. ---*/
+
+    for (unsigned short iInst = 0; iInst < nMember; iInst++) {
+
+      if (memberConverged[iInst]) continue;
+
+      config->SetiInst(iInst);
+
+      iteration_container[ZONE_0][iInst]->Iterate(memberOutput[iInst], integration_container, geometry_container,
+                                                  solver_container, numerics_container, config_container,
+                                                  surface_movement, grid_movement, FFDBox, ZONE_0, iInst);
+
+      auto output = memberOutput[iInst];
+
+      output->SetHistory_Output(geometry_container[ZONE_0][iInst][MESH_0], solver_container[ZONE_0][iInst][MESH_0],
+                                config, config->GetTimeIter(), config->GetOuterIter(), Inner_Iter);
+
+      memberConverged[iInst] = output->GetConvergence();
+      allConverged = allConverged && memberConverged[iInst];
+
+      if (memberConverged[iInst] && (rank == MASTER_NODE))
+        cout << "Ensemble member " << iInst << " converged at iteration " << Inner_Iter << "." << endl;
+
+      /*--- Intermediate files. ---*/
+
+      output->SetResult_Files(geometry_container[ZONE_0][iInst][MESH_0], config,
+                              solver_container[ZONE_0][iInst][MESH_0], Inner_Iter);
+    }
+  }
+  config->SetiInst(INST_0);
+
+  /*--- The monitoring of the single zone driver checks the convergence of the whole ensemble. ---*/
+
+  output_container[ZONE_0]->SetConvergence(allConverged);
+}
+
+void CEnsembleDriver::Postprocess() {
+
+  for (unsigned short iInst = 0; iInst < nInst[ZONE_0]; iInst++) {
+    config_container[ZONE_0]->SetiInst(iInst);
+    iteration_container[ZONE_0][iInst]->Postprocess(memberOutput[iInst], integration_container, geometry_container,
+                                                    solver_container, numerics_container, config_container,
+                                                    surface_movement, grid_movement, FFDBox, ZONE_0, iInst);
+  }
+  config_container[ZONE_0]->SetiInst(INST_0);
+}
+
+void CEnsembleDriver::Update() {
+
+  for (unsigned short iInst = 0; iInst < nInst[ZONE_0]; iInst++) {
+    config_container[ZONE_0]->SetiInst(iInst);
+    iteration_container[ZONE_0][iInst]->Update(memberOutput[iInst], integration_container, geometry_container,
+                                               solver_container, numerics_container, config_container,
+                                               surface_movement, grid_movement, FFDBox, ZONE_0, iInst);
+  }
+  config_container[ZONE_0]->SetiInst(INST_0);
+}
+
+void CEnsembleDriver::Output(unsigned long TimeIter) {
+
+  /*--- The files of each member have its suffix (the instance of the filenames). ---*/
+
+  for (unsigned short iInst = 0; iInst < nInst[ZONE_0]; iInst++) {
+    config_container[ZONE_0]->SetiInst(iInst);
+    memberOutput[iInst]->SetResult_Files(geometry_container[ZONE_0][iInst][MESH_0], config_container[ZONE_0],
+                                         solver_container[ZONE_0][iInst][MESH_0], TimeIter, StopCalc);
+  }
+  config_container[ZONE_0]->SetiInst(INST_0);
+}
@@ -0,0 +1,520 @@
+/*!
+ * \file CLoadBalancingDriver.cpp
+ * \brief Unsteady runs that repartition the grid, and migrate the solution in memory, when the ranks are imbalanced.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "../../include/drivers/CLoadBalancingDriver.hpp"
+#include "../../include/output/COutput.hpp"
+#include "../../include/CSolutionInterpolator.hpp"
+#include "../../../Common/include/geometry/CParallelGridAdaptation.hpp"
+#include "../../../Common/include/geometry/meshreader/CMemoryMeshReaderFVM.hpp"
+#include "../../../Common/include/toolboxes/CLinearPartitioner.hpp"
+#include "../../../Common/include/toolboxes/CCommProfiler.hpp"
+
+#include <algorithm>
+
+namespace {
+
+inline SU2_MPI::Datatype MPIType(unsigned long) { return MPI_UNSIGNED_LONG; }
+inline SU2_MPI::Datatype MPIType(passivedouble) { return MPI_DOUBLE; }
+
+/*--- Send a buffer to each rank and receive one from each rank (collective). ---*/
+template<class T>
+void ExchangeBuffers(const vector<vector<T> >& sendBuf, vector<vector<T> >& recvBuf) {
+
+  const int size = SU2_MPI::GetSize();
+
+  recvBuf.clear();
+  recvBuf.resize(size);
+
+  if (size == 1) {
+    recvBuf[0] = sendBuf[0];
+    return;
+  }
+
+#ifdef HAVE_MPI
+  vector<int> nSend(size), nRecv(size), sendDispl(size+1, 0), recvDispl(size+1, 0);
+
+  for (int iRank = 0; iRank < size; iRank++) nSend[iRank] = sendBuf[iRank].size();
+
+  SU2_MPI::Alltoall(nSend.data(), 1, MPI_INT, nRecv.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+  for (int iRank = 0; iRank < size; iRank++) {
+    sendDispl[iRank+1] = sendDispl[iRank] + nSend[iRank];
+    recvDispl[iRank+1] = recvDispl[iRank] + nRecv[iRank];
+  }
+
+  vector<T> sendData(sendDispl[size]), recvData(recvDispl[size]);
+  for (int iRank = 0; iRank < size; iRank++)
+    copy(sendBuf[iRank].begin(), sendBuf[iRank].end(), sendData.begin()+sendDispl[iRank]);
+
+  SelectMPIWrapper<T>::W::Alltoallv(sendData.data(), nSend.data(), sendDispl.data(), MPIType(T()),
+                                    recvData.data(), nRecv.data(), recvDispl.data(), MPIType(T()),
+                                    MPI_COMM_WORLD);
+
+  for (int iRank = 0; iRank < size; iRank++)
+    recvBuf[iRank].assign(recvData.begin()+recvDispl[iRank], recvData.begin()+recvDispl[iRank+1]);
+#endif
+}
+
+/*--- An element is copied by the rank that owns its node of lowest global index, which holds all its elements. ---*/
+bool IsOwned(const CGeometry* geometry, CPrimalGrid* elem) {
+  unsigned long iPointMin = elem->GetNode(0);
+  for (unsigned short iNode = 1; iNode < elem->GetnNodes(); iNode++) {
+    const unsigned long iPoint = elem->GetNode(iNode);
+    if (geometry->node[iPoint]->GetGlobalIndex() < geometry->node[iPointMin]->GetGlobalIndex()) iPointMin = iPoint;
+  }
+  return geometry->node[iPointMin]->GetDomain();
+}
+
+/*--- Record [vtkType n0 ... ] of an element, with the global indices of its nodes. ---*/
+void AddRecord(const CGeometry* geometry, CPrimalGrid* elem, unsigned short recordSize, vector<unsigned long>& conn) {
+  const auto offset = conn.size();
+  conn.resize(offset+recordSize, 0);
+  conn[offset] = elem->GetVTK_Type();
+  for (unsigned short iNode = 0; iNode < elem->GetnNodes(); iNode++)
+    conn[offset+1+iNode] = geometry->node[elem->GetNode(iNode)]->GetGlobalIndex();
+}
+
+}
+
+/*!
+ * \brief Solution of the linear partitions and state of the motion, kept between the driver that stops to repartition
+ *        the grid and the driver of the new partition.
+ * \note The values of a point are the solution, and the solutions at time n and n-1, of the flow and turbulence solvers.
+ */
+struct CLoadBalancingDriver::CSolutionMigration {
+  unsigned long timeIter = 0;           /*!< \brief Time iteration the next driver starts from. */
+  unsigned short nVarFlow = 0;          /*!< \brief Number of variables of the flow solver. */
+  unsigned short nVarTurb = 0;          /*!< \brief Number of variables of the turbulence solver. */
+  unsigned long firstPoint = 0;         /*!< \brief Global index of the first point of the linear partition of this rank. */
+  vector<passivedouble> values;         /*!< \brief Values of the points of the linear partition. */
+  su2double motionOrigin[3] = {0.0};    /*!< \brief Origin of the rigid motion. */
+  vector<su2double> momentOrigin;       /*!< \brief Origins of the moments of the monitored markers (3 per marker). */
+
+  unsigned short GetStride() const { return 3*(nVarFlow+nVarTurb); }
+};
+
+CLoadBalancingDriver::CSolutionMigration* CLoadBalancingDriver::migration = nullptr;
+
+CLoadBalancingDriver::CLoadBalancingDriver(char* confFile,
+                                           unsigned short val_nZone,
+                                           SU2_Comm MPICommunicator) : CSinglezoneDriver(confFile,
+                                                                                         val_nZone,
+                                                                                         MPICommunicator) {
+  if (config_container[ZONE_0]->GetRestart())
+    startIter = config_container[ZONE_0]->GetRestart_Iter();
+
+  if (migration != nullptr) MigrateSolution();
+
+  /*--- The outputs of this driver are named, the next ones start from the beginning unless they are set again. ---*/
+
+  COutput::SetContinuationIter(0);
+
+  /*--- The computation time of the ranks is measured by the communication profiler. ---*/
+
+  CCommProfiler::Enable();
+}
+
+void CLoadBalancingDriver::StartSolver() {
+
+  if (solved) return;
+  solved = true;
+
+  CConfig* config = config_container[ZONE_0];
+
+#ifndef HAVE_MPI
+  StartTime = su2double(clock())/su2double(CLOCKS_PER_SEC);
+#else
+  StartTime = MPI_Wtime();
+#endif
+
+  config->Set_StartTime(StartTime);
+
+  if (rank == MASTER_NODE) {
+    cout << endl <<"------------------------------ Begin Solver -----------------------------" << endl;
+    cout << endl << "Simulation Run using the Single-zone Driver with load balancing" << endl;
+    cout << "The simulation will run for " << config->GetnTime_Iter() - startIter << " time steps, the load ";
+    cout << "balance is checked every " << config->GetLoadBalancing_Freq() << " time steps." << endl;
+  }
+
+  TimeIter = startIter;
+  computeTime = 0.0;
+
+  while (TimeIter < config->GetnTime_Iter()) {
+
+    /*--- Only the time step itself is measured, the output is mostly done by the master. ---*/
+
+    const passivedouble stepStart = CCommProfiler::GetComputeTime();
+
+    Preprocess(TimeIter);
+
+    Run();
+
+    Postprocess();
+
+    Update();
+
+    computeTime += CCommProfiler::GetComputeTime() - stepStart;
+
+    Monitor(TimeIter);
+
+    Output(TimeIter);
+
+    if (StopCalc) break;
+
+    TimeIter++;
+
+    /*--- Stop to repartition the grid if the ranks are imbalanced, the next driver continues from TimeIter. ---*/
+
+    if (((TimeIter - startIter) % config->GetLoadBalancing_Freq() == 0) &&
+        (TimeIter < config->GetnTime_Iter()) && CheckBalance()) {
+      rebalance = true;
+      break;
+    }
+
+  }
+
+}
+
+bool CLoadBalancingDriver::CheckBalance() {
+
+  passivedouble maxTime = computeTime, sumTime = computeTime;
+#ifdef HAVE_MPI
+  SelectMPIWrapper<passivedouble>::W::Allreduce(&computeTime, &maxTime, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  SelectMPIWrapper<passivedouble>::W::Allreduce(&computeTime, &sumTime, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#endif
+
+  const passivedouble imbalance = (sumTime > 0.0)? maxTime*size/sumTime : 1.0;
+  const bool imbalanced = (imbalance > SU2_TYPE::GetValue(config_container[ZONE_0]->GetLoadBalancing_Tol()));
+
+  if (rank == MASTER_NODE) {
+    cout << "Load balance of the ranks at time iteration " << TimeIter << ": max/avg computation time "
+         << imbalance << (imbalanced? ", the grid is repartitioned." : ".") << endl;
+  }
+
+  /*--- The next check measures the next time steps. ---*/
+
+  if (!imbalanced) computeTime = 0.0;
+
+  return imbalanced;
+}
+
+bool CLoadBalancingDriver::Rebalance() {
+
+  if (!rebalance) return false;
+
+  CConfig* config = config_container[ZONE_0];
+  CGeometry* geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  CSolver** solver = solver_container[ZONE_0][INST_0][MESH_0];
+
+  const bool turbulent = (config->GetKind_Turb_Model() != NONE) && (solver[TURB_SOL] != nullptr);
+
+  delete migration;
+  migration = new CSolutionMigration;
+
+  migration->timeIter = TimeIter;
+  migration->nVarFlow = solver[FLOW_SOL]->GetnVar();
+  migration->nVarTurb = turbulent? solver[TURB_SOL]->GetnVar() : 0;
+
+  for (unsigned short iDim = 0; iDim < 3; iDim++)
+    migration->motionOrigin[iDim] = config->GetMotion_Origin(iDim);
+
+  for (unsigned short iMarker = 0; iMarker < config->GetnMarker_Monitoring(); iMarker++) {
+    migration->momentOrigin.push_back(config->GetRefOriginMoment_X(iMarker));
+    migration->momentOrigin.push_back(config->GetRefOriginMoment_Y(iMarker));
+    migration->momentOrigin.push_back(config->GetRefOriginMoment_Z(iMarker));
+  }
+
+  /*--- The measured cost of a point of this rank, relative to the average cost of a point, is the weight
+   *    of its points in the partitioning of the next driver. ---*/
+
+  passivedouble local[2] = {computeTime, passivedouble(geometry->GetnPointDomain())};
+  passivedouble global[2] = {local[0], local[1]};
+#ifdef HAVE_MPI
+  SelectMPIWrapper<passivedouble>::W::Allreduce(local, global, 2, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#endif
+
+  passivedouble work = 1.0;
+  if ((local[0] > 0.0) && (local[1] > 0.0) && (global[0] > 0.0))
+    work = (local[0]/local[1]) / (global[0]/global[1]);
+
+  CAdaptedMesh mesh;
+  SetPendingGrid(work, mesh);
+  CMemoryMeshReaderFVM::SetMesh(move(mesh));
+
+  /*--- The outputs of the next driver continue from this time iteration. ---*/
+
+  COutput::SetContinuationIter(TimeIter);
+
+  return true;
+}
+
+void CLoadBalancingDriver::SetPendingGrid(passivedouble work, CAdaptedMesh& mesh) {
+
+  CConfig* config = config_container[ZONE_0];
+  CGeometry* geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  CSolver** solver = solver_container[ZONE_0][INST_0][MESH_0];
+
+  const unsigned short nDim = geometry->GetnDim();
+  const unsigned short nVarFlow = migration->nVarFlow, nVarTurb = migration->nVarTurb;
+  const unsigned short nVar = nVarFlow+nVarTurb, stride = migration->GetStride();
+  const unsigned short nValue = nDim+1+stride;
+
+  mesh.nDim = nDim;
+  mesh.nPointGlobal = geometry->GetGlobal_nPointDomain();
+
+  /*--- Domain points, with their coordinates, work and values, sent to the ranks of their linear partition. ---*/
+
+  CLinearPartitioner pointPartitioner(mesh.nPointGlobal, 0);
+
+  vector<vector<unsigned long> > sendIndex(size), recvIndex;
+  vector<vector<passivedouble> > sendValue(size), recvValue;
+
+  CVariable* flowNodes = solver[FLOW_SOL]->GetNodes();
+  CVariable* turbNodes = (nVarTurb > 0)? solver[TURB_SOL]->GetNodes() : nullptr;
+
+  vector<passivedouble> values(nValue);
+
+  for (unsigned long iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
+
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      values[iDim] = SU2_TYPE::GetValue(geometry->node[iPoint]->GetCoord(iDim));
+    values[nDim] = work;
+
+    passivedouble* pointValues = &values[nDim+1];
+    for (unsigned short iVar = 0; iVar < nVarFlow; iVar++) {
+      pointValues[iVar]        = SU2_TYPE::GetValue(flowNodes->GetSolution(iPoint,iVar));
+      pointValues[nVar+iVar]   = SU2_TYPE::GetValue(flowNodes->GetSolution_time_n(iPoint,iVar));
+      pointValues[2*nVar+iVar] = SU2_TYPE::GetValue(flowNodes->GetSolution_time_n1(iPoint,iVar));
+    }
+    for (unsigned short iVar = 0; iVar < nVarTurb; iVar++) {
+      pointValues[nVarFlow+iVar]        = SU2_TYPE::GetValue(turbNodes->GetSolution(iPoint,iVar));
+      pointValues[nVar+nVarFlow+iVar]   = SU2_TYPE::GetValue(turbNodes->GetSolution_time_n(iPoint,iVar));
+      pointValues[2*nVar+nVarFlow+iVar] = SU2_TYPE::GetValue(turbNodes->GetSolution_time_n1(iPoint,iVar));
+    }
+
+    const unsigned long iPoint_Global = geometry->node[iPoint]->GetGlobalIndex();
+    const unsigned long iRank = pointPartitioner.GetRankContainingIndex(iPoint_Global);
+    sendIndex[iRank].push_back(iPoint_Global);
+    sendValue[iRank].insert(sendValue[iRank].end(), values.begin(), values.end());
+  }
+
+  ExchangeBuffers(sendIndex, recvIndex);
+  ExchangeBuffers(sendValue, recvValue);
+  vector<vector<unsigned long> >().swap(sendIndex);
+  vector<vector<passivedouble> >().swap(sendValue);
+
+  mesh.firstPoint = pointPartitioner.GetFirstIndexOnRank(rank);
+  const unsigned long nPointSlice = pointPartitioner.GetSizeOnRank(rank);
+
+  mesh.coords.assign(nPointSlice*nDim, 0.0);
+  mesh.weights.assign(nPointSlice, 1.0);
+  migration->firstPoint = mesh.firstPoint;
+  migration->values.assign(nPointSlice*stride, 0.0);
+
+  unsigned long nReceived = 0;
+
+  for (int iRank = 0; iRank < size; iRank++) {
+    for (unsigned long iPoint = 0; iPoint < recvIndex[iRank].size(); iPoint++) {
+      const unsigned long iPoint_Slice = recvIndex[iRank][iPoint] - mesh.firstPoint;
+      const passivedouble* pointValues = &recvValue[iRank][iPoint*nValue];
+      copy_n(pointValues, nDim, &mesh.coords[iPoint_Slice*nDim]);
+      mesh.weights[iPoint_Slice] = pointValues[nDim];
+      copy_n(pointValues+nDim+1, stride, &migration->values[iPoint_Slice*stride]);
+    }
+    nReceived += recvIndex[iRank].size();
+  }
+
+  if (nReceived != nPointSlice) {
+    SU2_MPI::Error("The domain points of the ranks do not cover the grid.", CURRENT_FUNCTION);
+  }
+
+  /*--- The elements stay on the rank that copies them, after those of the lower ranks in the global list. ---*/
+
+  mesh.elems.clear();
+  for (unsigned long iElem = 0; iElem < geometry->GetnElem(); iElem++)
+    if (IsOwned(geometry, geometry->elem[iElem]))
+      AddRecord(geometry, geometry->elem[iElem], SU2_BINARY_MESH_ELEM, mesh.elems);
+
+  unsigned long nElem = mesh.elems.size()/SU2_BINARY_MESH_ELEM;
+  vector<unsigned long> nElemRank(size, nElem);
+#ifdef HAVE_MPI
+  SU2_MPI::Allgather(&nElem, 1, MPI_UNSIGNED_LONG, nElemRank.data(), 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+#endif
+
+  mesh.firstElem = 0;
+  mesh.nElemGlobal = 0;
+  for (int iRank = 0; iRank < size; iRank++) {
+    if (iRank < rank) mesh.firstElem += nElemRank[iRank];
+    mesh.nElemGlobal += nElemRank[iRank];
+  }
+
+  /*--- The boundary elements, by marker of the config file (the local markers differ among the ranks),
+   *    are gathered on the master, the empty markers are removed. ---*/
+
+  vector<vector<unsigned long> > boundConn(config->GetnMarker_CfgFile());
+
+  for (unsigned short iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
+
+    if (config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) continue;
+
+    const unsigned short iMarker_CfgFile = config->GetMarker_CfgFile_TagBound(config->GetMarker_All_TagBound(iMarker));
+
+    for (unsigned long iElem = 0; iElem < geometry->GetnElem_Bound(iMarker); iElem++)
+      if (IsOwned(geometry, geometry->bound[iMarker][iElem]))
+        AddRecord(geometry, geometry->bound[iMarker][iElem], SU2_BINARY_MESH_BOUND, boundConn[iMarker_CfgFile]);
+  }
+
+  mesh.markerNames.clear();
+  mesh.markers.clear();
+
+  for (unsigned short iMarker = 0; iMarker < boundConn.size(); iMarker++) {
+
+    unsigned long nElem_Bound = boundConn[iMarker].size(), nElem_BoundGlobal = nElem_Bound;
+#ifdef HAVE_MPI
+    SU2_MPI::Allreduce(&nElem_Bound, &nElem_BoundGlobal, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+#endif
+    if (nElem_BoundGlobal == 0) continue;
+
+    vector<vector<unsigned long> > sendBound(size), recvBound;
+    sendBound[MASTER_NODE] = move(boundConn[iMarker]);
+    ExchangeBuffers(sendBound, recvBound);
+
+    mesh.markerNames.push_back(config->GetMarker_CfgFile_TagBound(iMarker));
+    mesh.markers.emplace_back();
+
+    if (rank == MASTER_NODE) {
+      for (int iRank = 0; iRank < size; iRank++)
+        mesh.markers.back().insert(mesh.markers.back().end(), recvBound[iRank].begin(), recvBound[iRank].end());
+    }
+  }
+
+}
+
+void CLoadBalancingDriver::MigrateSolution() {
+
+  CConfig* config = config_container[ZONE_0];
+  CGeometry** geometry = geometry_container[ZONE_0][INST_0];
+  CSolver*** solver = solver_container[ZONE_0][INST_0];
+
+  const unsigned short nVarFlow = migration->nVarFlow, nVarTurb = migration->nVarTurb;
+  const unsigned short nVar = nVarFlow+nVarTurb, stride = migration->GetStride();
+
+  if ((solver[MESH_0][FLOW_SOL]->GetnVar() != nVarFlow) ||
+      ((nVarTurb > 0) && (solver[MESH_0][TURB_SOL]->GetnVar() != nVarTurb)))
+    SU2_MPI::Error("The solvers of the new partition differ from those of the previous one.", CURRENT_FUNCTION);
+
+  /*--- The points of this rank (halos included) request their values from the ranks of their linear partition. ---*/
+
+  const unsigned long nPoint = geometry[MESH_0]->GetnPoint();
+  CLinearPartitioner pointPartitioner(geometry[MESH_0]->GetGlobal_nPointDomain(), 0);
+
+  vector<vector<unsigned long> > request(size), requested, localPoint(size);
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+    const unsigned long iPoint_Global = geometry[MESH_0]->node[iPoint]->GetGlobalIndex();
+    const unsigned long iRank = pointPartitioner.GetRankContainingIndex(iPoint_Global);
+    request[iRank].push_back(iPoint_Global);
+    localPoint[iRank].push_back(iPoint);
+  }
+
+  ExchangeBuffers(request, requested);
+
+  vector<vector<passivedouble> > reply(size), replied;
+  for (int iRank = 0; iRank < size; iRank++) {
+    reply[iRank].reserve(requested[iRank].size()*stride);
+    for (auto iPoint_Global : requested[iRank]) {
+      const passivedouble* pointValues = &migration->values[(iPoint_Global-migration->firstPoint)*stride];
+      reply[iRank].insert(reply[iRank].end(), pointValues, pointValues+stride);
+    }
+  }
+
+  ExchangeBuffers(reply, replied);
+
+  vector<passivedouble> solution(nPoint*stride);
+  for (int iRank = 0; iRank < size; iRank++)
+    for (unsigned long k = 0; k < localPoint[iRank].size(); k++)
+      copy_n(&replied[iRank][k*stride], stride, &solution[localPoint[iRank][k]*stride]);
+
+  /*--- State of the motion. ---*/
+
+  config->SetMotion_Origin(migration->motionOrigin);
+
+  for (unsigned short iMarker = 0; iMarker < config->GetnMarker_Monitoring(); iMarker++) {
+    config->SetRefOriginMoment_X(iMarker, migration->momentOrigin[3*iMarker]);
+    config->SetRefOriginMoment_Y(iMarker, migration->momentOrigin[3*iMarker+1]);
+    config->SetRefOriginMoment_Z(iMarker, migration->momentOrigin[3*iMarker+2]);
+  }
+
+  startIter = migration->timeIter;
+
+  delete migration;
+  migration = nullptr;
+
+  /*--- The time levels of all the points of the fine grid, the coarse levels take the volume weighted
+   *    average of their children as for a restart. ---*/
+
+  for (auto iSol : {FLOW_SOL, TURB_SOL}) {
+    if ((iSol == TURB_SOL) && (nVarTurb == 0)) continue;
+    const unsigned short nVarSol = (iSol == FLOW_SOL)? nVarFlow : nVarTurb;
+    const unsigned short offset = (iSol == FLOW_SOL)? 0 : nVarFlow;
+
+    CVariable* nodes = solver[MESH_0][iSol]->GetNodes();
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+      for (unsigned short iVar = 0; iVar < nVarSol; iVar++) {
+        nodes->Set_Solution_time_n(iPoint, iVar, solution[iPoint*stride+nVar+offset+iVar]);
+        nodes->Set_Solution_time_n1(iPoint, iVar, solution[iPoint*stride+2*nVar+offset+iVar]);
+      }
+    }
+
+    for (unsigned short iMesh = 1; iMesh <= config->GetnMGLevels(); iMesh++) {
+      CVariable* coarseNodes = solver[iMesh][iSol]->GetNodes();
+      CVariable* fineNodes = solver[iMesh-1][iSol]->GetNodes();
+      for (unsigned long iPoint = 0; iPoint < geometry[iMesh]->GetnPoint(); iPoint++) {
+        const su2double volume = geometry[iMesh]->node[iPoint]->GetVolume();
+        for (unsigned short iVar = 0; iVar < nVarSol; iVar++) {
+          su2double value_n = 0.0, value_n1 = 0.0;
+          for (unsigned short iChildren = 0; iChildren < geometry[iMesh]->node[iPoint]->GetnChildren_CV(); iChildren++) {
+            const unsigned long Point_Fine = geometry[iMesh]->node[iPoint]->GetChildren_CV(iChildren);
+            const su2double weight = geometry[iMesh-1]->node[Point_Fine]->GetVolume()/volume;
+            value_n += fineNodes->GetSolution_time_n(Point_Fine,iVar)*weight;
+            value_n1 += fineNodes->GetSolution_time_n1(Point_Fine,iVar)*weight;
+          }
+          coarseNodes->Set_Solution_time_n(iPoint, iVar, value_n);
+          coarseNodes->Set_Solution_time_n1(iPoint, iVar, value_n1);
+        }
+      }
+    }
+  }
+
+  /*--- The solution itself is finalized as a restart (halos, primitive variables, coarse levels). ---*/
+
+  CSolutionInterpolator::SetRestartSolution(geometry, solver, config, solution, stride);
+
+  if (rank == MASTER_NODE)
+    cout << "Solution and time levels migrated to the new partition at time iteration " << startIter << "." << endl;
+
+}
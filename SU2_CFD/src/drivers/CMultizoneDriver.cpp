@@ -288,8 +288,11 @@ void CMultizoneDriver::Preprocess(unsigned long TimeIter) {
   if ( unsteady ) {
     for (iZone = 0; iZone < nZone; iZone++) {
       for (unsigned short jZone = 0; jZone < nZone; jZone++){
-        if(jZone != iZone && interpolator_container[iZone][jZone] != NULL && prefixed_motion[iZone])
+        if(jZone != iZone && interpolator_container[iZone][jZone] != NULL && prefixed_motion[iZone]) {
           interpolator_container[iZone][jZone]->Set_TransferCoeff(config_container);
+          if (interface_container[iZone][jZone] != NULL)
+            interface_container[iZone][jZone]->SetTransferPatternOutdated();
+        }
       }
     }
   }
@@ -305,6 +308,18 @@ void CMultizoneDriver::Run_GaussSeidel() {
 
   unsigned long OuterIter = 0; for (iZone = 0; iZone < nZone; iZone++) config_container[iZone]->SetOuterIter(OuterIter);
 
+  /*--- The fixed point changes with each time step, it starts from the current solution. ---*/
+
+  InitializeQuasiNewton(false);
+
+  if (quasiNewton.active()) {
+    for (iZone = 0; iZone < nZone; iZone++)
+      for (unsigned short iSol = 0; iSol < MAX_SOLS; iSol++)
+        if ((iSol != MESH_SOL) && (solver_container[iZone][INST_0][MESH_0][iSol] != nullptr))
+          solver_container[iZone][INST_0][MESH_0][iSol]->GetNodes()->Set_BGSSolution_k();
+    QuasiNewtonBGSVector(false, true, quasiNewton.CurrentSolution());
+  }
+
   /*--- Loop over the number of outer iterations ---*/
   for (iOuter_Iter = 0; iOuter_Iter < driver_config->GetnOuter_Iter(); iOuter_Iter++){
 
@@ -343,6 +358,15 @@ void CMultizoneDriver::Run_GaussSeidel() {
 
     if (Convergence) break;
 
+    /*--- The outer iteration computed G(x_k), the next one starts from the quasi-Newton update, the primitive
+     *    variables are recomputed from it by the preprocessing of the zones. ---*/
+
+    if (quasiNewton.active()) {
+      QuasiNewtonBGSVector(false, true, quasiNewton.FPresult());
+      quasiNewton.compute();
+      QuasiNewtonBGSVector(false, false, quasiNewton.CurrentSolution());
+    }
+
   }
 
 }
@@ -350,7 +374,8 @@ void CMultizoneDriver::Run_GaussSeidel() {
 void CMultizoneDriver::Run_Jacobi() {
 
   unsigned long iOuter_Iter;
-  unsigned short jZone, UpdateMesh;
+  unsigned short jZone;
+  vector<unsigned short> UpdateMesh(nZone);
   bool DeformMesh = false;
   bool Convergence = false;
 
@@ -359,11 +384,12 @@ void CMultizoneDriver::Run_Jacobi() {
   /*--- Loop over the number of outer iterations ---*/
   for (iOuter_Iter = 0; iOuter_Iter < driver_config->GetnOuter_Iter(); iOuter_Iter++){
 
-    /*--- Transfer from all zones ---*/
+    /*--- Transfer from all zones. The donor data of all the transfers is that of the previous
+     outer iteration, hence the messages of all the interfaces are posted first and overlap. ---*/
     for (iZone = 0; iZone < nZone; iZone++){
 
       /*--- In principle, the mesh does not need to be updated ---*/
-      UpdateMesh = 0;
+      UpdateMesh[iZone] = 0;
 
       /*--- Set the OuterIter ---*/
       config_container[iZone]->SetOuterIter(iOuter_Iter);
@@ -373,12 +399,20 @@ void CMultizoneDriver::Run_Jacobi() {
       for (jZone = 0; jZone < nZone; jZone++){
         /*--- The target zone is iZone ---*/
         if (jZone != iZone && interface_container[iZone][jZone] != NULL){
-          DeformMesh = Transfer_Data(jZone, iZone);
-          if (DeformMesh) UpdateMesh+=1;
+          DeformMesh = Transfer_Data(jZone, iZone, false);
+          if (DeformMesh) UpdateMesh[iZone]+=1;
         }
       }
+    }
+
+    for (iZone = 0; iZone < nZone; iZone++){
+
+      for (jZone = 0; jZone < nZone; jZone++)
+        if (jZone != iZone && interface_container[iZone][jZone] != NULL)
+          interface_container[jZone][iZone]->CompleteTransfers();
+
       /*--- If a mesh update is required due to the transfer of data ---*/
-      if (UpdateMesh > 0) DynamicMeshUpdate(iZone, TimeIter);
+      if (UpdateMesh[iZone] > 0) DynamicMeshUpdate(iZone, TimeIter);
 
     }
 
@@ -453,6 +487,72 @@ bool CMultizoneDriver::OuterConvergence(unsigned long OuterIter) {
 
 }
 
+void CMultizoneDriver::QuasiNewtonBGSVector(bool adjoint, bool toVector, vector<passivedouble>& values) {
+
+  unsigned long i = 0;
+
+  for (auto domain : {true, false}) {
+    if (domain && adjoint) continue;
+
+    for (iZone = 0; iZone < nZone; iZone++) {
+      const auto geometry = geometry_container[iZone][INST_0][MESH_0];
+      const auto iPointBegin = (domain || adjoint)? 0ul : geometry->GetnPointDomain();
+      const auto iPointEnd = domain? geometry->GetnPointDomain() : geometry->GetnPoint();
+
+      for (unsigned short iSol = 0; iSol < MAX_SOLS; iSol++) {
+        auto solver = solver_container[iZone][INST_0][MESH_0][iSol];
+        if ((solver == nullptr) || (solver->GetAdjoint() != adjoint)) continue;
+        if ((iSol == MESH_SOL) || (iSol == ADJMESH_SOL)) continue;
+
+        auto nodes = solver->GetNodes();
+        const auto nVar = solver->GetnVar();
+
+        for (auto iPoint = iPointBegin; iPoint < iPointEnd; iPoint++) {
+          for (auto iVar = 0u; iVar < nVar; iVar++, i++) {
+            if (toVector) {
+              values[i] = SU2_TYPE::GetValue(nodes->Get_BGSSolution_k(iPoint, iVar));
+            }
+            else {
+              nodes->Set_BGSSolution_k(iPoint, iVar, values[i]);
+              if (!adjoint) nodes->SetSolution(iPoint, iVar, values[i]);
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+void CMultizoneDriver::InitializeQuasiNewton(bool adjoint) {
+
+  const auto nSamples = driver_config->GetnQuasiNewtonSamples();
+
+  if (nSamples == 0) return;
+
+  /*--- The relaxation of the structural zones would interfere with the update. ---*/
+
+  for (iZone = 0; iZone < nZone; iZone++) {
+    if (!adjoint && config_container[iZone]->GetRelaxation())
+      SU2_MPI::Error("QUASI_NEWTON_NUM_SAMPLES replaces the relaxation of the block Gauss-Seidel method (BGS_RELAXATION= NONE).",
+                     CURRENT_FUNCTION);
+  }
+
+  unsigned long nOwned = 0, nTotal = 0;
+
+  for (iZone = 0; iZone < nZone; iZone++) {
+    const auto geometry = geometry_container[iZone][INST_0][MESH_0];
+    for (unsigned short iSol = 0; iSol < MAX_SOLS; iSol++) {
+      auto solver = solver_container[iZone][INST_0][MESH_0][iSol];
+      if ((solver == nullptr) || (solver->GetAdjoint() != adjoint)) continue;
+      if ((iSol == MESH_SOL) || (iSol == ADJMESH_SOL)) continue;
+      nOwned += (adjoint? geometry->GetnPoint() : geometry->GetnPointDomain()) * solver->GetnVar();
+      nTotal += geometry->GetnPoint() * solver->GetnVar();
+    }
+  }
+
+  quasiNewton.resize(nSamples, nTotal, nOwned);
+}
+
 void CMultizoneDriver::Update() {
 
   unsigned short jZone, UpdateMesh;
@@ -568,7 +668,7 @@ void CMultizoneDriver::DynamicMeshUpdate(unsigned short val_iZone, unsigned long
 
 }
 
-bool CMultizoneDriver::Transfer_Data(unsigned short donorZone, unsigned short targetZone) {
+bool CMultizoneDriver::Transfer_Data(unsigned short donorZone, unsigned short targetZone, bool completeTransfer) {
 
   bool UpdateMesh = false;
 
@@ -587,7 +687,7 @@ bool CMultizoneDriver::Transfer_Data(unsigned short donorZone, unsigned short ta
       if (config_container[targetZone]->GetKind_Solver() == RANS ||
           config_container[targetZone]->GetKind_Solver() == INC_RANS)
       {
-        interface_container[donorZone][targetZone]->BroadcastData(
+        interface_container[donorZone][targetZone]->InitiateTransfer(
           solver_container[donorZone][INST_0][MESH_0][TURB_SOL],
           solver_container[targetZone][INST_0][MESH_0][TURB_SOL],
           geometry_container[donorZone][INST_0][MESH_0],
@@ -660,7 +760,7 @@ bool CMultizoneDriver::Transfer_Data(unsigned short donorZone, unsigned short ta
   }
 
   if(donorSolver >= 0 && targetSolver >= 0) {
-    interface_container[donorZone][targetZone]->BroadcastData(
+    interface_container[donorZone][targetZone]->InitiateTransfer(
       solver_container[donorZone][INST_0][MESH_0][donorSolver],
       solver_container[targetZone][INST_0][MESH_0][targetSolver],
       geometry_container[donorZone][INST_0][MESH_0],
@@ -669,6 +769,8 @@ bool CMultizoneDriver::Transfer_Data(unsigned short donorZone, unsigned short ta
       config_container[targetZone]);
   }
 
+  if (completeTransfer) interface_container[donorZone][targetZone]->CompleteTransfers();
+
   return UpdateMesh;
 }
 
@@ -154,6 +154,23 @@ void CPengRobinson::SetTDState_rhoe (su2double rho, su2double e ) {
 
 }
 
+void CPengRobinson::SetTDState_rhoe (CFluidBatch& batch) {
+
+  for (size_t k = 0; k < CFluidBatch::SIZE; ++k) {
+
+    CPengRobinson::SetTDState_rhoe(batch.Density[k], batch.StaticEnergy[k]);
+
+    batch.Pressure[k] = Pressure;
+    batch.Temperature[k] = Temperature;
+    batch.SoundSpeed2[k] = SoundSpeed2;
+    batch.Cp[k] = Cp;
+    batch.dPdrho_e[k] = dPdrho_e;
+    batch.dPde_rho[k] = dPde_rho;
+    batch.dTdrho_e[k] = dTdrho_e;
+    batch.dTde_rho[k] = dTde_rho;
+  }
+}
+
 void CPengRobinson::SetTDState_PT (su2double P, su2double T ) {
   su2double toll= 1e-6;
   su2double A, B, Z, DZ=1.0, F, F1, atanh;
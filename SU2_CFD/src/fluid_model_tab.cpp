@@ -0,0 +1,422 @@
+/*!
+ * \file fluid_model_tab.cpp
+ * \brief Source of the tabulated (look-up table) fluid model.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "./../include/fluid_model.hpp"
+
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace {
+/*--- Weights of the 4 nodes of a Catmull-Rom (cubic Hermite) interpolation at local coordinate t. ---*/
+inline void CatmullRomWeights(su2double t, su2double* w) {
+  const su2double t2 = t*t, t3 = t2*t;
+  w[0] = 0.5*(-t + 2.0*t2 - t3);
+  w[1] = 0.5*(2.0 - 5.0*t2 + 3.0*t3);
+  w[2] = 0.5*(t + 4.0*t2 - 3.0*t3);
+  w[3] = 0.5*(-t2 + t3);
+}
+
+/*--- Index of the cell that contains the local coordinate x (clamped, and 0 for NaN). ---*/
+inline long CellIndex(su2double x, unsigned long nNode) {
+  const passivedouble xp = SU2_TYPE::GetValue(x);
+  const long last = long(nNode)-2;
+  if (!(xp > 0.0)) return 0;
+  return (xp < last)? long(xp) : last;
+}
+}
+
+void CFluidTable::Allocate(unsigned long nRho, unsigned long nE, su2double rhoMin, su2double rhoMax,
+                           su2double eMin, su2double eMax) {
+  nDensity = nRho;
+  nEnergy = nE;
+  LogDensityMin = log(rhoMin);
+  DeltaLogDensity = (log(rhoMax) - LogDensityMin) / (nRho-1);
+  EnergyMin = eMin;
+  DeltaEnergy = (eMax - eMin) / (nE-1);
+  Data.assign(nRho*nE*NQUANT, 0.0);
+}
+
+void CFluidTable::GetScaleFactors(const su2double* refValues, su2double* factors) {
+
+  const su2double rhoRef = refValues[0], pRef = refValues[1], TRef = refValues[2];
+  const su2double eRef = pRef/rhoRef;
+
+  factors[PRESSURE] = pRef;
+  factors[TEMPERATURE] = TRef;
+  factors[SOUNDSPEED2] = eRef;
+  factors[DPDRHO_E] = eRef;
+  factors[DPDE_RHO] = rhoRef;
+  factors[DTDRHO_E] = TRef/rhoRef;
+  factors[DTDE_RHO] = TRef/eRef;
+  factors[ENTROPY] = eRef/TRef;
+  factors[NQUANT] = rhoRef;
+  factors[NQUANT+1] = eRef;
+}
+
+CFluidTable::CFluidTable(CFluidModel& model, unsigned long nRho, unsigned long nE,
+                         const su2double* densityRange, const su2double* energyRange) {
+
+  Allocate(nRho, nE, densityRange[0], densityRange[1], energyRange[0], energyRange[1]);
+
+  for (auto iRho = 0ul; iRho < nDensity; ++iRho) {
+    const su2double rho = exp(LogDensityMin + iRho*DeltaLogDensity);
+
+    for (auto iE = 0ul; iE < nEnergy; ++iE) {
+      model.SetTDState_rhoe(rho, EnergyMin + iE*DeltaEnergy);
+
+      su2double* node = &Data[(iRho*nEnergy + iE)*NQUANT];
+      node[PRESSURE] = model.GetPressure();
+      node[TEMPERATURE] = model.GetTemperature();
+      node[SOUNDSPEED2] = model.GetSoundSpeed2();
+      node[DPDRHO_E] = model.GetdPdrho_e();
+      node[DPDE_RHO] = model.GetdPde_rho();
+      node[DTDE_RHO] = model.GetdTde_rho();
+      node[ENTROPY] = model.GetEntropy();
+
+      for (auto iQuant = 0u; iQuant < NQUANT; ++iQuant) {
+        if (iQuant == DTDRHO_E) continue;
+        if (!std::isfinite(SU2_TYPE::GetValue(node[iQuant])))
+          SU2_MPI::Error("The range of the fluid table includes non-physical states of the base model,\n"
+                         "reduce TABULATED_GAS_DENSITY_RANGE or TABULATED_GAS_ENERGY_RANGE.", CURRENT_FUNCTION);
+      }
+    }
+  }
+
+  /*--- Derivative of the temperature w.r.t. density at constant energy, by finite differences
+   *    in log(density) (centered in the interior, one-sided at the bounds). ---*/
+
+  for (auto iRho = 0ul; iRho < nDensity; ++iRho) {
+    const auto iLo = (iRho > 0)? iRho-1 : iRho;
+    const auto iHi = (iRho+1 < nDensity)? iRho+1 : iRho;
+    const su2double rho = exp(LogDensityMin + iRho*DeltaLogDensity);
+    const su2double dLogRho = (iHi - iLo)*DeltaLogDensity;
+
+    for (auto iE = 0ul; iE < nEnergy; ++iE) {
+      const su2double dT = Data[(iHi*nEnergy + iE)*NQUANT + TEMPERATURE] -
+                           Data[(iLo*nEnergy + iE)*NQUANT + TEMPERATURE];
+      Data[(iRho*nEnergy + iE)*NQUANT + DTDRHO_E] = dT / (dLogRho*rho);
+    }
+  }
+}
+
+CFluidTable::CFluidTable(const string& fileName, const su2double* refValues) {
+
+  /*--- The master reads the (dimensional) header and nodes, which are then broadcast. ---*/
+
+  unsigned long size[2] = {0, 0};
+  passivedouble ranges[4] = {0.0};
+  vector<passivedouble> buffer;
+
+  if (SU2_MPI::GetRank() == MASTER_NODE) {
+
+    ifstream file(fileName);
+    if (file.fail())
+      SU2_MPI::Error(string("Unable to open the fluid table file ") + fileName, CURRENT_FUNCTION);
+
+    /*--- Skip the comment lines, then read the header. ---*/
+
+    string line;
+    while (getline(file, line) && (line.empty() || line[0] == '%')) {}
+
+    istringstream header(line);
+    header >> size[0] >> size[1] >> ranges[0] >> ranges[1] >> ranges[2] >> ranges[3];
+    if (header.fail() || size[0] < 4 || size[1] < 4)
+      SU2_MPI::Error(string("Invalid header in the fluid table file ") + fileName, CURRENT_FUNCTION);
+
+    buffer.resize(size[0]*size[1]*NQUANT);
+    for (auto& value : buffer) file >> value;
+    if (file.fail())
+      SU2_MPI::Error(string("The fluid table file ") + fileName + string(" is incomplete."), CURRENT_FUNCTION);
+  }
+
+  SU2_MPI::Bcast(size, 2, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Bcast(ranges, 4, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+  buffer.resize(size[0]*size[1]*NQUANT);
+  SU2_MPI::Bcast(buffer.data(), buffer.size(), MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+
+  /*--- Non-dimensionalize. ---*/
+
+  su2double factors[NQUANT+2];
+  GetScaleFactors(refValues, factors);
+
+  Allocate(size[0], size[1], ranges[0]/factors[NQUANT], ranges[1]/factors[NQUANT],
+           ranges[2]/factors[NQUANT+1], ranges[3]/factors[NQUANT+1]);
+
+  for (auto iData = 0ul; iData < Data.size(); ++iData)
+    Data[iData] = buffer[iData] / factors[iData%NQUANT];
+}
+
+void CFluidTable::Write(const string& fileName, const su2double* refValues) const {
+
+  su2double factors[NQUANT+2];
+  GetScaleFactors(refValues, factors);
+
+  ofstream file(fileName);
+  if (file.fail())
+    SU2_MPI::Error(string("Unable to write the fluid table file ") + fileName, CURRENT_FUNCTION);
+
+  file << "% SU2 fluid table, dimensional.\n";
+  file << "% Header: number of density and energy levels, density range, energy range (density is log-spaced).\n";
+  file << "% Nodes (energy index fastest): P, T, c^2, dP/drho_e, dP/de_rho, dT/drho_e, dT/de_rho, s.\n";
+
+  file << setprecision(17);
+  file << nDensity << " " << nEnergy << " "
+       << SU2_TYPE::GetValue(exp(LogDensityMin)*factors[NQUANT]) << " "
+       << SU2_TYPE::GetValue(exp(LogDensityMin + (nDensity-1)*DeltaLogDensity)*factors[NQUANT]) << " "
+       << SU2_TYPE::GetValue(EnergyMin*factors[NQUANT+1]) << " "
+       << SU2_TYPE::GetValue((EnergyMin + (nEnergy-1)*DeltaEnergy)*factors[NQUANT+1]) << "\n";
+
+  for (auto iNode = 0ul; iNode < nDensity*nEnergy; ++iNode) {
+    for (auto iQuant = 0u; iQuant < NQUANT; ++iQuant)
+      file << SU2_TYPE::GetValue(Data[iNode*NQUANT + iQuant]*factors[iQuant]) << ((iQuant+1 < NQUANT)? " " : "\n");
+  }
+}
+
+void CFluidTable::Interpolate(su2double rho, su2double e, su2double* values) const {
+
+  /*--- Local coordinates, the boundary cells are used outside of the table. ---*/
+
+  const su2double x = (log(rho) - LogDensityMin) / DeltaLogDensity;
+  const su2double y = (e - EnergyMin) / DeltaEnergy;
+
+  const long i = CellIndex(x, nDensity);
+  const long j = CellIndex(y, nEnergy);
+
+  su2double wx[4], wy[4];
+  CatmullRomWeights(x-i, wx);
+  CatmullRomWeights(y-j, wy);
+
+  for (auto iQuant = 0u; iQuant < NQUANT; ++iQuant) values[iQuant] = 0.0;
+
+  /*--- 4x4 stencil, the nodes beyond the bounds are replaced by the boundary nodes. ---*/
+
+  const long lastRho = long(nDensity)-1, lastE = long(nEnergy)-1;
+
+  for (long a = 0; a < 4; ++a) {
+    const long iNode = min(max(i-1+a, 0l), lastRho);
+
+    for (long b = 0; b < 4; ++b) {
+      const long jNode = min(max(j-1+b, 0l), lastE);
+      const su2double w = wx[a]*wy[b];
+      const su2double* node = &Data[(iNode*nEnergy + jNode)*NQUANT];
+
+      for (auto iQuant = 0u; iQuant < NQUANT; ++iQuant) values[iQuant] += w*node[iQuant];
+    }
+  }
+}
+
+CTabulatedGas::CTabulatedGas(shared_ptr<const CFluidTable> table, CFluidModel* baseModel) :
+  CFluidModel(), Table(table), BaseModel(baseModel) {
+  Cp = BaseModel->GetCp();
+  Cv = BaseModel->GetCv();
+}
+
+CFluidModel* CTabulatedGas::CreateBaseModel(const CConfig* config, bool nonDimensional) {
+
+  const su2double gamma = config->GetGamma();
+  const su2double R = nonDimensional? config->GetGas_ConstantND() : config->GetGas_Constant();
+  const su2double Pc = config->GetPressure_Critical() / (nonDimensional? config->GetPressure_Ref() : 1.0);
+  const su2double Tc = config->GetTemperature_Critical() / (nonDimensional? config->GetTemperature_Ref() : 1.0);
+
+  switch (config->GetKind_TabulatedFluidModel()) {
+    case STANDARD_AIR: return new CIdealGas(1.4, R);
+    case IDEAL_GAS: return new CIdealGas(gamma, R);
+    case VW_GAS: return new CVanDerWaalsGas(gamma, R, Pc, Tc);
+    case PR_GAS: return new CPengRobinson(gamma, R, Pc, Tc, config->GetAcentric_Factor());
+    default:
+      SU2_MPI::Error("Unknown base model for the tabulated fluid model.", CURRENT_FUNCTION);
+      return nullptr;
+  }
+}
+
+shared_ptr<const CFluidTable> CTabulatedGas::CreateTable(const CConfig* config, su2double densityFreeStream,
+                                                         su2double temperatureFreeStream, bool writeFile) {
+
+  const su2double refValues[] = {config->GetDensity_Ref(), config->GetPressure_Ref(), config->GetTemperature_Ref()};
+  const string fileName = config->GetTabulatedGas_FileName();
+
+  /*--- An existing file takes precedence over the generation. ---*/
+
+  if (!fileName.empty()) {
+    int exists = 0;
+    if (SU2_MPI::GetRank() == MASTER_NODE) exists = ifstream(fileName).good();
+    SU2_MPI::Bcast(&exists, 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+
+    if (exists) return make_shared<CFluidTable>(fileName, refValues);
+  }
+
+  unique_ptr<CFluidModel> baseModel(CreateBaseModel(config, true));
+
+  /*--- Non-dimensional ranges, default ones are based on the free-stream. ---*/
+
+  const su2double rhoRef = refValues[0], eRef = refValues[1]/refValues[0];
+  su2double densityRange[2], energyRange[2];
+
+  for (int iBound = 0; iBound < 2; ++iBound) {
+    densityRange[iBound] = config->GetTabulatedGas_DensityRange()[iBound] / rhoRef;
+    energyRange[iBound] = config->GetTabulatedGas_EnergyRange()[iBound] / eRef;
+  }
+
+  if (densityRange[1] == 0.0) {
+    densityRange[0] = 0.02*densityFreeStream;
+    densityRange[1] = 5.0*densityFreeStream;
+  }
+
+  if (energyRange[0] == energyRange[1]) {
+    su2double e[4];
+    for (int iBound = 0; iBound < 2; ++iBound) {
+      baseModel->SetTDState_rhoT(densityRange[iBound], 0.5*temperatureFreeStream);
+      e[iBound] = baseModel->GetStaticEnergy();
+      baseModel->SetTDState_rhoT(densityRange[iBound], 2.0*temperatureFreeStream);
+      e[iBound+2] = baseModel->GetStaticEnergy();
+    }
+    energyRange[0] = min(e[0], e[1]);
+    energyRange[1] = max(e[2], e[3]);
+  }
+
+  auto table = make_shared<CFluidTable>(*baseModel, config->GetTabulatedGas_Size(0),
+                                        config->GetTabulatedGas_Size(1), densityRange, energyRange);
+
+  if (writeFile && !fileName.empty() && (SU2_MPI::GetRank() == MASTER_NODE)) {
+    cout << "Writing the fluid table to " << fileName << "." << endl;
+    table->Write(fileName, refValues);
+  }
+
+  return table;
+}
+
+void CTabulatedGas::SetTDState_rhoe (su2double rho, su2double e ) {
+
+  su2double values[CFluidTable::NQUANT];
+  Table->Interpolate(rho, e, values);
+
+  Density = rho;
+  StaticEnergy = e;
+  Pressure = values[CFluidTable::PRESSURE];
+  Temperature = values[CFluidTable::TEMPERATURE];
+  SoundSpeed2 = values[CFluidTable::SOUNDSPEED2];
+  dPdrho_e = values[CFluidTable::DPDRHO_E];
+  dPde_rho = values[CFluidTable::DPDE_RHO];
+  dTdrho_e = values[CFluidTable::DTDRHO_E];
+  dTde_rho = values[CFluidTable::DTDE_RHO];
+  Entropy = values[CFluidTable::ENTROPY];
+}
+
+void CTabulatedGas::SolveInverse(INPUT_PAIR pair, su2double th1, su2double th2, su2double rho, su2double e) {
+
+  const unsigned short ITMAX = 50;
+  const su2double toll = 1e-10;
+
+  for (unsigned short iter = 0; iter < ITMAX; ++iter) {
+
+    SetTDState_rhoe(rho, e);
+
+    /*--- Residuals and Jacobian w.r.t. (rho, e), the entropy and enthalpy derivatives
+     *    follow from T ds = de - P/rho^2 drho and h = e + P/rho. ---*/
+
+    const su2double dsdrho = -Pressure/(rho*rho*Temperature), dsde = 1.0/Temperature;
+    su2double r1 = 0.0, r2 = 0.0, J11 = 1.0, J12 = 0.0, J21 = 0.0, J22 = 1.0;
+
+    switch (pair) {
+      case PRHO_INPUT:
+        r2 = Pressure - th1; J21 = dPdrho_e; J22 = dPde_rho;
+        break;
+      case RHOT_INPUT:
+        r2 = Temperature - th2; J21 = dTdrho_e; J22 = dTde_rho;
+        break;
+      case PT_INPUT:
+        r1 = Pressure - th1; J11 = dPdrho_e; J12 = dPde_rho;
+        r2 = Temperature - th2; J21 = dTdrho_e; J22 = dTde_rho;
+        break;
+      case PS_INPUT:
+        r1 = Pressure - th1; J11 = dPdrho_e; J12 = dPde_rho;
+        r2 = Entropy - th2; J21 = dsdrho; J22 = dsde;
+        break;
+      case HS_INPUT:
+        r1 = e + Pressure/rho - th1; J11 = dPdrho_e/rho - Pressure/(rho*rho); J12 = 1.0 + dPde_rho/rho;
+        r2 = Entropy - th2; J21 = dsdrho; J22 = dsde;
+        break;
+    }
+
+    const su2double det = J11*J22 - J12*J21;
+    const su2double drho = (r1*J22 - r2*J12) / det;
+    const su2double de = (J11*r2 - J21*r1) / det;
+
+    /*--- Keep the density positive. ---*/
+
+    rho = (drho < rho)? rho - drho : 0.5*rho;
+    e -= de;
+
+    if (fabs(drho) <= toll*rho && fabs(de) <= toll*(fabs(e) + fabs(Pressure/rho))) break;
+  }
+
+  SetTDState_rhoe(rho, e);
+}
+
+void CTabulatedGas::SetTDState_PT (su2double P, su2double T ) {
+  BaseModel->SetTDState_PT(P, T);
+  SolveInverse(PT_INPUT, P, T, BaseModel->GetDensity(), BaseModel->GetStaticEnergy());
+}
+
+void CTabulatedGas::SetTDState_Prho (su2double P, su2double rho ) {
+  BaseModel->SetTDState_Prho(P, rho);
+  SolveInverse(PRHO_INPUT, P, 0.0, rho, BaseModel->GetStaticEnergy());
+}
+
+void CTabulatedGas::SetEnergy_Prho (su2double P, su2double rho ) {
+  SetTDState_Prho(P, rho);
+}
+
+void CTabulatedGas::SetTDState_hs (su2double h, su2double s ) {
+  BaseModel->SetTDState_hs(h, s);
+  SolveInverse(HS_INPUT, h, s, BaseModel->GetDensity(), BaseModel->GetStaticEnergy());
+}
+
+void CTabulatedGas::SetTDState_rhoT (su2double rho, su2double T ) {
+  BaseModel->SetTDState_rhoT(rho, T);
+  SolveInverse(RHOT_INPUT, 0.0, T, rho, BaseModel->GetStaticEnergy());
+}
+
+void CTabulatedGas::SetTDState_Ps (su2double P, su2double s ) {
+  BaseModel->SetTDState_Ps(P, s);
+  SolveInverse(PS_INPUT, P, s, BaseModel->GetDensity(), BaseModel->GetStaticEnergy());
+}
+
+void CTabulatedGas::ComputeDerivativeNRBC_Prho (su2double P, su2double rho ) {
+
+  SetTDState_Prho(P, rho);
+
+  /*--- From de = dP/dPde_rho - dPdrho_e/dPde_rho drho, h = e + P/rho, and T ds = de - P/rho^2 drho. ---*/
+
+  const su2double dedrho_P = -dPdrho_e/dPde_rho, dedP_rho = 1.0/dPde_rho;
+
+  dhdrho_P = dedrho_P - P/(rho*rho);
+  dhdP_rho = dedP_rho + 1.0/rho;
+  dsdrho_P = (dedrho_P - P/(rho*rho))/Temperature;
+  dsdP_rho = dedP_rho/Temperature;
+}
@@ -0,0 +1,184 @@
+/*!
+ * \file CCoupledTurbIntegration.cpp
+ * \brief Implicit iteration of the mean flow and turbulence equations as one block system.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/integration/CCoupledTurbIntegration.hpp"
+#include "../../../Common/include/omp_structure.hpp"
+
+CCoupledTurbIntegration::CCoupledTurbIntegration() : CMultiGridIntegration() { }
+
+void CCoupledTurbIntegration::MultiGrid_Iteration(CGeometry ****geometry_, CSolver *****solver_container,
+                                                  CNumerics ******numerics_container, CConfig **config,
+                                                  unsigned short RunTime_EqSystem, unsigned short iZone,
+                                                  unsigned short iInst) {
+
+  geometry = geometry_[iZone][iInst][MESH_0];
+  solvers = solver_container[iZone][iInst][MESH_0];
+  turbNumerics = numerics_container[iZone][iInst][MESH_0][TURB_SOL];
+
+  /*--- Allocate the coupled system the first time. ---*/
+
+  if (LinSysRes.GetLocSize() == 0) {
+    const auto nPoint = geometry->GetnPoint();
+    const auto nPointDomain = geometry->GetnPointDomain();
+    const auto nVar = solvers[FLOW_SOL]->GetnVar() + solvers[TURB_SOL]->GetnVar();
+
+    if (rank == MASTER_NODE)
+      cout << "Initialize Jacobian structure (coupled flow and turbulence, " << nVar << " variables)." << endl;
+
+    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config[iZone]);
+    LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
+    LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
+  }
+
+  CMultiGridIntegration::MultiGrid_Iteration(geometry_, solver_container, numerics_container, config,
+                                             RunTime_EqSystem, iZone, iInst);
+}
+
+void CCoupledTurbIntegration::Time_Integration(CGeometry *geometry_, CSolver **solver_container, CConfig *config,
+                                               unsigned short iRKStep, unsigned short RunTime_EqSystem) {
+
+  if ((RunTime_EqSystem != RUNTIME_FLOW_SYS) || (geometry_ != geometry)) {
+    CIntegration::Time_Integration(geometry_, solver_container, config, iRKStep, RunTime_EqSystem);
+    return;
+  }
+
+  CoupledIteration(config);
+}
+
+void CCoupledTurbIntegration::ComputeTurbulenceSystem(CConfig *config) {
+
+  CSolver* turbSolver = solvers[TURB_SOL];
+
+  /*--- The numerical schemes are selected by the global parameters of the system. ---*/
+
+  SU2_OMP_MASTER
+  config->SetGlobalParam(RANS, RUNTIME_TURB_SYS);
+  SU2_OMP_BARRIER
+
+  /*--- Same steps as the single grid iteration of the turbulence solver, at the state of the
+   *    flow residual (the flow primitives and gradients are already up to date). ---*/
+
+  turbSolver->Preprocessing(geometry, solvers, config, MESH_0, NO_RK_ITER, RUNTIME_TURB_SYS, false);
+
+  turbSolver->Set_OldSolution(geometry);
+
+  Space_Integration(geometry, solvers, turbNumerics, config, MESH_0, NO_RK_ITER, RUNTIME_TURB_SYS);
+
+  turbSolver->PrepareImplicitIteration(geometry, solvers, config);
+
+  SU2_OMP_MASTER
+  config->SetGlobalParam(RANS, RUNTIME_FLOW_SYS);
+  SU2_OMP_BARRIER
+}
+
+void CCoupledTurbIntegration::CoupledIteration(CConfig *config) {
+
+  CSolver* flowSolver = solvers[FLOW_SOL];
+  CSolver* turbSolver = solvers[TURB_SOL];
+
+  const auto nPoint = geometry->GetnPoint();
+  const auto nVarFlow = flowSolver->GetnVar();
+  const auto nVarTurb = turbSolver->GetnVar();
+  const auto nVar = nVarFlow + nVarTurb;
+
+  /*--- Pseudo time terms and right hand sides of both systems. ---*/
+
+  flowSolver->PrepareImplicitIteration(geometry, solvers, config);
+
+  ComputeTurbulenceSystem(config);
+
+  /*--- Copy the systems, the flow variables come first in each block. Each thread writes
+   *    the rows it owns, the blocks of the matrix without storage (diagonal only) are skipped. ---*/
+
+  SU2_OMP_FOR_DYN(roundUpDiv(nPoint, 2*omp_get_num_threads()))
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+
+    const auto nNeigh = geometry->node[iPoint]->GetnPoint();
+
+    for (auto iNeigh = 0u; iNeigh <= nNeigh; iNeigh++) {
+
+      const auto jPoint = (iNeigh < nNeigh)? geometry->node[iPoint]->GetPoint(iNeigh) : iPoint;
+
+      Scalar* block = Jacobian.GetBlock(iPoint, jPoint);
+      if (block == nullptr) continue;
+
+      const Scalar* flowBlock = flowSolver->Jacobian.GetBlock(iPoint, jPoint);
+      const Scalar* turbBlock = turbSolver->Jacobian.GetBlock(iPoint, jPoint);
+
+      for (auto k = 0ul; k < nVar*nVar; k++) block[k] = 0.0;
+
+      for (auto iVar = 0u; iVar < nVarFlow; iVar++)
+        for (auto jVar = 0u; jVar < nVarFlow; jVar++)
+          block[iVar*nVar+jVar] = flowBlock[iVar*nVarFlow+jVar];
+
+      for (auto iVar = 0u; iVar < nVarTurb; iVar++)
+        for (auto jVar = 0u; jVar < nVarTurb; jVar++)
+          block[(nVarFlow+iVar)*nVar+nVarFlow+jVar] = turbBlock[iVar*nVarTurb+jVar];
+    }
+
+    for (auto iVar = 0u; iVar < nVarFlow; iVar++) {
+      LinSysRes(iPoint,iVar) = flowSolver->LinSysRes(iPoint,iVar);
+      LinSysSol(iPoint,iVar) = 0.0;
+    }
+    for (auto iVar = 0u; iVar < nVarTurb; iVar++) {
+      LinSysRes(iPoint,nVarFlow+iVar) = turbSolver->LinSysRes(iPoint,iVar);
+      LinSysSol(iPoint,nVarFlow+iVar) = 0.0;
+    }
+  }
+
+  /*--- Solve the coupled system, with the linear solver settings of the flow. ---*/
+
+  auto iter = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
+  SU2_OMP_MASTER
+  {
+    flowSolver->SetIterLinSolver(iter);
+    flowSolver->SetResLinSolver(System.GetResidual());
+    turbSolver->SetIterLinSolver(iter);
+    turbSolver->SetResLinSolver(System.GetResidual());
+  }
+  SU2_OMP_BARRIER
+
+  /*--- Split the increments and update both solutions (under-relaxation, clipping, and
+   *    communication are those of each solver). ---*/
+
+  SU2_OMP_FOR_STAT(roundUpDiv(nPoint, omp_get_num_threads()))
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+    for (auto iVar = 0u; iVar < nVarFlow; iVar++)
+      flowSolver->LinSysSol(iPoint,iVar) = LinSysSol(iPoint,iVar);
+    for (auto iVar = 0u; iVar < nVarTurb; iVar++)
+      turbSolver->LinSysSol(iPoint,iVar) = LinSysSol(iPoint,nVarFlow+iVar);
+  }
+
+  flowSolver->CompleteImplicitIteration(geometry, solvers, config);
+
+  turbSolver->CompleteImplicitIteration(geometry, solvers, config);
+
+  /*--- Eddy viscosity of the new turbulence state, the flow primitives are updated by the
+   *    next preprocessing (with the eddy viscosity lagged by one iteration). ---*/
+
+  turbSolver->Postprocessing(geometry, solvers, config, MESH_0);
+}
@@ -120,9 +120,16 @@ void CFEM_DG_Integration::SingleGrid_Iteration(CGeometry ****geometry,
                           numerics_container[iZone][iInst][iMesh][SolContainer_Position],
                           config[iZone], iMesh, iStep, RunTime_EqSystem);
 
-        /*--- Time integration, update solution using the old solution plus the solution increment ---*/
-        Time_Integration(geometry[iZone][iInst][iMesh], solver_container[iZone][iInst][iMesh],
-                         config[iZone], iStep, RunTime_EqSystem);
+        /*--- Time integration, update solution using the old solution plus the solution increment.
+              The implicit scheme evaluates residuals in the Newton-Krylov solver, hence it
+              needs the numerics and is called directly. ---*/
+        if (config[iZone]->GetKind_TimeIntScheme() == EULER_IMPLICIT)
+          solver_container[iZone][iInst][iMesh][SolContainer_Position]->ImplicitNewtonKrylov_Iteration(geometry[iZone][iInst][iMesh], solver_container[iZone][iInst][iMesh],
+                                                                                                       numerics_container[iZone][iInst][iMesh][SolContainer_Position],
+                                                                                                       config[iZone], iMesh);
+        else
+          Time_Integration(geometry[iZone][iInst][iMesh], solver_container[iZone][iInst][iMesh],
+                           config[iZone], iStep, RunTime_EqSystem);
 
         /*--- Postprocessing ---*/
         solver_container[iZone][iInst][iMesh][SolContainer_Position]->Postprocessing(geometry[iZone][iInst][iMesh], solver_container[iZone][iInst][iMesh],
@@ -141,6 +148,154 @@ void CFEM_DG_Integration::SingleGrid_Iteration(CGeometry ****geometry,
   //Convergence_Monitoring(geometry[iZone][iInst][FinestMesh], config[iZone], Iteration, monitor, FinestMesh);
 }
 
+void CFEM_DG_Integration::MultiGrid_Iteration(CGeometry ****geometry,
+                                              CSolver *****solver_container,
+                                              CNumerics ******numerics_container,
+                                              CConfig **config,
+                                              unsigned short RunTime_EqSystem,
+                                              unsigned short iZone,
+                                              unsigned short iInst) {
+
+  /*--- Without coarse levels the single grid iteration is carried out. ---*/
+  if (config[iZone]->GetnMGLevels() == 0) {
+    SingleGrid_Iteration(geometry, solver_container, numerics_container, config,
+                         RunTime_EqSystem, iZone, iInst);
+    return;
+  }
+
+  unsigned short SolContainer_Position = config[iZone]->GetContainerPosition(RunTime_EqSystem);
+
+  /*--- Perform the Full Approximation Scheme p-multigrid cycle. ---*/
+  MultiGrid_Cycle(geometry, solver_container, numerics_container, config,
+                  MESH_0, config[iZone]->GetMGCycle(), RunTime_EqSystem, iZone, iInst);
+
+  /*--- Calculate the inviscid and viscous forces ---*/
+  solver_container[iZone][iInst][MESH_0][SolContainer_Position]->Pressure_Forces(geometry[iZone][iInst][MESH_0], config[iZone]);
+
+  solver_container[iZone][iInst][MESH_0][SolContainer_Position]->Friction_Forces(geometry[iZone][iInst][MESH_0], config[iZone]);
+}
+
+void CFEM_DG_Integration::MultiGrid_Cycle(CGeometry ****geometry,
+                                          CSolver *****solver_container,
+                                          CNumerics ******numerics_container,
+                                          CConfig **config_container,
+                                          unsigned short iMesh,
+                                          unsigned short RecursiveParam,
+                                          unsigned short RunTime_EqSystem,
+                                          unsigned short iZone,
+                                          unsigned short iInst) {
+
+  CConfig* config = config_container[iZone];
+
+  const unsigned short Solver_Position = config->GetContainerPosition(RunTime_EqSystem);
+
+  /*--- Shorter names to refer to fine level entities. ---*/
+
+  CGeometry* geometry_fine = geometry[iZone][iInst][iMesh];
+  CSolver** solver_container_fine = solver_container[iZone][iInst][iMesh];
+  CSolver* solver_fine = solver_container_fine[Solver_Position];
+  CNumerics** numerics_fine = numerics_container[iZone][iInst][iMesh][Solver_Position];
+
+  /*--- Do a presmoothing on the level iMesh to be restricted to the level iMesh+1 ---*/
+
+  Smoothing_Iterations(geometry_fine, solver_container_fine, numerics_fine, config, iMesh,
+                       config->GetMG_PreSmooth(iMesh), RunTime_EqSystem);
+
+  /*--- Compute Forcing Term $P_(k+1) = I^(k+1)_k(P_k+F_k(u_k))-F_(k+1)(I^(k+1)_k u_k)$ and update solution for multigrid ---*/
+
+  if ( iMesh < config->GetnMGLevels() ) {
+
+    /*--- Shorter names to refer to coarse level entities. ---*/
+
+    CGeometry* geometry_coarse = geometry[iZone][iInst][iMesh+1];
+    CSolver** solver_container_coarse = solver_container[iZone][iInst][iMesh+1];
+    CSolver* solver_coarse = solver_container_coarse[Solver_Position];
+    CNumerics** numerics_coarse = numerics_container[iZone][iInst][iMesh+1][Solver_Position];
+
+    /*--- Compute $r_k = P_k + F_k(u_k)$, which the solver stores before the
+          multiplication with the inverse mass matrix. ---*/
+
+    solver_fine->Preprocessing(geometry_fine, solver_container_fine, config, iMesh, 0, RunTime_EqSystem, false);
+
+    Space_Integration(geometry_fine, solver_container_fine, numerics_fine, config, iMesh, 0, RunTime_EqSystem);
+
+    /*--- Compute $r_(k+1) = F_(k+1)(I^(k+1)_k u_k)$ ---*/
+
+    solver_coarse->SetRestricted_Solution_FEM(solver_fine, config);
+
+    solver_coarse->Preprocessing(geometry_coarse, solver_container_coarse, config, iMesh+1, 0, RunTime_EqSystem, false);
+
+    Space_Integration(geometry_coarse, solver_container_coarse, numerics_coarse, config, iMesh+1, 0, RunTime_EqSystem);
+
+    /*--- Compute $P_(k+1) = I^(k+1)_k(r_k) - r_(k+1) ---*/
+
+    solver_coarse->SetForcing_Term_FEM(solver_fine, config);
+
+    /*--- Recursive call to MultiGrid_Cycle (this routine), once for V cycles, twice for W
+     *    cycles (W cycles on the coarse level), and twice for F cycles (an F and then a V). ---*/
+
+    const unsigned short nRecursions = (RecursiveParam == F_CYCLE)? 2 : RecursiveParam+1;
+
+    for (unsigned short imu = 0; imu < nRecursions; imu++) {
+
+      unsigned short nextRecurseParam = RecursiveParam;
+      if ((RecursiveParam == F_CYCLE) && (imu > 0))
+        nextRecurseParam = V_CYCLE;
+      if (iMesh == config->GetnMGLevels()-2)
+        nextRecurseParam = 0;
+
+      MultiGrid_Cycle(geometry, solver_container, numerics_container, config_container,
+                      iMesh+1, nextRecurseParam, RunTime_EqSystem, iZone, iInst);
+    }
+
+    /*--- Add the prolongated correction $u^(new)_k = u_k + I^k_(k+1)(u_(k+1)-I^(k+1)_k u_k)$ ---*/
+
+    solver_coarse->SetProlongated_Correction_FEM(solver_fine, config);
+
+    /*--- Solution post-smoothing on the prolongated level. ---*/
+
+    Smoothing_Iterations(geometry_fine, solver_container_fine, numerics_fine, config, iMesh,
+                         config->GetMG_PostSmooth(iMesh), RunTime_EqSystem);
+  }
+}
+
+void CFEM_DG_Integration::Smoothing_Iterations(CGeometry *geometry,
+                                               CSolver **solver_container,
+                                               CNumerics **numerics,
+                                               CConfig *config,
+                                               unsigned short iMesh,
+                                               unsigned short nIter,
+                                               unsigned short RunTime_EqSystem) {
+
+  unsigned short SolContainer_Position = config->GetContainerPosition(RunTime_EqSystem);
+  CSolver *solver = solver_container[SolContainer_Position];
+
+  /*--- Number of RK steps. ---*/
+  unsigned short iLimit = 1;
+  switch (config->GetKind_TimeIntScheme()) {
+    case RUNGE_KUTTA_EXPLICIT: iLimit = config->GetnRKStep(); break;
+    case CLASSICAL_RK4_EXPLICIT: iLimit = 4; break;
+    default: iLimit = 1; break; }
+
+  for (unsigned short iIter = 0; iIter < nIter; iIter++) {
+
+    /* Compute the time step for stability. */
+    solver->SetTime_Step(geometry, solver_container, config, iMesh, config->GetTimeIter());
+
+    /*--- Time and space integration ---*/
+    for (unsigned short iStep = 0; iStep < iLimit; iStep++) {
+
+      solver->Preprocessing(geometry, solver_container, config, iMesh, iStep, RunTime_EqSystem, false);
+
+      Space_Integration(geometry, solver_container, numerics, config, iMesh, iStep, RunTime_EqSystem);
+
+      Time_Integration(geometry, solver_container, config, iStep, RunTime_EqSystem);
+
+      solver->Postprocessing(geometry, solver_container, config, iMesh);
+    }
+  }
+}
+
 void CFEM_DG_Integration::Space_Integration(CGeometry *geometry,
                                             CSolver **solver_container,
                                             CNumerics **numerics,
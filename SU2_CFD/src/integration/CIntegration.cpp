@@ -27,7 +27,31 @@
 
 #include "../../include/integration/CIntegration.hpp"
 #include "../../../Common/include/omp_structure.hpp"
+#include "../../../Common/include/toolboxes/CRegionProfiler.hpp"
 
+/*!
+ * \brief Estimated traffic of the edge loop of the convective fluxes (see SU2_PROFILE_REGION_BYTES), the
+ *        states (and reconstruction gradients, limiters, coordinates) of the two points, normal and nodes
+ *        of the edge, and update of the residual and (implicit) Jacobian blocks of the two points.
+ */
+static passivedouble ConvectiveResidualBytes(CGeometry *geometry, CSolver *solver, CConfig *config) {
+
+  if (config->GetKind_ConvNumScheme() == FINITE_ELEMENT) return 0.0;
+
+  const passivedouble nDim = geometry->GetnDim();
+  const passivedouble nVar = solver->GetnVar();
+  const passivedouble nPrimVar = max(solver->GetnPrimVar(), solver->GetnVar());
+  const passivedouble nPrimVarGrad = solver->GetnPrimVarGrad();
+  const bool muscl = config->GetMUSCL() && (config->GetKind_ConvNumScheme() == SPACE_UPWIND);
+  const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+
+  passivedouble bytes = 2*nPrimVar*sizeof(su2double) + nDim*sizeof(su2double) + 2*sizeof(unsigned long) +
+                        4*nVar*sizeof(su2double);
+  if (muscl) bytes += 2*(nPrimVarGrad*(nDim+1) + nDim)*sizeof(su2double);
+  if (implicit) bytes += 8*nVar*nVar*sizeof(su2mixedfloat);
+
+  return bytes * geometry->GetnEdge();
+}
 
 CIntegration::CIntegration() {
   rank = SU2_MPI::GetRank();
@@ -51,6 +75,8 @@ void CIntegration::Space_Integration(CGeometry *geometry,
 
   /*--- Compute inviscid residuals ---*/
 
+  {
+  SU2_PROFILE_REGION_BYTES("Convective residual", ConvectiveResidualBytes(geometry, solver_container[MainSolver], config));
   switch (config->GetKind_ConvNumScheme()) {
     case SPACE_CENTERED:
       solver_container[MainSolver]->Centered_Residual(geometry, solver_container, numerics, config, iMesh, iRKStep);
@@ -62,27 +88,36 @@ void CIntegration::Space_Integration(CGeometry *geometry,
       solver_container[MainSolver]->Convective_Residual(geometry, solver_container, numerics[CONV_TERM], config, iMesh, iRKStep);
       break;
   }
+  }
 
   /*--- Compute viscous residuals ---*/
 
+  {
+  SU2_PROFILE_REGION("Viscous residual");
   solver_container[MainSolver]->Viscous_Residual(geometry, solver_container, numerics, config, iMesh, iRKStep);
+  }
 
   /*--- Compute source term residuals ---*/
 
+  {
+  SU2_PROFILE_REGION("Source residual");
   solver_container[MainSolver]->Source_Residual(geometry, solver_container, numerics, config, iMesh);
+  }
 
   /*--- Add viscous and convective residuals, and compute the Dual Time Source term ---*/
 
   if (dual_time)
     solver_container[MainSolver]->SetResidual_DualTime(geometry, solver_container, config, iRKStep, iMesh, RunTime_EqSystem);
 
-  /// TODO: No boundary condition supports hybrid parallelism yet, master thread does all the work.
+  /*--- Boundary conditions that depend on other boundaries (they require MPI synchronization),
+   *    and the BCs of solvers that do not support hybrid parallelism, run on the master thread. ---*/
 
-  SU2_OMP_MASTER
-  {
+  SU2_PROFILE_REGION("Boundary conditions");
 
-  /*--- Boundary conditions that depend on other boundaries (they require MPI sincronization)---*/
+  const bool hybridBC = solver_container[MainSolver]->GetHasHybridParallelBC();
 
+  SU2_OMP_MASTER
+  {
   solver_container[MainSolver]->BC_Fluid_Interface(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM], config);
 
   /*--- Compute Fourier Transformations for markers where NRBC_BOUNDARY is applied---*/
@@ -92,65 +127,32 @@ void CIntegration::Space_Integration(CGeometry *geometry,
 
     solver_container[MainSolver]->PreprocessBC_Giles(geometry, config, numerics[CONV_BOUND_TERM], OUTFLOW);
   }
+  }
+  SU2_OMP_BARRIER
+
+  /*--- Weak boundary conditions, the vertex loops are shared by all threads (each with its own numerics),
+   *    except for the turbomachinery BCs which are applied by the master thread. ---*/
 
-  /*--- Weak boundary conditions ---*/
+  CNumerics** thread_numerics = numerics + omp_get_thread_num()*MAX_TERMS;
 
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
     KindBC = config->GetMarker_All_KindBC(iMarker);
-    switch (KindBC) {
-      case EULER_WALL:
-        solver_container[MainSolver]->BC_Euler_Wall(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM], config, iMarker);
-        break;
-      case ACTDISK_INLET:
-        solver_container[MainSolver]->BC_ActDisk_Inlet(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM], config, iMarker);
-        break;
-      case ENGINE_INFLOW:
-        solver_container[MainSolver]->BC_Engine_Inflow(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM], config, iMarker);
-        break;
-      case INLET_FLOW:
-        solver_container[MainSolver]->BC_Inlet(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM], config, iMarker);
-        break;
-      case ACTDISK_OUTLET:
-        solver_container[MainSolver]->BC_ActDisk_Outlet(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM], config, iMarker);
-        break;
-      case ENGINE_EXHAUST:
-        solver_container[MainSolver]->BC_Engine_Exhaust(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM], config, iMarker);
-        break;
-      case SUPERSONIC_INLET:
-        solver_container[MainSolver]->BC_Supersonic_Inlet(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM], config, iMarker);
-        break;
-      case OUTLET_FLOW:
-        solver_container[MainSolver]->BC_Outlet(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM], config, iMarker);
-        break;
-      case SUPERSONIC_OUTLET:
-        solver_container[MainSolver]->BC_Supersonic_Outlet(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM], config, iMarker);
-        break;
-      case GILES_BOUNDARY:
-        solver_container[MainSolver]->BC_Giles(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM], config, iMarker);
-        break;
-      case RIEMANN_BOUNDARY:
-        if (config->GetBoolTurbomachinery()){
-          solver_container[MainSolver]->BC_TurboRiemann(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM], config, iMarker);
-        }
-        else{
-          solver_container[MainSolver]->BC_Riemann(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM], config, iMarker);
-        }
-        break;
-      case FAR_FIELD:
-        solver_container[MainSolver]->BC_Far_Field(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM], config, iMarker);
-        break;
-      case SYMMETRY_PLANE:
-        solver_container[MainSolver]->BC_Sym_Plane(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM], config, iMarker);
-        break;
-      case ELECTRODE_BOUNDARY:
-        solver_container[MainSolver]->BC_Electrode(geometry, solver_container, numerics[CONV_BOUND_TERM], config, iMarker);
-        break;
-      case DIELEC_BOUNDARY:
-        solver_container[MainSolver]->BC_Dielec(geometry, solver_container, numerics[CONV_BOUND_TERM], config, iMarker);
-        break;
+
+    const bool masterOnly = !hybridBC || (KindBC == GILES_BOUNDARY) ||
+                            ((KindBC == RIEMANN_BOUNDARY) && config->GetBoolTurbomachinery());
+    if (masterOnly) {
+      SU2_OMP_MASTER
+      Weak_BoundaryCondition(iMarker, geometry, solver_container, numerics, config, MainSolver);
+      SU2_OMP_BARRIER
+    }
+    else {
+      Weak_BoundaryCondition(iMarker, geometry, solver_container, thread_numerics, config, MainSolver);
     }
   }
 
+  SU2_OMP_MASTER
+  {
+
   /*--- Strong boundary conditions (Navier-Stokes and Dirichlet type BCs) ---*/
 
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
@@ -188,11 +190,73 @@ void CIntegration::Space_Integration(CGeometry *geometry,
 
 }
 
+void CIntegration::Weak_BoundaryCondition(unsigned short iMarker, CGeometry *geometry, CSolver **solver_container,
+                                          CNumerics **numerics, CConfig *config, unsigned short MainSolver) {
+
+  unsigned short KindBC = config->GetMarker_All_KindBC(iMarker);
+
+  switch (KindBC) {
+    case EULER_WALL:
+      solver_container[MainSolver]->BC_Euler_Wall(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM], config, iMarker);
+      break;
+    case ACTDISK_INLET:
+      solver_container[MainSolver]->BC_ActDisk_Inlet(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM], config, iMarker);
+      break;
+    case ENGINE_INFLOW:
+      solver_container[MainSolver]->BC_Engine_Inflow(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM], config, iMarker);
+      break;
+    case INLET_FLOW:
+      solver_container[MainSolver]->BC_Inlet(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM], config, iMarker);
+      break;
+    case ACTDISK_OUTLET:
+      solver_container[MainSolver]->BC_ActDisk_Outlet(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM], config, iMarker);
+      break;
+    case ENGINE_EXHAUST:
+      solver_container[MainSolver]->BC_Engine_Exhaust(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM], config, iMarker);
+      break;
+    case SUPERSONIC_INLET:
+      solver_container[MainSolver]->BC_Supersonic_Inlet(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM], config, iMarker);
+      break;
+    case OUTLET_FLOW:
+      solver_container[MainSolver]->BC_Outlet(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM], config, iMarker);
+      break;
+    case SUPERSONIC_OUTLET:
+      solver_container[MainSolver]->BC_Supersonic_Outlet(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM], config, iMarker);
+      break;
+    case GILES_BOUNDARY:
+      solver_container[MainSolver]->BC_Giles(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM], config, iMarker);
+      break;
+    case RIEMANN_BOUNDARY:
+      if (config->GetBoolTurbomachinery()){
+        solver_container[MainSolver]->BC_TurboRiemann(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM], config, iMarker);
+      }
+      else{
+        solver_container[MainSolver]->BC_Riemann(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM], config, iMarker);
+      }
+      break;
+    case FAR_FIELD:
+      solver_container[MainSolver]->BC_Far_Field(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM], config, iMarker);
+      break;
+    case SYMMETRY_PLANE:
+      solver_container[MainSolver]->BC_Sym_Plane(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM], config, iMarker);
+      break;
+    case ELECTRODE_BOUNDARY:
+      solver_container[MainSolver]->BC_Electrode(geometry, solver_container, numerics[CONV_BOUND_TERM], config, iMarker);
+      break;
+    case DIELEC_BOUNDARY:
+      solver_container[MainSolver]->BC_Dielec(geometry, solver_container, numerics[CONV_BOUND_TERM], config, iMarker);
+      break;
+  }
+
+}
+
 void CIntegration::Time_Integration(CGeometry *geometry, CSolver **solver_container, CConfig *config,
                                     unsigned short iRKStep, unsigned short RunTime_EqSystem) {
 
   unsigned short MainSolver = config->GetContainerPosition(RunTime_EqSystem);
 
+  SU2_PROFILE_REGION("Time integration");
+
   switch (config->GetKind_TimeIntScheme()) {
     case (RUNGE_KUTTA_EXPLICIT):
       solver_container[MainSolver]->ExplicitRK_Iteration(geometry, solver_container, config, iRKStep);
@@ -210,16 +274,83 @@ void CIntegration::Time_Integration(CGeometry *geometry, CSolver **solver_contai
 
 }
 
-void CIntegration::SetDualTime_Solver(CGeometry *geometry, CSolver *solver, CConfig *config, unsigned short iMesh) {
+void CIntegration::SetRestricted_EddyVisc(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse,
+                                          CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config) {
+
+  unsigned long iVertex, Point_Fine, Point_Coarse, iChildren;
+  unsigned short iMarker;
+  su2double Area_Parent, Area_Children, EddyVisc_Fine, EddyVisc;
+
+  const auto& children = geo_coarse->GetChildren_CSR();
+
+  /*--- Compute coarse Eddy Viscosity from fine solution ---*/
+
+  SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPointDomain(), omp_get_num_threads()))
+  for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
+
+    Area_Parent = geo_coarse->node[Point_Coarse]->GetVolume();
+
+    EddyVisc = 0.0;
+
+    for (iChildren = 0; iChildren < children.getNumNonZeros(Point_Coarse); iChildren++) {
+      Point_Fine = children.getInnerIdx(Point_Coarse, iChildren);
+      Area_Children = geo_fine->node[Point_Fine]->GetVolume();
+      EddyVisc_Fine = sol_fine->GetNodes()->GetmuT(Point_Fine);
+      EddyVisc += EddyVisc_Fine*Area_Children/Area_Parent;
+    }
+
+    sol_coarse->GetNodes()->SetmuT(Point_Coarse,EddyVisc);
+
+  }
+
+  /*--- Update solution at the no slip wall boundary, only the first
+   variable (nu_tilde -in SA and SA_NEG- and k -in SST-), to guarantee that the eddy viscoisty
+   is zero on the surface ---*/
+
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    if ((config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX) ||
+        (config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL) ||
+        (config->GetMarker_All_KindBC(iMarker) == CHT_WALL_INTERFACE)) {
+
+      SU2_OMP_FOR_STAT(32)
+      for (iVertex = 0; iVertex < geo_coarse->nVertex[iMarker]; iVertex++) {
+        Point_Coarse = geo_coarse->vertex[iMarker][iVertex]->GetNode();
+        sol_coarse->GetNodes()->SetmuT(Point_Coarse,0.0);
+      }
+    }
+  }
+
+  /*--- MPI the new interpolated solution (this also includes the eddy viscosity) ---*/
+
+  SU2_OMP_MASTER
+  {
+    sol_coarse->InitiateComms(geo_coarse, config, SOLUTION_EDDY);
+    sol_coarse->CompleteComms(geo_coarse, config, SOLUTION_EDDY);
+  }
+  SU2_OMP_BARRIER
+
+}
+
+void CIntegration::SetDualTime_Solver(CGeometry *geometry, CSolver *solver, CConfig *config, unsigned short iMesh,
+                                      bool predictor) {
+
+  const unsigned short order = predictor? config->GetTimePredictor_Order() : 1;
 
   SU2_OMP_PARALLEL
   {
 
   unsigned long iPoint;
 
+  /*--- Shift the time levels, the oldest one is kept for the quadratic predictor. ---*/
+
+  if (order == 3) solver->GetNodes()->Set_Solution_time_n2(config->GetTimePredictor_LowPrec());
   solver->GetNodes()->Set_Solution_time_n1();
   solver->GetNodes()->Set_Solution_time_n();
 
+  /*--- Initial guess of the next time step, extrapolated from the stored levels. ---*/
+
+  if (order > 1) solver->GetNodes()->SetSolution_Extrapolated(order);
+
   SU2_OMP_MASTER
   solver->ResetCFLAdapt();
   SU2_OMP_BARRIER
@@ -28,6 +28,8 @@
 #include "../../include/integration/CIntegrationFactory.hpp"
 #include "../../include/integration/CSingleGridIntegration.hpp"
 #include "../../include/integration/CMultiGridIntegration.hpp"
+#include "../../include/integration/CNewtonIntegration.hpp"
+#include "../../include/integration/CCoupledTurbIntegration.hpp"
 #include "../../include/integration/CStructuralIntegration.hpp"
 #include "../../include/integration/CFEM_DG_Integration.hpp"
 
@@ -60,6 +62,12 @@ CIntegration* CIntegrationFactory::createIntegration(INTEGRATION_TYPE integratio
     case INTEGRATION_TYPE::MULTIGRID:
       integration = new CMultiGridIntegration();
       break;
+    case INTEGRATION_TYPE::NEWTON:
+      integration = new CNewtonIntegration();
+      break;
+    case INTEGRATION_TYPE::COUPLED_TURB:
+      integration = new CCoupledTurbIntegration();
+      break;
     case INTEGRATION_TYPE::STRUCTURAL:
       integration = new CStructuralIntegration();
       break;
@@ -26,11 +26,47 @@
  */
 
 #include "../../include/integration/CMultiGridIntegration.hpp"
+#include "../../../Common/include/toolboxes/CRegionProfiler.hpp"
 #include "../../../Common/include/omp_structure.hpp"
-
+#include "../../../Common/include/toolboxes/printing_toolbox.hpp"
+
+namespace {
+/*--- Wall clock time, measured as in the drivers. ---*/
+inline passivedouble WallTime() {
+#ifndef HAVE_MPI
+  return passivedouble(clock())/passivedouble(CLOCKS_PER_SEC);
+#else
+  return MPI_Wtime();
+#endif
+}
+}
 
 CMultiGridIntegration::CMultiGridIntegration() : CIntegration() { }
 
+CMultiGridIntegration::~CMultiGridIntegration() {
+
+  /*--- Summary of the time spent in each level by the cycles (of the master rank). ---*/
+
+  if ((levelTime.size() < 2) || (SU2_MPI::GetRank() != MASTER_NODE)) return;
+
+  passivedouble totalTime = 0.0;
+  for (auto time : levelTime) totalTime += time;
+  if (totalTime <= 0.0) return;
+
+  PrintingToolbox::CTablePrinter MGTable(&std::cout);
+  MGTable.AddColumn("MG Level", 10);
+  MGTable.AddColumn("Visits", 10);
+  MGTable.AddColumn("Time [s]", 12);
+  MGTable.AddColumn("Time [%]", 10);
+  MGTable.SetAlign(PrintingToolbox::CTablePrinter::RIGHT);
+
+  cout << "\nWall time of the multigrid levels (smoothing and transfer to the next level):" << endl;
+  MGTable.PrintHeader();
+  for (auto iMesh = 0ul; iMesh < levelTime.size(); iMesh++)
+    MGTable << iMesh << levelVisits[iMesh] << levelTime[iMesh] << 100.0*levelTime[iMesh]/totalTime;
+  MGTable.PrintFooter();
+}
+
 void CMultiGridIntegration::MultiGrid_Iteration(CGeometry ****geometry,
                                                 CSolver *****solver_container,
                                                 CNumerics ******numerics_container,
@@ -99,17 +135,77 @@ void CMultiGridIntegration::MultiGrid_Iteration(CGeometry ****geometry,
 
   FinestMesh = config[iZone]->GetFinestMesh();
 
+  SU2_OMP_MASTER
+  if (levelTime.size() != config[iZone]->GetnMGLevels()+1u) {
+    levelTime.assign(config[iZone]->GetnMGLevels()+1, 0.0);
+    levelVisits.assign(config[iZone]->GetnMGLevels()+1, 0);
+  }
+  SU2_OMP_BARRIER
+
+  /*--- Within the cycle each preprocessing is followed by the residual computation, which
+   *    completes the halo exchanges the former may leave pending (see OVERLAP_HALO_COMMS). ---*/
+
+  CSolver* solver_finest = solver_container[iZone][iInst][MESH_0][Solver_Position];
+
+  const bool overlapComms = config[iZone]->GetOverlapHaloComms() && !config[iZone]->GetDiscrete_Adjoint() &&
+                            (RunTime_EqSystem == RUNTIME_FLOW_SYS);
+
+  if (overlapComms) {
+    SU2_OMP_MASTER
+    solver_finest->SetAllowPendingComms(true);
+    SU2_OMP_BARRIER
+  }
+
   /*--- Perform the Full Approximation Scheme multigrid ---*/
 
   MultiGrid_Cycle(geometry, solver_container, numerics_container, config,
                   FinestMesh, RecursiveParam, RunTime_EqSystem, iZone, iInst);
 
+  if (overlapComms) {
+    SU2_OMP_MASTER
+    {
+      solver_finest->SetAllowPendingComms(false);
+      solver_finest->CompletePendingComms(geometry[iZone][iInst][MESH_0], config[iZone]);
+    }
+    SU2_OMP_BARRIER
+  }
+
   /*--- Computes primitive variables and gradients in the finest mesh (useful for the next solver (turbulence) and output ---*/
 
+  {
+  SU2_PROFILE_REGION("Solver preprocessing");
   solver_container[iZone][iInst][MESH_0][Solver_Position]->Preprocessing(geometry[iZone][iInst][MESH_0],
                                                                          solver_container[iZone][iInst][MESH_0],
                                                                          config[iZone], MESH_0, NO_RK_ITER,
                                                                          RunTime_EqSystem, true);
+  }
+
+  /*--- The turbulence model updates the eddy viscosity with the corrected solution (there is no
+   *    post-smoothing on the finest grid), and the coarse levels of the mean flow cycle use the
+   *    restriction of the fine grid turbulence, as in the single grid integration. ---*/
+
+  if (RunTime_EqSystem == RUNTIME_TURB_SYS) {
+
+    solver_finest->Postprocessing(geometry[iZone][iInst][MESH_0], solver_container[iZone][iInst][MESH_0],
+                                  config[iZone], MESH_0);
+
+    for (unsigned short iMesh = FinestMesh; iMesh < config[iZone]->GetnMGLevels(); iMesh++) {
+
+      SetRestricted_Solution(RunTime_EqSystem,
+                             solver_container[iZone][iInst][iMesh][Solver_Position],
+                             solver_container[iZone][iInst][iMesh+1][Solver_Position],
+                             geometry[iZone][iInst][iMesh],
+                             geometry[iZone][iInst][iMesh+1],
+                             config[iZone]);
+
+      SetRestricted_EddyVisc(RunTime_EqSystem,
+                             solver_container[iZone][iInst][iMesh][Solver_Position],
+                             solver_container[iZone][iInst][iMesh+1][Solver_Position],
+                             geometry[iZone][iInst][iMesh],
+                             geometry[iZone][iInst][iMesh+1],
+                             config[iZone]);
+    }
+  }
 
   /*--- Compute non-dimensional parameters and the convergence monitor ---*/
 
@@ -143,6 +239,13 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
   CSolver* solver_fine = solver_container_fine[Solver_Position];
   CNumerics** numerics_fine = numerics_container[iZone][iInst][iMesh][Solver_Position];
 
+  /*--- Wall time of this level, the time spent on the coarser levels is excluded. ---*/
+
+  passivedouble startTime = WallTime();
+
+  SU2_OMP_MASTER
+  levelVisits[iMesh]++;
+
   /*--- Number of RK steps. ---*/
 
   unsigned short iRKLimit = 1;
@@ -170,7 +273,10 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
 
       /*--- Send-Receive boundary conditions, and preprocessing ---*/
 
+      {
+      SU2_PROFILE_REGION("Solver preprocessing");
       solver_fine->Preprocessing(geometry_fine, solver_container_fine, config, iMesh, iRKStep, RunTime_EqSystem, false);
+      }
 
       if (iRKStep == 0) {
 
@@ -220,7 +326,10 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
 
     /*--- Compute $r_k = P_k + F_k(u_k)$ ---*/
 
+    {
+    SU2_PROFILE_REGION("Solver preprocessing");
     solver_fine->Preprocessing(geometry_fine, solver_container_fine, config, iMesh, NO_RK_ITER, RunTime_EqSystem, false);
+    }
 
     /// TODO: For implicit schemes, this call to Space_Integration can skip building the system matrix.
     Space_Integration(geometry_fine, solver_container_fine, numerics_fine, config, iMesh, NO_RK_ITER, RunTime_EqSystem);
@@ -231,19 +340,30 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
 
     SetRestricted_Solution(RunTime_EqSystem, solver_fine, solver_coarse, geometry_fine, geometry_coarse, config);
 
+    {
+    SU2_PROFILE_REGION("Solver preprocessing");
     solver_coarse->Preprocessing(geometry_coarse, solver_container_coarse, config, iMesh+1, NO_RK_ITER, RunTime_EqSystem, false);
+    }
 
     Space_Integration(geometry_coarse, solver_container_coarse, numerics_coarse, config, iMesh+1, NO_RK_ITER, RunTime_EqSystem);
 
     /*--- Compute $P_(k+1) = I^(k+1)_k(r_k) - r_(k+1) ---*/
 
-    SetForcing_Term(solver_fine, solver_coarse, geometry_fine, geometry_coarse, config, iMesh+1);
+    SetForcing_Term(RunTime_EqSystem, solver_fine, solver_coarse, geometry_fine, geometry_coarse, config, iMesh+1);
 
-    /*--- Recursive call to MultiGrid_Cycle (this routine). ---*/
+    /*--- Recursive call to MultiGrid_Cycle (this routine), once for V cycles, twice for W
+     *    cycles (W cycles on the coarse level), and twice for F cycles (an F and then a V). ---*/
+
+    SU2_OMP_MASTER
+    levelTime[iMesh] += WallTime() - startTime;
 
-    for (unsigned short imu = 0; imu <= RecursiveParam; imu++) {
+    const unsigned short nRecursions = (RecursiveParam == F_CYCLE)? 2 : RecursiveParam+1;
+
+    for (unsigned short imu = 0; imu < nRecursions; imu++) {
 
       unsigned short nextRecurseParam = RecursiveParam;
+      if ((RecursiveParam == F_CYCLE) && (imu > 0))
+        nextRecurseParam = V_CYCLE;
       if (iMesh == config->GetnMGLevels()-2)
         nextRecurseParam = 0;
 
@@ -251,13 +371,15 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
                       iMesh+1, nextRecurseParam, RunTime_EqSystem, iZone, iInst);
     }
 
+    startTime = WallTime();
+
     /*--- Compute prolongated solution, and smooth the correction $u^(new)_k = u_k +  Smooth(I^k_(k+1)(u_(k+1)-I^(k+1)_k u_k))$ ---*/
 
     GetProlongated_Correction(RunTime_EqSystem, solver_fine, solver_coarse, geometry_fine, geometry_coarse, config);
 
     SmoothProlongated_Correction(RunTime_EqSystem, solver_fine, geometry_fine, config->GetMG_CorrecSmooth(iMesh), 1.25, config);
 
-    SetProlongated_Correction(solver_fine, geometry_fine, config, iMesh);
+    SetProlongated_Correction(RunTime_EqSystem, solver_fine, geometry_fine, config, iMesh);
 
 
     /*--- Solution post-smoothing in the prolongated grid. ---*/
@@ -266,7 +388,10 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
 
       for (unsigned short iRKStep = 0; iRKStep < iRKLimit; iRKStep++) {
 
+        {
+        SU2_PROFILE_REGION("Solver preprocessing");
         solver_fine->Preprocessing(geometry_fine, solver_container_fine, config, iMesh, iRKStep, RunTime_EqSystem, false);
+        }
 
         if (iRKStep == 0) {
           solver_fine->Set_OldSolution(geometry_fine);
@@ -286,16 +411,23 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
     }
   }
 
+  SU2_OMP_MASTER
+  levelTime[iMesh] += WallTime() - startTime;
+
 }
 
 void CMultiGridIntegration::GetProlongated_Correction(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse,
                                                       CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config) {
-  unsigned long Point_Fine, Point_Coarse, iVertex;
-  unsigned short Boundary, iMarker, iChildren, iVar;
+  unsigned long Point_Fine, Point_Coarse, iVertex, iChildren;
+  unsigned short Boundary, iMarker, iVar;
   su2double Area_Parent, Area_Children;
   const su2double *Solution_Fine = nullptr, *Solution_Coarse = nullptr;
 
   const unsigned short nVar = sol_coarse->GetnVar();
+  const bool turbulence = (RunTime_EqSystem == RUNTIME_TURB_SYS);
+  const auto& children = geo_coarse->GetChildren_CSR();
+  CVariable* nodes_fine = sol_fine->GetNodes();
+  CVariable* nodes_coarse = sol_coarse->GetNodes();
 
   su2double *Solution = new su2double[nVar];
 
@@ -304,23 +436,19 @@ void CMultiGridIntegration::GetProlongated_Correction(unsigned short RunTime_EqS
 
     Area_Parent = geo_coarse->node[Point_Coarse]->GetVolume();
 
-    for (iVar = 0; iVar < nVar; iVar++) Solution[iVar] = 0.0;
+    Solution_Coarse = nodes_coarse->GetSolution(Point_Coarse);
+
+    for (iVar = 0; iVar < nVar; iVar++) Solution[iVar] = Solution_Coarse[iVar];
 
-    for (iChildren = 0; iChildren < geo_coarse->node[Point_Coarse]->GetnChildren_CV(); iChildren++) {
-      Point_Fine = geo_coarse->node[Point_Coarse]->GetChildren_CV(iChildren);
+    for (iChildren = 0; iChildren < children.getNumNonZeros(Point_Coarse); iChildren++) {
+      Point_Fine = children.getInnerIdx(Point_Coarse, iChildren);
       Area_Children = geo_fine->node[Point_Fine]->GetVolume();
-      Solution_Fine = sol_fine->GetNodes()->GetSolution(Point_Fine);
+      Solution_Fine = nodes_fine->GetSolution(Point_Fine);
       for (iVar = 0; iVar < nVar; iVar++)
         Solution[iVar] -= Solution_Fine[iVar]*Area_Children/Area_Parent;
     }
 
-    Solution_Coarse = sol_coarse->GetNodes()->GetSolution(Point_Coarse);
-
-    for (iVar = 0; iVar < nVar; iVar++)
-      Solution[iVar] += Solution_Coarse[iVar];
-
-    for (iVar = 0; iVar < nVar; iVar++)
-      sol_coarse->GetNodes()->SetSolution_Old(Point_Coarse,Solution);
+    nodes_coarse->SetSolution_Old(Point_Coarse,Solution);
   }
 
   delete [] Solution;
@@ -341,7 +469,13 @@ void CMultiGridIntegration::GetProlongated_Correction(unsigned short RunTime_EqS
         /*--- For dirichlet boundary condtions, set the correction to zero.
          Note that Solution_Old stores the correction not the actual value ---*/
 
-        sol_coarse->GetNodes()->SetVelSolutionOldZero(Point_Coarse);
+        if (turbulence) {
+          for (iVar = 0; iVar < nVar; iVar++)
+            nodes_coarse->SetSolution_Old(Point_Coarse, iVar, 0.0);
+        }
+        else {
+          nodes_coarse->SetVelSolutionOldZero(Point_Coarse);
+        }
 
       }
     }
@@ -356,13 +490,13 @@ void CMultiGridIntegration::GetProlongated_Correction(unsigned short RunTime_EqS
   }
   SU2_OMP_BARRIER
 
-  /// TODO: Need to check for possible race condition here (multiple coarse points setting the same fine).
+  /*--- Each fine point has a single parent, the coarse points can be processed concurrently. ---*/
 
   SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPointDomain(), omp_get_num_threads()))
   for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
-    for (iChildren = 0; iChildren < geo_coarse->node[Point_Coarse]->GetnChildren_CV(); iChildren++) {
-      Point_Fine = geo_coarse->node[Point_Coarse]->GetChildren_CV(iChildren);
-      sol_fine->LinSysRes.SetBlock(Point_Fine, sol_coarse->GetNodes()->GetSolution_Old(Point_Coarse));
+    for (iChildren = 0; iChildren < children.getNumNonZeros(Point_Coarse); iChildren++) {
+      Point_Fine = children.getInnerIdx(Point_Coarse, iChildren);
+      sol_fine->LinSysRes.SetBlock(Point_Fine, nodes_coarse->GetSolution_Old(Point_Coarse));
     }
   }
 
@@ -379,11 +513,12 @@ void CMultiGridIntegration::SmoothProlongated_Correction(unsigned short RunTime_
   unsigned long iPoint, jPoint, iVertex;
 
   const unsigned short nVar = solver->GetnVar();
+  CVariable* nodes = solver->GetNodes();
 
   SU2_OMP_FOR_STAT(roundUpDiv(geometry->GetnPoint(), omp_get_num_threads()))
   for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
     Residual_Old = solver->LinSysRes.GetBlock(iPoint);
-    solver->GetNodes()->SetResidual_Old(iPoint,Residual_Old);
+    nodes->SetResidual_Old(iPoint,Residual_Old);
   }
 
   /*--- Jacobi iterations. ---*/
@@ -395,12 +530,12 @@ void CMultiGridIntegration::SmoothProlongated_Correction(unsigned short RunTime_
     SU2_OMP_FOR_STAT(roundUpDiv(geometry->GetnPoint(), omp_get_num_threads()))
     for (iPoint = 0; iPoint < geometry->GetnPoint(); ++iPoint) {
 
-      solver->GetNodes()->SetResidualSumZero(iPoint);
+      nodes->SetResidualSumZero(iPoint);
 
       for (iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); ++iNeigh) {
         jPoint = geometry->node[iPoint]->GetPoint(iNeigh);
         Residual_j = solver->LinSysRes.GetBlock(jPoint);
-        solver->GetNodes()->AddResidual_Sum(iPoint, Residual_j);
+        nodes->AddResidual_Sum(iPoint, Residual_j);
       }
 
     }
@@ -412,8 +547,8 @@ void CMultiGridIntegration::SmoothProlongated_Correction(unsigned short RunTime_
 
       su2double factor = 1.0/(1.0+val_smooth_coeff*su2double(geometry->node[iPoint]->GetnPoint()));
 
-      Residual_Sum = solver->GetNodes()->GetResidual_Sum(iPoint);
-      Residual_Old = solver->GetNodes()->GetResidual_Old(iPoint);
+      Residual_Sum = nodes->GetResidual_Sum(iPoint);
+      Residual_Old = nodes->GetResidual_Old(iPoint);
 
       for (iVar = 0; iVar < nVar; iVar++)
         solver->LinSysRes(iPoint,iVar) = (Residual_Old[iVar] + val_smooth_coeff*Residual_Sum[iVar])*factor;
@@ -428,7 +563,7 @@ void CMultiGridIntegration::SmoothProlongated_Correction(unsigned short RunTime_
         SU2_OMP_FOR_STAT(32)
         for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
           iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-          Residual_Old = solver->GetNodes()->GetResidual_Old(iPoint);
+          Residual_Old = nodes->GetResidual_Old(iPoint);
           solver->LinSysRes.SetBlock(iPoint, Residual_Old);
         }
       }
@@ -438,8 +573,8 @@ void CMultiGridIntegration::SmoothProlongated_Correction(unsigned short RunTime_
 
 }
 
-void CMultiGridIntegration::SetProlongated_Correction(CSolver *sol_fine, CGeometry *geo_fine,
-                                                      CConfig *config, unsigned short iMesh) {
+void CMultiGridIntegration::SetProlongated_Correction(unsigned short RunTime_EqSystem, CSolver *sol_fine,
+                                                      CGeometry *geo_fine, CConfig *config, unsigned short iMesh) {
   unsigned long Point_Fine;
   unsigned short iVar;
   su2double *Solution_Fine, *Residual_Fine;
@@ -447,6 +582,11 @@ void CMultiGridIntegration::SetProlongated_Correction(CSolver *sol_fine, CGeomet
   const unsigned short nVar = sol_fine->GetnVar();
   const su2double factor = config->GetDamp_Correc_Prolong(); //pow(config->GetDamp_Correc_Prolong(), iMesh+1);
 
+  /*--- The turbulence variables (except for the SA_NEG model) must remain positive, a correction
+   *    that would make them negative reduces them by half instead. ---*/
+
+  const bool positive = (RunTime_EqSystem == RUNTIME_TURB_SYS) && (config->GetKind_Turb_Model() != SA_NEG);
+
   SU2_OMP_FOR_STAT(roundUpDiv(geo_fine->GetnPointDomain(), omp_get_num_threads()))
   for (Point_Fine = 0; Point_Fine < geo_fine->GetnPointDomain(); Point_Fine++) {
     Residual_Fine = sol_fine->LinSysRes.GetBlock(Point_Fine);
@@ -455,7 +595,9 @@ void CMultiGridIntegration::SetProlongated_Correction(CSolver *sol_fine, CGeomet
       /*--- Prevent a fine grid divergence due to a coarse grid divergence ---*/
       if (Residual_Fine[iVar] != Residual_Fine[iVar])
         Residual_Fine[iVar] = 0.0;
-      Solution_Fine[iVar] += factor*Residual_Fine[iVar];
+      su2double Correction = factor*Residual_Fine[iVar];
+      if (positive) Correction = max(Correction, -0.5*Solution_Fine[iVar]);
+      Solution_Fine[iVar] += Correction;
     }
   }
 
@@ -472,46 +614,53 @@ void CMultiGridIntegration::SetProlongated_Correction(CSolver *sol_fine, CGeomet
 
 void CMultiGridIntegration::SetProlongated_Solution(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse,
                                                     CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config) {
-  unsigned long Point_Fine, Point_Coarse;
-  unsigned short iChildren;
+  unsigned long Point_Fine, Point_Coarse, iChildren;
 
-  /// TODO: Need to check for possible race condition here (multiple coarse points setting the same fine).
+  const auto& children = geo_coarse->GetChildren_CSR();
+  CVariable* nodes_fine = sol_fine->GetNodes();
+  CVariable* nodes_coarse = sol_coarse->GetNodes();
+
+  /*--- Each fine point has a single parent, the coarse points can be processed concurrently. ---*/
 
   SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPointDomain(), omp_get_num_threads()))
   for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
-    for (iChildren = 0; iChildren < geo_coarse->node[Point_Coarse]->GetnChildren_CV(); iChildren++) {
-      Point_Fine = geo_coarse->node[Point_Coarse]->GetChildren_CV(iChildren);
-      sol_fine->GetNodes()->SetSolution(Point_Fine, sol_coarse->GetNodes()->GetSolution(Point_Coarse));
+    for (iChildren = 0; iChildren < children.getNumNonZeros(Point_Coarse); iChildren++) {
+      Point_Fine = children.getInnerIdx(Point_Coarse, iChildren);
+      nodes_fine->SetSolution(Point_Fine, nodes_coarse->GetSolution(Point_Coarse));
     }
   }
 }
 
-void CMultiGridIntegration::SetForcing_Term(CSolver *sol_fine, CSolver *sol_coarse, CGeometry *geo_fine,
-                                            CGeometry *geo_coarse, CConfig *config, unsigned short iMesh) {
+void CMultiGridIntegration::SetForcing_Term(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse,
+                                            CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config,
+                                            unsigned short iMesh) {
 
-  unsigned long Point_Fine, Point_Coarse, iVertex;
-  unsigned short iMarker, iVar, iChildren;
+  unsigned long Point_Fine, Point_Coarse, iVertex, iChildren;
+  unsigned short iMarker, iVar;
   const su2double *Residual_Fine;
 
   const unsigned short nVar = sol_coarse->GetnVar();
   su2double factor = config->GetDamp_Res_Restric(); //pow(config->GetDamp_Res_Restric(), iMesh);
+  const bool turbulence = (RunTime_EqSystem == RUNTIME_TURB_SYS);
+
+  const auto& children = geo_coarse->GetChildren_CSR();
+  CVariable* nodes_coarse = sol_coarse->GetNodes();
 
   su2double *Residual = new su2double[nVar];
 
   SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPointDomain(), omp_get_num_threads()))
   for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
 
-    sol_coarse->GetNodes()->SetRes_TruncErrorZero(Point_Coarse);
-
     for (iVar = 0; iVar < nVar; iVar++) Residual[iVar] = 0.0;
 
-    for (iChildren = 0; iChildren < geo_coarse->node[Point_Coarse]->GetnChildren_CV(); iChildren++) {
-      Point_Fine = geo_coarse->node[Point_Coarse]->GetChildren_CV(iChildren);
+    for (iChildren = 0; iChildren < children.getNumNonZeros(Point_Coarse); iChildren++) {
+      Point_Fine = children.getInnerIdx(Point_Coarse, iChildren);
       Residual_Fine = sol_fine->LinSysRes.GetBlock(Point_Fine);
       for (iVar = 0; iVar < nVar; iVar++)
         Residual[iVar] += factor*Residual_Fine[iVar];
     }
-    sol_coarse->GetNodes()->AddRes_TruncError(Point_Coarse, Residual);
+    nodes_coarse->SetRes_TruncErrorZero(Point_Coarse);
+    nodes_coarse->AddRes_TruncError(Point_Coarse, Residual);
   }
 
   delete [] Residual;
@@ -524,14 +673,18 @@ void CMultiGridIntegration::SetForcing_Term(CSolver *sol_fine, CSolver *sol_coar
       SU2_OMP_FOR_STAT(32)
       for (iVertex = 0; iVertex < geo_coarse->nVertex[iMarker]; iVertex++) {
         Point_Coarse = geo_coarse->vertex[iMarker][iVertex]->GetNode();
-        sol_coarse->GetNodes()->SetVel_ResTruncError_Zero(Point_Coarse);
+
+        /*--- All the turbulence variables are strongly imposed at the walls. ---*/
+
+        if (turbulence) nodes_coarse->SetRes_TruncErrorZero(Point_Coarse);
+        else nodes_coarse->SetVel_ResTruncError_Zero(Point_Coarse);
       }
     }
   }
 
   SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPointDomain(), omp_get_num_threads()))
   for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
-    sol_coarse->GetNodes()->SubtractRes_TruncError(Point_Coarse, sol_coarse->LinSysRes.GetBlock(Point_Coarse));
+    nodes_coarse->SubtractRes_TruncError(Point_Coarse, sol_coarse->LinSysRes.GetBlock(Point_Coarse));
   }
 
 }
@@ -547,8 +700,8 @@ void CMultiGridIntegration::SetResidual_Term(CGeometry *geometry, CSolver *solve
 void CMultiGridIntegration::SetRestricted_Solution(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse,
                                                    CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config) {
 
-  unsigned long iVertex, Point_Fine, Point_Coarse;
-  unsigned short iMarker, iVar, iChildren, iDim;
+  unsigned long iVertex, Point_Fine, Point_Coarse, iChildren;
+  unsigned short iMarker, iVar, iDim;
   su2double Area_Parent, Area_Children, Vector[3] = {0.0};
   const su2double *Solution_Fine = nullptr, *Grid_Vel = nullptr;
 
@@ -557,6 +710,10 @@ void CMultiGridIntegration::SetRestricted_Solution(unsigned short RunTime_EqSyst
   const unsigned short nDim = geo_fine->GetnDim();
   const bool grid_movement = config->GetGrid_Movement();
 
+  const auto& children = geo_coarse->GetChildren_CSR();
+  CVariable* nodes_fine = sol_fine->GetNodes();
+  CVariable* nodes_coarse = sol_coarse->GetNodes();
+
   su2double *Solution = new su2double[nVar];
 
   /*--- Compute coarse solution from fine solution ---*/
@@ -568,17 +725,17 @@ void CMultiGridIntegration::SetRestricted_Solution(unsigned short RunTime_EqSyst
 
     for (iVar = 0; iVar < nVar; iVar++) Solution[iVar] = 0.0;
 
-    for (iChildren = 0; iChildren < geo_coarse->node[Point_Coarse]->GetnChildren_CV(); iChildren++) {
+    for (iChildren = 0; iChildren < children.getNumNonZeros(Point_Coarse); iChildren++) {
 
-      Point_Fine = geo_coarse->node[Point_Coarse]->GetChildren_CV(iChildren);
+      Point_Fine = children.getInnerIdx(Point_Coarse, iChildren);
       Area_Children = geo_fine->node[Point_Fine]->GetVolume();
-      Solution_Fine = sol_fine->GetNodes()->GetSolution(Point_Fine);
+      Solution_Fine = nodes_fine->GetSolution(Point_Fine);
       for (iVar = 0; iVar < nVar; iVar++) {
         Solution[iVar] += Solution_Fine[iVar]*Area_Children/Area_Parent;
       }
     }
 
-    sol_coarse->GetNodes()->SetSolution(Point_Coarse, Solution);
+    nodes_coarse->SetSolution(Point_Coarse, Solution);
 
   }
 
@@ -603,19 +760,19 @@ void CMultiGridIntegration::SetRestricted_Solution(unsigned short RunTime_EqSyst
           if (grid_movement) {
             Grid_Vel = geo_coarse->node[Point_Coarse]->GetGridVel();
             for (iDim = 0; iDim < nDim; iDim++)
-              Vector[iDim] = sol_coarse->GetNodes()->GetSolution(Point_Coarse,0)*Grid_Vel[iDim];
-            sol_coarse->GetNodes()->SetVelSolutionVector(Point_Coarse, Vector);
+              Vector[iDim] = nodes_coarse->GetSolution(Point_Coarse,0)*Grid_Vel[iDim];
+            nodes_coarse->SetVelSolutionVector(Point_Coarse, Vector);
           }
           else {
             /*--- For stationary no-slip walls, set the velocity to zero. ---*/
 
-            sol_coarse->GetNodes()->SetVelSolutionZero(Point_Coarse);
+            nodes_coarse->SetVelSolutionZero(Point_Coarse);
           }
 
         }
 
         if (Solver_Position == ADJFLOW_SOL) {
-          sol_coarse->GetNodes()->SetVelSolutionDVector(Point_Coarse);
+          nodes_coarse->SetVelSolutionDVector(Point_Coarse);
         }
 
       }
@@ -635,13 +792,14 @@ void CMultiGridIntegration::SetRestricted_Solution(unsigned short RunTime_EqSyst
 
 void CMultiGridIntegration::SetRestricted_Gradient(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse,
                                                    CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config) {
-  unsigned long Point_Fine, Point_Coarse;
-  unsigned short iVar, iDim, iChildren;
+  unsigned long Point_Fine, Point_Coarse, iChildren;
+  unsigned short iVar, iDim;
   su2double Area_Parent, Area_Children;
   const su2double* const* Gradient_fine = nullptr;
 
   const unsigned short nDim = geo_coarse->GetnDim();
   const unsigned short nVar = sol_coarse->GetnVar();
+  const auto& children = geo_coarse->GetChildren_CSR();
 
   su2double **Gradient = new su2double* [nVar];
   for (iVar = 0; iVar < nVar; iVar++)
@@ -655,8 +813,8 @@ void CMultiGridIntegration::SetRestricted_Gradient(unsigned short RunTime_EqSyst
       for (iDim = 0; iDim < nDim; iDim++)
         Gradient[iVar][iDim] = 0.0;
 
-    for (iChildren = 0; iChildren < geo_coarse->node[Point_Coarse]->GetnChildren_CV(); iChildren++) {
-      Point_Fine = geo_coarse->node[Point_Coarse]->GetChildren_CV(iChildren);
+    for (iChildren = 0; iChildren < children.getNumNonZeros(Point_Coarse); iChildren++) {
+      Point_Fine = children.getInnerIdx(Point_Coarse, iChildren);
       Area_Children = geo_fine->node[Point_Fine]->GetVolume();
       Gradient_fine = sol_fine->GetNodes()->GetGradient(Point_Fine);
 
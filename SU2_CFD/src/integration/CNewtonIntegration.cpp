@@ -0,0 +1,282 @@
+/*!
+ * \file CNewtonIntegration.cpp
+ * \brief Newton-Krylov integration with matrix-free Jacobian-vector products.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/integration/CNewtonIntegration.hpp"
+#include "../../../Common/include/omp_structure.hpp"
+
+namespace {
+/*--- Conversion from the active type to the type of the linear solver, passive unless it is
+ *    also su2double (forward AD), in which case the derivatives are kept. ---*/
+template<class T>
+inline T ToScalar(const su2double& val) { return SU2_TYPE::GetValue(val); }
+
+template<>
+inline su2double ToScalar<su2double>(const su2double& val) { return val; }
+}
+
+CNewtonIntegration::CNewtonIntegration() : CMultiGridIntegration() { }
+
+void CNewtonIntegration::MultiGrid_Iteration(CGeometry ****geometry_, CSolver *****solver_container,
+                                             CNumerics ******numerics_container, CConfig **config_,
+                                             unsigned short RunTime_EqSystem, unsigned short iZone,
+                                             unsigned short iInst) {
+
+  config = config_[iZone];
+  geometry = geometry_[iZone][iInst][MESH_0];
+  solvers = solver_container[iZone][iInst][MESH_0];
+  numerics = numerics_container[iZone][iInst][MESH_0][FLOW_SOL];
+
+  /*--- Allocate the working vectors the first time. ---*/
+
+  if (solution0.GetLocSize() == 0) {
+    const auto nPoint = geometry->GetnPoint();
+    const auto nPointDomain = geometry->GetnPointDomain();
+    const auto nVar = solvers[FLOW_SOL]->GetnVar();
+
+    solution0.Initialize(nPoint, nPointDomain, nVar, 0.0);
+    residual0.Initialize(nPoint, nPointDomain, nVar, 0.0);
+    rhs.Initialize(nPoint, nPointDomain, nVar, 0.0);
+
+    unsigned long nLocal = nPointDomain*nVar, nGlobal = 0;
+    SU2_MPI::Allreduce(&nLocal, &nGlobal, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+    sqrtNumUnknowns = sqrt(su2double(nGlobal));
+
+    if (config->GetNewtonKrylov_ADJacobian()) {
+
+      /*--- Reconstruction and viscous fluxes use gradients, the residual then depends on the
+       *    neighbors of the neighbors, which need different colors to avoid aliasing. ---*/
+
+      const bool muscl = config->GetMUSCL_Flow() && (config->GetKind_ConvNumScheme_Flow() == SPACE_UPWIND);
+      const bool viscous = config->GetViscous();
+      const unsigned long fillLvl = (muscl || viscous)? 1 : 0;
+
+      stencil = buildCSRPattern(*geometry, ConnectivityType::FiniteVolume, fillLvl);
+      coloring = colorSparsePattern<CCompressedSparsePatternUL, unsigned short, 1024>(stencil, 1, false, &pointColor);
+
+      if (coloring.empty())
+        SU2_MPI::Error("The residual stencil could not be colored for NEWTON_KRYLOV_AD_JACOBIAN.", CURRENT_FUNCTION);
+
+      if (rank == MASTER_NODE)
+        cout << "Jacobian by forward AD with " << coloring.getOuterSize() << " colors (rank 0)." << endl;
+    }
+  }
+
+  CMultiGridIntegration::MultiGrid_Iteration(geometry_, solver_container, numerics_container, config_,
+                                             RunTime_EqSystem, iZone, iInst);
+}
+
+void CNewtonIntegration::Time_Integration(CGeometry *geometry_, CSolver **solver_container, CConfig *config_,
+                                          unsigned short iRKStep, unsigned short RunTime_EqSystem) {
+
+  const bool startup = (config_->GetInnerIter() < config_->GetNewtonKrylov_StartupIter());
+
+  if (startup || (RunTime_EqSystem != RUNTIME_FLOW_SYS) || (geometry_ != geometry)) {
+    CIntegration::Time_Integration(geometry_, solver_container, config_, iRKStep, RunTime_EqSystem);
+    return;
+  }
+
+  NewtonIteration();
+}
+
+void CNewtonIntegration::ComputeResiduals() {
+
+  /*--- The Jacobian is not updated as it defines the preconditioner. ---*/
+
+  SU2_OMP_MASTER
+  config->SetKind_TimeIntScheme_Flow(EULER_EXPLICIT);
+  SU2_OMP_BARRIER
+
+  solvers[FLOW_SOL]->Preprocessing(geometry, solvers, config, MESH_0, NO_RK_ITER, RUNTIME_FLOW_SYS, false);
+
+  Space_Integration(geometry, solvers, numerics, config, MESH_0, NO_RK_ITER, RUNTIME_FLOW_SYS);
+
+  SU2_OMP_MASTER
+  config->SetKind_TimeIntScheme_Flow(EULER_IMPLICIT);
+  SU2_OMP_BARRIER
+}
+
+void CNewtonIntegration::NewtonIteration() {
+
+  CSolver* solver = solvers[FLOW_SOL];
+  CVariable* nodes = solver->GetNodes();
+
+  const auto nPoint = geometry->GetnPoint();
+  const auto nVar = solver->GetnVar();
+
+  /*--- Keep the state around which the system is linearized, and its residual,
+   *    before the latter is modified to become the right hand side. ---*/
+
+  SU2_OMP_FOR_STAT(roundUpDiv(nPoint, omp_get_num_threads()))
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+    for (auto iVar = 0ul; iVar < nVar; iVar++) {
+      solution0(iPoint,iVar) = nodes->GetSolution(iPoint,iVar);
+      residual0(iPoint,iVar) = solver->LinSysRes(iPoint,iVar);
+    }
+  }
+
+  /*--- Perturbation size relative to the rms of the solution, scaled by
+   *    the rms of the direction in each product. ---*/
+
+  const su2double rmsSolution = solution0.norm() / sqrtNumUnknowns;
+
+  SU2_OMP_MASTER
+  finDiffStep = config->GetNewtonKrylov_FinDiffStep() * (1.0 + rmsSolution);
+  SU2_OMP_BARRIER
+
+  /*--- Replace the approximate Jacobian by the one computed with AD. ---*/
+
+  if (config->GetNewtonKrylov_ADJacobian()) ComputeADJacobian();
+
+  /*--- Standard implicit system, its matrix is the preconditioner. ---*/
+
+  solver->PrepareImplicitIteration(geometry, solvers, config);
+
+  /*--- The residual vector is overwritten by the products, keep a copy of the right hand side. ---*/
+
+  rhs = solver->LinSysRes;
+  SU2_OMP_BARRIER
+
+  const CMatrixFreeProduct product(*this);
+
+  auto iter = solver->System.Solve(solver->Jacobian, rhs, solver->LinSysSol, geometry, config, &product);
+  SU2_OMP_MASTER
+  {
+    solver->SetIterLinSolver(iter);
+    solver->SetResLinSolver(solver->System.GetResidual());
+  }
+  SU2_OMP_BARRIER
+
+  /*--- The products restore the solution, the other variables (primitives, gradients)
+   *    differ from the unperturbed ones by O(eps), they are recomputed after the update. ---*/
+
+  solver->CompleteImplicitIteration(geometry, solvers, config);
+}
+
+void CNewtonIntegration::MatrixFreeProduct(const CSysVector<Scalar>& u, CSysVector<Scalar>& v) {
+
+  CSolver* solver = solvers[FLOW_SOL];
+  CVariable* nodes = solver->GetNodes();
+
+  const auto nPoint = geometry->GetnPoint();
+  const auto nPointDomain = geometry->GetnPointDomain();
+  const auto nVar = solver->GetnVar();
+
+  const su2double rmsDirection = u.norm() / sqrtNumUnknowns;
+
+  if (rmsDirection == 0.0) {
+    v = Scalar(0.0);
+    SU2_OMP_BARRIER
+    return;
+  }
+
+  const su2double eps = finDiffStep / rmsDirection;
+
+  /*--- Perturb the solution of the owned points, the halos are communicated. ---*/
+
+  SU2_OMP_FOR_STAT(roundUpDiv(nPointDomain, omp_get_num_threads()))
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++)
+    for (auto iVar = 0ul; iVar < nVar; iVar++)
+      nodes->SetSolution(iPoint, iVar, solution0(iPoint,iVar) + eps * u(iPoint,iVar));
+
+  SU2_OMP_MASTER
+  {
+    solver->InitiateComms(geometry, config, SOLUTION);
+    solver->CompleteComms(geometry, config, SOLUTION);
+  }
+  SU2_OMP_BARRIER
+
+  ComputeResiduals();
+
+  /*--- Finite differences plus pseudo time term, the rows of points without time step
+   *    are identity rows (as in the implicit system). Then restore the solution. ---*/
+
+  SU2_OMP_FOR_STAT(roundUpDiv(nPointDomain, omp_get_num_threads()))
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+
+    const su2double dt = nodes->GetDelta_Time(iPoint);
+
+    if (dt != 0.0) {
+      const su2double Delta = (geometry->node[iPoint]->GetVolume() +
+                               geometry->node[iPoint]->GetPeriodicVolume()) / dt;
+
+      for (auto iVar = 0ul; iVar < nVar; iVar++) {
+        const su2double dRes = (solver->LinSysRes(iPoint,iVar) - residual0(iPoint,iVar)) / eps;
+        v(iPoint,iVar) = ToScalar<Scalar>(Delta * u(iPoint,iVar) + dRes);
+      }
+    }
+    else {
+      for (auto iVar = 0ul; iVar < nVar; iVar++)
+        v(iPoint,iVar) = u(iPoint,iVar);
+    }
+  }
+
+  SU2_OMP_FOR_STAT(roundUpDiv(nPoint, omp_get_num_threads()))
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
+    for (auto iVar = 0ul; iVar < nVar; iVar++)
+      nodes->SetSolution(iPoint, iVar, solution0(iPoint,iVar));
+
+  /*--- MPI Parallelization ---*/
+
+  solver->Jacobian.CommunicateHalos(v, geometry, config);
+}
+
+void CNewtonIntegration::ComputeADJacobian() {
+
+#ifdef CODI_FORWARD_TYPE
+  CSolver* solver = solvers[FLOW_SOL];
+  CVariable* nodes = solver->GetNodes();
+
+  const auto nPoint = geometry->GetnPoint();
+  const auto nPointDomain = geometry->GetnPointDomain();
+  const auto nVar = solver->GetnVar();
+
+  solver->Jacobian.SetValZero();
+
+  auto seed = [&](unsigned long iPoint, unsigned long iVar, unsigned long iDir, bool on) {
+    SU2_TYPE::SetDerivative(nodes->GetSolution(iPoint)[iVar], iDir, on? 1.0 : 0.0);
+  };
+
+  auto evaluate = [&]() { ComputeResiduals(); };
+
+  auto store = [&](unsigned long iPoint, unsigned long jPoint, unsigned long jVar, unsigned long iDir) {
+    if (iPoint >= nPointDomain) return;
+    auto block = solver->Jacobian.GetBlock(iPoint, jPoint);
+    if (!block) return;
+    for (auto iVar = 0ul; iVar < nVar; iVar++)
+      block[iVar*nVar+jVar] = SU2_TYPE::GetDerivative(solver->LinSysRes(iPoint,iVar), iDir);
+  };
+
+  computeColoredJacobian(stencil, coloring, pointColor, nVar, SU2_TYPE::GetnDirections(), seed, evaluate, store);
+
+  /*--- Restore the residual of the linearization state (without derivatives). ---*/
+
+  SU2_OMP_FOR_STAT(roundUpDiv(nPoint, omp_get_num_threads()))
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
+    for (auto iVar = 0ul; iVar < nVar; iVar++)
+      solver->LinSysRes(iPoint,iVar) = SU2_TYPE::GetValue(residual0(iPoint,iVar));
+#endif
+}
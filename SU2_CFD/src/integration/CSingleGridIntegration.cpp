@@ -26,6 +26,7 @@
  */
 
 #include "../../include/integration/CSingleGridIntegration.hpp"
+#include "../../../Common/include/toolboxes/CRegionProfiler.hpp"
 #include "../../../Common/include/omp_structure.hpp"
 
 
@@ -50,8 +51,11 @@ void CSingleGridIntegration::SingleGrid_Iteration(CGeometry ****geometry, CSolve
 
   /*--- Preprocessing ---*/
 
+  {
+  SU2_PROFILE_REGION("Solver preprocessing");
   solvers_fine[Solver_Position]->Preprocessing(geometry_fine, solvers_fine, config[iZone],
                                                FinestMesh, 0, RunTime_EqSystem, false);
+  }
 
   /*--- Set the old solution ---*/
 
@@ -111,12 +115,13 @@ void CSingleGridIntegration::SingleGrid_Iteration(CGeometry ****geometry, CSolve
 
 void CSingleGridIntegration::SetRestricted_Solution(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse,
                                                     CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config) {
-  unsigned long Point_Fine, Point_Coarse;
-  unsigned short iVar, iChildren;
+  unsigned long Point_Fine, Point_Coarse, iChildren;
+  unsigned short iVar;
   su2double Area_Parent, Area_Children;
   const su2double *Solution_Fine;
 
   unsigned short nVar = sol_coarse->GetnVar();
+  const auto& children = geo_coarse->GetChildren_CSR();
 
   su2double *Solution = new su2double[nVar];
 
@@ -129,9 +134,9 @@ void CSingleGridIntegration::SetRestricted_Solution(unsigned short RunTime_EqSys
 
     for (iVar = 0; iVar < nVar; iVar++) Solution[iVar] = 0.0;
 
-    for (iChildren = 0; iChildren < geo_coarse->node[Point_Coarse]->GetnChildren_CV(); iChildren++) {
+    for (iChildren = 0; iChildren < children.getNumNonZeros(Point_Coarse); iChildren++) {
 
-      Point_Fine = geo_coarse->node[Point_Coarse]->GetChildren_CV(iChildren);
+      Point_Fine = children.getInnerIdx(Point_Coarse, iChildren);
       Area_Children = geo_fine->node[Point_Fine]->GetVolume();
       Solution_Fine = sol_fine->GetNodes()->GetSolution(Point_Fine);
       for (iVar = 0; iVar < nVar; iVar++)
@@ -154,58 +159,3 @@ void CSingleGridIntegration::SetRestricted_Solution(unsigned short RunTime_EqSys
   SU2_OMP_BARRIER
 
 }
-
-void CSingleGridIntegration::SetRestricted_EddyVisc(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse,
-                                                    CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config) {
-
-  unsigned long iVertex, Point_Fine, Point_Coarse;
-  unsigned short iMarker, iChildren;
-  su2double Area_Parent, Area_Children, EddyVisc_Fine, EddyVisc;
-
-  /*--- Compute coarse Eddy Viscosity from fine solution ---*/
-
-  SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPointDomain(), omp_get_num_threads()))
-  for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
-
-    Area_Parent = geo_coarse->node[Point_Coarse]->GetVolume();
-
-    EddyVisc = 0.0;
-
-    for (iChildren = 0; iChildren < geo_coarse->node[Point_Coarse]->GetnChildren_CV(); iChildren++) {
-      Point_Fine = geo_coarse->node[Point_Coarse]->GetChildren_CV(iChildren);
-      Area_Children = geo_fine->node[Point_Fine]->GetVolume();
-      EddyVisc_Fine = sol_fine->GetNodes()->GetmuT(Point_Fine);
-      EddyVisc += EddyVisc_Fine*Area_Children/Area_Parent;
-    }
-
-    sol_coarse->GetNodes()->SetmuT(Point_Coarse,EddyVisc);
-
-  }
-
-  /*--- Update solution at the no slip wall boundary, only the first
-   variable (nu_tilde -in SA and SA_NEG- and k -in SST-), to guarantee that the eddy viscoisty
-   is zero on the surface ---*/
-
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-    if ((config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX) ||
-        (config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL) ||
-        (config->GetMarker_All_KindBC(iMarker) == CHT_WALL_INTERFACE)) {
-
-      SU2_OMP_FOR_STAT(32)
-      for (iVertex = 0; iVertex < geo_coarse->nVertex[iMarker]; iVertex++) {
-        Point_Coarse = geo_coarse->vertex[iMarker][iVertex]->GetNode();
-        sol_coarse->GetNodes()->SetmuT(Point_Coarse,0.0);
-      }
-    }
-  }
-
-  /*--- MPI the new interpolated solution (this also includes the eddy viscosity) ---*/
-
-  SU2_OMP_MASTER
-  {
-    sol_coarse->InitiateComms(geo_coarse, config, SOLUTION_EDDY);
-    sol_coarse->CompleteComms(geo_coarse, config, SOLUTION_EDDY);
-  }
-  SU2_OMP_BARRIER
-
-}
@@ -104,9 +104,11 @@ void CStructuralIntegration::Space_Integration_FEM(CGeometry *geometry, CSolver
     }
 
     /*--- If the method is modified Newton-Raphson, the stiffness matrix is only computed once at the beginning
-     * of the time step, then only the Nodal Stress Term has to be computed on each iteration. ---*/
-    if (IterativeScheme == MODIFIED_NEWTON_RAPHSON) {
-      if (first_iter)
+     * of the time step, then only the Nodal Stress Term has to be computed on each iteration. Unless the solver
+     * requests a new tangent (FEA_TANGENT_UPDATE_ITER, FEA_TANGENT_STALL_RATIO). The quasi-Newton method
+     * corrects the frozen tangent with BFGS updates, see CFEASolver::Solve_System. ---*/
+    if ((IterativeScheme == MODIFIED_NEWTON_RAPHSON) || (IterativeScheme == QUASI_NEWTON_BFGS)) {
+      if (first_iter || solver->GetTangentRefresh())
         solver->Compute_StiffMatrix_NodalStressRes(geometry, numerics, config);
       else
         solver->Compute_NodalStressRes(geometry, numerics, config);
@@ -27,6 +27,8 @@
 
 #include "../../include/interfaces/CInterface.hpp"
 
+#include <unordered_map>
+
 CInterface::CInterface(void) {
 
   rank = SU2_MPI::GetRank();
@@ -87,285 +89,292 @@ CInterface::~CInterface(void) {
 
 }
 
-void CInterface::BroadcastData(CSolver *donor_solution, CSolver *target_solution,
-                               CGeometry *donor_geometry, CGeometry *target_geometry,
-                               CConfig *donor_config, CConfig *target_config) {
+void CInterface::SetTransferPattern(CGeometry *donor_geometry, CGeometry *target_geometry,
+                                    CConfig *donor_config, CConfig *target_config) {
 
+  unsigned short iMarkerInt, iMarker;
+  unsigned long iVertex, iPoint;
+  unsigned short iDonorPoint, nDonorPoints;
+  int iRank;
 
-  unsigned short nMarkerInt, nMarkerDonor, nMarkerTarget; // Number of markers on the interface, donor and target side
-  unsigned short iMarkerInt, iMarkerDonor, iMarkerTarget; // Variables for iteration over markers
-  int Marker_Donor, Marker_Target;
-  int Target_check, Donor_check;
+  const unsigned short nMarkerInt = (donor_config->GetMarker_n_ZoneInterface())/2;
 
-  unsigned long iVertex;                            // Variables for iteration over vertices and nodes
+  transferPattern.clear();
+  transferPattern.resize(nMarkerInt);
 
-  unsigned short iVar;
+  /*--- The tags are always an integer greater than 1: loop from 1 to nMarkerInt ---*/
 
-  GetPhysical_Constants(donor_solution, target_solution, donor_geometry, target_geometry,
-                        donor_config, target_config);
+  for (iMarkerInt = 1; iMarkerInt <= nMarkerInt; iMarkerInt++) {
 
-  unsigned long Point_Donor_Global, Donor_Global_Index;
-  unsigned long Point_Donor, Point_Target;
+    CTransferPattern &pattern = transferPattern[iMarkerInt-1];
 
-#ifdef HAVE_MPI
-  int *Buffer_Recv_mark = NULL, iRank;
-
-  if (rank == MASTER_NODE)
-    Buffer_Recv_mark = new int[size];
-#endif
+    /*--- Identify the donor and target markers of the interface on this rank ---*/
 
-  unsigned long Buffer_Send_nVertexDonor[1], *Buffer_Recv_nVertexDonor;
-  unsigned long iLocalVertex = 0;
-  unsigned long nLocalVertexDonor = 0, nLocalVertexDonorOwned = 0;
+    for (iMarker = 0; iMarker < donor_config->GetnMarker_All(); iMarker++) {
+      if (donor_config->GetMarker_All_ZoneInterface(iMarker) == iMarkerInt) {
+        pattern.markerDonor = iMarker;
+        break;
+      }
+    }
+    for (iMarker = 0; iMarker < target_config->GetnMarker_All(); iMarker++) {
+      if (target_config->GetMarker_All_ZoneInterface(iMarker) == iMarkerInt) {
+        pattern.markerTarget = iMarker;
+        break;
+      }
+    }
 
-  unsigned long MaxLocalVertexDonor = 0, TotalVertexDonor = 0;
+    /*--- Check whether the boundary is not on the processor because of the partition
+     or because the zone does not include it ---*/
 
-  unsigned long nBuffer_DonorVariables = 0;
-  unsigned long nBuffer_DonorIndices = 0;
+    int Donor_check = -1, Target_check = -1;
+    SU2_MPI::Allreduce(&pattern.markerDonor, &Donor_check, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(&pattern.markerTarget, &Target_check, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
 
-  unsigned long nBuffer_BcastVariables = 0, nBuffer_BcastIndices = 0;
+    pattern.active = (Target_check != -1) && (Donor_check != -1);
+    if (!pattern.active) continue;
 
-  int nProcessor = 0;
+    /*--- Owned donor vertices of this rank, the global indices of all ranks are
+     gathered once to know the owner of each donor point ---*/
 
-  /*--- Number of markers on the FSI interface ---*/
+    unordered_map<long, unsigned long> localDonorVertex;
+    vector<long> ownedDonors;
 
-  nMarkerInt     = (donor_config->GetMarker_n_ZoneInterface())/2;
-  nMarkerTarget  = target_config->GetnMarker_All();
-  nMarkerDonor   = donor_config->GetnMarker_All();
+    if (pattern.markerDonor != -1) {
+      for (iVertex = 0; iVertex < donor_geometry->GetnVertex(pattern.markerDonor); iVertex++) {
+        iPoint = donor_geometry->vertex[pattern.markerDonor][iVertex]->GetNode();
+        if (donor_geometry->node[iPoint]->GetDomain()) {
+          const long globalIndex = donor_geometry->node[iPoint]->GetGlobalIndex();
+          localDonorVertex[globalIndex] = iVertex;
+          ownedDonors.push_back(globalIndex);
+        }
+      }
+    }
 
-  nProcessor = size;
+    int nOwned = ownedDonors.size();
+    vector<int> nOwnedRank(size), displs(size, 0);
+    SU2_MPI::Allgather(&nOwned, 1, MPI_INT, nOwnedRank.data(), 1, MPI_INT, MPI_COMM_WORLD);
+    for (iRank = 1; iRank < size; iRank++) displs[iRank] = displs[iRank-1] + nOwnedRank[iRank-1];
 
-  /*--- Outer loop over the markers on the FSI interface: compute one by one ---*/
-  /*--- The tags are always an integer greater than 1: loop from 1 to nMarkerFSI ---*/
+    vector<long> allDonors(displs[size-1] + nOwnedRank[size-1]);
+    SU2_MPI::Allgatherv(ownedDonors.data(), nOwned, MPI_LONG, allDonors.data(),
+                        nOwnedRank.data(), displs.data(), MPI_LONG, MPI_COMM_WORLD);
 
-  for (iMarkerInt = 1; iMarkerInt <= nMarkerInt; iMarkerInt++) {
+    unordered_map<long, int> donorOwner;
+    for (iRank = 0; iRank < size; iRank++)
+      for (int i = displs[iRank]; i < displs[iRank]+nOwnedRank[iRank]; i++)
+        donorOwner[allDonors[i]] = iRank;
+    allDonors.clear();
 
-    Buffer_Recv_nVertexDonor = NULL;
+    /*--- Donor points required by the owned target vertices, numbered per owner ---*/
 
-    Marker_Donor = -1;
-    Marker_Target = -1;
+    vector<vector<long> > requested(size);
+    vector<unordered_map<long, unsigned long> > requestedPosition(size);
+    vector<int> donorRank;
 
-    /*--- The donor and target markers are tagged with the same index.
-     *--- This is independent of the MPI domain decomposition.
-     *--- We need to loop over all markers on both sides and get the number of nodes
-     *--- that belong to each FSI marker for each processor ---*/
+    if (pattern.markerTarget != -1) {
+      for (iVertex = 0; iVertex < target_geometry->GetnVertex(pattern.markerTarget); iVertex++) {
+        iPoint = target_geometry->vertex[pattern.markerTarget][iVertex]->GetNode();
+        if (!target_geometry->node[iPoint]->GetDomain()) continue;
 
-    /*--- On the donor side ---*/
+        CVertex *vertex = target_geometry->vertex[pattern.markerTarget][iVertex];
+        nDonorPoints = vertex->GetnDonorPoints();
 
-    for (iMarkerDonor = 0; iMarkerDonor < nMarkerDonor; iMarkerDonor++) {
-      /*--- If the tag GetMarker_All_ZoneInterface(iMarkerDonor) equals the index we are looping at ---*/
-      if ( donor_config->GetMarker_All_ZoneInterface(iMarkerDonor) == iMarkerInt ) {
-        /*--- Store the identifier for the structural marker ---*/
-        Marker_Donor = iMarkerDonor;
-        /*--- Exit the for loop: we have found the local index for iMarkerFSI on the FEA side ---*/
-        break;
-      }
-    }
+        for (iDonorPoint = 0; iDonorPoint < nDonorPoints; iDonorPoint++) {
+          const long globalIndex = vertex->GetInterpDonorPoint(iDonorPoint);
+          const auto owner = donorOwner.find(globalIndex);
+          if (owner == donorOwner.end())
+            SU2_MPI::Error("A donor point of the interface is not an owned point of the donor marker.", CURRENT_FUNCTION);
 
-    /*--- On the target side we only have to identify the marker;
-     * then we'll loop over it and retrieve from the donor points ---*/
+          const int jRank = owner->second;
+          const auto position = requestedPosition[jRank].insert(make_pair(globalIndex, requested[jRank].size()));
+          if (position.second) requested[jRank].push_back(globalIndex);
 
-    for (iMarkerTarget = 0; iMarkerTarget < nMarkerTarget; iMarkerTarget++) {
-      /*--- If the tag GetMarker_All_ZoneInterface(iMarkerFlow) equals the index we are looping at ---*/
-      if ( target_config->GetMarker_All_ZoneInterface(iMarkerTarget) == iMarkerInt ) {
-        /*--- Store the identifier for the fluid marker ---*/
-        Marker_Target = iMarkerTarget;
-        /*--- Exit the for loop: we have found the local index for iMarkerFSI on the FEA side ---*/
-        break;
+          donorRank.push_back(jRank);
+          pattern.donorPosition.push_back(position.first->second);
+        }
       }
     }
 
-#ifdef HAVE_MPI
-
-    Donor_check  = -1;
-    Target_check = -1;
+    /*--- Receive buffer ordered by source rank ---*/
 
-    /*--- We gather a vector in MASTER_NODE that determines if the boundary is not on the processor
-     * because of the partition or because the zone does not include it  ---*/
+    vector<int> nRecv(size), nSend(size), recvDispls(size, 0), sendDispls(size, 0);
+    vector<unsigned long> recvOffset(size, 0);
+    unsigned long nRecvTotal = 0;
 
-    SU2_MPI::Gather(&Marker_Donor , 1, MPI_INT, Buffer_Recv_mark, 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
-
-    if (rank == MASTER_NODE) {
-      for (iRank = 0; iRank < nProcessor; iRank++) {
-        if( Buffer_Recv_mark[iRank] != -1 ) {
-          Donor_check = Buffer_Recv_mark[iRank];
-          break;
-        }
+    for (iRank = 0; iRank < size; iRank++) {
+      nRecv[iRank] = requested[iRank].size();
+      recvOffset[iRank] = nRecvTotal;
+      nRecvTotal += nRecv[iRank];
+      if (nRecv[iRank] > 0) {
+        pattern.recvRank.push_back(iRank);
+        pattern.recvStart.push_back(recvOffset[iRank]);
       }
     }
+    pattern.recvStart.push_back(nRecvTotal);
 
-    SU2_MPI::Bcast(&Donor_check , 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+    for (unsigned long iDonor = 0; iDonor < pattern.donorPosition.size(); iDonor++)
+      pattern.donorPosition[iDonor] += recvOffset[donorRank[iDonor]];
 
-    SU2_MPI::Gather(&Marker_Target, 1, MPI_INT, Buffer_Recv_mark, 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+    /*--- Send the requested global indices to their owners ---*/
 
-    if (rank == MASTER_NODE) {
-      for (iRank = 0; iRank < nProcessor; iRank++) {
-        if( Buffer_Recv_mark[iRank] != -1 ) {
-          Target_check = Buffer_Recv_mark[iRank];
-          break;
-        }
+    SU2_MPI::Alltoall(nRecv.data(), 1, MPI_INT, nSend.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+    vector<long> requestBuf, replyBuf;
+    for (iRank = 0; iRank < size; iRank++) {
+      requestBuf.insert(requestBuf.end(), requested[iRank].begin(), requested[iRank].end());
+      if (iRank > 0) {
+        recvDispls[iRank] = recvDispls[iRank-1] + nRecv[iRank-1];
+        sendDispls[iRank] = sendDispls[iRank-1] + nSend[iRank-1];
       }
     }
+    replyBuf.resize(sendDispls[size-1] + nSend[size-1]);
 
-    SU2_MPI::Bcast(&Target_check, 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Alltoallv(requestBuf.data(), nRecv.data(), recvDispls.data(), MPI_LONG,
+                       replyBuf.data(), nSend.data(), sendDispls.data(), MPI_LONG, MPI_COMM_WORLD);
 
-#else
-    Donor_check  = Marker_Donor;
-    Target_check = Marker_Target;
-#endif
+    /*--- Donor vertices sent to each destination ---*/
 
-    if(Target_check == -1 || Donor_check == -1) {
-      continue;
+    for (iRank = 0; iRank < size; iRank++) {
+      if (nSend[iRank] == 0) continue;
+      pattern.sendRank.push_back(iRank);
+      pattern.sendStart.push_back(pattern.sendVertex.size());
+      for (int i = sendDispls[iRank]; i < sendDispls[iRank]+nSend[iRank]; i++)
+        pattern.sendVertex.push_back(localDonorVertex[replyBuf[i]]);
     }
+    pattern.sendStart.push_back(pattern.sendVertex.size());
+  }
 
-    nLocalVertexDonorOwned = 0;
-    nLocalVertexDonor      = 0;
-
-    if( Marker_Donor != -1 ) {
-      nLocalVertexDonor = donor_geometry->GetnVertex(Marker_Donor);
+  transferPatternOutdated = false;
 
-      for (iVertex = 0; iVertex < nLocalVertexDonor; iVertex++) {
-        Point_Donor = donor_geometry->vertex[Marker_Donor][iVertex]->GetNode();
-        if (donor_geometry->node[Point_Donor]->GetDomain())
-          nLocalVertexDonorOwned++;
-      }
-    }
-
-    Buffer_Send_nVertexDonor[0] = nLocalVertexDonor;    // Retrieve total number of vertices on Donor marker
+}
 
-    // Allocate memory to receive how many vertices are on each rank on the structural side
-    if (rank == MASTER_NODE) Buffer_Recv_nVertexDonor = new unsigned long[size];
+void CInterface::BroadcastData(CSolver *donor_solution, CSolver *target_solution,
+                               CGeometry *donor_geometry, CGeometry *target_geometry,
+                               CConfig *donor_config, CConfig *target_config) {
 
-#ifdef HAVE_MPI
-    /*--- We receive MaxLocalVertexDonor as the maximum number of vertices
-     * in one single processor on the donor side---*/
-    SU2_MPI::Allreduce(&nLocalVertexDonor, &MaxLocalVertexDonor, 1, MPI_UNSIGNED_LONG, MPI_MAX, MPI_COMM_WORLD);
-    /*--- We receive TotalVertexDonorOwned as the total (real) number of vertices
-     * in one single interface marker on the donor side ---*/
-    SU2_MPI::Allreduce(&nLocalVertexDonorOwned, &TotalVertexDonor, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
-    /*--- We gather a vector in MASTER_NODE that determines how many elements are there
-     * on each processor on the structural side ---*/
-    SU2_MPI::Gather(&Buffer_Send_nVertexDonor, 1, MPI_UNSIGNED_LONG, Buffer_Recv_nVertexDonor, 1,
-                    MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
-#else
-    MaxLocalVertexDonor         = nLocalVertexDonor;
-    TotalVertexDonor            = nLocalVertexDonorOwned;
-    Buffer_Recv_nVertexDonor[0] = Buffer_Send_nVertexDonor[0];
-#endif
+  InitiateTransfer(donor_solution, target_solution, donor_geometry, target_geometry,
+                   donor_config, target_config);
 
-    /*--- We will be gathering the donor information into the master node ---*/
-    nBuffer_DonorVariables = MaxLocalVertexDonor * nVar;
-    nBuffer_DonorIndices   = MaxLocalVertexDonor;
+  CompleteTransfers();
 
-    /*--- Then we will broadcasting it to all the processors so they can retrieve the info they need ---*/
-    /*--- We only broadcast those nodes that we need ---*/
-    nBuffer_BcastVariables = TotalVertexDonor * nVar;
-    nBuffer_BcastIndices   = TotalVertexDonor;
+}
 
-    /*--- Send and Recv buffers ---*/
+void CInterface::InitiateTransfer(CSolver *donor_solution, CSolver *target_solution,
+                                  CGeometry *donor_geometry, CGeometry *target_geometry,
+                                  CConfig *donor_config, CConfig *target_config) {
 
-    /*--- Buffers to send and receive the variables in the donor mesh ---*/
-    su2double *Buffer_Send_DonorVariables = new su2double[nBuffer_DonorVariables];
-    su2double *Buffer_Recv_DonorVariables = NULL;
+  unsigned short iVar;
+  unsigned long iVertex, iSend, Point_Donor;
 
-    /*--- Buffers to send and receive the indices in the donor mesh ---*/
-    long *Buffer_Send_DonorIndices = new long[nBuffer_DonorIndices];
-    long *Buffer_Recv_DonorIndices = NULL;
+  GetPhysical_Constants(donor_solution, target_solution, donor_geometry, target_geometry,
+                        donor_config, target_config);
 
-    /*--- Buffers to broadcast the variables and the indices ---*/
-    su2double *Buffer_Bcast_Variables = new su2double[nBuffer_BcastVariables];
-    long *Buffer_Bcast_Indices        = new long[nBuffer_BcastIndices];
+  /*--- The communication pattern only depends on the donor information of the
+   target vertices, it is built on the first transfer and after it changes.
+   The pending transfers use the old pattern and are completed before. ---*/
 
-    /*--- Prepare the receive buffers (1st step) and send buffers (2nd step) on the master node only. ---*/
+  if (transferPatternOutdated) {
+    CompleteTransfers();
+    SetTransferPattern(donor_geometry, target_geometry, donor_config, target_config);
+  }
 
-    if (rank == MASTER_NODE) {
-      Buffer_Recv_DonorVariables  = new su2double[size*nBuffer_DonorVariables];
-      Buffer_Recv_DonorIndices    = new long[size*nBuffer_DonorIndices];
-    }
+  pendingTransfers.emplace_back();
+  CPendingTransfer &transfer = pendingTransfers.back();
 
-    /*--- On the donor side ---*/
-    /*--- First we initialize all of the indices and processors to -1 ---*/
-    /*--- This helps on identifying halo nodes and avoids setting wrong values ---*/
-    for (iVertex = 0; iVertex < nBuffer_DonorIndices; iVertex++)
-      Buffer_Send_DonorIndices[iVertex] = -1;
+  transfer.target_solution = target_solution;
+  transfer.target_geometry = target_geometry;
+  transfer.target_config   = target_config;
+  transfer.sendBuffer.resize(transferPattern.size());
+  transfer.recvBuffer.resize(transferPattern.size());
 
+  /*--- The requests are not reallocated once posted ---*/
 
-    for (iVertex = 0; iVertex < nLocalVertexDonor; iVertex++) {
-      Point_Donor = donor_geometry->vertex[Marker_Donor][iVertex]->GetNode();
+  size_t nRequest = 0;
+  for (const auto &pattern : transferPattern)
+    nRequest += pattern.sendRank.size() + pattern.recvRank.size();
+  transfer.request.reserve(nRequest);
 
-      /*--- If this processor owns the node ---*/
+  for (unsigned long iPattern = 0; iPattern < transferPattern.size(); iPattern++) {
 
-      if (donor_geometry->node[Point_Donor]->GetDomain()) {
+    const CTransferPattern &pattern = transferPattern[iPattern];
+    if (!pattern.active) continue;
 
-        GetDonor_Variable(donor_solution, donor_geometry, donor_config, Marker_Donor, iVertex, Point_Donor);
+    const int Marker_Donor = pattern.markerDonor;
 
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Send_DonorVariables[iVertex*nVar+iVar] = Donor_Variable[iVar];
+    /*--- Variables of the donor vertices required by each destination ---*/
 
-        Point_Donor_Global = donor_geometry->node[Point_Donor]->GetGlobalIndex();
-        Buffer_Send_DonorIndices[iVertex]     = Point_Donor_Global;
-      }
+    vector<su2double> &Buffer_Send_Variables = transfer.sendBuffer[iPattern];
+    vector<su2double> &Buffer_Recv_Variables = transfer.recvBuffer[iPattern];
 
-    }
+    Buffer_Send_Variables.resize(pattern.sendVertex.size()*nVar);
+    Buffer_Recv_Variables.resize(pattern.recvStart.back()*nVar);
 
-#ifdef HAVE_MPI
-    /*--- Once all the messages have been prepared, we gather them all into the MASTER_NODE ---*/
-    SU2_MPI::Gather(Buffer_Send_DonorVariables, nBuffer_DonorVariables, MPI_DOUBLE, Buffer_Recv_DonorVariables,
-                    nBuffer_DonorVariables, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Gather(Buffer_Send_DonorIndices, nBuffer_DonorIndices, MPI_LONG, Buffer_Recv_DonorIndices,
-                    nBuffer_DonorIndices, MPI_LONG, MASTER_NODE, MPI_COMM_WORLD);
-
-#else
-    for (unsigned long iVariable = 0; iVariable < nBuffer_DonorVariables; iVariable++)
-      Buffer_Recv_DonorVariables[iVariable] = Buffer_Send_DonorVariables[iVariable];
-    for (unsigned long iVariable = 0; iVariable < nBuffer_DonorIndices; iVariable++)
-      Buffer_Recv_DonorIndices[iVariable] = Buffer_Send_DonorIndices[iVariable];
-#endif
+    for (iSend = 0; iSend < pattern.sendVertex.size(); iSend++) {
+      iVertex = pattern.sendVertex[iSend];
+      Point_Donor = donor_geometry->vertex[Marker_Donor][iVertex]->GetNode();
 
-    /*--- Now we pack the information to send it over to the different processors ---*/
+      GetDonor_Variable(donor_solution, donor_geometry, donor_config, Marker_Donor, iVertex, Point_Donor);
 
-    if (rank == MASTER_NODE) {
+      for (iVar = 0; iVar < nVar; iVar++)
+        Buffer_Send_Variables[iSend*nVar+iVar] = Donor_Variable[iVar];
+    }
 
-      /*--- For all the data we have received ---*/
-      /*--- We initialize a counter to determine the position in the broadcast vector ---*/
-      iLocalVertex = 0;
+    /*--- Point-to-point exchange with the ranks that contribute, the part of this rank is copied ---*/
 
-      for (iVertex = 0; iVertex < nProcessor*nBuffer_DonorIndices; iVertex++) {
+    for (unsigned long iRecv = 0; iRecv < pattern.recvRank.size(); iRecv++) {
+      if (pattern.recvRank[iRecv] == rank) continue;
+      const unsigned long start = pattern.recvStart[iRecv]*nVar;
+      const int count = (pattern.recvStart[iRecv+1]-pattern.recvStart[iRecv])*nVar;
+      transfer.request.push_back(SU2_MPI::Request());
+      SU2_MPI::Irecv(&Buffer_Recv_Variables[start], count, MPI_DOUBLE, pattern.recvRank[iRecv],
+                     pattern.recvRank[iRecv], MPI_COMM_WORLD, &transfer.request.back());
+    }
 
-        /*--- If the donor index is not -1 (this is, if the node is not originally a halo node) ---*/
-        if (Buffer_Recv_DonorIndices[iVertex] != -1) {
+    for (iSend = 0; iSend < pattern.sendRank.size(); iSend++) {
+      const unsigned long start = pattern.sendStart[iSend]*nVar;
+      const int count = (pattern.sendStart[iSend+1]-pattern.sendStart[iSend])*nVar;
 
-          /*--- We set the donor index ---*/
-          Buffer_Bcast_Indices[iLocalVertex] = Buffer_Recv_DonorIndices[iVertex];
+      if (pattern.sendRank[iSend] == rank) {
+        const unsigned long iRecv = distance(pattern.recvRank.begin(),
+                                             find(pattern.recvRank.begin(), pattern.recvRank.end(), rank));
+        copy(&Buffer_Send_Variables[start], &Buffer_Send_Variables[start]+count,
+             &Buffer_Recv_Variables[pattern.recvStart[iRecv]*nVar]);
+        continue;
+      }
+      transfer.request.push_back(SU2_MPI::Request());
+      SU2_MPI::Isend(&Buffer_Send_Variables[start], count, MPI_DOUBLE, pattern.sendRank[iSend],
+                     rank, MPI_COMM_WORLD, &transfer.request.back());
+    }
+  }
 
-          for (iVar = 0; iVar < nVar; iVar++)
-            Buffer_Bcast_Variables[iLocalVertex*nVar+iVar] = Buffer_Recv_DonorVariables[iVertex*nVar + iVar];
+}
 
+void CInterface::CompleteTransfers(void) {
 
-          iLocalVertex++;
+  unsigned short iDonorPoint, nDonorPoints;
+  unsigned long iVertex, iDonor, Point_Target;
+  su2double donorCoeff;
 
-        }
+  for (auto &transfer : pendingTransfers) {
 
-        if (iLocalVertex == TotalVertexDonor) break;
+    if (!transfer.request.empty())
+      SU2_MPI::Waitall(transfer.request.size(), transfer.request.data(), MPI_STATUS_IGNORE);
 
-      }
+    CSolver *target_solution = transfer.target_solution;
+    CGeometry *target_geometry = transfer.target_geometry;
+    CConfig *target_config = transfer.target_config;
 
-    }
+    for (unsigned long iPattern = 0; iPattern < transferPattern.size(); iPattern++) {
 
-#ifdef HAVE_MPI
-    SU2_MPI::Bcast(Buffer_Bcast_Variables, nBuffer_BcastVariables, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Bcast(Buffer_Bcast_Indices, nBuffer_BcastIndices, MPI_LONG, MASTER_NODE, MPI_COMM_WORLD);
-#endif
+      const CTransferPattern &pattern = transferPattern[iPattern];
 
-    long indexPoint_iVertex;
-    unsigned short iDonorPoint, nDonorPoints;
-    su2double donorCoeff;
+      /*--- For the target marker we are studying ---*/
+      if (!pattern.active || (pattern.markerTarget < 0)) continue;
 
-    /*--- For the target marker we are studying ---*/
-    if (Marker_Target >= 0) {
+      const int Marker_Target = pattern.markerTarget;
+      su2double *Buffer_Recv_Variables = transfer.recvBuffer[iPattern].data();
 
-      /*--- We have identified the local index of the Structural marker ---*/
-      /*--- We loop over all the vertices in that marker and in that particular processor ---*/
+      iDonor = 0;
 
       for (iVertex = 0; iVertex < target_geometry->GetnVertex(Marker_Target); iVertex++) {
 
@@ -373,29 +382,18 @@ void CInterface::BroadcastData(CSolver *donor_solution, CSolver *target_solution
 
         /*--- If this processor owns the node ---*/
         if (target_geometry->node[Point_Target]->GetDomain()) {
-          TotalVertexDonor++;
           nDonorPoints = target_geometry->vertex[Marker_Target][iVertex]->GetnDonorPoints();
 
           InitializeTarget_Variable(target_solution, Marker_Target, iVertex, nDonorPoints);
 
           /*--- For the number of donor points ---*/
-          for (iDonorPoint = 0; iDonorPoint < nDonorPoints; iDonorPoint++) {
-
-            /*--- Find the global index of the donor points for Point_Target ---*/
-            Donor_Global_Index = target_geometry->vertex[Marker_Target][iVertex]->GetInterpDonorPoint(iDonorPoint);
+          for (iDonorPoint = 0; iDonorPoint < nDonorPoints; iDonorPoint++, iDonor++) {
 
             /*--- We need to get the donor coefficient in a way like this: ---*/
             donorCoeff = target_geometry->vertex[Marker_Target][iVertex]->GetDonorCoeff(iDonorPoint);
 
-            /*--- Find the index of the global donor point in the buffer Buffer_Bcast_Indices ---*/
-
-            indexPoint_iVertex = std::distance(Buffer_Bcast_Indices,
-                                               std::find(Buffer_Bcast_Indices,
-                                                         Buffer_Bcast_Indices + nBuffer_BcastIndices,
-                                                         Donor_Global_Index));
-
             /*--- Recover the Target_Variable from the buffer of variables ---*/
-            RecoverTarget_Variable(indexPoint_iVertex, Buffer_Bcast_Variables, donorCoeff);
+            RecoverTarget_Variable(pattern.donorPosition[iDonor], Buffer_Recv_Variables, donorCoeff);
 
             /*--- If the value is not directly aggregated in the previous function ---*/
             if (!valAggregated) SetTarget_Variable(target_solution, target_geometry, target_config,
@@ -413,23 +411,12 @@ void CInterface::BroadcastData(CSolver *donor_solution, CSolver *target_solution
 
     }
 
-    delete [] Buffer_Send_DonorVariables;
-    delete [] Buffer_Send_DonorIndices;
-    delete [] Buffer_Bcast_Variables;
-    delete [] Buffer_Bcast_Indices;
-
-    if (rank == MASTER_NODE) {
-      delete [] Buffer_Recv_nVertexDonor;
-      delete [] Buffer_Recv_DonorVariables;
-      delete [] Buffer_Recv_DonorIndices;
-    }
+    FinalizeTarget_Variables(target_solution, target_geometry, target_config);
 
   }
 
-#ifdef HAVE_MPI
-  if (rank == MASTER_NODE && Buffer_Recv_mark != NULL)
-    delete [] Buffer_Recv_mark;
-#endif
+  pendingTransfers.clear();
+
 }
 
 void CInterface::PreprocessAverage(CGeometry *donor_geometry, CGeometry *target_geometry,
@@ -587,10 +574,6 @@ void CInterface::AllgatherAverage(CSolver *donor_solution, CSolver *target_solut
 
 #ifdef HAVE_MPI
   int iSize;
-  su2double *BuffAvgPressureDonor = NULL, *BuffAvgDensityDonor = NULL, *BuffAvgNormalVelDonor = NULL,
-      *BuffAvg3DVelDonor = NULL, *BuffAvgTangVelDonor = NULL, *BuffAvgNuDonor = NULL,
-      *BuffAvgKineDonor = NULL, *BuffAvgOmegaDonor = NULL;
-  int nSpanSize, *BuffMarkerDonor;
 #endif
 
 
@@ -685,88 +668,38 @@ void CInterface::AllgatherAverage(CSolver *donor_solution, CSolver *target_solut
   }
 
 #ifdef HAVE_MPI
-  nSpanSize = size*nSpanDonor;
-  BuffAvgDensityDonor                 = new su2double[nSpanSize];
-  BuffAvgPressureDonor                = new su2double[nSpanSize];
-  BuffAvgNormalVelDonor               = new su2double[nSpanSize];
-  BuffAvgTangVelDonor                 = new su2double[nSpanSize];
-  BuffAvg3DVelDonor                   = new su2double[nSpanSize];
-  BuffAvgNuDonor                      = new su2double[nSpanSize];
-  BuffAvgKineDonor                    = new su2double[nSpanSize];
-  BuffAvgOmegaDonor                   = new su2double[nSpanSize];
-  BuffMarkerDonor                     = new int[size];
-
-  for (iSpan=0;iSpan<nSpanSize;iSpan++){
-    BuffAvgDensityDonor[iSpan]        = -1.0;
-    BuffAvgPressureDonor[iSpan]       = -1.0;
-    BuffAvgNormalVelDonor[iSpan]      = -1.0;
-    BuffAvgTangVelDonor[iSpan]        = -1.0;
-    BuffAvg3DVelDonor[iSpan]          = -1.0;
-    BuffAvgNuDonor[iSpan]             = -1.0;
-    BuffAvgKineDonor[iSpan]           = -1.0;
-    BuffAvgOmegaDonor[iSpan]          = -1.0;
-  }
+  /*--- All the averages of all the spans are packed, to be gathered in one call. ---*/
+  const unsigned short nAvg = 8;
+  su2double *avgDonor[nAvg] = {avgDensityDonor, avgPressureDonor, avgNormalVelDonor, avgTangVelDonor,
+                               avg3DVelDonor, avgNuDonor, avgKineDonor, avgOmegaDonor};
+  const int nSendAvg = nAvg*nSpanDonor;
 
-  for (iSize=0; iSize<size;iSize++){
-    BuffMarkerDonor[iSize]            = -1;
-  }
+  vector<su2double> sendAvgDonor(nSendAvg), BuffAvgDonor(size*nSendAvg, -1.0);
+  vector<int> BuffMarkerDonor(size, -1);
 
-  SU2_MPI::Allgather(avgDensityDonor, nSpanDonor , MPI_DOUBLE, BuffAvgDensityDonor,
-                     nSpanDonor, MPI_DOUBLE, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(avgPressureDonor, nSpanDonor , MPI_DOUBLE, BuffAvgPressureDonor,
-                     nSpanDonor, MPI_DOUBLE, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(avgNormalVelDonor, nSpanDonor , MPI_DOUBLE, BuffAvgNormalVelDonor,
-                     nSpanDonor, MPI_DOUBLE, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(avgTangVelDonor, nSpanDonor , MPI_DOUBLE, BuffAvgTangVelDonor,
-                     nSpanDonor, MPI_DOUBLE, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(avg3DVelDonor, nSpanDonor , MPI_DOUBLE, BuffAvg3DVelDonor,
-                     nSpanDonor, MPI_DOUBLE, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(avgNuDonor, nSpanDonor , MPI_DOUBLE, BuffAvgNuDonor,
-                     nSpanDonor, MPI_DOUBLE, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(avgKineDonor, nSpanDonor , MPI_DOUBLE, BuffAvgKineDonor,
-                     nSpanDonor, MPI_DOUBLE, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(avgOmegaDonor, nSpanDonor , MPI_DOUBLE, BuffAvgOmegaDonor,
-                     nSpanDonor, MPI_DOUBLE, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(&Marker_Donor, 1 , MPI_INT, BuffMarkerDonor, 1, MPI_INT, MPI_COMM_WORLD);
+  for (unsigned short iAvg = 0; iAvg < nAvg; iAvg++)
+    for (iSpan = 0; iSpan < nSpanDonor; iSpan++)
+      sendAvgDonor[iAvg*nSpanDonor + iSpan] = avgDonor[iAvg][iSpan];
 
-  for (iSpan = 0; iSpan < nSpanDonor; iSpan++){
-    avgDensityDonor[iSpan]            = -1.0;
-    avgPressureDonor[iSpan]           = -1.0;
-    avgNormalVelDonor[iSpan]          = -1.0;
-    avgTangVelDonor[iSpan]            = -1.0;
-    avg3DVelDonor[iSpan]              = -1.0;
-    avgNuDonor[iSpan]                 = -1.0;
-    avgKineDonor[iSpan]               = -1.0;
-    avgOmegaDonor[iSpan]              = -1.0;
-  }
+  SU2_MPI::Allgather(sendAvgDonor.data(), nSendAvg, MPI_DOUBLE, BuffAvgDonor.data(), nSendAvg, MPI_DOUBLE, MPI_COMM_WORLD);
+  SU2_MPI::Allgather(&Marker_Donor, 1 , MPI_INT, BuffMarkerDonor.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+  for (unsigned short iAvg = 0; iAvg < nAvg; iAvg++)
+    for (iSpan = 0; iSpan < nSpanDonor; iSpan++)
+      avgDonor[iAvg][iSpan] = -1.0;
 
   Marker_Donor= -1;
 
   for (iSize=0; iSize<size;iSize++){
-    if(BuffAvgDensityDonor[nSpanDonor*iSize] > 0.0){
-      for (iSpan = 0; iSpan < nSpanDonor; iSpan++){
-        avgDensityDonor[iSpan]        = BuffAvgDensityDonor[nSpanDonor*iSize + iSpan];
-        avgPressureDonor[iSpan]       = BuffAvgPressureDonor[nSpanDonor*iSize + iSpan];
-        avgNormalVelDonor[iSpan]      = BuffAvgNormalVelDonor[nSpanDonor*iSize + iSpan];
-        avgTangVelDonor[iSpan]        = BuffAvgTangVelDonor[nSpanDonor*iSize + iSpan];
-        avg3DVelDonor[iSpan]          = BuffAvg3DVelDonor[nSpanDonor*iSize + iSpan];
-        avgNuDonor[iSpan]             = BuffAvgNuDonor[nSpanDonor*iSize + iSpan];
-        avgKineDonor[iSpan]           = BuffAvgKineDonor[nSpanDonor*iSize + iSpan];
-        avgOmegaDonor[iSpan]          = BuffAvgOmegaDonor[nSpanDonor*iSize + iSpan];
-      }
+    /*--- The first average is the density, positive only on the ranks that own the donor marker. ---*/
+    if(BuffAvgDonor[nSendAvg*iSize] > 0.0){
+      for (unsigned short iAvg = 0; iAvg < nAvg; iAvg++)
+        for (iSpan = 0; iSpan < nSpanDonor; iSpan++)
+          avgDonor[iAvg][iSpan] = BuffAvgDonor[nSendAvg*iSize + iAvg*nSpanDonor + iSpan];
       Marker_Donor                    = BuffMarkerDonor[iSize];
       break;
     }
   }
-  delete [] BuffAvgDensityDonor;
-  delete [] BuffAvgPressureDonor;
-  delete [] BuffAvgNormalVelDonor;
-  delete [] BuffAvgTangVelDonor;
-  delete [] BuffAvg3DVelDonor;
-  delete [] BuffAvgNuDonor;
-  delete [] BuffAvgKineDonor;
-  delete [] BuffAvgOmegaDonor;
-  delete [] BuffMarkerDonor;
 
 #endif
 
@@ -195,21 +195,89 @@ void CConjugateHeatInterface::GetDonor_Variable(CSolver *donor_solution, CGeomet
   }
 }
 
+void CConjugateHeatInterface::SetConjugateHeatVariables(CSolver *target_solution, const CConfig *target_config,
+                                                        unsigned long Marker_Target, unsigned long Vertex_Target,
+                                                        su2double relaxation, const su2double *values) const {
+
+  target_solution->SetConjugateHeatVariable(Marker_Target, Vertex_Target, 0, relaxation, values[0]);
+  target_solution->SetConjugateHeatVariable(Marker_Target, Vertex_Target, 1, relaxation, values[1]);
+
+  if ((target_config->GetKind_CHT_Coupling() == DIRECT_TEMPERATURE_ROBIN_HEATFLUX) ||
+      (target_config->GetKind_CHT_Coupling() == AVERAGED_TEMPERATURE_ROBIN_HEATFLUX)) {
+
+    target_solution->SetConjugateHeatVariable(Marker_Target, Vertex_Target, 2, relaxation, values[2]);
+    target_solution->SetConjugateHeatVariable(Marker_Target, Vertex_Target, 3, relaxation, values[3]);
+  }
+}
+
 void CConjugateHeatInterface::SetTarget_Variable(CSolver *target_solution, CGeometry *target_geometry,
                                                  CConfig *target_config, unsigned long Marker_Target,
                                                  unsigned long Vertex_Target, unsigned long Point_Target) {
 
-  target_solution->SetConjugateHeatVariable(Marker_Target, Vertex_Target, 0,
-                                            target_config->GetRelaxation_Factor_CHT(), Target_Variable[0]);
-  target_solution->SetConjugateHeatVariable(Marker_Target, Vertex_Target, 1,
-                                            target_config->GetRelaxation_Factor_CHT(), Target_Variable[1]);
+  if (!target_config->GetCHT_AitkenRelaxation()) {
+    SetConjugateHeatVariables(target_solution, target_config, Marker_Target, Vertex_Target,
+                              target_config->GetRelaxation_Factor_CHT(), Target_Variable);
+    return;
+  }
 
-  if ((target_config->GetKind_CHT_Coupling() == DIRECT_TEMPERATURE_ROBIN_HEATFLUX) ||
-      (target_config->GetKind_CHT_Coupling() == AVERAGED_TEMPERATURE_ROBIN_HEATFLUX)) {
+  /*--- The relaxation factor depends on the whole interface, store the new values until it is known. ---*/
+
+  if (Staged_Variable.empty()) Staged_Variable.resize(target_geometry->GetnMarker());
+  auto& staged = Staged_Variable[Marker_Target];
+  if (staged.empty()) staged.resize(target_geometry->GetnVertex(Marker_Target)*nVar, 0.0);
+
+  for (unsigned short iVar = 0; iVar < nVar; iVar++)
+    staged[Vertex_Target*nVar+iVar] = Target_Variable[iVar];
+}
+
+void CConjugateHeatInterface::FinalizeTarget_Variables(CSolver *target_solution, CGeometry *target_geometry,
+                                                       CConfig *target_config) {
 
-    target_solution->SetConjugateHeatVariable(Marker_Target, Vertex_Target, 2,
-                                              target_config->GetRelaxation_Factor_CHT(), Target_Variable[2]);
-    target_solution->SetConjugateHeatVariable(Marker_Target, Vertex_Target, 3,
-                                              target_config->GetRelaxation_Factor_CHT(), Target_Variable[3]);
+  if (!target_config->GetCHT_AitkenRelaxation()) return;
+
+  if (Residual_Old.empty()) Residual_Old.resize(target_geometry->GetnMarker());
+
+  /*--- Aitken's dynamic factor, from the change of the interface temperature proposed by this
+   *    transfer (r) and by the previous one: w = -w_old * r_old.(r - r_old) / |r - r_old|^2 ---*/
+
+  su2double sbuf[2] = {0.0, 0.0}, rbuf[2] = {0.0, 0.0};
+
+  for (unsigned short iMarker = 0; iMarker < Staged_Variable.size(); iMarker++) {
+    if (Staged_Variable[iMarker].empty()) continue;
+    auto& residualOld = Residual_Old[iMarker];
+    if (residualOld.empty()) residualOld.resize(target_geometry->GetnVertex(iMarker), 0.0);
+
+    for (unsigned long iVertex = 0; iVertex < target_geometry->GetnVertex(iMarker); iVertex++) {
+      const auto iPoint = target_geometry->vertex[iMarker][iVertex]->GetNode();
+      if (!target_geometry->node[iPoint]->GetDomain()) continue;
+
+      const su2double residual = Staged_Variable[iMarker][iVertex*nVar] -
+                                 target_solution->GetConjugateHeatVariable(iMarker, iVertex, 0);
+      const su2double deltaResidual = residual - residualOld[iVertex];
+      sbuf[0] += residualOld[iVertex]*deltaResidual;
+      sbuf[1] += deltaResidual*deltaResidual;
+      residualOld[iVertex] = residual;
+    }
+  }
+
+  SU2_MPI::Allreduce(sbuf, rbuf, 2, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+
+  if (!Residual_Old_Set) {
+    Relaxation_Factor = target_config->GetRelaxation_Factor_CHT();
+    Residual_Old_Set = true;
+  }
+  else if (rbuf[1] > EPS) {
+    /*--- Small factors are allowed, they are what stiff (high conductivity ratio) interfaces need. ---*/
+    Relaxation_Factor = min(max(-Relaxation_Factor*rbuf[0]/rbuf[1], 0.01), 1.0);
+  }
+
+  for (unsigned short iMarker = 0; iMarker < Staged_Variable.size(); iMarker++) {
+    if (Staged_Variable[iMarker].empty()) continue;
+    for (unsigned long iVertex = 0; iVertex < target_geometry->GetnVertex(iMarker); iVertex++) {
+      const auto iPoint = target_geometry->vertex[iMarker][iVertex]->GetNode();
+      if (!target_geometry->node[iPoint]->GetDomain()) continue;
+      SetConjugateHeatVariables(target_solution, target_config, iMarker, iVertex, Relaxation_Factor,
+                                &Staged_Variable[iMarker][iVertex*nVar]);
+    }
   }
 }
@@ -543,41 +543,55 @@ void CFluidIteration::Iterate(COutput *output,
 
   /*--- Solve the Euler, Navier-Stokes or Reynolds-averaged Navier-Stokes (RANS) equations (one iteration) ---*/
 
+  AD::StartSection("Flow solver");
   integration[val_iZone][val_iInst][FLOW_SOL]->MultiGrid_Iteration(geometry, solver, numerics,
                                                                   config, RUNTIME_FLOW_SYS, val_iZone, val_iInst);
+  AD::EndSection();
 
   if ((config[val_iZone]->GetKind_Solver() == RANS ||
        config[val_iZone]->GetKind_Solver() == DISC_ADJ_RANS ||
        config[val_iZone]->GetKind_Solver() == INC_RANS ||
        config[val_iZone]->GetKind_Solver() == DISC_ADJ_INC_RANS ) && !frozen_visc) {
 
-    /*--- Solve the turbulence model ---*/
+    /*--- Solve the turbulence model, unless it was solved together with the mean flow ---*/
 
     config[val_iZone]->SetGlobalParam(RANS, RUNTIME_TURB_SYS);
-    integration[val_iZone][val_iInst][TURB_SOL]->SingleGrid_Iteration(geometry, solver, numerics,
-                                                                     config, RUNTIME_TURB_SYS, val_iZone, val_iInst);
+    AD::StartSection("Turbulence solver");
+    if (config[val_iZone]->GetMG_Turbulence())
+      integration[val_iZone][val_iInst][TURB_SOL]->MultiGrid_Iteration(geometry, solver, numerics,
+                                                                      config, RUNTIME_TURB_SYS, val_iZone, val_iInst);
+    else if (!config[val_iZone]->GetCoupledTurbulence())
+      integration[val_iZone][val_iInst][TURB_SOL]->SingleGrid_Iteration(geometry, solver, numerics,
+                                                                       config, RUNTIME_TURB_SYS, val_iZone, val_iInst);
+    AD::EndSection();
 
     /*--- Solve transition model ---*/
 
     if (config[val_iZone]->GetKind_Trans_Model() == LM) {
       config[val_iZone]->SetGlobalParam(RANS, RUNTIME_TRANS_SYS);
+      AD::StartSection("Transition solver");
       integration[val_iZone][val_iInst][TRANS_SOL]->SingleGrid_Iteration(geometry, solver, numerics,
                                                                         config, RUNTIME_TRANS_SYS, val_iZone, val_iInst);
+      AD::EndSection();
     }
 
   }
 
   if (config[val_iZone]->GetWeakly_Coupled_Heat()){
     config[val_iZone]->SetGlobalParam(RANS, RUNTIME_HEAT_SYS);
+    AD::StartSection("Heat solver");
     integration[val_iZone][val_iInst][HEAT_SOL]->SingleGrid_Iteration(geometry, solver, numerics,
                                                                      config, RUNTIME_HEAT_SYS, val_iZone, val_iInst);
+    AD::EndSection();
   }
 
   /*--- Incorporate a weakly-coupled radiation model to the analysis ---*/
   if (config[val_iZone]->AddRadiation()){
     config[val_iZone]->SetGlobalParam(RANS, RUNTIME_RADIATION_SYS);
+    AD::StartSection("Radiation solver");
     integration[val_iZone][val_iInst][RAD_SOL]->SingleGrid_Iteration(geometry, solver, numerics, config,
                                                                      RUNTIME_RADIATION_SYS, val_iZone, val_iInst);
+    AD::EndSection();
   }
 
   /*--- Adapt the CFL number using an exponential progression
@@ -626,7 +640,7 @@ void CFluidIteration::Update(COutput *output,
     /*--- Update dual time solver on all mesh levels ---*/
 
     for (iMesh = 0; iMesh <= config[val_iZone]->GetnMGLevels(); iMesh++) {
-      integration[val_iZone][val_iInst][FLOW_SOL]->SetDualTime_Solver(geometry[val_iZone][val_iInst][iMesh], solver[val_iZone][val_iInst][iMesh][FLOW_SOL], config[val_iZone], iMesh);
+      integration[val_iZone][val_iInst][FLOW_SOL]->SetDualTime_Solver(geometry[val_iZone][val_iInst][iMesh], solver[val_iZone][val_iInst][iMesh][FLOW_SOL], config[val_iZone], iMesh, true);
       integration[val_iZone][val_iInst][FLOW_SOL]->SetConvergence(false);
     }
 
@@ -1149,15 +1163,15 @@ void CFEMFluidIteration::Iterate(COutput *output,
   if (config[val_iZone]->GetKind_Solver() == FEM_LES)
     config[val_iZone]->SetGlobalParam(FEM_LES, RUNTIME_FLOW_SYS);
 
-  /*--- Solve the Euler, Navier-Stokes, RANS or LES equations (one iteration) ---*/
+  /*--- Solve the Euler, Navier-Stokes, RANS or LES equations (one iteration), possibly with p-multigrid ---*/
 
-  integration[val_iZone][val_iInst][FLOW_SOL]->SingleGrid_Iteration(geometry,
-                                                                              solver,
-                                                                              numerics,
-                                                                              config,
-                                                                              RUNTIME_FLOW_SYS,
-                                                                              val_iZone,
-                                                                              val_iInst);
+  integration[val_iZone][val_iInst][FLOW_SOL]->MultiGrid_Iteration(geometry,
+                                                                   solver,
+                                                                   numerics,
+                                                                   config,
+                                                                   RUNTIME_FLOW_SYS,
+                                                                   val_iZone,
+                                                                   val_iInst);
 }
 
 void CFEMFluidIteration::Update(COutput *output,
@@ -1956,9 +1970,21 @@ CDiscAdjFluidIteration::CDiscAdjFluidIteration(CConfig *config) : CIteration(con
 
   turbulent = ( config->GetKind_Solver() == DISC_ADJ_RANS || config->GetKind_Solver() == DISC_ADJ_INC_RANS);
 
+  /*--- The direct time steps are recomputed from checkpoints instead of read from restart files. ---*/
+
+  if (config->GetDiscAdj_Checkpoints() > 0) {
+    meanflow_iteration = new CFluidIteration(config);
+    checkpoints = new CBinomialCheckpoints(config->GetDiscAdj_Checkpoints(), config->GetDiscAdj_Checkpoints_Disk(),
+                                           config->GetDiscAdj_Checkpoints_Folder());
+  }
+
 }
 
-CDiscAdjFluidIteration::~CDiscAdjFluidIteration(void) { }
+CDiscAdjFluidIteration::~CDiscAdjFluidIteration(void) {
+
+  delete meanflow_iteration;
+  delete checkpoints;
+}
 
 void CDiscAdjFluidIteration::Preprocess(COutput *output,
                                            CIntegration ****integration,
@@ -1996,7 +2022,15 @@ void CDiscAdjFluidIteration::Preprocess(COutput *output,
 //  if (config[ZONE_0]->GetInvDesign_HeatFlux() == YES)
 //    output->SetHeatFlux_InverseDesign(solver[val_iZone][val_iInst][MESH_0][FLOW_SOL], geometry[val_iZone][val_iInst][MESH_0], config[val_iZone], ExtIter);
 
-  /*--- For the unsteady adjoint, load direct solutions from restart files. ---*/
+  /*--- For the unsteady adjoint, load direct solutions from restart files (or recompute them from checkpoints). ---*/
+
+  auto LoadSolution = [&](int iter) {
+    if (checkpoints)
+      RecomputeUnsteady_Solution(integration, geometry, solver, numerics, config, surface_movement,
+                                 grid_movement, FFDBox, val_iZone, val_iInst, iter);
+    else
+      LoadUnsteady_Solution(geometry, solver, config, val_iZone, val_iInst, iter);
+  };
 
   if (config[val_iZone]->GetTime_Marching()) {
 
@@ -2013,7 +2047,7 @@ void CDiscAdjFluidIteration::Preprocess(COutput *output,
       if (dual_time_2nd) {
 
         /*--- Load solution at timestep n-2 ---*/
-        LoadUnsteady_Solution(geometry, solver,config, val_iZone, val_iInst, Direct_Iter-2);
+        LoadSolution(Direct_Iter-2);
 
         /*--- Push solution back to correct array ---*/
 
@@ -2039,7 +2073,7 @@ void CDiscAdjFluidIteration::Preprocess(COutput *output,
       if (dual_time) {
 
         /*--- Load solution at timestep n-1 ---*/
-        LoadUnsteady_Solution(geometry, solver,config, val_iZone, val_iInst, Direct_Iter-1);
+        LoadSolution(Direct_Iter-1);
 
         /*--- Push solution back to correct array ---*/
 
@@ -2061,7 +2095,7 @@ void CDiscAdjFluidIteration::Preprocess(COutput *output,
 
       /*--- Load solution timestep n ---*/
 
-      LoadUnsteady_Solution(geometry, solver,config, val_iInst, val_iZone, Direct_Iter);
+      LoadSolution(Direct_Iter);
 
     } else if ((TimeIter > 0) && dual_time) {
 
@@ -2074,9 +2108,9 @@ void CDiscAdjFluidIteration::Preprocess(COutput *output,
 
       /*--- Load solution timestep n-1 | n-2 for DualTimestepping 1st | 2nd order ---*/
       if (dual_time_1st){
-        LoadUnsteady_Solution(geometry, solver,config, val_iInst, val_iZone, Direct_Iter - 1);
+        LoadSolution(Direct_Iter - 1);
       } else {
-        LoadUnsteady_Solution(geometry, solver,config, val_iInst, val_iZone, Direct_Iter - 2);
+        LoadSolution(Direct_Iter - 2);
       }
 
 
@@ -2254,6 +2288,133 @@ void CDiscAdjFluidIteration::LoadUnsteady_Solution(CGeometry ****geometry,
   }
 }
 
+void CDiscAdjFluidIteration::CheckpointState(CGeometry ****geometry, CSolver *****solver, CConfig **config,
+                                             unsigned short val_iZone, unsigned short val_iInst,
+                                             bool pack, bool withSolution, vector<passivedouble>& state) const {
+
+  const bool dual_time_2nd = (config[val_iZone]->GetTime_Marching() == DT_STEPPING_2ND);
+
+  if (pack) state.clear();
+  unsigned long iState = 0;
+
+  auto Transfer = [&](su2double& var) {
+    if (pack) state.push_back(SU2_TYPE::GetValue(var));
+    else var = state[iState++];
+  };
+
+  for (unsigned short iMesh = 0; iMesh <= config[val_iZone]->GetnMGLevels(); iMesh++) {
+    for (auto iSol : {FLOW_SOL, TURB_SOL}) {
+      if ((iSol == TURB_SOL) && !turbulent) continue;
+
+      CVariable* nodes = solver[val_iZone][val_iInst][iMesh][iSol]->GetNodes();
+      const auto nVar = solver[val_iZone][val_iInst][iMesh][iSol]->GetnVar();
+
+      for (unsigned long iPoint = 0; iPoint < geometry[val_iZone][val_iInst][iMesh]->GetnPoint(); iPoint++) {
+        for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+          if (withSolution) Transfer(nodes->GetSolution(iPoint)[iVar]);
+          Transfer(nodes->GetSolution_time_n(iPoint)[iVar]);
+          if (dual_time_2nd) Transfer(nodes->GetSolution_time_n1(iPoint)[iVar]);
+        }
+      }
+    }
+  }
+}
+
+void CDiscAdjFluidIteration::RecomputeUnsteady_Solution(CIntegration ****integration, CGeometry ****geometry,
+                                                        CSolver *****solver, CNumerics ******numerics, CConfig **config,
+                                                        CSurfaceMovement **surface_movement,
+                                                        CVolumetricMovement ***grid_movement, CFreeFormDefBox*** FFDBox,
+                                                        unsigned short val_iZone, unsigned short val_iInst, int val_DirectIter) {
+
+  /*--- Before the start the solution is the freestream. ---*/
+
+  if (val_DirectIter < 0) {
+    LoadUnsteady_Solution(geometry, solver, config, val_iZone, val_iInst, val_DirectIter);
+    return;
+  }
+
+  CConfig* config_zone = config[val_iZone];
+  CSolver**** solver_zone = solver[val_iZone];
+  const unsigned long TimeIter = config_zone->GetTimeIter();
+  const unsigned short nMesh = config_zone->GetnMGLevels()+1;
+
+  auto UpdatePrimitives = [&]() {
+    for (unsigned short iMesh = 0; iMesh < nMesh; iMesh++) {
+      solver_zone[val_iInst][iMesh][FLOW_SOL]->Preprocessing(geometry[val_iZone][val_iInst][iMesh], solver_zone[val_iInst][iMesh],
+                                                             config_zone, iMesh, NO_RK_ITER, RUNTIME_FLOW_SYS, false);
+      if (turbulent)
+        solver_zone[val_iInst][iMesh][TURB_SOL]->Postprocessing(geometry[val_iZone][val_iInst][iMesh],
+                                                                solver_zone[val_iInst][iMesh], config_zone, iMesh);
+    }
+  };
+
+  /*--- The time levels hold the solutions loaded previously, they are restored at the end. ---*/
+
+  vector<passivedouble> timeLevels, state;
+  CheckpointState(geometry, solver, config, val_iZone, val_iInst, true, false, timeLevels);
+
+  /*--- Start from the latest checkpoint, or from the freestream. ---*/
+
+  long step = checkpoints->Restore(val_DirectIter, state);
+
+  if (rank == MASTER_NODE && val_iZone == ZONE_0)
+    cout << " Recomputing flow solution of direct iteration " << val_DirectIter << " from "
+         << (step < 0 ? string("the freestream") : "direct iteration " + to_string(step)) << "." << endl;
+
+  if (step >= 0) {
+    CheckpointState(geometry, solver, config, val_iZone, val_iInst, false, true, state);
+  }
+  else {
+    for (unsigned short iMesh = 0; iMesh < nMesh; iMesh++) {
+      for (auto iSol : {FLOW_SOL, TURB_SOL}) {
+        if ((iSol == TURB_SOL) && !turbulent) continue;
+        solver_zone[val_iInst][iMesh][iSol]->SetFreeStream_Solution(config_zone);
+        solver_zone[val_iInst][iMesh][iSol]->GetNodes()->Set_Solution_time_n();
+        solver_zone[val_iInst][iMesh][iSol]->GetNodes()->Set_Solution_time_n1();
+      }
+    }
+  }
+  UpdatePrimitives();
+
+  /*--- March the direct problem, the next checkpoint is placed as in binomial checkpointing. ---*/
+
+  while (step < val_DirectIter) {
+
+    const long next = checkpoints->NextCheckpoint(step, val_DirectIter);
+
+    while (step < next) {
+      step++;
+      config_zone->SetTimeIter(step);
+
+      meanflow_iteration->Preprocess(nullptr, integration, geometry, solver, numerics, config,
+                                     surface_movement, grid_movement, FFDBox, val_iZone, val_iInst);
+
+      for (unsigned long iInner = 0; iInner < config_zone->GetnInner_Iter(); iInner++) {
+        config_zone->SetInnerIter(iInner);
+        meanflow_iteration->Iterate(nullptr, integration, geometry, solver, numerics, config,
+                                    surface_movement, grid_movement, FFDBox, val_iZone, val_iInst);
+
+        const su2double residual = solver_zone[val_iInst][MESH_0][FLOW_SOL]->GetRes_RMS(0);
+        if (log10(residual) < config_zone->GetMinLogResidual()) break;
+      }
+
+      meanflow_iteration->Update(nullptr, integration, geometry, solver, numerics, config,
+                                 surface_movement, grid_movement, FFDBox, val_iZone, val_iInst);
+    }
+
+    if (step < val_DirectIter) {
+      CheckpointState(geometry, solver, config, val_iZone, val_iInst, true, true, state);
+      checkpoints->Store(step, state);
+    }
+  }
+
+  config_zone->SetTimeIter(TimeIter);
+  config_zone->SetInnerIter(0);
+
+  CheckpointState(geometry, solver, config, val_iZone, val_iInst, false, false, timeLevels);
+  UpdatePrimitives();
+}
+
 
 void CDiscAdjFluidIteration::Iterate(COutput *output,
                                         CIntegration ****integration,
@@ -2448,7 +2609,7 @@ void CDiscAdjFluidIteration::SetDependencies(CSolver *****solver,
 
   bool frozen_visc = config[iZone]->GetFrozen_Visc_Disc();
   bool heat = config[iZone]->GetWeakly_Coupled_Heat();
-  if ((kind_recording == MESH_COORDS) || (kind_recording == NONE)  ||
+  if ((kind_recording == MESH_COORDS) || (kind_recording == NONE)  || (kind_recording == COMBINED) ||
       (kind_recording == GEOMETRY_CROSS_TERM) || (kind_recording == ALL_VARIABLES)){
 
     /*--- Update geometry to get the influence on other geometry variables (normals, volume etc) ---*/
@@ -3442,7 +3603,7 @@ void CDiscAdjHeatIteration::SetDependencies(CSolver *****solver,
                                             unsigned short iZone, unsigned short iInst,
                                             unsigned short kind_recording){
 
-  if ((kind_recording == MESH_COORDS) || (kind_recording == NONE)  ||
+  if ((kind_recording == MESH_COORDS) || (kind_recording == NONE)  || (kind_recording == COMBINED) ||
       (kind_recording == GEOMETRY_CROSS_TERM) || (kind_recording == ALL_VARIABLES)){
 
     /*--- Update geometry to get the influence on other geometry variables (normals, volume etc) ---*/
@@ -30,6 +30,19 @@
 
 #include "../../include/numerics/CNumerics.hpp"
 #include "../../include/fluid_model.hpp"
+#include "../../../Common/include/toolboxes/allocation_toolbox.hpp"
+
+#include <iomanip>
+#include <map>
+#include <typeinfo>
+#if defined(__GNUC__)
+#include <cxxabi.h>
+#endif
+
+namespace {
+/*--- Number of calls and of recorded statements of each kernel (reverse AD is not hybrid parallel). ---*/
+std::map<string, std::pair<unsigned long, unsigned long> > TapeReport;
+}
 
 CNumerics::CNumerics(void) {
 
@@ -1891,7 +1904,8 @@ su2double CNumerics::GetRoe_Dissipation(const su2double Dissipation_i,
 
 void CNumerics::EigenDecomposition(su2double **A_ij, su2double **Eig_Vec, su2double *Eig_Val, unsigned short n){
   int iDim,jDim;
-  su2double *e = new su2double [n];
+  MemoryAllocation::CScratchScope scratch;
+  su2double *e = scratch.alloc<su2double>(n);
   for (iDim= 0; iDim< n; iDim++){
     e[iDim] = 0;
     for (jDim = 0; jDim < n; jDim++){
@@ -1900,19 +1914,13 @@ void CNumerics::EigenDecomposition(su2double **A_ij, su2double **Eig_Vec, su2dou
   }
   tred2(Eig_Vec, Eig_Val, e, n);
   tql2(Eig_Vec, Eig_Val, e, n);
-
-  delete [] e;
 }
 
 void CNumerics::EigenRecomposition(su2double **A_ij, su2double **Eig_Vec, su2double *Eig_Val, unsigned short n){
   unsigned short i,j,k;
-  su2double **tmp = new su2double* [n];
-  su2double **deltaN = new su2double* [n];
-
-  for (i= 0; i< n; i++){
-    tmp[i] = new su2double [n];
-    deltaN[i] = new su2double [n];
-  }
+  MemoryAllocation::CScratchScope scratch;
+  su2double **tmp = scratch.alloc_matrix<su2double>(n, n);
+  su2double **deltaN = scratch.alloc_matrix<su2double>(n, n);
 
   for (i = 0; i < n; i++) {
     for (j = 0; j < n; j++) {
@@ -1939,12 +1947,6 @@ void CNumerics::EigenRecomposition(su2double **A_ij, su2double **Eig_Vec, su2dou
     }
   }
 
-  for (i = 0; i < n; i++){
-    delete [] tmp[i];
-    delete [] deltaN[i];
-  }
-  delete [] tmp;
-  delete [] deltaN;
 }
 
 void CNumerics::tred2(su2double **V, su2double *d, su2double *e, unsigned short n) {
@@ -2233,3 +2235,92 @@ void CNumerics::tql2(su2double **V, su2double *d, su2double *e, unsigned short n
   }
 }
 
+#ifdef CODI_REVERSE_TYPE
+CNumerics::ResidualType<> CNumerics::RecordResidual(const CConfig* config) {
+
+  const auto statements = AD::GetTapeStatements();
+
+  /*--- If the kernel does not register its inputs the (empty) section is closed right away. ---*/
+
+  AD::StartPreacc();
+  const bool preacc = SetPreaccInputs();
+  if (!preacc) AD::EndPreacc();
+
+  auto residual = ComputeResidual(config);
+
+  if (preacc) {
+    /*--- The residual is stored by the numerics, the view is only const for the solvers. ---*/
+    AD::SetPreaccOut(const_cast<su2double*>(residual.residual), nVar);
+    SetPreaccOutputs();
+    AD::EndPreacc();
+  }
+
+  auto& entry = TapeReport[typeid(*this).name()];
+  entry.first += 1;
+  entry.second += AD::GetTapeStatements() - statements;
+
+  return residual;
+}
+#endif
+
+void CNumerics::ResetTapeReport() { TapeReport.clear(); }
+
+void CNumerics::PrintTapeReport() {
+
+  if (TapeReport.empty()) return;
+
+  cout << "Tape statements recorded by the numerics kernels:" << endl;
+  cout << setw(40) << left << "Kernel" << setw(12) << right << "Calls"
+       << setw(16) << "Statements" << setw(14) << "Per call" << endl;
+
+  for (const auto& entry : TapeReport) {
+    string name = entry.first;
+#if defined(__GNUC__)
+    int status = 0;
+    char* demangled = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
+    if (status == 0) name = demangled;
+    free(demangled);
+#endif
+    const auto calls = entry.second.first, statements = entry.second.second;
+    cout << setw(40) << left << name << setw(12) << right << calls << setw(16) << statements
+         << setw(14) << statements / max(calls, 1ul) << endl;
+  }
+}
+
+void CNumerics::SetStaticResidualStorage(su2double*& flux, su2double**& jacobian_i, su2double**& jacobian_j) {
+
+  if (nVar > MAXNVAR)
+    SU2_MPI::Error("Too many variables for the fixed size residual storage of the numerics.", CURRENT_FUNCTION);
+
+  for (unsigned short iVar = 0; iVar < MAXNVAR; iVar++) {
+    staticRows_i[iVar] = &staticResidual.jacobian_i(iVar,0);
+    staticRows_j[iVar] = &staticResidual.jacobian_j(iVar,0);
+  }
+  flux = staticResidual.residual.data();
+  jacobian_i = staticRows_i;
+  jacobian_j = staticRows_j;
+  staticInPlace = true;
+}
+
+const CNumerics::StaticResidualType& CNumerics::ComputeStaticResidual(const CConfig* config) {
+
+  const auto residual = ComputeResidualPreacc(config);
+
+  if (staticInPlace) return staticResidual;
+
+  /*--- Copy the residual of schemes with their own storage, the Jacobians may not exist (explicit). ---*/
+
+  if (nVar > MAXNVAR)
+    SU2_MPI::Error("Too many variables for the fixed size residual storage of the numerics.", CURRENT_FUNCTION);
+
+  for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+    staticResidual.residual(iVar) = residual.residual[iVar];
+    if (residual.jacobian_i != nullptr) {
+      for (unsigned short jVar = 0; jVar < nVar; jVar++) {
+        staticResidual.jacobian_i(iVar,jVar) = residual.jacobian_i[iVar][jVar];
+        staticResidual.jacobian_j(iVar,jVar) = residual.jacobian_j[iVar][jVar];
+      }
+    }
+  }
+  return staticResidual;
+}
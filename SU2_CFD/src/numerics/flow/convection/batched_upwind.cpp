@@ -0,0 +1,526 @@
+/*!
+ * \file batched_upwind.cpp
+ * \brief Implementations of the edge-batched upwind schemes.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../../include/numerics/flow/convection/batched_upwind.hpp"
+#include "../../../../../Common/include/omp_structure.hpp"
+
+namespace {
+/*--- Projected Jacobian of the inviscid flux, same as CNumerics::GetInviscidProjJac.
+ *    The arguments are references to arrays (not pointers) such that the private arrays
+ *    of the SIMD loops that call this function can still be vectorized. ---*/
+template<unsigned short NDIM>
+inline void InviscidProjJac(su2double gamma, const su2double (&velocity)[NDIM], su2double energy,
+                            const su2double (&normal)[NDIM], su2double scale, su2double (&jac)[NDIM+2][NDIM+2]) {
+  su2double sqvel = 0.0, proj_vel = 0.0;
+  for (unsigned short iDim = 0; iDim < NDIM; iDim++) {
+    sqvel    += velocity[iDim]*velocity[iDim];
+    proj_vel += velocity[iDim]*normal[iDim];
+  }
+
+  const su2double a2 = gamma-1.0;
+  const su2double phi = 0.5*a2*sqvel;
+  const su2double a1 = gamma*energy-phi;
+
+  jac[0][0] = 0.0;
+  for (unsigned short iDim = 0; iDim < NDIM; iDim++)
+    jac[0][iDim+1] = scale*normal[iDim];
+  jac[0][NDIM+1] = 0.0;
+
+  for (unsigned short iDim = 0; iDim < NDIM; iDim++) {
+    jac[iDim+1][0] = scale*(normal[iDim]*phi - velocity[iDim]*proj_vel);
+    for (unsigned short jDim = 0; jDim < NDIM; jDim++)
+      jac[iDim+1][jDim+1] = scale*(normal[jDim]*velocity[iDim]-a2*normal[iDim]*velocity[jDim]);
+    jac[iDim+1][iDim+1] += scale*proj_vel;
+    jac[iDim+1][NDIM+1] = scale*a2*normal[iDim];
+  }
+
+  jac[NDIM+1][0] = scale*proj_vel*(phi-a1);
+  for (unsigned short iDim = 0; iDim < NDIM; iDim++)
+    jac[NDIM+1][iDim+1] = scale*(normal[iDim]*a1-a2*velocity[iDim]*proj_vel);
+  jac[NDIM+1][NDIM+1] = scale*gamma*proj_vel;
+}
+}
+
+CUpwindBatchNumerics* CUpwindBatchNumerics::CreateNumerics(unsigned short nDim, const CConfig* config) {
+
+  const bool ideal_gas = (config->GetKind_FluidModel() == STANDARD_AIR) ||
+                         (config->GetKind_FluidModel() == IDEAL_GAS);
+
+  if (!config->GetEdgeBatchedNumerics() || !ideal_gas || config->GetDynamic_Grid() ||
+      (config->GetKind_ConvNumScheme_Flow() != SPACE_UPWIND) ||
+      (config->GetKind_RoeLowDiss() != NO_ROELOWDISS) ||
+      config->Low_Mach_Correction() || config->Low_Mach_Preconditioning())
+    return nullptr;
+
+  switch (config->GetKind_Upwind_Flow()) {
+    case ROE:
+      if (nDim == 2) return new CUpwRoeBatch_Flow<2>(config);
+      return new CUpwRoeBatch_Flow<3>(config);
+    case HLLC:
+      if (nDim == 2) return new CUpwHLLCBatch_Flow<2>(config);
+      return new CUpwHLLCBatch_Flow<3>(config);
+    default:
+      return nullptr;
+  }
+}
+
+template<unsigned short NDIM>
+CUpwRoeBatch_Flow<NDIM>::CUpwRoeBatch_Flow(const CConfig* config) :
+  gamma(config->GetGamma()),
+  kappa(config->GetRoe_Kappa()),
+  entropyFix(config->GetEntropyFix_Coeff()),
+  implicit(config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) {
+}
+
+template<unsigned short NDIM>
+void CUpwRoeBatch_Flow<NDIM>::ComputeResidual(CUpwindEdgeBatch& batch) const {
+  if (implicit) ComputeBatch<true>(batch);
+  else ComputeBatch<false>(batch);
+}
+
+template<unsigned short NDIM>
+template<bool Implicit>
+void CUpwRoeBatch_Flow<NDIM>::ComputeBatch(CUpwindEdgeBatch& batch) const {
+
+  constexpr unsigned short NVAR = NDIM+2;
+  const su2double gm1 = gamma-1.0;
+
+  /*--- Each iteration is one edge, the inner loops have compile-time bounds. ---*/
+
+  SU2_OMP_SIMD
+  for (size_t k = 0; k < CUpwindEdgeBatch::SIZE; ++k) {
+
+    unsigned short iDim, iVar, jVar;
+
+    /*--- Face area and unit normal. ---*/
+
+    su2double Normal[NDIM], UnitNormal[NDIM], Area = 0.0;
+    for (iDim = 0; iDim < NDIM; iDim++) {
+      Normal[iDim] = batch.Normal[iDim][k];
+      Area += Normal[iDim]*Normal[iDim];
+    }
+    Area = sqrt(Area);
+    for (iDim = 0; iDim < NDIM; iDim++)
+      UnitNormal[iDim] = Normal[iDim]/Area;
+
+    /*--- Primitive variables at points i and j. ---*/
+
+    su2double Velocity_i[NDIM], Velocity_j[NDIM];
+    for (iDim = 0; iDim < NDIM; iDim++) {
+      Velocity_i[iDim] = batch.V_i[iDim+1][k];
+      Velocity_j[iDim] = batch.V_j[iDim+1][k];
+    }
+    const su2double Pressure_i = batch.V_i[NDIM+1][k], Pressure_j = batch.V_j[NDIM+1][k];
+    const su2double Density_i  = batch.V_i[NDIM+2][k], Density_j  = batch.V_j[NDIM+2][k];
+    const su2double Enthalpy_i = batch.V_i[NDIM+3][k], Enthalpy_j = batch.V_j[NDIM+3][k];
+    const su2double Energy_i = Enthalpy_i - Pressure_i/Density_i;
+    const su2double Energy_j = Enthalpy_j - Pressure_j/Density_j;
+
+    /*--- Roe-averaged variables at interface between i & j. ---*/
+
+    const su2double R = sqrt(fabs(Density_j/Density_i));
+    su2double RoeVelocity[NDIM], sq_vel = 0.0, ProjVelocity = 0.0;
+    for (iDim = 0; iDim < NDIM; iDim++) {
+      RoeVelocity[iDim] = (R*Velocity_j[iDim]+Velocity_i[iDim])/(R+1);
+      sq_vel += RoeVelocity[iDim]*RoeVelocity[iDim];
+      ProjVelocity += RoeVelocity[iDim]*UnitNormal[iDim];
+    }
+    const su2double RoeEnthalpy = (R*Enthalpy_j+Enthalpy_i)/(R+1);
+    const su2double RoeSoundSpeed2 = gm1*(RoeEnthalpy-0.5*sq_vel);
+
+    /*--- Negative RoeSoundSpeed^2, the jump variables is too large, the fluxes are cleared
+     *    (masked instead of returning early to keep the loop vectorizable). ---*/
+
+    const bool valid = (RoeSoundSpeed2 > 0.0);
+    const su2double mask = valid? 1.0 : 0.0;
+    const su2double RoeSoundSpeed = sqrt(valid? RoeSoundSpeed2 : su2double(1.0));
+    const su2double c2 = RoeSoundSpeed*RoeSoundSpeed;
+
+    /*--- Flow eigenvalues with Mavriplis' entropy correction. ---*/
+
+    const su2double MaxLambda = fabs(ProjVelocity) + RoeSoundSpeed;
+    const su2double Lambda_u = max(fabs(ProjVelocity), entropyFix*MaxLambda);
+    const su2double Lambda_p = max(fabs(ProjVelocity+RoeSoundSpeed), entropyFix*MaxLambda);
+    const su2double Lambda_m = max(fabs(ProjVelocity-RoeSoundSpeed), entropyFix*MaxLambda);
+
+    /*--- Acoustic right (r) and left (l) eigenvectors, l.dU = (dp +- rho*c*dUn) / (2c^2). ---*/
+
+    su2double r_p[NVAR], r_m[NVAR], l_p[NVAR], l_m[NVAR];
+    r_p[0] = r_m[0] = 1.0;
+    l_p[0] = (0.5*gm1*sq_vel - RoeSoundSpeed*ProjVelocity) / (2*c2);
+    l_m[0] = (0.5*gm1*sq_vel + RoeSoundSpeed*ProjVelocity) / (2*c2);
+    for (iDim = 0; iDim < NDIM; iDim++) {
+      r_p[iDim+1] = RoeVelocity[iDim] + RoeSoundSpeed*UnitNormal[iDim];
+      r_m[iDim+1] = RoeVelocity[iDim] - RoeSoundSpeed*UnitNormal[iDim];
+      l_p[iDim+1] = (-gm1*RoeVelocity[iDim] + RoeSoundSpeed*UnitNormal[iDim]) / (2*c2);
+      l_m[iDim+1] = (-gm1*RoeVelocity[iDim] - RoeSoundSpeed*UnitNormal[iDim]) / (2*c2);
+    }
+    r_p[NVAR-1] = RoeEnthalpy + RoeSoundSpeed*ProjVelocity;
+    r_m[NVAR-1] = RoeEnthalpy - RoeSoundSpeed*ProjVelocity;
+    l_p[NVAR-1] = l_m[NVAR-1] = gm1 / (2*c2);
+
+    /*--- Difference between conservative variables at j and i, and projected fluxes. ---*/
+
+    su2double Diff_U[NVAR], ProjFlux[NVAR];
+    su2double ProjVel_i = 0.0, ProjVel_j = 0.0;
+    for (iDim = 0; iDim < NDIM; iDim++) {
+      ProjVel_i += Velocity_i[iDim]*Normal[iDim];
+      ProjVel_j += Velocity_j[iDim]*Normal[iDim];
+    }
+    Diff_U[0] = Density_j - Density_i;
+    ProjFlux[0] = Density_i*ProjVel_i + Density_j*ProjVel_j;
+    for (iDim = 0; iDim < NDIM; iDim++) {
+      Diff_U[iDim+1] = Density_j*Velocity_j[iDim] - Density_i*Velocity_i[iDim];
+      ProjFlux[iDim+1] = Density_i*Velocity_i[iDim]*ProjVel_i + Density_j*Velocity_j[iDim]*ProjVel_j +
+                         (Pressure_i+Pressure_j)*Normal[iDim];
+    }
+    Diff_U[NVAR-1] = Density_j*Energy_j - Density_i*Energy_i;
+    ProjFlux[NVAR-1] = Density_i*Enthalpy_i*ProjVel_i + Density_j*Enthalpy_j*ProjVel_j;
+
+    /*--- Central part plus dissipation, (1-kappa) |A| dU. ---*/
+
+    const su2double DissScale = (1.0-kappa)*Area;
+    su2double AbsA[NVAR][NVAR];
+
+    for (iVar = 0; iVar < NVAR; iVar++)
+      for (jVar = 0; jVar < NVAR; jVar++)
+        AbsA[iVar][jVar] = (Lambda_p-Lambda_u)*r_p[iVar]*l_p[jVar] +
+                           (Lambda_m-Lambda_u)*r_m[iVar]*l_m[jVar];
+    for (iVar = 0; iVar < NVAR; iVar++)
+      AbsA[iVar][iVar] += Lambda_u;
+
+    for (iVar = 0; iVar < NVAR; iVar++) {
+      su2double Flux = kappa*ProjFlux[iVar];
+      for (jVar = 0; jVar < NVAR; jVar++)
+        Flux -= DissScale*AbsA[iVar][jVar]*Diff_U[jVar];
+      batch.Flux[iVar][k] = mask*Flux;
+    }
+
+    if (!Implicit) continue;
+
+    su2double Jac_i[NVAR][NVAR], Jac_j[NVAR][NVAR];
+    InviscidProjJac<NDIM>(gamma, Velocity_i, Energy_i, Normal, kappa, Jac_i);
+    InviscidProjJac<NDIM>(gamma, Velocity_j, Energy_j, Normal, kappa, Jac_j);
+
+    for (iVar = 0; iVar < NVAR; iVar++) {
+      for (jVar = 0; jVar < NVAR; jVar++) {
+        batch.Jacobian_i[iVar][jVar][k] = mask*(Jac_i[iVar][jVar] + DissScale*AbsA[iVar][jVar]);
+        batch.Jacobian_j[iVar][jVar][k] = mask*(Jac_j[iVar][jVar] - DissScale*AbsA[iVar][jVar]);
+      }
+    }
+  }
+}
+
+template<unsigned short NDIM>
+CUpwHLLCBatch_Flow<NDIM>::CUpwHLLCBatch_Flow(const CConfig* config) :
+  gamma(config->GetGamma()),
+  kappa(config->GetRoe_Kappa()),
+  implicit(config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) {
+}
+
+template<unsigned short NDIM>
+void CUpwHLLCBatch_Flow<NDIM>::ComputeResidual(CUpwindEdgeBatch& batch) const {
+  if (implicit) ComputeBatch<true>(batch);
+  else ComputeBatch<false>(batch);
+}
+
+template<unsigned short NDIM>
+template<bool Implicit>
+void CUpwHLLCBatch_Flow<NDIM>::ComputeBatch(CUpwindEdgeBatch& batch) const {
+
+  constexpr unsigned short NVAR = NDIM+2;
+  const su2double Gamma_Minus_One = gamma-1.0;
+
+  /*--- Each iteration is one edge, the inner loops have compile-time bounds. ---*/
+
+  SU2_OMP_SIMD
+  for (size_t k = 0; k < CUpwindEdgeBatch::SIZE; ++k) {
+
+    unsigned short iDim, jDim, iVar, jVar;
+
+    /*--- Face area and unit normal. ---*/
+
+    su2double UnitNormal[NDIM], Area = 0.0;
+    for (iDim = 0; iDim < NDIM; iDim++)
+      Area += batch.Normal[iDim][k]*batch.Normal[iDim][k];
+    Area = sqrt(Area);
+    for (iDim = 0; iDim < NDIM; iDim++)
+      UnitNormal[iDim] = batch.Normal[iDim][k]/Area;
+
+    /*--- Primitive variables at points i and j. ---*/
+
+    su2double Velocity_i[NDIM], Velocity_j[NDIM], sq_vel_i = 0.0, sq_vel_j = 0.0;
+    su2double ProjVelocity_i = 0.0, ProjVelocity_j = 0.0;
+    for (iDim = 0; iDim < NDIM; iDim++) {
+      Velocity_i[iDim] = batch.V_i[iDim+1][k];
+      Velocity_j[iDim] = batch.V_j[iDim+1][k];
+      sq_vel_i += Velocity_i[iDim]*Velocity_i[iDim];
+      sq_vel_j += Velocity_j[iDim]*Velocity_j[iDim];
+      ProjVelocity_i += Velocity_i[iDim]*UnitNormal[iDim];
+      ProjVelocity_j += Velocity_j[iDim]*UnitNormal[iDim];
+    }
+    const su2double Pressure_i = batch.V_i[NDIM+1][k], Pressure_j = batch.V_j[NDIM+1][k];
+    const su2double Density_i  = batch.V_i[NDIM+2][k], Density_j  = batch.V_j[NDIM+2][k];
+    const su2double Enthalpy_i = batch.V_i[NDIM+3][k], Enthalpy_j = batch.V_j[NDIM+3][k];
+    const su2double Energy_i = Enthalpy_i - Pressure_i/Density_i;
+    const su2double Energy_j = Enthalpy_j - Pressure_j/Density_j;
+
+    const su2double SoundSpeed_i = sqrt((Enthalpy_i - 0.5*sq_vel_i)*Gamma_Minus_One);
+    const su2double SoundSpeed_j = sqrt((Enthalpy_j - 0.5*sq_vel_j)*Gamma_Minus_One);
+
+    /*--- Roe's averaging. ---*/
+
+    const su2double sqrtDensity_i = sqrt(Density_i), sqrtDensity_j = sqrt(Density_j);
+    const su2double Rrho = sqrtDensity_i + sqrtDensity_j;
+
+    su2double sq_velRoe = 0.0, RoeProjVelocity = 0.0;
+    for (iDim = 0; iDim < NDIM; iDim++) {
+      const su2double RoeVelocity = (Velocity_i[iDim]*sqrtDensity_i + Velocity_j[iDim]*sqrtDensity_j) / Rrho;
+      sq_velRoe += RoeVelocity*RoeVelocity;
+      RoeProjVelocity += RoeVelocity*UnitNormal[iDim];
+    }
+
+    const su2double RoeEnthalpy = (sqrtDensity_j*Enthalpy_j + sqrtDensity_i*Enthalpy_i) / Rrho;
+    const su2double RoeSoundSpeed = sqrt(Gamma_Minus_One*(RoeEnthalpy - 0.5*sq_velRoe));
+
+    /*--- Wave speeds, speed of contact surface, and pressure at the contact surface. ---*/
+
+    const su2double sL = min(RoeProjVelocity - RoeSoundSpeed, ProjVelocity_i - SoundSpeed_i);
+    const su2double sR = max(RoeProjVelocity + RoeSoundSpeed, ProjVelocity_j + SoundSpeed_j);
+
+    const su2double RHO = Density_j*(sR - ProjVelocity_j) - Density_i*(sL - ProjVelocity_i);
+    const su2double sM = (Pressure_i - Pressure_j - Density_i*ProjVelocity_i*(sL - ProjVelocity_i) +
+                          Density_j*ProjVelocity_j*(sR - ProjVelocity_j)) / RHO;
+
+    const su2double pStar = Density_j*(ProjVelocity_j - sR)*(ProjVelocity_j - sM) + Pressure_j;
+
+    /*--- Upwind (left or right) state, and whether the star state is used. ---*/
+
+    const bool left = (sM > 0.0);
+    const su2double sign = left? 1.0 : -1.0;
+    const su2double sK = left? sL : sR;
+    const bool star = (sign*sK <= 0.0);
+
+    const su2double Density_K = left? Density_i : Density_j;
+    const su2double Pressure_K = left? Pressure_i : Pressure_j;
+    const su2double Enthalpy_K = left? Enthalpy_i : Enthalpy_j;
+    const su2double Energy_K = left? Energy_i : Energy_j;
+    const su2double ProjVelocity_K = left? ProjVelocity_i : ProjVelocity_j;
+    su2double Velocity_K[NDIM];
+    for (iDim = 0; iDim < NDIM; iDim++)
+      Velocity_K[iDim] = left? Velocity_i[iDim] : Velocity_j[iDim];
+
+    /*--- Star state of the upwind side. The fluxes (and Jacobians) of the star state and of
+     *    the plain state are both computed and then selected, without branches, such that
+     *    the loop vectorizes. ---*/
+
+    const su2double rhoSK = (sK - ProjVelocity_K) / (sK - sM);
+
+    su2double IntermediateState[NVAR];
+    IntermediateState[0] = rhoSK * Density_K;
+    for (iDim = 0; iDim < NDIM; iDim++)
+      IntermediateState[iDim+1] = rhoSK * (Density_K*Velocity_K[iDim] + (pStar - Pressure_K) / (sK - ProjVelocity_K) * UnitNormal[iDim]);
+    IntermediateState[NVAR-1] = rhoSK * (Density_K*Energy_K - (Pressure_K*ProjVelocity_K - pStar*sM) / (sK - ProjVelocity_K));
+
+    /*--- Flux of the left or right state, and of the star state. ---*/
+
+    su2double Flux_K[NVAR], Flux_Star[NVAR];
+
+    Flux_K[0] = Density_K*ProjVelocity_K;
+    Flux_Star[0] = sM*IntermediateState[0];
+    for (iDim = 0; iDim < NDIM; iDim++) {
+      Flux_K[iDim+1] = Density_K*Velocity_K[iDim]*ProjVelocity_K + Pressure_K*UnitNormal[iDim];
+      Flux_Star[iDim+1] = sM*IntermediateState[iDim+1] + pStar*UnitNormal[iDim];
+    }
+    Flux_K[NVAR-1] = Enthalpy_K*Density_K*ProjVelocity_K;
+    Flux_Star[NVAR-1] = sM*(IntermediateState[NVAR-1] + pStar);
+
+    for (iVar = 0; iVar < NVAR; iVar++)
+      batch.Flux[iVar][k] = Area * (star? Flux_Star[iVar] : Flux_K[iVar]);
+
+    if (!Implicit) continue;
+
+    /*--- Jacobian based on the left or right state, zero w.r.t. the other side. ---*/
+
+    su2double Jacobian_State[NVAR][NVAR];
+    InviscidProjJac<NDIM>(gamma, Velocity_K, Energy_K, UnitNormal, 1.0, Jacobian_State);
+
+    /*--- Jacobian based on the left or right star state. The upwind side (K) is the one
+     *    of the star state, the other side (O) only enters through sM and pStar. ---*/
+
+    su2double Jacobian_K[NVAR][NVAR], Jacobian_O[NVAR][NVAR];
+
+    const su2double EStar = IntermediateState[NVAR-1];
+    const su2double Omega = 1/(sK-sM);
+    const su2double OmegaSM = Omega * sM;
+
+    /*--- Quantities of the other side, sign above is that of the derivatives of sM w.r.t. the upwind side. ---*/
+
+    const su2double sO = left? sR : sL;
+    const su2double Density_O = left? Density_j : Density_i;
+    const su2double ProjVelocity_O = left? ProjVelocity_j : ProjVelocity_i;
+    const su2double sq_vel_K = left? sq_vel_i : sq_vel_j;
+    const su2double sq_vel_O = left? sq_vel_j : sq_vel_i;
+    su2double Velocity_O[NDIM];
+    for (iDim = 0; iDim < NDIM; iDim++)
+      Velocity_O[iDim] = left? Velocity_j[iDim] : Velocity_i[iDim];
+
+    su2double dPI_dU[NVAR], dSm_dU[NVAR], drhoStar_dU[NVAR], dpStar_dU[NVAR], dEStar_dU[NVAR];
+
+    /*--------- Jacobian w.r.t. the upwind side ---------*/
+
+    /*--- Computing pressure derivatives d/dU_K (PI) ---*/
+
+    dPI_dU[0] = 0.5 * Gamma_Minus_One * sq_vel_K;
+    for (iDim = 0; iDim < NDIM; iDim++)
+      dPI_dU[iDim+1] = - Gamma_Minus_One * Velocity_K[iDim];
+    dPI_dU[NVAR-1] = Gamma_Minus_One;
+
+    /*--- Computing d/dU_K (Sm) ---*/
+
+    dSm_dU[0] = sign * ( - ProjVelocity_K * ProjVelocity_K + sM * sK + dPI_dU[0] ) / RHO;
+    for (iDim = 0; iDim < NDIM; iDim++)
+      dSm_dU[iDim+1] = sign * ( UnitNormal[iDim] * ( 2 * ProjVelocity_K - sK - sM ) + dPI_dU[iDim+1] ) / RHO;
+    dSm_dU[NVAR-1] = sign * dPI_dU[NVAR-1] / RHO;
+
+    /*--- Computing d/dU_K (rhoStar) ---*/
+
+    drhoStar_dU[0] = Omega * ( sK + IntermediateState[0] * dSm_dU[0] );
+    for (iDim = 0; iDim < NDIM; iDim++)
+      drhoStar_dU[iDim+1] = Omega * ( - UnitNormal[iDim] + IntermediateState[0] * dSm_dU[iDim+1] );
+    drhoStar_dU[NVAR-1] = Omega * IntermediateState[0] * dSm_dU[NVAR-1];
+
+    /*--- Computing d/dU_K (pStar) ---*/
+
+    for (iVar = 0; iVar < NVAR; iVar++)
+      dpStar_dU[iVar] = Density_K * (sO - ProjVelocity_O) * dSm_dU[iVar];
+
+    /*--- Computing d/dU_K (EStar) ---*/
+
+    for (iVar = 0; iVar < NVAR; iVar++)
+      dEStar_dU[iVar] = Omega * ( sM * dpStar_dU[iVar] + ( EStar + pStar ) * dSm_dU[iVar] );
+
+    dEStar_dU[0] += Omega * ProjVelocity_K * ( Enthalpy_K - dPI_dU[0] );
+    for (iDim = 0; iDim < NDIM; iDim++)
+      dEStar_dU[iDim+1] += Omega * ( - UnitNormal[iDim] * Enthalpy_K - ProjVelocity_K * dPI_dU[iDim+1] );
+    dEStar_dU[NVAR-1] += Omega * ( sK - ProjVelocity_K - ProjVelocity_K * dPI_dU[NVAR-1] );
+
+    /*--- Jacobian First Row ---*/
+
+    for (iVar = 0; iVar < NVAR; iVar++)
+      Jacobian_K[0][iVar] = sM * drhoStar_dU[iVar] + IntermediateState[0] * dSm_dU[iVar];
+
+    /*--- Jacobian Middle Rows ---*/
+
+    for (jDim = 0; jDim < NDIM; jDim++) {
+      for (iVar = 0; iVar < NVAR; iVar++)
+        Jacobian_K[jDim+1][iVar] = ( OmegaSM + 1 ) * ( UnitNormal[jDim] * dpStar_dU[iVar] + IntermediateState[jDim+1] * dSm_dU[iVar] )
+                                   - OmegaSM * dPI_dU[iVar] * UnitNormal[jDim];
+    }
+
+    /*--- Separate nest, the vectorizer does not handle consecutive inner loops. ---*/
+
+    for (jDim = 0; jDim < NDIM; jDim++) {
+      Jacobian_K[jDim+1][0] += OmegaSM * Velocity_K[jDim] * ProjVelocity_K;
+
+      Jacobian_K[jDim+1][jDim+1] += OmegaSM * (sK - ProjVelocity_K);
+
+      for (iDim = 0; iDim < NDIM; iDim++)
+        Jacobian_K[jDim+1][iDim+1] -= OmegaSM * Velocity_K[jDim] * UnitNormal[iDim];
+    }
+
+    /*--- Jacobian Last Row ---*/
+
+    for (iVar = 0; iVar < NVAR; iVar++)
+      Jacobian_K[NVAR-1][iVar] = sM * ( dEStar_dU[iVar] + dpStar_dU[iVar] ) + ( EStar + pStar ) * dSm_dU[iVar];
+
+    /*--------- Jacobian w.r.t. the other side ---------*/
+
+    /*--- Computing d/dU_O (Sm) ---*/
+
+    dSm_dU[0] = sign * ( ProjVelocity_O * ProjVelocity_O - sM * sO - 0.5 * Gamma_Minus_One * sq_vel_O ) / RHO;
+    for (iDim = 0; iDim < NDIM; iDim++)
+      dSm_dU[iDim+1] = - sign * ( UnitNormal[iDim] * ( 2 * ProjVelocity_O - sO - sM) - Gamma_Minus_One * Velocity_O[iDim] ) / RHO;
+    dSm_dU[NVAR-1] = - sign * Gamma_Minus_One / RHO;
+
+    /*--- Computing d/dU_O (pStar) ---*/
+
+    for (iVar = 0; iVar < NVAR; iVar++)
+      dpStar_dU[iVar] = Density_O * (sK - ProjVelocity_K) * dSm_dU[iVar];
+
+    /*--- Computing d/dU_O (EStar) ---*/
+
+    for (iVar = 0; iVar < NVAR; iVar++)
+      dEStar_dU[iVar] = Omega * ( sM * dpStar_dU[iVar] + ( EStar + pStar ) * dSm_dU[iVar] );
+
+    /*--- Jacobian First Row ---*/
+
+    for (iVar = 0; iVar < NVAR; iVar++)
+      Jacobian_O[0][iVar] = IntermediateState[0] * ( OmegaSM + 1 ) * dSm_dU[iVar];
+
+    /*--- Jacobian Middle Rows ---*/
+
+    for (iDim = 0; iDim < NDIM; iDim++) {
+      for (iVar = 0; iVar < NVAR; iVar++)
+        Jacobian_O[iDim+1][iVar] = ( OmegaSM + 1 ) * ( IntermediateState[iDim+1] * dSm_dU[iVar] + UnitNormal[iDim] * dpStar_dU[iVar] );
+    }
+
+    /*--- Jacobian Last Row ---*/
+
+    for (iVar = 0; iVar < NVAR; iVar++)
+      Jacobian_O[NVAR-1][iVar] = sM * (dEStar_dU[iVar] + dpStar_dU[iVar]) + (EStar + pStar) * dSm_dU[iVar];
+
+    /*--- Jacobians of the inviscid flux, scale = k because Flux ~ 0.5*(fc_i+fc_j)*Normal ---*/
+
+    /*--- The upwind side is selected with weights, a condition on it in these loops makes the
+     *    compiler unswitch them, which prevents the vectorization of the outer loop. The loops
+     *    are kept small such that they are completely unrolled. ---*/
+
+    const su2double Scale_K_i = left? kappa*Area : 0.0;
+    const su2double Scale_K_j = kappa*Area - Scale_K_i;
+
+    for (iVar = 0; iVar < NVAR; iVar++) {
+      for (jVar = 0; jVar < NVAR; jVar++) {
+        Jacobian_K[iVar][jVar] = star? Jacobian_K[iVar][jVar] : Jacobian_State[iVar][jVar];
+        Jacobian_O[iVar][jVar] = star? Jacobian_O[iVar][jVar] : su2double(0.0);
+      }
+    }
+
+    for (iVar = 0; iVar < NVAR; iVar++)
+      for (jVar = 0; jVar < NVAR; jVar++)
+        batch.Jacobian_i[iVar][jVar][k] = Scale_K_i*Jacobian_K[iVar][jVar] + Scale_K_j*Jacobian_O[iVar][jVar];
+
+    for (iVar = 0; iVar < NVAR; iVar++)
+      for (jVar = 0; jVar < NVAR; jVar++)
+        batch.Jacobian_j[iVar][jVar][k] = Scale_K_i*Jacobian_O[iVar][jVar] + Scale_K_j*Jacobian_K[iVar][jVar];
+  }
+}
+
+template class CUpwRoeBatch_Flow<2>;
+template class CUpwRoeBatch_Flow<3>;
+template class CUpwHLLCBatch_Flow<2>;
+template class CUpwHLLCBatch_Flow<3>;
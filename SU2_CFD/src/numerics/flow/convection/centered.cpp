@@ -38,31 +38,15 @@ CCentBase_Flow::CCentBase_Flow(unsigned short val_nDim, unsigned short val_nVar,
   Gamma = config->GetGamma();
   Gamma_Minus_One = Gamma - 1.0;
 
-  /*--- Allocate required structures ---*/
+  /*--- Allocate required structures, the flux and Jacobians use the fixed size storage of CNumerics. ---*/
   Diff_U = new su2double [nVar];
   Diff_Lapl = new su2double [nVar];
-  ProjFlux = new su2double [nVar];
-  Jacobian_i = new su2double* [nVar];
-  Jacobian_j = new su2double* [nVar];
-  for (iVar = 0; iVar < nVar; iVar++) {
-    Jacobian_i[iVar] = new su2double [nVar];
-    Jacobian_j[iVar] = new su2double [nVar];
-  }
+  SetStaticResidualStorage(ProjFlux, Jacobian_i, Jacobian_j);
 }
 
 CCentBase_Flow::~CCentBase_Flow(void) {
   delete [] Diff_U;
   delete [] Diff_Lapl;
-  delete [] ProjFlux;
-
-  if (Jacobian_i != nullptr) {
-    for (iVar = 0; iVar < nVar; iVar++) {
-      delete [] Jacobian_i[iVar];
-      delete [] Jacobian_j[iVar];
-    }
-    delete [] Jacobian_i;
-    delete [] Jacobian_j;
-  }
 }
 
 CNumerics::ResidualType<> CCentBase_Flow::ComputeResidual(const CConfig* config) {
@@ -129,9 +113,7 @@ CNumerics::ResidualType<> CCentBase_Flow::ComputeResidual(const CConfig* config)
   /*--- Adjustment due to grid motion ---*/
 
   if (dynamic_grid) {
-    ProjGridVel = 0.0;
-    for (iDim = 0; iDim < nDim; iDim++)
-      ProjGridVel += 0.5*(GridVel_i[iDim]+GridVel_j[iDim])*Normal[iDim];
+    ProjGridVel = GetProjGridVel(Normal);
 
     for (iVar = 0; iVar < nVar; iVar++) {
       ProjFlux[iVar] -= ProjGridVel * 0.5*(U_i[iVar] + U_j[iVar]);
@@ -462,8 +444,7 @@ CNumerics::ResidualType<> CCentLaxInc_Flow::ComputeResidual(const CConfig* confi
     }
     U_i[nDim+1] = DensityInc_i*Enthalpy_i; U_j[nDim+1] = DensityInc_j*Enthalpy_j;
 
-    for (iDim = 0; iDim < nDim; iDim++)
-      ProjVelocity += 0.5*(GridVel_i[iDim]+GridVel_j[iDim])*Normal[iDim];
+    ProjVelocity += GetProjGridVel(Normal);
 
     /*--- Residual contributions ---*/
     for (iVar = 0; iVar < nVar; iVar++) {
@@ -500,10 +481,7 @@ CNumerics::ResidualType<> CCentLaxInc_Flow::ComputeResidual(const CConfig* confi
   /*--- Projected velocity adjustment due to mesh motion ---*/
 
   if (dynamic_grid) {
-    ProjGridVel = 0.0;
-    for (iDim = 0; iDim < nDim; iDim++) {
-      ProjGridVel   += 0.5*(GridVel_i[iDim]+GridVel_j[iDim])*Normal[iDim];
-    }
+    ProjGridVel = GetProjGridVel(Normal);
     ProjVelocity_i -= ProjGridVel;
     ProjVelocity_j -= ProjGridVel;
   }
@@ -682,9 +660,7 @@ CNumerics::ResidualType<> CCentJSTInc_Flow::ComputeResidual(const CConfig* confi
     }
     U_i[nDim+1] = DensityInc_i*Enthalpy_i; U_j[nDim+1] = DensityInc_j*Enthalpy_j;
 
-    su2double ProjVelocity = 0.0;
-    for (iDim = 0; iDim < nDim; iDim++)
-      ProjVelocity += 0.5*(GridVel_i[iDim]+GridVel_j[iDim])*Normal[iDim];
+    su2double ProjVelocity = GetProjGridVel(Normal);
 
     /*--- Residual contributions ---*/
     for (iVar = 0; iVar < nVar; iVar++) {
@@ -720,10 +696,7 @@ CNumerics::ResidualType<> CCentJSTInc_Flow::ComputeResidual(const CConfig* confi
   /*--- Projected velocity adjustment due to mesh motion ---*/
 
   if (dynamic_grid) {
-    ProjGridVel = 0.0;
-    for (iDim = 0; iDim < nDim; iDim++) {
-      ProjGridVel   += 0.5*(GridVel_i[iDim]+GridVel_j[iDim])*Normal[iDim];
-    }
+    ProjGridVel = GetProjGridVel(Normal);
     ProjVelocity_i -= ProjGridVel;
     ProjVelocity_j -= ProjGridVel;
   }
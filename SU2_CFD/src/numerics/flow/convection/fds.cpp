@@ -133,10 +133,7 @@ CNumerics::ResidualType<> CUpwFDSInc_Flow::ComputeResidual(const CConfig *config
   /*--- Projected velocity adjustment due to mesh motion ---*/
 
   if (dynamic_grid) {
-    ProjGridVel = 0.0;
-    for (iDim = 0; iDim < nDim; iDim++) {
-      ProjGridVel   += 0.5*(GridVel_i[iDim]+GridVel_j[iDim])*Normal[iDim];
-    }
+    ProjGridVel = GetProjGridVel(Normal);
     ProjVelocity   -= ProjGridVel;
   }
 
@@ -245,9 +242,7 @@ CNumerics::ResidualType<> CUpwFDSInc_Flow::ComputeResidual(const CConfig *config
     }
     U_i[nDim+1] = DensityInc_i*Enthalpy_i; U_j[nDim+1] = DensityInc_j*Enthalpy_j;
 
-    ProjVelocity = 0.0;
-    for (iDim = 0; iDim < nDim; iDim++)
-      ProjVelocity += 0.5*(GridVel_i[iDim]+GridVel_j[iDim])*Normal[iDim];
+    ProjVelocity = GetProjGridVel(Normal);
 
     /*--- Residual contributions ---*/
     for (iVar = 0; iVar < nVar; iVar++) {
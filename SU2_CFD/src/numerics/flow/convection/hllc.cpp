@@ -81,6 +81,14 @@ CUpwHLLC_Flow::~CUpwHLLC_Flow(void) {
 
 }
 
+bool CUpwHLLC_Flow::SetPreaccInputs() {
+  AD::SetPreaccIn(V_i, nDim+4); AD::SetPreaccIn(V_j, nDim+4); AD::SetPreaccIn(Normal, nDim);
+  if (dynamic_grid) {
+    AD::SetPreaccIn(GridVel_i, nDim); AD::SetPreaccIn(GridVel_j, nDim);
+  }
+  return true;
+}
+
 CNumerics::ResidualType<> CUpwHLLC_Flow::ComputeResidual(const CConfig* config) {
 
   /*--- Face area (norm or the normal vector) ---*/
@@ -146,8 +154,7 @@ CNumerics::ResidualType<> CUpwHLLC_Flow::ComputeResidual(const CConfig* config)
 
   if (dynamic_grid) {
 
-    for (iDim = 0; iDim < nDim; iDim++)
-      ProjInterfaceVel += 0.5 * ( GridVel_i[iDim] + GridVel_j[iDim] )*UnitNormal[iDim];
+    ProjInterfaceVel += GetProjGridVel(UnitNormal, Area);
 
     SoundSpeed_i -= ProjInterfaceVel;
     SoundSpeed_j += ProjInterfaceVel;
@@ -684,8 +691,7 @@ CNumerics::ResidualType<> CUpwGeneralHLLC_Flow::ComputeResidual(const CConfig* c
 
   if (dynamic_grid) {
 
-    for (iDim = 0; iDim < nDim; iDim++)
-      ProjInterfaceVel += 0.5 * ( GridVel_i[iDim] + GridVel_j[iDim] )*UnitNormal[iDim];
+    ProjInterfaceVel += GetProjGridVel(UnitNormal, Area);
 
     SoundSpeed_i -= ProjInterfaceVel;
     SoundSpeed_j += ProjInterfaceVel;
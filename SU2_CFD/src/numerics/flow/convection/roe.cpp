@@ -40,7 +40,9 @@ CUpwRoeBase_Flow::CUpwRoeBase_Flow(unsigned short val_nDim, unsigned short val_n
 
   roe_low_dissipation = val_low_dissipation;
 
-  Flux = new su2double [nVar];
+  /*--- The flux and Jacobians are computed in the fixed size storage of CNumerics. ---*/
+  SetStaticResidualStorage(Flux, Jacobian_i, Jacobian_j);
+
   Diff_U = new su2double [nVar];
   ProjFlux_i = new su2double [nVar];
   ProjFlux_j = new su2double [nVar];
@@ -49,19 +51,14 @@ CUpwRoeBase_Flow::CUpwRoeBase_Flow(unsigned short val_nDim, unsigned short val_n
   Lambda = new su2double [nVar];
   P_Tensor = new su2double* [nVar];
   invP_Tensor = new su2double* [nVar];
-  Jacobian_i = new su2double* [nVar];
-  Jacobian_j = new su2double* [nVar];
   for (unsigned short iVar = 0; iVar < nVar; iVar++) {
     P_Tensor[iVar] = new su2double [nVar];
     invP_Tensor[iVar] = new su2double [nVar];
-    Jacobian_i[iVar] = new su2double [nVar];
-    Jacobian_j[iVar] = new su2double [nVar];
   }
 }
 
 CUpwRoeBase_Flow::~CUpwRoeBase_Flow(void) {
 
-  delete [] Flux;
   delete [] Diff_U;
   delete [] ProjFlux_i;
   delete [] ProjFlux_j;
@@ -71,13 +68,9 @@ CUpwRoeBase_Flow::~CUpwRoeBase_Flow(void) {
   for (unsigned short iVar = 0; iVar < nVar; iVar++) {
     delete [] P_Tensor[iVar];
     delete [] invP_Tensor[iVar];
-    delete [] Jacobian_i[iVar];
-    delete [] Jacobian_j[iVar];
   }
   delete [] P_Tensor;
   delete [] invP_Tensor;
-  delete [] Jacobian_i;
-  delete [] Jacobian_j;
 
 }
 
@@ -178,8 +171,7 @@ CNumerics::ResidualType<> CUpwRoeBase_Flow::ComputeResidual(const CConfig* confi
     ProjVelocity += RoeVelocity[iDim]*UnitNormal[iDim];
 
   if (dynamic_grid) {
-    for (iDim = 0; iDim < nDim; iDim++)
-      ProjGridVel += 0.5*(GridVel_i[iDim]+GridVel_j[iDim])*UnitNormal[iDim];
+    ProjGridVel += GetProjGridVel(UnitNormal, Area);
     ProjVelocity -= ProjGridVel;
   }
 
@@ -578,10 +570,7 @@ CNumerics::ResidualType<> CUpwTurkel_Flow::ComputeResidual(const CConfig* config
 
   /*--- Projected velocity adjustment due to mesh motion ---*/
   if (dynamic_grid) {
-    su2double ProjGridVel = 0.0;
-    for (iDim = 0; iDim < nDim; iDim++) {
-      ProjGridVel   += 0.5*(GridVel_i[iDim]+GridVel_j[iDim])*UnitNormal[iDim];
-    }
+    su2double ProjGridVel = GetProjGridVel(UnitNormal, Area);
     ProjVelocity   -= ProjGridVel;
     ProjVelocity_i -= ProjGridVel;
     ProjVelocity_j -= ProjGridVel;
@@ -661,9 +650,7 @@ CNumerics::ResidualType<> CUpwTurkel_Flow::ComputeResidual(const CConfig* config
 
   /*--- Contributions due to mesh motion---*/
   if (dynamic_grid) {
-    ProjVelocity = 0.0;
-    for (iDim = 0; iDim < nDim; iDim++)
-      ProjVelocity += 0.5*(GridVel_i[iDim]+GridVel_j[iDim])*UnitNormal[iDim];
+    ProjVelocity = GetProjGridVel(UnitNormal, Area);
     for (iVar = 0; iVar < nVar; iVar++) {
       Flux[iVar] -= ProjVelocity * 0.5*(U_i[iVar]+U_j[iVar]);
       /*--- Implicit terms ---*/
@@ -843,10 +830,7 @@ CNumerics::ResidualType<> CUpwGeneralRoe_Flow::ComputeResidual(const CConfig* co
 
   /*--- Projected velocity adjustment due to mesh motion ---*/
   if (dynamic_grid) {
-    su2double ProjGridVel = 0.0;
-    for (iDim = 0; iDim < nDim; iDim++) {
-      ProjGridVel   += 0.5*(GridVel_i[iDim]+GridVel_j[iDim])*UnitNormal[iDim];
-    }
+    su2double ProjGridVel = GetProjGridVel(UnitNormal, Area);
     ProjVelocity   -= ProjGridVel;
     ProjVelocity_i -= ProjGridVel;
     ProjVelocity_j -= ProjGridVel;
@@ -918,9 +902,7 @@ CNumerics::ResidualType<> CUpwGeneralRoe_Flow::ComputeResidual(const CConfig* co
 
     /*--- Flux contribution due to grid motion ---*/
     if (dynamic_grid) {
-      ProjVelocity = 0.0;
-      for (iDim = 0; iDim < nDim; iDim++)
-        ProjVelocity += 0.5*(GridVel_i[iDim]+GridVel_j[iDim])*Normal[iDim];
+      ProjVelocity = GetProjGridVel(Normal);
       for (iVar = 0; iVar < nVar; iVar++) {
         Flux[iVar] -= ProjVelocity * 0.5*(U_i[iVar]+U_j[iVar]);
       }
@@ -963,9 +945,7 @@ CNumerics::ResidualType<> CUpwGeneralRoe_Flow::ComputeResidual(const CConfig* co
 
     /*--- Jacobian contributions due to grid motion ---*/
     if (dynamic_grid) {
-      ProjVelocity = 0.0;
-      for (iDim = 0; iDim < nDim; iDim++)
-        ProjVelocity += 0.5*(GridVel_i[iDim]+GridVel_j[iDim])*Normal[iDim];
+      ProjVelocity = GetProjGridVel(Normal);
       for (iVar = 0; iVar < nVar; iVar++) {
         Flux[iVar] -= ProjVelocity * 0.5*(U_i[iVar]+U_j[iVar]);
         /*--- Implicit terms ---*/
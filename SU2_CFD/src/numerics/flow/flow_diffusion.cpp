@@ -27,6 +27,7 @@
  */
 
 #include "../../../include/numerics/flow/flow_diffusion.hpp"
+#include "../../../../Common/include/toolboxes/allocation_toolbox.hpp"
 
 CAvgGrad_Base::CAvgGrad_Base(unsigned short val_nDim,
                              unsigned short val_nVar,
@@ -99,6 +100,29 @@ CAvgGrad_Base::~CAvgGrad_Base() {
 
 }
 
+void CAvgGrad_Base::SetEdgeGeometricFactors() {
+
+  if (EdgeGeometry) {
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      Edge_Vector[iDim] = EdgeGeometry[iDim];
+    dist_ij_2 = EdgeGeometry[nDim];
+    Area = EdgeGeometry[nDim+1];
+  }
+  else {
+    Area = 0.0;
+    dist_ij_2 = 0.0;
+    for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+      Edge_Vector[iDim] = Coord_j[iDim]-Coord_i[iDim];
+      dist_ij_2 += Edge_Vector[iDim]*Edge_Vector[iDim];
+      Area += Normal[iDim]*Normal[iDim];
+    }
+    Area = sqrt(Area);
+  }
+
+  for (unsigned short iDim = 0; iDim < nDim; iDim++)
+    UnitNormal[iDim] = Normal[iDim]/Area;
+}
+
 void CAvgGrad_Base::CorrectGradient(su2double** GradPrimVar,
                                     const su2double* val_PrimVar_i,
                                     const su2double* val_PrimVar_j,
@@ -249,17 +273,14 @@ void CAvgGrad_Base::GetMeanRateOfStrainMatrix(su2double **S_ij) const
 void CAvgGrad_Base::SetReynoldsStressMatrix(su2double turb_ke){
 
   unsigned short iDim, jDim;
-  su2double **S_ij = new su2double* [3];
+  MemoryAllocation::CScratchScope scratch;
+  su2double **S_ij = scratch.alloc_matrix<su2double>(3, 3);
   su2double muT = Mean_Eddy_Viscosity;
   su2double divVel = 0;
   su2double density;
   su2double TWO3 = 2.0/3.0;
   density = Mean_PrimVar[nDim+2];
 
-  for (iDim = 0; iDim < 3; iDim++){
-    S_ij[iDim] = new su2double [3];
-  }
-
   GetMeanRateOfStrainMatrix(S_ij);
 
   /* --- Using rate of strain matrix, calculate Reynolds stress tensor --- */
@@ -274,10 +295,6 @@ void CAvgGrad_Base::SetReynoldsStressMatrix(su2double turb_ke){
       - muT / density * (2 * S_ij[iDim][jDim] - TWO3 * divVel * delta3[iDim][jDim]);
     }
   }
-
-  for (iDim = 0; iDim < 3; iDim++)
-    delete [] S_ij[iDim];
-  delete [] S_ij;
 }
 
 void CAvgGrad_Base::SetPerturbedRSM(su2double turb_ke, const CConfig* config){
@@ -574,7 +591,7 @@ CNumerics::ResidualType<> CAvgGrad_Flow::ComputeResidual(const CConfig* config)
 
   AD::StartPreacc();
   AD::SetPreaccIn(V_i, nDim+9);   AD::SetPreaccIn(V_j, nDim+9);
-  AD::SetPreaccIn(Coord_i, nDim); AD::SetPreaccIn(Coord_j, nDim);
+  SetPreaccEdgeGeometry();
   AD::SetPreaccIn(PrimVar_Grad_i, nDim+1, nDim);
   AD::SetPreaccIn(PrimVar_Grad_j, nDim+1, nDim);
   AD::SetPreaccIn(turb_ke_i); AD::SetPreaccIn(turb_ke_j);
@@ -582,15 +599,9 @@ CNumerics::ResidualType<> CAvgGrad_Flow::ComputeResidual(const CConfig* config)
 
   unsigned short iVar, jVar, iDim;
 
-  /*--- Normalized normal vector ---*/
-
-  Area = 0.0;
-  for (iDim = 0; iDim < nDim; iDim++)
-    Area += Normal[iDim]*Normal[iDim];
-  Area = sqrt(Area);
+  /*--- Normalized normal vector, vector going from iPoint to jPoint and its squared length ---*/
 
-  for (iDim = 0; iDim < nDim; iDim++)
-    UnitNormal[iDim] = Normal[iDim]/Area;
+  SetEdgeGeometricFactors();
 
   PrimVar_i = V_i;
   PrimVar_j = V_j;
@@ -600,14 +611,6 @@ CNumerics::ResidualType<> CAvgGrad_Flow::ComputeResidual(const CConfig* config)
   }
 
 
-  /*--- Compute vector going from iPoint to jPoint ---*/
-
-  dist_ij_2 = 0.0;
-  for (iDim = 0; iDim < nDim; iDim++) {
-    Edge_Vector[iDim] = Coord_j[iDim]-Coord_i[iDim];
-    dist_ij_2 += Edge_Vector[iDim]*Edge_Vector[iDim];
-  }
-
   /*--- Laminar and Eddy viscosity ---*/
 
   Laminar_Viscosity_i = V_i[nDim+5]; Laminar_Viscosity_j = V_j[nDim+5];
@@ -761,7 +764,7 @@ CNumerics::ResidualType<> CAvgGradInc_Flow::ComputeResidual(const CConfig* confi
 
   AD::StartPreacc();
   AD::SetPreaccIn(V_i, nDim+9);   AD::SetPreaccIn(V_j, nDim+9);
-  AD::SetPreaccIn(Coord_i, nDim); AD::SetPreaccIn(Coord_j, nDim);
+  SetPreaccEdgeGeometry();
   AD::SetPreaccIn(PrimVar_Grad_i, nVar, nDim);
   AD::SetPreaccIn(PrimVar_Grad_j, nVar, nDim);
   AD::SetPreaccIn(turb_ke_i); AD::SetPreaccIn(turb_ke_j);
@@ -769,15 +772,9 @@ CNumerics::ResidualType<> CAvgGradInc_Flow::ComputeResidual(const CConfig* confi
 
   unsigned short iVar, jVar, iDim;
 
-  /*--- Normalized normal vector ---*/
-
-  Area = 0.0;
-  for (iDim = 0; iDim < nDim; iDim++)
-    Area += Normal[iDim]*Normal[iDim];
-  Area = sqrt(Area);
+  /*--- Normalized normal vector, vector going from iPoint to jPoint and its squared length ---*/
 
-  for (iDim = 0; iDim < nDim; iDim++)
-    UnitNormal[iDim] = Normal[iDim]/Area;
+  SetEdgeGeometricFactors();
 
   PrimVar_i = V_i;
   PrimVar_j = V_j;
@@ -786,14 +783,6 @@ CNumerics::ResidualType<> CAvgGradInc_Flow::ComputeResidual(const CConfig* confi
     Mean_PrimVar[iVar] = 0.5*(PrimVar_i[iVar]+PrimVar_j[iVar]);
   }
 
-  /*--- Compute vector going from iPoint to jPoint ---*/
-
-  dist_ij_2 = 0.0;
-  for (iDim = 0; iDim < nDim; iDim++) {
-    Edge_Vector[iDim] = Coord_j[iDim]-Coord_i[iDim];
-    dist_ij_2 += Edge_Vector[iDim]*Edge_Vector[iDim];
-  }
-
   /*--- Density and transport properties ---*/
 
   Laminar_Viscosity_i    = V_i[nDim+4];  Laminar_Viscosity_j    = V_j[nDim+4];
@@ -845,10 +834,15 @@ CNumerics::ResidualType<> CAvgGradInc_Flow::ComputeResidual(const CConfig* confi
 
       /*--- Include the temperature equation Jacobian. ---*/
       su2double proj_vector_ij = 0.0;
-      for (iDim = 0; iDim < nDim; iDim++) {
-        proj_vector_ij += (Coord_j[iDim]-Coord_i[iDim])*Normal[iDim];
+      if (EdgeGeometry) {
+        proj_vector_ij = EdgeGeometry[nDim+2];
+      }
+      else {
+        for (iDim = 0; iDim < nDim; iDim++) {
+          proj_vector_ij += Edge_Vector[iDim]*Normal[iDim];
+        }
+        proj_vector_ij = proj_vector_ij/dist_ij_2;
       }
-      proj_vector_ij = proj_vector_ij/dist_ij_2;
       Jacobian_i[nDim+1][nDim+1] = -Mean_Thermal_Conductivity*proj_vector_ij;
       Jacobian_j[nDim+1][nDim+1] =  Mean_Thermal_Conductivity*proj_vector_ij;
     }
@@ -1060,7 +1054,7 @@ CNumerics::ResidualType<> CGeneralAvgGrad_Flow::ComputeResidual(const CConfig* c
 
   AD::StartPreacc();
   AD::SetPreaccIn(V_i, nDim+9);   AD::SetPreaccIn(V_j, nDim+9);
-  AD::SetPreaccIn(Coord_i, nDim); AD::SetPreaccIn(Coord_j, nDim);
+  SetPreaccEdgeGeometry();
   AD::SetPreaccIn(S_i, 4); AD::SetPreaccIn(S_j, 4);
   AD::SetPreaccIn(PrimVar_Grad_i, nDim+1, nDim);
   AD::SetPreaccIn(PrimVar_Grad_j, nDim+1, nDim);
@@ -1069,15 +1063,9 @@ CNumerics::ResidualType<> CGeneralAvgGrad_Flow::ComputeResidual(const CConfig* c
 
   unsigned short iVar, jVar, iDim;
 
-  /*--- Normalized normal vector ---*/
+  /*--- Normalized normal vector, vector going from iPoint to jPoint and its squared length ---*/
 
-  Area = 0.0;
-  for (iDim = 0; iDim < nDim; iDim++)
-    Area += Normal[iDim]*Normal[iDim];
-  Area = sqrt(Area);
-
-  for (iDim = 0; iDim < nDim; iDim++)
-    UnitNormal[iDim] = Normal[iDim]/Area;
+  SetEdgeGeometricFactors();
 
   /*--- Mean primitive variables ---*/
 
@@ -1088,14 +1076,6 @@ CNumerics::ResidualType<> CGeneralAvgGrad_Flow::ComputeResidual(const CConfig* c
     Mean_PrimVar[iVar] = 0.5*(PrimVar_i[iVar]+PrimVar_j[iVar]);
   }
 
-  /*--- Compute vector going from iPoint to jPoint ---*/
-
-  dist_ij_2 = 0.0;
-  for (iDim = 0; iDim < nDim; iDim++) {
-    Edge_Vector[iDim] = Coord_j[iDim]-Coord_i[iDim];
-    dist_ij_2 += Edge_Vector[iDim]*Edge_Vector[iDim];
-  }
-
   /*--- Laminar and Eddy viscosity ---*/
 
   Laminar_Viscosity_i = V_i[nDim+5];    Laminar_Viscosity_j = V_j[nDim+5];
@@ -74,238 +74,56 @@ void CUpwLin_TransLM::ComputeResidual (su2double *val_residual, su2double **val_
 }
 
 CUpwSca_TransLM::CUpwSca_TransLM(unsigned short val_nDim, unsigned short val_nVar,
-                                 CConfig *config) : CNumerics(val_nDim, val_nVar, config) {
+                                 const CConfig* config) : CUpwScalar(val_nDim, val_nVar, config) { }
 
-  implicit = (config->GetKind_TimeIntScheme_Turb() == EULER_IMPLICIT);
-
-  Gamma = config->GetGamma();
-  Gamma_Minus_One = Gamma - 1.0;
-
-  Velocity_i = new su2double [nDim];
-  Velocity_j = new su2double [nDim];
+void CUpwSca_TransLM::ExtraADPreaccIn() {
+  AD::SetPreaccIn(V_i, nDim+3);
+  AD::SetPreaccIn(V_j, nDim+3);
 }
 
-CUpwSca_TransLM::~CUpwSca_TransLM(void) {
-  delete [] Velocity_i;
-  delete [] Velocity_j;
-}
+void CUpwSca_TransLM::FinishResidualCalc(const CConfig* config) {
 
-void CUpwSca_TransLM::ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j, CConfig *config) {
+  /*--- Mass flux times the transported variables, which are not in conservative form. ---*/
 
-  q_ij = 0;
-  for (iDim = 0; iDim < nDim; iDim++) {
-    q_ij += 0.5*(U_i[iDim]+U_j[iDim])*Normal[iDim];
-  }
-
-  a0 = 0.5*(q_ij+fabs(q_ij));
-  a1 = 0.5*(q_ij-fabs(q_ij));
-  val_residual[0] = a0*TransVar_i[0]+a1*TransVar_j[0];
-  val_residual[1] = a0*TransVar_i[1]+a1*TransVar_j[1];
+  Flux[0] = a0*Density_i*TurbVar_i[0]+a1*Density_j*TurbVar_j[0];
+  Flux[1] = a0*Density_i*TurbVar_i[1]+a1*Density_j*TurbVar_j[1];
 
   if (implicit) {
-    val_Jacobian_i[0][0] = a0;
-    val_Jacobian_j[0][0] = a1;
-    val_Jacobian_i[1][1] = a0;
-    val_Jacobian_j[1][1] = a1;
+    Jacobian_i[0][0] = a0*Density_i;  Jacobian_i[0][1] = 0.0;
+    Jacobian_i[1][0] = 0.0;           Jacobian_i[1][1] = a0*Density_i;
 
-    /*--- Zero out off-diagonal terms just in case ---*/
-    val_Jacobian_i[0][1] = 0;
-    val_Jacobian_j[0][1] = 0;
-    val_Jacobian_i[1][0] = 0;
-    val_Jacobian_j[1][0] = 0;
+    Jacobian_j[0][0] = a1*Density_j;  Jacobian_j[0][1] = 0.0;
+    Jacobian_j[1][0] = 0.0;           Jacobian_j[1][1] = a1*Density_j;
   }
-
 }
 
-CAvgGrad_TransLM::CAvgGrad_TransLM(unsigned short val_nDim, unsigned short val_nVar, CConfig *config) : CNumerics(val_nDim, val_nVar, config) {
-  unsigned short iVar;
+CAvgGrad_TransLM::CAvgGrad_TransLM(unsigned short val_nDim, unsigned short val_nVar,
+                                   bool correct_grad, const CConfig* config) :
+                  CAvgGrad_Scalar(val_nDim, val_nVar, correct_grad, config) { }
 
-  implicit = (config->GetKind_TimeIntScheme_Turb() == EULER_IMPLICIT);
-  incompressible = (config->GetKind_Regime() == INCOMPRESSIBLE);
+void CAvgGrad_TransLM::ExtraADPreaccIn() { }
 
-  Gamma = config->GetGamma();
-  Gamma_Minus_One = Gamma - 1.0;
+void CAvgGrad_TransLM::FinishResidualCalc(const CConfig* config) {
 
-  sigma = 2./3.;
-
-  Edge_Vector = new su2double [nDim];
-  Proj_Mean_GradTransVar_Kappa = new su2double [nVar];
-  Proj_Mean_GradTransVar_Edge = new su2double [nVar];
-  Mean_GradTransVar = new su2double* [nVar];
-  for (iVar = 0; iVar < nVar; iVar++)
-    Mean_GradTransVar[iVar] = new su2double [nDim];
-}
-
-CAvgGrad_TransLM::~CAvgGrad_TransLM(void) {
-
-  unsigned short iVar;
-
-  delete [] Edge_Vector;
-  delete [] Proj_Mean_GradTransVar_Kappa;
-  delete [] Proj_Mean_GradTransVar_Edge;
-  for (iVar = 0; iVar < nVar; iVar++)
-    delete [] Mean_GradTransVar[iVar];
-  delete [] Mean_GradTransVar;
-}
-
-void CAvgGrad_TransLM::ComputeResidual(su2double *val_residual, su2double **Jacobian_i, su2double **Jacobian_j, CConfig *config) {
- /*--- This section is commented out on 04/11/2016
-       after review of the static scan ---*/
- // su2double *Density_Grad_i      = new su2double[nDim];
- // su2double *Density_Grad_j      = new su2double[nDim];
- // su2double *Conservative_Grad_i = new su2double[nDim];
- // su2double *Conservative_Grad_j = new su2double[nDim];
- // su2double *Primitive_Grad_i    = new su2double[nDim];
- // su2double *Primitive_Grad_j    = new su2double[nDim];
- //
- // /*--- Intermediate values for combining viscosities ---*/
- // su2double Inter_Viscosity_i, Inter_Viscosity_j, REth_Viscosity_i, REth_Viscosity_j, Inter_Viscosity_Mean, REth_Viscosity_Mean;
- //
- // /*--- Model constants---*/
- // su2double sigmaf       = 1.0;
- // su2double sigma_thetat = 2.0;
- //
- // /*--- Get density ---*/
- // Density_i = U_i[0];
- // Density_j = U_j[0];
- //
- // /*--- Construct combinations of viscosity ---*/
- // Inter_Viscosity_i    = (Laminar_Viscosity_i+Eddy_Viscosity_i/sigmaf);
- // Inter_Viscosity_j    = (Laminar_Viscosity_j+Eddy_Viscosity_j/sigmaf);
- // Inter_Viscosity_Mean = 0.5*(Inter_Viscosity_i+Inter_Viscosity_j);
- // REth_Viscosity_i     = sigma_thetat*(Laminar_Viscosity_i+Eddy_Viscosity_i);
- // REth_Viscosity_j     = sigma_thetat*(Laminar_Viscosity_j+Eddy_Viscosity_j);
- // REth_Viscosity_Mean  = 0.5*(REth_Viscosity_i+REth_Viscosity_j);
- //
-  ///*--- Compute vector going from iPoint to jPoint ---*/
-  //dist_ij_2 = 0; proj_vector_ij = 0;
-  //for (iDim = 0; iDim < nDim; iDim++) {
-  //  Edge_Vector[iDim] = Coord_j[iDim]-Coord_i[iDim];
-  //  dist_ij_2 += Edge_Vector[iDim]*Edge_Vector[iDim];
-  //  proj_vector_ij += Edge_Vector[iDim]*Normal[iDim];
-  //}
-  //proj_vector_ij = proj_vector_ij/dist_ij_2; // to normalize vectors
- //
-  ///*--- Mean gradient approximation ---*/
-  //for (iVar = 0; iVar < nVar; iVar++) {
-  //  Proj_Mean_GradTransVar_Kappa[iVar] = 0.0;
-  //  // Proj_Mean_GradTransVar_Edge[iVar] = 0.0;
-  //  for (iDim = 0; iDim < nDim; iDim++) {
- //
- //     /* -- Compute primitive grad using chain rule -- */
- //     Density_Grad_i[iDim]      = ConsVar_Grad_i[0][iDim];
- //     Density_Grad_j[iDim]      = ConsVar_Grad_j[0][iDim];
- //     Conservative_Grad_i[iDim] = TransVar_Grad_i[iVar][iDim];
- //     Conservative_Grad_j[iDim] = TransVar_Grad_j[iVar][iDim];
- //     Primitive_Grad_i[iDim]    = 1./Density_i*(Conservative_Grad_i[iDim]-TransVar_i[iVar]*Density_Grad_i[iDim]);
- //     Primitive_Grad_j[iDim]    = 1./Density_j*(Conservative_Grad_j[iDim]-TransVar_j[iVar]*Density_Grad_j[iDim]);
- //
- //     /*--- Compute the average primitive gradient and project it in the normal direction ---*/
- //     Mean_GradTransVar[iVar][iDim] = 0.5*(Primitive_Grad_i[iDim] + Primitive_Grad_j[iDim]);
-  //    Proj_Mean_GradTransVar_Kappa[iVar] += Mean_GradTransVar[iVar][iDim]*Normal[iDim];
-  //  }
-  //}
- //
-  //val_residual[0] = Inter_Viscosity_Mean*Proj_Mean_GradTransVar_Kappa[0];
-  //val_residual[1] = REth_Viscosity_Mean*Proj_Mean_GradTransVar_Kappa[1];
- //
-  ///*--- For Jacobians -> Use of TSL approx. to compute derivatives of the gradients ---*/
-  //if (implicit) {
-  //  Jacobian_i[0][0] = (0.5*Proj_Mean_GradTransVar_Kappa[0]-Inter_Viscosity_Mean*proj_vector_ij);
-  //  Jacobian_j[0][0] = (0.5*Proj_Mean_GradTransVar_Kappa[0]+Inter_Viscosity_Mean*proj_vector_ij);
-  //  Jacobian_i[1][1] = (0.5*Proj_Mean_GradTransVar_Kappa[1]-REth_Viscosity_Mean*proj_vector_ij);
-  //  Jacobian_j[1][1] = (0.5*Proj_Mean_GradTransVar_Kappa[1]+REth_Viscosity_Mean*proj_vector_ij);
-  //}
- //
- // /*--- Free locally allocated memory. For efficiency, these arrays
- //  should really be allocated/deallocated in the constructor/destructor. ---*/
- // delete [] Density_Grad_i;
- // delete [] Density_Grad_j;
- // delete [] Conservative_Grad_i;
- // delete [] Conservative_Grad_j;
- // delete [] Primitive_Grad_i;
- // delete [] Primitive_Grad_j;
- //
-}
-
-CAvgGradCorrected_TransLM::CAvgGradCorrected_TransLM(unsigned short val_nDim, unsigned short val_nVar,
-                                                     CConfig *config) : CNumerics(val_nDim, val_nVar, config) {
-
-  unsigned short iVar;
-
-  implicit = (config->GetKind_TimeIntScheme_Turb() == EULER_IMPLICIT);
-  incompressible = (config->GetKind_Regime() == INCOMPRESSIBLE);
-
-  Gamma = config->GetGamma();
-  Gamma_Minus_One = Gamma - 1.0;
-
-  sigma = 2./3.;
+  /*--- Mean diffusion coefficients of the intermittency and of the REth equations. ---*/
 
-  Edge_Vector = new su2double [nDim];
-  Proj_Mean_GradTurbVar_Kappa = new su2double [nVar];
-  Proj_Mean_GradTurbVar_Edge = new su2double [nVar];
-  Proj_Mean_GradTurbVar_Corrected = new su2double [nVar];
-  Mean_GradTurbVar = new su2double* [nVar];
-  for (iVar = 0; iVar < nVar; iVar++)
-    Mean_GradTurbVar[iVar] = new su2double [nDim];
-}
+  const su2double visc_gamma = 0.5*(Laminar_Viscosity_i + Eddy_Viscosity_i/sigmaf +
+                                    Laminar_Viscosity_j + Eddy_Viscosity_j/sigmaf);
+  const su2double visc_reth = 0.5*sigma_thetat*(Laminar_Viscosity_i + Eddy_Viscosity_i +
+                                                Laminar_Viscosity_j + Eddy_Viscosity_j);
 
-CAvgGradCorrected_TransLM::~CAvgGradCorrected_TransLM(void) {
+  Flux[0] = visc_gamma*Proj_Mean_GradTurbVar[0];
+  Flux[1] = visc_reth*Proj_Mean_GradTurbVar[1];
 
-  unsigned short iVar;
+  /*--- For Jacobians -> Use of TSL approx. to compute derivatives of the gradients ---*/
 
-  delete [] Edge_Vector;
-  delete [] Proj_Mean_GradTurbVar_Kappa;
-  delete [] Proj_Mean_GradTurbVar_Edge;
-  delete [] Proj_Mean_GradTurbVar_Corrected;
-  for (iVar = 0; iVar < nVar; iVar++)
-    delete [] Mean_GradTurbVar[iVar];
-  delete [] Mean_GradTurbVar;
-}
+  if (implicit) {
+    Jacobian_i[0][0] = -visc_gamma*proj_vector_ij;  Jacobian_i[0][1] = 0.0;
+    Jacobian_i[1][0] = 0.0;                         Jacobian_i[1][1] = -visc_reth*proj_vector_ij;
 
-void CAvgGradCorrected_TransLM::ComputeResidual(su2double *val_residual, su2double **Jacobian_i, su2double **Jacobian_j, CConfig *config) {
-
-  //  switch (config->GetKind_Turb_Model()) {
-  //  case SA :
-  //    /*--- Compute mean effective viscosity ---*/
-  //    nu_i = Laminar_Viscosity_i/U_i[0];
-  //    nu_j = Laminar_Viscosity_j/U_j[0];
-  //    nu_e = 0.5*(nu_i+nu_j+TurbVar_i[0]+TurbVar_j[0]);
-  //
-  //    /*--- Compute vector going from iPoint to jPoint ---*/
-  //    dist_ij_2 = 0; proj_vector_ij = 0;
-  //    for (iDim = 0; iDim < nDim; iDim++) {
-  //      Edge_Vector[iDim] = Coord_j[iDim]-Coord_i[iDim];
-  //      dist_ij_2 += Edge_Vector[iDim]*Edge_Vector[iDim];
-  //      proj_vector_ij += Edge_Vector[iDim]*Normal[iDim];
-  //    }
-  //    proj_vector_ij = proj_vector_ij/dist_ij_2;
-  //
-  //    /*--- Mean gradient approximation. Projection of the mean gradient
-  //       in the direction of the edge ---*/
-  //    for (iVar = 0; iVar < nVar; iVar++) {
-  //      Proj_Mean_GradTurbVar_Kappa[iVar] = 0.0;
-  //      Proj_Mean_GradTurbVar_Edge[iVar] = 0.0;
-  //      for (iDim = 0; iDim < nDim; iDim++) {
-  //        Mean_GradTurbVar[iVar][iDim] = 0.5*(TurbVar_Grad_i[iVar][iDim] + TurbVar_Grad_j[iVar][iDim]);
-  //        Proj_Mean_GradTurbVar_Kappa[iVar] += Mean_GradTurbVar[iVar][iDim]*Normal[iDim];
-  //        Proj_Mean_GradTurbVar_Edge[iVar] += Mean_GradTurbVar[iVar][iDim]*Edge_Vector[iDim];
-  //      }
-  //      Proj_Mean_GradTurbVar_Corrected[iVar] = Proj_Mean_GradTurbVar_Kappa[iVar];
-  //      Proj_Mean_GradTurbVar_Corrected[iVar] -= Proj_Mean_GradTurbVar_Edge[iVar]*proj_vector_ij -
-  //          (TurbVar_j[iVar]-TurbVar_i[iVar])*proj_vector_ij;
-  //    }
-  //
-  //    val_residual[0] = nu_e*Proj_Mean_GradTurbVar_Corrected[0]/sigma;
-  //
-  //    /*--- For Jacobians -> Use of TSL approx. to compute derivatives of the gradients ---*/
-  //    if (implicit) {
-  //      Jacobian_i[0][0] = (0.5*Proj_Mean_GradTurbVar_Corrected[0]-nu_e*proj_vector_ij)/sigma;
-  //      Jacobian_j[0][0] = (0.5*Proj_Mean_GradTurbVar_Corrected[0]+nu_e*proj_vector_ij)/sigma;
-  //    }
-  //    break;
-  //
-  //  }
+    Jacobian_j[0][0] = visc_gamma*proj_vector_ij;   Jacobian_j[0][1] = 0.0;
+    Jacobian_j[1][0] = 0.0;                         Jacobian_j[1][1] = visc_reth*proj_vector_ij;
+  }
 }
 
 CSourcePieceWise_TransLM::CSourcePieceWise_TransLM(unsigned short val_nDim, unsigned short val_nVar,
@@ -510,28 +328,6 @@ void CSourcePieceWise_TransLM::ComputeResidual_TransLM(su2double *val_residual,
     val_residual[1] = c_theta*U_i[0]/time_scale *  (1.-f_theta) * (re_theta-TransVar_i[1]);
 
     //SU2_CPP2C COMMENT START
-    cout << "val_res0: "  << val_residual[0]      << endl;
-    cout << "val_res1: "  << val_residual[1]      << endl;
-    cout << "dist_i: "    << dist_i               << endl;
-    cout << "re_v: "      << re_v                 << endl;
-    cout << "c_a1: "      << c_a1                 << endl;
-    cout << "strain: "    << strain               << endl;
-    cout << "primgrad10: "<< PrimVar_Grad_i[1][0] << endl;
-    cout << "primgrad11: "<< PrimVar_Grad_i[1][1] << endl;
-    cout << "primgrad20: "<< PrimVar_Grad_i[2][0] << endl;
-    cout << "primgrad21: "<< PrimVar_Grad_i[2][1] << endl;
-    cout << "f_onset: "   << f_onset              << endl;
-    cout << "TransVar0: " << TransVar_i[0]        << endl;
-    cout << "prod: "      << prod                 << endl;
-    cout << "c_a2: "      << c_a2                 << endl;
-    cout << "Vorticity: " << Vorticity            << endl;
-    cout << "f_turb: "    << f_turb               << endl;
-    cout << "des: "       << des                  << endl;
-    cout << "du_ds: "     << du_ds                << endl;
-    cout << "r_t:    "    << r_t                  << endl;
-    cout << "rey_tc: "    << rey_tc               << endl;
-    cout << "re_theta: "  << re_theta             << endl;
-
     /*-- Calculate term for separation correction --*/
     f_reattach = exp(-pow(0.05*r_t,4));
     gamma_sep = s1*max(0., re_v/(3.235*rey_tc)-1.)*f_reattach;
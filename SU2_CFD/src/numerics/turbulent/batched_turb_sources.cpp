@@ -0,0 +1,261 @@
+/*!
+ * \file batched_turb_sources.cpp
+ * \brief Implementations of the point-batched source terms of the turbulence models.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/numerics/turbulent/batched_turb_sources.hpp"
+#include "../../../../Common/include/omp_structure.hpp"
+
+namespace {
+/*--- Helper to create the kernel for the dimension of the problem. ---*/
+template<template<unsigned short, unsigned short> class Kernel, unsigned short MODEL, class... Ts>
+CTurbSourceBatchNumerics* CreateKernel(unsigned short nDim, const Ts&... args) {
+  if (nDim == 2) return new Kernel<2,MODEL>(args...);
+  return new Kernel<3,MODEL>(args...);
+}
+}
+
+CTurbSourceBatchNumerics* CTurbSourceBatchNumerics::CreateNumerics(unsigned short nDim, const CConfig* config,
+                                                                   const su2double* constants,
+                                                                   su2double kine_Inf, su2double omega_Inf) {
+
+  /*--- The transition models modify the production (and store the intermittency) point by point. ---*/
+
+  if (!config->GetBatchedTurbSources() || (config->GetKind_Trans_Model() != NO_TRANS_MODEL))
+    return nullptr;
+
+  switch (config->GetKind_Turb_Model()) {
+    case SA:
+      return CreateKernel<CSourceBatch_TurbSA, SA>(nDim, config);
+    case SA_NEG:
+      return CreateKernel<CSourceBatch_TurbSA, SA_NEG>(nDim, config);
+    case SA_COMP:
+      return CreateKernel<CSourceBatch_TurbSA, SA_COMP>(nDim, config);
+    case SST:
+      if (config->GetUsing_UQ()) return nullptr;
+      return CreateKernel<CSourceBatch_TurbSST, SST>(nDim, constants, kine_Inf, omega_Inf);
+    case SST_SUST:
+      if (config->GetUsing_UQ()) return nullptr;
+      return CreateKernel<CSourceBatch_TurbSST, SST_SUST>(nDim, constants, kine_Inf, omega_Inf);
+    default:
+      return nullptr;
+  }
+}
+
+template<unsigned short NDIM, unsigned short MODEL>
+CSourceBatch_TurbSA<NDIM,MODEL>::CSourceBatch_TurbSA(const CConfig* config) :
+  gamma(config->GetGamma()),
+  rotating_frame(config->GetRotating_Frame()) {
+
+  /*--- Spalart-Allmaras closure constants, same as CSourceBase_TurbSA. ---*/
+
+  cv1_3 = pow(7.1, 3.0);
+  k2    = pow(0.41, 2.0);
+  cb1   = 0.1355;
+  cw2   = 0.3;
+  ct3   = 1.2;
+  cw3_6 = pow(2.0, 6.0);
+  const su2double sigma = 2./3., cb2 = 0.622;
+  cb2_sigma = cb2/sigma;
+  cw1 = cb1/k2+(1.0+cb2)/sigma;
+}
+
+template<unsigned short NDIM, unsigned short MODEL>
+void CSourceBatch_TurbSA<NDIM,MODEL>::ComputeResidual(CTurbSourceBatch& batch) const {
+
+  /*--- Each iteration is one point, the branches of the point-by-point numerics are
+   *    replaced by selections such that the loop vectorizes (the inactive branches
+   *    are computed with safe values and discarded). ---*/
+
+  SU2_OMP_SIMD
+  for (size_t k = 0; k < CTurbSourceBatch::SIZE; ++k) {
+
+    const su2double nue = batch.TurbVar[0][k];
+    const su2double Volume = batch.Volume[k];
+    const su2double nu = batch.LamVisc[k] / batch.Density[k];
+
+    /*--- Omega, with the rotational correction. ---*/
+
+    su2double Omega = sqrt(pow(batch.Vorticity[0][k],2) + pow(batch.Vorticity[1][k],2) +
+                           pow(batch.Vorticity[2][k],2));
+
+    if (rotating_frame) Omega += 2.0*min(0.0, batch.StrainMag[k]-Omega);
+
+    /*--- Source terms are only applied away from the walls. ---*/
+
+    const bool active = batch.Dist[k] > 1e-10;
+    const su2double dist_2 = active? pow(batch.Dist[k],2) : 1.0;
+    const su2double inv_k2_d2 = 1.0/(k2*dist_2);
+
+    su2double norm2_Grad = 0.0;
+    for (unsigned short iDim = 0; iDim < NDIM; iDim++)
+      norm2_Grad += pow(batch.TurbVarGrad[iDim][k],2);
+
+    const su2double CrossProduction = cb2_sigma*norm2_Grad*Volume;
+
+    /*--- Standard model. ---*/
+
+    const su2double Ji = nue/nu;
+    const su2double Ji_2 = Ji*Ji;
+    const su2double Ji_3 = Ji_2*Ji;
+    const su2double fv1 = Ji_3/(Ji_3+cv1_3);
+    const su2double fv2 = 1.0 - Ji/(1.0+Ji*fv1);
+
+    const su2double Shat = max(Omega + nue*fv2*inv_k2_d2, 1.0e-10);
+    const su2double inv_Shat = 1.0/Shat;
+
+    const su2double Production = cb1*Shat*nue*Volume;
+
+    const su2double r = min(nue*inv_Shat*inv_k2_d2, 10.0);
+    const su2double r_2 = r*r;
+    const su2double g = r + cw2*(r_2*r_2*r_2-r);
+    const su2double g_6 = pow(g,6);
+    const su2double glim = pow((1.0+cw3_6)/(g_6+cw3_6), 1.0/6.0);
+    const su2double fw = g*glim;
+
+    const su2double Destruction = cw1*fw*nue*nue/dist_2*Volume;
+
+    su2double Residual = Production - Destruction + CrossProduction;
+
+    /*--- Implicit part, production and destruction terms. ---*/
+
+    const su2double dfv1 = 3.0*Ji_2*cv1_3/(nu*pow(Ji_3+cv1_3,2));
+    const su2double dfv2 = -(1/nu-Ji_2*dfv1)/pow(1.+Ji*fv1,2);
+    const su2double dShat = (Shat <= 1.0e-10)? 0.0 : (fv2+nue*dfv2)*inv_k2_d2;
+
+    su2double Jacobian = cb1*(nue*dShat+Shat)*Volume;
+
+    const su2double dr = (r == 10.0)? 0.0 : (Shat-nue*dShat)*inv_Shat*inv_Shat*inv_k2_d2;
+    const su2double dg = dr*(1.+cw2*(6.0*r_2*r_2*r-1.0));
+    const su2double dfw = dg*glim*(1.-g_6/(g_6+cw3_6));
+    Jacobian -= cw1*(dfw*nue + 2.0*fw)*nue/dist_2*Volume;
+
+    /*--- Compressibility correction. ---*/
+
+    if (MODEL == SA_COMP) {
+      const su2double SoundSpeed_2 = batch.Pressure[k]*gamma/batch.Density[k];
+      su2double aux_cc = 0.0;
+      for (unsigned short iDim = 0; iDim < NDIM; iDim++)
+        for (unsigned short jDim = 0; jDim < NDIM; jDim++)
+          aux_cc += pow(batch.VelGrad[iDim][jDim][k],2);
+
+      Residual -= 3.5*(nue*nue/SoundSpeed_2)*aux_cc*Volume;
+      Jacobian -= 2.0*3.5*(nue/SoundSpeed_2)*aux_cc*Volume;
+    }
+
+    /*--- Negative model, for non-positive values of the variable. ---*/
+
+    if (MODEL == SA_NEG) {
+      const bool negative = nue <= 0.0;
+      const su2double ProdNeg = cb1*(1.0-ct3)*Omega*nue*Volume;
+      const su2double DestNeg = cw1*nue*nue/dist_2*Volume;
+
+      Residual = negative? ProdNeg + DestNeg + CrossProduction : Residual;
+      Jacobian = negative? cb1*(1.0-ct3)*Omega*Volume + 2.0*cw1*nue/dist_2*Volume : Jacobian;
+    }
+
+    batch.Residual[0][k] = active? Residual : 0.0;
+    batch.Jacobian[0][0][k] = active? Jacobian : 0.0;
+  }
+}
+
+template<unsigned short NDIM, unsigned short MODEL>
+CSourceBatch_TurbSST<NDIM,MODEL>::CSourceBatch_TurbSST(const su2double* constants,
+                                                       su2double kine_Inf, su2double omega_Inf) :
+  beta_star(constants[6]),
+  beta_1(constants[4]),
+  beta_2(constants[5]),
+  alfa_1(constants[8]),
+  alfa_2(constants[9]),
+  a1(constants[7]),
+  kAmb(kine_Inf),
+  omegaAmb(omega_Inf) {
+}
+
+template<unsigned short NDIM, unsigned short MODEL>
+void CSourceBatch_TurbSST<NDIM,MODEL>::ComputeResidual(CTurbSourceBatch& batch) const {
+
+  SU2_OMP_SIMD
+  for (size_t k = 0; k < CTurbSourceBatch::SIZE; ++k) {
+
+    const su2double Density = batch.Density[k];
+    const su2double kine = batch.TurbVar[0][k];
+    const su2double omega = batch.TurbVar[1][k];
+    const su2double F1 = batch.F1[k];
+    const su2double Volume = batch.Volume[k];
+    const su2double StrainMag_2 = pow(batch.StrainMag[k],2);
+
+    const su2double VorticityMag = sqrt(pow(batch.Vorticity[0][k],2) + pow(batch.Vorticity[1][k],2) +
+                                        pow(batch.Vorticity[2][k],2));
+
+    /*--- Blended constants. ---*/
+
+    const su2double alfa_blended = F1*alfa_1 + (1.0 - F1)*alfa_2;
+    const su2double beta_blended = F1*beta_1 + (1.0 - F1)*beta_2;
+
+    /*--- Production. ---*/
+
+    su2double diverg = 0.0;
+    for (unsigned short iDim = 0; iDim < NDIM; iDim++)
+      diverg += batch.VelGrad[iDim][iDim][k];
+
+    su2double pk = batch.EddyVisc[k]*StrainMag_2 - 2.0/3.0*Density*kine*diverg;
+    pk = max(min(pk, 20.0*beta_star*Density*omega*kine), 0.0);
+
+    const su2double zeta = max(omega, VorticityMag*batch.F2[k]/a1);
+
+    su2double pw = alfa_blended*Density*max(StrainMag_2 - 2.0/3.0*zeta*diverg, 0.0);
+
+    /*--- Sustaining terms, see CSourcePieceWise_TurbSST. ---*/
+
+    if (MODEL == SST_SUST) {
+      pk = max(pk, beta_star*Density*kAmb*omegaAmb);
+      pw = max(pw, beta_blended*Density*omegaAmb*omegaAmb);
+    }
+
+    /*--- Production, dissipation, and cross diffusion, only away from the walls. ---*/
+
+    const su2double active = (batch.Dist[k] > 1e-10)? Volume : 0.0;
+
+    batch.Residual[0][k] = (pk - beta_star*Density*omega*kine)*active;
+    batch.Residual[1][k] = (pw - beta_blended*Density*omega*omega + (1.0 - F1)*batch.CDkw[k])*active;
+
+    batch.Jacobian[0][0][k] = -beta_star*omega*active;
+    batch.Jacobian[0][1][k] = -beta_star*kine*active;
+    batch.Jacobian[1][0][k] = 0.0;
+    batch.Jacobian[1][1][k] = -2.0*beta_blended*omega*active;
+  }
+}
+
+template class CSourceBatch_TurbSA<2,SA>;
+template class CSourceBatch_TurbSA<3,SA>;
+template class CSourceBatch_TurbSA<2,SA_NEG>;
+template class CSourceBatch_TurbSA<3,SA_NEG>;
+template class CSourceBatch_TurbSA<2,SA_COMP>;
+template class CSourceBatch_TurbSA<3,SA_COMP>;
+template class CSourceBatch_TurbSST<2,SST>;
+template class CSourceBatch_TurbSST<3,SST>;
+template class CSourceBatch_TurbSST<2,SST_SUST>;
+template class CSourceBatch_TurbSST<3,SST_SUST>;
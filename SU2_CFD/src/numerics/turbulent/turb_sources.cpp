@@ -27,6 +27,7 @@
  */
 
 #include "../../../include/numerics/turbulent/turb_sources.hpp"
+#include "../../../../Common/include/toolboxes/allocation_toolbox.hpp"
 
 CSourceBase_TurbSA::CSourceBase_TurbSA(unsigned short val_nDim,
                                        unsigned short val_nVar,
@@ -57,6 +58,21 @@ CSourceBase_TurbSA::CSourceBase_TurbSA(unsigned short val_nDim,
 
 }
 
+bool CSourceBase_TurbSA::SetPreaccInputs() {
+
+  /*--- Primitives up to the laminar viscosity, velocity gradients for the compressibility corrections. ---*/
+
+  AD::SetPreaccIn(V_i, nDim+6);
+  AD::SetPreaccIn(PrimVar_Grad_i+1, nDim, nDim);
+  AD::SetPreaccIn(Vorticity_i, 3);
+  AD::SetPreaccIn(StrainMag_i);
+  AD::SetPreaccIn(TurbVar_i[0]);
+  AD::SetPreaccIn(TurbVar_Grad_i[0], nDim);
+  AD::SetPreaccIn(Volume); AD::SetPreaccIn(dist_i);
+
+  return true;
+}
+
 CSourcePieceWise_TurbSA::CSourcePieceWise_TurbSA(unsigned short val_nDim,
                                                  unsigned short val_nVar,
                                                  const CConfig* config) :
@@ -67,14 +83,6 @@ CSourcePieceWise_TurbSA::CSourcePieceWise_TurbSA(unsigned short val_nDim,
 
 CNumerics::ResidualType<> CSourcePieceWise_TurbSA::ComputeResidual(const CConfig* config) {
 
-//  AD::StartPreacc();
-//  AD::SetPreaccIn(V_i, nDim+6);
-//  AD::SetPreaccIn(Vorticity_i, nDim);
-//  AD::SetPreaccIn(StrainMag_i);
-//  AD::SetPreaccIn(TurbVar_i[0]);
-//  AD::SetPreaccIn(TurbVar_Grad_i[0], nDim);
-//  AD::SetPreaccIn(Volume); AD::SetPreaccIn(dist_i);
-
 //  BC Transition Model variables
   su2double vmag, rey, re_theta, re_theta_t, re_v;
   su2double tu , nu_cr, nu_t, nu_BC, chi_1, chi_2, term1, term2, term_exponential;
@@ -209,9 +217,6 @@ CNumerics::ResidualType<> CSourcePieceWise_TurbSA::ComputeResidual(const CConfig
 
   }
 
-//  AD::SetPreaccOut(Residual);
-//  AD::EndPreacc();
-
   return ResidualType<>(&Residual, &Jacobian_i, nullptr);
 
 }
@@ -223,14 +228,6 @@ CSourcePieceWise_TurbSA_COMP::CSourcePieceWise_TurbSA_COMP(unsigned short val_nD
 
 CNumerics::ResidualType<> CSourcePieceWise_TurbSA_COMP::ComputeResidual(const CConfig* config) {
 
-  //  AD::StartPreacc();
-  //  AD::SetPreaccIn(V_i, nDim+6);
-  //  AD::SetPreaccIn(Vorticity_i, nDim);
-  //  AD::SetPreaccIn(StrainMag_i);
-  //  AD::SetPreaccIn(TurbVar_i[0]);
-  //  AD::SetPreaccIn(TurbVar_Grad_i[0], nDim);
-  //  AD::SetPreaccIn(Volume); AD::SetPreaccIn(dist_i);
-
   if (incompressible) {
     Density_i = V_i[nDim+2];
     Laminar_Viscosity_i = V_i[nDim+4];
@@ -329,9 +326,6 @@ CNumerics::ResidualType<> CSourcePieceWise_TurbSA_COMP::ComputeResidual(const CC
 
   }
 
-  //  AD::SetPreaccOut(Residual);
-  //  AD::EndPreacc();
-
   return ResidualType<>(&Residual, &Jacobian_i, nullptr);
 
 }
@@ -345,14 +339,6 @@ CNumerics::ResidualType<> CSourcePieceWise_TurbSA_E::ComputeResidual(const CConf
 
   unsigned short iDim, jDim;
 
-  //  AD::StartPreacc();
-  //  AD::SetPreaccIn(V_i, nDim+6);
-  //  AD::SetPreaccIn(Vorticity_i, nDim);
-  //  AD::SetPreaccIn(StrainMag_i);
-  //  AD::SetPreaccIn(TurbVar_i[0]);
-  //  AD::SetPreaccIn(TurbVar_Grad_i[0], nDim);
-  //  AD::SetPreaccIn(Volume); AD::SetPreaccIn(dist_i);
-
   if (incompressible) {
     Density_i = V_i[nDim+2];
     Laminar_Viscosity_i = V_i[nDim+4];
@@ -456,9 +442,6 @@ CNumerics::ResidualType<> CSourcePieceWise_TurbSA_E::ComputeResidual(const CConf
 
   }
 
-  //  AD::SetPreaccOut(Residual);
-  //  AD::EndPreacc();
-
   return ResidualType<>(&Residual, &Jacobian_i, nullptr);
 
 }
@@ -472,14 +455,6 @@ CNumerics::ResidualType<> CSourcePieceWise_TurbSA_E_COMP::ComputeResidual(const
 
   unsigned short iDim;
 
-  //  AD::StartPreacc();
-  //  AD::SetPreaccIn(V_i, nDim+6);
-  //  AD::SetPreaccIn(Vorticity_i, nDim);
-  //  AD::SetPreaccIn(StrainMag_i);
-  //  AD::SetPreaccIn(TurbVar_i[0]);
-  //  AD::SetPreaccIn(TurbVar_Grad_i[0], nDim);
-  //  AD::SetPreaccIn(Volume); AD::SetPreaccIn(dist_i);
-
   if (incompressible) {
     Density_i = V_i[nDim+2];
     Laminar_Viscosity_i = V_i[nDim+4];
@@ -596,9 +571,6 @@ CNumerics::ResidualType<> CSourcePieceWise_TurbSA_E_COMP::ComputeResidual(const
 
   }
 
-  //  AD::SetPreaccOut(Residual);
-  //  AD::EndPreacc();
-
   return ResidualType<>(&Residual, &Jacobian_i, nullptr);
 
 }
@@ -612,14 +584,6 @@ CNumerics::ResidualType<> CSourcePieceWise_TurbSA_Neg::ComputeResidual(const CCo
 
   unsigned short iDim;
 
-//  AD::StartPreacc();
-//  AD::SetPreaccIn(V_i, nDim+6);
-//  AD::SetPreaccIn(Vorticity_i, nDim);
-//  AD::SetPreaccIn(StrainMag_i);
-//  AD::SetPreaccIn(TurbVar_i[0]);
-//  AD::SetPreaccIn(TurbVar_Grad_i[0], nDim);
-//  AD::SetPreaccIn(Volume); AD::SetPreaccIn(dist_i);
-
   if (incompressible) {
     Density_i = V_i[nDim+2];
     Laminar_Viscosity_i = V_i[nDim+4];
@@ -745,9 +709,6 @@ CNumerics::ResidualType<> CSourcePieceWise_TurbSA_Neg::ComputeResidual(const CCo
 
   }
 
-//  AD::SetPreaccOut(Residual);
-//  AD::EndPreacc();
-
   return ResidualType<>(&Residual, &Jacobian_i, nullptr);
 
 }
@@ -936,16 +897,11 @@ void CSourcePieceWise_TurbSST::GetMeanRateOfStrainMatrix(su2double **S_ij)
 
 void CSourcePieceWise_TurbSST::SetReynoldsStressMatrix(su2double turb_ke){
   unsigned short iDim, jDim;
-  su2double **S_ij = new su2double* [3];
+  MemoryAllocation::CScratchScope scratch;
+  su2double **S_ij = scratch.alloc_matrix<su2double>(3, 3);
   su2double divVel = 0;
   su2double TWO3 = 2.0/3.0;
 
-
-
-  for (iDim = 0; iDim < 3; iDim++){
-    S_ij[iDim] = new su2double [3];
-  }
-
   GetMeanRateOfStrainMatrix(S_ij);
 
     /* --- Using rate of strain matrix, calculate Reynolds stress tensor --- */
@@ -960,10 +916,6 @@ void CSourcePieceWise_TurbSST::SetReynoldsStressMatrix(su2double turb_ke){
       - Eddy_Viscosity_i / Density_i * (2 * S_ij[iDim][jDim] - TWO3 * divVel * delta3[iDim][jDim]);
     }
   }
-
-  for (iDim = 0; iDim < 3; iDim++)
-    delete [] S_ij[iDim];
-  delete [] S_ij;
 }
 
 void CSourcePieceWise_TurbSST::SetPerturbedRSM(su2double turb_ke, const CConfig* config){
@@ -1068,10 +1020,8 @@ void CSourcePieceWise_TurbSST::SetPerturbedRSM(su2double turb_ke, const CConfig*
 void CSourcePieceWise_TurbSST::SetPerturbedStrainMag(su2double turb_ke){
   unsigned short iDim, jDim;
   PerturbedStrainMag = 0;
-  su2double **StrainRate = new su2double* [nDim];
-  for (iDim= 0; iDim< nDim; iDim++){
-    StrainRate[iDim] = new su2double [nDim];
-  }
+  MemoryAllocation::CScratchScope scratch;
+  su2double **StrainRate = scratch.alloc_matrix<su2double>(nDim, nDim);
 
   /* compute perturbed strain rate tensor */
 
@@ -1099,10 +1049,4 @@ void CSourcePieceWise_TurbSST::SetPerturbedStrainMag(su2double turb_ke){
   }
 
   PerturbedStrainMag = sqrt(2.0*PerturbedStrainMag);
-
-  for (iDim= 0; iDim< nDim; iDim++){
-    delete [] StrainRate[iDim];
-  }
-
-  delete [] StrainRate;
 }
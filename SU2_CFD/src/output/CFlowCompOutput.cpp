@@ -200,6 +200,18 @@ void CFlowCompOutput::SetHistoryOutputFields(CConfig *config){
   /// DESCRIPTION: Linear solver iterations
   AddHistoryOutput("LINSOL_ITER", "Linear_Solver_Iterations", ScreenOutputFormat::INTEGER, "LINSOL", "Number of iterations of the linear solver.");
   AddHistoryOutput("LINSOL_RESIDUAL", "LinSolRes", ScreenOutputFormat::FIXED, "LINSOL", "Residual of the linear solver.");
+  AddHistoryOutput("LINSOL_PREC_AGE", "LinSolPrecAge", ScreenOutputFormat::INTEGER, "LINSOL", "Number of linear solves since the preconditioner was built (0 if it was rebuilt).");
+  AddHistoryOutput("LINSOL_TOL", "LinSolTol", ScreenOutputFormat::SCIENTIFIC, "LINSOL", "Relative tolerance of the linear solver (see LINEAR_SOLVER_ADAPTIVE_ERROR).");
+
+  /// DESCRIPTION: Fraction of the limiters computed
+  if (config->GetLimiterFreeze()) {
+    AddHistoryOutput("LIMITER_UPDATE", "LimiterUpdate", ScreenOutputFormat::FIXED, "LIMITER", "Fraction of the points whose limiters were computed (see LIMITER_FREEZE).");
+  }
+
+  /// DESCRIPTION: Fraction of the points not frozen by the active set
+  if (config->GetActiveSet()) {
+    AddHistoryOutput("ACTIVE_SET", "ActiveSet", ScreenOutputFormat::FIXED, "ACTIVE_SET", "Fraction of the points that are not frozen (see ACTIVE_SET).");
+  }
 
   /// BEGIN_GROUP: ENGINE_OUTPUT, DESCRIPTION: Engine output
   /// DESCRIPTION: Aero CD drag
@@ -651,6 +663,16 @@ void CFlowCompOutput::LoadHistoryData(CConfig *config, CGeometry *geometry, CSol
 
   SetHistoryOutputValue("LINSOL_ITER", flow_solver->GetIterLinSolver());
   SetHistoryOutputValue("LINSOL_RESIDUAL", log10(flow_solver->GetResLinSolver()));
+  SetHistoryOutputValue("LINSOL_PREC_AGE", flow_solver->System.GetPrecondAge());
+  SetHistoryOutputValue("LINSOL_TOL", flow_solver->System.GetTolerance());
+
+  if (config->GetLimiterFreeze()) {
+    SetHistoryOutputValue("LIMITER_UPDATE", flow_solver->GetLimiterUpdateFraction());
+  }
+
+  if (config->GetActiveSet()) {
+    SetHistoryOutputValue("ACTIVE_SET", flow_solver->GetActiveSetFraction());
+  }
 
   if (config->GetDeform_Mesh()){
     SetHistoryOutputValue("DEFORM_MIN_VOLUME", mesh_solver->GetMinimum_Volume());
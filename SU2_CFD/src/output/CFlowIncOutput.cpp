@@ -194,6 +194,8 @@ void CFlowIncOutput::SetHistoryOutputFields(CConfig *config){
   /// DESCRIPTION: Linear solver iterations
   AddHistoryOutput("LINSOL_ITER", "LinSolIter", ScreenOutputFormat::INTEGER, "LINSOL", "Number of iterations of the linear solver.");
   AddHistoryOutput("LINSOL_RESIDUAL", "LinSolRes", ScreenOutputFormat::FIXED, "LINSOL", "Residual of the linear solver.");
+  AddHistoryOutput("LINSOL_PREC_AGE", "LinSolPrecAge", ScreenOutputFormat::INTEGER, "LINSOL", "Number of linear solves since the preconditioner was built (0 if it was rebuilt).");
+  AddHistoryOutput("LINSOL_TOL", "LinSolTol", ScreenOutputFormat::SCIENTIFIC, "LINSOL", "Relative tolerance of the linear solver (see LINEAR_SOLVER_ADAPTIVE_ERROR).");
 
   AddHistoryOutput("MIN_DELTA_TIME", "Min DT", ScreenOutputFormat::SCIENTIFIC, "CFL_NUMBER", "Current minimum local time step");
   AddHistoryOutput("MAX_DELTA_TIME", "Max DT", ScreenOutputFormat::SCIENTIFIC, "CFL_NUMBER", "Current maximum local time step");
@@ -308,6 +310,8 @@ void CFlowIncOutput::LoadHistoryData(CConfig *config, CGeometry *geometry, CSolv
 
   SetHistoryOutputValue("LINSOL_ITER", flow_solver->GetIterLinSolver());
   SetHistoryOutputValue("LINSOL_RESIDUAL", log10(flow_solver->GetResLinSolver()));
+  SetHistoryOutputValue("LINSOL_PREC_AGE", flow_solver->System.GetPrecondAge());
+  SetHistoryOutputValue("LINSOL_TOL", flow_solver->System.GetTolerance());
 
   if (config->GetDeform_Mesh()){
     SetHistoryOutputValue("DEFORM_MIN_VOLUME", mesh_solver->GetMinimum_Volume());
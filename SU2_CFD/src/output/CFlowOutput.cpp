@@ -28,6 +28,7 @@
 #include "../../include/output/CFlowOutput.hpp"
 #include "../../../Common/include/geometry/CGeometry.hpp"
 #include "../../include/solvers/CSolver.hpp"
+#include "../../../Common/include/toolboxes/CSumReduction.hpp"
 
 CFlowOutput::CFlowOutput(CConfig *config, unsigned short nDim, bool fem_output) : COutput (config, nDim, fem_output){
 
@@ -373,19 +374,31 @@ void CFlowOutput::SetAnalyzeSurface(CSolver *solver, CGeometry *geometry, CConfi
 
 #ifdef HAVE_MPI
 
-  SU2_MPI::Allreduce(Surface_MassFlow_Local, Surface_MassFlow_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(Surface_Mach_Local, Surface_Mach_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(Surface_Temperature_Local, Surface_Temperature_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(Surface_Density_Local, Surface_Density_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(Surface_Enthalpy_Local, Surface_Enthalpy_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(Surface_NormalVelocity_Local, Surface_NormalVelocity_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(Surface_StreamVelocity2_Local, Surface_StreamVelocity2_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(Surface_TransvVelocity2_Local, Surface_TransvVelocity2_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(Surface_Pressure_Local, Surface_Pressure_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(Surface_TotalTemperature_Local, Surface_TotalTemperature_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(Surface_TotalPressure_Local, Surface_TotalPressure_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(Surface_Area_Local, Surface_Area_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(Surface_MassFlow_Abs_Local, Surface_MassFlow_Abs_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  /*--- Sum the values of all the surfaces over the ranks with a single reduction. ---*/
+
+  CSumReduction reduction;
+
+  auto AddToReduction = [&](const su2double* local, su2double* total) {
+    for (iMarker_Analyze = 0; iMarker_Analyze < nMarker_Analyze; iMarker_Analyze++)
+      total[iMarker_Analyze] = local[iMarker_Analyze];
+    reduction.Add(total, nMarker_Analyze);
+  };
+
+  AddToReduction(Surface_MassFlow_Local, Surface_MassFlow_Total);
+  AddToReduction(Surface_Mach_Local, Surface_Mach_Total);
+  AddToReduction(Surface_Temperature_Local, Surface_Temperature_Total);
+  AddToReduction(Surface_Density_Local, Surface_Density_Total);
+  AddToReduction(Surface_Enthalpy_Local, Surface_Enthalpy_Total);
+  AddToReduction(Surface_NormalVelocity_Local, Surface_NormalVelocity_Total);
+  AddToReduction(Surface_StreamVelocity2_Local, Surface_StreamVelocity2_Total);
+  AddToReduction(Surface_TransvVelocity2_Local, Surface_TransvVelocity2_Total);
+  AddToReduction(Surface_Pressure_Local, Surface_Pressure_Total);
+  AddToReduction(Surface_TotalTemperature_Local, Surface_TotalTemperature_Total);
+  AddToReduction(Surface_TotalPressure_Local, Surface_TotalPressure_Total);
+  AddToReduction(Surface_Area_Local, Surface_Area_Total);
+  AddToReduction(Surface_MassFlow_Abs_Local, Surface_MassFlow_Abs_Total);
+
+  reduction.Complete();
 
 #else
 
@@ -1513,6 +1526,12 @@ void CFlowOutput::WriteForcesBreakdown(CConfig *config, CGeometry *geometry, CSo
           Breakdown_file << "Critical Pressure (non-dim):   " << config->GetPressure_Critical() /config->GetPressure_Ref() << "\n";
           Breakdown_file << "Critical Temperature (non-dim) :  " << config->GetTemperature_Critical() /config->GetTemperature_Ref() << "\n";
           break;
+
+        case TABULATED_GAS:
+          Breakdown_file << "Fluid Model: Tabulated "<< "\n";
+          Breakdown_file << "Table nodes (density x energy): " << config->GetTabulatedGas_Size(0) << " x " << config->GetTabulatedGas_Size(1) << "\n";
+          Breakdown_file << "Table file: " << config->GetTabulatedGas_FileName() << "\n";
+          break;
       }
 
       if (viscous) {
@@ -2873,6 +2892,20 @@ void CFlowOutput::SetTimeAveragedFields(){
 }
 
 void CFlowOutput::LoadTimeAveragedData(unsigned long iPoint, CVariable *Node_Flow){
+
+  /*--- The fluctuations are updated with Welford's algorithm, C_n = C_n-1 + ((x-xm_n-1)*(y-ym_n) - C_n-1)/n,
+   *    which does not suffer from the cancellation of <xy> - xm*ym, the old means are read first. ---*/
+
+  const su2double u = Node_Flow->GetVelocity(iPoint,0);
+  const su2double v = Node_Flow->GetVelocity(iPoint,1);
+  const su2double w = (nDim == 3)? Node_Flow->GetVelocity(iPoint,2) : su2double(0.0);
+  const su2double p = Node_Flow->GetPressure(iPoint);
+
+  const su2double umeanOld = GetVolumeOutputValue("MEAN_VELOCITY-X", iPoint);
+  const su2double vmeanOld = GetVolumeOutputValue("MEAN_VELOCITY-Y", iPoint);
+  const su2double wmeanOld = (nDim == 3)? GetVolumeOutputValue("MEAN_VELOCITY-Z", iPoint) : su2double(0.0);
+  const su2double pmeanOld = GetVolumeOutputValue("MEAN_PRESSURE", iPoint);
+
   SetAvgVolumeOutputValue("MEAN_DENSITY", iPoint, Node_Flow->GetDensity(iPoint));
   SetAvgVolumeOutputValue("MEAN_VELOCITY-X", iPoint, Node_Flow->GetVelocity(iPoint,0));
   SetAvgVolumeOutputValue("MEAN_VELOCITY-Y", iPoint, Node_Flow->GetVelocity(iPoint,1));
@@ -2891,25 +2924,18 @@ void CFlowOutput::LoadTimeAveragedData(unsigned long iPoint, CVariable *Node_Flo
     SetAvgVolumeOutputValue("RMS_UW", iPoint,  Node_Flow->GetVelocity(iPoint,2) * Node_Flow->GetVelocity(iPoint,0));
   }
 
-  const su2double umean  = GetVolumeOutputValue("MEAN_VELOCITY-X", iPoint);
-  const su2double uumean = GetVolumeOutputValue("RMS_U", iPoint);
-  const su2double vmean  = GetVolumeOutputValue("MEAN_VELOCITY-Y", iPoint);
-  const su2double vvmean = GetVolumeOutputValue("RMS_V", iPoint);
-  const su2double uvmean = GetVolumeOutputValue("RMS_UV", iPoint);
-  const su2double pmean  = GetVolumeOutputValue("MEAN_PRESSURE", iPoint);
-  const su2double ppmean = GetVolumeOutputValue("RMS_P", iPoint);
-
-  SetVolumeOutputValue("UUPRIME", iPoint, -(umean*umean - uumean));
-  SetVolumeOutputValue("VVPRIME", iPoint, -(vmean*vmean - vvmean));
-  SetVolumeOutputValue("UVPRIME", iPoint, -(umean*vmean - uvmean));
-  SetVolumeOutputValue("PPRIME",  iPoint, -(pmean*pmean - ppmean));
+  const su2double umean = GetVolumeOutputValue("MEAN_VELOCITY-X", iPoint);
+  const su2double vmean = GetVolumeOutputValue("MEAN_VELOCITY-Y", iPoint);
+  const su2double pmean = GetVolumeOutputValue("MEAN_PRESSURE", iPoint);
+
+  SetAvgVolumeOutputValue("UUPRIME", iPoint, (u-umeanOld)*(u-umean));
+  SetAvgVolumeOutputValue("VVPRIME", iPoint, (v-vmeanOld)*(v-vmean));
+  SetAvgVolumeOutputValue("UVPRIME", iPoint, (u-umeanOld)*(v-vmean));
+  SetAvgVolumeOutputValue("PPRIME",  iPoint, (p-pmeanOld)*(p-pmean));
   if (nDim == 3){
-    const su2double wmean  = GetVolumeOutputValue("MEAN_VELOCITY-Z", iPoint);
-    const su2double wwmean = GetVolumeOutputValue("RMS_W", iPoint);
-    const su2double uwmean = GetVolumeOutputValue("RMS_UW", iPoint);
-    const su2double vwmean = GetVolumeOutputValue("RMS_VW", iPoint);
-    SetVolumeOutputValue("WWPRIME", iPoint, -(wmean*wmean - wwmean));
-    SetVolumeOutputValue("UWPRIME", iPoint, -(umean*wmean - uwmean));
-    SetVolumeOutputValue("VWPRIME",  iPoint, -(vmean*wmean - vwmean));
+    const su2double wmean = GetVolumeOutputValue("MEAN_VELOCITY-Z", iPoint);
+    SetAvgVolumeOutputValue("WWPRIME", iPoint, (w-wmeanOld)*(w-wmean));
+    SetAvgVolumeOutputValue("UWPRIME", iPoint, (u-umeanOld)*(w-wmean));
+    SetAvgVolumeOutputValue("VWPRIME", iPoint, (v-vmeanOld)*(w-wmean));
   }
 }
@@ -73,6 +73,7 @@ CMultizoneOutput::CMultizoneOutput(CConfig* driver_config, CConfig** config, uns
 
   string hist_ext = ".csv";
   if (driver_config->GetTabular_FileFormat() == TAB_TECPLOT) hist_ext = ".dat";
+  if (historyBinary) hist_ext = ".bin";
 
   historyFilename += hist_ext;
 
@@ -41,11 +41,38 @@
 #include "../../include/output/filewriter/CSU2FileWriter.hpp"
 #include "../../include/output/filewriter/CSU2BinaryFileWriter.hpp"
 #include "../../include/output/filewriter/CSU2MeshFileWriter.hpp"
+#include "../../include/output/filewriter/CSU2BinaryMeshFileWriter.hpp"
+#include "../../include/output/filewriter/CHDF5FileWriter.hpp"
+#include "../../include/output/filewriter/CADIOS2StreamWriter.hpp"
+#include "../../include/output/filewriter/CSurfaceSamplingWriter.hpp"
+#include "../../include/output/tools/CProbeOutput.hpp"
+#include "../../../Common/include/toolboxes/CRegionProfiler.hpp"
 
 
 #include "../../../Common/include/geometry/CGeometry.hpp"
 #include "../../include/solvers/CSolver.hpp"
 
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+
+unsigned long COutput::continuationIter = 0;
+
+int COutput::checkpointActive = -1;
+passivedouble COutput::checkpointDeadline = 0.0;
+volatile std::sig_atomic_t COutput::checkpointSignals = 0;
+volatile std::sig_atomic_t COutput::terminateSignal = 0;
+
+namespace {
+/*--- Times of the checkpoints are measured from the start of the program. ---*/
+const auto programStart = std::chrono::steady_clock::now();
+
+passivedouble SecondsSinceStart() {
+  return std::chrono::duration<passivedouble>(std::chrono::steady_clock::now() - programStart).count();
+}
+}
+
+
 COutput::COutput(CConfig *config, unsigned short nDim, bool fem_output): femOutput(fem_output) {
 
   this->nDim = nDim;
@@ -55,11 +82,50 @@ COutput::COutput(CConfig *config, unsigned short nDim, bool fem_output): femOutp
 
   fieldWidth = 12;
 
+  /*--- Asynchronous output is not possible with reverse AD (the tape is not thread-safe), and
+   *    with MPI it requires the helper thread to be allowed to communicate concurrently. ---*/
+
+  asyncOutput = config->GetWrt_Async_Output();
+#ifdef CODI_REVERSE_TYPE
+  asyncOutput = false;
+#endif
+  asyncComm = MPI_COMM_WORLD;
+#ifdef HAVE_MPI
+  if (asyncOutput) {
+    int provided = MPI_THREAD_SINGLE;
+    MPI_Query_thread(&provided);
+    if (provided < MPI_THREAD_MULTIPLE) {
+      asyncOutput = false;
+      if (rank == MASTER_NODE)
+        cout << "WARNING: WRT_ASYNC_OUTPUT requires MPI_THREAD_MULTIPLE (--thread_multiple), "
+                "the volume output will be written synchronously." << endl;
+    }
+  }
+  if (asyncOutput) MPI_Comm_dup(MPI_COMM_WORLD, &asyncComm);
+#endif
+  asyncDone = false;
+  asyncBandwidth = 0.0;
+  volumeStream = nullptr;
+  surfaceStream = nullptr;
+  probeOutput = nullptr;
+  surfaceSampling = nullptr;
+  if (femOutput && (rank == MASTER_NODE) &&
+      (config->GetnOutput_Probes() + config->GetnOutput_Probe_Planes() + config->GetnOutput_Probe_Boxes() +
+       config->GetnMarker_Surface_Sampling() > 0))
+    cout << "WARNING: The output probes, boxes and surface sampling are not available for the FEM solvers, "
+            "they are ignored." << endl;
+  writeTimeIter = 0;
+  writeTimeStep = 0.0;
+
   convergenceTable = new PrintingToolbox::CTablePrinter(&std::cout);
   multiZoneHeaderTable = new PrintingToolbox::CTablePrinter(&std::cout);
-  fileWritingTable = new PrintingToolbox::CTablePrinter(&std::cout);
+  fileWritingTable = new PrintingToolbox::CTablePrinter(asyncOutput? &asyncFileTable : &std::cout);
   historyFileTable = new PrintingToolbox::CTablePrinter(&histFile, "");
 
+  historyBinary = config->GetWrt_History_Binary();
+  historyFlushFreq = config->GetHistory_Flush_Freq();
+  nHistoryWrites = 0;
+
   /*--- Set default filenames ---*/
 
   surfaceFilename = "surface";
@@ -74,6 +140,7 @@ COutput::COutput(CConfig *config, unsigned short nDim, bool fem_output): femOutp
 
   string hist_ext = ".csv";
   if (config->GetTabular_FileFormat() == TAB_TECPLOT) hist_ext = ".dat";
+  if (historyBinary) hist_ext = ".bin";
 
   /*--- Append the zone ID ---*/
 
@@ -84,6 +151,9 @@ COutput::COutput(CConfig *config, unsigned short nDim, bool fem_output): femOutp
   if (config->GetTime_Domain() && config->GetRestart()) {
     historyFilename = config->GetUnsteady_FileName(historyFilename, config->GetRestart_Iter(), hist_ext);
   }
+  else if (config->GetTime_Domain() && (continuationIter > 0)) {
+    historyFilename = config->GetUnsteady_FileName(historyFilename, continuationIter, hist_ext);
+  }
 
   historySep = ",";
 
@@ -175,6 +245,25 @@ COutput::COutput(CConfig *config, unsigned short nDim, bool fem_output): femOutp
 
 COutput::~COutput(void) {
 
+  /*--- Wait for pending asynchronous output, it uses the sorters. ---*/
+
+  if (asyncWriter.joinable()) asyncWriter.join();
+
+  /*--- Close the in-situ streams, they may communicate on the communicator of the sorters. ---*/
+
+  delete volumeStream;
+  delete surfaceStream;
+  delete probeOutput;
+  delete surfaceSampling;
+
+#ifdef HAVE_MPI
+  if (asyncOutput) SU2_MPI::Comm_free(&asyncComm);
+#endif
+
+  /*--- Write the lines of the history file that are still buffered. ---*/
+
+  if (histFile.is_open()) FlushHistoryFile();
+
   delete convergenceTable;
   delete multiZoneHeaderTable;
   delete fileWritingTable;
@@ -202,6 +291,8 @@ void COutput::SetHistory_Output(CGeometry *geometry,
                                   unsigned long OuterIter,
                                   unsigned long InnerIter) {
 
+  SU2_PROFILE_REGION("Output (history)");
+
   curTimeIter  = TimeIter;
   curAbsTimeIter = TimeIter - config->GetRestart_Iter();
   curOuterIter = OuterIter;
@@ -321,6 +412,13 @@ void COutput::AllocateDataSorters(CConfig *config, CGeometry *geometry){
 
   }
 
+  /*--- Asynchronous output sorts and writes on its own communicator. ---*/
+
+  if (asyncOutput) {
+    volumeDataSorter->SetComm(asyncComm);
+    surfaceDataSorter->SetComm(asyncComm);
+  }
+
 }
 
 void COutput::Load_Data(CGeometry *geometry, CConfig *config, CSolver** solver_container){
@@ -333,6 +431,8 @@ void COutput::Load_Data(CGeometry *geometry, CConfig *config, CSolver** solver_c
 
   LoadDataIntoSorter(config, geometry, solver_container);
 
+  StoreWriteTimeInfo();
+
   /*--- Partition and sort the volume output data -- */
 
   volumeDataSorter->SortOutputData();
@@ -353,7 +453,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
     case SURFACE_CSV:
 
       if (fileName.empty())
-        fileName = config->GetFilename(surfaceFilename, "", curTimeIter);
+        fileName = config->GetFilename(surfaceFilename, "", writeTimeIter);
 
       surfaceDataSorter->SortConnectivity(config, geometry);
       surfaceDataSorter->SortOutputData();
@@ -369,7 +469,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
     case RESTART_ASCII: case CSV:
 
       if (fileName.empty())
-        fileName = config->GetFilename(restartFilename, "", curTimeIter);
+        fileName = config->GetFilename(restartFilename, "", writeTimeIter);
 
       if (rank == MASTER_NODE) {
           (*fileWritingTable) << "SU2 ASCII restart" << fileName + CSU2FileWriter::fileExt;
@@ -382,13 +482,14 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
     case RESTART_BINARY:
 
       if (fileName.empty())
-        fileName = config->GetFilename(restartFilename, "", curTimeIter);
+        fileName = config->GetFilename(restartFilename, "", writeTimeIter);
 
       if (rank == MASTER_NODE) {
           (*fileWritingTable) << "SU2 restart" << fileName + CSU2BinaryFileWriter::fileExt;
       }
 
-      fileWriter = new CSU2BinaryFileWriter(fileName, volumeDataSorter);
+      fileWriter = new CSU2BinaryFileWriter(fileName, volumeDataSorter,
+                                            config->GetRestart_Compression(), restartErrorBound);
 
       break;
 
@@ -401,13 +502,23 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
 
       volumeDataSorter->SortConnectivity(config, geometry, true);
 
-      /*--- Set the mesh ASCII format ---*/
-      if (rank == MASTER_NODE) {
-          (*fileWritingTable) << "SU2 mesh" << fileName + CSU2MeshFileWriter::fileExt;
+      /*--- Binary SU2 meshes are written in the same format, otherwise ASCII ---*/
+      if (config->GetMesh_FileFormat() == SU2_BINARY) {
+        if (rank == MASTER_NODE) {
+            (*fileWritingTable) << "SU2 binary mesh" << fileName + CSU2BinaryMeshFileWriter::fileExt;
+        }
+
+        fileWriter = new CSU2BinaryMeshFileWriter(fileName, volumeDataSorter,
+                                                  config->GetiZone(), config->GetnZone());
       }
+      else {
+        if (rank == MASTER_NODE) {
+            (*fileWritingTable) << "SU2 mesh" << fileName + CSU2MeshFileWriter::fileExt;
+        }
 
-      fileWriter = new CSU2MeshFileWriter(fileName, volumeDataSorter,
-                                          config->GetiZone(), config->GetnZone());
+        fileWriter = new CSU2MeshFileWriter(fileName, volumeDataSorter,
+                                            config->GetiZone(), config->GetnZone());
+      }
 
 
       break;
@@ -415,7 +526,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
     case TECPLOT_BINARY:
 
       if (fileName.empty())
-        fileName = config->GetFilename(volumeFilename, "", curTimeIter);
+        fileName = config->GetFilename(volumeFilename, "", writeTimeIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
 
@@ -427,14 +538,14 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
       }
 
       fileWriter = new CTecplotBinaryFileWriter(fileName, volumeDataSorter,
-                                                curTimeIter, GetHistoryFieldValue("TIME_STEP"));
+                                                writeTimeIter, writeTimeStep);
 
       break;
 
     case TECPLOT:
 
       if (fileName.empty())
-        fileName = config->GetFilename(volumeFilename, "", curTimeIter);
+        fileName = config->GetFilename(volumeFilename, "", writeTimeIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
 
@@ -446,14 +557,14 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
       }
 
       fileWriter = new CTecplotFileWriter(fileName, volumeDataSorter,
-                                          curTimeIter, GetHistoryFieldValue("TIME_STEP"));
+                                          writeTimeIter, writeTimeStep);
 
       break;
 
     case PARAVIEW_XML:
 
       if (fileName.empty())
-        fileName = config->GetFilename(volumeFilename, "", curTimeIter);
+        fileName = config->GetFilename(volumeFilename, "", writeTimeIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
 
@@ -471,7 +582,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
     case PARAVIEW_BINARY:
 
       if (fileName.empty())
-        fileName = config->GetFilename(volumeFilename, "", curTimeIter);
+        fileName = config->GetFilename(volumeFilename, "", writeTimeIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
 
@@ -486,11 +597,57 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
 
       break;
 
+    case HDF5:
+
+      /*--- All the time steps are written to the same file, hence no iteration number in its name. ---*/
+
+      if (fileName.empty())
+        fileName = config->GetFilename(volumeFilename, "", writeTimeIter, false);
+
+      /*--- Load and sort the output data and connectivity. ---*/
+
+      volumeDataSorter->SortConnectivity(config, geometry, true);
+
+      /*--- Write HDF5 ---*/
+      if (rank == MASTER_NODE) {
+          (*fileWritingTable) << "HDF5/XDMF" << fileName + CHDF5FileWriter::fileExt;
+      }
+
+      fileWriter = new CHDF5FileWriter(fileName, volumeDataSorter, writeTimeIter, writeTimeStep,
+                                       config->GetDynamic_Grid(), config->GetHDF5_Compression());
+
+      break;
+
+    case ADIOS2:
+
+      /*--- The stream is opened by the first output and receives one step per output. ---*/
+
+      if (fileName.empty())
+        fileName = config->GetFilename(volumeFilename, "", writeTimeIter, false);
+
+      /*--- Load and sort the output data and connectivity. ---*/
+
+      volumeDataSorter->SortConnectivity(config, geometry, true);
+
+      /*--- Write ADIOS2 stream ---*/
+      if (rank == MASTER_NODE) {
+          (*fileWritingTable) << "ADIOS2 stream" << fileName + CADIOS2StreamWriter::fileExt;
+      }
+
+      if (volumeStream == nullptr)
+        volumeStream = new CADIOS2StreamWriter(fileName, volumeDataSorter, config->GetADIOS2_Engine(),
+                                               config->GetADIOS2_Config_FileName());
+      volumeStream->SetTime(writeTimeIter, writeTimeStep);
+
+      fileWriter = volumeStream;
+
+      break;
+
     case PARAVIEW_MULTIBLOCK:
       {
 
         if (fileName.empty())
-          fileName = config->GetFilename(volumeFilename, "", curTimeIter);
+          fileName = config->GetFilename(volumeFilename, "", writeTimeIter);
 
         /*--- Sort volume connectivity ---*/
 
@@ -498,7 +655,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
 
         /*--- The file name of the multiblock file is the case name (i.e. the config file name w/o ext.) ---*/
 
-        fileName = config->GetUnsteady_FileName(config->GetCaseName(), curTimeIter, "");
+        fileName = config->GetUnsteady_FileName(config->GetCaseName(), writeTimeIter, "");
 
         /*--- Allocate the vtm file writer ---*/
 
@@ -583,7 +740,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
     case PARAVIEW:
 
       if (fileName.empty())
-        fileName = config->GetFilename(volumeFilename, "", curTimeIter);
+        fileName = config->GetFilename(volumeFilename, "", writeTimeIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
 
@@ -601,7 +758,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
     case SURFACE_PARAVIEW:
 
       if (fileName.empty())
-        fileName = config->GetFilename(surfaceFilename, "", curTimeIter);
+        fileName = config->GetFilename(surfaceFilename, "", writeTimeIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
 
@@ -620,7 +777,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
     case SURFACE_PARAVIEW_BINARY:
 
       if (fileName.empty())
-        fileName = config->GetFilename(surfaceFilename, "", curTimeIter);
+        fileName = config->GetFilename(surfaceFilename, "", writeTimeIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
 
@@ -639,7 +796,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
     case SURFACE_PARAVIEW_XML:
 
       if (fileName.empty())
-        fileName = config->GetFilename(surfaceFilename, "", curTimeIter);
+        fileName = config->GetFilename(surfaceFilename, "", writeTimeIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
 
@@ -655,10 +812,58 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
 
       break;
 
+    case SURFACE_HDF5:
+
+      /*--- All the time steps are written to the same file, hence no iteration number in its name. ---*/
+
+      if (fileName.empty())
+        fileName = config->GetFilename(surfaceFilename, "", writeTimeIter, false);
+
+      /*--- Load and sort the output data and connectivity. ---*/
+
+      surfaceDataSorter->SortConnectivity(config, geometry);
+      surfaceDataSorter->SortOutputData();
+
+      /*--- Write surface HDF5 ---*/
+      if (rank == MASTER_NODE) {
+          (*fileWritingTable) << "HDF5/XDMF surface" << fileName + CHDF5FileWriter::fileExt;
+      }
+
+      fileWriter = new CHDF5FileWriter(fileName, surfaceDataSorter, writeTimeIter, writeTimeStep,
+                                       config->GetDynamic_Grid(), config->GetHDF5_Compression());
+
+      break;
+
+    case SURFACE_ADIOS2:
+
+      /*--- The stream is opened by the first output and receives one step per output. ---*/
+
+      if (fileName.empty())
+        fileName = config->GetFilename(surfaceFilename, "", writeTimeIter, false);
+
+      /*--- Load and sort the output data and connectivity. ---*/
+
+      surfaceDataSorter->SortConnectivity(config, geometry);
+      surfaceDataSorter->SortOutputData();
+
+      /*--- Write surface ADIOS2 stream ---*/
+      if (rank == MASTER_NODE) {
+          (*fileWritingTable) << "ADIOS2 surface stream" << fileName + CADIOS2StreamWriter::fileExt;
+      }
+
+      if (surfaceStream == nullptr)
+        surfaceStream = new CADIOS2StreamWriter(fileName, surfaceDataSorter, config->GetADIOS2_Engine(),
+                                                config->GetADIOS2_Config_FileName());
+      surfaceStream->SetTime(writeTimeIter, writeTimeStep);
+
+      fileWriter = surfaceStream;
+
+      break;
+
     case SURFACE_TECPLOT:
 
       if (fileName.empty())
-        fileName = config->GetFilename(surfaceFilename, "", curTimeIter);
+        fileName = config->GetFilename(surfaceFilename, "", writeTimeIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
 
@@ -671,14 +876,14 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
       }
 
       fileWriter = new CTecplotFileWriter(fileName, surfaceDataSorter,
-                                          curTimeIter, GetHistoryFieldValue("TIME_STEP"));
+                                          writeTimeIter, writeTimeStep);
 
       break;
 
     case SURFACE_TECPLOT_BINARY:
 
       if (fileName.empty())
-        fileName = config->GetFilename(surfaceFilename, "", curTimeIter);
+        fileName = config->GetFilename(surfaceFilename, "", writeTimeIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
 
@@ -691,14 +896,14 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
       }
 
       fileWriter = new CTecplotBinaryFileWriter(fileName, surfaceDataSorter,
-                                                curTimeIter, GetHistoryFieldValue("TIME_STEP"));
+                                                writeTimeIter, writeTimeStep);
 
       break;
 
     case STL:
 
       if (fileName.empty())
-        fileName = config->GetFilename(surfaceFilename, "", curTimeIter);
+        fileName = config->GetFilename(surfaceFilename, "", writeTimeIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
 
@@ -730,7 +935,8 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
     /*--- Compute and store the bandwidth ---*/
 
     if (format == RESTART_BINARY){
-      config->SetRestart_Bandwidth_Agg(config->GetRestart_Bandwidth_Agg()+BandWidth);
+      if (asyncOutput) asyncBandwidth += BandWidth;
+      else config->SetRestart_Bandwidth_Agg(config->GetRestart_Bandwidth_Agg()+BandWidth);
     }
 
     if (config->GetWrt_Performance() && (rank == MASTER_NODE)){
@@ -739,7 +945,10 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
       fileWritingTable->SetAlign(PrintingToolbox::CTablePrinter::LEFT);
     }
 
-    delete fileWriter;
+    /*--- The streams stay open for the next outputs. ---*/
+
+    if (fileWriter != volumeStream && fileWriter != surfaceStream)
+      delete fileWriter;
 
   }
 }
@@ -749,51 +958,93 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
 bool COutput::SetResult_Files(CGeometry *geometry, CConfig *config, CSolver** solver_container,
                               unsigned long iter, bool force_writing){
 
+  SU2_PROFILE_REGION("Output (files)");
+
   bool writeFiles = WriteVolume_Output(config, iter, force_writing);
 
+  /*--- A checkpoint is only needed if the restart is not being written anyway. ---*/
+
+  bool terminate = false;
+  const bool writeCheckpoint = CheckpointDue(config, terminate) && !writeFiles;
+
+  /*--- Print the results of the asynchronous output as soon as it is done. ---*/
+
+  if (asyncDone) CompleteAsyncOutput(config);
+
   /*--- Check if the data sorters are allocated, if not, allocate them. --- */
 
   AllocateDataSorters(config, geometry);
 
+  /*--- The probes and boxes are located once, at the first call. ---*/
+
+  const bool probesRequested = (config->GetnOutput_Probes() + config->GetnOutput_Probe_Planes() +
+                                config->GetnOutput_Probe_Boxes()) > 0;
+
+  if (probesRequested && !femOutput && (probeOutput == nullptr))
+    probeOutput = new CProbeOutput(config, geometry);
+
+  const bool writeProbes = (probeOutput != nullptr) && probeOutput->HasOutput() &&
+                           (iter % config->GetOutput_Probe_Freq() == 0);
+
+  /*--- The layout of the surface sampling file is set once, the writer stays open. ---*/
+
+  if ((config->GetnMarker_Surface_Sampling() > 0) && !femOutput && (surfaceSampling == nullptr)) {
+    const string samplingFileName = config->GetMultizone_FileName(config->GetSurface_Sampling_FileName(),
+                                                                  config->GetiZone(), "");
+    surfaceSampling = new CSurfaceSamplingWriter(samplingFileName, volumeDataSorter, surfaceSamplingFields,
+                                                 geometry, config);
+  }
+
+  const bool writeSampling = (surfaceSampling != nullptr) && (iter % config->GetSurface_Sampling_Freq() == 0);
+
   /*--- Collect the volume data from the solvers.
    *  If time-domain is enabled, we also load the data although we don't output it,
-   *  since we might want to do time-averaging. ---*/
+   *  when the time averaged fields need to be sampled. ---*/
 
-  if (writeFiles || config->GetTime_Domain())
+  if (writeFiles || writeCheckpoint || writeProbes || writeSampling || TimeAverageSampleDue(config))
     LoadDataIntoSorter(config, geometry, solver_container);
 
-  if (writeFiles){
+  /*--- The probes and the surface sampling only read the unsorted data of the sorter,
+   *    not the copy of the asynchronous output. ---*/
+
+  if (writeProbes)
+    probeOutput->Write(volumeDataSorter, iter, config->GetPhysicalTime());
 
-    /*--- Partition and sort the data --- */
+  if (writeSampling) {
+    surfaceSampling->SetTime(iter, config->GetPhysicalTime());
+    surfaceSampling->Write_Data();
+  }
 
-    volumeDataSorter->SortOutputData();
+  if (writeFiles || writeCheckpoint){
 
-    unsigned short nVolumeFiles = config->GetnVolumeOutputFiles();
-    unsigned short *VolumeFiles = config->GetVolumeOutputFiles();
+    /*--- The sorters hold the data of one write at a time, wait for the previous one.
+     *    Loading the data above is safe as the helper thread only sorts a copy of it. ---*/
 
-    if (rank == MASTER_NODE && nVolumeFiles != 0){
-      fileWritingTable->SetAlign(PrintingToolbox::CTablePrinter::CENTER);
-      fileWritingTable->PrintHeader();
-      fileWritingTable->SetAlign(PrintingToolbox::CTablePrinter::LEFT);
-    }
+    CompleteAsyncOutput(config);
 
-    /*--- Loop through all requested output files and write
-     * the partitioned and sorted data stored in the data sorters. ---*/
+    StoreWriteTimeInfo();
 
-    for (unsigned short iFile = 0; iFile < nVolumeFiles; iFile++){
+    /*--- The last files (forced writing) are always written before returning, and so is the
+     *    checkpoint of SIGTERM since the scheduler kills the job after a grace period. ---*/
 
-      WriteToFile(config, geometry, VolumeFiles[iFile]);
+    const bool restartOnly = !writeFiles;
 
+    if (asyncOutput && !force_writing && !terminate) {
+      volumeDataSorter->SnapshotData();
+      asyncDone = false;
+      asyncWriter = std::thread([this, config, geometry, restartOnly]() {
+        WriteVolumeFiles(config, geometry, restartOnly);
+        asyncDone = true;
+      });
     }
-
-    if (rank == MASTER_NODE && nVolumeFiles != 0){
-      fileWritingTable->PrintFooter();
-      headerNeeded = true;
+    else {
+      WriteVolumeFiles(config, geometry, restartOnly);
+      CompleteAsyncOutput(config);
     }
 
     /*--- Write any additonal files defined in the child class ----*/
 
-    WriteAdditionalFiles(config, geometry, solver_container);
+    if (writeFiles) WriteAdditionalFiles(config, geometry, solver_container);
 
     return true;
   }
@@ -801,6 +1052,157 @@ bool COutput::SetResult_Files(CGeometry *geometry, CConfig *config, CSolver** so
   return false;
 }
 
+void COutput::WriteVolumeFiles(CConfig *config, CGeometry *geometry, bool restartOnly){
+
+  /*--- Partition and sort the data --- */
+
+  volumeDataSorter->SortOutputData();
+
+  unsigned short nVolumeFiles = config->GetnVolumeOutputFiles();
+  unsigned short *VolumeFiles = config->GetVolumeOutputFiles();
+
+  /*--- Checkpoints only write the requested restart formats, or the binary restart. ---*/
+
+  vector<unsigned short> restartFiles;
+
+  if (restartOnly) {
+    for (unsigned short iFile = 0; iFile < nVolumeFiles; iFile++)
+      if (VolumeFiles[iFile] == RESTART_BINARY || VolumeFiles[iFile] == RESTART_ASCII)
+        restartFiles.push_back(VolumeFiles[iFile]);
+    if (restartFiles.empty()) restartFiles.push_back(RESTART_BINARY);
+
+    nVolumeFiles = restartFiles.size();
+    VolumeFiles = restartFiles.data();
+  }
+
+  if (rank == MASTER_NODE && nVolumeFiles != 0){
+    fileWritingTable->SetAlign(PrintingToolbox::CTablePrinter::CENTER);
+    fileWritingTable->PrintHeader();
+    fileWritingTable->SetAlign(PrintingToolbox::CTablePrinter::LEFT);
+  }
+
+  /*--- Loop through all requested output files and write
+   * the partitioned and sorted data stored in the data sorters. ---*/
+
+  for (unsigned short iFile = 0; iFile < nVolumeFiles; iFile++){
+
+    WriteToFile(config, geometry, VolumeFiles[iFile]);
+
+  }
+
+  if (rank == MASTER_NODE && nVolumeFiles != 0){
+    fileWritingTable->PrintFooter();
+    if (!asyncOutput) headerNeeded = true;
+  }
+
+}
+
+void COutput::CompleteAsyncOutput(CConfig *config){
+
+  if (!asyncOutput) return;
+
+  if (asyncWriter.joinable()) asyncWriter.join();
+  asyncDone = false;
+
+  config->SetRestart_Bandwidth_Agg(config->GetRestart_Bandwidth_Agg()+asyncBandwidth);
+  asyncBandwidth = 0.0;
+
+  if (rank == MASTER_NODE && !asyncFileTable.str().empty()){
+    cout << asyncFileTable.str() << flush;
+    asyncFileTable.str("");
+    headerNeeded = true;
+  }
+
+}
+
+void COutput::CheckpointSignalHandler(int signum) {
+
+  checkpointSignals = checkpointSignals + 1;
+  if (signum == SIGTERM) terminateSignal = 1;
+}
+
+void COutput::InitCheckpoints(const CConfig *config) {
+
+  if (checkpointActive >= 0) return;
+
+  checkpointActive = config->GetWallTime_Checkpoint();
+  if (!checkpointActive) return;
+
+  /*--- The deadline is only known by the master, which decides for all ranks. ---*/
+
+  if (SU2_MPI::GetRank() == MASTER_NODE) {
+
+    passivedouble limit = SU2_TYPE::GetValue(config->GetWallTime_Limit());
+
+    if (limit <= 0.0) {
+      /*--- The end time of the job is a Unix timestamp. ---*/
+      const char* endTime = std::getenv("SLURM_JOB_END_TIME");
+      if (endTime != nullptr) {
+        const auto remaining = std::strtod(endTime, nullptr) - passivedouble(std::time(nullptr));
+        if (remaining > 0.0) limit = SecondsSinceStart() + remaining;
+      }
+    }
+
+    if (limit > 0.0) {
+      checkpointDeadline = max(limit - SU2_TYPE::GetValue(config->GetWallTime_Margin()), 1e-6);
+      cout << "A restart is written " << config->GetWallTime_Margin() << " s before the walltime limit, in "
+           << checkpointDeadline - SecondsSinceStart() << " s." << endl;
+    }
+    else {
+      cout << "No walltime limit is set (WALLTIME_LIMIT, SLURM_JOB_END_TIME), "
+              "restarts are only written on SIGUSR1 and SIGTERM." << endl;
+    }
+  }
+
+  std::signal(SIGUSR1, CheckpointSignalHandler);
+  std::signal(SIGTERM, CheckpointSignalHandler);
+}
+
+bool COutput::CheckpointDue(const CConfig *config, bool& terminate) {
+
+  InitCheckpoints(config);
+
+  terminate = false;
+  if (!checkpointActive) return false;
+
+  /*--- Average time between the calls (i.e. of the iterations), the first one includes the preprocessing. ---*/
+
+  const auto now = SecondsSinceStart();
+  if (lastResultTime >= 0.0) {
+    iterTimeSum += now - lastResultTime;
+    nIterTime++;
+  }
+  lastResultTime = now;
+
+  const passivedouble iterTime = (nIterTime > 0)? iterTimeSum / nIterTime : 0.0;
+
+  /*--- Write before the next iteration could end past the deadline, once. ---*/
+
+  int flags[3] = {0,0,0}, globalFlags[3] = {0,0,0};
+
+  if (rank == MASTER_NODE && !wallTimeCheckpointDone && checkpointDeadline > 0.0)
+    flags[0] = (now + 2*iterTime > checkpointDeadline);
+
+  const std::sig_atomic_t nSignals = checkpointSignals;
+  flags[1] = (nSignals > signalsHandled);
+  flags[2] = terminateSignal;
+
+  SU2_MPI::Allreduce(flags, globalFlags, 3, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+
+  signalsHandled = nSignals;
+  terminate = globalFlags[2];
+
+  if (globalFlags[0]) {
+    wallTimeCheckpointDone = true;
+    if (rank == MASTER_NODE) cout << "Writing a restart before the walltime limit." << endl;
+  }
+  else if (globalFlags[1] && rank == MASTER_NODE) {
+    cout << "Writing a restart requested by " << (terminate? "SIGTERM." : "SIGUSR1.") << endl;
+  }
+
+  return globalFlags[0] || globalFlags[1];
+}
+
 void COutput::PrintConvergenceSummary(){
 
   PrintingToolbox::CTablePrinter  ConvSummary(&cout);
@@ -1023,18 +1425,17 @@ void COutput::SetHistoryFile_Header(CConfig *config) {
   unsigned short iField_Output = 0,
       iReqField = 0,
       iMarker = 0;
-  stringstream out;
   int width = 20;
 
+  /*--- Resolve the fields of the requested groups once, the history file output only uses these handles. ---*/
+
+  historyFileFields.clear();
+
   for (iField_Output = 0; iField_Output < historyOutput_List.size(); iField_Output++){
-    const string &fieldIdentifier = historyOutput_List[iField_Output];
-    const HistoryOutputField &field = historyOutput_Map.at(fieldIdentifier);
+    const HistoryOutputField &field = historyOutput_Map.at(historyOutput_List[iField_Output]);
     for (iReqField = 0; iReqField < nRequestedHistoryFields; iReqField++){
-      const string & requestedField = requestedHistoryFields[iReqField];
-      if (requestedField == field.outputGroup || (requestedField == fieldIdentifier)){
-        if (field.screenFormat == ScreenOutputFormat::INTEGER) width = std::max((int)field.fieldName.size()+2, 10);
-        else{ width = std::max((int)field.fieldName.size()+2, 18);}
-        historyFileTable->AddColumn("\"" + field.fieldName + "\"", width);
+      if (requestedHistoryFields[iReqField] == field.outputGroup){
+        historyFileFields.push_back(&field);
       }
     }
   }
@@ -1044,16 +1445,34 @@ void COutput::SetHistoryFile_Header(CConfig *config) {
     for (iMarker = 0; iMarker < historyOutputPerSurface_Map[fieldIdentifier].size(); iMarker++){
       const HistoryOutputField &field = historyOutputPerSurface_Map.at(fieldIdentifier)[iMarker];
       for (iReqField = 0; iReqField < nRequestedHistoryFields; iReqField++){
-        const string &requestedField = requestedHistoryFields[iReqField];
-        if (requestedField == field.outputGroup || (requestedField == fieldIdentifier)){
-          if (field.screenFormat == ScreenOutputFormat::INTEGER) width = std::max((int)field.fieldName.size()+2, 10);
-          else{ width = std::max((int)field.fieldName.size()+2, 18);}
-          historyFileTable->AddColumn("\"" + field.fieldName + "\"", width);
+        if (requestedHistoryFields[iReqField] == field.outputGroup){
+          historyFileFields.push_back(&field);
         }
       }
     }
   }
 
+  /*--- The binary header is the id and the number of fields, followed by the
+   names of the fields with the fixed length of the restart files. ---*/
+
+  if (historyBinary) {
+    const int header[2] = {SU2_BINARY_HISTORY_ID, int(historyFileFields.size())};
+    histFile.write(reinterpret_cast<const char*>(header), sizeof(header));
+    for (const auto field : historyFileFields) {
+      char name[CGNS_STRING_SIZE] = {};
+      strncpy(name, field->fieldName.c_str(), CGNS_STRING_SIZE-1);
+      histFile.write(name, CGNS_STRING_SIZE);
+    }
+    histFile.flush();
+    return;
+  }
+
+  for (const auto field : historyFileFields){
+    if (field->screenFormat == ScreenOutputFormat::INTEGER) width = std::max((int)field->fieldName.size()+2, 10);
+    else{ width = std::max((int)field->fieldName.size()+2, 18);}
+    historyFileTable->AddColumn("\"" + field->fieldName + "\"", width);
+  }
+
   if (config->GetTabular_FileFormat() == TAB_TECPLOT) {
     histFile << "VARIABLES = \\" << endl;
   }
@@ -1064,37 +1483,27 @@ void COutput::SetHistoryFile_Header(CConfig *config) {
 
 void COutput::SetHistoryFile_Output(CConfig *config) {
 
-  unsigned short iField_Output = 0,
-      iReqField = 0,
-      iMarker = 0;
-  stringstream out;
-
-  for (iField_Output = 0; iField_Output < historyOutput_List.size(); iField_Output++){
-    const string &fieldIdentifier = historyOutput_List[iField_Output];
-    const HistoryOutputField &field = historyOutput_Map.at(fieldIdentifier);
-    for (iReqField = 0; iReqField < nRequestedHistoryFields; iReqField++){
-      const string &RequestedField = requestedHistoryFields[iReqField];
-      if (RequestedField == field.outputGroup){
-        (*historyFileTable) << field.value;
-      }
-    }
+  if (historyBinary) {
+    for (const auto field : historyFileFields)
+      historyBuffer.push_back(SU2_TYPE::GetValue(field->value));
   }
-
-  for (iField_Output = 0; iField_Output < historyOutputPerSurface_List.size(); iField_Output++){
-    const string &fieldIdentifier = historyOutputPerSurface_List[iField_Output];
-    for (iMarker = 0; iMarker < historyOutputPerSurface_Map[fieldIdentifier].size(); iMarker++){
-      const HistoryOutputField &field = historyOutputPerSurface_Map.at(fieldIdentifier)[iMarker];
-      for (iReqField = 0; iReqField < nRequestedHistoryFields; iReqField++){
-        const string &RequestedField = requestedHistoryFields[iReqField];
-        if (RequestedField == field.outputGroup){
-          (*historyFileTable) << field.value;
-        }
-      }
-    }
+  else {
+    for (const auto field : historyFileFields)
+      (*historyFileTable) << field->value;
   }
 
-  /*--- Print the string to file and remove the last two characters (a separator and a space) ---*/
+  /*--- The lines are buffered and written to disk every HISTORY_FLUSH_FREQ writes. ---*/
+
+  nHistoryWrites++;
+  if (nHistoryWrites % historyFlushFreq == 0) FlushHistoryFile();
+}
+
+void COutput::FlushHistoryFile() {
 
+  if (!historyBuffer.empty()) {
+    histFile.write(reinterpret_cast<const char*>(historyBuffer.data()), historyBuffer.size()*sizeof(passivedouble));
+    historyBuffer.clear();
+  }
   histFile.flush();
 }
 
@@ -1107,42 +1516,21 @@ void COutput::SetScreen_Header(CConfig *config) {
 
 void COutput::SetScreen_Output(CConfig *config) {
 
-  string RequestedField;
-
-  for (unsigned short iReqField = 0; iReqField < nRequestedScreenFields; iReqField++){
+  for (const auto field : screenOutputFields){
     stringstream out;
-    RequestedField = requestedScreenFields[iReqField];
-    if (historyOutput_Map.count(RequestedField) > 0){
-      switch (historyOutput_Map.at(RequestedField).screenFormat) {
-        case ScreenOutputFormat::INTEGER:
-          PrintingToolbox::PrintScreenInteger(out, SU2_TYPE::Int(historyOutput_Map.at(RequestedField).value), fieldWidth);
-          break;
-        case ScreenOutputFormat::FIXED:
-          PrintingToolbox::PrintScreenFixed(out, historyOutput_Map.at(RequestedField).value, fieldWidth);
-          break;
-        case ScreenOutputFormat::SCIENTIFIC:
-          PrintingToolbox::PrintScreenScientific(out, historyOutput_Map.at(RequestedField).value, fieldWidth);
-          break;
-        case ScreenOutputFormat::PERCENT:
-          PrintingToolbox::PrintScreenPercent(out, historyOutput_Map[RequestedField].value, fieldWidth);
-          break;
-      }
-    }
-    if (historyOutputPerSurface_Map.count(RequestedField) > 0){
-      switch (historyOutputPerSurface_Map.at(RequestedField)[0].screenFormat) {
-        case ScreenOutputFormat::INTEGER:
-          PrintingToolbox::PrintScreenInteger(out, SU2_TYPE::Int(historyOutputPerSurface_Map.at(RequestedField)[0].value), fieldWidth);
-          break;
-        case ScreenOutputFormat::FIXED:
-          PrintingToolbox::PrintScreenFixed(out, historyOutputPerSurface_Map.at(RequestedField)[0].value, fieldWidth);
-          break;
-        case ScreenOutputFormat::SCIENTIFIC:
-          PrintingToolbox::PrintScreenScientific(out, historyOutputPerSurface_Map.at(RequestedField)[0].value, fieldWidth);
-          break;
-        case ScreenOutputFormat::PERCENT:
-          PrintingToolbox::PrintScreenPercent(out, historyOutputPerSurface_Map[RequestedField][0].value, fieldWidth);
-          break;
-      }
+    switch (field->screenFormat) {
+      case ScreenOutputFormat::INTEGER:
+        PrintingToolbox::PrintScreenInteger(out, SU2_TYPE::Int(field->value), fieldWidth);
+        break;
+      case ScreenOutputFormat::FIXED:
+        PrintingToolbox::PrintScreenFixed(out, field->value, fieldWidth);
+        break;
+      case ScreenOutputFormat::SCIENTIFIC:
+        PrintingToolbox::PrintScreenScientific(out, field->value, fieldWidth);
+        break;
+      case ScreenOutputFormat::PERCENT:
+        PrintingToolbox::PrintScreenPercent(out, field->value, fieldWidth);
+        break;
     }
     (*convergenceTable) << out.str();
   }
@@ -1247,7 +1635,10 @@ void COutput::PrepareHistoryFile(CConfig *config){
 
   /*--- Open the history file ---*/
 
-  histFile.open(historyFilename.c_str(), ios::out);
+  if (historyBinary)
+    histFile.open(historyFilename.c_str(), ios::out | ios::binary);
+  else
+    histFile.open(historyFilename.c_str(), ios::out);
 
   /*--- Create and format the history file table ---*/
 
@@ -1304,6 +1695,17 @@ void COutput::CheckHistoryOutput(){
 
   nRequestedScreenFields = requestedScreenFields.size();
 
+  /*--- Resolve the screen fields once, per surface fields show the value of the first marker. ---*/
+
+  screenOutputFields.clear();
+  for (unsigned short iReqField = 0; iReqField < nRequestedScreenFields; iReqField++){
+    requestedField = requestedScreenFields[iReqField];
+    if (historyOutput_Map.count(requestedField) > 0)
+      screenOutputFields.push_back(&historyOutput_Map.at(requestedField));
+    else
+      screenOutputFields.push_back(&historyOutputPerSurface_Map.at(requestedField)[0]);
+  }
+
   if (rank == MASTER_NODE){
     cout <<"Screen output fields: ";
     for (unsigned short iReqField = 0; iReqField < nRequestedScreenFields; iReqField++){
@@ -1533,6 +1935,51 @@ void COutput::PreprocessVolumeOutput(CConfig *config){
 
   nRequestedVolumeFields = requestedVolumeFields.size();
 
+  /*--- Error bounds of the lossy compression of the restart files, the coordinates
+   and the solution are always stored losslessly as they are read on restart. ---*/
+
+  restartErrorBound.clear();
+
+  if (config->GetRestart_Compression() == LOSSY_COMPRESSION) {
+
+    restartErrorBound.resize(nVolumeFields, 0.0);
+
+    for (unsigned short iField = 0; iField < config->GetnRestart_Lossy_Fields(); iField++) {
+      const string lossyField = config->GetRestart_Lossy_Field(iField);
+
+      for (const auto& fieldReference : volumeOutput_List) {
+        if (volumeOutput_Map.count(fieldReference) == 0) continue;
+        const VolumeOutputField &Field = volumeOutput_Map.at(fieldReference);
+
+        if ((Field.offset != -1) && ((lossyField == Field.outputGroup) || (lossyField == fieldReference)) &&
+            (Field.outputGroup != "COORDINATES") && (Field.outputGroup != "SOLUTION")) {
+          restartErrorBound[Field.offset] = SU2_TYPE::GetValue(config->GetRestart_Lossy_Error());
+        }
+      }
+    }
+  }
+
+  /*--- Fields of the surface sampling, by default all but the coordinates (written once in its header). ---*/
+
+  surfaceSamplingFields.clear();
+
+  for (const auto& fieldReference : volumeOutput_List) {
+    if (volumeOutput_Map.count(fieldReference) == 0) continue;
+    const VolumeOutputField &Field = volumeOutput_Map.at(fieldReference);
+    if (Field.offset == -1) continue;
+
+    bool sampled = (config->GetnSurface_Sampling_Fields() == 0) && (Field.outputGroup != "COORDINATES");
+    for (unsigned short iField = 0; iField < config->GetnSurface_Sampling_Fields(); iField++) {
+      const string samplingField = config->GetSurface_Sampling_Field(iField);
+      sampled = sampled || (samplingField == Field.outputGroup) || (samplingField == fieldReference);
+    }
+    if (sampled) surfaceSamplingFields.push_back(Field.offset);
+  }
+
+  if ((config->GetnMarker_Surface_Sampling() > 0) && surfaceSamplingFields.empty()) {
+    SU2_MPI::Error("None of the SURFACE_SAMPLING_FIELDS is a volume output field.", CURRENT_FUNCTION);
+  }
+
   if (rank == MASTER_NODE){
     cout <<"Volume output fields: ";
     for (unsigned short iReqField = 0; iReqField < nRequestedVolumeFields; iReqField++){
@@ -1544,12 +1991,31 @@ void COutput::PreprocessVolumeOutput(CConfig *config){
   }
 }
 
+bool COutput::TimeAverageSampleDue(const CConfig *config) const {
+
+  if (!config->GetTime_Domain() || (curAbsTimeIter == lastTimeAverageIter) ||
+      (curAbsTimeIter % config->GetTime_Average_Freq() != 0)) return false;
+
+  for (const auto& field : volumeOutput_Map)
+    if ((field.second.outputGroup == "TIME_AVERAGE") && (field.second.offset != -1)) return true;
+
+  return false;
+}
+
 void COutput::LoadDataIntoSorter(CConfig* config, CGeometry* geometry, CSolver** solver){
 
   unsigned short iMarker = 0;
   unsigned long iPoint = 0, jPoint = 0;
   unsigned long iVertex = 0;
 
+  /*--- The time averages are sampled at most once per time iteration. ---*/
+
+  sampleTimeAverages = TimeAverageSampleDue(config);
+  if (sampleTimeAverages) {
+    lastTimeAverageIter = curAbsTimeIter;
+    nTimeAverageSamples++;
+  }
+
   /*--- Reset the offset cache and index --- */
   cachePosition = 0;
   fieldIndexCache.clear();
@@ -1692,7 +2158,9 @@ su2double COutput::GetVolumeOutputValue(string name, unsigned long iPoint){
 
 void COutput::SetAvgVolumeOutputValue(string name, unsigned long iPoint, su2double value){
 
-  const su2double scaling = 1.0 / su2double(curAbsTimeIter + 1);
+  /*--- Running mean of the samples, the averages are kept when they are not sampled. ---*/
+
+  const su2double scaling = sampleTimeAverages? 1.0 / su2double(nTimeAverageSamples) : 0.0;
 
   if (buildFieldIndexCache){
 
@@ -1759,15 +2227,39 @@ void COutput::Postprocess_HistoryData(CConfig *config){
     if (currentField.fieldType == HistoryFieldType::COEFFICIENT){
       if(SetUpdate_Averages(config)){
         if (config->GetTime_Domain()){
-          windowedTimeAverages[historyOutput_List[iField]].addValue(currentField.value,config->GetTimeIter(), config->GetStartWindowIteration()); //Collecting Values for Windowing
-          SetHistoryOutputValue("TAVG_" + fieldIdentifier, windowedTimeAverages[fieldIdentifier].WindowedUpdate(config->GetKindWindow()));
+          const auto startIter = config->GetStartWindowIteration();
+          const auto freq = config->GetTime_Average_Freq();
+          const auto timeIter = config->GetTimeIter();
+          auto& windowedAverage = windowedTimeAverages[fieldIdentifier];
+
+          /*--- Without windowing, or with the streaming option, the values are not stored, the window
+           *    then spans the entire time domain (from the start iteration) with one sample every freq. ---*/
+
+          if ((timeIter >= startIter) && ((timeIter-startIter) % freq == 0)) {
+            if ((config->GetKindWindow() == SQUARE) || config->GetWindow_Streaming()) {
+              const auto nSample = (config->GetnTime_Iter() > startIter)?
+                                   (config->GetnTime_Iter()-1-startIter)/freq + 1 : 1ul;
+              windowedAverage.StreamingUpdate(config->GetKindWindow(), currentField.value,
+                                              (timeIter-startIter)/freq, nSample);
+            }
+            else {
+              windowedAverage.addValue(currentField.value, timeIter, startIter); //Collecting Values for Windowing
+              windowedAverage.WindowedUpdate(config->GetKindWindow());
+            }
+          }
+          SetHistoryOutputValue("TAVG_" + fieldIdentifier, windowedAverage.GetVal());
           if (config->GetDirectDiff() != NO_DERIVATIVE) {
-            SetHistoryOutputValue("D_TAVG_" + fieldIdentifier, SU2_TYPE::GetDerivative(windowedTimeAverages[fieldIdentifier].GetVal()));
+            const su2double& average = windowedTimeAverages[fieldIdentifier].GetVal();
+            SetHistoryOutputValue("D_TAVG_" + fieldIdentifier, SU2_TYPE::GetDerivative(average));
+            for (unsigned short iDir = 1; iDir < SU2_TYPE::GetnDirections(); iDir++)
+              SetHistoryOutputValue("D" + to_string(iDir) + "_TAVG_" + fieldIdentifier, SU2_TYPE::GetDerivative(average, iDir));
           }
         }
       }
       if (config->GetDirectDiff() != NO_DERIVATIVE){
         SetHistoryOutputValue("D_" + fieldIdentifier, SU2_TYPE::GetDerivative(currentField.value));
+        for (unsigned short iDir = 1; iDir < SU2_TYPE::GetnDirections(); iDir++)
+          SetHistoryOutputValue("D" + to_string(iDir) + "_" + fieldIdentifier, SU2_TYPE::GetDerivative(currentField.value, iDir));
       }
     }
   }
@@ -1825,6 +2317,13 @@ void COutput::Postprocess_HistoryFields(CConfig *config){
         AddHistoryOutput("D_"      + fieldIdentifier, "d["     + currentField.fieldName + "]",
                          currentField.screenFormat, "D_"      + currentField.outputGroup,
                          "Derivative value (DIRECT_DIFF=YES)", HistoryFieldType::AUTO_COEFFICIENT);
+        /*--- Further directions of the vector forward mode, e.g. d1[CD] ---*/
+        for (unsigned short iDir = 1; iDir < SU2_TYPE::GetnDirections(); iDir++) {
+          const string dir = to_string(iDir);
+          AddHistoryOutput("D" + dir + "_" + fieldIdentifier, "d" + dir + "[" + currentField.fieldName + "]",
+                           currentField.screenFormat, "D_" + currentField.outputGroup,
+                           "Derivative value (DIRECT_DIFF=YES), direction " + dir, HistoryFieldType::AUTO_COEFFICIENT);
+        }
       }
     }
   }
@@ -1837,6 +2336,13 @@ void COutput::Postprocess_HistoryFields(CConfig *config){
         AddHistoryOutput("D_TAVG_" + fieldIdentifier, "dtavg[" + currentField.fieldName + "]",
                          currentField.screenFormat, "D_TAVG_" + currentField.outputGroup,
                          "Derivative of the time averaged value (DIRECT_DIFF=YES)", HistoryFieldType::AUTO_COEFFICIENT);
+        for (unsigned short iDir = 1; iDir < SU2_TYPE::GetnDirections(); iDir++) {
+          const string dir = to_string(iDir);
+          AddHistoryOutput("D" + dir + "_TAVG_" + fieldIdentifier, "d" + dir + "tavg[" + currentField.fieldName + "]",
+                           currentField.screenFormat, "D_TAVG_" + currentField.outputGroup,
+                           "Derivative of the time averaged value (DIRECT_DIFF=YES), direction " + dir,
+                           HistoryFieldType::AUTO_COEFFICIENT);
+        }
       }
     }
   }
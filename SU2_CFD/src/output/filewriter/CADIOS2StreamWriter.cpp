@@ -0,0 +1,201 @@
+/*!
+ * \file CADIOS2StreamWriter.cpp
+ * \brief Stream writer class for in-situ processing or staging with ADIOS2.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/output/filewriter/CADIOS2StreamWriter.hpp"
+#ifdef HAVE_ADIOS2
+  #include <adios2.h>
+#endif
+
+const string CADIOS2StreamWriter::fileExt = ".bp";
+
+struct CADIOS2StreamWriter::CStream {
+#ifdef HAVE_ADIOS2
+  adios2::ADIOS adios;
+  adios2::IO io;
+  adios2::Engine engine;
+  adios2::Variable<passivedouble> fields;
+  adios2::Variable<passivedouble> time;
+  adios2::Variable<uint64_t> iter;
+
+  CStream(const string& configFile, SU2_MPI::Comm comm) :
+#ifdef HAVE_MPI
+    adios(configFile, comm)
+#else
+    adios(configFile)
+#endif
+  {}
+#endif
+};
+
+CADIOS2StreamWriter::CADIOS2StreamWriter(string valFileName, CParallelDataSorter *valDataSorter,
+                                         string valEngine, string valConfigFile) :
+  CFileWriter(std::move(valFileName), valDataSorter, fileExt),
+  engineType(std::move(valEngine)), configFile(std::move(valConfigFile)){}
+
+CADIOS2StreamWriter::~CADIOS2StreamWriter(){
+
+#ifdef HAVE_ADIOS2
+  if (stream != nullptr) {
+    try {
+      stream->engine.Close();
+    }
+    catch (const std::exception& e) {
+      cout << "Error closing the ADIOS2 stream " << fileName << ": " << e.what() << endl;
+    }
+  }
+#endif
+  delete stream;
+
+}
+
+void CADIOS2StreamWriter::Write_Data(){
+
+  if (!dataSorter->GetConnectivitySorted()){
+    SU2_MPI::Error("Connectivity must be sorted.", CURRENT_FUNCTION);
+  }
+
+  /*--- Set a timer for the stream writing. ---*/
+
+#ifndef HAVE_MPI
+  startTime = su2double(clock())/su2double(CLOCKS_PER_SEC);
+#else
+  startTime = MPI_Wtime();
+#endif
+
+#ifdef HAVE_ADIOS2
+
+  const vector<string>& fieldNames = dataSorter->GetFieldNames();
+  const size_t nField = fieldNames.size();
+
+  const size_t myPoint = dataSorter->GetnPoints();
+  const size_t GlobalPoint = dataSorter->GetnPointsGlobal();
+  const size_t pointOffset = dataSorter->GetnPointCumulative(rank);
+
+  const GEO_TYPE elemTypes[] = {LINE, TRIANGLE, QUADRILATERAL, TETRAHEDRON, HEXAHEDRON, PRISM, PYRAMID};
+  const string elemNames[] = {"Line", "Triangle", "Quadrilateral", "Tetrahedron", "Hexahedron", "Prism", "Pyramid"};
+  const size_t elemNodes[] = {N_POINTS_LINE, N_POINTS_TRIANGLE, N_POINTS_QUADRILATERAL, N_POINTS_TETRAHEDRON,
+                              N_POINTS_HEXAHEDRON, N_POINTS_PRISM, N_POINTS_PYRAMID};
+  const int nType = 7;
+
+  su2double myBytes = 0.0;
+
+  try {
+
+    /*--- The first write opens the stream, the IO (engine, parameters, transports) may be set in the
+     configuration file under the name of the stream, otherwise the engine of the config is used. ---*/
+
+    if (stream == nullptr) {
+
+      stream = new CStream(configFile, comm);
+
+      const string ioName = fileName.substr(fileName.find_last_of('/')+1);
+      stream->io = stream->adios.DeclareIO(ioName.substr(0, ioName.size()-fileExt.size()));
+      if (!stream->io.InConfigFile()) stream->io.SetEngine(engineType);
+
+      stream->io.DefineAttribute<string>("FieldNames", fieldNames.data(), nField);
+      stream->io.DefineAttribute<int>("Dimension", int(dataSorter->GetnDim()));
+
+      stream->fields = stream->io.DefineVariable<passivedouble>("Fields", {GlobalPoint, nField},
+                                                                {pointOffset, 0}, {myPoint, nField});
+      stream->time = stream->io.DefineVariable<passivedouble>("Time");
+      stream->iter = stream->io.DefineVariable<uint64_t>("TimeIter");
+
+      stream->engine = stream->io.Open(fileName, adios2::Mode::Write);
+    }
+
+    stream->engine.BeginStep();
+
+    /*--- The sorted data is put without a copy, it stays valid until the end of the step. ---*/
+
+    stream->fields.SetShape({GlobalPoint, nField});
+    stream->fields.SetSelection({{pointOffset, 0}, {myPoint, nField}});
+    if (myPoint > 0) {
+      stream->engine.Put(stream->fields, dataSorter->GetData());
+      myBytes += myPoint*nField*sizeof(passivedouble);
+    }
+
+    if (rank == MASTER_NODE) {
+      const passivedouble time = (timeStep > 0.0)? SU2_TYPE::GetValue(timeIter*timeStep) : passivedouble(timeIter);
+      stream->engine.Put(stream->time, time, adios2::Mode::Sync);
+      stream->engine.Put(stream->iter, uint64_t(timeIter), adios2::Mode::Sync);
+    }
+
+    /*--- The topology of the mesh does not change, it is put in the first step. ---*/
+
+    if (nStep == 0) {
+
+      unsigned long myElem[nType];
+      for (int iType = 0; iType < nType; iType++) myElem[iType] = dataSorter->GetnElem(elemTypes[iType]);
+
+      vector<unsigned long> nElem(nType*size);
+      SU2_MPI::Allgather(myElem, nType, MPI_UNSIGNED_LONG, nElem.data(), nType, MPI_UNSIGNED_LONG, comm);
+
+      for (int iType = 0; iType < nType; iType++) {
+        size_t elemOffset = 0, GlobalElem = 0;
+        for (int iRank = 0; iRank < size; iRank++) {
+          if (iRank < rank) elemOffset += nElem[iRank*nType+iType];
+          GlobalElem += nElem[iRank*nType+iType];
+        }
+        if (GlobalElem == 0) continue;
+
+        const size_t nNodes = elemNodes[iType];
+        auto conn = stream->io.DefineVariable<int>("Connectivity/"+elemNames[iType], {GlobalElem, nNodes},
+                                                   {elemOffset, 0}, {myElem[iType], nNodes});
+        if (myElem[iType] > 0) {
+          stream->engine.Put(conn, dataSorter->GetConnectivity(elemTypes[iType]));
+          myBytes += myElem[iType]*nNodes*sizeof(int);
+        }
+      }
+    }
+
+    stream->engine.EndStep();
+    nStep++;
+
+  }
+  catch (const std::exception& e) {
+    SU2_MPI::Error("ADIOS2 stream " + fileName + ": " + e.what(), CURRENT_FUNCTION);
+  }
+
+  su2double totalBytes = 0.0;
+  SU2_MPI::Allreduce(&myBytes, &totalBytes, 1, MPI_DOUBLE, MPI_SUM, comm);
+  fileSize = totalBytes;
+
+#endif /* HAVE_ADIOS2 */
+
+  /*--- Compute and store the write time. ---*/
+
+#ifndef HAVE_MPI
+  stopTime = su2double(clock())/su2double(CLOCKS_PER_SEC);
+#else
+  stopTime = MPI_Wtime();
+#endif
+  usedTime = stopTime-startTime;
+
+  /*--- Compute and store the bandwidth ---*/
+
+  bandwidth = fileSize/(1.0e6)/usedTime;
+}
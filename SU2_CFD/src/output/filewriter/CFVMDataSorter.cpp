@@ -34,6 +34,8 @@ CFVMDataSorter::CFVMDataSorter(CConfig *config, CGeometry *geometry, const vecto
 
   nDim = geometry->GetnDim();
 
+  connSortedByRank = false;
+
   std::vector<unsigned long> globalID;
 
   nGlobalPointBeforeSort = geometry->GetGlobal_nPointDomain();
@@ -112,6 +114,11 @@ void CFVMDataSorter::SetHaloPoints(CGeometry *geometry, CConfig *config){
 
 void CFVMDataSorter::SortConnectivity(CConfig *config, CGeometry *geometry, bool val_sort) {
 
+  /*--- The mesh and its partitioning do not change between outputs, the
+   connectivity only needs to be sorted again if it is requested in another way. ---*/
+
+  if (connectivitySorted && (connSortedByRank == !val_sort)) return;
+
   /*--- Sort connectivity for each type of element (excluding halos). Note
    In these routines, we sort the connectivity into a linear partitioning
    across all processors based on the global index of the grid nodes. ---*/
@@ -128,6 +135,7 @@ void CFVMDataSorter::SortConnectivity(CConfig *config, CGeometry *geometry, bool
   SetTotalElements();
 
   connectivitySorted = true;
+  connSortedByRank = !val_sort;
 
 }
 
@@ -241,7 +249,7 @@ void CFVMDataSorter::SortVolumetricConnectivity(CConfig *config,
    many cells it will receive from each other processor. ---*/
 
   SU2_MPI::Alltoall(&(nElem_Send[1]), 1, MPI_INT,
-                    &(nElem_Cum[1]), 1, MPI_INT, MPI_COMM_WORLD);
+                    &(nElem_Cum[1]), 1, MPI_INT, comm);
 
   /*--- Prepare to send connectivities. First check how many
    messages we will be sending and receiving. Here we also put
@@ -377,7 +385,7 @@ void CFVMDataSorter::SortVolumetricConnectivity(CConfig *config,
       int source = ii;
       int tag    = ii + 1;
       SU2_MPI::Irecv(&(connRecv[ll]), count, MPI_UNSIGNED_LONG, source, tag,
-                     MPI_COMM_WORLD, &(recv_req[iMessage]));
+                     comm, &(recv_req[iMessage]));
       iMessage++;
     }
   }
@@ -393,7 +401,7 @@ void CFVMDataSorter::SortVolumetricConnectivity(CConfig *config,
       int dest = ii;
       int tag    = rank + 1;
       SU2_MPI::Isend(&(connSend[ll]), count, MPI_UNSIGNED_LONG, dest, tag,
-                     MPI_COMM_WORLD, &(send_req[iMessage]));
+                     comm, &(send_req[iMessage]));
       iMessage++;
     }
   }
@@ -409,7 +417,7 @@ void CFVMDataSorter::SortVolumetricConnectivity(CConfig *config,
       int source = ii;
       int tag    = ii + 1;
       SU2_MPI::Irecv(&(haloRecv[ll]), count, MPI_UNSIGNED_SHORT, source, tag,
-                     MPI_COMM_WORLD, &(recv_req[iMessage+nRecvs]));
+                     comm, &(recv_req[iMessage+nRecvs]));
       iMessage++;
     }
   }
@@ -425,7 +433,7 @@ void CFVMDataSorter::SortVolumetricConnectivity(CConfig *config,
       int dest   = ii;
       int tag    = rank + 1;
       SU2_MPI::Isend(&(haloSend[ll]), count, MPI_UNSIGNED_SHORT, dest, tag,
-                     MPI_COMM_WORLD, &(send_req[iMessage+nSends]));
+                     comm, &(send_req[iMessage+nSends]));
       iMessage++;
     }
   }
@@ -0,0 +1,528 @@
+/*!
+ * \file CHDF5FileWriter.cpp
+ * \brief Filewriter class for parallel HDF5 time series with an XDMF descriptor.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/output/filewriter/CHDF5FileWriter.hpp"
+#ifdef HAVE_HDF5
+  #include <hdf5.h>
+#endif
+#include <iomanip>
+#include <sstream>
+
+const string CHDF5FileWriter::fileExt = ".h5";
+const string CHDF5FileWriter::xdmfExt = ".xmf";
+
+#ifdef HAVE_HDF5
+namespace {
+
+/*--- Cell type IDs of the XDMF mixed topology, the node ordering of the SU2 elements is the same. ---*/
+
+const int64_t XDMF_POLYLINE      = 2;
+const int64_t XDMF_TRIANGLE      = 4;
+const int64_t XDMF_QUADRILATERAL = 5;
+const int64_t XDMF_TETRAHEDRON   = 6;
+const int64_t XDMF_PYRAMID       = 7;
+const int64_t XDMF_WEDGE         = 8;
+const int64_t XDMF_HEXAHEDRON    = 9;
+
+/*!
+ * \brief Open a group, creating it if it does not exist.
+ */
+hid_t OpenGroup(hid_t loc, const string& name) {
+
+  hid_t group;
+  if (H5Lexists(loc, name.c_str(), H5P_DEFAULT) > 0)
+    group = H5Gopen2(loc, name.c_str(), H5P_DEFAULT);
+  else
+    group = H5Gcreate2(loc, name.c_str(), H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+
+  if (group < 0)
+    SU2_MPI::Error("Could not open the HDF5 group " + name, CURRENT_FUNCTION);
+
+  return group;
+}
+
+/*!
+ * \brief Write the rows [offset, offset+nLocal) of a (nGlobal x nCols) dataset, creating it if it does not exist.
+ * \return The number of bytes written by this rank.
+ */
+unsigned long WriteDataset(hid_t loc, const string& name, hid_t type, size_t typeSize,
+                           hsize_t nGlobal, hsize_t nCols, hsize_t nLocal, hsize_t offset,
+                           const void* data, unsigned short compression, hsize_t chunkSize, hid_t dxpl) {
+
+  const int nDims = (nCols > 1)? 2 : 1;
+  hsize_t dims[2] = {nGlobal, nCols};
+  hid_t fileSpace = H5Screate_simple(nDims, dims, NULL);
+
+  hid_t dataSet;
+  if (H5Lexists(loc, name.c_str(), H5P_DEFAULT) > 0) {
+    dataSet = H5Dopen2(loc, name.c_str(), H5P_DEFAULT);
+  }
+  else {
+    hid_t plist = H5Pcreate(H5P_DATASET_CREATE);
+    if (compression > 0 && nGlobal > 0) {
+      hsize_t chunk[2] = {min(nGlobal, chunkSize), nCols};
+      H5Pset_chunk(plist, nDims, chunk);
+      H5Pset_shuffle(plist);
+      H5Pset_deflate(plist, compression);
+    }
+    dataSet = H5Dcreate2(loc, name.c_str(), type, fileSpace, H5P_DEFAULT, plist, H5P_DEFAULT);
+    H5Pclose(plist);
+  }
+  if (dataSet < 0)
+    SU2_MPI::Error("Could not create the HDF5 dataset " + name, CURRENT_FUNCTION);
+
+  /*--- Ranks without data still take part in the (collective) write. ---*/
+
+  hsize_t start[2] = {offset, 0}, count[2] = {nLocal, nCols};
+  hid_t memSpace = H5Screate_simple(nDims, count, NULL);
+
+  if (nLocal > 0) {
+    H5Sselect_hyperslab(fileSpace, H5S_SELECT_SET, start, NULL, count, NULL);
+  }
+  else {
+    H5Sselect_none(fileSpace);
+    H5Sselect_none(memSpace);
+  }
+
+  if (H5Dwrite(dataSet, type, memSpace, fileSpace, dxpl, data) < 0)
+    SU2_MPI::Error("Could not write the HDF5 dataset " + name, CURRENT_FUNCTION);
+
+  H5Sclose(memSpace);
+  H5Sclose(fileSpace);
+  H5Dclose(dataSet);
+
+  return nLocal*nCols*typeSize;
+}
+
+/*!
+ * \brief Write a scalar attribute.
+ */
+void WriteAttribute(hid_t loc, const char* name, hid_t type, const void* value) {
+
+  hid_t space = H5Screate(H5S_SCALAR);
+  hid_t attr = H5Acreate2(loc, name, type, space, H5P_DEFAULT, H5P_DEFAULT);
+  H5Awrite(attr, type, value);
+  H5Aclose(attr);
+  H5Sclose(space);
+}
+
+/*!
+ * \brief Read a scalar attribute.
+ * \return <TRUE> if the attribute exists and was read.
+ */
+bool ReadAttribute(hid_t loc, const char* name, hid_t type, void* value) {
+
+  if (H5Aexists(loc, name) <= 0) return false;
+
+  hid_t attr = H5Aopen(loc, name, H5P_DEFAULT);
+  const bool success = (H5Aread(attr, type, value) >= 0);
+  H5Aclose(attr);
+
+  return success;
+}
+
+/*!
+ * \brief Get the dimensions of a dataset.
+ */
+vector<hsize_t> DatasetDims(hid_t loc, const string& name) {
+
+  hid_t dataSet = H5Dopen2(loc, name.c_str(), H5P_DEFAULT);
+  hid_t space = H5Dget_space(dataSet);
+
+  vector<hsize_t> dims(max(H5Sget_simple_extent_ndims(space), 1), 0);
+  H5Sget_simple_extent_dims(space, dims.data(), NULL);
+
+  H5Sclose(space);
+  H5Dclose(dataSet);
+
+  return dims;
+}
+
+/*!
+ * \brief Get the name of the index-th link of a group, in increasing name order.
+ */
+string LinkName(hid_t group, hsize_t index) {
+
+  const ssize_t length = H5Lget_name_by_idx(group, ".", H5_INDEX_NAME, H5_ITER_INC, index, NULL, 0, H5P_DEFAULT);
+  vector<char> name(length+1, '\0');
+  H5Lget_name_by_idx(group, ".", H5_INDEX_NAME, H5_ITER_INC, index, name.data(), length+1, H5P_DEFAULT);
+
+  return string(name.data());
+}
+
+}
+#endif /* HAVE_HDF5 */
+
+CHDF5FileWriter::CHDF5FileWriter(string valFileName, CParallelDataSorter *valDataSorter,
+                                 unsigned long valTimeIter, su2double valTimeStep,
+                                 bool valDynamicGrid, unsigned short valCompression) :
+  CFileWriter(std::move(valFileName), valDataSorter, fileExt), timeIter(valTimeIter), timeStep(valTimeStep),
+  dynamicGrid(valDynamicGrid), compression(valCompression){}
+
+CHDF5FileWriter::~CHDF5FileWriter(){}
+
+void CHDF5FileWriter::Write_Data(){
+
+  if (!dataSorter->GetConnectivitySorted()){
+    SU2_MPI::Error("Connectivity must be sorted.", CURRENT_FUNCTION);
+  }
+
+  /*--- Set a timer for the file writing. ---*/
+
+#ifndef HAVE_MPI
+  startTime = su2double(clock())/su2double(CLOCKS_PER_SEC);
+#else
+  startTime = MPI_Wtime();
+#endif
+
+#ifdef HAVE_HDF5
+
+  /*--- We always have 3 coords, independent of the actual value of nDim ---*/
+
+  const hsize_t NCOORDS = 3;
+  const unsigned short nDim = dataSorter->GetnDim();
+  const vector<string>& fieldNames = dataSorter->GetFieldNames();
+
+  const unsigned long myPoint = dataSorter->GetnPoints();
+  const unsigned long GlobalPoint = dataSorter->GetnPointsGlobal();
+  const unsigned long pointOffset = dataSorter->GetnPointCumulative(rank);
+
+  /*--- Group the fields (after the coordinates) into vectors (<name>_x, <name>_y[, <name>_z]) and scalars,
+   the quotes and slashes are removed from the names as they are used for the datasets. ---*/
+
+  struct FieldInfo { string name; unsigned short first, nComp; };
+  vector<FieldInfo> fields;
+
+  auto datasetName = [](string name) {
+    name.erase(remove(name.begin(), name.end(), '"'), name.end());
+    replace(name.begin(), name.end(), '/', '_');
+    return name;
+  };
+
+  for (unsigned short iField = nDim; iField < fieldNames.size();) {
+    const string& name = fieldNames[iField];
+    const string stem = name.substr(0, name.size()-2);
+
+    bool isVector = (name.size() > 2) && (name.compare(name.size()-2, 2, "_x") == 0) &&
+                    (iField+nDim <= fieldNames.size()) && (fieldNames[iField+1] == stem+"_y");
+    if (isVector && nDim == 3) isVector = (fieldNames[iField+2] == stem+"_z");
+
+    if (isVector) {
+      fields.push_back({datasetName(stem), iField, nDim});
+      iField += nDim;
+    }
+    else {
+      fields.push_back({datasetName(name), iField, 1});
+      iField++;
+    }
+  }
+
+  /*--- Load the coordinates and the mixed topology (cell type, [number of nodes,] nodes) of this rank. ---*/
+
+  vector<passivedouble> coordBuf(myPoint*NCOORDS, 0.0);
+  for (unsigned long iPoint = 0; iPoint < myPoint; iPoint++)
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      coordBuf[iPoint*NCOORDS + iDim] = dataSorter->GetData(iDim, iPoint);
+
+  vector<int64_t> topoBuf;
+  topoBuf.reserve(dataSorter->GetnConn() + dataSorter->GetnElem() + dataSorter->GetnElem(LINE));
+
+  auto copyToBuffer = [&](GEO_TYPE type, int64_t xdmfType, unsigned short nPoints){
+    for (unsigned long iElem = 0; iElem < dataSorter->GetnElem(type); iElem++) {
+      topoBuf.push_back(xdmfType);
+      if (type == LINE) topoBuf.push_back(nPoints);
+      for (unsigned short iNode = 0; iNode < nPoints; iNode++)
+        topoBuf.push_back(int64_t(dataSorter->GetElem_Connectivity(type, iElem, iNode))-1);
+    }
+  };
+
+  copyToBuffer(LINE,          XDMF_POLYLINE,      N_POINTS_LINE);
+  copyToBuffer(TRIANGLE,      XDMF_TRIANGLE,      N_POINTS_TRIANGLE);
+  copyToBuffer(QUADRILATERAL, XDMF_QUADRILATERAL, N_POINTS_QUADRILATERAL);
+  copyToBuffer(TETRAHEDRON,   XDMF_TETRAHEDRON,   N_POINTS_TETRAHEDRON);
+  copyToBuffer(HEXAHEDRON,    XDMF_HEXAHEDRON,    N_POINTS_HEXAHEDRON);
+  copyToBuffer(PRISM,         XDMF_WEDGE,         N_POINTS_PRISM);
+  copyToBuffer(PYRAMID,       XDMF_PYRAMID,       N_POINTS_PYRAMID);
+
+  /*--- The topology entries per element vary, the offset of each rank is obtained from the sizes of all. ---*/
+
+  unsigned long myTopo = topoBuf.size(), topoOffset = 0, GlobalTopo = 0;
+  vector<unsigned long> nTopo(size);
+  SU2_MPI::Allgather(&myTopo, 1, MPI_UNSIGNED_LONG, nTopo.data(), 1, MPI_UNSIGNED_LONG, comm);
+  for (int iRank = 0; iRank < size; iRank++) {
+    if (iRank < rank) topoOffset += nTopo[iRank];
+    GlobalTopo += nTopo[iRank];
+  }
+
+  /*--- Check if the file already holds this mesh (continued time series). ---*/
+
+  unsigned short meshStored = 0;
+  if (rank == MASTER_NODE) meshStored = MeshIsStored();
+  SU2_MPI::Bcast(&meshStored, 1, MPI_UNSIGNED_SHORT, MASTER_NODE, comm);
+
+  ostringstream stepName;
+  stepName << setw(8) << setfill('0') << timeIter;
+
+  const passivedouble time = (timeStep > 0.0)? SU2_TYPE::GetValue(timeIter*timeStep) : passivedouble(timeIter);
+  const unsigned long GlobalElem = dataSorter->GetnElemGlobal();
+
+  su2double myBytes = 0.0;
+
+  /*--- Write the mesh (if needed) and the step. The layout (groups, attributes, deletion of a previous
+   version of the step) is only defined by the ranks that are allowed to, see below. ---*/
+
+  auto writeContents = [&](hid_t fileID, hid_t dxpl, bool defineLayout) {
+
+    if (!meshStored) {
+      hid_t mesh = OpenGroup(fileID, "Mesh");
+      myBytes += WriteDataset(mesh, "Coordinates", H5T_NATIVE_DOUBLE, sizeof(passivedouble), GlobalPoint, NCOORDS,
+                              myPoint, pointOffset, coordBuf.data(), compression, CHUNK_SIZE, dxpl);
+      myBytes += WriteDataset(mesh, "Topology", H5T_NATIVE_INT64, sizeof(int64_t), GlobalTopo, 1,
+                              myTopo, topoOffset, topoBuf.data(), compression, CHUNK_SIZE*8, dxpl);
+      if (defineLayout) {
+        WriteAttribute(mesh, "NumberOfPoints", H5T_NATIVE_ULONG, &GlobalPoint);
+        WriteAttribute(mesh, "NumberOfElements", H5T_NATIVE_ULONG, &GlobalElem);
+      }
+      H5Gclose(mesh);
+    }
+
+    hid_t steps = OpenGroup(fileID, "Steps");
+    if (defineLayout && H5Lexists(steps, stepName.str().c_str(), H5P_DEFAULT) > 0)
+      H5Ldelete(steps, stepName.str().c_str(), H5P_DEFAULT);
+
+    hid_t step = OpenGroup(steps, stepName.str());
+    if (defineLayout) {
+      WriteAttribute(step, "Time", H5T_NATIVE_DOUBLE, &time);
+      WriteAttribute(step, "Iteration", H5T_NATIVE_ULONG, &timeIter);
+    }
+
+    if (dynamicGrid) {
+      myBytes += WriteDataset(step, "Coordinates", H5T_NATIVE_DOUBLE, sizeof(passivedouble), GlobalPoint, NCOORDS,
+                              myPoint, pointOffset, coordBuf.data(), compression, CHUNK_SIZE, dxpl);
+    }
+
+    vector<passivedouble> fieldBuf(myPoint*NCOORDS, 0.0);
+
+    for (const auto& field : fields) {
+      const hsize_t nCols = (field.nComp > 1)? NCOORDS : 1;
+      for (unsigned long iPoint = 0; iPoint < myPoint; iPoint++)
+        for (unsigned short iComp = 0; iComp < field.nComp; iComp++)
+          fieldBuf[iPoint*nCols + iComp] = dataSorter->GetData(field.first+iComp, iPoint);
+
+      myBytes += WriteDataset(step, field.name, H5T_NATIVE_DOUBLE, sizeof(passivedouble), GlobalPoint, nCols,
+                              myPoint, pointOffset, fieldBuf.data(), compression, CHUNK_SIZE, dxpl);
+    }
+
+    H5Gclose(step);
+    H5Gclose(steps);
+  };
+
+#ifdef H5_HAVE_PARALLEL
+
+  /*--- All ranks open the file and write their part of each dataset collectively with MPI-IO. ---*/
+
+  hid_t fapl = H5Pcreate(H5P_FILE_ACCESS);
+  H5Pset_fapl_mpio(fapl, comm, MPI_INFO_NULL);
+
+  hid_t fileID = meshStored? H5Fopen(fileName.c_str(), H5F_ACC_RDWR, fapl) :
+                             H5Fcreate(fileName.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, fapl);
+  H5Pclose(fapl);
+
+  if (fileID < 0)
+    SU2_MPI::Error("Unable to open HDF5 file " + fileName, CURRENT_FUNCTION);
+
+  hid_t dxpl = H5Pcreate(H5P_DATASET_XFER);
+  H5Pset_dxpl_mpio(dxpl, H5FD_MPIO_COLLECTIVE);
+
+  writeContents(fileID, dxpl, true);
+
+  H5Pclose(dxpl);
+  H5Fclose(fileID);
+
+#else
+
+  /*--- Without parallel HDF5 the ranks write their part of the datasets one after the other,
+   the first one creates the file (if needed), the step and the datasets. ---*/
+
+  for (int iRank = 0; iRank < size; iRank++) {
+    if (rank == iRank) {
+      const bool first = (iRank == 0);
+
+      hid_t fileID = (first && !meshStored)? H5Fcreate(fileName.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT) :
+                                             H5Fopen(fileName.c_str(), H5F_ACC_RDWR, H5P_DEFAULT);
+      if (fileID < 0)
+        SU2_MPI::Error("Unable to open HDF5 file " + fileName, CURRENT_FUNCTION);
+
+      writeContents(fileID, H5P_DEFAULT, first);
+
+      H5Fclose(fileID);
+    }
+    SU2_MPI::Barrier(comm);
+  }
+
+#endif
+
+  /*--- Describe all the steps of the file for visualization. ---*/
+
+  if (rank == MASTER_NODE) WriteXDMF();
+
+  /*--- The file grows with every step, the bandwidth is based on the amount of data written. ---*/
+
+  su2double totalBytes = 0.0;
+  SU2_MPI::Allreduce(&myBytes, &totalBytes, 1, MPI_DOUBLE, MPI_SUM, comm);
+  fileSize = totalBytes;
+
+#endif /* HAVE_HDF5 */
+
+  /*--- Compute and store the write time. ---*/
+
+#ifndef HAVE_MPI
+  stopTime = su2double(clock())/su2double(CLOCKS_PER_SEC);
+#else
+  stopTime = MPI_Wtime();
+#endif
+  usedTime = stopTime-startTime;
+
+  /*--- Compute and store the bandwidth ---*/
+
+  bandwidth = fileSize/(1.0e6)/usedTime;
+}
+
+bool CHDF5FileWriter::MeshIsStored() const {
+
+  bool stored = false;
+
+#ifdef HAVE_HDF5
+  struct stat stat_buf;
+  if ((stat(fileName.c_str(), &stat_buf) != 0) || (H5Fis_hdf5(fileName.c_str()) <= 0)) return false;
+
+  hid_t fileID = H5Fopen(fileName.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+  if (fileID < 0) return false;
+
+  if (H5Lexists(fileID, "Mesh", H5P_DEFAULT) > 0) {
+    unsigned long nPoint = 0, nElem = 0;
+    hid_t mesh = H5Gopen2(fileID, "Mesh", H5P_DEFAULT);
+    stored = ReadAttribute(mesh, "NumberOfPoints", H5T_NATIVE_ULONG, &nPoint) &&
+             ReadAttribute(mesh, "NumberOfElements", H5T_NATIVE_ULONG, &nElem) &&
+             (nPoint == dataSorter->GetnPointsGlobal()) && (nElem == dataSorter->GetnElemGlobal());
+    H5Gclose(mesh);
+  }
+  H5Fclose(fileID);
+#endif
+
+  return stored;
+}
+
+void CHDF5FileWriter::WriteXDMF() const {
+
+#ifdef HAVE_HDF5
+  hid_t fileID = H5Fopen(fileName.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+  if (fileID < 0)
+    SU2_MPI::Error("Unable to open HDF5 file " + fileName, CURRENT_FUNCTION);
+
+  unsigned long nPoint = 0, nElem = 0;
+  hid_t mesh = H5Gopen2(fileID, "Mesh", H5P_DEFAULT);
+  ReadAttribute(mesh, "NumberOfPoints", H5T_NATIVE_ULONG, &nPoint);
+  ReadAttribute(mesh, "NumberOfElements", H5T_NATIVE_ULONG, &nElem);
+  const hsize_t nTopo = DatasetDims(mesh, "Topology")[0];
+  H5Gclose(mesh);
+
+  /*--- The XDMF file is written next to the HDF5 file, which is referred to by its name only. ---*/
+
+  const string h5Name = fileName.substr(fileName.find_last_of('/')+1);
+  const string xdmfName = fileName.substr(0, fileName.size()-fileExt.size()) + xdmfExt;
+
+  auto dataItem = [&](const string& path, hsize_t nRow, hsize_t nCol, const char* numberType) {
+    ostringstream item;
+    item << "<DataItem Dimensions=\"" << nRow;
+    if (nCol > 1) item << " " << nCol;
+    item << "\" NumberType=\"" << numberType << "\" Precision=\"8\" Format=\"HDF\">"
+         << h5Name << ":" << path << "</DataItem>";
+    return item.str();
+  };
+
+  ofstream xdmf(xdmfName);
+  xdmf << setprecision(15);
+  xdmf << "<?xml version=\"1.0\" ?>\n";
+  xdmf << "<!DOCTYPE Xdmf SYSTEM \"Xdmf.dtd\" []>\n";
+  xdmf << "<Xdmf Version=\"3.0\">\n";
+  xdmf << "  <Domain>\n";
+  xdmf << "    <Grid Name=\"TimeSeries\" GridType=\"Collection\" CollectionType=\"Temporal\">\n";
+
+  hid_t steps = H5Gopen2(fileID, "Steps", H5P_DEFAULT);
+  H5G_info_t stepsInfo;
+  H5Gget_info(steps, &stepsInfo);
+
+  for (hsize_t iStep = 0; iStep < stepsInfo.nlinks; iStep++) {
+
+    const string stepName = LinkName(steps, iStep);
+    const string stepPath = "/Steps/" + stepName + "/";
+    hid_t step = H5Gopen2(steps, stepName.c_str(), H5P_DEFAULT);
+
+    passivedouble time = 0.0;
+    ReadAttribute(step, "Time", H5T_NATIVE_DOUBLE, &time);
+
+    const bool stepCoords = (H5Lexists(step, "Coordinates", H5P_DEFAULT) > 0);
+
+    xdmf << "      <Grid Name=\"Step_" << stepName << "\" GridType=\"Uniform\">\n";
+    xdmf << "        <Time Value=\"" << time << "\"/>\n";
+    xdmf << "        <Topology TopologyType=\"Mixed\" NumberOfElements=\"" << nElem << "\">\n";
+    xdmf << "          " << dataItem("/Mesh/Topology", nTopo, 1, "Int") << "\n";
+    xdmf << "        </Topology>\n";
+    xdmf << "        <Geometry GeometryType=\"XYZ\">\n";
+    xdmf << "          " << dataItem(stepCoords? stepPath+"Coordinates" : "/Mesh/Coordinates", nPoint, 3, "Float") << "\n";
+    xdmf << "        </Geometry>\n";
+
+    H5G_info_t stepInfo;
+    H5Gget_info(step, &stepInfo);
+
+    for (hsize_t iField = 0; iField < stepInfo.nlinks; iField++) {
+      const string fieldName = LinkName(step, iField);
+      if (fieldName == "Coordinates") continue;
+
+      const vector<hsize_t> dims = DatasetDims(step, fieldName);
+      const hsize_t nCol = (dims.size() > 1)? dims[1] : 1;
+
+      xdmf << "        <Attribute Name=\"" << fieldName << "\" AttributeType=\""
+           << ((nCol > 1)? "Vector" : "Scalar") << "\" Center=\"Node\">\n";
+      xdmf << "          " << dataItem(stepPath+fieldName, dims[0], nCol, "Float") << "\n";
+      xdmf << "        </Attribute>\n";
+    }
+
+    xdmf << "      </Grid>\n";
+    H5Gclose(step);
+  }
+  H5Gclose(steps);
+  H5Fclose(fileID);
+
+  xdmf << "    </Grid>\n";
+  xdmf << "  </Domain>\n";
+  xdmf << "</Xdmf>\n";
+  xdmf.close();
+#endif
+
+}
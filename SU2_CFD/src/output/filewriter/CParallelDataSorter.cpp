@@ -26,6 +26,7 @@
  */
 
 #include "../../../include/output/filewriter/CParallelDataSorter.hpp"
+#include "../../../../Common/include/toolboxes/allocation_toolbox.hpp"
 #include <cassert>
 #include <numeric>
 
@@ -46,6 +47,8 @@ CParallelDataSorter::CParallelDataSorter(CConfig *config, const vector<string> &
   rank = SU2_MPI::GetRank();
   size = SU2_MPI::GetSize();
 
+  comm = MPI_COMM_WORLD;
+
   GlobalField_Counter = this->fieldNames.size();
 
   Conn_Line_Par = NULL;
@@ -66,6 +69,8 @@ CParallelDataSorter::CParallelDataSorter(CConfig *config, const vector<string> &
   idSend       = NULL;
   nSends = 0;
   nRecvs = 0;
+  sortPlanStored = false;
+  connectivitySorted = false;
 
   nLocalPointsBeforeSort  = 0;
   nGlobalPointBeforeSort = 0;
@@ -106,12 +111,32 @@ CParallelDataSorter::~CParallelDataSorter(){
   delete [] connSend;
 
   delete [] dataBuffer;
+
+  MemoryAllocation::track_memory(MemoryAllocation::MEMORY_OUTPUT, -bufferBytes);
+}
+
+void CParallelDataSorter::SnapshotData() {
+
+  const int VARS_PER_POINT = GlobalField_Counter;
+
+  connSnapshot.assign(connSend, connSend + VARS_PER_POINT*nPoint_Send[size]);
+
 }
 
 void CParallelDataSorter::SortOutputData() {
 
   int VARS_PER_POINT = GlobalField_Counter;
 
+  /*--- Sort the copy of the data if one was made. ---*/
+
+  su2double* dataSend = connSnapshot.empty()? connSend : connSnapshot.data();
+
+  /*--- The global IDs of the received points only depend on the partition, they
+   are communicated by the first sort and the resulting order is reused afterwards. ---*/
+
+  const bool sendIDs = !sortPlanStored;
+  const int nMessage = sendIDs? 2 : 1;
+
 #ifdef HAVE_MPI
   SU2_MPI::Request *send_req, *recv_req;
   SU2_MPI::Status status;
@@ -123,15 +148,15 @@ void CParallelDataSorter::SortOutputData() {
    we do not include our own rank in the communications. We will
    directly copy our own data later. ---*/
 
-
-  unsigned long *idRecv = new unsigned long[nPoint_Recv[size]]();
+  if (sendIDs) sortOrder.assign(nPoint_Recv[size], 0);
+  unsigned long *idRecv = sortOrder.data();
 
 #ifdef HAVE_MPI
   /*--- We need double the number of messages to send both the conn.
    and the global IDs. ---*/
 
-  send_req = new SU2_MPI::Request[2*nSends];
-  recv_req = new SU2_MPI::Request[2*nRecvs];
+  send_req = new SU2_MPI::Request[nMessage*nSends];
+  recv_req = new SU2_MPI::Request[nMessage*nRecvs];
 
   unsigned long iMessage = 0;
   for (int ii=0; ii<size; ii++) {
@@ -142,7 +167,7 @@ void CParallelDataSorter::SortOutputData() {
       int source = ii;
       int tag    = ii + 1;
       SU2_MPI::Irecv(&(doubleBuffer[ll]), count, MPI_DOUBLE, source, tag,
-                     MPI_COMM_WORLD, &(recv_req[iMessage]));
+                     comm, &(recv_req[iMessage]));
       iMessage++;
     }
   }
@@ -157,8 +182,8 @@ void CParallelDataSorter::SortOutputData() {
       int count  = VARS_PER_POINT*kk;
       int dest = ii;
       int tag    = rank + 1;
-      SU2_MPI::Isend(&(connSend[ll]), count, MPI_DOUBLE, dest, tag,
-                     MPI_COMM_WORLD, &(send_req[iMessage]));
+      SU2_MPI::Isend(&(dataSend[ll]), count, MPI_DOUBLE, dest, tag,
+                     comm, &(send_req[iMessage]));
       iMessage++;
     }
   }
@@ -166,7 +191,7 @@ void CParallelDataSorter::SortOutputData() {
   /*--- Repeat the process to communicate the global IDs. ---*/
 
   iMessage = 0;
-  for (int ii=0; ii<size; ii++) {
+  for (int ii=0; sendIDs && ii<size; ii++) {
     if ((ii != rank) && (nPoint_Recv[ii+1] > nPoint_Recv[ii])) {
       int ll     = nPoint_Recv[ii];
       int kk     = nPoint_Recv[ii+1] - nPoint_Recv[ii];
@@ -174,7 +199,7 @@ void CParallelDataSorter::SortOutputData() {
       int source = ii;
       int tag    = ii + 1;
       SU2_MPI::Irecv(&(idRecv[ll]), count, MPI_UNSIGNED_LONG, source, tag,
-                     MPI_COMM_WORLD, &(recv_req[iMessage+nRecvs]));
+                     comm, &(recv_req[iMessage+nRecvs]));
       iMessage++;
     }
   }
@@ -182,7 +207,7 @@ void CParallelDataSorter::SortOutputData() {
   /*--- Launch the non-blocking sends of the global IDs. ---*/
 
   iMessage = 0;
-  for (int ii=0; ii<size; ii++) {
+  for (int ii=0; sendIDs && ii<size; ii++) {
     if ((ii != rank) && (nPoint_Send[ii+1] > nPoint_Send[ii])) {
       int ll = nPoint_Send[ii];
       int kk = nPoint_Send[ii+1] - nPoint_Send[ii];
@@ -190,7 +215,7 @@ void CParallelDataSorter::SortOutputData() {
       int dest   = ii;
       int tag    = rank + 1;
       SU2_MPI::Isend(&(idSend[ll]), count, MPI_UNSIGNED_LONG, dest, tag,
-                     MPI_COMM_WORLD, &(send_req[iMessage+nSends]));
+                     comm, &(send_req[iMessage+nSends]));
       iMessage++;
     }
   }
@@ -202,22 +227,23 @@ void CParallelDataSorter::SortOutputData() {
   int ll = VARS_PER_POINT*nPoint_Send[rank];
   int kk = VARS_PER_POINT*nPoint_Send[rank+1];
 
-  for (int nn=ll; nn<kk; nn++, mm++) doubleBuffer[mm] = connSend[nn];
+  for (int nn=ll; nn<kk; nn++, mm++) doubleBuffer[mm] = dataSend[nn];
 
   mm = nPoint_Recv[rank];
   ll = nPoint_Send[rank];
   kk = nPoint_Send[rank+1];
 
-  for (int nn=ll; nn<kk; nn++, mm++) idRecv[mm] = idSend[nn];
+  if (sendIDs)
+    for (int nn=ll; nn<kk; nn++, mm++) idRecv[mm] = idSend[nn];
 
   /*--- Wait for the non-blocking sends and recvs to complete. ---*/
 
 #ifdef HAVE_MPI
-  int number = 2*nSends;
+  int number = nMessage*nSends;
   for (int ii = 0; ii < number; ii++)
     SU2_MPI::Waitany(number, send_req, &ind, &status);
 
-  number = 2*nRecvs;
+  number = nMessage*nRecvs;
   for (int ii = 0; ii < number; ii++)
     SU2_MPI::Waitany(number, recv_req, &ind, &status);
 
@@ -254,6 +280,8 @@ void CParallelDataSorter::SortOutputData() {
 
   delete [] tmpBuffer;
 
+  if (!sendIDs) return;
+
   /*--- Store the total number of local points my rank has for
    the current section after completing the communications. ---*/
 
@@ -262,11 +290,9 @@ void CParallelDataSorter::SortOutputData() {
   /*--- Reduce the total number of points we will write in the output files. ---*/
 
   SU2_MPI::Allreduce(&nPoints, &nPointsGlobal, 1,
-                     MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
-
-  /*--- Free temporary memory from communications ---*/
+                     MPI_UNSIGNED_LONG, MPI_SUM, comm);
 
-  delete [] idRecv;
+  sortPlanStored = true;
 }
 
 void CParallelDataSorter::PrepareSendBuffers(std::vector<unsigned long>& globalID){
@@ -298,7 +324,7 @@ void CParallelDataSorter::PrepareSendBuffers(std::vector<unsigned long>& globalI
    many cells it will receive from each other processor. ---*/
 
   SU2_MPI::Alltoall(&(nPoint_Send[1]), 1, MPI_INT,
-                    &(nPoint_Recv[1]), 1, MPI_INT, MPI_COMM_WORLD);
+                    &(nPoint_Recv[1]), 1, MPI_INT, comm);
 
   /*--- Prepare to send coordinates. First check how many
    messages we will be sending and receiving. Here we also put
@@ -326,6 +352,10 @@ void CParallelDataSorter::PrepareSendBuffers(std::vector<unsigned long>& globalI
   unsigned short maxSize = max(sizeof(passivedouble), sizeof(su2double));
   dataBuffer = new char[VARS_PER_POINT*nPoint_Recv[size]*maxSize];
 
+  const long long nBytes = VARS_PER_POINT*(nPoint_Send[size]*sizeof(su2double) + nPoint_Recv[size]*maxSize);
+  MemoryAllocation::track_memory(MemoryAllocation::MEMORY_OUTPUT, nBytes);
+  bufferBytes += nBytes;
+
   /*--- doubleBuffer and passiveDouble buffer use the same memory allocated above using the dataBuffer. ---*/
 
   doubleBuffer = reinterpret_cast<su2double*>(dataBuffer);
@@ -375,6 +405,28 @@ void CParallelDataSorter::PrepareSendBuffers(std::vector<unsigned long>& globalI
 
   delete [] index;
   delete [] idIndex;
+
+  /*--- The received order has to be communicated again by the next sort. ---*/
+
+  sortPlanStored = false;
+}
+
+const int* CParallelDataSorter::GetConnectivity(GEO_TYPE type) const {
+
+  switch (type) {
+    case LINE:          return Conn_Line_Par;
+    case TRIANGLE:      return Conn_Tria_Par;
+    case QUADRILATERAL: return Conn_Quad_Par;
+    case TETRAHEDRON:   return Conn_Tetr_Par;
+    case HEXAHEDRON:    return Conn_Hexa_Par;
+    case PRISM:         return Conn_Pris_Par;
+    case PYRAMID:       return Conn_Pyra_Par;
+    default: break;
+  }
+
+  SU2_MPI::Error("GEO_TYPE not found", CURRENT_FUNCTION);
+
+  return nullptr;
 }
 
 unsigned long CParallelDataSorter::GetElem_Connectivity(GEO_TYPE type, unsigned long iElem, unsigned long iNode) const {
@@ -414,7 +466,7 @@ void CParallelDataSorter::SetTotalElements(){
   
   /*--- Reduce the total number of cells we will be writing in the output files. ---*/
 
-  SU2_MPI::Allreduce(nElemPerType.data(), nElemPerTypeGlobal.data(), N_ELEM_TYPES, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(nElemPerType.data(), nElemPerTypeGlobal.data(), N_ELEM_TYPES, MPI_UNSIGNED_LONG, MPI_SUM, comm);
   
   nElemGlobal = std::accumulate(nElemPerTypeGlobal.begin(), nElemPerTypeGlobal.end(), 0); 
   nElem  = std::accumulate(nElemPerType.begin(), nElemPerType.end(), 0);
@@ -451,10 +503,10 @@ void CParallelDataSorter::SetTotalElements(){
   /*--- Communicate the local counts to all ranks for building offsets. ---*/
 
   SU2_MPI::Alltoall(&(nElem_Send[1]), 1, MPI_INT,
-                    &(nElem_Cum[1]), 1, MPI_INT, MPI_COMM_WORLD);
+                    &(nElem_Cum[1]), 1, MPI_INT, comm);
 
   SU2_MPI::Alltoall(&(nElemConn_Send[1]), 1, MPI_INT,
-                    &(nElemConn_Cum[1]), 1, MPI_INT, MPI_COMM_WORLD);
+                    &(nElemConn_Cum[1]), 1, MPI_INT, comm);
 
   /*--- Put the counters into cumulative storage format. ---*/
 
@@ -157,7 +157,7 @@ void CSTLFileWriter::ReprocessElementConnectivity(){
   for (unsigned long i = 0; i < num_halo_nodes; ++i)
     ++num_nodes_to_receive[neighbor_partitions[i]];
   num_nodes_to_send.resize(size);
-  SU2_MPI::Alltoall(&num_nodes_to_receive[0], 1, MPI_INT, &num_nodes_to_send[0], 1, MPI_INT, MPI_COMM_WORLD);
+  SU2_MPI::Alltoall(&num_nodes_to_receive[0], 1, MPI_INT, &num_nodes_to_send[0], 1, MPI_INT, comm);
 
   /* Now send the global node numbers whose data we need,
      and receive the same from all other ranks.
@@ -182,7 +182,7 @@ void CSTLFileWriter::ReprocessElementConnectivity(){
   if (sorted_halo_nodes.empty()) sorted_halo_nodes.resize(1); /* Avoid crash. */
   SU2_MPI::Alltoallv(&sorted_halo_nodes[0], &num_nodes_to_receive[0], &nodes_to_receive_displacements[0], MPI_UNSIGNED_LONG,
                      &nodes_to_send[0],     &num_nodes_to_send[0],    &nodes_to_send_displacements[0],    MPI_UNSIGNED_LONG,
-                     MPI_COMM_WORLD);
+                     comm);
 
   /* Now actually send and receive the data */
   data_to_send.resize(max<unsigned long>(1, total_num_nodes_to_send * fieldNames.size()));
@@ -211,7 +211,7 @@ void CSTLFileWriter::ReprocessElementConnectivity(){
 
   SU2_MPI::Alltoallv(&data_to_send[0],  &num_values_to_send[0],    &values_to_send_displacements[0],    MPI_DOUBLE,
                      &halo_var_data[0], &num_values_to_receive[0], &values_to_receive_displacements[0], MPI_DOUBLE,
-                     MPI_COMM_WORLD);
+                     comm);
 }
 
 
@@ -244,12 +244,12 @@ void CSTLFileWriter::GatherCoordData(){
    to the master node with collective calls. ---*/
 
   SU2_MPI::Allreduce(&nLocalTriaAll, &max_nLocalTriaAll, 1,
-                     MPI_UNSIGNED_LONG, MPI_MAX, MPI_COMM_WORLD);
+                     MPI_UNSIGNED_LONG, MPI_MAX, comm);
 
 
   SU2_MPI::Gather(&nLocalTriaAll   , 1, MPI_UNSIGNED_LONG,
                   buffRecvTriaCount, 1, MPI_UNSIGNED_LONG,
-                  MASTER_NODE, MPI_COMM_WORLD);
+                  MASTER_NODE, comm);
 
   /*--- Allocate buffer for send/recv of the coordinate data. Only the master rank allocates buffers for the recv. ---*/
   buffSendCoords = new su2double[max_nLocalTriaAll*N_POINTS_TRIANGLE*3]; /* Triangle has 3 Points with 3 coords each */
@@ -262,7 +262,7 @@ void CSTLFileWriter::GatherCoordData(){
   /*--- Collective comms of the solution data and global IDs. ---*/
   SU2_MPI::Gather(buffSendCoords, static_cast<int>(max_nLocalTriaAll*N_POINTS_TRIANGLE*3), MPI_DOUBLE,
                   buffRecvCoords, static_cast<int>(max_nLocalTriaAll*N_POINTS_TRIANGLE*3), MPI_DOUBLE,
-                  MASTER_NODE, MPI_COMM_WORLD);
+                  MASTER_NODE, comm);
 
   /*--- Free temporary memory. ---*/
   if(buffSendCoords != NULL) delete [] buffSendCoords;
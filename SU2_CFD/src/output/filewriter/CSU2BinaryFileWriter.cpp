@@ -26,11 +26,14 @@
  */
 
 #include "../../../include/output/filewriter/CSU2BinaryFileWriter.hpp"
+#include "../../../../Common/include/toolboxes/compression_toolbox.hpp"
 
 const string CSU2BinaryFileWriter::fileExt = ".dat";
 
-CSU2BinaryFileWriter::CSU2BinaryFileWriter(string valFileName, CParallelDataSorter *valDataSorter)  :
-  CFileWriter(std::move(valFileName), valDataSorter, fileExt){}
+CSU2BinaryFileWriter::CSU2BinaryFileWriter(string valFileName, CParallelDataSorter *valDataSorter,
+                                           unsigned short valCompression, vector<passivedouble> valErrorBound)  :
+  CFileWriter(std::move(valFileName), valDataSorter, fileExt),
+  compression(valCompression), errorBound(std::move(valErrorBound)){}
 
 
 CSU2BinaryFileWriter::~CSU2BinaryFileWriter(){
@@ -53,11 +56,18 @@ void CSU2BinaryFileWriter::Write_Data(){
   /*--- Prepare the first ints containing the counts. The first is a
    magic number that we can use to check for binary files (it is the hex
    representation for "SU2"). The second two values are number of variables
-   and number of points (DoFs). ---*/
+   and number of points (DoFs). Compressed files have their own magic number,
+   the kind of compression, and the number of compressed blocks (one per rank). ---*/
 
   int var_buf_size = 5;
   int var_buf[5] = {535532, nVar, (int)nPoint_Global, 0, 0};
 
+  if (compression != NO_COMPRESSION) {
+    var_buf[0] = SU2_COMPRESSED_RESTART_ID;
+    var_buf[3] = compression;
+    var_buf[4] = size;
+  }
+
   /*--- Open the file using MPI I/O ---*/
   
   OpenMPIFile();
@@ -77,16 +87,63 @@ void CSU2BinaryFileWriter::Write_Data(){
     WriteMPIBinaryData(str_buf, CGNS_STRING_SIZE*sizeof(char), MASTER_NODE);
   }
     
-  /*--- Compute various data sizes --- */
-  
-  unsigned long sizeInBytesPerPoint = sizeof(passivedouble)*nVar;
-  unsigned long sizeInBytesLocal    = sizeInBytesPerPoint*nParallel_Poin;
-  unsigned long sizeInBytesGlobal   = sizeInBytesPerPoint*nPoint_Global;
-  unsigned long offsetInBytes       = sizeInBytesPerPoint*dataSorter->GetnPointCumulative(rank);
-  
-  /*--- Collectively write the actual data to file ---*/
-  
-  WriteMPIBinaryDataAll(dataSorter->GetData(), sizeInBytesLocal, sizeInBytesGlobal, offsetInBytes);
+  if (compression == NO_COMPRESSION) {
+
+    /*--- Compute various data sizes --- */
+
+    unsigned long sizeInBytesPerPoint = sizeof(passivedouble)*nVar;
+    unsigned long sizeInBytesLocal    = sizeInBytesPerPoint*nParallel_Poin;
+    unsigned long sizeInBytesGlobal   = sizeInBytesPerPoint*nPoint_Global;
+    unsigned long offsetInBytes       = sizeInBytesPerPoint*dataSorter->GetnPointCumulative(rank);
+
+    /*--- Collectively write the actual data to file ---*/
+
+    WriteMPIBinaryDataAll(dataSorter->GetData(), sizeInBytesLocal, sizeInBytesGlobal, offsetInBytes);
+  }
+  else {
+
+    /*--- Write the error bounds (0 for the lossless fields). ---*/
+
+    vector<passivedouble> bound(nVar, 0.0);
+    if (compression == LOSSY_COMPRESSION)
+      for (iVar = 0; iVar < min<size_t>(nVar, errorBound.size()); iVar++) bound[iVar] = errorBound[iVar];
+
+    WriteMPIBinaryData(bound.data(), nVar*sizeof(passivedouble), MASTER_NODE);
+
+    /*--- Each rank compresses its points into one block, the compression counts as writing time. ---*/
+
+#ifndef HAVE_MPI
+    startTime = su2double(clock())/su2double(CLOCKS_PER_SEC);
+#else
+    startTime = MPI_Wtime();
+#endif
+
+    vector<char> block;
+    CompressionToolbox::CompressBlock(dataSorter->GetData(), nParallel_Poin, nVar, bound.data(), DEFLATE_LEVEL, block);
+
+#ifndef HAVE_MPI
+    stopTime = su2double(clock())/su2double(CLOCKS_PER_SEC);
+#else
+    stopTime = MPI_Wtime();
+#endif
+    usedTime += stopTime - startTime;
+
+    /*--- Write the table of the blocks [nPoint nBytes] and the blocks after one another. ---*/
+
+    unsigned long myBlock[2] = {nParallel_Poin, block.size()};
+    vector<unsigned long> blockTable(2*size);
+    SU2_MPI::Allgather(myBlock, 2, MPI_UNSIGNED_LONG, blockTable.data(), 2, MPI_UNSIGNED_LONG, comm);
+
+    WriteMPIBinaryData(blockTable.data(), blockTable.size()*sizeof(unsigned long), MASTER_NODE);
+
+    unsigned long offsetInBytes = 0, sizeInBytesGlobal = 0;
+    for (int iRank = 0; iRank < size; iRank++) {
+      if (iRank < rank) offsetInBytes += blockTable[2*iRank+1];
+      sizeInBytesGlobal += blockTable[2*iRank+1];
+    }
+
+    WriteMPIBinaryDataAll(block.data(), block.size(), sizeInBytesGlobal, offsetInBytes);
+  }
 
   /*--- Close the file ---*/
   
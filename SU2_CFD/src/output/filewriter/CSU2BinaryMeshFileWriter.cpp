@@ -0,0 +1,204 @@
+/*!
+ * \file CSU2BinaryMeshFileWriter.cpp
+ * \brief Filewriter class for the binary SU2 mesh format.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/output/filewriter/CSU2BinaryMeshFileWriter.hpp"
+#include "../../../../Common/include/toolboxes/printing_toolbox.hpp"
+#include <cstdint>
+
+const string CSU2BinaryMeshFileWriter::fileExt = ".su2b";
+
+CSU2BinaryMeshFileWriter::CSU2BinaryMeshFileWriter(string valFileName, CParallelDataSorter *valDataSorter,
+                                                   unsigned short valiZone, unsigned short valnZone) :
+   CFileWriter(std::move(valFileName), valDataSorter, fileExt), iZone(valiZone), nZone(valnZone) {}
+
+
+CSU2BinaryMeshFileWriter::~CSU2BinaryMeshFileWriter(){
+
+}
+
+
+void CSU2BinaryMeshFileWriter::Write_Data(){
+
+  if (nZone > 1) {
+    SU2_MPI::Error("Binary SU2 meshes contain a single zone, use the SU2 (ASCII) mesh format.", CURRENT_FUNCTION);
+  }
+
+  const unsigned short nDim = dataSorter->GetnDim();
+  const unsigned long nPoint = dataSorter->GetnPoints();
+  const unsigned long nPointGlobal = dataSorter->GetnPointsGlobal();
+
+  /*--- Volume elements of this rank, in the same order as the ASCII writer,
+   the connectivity is stored with 0-based indices. ---*/
+
+  const GEO_TYPE elemTypes[] = {TRIANGLE, QUADRILATERAL, TETRAHEDRON, HEXAHEDRON, PRISM, PYRAMID};
+  const unsigned short elemNodes[] = {N_POINTS_TRIANGLE, N_POINTS_QUADRILATERAL, N_POINTS_TETRAHEDRON,
+                                      N_POINTS_HEXAHEDRON, N_POINTS_PRISM, N_POINTS_PYRAMID};
+  vector<uint64_t> elems;
+
+  for (unsigned short iType = 0; iType < 6; iType++) {
+    for (unsigned long iElem = 0; iElem < dataSorter->GetnElem(elemTypes[iType]); iElem++) {
+      elems.push_back(elemTypes[iType]);
+      for (unsigned short iNode = 0; iNode < SU2_BINARY_MESH_ELEM-1; iNode++) {
+        if (iNode < elemNodes[iType])
+          elems.push_back(dataSorter->GetElem_Connectivity(elemTypes[iType], iElem, iNode) - 1);
+        else
+          elems.push_back(0);
+      }
+    }
+  }
+
+  /*--- Offset of the elements of this rank in the global list. ---*/
+
+  unsigned long nElem = elems.size()/SU2_BINARY_MESH_ELEM, nElemGlobal = 0, elemOffset = 0;
+  vector<unsigned long> nElemRank(size);
+  SU2_MPI::Allgather(&nElem, 1, MPI_UNSIGNED_LONG, nElemRank.data(), 1, MPI_UNSIGNED_LONG, comm);
+
+  for (int iRank = 0; iRank < size; iRank++) {
+    if (iRank < rank) elemOffset += nElemRank[iRank];
+    nElemGlobal += nElemRank[iRank];
+  }
+
+  /*--- Coordinates of the points of this rank. ---*/
+
+  vector<passivedouble> coords(nPoint*nDim);
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      coords[iPoint*nDim+iDim] = dataSorter->GetData(iDim, iPoint);
+
+  /*--- The master converts the boundary information (written by the geometry)
+   into the marker block. The deprecated SEND_RECEIVE markers are not written. ---*/
+
+  vector<char> markers;
+  uint64_t nMarker = 0;
+
+  auto append = [&markers](const void* data, size_t sizeInBytes) {
+    const char* bytes = static_cast<const char*>(data);
+    markers.insert(markers.end(), bytes, bytes+sizeInBytes);
+  };
+
+  if (rank == MASTER_NODE) {
+
+    string str = (nZone == 1)? "boundary" : "boundary_" + PrintingToolbox::to_string(iZone);
+    str += ".dat";
+
+    ifstream input_file(str.c_str(), ios::in);
+    if (!input_file.is_open()) {
+      SU2_MPI::Error(string("Cannot find ") + str, CURRENT_FUNCTION);
+    }
+
+    string text_line;
+    while (getline(input_file, text_line)) {
+
+      if (text_line.find("NMARK=",0) == string::npos) continue;
+
+      text_line.erase(0,6);
+      const unsigned short nMarker_ = atoi(text_line.c_str());
+
+      for (unsigned short iMarker = 0; iMarker < nMarker_; iMarker++) {
+
+        getline(input_file, text_line);
+        text_line.erase(0,11);
+        string Marker_Tag;
+        for (auto c : text_line) if ((c != ' ') && (c != '\r') && (c != '\n')) Marker_Tag += c;
+
+        getline(input_file, text_line);
+        text_line.erase(0,13);
+        const uint64_t nElem_Bound = atol(text_line.c_str());
+
+        getline(input_file, text_line); // SEND_TO
+
+        const bool skip = (Marker_Tag == "SEND_RECEIVE");
+
+        if (!skip) {
+          char name[CGNS_STRING_SIZE] = {'\0'};
+          strncpy(name, Marker_Tag.c_str(), CGNS_STRING_SIZE-1);
+          append(name, CGNS_STRING_SIZE);
+          append(&nElem_Bound, sizeof(uint64_t));
+          nMarker++;
+        }
+
+        for (uint64_t iElem_Bound = 0; iElem_Bound < nElem_Bound; iElem_Bound++) {
+
+          getline(input_file, text_line);
+          if (skip) continue;
+
+          istringstream bound_line(text_line);
+          uint64_t record[SU2_BINARY_MESH_BOUND] = {0};
+          unsigned short nNodes = 0;
+
+          bound_line >> record[0];
+          switch (record[0]) {
+            case LINE:          nNodes = N_POINTS_LINE; break;
+            case TRIANGLE:      nNodes = N_POINTS_TRIANGLE; break;
+            case QUADRILATERAL: nNodes = N_POINTS_QUADRILATERAL; break;
+            default:
+              SU2_MPI::Error(string("Unsupported boundary element type in ") + str, CURRENT_FUNCTION);
+          }
+          for (unsigned short iNode = 0; iNode < nNodes; iNode++)
+            bound_line >> record[iNode+1];
+
+          append(record, SU2_BINARY_MESH_BOUND*sizeof(uint64_t));
+        }
+      }
+      break;
+    }
+
+    input_file.close();
+  }
+
+  /*--- Header with the counts and the offsets of the blocks. ---*/
+
+  const unsigned long pointSize = nDim*sizeof(passivedouble);
+  const unsigned long elemSize = SU2_BINARY_MESH_ELEM*sizeof(uint64_t);
+
+  uint64_t header[SU2_BINARY_MESH_HEADER];
+  header[0] = SU2_BINARY_MESH_ID;
+  header[1] = nDim;
+  header[2] = nPointGlobal;
+  header[3] = nElemGlobal;
+  header[4] = nMarker;
+  header[5] = SU2_BINARY_MESH_HEADER*sizeof(uint64_t);
+  header[6] = header[5] + nPointGlobal*pointSize;
+  header[7] = header[6] + nElemGlobal*elemSize;
+
+  /*--- Open the file using MPI I/O, the master writes the header and the markers,
+   all ranks write their points and elements collectively. ---*/
+
+  OpenMPIFile();
+
+  WriteMPIBinaryData(header, SU2_BINARY_MESH_HEADER*sizeof(uint64_t), MASTER_NODE);
+
+  WriteMPIBinaryDataAll(coords.data(), nPoint*pointSize, nPointGlobal*pointSize,
+                        dataSorter->GetnPointCumulative(rank)*pointSize);
+
+  WriteMPIBinaryDataAll(elems.data(), nElem*elemSize, nElemGlobal*elemSize, elemOffset*elemSize);
+
+  WriteMPIBinaryData(markers.data(), markers.size(), MASTER_NODE);
+
+  CloseMPIFile();
+
+}
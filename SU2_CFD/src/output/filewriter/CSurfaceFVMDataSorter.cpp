@@ -37,6 +37,7 @@ CSurfaceFVMDataSorter::CSurfaceFVMDataSorter(CConfig *config, CGeometry *geometr
   this->volumeSorter = valVolumeSorter;
 
   connectivitySorted = false;
+  surfacePlanStored = false;
 
   nGlobalPointBeforeSort = geometry->GetGlobal_nPointDomain();
   nLocalPointsBeforeSort  = geometry->GetnPointDomain();
@@ -61,6 +62,17 @@ void CSurfaceFVMDataSorter::SortOutputData() {
   unsigned long Global_Index;
 
   int VARS_PER_POINT = GlobalField_Counter;
+
+  /*--- Once the surface points and the renumbered connectivity are known, only the
+   values of those points have to be extracted from the sorted volume data. ---*/
+
+  if (surfacePlanStored) {
+    for (unsigned long ii = 0; ii < surfacePoints.size(); ii++)
+      for (int jj = 0; jj < VARS_PER_POINT; jj++)
+        passiveDoubleBuffer[ii*VARS_PER_POINT + jj] = volumeSorter->GetData(jj, surfacePoints[ii]);
+    return;
+  }
+
   int *Local_Halo = NULL;
   int iNode, count;
 
@@ -175,7 +187,7 @@ void CSurfaceFVMDataSorter::SortOutputData() {
    many nodes it will receive from each other processor. ---*/
 
   SU2_MPI::Alltoall(&(nElem_Send[1]), 1, MPI_INT,
-                    &(nElem_Recv[1]), 1, MPI_INT, MPI_COMM_WORLD);
+                    &(nElem_Recv[1]), 1, MPI_INT, comm);
 
   /*--- Prepare to send. First check how many
    messages we will be sending and receiving. Here we also put
@@ -331,7 +343,7 @@ void CSurfaceFVMDataSorter::SortOutputData() {
       int source = ii;
       int tag    = ii + 1;
       SU2_MPI::Irecv(&(idRecv[ll]), count, MPI_UNSIGNED_LONG, source, tag,
-                     MPI_COMM_WORLD, &(recv_req[iMessage]));
+                     comm, &(recv_req[iMessage]));
       iMessage++;
     }
   }
@@ -347,7 +359,7 @@ void CSurfaceFVMDataSorter::SortOutputData() {
       int dest = ii;
       int tag    = rank + 1;
       SU2_MPI::Isend(&(idSend[ll]), count, MPI_UNSIGNED_LONG, dest, tag,
-                     MPI_COMM_WORLD, &(send_req[iMessage]));
+                     comm, &(send_req[iMessage]));
       iMessage++;
     }
   }
@@ -400,6 +412,7 @@ void CSurfaceFVMDataSorter::SortOutputData() {
 
   nPoints = 0;
   Renumber2Global.clear();
+  surfacePoints.clear();
 
   for (iPoint = 0; iPoint < volumeSorter->GetnPoints(); iPoint++) {
     if (surfPoint[iPoint] != -1) {
@@ -407,6 +420,7 @@ void CSurfaceFVMDataSorter::SortOutputData() {
       /*--- Save the global index values for CSV output. ---*/
 
       Renumber2Global[nPoints] = surfPoint[iPoint];
+      surfacePoints.push_back(iPoint);
 
       /*--- Increment total number of surface points found locally. ---*/
 
@@ -425,7 +439,7 @@ void CSurfaceFVMDataSorter::SortOutputData() {
   for (int ii=1; ii < size+1; ii++) nPoint_Send[ii]= (int)nPoints;
 
   SU2_MPI::Alltoall(&(nPoint_Send[1]), 1, MPI_INT,
-                    &(nPoint_Recv[1]), 1, MPI_INT, MPI_COMM_WORLD);
+                    &(nPoint_Recv[1]), 1, MPI_INT, comm);
 
   /*--- Go to cumulative storage format to compute the offsets. ---*/
 
@@ -457,7 +471,7 @@ void CSurfaceFVMDataSorter::SortOutputData() {
    needed for writing the surface solution files later. ---*/
 
   SU2_MPI::Allreduce(&nPoints, &nPointsGlobal, 1,
-                     MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+                     MPI_UNSIGNED_LONG, MPI_SUM, comm);
 
   /*--- Now that we know every proc's global offset for the number of
    surface points, we can create the new global numbering. Here, we
@@ -524,7 +538,7 @@ void CSurfaceFVMDataSorter::SortOutputData() {
    many cells it will receive from each other processor. ---*/
 
   SU2_MPI::Alltoall(&(nElem_Send[1]), 1, MPI_INT,
-                    &(nElem_Recv[1]), 1, MPI_INT, MPI_COMM_WORLD);
+                    &(nElem_Recv[1]), 1, MPI_INT, comm);
 
   /*--- Prepare to send. First check how many
    messages we will be sending and receiving. Here we also put
@@ -619,7 +633,7 @@ void CSurfaceFVMDataSorter::SortOutputData() {
       int source = ii;
       int tag    = ii + 1;
       SU2_MPI::Irecv(&(globalRecv[ll]), count, MPI_UNSIGNED_LONG, source, tag,
-                     MPI_COMM_WORLD, &(recv_req[iMessage]));
+                     comm, &(recv_req[iMessage]));
       iMessage++;
     }
   }
@@ -635,7 +649,7 @@ void CSurfaceFVMDataSorter::SortOutputData() {
       int dest = ii;
       int tag    = rank + 1;
       SU2_MPI::Isend(&(globalSend[ll]), count, MPI_UNSIGNED_LONG, dest, tag,
-                     MPI_COMM_WORLD, &(send_req[iMessage]));
+                     comm, &(send_req[iMessage]));
       iMessage++;
     }
   }
@@ -651,7 +665,7 @@ void CSurfaceFVMDataSorter::SortOutputData() {
       int source = ii;
       int tag    = ii + 1;
       SU2_MPI::Irecv(&(renumbRecv[ll]), count, MPI_UNSIGNED_LONG, source, tag,
-                     MPI_COMM_WORLD, &(recv_req[iMessage+nRecvs]));
+                     comm, &(recv_req[iMessage+nRecvs]));
       iMessage++;
     }
   }
@@ -667,7 +681,7 @@ void CSurfaceFVMDataSorter::SortOutputData() {
       int dest = ii;
       int tag    = rank + 1;
       SU2_MPI::Isend(&(renumbSend[ll]), count, MPI_UNSIGNED_LONG, dest, tag,
-                     MPI_COMM_WORLD, &(send_req[iMessage+nSends]));
+                     comm, &(send_req[iMessage+nSends]));
       iMessage++;
     }
   }
@@ -825,7 +839,7 @@ void CSurfaceFVMDataSorter::SortOutputData() {
    many cells it will receive from each other processor. ---*/
 
   SU2_MPI::Alltoall(&(nElem_Send[1]), 1, MPI_INT,
-                    &(nElem_Recv[1]), 1, MPI_INT, MPI_COMM_WORLD);
+                    &(nElem_Recv[1]), 1, MPI_INT, comm);
   
   /*--- Prepare to send connectivities. First check how many
    messages we will be sending and receiving. Here we also put
@@ -907,7 +921,7 @@ void CSurfaceFVMDataSorter::SortOutputData() {
       int source = ii;
       int tag    = ii + 1;
       SU2_MPI::Irecv(&(idRecv[ll]), count, MPI_UNSIGNED_LONG, source, tag,
-                     MPI_COMM_WORLD, &(recv_req[iMessage]));
+                     comm, &(recv_req[iMessage]));
       iMessage++;
     }
   }
@@ -923,7 +937,7 @@ void CSurfaceFVMDataSorter::SortOutputData() {
       int dest = ii;
       int tag    = rank + 1;
       SU2_MPI::Isend(&(idSend[ll]), count, MPI_UNSIGNED_LONG, dest, tag,
-                     MPI_COMM_WORLD, &(send_req[iMessage]));
+                     comm, &(send_req[iMessage]));
       iMessage++;
     }
   }
@@ -984,7 +998,7 @@ void CSurfaceFVMDataSorter::SortOutputData() {
       int dest = ii;
       int tag    = ii + 1;
       SU2_MPI::Irecv(&(idSend[ll]), count, MPI_UNSIGNED_LONG, dest, tag,
-                     MPI_COMM_WORLD, &(recv_req[iMessage]));
+                     comm, &(recv_req[iMessage]));
       iMessage++;
     }
   }
@@ -1000,7 +1014,7 @@ void CSurfaceFVMDataSorter::SortOutputData() {
       int source = ii;
       int tag    = rank + 1;
       SU2_MPI::Isend(&(idRecv[ll]), count, MPI_UNSIGNED_LONG, source, tag,
-                     MPI_COMM_WORLD, &(send_req[iMessage]));
+                     comm, &(send_req[iMessage]));
       iMessage++;
     }
   }
@@ -1080,6 +1094,8 @@ void CSurfaceFVMDataSorter::SortOutputData() {
   delete [] nElem_Flag;
   delete [] Local_Halo;
 
+  surfacePlanStored = true;
+
 }
 
 void CSurfaceFVMDataSorter::SortConnectivity(CConfig *config, CGeometry *geometry, bool val_sort) {
@@ -1100,6 +1116,10 @@ void CSurfaceFVMDataSorter::SortConnectivity(CConfig *config, CGeometry *geometr
 
 void CSurfaceFVMDataSorter::SortConnectivity(CConfig *config, CGeometry *geometry, const vector<string> &markerList) {
 
+  /*--- Nothing to do if the (renumbered) connectivity of these markers is already stored. ---*/
+
+  if (connectivitySorted && (markerList == sortedMarkers)) return;
+
   /*--- Sort connectivity for each type of element (excluding halos). Note
    In these routines, we sort the connectivity into a linear partitioning
    across all processors based on the global index of the grid nodes. ---*/
@@ -1115,6 +1135,11 @@ void CSurfaceFVMDataSorter::SortConnectivity(CConfig *config, CGeometry *geometr
   SetTotalElements();
 
   connectivitySorted = true;
+  sortedMarkers = markerList;
+
+  /*--- The surface points and their numbering have to be recomputed for the new connectivity. ---*/
+
+  surfacePlanStored = false;
 
 }
 
@@ -1226,7 +1251,7 @@ void CSurfaceFVMDataSorter::SortSurfaceConnectivity(CConfig *config, CGeometry *
    many cells it will receive from each other processor. ---*/
 
   SU2_MPI::Alltoall(&(nElem_Send[1]), 1, MPI_INT,
-                    &(nElem_Recv[1]), 1, MPI_INT, MPI_COMM_WORLD);
+                    &(nElem_Recv[1]), 1, MPI_INT, comm);
 
   /*--- Prepare to send connectivities. First check how many
    messages we will be sending and receiving. Here we also put
@@ -1373,7 +1398,7 @@ void CSurfaceFVMDataSorter::SortSurfaceConnectivity(CConfig *config, CGeometry *
       int source = ii;
       int tag    = ii + 1;
       SU2_MPI::Irecv(&(connRecv[ll]), count, MPI_UNSIGNED_LONG, source, tag,
-                     MPI_COMM_WORLD, &(recv_req[iMessage]));
+                     comm, &(recv_req[iMessage]));
       iMessage++;
     }
   }
@@ -1389,7 +1414,7 @@ void CSurfaceFVMDataSorter::SortSurfaceConnectivity(CConfig *config, CGeometry *
       int dest = ii;
       int tag    = rank + 1;
       SU2_MPI::Isend(&(connSend[ll]), count, MPI_UNSIGNED_LONG, dest, tag,
-                     MPI_COMM_WORLD, &(send_req[iMessage]));
+                     comm, &(send_req[iMessage]));
       iMessage++;
     }
   }
@@ -1405,7 +1430,7 @@ void CSurfaceFVMDataSorter::SortSurfaceConnectivity(CConfig *config, CGeometry *
       int source = ii;
       int tag    = ii + 1;
       SU2_MPI::Irecv(&(haloRecv[ll]), count, MPI_UNSIGNED_SHORT, source, tag,
-                     MPI_COMM_WORLD, &(recv_req[iMessage+nRecvs]));
+                     comm, &(recv_req[iMessage+nRecvs]));
       iMessage++;
     }
   }
@@ -1421,7 +1446,7 @@ void CSurfaceFVMDataSorter::SortSurfaceConnectivity(CConfig *config, CGeometry *
       int dest   = ii;
       int tag    = rank + 1;
       SU2_MPI::Isend(&(haloSend[ll]), count, MPI_UNSIGNED_SHORT, dest, tag,
-                     MPI_COMM_WORLD, &(send_req[iMessage+nSends]));
+                     comm, &(send_req[iMessage+nSends]));
       iMessage++;
     }
   }
@@ -0,0 +1,175 @@
+/*!
+ * \file CSurfaceSamplingWriter.cpp
+ * \brief Time series writer of some fields on the points of some markers.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/output/filewriter/CSurfaceSamplingWriter.hpp"
+#include "../../../../Common/include/CConfig.hpp"
+#include "../../../../Common/include/geometry/CGeometry.hpp"
+
+const string CSurfaceSamplingWriter::fileExt = ".bin";
+
+CSurfaceSamplingWriter::CSurfaceSamplingWriter(string valFileName, CParallelDataSorter *valDataSorter,
+                                               vector<unsigned short> valFields, CGeometry *geometry, CConfig *config) :
+  CFileWriter(std::move(valFileName), fileExt), fields(std::move(valFields)) {
+
+  /*--- The unsorted data is read on the main thread, hence the communicator of the
+   *    sorter (the one of the asynchronous output) is not used. ---*/
+
+  dataSorter = valDataSorter;
+  nDim = geometry->GetnDim();
+
+  /*--- Domain points of the markers, a point shared by several markers is written once. ---*/
+
+  vector<bool> isSampled(geometry->GetnPointDomain(), false);
+
+  for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    const string markerTag = config->GetMarker_All_TagBound(iMarker);
+
+    for (unsigned short iSampling = 0; iSampling < config->GetnMarker_Surface_Sampling(); iSampling++) {
+      if (markerTag != config->GetMarker_Surface_Sampling(iSampling)) continue;
+
+      for (unsigned long iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+        const unsigned long iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        if (iPoint < geometry->GetnPointDomain()) isSampled[iPoint] = true;
+      }
+    }
+  }
+
+  for (unsigned long iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
+    if (!isSampled[iPoint]) continue;
+    points.push_back(iPoint);
+    globalIndex.push_back(geometry->node[iPoint]->GetGlobalIndex());
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      coords.push_back(SU2_TYPE::GetValue(geometry->node[iPoint]->GetCoord(iDim)));
+  }
+
+  /*--- Each rank writes its points after the ones of the lower ranks. ---*/
+
+  unsigned long nPointLocal = points.size();
+  vector<unsigned long> nPointRank(size);
+  SU2_MPI::Allgather(&nPointLocal, 1, MPI_UNSIGNED_LONG, nPointRank.data(), 1, MPI_UNSIGNED_LONG, comm);
+
+  nPointGlobal = 0;
+  pointOffset = 0;
+  for (int iRank = 0; iRank < size; iRank++) {
+    if (iRank < rank) pointOffset += nPointRank[iRank];
+    nPointGlobal += nPointRank[iRank];
+  }
+
+  if (nPointGlobal == 0) {
+    SU2_MPI::Error("No points found on the markers of MARKER_SURFACE_SAMPLING.", CURRENT_FUNCTION);
+  }
+
+}
+
+CSurfaceSamplingWriter::~CSurfaceSamplingWriter(){
+
+  if (fileOpen) CloseMPIFile();
+
+}
+
+void CSurfaceSamplingWriter::WriteHeader(){
+
+  const vector<string>& fieldNames = dataSorter->GetFieldNames();
+  const unsigned short nField = fields.size();
+
+  char str_buf[CGNS_STRING_SIZE];
+
+  OpenMPIFile();
+  fileOpen = true;
+
+  int var_buf[4] = {SU2_SURFACE_SAMPLING_ID, nDim, nField, (int)nPointGlobal};
+  WriteMPIBinaryData(var_buf, 4*sizeof(int), MASTER_NODE);
+
+  for (unsigned short iField = 0; iField < nField; iField++) {
+    strncpy(str_buf, fieldNames[fields[iField]].c_str(), CGNS_STRING_SIZE);
+    WriteMPIBinaryData(str_buf, CGNS_STRING_SIZE*sizeof(char), MASTER_NODE);
+  }
+
+  /*--- The points of each rank, at explicit offsets since many ranks may not have any point. ---*/
+
+#ifdef HAVE_MPI
+  MPI_File_write_at_all(fhw, disp + pointOffset*sizeof(unsigned long), globalIndex.data(),
+                        int(globalIndex.size()*sizeof(unsigned long)), MPI_BYTE, MPI_STATUS_IGNORE);
+  disp += nPointGlobal*sizeof(unsigned long);
+
+  MPI_File_write_at_all(fhw, disp + pointOffset*nDim*sizeof(passivedouble), coords.data(),
+                        int(coords.size()*sizeof(passivedouble)), MPI_BYTE, MPI_STATUS_IGNORE);
+  disp += nPointGlobal*nDim*sizeof(passivedouble);
+#else
+  fwrite(globalIndex.data(), sizeof(unsigned long), globalIndex.size(), fhw);
+  fwrite(coords.data(), sizeof(passivedouble), coords.size(), fhw);
+#endif
+
+  /*--- The layout of the steps does not change, the header data is no longer needed. ---*/
+
+  vector<unsigned long>().swap(globalIndex);
+  vector<passivedouble>().swap(coords);
+
+}
+
+void CSurfaceSamplingWriter::Write_Data(){
+
+  if (!fileOpen) WriteHeader();
+
+  const unsigned long nField = fields.size();
+
+  /*--- The master writes the iteration and time in front of its points. ---*/
+
+  const unsigned long nStepHeader = (rank == MASTER_NODE)? 2 : 0;
+
+  buffer.resize(nStepHeader + points.size()*nField);
+
+  if (rank == MASTER_NODE) {
+    buffer[0] = passivedouble(timeIter);
+    buffer[1] = SU2_TYPE::GetValue(time);
+  }
+
+  for (unsigned long iPoint = 0; iPoint < points.size(); iPoint++) {
+    passivedouble* values = &buffer[nStepHeader + iPoint*nField];
+    for (unsigned long iField = 0; iField < nField; iField++)
+      values[iField] = SU2_TYPE::GetValue(dataSorter->GetUnsorted_Data(points[iPoint], fields[iField]));
+  }
+
+  const unsigned long offsetInBytes = (rank == MASTER_NODE)? 0 : (2 + pointOffset*nField)*sizeof(passivedouble);
+  const unsigned long stepSizeInBytes = (2 + nPointGlobal*nField)*sizeof(passivedouble);
+
+#ifdef HAVE_MPI
+  int ierr = MPI_File_write_at_all(fhw, disp + offsetInBytes, buffer.data(), int(buffer.size()*sizeof(passivedouble)),
+                                   MPI_BYTE, MPI_STATUS_IGNORE);
+  disp += stepSizeInBytes;
+#else
+  int ierr = (fwrite(buffer.data(), sizeof(passivedouble), buffer.size(), fhw) == buffer.size())? 0 : 1;
+#endif
+
+  if (ierr != 0) {
+    SU2_MPI::Error(string("Unable to write to file ") + fileName, CURRENT_FUNCTION);
+  }
+
+  fileSize += buffer.size()*sizeof(passivedouble);
+  nStep++;
+
+}
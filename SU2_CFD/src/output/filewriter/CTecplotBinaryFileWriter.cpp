@@ -29,7 +29,7 @@
 #ifdef HAVE_TECIO
   #include "TECIO.h"
 #endif
-#include <set>
+#include <algorithm>
 
 const string CTecplotBinaryFileWriter::fileExt = ".szplt";
 
@@ -89,7 +89,7 @@ void CTecplotBinaryFileWriter::Write_Data(){
   if (err) cout << "Error opening Tecplot file '" << fileName << "'" << endl;
 
 #ifdef HAVE_MPI
-  err = tecMPIInitialize(file_handle, MPI_COMM_WORLD, MASTER_NODE);
+  err = tecMPIInitialize(file_handle, comm, MASTER_NODE);
   if (err) cout << "Error initializing Tecplot parallel output." << endl;
 #endif
 
@@ -141,7 +141,6 @@ void CTecplotBinaryFileWriter::Write_Data(){
 
   unsigned short iVar;
   NodePartitioner node_partitioner(num_nodes, size);
-  std::set<unsigned long> halo_nodes;
   vector<unsigned long> sorted_halo_nodes;
   vector<passivedouble> halo_var_data;
   vector<int> num_nodes_to_receive(size, 0);
@@ -157,43 +156,24 @@ void CTecplotBinaryFileWriter::Write_Data(){
     err = tecZoneMapPartitionsToMPIRanks(file_handle, zone, size, &partition_owners[0]);
     if (err) cout << rank << ": Error assigning MPI ranks for Tecplot zone partitions." << endl;
 
-    /* Gather a list of nodes we refer to but are not outputting. */
+    /* Gather a sorted list of nodes we refer to but are not outputting. */
 
-    for (unsigned long i = 0; i < nParallel_Tria * N_POINTS_TRIANGLE; ++i)
-      if ((unsigned long)dataSorter->GetElem_Connectivity(TRIANGLE, 0, i) <= dataSorter->GetNodeBegin(rank) ||
-          dataSorter->GetNodeEnd(rank) < (unsigned long)dataSorter->GetElem_Connectivity(TRIANGLE, 0, i))
-        halo_nodes.insert(dataSorter->GetElem_Connectivity(TRIANGLE, 0, i));
+    const pair<GEO_TYPE, unsigned short> volume_types[] = {
+      {TRIANGLE, N_POINTS_TRIANGLE}, {QUADRILATERAL, N_POINTS_QUADRILATERAL}, {TETRAHEDRON, N_POINTS_TETRAHEDRON},
+      {HEXAHEDRON, N_POINTS_HEXAHEDRON}, {PRISM, N_POINTS_PRISM}, {PYRAMID, N_POINTS_PYRAMID}};
 
-    for (unsigned long i = 0; i < nParallel_Quad * N_POINTS_QUADRILATERAL; ++i)
-      if ((unsigned long)dataSorter->GetElem_Connectivity(QUADRILATERAL, 0, i) <= dataSorter->GetNodeBegin(rank) ||
-          dataSorter->GetNodeEnd(rank) < (unsigned long)dataSorter->GetElem_Connectivity(QUADRILATERAL, 0, i))
-        halo_nodes.insert(dataSorter->GetElem_Connectivity(QUADRILATERAL, 0, i));
-
-    for (unsigned long i = 0; i < nParallel_Tetr * N_POINTS_TETRAHEDRON; ++i)
-      if ((unsigned long)dataSorter->GetElem_Connectivity(TETRAHEDRON, 0, i) <= dataSorter->GetNodeBegin(rank) ||
-          dataSorter->GetNodeEnd(rank) < (unsigned long)dataSorter->GetElem_Connectivity(TETRAHEDRON, 0, i))
-        halo_nodes.insert(dataSorter->GetElem_Connectivity(TETRAHEDRON, 0, i));
-
-    for (unsigned long i = 0; i < nParallel_Hexa * N_POINTS_HEXAHEDRON; ++i)
-      if ((unsigned long)dataSorter->GetElem_Connectivity(HEXAHEDRON, 0, i) <= dataSorter->GetNodeBegin(rank) ||
-          dataSorter->GetNodeEnd(rank) < (unsigned long)dataSorter->GetElem_Connectivity(HEXAHEDRON, 0, i))
-        halo_nodes.insert(dataSorter->GetElem_Connectivity(HEXAHEDRON, 0, i));
-
-    for (unsigned long i = 0; i < nParallel_Pris * N_POINTS_PRISM; ++i)
-      if ((unsigned long)dataSorter->GetElem_Connectivity(PRISM, 0, i) <= dataSorter->GetNodeBegin(rank) ||
-          dataSorter->GetNodeEnd(rank) < (unsigned long)dataSorter->GetElem_Connectivity(PRISM, 0, i))
-        halo_nodes.insert(dataSorter->GetElem_Connectivity(PRISM, 0, i));
-
-    for (unsigned long i = 0; i < nParallel_Pyra * N_POINTS_PYRAMID; ++i)
-      if ((unsigned long)dataSorter->GetElem_Connectivity(PYRAMID, 0, i) <= dataSorter->GetNodeBegin(rank) ||
-          dataSorter->GetNodeEnd(rank) < (unsigned long)dataSorter->GetElem_Connectivity(PYRAMID, 0, i))
-        halo_nodes.insert(dataSorter->GetElem_Connectivity(PYRAMID, 0, i));
-
-    /* Sorted list of halo nodes for this MPI rank. */
-    sorted_halo_nodes.assign(halo_nodes.begin(), halo_nodes.end());
+    for (const auto& type : volume_types) {
+      for (unsigned long i = 0; i < dataSorter->GetnElem(type.first) * type.second; ++i) {
+        const auto node = (unsigned long)dataSorter->GetElem_Connectivity(type.first, 0, i);
+        if (node <= dataSorter->GetNodeBegin(rank) || dataSorter->GetNodeEnd(rank) < node)
+          sorted_halo_nodes.push_back(node);
+      }
+    }
+    sort(sorted_halo_nodes.begin(), sorted_halo_nodes.end());
+    sorted_halo_nodes.erase(unique(sorted_halo_nodes.begin(), sorted_halo_nodes.end()), sorted_halo_nodes.end());
 
     /* Have to include all nodes our cells refer to or TecIO will barf, so add the halo node count to the number of local nodes. */
-    int64_t partition_num_nodes = dataSorter->GetNodeEnd(rank) - dataSorter->GetNodeBegin(rank) + static_cast<int64_t>(halo_nodes.size());
+    int64_t partition_num_nodes = dataSorter->GetNodeEnd(rank) - dataSorter->GetNodeBegin(rank) + static_cast<int64_t>(sorted_halo_nodes.size());
     int64_t partition_num_cells = nParallel_Tetr + nParallel_Hexa + nParallel_Pris + nParallel_Pyra;
 
     /*--- We effectively tack the halo nodes onto the end of the node list for this partition.
@@ -218,7 +198,7 @@ void CTecplotBinaryFileWriter::Write_Data(){
     for (size_t i = 0; i < num_halo_nodes; ++i)
       ++num_nodes_to_receive[neighbor_partitions[i] - 1];
     vector<int> num_nodes_to_send(size);
-    SU2_MPI::Alltoall(&num_nodes_to_receive[0], 1, MPI_INT, &num_nodes_to_send[0], 1, MPI_INT, MPI_COMM_WORLD);
+    SU2_MPI::Alltoall(&num_nodes_to_receive[0], 1, MPI_INT, &num_nodes_to_send[0], 1, MPI_INT, comm);
 
     /* Now send the global node numbers whose data we need,
        and receive the same from all other ranks.
@@ -241,7 +221,7 @@ void CTecplotBinaryFileWriter::Write_Data(){
     if (sorted_halo_nodes.empty()) sorted_halo_nodes.resize(1); /* Avoid crash. */
     SU2_MPI::Alltoallv(&sorted_halo_nodes[0], &num_nodes_to_receive[0], &nodes_to_receive_displacements[0], MPI_UNSIGNED_LONG,
                        &nodes_to_send[0],     &num_nodes_to_send[0],    &nodes_to_send_displacements[0],    MPI_UNSIGNED_LONG,
-                       MPI_COMM_WORLD);
+                       comm);
 
     /* Now actually send and receive the data */
     vector<passivedouble> data_to_send(max(1, total_num_nodes_to_send * (int)fieldNames.size()));
@@ -264,7 +244,7 @@ void CTecplotBinaryFileWriter::Write_Data(){
     }
     CBaseMPIWrapper::Alltoallv(&data_to_send[0],  &num_values_to_send[0],    &values_to_send_displacements[0],    MPI_DOUBLE,
                        &halo_var_data[0], &num_values_to_receive[0], &values_to_receive_displacements[0], MPI_DOUBLE,
-                       MPI_COMM_WORLD);
+                       comm);
   }
   else {
     /* Zone will be gathered to and output by MASTER_NODE */
@@ -294,7 +274,7 @@ void CTecplotBinaryFileWriter::Write_Data(){
       vector<passivedouble> var_data;
       unsigned long nPoint = dataSorter->GetnPoints();
       vector<unsigned long> num_points(size);
-      SU2_MPI::Gather(&nPoint, 1, MPI_UNSIGNED_LONG, &num_points[0], 1, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+      SU2_MPI::Gather(&nPoint, 1, MPI_UNSIGNED_LONG, &num_points[0], 1, MPI_UNSIGNED_LONG, MASTER_NODE, comm);
 
       for(int iRank = 0; iRank < size; ++iRank) {
         int64_t rank_num_points = num_points[iRank];
@@ -312,7 +292,7 @@ void CTecplotBinaryFileWriter::Write_Data(){
           }
           else { /* Receive data from other rank. */
             var_data.resize(max((int64_t)1, (int64_t)fieldNames.size() * rank_num_points));
-            CBaseMPIWrapper::Recv(&var_data[0], fieldNames.size() * rank_num_points, MPI_DOUBLE, iRank, iRank, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            CBaseMPIWrapper::Recv(&var_data[0], fieldNames.size() * rank_num_points, MPI_DOUBLE, iRank, iRank, comm, MPI_STATUS_IGNORE);
             for (iVar = 0; err == 0 && iVar < fieldNames.size(); iVar++) {
               err = tecZoneVarWriteDoubleValues(file_handle, zone, iVar + 1, 0, rank_num_points, &var_data[iVar * rank_num_points]);
               if (err) cout << rank << ": Error outputting Tecplot surface variable values." << endl;
@@ -324,7 +304,7 @@ void CTecplotBinaryFileWriter::Write_Data(){
     else { /* Send data to MASTER_NODE */
       unsigned long nPoint = dataSorter->GetnPoints();
 
-      SU2_MPI::Gather(&nPoint, 1, MPI_UNSIGNED_LONG, NULL, 1, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+      SU2_MPI::Gather(&nPoint, 1, MPI_UNSIGNED_LONG, NULL, 1, MPI_UNSIGNED_LONG, MASTER_NODE, comm);
 
       vector<passivedouble> var_data;
       size_t var_data_size = fieldNames.size() * dataSorter->GetnPoints();
@@ -334,7 +314,7 @@ void CTecplotBinaryFileWriter::Write_Data(){
             var_data.push_back(dataSorter->GetData(iVar,i));
 
       if (var_data.size() > 0)
-        CBaseMPIWrapper::Send(&var_data[0], static_cast<int>(var_data.size()), MPI_DOUBLE, MASTER_NODE, rank, MPI_COMM_WORLD);
+        CBaseMPIWrapper::Send(&var_data[0], static_cast<int>(var_data.size()), MPI_DOUBLE, MASTER_NODE, rank, comm);
     }
   }
 
@@ -357,14 +337,34 @@ void CTecplotBinaryFileWriter::Write_Data(){
 
 #endif /* HAVE_MPI */
 
-  /*--- Write connectivity data. ---*/
+  /*--- Write connectivity data. The node map is buffered and written in large
+   pieces, rather than cell by cell, each piece must belong to one partition. ---*/
 
   unsigned long iElem;
 
+  const size_t node_map_chunk = 1 << 19;
+  vector<int64_t> node_map;
+  node_map.reserve(node_map_chunk + 8);
+  int32_t node_map_partition = 0;
+
+  auto flush_node_map = [&]() {
+    if (err == 0 && !node_map.empty()) {
+      err = tecZoneNodeMapWrite64(file_handle, zone, node_map_partition, 1, node_map.size(), node_map.data());
+      if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
+    }
+    node_map.clear();
+  };
+
+  auto append_cell = [&](const int64_t* nodes, int num_nodes) {
+    node_map.insert(node_map.end(), nodes, nodes + num_nodes);
+    if (node_map.size() >= node_map_chunk) flush_node_map();
+  };
+
 #ifdef HAVE_MPI
   if (zone_type == ZONETYPE_FEBRICK) {
 
     int64_t nodes[8];
+    node_map_partition = rank + 1;
 
     /**
      *  Each rank writes node numbers relative to the partition it is outputting (starting with node number 1).
@@ -384,8 +384,7 @@ void CTecplotBinaryFileWriter::Write_Data(){
       nodes[5] = nodes[4];
       nodes[6] = nodes[4];
       nodes[7] = nodes[4];
-      err = tecZoneNodeMapWrite64(file_handle, zone, rank + 1, 1, 8, nodes);
-      if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
+      append_cell(nodes, 8);
     }
 
     for (iElem = 0; err == 0 && iElem < nParallel_Hexa; iElem++) {
@@ -397,8 +396,7 @@ void CTecplotBinaryFileWriter::Write_Data(){
       nodes[5] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 5));
       nodes[6] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 6));
       nodes[7] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 7));
-      err = tecZoneNodeMapWrite64(file_handle, zone, rank + 1, 1, 8, nodes);
-      if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
+      append_cell(nodes, 8);
     }
 
     for (iElem = 0; err == 0 && iElem < nParallel_Pris; iElem++) {
@@ -410,8 +408,7 @@ void CTecplotBinaryFileWriter::Write_Data(){
       nodes[5] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(PRISM, iElem, 4));
       nodes[6] = nodes[5];
       nodes[7] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(PRISM, iElem, 5));
-      err = tecZoneNodeMapWrite64(file_handle, zone, rank + 1, 1, 8, nodes);
-      if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
+      append_cell(nodes, 8);
     }
 
     for (iElem = 0; err == 0 && iElem < nParallel_Pyra; iElem++) {
@@ -423,9 +420,9 @@ void CTecplotBinaryFileWriter::Write_Data(){
       nodes[5] = nodes[4];
       nodes[6] = nodes[4];
       nodes[7] = nodes[4];
-      err = tecZoneNodeMapWrite64(file_handle, zone, rank + 1, 1, 8, nodes);
-      if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
+      append_cell(nodes, 8);
     }
+    flush_node_map();
   } else {
     if (rank == MASTER_NODE) {
 
@@ -435,15 +432,14 @@ void CTecplotBinaryFileWriter::Write_Data(){
 
       vector<unsigned long> connectivity_sizes(size);
       unsigned long unused = 0;
-      SU2_MPI::Gather(&unused, 1, MPI_UNSIGNED_LONG, &connectivity_sizes[0], 1, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+      SU2_MPI::Gather(&unused, 1, MPI_UNSIGNED_LONG, &connectivity_sizes[0], 1, MPI_UNSIGNED_LONG, MASTER_NODE, comm);
       vector<int64_t> connectivity;
       for(int iRank = 0; iRank < size; ++iRank) {
         if (iRank == rank) {
           for (iElem = 0; err == 0 && iElem < nParallel_Line; iElem++) {
             nodes[0] = dataSorter->GetElem_Connectivity(LINE, iElem, 0);
             nodes[1] = dataSorter->GetElem_Connectivity(LINE, iElem, 1);
-            err = tecZoneNodeMapWrite64(file_handle, zone, 0, 1, 2, nodes);
-            if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
+            append_cell(nodes, 2);
           }
 
           for (iElem = 0; err == 0 && iElem < nParallel_Tria; iElem++) {
@@ -451,8 +447,7 @@ void CTecplotBinaryFileWriter::Write_Data(){
             nodes[1] = dataSorter->GetElem_Connectivity(TRIANGLE, iElem, 1);
             nodes[2] = dataSorter->GetElem_Connectivity(TRIANGLE, iElem, 2);
             nodes[3] = dataSorter->GetElem_Connectivity(TRIANGLE, iElem, 2);
-            err = tecZoneNodeMapWrite64(file_handle, zone, 0, 1, 4, nodes);
-            if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
+            append_cell(nodes, 4);
           }
 
           for (iElem = 0; err == 0 && iElem < nParallel_Quad; iElem++) {
@@ -460,13 +455,13 @@ void CTecplotBinaryFileWriter::Write_Data(){
             nodes[1] = dataSorter->GetElem_Connectivity(QUADRILATERAL, iElem, 1);
             nodes[2] = dataSorter->GetElem_Connectivity(QUADRILATERAL, iElem, 2);
             nodes[3] = dataSorter->GetElem_Connectivity(QUADRILATERAL, iElem, 3);
-            err = tecZoneNodeMapWrite64(file_handle, zone, 0, 1, 4, nodes);
-            if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
+            append_cell(nodes, 4);
           }
+          flush_node_map();
 
         } else { /* Receive node map and write out. */
           connectivity.resize(max((unsigned long)1, connectivity_sizes[iRank]));
-          SU2_MPI::Recv(&connectivity[0], connectivity_sizes[iRank], MPI_UNSIGNED_LONG, iRank, iRank, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+          SU2_MPI::Recv(&connectivity[0], connectivity_sizes[iRank], MPI_UNSIGNED_LONG, iRank, iRank, comm, MPI_STATUS_IGNORE);
           err = tecZoneNodeMapWrite64(file_handle, zone, 0, 1, connectivity_sizes[iRank], &connectivity[0]);
           if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
         }
@@ -477,12 +472,12 @@ void CTecplotBinaryFileWriter::Write_Data(){
 
       unsigned long connectivity_size;
       connectivity_size = 2 * nParallel_Line + 4 * (nParallel_Tria + nParallel_Quad);
-      SU2_MPI::Gather(&connectivity_size, 1, MPI_UNSIGNED_LONG, NULL, 1, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+      SU2_MPI::Gather(&connectivity_size, 1, MPI_UNSIGNED_LONG, NULL, 1, MPI_UNSIGNED_LONG, MASTER_NODE, comm);
       vector<int64_t> connectivity;
       connectivity.reserve(connectivity_size);
       for (iElem = 0; err == 0 && iElem < nParallel_Line; iElem++) {
         connectivity.push_back(dataSorter->GetElem_Connectivity(LINE, iElem, 0));
-        connectivity.push_back(dataSorter->GetElem_Connectivity(LINE, iElem, 0));
+        connectivity.push_back(dataSorter->GetElem_Connectivity(LINE, iElem, 1));
       }
 
       for (iElem = 0; err == 0 && iElem < nParallel_Tria; iElem++) {
@@ -500,20 +495,26 @@ void CTecplotBinaryFileWriter::Write_Data(){
       }
 
       if (connectivity.empty()) connectivity.resize(1); /* Avoid crash */
-      SU2_MPI::Send(&connectivity[0], connectivity_size, MPI_UNSIGNED_LONG, MASTER_NODE, rank, MPI_COMM_WORLD);
+      SU2_MPI::Send(&connectivity[0], connectivity_size, MPI_UNSIGNED_LONG, MASTER_NODE, rank, comm);
     }
   }
 #else
 
   int64_t nodes[8];
+  node_map_partition = rank;
+
+  for (iElem = 0; err == 0 && iElem < nParallel_Line; iElem++) {
+    nodes[0] = dataSorter->GetElem_Connectivity(LINE, iElem, 0);
+    nodes[1] = dataSorter->GetElem_Connectivity(LINE, iElem, 1);
+    append_cell(nodes, 2);
+  }
 
   for (iElem = 0; err == 0 && iElem < nParallel_Tria; iElem++) {
     nodes[0] = dataSorter->GetElem_Connectivity(TRIANGLE, iElem, 0);
     nodes[1] = dataSorter->GetElem_Connectivity(TRIANGLE, iElem, 1);
     nodes[2] = dataSorter->GetElem_Connectivity(TRIANGLE, iElem, 2);
     nodes[3] = dataSorter->GetElem_Connectivity(TRIANGLE, iElem, 2);
-    err = tecZoneNodeMapWrite64(file_handle, zone, rank, 1, 4, nodes);
-    if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
+    append_cell(nodes, 4);
   }
 
   for (iElem = 0; err == 0 && iElem < nParallel_Quad; iElem++) {
@@ -521,8 +522,7 @@ void CTecplotBinaryFileWriter::Write_Data(){
     nodes[1] = dataSorter->GetElem_Connectivity(QUADRILATERAL, iElem, 1);
     nodes[2] = dataSorter->GetElem_Connectivity(QUADRILATERAL, iElem, 2);
     nodes[3] = dataSorter->GetElem_Connectivity(QUADRILATERAL, iElem, 3);
-    err = tecZoneNodeMapWrite64(file_handle, zone, rank, 1, 4, nodes);
-    if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
+    append_cell(nodes, 4);
   }
 
   for (iElem = 0; err == 0 && iElem < nParallel_Tetr; iElem++) {
@@ -534,8 +534,7 @@ void CTecplotBinaryFileWriter::Write_Data(){
     nodes[5] = dataSorter->GetElem_Connectivity(TETRAHEDRON, iElem, 3);
     nodes[6] = dataSorter->GetElem_Connectivity(TETRAHEDRON, iElem, 3);
     nodes[7] = dataSorter->GetElem_Connectivity(TETRAHEDRON, iElem, 3);
-    err = tecZoneNodeMapWrite64(file_handle, zone, rank, 1, 8, nodes);
-    if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
+    append_cell(nodes, 8);
   }
 
   for (iElem = 0; err == 0 && iElem < nParallel_Hexa; iElem++) {
@@ -547,8 +546,7 @@ void CTecplotBinaryFileWriter::Write_Data(){
     nodes[5] = dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 5);
     nodes[6] = dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 6);
     nodes[7] = dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 7);
-    err = tecZoneNodeMapWrite64(file_handle, zone, rank, 1, 8, nodes);
-    if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
+    append_cell(nodes, 8);
   }
 
   for (iElem = 0; err == 0 && iElem < nParallel_Pris; iElem++) {
@@ -560,8 +558,7 @@ void CTecplotBinaryFileWriter::Write_Data(){
     nodes[5] = dataSorter->GetElem_Connectivity(PRISM, iElem, 4);
     nodes[6] = dataSorter->GetElem_Connectivity(PRISM, iElem, 4);
     nodes[7] = dataSorter->GetElem_Connectivity(PRISM, iElem, 5);
-    err = tecZoneNodeMapWrite64(file_handle, zone, rank, 1, 8, nodes);
-    if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
+    append_cell(nodes, 8);
   }
 
   for (iElem = 0; err == 0 && iElem < nParallel_Pyra; iElem++) {
@@ -573,11 +570,9 @@ void CTecplotBinaryFileWriter::Write_Data(){
     nodes[5] = dataSorter->GetElem_Connectivity(PYRAMID, iElem, 4);
     nodes[6] = dataSorter->GetElem_Connectivity(PYRAMID, iElem, 4);
     nodes[7] = dataSorter->GetElem_Connectivity(PYRAMID, iElem, 4);
-    err = tecZoneNodeMapWrite64(file_handle, zone, rank, 1, 8, nodes);
-    if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
+    append_cell(nodes, 8);
   }
-
-
+  flush_node_map();
 
 #endif
 
@@ -122,7 +122,7 @@ void CTecplotFileWriter::Write_Data(){
   }
 
 #ifdef HAVE_MPI
-  SU2_MPI::Barrier(MPI_COMM_WORLD);
+  SU2_MPI::Barrier(comm);
 #endif
 
   /*--- Each processor opens the file. ---*/
@@ -146,7 +146,7 @@ void CTecplotFileWriter::Write_Data(){
 
     Tecplot_File.flush();
 #ifdef HAVE_MPI
-    SU2_MPI::Barrier(MPI_COMM_WORLD);
+    SU2_MPI::Barrier(comm);
 #endif
   }
 
@@ -208,7 +208,7 @@ void CTecplotFileWriter::Write_Data(){
     }
     Tecplot_File.flush();
 #ifdef HAVE_MPI
-    SU2_MPI::Barrier(MPI_COMM_WORLD);
+    SU2_MPI::Barrier(comm);
 #endif
   }
 
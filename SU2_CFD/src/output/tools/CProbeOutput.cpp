@@ -0,0 +1,315 @@
+/*!
+ * \file CProbeOutput.cpp
+ * \brief Output of the volume fields at probes and in boxes.
+ * \author SU2 Contributors
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/output/tools/CProbeOutput.hpp"
+#include "../../../include/output/filewriter/CParallelDataSorter.hpp"
+#include "../../../../Common/include/CConfig.hpp"
+#include "../../../../Common/include/geometry/CGeometry.hpp"
+#include "../../../../Common/include/adt_structure.hpp"
+
+#include <iomanip>
+#include <sstream>
+#include <limits>
+
+/*--- Maximum number of nodes of an element (hexahedron). ---*/
+static const unsigned short MAX_ELEM_NODES = 8;
+
+CProbeOutput::CProbeOutput(CConfig *config, CGeometry *geometry) {
+
+  rank = SU2_MPI::GetRank();
+  size = SU2_MPI::GetSize();
+
+  fileName = config->GetMultizone_FileName(config->GetOutput_Probe_FileName(), config->GetiZone(), "");
+  nDim = geometry->GetnDim();
+  timeDomain = config->GetTime_Domain();
+  nProbe = 0;
+
+  /*--- Coordinates of the single probes, followed by the samples of the planes. ---*/
+
+  vector<su2double> coord;
+
+  for (unsigned short iProbe = 0; iProbe < config->GetnOutput_Probes(); iProbe++) {
+    const su2double* probe = config->GetOutput_Probe(iProbe);
+    coord.insert(coord.end(), probe, probe+nDim);
+  }
+
+  for (unsigned short iPlane = 0; iPlane < config->GetnOutput_Probe_Planes(); iPlane++) {
+    const su2double* plane = config->GetOutput_Probe_Plane(iPlane);
+    const unsigned long nU = SU2_TYPE::Int(plane[9]), nV = SU2_TYPE::Int(plane[10]);
+
+    for (unsigned long iV = 0; iV < nV; iV++) {
+      const su2double fV = (nV > 1)? su2double(iV)/su2double(nV-1) : su2double(0.0);
+      for (unsigned long iU = 0; iU < nU; iU++) {
+        const su2double fU = (nU > 1)? su2double(iU)/su2double(nU-1) : su2double(0.0);
+        for (unsigned short iDim = 0; iDim < nDim; iDim++)
+          coord.push_back(plane[iDim] + fU*plane[3+iDim] + fV*plane[6+iDim]);
+      }
+    }
+  }
+
+  LocateProbes(geometry, coord);
+
+  /*--- The boxes keep the local domain points inside them. ---*/
+
+  for (unsigned short iBox = 0; iBox < config->GetnOutput_Probe_Boxes(); iBox++) {
+    const su2double* box = config->GetOutput_Probe_Box(iBox);
+    vector<unsigned long> points;
+
+    for (unsigned long iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
+      const su2double* pointCoord = geometry->node[iPoint]->GetCoord();
+      bool inside = true;
+      for (unsigned short iDim = 0; iDim < nDim; iDim++)
+        inside = inside && (pointCoord[iDim] >= box[iDim]) && (pointCoord[iDim] <= box[3+iDim]);
+      if (inside) points.push_back(iPoint);
+    }
+    boxPoints.push_back(points);
+  }
+
+}
+
+void CProbeOutput::LocateProbes(CGeometry *geometry, const vector<su2double>& coord) {
+
+  const unsigned long nProbeTotal = coord.size()/nDim;
+  if (nProbeTotal == 0) return;
+
+  const unsigned long noElem = numeric_limits<unsigned long>::max();
+
+  /*--- Each rank searches the probes in a local ADT of its elements. ---*/
+
+  vector<unsigned long> myElem(nProbeTotal, noElem), elem(nProbeTotal);
+  vector<unsigned long> myNodes(nProbeTotal*MAX_ELEM_NODES, 0), nodes(nProbeTotal*MAX_ELEM_NODES);
+  vector<passivedouble> myWeights(nProbeTotal*MAX_ELEM_NODES, 0.0), weights(nProbeTotal*MAX_ELEM_NODES);
+
+  if (geometry->GetnElem() > 0) {
+
+    vector<su2double> elemCoord;
+    elemCoord.reserve(nDim*geometry->GetnPoint());
+    for (unsigned long iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++)
+      for (unsigned short iDim = 0; iDim < nDim; iDim++)
+        elemCoord.push_back(geometry->node[iPoint]->GetCoord(iDim));
+
+    vector<unsigned long> elemConn, elemID;
+    vector<unsigned short> elemVTK, elemMarker;
+    for (unsigned long iElem = 0; iElem < geometry->GetnElem(); iElem++) {
+      elemVTK.push_back(geometry->elem[iElem]->GetVTK_Type());
+      elemMarker.push_back(0);
+      elemID.push_back(iElem);
+      for (unsigned short iNode = 0; iNode < geometry->elem[iElem]->GetnNodes(); iNode++)
+        elemConn.push_back(geometry->elem[iElem]->GetNode(iNode));
+    }
+
+    CADTElemClass localADT(nDim, elemCoord, elemConn, elemVTK, elemMarker, elemID, false);
+
+    for (unsigned long iProbe = 0; iProbe < nProbeTotal; iProbe++) {
+
+      unsigned short markerID;
+      unsigned long iElem;
+      int rankID;
+      su2double parCoord[3], weightsInterpol[MAX_ELEM_NODES];
+
+      if (!localADT.DetermineContainingElement(&coord[iProbe*nDim], markerID, iElem, rankID,
+                                               parCoord, weightsInterpol)) continue;
+
+      myElem[iProbe] = geometry->elem[iElem]->GetGlobalIndex();
+
+      /*--- Global indices are shifted by one, 0 marks the unused nodes. ---*/
+
+      for (unsigned short iNode = 0; iNode < geometry->elem[iElem]->GetnNodes(); iNode++) {
+        const unsigned long iPoint = geometry->elem[iElem]->GetNode(iNode);
+        myNodes[iProbe*MAX_ELEM_NODES+iNode] = geometry->node[iPoint]->GetGlobalIndex()+1;
+        myWeights[iProbe*MAX_ELEM_NODES+iNode] = SU2_TYPE::GetValue(weightsInterpol[iNode]);
+      }
+    }
+  }
+
+  /*--- A probe on the interface of elements (or partitions) is found more than once, the element
+   *    with the lowest global index is used, reported by the lowest rank that found it. ---*/
+
+  SU2_MPI::Allreduce(myElem.data(), elem.data(), nProbeTotal, MPI_UNSIGNED_LONG, MPI_MIN, MPI_COMM_WORLD);
+
+  vector<int> myOwner(nProbeTotal), owner(nProbeTotal);
+  for (unsigned long iProbe = 0; iProbe < nProbeTotal; iProbe++)
+    myOwner[iProbe] = ((elem[iProbe] != noElem) && (myElem[iProbe] == elem[iProbe]))? rank : size;
+
+  SU2_MPI::Allreduce(myOwner.data(), owner.data(), nProbeTotal, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+
+  for (unsigned long iProbe = 0; iProbe < nProbeTotal; iProbe++) {
+    if (owner[iProbe] == rank) continue;
+    for (unsigned short iNode = 0; iNode < MAX_ELEM_NODES; iNode++) {
+      myNodes[iProbe*MAX_ELEM_NODES+iNode] = 0;
+      myWeights[iProbe*MAX_ELEM_NODES+iNode] = 0.0;
+    }
+  }
+
+  SU2_MPI::Allreduce(myNodes.data(), nodes.data(), nodes.size(), MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+#ifdef HAVE_MPI
+  SelectMPIWrapper<passivedouble>::W::Allreduce(myWeights.data(), weights.data(), weights.size(),
+                                                MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#else
+  weights = myWeights;
+#endif
+
+  /*--- Every rank interpolates from the nodes of the elements that are its domain points. ---*/
+
+  const auto& globalToLocal = geometry->GetGlobal_to_Local_Map();
+
+  for (unsigned long iProbe = 0; iProbe < nProbeTotal; iProbe++) {
+    if (elem[iProbe] == noElem) continue;
+
+    for (unsigned short iNode = 0; iNode < MAX_ELEM_NODES; iNode++) {
+      const unsigned long globalPoint = nodes[iProbe*MAX_ELEM_NODES+iNode];
+      if (globalPoint == 0) continue;
+
+      const auto it = globalToLocal.find(globalPoint-1);
+      if ((it == globalToLocal.end()) || (it->second >= geometry->GetnPointDomain())) continue;
+
+      probeNode.push_back(nProbe);
+      probePoint.push_back(it->second);
+      probeWeight.push_back(weights[iProbe*MAX_ELEM_NODES+iNode]);
+    }
+
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      probeCoord.push_back(SU2_TYPE::GetValue(coord[iProbe*nDim+iDim]));
+    nProbe++;
+  }
+
+  if ((rank == MASTER_NODE) && (nProbe < nProbeTotal)) {
+    cout << "WARNING: " << nProbeTotal-nProbe << " of the " << nProbeTotal
+         << " output probes are outside of the grid, they are ignored." << endl;
+  }
+
+}
+
+void CProbeOutput::Write(const CParallelDataSorter* dataSorter, unsigned long iter, su2double time) {
+
+  if (nProbe > 0) WriteProbes(dataSorter, iter, time);
+
+  if (!boxPoints.empty()) WriteBoxes(dataSorter, iter);
+
+}
+
+void CProbeOutput::WriteProbes(const CParallelDataSorter* dataSorter, unsigned long iter, su2double time) {
+
+  const vector<string>& fieldNames = dataSorter->GetFieldNames();
+  const unsigned long nField = fieldNames.size();
+
+  /*--- Partial values of the probes from the local nodes, summed on the master. ---*/
+
+  sendBuffer.assign(nProbe*nField, 0.0);
+  recvBuffer.resize(nProbe*nField);
+
+  for (unsigned long iNode = 0; iNode < probeNode.size(); iNode++) {
+    passivedouble* values = &sendBuffer[probeNode[iNode]*nField];
+    for (unsigned long iField = 0; iField < nField; iField++)
+      values[iField] += probeWeight[iNode]*SU2_TYPE::GetValue(dataSorter->GetUnsorted_Data(probePoint[iNode], iField));
+  }
+
+#ifdef HAVE_MPI
+  SelectMPIWrapper<passivedouble>::W::Reduce(sendBuffer.data(), recvBuffer.data(), sendBuffer.size(),
+                                             MPI_DOUBLE, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
+#else
+  recvBuffer = sendBuffer;
+#endif
+
+  if (rank != MASTER_NODE) return;
+
+  /*--- The first write opens the file, writes the header and the locations of the probes. ---*/
+
+  if (!probeFile.is_open()) {
+
+    ofstream locationFile((fileName+"_locations.csv").c_str());
+    locationFile << "\"Probe\",\"x\",\"y\"" << (nDim == 3? ",\"z\"" : "") << "\n";
+    locationFile << scientific << setprecision(10);
+    for (unsigned long iProbe = 0; iProbe < nProbe; iProbe++) {
+      locationFile << iProbe;
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) locationFile << "," << probeCoord[iProbe*nDim+iDim];
+      locationFile << "\n";
+    }
+
+    probeFile.open((fileName+".csv").c_str());
+    probeFile << "\"Iteration\"" << (timeDomain? ",\"Time\"" : "");
+    for (unsigned long iProbe = 0; iProbe < nProbe; iProbe++)
+      for (unsigned long iField = 0; iField < nField; iField++)
+        probeFile << ",\"" << fieldNames[iField] << "@" << iProbe << "\"";
+    probeFile << "\n" << scientific << setprecision(10);
+  }
+
+  probeFile << iter;
+  if (timeDomain) probeFile << "," << SU2_TYPE::GetValue(time);
+  for (unsigned long iValue = 0; iValue < recvBuffer.size(); iValue++)
+    probeFile << "," << recvBuffer[iValue];
+  probeFile << "\n";
+
+}
+
+void CProbeOutput::WriteBoxes(const CParallelDataSorter* dataSorter, unsigned long iter) {
+
+  const vector<string>& fieldNames = dataSorter->GetFieldNames();
+  const unsigned long nField = fieldNames.size();
+
+  for (unsigned long iBox = 0; iBox < boxPoints.size(); iBox++) {
+
+    /*--- The values of the points of the box are gathered on the master. ---*/
+
+    const vector<unsigned long>& points = boxPoints[iBox];
+
+    sendBuffer.resize(points.size()*nField);
+    for (unsigned long iPoint = 0; iPoint < points.size(); iPoint++)
+      for (unsigned long iField = 0; iField < nField; iField++)
+        sendBuffer[iPoint*nField+iField] = SU2_TYPE::GetValue(dataSorter->GetUnsorted_Data(points[iPoint], iField));
+
+    int myCount = sendBuffer.size();
+    vector<int> counts(size), displs(size, 0);
+    SU2_MPI::Gather(&myCount, 1, MPI_INT, counts.data(), 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+
+    if (rank == MASTER_NODE) {
+      for (int iRank = 1; iRank < size; iRank++) displs[iRank] = displs[iRank-1]+counts[iRank-1];
+      recvBuffer.resize(displs[size-1]+counts[size-1]);
+    }
+
+#ifdef HAVE_MPI
+    MPI_Gatherv(sendBuffer.data(), myCount, MPI_DOUBLE, recvBuffer.data(), counts.data(), displs.data(),
+                MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+#else
+    recvBuffer = sendBuffer;
+#endif
+
+    if (rank != MASTER_NODE) continue;
+
+    stringstream boxFileName;
+    boxFileName << fileName << "_box" << iBox << "_" << setfill('0') << setw(5) << iter << ".csv";
+
+    ofstream boxFile(boxFileName.str().c_str());
+    for (unsigned long iField = 0; iField < nField; iField++)
+      boxFile << (iField > 0? "," : "") << "\"" << fieldNames[iField] << "\"";
+    boxFile << "\n" << scientific << setprecision(10);
+
+    for (unsigned long iValue = 0; iValue < recvBuffer.size(); iValue++)
+      boxFile << recvBuffer[iValue] << ((iValue+1) % nField == 0? "\n" : ",");
+  }
+
+}
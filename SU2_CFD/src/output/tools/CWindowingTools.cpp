@@ -71,6 +71,8 @@ CWindowedAverage::CWindowedAverage(){
 
 void CWindowedAverage::Reset(){
   val = 0.;
+  weightedSum = 0.;
+  nSamples = 0;
 }
 
 void CWindowedAverage::addValue(su2double valIn, unsigned long curTimeIter,unsigned long startIter){
@@ -89,6 +91,19 @@ su2double CWindowedAverage::WindowedUpdate(WINDOW_FUNCTION windowId){
   return 0.0;
 }
 
+su2double CWindowedAverage::StreamingUpdate(WINDOW_FUNCTION windowId, su2double valIn,
+                                            unsigned long iSample, unsigned long nSample){
+  nSamples++;
+  if (windowId == SQUARE) {
+    val += (valIn-val)/static_cast<su2double>(nSamples);
+  }
+  else {
+    weightedSum += valIn*GetWndWeight(windowId, iSample, nSample-1);
+    val = weightedSum/static_cast<su2double>(nSamples);
+  }
+  return val;
+}
+
 /* Definitions below are according to the window definitions in the paper of
  * Krakos et al. : "Sensitivity analysis of limit cycle oscillations"
  *                  by Krakos, J. A. and Wang, Q. and Hall, S. R. and Darmfoal, D. L..
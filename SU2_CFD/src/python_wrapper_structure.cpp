@@ -27,6 +27,8 @@
 
 
  #include "../include/drivers/CDriver.hpp"
+#include "../../Common/include/toolboxes/allocation_toolbox.hpp"
+#include "../include/output/COutput.hpp"
 
 void CDriver::PythonInterface_Preprocessing(CConfig **config, CGeometry ****geometry, CSolver *****solver){
 
@@ -221,6 +223,19 @@ passivedouble CDriver::Get_LiftCoeff() {
     return SU2_TYPE::GetValue(CLift);
 }
 
+map<string, passivedouble> CDriver::GetHistoryOutputValues() {
+
+  COutput *output = (nZone > 1)? driver_output : output_container[ZONE_0];
+
+  map<string, passivedouble> values;
+  if (output == nullptr) return values;
+
+  for (const auto& field : output->GetHistoryOutput_List())
+    values[field] = SU2_TYPE::GetValue(output->GetHistoryFieldValue(field));
+
+  return values;
+}
+
 unsigned short CDriver::GetMovingMarker() {
 
   unsigned short IDtoSend,iMarker, jMarker, Moving;
@@ -676,6 +691,173 @@ vector<passivedouble> CDriver::GetVertexUnitNormal(unsigned short iMarker, unsig
 
 }
 
+/*--- Check the size of the array of a bulk accessor of a marker. ---*/
+
+static void CheckMarkerArraySize(unsigned long nValues, unsigned long nVertex, unsigned long nValuePerVertex,
+                                 const char* function) {
+  if (nValues != nVertex*nValuePerVertex) {
+    SU2_MPI::Error(string("The array has ") + to_string(nValues) + string(" values instead of ") +
+                   to_string(nVertex*nValuePerVertex) + string(" (") + to_string(nValuePerVertex) +
+                   string(" per vertex)."), function);
+  }
+}
+
+void CDriver::GetMarkerCoordinates(unsigned short iMarker, passivedouble* values, unsigned long nValues){
+
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  const unsigned long nVertex = geometry->GetnVertex(iMarker);
+
+  CheckMarkerArraySize(nValues, nVertex, nDim, CURRENT_FUNCTION);
+
+  for (unsigned long iVertex = 0; iVertex < nVertex; iVertex++) {
+    const unsigned long iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      values[iVertex*nDim+iDim] = SU2_TYPE::GetValue(geometry->node[iPoint]->GetCoord(iDim));
+  }
+
+}
+
+void CDriver::GetMarkerForces(unsigned short iMarker, passivedouble* values, unsigned long nValues){
+
+  const unsigned long nVertex = geometry_container[ZONE_0][INST_0][MESH_0]->GetnVertex(iMarker);
+
+  CheckMarkerArraySize(nValues, nVertex, nDim, CURRENT_FUNCTION);
+
+  for (unsigned long iVertex = 0; iVertex < nVertex; iVertex++) {
+    const bool halo = ComputeVertexForces(iMarker, iVertex);
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      values[iVertex*nDim+iDim] = halo? 0.0 : SU2_TYPE::GetValue(PyWrapNodalForce[iDim]);
+  }
+
+}
+
+void CDriver::GetMarkerTemperatures(unsigned short iMarker, passivedouble* values, unsigned long nValues){
+
+  const unsigned long nVertex = geometry_container[ZONE_0][INST_0][MESH_0]->GetnVertex(iMarker);
+
+  CheckMarkerArraySize(nValues, nVertex, 1, CURRENT_FUNCTION);
+
+  for (unsigned long iVertex = 0; iVertex < nVertex; iVertex++)
+    values[iVertex] = GetVertexTemperature(iMarker, iVertex);
+
+}
+
+void CDriver::SetMarkerTemperatures(unsigned short iMarker, const passivedouble* values, unsigned long nValues){
+
+  const unsigned long nVertex = geometry_container[ZONE_0][INST_0][MESH_0]->GetnVertex(iMarker);
+
+  CheckMarkerArraySize(nValues, nVertex, 1, CURRENT_FUNCTION);
+
+  for (unsigned long iVertex = 0; iVertex < nVertex; iVertex++)
+    SetVertexTemperature(iMarker, iVertex, values[iVertex]);
+
+}
+
+void CDriver::GetMarkerNormalHeatFluxes(unsigned short iMarker, passivedouble* values, unsigned long nValues){
+
+  const unsigned long nVertex = geometry_container[ZONE_0][INST_0][MESH_0]->GetnVertex(iMarker);
+
+  CheckMarkerArraySize(nValues, nVertex, 1, CURRENT_FUNCTION);
+
+  for (unsigned long iVertex = 0; iVertex < nVertex; iVertex++)
+    values[iVertex] = GetVertexNormalHeatFlux(iMarker, iVertex);
+
+}
+
+void CDriver::SetMarkerNormalHeatFluxes(unsigned short iMarker, const passivedouble* values, unsigned long nValues){
+
+  const unsigned long nVertex = geometry_container[ZONE_0][INST_0][MESH_0]->GetnVertex(iMarker);
+
+  CheckMarkerArraySize(nValues, nVertex, 1, CURRENT_FUNCTION);
+
+  for (unsigned long iVertex = 0; iVertex < nVertex; iVertex++)
+    SetVertexNormalHeatFlux(iMarker, iVertex, values[iVertex]);
+
+}
+
+void CDriver::SetMarkerMeshDisplacements(unsigned short iMarker, const passivedouble* values, unsigned long nValues){
+
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  CVariable *nodes = solver_container[ZONE_0][INST_0][MESH_0][MESH_SOL]->GetNodes();
+  const unsigned long nVertex = geometry->GetnVertex(iMarker);
+
+  CheckMarkerArraySize(nValues, nVertex, nDim, CURRENT_FUNCTION);
+
+  su2double Disp[3] = {0.0, 0.0, 0.0};
+
+  for (unsigned long iVertex = 0; iVertex < nVertex; iVertex++) {
+    const unsigned long iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      Disp[iDim] = values[iVertex*nDim+iDim];
+    nodes->SetBound_Disp(iPoint, Disp);
+  }
+
+}
+
+void CDriver::SetMarkerFEA_Loads(unsigned short iMarker, const passivedouble* values, unsigned long nValues){
+
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  CVariable *nodes = solver_container[ZONE_0][INST_0][MESH_0][FEA_SOL]->GetNodes();
+  const unsigned long nVertex = geometry->GetnVertex(iMarker);
+
+  CheckMarkerArraySize(nValues, nVertex, nDim, CURRENT_FUNCTION);
+
+  su2double Load[3] = {0.0, 0.0, 0.0};
+
+  for (unsigned long iVertex = 0; iVertex < nVertex; iVertex++) {
+    const unsigned long iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      Load[iDim] = values[iVertex*nDim+iDim];
+    nodes->Set_FlowTraction(iPoint, Load);
+  }
+
+}
+
+void CDriver::GetMarkerFEA_Displacements(unsigned short iMarker, passivedouble* values, unsigned long nValues){
+
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  CVariable *nodes = solver_container[ZONE_0][INST_0][MESH_0][FEA_SOL]->GetNodes();
+  const unsigned long nVertex = geometry->GetnVertex(iMarker);
+
+  CheckMarkerArraySize(nValues, nVertex, nDim, CURRENT_FUNCTION);
+
+  for (unsigned long iVertex = 0; iVertex < nVertex; iVertex++) {
+    const unsigned long iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      values[iVertex*nDim+iDim] = SU2_TYPE::GetValue(nodes->GetSolution(iPoint, iDim));
+  }
+
+}
+
+unsigned short CDriver::GetNumberSolverVars(unsigned short iSol){
+
+  if ((iSol >= MAX_SOLS) || (solver_container[ZONE_0][INST_0][MESH_0][iSol] == nullptr)) return 0;
+
+  return solver_container[ZONE_0][INST_0][MESH_0][iSol]->GetnVar();
+
+}
+
+void CDriver::GetMarkerSolution(unsigned short iSol, unsigned short iMarker, passivedouble* values, unsigned long nValues){
+
+  const unsigned short nVar = GetNumberSolverVars(iSol);
+  if (nVar == 0) {
+    SU2_MPI::Error(string("Solver ") + to_string(iSol) + string(" does not exist."), CURRENT_FUNCTION);
+  }
+
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  CVariable *nodes = solver_container[ZONE_0][INST_0][MESH_0][iSol]->GetNodes();
+  const unsigned long nVertex = geometry->GetnVertex(iMarker);
+
+  CheckMarkerArraySize(nValues, nVertex, nVar, CURRENT_FUNCTION);
+
+  for (unsigned long iVertex = 0; iVertex < nVertex; iVertex++) {
+    const unsigned long iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+    for (unsigned short iVar = 0; iVar < nVar; iVar++)
+      values[iVertex*nVar+iVar] = SU2_TYPE::GetValue(nodes->GetSolution(iPoint, iVar));
+  }
+
+}
+
 vector<string> CDriver::GetAllBoundaryMarkersTag(){
 
   vector<string> boundariesTagList;
@@ -1253,3 +1435,213 @@ void CDriver::SetInlet_Angle(unsigned short iMarker, passivedouble alpha){
 
 }
 
+
+unsigned short CDriver::SaveSolverState(){
+
+  if (fem_solver) {
+    SU2_MPI::Error("Solver states are not available for the FEM fluid solver.", CURRENT_FUNCTION);
+  }
+
+  vector<su2double> state;
+
+  for (iZone = 0; iZone < nZone; iZone++) {
+    const bool dual_time = (config_container[iZone]->GetTime_Marching() != NO);
+    for (iInst = 0; iInst < nInst[iZone]; iInst++) {
+      for (iMesh = 0; iMesh <= config_container[iZone]->GetnMGLevels(); iMesh++) {
+        for (unsigned short iSol = 0; iSol < MAX_SOLS; iSol++) {
+          CSolver *solver = solver_container[iZone][iInst][iMesh][iSol];
+          if (solver == nullptr) continue;
+
+          CVariable *nodes = solver->GetNodes();
+          const unsigned long nPoint = nodes->GetSolution().rows();
+          const unsigned short nVar = solver->GetnVar();
+
+          for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+            for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+              state.push_back(nodes->GetSolution(iPoint, iVar));
+              if (!dual_time) continue;
+              state.push_back(nodes->GetSolution_time_n(iPoint, iVar));
+              state.push_back(nodes->GetSolution_time_n1(iPoint, iVar));
+            }
+          }
+        }
+      }
+    }
+  }
+
+  PyWrapSolverStates.push_back(move(state));
+  PyWrapSolverStatesIter.push_back(TimeIter);
+
+  return PyWrapSolverStates.size()-1;
+
+}
+
+void CDriver::RestoreSolverState(unsigned short iState){
+
+  if ((iState >= PyWrapSolverStates.size()) || PyWrapSolverStates[iState].empty()) {
+    SU2_MPI::Error(string("Solver state ") + to_string(iState) + string(" does not exist."), CURRENT_FUNCTION);
+  }
+
+  /*--- The layout of the state is the one of SaveSolverState, halo points included, hence no communication is needed. ---*/
+
+  const vector<su2double>& state = PyWrapSolverStates[iState];
+  unsigned long pos = 0;
+
+  for (iZone = 0; iZone < nZone; iZone++) {
+    const bool dual_time = (config_container[iZone]->GetTime_Marching() != NO);
+    for (iInst = 0; iInst < nInst[iZone]; iInst++) {
+      for (iMesh = 0; iMesh <= config_container[iZone]->GetnMGLevels(); iMesh++) {
+        for (unsigned short iSol = 0; iSol < MAX_SOLS; iSol++) {
+          CSolver *solver = solver_container[iZone][iInst][iMesh][iSol];
+          if (solver == nullptr) continue;
+
+          CVariable *nodes = solver->GetNodes();
+          const unsigned long nPoint = nodes->GetSolution().rows();
+          const unsigned short nVar = solver->GetnVar();
+
+          for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+            for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+              nodes->SetSolution(iPoint, iVar, state[pos++]);
+              if (!dual_time) continue;
+              nodes->Set_Solution_time_n(iPoint, iVar, state[pos++]);
+              nodes->Set_Solution_time_n1(iPoint, iVar, state[pos++]);
+            }
+          }
+          nodes->Set_OldSolution();
+        }
+      }
+    }
+  }
+
+  /*--- The solvers were not re-allocated in between, otherwise the sizes would differ. ---*/
+
+  if (pos != state.size()) {
+    SU2_MPI::Error("The solvers do not match the stored state.", CURRENT_FUNCTION);
+  }
+
+  ResetConvergence();
+  StopCalc = false;
+  TimeIter = driver_config->GetTime_Domain()? PyWrapSolverStatesIter[iState] : 0;
+
+}
+
+void CDriver::DeleteSolverState(unsigned short iState){
+
+  if (iState < PyWrapSolverStates.size())
+    vector<su2double>().swap(PyWrapSolverStates[iState]);
+
+}
+
+/*!
+ * \brief Rotate the freestream velocity of a flow solver to the angles of the config, keeping its magnitude.
+ */
+static void SetFreestreamDirection(CConfig *config, CSolver *solver, unsigned short nDim, bool fineGrid) {
+
+  su2double *Velocity_Inf = solver->GetVelocity_Inf();
+  if (Velocity_Inf == nullptr) return;
+
+  su2double Vel_Infty_Mag = 0.0;
+  for (unsigned short iDim = 0; iDim < nDim; iDim++)
+    Vel_Infty_Mag += Velocity_Inf[iDim]*Velocity_Inf[iDim];
+  Vel_Infty_Mag = sqrt(Vel_Infty_Mag);
+
+  const su2double Alpha = config->GetAoA()*PI_NUMBER/180.0;
+  const su2double Beta  = config->GetAoS()*PI_NUMBER/180.0;
+
+  if (nDim == 2) {
+    Velocity_Inf[0] = cos(Alpha)*Vel_Infty_Mag;
+    Velocity_Inf[1] = sin(Alpha)*Vel_Infty_Mag;
+  }
+  else {
+    Velocity_Inf[0] = cos(Alpha)*cos(Beta)*Vel_Infty_Mag;
+    Velocity_Inf[1] = sin(Beta)*Vel_Infty_Mag;
+    Velocity_Inf[2] = sin(Alpha)*cos(Beta)*Vel_Infty_Mag;
+  }
+
+  /*--- Only the fine grid stores the velocity in the config. ---*/
+
+  if (fineGrid) {
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      config->SetVelocity_FreeStreamND(Velocity_Inf[iDim], iDim);
+  }
+
+}
+
+void CDriver::SetDV_Value(unsigned short iDV, unsigned short iValue, passivedouble val){
+
+  for (iZone = 0; iZone < nZone; iZone++) {
+    if ((iDV >= config_container[iZone]->GetnDV()) || (iValue >= config_container[iZone]->GetnDV_Value(iDV))) {
+      SU2_MPI::Error("The design variable or its value does not exist (DV_KIND, DV_VALUE).", CURRENT_FUNCTION);
+    }
+    config_container[iZone]->SetDV_Value(iDV, iValue, val);
+  }
+
+}
+
+void CDriver::DeformDesign(){
+
+  if (Design_Coord.size() != nZone) Design_Coord.resize(nZone);
+
+  for (iZone = 0; iZone < nZone; iZone++) {
+    Design_Deformation(config_container[iZone], geometry_container[iZone][INST_0], grid_movement[iZone][INST_0],
+                       surface_movement[iZone], Design_Coord[iZone]);
+  }
+
+}
+
+void CDriver::SetAngleOfAttack(passivedouble AoA){
+
+  for (iZone = 0; iZone < nZone; iZone++) {
+    config_container[iZone]->SetAoA(AoA);
+    for (iInst = 0; iInst < nInst[iZone]; iInst++)
+      for (iMesh = 0; iMesh <= config_container[iZone]->GetnMGLevels(); iMesh++)
+        if (solver_container[iZone][iInst][iMesh][FLOW_SOL] != nullptr)
+          SetFreestreamDirection(config_container[iZone], solver_container[iZone][iInst][iMesh][FLOW_SOL],
+                                 nDim, (iMesh == MESH_0) && (iInst == INST_0));
+  }
+
+}
+
+void CDriver::SetSideslipAngle(passivedouble AoS){
+
+  for (iZone = 0; iZone < nZone; iZone++) {
+    config_container[iZone]->SetAoS(AoS);
+    for (iInst = 0; iInst < nInst[iZone]; iInst++)
+      for (iMesh = 0; iMesh <= config_container[iZone]->GetnMGLevels(); iMesh++)
+        if (solver_container[iZone][iInst][iMesh][FLOW_SOL] != nullptr)
+          SetFreestreamDirection(config_container[iZone], solver_container[iZone][iInst][iMesh][FLOW_SOL],
+                                 nDim, (iMesh == MESH_0) && (iInst == INST_0));
+  }
+
+}
+
+map<string, passivedouble> CDriver::GetMemoryUsage() const {
+
+  using namespace MemoryAllocation;
+
+  /*--- The tape is accounted when it is queried. ---*/
+
+  track_memory(MEMORY_AD_TAPE, static_cast<long long>(AD::GetTapeMemory()) - memory_in_use(MEMORY_AD_TAPE));
+
+  const passivedouble MB = 1.0/1048576.0;
+  map<string, passivedouble> usage;
+
+  for (int iCat = 0; iCat < N_MEMORY_CATEGORY; iCat++) {
+    const string name = memory_category_name(iCat);
+    usage[name] = memoryCounters.current[iCat].load() * MB;
+    usage[name + " peak"] = memoryCounters.peak[iCat].load() * MB;
+  }
+  usage["Tracked"] = memoryCounters.totalCurrent.load() * MB;
+  usage["Tracked peak"] = memoryCounters.totalPeak.load() * MB;
+  usage["Resident"] = CTimingReport::GetCurrentMemory();
+  usage["Resident peak"] = CTimingReport::GetPeakMemory();
+
+  return usage;
+
+}
+
+void CDriver::PrintMemoryReport() const {
+
+  MemoryAllocation::print_memory_report("Memory by category");
+
+}
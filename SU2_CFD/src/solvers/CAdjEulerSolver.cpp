@@ -191,6 +191,10 @@ CAdjEulerSolver::CAdjEulerSolver(CGeometry *geometry, CConfig *config, unsigned
       cout << "Explicit scheme. No Jacobian structure (Adjoint Euler). MG level: " << iMesh <<"." << endl;
   }
 
+  /*--- Edge coloring and chunk sizes for the OpenMP loops. ---*/
+
+  SetEdgeColoring(geometry, config);
+
   /*--- Computation of gradients by least squares ---*/
   if (config->GetLeastSquaresRequired()) {
     /*--- S matrix := inv(R)*traspose(inv(R)) ---*/
@@ -401,6 +405,35 @@ CAdjEulerSolver::~CAdjEulerSolver(void) {
   if (nodes != nullptr) delete nodes;
 }
 
+void CAdjEulerSolver::SetEdgeColoring(CGeometry *geometry, CConfig *config) {
+
+#ifdef HAVE_OMP
+  /*--- Get the edge coloring, see notes in CEulerSolver's constructor. The adjoint fluxes are
+   *    not conservative, hence the reducer strategy does not apply, if the coloring is not
+   *    efficient the natural coloring is used (whose group size makes the edge loops serial). ---*/
+
+  su2double parallelEff = 1.0;
+  const auto& coloring = geometry->GetEdgeColoring(&parallelEff);
+
+  if ((parallelEff < COLORING_EFF_THRESH) && (coloring.getOuterSize()>1))
+    geometry->SetNaturalEdgeColoring();
+
+  if (!coloring.empty()) {
+    auto groupSize = geometry->GetEdgeColorGroupSize();
+    auto nColor = coloring.getOuterSize();
+    EdgeColoring.reserve(nColor);
+
+    for(auto iColor = 0ul; iColor < nColor; ++iColor)
+      EdgeColoring.emplace_back(coloring.innerIdx(iColor), coloring.getNumNonZeros(iColor), groupSize);
+  }
+
+  omp_chunk_size = computeStaticChunkSize(nPoint, omp_get_max_threads(), OMP_MAX_SIZE);
+#else
+  EdgeColoring[0] = DummyGridColor<>(geometry->GetnEdge());
+#endif
+
+}
+
 void CAdjEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container, CConfig *config,
                             unsigned short iMesh, unsigned long Iteration) {
 
@@ -1615,10 +1648,6 @@ void CAdjEulerSolver::SetInitialCondition(CGeometry **geometry, CSolver ***solve
 
 void CAdjEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iMesh, unsigned short iRKStep, unsigned short RunTime_EqSystem, bool Output) {
 
-  unsigned long iPoint, nonPhysicalPoints = 0;
-  su2double SharpEdge_Distance;
-  bool physical = true;
-
   /*--- Retrieve information about the spatial and temporal integration for the
    adjoint equations (note that the flow problem may use different methods). ---*/
 
@@ -1632,20 +1661,31 @@ void CAdjEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_contai
 
   /*--- Update the objective function coefficient to guarantee zero gradient. ---*/
 
-  if (fixed_cl && eval_dof_dcx) { SetFarfield_AoA(geometry, solver_container, config, iMesh, Output); }
+  if (fixed_cl && eval_dof_dcx) {
+    SU2_OMP_MASTER
+    SetFarfield_AoA(geometry, solver_container, config, iMesh, Output);
+    SU2_OMP_BARRIER
+  }
 
   /*--- Residual initialization ---*/
 
-  for (iPoint = 0; iPoint < nPoint; iPoint ++) {
+  SU2_OMP_MASTER
+  ErrorCounter = 0;
+  SU2_OMP_BARRIER
+
+  unsigned long nonPhysicalPoints = 0;
+
+  SU2_OMP(for schedule(static,omp_chunk_size) nowait)
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint ++) {
 
     /*--- Get the distance form a sharp edge ---*/
 
-    SharpEdge_Distance = geometry->node[iPoint]->GetSharpEdge_Distance();
+    su2double SharpEdge_Distance = geometry->node[iPoint]->GetSharpEdge_Distance();
 
     /*--- Set the primitive variables compressible
      adjoint variables ---*/
 
-    physical = nodes->SetPrimVar(iPoint,SharpEdge_Distance, false, config);
+    bool physical = nodes->SetPrimVar(iPoint,SharpEdge_Distance, false, config);
 
     /* Check for non-realizable states for reporting. */
 
@@ -1656,6 +1696,9 @@ void CAdjEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_contai
     if (!Output) LinSysRes.SetBlock_Zero(iPoint);
 
   }
+  SU2_OMP_ATOMIC
+  ErrorCounter += nonPhysicalPoints;
+  SU2_OMP_BARRIER
 
   if ((muscl) && (iMesh == MESH_0)) {
 
@@ -1692,11 +1735,13 @@ void CAdjEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_contai
   /*--- Error message ---*/
 
   if (config->GetComm_Level() == COMM_FULL) {
-#ifdef HAVE_MPI
-    unsigned long MyErrorCounter = nonPhysicalPoints; nonPhysicalPoints = 0;
-    SU2_MPI::Allreduce(&MyErrorCounter, &nonPhysicalPoints, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
-#endif
-    if (iMesh == MESH_0) config->SetNonphysical_Points(nonPhysicalPoints);
+    SU2_OMP_MASTER
+    {
+      unsigned long tmp = ErrorCounter;
+      SU2_MPI::Allreduce(&tmp, &ErrorCounter, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+      if (iMesh == MESH_0) config->SetNonphysical_Points(ErrorCounter);
+    }
+    SU2_OMP_BARRIER
   }
 
 }
@@ -1704,20 +1749,39 @@ void CAdjEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_contai
 void CAdjEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
                                         CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
 
-  CNumerics* numerics = numerics_container[CONV_TERM];
-
-  unsigned long iEdge, iPoint, jPoint;
+  /*--- Pick one numerics object per thread. ---*/
+  CNumerics* numerics = numerics_container[CONV_TERM + omp_get_thread_num()*MAX_TERMS];
 
   bool implicit = (config->GetKind_TimeIntScheme_AdjFlow() == EULER_IMPLICIT);
   bool jst_scheme = ((config->GetKind_Centered_AdjFlow() == JST) && (iMesh == MESH_0));
   bool grid_movement  = config->GetGrid_Movement();
 
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  CVariable* flowNodes = solver_container[FLOW_SOL]->GetNodes();
+
+  /*--- Static arrays for the residuals and Jacobians of each edge (thread safety). ---*/
+  su2double res_conv_i[MAXNVAR] = {0.0}, res_visc_i[MAXNVAR] = {0.0},
+            res_conv_j[MAXNVAR] = {0.0}, res_visc_j[MAXNVAR] = {0.0};
+  su2double jacobian_ii[MAXNVAR][MAXNVAR] = {{0.0}}, jacobian_ij[MAXNVAR][MAXNVAR] = {{0.0}},
+            jacobian_ji[MAXNVAR][MAXNVAR] = {{0.0}}, jacobian_jj[MAXNVAR][MAXNVAR] = {{0.0}};
+  su2double *Jac_ii[MAXNVAR], *Jac_ij[MAXNVAR], *Jac_ji[MAXNVAR], *Jac_jj[MAXNVAR];
+  for (unsigned short iVar = 0; iVar < MAXNVAR; iVar++) {
+    Jac_ii[iVar] = jacobian_ii[iVar]; Jac_ij[iVar] = jacobian_ij[iVar];
+    Jac_ji[iVar] = jacobian_ji[iVar]; Jac_jj[iVar] = jacobian_jj[iVar];
+  }
+
+  /*--- Loop over edge colors. ---*/
+  for (auto color : EdgeColoring)
+  {
+  /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+  SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+  for(auto k = 0ul; k < color.size; ++k) {
+
+    auto iEdge = color.indices[k];
 
     /*--- Points in edge, normal, and neighbors---*/
 
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
+    unsigned long iPoint = geometry->edge[iEdge]->GetNode(0);
+    unsigned long jPoint = geometry->edge[iEdge]->GetNode(1);
     numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
     numerics->SetNeighbor(geometry->node[iPoint]->GetnNeighbor(), geometry->node[jPoint]->GetnNeighbor());
 
@@ -1727,17 +1791,12 @@ void CAdjEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_co
 
     /*--- Conservative variables w/o reconstruction ---*/
 
-    numerics->SetConservative(solver_container[FLOW_SOL]->GetNodes()->GetSolution(iPoint),
-                              solver_container[FLOW_SOL]->GetNodes()->GetSolution(jPoint));
+    numerics->SetConservative(flowNodes->GetSolution(iPoint), flowNodes->GetSolution(jPoint));
 
-    numerics->SetSoundSpeed(solver_container[FLOW_SOL]->GetNodes()->GetSoundSpeed(iPoint),
-                            solver_container[FLOW_SOL]->GetNodes()->GetSoundSpeed(jPoint));
-    numerics->SetEnthalpy(solver_container[FLOW_SOL]->GetNodes()->GetEnthalpy(iPoint),
-                          solver_container[FLOW_SOL]->GetNodes()->GetEnthalpy(jPoint));
+    numerics->SetSoundSpeed(flowNodes->GetSoundSpeed(iPoint), flowNodes->GetSoundSpeed(jPoint));
+    numerics->SetEnthalpy(flowNodes->GetEnthalpy(iPoint), flowNodes->GetEnthalpy(jPoint));
 
-
-    numerics->SetLambda(solver_container[FLOW_SOL]->GetNodes()->GetLambda(iPoint),
-                        solver_container[FLOW_SOL]->GetNodes()->GetLambda(jPoint));
+    numerics->SetLambda(flowNodes->GetLambda(iPoint), flowNodes->GetLambda(jPoint));
 
     if (jst_scheme) {
       numerics->SetUndivided_Laplacian(nodes->GetUndivided_Laplacian(iPoint), nodes->GetUndivided_Laplacian(jPoint));
@@ -1752,63 +1811,91 @@ void CAdjEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_co
 
     /*--- Compute residuals ---*/
 
-    numerics->ComputeResidual(Res_Conv_i, Res_Visc_i, Res_Conv_j, Res_Visc_j,
-                              Jacobian_ii, Jacobian_ij, Jacobian_ji, Jacobian_jj, config);
+    numerics->ComputeResidual(res_conv_i, res_visc_i, res_conv_j, res_visc_j,
+                              Jac_ii, Jac_ij, Jac_ji, Jac_jj, config);
 
     /*--- Update convective and artificial dissipation residuals ---*/
 
-    LinSysRes.SubtractBlock(iPoint, Res_Conv_i);
-    LinSysRes.SubtractBlock(jPoint, Res_Conv_j);
-    LinSysRes.SubtractBlock(iPoint, Res_Visc_i);
-    LinSysRes.SubtractBlock(jPoint, Res_Visc_j);
+    LinSysRes.SubtractBlock(iPoint, res_conv_i);
+    LinSysRes.SubtractBlock(jPoint, res_conv_j);
+    LinSysRes.SubtractBlock(iPoint, res_visc_i);
+    LinSysRes.SubtractBlock(jPoint, res_visc_j);
 
     /*--- Implicit contribution to the residual ---*/
 
     if (implicit) {
-      Jacobian.SubtractBlock2Diag(iPoint, Jacobian_ii);
-      Jacobian.SubtractBlock(iPoint, jPoint, Jacobian_ij);
-      Jacobian.SubtractBlock(jPoint, iPoint, Jacobian_ji);
-      Jacobian.SubtractBlock2Diag(jPoint, Jacobian_jj);
+      Jacobian.SubtractBlock2Diag(iPoint, Jac_ii);
+      Jacobian.SubtractBlock(iPoint, jPoint, Jac_ij);
+      Jacobian.SubtractBlock(jPoint, iPoint, Jac_ji);
+      Jacobian.SubtractBlock2Diag(jPoint, Jac_jj);
     }
 
   }
+  } // end color loop
+
 }
 
 
 void CAdjEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_container,
                                       CNumerics **numerics_container, CConfig *config, unsigned short iMesh) {
 
-  CNumerics* numerics = numerics_container[CONV_TERM];
-
-  su2double **Gradient_i, **Gradient_j, Project_Grad_i, Project_Grad_j, *Limiter_i = NULL,
-  *Limiter_j = NULL, *Psi_i = NULL, *Psi_j = NULL, *V_i, *V_j;
-  unsigned long iEdge, iPoint, jPoint, counter_local = 0, counter_global = 0;
-  unsigned short iDim, iVar;
+  /*--- Pick one numerics object per thread. ---*/
+  CNumerics* numerics = numerics_container[CONV_TERM + omp_get_thread_num()*MAX_TERMS];
 
   bool implicit         = (config->GetKind_TimeIntScheme_AdjFlow() == EULER_IMPLICIT);
   bool muscl            = (config->GetMUSCL_AdjFlow() && (iMesh == MESH_0));
   bool limiter          = (config->GetKind_SlopeLimit_AdjFlow() != NO_LIMITER);
   bool grid_movement    = config->GetGrid_Movement();
+  su2double adj_limit   = config->GetAdjointLimit();
+
+  CVariable* flowNodes = solver_container[FLOW_SOL]->GetNodes();
+
+  /*--- Static arrays of MUSCL-reconstructed adjoint variables, and for the residuals
+   *    and Jacobians of each edge (thread safety). ---*/
+  su2double solution_i[MAXNVAR] = {0.0}, solution_j[MAXNVAR] = {0.0};
+  su2double residual_i[MAXNVAR] = {0.0}, residual_j[MAXNVAR] = {0.0};
+  su2double jacobian_ii[MAXNVAR][MAXNVAR] = {{0.0}}, jacobian_ij[MAXNVAR][MAXNVAR] = {{0.0}},
+            jacobian_ji[MAXNVAR][MAXNVAR] = {{0.0}}, jacobian_jj[MAXNVAR][MAXNVAR] = {{0.0}};
+  su2double *Jac_ii[MAXNVAR], *Jac_ij[MAXNVAR], *Jac_ji[MAXNVAR], *Jac_jj[MAXNVAR];
+  for (unsigned short iVar = 0; iVar < MAXNVAR; iVar++) {
+    Jac_ii[iVar] = jacobian_ii[iVar]; Jac_ij[iVar] = jacobian_ij[iVar];
+    Jac_ji[iVar] = jacobian_ji[iVar]; Jac_jj[iVar] = jacobian_jj[iVar];
+  }
+
+  /*--- Non-physical reconstructions counted by this thread. ---*/
+
+  SU2_OMP_MASTER
+  ErrorCounter = 0;
+  SU2_OMP_BARRIER
+
+  unsigned long counter_local = 0;
+
+  /*--- Loop over edge colors. ---*/
+  for (auto color : EdgeColoring)
+  {
+  /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+  SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+  for(auto k = 0ul; k < color.size; ++k) {
 
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+    auto iEdge = color.indices[k];
+
+    unsigned short iDim, iVar;
 
     /*--- Points in edge and normal vectors ---*/
 
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
+    unsigned long iPoint = geometry->edge[iEdge]->GetNode(0);
+    unsigned long jPoint = geometry->edge[iEdge]->GetNode(1);
     numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
 
     /*--- Adjoint variables w/o reconstruction ---*/
 
-    Psi_i = nodes->GetSolution(iPoint);
-    Psi_j = nodes->GetSolution(jPoint);
+    su2double *Psi_i = nodes->GetSolution(iPoint);
+    su2double *Psi_j = nodes->GetSolution(jPoint);
     numerics->SetAdjointVar(Psi_i, Psi_j);
 
     /*--- Primitive variables w/o reconstruction ---*/
 
-    V_i = solver_container[FLOW_SOL]->GetNodes()->GetPrimitive(iPoint);
-    V_j = solver_container[FLOW_SOL]->GetNodes()->GetPrimitive(jPoint);
-    numerics->SetPrimitive(V_i, V_j);
+    numerics->SetPrimitive(flowNodes->GetPrimitive(iPoint), flowNodes->GetPrimitive(jPoint));
 
     /*--- Grid velocities for dynamic meshes ---*/
 
@@ -1820,6 +1907,8 @@ void CAdjEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_cont
 
     if (muscl) {
 
+      su2double Vector_i[MAXNDIM] = {0.0}, Vector_j[MAXNDIM] = {0.0};
+
       for (iDim = 0; iDim < nDim; iDim++) {
         Vector_i[iDim] = 0.5*(geometry->node[jPoint]->GetCoord(iDim) - geometry->node[iPoint]->GetCoord(iDim));
         Vector_j[iDim] = 0.5*(geometry->node[iPoint]->GetCoord(iDim) - geometry->node[jPoint]->GetCoord(iDim));
@@ -1827,8 +1916,10 @@ void CAdjEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_cont
 
       /*--- Adjoint variables using gradient reconstruction and limiters ---*/
 
-      Gradient_i = nodes->GetGradient_Reconstruction(iPoint);
-      Gradient_j = nodes->GetGradient_Reconstruction(jPoint);
+      auto Gradient_i = nodes->GetGradient_Reconstruction(iPoint);
+      auto Gradient_j = nodes->GetGradient_Reconstruction(jPoint);
+
+      su2double *Limiter_i = nullptr, *Limiter_j = nullptr;
 
       if (limiter) {
         Limiter_i = nodes->GetLimiter(iPoint);
@@ -1836,33 +1927,29 @@ void CAdjEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_cont
       }
 
       for (iVar = 0; iVar < nVar; iVar++) {
-        Project_Grad_i = 0; Project_Grad_j = 0;
+        su2double Project_Grad_i = 0.0, Project_Grad_j = 0.0;
         for (iDim = 0; iDim < nDim; iDim++) {
           Project_Grad_i += Vector_i[iDim]*Gradient_i[iVar][iDim];
           Project_Grad_j += Vector_j[iDim]*Gradient_j[iVar][iDim];
         }
         if (limiter) {
-          Solution_i[iVar] = Psi_i[iVar] + Project_Grad_i*Limiter_i[iDim];
-          Solution_j[iVar] = Psi_j[iVar] + Project_Grad_j*Limiter_j[iDim];
+          solution_i[iVar] = Psi_i[iVar] + Project_Grad_i*Limiter_i[iVar];
+          solution_j[iVar] = Psi_j[iVar] + Project_Grad_j*Limiter_j[iVar];
         }
         else {
-          Solution_i[iVar] = Psi_i[iVar] + Project_Grad_i;
-          Solution_j[iVar] = Psi_j[iVar] + Project_Grad_j;
+          solution_i[iVar] = Psi_i[iVar] + Project_Grad_i;
+          solution_j[iVar] = Psi_j[iVar] + Project_Grad_j;
         }
       }
 
       /* Check our reconstruction for exceeding bounds on the
        adjoint density. */
 
-      su2double adj_limit = config->GetAdjointLimit();
-      bool phi_bound_i = (fabs(Solution_i[0]) > adj_limit);
-      bool phi_bound_j = (fabs(Solution_j[0]) > adj_limit);
+      bool phi_bound_i = (fabs(solution_i[0]) > adj_limit);
+      bool phi_bound_j = (fabs(solution_j[0]) > adj_limit);
 
-      if (phi_bound_i) nodes->SetNon_Physical(iPoint, true);
-      else             nodes->SetNon_Physical(iPoint, false);
-
-      if (phi_bound_j) nodes->SetNon_Physical(jPoint, true);
-      else             nodes->SetNon_Physical(jPoint, false);
+      nodes->SetNon_Physical(iPoint, phi_bound_i);
+      nodes->SetNon_Physical(jPoint, phi_bound_j);
 
       /* Lastly, check for existing first-order points still active
        from previous iterations. */
@@ -1870,47 +1957,53 @@ void CAdjEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_cont
       if (nodes->GetNon_Physical(iPoint)) {
         counter_local++;
         for (iVar = 0; iVar < nVar; iVar++)
-          Solution_i[iVar] = Psi_i[iVar];
+          solution_i[iVar] = Psi_i[iVar];
       }
       if (nodes->GetNon_Physical(jPoint)) {
         counter_local++;
         for (iVar = 0; iVar < nVar; iVar++)
-          Solution_j[iVar] = Psi_j[iVar];
+          solution_j[iVar] = Psi_j[iVar];
       }
 
-      numerics->SetAdjointVar(Solution_i, Solution_j);
+      numerics->SetAdjointVar(solution_i, solution_j);
 
     }
 
     /*--- Compute the residual---*/
 
-    numerics->ComputeResidual(Residual_i, Residual_j, Jacobian_ii, Jacobian_ij, Jacobian_ji, Jacobian_jj, config);
+    numerics->ComputeResidual(residual_i, residual_j, Jac_ii, Jac_ij, Jac_ji, Jac_jj, config);
 
     /*--- Add and Subtract Residual ---*/
 
-    LinSysRes.SubtractBlock(iPoint, Residual_i);
-    LinSysRes.SubtractBlock(jPoint, Residual_j);
+    LinSysRes.SubtractBlock(iPoint, residual_i);
+    LinSysRes.SubtractBlock(jPoint, residual_j);
 
     /*--- Implicit contribution to the residual ---*/
 
     if (implicit) {
-      Jacobian.SubtractBlock2Diag(iPoint, Jacobian_ii);
-      Jacobian.SubtractBlock(iPoint, jPoint, Jacobian_ij);
-      Jacobian.SubtractBlock(jPoint, iPoint, Jacobian_ji);
-      Jacobian.SubtractBlock2Diag(jPoint, Jacobian_jj);
+      Jacobian.SubtractBlock2Diag(iPoint, Jac_ii);
+      Jacobian.SubtractBlock(iPoint, jPoint, Jac_ij);
+      Jacobian.SubtractBlock(jPoint, iPoint, Jac_ji);
+      Jacobian.SubtractBlock2Diag(jPoint, Jac_jj);
     }
 
   }
+  } // end color loop
 
   /*--- Warning message about non-physical reconstructions. ---*/
 
   if (config->GetComm_Level() == COMM_FULL) {
-#ifdef HAVE_MPI
-    SU2_MPI::Reduce(&counter_local, &counter_global, 1, MPI_UNSIGNED_LONG, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
-#else
-    counter_global = counter_local;
-#endif
-    if (iMesh == MESH_0) config->SetNonphysical_Reconstr(counter_global);
+    SU2_OMP_ATOMIC
+    ErrorCounter += counter_local;
+    SU2_OMP_BARRIER
+
+    SU2_OMP_MASTER
+    {
+      unsigned long counter_global = 0;
+      SU2_MPI::Reduce(&ErrorCounter, &counter_global, 1, MPI_UNSIGNED_LONG, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
+      if (iMesh == MESH_0) config->SetNonphysical_Reconstr(counter_global);
+    }
+    SU2_OMP_BARRIER
   }
 
 }
@@ -1918,23 +2011,26 @@ void CAdjEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_cont
 void CAdjEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_container,
                                       CNumerics **numerics_container, CConfig *config, unsigned short iMesh) {
 
-  CNumerics* numerics = numerics_container[SOURCE_FIRST_TERM];
+  /*--- Pick one numerics object per thread. ---*/
+  CNumerics* numerics = numerics_container[SOURCE_FIRST_TERM + omp_get_thread_num()*MAX_TERMS];
 
-  unsigned short iVar;
-  unsigned long iPoint;
   bool implicit = (config->GetKind_TimeIntScheme_AdjFlow() == EULER_IMPLICIT);
   bool rotating_frame = config->GetRotating_Frame();
   bool axisymmetric   = config->GetAxisymmetric();
   //  bool gravity        = (config->GetGravityForce() == YES);
   bool harmonic_balance  = (config->GetTime_Marching() == HARMONIC_BALANCE);
 
-  /*--- Initialize the source residual to zero ---*/
-  for (iVar = 0; iVar < nVar; iVar++) Residual[iVar] = 0.0;
+  /*--- Static arrays for the residual and Jacobian of each point (thread safety). ---*/
+  su2double residual[MAXNVAR] = {0.0}, jacobian_i[MAXNVAR][MAXNVAR] = {{0.0}};
+  su2double *Jac_i[MAXNVAR];
+  for (unsigned short iVar = 0; iVar < MAXNVAR; iVar++)
+    Jac_i[iVar] = jacobian_i[iVar];
 
   if (rotating_frame) {
 
     /*--- Loop over all points ---*/
-    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
       /*--- Load the adjoint variables ---*/
       numerics->SetAdjointVar(nodes->GetSolution(iPoint),
@@ -1944,35 +2040,34 @@ void CAdjEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_cont
       numerics->SetVolume(geometry->node[iPoint]->GetVolume());
 
       /*--- Compute the adjoint rotating frame source residual ---*/
-      numerics->ComputeResidual(Residual, Jacobian_i, config);
+      numerics->ComputeResidual(residual, Jac_i, config);
 
       /*--- Add the source residual to the total ---*/
-      LinSysRes.AddBlock(iPoint, Residual);
+      LinSysRes.AddBlock(iPoint, residual);
 
       /*--- Add the implicit Jacobian contribution ---*/
-      if (implicit) Jacobian.AddBlock2Diag(iPoint, Jacobian_i);
+      if (implicit) Jacobian.AddBlock2Diag(iPoint, Jac_i);
 
     }
   }
 
   if (harmonic_balance) {
 
-    su2double Volume, Source;
-
     /*--- loop over points ---*/
-    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
       /*--- Get control volume ---*/
-      Volume = geometry->node[iPoint]->GetVolume();
+      su2double Volume = geometry->node[iPoint]->GetVolume();
 
       /*--- Get stored harmonic balance source term ---*/
-      for (iVar = 0; iVar < nVar; iVar++) {
-        Source = nodes->GetHarmonicBalance_Source(iPoint,iVar);
-        Residual[iVar] = Source*Volume;
+      for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+        su2double Source = nodes->GetHarmonicBalance_Source(iPoint,iVar);
+        residual[iVar] = Source*Volume;
       }
 
       /*--- Add Residual ---*/
-      LinSysRes.AddBlock(iPoint, Residual);
+      LinSysRes.AddBlock(iPoint, residual);
 
     }
   }
@@ -1981,16 +2076,19 @@ void CAdjEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_cont
 
     /*--- Zero out Jacobian structure ---*/
     if (implicit) {
-      for (iVar = 0; iVar < nVar; iVar ++)
+      for (unsigned short iVar = 0; iVar < nVar; iVar ++)
         for (unsigned short jVar = 0; jVar < nVar; jVar ++)
-          Jacobian_i[iVar][jVar] = 0.0;
+          Jac_i[iVar][jVar] = 0.0;
     }
 
+    CVariable* flowNodes = solver_container[FLOW_SOL]->GetNodes();
+
     /*--- loop over points ---*/
-    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
       /*--- Set solution ---*/
-      numerics->SetConservative(solver_container[FLOW_SOL]->GetNodes()->GetSolution(iPoint), solver_container[FLOW_SOL]->GetNodes()->GetSolution(iPoint));
+      numerics->SetConservative(flowNodes->GetSolution(iPoint), flowNodes->GetSolution(iPoint));
 
       /*--- Set adjoint variables ---*/
       numerics->SetAdjointVar(nodes->GetSolution(iPoint), nodes->GetSolution(iPoint));
@@ -2002,14 +2100,14 @@ void CAdjEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_cont
       numerics->SetCoord(geometry->node[iPoint]->GetCoord(), geometry->node[iPoint]->GetCoord());
 
       /*--- Compute Source term Residual ---*/
-      numerics->ComputeResidual(Residual, Jacobian_i, config);
+      numerics->ComputeResidual(residual, Jac_i, config);
 
       /*--- Add Residual ---*/
-      LinSysRes.AddBlock(iPoint, Residual);
+      LinSysRes.AddBlock(iPoint, residual);
 
       /*--- Implicit part ---*/
       if (implicit)
-        Jacobian.AddBlock2Diag(iPoint, Jacobian_i);
+        Jacobian.AddBlock2Diag(iPoint, Jac_i);
 
     }
   }
@@ -2025,272 +2123,288 @@ void CAdjEulerSolver::Source_Template(CGeometry *geometry, CSolver **solver_cont
 }
 
 void CAdjEulerSolver::SetUndivided_Laplacian(CGeometry *geometry, CConfig *config) {
-  unsigned long iPoint, jPoint, iEdge;
-  unsigned short iVar;
-  su2double *Diff;
-
-  Diff = new su2double[nVar];
-
-  nodes->SetUnd_LaplZero();
-
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
 
-    for (iVar = 0; iVar < nVar; iVar++)
-      Diff[iVar] = nodes->GetSolution(iPoint,iVar) - nodes->GetSolution(jPoint,iVar);
-
-#ifdef STRUCTURED_GRID
-
-    if (geometry->node[iPoint]->GetDomain()) nodes->SubtractUnd_Lapl(iPoint, Diff);
-    if (geometry->node[jPoint]->GetDomain()) nodes->AddUnd_Lapl(jPoint, Diff);
-
-#else
+  /*--- Loop domain points, each point gathers the differences with its neighbors (thread safety). ---*/
 
-    bool boundary_i = geometry->node[iPoint]->GetPhysicalBoundary();
-    bool boundary_j = geometry->node[jPoint]->GetPhysicalBoundary();
+  SU2_OMP_FOR_DYN(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
-    /*--- Both points inside the domain, or both in the boundary ---*/
-    if ((!boundary_i && !boundary_j) || (boundary_i && boundary_j)) {
-      if (geometry->node[iPoint]->GetDomain()) nodes->SubtractUnd_Lapl(iPoint, Diff);
-      if (geometry->node[jPoint]->GetDomain()) nodes->AddUnd_Lapl(jPoint, Diff);
-    }
+    const bool boundary_i = geometry->node[iPoint]->GetPhysicalBoundary();
 
-    /*--- iPoint inside the domain, jPoint on the boundary ---*/
-    if (!boundary_i && boundary_j)
-      if (geometry->node[iPoint]->GetDomain()) nodes->SubtractUnd_Lapl(iPoint, Diff);
+    for (unsigned short iVar = 0; iVar < nVar; iVar++)
+      nodes->SetUnd_Lapl(iPoint, iVar, 0.0);
 
-    /*--- jPoint inside the domain, iPoint on the boundary ---*/
-    if (boundary_i && !boundary_j)
-      if (geometry->node[jPoint]->GetDomain()) nodes->AddUnd_Lapl(jPoint, Diff);
+    for (unsigned short iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); iNeigh++) {
 
-#endif
+      const unsigned long jPoint = geometry->node[iPoint]->GetPoint(iNeigh);
+      const bool boundary_j = geometry->node[jPoint]->GetPhysicalBoundary();
 
-  }
+      /*--- Points on the boundary only take contributions from other boundary points ---*/
 
-#ifdef STRUCTURED_GRID
-
-  unsigned long Point_Normal = 0, iVertex;
-  unsigned short iMarker;
-  su2double *Psi_mirror;
+      if (boundary_i && !boundary_j) continue;
 
-  Psi_mirror = new su2double[nVar];
+      /*--- Solution differences ---*/
 
-  /*--- Loop over all boundaries and include an extra contribution
-   from a halo node. Find the nearest normal, interior point
-   for a boundary node and make a linear approximation. ---*/
-  for (iMarker = 0; iMarker < nMarker; iMarker++) {
-
-    if (config->GetMarker_All_KindBC(iMarker) != SEND_RECEIVE &&
-        config->GetMarker_All_KindBC(iMarker) != INTERFACE_BOUNDARY &&
-        config->GetMarker_All_KindBC(iMarker) != NEARFIELD_BOUNDARY) {
-
-      for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-
-        if (geometry->node[iPoint]->GetDomain()) {
-
-          Point_Normal = geometry->vertex[iMarker][iVertex]->GetNormal_Neighbor();
-
-          /*--- Interpolate & compute difference in the conserved variables ---*/
-
-          for (iVar = 0; iVar < nVar; iVar++) {
-            Psi_mirror[iVar] = 2.0*node[iPoint]->GetSolution(iVar) - nodes->GetSolution(Point_Normal, iVar);
-            Diff[iVar]   = nodes->GetSolution(iPoint,iVar) - Psi_mirror[iVar];
-          }
-
-          /*--- Subtract contribution at the boundary node only ---*/
-
-          nodes->SubtractUnd_Lapl(iPoint,Diff);
-        }
-      }
+      for (unsigned short iVar = 0; iVar < nVar; iVar++)
+        nodes->AddUnd_Lapl(iPoint, iVar, nodes->GetSolution(jPoint,iVar) - nodes->GetSolution(iPoint,iVar));
     }
   }
 
-  delete [] Psi_mirror;
-
-#endif
-
-  delete [] Diff;
-
   /*--- MPI parallelization ---*/
 
-  InitiateComms(geometry, config, UNDIVIDED_LAPLACIAN);
-  CompleteComms(geometry, config, UNDIVIDED_LAPLACIAN);
+  SU2_OMP_MASTER
+  {
+    InitiateComms(geometry, config, UNDIVIDED_LAPLACIAN);
+    CompleteComms(geometry, config, UNDIVIDED_LAPLACIAN);
+  }
+  SU2_OMP_BARRIER
 
 }
 
 void CAdjEulerSolver::SetCentered_Dissipation_Sensor(CGeometry *geometry, CConfig *config) {
 
-  unsigned long iPoint;
-  su2double SharpEdge_Distance, eps, ds, scale, Sensor, Param_Kappa_2, Param_Kappa_4;
-
-  eps = config->GetVenkat_LimiterCoeff()*config->GetRefElemLength();
-  Param_Kappa_2 = config->GetKappa_2nd_AdjFlow();
-  Param_Kappa_4 = config->GetKappa_4th_AdjFlow();
+  su2double eps = config->GetVenkat_LimiterCoeff()*config->GetRefElemLength();
+  su2double Param_Kappa_2 = config->GetKappa_2nd_AdjFlow();
+  su2double Param_Kappa_4 = config->GetKappa_4th_AdjFlow();
 
+  su2double scale = 0.0;
   if (Param_Kappa_2 != 0.0) scale = 2.0 * Param_Kappa_4 / Param_Kappa_2;
-  else scale = 0.0;
 
-  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
 
-    SharpEdge_Distance = (geometry->node[iPoint]->GetSharpEdge_Distance() - config->GetAdjSharp_LimiterCoeff()*eps);
+    su2double SharpEdge_Distance = (geometry->node[iPoint]->GetSharpEdge_Distance() - config->GetAdjSharp_LimiterCoeff()*eps);
 
-    ds = 0.0;
+    su2double ds = 0.0;
     if (SharpEdge_Distance < -eps) ds = 1.0;
     if (fabs(SharpEdge_Distance) <= eps) ds = 1.0 - (0.5*(1.0+(SharpEdge_Distance/eps)+(1.0/PI_NUMBER)*sin(PI_NUMBER*SharpEdge_Distance/eps)));
     if (SharpEdge_Distance > eps) ds = 0.0;
 
-    Sensor = scale * ds;
-
-    nodes->SetSensor(iPoint,Sensor);
+    nodes->SetSensor(iPoint, scale * ds);
 
   }
 
   /*--- MPI parallelization ---*/
 
-  InitiateComms(geometry, config, SENSOR);
-  CompleteComms(geometry, config, SENSOR);
+  SU2_OMP_MASTER
+  {
+    InitiateComms(geometry, config, SENSOR);
+    CompleteComms(geometry, config, SENSOR);
+  }
+  SU2_OMP_BARRIER
 
 }
 
 void CAdjEulerSolver::ExplicitRK_Iteration(CGeometry *geometry, CSolver **solver_container,
                                            CConfig *config, unsigned short iRKStep) {
-  su2double *Residual, *Res_TruncError, Vol, Delta, Res;
-  unsigned short iVar;
-  unsigned long iPoint;
 
   su2double RK_AlphaCoeff = config->Get_Alpha_RKStep(iRKStep);
 
-  for (iVar = 0; iVar < nVar; iVar++) {
+  /*--- Set shared residual variables to 0 and declare
+   *    local ones for current thread to work on. ---*/
+
+  SU2_OMP_MASTER
+  for (unsigned short iVar = 0; iVar < nVar; iVar++) {
     SetRes_RMS(iVar, 0.0);
     SetRes_Max(iVar, 0.0, 0);
   }
+  SU2_OMP_BARRIER
+
+  su2double resMax[MAXNVAR] = {0.0}, resRMS[MAXNVAR] = {0.0};
+  const su2double* coordMax[MAXNVAR] = {nullptr};
+  unsigned long idxMax[MAXNVAR] = {0};
+
+  CVariable* flowNodes = solver_container[FLOW_SOL]->GetNodes();
 
   /*--- Update the solution ---*/
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-    Vol = geometry->node[iPoint]->GetVolume();
-    Delta = solver_container[FLOW_SOL]->GetNodes()->GetDelta_Time(iPoint) / Vol;
 
-    Res_TruncError = nodes->GetResTruncError(iPoint);
-    Residual = LinSysRes.GetBlock(iPoint);
+  SU2_OMP(for schedule(static,omp_chunk_size) nowait)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    su2double Vol = geometry->node[iPoint]->GetVolume();
+    su2double Delta = flowNodes->GetDelta_Time(iPoint) / Vol;
 
-    for (iVar = 0; iVar < nVar; iVar++) {
-      Res = Residual[iVar] + Res_TruncError[iVar];
+    const su2double* Res_TruncError = nodes->GetResTruncError(iPoint);
+    const su2double* Residual = LinSysRes.GetBlock(iPoint);
+
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      su2double Res = Residual[iVar] + Res_TruncError[iVar];
       nodes->AddSolution(iPoint,iVar, -Res*Delta*RK_AlphaCoeff);
-      AddRes_RMS(iVar, Res*Res);
-      AddRes_Max(iVar, fabs(Res), geometry->node[iPoint]->GetGlobalIndex(), geometry->node[iPoint]->GetCoord());
+
+      /*--- Update residual information for current thread. ---*/
+      resRMS[iVar] += Res*Res;
+      if (fabs(Res) > resMax[iVar]) {
+        resMax[iVar] = fabs(Res);
+        idxMax[iVar] = iPoint;
+        coordMax[iVar] = geometry->node[iPoint]->GetCoord();
+      }
     }
 
   }
+  SU2_OMP_CRITICAL
+  for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+    AddRes_RMS(iVar, resRMS[iVar]);
+    AddRes_Max(iVar, resMax[iVar], geometry->node[idxMax[iVar]]->GetGlobalIndex(), coordMax[iVar]);
+  }
+  SU2_OMP_BARRIER
 
-  /*--- MPI solution ---*/
+  SU2_OMP_MASTER
+  {
+    /*--- MPI solution ---*/
 
-  InitiateComms(geometry, config, SOLUTION);
-  CompleteComms(geometry, config, SOLUTION);
+    InitiateComms(geometry, config, SOLUTION);
+    CompleteComms(geometry, config, SOLUTION);
 
-  /*--- Compute the root mean square residual ---*/
-  SetResidual_RMS(geometry, config);
+    /*--- Compute the root mean square residual ---*/
+
+    SetResidual_RMS(geometry, config);
+  }
+  SU2_OMP_BARRIER
 
 }
 
 void CAdjEulerSolver::ExplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
-  su2double *local_Residual, *local_Res_TruncError, Vol, Delta, Res;
-  unsigned short iVar;
-  unsigned long iPoint;
 
-  for (iVar = 0; iVar < nVar; iVar++) {
+  /*--- Set shared residual variables to 0 and declare
+   *    local ones for current thread to work on. ---*/
+
+  SU2_OMP_MASTER
+  for (unsigned short iVar = 0; iVar < nVar; iVar++) {
     SetRes_RMS(iVar, 0.0);
     SetRes_Max(iVar, 0.0, 0);
   }
+  SU2_OMP_BARRIER
+
+  su2double resMax[MAXNVAR] = {0.0}, resRMS[MAXNVAR] = {0.0};
+  const su2double* coordMax[MAXNVAR] = {nullptr};
+  unsigned long idxMax[MAXNVAR] = {0};
+
+  CVariable* flowNodes = solver_container[FLOW_SOL]->GetNodes();
 
   /*--- Update the solution ---*/
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-    Vol = geometry->node[iPoint]->GetVolume();
-    Delta = solver_container[FLOW_SOL]->GetNodes()->GetDelta_Time(iPoint) / Vol;
 
-    local_Res_TruncError = nodes->GetResTruncError(iPoint);
-    local_Residual = LinSysRes.GetBlock(iPoint);
+  SU2_OMP(for schedule(static,omp_chunk_size) nowait)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    su2double Vol = geometry->node[iPoint]->GetVolume();
+    su2double Delta = flowNodes->GetDelta_Time(iPoint) / Vol;
 
-    for (iVar = 0; iVar < nVar; iVar++) {
-      Res = local_Residual[iVar] + local_Res_TruncError[iVar];
+    const su2double* local_Res_TruncError = nodes->GetResTruncError(iPoint);
+    const su2double* local_Residual = LinSysRes.GetBlock(iPoint);
+
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      su2double Res = local_Residual[iVar] + local_Res_TruncError[iVar];
       nodes->AddSolution(iPoint,iVar, -Res*Delta);
-      AddRes_RMS(iVar, Res*Res);
-      AddRes_Max(iVar, fabs(Res), geometry->node[iPoint]->GetGlobalIndex(), geometry->node[iPoint]->GetCoord());
+
+      /*--- Update residual information for current thread. ---*/
+      resRMS[iVar] += Res*Res;
+      if (fabs(Res) > resMax[iVar]) {
+        resMax[iVar] = fabs(Res);
+        idxMax[iVar] = iPoint;
+        coordMax[iVar] = geometry->node[iPoint]->GetCoord();
+      }
     }
 
   }
+  SU2_OMP_CRITICAL
+  for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+    AddRes_RMS(iVar, resRMS[iVar]);
+    AddRes_Max(iVar, resMax[iVar], geometry->node[idxMax[iVar]]->GetGlobalIndex(), coordMax[iVar]);
+  }
+  SU2_OMP_BARRIER
 
-  /*--- MPI solution ---*/
+  SU2_OMP_MASTER
+  {
+    /*--- MPI solution ---*/
 
-  InitiateComms(geometry, config, SOLUTION);
-  CompleteComms(geometry, config, SOLUTION);
+    InitiateComms(geometry, config, SOLUTION);
+    CompleteComms(geometry, config, SOLUTION);
 
-  /*--- Compute the root mean square residual ---*/
-  SetResidual_RMS(geometry, config);
+    /*--- Compute the root mean square residual ---*/
+
+    SetResidual_RMS(geometry, config);
+  }
+  SU2_OMP_BARRIER
 
 }
 
 void CAdjEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
 
-  unsigned short iVar;
-  unsigned long iPoint, total_index;
-  su2double Delta, *local_Res_TruncError, Vol;
-
-  /*--- Set maximum residual to zero ---*/
+  /*--- Set shared residual variables to 0 and declare
+   *    local ones for current thread to work on. ---*/
 
-  for (iVar = 0; iVar < nVar; iVar++) {
+  SU2_OMP_MASTER
+  for (unsigned short iVar = 0; iVar < nVar; iVar++) {
     SetRes_RMS(iVar, 0.0);
     SetRes_Max(iVar, 0.0, 0);
   }
+  SU2_OMP_BARRIER
+
+  su2double resMax[MAXNVAR] = {0.0}, resRMS[MAXNVAR] = {0.0};
+  const su2double* coordMax[MAXNVAR] = {nullptr};
+  unsigned long idxMax[MAXNVAR] = {0};
+
+  CVariable* flowNodes = solver_container[FLOW_SOL]->GetNodes();
 
   /*--- Build implicit system ---*/
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+  SU2_OMP(for schedule(static,omp_chunk_size) nowait)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
     /*--- Read the residual ---*/
 
-    local_Res_TruncError = nodes->GetResTruncError(iPoint);
+    su2double* local_Res_TruncError = nodes->GetResTruncError(iPoint);
 
     /*--- Read the volume ---*/
 
-    Vol = geometry->node[iPoint]->GetVolume();
+    su2double Vol = geometry->node[iPoint]->GetVolume();
 
     /*--- Modify matrix diagonal to assure diagonal dominance ---*/
 
-    if (solver_container[FLOW_SOL]->GetNodes()->GetDelta_Time(iPoint) != 0.0) {
-      Delta = Vol / solver_container[FLOW_SOL]->GetNodes()->GetDelta_Time(iPoint);
+    if (flowNodes->GetDelta_Time(iPoint) != 0.0) {
+      su2double Delta = Vol / flowNodes->GetDelta_Time(iPoint);
       Jacobian.AddVal2Diag(iPoint, Delta);
     }
     else {
       Jacobian.SetVal2Diag(iPoint, 1.0);
-      for (iVar = 0; iVar < nVar; iVar++) {
-        total_index = iPoint*nVar + iVar;
-        LinSysRes[total_index] = 0.0;
+      for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+        LinSysRes(iPoint,iVar) = 0.0;
         local_Res_TruncError[iVar] = 0.0;
       }
     }
 
     /*--- Right hand side of the system (-Residual) and initial guess (x = 0) ---*/
 
-    for (iVar = 0; iVar < nVar; iVar++) {
-      total_index = iPoint*nVar+iVar;
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      unsigned long total_index = iPoint*nVar+iVar;
       LinSysRes[total_index] = -(LinSysRes[total_index] + local_Res_TruncError[iVar]);
       LinSysSol[total_index] = 0.0;
-      AddRes_RMS(iVar, LinSysRes[total_index]*LinSysRes[total_index]);
-      AddRes_Max(iVar, fabs(LinSysRes[total_index]), geometry->node[iPoint]->GetGlobalIndex(), geometry->node[iPoint]->GetCoord());
+
+      su2double Res = fabs(LinSysRes[total_index]);
+      resRMS[iVar] += Res*Res;
+      if (Res > resMax[iVar]) {
+        resMax[iVar] = Res;
+        idxMax[iVar] = iPoint;
+        coordMax[iVar] = geometry->node[iPoint]->GetCoord();
+      }
     }
 
   }
+  SU2_OMP_CRITICAL
+  for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+    AddRes_RMS(iVar, resRMS[iVar]);
+    AddRes_Max(iVar, resMax[iVar], geometry->node[idxMax[iVar]]->GetGlobalIndex(), coordMax[iVar]);
+  }
 
   /*--- Initialize residual and solution at the ghost points ---*/
 
-  for (iPoint = nPointDomain; iPoint < nPoint; iPoint++) {
-    for (iVar = 0; iVar < nVar; iVar++) {
-      total_index = iPoint*nVar + iVar;
-      LinSysRes[total_index] = 0.0;
-      LinSysSol[total_index] = 0.0;
-    }
+  SU2_OMP(sections)
+  {
+    SU2_OMP(section)
+    for (unsigned long iPoint = nPointDomain; iPoint < nPoint; iPoint++)
+      LinSysRes.SetBlock_Zero(iPoint);
+
+    SU2_OMP(section)
+    for (unsigned long iPoint = nPointDomain; iPoint < nPoint; iPoint++)
+      LinSysSol.SetBlock_Zero(iPoint);
   }
 
   /*--- Solve or smooth the linear system ---*/
@@ -2299,27 +2413,34 @@ void CAdjEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **sol
 
   /*--- Update solution (system written in terms of increments) ---*/
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
-    for (iVar = 0; iVar < nVar; iVar++) {
-      nodes->AddSolution(iPoint,iVar, config->GetRelaxation_Factor_AdjFlow()*LinSysSol[iPoint*nVar+iVar]);
+  const su2double relax = config->GetRelaxation_Factor_AdjFlow();
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      nodes->AddSolution(iPoint,iVar, relax*LinSysSol[iPoint*nVar+iVar]);
     }
 
-  /*--- MPI solution ---*/
+  SU2_OMP_MASTER
+  {
+    /*--- MPI solution ---*/
 
-  InitiateComms(geometry, config, SOLUTION);
-  CompleteComms(geometry, config, SOLUTION);
+    InitiateComms(geometry, config, SOLUTION);
+    CompleteComms(geometry, config, SOLUTION);
 
-  /*--- Compute the root mean square residual ---*/
+    /*--- Compute the root mean square residual ---*/
 
-  SetResidual_RMS(geometry, config);
+    SetResidual_RMS(geometry, config);
+  }
+  SU2_OMP_BARRIER
 
 }
 
 void CAdjEulerSolver::Inviscid_Sensitivity(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics, CConfig *config) {
 
-  unsigned long iVertex, iPoint, Neigh;
+  unsigned long iVertex, iPoint;
   unsigned short iPos, jPos;
-  unsigned short iDim, iMarker, iNeigh;
+  unsigned short iDim, iMarker;
   su2double *d = NULL, *Normal = NULL, *Psi = NULL, *U = NULL, Enthalpy, conspsi = 0.0, Mach_Inf,
   Area, **PrimVar_Grad = NULL, *ConsPsi_Grad = NULL,
   ConsPsi, d_press, grad_v, v_gradconspsi, UnitNormal[3], *GridVel = NULL,
@@ -2371,6 +2492,12 @@ void CAdjEulerSolver::Inviscid_Sensitivity(CGeometry *geometry, CSolver **solver
 
   }
 
+  /*--- Sensitivities are removed near sharp edges, if requested. ---*/
+
+  const bool remove_sharp = config->GetSens_Remove_Sharp();
+  eps = config->GetVenkat_LimiterCoeff()*config->GetRefElemLength();
+  const su2double sharp_limit = config->GetAdjSharp_LimiterCoeff()*eps;
+
   /*--- Initialize sensitivities to zero ---*/
 
   Total_Sens_Geo = 0.0;
@@ -2380,38 +2507,19 @@ void CAdjEulerSolver::Inviscid_Sensitivity(CGeometry *geometry, CSolver **solver
   Total_Sens_Temp = 0.0;
   Total_Sens_BPress = 0.0;
 
-  /*--- Loop over boundary markers to select those for Euler walls ---*/
-
-  for (iMarker = 0; iMarker < nMarker; iMarker++)
+  /*--- Store the auxiliary variable at the points of the surface gradient stencils
+   *    (wall points and their first neighbors), each point is visited only once. ---*/
 
-    if (config->GetMarker_All_KindBC(iMarker) == EULER_WALL)
+  CVariable* flowNodes = solver_container[FLOW_SOL]->GetNodes();
 
-    /*--- Loop over points on the surface to store the auxiliary variable ---*/
-
-      for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-        if (geometry->node[iPoint]->GetDomain()) {
-          Psi = nodes->GetSolution(iPoint);
-          U = solver_container[FLOW_SOL]->GetNodes()->GetSolution(iPoint);
-          Enthalpy = solver_container[FLOW_SOL]->GetNodes()->GetEnthalpy(iPoint);
-          conspsi = U[0]*Psi[0] + U[0]*Enthalpy*Psi[nDim+1];
-          for (iDim = 0; iDim < nDim; iDim++) conspsi += U[iDim+1]*Psi[iDim+1];
-
-          nodes->SetAuxVar(iPoint,conspsi);
-
-          /*--- Also load the auxiliary variable for first neighbors ---*/
-
-          for (iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); iNeigh++) {
-            Neigh = geometry->node[iPoint]->GetPoint(iNeigh);
-            Psi = nodes->GetSolution(Neigh);
-            U = solver_container[FLOW_SOL]->GetNodes()->GetSolution(Neigh);
-            Enthalpy = solver_container[FLOW_SOL]->GetNodes()->GetEnthalpy(Neigh);
-            conspsi = U[0]*Psi[0] + U[0]*Enthalpy*Psi[nDim+1];
-            for (iDim = 0; iDim < nDim; iDim++) conspsi += U[iDim+1]*Psi[iDim+1];
-            nodes->SetAuxVar(Neigh,conspsi);
-          }
-        }
-      }
+  for (auto iPoint : SetAuxVar_Surface_Stencil(geometry, config)) {
+    Psi = nodes->GetSolution(iPoint);
+    U = flowNodes->GetSolution(iPoint);
+    Enthalpy = flowNodes->GetEnthalpy(iPoint);
+    conspsi = U[0]*Psi[0] + U[0]*Enthalpy*Psi[nDim+1];
+    for (iDim = 0; iDim < nDim; iDim++) conspsi += U[iDim+1]*Psi[iDim+1];
+    nodes->SetAuxVar(iPoint,conspsi);
+  }
 
   /*--- Compute surface gradients of the auxiliary variable ---*/
 
@@ -2468,11 +2576,8 @@ void CAdjEulerSolver::Inviscid_Sensitivity(CGeometry *geometry, CSolver **solver
 
           /*--- If sharp edge, set the sensitivity to 0 on that region ---*/
 
-          if (config->GetSens_Remove_Sharp()) {
-            eps = config->GetVenkat_LimiterCoeff()*config->GetRefElemLength();
-            if ( geometry->node[iPoint]->GetSharpEdge_Distance() < config->GetAdjSharp_LimiterCoeff()*eps )
-              CSensitivity[iMarker][iVertex] = 0.0;
-          }
+          if (remove_sharp && (geometry->node[iPoint]->GetSharpEdge_Distance() < sharp_limit))
+            CSensitivity[iMarker][iVertex] = 0.0;
 
           Sens_Geo[iMarker] -= CSensitivity[iMarker][iVertex];
 
@@ -2767,23 +2872,16 @@ void CAdjEulerSolver::Inviscid_Sensitivity(CGeometry *geometry, CSolver **solver
   }
 
 
-#ifdef HAVE_MPI
+  /*--- Reduce all the totals at once. ---*/
 
-  su2double MyTotal_Sens_Geo   = Total_Sens_Geo;     Total_Sens_Geo = 0.0;
-  su2double MyTotal_Sens_Mach  = Total_Sens_Mach;    Total_Sens_Mach = 0.0;
-  su2double MyTotal_Sens_AoA   = Total_Sens_AoA;     Total_Sens_AoA = 0.0;
-  su2double MyTotal_Sens_Press = Total_Sens_Press;   Total_Sens_Press = 0.0;
-  su2double MyTotal_Sens_Temp  = Total_Sens_Temp;    Total_Sens_Temp = 0.0;
-  su2double MyTotal_Sens_BPress  = Total_Sens_BPress;    Total_Sens_BPress = 0.0;
+  su2double MyTotal_Sens[6] = {Total_Sens_Geo, Total_Sens_Mach, Total_Sens_AoA,
+                               Total_Sens_Press, Total_Sens_Temp, Total_Sens_BPress}, Total_Sens[6];
 
-  SU2_MPI::Allreduce(&MyTotal_Sens_Geo, &Total_Sens_Geo, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyTotal_Sens_Mach, &Total_Sens_Mach, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyTotal_Sens_AoA, &Total_Sens_AoA, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyTotal_Sens_Press, &Total_Sens_Press, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyTotal_Sens_Temp, &Total_Sens_Temp, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyTotal_Sens_BPress, &Total_Sens_BPress, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(MyTotal_Sens, Total_Sens, 6, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
 
-#endif
+  Total_Sens_Geo   = Total_Sens[0];  Total_Sens_Mach  = Total_Sens[1];
+  Total_Sens_AoA   = Total_Sens[2];  Total_Sens_Press = Total_Sens[3];
+  Total_Sens_Temp  = Total_Sens[4];  Total_Sens_BPress = Total_Sens[5];
 
   delete [] USens;
   delete [] Velocity;
@@ -4726,20 +4824,30 @@ void CAdjEulerSolver::BC_ActDisk(CGeometry *geometry, CSolver **solver_container
 
 void CAdjEulerSolver::SetResidual_DualTime(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iRKStep,
                                            unsigned short iMesh, unsigned short RunTime_EqSystem) {
-  unsigned short iVar, jVar;
-  unsigned long iPoint;
-  su2double *U_time_nM1, *U_time_n, *U_time_nP1, Volume_nM1, Volume_n, Volume_nP1, TimeStep;
 
   bool implicit = (config->GetKind_TimeIntScheme_AdjFlow() == EULER_IMPLICIT);
   bool Grid_Movement = config->GetGrid_Movement();
 
+  /*--- Time Step ---*/
+  const su2double TimeStep = config->GetDelta_UnstTimeND();
+
+  /*--- Static arrays for the residual and Jacobian of each point (thread safety). ---*/
+  su2double residual[MAXNVAR] = {0.0}, jacobian_i[MAXNVAR][MAXNVAR] = {{0.0}};
+  su2double *Jac_i[MAXNVAR];
+  for (unsigned short iVar = 0; iVar < MAXNVAR; iVar++)
+    Jac_i[iVar] = jacobian_i[iVar];
+
   /*--- loop over points ---*/
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+
+    unsigned short iVar, jVar;
+    su2double Volume_nM1, Volume_n, Volume_nP1;
 
     /*--- Solution at time n-1, n and n+1 ---*/
-    U_time_nM1 = nodes->GetSolution_time_n1(iPoint);
-    U_time_n   = nodes->GetSolution_time_n(iPoint);
-    U_time_nP1 = nodes->GetSolution(iPoint);
+    const su2double* U_time_nM1 = nodes->GetSolution_time_n1(iPoint);
+    const su2double* U_time_n   = nodes->GetSolution_time_n(iPoint);
+    const su2double* U_time_nP1 = nodes->GetSolution(iPoint);
 
     /*--- Volume at time n-1 and n ---*/
     if (Grid_Movement) {
@@ -4753,32 +4861,29 @@ void CAdjEulerSolver::SetResidual_DualTime(CGeometry *geometry, CSolver **solver
       Volume_nP1 = geometry->node[iPoint]->GetVolume();
     }
 
-    /*--- Time Step ---*/
-    TimeStep = config->GetDelta_UnstTimeND();
-
     /*--- Compute Residual ---*/
     for (iVar = 0; iVar < nVar; iVar++) {
       if (config->GetTime_Marching() == DT_STEPPING_1ST)
-        Residual[iVar] = ( U_time_nP1[iVar]*Volume_nP1 - U_time_n[iVar]*Volume_n ) / TimeStep;
+        residual[iVar] = ( U_time_nP1[iVar]*Volume_nP1 - U_time_n[iVar]*Volume_n ) / TimeStep;
       if (config->GetTime_Marching() == DT_STEPPING_2ND)
-        Residual[iVar] = ( 3.0*U_time_nP1[iVar]*Volume_nP1 - 4.0*U_time_n[iVar]*Volume_n
+        residual[iVar] = ( 3.0*U_time_nP1[iVar]*Volume_nP1 - 4.0*U_time_n[iVar]*Volume_n
                           +  1.0*U_time_nM1[iVar]*Volume_nM1 ) / (2.0*TimeStep);
     }
 
     /*--- Add Residual ---*/
-    LinSysRes.AddBlock(iPoint, Residual);
+    LinSysRes.AddBlock(iPoint, residual);
 
     if (implicit) {
       for (iVar = 0; iVar < nVar; iVar++) {
         for (jVar = 0; jVar < nVar; jVar++)
-          Jacobian_i[iVar][jVar] = 0.0;
+          Jac_i[iVar][jVar] = 0.0;
 
         if (config->GetTime_Marching() == DT_STEPPING_1ST)
-          Jacobian_i[iVar][iVar] = Volume_nP1 / TimeStep;
+          Jac_i[iVar][iVar] = Volume_nP1 / TimeStep;
         if (config->GetTime_Marching() == DT_STEPPING_2ND)
-          Jacobian_i[iVar][iVar] = (Volume_nP1*3.0)/(2.0*TimeStep);
+          Jac_i[iVar][iVar] = (Volume_nP1*3.0)/(2.0*TimeStep);
       }
-      Jacobian.AddBlock2Diag(iPoint, Jacobian_i);
+      Jacobian.AddBlock2Diag(iPoint, Jac_i);
     }
   }
 
@@ -4821,27 +4926,24 @@ void CAdjEulerSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConf
   unsigned long iPoint_Global_Local = 0;
   unsigned short rbuf_NotMatching = 0, sbuf_NotMatching = 0;
 
-  for (iPoint_Global = 0; iPoint_Global < geometry[MESH_0]->GetGlobal_nPointDomain(); iPoint_Global++ ) {
+  for (const auto& globalToLocal : geometry[MESH_0]->GetGlobal_to_Local_Map()) {
 
-    /*--- Retrieve local index. If this node from the restart file lives
-     on the current processor, we will load and instantiate the vars. ---*/
+    /*--- The points of this rank, in the order of their data in the restart file. ---*/
 
-    iPoint_Local = geometry[MESH_0]->GetGlobal_to_Local_Point(iPoint_Global);
+    iPoint_Global = globalToLocal.first;
+    iPoint_Local = globalToLocal.second;
 
-    if (iPoint_Local > -1) {
+    /*--- We need to store this point's data, so jump to the correct
+     offset in the buffer of data from the restart file and load it. ---*/
 
-      /*--- We need to store this point's data, so jump to the correct
-       offset in the buffer of data from the restart file and load it. ---*/
+    index = counter*Restart_Vars[1] + skipVars;
+    for (iVar = 0; iVar < nVar; iVar++) Solution[iVar] = Restart_Data[index+iVar];
 
-      index = counter*Restart_Vars[1] + skipVars;
-      for (iVar = 0; iVar < nVar; iVar++) Solution[iVar] = Restart_Data[index+iVar];
+    nodes->SetSolution(iPoint_Local,Solution);
+    iPoint_Global_Local++;
 
-      nodes->SetSolution(iPoint_Local,Solution);
-      iPoint_Global_Local++;
-
-      /*--- Increment the overall counter for how many points have been loaded. ---*/
-      counter++;
-    }
+    /*--- Increment the overall counter for how many points have been loaded. ---*/
+    counter++;
   }
 
   /*--- Detect a wrong solution file ---*/
@@ -151,6 +151,10 @@ CAdjNSSolver::CAdjNSSolver(CGeometry *geometry, CConfig *config, unsigned short
       cout << "Explicit scheme. No Jacobian structure (Adjoint N-S). MG level: " << iMesh <<"." << endl;
   }
 
+  /*--- Edge coloring and chunk sizes for the OpenMP loops. ---*/
+
+  SetEdgeColoring(geometry, config);
+
   /*--- Array structures for computation of gradients by least squares ---*/
   if (config->GetLeastSquaresRequired()) {
     /*--- S matrix := inv(R)*traspose(inv(R)) ---*/
@@ -329,10 +333,6 @@ void CAdjNSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container,
 
 void CAdjNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iMesh, unsigned short iRKStep, unsigned short RunTime_EqSystem, bool Output) {
 
-  unsigned long iPoint, nonPhysicalPoints = 0;
-  su2double SharpEdge_Distance;
-  bool physical = true;
-
   /*--- Retrieve information about the spatial and temporal integration for the
    adjoint equations (note that the flow problem may use different methods). ---*/
 
@@ -344,20 +344,31 @@ void CAdjNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
 
   /*--- Update the objective function coefficient to guarantee zero gradient. ---*/
 
-  if (fixed_cl && eval_dof_dcx) { SetFarfield_AoA(geometry, solver_container, config, iMesh, Output); }
+  if (fixed_cl && eval_dof_dcx) {
+    SU2_OMP_MASTER
+    SetFarfield_AoA(geometry, solver_container, config, iMesh, Output);
+    SU2_OMP_BARRIER
+  }
 
   /*--- Residual initialization ---*/
 
-  for (iPoint = 0; iPoint < nPoint; iPoint ++) {
+  SU2_OMP_MASTER
+  ErrorCounter = 0;
+  SU2_OMP_BARRIER
+
+  unsigned long nonPhysicalPoints = 0;
+
+  SU2_OMP(for schedule(static,omp_chunk_size) nowait)
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint ++) {
 
     /*--- Get the distance form a sharp edge ---*/
 
-    SharpEdge_Distance = geometry->node[iPoint]->GetSharpEdge_Distance();
+    su2double SharpEdge_Distance = geometry->node[iPoint]->GetSharpEdge_Distance();
 
     /*--- Set the primitive variables compressible
      adjoint variables ---*/
 
-    physical = nodes->SetPrimVar(iPoint,SharpEdge_Distance, false, config);
+    bool physical = nodes->SetPrimVar(iPoint,SharpEdge_Distance, false, config);
 
     /* Check for non-realizable states for reporting. */
 
@@ -368,6 +379,9 @@ void CAdjNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
     if (!Output) LinSysRes.SetBlock_Zero(iPoint);
 
   }
+  SU2_OMP_ATOMIC
+  ErrorCounter += nonPhysicalPoints;
+  SU2_OMP_BARRIER
 
   /*--- Compute gradients adj for solution reconstruction and viscous term ---*/
 
@@ -407,11 +421,13 @@ void CAdjNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
   /*--- Error message ---*/
 
   if (config->GetComm_Level() == COMM_FULL) {
-#ifdef HAVE_MPI
-    unsigned long MyErrorCounter = nonPhysicalPoints; nonPhysicalPoints = 0;
-    SU2_MPI::Allreduce(&MyErrorCounter, &nonPhysicalPoints, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
-#endif
-    if (iMesh == MESH_0) config->SetNonphysical_Points(nonPhysicalPoints);
+    SU2_OMP_MASTER
+    {
+      unsigned long tmp = ErrorCounter;
+      SU2_MPI::Allreduce(&tmp, &ErrorCounter, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+      if (iMesh == MESH_0) config->SetNonphysical_Points(ErrorCounter);
+    }
+    SU2_OMP_BARRIER
   }
 
 }
@@ -419,26 +435,43 @@ void CAdjNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
 void CAdjNSSolver::Viscous_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
                                     CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
 
-  CNumerics* numerics = numerics_container[VISC_TERM];
-
-  unsigned long iPoint, jPoint, iEdge;
+  /*--- Pick one numerics object per thread. ---*/
+  CNumerics* numerics = numerics_container[VISC_TERM + omp_get_thread_num()*MAX_TERMS];
 
   bool implicit = (config->GetKind_TimeIntScheme_AdjFlow() == EULER_IMPLICIT);
 
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  CVariable* flowNodes = solver_container[FLOW_SOL]->GetNodes();
+
+  /*--- Static arrays for the residuals and Jacobians of each edge (thread safety). ---*/
+  su2double residual_i[MAXNVAR] = {0.0}, residual_j[MAXNVAR] = {0.0};
+  su2double jacobian_ii[MAXNVAR][MAXNVAR] = {{0.0}}, jacobian_ij[MAXNVAR][MAXNVAR] = {{0.0}},
+            jacobian_ji[MAXNVAR][MAXNVAR] = {{0.0}}, jacobian_jj[MAXNVAR][MAXNVAR] = {{0.0}};
+  su2double *Jac_ii[MAXNVAR], *Jac_ij[MAXNVAR], *Jac_ji[MAXNVAR], *Jac_jj[MAXNVAR];
+  for (unsigned short iVar = 0; iVar < MAXNVAR; iVar++) {
+    Jac_ii[iVar] = jacobian_ii[iVar]; Jac_ij[iVar] = jacobian_ij[iVar];
+    Jac_ji[iVar] = jacobian_ji[iVar]; Jac_jj[iVar] = jacobian_jj[iVar];
+  }
+
+  /*--- Loop over edge colors. ---*/
+  for (auto color : EdgeColoring)
+  {
+  /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+  SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+  for(auto k = 0ul; k < color.size; ++k) {
+
+    auto iEdge = color.indices[k];
 
     /*--- Points in edge, coordinates and normal vector---*/
 
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
+    unsigned long iPoint = geometry->edge[iEdge]->GetNode(0);
+    unsigned long jPoint = geometry->edge[iEdge]->GetNode(1);
 
     numerics->SetCoord(geometry->node[iPoint]->GetCoord(), geometry->node[jPoint]->GetCoord());
     numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
 
     /*--- Primitive variables w/o reconstruction and adjoint variables w/o reconstruction---*/
 
-    numerics->SetPrimitive(solver_container[FLOW_SOL]->GetNodes()->GetPrimitive(iPoint),
-                           solver_container[FLOW_SOL]->GetNodes()->GetPrimitive(jPoint));
+    numerics->SetPrimitive(flowNodes->GetPrimitive(iPoint), flowNodes->GetPrimitive(jPoint));
 
     numerics->SetAdjointVar(nodes->GetSolution(iPoint), nodes->GetSolution(jPoint));
 
@@ -448,45 +481,58 @@ void CAdjNSSolver::Viscous_Residual(CGeometry *geometry, CSolver **solver_contai
 
     /*--- Compute residual ---*/
 
-    numerics->ComputeResidual(Residual_i, Residual_j, Jacobian_ii, Jacobian_ij, Jacobian_ji, Jacobian_jj, config);
+    numerics->ComputeResidual(residual_i, residual_j, Jac_ii, Jac_ij, Jac_ji, Jac_jj, config);
 
     /*--- Update adjoint viscous residual ---*/
 
-    LinSysRes.SubtractBlock(iPoint, Residual_i);
-    LinSysRes.AddBlock(jPoint, Residual_j);
+    LinSysRes.SubtractBlock(iPoint, residual_i);
+    LinSysRes.AddBlock(jPoint, residual_j);
 
     if (implicit) {
-      Jacobian.SubtractBlock2Diag(iPoint, Jacobian_ii);
-      Jacobian.SubtractBlock(iPoint, jPoint, Jacobian_ij);
-      Jacobian.AddBlock(jPoint, iPoint, Jacobian_ji);
-      Jacobian.AddBlock2Diag(jPoint, Jacobian_jj);
+      Jacobian.SubtractBlock2Diag(iPoint, Jac_ii);
+      Jacobian.SubtractBlock(iPoint, jPoint, Jac_ij);
+      Jacobian.AddBlock(jPoint, iPoint, Jac_ji);
+      Jacobian.AddBlock2Diag(jPoint, Jac_jj);
     }
 
   }
+  } // end color loop
 
 }
 
 void CAdjNSSolver::Source_Residual(CGeometry *geometry, CSolver **solver_container,
                                    CNumerics **numerics_container, CConfig *config, unsigned short iMesh) {
 
-  CNumerics* numerics = numerics_container[SOURCE_FIRST_TERM];
-  CNumerics* second_numerics = numerics_container[SOURCE_SECOND_TERM];
-
-  unsigned long iPoint, jPoint, iEdge;
+  /*--- Pick one numerics object per thread. ---*/
+  const int thread = omp_get_thread_num();
+  CNumerics* numerics = numerics_container[SOURCE_FIRST_TERM + thread*MAX_TERMS];
+  CNumerics* second_numerics = numerics_container[SOURCE_SECOND_TERM + thread*MAX_TERMS];
 
   bool implicit = (config->GetKind_TimeIntScheme_AdjFlow() == EULER_IMPLICIT);
   bool rotating_frame = config->GetRotating_Frame();
+  bool adj_rans = (config->GetKind_Solver() == ADJ_RANS) && (!config->GetFrozen_Visc_Cont());
+
+  CVariable* flowNodes = solver_container[FLOW_SOL]->GetNodes();
+  CVariable* turbNodes = adj_rans? solver_container[TURB_SOL]->GetNodes() : nullptr;
+  CVariable* adjTurbNodes = adj_rans? solver_container[ADJTURB_SOL]->GetNodes() : nullptr;
+
+  /*--- Static arrays for the residual and Jacobian of each point or edge (thread safety). ---*/
+  su2double residual[MAXNVAR] = {0.0}, jacobian_i[MAXNVAR][MAXNVAR] = {{0.0}};
+  su2double *Jac_i[MAXNVAR];
+  for (unsigned short iVar = 0; iVar < MAXNVAR; iVar++)
+    Jac_i[iVar] = jacobian_i[iVar];
 
   /*--- Loop over all the points, note that we are supposing that primitive and
    adjoint gradients have been computed previously ---*/
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
     /*--- Primitive variables w/o reconstruction, and its gradient ---*/
 
-    numerics->SetPrimitive(solver_container[FLOW_SOL]->GetNodes()->GetPrimitive(iPoint), NULL);
+    numerics->SetPrimitive(flowNodes->GetPrimitive(iPoint), NULL);
 
-    numerics->SetPrimVarGradient(solver_container[FLOW_SOL]->GetNodes()->GetGradient_Primitive(iPoint), NULL);
+    numerics->SetPrimVarGradient(flowNodes->GetGradient_Primitive(iPoint), NULL);
 
     /*--- Gradient of adjoint variables ---*/
 
@@ -498,19 +544,19 @@ void CAdjNSSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
 
     /*--- If turbulence computation we must add some coupling terms to the NS adjoint eq. ---*/
 
-    if ((config->GetKind_Solver() == ADJ_RANS) && (!config->GetFrozen_Visc_Cont())) {
+    if (adj_rans) {
 
       /*--- Turbulent variables w/o reconstruction and its gradient ---*/
 
-      numerics->SetTurbVar(solver_container[TURB_SOL]->GetNodes()->GetSolution(iPoint), NULL);
+      numerics->SetTurbVar(turbNodes->GetSolution(iPoint), NULL);
 
-      numerics->SetTurbVarGradient(solver_container[TURB_SOL]->GetNodes()->GetGradient(iPoint), NULL);
+      numerics->SetTurbVarGradient(turbNodes->GetGradient(iPoint), NULL);
 
       /*--- Turbulent adjoint variables w/o reconstruction and its gradient ---*/
 
-      numerics->SetTurbAdjointVar(solver_container[ADJTURB_SOL]->GetNodes()->GetSolution(iPoint), NULL);
+      numerics->SetTurbAdjointVar(adjTurbNodes->GetSolution(iPoint), NULL);
 
-      numerics->SetTurbAdjointGradient(solver_container[ADJTURB_SOL]->GetNodes()->GetGradient(iPoint), NULL);
+      numerics->SetTurbAdjointGradient(adjTurbNodes->GetGradient(iPoint), NULL);
 
       /*--- Set distance to the surface ---*/
 
@@ -520,50 +566,54 @@ void CAdjNSSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
 
     /*--- Compute residual ---*/
 
-    numerics->ComputeResidual(Residual, config);
+    numerics->ComputeResidual(residual, config);
 
     /*--- Add to the residual ---*/
 
-    LinSysRes.AddBlock(iPoint, Residual);
+    LinSysRes.AddBlock(iPoint, residual);
 
   }
 
   /*--- If turbulence computation we must add some coupling terms to the NS adjoint eq. ---*/
 
-  if ((config->GetKind_Solver() == ADJ_RANS) && (!config->GetFrozen_Visc_Cont())) {
+  if (adj_rans) {
 
-    for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+    /*--- Loop over edge colors. ---*/
+    for (auto color : EdgeColoring)
+    {
+    /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+    SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+    for(auto k = 0ul; k < color.size; ++k) {
+
+      auto iEdge = color.indices[k];
 
       /*--- Points in edge, and normal vector ---*/
 
-      iPoint = geometry->edge[iEdge]->GetNode(0);
-      jPoint = geometry->edge[iEdge]->GetNode(1);
+      unsigned long iPoint = geometry->edge[iEdge]->GetNode(0);
+      unsigned long jPoint = geometry->edge[iEdge]->GetNode(1);
       second_numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
 
       /*--- Conservative variables w/o reconstruction ---*/
 
-      second_numerics->SetConservative(solver_container[FLOW_SOL]->GetNodes()->GetSolution(iPoint),
-                                     solver_container[FLOW_SOL]->GetNodes()->GetSolution(jPoint));
+      second_numerics->SetConservative(flowNodes->GetSolution(iPoint), flowNodes->GetSolution(jPoint));
 
       /*--- Gradient of primitive variables w/o reconstruction ---*/
 
-      second_numerics->SetPrimVarGradient(solver_container[FLOW_SOL]->GetNodes()->GetGradient_Primitive(iPoint),
-                                        solver_container[FLOW_SOL]->GetNodes()->GetGradient_Primitive(jPoint));
+      second_numerics->SetPrimVarGradient(flowNodes->GetGradient_Primitive(iPoint),
+                                          flowNodes->GetGradient_Primitive(jPoint));
 
       /*--- Viscosity ---*/
 
-      second_numerics->SetLaminarViscosity(solver_container[FLOW_SOL]->GetNodes()->GetLaminarViscosity(iPoint),
-                                         solver_container[FLOW_SOL]->GetNodes()->GetLaminarViscosity(jPoint));
+      second_numerics->SetLaminarViscosity(flowNodes->GetLaminarViscosity(iPoint),
+                                           flowNodes->GetLaminarViscosity(jPoint));
 
       /*--- Turbulent variables w/o reconstruction ---*/
 
-      second_numerics->SetTurbVar(solver_container[TURB_SOL]->GetNodes()->GetSolution(iPoint),
-                                solver_container[TURB_SOL]->GetNodes()->GetSolution(jPoint));
+      second_numerics->SetTurbVar(turbNodes->GetSolution(iPoint), turbNodes->GetSolution(jPoint));
 
       /*--- Turbulent adjoint variables w/o reconstruction ---*/
 
-      second_numerics->SetTurbAdjointVar(solver_container[ADJTURB_SOL]->GetNodes()->GetSolution(iPoint),
-                                       solver_container[ADJTURB_SOL]->GetNodes()->GetSolution(jPoint));
+      second_numerics->SetTurbAdjointVar(adjTurbNodes->GetSolution(iPoint), adjTurbNodes->GetSolution(jPoint));
 
       /*--- Set distance to the surface ---*/
 
@@ -571,11 +621,12 @@ void CAdjNSSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
 
       /*--- Update adjoint viscous residual ---*/
 
-      second_numerics->ComputeResidual(Residual, config);
+      second_numerics->ComputeResidual(residual, config);
 
-      LinSysRes.AddBlock(iPoint, Residual);
-      LinSysRes.SubtractBlock(jPoint, Residual);
+      LinSysRes.AddBlock(iPoint, residual);
+      LinSysRes.SubtractBlock(jPoint, residual);
     }
+    } // end color loop
 
   }
 
@@ -586,7 +637,8 @@ void CAdjNSSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
   if (rotating_frame) {
 
     /*--- Loop over all points ---*/
-    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
       /*--- Load the adjoint variables ---*/
       second_numerics->SetAdjointVar(nodes->GetSolution(iPoint),
@@ -596,13 +648,13 @@ void CAdjNSSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
       second_numerics->SetVolume(geometry->node[iPoint]->GetVolume());
 
       /*--- Compute the adjoint rotating frame source residual ---*/
-      second_numerics->ComputeResidual(Residual, Jacobian_i, config);
+      second_numerics->ComputeResidual(residual, Jac_i, config);
 
       /*--- Add the source residual to the total ---*/
-      LinSysRes.AddBlock(iPoint, Residual);
+      LinSysRes.AddBlock(iPoint, residual);
 
       /*--- Add the implicit Jacobian contribution ---*/
-      if (implicit) Jacobian.AddBlock2Diag(iPoint, Jacobian_i);
+      if (implicit) Jacobian.AddBlock2Diag(iPoint, Jac_i);
 
     }
   }
@@ -616,25 +668,9 @@ void CAdjNSSolver::Viscous_Sensitivity(CGeometry *geometry, CSolver **solver_con
   normal_grad_psi5, normal_grad_T, sigma_partial, Laminar_Viscosity = 0.0, heat_flux_factor, temp_sens = 0.0, *Psi = NULL, *U = NULL, Enthalpy, **GridVel_Grad, gradPsi5_v, psi5_tau_partial, psi5_tau_grad_vel, source_v_1, Density, Pressure = 0.0, div_vel, val_turb_ke, vartheta, vartheta_partial, psi5_p_div_vel, Omega[3], rho_v[3] = {0.0,0.0,0.0}, CrossProduct[3], delta[3][3] = {{1.0, 0.0, 0.0},{0.0,1.0,0.0},{0.0,0.0,1.0}}, r, ru, rv, rw, rE, p, T, dp_dr, dp_dru, dp_drv, dp_drw, dp_drE, dH_dr, dH_dru, dH_drv, dH_drw, dH_drE, H, D[3][3], Dd[3], Mach_Inf, eps, scale = 1.0;
   su2double RefVel2, RefDensity, Mach2Vel, *Velocity_Inf, factor;
 
-  su2double *USens = new su2double[nVar];
-  su2double *UnitNormal = new su2double[nDim];
-  su2double *normal_grad_vel = new su2double[nDim];
-  su2double *tang_deriv_psi5 = new su2double[nDim];
-  su2double *tang_deriv_T = new su2double[nDim];
-  su2double **Sigma = new su2double* [nDim];
-
-  for (iDim = 0; iDim < nDim; iDim++)
-    Sigma[iDim] = new su2double [nDim];
-
-  su2double *normal_grad_gridvel = new su2double[nDim];
-  su2double *normal_grad_v_ux =new su2double[nDim];
-  su2double **Sigma_Psi5v = new su2double* [nDim];
-  for (iDim = 0; iDim < nDim; iDim++)
-    Sigma_Psi5v[iDim] = new su2double [nDim];
-  su2double **tau = new su2double* [nDim];
-  for (iDim = 0; iDim < nDim; iDim++)
-    tau[iDim] = new su2double [nDim];
-  su2double *Velocity = new su2double[nDim];
+  su2double USens[MAXNVAR], UnitNormal[MAXNDIM], normal_grad_vel[MAXNDIM], tang_deriv_psi5[MAXNDIM],
+  tang_deriv_T[MAXNDIM], Sigma[MAXNDIM][MAXNDIM], normal_grad_gridvel[MAXNDIM], normal_grad_v_ux[MAXNDIM],
+  Sigma_Psi5v[MAXNDIM][MAXNDIM], tau[MAXNDIM][MAXNDIM], Velocity[MAXNDIM];
 
   bool rotating_frame    = config->GetRotating_Frame();
   bool grid_movement     = config->GetGrid_Movement();
@@ -682,6 +718,12 @@ void CAdjNSSolver::Viscous_Sensitivity(CGeometry *geometry, CSolver **solver_con
   }
 
 
+  /*--- Sensitivities are removed near sharp edges, if requested. ---*/
+
+  const bool remove_sharp = config->GetSens_Remove_Sharp();
+  eps = config->GetVenkat_LimiterCoeff()*config->GetRefElemLength();
+  const su2double sharp_limit = config->GetAdjSharp_LimiterCoeff()*eps;
+
   /*--- Compute gradient of the grid velocity, if applicable ---*/
 
   if (grid_movement)
@@ -901,11 +943,8 @@ void CAdjNSSolver::Viscous_Sensitivity(CGeometry *geometry, CSolver **solver_con
 
           /*--- If sharp edge, set the sensitivity to 0 on that region ---*/
 
-          if (config->GetSens_Remove_Sharp()) {
-            eps = config->GetVenkat_LimiterCoeff()*config->GetRefElemLength();
-            if ( geometry->node[iPoint]->GetSharpEdge_Distance() < config->GetAdjSharp_LimiterCoeff()*eps )
-              CSensitivity[iMarker][iVertex] = 0.0;
-          }
+          if (remove_sharp && (geometry->node[iPoint]->GetSharpEdge_Distance() < sharp_limit))
+            CSensitivity[iMarker][iVertex] = 0.0;
 
           Sens_Geo[iMarker] -= CSensitivity[iMarker][iVertex];
 
@@ -1162,39 +1201,16 @@ void CAdjNSSolver::Viscous_Sensitivity(CGeometry *geometry, CSolver **solver_con
   }
 
 
-#ifdef HAVE_MPI
+  /*--- Reduce all the totals at once. ---*/
 
-  su2double MyTotal_Sens_Geo   = Total_Sens_Geo;     Total_Sens_Geo = 0.0;
-  su2double MyTotal_Sens_Mach  = Total_Sens_Mach;    Total_Sens_Mach = 0.0;
-  su2double MyTotal_Sens_AoA   = Total_Sens_AoA;     Total_Sens_AoA = 0.0;
-  su2double MyTotal_Sens_Press = Total_Sens_Press;   Total_Sens_Press = 0.0;
-  su2double MyTotal_Sens_Temp  = Total_Sens_Temp;    Total_Sens_Temp = 0.0;
+  su2double MyTotal_Sens[5] = {Total_Sens_Geo, Total_Sens_Mach, Total_Sens_AoA,
+                               Total_Sens_Press, Total_Sens_Temp}, Total_Sens[5];
 
-  SU2_MPI::Allreduce(&MyTotal_Sens_Geo, &Total_Sens_Geo, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyTotal_Sens_Mach, &Total_Sens_Mach, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyTotal_Sens_AoA, &Total_Sens_AoA, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyTotal_Sens_Press, &Total_Sens_Press, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyTotal_Sens_Temp, &Total_Sens_Temp, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(MyTotal_Sens, Total_Sens, 5, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
 
-#endif
-
-  delete [] USens;
-  delete [] UnitNormal;
-  delete [] normal_grad_vel;
-  delete [] tang_deriv_psi5;
-  delete [] tang_deriv_T;
-  for (iDim = 0; iDim < nDim; iDim++)
-    delete [] Sigma[iDim];
-  delete [] Sigma;
-  delete [] normal_grad_gridvel;
-  delete [] normal_grad_v_ux;
-  for (iDim = 0; iDim < nDim; iDim++)
-    delete [] Sigma_Psi5v[iDim];
-  delete [] Sigma_Psi5v;
-  for (iDim = 0; iDim < nDim; iDim++)
-    delete [] tau[iDim];
-  delete [] tau;
-  delete [] Velocity;
+  Total_Sens_Geo   = Total_Sens[0];  Total_Sens_Mach  = Total_Sens[1];
+  Total_Sens_AoA   = Total_Sens[2];  Total_Sens_Press = Total_Sens[3];
+  Total_Sens_Temp  = Total_Sens[4];
 
 }
 
@@ -136,7 +136,7 @@ void CBaselineSolver_FEM::SetOutputVariables(CGeometry *geometry, CConfig *confi
     /*--- Check that this is an SU2 binary file. SU2 binary files
      have the hex representation of "SU2" as the first int in the file. ---*/
 
-    if (var_buf[0] != 535532)
+    if ((var_buf[0] != 535532) && (var_buf[0] != SU2_COMPRESSED_RESTART_ID))
       SU2_MPI::Error(string("File ") + filename + string(" is not a binary SU2 restart file.\n") +
                      string("SU2 reads/writes binary restart files by default.\n") +
                      string("Note that backward compatibility for ASCII restart files is\n") +
@@ -179,7 +179,7 @@ void CBaselineSolver_FEM::SetOutputVariables(CGeometry *geometry, CConfig *confi
     /*--- Check that this is an SU2 binary file. SU2 binary files
      have the hex representation of "SU2" as the first int in the file. ---*/
 
-    if (var_buf[0] != 535532)
+    if ((var_buf[0] != 535532) && (var_buf[0] != SU2_COMPRESSED_RESTART_ID))
       SU2_MPI::Error(string("File ") + filename + string(" is not a binary SU2 restart file.\n") +
                      string("SU2 reads/writes binary restart files by default.\n") +
                      string("Note that backward compatibility for ASCII restart files is\n") +
@@ -226,7 +226,7 @@ void CBaselineSolver_FEM::SetOutputVariables(CGeometry *geometry, CConfig *confi
     /*--- Check that this is an SU2 binary file. SU2 binary files
      have the hex representation of "SU2" as the first int in the file. ---*/
 
-    if (magic_number == 535532)
+    if ((magic_number == 535532) || (magic_number == SU2_COMPRESSED_RESTART_ID))
       SU2_MPI::Error(string("File ") + filename + string(" is a binary SU2 restart file, expected ASCII.\n") +
                      string("SU2 reads/writes binary restart files by default.\n") +
                      string("Note that backward compatibility for ASCII restart files is\n") +
@@ -264,7 +264,7 @@ void CBaselineSolver_FEM::SetOutputVariables(CGeometry *geometry, CConfig *confi
     /*--- Check that this is an SU2 binary file. SU2 binary files
      have the hex representation of "SU2" as the first int in the file. ---*/
 
-    if (magic_number == 535532)
+    if ((magic_number == 535532) || (magic_number == SU2_COMPRESSED_RESTART_ID))
       SU2_MPI::Error(string("File ") + filename + string(" is a binary SU2 restart file, expected ASCII.\n") +
                      string("SU2 reads/writes binary restart files by default.\n") +
                      string("Note that backward compatibility for ASCII restart files is\n") +
@@ -323,7 +323,7 @@ void CBaselineSolver_FEM::LoadRestart(CGeometry **geometry, CSolver ***solver, C
   }
 
   int counter = 0;
-  long iPoint_Local = 0; unsigned long iPoint_Global = 0;
+  long iPoint_Local = 0;
   unsigned short rbuf_NotMatching = 0;
   unsigned long nDOF_Read = 0;
 
@@ -338,28 +338,24 @@ void CBaselineSolver_FEM::LoadRestart(CGeometry **geometry, CSolver ***solver, C
   /*--- Load data from the restart into correct containers. ---*/
 
   counter = 0;
-  for (iPoint_Global = 0; iPoint_Global < geometry[MESH_0]->GetGlobal_nPointDomain(); iPoint_Global++) {
+  for (const auto& globalToLocal : geometry[MESH_0]->GetGlobal_to_Local_Map()) {
 
-    /*--- Retrieve local index. If this node from the restart file lives
-     on the current processor, we will load and instantiate the vars. ---*/
+    /*--- The points of this rank, in the order of their data in the restart file. ---*/
 
-    iPoint_Local = geometry[MESH_0]->GetGlobal_to_Local_Point(iPoint_Global);
+    iPoint_Local = globalToLocal.second;
 
-    if (iPoint_Local > -1) {
+    /*--- We need to store this point's data, so jump to the correct
+     offset in the buffer of data from the restart file and load it. ---*/
 
-      /*--- We need to store this point's data, so jump to the correct
-       offset in the buffer of data from the restart file and load it. ---*/
-
-      index = counter*Restart_Vars[1];
-      for (iVar = 0; iVar < nVar; iVar++) {
-        VecSolDOFs[nVar*iPoint_Local+iVar] = Restart_Data[index+iVar];
-      }
-      /*--- Update the local counter nDOF_Read. ---*/
-      ++nDOF_Read;
-
-      /*--- Increment the overall counter for how many points have been loaded. ---*/
-      counter++;
+    index = counter*Restart_Vars[1];
+    for (iVar = 0; iVar < nVar; iVar++) {
+      VecSolDOFs[nVar*iPoint_Local+iVar] = Restart_Data[index+iVar];
     }
+    /*--- Update the local counter nDOF_Read. ---*/
+    ++nDOF_Read;
+
+    /*--- Increment the overall counter for how many points have been loaded. ---*/
+    counter++;
 
   }
 
@@ -1076,26 +1076,23 @@ void CDiscAdjFEASolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CCo
   /*--- Load data from the restart into correct containers. ---*/
 
   counter = 0;
-  for (iPoint_Global = 0; iPoint_Global < geometry[MESH_0]->GetGlobal_nPointDomain(); iPoint_Global++ ) {
+  for (const auto& globalToLocal : geometry[MESH_0]->GetGlobal_to_Local_Map()) {
 
-    /*--- Retrieve local index. If this node from the restart file lives
-     on the current processor, we will load and instantiate the vars. ---*/
+    /*--- The points of this rank, in the order of their data in the restart file. ---*/
 
-    iPoint_Local = geometry[MESH_0]->GetGlobal_to_Local_Point(iPoint_Global);
+    iPoint_Global = globalToLocal.first;
+    iPoint_Local = globalToLocal.second;
 
-    if (iPoint_Local > -1) {
+    /*--- We need to store this point's data, so jump to the correct
+     offset in the buffer of data from the restart file and load it. ---*/
 
-      /*--- We need to store this point's data, so jump to the correct
-       offset in the buffer of data from the restart file and load it. ---*/
+    index = counter*Restart_Vars[1] + skipVars;
+    for (iVar = 0; iVar < nVar; iVar++) Solution[iVar] = Restart_Data[index+iVar];
+    nodes->SetSolution(iPoint_Local,Solution);
+    iPoint_Global_Local++;
 
-      index = counter*Restart_Vars[1] + skipVars;
-      for (iVar = 0; iVar < nVar; iVar++) Solution[iVar] = Restart_Data[index+iVar];
-      nodes->SetSolution(iPoint_Local,Solution);
-      iPoint_Global_Local++;
-
-      /*--- Increment the overall counter for how many points have been loaded. ---*/
-      counter++;
-    }
+    /*--- Increment the overall counter for how many points have been loaded. ---*/
+    counter++;
 
   }
 
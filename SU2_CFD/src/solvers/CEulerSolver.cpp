@@ -29,9 +29,12 @@
 #include "../../include/solvers/CEulerSolver.hpp"
 #include "../../include/variables/CNSVariable.hpp"
 #include "../../../Common/include/toolboxes/printing_toolbox.hpp"
+#include "../../../Common/include/toolboxes/CSumReduction.hpp"
+#include "../../../Common/include/toolboxes/allocation_toolbox.hpp"
 #include "../../include/gradients/computeGradientsGreenGauss.hpp"
 #include "../../include/gradients/computeGradientsLeastSquares.hpp"
 #include "../../include/limiters/computeLimiters.hpp"
+#include "../../include/numerics/flow/convection/batched_upwind.hpp"
 
 void CEulerSolver::AeroCoeffsArray::allocate(int size) {
   _size = size;
@@ -251,7 +254,17 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config,
     }
   }
 
-  if (ReducerStrategy)
+  /*--- Owner-computes strategy, each point computes the fluxes of all its edges (each flux is computed
+   *    twice but the updates are not shared). Only for the cheap schemes, i.e. centered and first order
+   *    upwind, the latter without the Roe low dissipation (it is set on both points of the edges). ---*/
+
+  const bool firstOrder = !config->GetMUSCL_Flow() || (iMesh != MESH_0);
+  OwnerComputes = config->GetEdgeOwnerComputes() &&
+                  ((config->GetKind_ConvNumScheme_Flow() == SPACE_CENTERED) ||
+                   ((config->GetKind_ConvNumScheme_Flow() == SPACE_UPWIND) && firstOrder &&
+                    (config->GetKind_RoeLowDiss() == NO_ROELOWDISS)));
+
+  if (ReducerStrategy && !OwnerComputes)
     EdgeFluxes.Initialize(geometry->GetnEdge(), geometry->GetnEdge(), nVar, nullptr);
 
   omp_chunk_size = computeStaticChunkSize(nPoint, omp_get_max_threads(), OMP_MAX_SIZE);
@@ -259,6 +272,24 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config,
   EdgeColoring[0] = DummyGridColor<>(geometry->GetnEdge());
 #endif
 
+  /*--- Classify the edges to overlap the halo exchanges with the interior fluxes. ---*/
+
+  if (config->GetOverlapHaloComms() && (iMesh == MESH_0))
+    geometry->SetEdgeHalo();
+
+  /*--- Vectorized upwind scheme (nullptr if not requested or not supported by the options). ---*/
+
+  BatchNumerics = CUpwindBatchNumerics::CreateNumerics(nDim, config);
+
+  /*--- Packed records of the MUSCL edge loops (not with the edge-based limiter, which updates the limiters). ---*/
+
+  PackedEdgeData = config->GetPackedEdgeData() && config->GetMUSCL_Flow() && (iMesh == MESH_0) &&
+                   (config->GetKind_ConvNumScheme_Flow() == SPACE_UPWIND) &&
+                   (config->GetKind_SlopeLimit_Flow() != VAN_ALBADA_EDGE);
+
+  if (PackedEdgeData)
+    EdgeLoopData.resize(nPoint, nPrimVarGrad*(nDim+2));
+
   /*--- Jacobians and vector structures for implicit computations ---*/
 
   if (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) {
@@ -471,6 +502,9 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config,
   }
   SetBaseClassPointerToNodes();
 
+  if (config->GetVariableMemoryReport() && (iMesh == MESH_0))
+    ReportVariableMemory(geometry);
+
   /*--- Check that the initial solution is physical, report any non-physical nodes ---*/
 
   counter_local = 0;
@@ -577,6 +611,8 @@ CEulerSolver::~CEulerSolver(void) {
 
   /*--- Array deallocation ---*/
 
+  delete BatchNumerics;
+
   delete [] CEquivArea_Inv;
   delete [] CNearFieldOF_Inv;
 
@@ -1082,866 +1118,434 @@ void CEulerSolver::InitTurboContainers(CGeometry *geometry, CConfig *config){
 
 }
 
-void CEulerSolver::Set_MPI_ActDisk(CSolver **solver_container, CGeometry *geometry, CConfig *config) {
-
-  unsigned long iter,  iPoint, iVertex, jVertex, iPointTotal,
-  Buffer_Send_nPointTotal = 0;
-  long iGlobalIndex, iGlobal;
-  unsigned short iVar, iMarker, jMarker;
-  long nDomain = 0, iDomain, jDomain;
-  //bool ActDisk_Perimeter;
-  bool rans = (config->GetKind_Turb_Model() != NONE) && (solver_container[TURB_SOL] != nullptr);
-
-  unsigned short nPrimVar_ = nPrimVar;
-  if (rans) nPrimVar_ += 2; // Add two extra variables for the turbulence.
-
-#ifdef HAVE_MPI
-
-  /*--- MPI status and request arrays for non-blocking communications ---*/
-
-  SU2_MPI::Status status;
+CEulerSolver::CDonorExchange::~CDonorExchange() {
 
+#ifdef HAVE_MPI_PERSISTENT
+  for (auto& req : sendReq) SU2_MPI::Request_free(&req);
+  for (auto& req : recvReq) SU2_MPI::Request_free(&req);
 #endif
+}
 
-  /*--- Define buffer vector interior domain ---*/
-
-  su2double *Buffer_Send_PrimVar = NULL;
-  long      *Buffer_Send_Data    = NULL;
-
-  unsigned long *nPointTotal_s = new unsigned long[size];
-  unsigned long *nPointTotal_r = new unsigned long[size];
-  su2double *iPrimVar = new su2double [nPrimVar_];
-
-  unsigned long Buffer_Size_PrimVar = 0;
-  unsigned long Buffer_Size_Data    = 0;
-
-  unsigned long PointTotal_Counter = 0;
+void CEulerSolver::SetDonorExchange(CGeometry *geometry, const CConfig *config, bool nearfield,
+                                    unsigned short nVarPoint, CDonorExchange& exchange) {
 
-  /*--- Allocate the memory that we only need if we have MPI support ---*/
+  auto isDonorMarker = [&](unsigned short iMarker) {
+    const auto kind = config->GetMarker_All_KindBC(iMarker);
+    if (nearfield) return (kind == NEARFIELD_BOUNDARY);
+    return (kind == ACTDISK_INLET) || (kind == ACTDISK_OUTLET);
+  };
 
-  su2double *Buffer_Receive_PrimVar = NULL;
-  long      *Buffer_Receive_Data    = NULL;
+  /*--- Count the points sent to each rank, and the points received from each rank. ---*/
 
-  /*--- Basic dimensionalization ---*/
+  vector<int> nSend(size,0), nRecv(size,0);
 
-  nDomain = size;
+  for (auto iMarker = 0u; iMarker < config->GetnMarker_All(); iMarker++) {
+    if (!isDonorMarker(iMarker)) continue;
+    for (auto iVertex = 0ul; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+      const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+      if (geometry->node[iPoint]->GetDomain())
+        nSend[geometry->vertex[iMarker][iVertex]->GetDonorProcessor()]++;
+    }
+  }
 
-  /*--- This loop gets the array sizes of points for each
-   rank to send to each other rank. ---*/
+  SU2_MPI::Alltoall(nSend.data(), 1, MPI_INT, nRecv.data(), 1, MPI_INT, MPI_COMM_WORLD);
 
-  for (iDomain = 0; iDomain < nDomain; iDomain++) {
+  vector<int> sendDispl(size+1,0), recvDispl(size+1,0);
+  for (int iRank = 0; iRank < size; iRank++) {
+    sendDispl[iRank+1] = sendDispl[iRank] + nSend[iRank];
+    recvDispl[iRank+1] = recvDispl[iRank] + nRecv[iRank];
+  }
 
-    /*--- Loop over the markers to perform the dimensionalizaton
-     of the domain variables ---*/
+  /*--- Sort the points by destination (keeping the order of markers and vertices for each rank),
+   *    the global index, donor vertex, and donor marker of each point only need to be sent once. ---*/
 
-    Buffer_Send_nPointTotal = 0;
+  exchange.sendPoint.resize(sendDispl[size]);
+  vector<long> sendData(3*sendDispl[size]), recvData(3*recvDispl[size]);
+  vector<int> counter(sendDispl.begin(), sendDispl.end()-1);
 
-    /*--- Loop over all of the markers and count the number of each
-     type of point and element that needs to be sent. ---*/
+  for (auto iMarker = 0u; iMarker < config->GetnMarker_All(); iMarker++) {
+    if (!isDonorMarker(iMarker)) continue;
+    for (auto iVertex = 0ul; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+      const auto vertex = geometry->vertex[iMarker][iVertex];
+      const auto iPoint = vertex->GetNode();
+      if (!geometry->node[iPoint]->GetDomain()) continue;
 
-    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-      if ((config->GetMarker_All_KindBC(iMarker) == ACTDISK_INLET) ||
-          (config->GetMarker_All_KindBC(iMarker) == ACTDISK_OUTLET)) {
-        for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-          //ActDisk_Perimeter = geometry->vertex[iMarker][iVertex]->GetActDisk_Perimeter();
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-          jDomain = geometry->vertex[iMarker][iVertex]->GetDonorProcessor();
-//          if ((iDomain == jDomain) && (geometry->node[iPoint]->GetDomain()) && (!ActDisk_Perimeter)) {
-          if ((iDomain == jDomain) && (geometry->node[iPoint]->GetDomain())) {
-            Buffer_Send_nPointTotal++;
-          }
-        }
-      }
+      const auto k = counter[vertex->GetDonorProcessor()]++;
+      exchange.sendPoint[k] = iPoint;
+      sendData[3*k] = geometry->node[iPoint]->GetGlobalIndex();
+      sendData[3*k+1] = vertex->GetDonorVertex();
+      sendData[3*k+2] = vertex->GetDonorMarker();
     }
+  }
 
-    /*--- Store the counts on a partition by partition basis. ---*/
-
-    nPointTotal_s[iDomain] = Buffer_Send_nPointTotal;
-
-    /*--- Total counts for allocating send buffers below ---*/
-
-    Buffer_Size_PrimVar += nPointTotal_s[iDomain]*(nPrimVar_);
-    Buffer_Size_Data += nPointTotal_s[iDomain]*(3);
-
+  vector<int> nSendData(size), nRecvData(size), sendDisplData(size), recvDisplData(size);
+  for (int iRank = 0; iRank < size; iRank++) {
+    nSendData[iRank] = 3*nSend[iRank];
+    nRecvData[iRank] = 3*nRecv[iRank];
+    sendDisplData[iRank] = 3*sendDispl[iRank];
+    recvDisplData[iRank] = 3*recvDispl[iRank];
   }
 
-  /*--- Allocate the buffer vectors in the appropiate domain (master, iDomain) ---*/
+  SU2_MPI::Alltoallv(sendData.data(), nSendData.data(), sendDisplData.data(), MPI_LONG,
+                     recvData.data(), nRecvData.data(), recvDisplData.data(), MPI_LONG, MPI_COMM_WORLD);
 
-  Buffer_Send_PrimVar = new su2double[Buffer_Size_PrimVar];
-  Buffer_Send_Data    = new long[Buffer_Size_Data];
+  /*--- The destination of each received value, the donor global indices do not change. ---*/
 
-  /*--- Now that we know the sizes of the point, we can
-   allocate and send the information in large chunks to all processors. ---*/
+  exchange.recvMarker.resize(recvDispl[size]);
+  exchange.recvVertex.resize(recvDispl[size]);
 
-  for (iDomain = 0; iDomain < nDomain; iDomain++) {
+  for (int k = 0; k < recvDispl[size]; k++) {
+    exchange.recvVertex[k] = recvData[3*k+1];
+    exchange.recvMarker[k] = recvData[3*k+2];
+    SetDonorGlobalIndex(exchange.recvMarker[k], exchange.recvVertex[k], recvData[3*k]);
+  }
 
-    /*--- A rank does not communicate with itself through MPI ---*/
+  /*--- Keep only the ranks that are communicated with, this rank included. ---*/
 
-    if (rank != iDomain) {
+  exchange.sendRank.clear(); exchange.sendPtr.assign(1,0);
+  exchange.recvRank.clear(); exchange.recvPtr.assign(1,0);
 
-#ifdef HAVE_MPI
+  for (int iRank = 0; iRank < size; iRank++) {
+    if (nSend[iRank] > 0) {
+      exchange.sendRank.push_back(iRank);
+      exchange.sendPtr.push_back(sendDispl[iRank+1]);
+    }
+    if (nRecv[iRank] > 0) {
+      exchange.recvRank.push_back(iRank);
+      exchange.recvPtr.push_back(recvDispl[iRank+1]);
+    }
+  }
 
-      /*--- Communicate the counts to iDomain with non-blocking sends ---*/
+  exchange.nVarPoint = nVarPoint;
+  exchange.sendBuf.resize(nVarPoint*exchange.sendPoint.size());
+  exchange.recvBuf.resize(nVarPoint*exchange.recvMarker.size());
 
-      SU2_MPI::Bsend(&nPointTotal_s[iDomain], 1, MPI_UNSIGNED_LONG, iDomain, iDomain, MPI_COMM_WORLD);
+  /*--- The requests of the messages to other ranks, the buffers are fixed so they can be persistent. ---*/
 
+#ifdef HAVE_MPI_PERSISTENT
+  for (auto& req : exchange.sendReq) SU2_MPI::Request_free(&req);
+  for (auto& req : exchange.recvReq) SU2_MPI::Request_free(&req);
 #endif
+  exchange.sendReq.clear();
+  exchange.recvReq.clear();
+
+  for (auto iRecv = 0ul; iRecv < exchange.recvRank.size(); iRecv++) {
+    if (exchange.recvRank[iRecv] == rank) continue;
+    exchange.recvReq.emplace_back();
+#ifdef HAVE_MPI_PERSISTENT
+    const auto offset = nVarPoint*exchange.recvPtr[iRecv];
+    const int count = nVarPoint*(exchange.recvPtr[iRecv+1] - exchange.recvPtr[iRecv]);
+    const int source = exchange.recvRank[iRecv];
+    SU2_MPI::Recv_init(&exchange.recvBuf[offset], count, MPI_DOUBLE, source, source+1,
+                       MPI_COMM_WORLD, &exchange.recvReq.back());
+#endif
+  }
 
-    } else {
-
-      /*--- If iDomain = rank, we simply copy values into place in memory ---*/
-
-      nPointTotal_r[iDomain] = nPointTotal_s[iDomain];
-
-    }
-
-    /*--- Receive the counts. All processors are sending their counters to
-     iDomain up above, so only iDomain needs to perform the recv here from
-     all other ranks. ---*/
-
-    if (rank == iDomain) {
-
-      for (jDomain = 0; jDomain < size; jDomain++) {
+  for (auto iSend = 0ul; iSend < exchange.sendRank.size(); iSend++) {
+    if (exchange.sendRank[iSend] == rank) continue;
+    exchange.sendReq.emplace_back();
+#ifdef HAVE_MPI_PERSISTENT
+    const auto offset = nVarPoint*exchange.sendPtr[iSend];
+    const int count = nVarPoint*(exchange.sendPtr[iSend+1] - exchange.sendPtr[iSend]);
+    SU2_MPI::Send_init(&exchange.sendBuf[offset], count, MPI_DOUBLE, exchange.sendRank[iSend], rank+1,
+                       MPI_COMM_WORLD, &exchange.sendReq.back());
+#endif
+  }
 
-        /*--- A rank does not communicate with itself through MPI ---*/
+  exchange.ready = true;
+}
 
-        if (rank != jDomain) {
+template<class F>
+void CEulerSolver::DonorExchange(CDonorExchange& exchange, const F& packPoint) {
 
-#ifdef HAVE_MPI
+  const auto nVarPoint = exchange.nVarPoint;
 
-          /*--- Recv the data by probing for the current sender, jDomain,
-           first and then receiving the values from it. ---*/
+  for (auto k = 0ul; k < exchange.sendPoint.size(); k++)
+    packPoint(exchange.sendPoint[k], &exchange.sendBuf[k*nVarPoint]);
 
-          SU2_MPI::Recv(&nPointTotal_r[jDomain], 1, MPI_UNSIGNED_LONG, jDomain, rank, MPI_COMM_WORLD, &status);
+  /*--- Start the messages to and from other ranks. ---*/
 
+#ifdef HAVE_MPI_PERSISTENT
+  if (!exchange.recvReq.empty()) SU2_MPI::Startall(exchange.recvReq.size(), exchange.recvReq.data());
+  if (!exchange.sendReq.empty()) SU2_MPI::Startall(exchange.sendReq.size(), exchange.sendReq.data());
+#elif defined HAVE_MPI
+  for (auto iRecv = 0ul, iReq = 0ul; iRecv < exchange.recvRank.size(); iRecv++) {
+    if (exchange.recvRank[iRecv] == rank) continue;
+    const auto offset = nVarPoint*exchange.recvPtr[iRecv];
+    const int count = nVarPoint*(exchange.recvPtr[iRecv+1] - exchange.recvPtr[iRecv]);
+    const int source = exchange.recvRank[iRecv];
+    SU2_MPI::Irecv(&exchange.recvBuf[offset], count, MPI_DOUBLE, source, source+1,
+                   MPI_COMM_WORLD, &exchange.recvReq[iReq++]);
+  }
+  for (auto iSend = 0ul, iReq = 0ul; iSend < exchange.sendRank.size(); iSend++) {
+    if (exchange.sendRank[iSend] == rank) continue;
+    const auto offset = nVarPoint*exchange.sendPtr[iSend];
+    const int count = nVarPoint*(exchange.sendPtr[iSend+1] - exchange.sendPtr[iSend]);
+    SU2_MPI::Isend(&exchange.sendBuf[offset], count, MPI_DOUBLE, exchange.sendRank[iSend], rank+1,
+                   MPI_COMM_WORLD, &exchange.sendReq[iReq++]);
+  }
 #endif
 
-        }
-      }
+  /*--- The values sent to this rank are copied directly. ---*/
 
+  for (auto iSend = 0ul; iSend < exchange.sendRank.size(); iSend++) {
+    if (exchange.sendRank[iSend] != rank) continue;
+    for (auto iRecv = 0ul; iRecv < exchange.recvRank.size(); iRecv++) {
+      if (exchange.recvRank[iRecv] != rank) continue;
+      const auto count = nVarPoint*(exchange.sendPtr[iSend+1] - exchange.sendPtr[iSend]);
+      copy_n(&exchange.sendBuf[nVarPoint*exchange.sendPtr[iSend]], count,
+             &exchange.recvBuf[nVarPoint*exchange.recvPtr[iRecv]]);
     }
   }
 
-  /*--- Wait for the non-blocking sends to complete. ---*/
-
 #ifdef HAVE_MPI
-
-  SU2_MPI::Barrier(MPI_COMM_WORLD);
-
+  if (!exchange.recvReq.empty())
+    SU2_MPI::Waitall(exchange.recvReq.size(), exchange.recvReq.data(), MPI_STATUS_IGNORE);
 #endif
 
-  /*--- Initialize the counters for the larger send buffers (by domain) ---*/
-
-  PointTotal_Counter  = 0;
-
-  for (iDomain = 0; iDomain < nDomain; iDomain++) {
-
-    /*--- Set the value of the interior geometry. Initialize counters. ---*/
-
-    iPointTotal = 0;
-
-    /*--- Load up the actual values into the buffers for sending. ---*/
-
-    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-
-      if ((config->GetMarker_All_KindBC(iMarker) == ACTDISK_INLET) ||
-          (config->GetMarker_All_KindBC(iMarker) == ACTDISK_OUTLET)) {
-        for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-
-          jDomain = geometry->vertex[iMarker][iVertex]->GetDonorProcessor();
-          //ActDisk_Perimeter = geometry->vertex[iMarker][iVertex]->GetActDisk_Perimeter();
-
-//          if ((iDomain == jDomain) && (geometry->node[iPoint]->GetDomain()) && (!ActDisk_Perimeter)) {
-          if ((iDomain == jDomain) && (geometry->node[iPoint]->GetDomain())) {
+  for (auto k = 0ul; k < exchange.recvMarker.size(); k++)
+    for (auto iVar = 0u; iVar < nVarPoint; iVar++)
+      SetDonorPrimVar(exchange.recvMarker[k], exchange.recvVertex[k], iVar, exchange.recvBuf[k*nVarPoint+iVar]);
 
-            for (iVar = 0; iVar < nPrimVar; iVar++) {
-              Buffer_Send_PrimVar[(nPrimVar_)*(PointTotal_Counter+iPointTotal)+iVar] = nodes->GetPrimitive(iPoint,iVar);
-            }
-            if (rans) {
-              Buffer_Send_PrimVar[(nPrimVar_)*(PointTotal_Counter+iPointTotal)+nPrimVar] = solver_container[TURB_SOL]->GetNodes()->GetSolution(iPoint,0);
-              Buffer_Send_PrimVar[(nPrimVar_)*(PointTotal_Counter+iPointTotal)+(nPrimVar+1)] = 0.0;
-            }
-
-            iGlobalIndex = geometry->node[iPoint]->GetGlobalIndex();
-            jVertex = geometry->vertex[iMarker][iVertex]->GetDonorVertex();
-            jMarker = geometry->vertex[iMarker][iVertex]->GetDonorMarker();
+#ifdef HAVE_MPI
+  if (!exchange.sendReq.empty())
+    SU2_MPI::Waitall(exchange.sendReq.size(), exchange.sendReq.data(), MPI_STATUS_IGNORE);
+#endif
+}
 
-            Buffer_Send_Data[(3)*(PointTotal_Counter+iPointTotal)+(0)]  = iGlobalIndex;
-            Buffer_Send_Data[(3)*(PointTotal_Counter+iPointTotal)+(1)] = jVertex;
-            Buffer_Send_Data[(3)*(PointTotal_Counter+iPointTotal)+(2)]  = jMarker;
+void CEulerSolver::Set_MPI_ActDisk(CSolver **solver_container, CGeometry *geometry, CConfig *config) {
 
-            iPointTotal++;
+  const bool rans = (config->GetKind_Turb_Model() != NONE) && (solver_container[TURB_SOL] != nullptr);
 
-          }
+  /*--- Two extra variables for the turbulence. ---*/
 
-        }
+  if (!ActDiskExchange.ready)
+    SetDonorExchange(geometry, config, false, nPrimVar + (rans? 2 : 0), ActDiskExchange);
 
-      }
+  const auto turbNodes = rans? solver_container[TURB_SOL]->GetNodes() : nullptr;
 
+  DonorExchange(ActDiskExchange, [&](unsigned long iPoint, su2double* values) {
+    for (auto iVar = 0u; iVar < nPrimVar; iVar++)
+      values[iVar] = nodes->GetPrimitive(iPoint,iVar);
+    if (rans) {
+      values[nPrimVar] = turbNodes->GetSolution(iPoint,0);
+      values[nPrimVar+1] = 0.0;
     }
+  });
 
-    /*--- Send the buffers with the geometrical information ---*/
-
-    if (iDomain != rank) {
-
-#ifdef HAVE_MPI
-
-      /*--- Communicate the coordinates, global index, colors, and element
-       date to iDomain with non-blocking sends. ---*/
+}
 
-      SU2_MPI::Bsend(&Buffer_Send_PrimVar[PointTotal_Counter*(nPrimVar_)],
-                     nPointTotal_s[iDomain]*(nPrimVar_), MPI_DOUBLE, iDomain,
-                     iDomain,  MPI_COMM_WORLD);
+void CEulerSolver::Set_MPI_Nearfield(CGeometry *geometry, CConfig *config) {
 
-      SU2_MPI::Bsend(&Buffer_Send_Data[PointTotal_Counter*(3)],
-                     nPointTotal_s[iDomain]*(3), MPI_LONG, iDomain,
-                     iDomain+nDomain,  MPI_COMM_WORLD);
+  if (!NearfieldExchange.ready)
+    SetDonorExchange(geometry, config, true, nPrimVar, NearfieldExchange);
 
-#endif
+  DonorExchange(NearfieldExchange, [&](unsigned long iPoint, su2double* values) {
+    for (auto iVar = 0u; iVar < nPrimVar; iVar++)
+      values[iVar] = nodes->GetPrimitive(iPoint,iVar);
+  });
 
-    }
+}
 
-    else {
+void CEulerSolver::SetNondimensionalization(CConfig *config, unsigned short iMesh) {
 
-      /*--- Allocate local memory for the local recv of the elements ---*/
+  su2double Temperature_FreeStream = 0.0, Mach2Vel_FreeStream = 0.0, ModVel_FreeStream = 0.0,
+  Energy_FreeStream = 0.0, ModVel_FreeStreamND = 0.0, Velocity_Reynolds = 0.0,
+  Omega_FreeStream = 0.0, Omega_FreeStreamND = 0.0, Viscosity_FreeStream = 0.0,
+  Density_FreeStream = 0.0, Pressure_FreeStream = 0.0, Tke_FreeStream = 0.0,
+  Length_Ref = 0.0, Density_Ref = 0.0, Pressure_Ref = 0.0, Velocity_Ref = 0.0,
+  Temperature_Ref = 0.0, Time_Ref = 0.0, Omega_Ref = 0.0, Force_Ref = 0.0,
+  Gas_Constant_Ref = 0.0, Viscosity_Ref = 0.0, Conductivity_Ref = 0.0, Energy_Ref= 0.0,
+  Froude = 0.0, Pressure_FreeStreamND = 0.0, Density_FreeStreamND = 0.0,
+  Temperature_FreeStreamND = 0.0, Gas_ConstantND = 0.0,
+  Velocity_FreeStreamND[3] = {0.0, 0.0, 0.0}, Viscosity_FreeStreamND = 0.0,
+  Tke_FreeStreamND = 0.0, Energy_FreeStreamND = 0.0,
+  Total_UnstTimeND = 0.0, Delta_UnstTimeND = 0.0, TgammaR = 0.0, Heat_Flux_Ref = 0.0;
 
-      Buffer_Receive_PrimVar            = new su2double[nPointTotal_s[iDomain]*(nPrimVar_)];
-      Buffer_Receive_Data               = new long[nPointTotal_s[iDomain]*(3)];
+  unsigned short iDim;
 
-      for (iter = 0; iter < nPointTotal_s[iDomain]*(nPrimVar_); iter++)
-        Buffer_Receive_PrimVar[iter] = Buffer_Send_PrimVar[PointTotal_Counter*(nPrimVar_)+iter];
+  /*--- Local variables ---*/
 
-      for (iter = 0; iter < nPointTotal_s[iDomain]*(3); iter++)
-        Buffer_Receive_Data[iter] = Buffer_Send_Data[PointTotal_Counter*(3)+iter];
+  su2double Alpha         = config->GetAoA()*PI_NUMBER/180.0;
+  su2double Beta          = config->GetAoS()*PI_NUMBER/180.0;
+  su2double Mach          = config->GetMach();
+  su2double Reynolds      = config->GetReynolds();
+  bool unsteady           = (config->GetTime_Marching() != NO);
+  bool viscous            = config->GetViscous();
+  bool gravity            = config->GetGravityForce();
+  bool turbulent          = (config->GetKind_Turb_Model() != NONE);
+  bool tkeNeeded          = (turbulent && (config->GetKind_Turb_Model() == SST || config->GetKind_Turb_Model() == SST_SUST));
+  bool free_stream_temp   = (config->GetKind_FreeStreamOption() == TEMPERATURE_FS);
+  bool reynolds_init      = (config->GetKind_InitOption() == REYNOLDS);
+  bool aeroelastic        = config->GetAeroelastic_Simulation();
 
+  /*--- Set temperature via the flutter speed index ---*/
+  if (aeroelastic) {
+    su2double vf             = config->GetAeroelastic_Flutter_Speed_Index();
+    su2double w_alpha        = config->GetAeroelastic_Frequency_Pitch();
+    su2double b              = config->GetLength_Reynolds()/2.0; // airfoil semichord, Reynolds length is by defaul 1.0
+    su2double mu             = config->GetAeroelastic_Airfoil_Mass_Ratio();
+    // The temperature times gamma times the gas constant. Depending on the FluidModel temp is calculated below.
+    TgammaR = ((vf*vf)*(b*b)*(w_alpha*w_alpha)*mu) / (Mach*Mach);
+  }
 
-      /*--- Recv the point data from ourselves (same procedure as above) ---*/
+  /*--- Compressible non dimensionalization ---*/
 
-      for (iPoint = 0; iPoint < nPointTotal_r[iDomain]; iPoint++) {
+  /*--- Compute the Free Stream velocity, using the Mach number ---*/
 
-        for (iVar = 0; iVar < nPrimVar_; iVar++)
-          iPrimVar[iVar] = Buffer_Receive_PrimVar[iPoint*(nPrimVar_)+iVar];
+  Pressure_FreeStream = config->GetPressure_FreeStream();
+  Density_FreeStream  = config->GetDensity_FreeStream();
+  Temperature_FreeStream = config->GetTemperature_FreeStream();
 
-        iGlobal       =  Buffer_Receive_Data[iPoint*(3)+(0)];
-        iVertex      =  Buffer_Receive_Data[iPoint*(3)+(1)];
-        iMarker      = Buffer_Receive_Data[iPoint*(3)+(2)];
+  CFluidModel* auxFluidModel = nullptr;
 
-        for (iVar = 0; iVar < nPrimVar_; iVar++)
-          SetDonorPrimVar(iMarker, iVertex, iVar, iPrimVar[iVar]);
+  switch (config->GetKind_FluidModel()) {
 
-        SetDonorGlobalIndex(iMarker, iVertex, iGlobal);
+    case STANDARD_AIR:
 
+      switch (config->GetSystemMeasurements()) {
+        case SI: config->SetGas_Constant(287.058); break;
+        case US: config->SetGas_Constant(1716.49); break;
       }
 
-      /*--- Delete memory for recv the point stuff ---*/
+      auxFluidModel = new CIdealGas(1.4, config->GetGas_Constant());
 
-      delete [] Buffer_Receive_PrimVar;
-      delete [] Buffer_Receive_Data;
+      if (free_stream_temp && aeroelastic) {
+        Temperature_FreeStream = TgammaR / (config->GetGas_Constant()*1.4);
+        config->SetTemperature_FreeStream(Temperature_FreeStream);
+      }
+      break;
 
-    }
+    case IDEAL_GAS:
 
-    /*--- Increment the counters for the send buffers (iDomain loop) ---*/
+      auxFluidModel = new CIdealGas(Gamma, config->GetGas_Constant());
+      break;
 
-    PointTotal_Counter += iPointTotal;
+    case VW_GAS:
 
-  }
+      auxFluidModel = new CVanDerWaalsGas(Gamma, config->GetGas_Constant(),
+                 config->GetPressure_Critical(), config->GetTemperature_Critical());
+      break;
 
-  /*--- Wait for the non-blocking sends to complete. ---*/
+    case PR_GAS:
 
-#ifdef HAVE_MPI
+      auxFluidModel = new CPengRobinson(Gamma, config->GetGas_Constant(), config->GetPressure_Critical(),
+                                        config->GetTemperature_Critical(), config->GetAcentric_Factor());
+      break;
 
-  SU2_MPI::Barrier(MPI_COMM_WORLD);
+    case TABULATED_GAS:
 
-#endif
+      /*--- The dimensional free-stream is computed with the model from which the table is generated. ---*/
+      auxFluidModel = CTabulatedGas::CreateBaseModel(config, false);
+      break;
 
-  /*--- The next section begins the recv of all data for the interior
-   points/elements in the mesh. First, create the domain structures for
-   the points on this rank. First, we recv all of the point data ---*/
+    default:
+      SU2_MPI::Error("Unknown fluid model.", CURRENT_FUNCTION);
+      break;
+  }
 
-  for (iDomain = 0; iDomain < size; iDomain++) {
+  if (free_stream_temp) {
+    auxFluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
+    Density_FreeStream = auxFluidModel->GetDensity();
+    config->SetDensity_FreeStream(Density_FreeStream);
+  }
+  else {
+    auxFluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
+    Temperature_FreeStream = auxFluidModel->GetTemperature();
+    config->SetTemperature_FreeStream(Temperature_FreeStream);
+  }
 
-    if (rank != iDomain) {
+  Mach2Vel_FreeStream = auxFluidModel->GetSoundSpeed();
 
-#ifdef HAVE_MPI
+  /*--- Compute the Free Stream velocity, using the Mach number ---*/
 
-      /*--- Allocate the receive buffer vector. Send the colors so that we
-       know whether what we recv is an owned or halo node. ---*/
+  if (nDim == 2) {
+    config->GetVelocity_FreeStream()[0] = cos(Alpha)*Mach*Mach2Vel_FreeStream;
+    config->GetVelocity_FreeStream()[1] = sin(Alpha)*Mach*Mach2Vel_FreeStream;
+  }
+  if (nDim == 3) {
+    config->GetVelocity_FreeStream()[0] = cos(Alpha)*cos(Beta)*Mach*Mach2Vel_FreeStream;
+    config->GetVelocity_FreeStream()[1] = sin(Beta)*Mach*Mach2Vel_FreeStream;
+    config->GetVelocity_FreeStream()[2] = sin(Alpha)*cos(Beta)*Mach*Mach2Vel_FreeStream;
+  }
 
-      Buffer_Receive_PrimVar            = new su2double [nPointTotal_r[iDomain]*(nPrimVar_)];
-      Buffer_Receive_Data               = new long [nPointTotal_r[iDomain]*(3)];
+  /*--- Compute the modulus of the free stream velocity ---*/
 
-      /*--- Receive the buffers with the coords, global index, and colors ---*/
+  ModVel_FreeStream = 0.0;
+  for (iDim = 0; iDim < nDim; iDim++)
+    ModVel_FreeStream += config->GetVelocity_FreeStream()[iDim]*config->GetVelocity_FreeStream()[iDim];
+  ModVel_FreeStream = sqrt(ModVel_FreeStream); config->SetModVel_FreeStream(ModVel_FreeStream);
 
-      SU2_MPI::Recv(Buffer_Receive_PrimVar, nPointTotal_r[iDomain]*(nPrimVar_) , MPI_DOUBLE,
-                    iDomain, rank, MPI_COMM_WORLD, &status);
+  /*--- Viscous initialization ---*/
 
-      SU2_MPI::Recv(Buffer_Receive_Data, nPointTotal_r[iDomain]*(3) , MPI_LONG,
-                    iDomain, rank+nDomain, MPI_COMM_WORLD, &status);
+  if (viscous) {
 
-      /*--- Loop over all of the points that we have recv'd and store the
-       coords, global index vertex and markers ---*/
+    /*--- The dimensional viscosity is needed to determine the free-stream conditions.
+          To accomplish this, simply set the non-dimensional coefficients to the
+          dimensional ones. This will be overruled later.---*/
+    config->SetMu_RefND(config->GetMu_Ref());
+    config->SetMu_Temperature_RefND(config->GetMu_Temperature_Ref());
+    config->SetMu_SND(config->GetMu_S());
 
-      for (iPoint = 0; iPoint < nPointTotal_r[iDomain]; iPoint++) {
+    config->SetMu_ConstantND(config->GetMu_Constant());
 
-        iGlobal      = Buffer_Receive_Data[iPoint*(3)+(0)];
-        iVertex      = Buffer_Receive_Data[iPoint*(3)+(1)];
-        iMarker      = Buffer_Receive_Data[iPoint*(3)+(2)];
+    /*--- Reynolds based initialization ---*/
 
-        for (iVar = 0; iVar < nPrimVar_; iVar++)
-          iPrimVar[iVar] = Buffer_Receive_PrimVar[iPoint*(nPrimVar_)+iVar];
+    if (reynolds_init) {
 
-        for (iVar = 0; iVar < nPrimVar_; iVar++) {
-          SetDonorPrimVar(iMarker, iVertex, iVar, iPrimVar[iVar]);
-        }
+      /*--- First, check if there is mesh motion. If yes, use the Mach
+         number relative to the body to initialize the flow. ---*/
 
-        SetDonorGlobalIndex(iMarker, iVertex, iGlobal);
+      if (dynamic_grid) Velocity_Reynolds = config->GetMach_Motion()*Mach2Vel_FreeStream;
+      else Velocity_Reynolds = ModVel_FreeStream;
 
-      }
+      /*--- For viscous flows, pressure will be computed from a density
+            that is found from the Reynolds number. The viscosity is computed
+            from the dimensional version of Sutherland's law or the constant
+            viscosity, depending on the input option.---*/
 
-      /*--- Delete memory for recv the point stuff ---*/
+      auxFluidModel->SetLaminarViscosityModel(config);
 
-      delete [] Buffer_Receive_PrimVar;
-      delete [] Buffer_Receive_Data;
+      Viscosity_FreeStream = auxFluidModel->GetLaminarViscosity();
+      config->SetViscosity_FreeStream(Viscosity_FreeStream);
 
-#endif
+      Density_FreeStream = Reynolds*Viscosity_FreeStream/(Velocity_Reynolds*config->GetLength_Reynolds());
+      config->SetDensity_FreeStream(Density_FreeStream);
+      auxFluidModel->SetTDState_rhoT(Density_FreeStream, Temperature_FreeStream);
+      Pressure_FreeStream = auxFluidModel->GetPressure();
+      config->SetPressure_FreeStream(Pressure_FreeStream);
+      Energy_FreeStream = auxFluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
 
     }
 
-  }
-
-  /*--- Wait for the non-blocking sends to complete. ---*/
+    /*--- Thermodynamics quantities based initialization ---*/
 
-#ifdef HAVE_MPI
+    else {
 
-  SU2_MPI::Barrier(MPI_COMM_WORLD);
+      auxFluidModel->SetLaminarViscosityModel(config);
+      Viscosity_FreeStream = auxFluidModel->GetLaminarViscosity();
+      config->SetViscosity_FreeStream(Viscosity_FreeStream);
+      Energy_FreeStream = auxFluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
 
-#endif
+    }
 
-  /*--- Free all of the memory used for communicating points and elements ---*/
+    /*--- Turbulence kinetic energy ---*/
 
-  delete[] Buffer_Send_PrimVar;
-  delete[] Buffer_Send_Data;
+    Tke_FreeStream  = 3.0/2.0*(ModVel_FreeStream*ModVel_FreeStream*config->GetTurbulenceIntensity_FreeStream()*config->GetTurbulenceIntensity_FreeStream());
 
-  /*--- Release all of the temporary memory ---*/
+  }
+  else {
 
-  delete [] nPointTotal_s;
-  delete [] nPointTotal_r;
-  delete [] iPrimVar;
+    /*--- For inviscid flow, energy is calculated from the specified
+       FreeStream quantities using the proper gas law. ---*/
 
-}
+    Energy_FreeStream = auxFluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
 
-void CEulerSolver::Set_MPI_Nearfield(CGeometry *geometry, CConfig *config) {
+  }
 
-  unsigned long iter,  iPoint, iVertex, jVertex, iPointTotal,
-  Buffer_Send_nPointTotal = 0;
-  long iGlobalIndex, iGlobal;
-  unsigned short iVar, iMarker, jMarker;
-  long nDomain = 0, iDomain, jDomain;
+  /*-- Compute the freestream energy. ---*/
 
-#ifdef HAVE_MPI
-
-  /*--- MPI status and request arrays for non-blocking communications ---*/
-
-  SU2_MPI::Status status, status_;
-
-
-#endif
-
-  /*--- Define buffer vector interior domain ---*/
-
-  su2double        *Buffer_Send_PrimVar          = NULL;
-
-  unsigned long *nPointTotal_s = new unsigned long[size];
-  unsigned long *nPointTotal_r = new unsigned long[size];
-  su2double     *iPrimVar      = new su2double [nPrimVar];
-
-  unsigned long Buffer_Size_PrimVar = 0;
-  unsigned long PointTotal_Counter = 0;
-
-  /*--- Allocate the memory that we only need if we have MPI support ---*/
-
-  su2double* Buffer_Receive_PrimVar = NULL;
-
-  /*--- Basic dimensionalization ---*/
-
-  nDomain = size;
-
-  /*--- This loop gets the array sizes of points for each
-   rank to send to each other rank. ---*/
-
-  for (iDomain = 0; iDomain < nDomain; iDomain++) {
-
-    /*--- Loop over the markers to perform the dimensionalizaton
-     of the domain variables ---*/
-
-    Buffer_Send_nPointTotal = 0;
-
-    /*--- Loop over all of the markers and count the number of each
-     type of point and element that needs to be sent. ---*/
-
-    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-      if (config->GetMarker_All_KindBC(iMarker) == NEARFIELD_BOUNDARY) {
-        for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-          jDomain = geometry->vertex[iMarker][iVertex]->GetDonorProcessor();
-          if ((iDomain == jDomain) && (geometry->node[iPoint]->GetDomain())) {
-            Buffer_Send_nPointTotal++;
-          }
-        }
-      }
-    }
-
-    /*--- Store the counts on a partition by partition basis. ---*/
-
-    nPointTotal_s[iDomain] = Buffer_Send_nPointTotal;
-
-    /*--- Total counts for allocating send buffers below ---*/
-
-    Buffer_Size_PrimVar += nPointTotal_s[iDomain]*(nPrimVar+3);
-
-  }
-
-  /*--- Allocate the buffer vectors in the appropiate domain (master, iDomain) ---*/
-
-  Buffer_Send_PrimVar = new su2double[Buffer_Size_PrimVar];
-
-  /*--- Now that we know the sizes of the point, we can
-   allocate and send the information in large chunks to all processors. ---*/
-
-  for (iDomain = 0; iDomain < nDomain; iDomain++) {
-
-    /*--- A rank does not communicate with itself through MPI ---*/
-
-    if (rank != iDomain) {
-
-#ifdef HAVE_MPI
-
-      /*--- Communicate the counts to iDomain with non-blocking sends ---*/
-
-      SU2_MPI::Bsend(&nPointTotal_s[iDomain], 1, MPI_UNSIGNED_LONG, iDomain, iDomain, MPI_COMM_WORLD);
-
-#endif
-
-    } else {
-
-      /*--- If iDomain = rank, we simply copy values into place in memory ---*/
-
-      nPointTotal_r[iDomain] = nPointTotal_s[iDomain];
-
-    }
-
-    /*--- Receive the counts. All processors are sending their counters to
-     iDomain up above, so only iDomain needs to perform the recv here from
-     all other ranks. ---*/
-
-    if (rank == iDomain) {
-
-      for (jDomain = 0; jDomain < size; jDomain++) {
-
-        /*--- A rank does not communicate with itself through MPI ---*/
-
-        if (rank != jDomain) {
-
-#ifdef HAVE_MPI
-
-          /*--- Recv the data by probing for the current sender, jDomain,
-           first and then receiving the values from it. ---*/
-
-          SU2_MPI::Recv(&nPointTotal_r[jDomain], 1, MPI_UNSIGNED_LONG, jDomain, rank, MPI_COMM_WORLD, &status);
-
-#endif
-
-        }
-      }
-
-    }
-  }
-
-  /*--- Wait for the non-blocking sends to complete. ---*/
-
-#ifdef HAVE_MPI
-
-  SU2_MPI::Barrier(MPI_COMM_WORLD);
-
-#endif
-
-  /*--- Initialize the counters for the larger send buffers (by domain) ---*/
-
-  PointTotal_Counter  = 0;
-
-  for (iDomain = 0; iDomain < nDomain; iDomain++) {
-
-    /*--- Set the value of the interior geometry. Initialize counters. ---*/
-
-    iPointTotal = 0;
-
-    /*--- Load up the actual values into the buffers for sending. ---*/
-
-    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-
-      if (config->GetMarker_All_KindBC(iMarker) == NEARFIELD_BOUNDARY) {
-
-        for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-          jDomain = geometry->vertex[iMarker][iVertex]->GetDonorProcessor();
-          if ((iDomain == jDomain) && (geometry->node[iPoint]->GetDomain())) {
-            iGlobalIndex = geometry->node[iPoint]->GetGlobalIndex();
-            jVertex = geometry->vertex[iMarker][iVertex]->GetDonorVertex();
-            jMarker = geometry->vertex[iMarker][iVertex]->GetDonorMarker();
-            for (iVar = 0; iVar < nPrimVar; iVar++) {
-              Buffer_Send_PrimVar[(nPrimVar+3)*(PointTotal_Counter+iPointTotal)+iVar] = nodes->GetPrimitive(iPoint,iVar);
-            }
-            Buffer_Send_PrimVar[(nPrimVar+3)*(PointTotal_Counter+iPointTotal)+(nPrimVar+0)] = su2double(iGlobalIndex);
-            Buffer_Send_PrimVar[(nPrimVar+3)*(PointTotal_Counter+iPointTotal)+(nPrimVar+1)] = su2double(jVertex);
-            Buffer_Send_PrimVar[(nPrimVar+3)*(PointTotal_Counter+iPointTotal)+(nPrimVar+2)] = su2double(jMarker);
-
-            iPointTotal++;
-
-          }
-
-        }
-
-      }
-
-    }
-
-    /*--- Send the buffers with the geometrical information ---*/
-
-    if (iDomain != rank) {
-
-#ifdef HAVE_MPI
-
-      /*--- Communicate the coordinates, global index, colors, and element
-       date to iDomain with non-blocking sends. ---*/
-
-      SU2_MPI::Bsend(&Buffer_Send_PrimVar[PointTotal_Counter*(nPrimVar+3)],
-                     nPointTotal_s[iDomain]*(nPrimVar+3), MPI_DOUBLE, iDomain,
-                     iDomain,  MPI_COMM_WORLD);
-
-#endif
-
-    }
-
-    else {
-
-      /*--- Allocate local memory for the local recv of the elements ---*/
-
-      Buffer_Receive_PrimVar = new su2double[nPointTotal_s[iDomain]*(nPrimVar+3)];
-
-      for (iter = 0; iter < nPointTotal_s[iDomain]*(nPrimVar+3); iter++)
-        Buffer_Receive_PrimVar[iter] = Buffer_Send_PrimVar[PointTotal_Counter*(nPrimVar+3)+iter];
-
-      /*--- Recv the point data from ourselves (same procedure as above) ---*/
-
-      for (iPoint = 0; iPoint < nPointTotal_r[iDomain]; iPoint++) {
-
-        iGlobal      = SU2_TYPE::Int(Buffer_Receive_PrimVar[iPoint*(nPrimVar+3)+(nPrimVar+0)]);
-        iVertex      = SU2_TYPE::Int(Buffer_Receive_PrimVar[iPoint*(nPrimVar+3)+(nPrimVar+1)]);
-        iMarker      = SU2_TYPE::Int(Buffer_Receive_PrimVar[iPoint*(nPrimVar+3)+(nPrimVar+2)]);
-        for (iVar = 0; iVar < nPrimVar; iVar++)
-          iPrimVar[iVar] = Buffer_Receive_PrimVar[iPoint*(nPrimVar+3)+iVar];
-
-        if (iVertex < 0.0) cout <<" Negative iVertex (receive)" << endl;
-        if (iMarker < 0.0) cout <<" Negative iMarker (receive)" << endl;
-
-        if (iMarker > nMarker) cout << "ERROR" <<  endl;
-        if (iVertex > geometry->nVertex[iMarker]) cout << "ERROR" <<  endl;
-
-        for (iVar = 0; iVar < nPrimVar; iVar++)
-          SetDonorPrimVar(iMarker, iVertex, iVar, iPrimVar[iVar]);
-
-        SetDonorGlobalIndex(iMarker, iVertex, iGlobal);
-
-      }
-
-      /*--- Delete memory for recv the point stuff ---*/
-
-      delete [] Buffer_Receive_PrimVar;
-
-    }
-
-    /*--- Increment the counters for the send buffers (iDomain loop) ---*/
-
-    PointTotal_Counter += iPointTotal;
-
-  }
-
-  /*--- Wait for the non-blocking sends to complete. ---*/
-
-#ifdef HAVE_MPI
-
-  SU2_MPI::Barrier(MPI_COMM_WORLD);
-
-#endif
-
-  /*--- The next section begins the recv of all data for the interior
-   points/elements in the mesh. First, create the domain structures for
-   the points on this rank. First, we recv all of the point data ---*/
-
-  for (iDomain = 0; iDomain < size; iDomain++) {
-
-    if (rank != iDomain) {
-
-#ifdef HAVE_MPI
-
-      /*--- Allocate the receive buffer vector. Send the colors so that we
-       know whether what we recv is an owned or halo node. ---*/
-
-      Buffer_Receive_PrimVar = new su2double [nPointTotal_r[iDomain]*(nPrimVar+3)];
-
-      /*--- Receive the buffers with the coords, global index, and colors ---*/
-
-      SU2_MPI::Recv(Buffer_Receive_PrimVar, nPointTotal_r[iDomain]*(nPrimVar+3) , MPI_DOUBLE,
-                    iDomain, rank, MPI_COMM_WORLD, &status_);
-
-      /*--- Loop over all of the points that we have recv'd and store the
-       coords, global index vertex and markers ---*/
-
-      for (iPoint = 0; iPoint < nPointTotal_r[iDomain]; iPoint++) {
-
-        iGlobal      = SU2_TYPE::Int(Buffer_Receive_PrimVar[iPoint*(nPrimVar+3)+(nPrimVar+0)]);
-        iVertex      = SU2_TYPE::Int(Buffer_Receive_PrimVar[iPoint*(nPrimVar+3)+(nPrimVar+1)]);
-        iMarker      = SU2_TYPE::Int(Buffer_Receive_PrimVar[iPoint*(nPrimVar+3)+(nPrimVar+2)]);
-        for (iVar = 0; iVar < nPrimVar; iVar++)
-          iPrimVar[iVar] = Buffer_Receive_PrimVar[iPoint*(nPrimVar+3)+iVar];
-
-        if (iVertex < 0.0) cout <<" Negative iVertex (receive)" << endl;
-        if (iMarker < 0.0) cout <<" Negative iMarker (receive)" << endl;
-
-        if (iMarker > nMarker) cout << "ERROR" <<  endl;
-        if (iVertex > geometry->nVertex[iMarker]) cout << "ERROR" <<  endl;
-
-        for (iVar = 0; iVar < nPrimVar; iVar++)
-          SetDonorPrimVar(iMarker, iVertex, iVar,  iPrimVar[iVar]);
-
-        SetDonorGlobalIndex(iMarker, iVertex, iGlobal);
-
-      }
-
-      /*--- Delete memory for recv the point stuff ---*/
-
-      delete [] Buffer_Receive_PrimVar;
-
-#endif
-
-    }
-
-  }
-
-  /*--- Wait for the non-blocking sends to complete. ---*/
-
-#ifdef HAVE_MPI
-
-  SU2_MPI::Barrier(MPI_COMM_WORLD);
-
-#endif
-
-  /*--- Free all of the memory used for communicating points and elements ---*/
-
-  delete[] Buffer_Send_PrimVar;
-
-  /*--- Release all of the temporary memory ---*/
-
-  delete [] nPointTotal_s;
-  delete [] nPointTotal_r;
-  delete [] iPrimVar;
-
-}
-
-void CEulerSolver::SetNondimensionalization(CConfig *config, unsigned short iMesh) {
-
-  su2double Temperature_FreeStream = 0.0, Mach2Vel_FreeStream = 0.0, ModVel_FreeStream = 0.0,
-  Energy_FreeStream = 0.0, ModVel_FreeStreamND = 0.0, Velocity_Reynolds = 0.0,
-  Omega_FreeStream = 0.0, Omega_FreeStreamND = 0.0, Viscosity_FreeStream = 0.0,
-  Density_FreeStream = 0.0, Pressure_FreeStream = 0.0, Tke_FreeStream = 0.0,
-  Length_Ref = 0.0, Density_Ref = 0.0, Pressure_Ref = 0.0, Velocity_Ref = 0.0,
-  Temperature_Ref = 0.0, Time_Ref = 0.0, Omega_Ref = 0.0, Force_Ref = 0.0,
-  Gas_Constant_Ref = 0.0, Viscosity_Ref = 0.0, Conductivity_Ref = 0.0, Energy_Ref= 0.0,
-  Froude = 0.0, Pressure_FreeStreamND = 0.0, Density_FreeStreamND = 0.0,
-  Temperature_FreeStreamND = 0.0, Gas_ConstantND = 0.0,
-  Velocity_FreeStreamND[3] = {0.0, 0.0, 0.0}, Viscosity_FreeStreamND = 0.0,
-  Tke_FreeStreamND = 0.0, Energy_FreeStreamND = 0.0,
-  Total_UnstTimeND = 0.0, Delta_UnstTimeND = 0.0, TgammaR = 0.0, Heat_Flux_Ref = 0.0;
-
-  unsigned short iDim;
-
-  /*--- Local variables ---*/
-
-  su2double Alpha         = config->GetAoA()*PI_NUMBER/180.0;
-  su2double Beta          = config->GetAoS()*PI_NUMBER/180.0;
-  su2double Mach          = config->GetMach();
-  su2double Reynolds      = config->GetReynolds();
-  bool unsteady           = (config->GetTime_Marching() != NO);
-  bool viscous            = config->GetViscous();
-  bool gravity            = config->GetGravityForce();
-  bool turbulent          = (config->GetKind_Turb_Model() != NONE);
-  bool tkeNeeded          = (turbulent && (config->GetKind_Turb_Model() == SST || config->GetKind_Turb_Model() == SST_SUST));
-  bool free_stream_temp   = (config->GetKind_FreeStreamOption() == TEMPERATURE_FS);
-  bool reynolds_init      = (config->GetKind_InitOption() == REYNOLDS);
-  bool aeroelastic        = config->GetAeroelastic_Simulation();
-
-  /*--- Set temperature via the flutter speed index ---*/
-  if (aeroelastic) {
-    su2double vf             = config->GetAeroelastic_Flutter_Speed_Index();
-    su2double w_alpha        = config->GetAeroelastic_Frequency_Pitch();
-    su2double b              = config->GetLength_Reynolds()/2.0; // airfoil semichord, Reynolds length is by defaul 1.0
-    su2double mu             = config->GetAeroelastic_Airfoil_Mass_Ratio();
-    // The temperature times gamma times the gas constant. Depending on the FluidModel temp is calculated below.
-    TgammaR = ((vf*vf)*(b*b)*(w_alpha*w_alpha)*mu) / (Mach*Mach);
-  }
-
-  /*--- Compressible non dimensionalization ---*/
-
-  /*--- Compute the Free Stream velocity, using the Mach number ---*/
-
-  Pressure_FreeStream = config->GetPressure_FreeStream();
-  Density_FreeStream  = config->GetDensity_FreeStream();
-  Temperature_FreeStream = config->GetTemperature_FreeStream();
-
-  CFluidModel* auxFluidModel = nullptr;
-
-  switch (config->GetKind_FluidModel()) {
-
-    case STANDARD_AIR:
-
-      switch (config->GetSystemMeasurements()) {
-        case SI: config->SetGas_Constant(287.058); break;
-        case US: config->SetGas_Constant(1716.49); break;
-      }
-
-      auxFluidModel = new CIdealGas(1.4, config->GetGas_Constant());
-
-      if (free_stream_temp && aeroelastic) {
-        Temperature_FreeStream = TgammaR / (config->GetGas_Constant()*1.4);
-        config->SetTemperature_FreeStream(Temperature_FreeStream);
-      }
-      break;
-
-    case IDEAL_GAS:
-
-      auxFluidModel = new CIdealGas(Gamma, config->GetGas_Constant());
-      break;
-
-    case VW_GAS:
-
-      auxFluidModel = new CVanDerWaalsGas(Gamma, config->GetGas_Constant(),
-                 config->GetPressure_Critical(), config->GetTemperature_Critical());
-      break;
-
-    case PR_GAS:
-
-      auxFluidModel = new CPengRobinson(Gamma, config->GetGas_Constant(), config->GetPressure_Critical(),
-                                        config->GetTemperature_Critical(), config->GetAcentric_Factor());
-      break;
-
-    default:
-      SU2_MPI::Error("Unknown fluid model.", CURRENT_FUNCTION);
-      break;
-  }
-
-  if (free_stream_temp) {
-    auxFluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
-    Density_FreeStream = auxFluidModel->GetDensity();
-    config->SetDensity_FreeStream(Density_FreeStream);
-  }
-  else {
-    auxFluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
-    Temperature_FreeStream = auxFluidModel->GetTemperature();
-    config->SetTemperature_FreeStream(Temperature_FreeStream);
-  }
-
-  Mach2Vel_FreeStream = auxFluidModel->GetSoundSpeed();
-
-  /*--- Compute the Free Stream velocity, using the Mach number ---*/
-
-  if (nDim == 2) {
-    config->GetVelocity_FreeStream()[0] = cos(Alpha)*Mach*Mach2Vel_FreeStream;
-    config->GetVelocity_FreeStream()[1] = sin(Alpha)*Mach*Mach2Vel_FreeStream;
-  }
-  if (nDim == 3) {
-    config->GetVelocity_FreeStream()[0] = cos(Alpha)*cos(Beta)*Mach*Mach2Vel_FreeStream;
-    config->GetVelocity_FreeStream()[1] = sin(Beta)*Mach*Mach2Vel_FreeStream;
-    config->GetVelocity_FreeStream()[2] = sin(Alpha)*cos(Beta)*Mach*Mach2Vel_FreeStream;
-  }
-
-  /*--- Compute the modulus of the free stream velocity ---*/
-
-  ModVel_FreeStream = 0.0;
-  for (iDim = 0; iDim < nDim; iDim++)
-    ModVel_FreeStream += config->GetVelocity_FreeStream()[iDim]*config->GetVelocity_FreeStream()[iDim];
-  ModVel_FreeStream = sqrt(ModVel_FreeStream); config->SetModVel_FreeStream(ModVel_FreeStream);
-
-  /*--- Viscous initialization ---*/
-
-  if (viscous) {
-
-    /*--- The dimensional viscosity is needed to determine the free-stream conditions.
-          To accomplish this, simply set the non-dimensional coefficients to the
-          dimensional ones. This will be overruled later.---*/
-    config->SetMu_RefND(config->GetMu_Ref());
-    config->SetMu_Temperature_RefND(config->GetMu_Temperature_Ref());
-    config->SetMu_SND(config->GetMu_S());
-
-    config->SetMu_ConstantND(config->GetMu_Constant());
-
-    /*--- Reynolds based initialization ---*/
-
-    if (reynolds_init) {
-
-      /*--- First, check if there is mesh motion. If yes, use the Mach
-         number relative to the body to initialize the flow. ---*/
-
-      if (dynamic_grid) Velocity_Reynolds = config->GetMach_Motion()*Mach2Vel_FreeStream;
-      else Velocity_Reynolds = ModVel_FreeStream;
-
-      /*--- For viscous flows, pressure will be computed from a density
-            that is found from the Reynolds number. The viscosity is computed
-            from the dimensional version of Sutherland's law or the constant
-            viscosity, depending on the input option.---*/
-
-      auxFluidModel->SetLaminarViscosityModel(config);
-
-      Viscosity_FreeStream = auxFluidModel->GetLaminarViscosity();
-      config->SetViscosity_FreeStream(Viscosity_FreeStream);
-
-      Density_FreeStream = Reynolds*Viscosity_FreeStream/(Velocity_Reynolds*config->GetLength_Reynolds());
-      config->SetDensity_FreeStream(Density_FreeStream);
-      auxFluidModel->SetTDState_rhoT(Density_FreeStream, Temperature_FreeStream);
-      Pressure_FreeStream = auxFluidModel->GetPressure();
-      config->SetPressure_FreeStream(Pressure_FreeStream);
-      Energy_FreeStream = auxFluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
-
-    }
-
-    /*--- Thermodynamics quantities based initialization ---*/
-
-    else {
-
-      auxFluidModel->SetLaminarViscosityModel(config);
-      Viscosity_FreeStream = auxFluidModel->GetLaminarViscosity();
-      config->SetViscosity_FreeStream(Viscosity_FreeStream);
-      Energy_FreeStream = auxFluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
-
-    }
-
-    /*--- Turbulence kinetic energy ---*/
-
-    Tke_FreeStream  = 3.0/2.0*(ModVel_FreeStream*ModVel_FreeStream*config->GetTurbulenceIntensity_FreeStream()*config->GetTurbulenceIntensity_FreeStream());
-
-  }
-  else {
-
-    /*--- For inviscid flow, energy is calculated from the specified
-       FreeStream quantities using the proper gas law. ---*/
-
-    Energy_FreeStream = auxFluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
-
-  }
-
-  /*-- Compute the freestream energy. ---*/
-
-  if (tkeNeeded) { Energy_FreeStream += Tke_FreeStream; }; config->SetEnergy_FreeStream(Energy_FreeStream);
+  if (tkeNeeded) { Energy_FreeStream += Tke_FreeStream; }; config->SetEnergy_FreeStream(Energy_FreeStream);
 
   /*--- Compute non dimensional quantities. By definition,
      Lref is one because we have converted the grid to meters. ---*/
@@ -2039,6 +1643,12 @@ void CEulerSolver::SetNondimensionalization(CConfig *config, unsigned short iMes
   assert(FluidModel.empty() && "Potential memory leak!");
   FluidModel.resize(omp_get_max_threads());
 
+  /*--- The table of the tabulated model is built once and shared by the models of all threads. ---*/
+
+  shared_ptr<const CFluidTable> fluidTable;
+  if (config->GetKind_FluidModel() == TABULATED_GAS)
+    fluidTable = CTabulatedGas::CreateTable(config, Density_FreeStreamND, Temperature_FreeStreamND, MGLevel == MESH_0);
+
   SU2_OMP_PARALLEL
   {
     const int thread = omp_get_thread_num();
@@ -2065,6 +1675,10 @@ void CEulerSolver::SetNondimensionalization(CConfig *config, unsigned short iMes
                                                config->GetTemperature_Critical() / config->GetTemperature_Ref(),
                                                config->GetAcentric_Factor());
         break;
+
+      case TABULATED_GAS:
+        FluidModel[thread] = new CTabulatedGas(fluidTable, CTabulatedGas::CreateBaseModel(config, true));
+        break;
     }
 
     GetFluidModel()->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
@@ -2204,6 +1818,9 @@ void CEulerSolver::SetNondimensionalization(CConfig *config, unsigned short iMes
     case PR_GAS:
       ModelTable << "PR_GAS";
       break;
+    case TABULATED_GAS:
+      ModelTable << "TABULATED_GAS";
+      break;
     }
 
     if (config->GetKind_FluidModel() == VW_GAS || config->GetKind_FluidModel() == PR_GAS){
@@ -2595,9 +2212,7 @@ void CEulerSolver::CommonPreprocessing(CGeometry *geometry, CSolver **solver_con
   /*--- Artificial dissipation ---*/
 
   if (center && !Output) {
-    SetMax_Eigenvalue(geometry, config);
-    if (center_jst)
-      SetUndivided_Laplacian_And_Centered_Dissipation_Sensor(geometry, config);
+    SetCentered_Dissipation_Quantities(geometry, config, center_jst, iRKStep == 0);
   }
 
   /*--- Roe Low Dissipation Sensor ---*/
@@ -2609,6 +2224,10 @@ void CEulerSolver::CommonPreprocessing(CGeometry *geometry, CSolver **solver_con
     }
   }
 
+  /*--- Points of converged regions skipped by the residual loops. ---*/
+
+  if ((iMesh == MESH_0) && !Output) SetActiveSet(geometry, config);
+
   /*--- Initialize the Jacobian matrix and residual, not needed for the reducer strategy
    *    as we set blocks (including diagonal ones) and completely overwrite. ---*/
 
@@ -2640,19 +2259,22 @@ void CEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
 
     /*--- Gradient computation for MUSCL reconstruction. ---*/
 
-    switch (config->GetKind_Gradient_Method_Recon()) {
-      case GREEN_GAUSS:
-        SetPrimitive_Gradient_GG(geometry, config, true); break;
-      case LEAST_SQUARES:
-      case WEIGHTED_LEAST_SQUARES:
-        SetPrimitive_Gradient_LS(geometry, config, true); break;
-      default: break;
-    }
-
-    /*--- Limiter computation ---*/
+    /*--- With a limiter both are computed by the same kernel. ---*/
 
-    if (limiter && (iMesh == MESH_0) && !Output && !van_albada)
-      SetPrimitive_Limiter(geometry, config);
+    if (limiter && !van_albada) {
+      SetLimiterUpdate(geometry, config);
+      SetPrimitive_Gradient_Limiter(geometry, config, true);
+    }
+    else {
+      switch (config->GetKind_Gradient_Method_Recon()) {
+        case GREEN_GAUSS:
+          SetPrimitive_Gradient_GG(geometry, config, true); break;
+        case LEAST_SQUARES:
+        case WEIGHTED_LEAST_SQUARES:
+          SetPrimitive_Gradient_LS(geometry, config, true); break;
+        default: break;
+      }
+    }
   }
 
 }
@@ -2663,6 +2285,11 @@ unsigned long CEulerSolver::SetPrimitive_Variables(CSolver **solver_container, C
    *    further reduction if function is called in parallel ---*/
   unsigned long nonPhysicalPoints = 0;
 
+  /*--- Devirtualized point loop for the common fluid models. ---*/
+
+  if (SetPrimitive_Variables_Specialized(solver_container, config, nonPhysicalPoints))
+    return nonPhysicalPoints;
+
   SU2_OMP_FOR_STAT(omp_chunk_size)
   for (unsigned long iPoint = 0; iPoint < nPoint; iPoint ++) {
 
@@ -2679,6 +2306,158 @@ unsigned long CEulerSolver::SetPrimitive_Variables(CSolver **solver_container, C
   return nonPhysicalPoints;
 }
 
+template<class FluidModelType, class ViscosityModelType, bool Viscous>
+unsigned long CEulerSolver::SetPrimitive_Variables_Batched(CSolver **solver_container, const CConfig *config) {
+
+  using VariableType = typename conditional<Viscous, CNSVariable, CEulerVariable>::type;
+  constexpr auto SIZE = CFluidBatch::SIZE;
+
+  auto flowNodes = static_cast<VariableType*>(nodes);
+  auto fluidModel = static_cast<FluidModelType*>(GetFluidModel());
+  auto viscosityModel = static_cast<const ViscosityModelType*>(fluidModel->GetViscosityModel());
+  auto conductivityModel = static_cast<const CConstantPrandtl*>(fluidModel->GetConductivityModel());
+
+  const unsigned short turb_model = config->GetKind_Turb_Model();
+  const bool tkeNeeded = (turb_model == SST) || (turb_model == SST_SUST);
+  const bool hybridRANSLES = (config->GetKind_HybridRANSLES() != NO_HYBRIDRANSLES);
+
+  CVariable* turbNodes = nullptr;
+  if (Viscous && (turb_model != NONE) && (solver_container[TURB_SOL] != nullptr))
+    turbNodes = solver_container[TURB_SOL]->GetNodes();
+
+  unsigned long nonPhysicalPoints = 0;
+  const unsigned long nBatch = roundUpDiv(nPoint, SIZE);
+
+  SU2_OMP_FOR_STAT(roundUpDiv(omp_chunk_size, SIZE))
+  for (unsigned long iBatch = 0; iBatch < nBatch; ++iBatch) {
+
+    const unsigned long begin = iBatch*SIZE;
+    const unsigned long nLane = min<unsigned long>(SIZE, nPoint-begin);
+
+    CFluidBatch batch;
+    su2double eddy_visc[SIZE] = {0.0}, turb_ke[SIZE] = {0.0};
+
+    /*--- Gather the thermodynamic inputs (velocity is set), the lanes past the last point repeat it. ---*/
+
+    for (unsigned long k = 0; k < nLane; ++k) {
+      const unsigned long iPoint = begin + k;
+
+      if (turbNodes != nullptr) {
+        eddy_visc[k] = turbNodes->GetmuT(iPoint);
+        if (tkeNeeded) turb_ke[k] = turbNodes->GetSolution(iPoint,0);
+        if (hybridRANSLES) flowNodes->SetDES_LengthScale(iPoint, turbNodes->GetDES_LengthScale(iPoint));
+      }
+
+      flowNodes->SetVelocity(iPoint);
+      batch.Density[k] = flowNodes->GetDensity(iPoint);
+      batch.StaticEnergy[k] = flowNodes->GetEnergy(iPoint) - 0.5*flowNodes->GetVelocity2(iPoint) - turb_ke[k];
+    }
+    for (unsigned long k = nLane; k < SIZE; ++k) {
+      batch.Density[k] = batch.Density[nLane-1];
+      batch.StaticEnergy[k] = batch.StaticEnergy[nLane-1];
+    }
+
+    /*--- Thermodynamic state and transport properties (statically bound). ---*/
+
+    fluidModel->SetTDState_rhoe(batch);
+
+    if (Viscous) {
+      viscosityModel->SetViscosity(batch);
+      conductivityModel->SetConductivity(batch);
+    }
+
+    /*--- Scatter the primitive and secondary variables. ---*/
+
+    for (unsigned long k = 0; k < nLane; ++k) {
+      const unsigned long iPoint = begin + k;
+
+      const bool physical = (batch.Density[k] > 0.0) && (batch.Pressure[k] > 0.0) &&
+                            (batch.SoundSpeed2[k] >= 0.0) && (batch.Temperature[k] > 0.0);
+
+      if (!physical) {
+
+        /*--- Copy the old solution and recompute the primitives with the generic method. ---*/
+
+        for (unsigned long iVar = 0; iVar < nVar; iVar++)
+          flowNodes->SetSolution(iPoint, iVar, flowNodes->GetSolution_Old(iPoint, iVar));
+
+        CVariable* baseNodes = nodes;
+        if (Viscous) baseNodes->SetPrimVar(iPoint, eddy_visc[k], turb_ke[k], fluidModel);
+        else baseNodes->SetPrimVar(iPoint, fluidModel);
+        baseNodes->SetSecondaryVar(iPoint, fluidModel);
+
+        nonPhysicalPoints++;
+        continue;
+      }
+
+      flowNodes->SetDensity(iPoint);
+      flowNodes->SetPressure(iPoint, batch.Pressure[k]);
+      flowNodes->SetSoundSpeed(iPoint, batch.SoundSpeed2[k]);
+      flowNodes->SetTemperature(iPoint, batch.Temperature[k]);
+      flowNodes->SetEnthalpy(iPoint);
+
+      flowNodes->SetdPdrho_e(iPoint, batch.dPdrho_e[k]);
+      flowNodes->SetdPde_rho(iPoint, batch.dPde_rho[k]);
+
+      if (Viscous) {
+        flowNodes->SetLaminarViscosity(iPoint, batch.Mu[k]);
+        flowNodes->SetEddyViscosity(iPoint, eddy_visc[k]);
+        flowNodes->SetThermalConductivity(iPoint, batch.Kt[k]);
+        flowNodes->SetSpecificHeatCp(iPoint, batch.Cp[k]);
+
+        flowNodes->SetdTdrho_e(iPoint, batch.dTdrho_e[k]);
+        flowNodes->SetdTde_rho(iPoint, batch.dTde_rho[k]);
+        flowNodes->Setdmudrho_T(iPoint, batch.dmudrho_T[k]);
+        flowNodes->SetdmudT_rho(iPoint, batch.dmudT_rho[k]);
+        flowNodes->Setdktdrho_T(iPoint, batch.dktdrho_T[k]);
+        flowNodes->SetdktdT_rho(iPoint, batch.dktdT_rho[k]);
+      }
+    }
+  }
+
+  return nonPhysicalPoints;
+}
+
+template<class FluidModelType>
+bool CEulerSolver::SetPrimitive_Variables_Transport(CSolver **solver_container, const CConfig *config,
+                                                    unsigned long &nonPhysicalPoints) {
+  if (!config->GetViscous()) {
+    nonPhysicalPoints = SetPrimitive_Variables_Batched<FluidModelType, CConstantViscosity, false>(solver_container, config);
+    return true;
+  }
+
+  /*--- Only the (laminar) constant Prandtl conductivity, the turbulent variant depends on state of the fluid model. ---*/
+
+  if ((config->GetKind_ConductivityModel() != CONSTANT_PRANDTL) ||
+      (config->GetKind_ConductivityModel_Turb() == CONSTANT_PRANDTL_TURB)) return false;
+
+  switch (config->GetKind_ViscosityModel()) {
+    case CONSTANT_VISCOSITY:
+      nonPhysicalPoints = SetPrimitive_Variables_Batched<FluidModelType, CConstantViscosity, true>(solver_container, config);
+      return true;
+    case SUTHERLAND:
+      nonPhysicalPoints = SetPrimitive_Variables_Batched<FluidModelType, CSutherland, true>(solver_container, config);
+      return true;
+  }
+  return false;
+}
+
+bool CEulerSolver::SetPrimitive_Variables_Specialized(CSolver **solver_container, const CConfig *config,
+                                                      unsigned long &nonPhysicalPoints) {
+  switch (config->GetKind_FluidModel()) {
+    case STANDARD_AIR:
+    case IDEAL_GAS:
+      return SetPrimitive_Variables_Transport<CIdealGas>(solver_container, config, nonPhysicalPoints);
+    case VW_GAS:
+      return SetPrimitive_Variables_Transport<CVanDerWaalsGas>(solver_container, config, nonPhysicalPoints);
+    case PR_GAS:
+      return SetPrimitive_Variables_Transport<CPengRobinson>(solver_container, config, nonPhysicalPoints);
+    case TABULATED_GAS:
+      return SetPrimitive_Variables_Transport<CTabulatedGas>(solver_container, config, nonPhysicalPoints);
+  }
+  return false;
+}
+
 void CEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container, CConfig *config,
                                 unsigned short iMesh, unsigned long Iteration) {
 
@@ -2707,120 +2486,131 @@ void CEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container,
   unsigned long iEdge, iVertex, iPoint, jPoint;
   unsigned short iDim, iMarker;
 
-  /*--- Loop domain points. ---*/
+  /*--- The spectral radii are computed here unless the preprocessing already did it (see
+   *    SetCentered_Dissipation_Quantities), in which case the edge sweeps are skipped. ---*/
 
-  SU2_OMP_FOR_DYN(omp_chunk_size)
-  for (iPoint = 0; iPoint < nPointDomain; ++iPoint) {
+  const bool radiiReady = SpectralRadiiReady;
 
-    auto node_i = geometry->node[iPoint];
+  if (!radiiReady) {
+    /*--- Loop domain points. ---*/
 
-    /*--- Set maximum eigenvalues to zero. ---*/
+    SU2_OMP_FOR_DYN(omp_chunk_size)
+    for (iPoint = 0; iPoint < nPointDomain; ++iPoint) {
 
-    nodes->SetMax_Lambda_Inv(iPoint,0.0);
+      auto node_i = geometry->node[iPoint];
 
-    if (viscous)
-      nodes->SetMax_Lambda_Visc(iPoint,0.0);
+      /*--- Set maximum eigenvalues to zero. ---*/
 
-    /*--- Loop over the neighbors of point i. ---*/
+      nodes->SetMax_Lambda_Inv(iPoint,0.0);
 
-    for (unsigned short iNeigh = 0; iNeigh < node_i->GetnPoint(); ++iNeigh)
-    {
-      jPoint = node_i->GetPoint(iNeigh);
-      auto node_j = geometry->node[jPoint];
+      if (viscous)
+        nodes->SetMax_Lambda_Visc(iPoint,0.0);
 
-      iEdge = node_i->GetEdge(iNeigh);
-      Normal = geometry->edge[iEdge]->GetNormal();
-      Area = 0.0; for (iDim = 0; iDim < nDim; iDim++) Area += pow(Normal[iDim],2); Area = sqrt(Area);
+      /*--- Loop over the neighbors of point i. ---*/
 
-      /*--- Mean Values ---*/
+      for (unsigned short iNeigh = 0; iNeigh < node_i->GetnPoint(); ++iNeigh)
+      {
+        jPoint = node_i->GetPoint(iNeigh);
+        auto node_j = geometry->node[jPoint];
 
-      Mean_ProjVel = 0.5 * (nodes->GetProjVel(iPoint,Normal) + nodes->GetProjVel(jPoint,Normal));
-      Mean_SoundSpeed = 0.5 * (nodes->GetSoundSpeed(iPoint) + nodes->GetSoundSpeed(jPoint)) * Area;
+        iEdge = node_i->GetEdge(iNeigh);
+        Normal = geometry->edge[iEdge]->GetNormal();
+        Area = 0.0; for (iDim = 0; iDim < nDim; iDim++) Area += pow(Normal[iDim],2); Area = sqrt(Area);
 
-      /*--- Adjustment for grid movement ---*/
+        /*--- Mean Values ---*/
 
-      if (dynamic_grid) {
-        const su2double *GridVel_i = node_i->GetGridVel();
-        const su2double *GridVel_j = node_j->GetGridVel();
+        Mean_ProjVel = 0.5 * (nodes->GetProjVel(iPoint,Normal) + nodes->GetProjVel(jPoint,Normal));
+        Mean_SoundSpeed = 0.5 * (nodes->GetSoundSpeed(iPoint) + nodes->GetSoundSpeed(jPoint)) * Area;
 
-        for (iDim = 0; iDim < nDim; iDim++)
-          Mean_ProjVel -= 0.5 * (GridVel_i[iDim] + GridVel_j[iDim]) * Normal[iDim];
-      }
+        /*--- Adjustment for grid movement ---*/
 
-      /*--- Inviscid contribution ---*/
+        if (dynamic_grid) {
+          const su2double *GridFlux = geometry->GetEdgeGridFlux(iEdge);
+          if (GridFlux) Mean_ProjVel -= *GridFlux;
+          else {
+            const su2double *GridVel_i = node_i->GetGridVel();
+            const su2double *GridVel_j = node_j->GetGridVel();
 
-      Lambda = fabs(Mean_ProjVel) + Mean_SoundSpeed ;
-      nodes->AddMax_Lambda_Inv(iPoint,Lambda);
+            for (iDim = 0; iDim < nDim; iDim++)
+              Mean_ProjVel -= 0.5 * (GridVel_i[iDim] + GridVel_j[iDim]) * Normal[iDim];
+          }
+        }
 
-      /*--- Viscous contribution ---*/
+        /*--- Inviscid contribution ---*/
 
-      if (!viscous) continue;
+        Lambda = fabs(Mean_ProjVel) + Mean_SoundSpeed ;
+        nodes->AddMax_Lambda_Inv(iPoint,Lambda);
 
-      Mean_LaminarVisc = 0.5*(nodes->GetLaminarViscosity(iPoint) + nodes->GetLaminarViscosity(jPoint));
-      Mean_EddyVisc    = 0.5*(nodes->GetEddyViscosity(iPoint) + nodes->GetEddyViscosity(jPoint));
-      Mean_Density     = 0.5*(nodes->GetDensity(iPoint) + nodes->GetDensity(jPoint));
+        /*--- Viscous contribution ---*/
 
-      Lambda_1 = (4.0/3.0)*(Mean_LaminarVisc + Mean_EddyVisc);
-      //TODO (REAL_GAS) removing Gamma it cannot work with FLUIDPROP
-      Lambda_2 = (1.0 + (Prandtl_Lam/Prandtl_Turb)*(Mean_EddyVisc/Mean_LaminarVisc))*(Gamma*Mean_LaminarVisc/Prandtl_Lam);
+        if (!viscous) continue;
 
-      Lambda = (Lambda_1 + Lambda_2)*Area*Area/Mean_Density;
-      nodes->AddMax_Lambda_Visc(iPoint, Lambda);
-    }
+        Mean_LaminarVisc = 0.5*(nodes->GetLaminarViscosity(iPoint) + nodes->GetLaminarViscosity(jPoint));
+        Mean_EddyVisc    = 0.5*(nodes->GetEddyViscosity(iPoint) + nodes->GetEddyViscosity(jPoint));
+        Mean_Density     = 0.5*(nodes->GetDensity(iPoint) + nodes->GetDensity(jPoint));
 
-  }
+        Lambda_1 = (4.0/3.0)*(Mean_LaminarVisc + Mean_EddyVisc);
+        //TODO (REAL_GAS) removing Gamma it cannot work with FLUIDPROP
+        Lambda_2 = (1.0 + (Prandtl_Lam/Prandtl_Turb)*(Mean_EddyVisc/Mean_LaminarVisc))*(Gamma*Mean_LaminarVisc/Prandtl_Lam);
 
-  /*--- Loop boundary edges ---*/
+        Lambda = (Lambda_1 + Lambda_2)*Area*Area/Mean_Density;
+        nodes->AddMax_Lambda_Visc(iPoint, Lambda);
+      }
 
-  for (iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
-    if ((config->GetMarker_All_KindBC(iMarker) != INTERNAL_BOUNDARY) &&
-        (config->GetMarker_All_KindBC(iMarker) != PERIODIC_BOUNDARY)) {
+    }
 
-      SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
-      for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+    /*--- Loop boundary edges ---*/
 
-        /*--- Point identification, Normal vector and area ---*/
+    for (iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
+      if ((config->GetMarker_All_KindBC(iMarker) != INTERNAL_BOUNDARY) &&
+          (config->GetMarker_All_KindBC(iMarker) != PERIODIC_BOUNDARY)) {
 
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+        for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
 
-        if (!geometry->node[iPoint]->GetDomain()) continue;
+          /*--- Point identification, Normal vector and area ---*/
 
-        Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
-        Area = 0.0; for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim]; Area = sqrt(Area);
+          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+
+          if (!geometry->node[iPoint]->GetDomain()) continue;
+
+          Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+          Area = 0.0; for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim]; Area = sqrt(Area);
 
-        /*--- Mean Values ---*/
+          /*--- Mean Values ---*/
 
-        Mean_ProjVel = nodes->GetProjVel(iPoint,Normal);
-        Mean_SoundSpeed = nodes->GetSoundSpeed(iPoint) * Area;
+          Mean_ProjVel = nodes->GetProjVel(iPoint,Normal);
+          Mean_SoundSpeed = nodes->GetSoundSpeed(iPoint) * Area;
 
-        /*--- Adjustment for grid movement ---*/
+          /*--- Adjustment for grid movement ---*/
 
-        if (dynamic_grid) {
-          const su2double *GridVel = geometry->node[iPoint]->GetGridVel();
+          if (dynamic_grid) {
+            const su2double *GridVel = geometry->node[iPoint]->GetGridVel();
 
-          for (iDim = 0; iDim < nDim; iDim++)
-            Mean_ProjVel -= GridVel[iDim]*Normal[iDim];
-        }
+            for (iDim = 0; iDim < nDim; iDim++)
+              Mean_ProjVel -= GridVel[iDim]*Normal[iDim];
+          }
 
-        /*--- Inviscid contribution ---*/
+          /*--- Inviscid contribution ---*/
 
-        Lambda = fabs(Mean_ProjVel) + Mean_SoundSpeed;
-        nodes->AddMax_Lambda_Inv(iPoint,Lambda);
+          Lambda = fabs(Mean_ProjVel) + Mean_SoundSpeed;
+          nodes->AddMax_Lambda_Inv(iPoint,Lambda);
 
-        /*--- Viscous contribution ---*/
+          /*--- Viscous contribution ---*/
 
-        if (!viscous) continue;
+          if (!viscous) continue;
 
-        Mean_LaminarVisc = nodes->GetLaminarViscosity(iPoint);
-        Mean_EddyVisc    = nodes->GetEddyViscosity(iPoint);
-        Mean_Density     = nodes->GetDensity(iPoint);
+          Mean_LaminarVisc = nodes->GetLaminarViscosity(iPoint);
+          Mean_EddyVisc    = nodes->GetEddyViscosity(iPoint);
+          Mean_Density     = nodes->GetDensity(iPoint);
 
-        Lambda_1 = (4.0/3.0)*(Mean_LaminarVisc + Mean_EddyVisc);
-        Lambda_2 = (1.0 + (Prandtl_Lam/Prandtl_Turb)*(Mean_EddyVisc/Mean_LaminarVisc))*(Gamma*Mean_LaminarVisc/Prandtl_Lam);
-        Lambda = (Lambda_1 + Lambda_2)*Area*Area/Mean_Density;
+          Lambda_1 = (4.0/3.0)*(Mean_LaminarVisc + Mean_EddyVisc);
+          Lambda_2 = (1.0 + (Prandtl_Lam/Prandtl_Turb)*(Mean_EddyVisc/Mean_LaminarVisc))*(Gamma*Mean_LaminarVisc/Prandtl_Lam);
+          Lambda = (Lambda_1 + Lambda_2)*Area*Area/Mean_Density;
 
-        nodes->AddMax_Lambda_Visc(iPoint, Lambda);
+          nodes->AddMax_Lambda_Visc(iPoint, Lambda);
 
+        }
       }
     }
   }
@@ -2862,16 +2652,21 @@ void CEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container,
     SU2_OMP_BARRIER
   }
 
-  /*--- Compute the min/max dt (in parallel, now over mpi ranks). ---*/
+  /*--- Compute the min/max dt (in parallel, now over mpi ranks), the spectral
+   *    radii of the preprocessing are used only once. ---*/
 
   SU2_OMP_MASTER
-  if (config->GetComm_Level() == COMM_FULL) {
-    su2double rbuf_time;
-    SU2_MPI::Allreduce(&Min_Delta_Time, &rbuf_time, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
-    Min_Delta_Time = rbuf_time;
+  {
+    SpectralRadiiReady = false;
+
+    if (config->GetComm_Level() == COMM_FULL) {
+      su2double rbuf_time;
+      SU2_MPI::Allreduce(&Min_Delta_Time, &rbuf_time, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+      Min_Delta_Time = rbuf_time;
 
-    SU2_MPI::Allreduce(&Max_Delta_Time, &rbuf_time, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
-    Max_Delta_Time = rbuf_time;
+      SU2_MPI::Allreduce(&Max_Delta_Time, &rbuf_time, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+      Max_Delta_Time = rbuf_time;
+    }
   }
   SU2_OMP_BARRIER
 
@@ -2942,6 +2737,40 @@ void CEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container,
 
 }
 
+template<class EdgeResidualFunc>
+void CEulerSolver::OwnerComputesEdgeLoop(CGeometry *geometry, CSolver **solver_container,
+                                         CNumerics **numerics_container, CConfig *config,
+                                         bool implicit, EdgeResidualFunc computeEdge) {
+
+  CNumerics* visc_numerics = numerics_container[VISC_TERM + omp_get_thread_num()*MAX_TERMS];
+
+  /*--- Each point computes the fluxes of all its edges and updates only its row of the system,
+   *    the rows are overwritten (as with the reducer strategy) hence they are zeroed first. ---*/
+
+  SU2_OMP_FOR_DYN(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+
+    LinSysRes.SetBlock_Zero(iPoint);
+    if (implicit) Jacobian.SetBlock2DiagZero(iPoint);
+
+    for (unsigned short iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); ++iNeigh) {
+
+      const auto iEdge = geometry->node[iPoint]->GetEdge(iNeigh);
+      const auto node0 = geometry->GetEdgeNode(iEdge,0);
+      const auto node1 = geometry->GetEdgeNode(iEdge,1);
+
+      if (SkipEdge(node0, node1)) continue;
+
+      const auto& residual = computeEdge(iEdge, node0, node1);
+
+      auto viscous = ViscousEdgeResidual(iEdge, geometry, solver_container, visc_numerics, config);
+
+      UpdateOwnerContribution(iEdge, iPoint, iPoint == node0, implicit, residual, viscous);
+    }
+  }
+
+}
+
 void CEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
                                      CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
 
@@ -2951,21 +2780,14 @@ void CEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_conta
   /*--- Pick one numerics object per thread. ---*/
   CNumerics* numerics = numerics_container[CONV_TERM + omp_get_thread_num()*MAX_TERMS];
 
-  /*--- Loop over edge colors. ---*/
-  for (auto color : EdgeColoring)
-  {
-  /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
-  SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
-  for(auto k = 0ul; k < color.size; ++k) {
-
-    auto iEdge = color.indices[k];
+  /*--- Set the numerics for an edge and compute its residual. ---*/
 
-    /*--- Points in edge, set normal vectors, and number of neighbors ---*/
+  auto computeEdge = [&](unsigned long iEdge, unsigned long iPoint, unsigned long jPoint)
+                     -> const CNumerics::StaticResidualType& {
 
-    auto iPoint = geometry->edge[iEdge]->GetNode(0);
-    auto jPoint = geometry->edge[iEdge]->GetNode(1);
+    /*--- Set normal vectors, and number of neighbors ---*/
 
-    numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
+    numerics->SetNormal(geometry->GetEdgeNormal(iEdge));
     numerics->SetNeighbor(geometry->node[iPoint]->GetnNeighbor(), geometry->node[jPoint]->GetnNeighbor());
 
     /*--- Set primitive variables w/o reconstruction ---*/
@@ -2988,31 +2810,47 @@ void CEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_conta
     /*--- Grid movement ---*/
 
     if (dynamic_grid) {
-      numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(), geometry->node[jPoint]->GetGridVel());
+      const su2double *GridFlux = geometry->GetEdgeGridFlux(iEdge);
+      if (GridFlux) numerics->SetGridFlux(GridFlux);
+      else numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(), geometry->node[jPoint]->GetGridVel());
     }
 
     /*--- Compute residuals, and Jacobians ---*/
 
-    auto residual = numerics->ComputeResidual(config);
+    return numerics->ComputeStaticResidual(config);
+  };
 
-    /*--- Update convective and artificial dissipation residuals. ---*/
+  if (OwnerComputes) {
+    OwnerComputesEdgeLoop(geometry, solver_container, numerics_container, config, implicit, computeEdge);
+    return;
+  }
 
-    if (ReducerStrategy) {
-      EdgeFluxes.SetBlock(iEdge, residual);
-      if (implicit)
-        Jacobian.SetBlocks(iEdge, residual.jacobian_i, residual.jacobian_j);
-    }
-    else {
-      LinSysRes.AddBlock(iPoint, residual);
-      LinSysRes.SubtractBlock(jPoint, residual);
-      if (implicit)
-        Jacobian.UpdateBlocks(iEdge, iPoint, jPoint, residual.jacobian_i, residual.jacobian_j);
-    }
+  /*--- Loop over edge colors. ---*/
+  for (auto color : EdgeColoring)
+  {
+  /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+  SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+  for(auto k = 0ul; k < color.size; ++k) {
+
+    auto iEdge = color.indices[k];
+
+    /*--- Points in edge ---*/
+
+    auto iPoint = geometry->GetEdgeNode(iEdge,0);
+    auto jPoint = geometry->GetEdgeNode(iEdge,1);
+
+    if (SkipEdge(iPoint, jPoint)) continue;
+
+    const auto& residual = computeEdge(iEdge, iPoint, jPoint);
 
     /*--- Viscous contribution. ---*/
 
-    Viscous_Residual(iEdge, geometry, solver_container,
-                     numerics_container[VISC_TERM + omp_get_thread_num()*MAX_TERMS], config);
+    auto viscous = ViscousEdgeResidual(iEdge, geometry, solver_container,
+                                       numerics_container[VISC_TERM + omp_get_thread_num()*MAX_TERMS], config);
+
+    /*--- Update convective, artificial dissipation, and viscous residuals. ---*/
+
+    UpdateEdgeContribution(iEdge, iPoint, jPoint, implicit, residual, viscous);
   }
   } // end color loop
 
@@ -3029,17 +2867,16 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
 
   const auto InnerIter        = config->GetInnerIter();
   const bool implicit         = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
-  const bool ideal_gas        = (config->GetKind_FluidModel() == STANDARD_AIR) ||
-                                (config->GetKind_FluidModel() == IDEAL_GAS);
 
   const bool roe_turkel       = (config->GetKind_Upwind_Flow() == TURKEL);
-  const bool low_mach_corr    = config->Low_Mach_Correction();
   const auto kind_dissipation = config->GetKind_RoeLowDiss();
 
   const bool muscl            = (config->GetMUSCL_Flow() && (iMesh == MESH_0));
   const bool limiter          = (config->GetKind_SlopeLimit_Flow() != NO_LIMITER) &&
                                 (InnerIter <= config->GetLimiterIter());
-  const bool van_albada       = (config->GetKind_SlopeLimit_Flow() == VAN_ALBADA_EDGE);
+
+  /*--- Halo exchange left pending by the preprocessing (see OVERLAP_HALO_COMMS). ---*/
+  const bool overlap          = GetPendingComms();
 
   /*--- Non-physical counter. ---*/
   unsigned long counter_local = 0;
@@ -3053,6 +2890,62 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
   su2double Primitive_i[MAXNVAR] = {0.0}, Primitive_j[MAXNVAR] = {0.0};
   su2double Secondary_i[MAXNVAR] = {0.0}, Secondary_j[MAXNVAR] = {0.0};
 
+  /*--- Owner-computes strategy for the first order scheme (see the constructor). ---*/
+  const bool ownerComputes = OwnerComputes && !muscl;
+
+  /*--- Pack the data of the reconstruction, the halo points are packed once their exchange completes. ---*/
+  if (PackedEdgeData && muscl)
+    PackEdgeLoopData(limiter, 0, overlap? nPointDomain : nPoint);
+
+  if (ownerComputes) {
+    if (overlap) {
+      SU2_OMP_MASTER
+      CompletePendingComms(geometry, config);
+      SU2_OMP_BARRIER
+    }
+
+    auto computeEdge = [&](unsigned long iEdge, unsigned long iPoint, unsigned long jPoint)
+                       -> const CNumerics::StaticResidualType& {
+
+      numerics->SetNormal(geometry->GetEdgeNormal(iEdge));
+
+      if (roe_turkel) {
+        su2double sqvel = 0.0;
+        for (unsigned short iDim = 0; iDim < nDim; iDim ++)
+          sqvel += pow(config->GetVelocity_FreeStream()[iDim], 2);
+        numerics->SetVelocity2_Inf(sqvel);
+      }
+
+      if (dynamic_grid) {
+        const su2double *GridFlux = geometry->GetEdgeGridFlux(iEdge);
+        if (GridFlux) numerics->SetGridFlux(GridFlux);
+        else numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(),
+                                  geometry->node[jPoint]->GetGridVel());
+      }
+
+      numerics->SetPrimitive(nodes->GetPrimitive(iPoint), nodes->GetPrimitive(jPoint));
+      numerics->SetSecondary(nodes->GetSecondary(iPoint), nodes->GetSecondary(jPoint));
+
+      return numerics->ComputeStaticResidual(config);
+    };
+
+    OwnerComputesEdgeLoop(geometry, solver_container, numerics_container, config, implicit, computeEdge);
+  }
+  /*--- Vectorized numerics for batches of edges, if supported by the options. ---*/
+  else if (BatchNumerics != nullptr) {
+    counter_local = Upwind_Residual_Batched(geometry, solver_container, numerics_container, config, iMesh);
+  }
+  else {
+    /*--- With a pending halo exchange, the edges without halo points are computed first,
+     *    then the exchange is completed and the remaining edges are computed. ---*/
+  for (auto iPass = overlap? 0u : 1u; iPass < 2; ++iPass)
+  {
+  if (overlap && (iPass == 1)) {
+    SU2_OMP_MASTER
+    CompletePendingComms(geometry, config);
+    SU2_OMP_BARRIER
+    if (PackedEdgeData && muscl) PackEdgeLoopData(limiter, nPointDomain, nPoint);
+  }
     /*--- Loop over edge colors. ---*/
   for (auto color : EdgeColoring)
   {
@@ -3062,17 +2955,21 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
 
     auto iEdge = color.indices[k];
 
-    unsigned short iDim, iVar;
+    if (overlap && (geometry->GetEdgeHalo(iEdge) != (iPass == 1))) continue;
+
+    unsigned short iDim;
 
     /*--- Points in edge and normal vectors ---*/
 
-    auto iPoint = geometry->edge[iEdge]->GetNode(0);
-    auto jPoint = geometry->edge[iEdge]->GetNode(1);
+    auto iPoint = geometry->GetEdgeNode(iEdge,0);
+    auto jPoint = geometry->GetEdgeNode(iEdge,1);
+
+    if (SkipEdge(iPoint, jPoint)) continue;
 
-    numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
+    numerics->SetNormal(geometry->GetEdgeNormal(iEdge));
 
-    auto Coord_i = geometry->node[iPoint]->GetCoord();
-    auto Coord_j = geometry->node[jPoint]->GetCoord();
+    auto Coord_i = geometry->GetPointCoord(iPoint);
+    auto Coord_j = geometry->GetPointCoord(jPoint);
 
     /*--- Roe Turkel preconditioning ---*/
 
@@ -3086,8 +2983,10 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
     /*--- Grid movement ---*/
 
     if (dynamic_grid) {
-      numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(),
-                           geometry->node[jPoint]->GetGridVel());
+      const su2double *GridFlux = geometry->GetEdgeGridFlux(iEdge);
+      if (GridFlux) numerics->SetGridFlux(GridFlux);
+      else numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(),
+                                geometry->node[jPoint]->GetGridVel());
     }
 
     /*--- Get primitive and secondary variables ---*/
@@ -3106,190 +3005,498 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
     else {
       /*--- Reconstruction ---*/
 
-      su2double Vector_ij[MAXNDIM] = {0.0};
-      for (iDim = 0; iDim < nDim; iDim++) {
-        Vector_ij[iDim] = 0.5*(Coord_j[iDim] - Coord_i[iDim]);
-      }
+      bool bad_i = false, bad_j = false;
+
+      ReconstructEdgeVariables(geometry, config, iEdge, iPoint, jPoint, limiter, Primitive_i, Primitive_j,
+                               Secondary_i, Secondary_j, bad_i, bad_j);
+
+      counter_local += bad_i+bad_j;
+
+      numerics->SetPrimitive(bad_i? V_i : Primitive_i,  bad_j? V_j : Primitive_j);
+      numerics->SetSecondary(bad_i? S_i : Secondary_i,  bad_j? S_j : Secondary_j);
 
-      auto Gradient_i = nodes->GetGradient_Reconstruction(iPoint);
-      auto Gradient_j = nodes->GetGradient_Reconstruction(jPoint);
+    }
+
+    /*--- Roe Low Dissipation Scheme ---*/
+
+    if (kind_dissipation != NO_ROELOWDISS) {
 
-      su2double *Limiter_i = nullptr, *Limiter_j = nullptr;
+      numerics->SetDissipation(nodes->GetRoe_Dissipation(iPoint),
+                               nodes->GetRoe_Dissipation(jPoint));
 
-      if (limiter) {
-        Limiter_i = nodes->GetLimiter_Primitive(iPoint);
-        Limiter_j = nodes->GetLimiter_Primitive(jPoint);
+      if (kind_dissipation == FD_DUCROS || kind_dissipation == NTS_DUCROS){
+        numerics->SetSensor(nodes->GetSensor(iPoint),
+                            nodes->GetSensor(jPoint));
+      }
+      if (kind_dissipation == NTS || kind_dissipation == NTS_DUCROS){
+        numerics->SetCoord(Coord_i, Coord_j);
       }
+    }
 
-      for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+    /*--- Compute the residual ---*/
 
-        su2double Project_Grad_i = 0.0;
-        su2double Project_Grad_j = 0.0;
+    const auto& residual = numerics->ComputeStaticResidual(config);
 
-        for (iDim = 0; iDim < nDim; iDim++) {
-          Project_Grad_i += Vector_ij[iDim]*Gradient_i[iVar][iDim];
-          Project_Grad_j -= Vector_ij[iDim]*Gradient_j[iVar][iDim];
-        }
+    /*--- Set the final value of the Roe dissipation coefficient ---*/
 
-        if (limiter) {
-          if (van_albada) {
-            su2double V_ij = V_j[iVar] - V_i[iVar];
-            Limiter_i[iVar] = V_ij*( 2.0*Project_Grad_i + V_ij) / (4*pow(Project_Grad_i, 2) + pow(V_ij, 2) + EPS);
-            Limiter_j[iVar] = V_ij*(-2.0*Project_Grad_j + V_ij) / (4*pow(Project_Grad_j, 2) + pow(V_ij, 2) + EPS);
-          }
-          Primitive_i[iVar] = V_i[iVar] + Limiter_i[iVar]*Project_Grad_i;
-          Primitive_j[iVar] = V_j[iVar] + Limiter_j[iVar]*Project_Grad_j;
-        }
-        else {
-          Primitive_i[iVar] = V_i[iVar] + Project_Grad_i;
-          Primitive_j[iVar] = V_j[iVar] + Project_Grad_j;
-        }
+    if ((kind_dissipation != NO_ROELOWDISS) && (MGLevel != MESH_0)) {
+      nodes->SetRoe_Dissipation(iPoint,numerics->GetDissipation());
+      nodes->SetRoe_Dissipation(jPoint,numerics->GetDissipation());
+    }
+
+    /*--- Viscous contribution. ---*/
+
+    auto viscous = ViscousEdgeResidual(iEdge, geometry, solver_container,
+                                       numerics_container[VISC_TERM + omp_get_thread_num()*MAX_TERMS], config);
+
+    /*--- Update residual value (and Jacobian) with both contributions. ---*/
+
+    UpdateEdgeContribution(iEdge, iPoint, jPoint, implicit, residual, viscous);
+  }
+  } // end color loop
+  } // end pass loop
+  }
+
+  if (ReducerStrategy && !ownerComputes) {
+    SumEdgeFluxes(geometry);
+    if (implicit)
+      Jacobian.SetDiagonalAsColumnSum();
+  }
+
+  /*--- Warning message about non-physical reconstructions. ---*/
+
+  if ((iMesh == MESH_0) && (config->GetComm_Level() == COMM_FULL)) {
+    /*--- Add counter results for all threads. ---*/
+    SU2_OMP_ATOMIC
+    ErrorCounter += counter_local;
+    SU2_OMP_BARRIER
+
+    /*--- Add counter results for all ranks. ---*/
+    SU2_OMP_MASTER
+    {
+      counter_local = ErrorCounter;
+      SU2_MPI::Reduce(&counter_local, &ErrorCounter, 1, MPI_UNSIGNED_LONG, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
+      config->SetNonphysical_Reconstr(ErrorCounter);
+    }
+    SU2_OMP_BARRIER
+  }
+
+}
+
+void CEulerSolver::ReconstructEdgeVariables(CGeometry *geometry, const CConfig *config, unsigned long iEdge,
+                                            unsigned long iPoint, unsigned long jPoint, bool limiter,
+                                            su2double *Primitive_i, su2double *Primitive_j,
+                                            su2double *Secondary_i, su2double *Secondary_j,
+                                            bool &bad_i, bool &bad_j) {
+
+  const bool ideal_gas     = (config->GetKind_FluidModel() == STANDARD_AIR) ||
+                             (config->GetKind_FluidModel() == IDEAL_GAS);
+  const bool low_mach_corr = config->Low_Mach_Correction();
+  const bool van_albada    = (config->GetKind_SlopeLimit_Flow() == VAN_ALBADA_EDGE);
+
+  unsigned short iDim, iVar;
+
+  auto V_i = nodes->GetPrimitive(iPoint);
+  auto V_j = nodes->GetPrimitive(jPoint);
+
+  su2double Vector_ij[MAXNDIM] = {0.0};
+  geometry->GetEdgeHalfVector(iEdge, Vector_ij);
+
+  su2double **Gradient_i = nullptr, **Gradient_j = nullptr;
+  const su2double *PackedGrad_i = nullptr, *PackedGrad_j = nullptr;
+  su2double *Limiter_i = nullptr, *Limiter_j = nullptr;
+
+  if (PackedEdgeData) {
+    /*--- One record per point, primitives, gradients, and limiters. ---*/
+    V_i = EdgeLoopData[iPoint];
+    V_j = EdgeLoopData[jPoint];
+    PackedGrad_i = V_i + nPrimVarGrad;
+    PackedGrad_j = V_j + nPrimVarGrad;
+    Limiter_i = EdgeLoopData[iPoint] + nPrimVarGrad*(nDim+1);
+    Limiter_j = EdgeLoopData[jPoint] + nPrimVarGrad*(nDim+1);
+  }
+  else {
+    Gradient_i = nodes->GetGradient_Reconstruction(iPoint);
+    Gradient_j = nodes->GetGradient_Reconstruction(jPoint);
+
+    if (limiter) {
+      Limiter_i = nodes->GetLimiter_Primitive(iPoint);
+      Limiter_j = nodes->GetLimiter_Primitive(jPoint);
+    }
+  }
 
+  for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+
+    su2double Project_Grad_i = 0.0;
+    su2double Project_Grad_j = 0.0;
+
+    if (PackedEdgeData) {
+      for (iDim = 0; iDim < nDim; iDim++) {
+        Project_Grad_i += Vector_ij[iDim]*PackedGrad_i[iVar*nDim+iDim];
+        Project_Grad_j -= Vector_ij[iDim]*PackedGrad_j[iVar*nDim+iDim];
+      }
+    }
+    else {
+      for (iDim = 0; iDim < nDim; iDim++) {
+        Project_Grad_i += Vector_ij[iDim]*Gradient_i[iVar][iDim];
+        Project_Grad_j -= Vector_ij[iDim]*Gradient_j[iVar][iDim];
+      }
+    }
+
+    if (limiter) {
+      if (van_albada) {
+        su2double V_ij = V_j[iVar] - V_i[iVar];
+        Limiter_i[iVar] = V_ij*( 2.0*Project_Grad_i + V_ij) / (4*pow(Project_Grad_i, 2) + pow(V_ij, 2) + EPS);
+        Limiter_j[iVar] = V_ij*(-2.0*Project_Grad_j + V_ij) / (4*pow(Project_Grad_j, 2) + pow(V_ij, 2) + EPS);
       }
+      Primitive_i[iVar] = V_i[iVar] + Limiter_i[iVar]*Project_Grad_i;
+      Primitive_j[iVar] = V_j[iVar] + Limiter_j[iVar]*Project_Grad_j;
+    }
+    else {
+      Primitive_i[iVar] = V_i[iVar] + Project_Grad_i;
+      Primitive_j[iVar] = V_j[iVar] + Project_Grad_j;
+    }
+
+  }
+
+  /*--- Recompute the reconstructed quantities in a thermodynamically consistent way. ---*/
 
-      /*--- Recompute the reconstructed quantities in a thermodynamically consistent way. ---*/
+  if (!ideal_gas || low_mach_corr) {
+    ComputeConsistentExtrapolation(GetFluidModel(), nDim, Primitive_i, Secondary_i);
+    ComputeConsistentExtrapolation(GetFluidModel(), nDim, Primitive_j, Secondary_j);
+  }
+
+  /*--- Low-Mach number correction. ---*/
+
+  if (low_mach_corr) {
+    LowMachPrimitiveCorrection(GetFluidModel(), nDim, Primitive_i, Primitive_j);
+  }
+
+  /*--- Check for non-physical solutions after reconstruction. If found, use the
+   cell-average value of the solution. This is a locally 1st order approximation,
+   which is typically only active during the start-up of a calculation. ---*/
+
+  bool neg_pres_or_rho_i = (Primitive_i[nDim+1] < 0.0) || (Primitive_i[nDim+2] < 0.0);
+  bool neg_pres_or_rho_j = (Primitive_j[nDim+1] < 0.0) || (Primitive_j[nDim+2] < 0.0);
+
+  su2double R = sqrt(fabs(Primitive_j[nDim+2]/Primitive_i[nDim+2]));
+  su2double sq_vel = 0.0;
+  for (iDim = 0; iDim < nDim; iDim++) {
+    su2double RoeVelocity = (R*Primitive_j[iDim+1]+Primitive_i[iDim+1])/(R+1);
+    sq_vel += pow(RoeVelocity, 2);
+  }
+  su2double RoeEnthalpy = (R*Primitive_j[nDim+3]+Primitive_i[nDim+3])/(R+1);
+
+  bool neg_sound_speed = ((Gamma-1)*(RoeEnthalpy-0.5*sq_vel) < 0.0);
+
+  bad_i = neg_sound_speed || neg_pres_or_rho_i;
+  bad_j = neg_sound_speed || neg_pres_or_rho_j;
+
+  nodes->SetNon_Physical(iPoint, bad_i);
+  nodes->SetNon_Physical(jPoint, bad_j);
+
+  /*--- Get updated state, in case the point recovered after the set. ---*/
+  bad_i = nodes->GetNon_Physical(iPoint);
+  bad_j = nodes->GetNon_Physical(jPoint);
+}
+
+void CEulerSolver::PackEdgeLoopData(bool limiter, unsigned long pointBegin, unsigned long pointEnd) {
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (auto iPoint = pointBegin; iPoint < pointEnd; ++iPoint) {
+
+    su2double* record = EdgeLoopData[iPoint];
+
+    const su2double* V = nodes->GetPrimitive(iPoint);
+    const su2double* const* Gradient = nodes->GetGradient_Reconstruction(iPoint);
+
+    for (unsigned short iVar = 0; iVar < nPrimVarGrad; iVar++) {
+      record[iVar] = V[iVar];
+      for (unsigned short iDim = 0; iDim < nDim; iDim++)
+        record[nPrimVarGrad + iVar*nDim + iDim] = Gradient[iVar][iDim];
+    }
+
+    if (!limiter) continue;
+
+    const su2double* Limiter = nodes->GetLimiter_Primitive(iPoint);
+
+    for (unsigned short iVar = 0; iVar < nPrimVarGrad; iVar++)
+      record[nPrimVarGrad*(nDim+1) + iVar] = Limiter[iVar];
+  }
+
+}
+
+unsigned long CEulerSolver::Upwind_Residual_Batched(CGeometry *geometry, CSolver **solver_container,
+                                                   CNumerics **numerics_container, CConfig *config,
+                                                   unsigned short iMesh) {
+
+  constexpr size_t BATCH = CUpwindEdgeBatch::SIZE;
+
+  const auto InnerIter = config->GetInnerIter();
+  const bool implicit  = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  const bool muscl     = (config->GetMUSCL_Flow() && (iMesh == MESH_0));
+  const bool limiter   = (config->GetKind_SlopeLimit_Flow() != NO_LIMITER) &&
+                         (InnerIter <= config->GetLimiterIter());
+
+  /*--- Primitives used by the schemes (T, velocity, p, rho, h). ---*/
+  const unsigned short nPrimUsed = nDim+4;
 
-      if (!ideal_gas || low_mach_corr) {
-        ComputeConsistentExtrapolation(GetFluidModel(), nDim, Primitive_i, Secondary_i);
-        ComputeConsistentExtrapolation(GetFluidModel(), nDim, Primitive_j, Secondary_j);
+  unsigned long counter_local = 0;
+
+  /*--- Batch and MUSCL-reconstructed variables of this thread (thread safety). ---*/
+  CUpwindEdgeBatch batch;
+  su2double Primitive_i[MAXNVAR] = {0.0}, Primitive_j[MAXNVAR] = {0.0};
+  su2double Secondary_i[MAXNVAR] = {0.0}, Secondary_j[MAXNVAR] = {0.0};
+
+  /*--- Flux and Jacobians of one edge, in the layout expected by the vector and matrix. ---*/
+  su2double Flux[MAXNVAR] = {0.0};
+  su2double JacobianRows_i[MAXNVAR*MAXNVAR] = {0.0}, JacobianRows_j[MAXNVAR*MAXNVAR] = {0.0};
+  su2double *Jacobian_i[MAXNVAR], *Jacobian_j[MAXNVAR];
+  for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+    Jacobian_i[iVar] = &JacobianRows_i[iVar*nVar];
+    Jacobian_j[iVar] = &JacobianRows_j[iVar*nVar];
+  }
+
+  /*--- With a pending halo exchange (see Upwind_Residual) the batches without halo
+   *    points are computed first, then the exchange is completed. ---*/
+  const bool overlap = GetPendingComms();
+
+  for (auto iPass = overlap? 0u : 1u; iPass < 2; ++iPass)
+  {
+  if (overlap && (iPass == 1)) {
+    SU2_OMP_MASTER
+    CompletePendingComms(geometry, config);
+    SU2_OMP_BARRIER
+    if (PackedEdgeData && muscl) PackEdgeLoopData(limiter, nPointDomain, nPoint);
+  }
+
+  /*--- Loop over edge colors. ---*/
+  for (auto color : EdgeColoring)
+  {
+  const unsigned long nBatch = roundUpDiv(color.size, BATCH);
+
+  /*--- Chunks of batches hold whole color groups, and at least OMP_MIN_SIZE edges. ---*/
+  SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize*BATCH)/BATCH)
+  for (auto iBatch = 0ul; iBatch < nBatch; ++iBatch) {
+
+    const unsigned long begin = iBatch*BATCH;
+    batch.nEdge = min<unsigned long>(BATCH, color.size-begin);
+
+    if (overlap) {
+      bool halo = false;
+      for (auto k = 0ul; k < batch.nEdge; ++k)
+        halo |= geometry->GetEdgeHalo(color.indices[begin + k]);
+      if (halo != (iPass == 1)) continue;
+    }
+
+    /*--- Batches whose edges are all skipped (see ACTIVE_SET). ---*/
+
+    if (activeSetSkip) {
+      bool skip = true;
+      for (auto k = 0ul; k < batch.nEdge; ++k) {
+        const auto iEdge = color.indices[begin + k];
+        skip &= SkipEdge(geometry->GetEdgeNode(iEdge,0), geometry->GetEdgeNode(iEdge,1));
       }
+      if (skip) continue;
+    }
+
+    /*--- Gather the inputs, the lanes past the last edge of the color repeat it. ---*/
+
+    for (auto k = 0ul; k < BATCH; ++k) {
+
+      const auto iEdge = color.indices[begin + min(k, batch.nEdge-1)];
+      const auto iPoint = geometry->GetEdgeNode(iEdge,0);
+      const auto jPoint = geometry->GetEdgeNode(iEdge,1);
+
+      const su2double* Normal = geometry->GetEdgeNormal(iEdge);
+      for (unsigned short iDim = 0; iDim < nDim; iDim++)
+        batch.Normal[iDim][k] = Normal[iDim];
+
+      const su2double* V_i = nodes->GetPrimitive(iPoint);
+      const su2double* V_j = nodes->GetPrimitive(jPoint);
+
+      if (muscl && (k < batch.nEdge)) {
+        bool bad_i = false, bad_j = false;
+
+        ReconstructEdgeVariables(geometry, config, iEdge, iPoint, jPoint, limiter, Primitive_i, Primitive_j,
+                                 Secondary_i, Secondary_j, bad_i, bad_j);
 
-      /*--- Low-Mach number correction. ---*/
+        counter_local += bad_i+bad_j;
 
-      if (low_mach_corr) {
-        LowMachPrimitiveCorrection(GetFluidModel(), nDim, Primitive_i, Primitive_j);
+        if (!bad_i) V_i = Primitive_i;
+        if (!bad_j) V_j = Primitive_j;
       }
 
-      /*--- Check for non-physical solutions after reconstruction. If found, use the
-       cell-average value of the solution. This is a locally 1st order approximation,
-       which is typically only active during the start-up of a calculation. ---*/
+      for (unsigned short iVar = 0; iVar < nPrimUsed; iVar++) {
+        batch.V_i[iVar][k] = V_i[iVar];
+        batch.V_j[iVar][k] = V_j[iVar];
+      }
+    }
 
-      bool neg_pres_or_rho_i = (Primitive_i[nDim+1] < 0.0) || (Primitive_i[nDim+2] < 0.0);
-      bool neg_pres_or_rho_j = (Primitive_j[nDim+1] < 0.0) || (Primitive_j[nDim+2] < 0.0);
+    /*--- Compute the residuals of the batch. ---*/
 
-      su2double R = sqrt(fabs(Primitive_j[nDim+2]/Primitive_i[nDim+2]));
-      su2double sq_vel = 0.0;
-      for (iDim = 0; iDim < nDim; iDim++) {
-        su2double RoeVelocity = (R*Primitive_j[iDim+1]+Primitive_i[iDim+1])/(R+1);
-        sq_vel += pow(RoeVelocity, 2);
-      }
-      su2double RoeEnthalpy = (R*Primitive_j[nDim+3]+Primitive_i[nDim+3])/(R+1);
+    BatchNumerics->ComputeResidual(batch);
 
-      bool neg_sound_speed = ((Gamma-1)*(RoeEnthalpy-0.5*sq_vel) < 0.0);
+    /*--- Scatter the residuals, one edge at a time as edges of a group can share points. ---*/
 
-      bool bad_i = neg_sound_speed || neg_pres_or_rho_i;
-      bool bad_j = neg_sound_speed || neg_pres_or_rho_j;
+    for (auto k = 0ul; k < batch.nEdge; ++k) {
 
-      nodes->SetNon_Physical(iPoint, bad_i);
-      nodes->SetNon_Physical(jPoint, bad_j);
+      const auto iEdge = color.indices[begin + k];
+      const auto iPoint = geometry->GetEdgeNode(iEdge,0);
+      const auto jPoint = geometry->GetEdgeNode(iEdge,1);
 
-      /*--- Get updated state, in case the point recovered after the set. ---*/
-      bad_i = nodes->GetNon_Physical(iPoint);
-      bad_j = nodes->GetNon_Physical(jPoint);
+      for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+        Flux[iVar] = batch.Flux[iVar][k];
+        if (implicit) {
+          for (unsigned short jVar = 0; jVar < nVar; jVar++) {
+            Jacobian_i[iVar][jVar] = batch.Jacobian_i[iVar][jVar][k];
+            Jacobian_j[iVar][jVar] = batch.Jacobian_j[iVar][jVar][k];
+          }
+        }
+      }
 
-      counter_local += bad_i+bad_j;
+      /*--- Viscous contribution, and update of the system with both. ---*/
 
-      numerics->SetPrimitive(bad_i? V_i : Primitive_i,  bad_j? V_j : Primitive_j);
-      numerics->SetSecondary(bad_i? S_i : Secondary_i,  bad_j? S_j : Secondary_j);
+      auto viscous = ViscousEdgeResidual(iEdge, geometry, solver_container,
+                                         numerics_container[VISC_TERM + omp_get_thread_num()*MAX_TERMS], config);
 
+      UpdateEdgeContribution(iEdge, iPoint, jPoint, implicit, Flux, Jacobian_i, Jacobian_j, viscous);
     }
+  }
+  } // end color loop
+  } // end pass loop
 
-    /*--- Roe Low Dissipation Scheme ---*/
-
-    if (kind_dissipation != NO_ROELOWDISS) {
+  return counter_local;
+}
 
-      numerics->SetDissipation(nodes->GetRoe_Dissipation(iPoint),
-                               nodes->GetRoe_Dissipation(jPoint));
+void CEulerSolver::SumEdgeFluxes(CGeometry* geometry) {
 
-      if (kind_dissipation == FD_DUCROS || kind_dissipation == NTS_DUCROS){
-        numerics->SetSensor(nodes->GetSensor(iPoint),
-                            nodes->GetSensor(jPoint));
-      }
-      if (kind_dissipation == NTS || kind_dissipation == NTS_DUCROS){
-        numerics->SetCoord(Coord_i, Coord_j);
-      }
-    }
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
 
-    /*--- Compute the residual ---*/
+    LinSysRes.SetBlock_Zero(iPoint);
 
-    auto residual = numerics->ComputeResidual(config);
+    for (unsigned short iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); ++iNeigh) {
 
-    /*--- Set the final value of the Roe dissipation coefficient ---*/
+      auto iEdge = geometry->node[iPoint]->GetEdge(iNeigh);
 
-    if ((kind_dissipation != NO_ROELOWDISS) && (MGLevel != MESH_0)) {
-      nodes->SetRoe_Dissipation(iPoint,numerics->GetDissipation());
-      nodes->SetRoe_Dissipation(jPoint,numerics->GetDissipation());
+      if (iPoint == geometry->GetEdgeNode(iEdge,0))
+        LinSysRes.AddBlock(iPoint, EdgeFluxes.GetBlock(iEdge));
+      else
+        LinSysRes.SubtractBlock(iPoint, EdgeFluxes.GetBlock(iEdge));
     }
+  }
 
-    /*--- Update residual value ---*/
+}
 
-    if (ReducerStrategy) {
-      EdgeFluxes.SetBlock(iEdge, residual);
-      if (implicit)
-        Jacobian.SetBlocks(iEdge, residual.jacobian_i, residual.jacobian_j);
-    }
-    else {
-      LinSysRes.AddBlock(iPoint, residual);
-      LinSysRes.SubtractBlock(jPoint, residual);
+void CEulerSolver::UpdateEdgeContribution(unsigned long iEdge, unsigned long iPoint, unsigned long jPoint,
+                                          bool implicit, const su2double *flux, const su2double* const* jacobian_i,
+                                          const su2double* const* jacobian_j, const CNumerics::ResidualType<>& viscous) {
 
-      /*--- Set implicit computation ---*/
-      if (implicit)
-        Jacobian.UpdateBlocks(iEdge, iPoint, jPoint, residual.jacobian_i, residual.jacobian_j);
-    }
+  /*--- Sum of the contributions (thread-local storage), only if there is a viscous one. ---*/
 
-    /*--- Viscous contribution. ---*/
+  su2double Flux[MAXNVAR], JacobianRows_i[MAXNVAR*MAXNVAR], JacobianRows_j[MAXNVAR*MAXNVAR];
+  su2double *Jacobian_i[MAXNVAR], *Jacobian_j[MAXNVAR];
+
+  if (viscous.residual != nullptr) {
+    for (unsigned short iVar = 0; iVar < nVar; iVar++)
+      Flux[iVar] = flux[iVar] - viscous.residual[iVar];
+    flux = Flux;
 
-    Viscous_Residual(iEdge, geometry, solver_container,
-                     numerics_container[VISC_TERM + omp_get_thread_num()*MAX_TERMS], config);
+    if (implicit) {
+      for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+        Jacobian_i[iVar] = &JacobianRows_i[iVar*nVar];
+        Jacobian_j[iVar] = &JacobianRows_j[iVar*nVar];
+        for (unsigned short jVar = 0; jVar < nVar; jVar++) {
+          Jacobian_i[iVar][jVar] = jacobian_i[iVar][jVar] - viscous.jacobian_i[iVar][jVar];
+          Jacobian_j[iVar][jVar] = jacobian_j[iVar][jVar] - viscous.jacobian_j[iVar][jVar];
+        }
+      }
+      jacobian_i = Jacobian_i;
+      jacobian_j = Jacobian_j;
+    }
   }
-  } // end color loop
+
+  /*--- Update the residual and Jacobian once. ---*/
 
   if (ReducerStrategy) {
-    SumEdgeFluxes(geometry);
+    EdgeFluxes.SetBlock(iEdge, flux);
     if (implicit)
-      Jacobian.SetDiagonalAsColumnSum();
+      Jacobian.SetBlocks(iEdge, jacobian_i, jacobian_j);
+  }
+  else {
+    LinSysRes.AddBlock(iPoint, flux);
+    LinSysRes.SubtractBlock(jPoint, flux);
+    if (implicit)
+      Jacobian.UpdateBlocks(iEdge, iPoint, jPoint, jacobian_i, jacobian_j);
   }
 
-  /*--- Warning message about non-physical reconstructions. ---*/
+}
 
-  if ((iMesh == MESH_0) && (config->GetComm_Level() == COMM_FULL)) {
-    /*--- Add counter results for all threads. ---*/
-    SU2_OMP_ATOMIC
-    ErrorCounter += counter_local;
-    SU2_OMP_BARRIER
+const CNumerics::StaticResidualType& CEulerSolver::SumEdgeContributions(bool implicit,
+                                        const CNumerics::StaticResidualType& convective,
+                                        const CNumerics::ResidualType<>& viscous,
+                                        CNumerics::StaticResidualType& sum) const {
 
-    /*--- Add counter results for all ranks. ---*/
-    SU2_OMP_MASTER
-    {
-      counter_local = ErrorCounter;
-      SU2_MPI::Reduce(&counter_local, &ErrorCounter, 1, MPI_UNSIGNED_LONG, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
-      config->SetNonphysical_Reconstr(ErrorCounter);
+  if (viscous.residual == nullptr) return convective;
+
+  for (unsigned short iVar = 0; iVar < nVar; iVar++)
+    sum.residual(iVar) = convective.residual(iVar) - viscous.residual[iVar];
+
+  if (implicit) {
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      for (unsigned short jVar = 0; jVar < nVar; jVar++) {
+        sum.jacobian_i(iVar,jVar) = convective.jacobian_i(iVar,jVar) - viscous.jacobian_i[iVar][jVar];
+        sum.jacobian_j(iVar,jVar) = convective.jacobian_j(iVar,jVar) - viscous.jacobian_j[iVar][jVar];
+      }
     }
-    SU2_OMP_BARRIER
   }
-
+  return sum;
 }
 
-void CEulerSolver::SumEdgeFluxes(CGeometry* geometry) {
+void CEulerSolver::UpdateEdgeContribution(unsigned long iEdge, unsigned long iPoint, unsigned long jPoint,
+                                          bool implicit, const CNumerics::StaticResidualType& convective,
+                                          const CNumerics::ResidualType<>& viscous) {
 
-  SU2_OMP_FOR_STAT(omp_chunk_size)
-  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+  /*--- Sum of the contributions (thread-local storage, contiguous), only if there is a viscous one. ---*/
 
-    LinSysRes.SetBlock_Zero(iPoint);
+  CNumerics::StaticResidualType sum;
+  const auto total = &SumEdgeContributions(implicit, convective, viscous, sum);
 
-    for (unsigned short iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); ++iNeigh) {
+  /*--- Update the residual and Jacobian once, the blocks are read without the row indirection. ---*/
 
-      auto iEdge = geometry->node[iPoint]->GetEdge(iNeigh);
+  const su2double* flux = total->residual.data();
 
-      if (iPoint == geometry->edge[iEdge]->GetNode(0))
-        LinSysRes.AddBlock(iPoint, EdgeFluxes.GetBlock(iEdge));
-      else
-        LinSysRes.SubtractBlock(iPoint, EdgeFluxes.GetBlock(iEdge));
-    }
+  if (ReducerStrategy) {
+    EdgeFluxes.SetBlock(iEdge, flux);
+    if (implicit)
+      Jacobian.SetBlocks(iEdge, total->jacobian_i, total->jacobian_j);
+  }
+  else {
+    LinSysRes.AddBlock(iPoint, flux);
+    LinSysRes.SubtractBlock(jPoint, flux);
+    if (implicit)
+      Jacobian.UpdateBlocks(iEdge, iPoint, jPoint, total->jacobian_i, total->jacobian_j);
   }
 
 }
 
+void CEulerSolver::UpdateOwnerContribution(unsigned long iEdge, unsigned long iPoint, bool first, bool implicit,
+                                           const CNumerics::StaticResidualType& convective,
+                                           const CNumerics::ResidualType<>& viscous) {
+
+  CNumerics::StaticResidualType sum;
+  const auto& total = SumEdgeContributions(implicit, convective, viscous, sum);
+
+  /*--- Only the row of iPoint is updated, the flux leaves the first point of the edge. ---*/
+
+  if (first) LinSysRes.AddBlock(iPoint, total.residual.data());
+  else LinSysRes.SubtractBlock(iPoint, total.residual.data());
+
+  if (implicit)
+    Jacobian.SetRowBlocks(iEdge, iPoint, first, total.jacobian_i, total.jacobian_j);
+}
+
 void CEulerSolver::ComputeConsistentExtrapolation(CFluidModel *fluidModel, unsigned short nDim,
                                                   su2double *primitive, su2double *secondary) {
 
@@ -3379,7 +3586,7 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
       numerics->SetVolume(geometry->node[iPoint]->GetVolume());
 
       /*--- Compute the rotating frame source residual ---*/
-      auto residual = numerics->ComputeResidual(config);
+      auto residual = numerics->ComputeResidualPreacc(config);
 
       /*--- Add the source residual to the total ---*/
       LinSysRes.AddBlock(iPoint, residual);
@@ -3408,7 +3615,7 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
       numerics->SetVolume(geometry->node[iPoint]->GetVolume());
 
       /*--- Compute the rotating frame source residual ---*/
-      auto residual = numerics->ComputeResidual(config);
+      auto residual = numerics->ComputeResidualPreacc(config);
 
       /*--- Add the source residual to the total ---*/
       LinSysRes.AddBlock(iPoint, residual);
@@ -3435,7 +3642,7 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
       numerics->SetCoord(geometry->node[iPoint]->GetCoord(), geometry->node[iPoint]->GetCoord());
 
       /*--- Compute Source term Residual ---*/
-      auto residual = numerics->ComputeResidual(config);
+      auto residual = numerics->ComputeResidualPreacc(config);
 
       /*--- Add Residual ---*/
       LinSysRes.AddBlock(iPoint, residual);
@@ -3459,7 +3666,7 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
       numerics->SetVolume(geometry->node[iPoint]->GetVolume());
 
       /*--- Compute Source term Residual ---*/
-      auto residual = numerics->ComputeResidual(config);
+      auto residual = numerics->ComputeResidualPreacc(config);
 
       /*--- Add Residual ---*/
       LinSysRes.AddBlock(iPoint, residual);
@@ -3503,7 +3710,7 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
       numerics->SetVolume(geometry->node[iPoint]->GetVolume());
 
       /*--- Compute the rotating frame source residual ---*/
-      auto residual = numerics->ComputeResidual(config);
+      auto residual = numerics->ComputeResidualPreacc(config);
 
       /*--- Add the source residual to the total ---*/
       LinSysRes.AddBlock(iPoint, residual);
@@ -3561,22 +3768,44 @@ void CEulerSolver::Source_Template(CGeometry *geometry, CSolver **solver_contain
 
 }
 
-void CEulerSolver::SetMax_Eigenvalue(CGeometry *geometry, CConfig *config) {
+void CEulerSolver::SetCentered_Dissipation_Quantities(CGeometry *geometry, CConfig *config, bool jst, bool timeStep) {
 
-  /*--- Loop domain points. ---*/
+  const bool viscous = timeStep && config->GetViscous();
+
+  /*--- We can access memory more efficiently if there are no periodic boundaries. ---*/
+
+  const bool isPeriodic = (config->GetnMarker_Periodic() > 0);
+
+  /*--- Loop domain points, the eigenvalue, the spectral radii, and the Laplacian and
+   *    sensor, are accumulated by the same sweep over the neighbors. ---*/
 
   SU2_OMP_FOR_DYN(omp_chunk_size)
   for (unsigned long iPoint = 0; iPoint < nPointDomain; ++iPoint) {
 
-    /*--- Set eigenvalues to zero. ---*/
-    nodes->SetLambda(iPoint,0.0);
+    auto node_i = geometry->node[iPoint];
+
+    const bool boundary_i = node_i->GetPhysicalBoundary();
+    const su2double Pressure_i = nodes->GetPressure(iPoint);
+
+    /*--- Initialize. ---*/
+
+    su2double Lambda_i = 0.0, LambdaVisc_i = 0.0;
+
+    if (jst) {
+      for (unsigned short iVar = 0; iVar < nVar; iVar++)
+        nodes->SetUnd_Lapl(iPoint, iVar, 0.0);
+
+      iPoint_UndLapl[iPoint] = 0.0;
+      jPoint_UndLapl[iPoint] = 0.0;
+    }
 
     /*--- Loop over the neighbors of point i. ---*/
-    for (unsigned short iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); ++iNeigh)
+
+    for (unsigned short iNeigh = 0; iNeigh < node_i->GetnPoint(); ++iNeigh)
     {
-      auto jPoint = geometry->node[iPoint]->GetPoint(iNeigh);
+      auto jPoint = node_i->GetPoint(iNeigh);
 
-      auto iEdge = geometry->node[iPoint]->GetEdge(iNeigh);
+      auto iEdge = node_i->GetEdge(iNeigh);
       auto Normal = geometry->edge[iEdge]->GetNormal();
       su2double Area = 0.0;
       for (unsigned short iDim = 0; iDim < nDim; iDim++) Area += pow(Normal[iDim],2);
@@ -3590,19 +3819,62 @@ void CEulerSolver::SetMax_Eigenvalue(CGeometry *geometry, CConfig *config) {
       /*--- Adjustment for grid movement ---*/
 
       if (dynamic_grid) {
-        const su2double *GridVel_i = geometry->node[iPoint]->GetGridVel();
-        const su2double *GridVel_j = geometry->node[jPoint]->GetGridVel();
+        const su2double *GridFlux = geometry->GetEdgeGridFlux(iEdge);
+        if (GridFlux) Mean_ProjVel -= *GridFlux;
+        else {
+          const su2double *GridVel_i = node_i->GetGridVel();
+          const su2double *GridVel_j = geometry->node[jPoint]->GetGridVel();
 
-        for (unsigned short iDim = 0; iDim < nDim; iDim++)
-          Mean_ProjVel -= 0.5 * (GridVel_i[iDim] + GridVel_j[iDim]) * Normal[iDim];
+          for (unsigned short iDim = 0; iDim < nDim; iDim++)
+            Mean_ProjVel -= 0.5 * (GridVel_i[iDim] + GridVel_j[iDim]) * Normal[iDim];
+        }
       }
 
       /*--- Inviscid contribution ---*/
 
-      su2double Lambda = fabs(Mean_ProjVel) + Mean_SoundSpeed ;
-      nodes->AddLambda(iPoint, Lambda);
+      Lambda_i += fabs(Mean_ProjVel) + Mean_SoundSpeed;
+
+      /*--- Viscous contribution to the spectral radius of the time step. ---*/
+
+      if (viscous) {
+        su2double Mean_LaminarVisc = 0.5*(nodes->GetLaminarViscosity(iPoint) + nodes->GetLaminarViscosity(jPoint));
+        su2double Mean_EddyVisc    = 0.5*(nodes->GetEddyViscosity(iPoint) + nodes->GetEddyViscosity(jPoint));
+        su2double Mean_Density     = 0.5*(nodes->GetDensity(iPoint) + nodes->GetDensity(jPoint));
+
+        su2double Lambda_1 = (4.0/3.0)*(Mean_LaminarVisc + Mean_EddyVisc);
+        su2double Lambda_2 = (1.0 + (Prandtl_Lam/Prandtl_Turb)*(Mean_EddyVisc/Mean_LaminarVisc))*(Gamma*Mean_LaminarVisc/Prandtl_Lam);
+
+        LambdaVisc_i += (Lambda_1 + Lambda_2)*Area*Area/Mean_Density;
+      }
+
+      if (!jst) continue;
+
+      /*--- If iPoint is boundary it only takes contributions from other boundary points. ---*/
+
+      if (boundary_i && !geometry->node[jPoint]->GetPhysicalBoundary()) continue;
+
+      /*--- Add solution differences, with correction for compressible flows which use the enthalpy. ---*/
+
+      for (unsigned short iVar = 0; iVar < nVar; iVar++)
+        nodes->AddUnd_Lapl(iPoint, iVar, nodes->GetSolution(jPoint,iVar)-nodes->GetSolution(iPoint,iVar));
+
+      su2double Pressure_j = nodes->GetPressure(jPoint);
+      nodes->AddUnd_Lapl(iPoint, nVar-1, Pressure_j-Pressure_i);
+
+      /*--- Dissipation sensor, add pressure difference and pressure sum. ---*/
+      iPoint_UndLapl[iPoint] += Pressure_j - Pressure_i;
+      jPoint_UndLapl[iPoint] += Pressure_j + Pressure_i;
+    }
+
+    nodes->SetLambda(iPoint, Lambda_i);
+
+    if (timeStep) {
+      nodes->SetMax_Lambda_Inv(iPoint, Lambda_i);
+      if (viscous) nodes->SetMax_Lambda_Visc(iPoint, LambdaVisc_i);
     }
 
+    if (jst && !isPeriodic)
+      nodes->SetSensor(iPoint, fabs(iPoint_UndLapl[iPoint]) / jPoint_UndLapl[iPoint]);
   }
 
   /*--- Loop boundary edges ---*/
@@ -3617,6 +3889,9 @@ void CEulerSolver::SetMax_Eigenvalue(CGeometry *geometry, CConfig *config) {
       /*--- Point identification, Normal vector and area ---*/
 
       auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+
+      if (!geometry->node[iPoint]->GetDomain()) continue;
+
       auto Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
       su2double Area = 0.0;
       for (unsigned short iDim = 0; iDim < nDim; iDim++)
@@ -3639,95 +3914,50 @@ void CEulerSolver::SetMax_Eigenvalue(CGeometry *geometry, CConfig *config) {
       /*--- Inviscid contribution ---*/
 
       su2double Lambda = fabs(Mean_ProjVel) + Mean_SoundSpeed;
-      if (geometry->node[iPoint]->GetDomain()) {
-        nodes->AddLambda(iPoint,Lambda);
-      }
-    }
-    }
-  }
-
-  SU2_OMP_MASTER
-  {
-    /*--- Correct the eigenvalue values across any periodic boundaries. ---*/
-
-    for (unsigned short iPeriodic = 1; iPeriodic <= config->GetnMarker_Periodic()/2; iPeriodic++) {
-      InitiatePeriodicComms(geometry, config, iPeriodic, PERIODIC_MAX_EIG);
-      CompletePeriodicComms(geometry, config, iPeriodic, PERIODIC_MAX_EIG);
-    }
-
-    /*--- MPI parallelization ---*/
-
-    InitiateComms(geometry, config, MAX_EIGENVALUE);
-    CompleteComms(geometry, config, MAX_EIGENVALUE);
-  }
-  SU2_OMP_BARRIER
-
-}
-
-void CEulerSolver::SetUndivided_Laplacian_And_Centered_Dissipation_Sensor(CGeometry *geometry, CConfig *config) {
+      nodes->AddLambda(iPoint,Lambda);
 
-  /*--- We can access memory more efficiently if there are no periodic boundaries. ---*/
-
-  const bool isPeriodic = (config->GetnMarker_Periodic() > 0);
+      if (!timeStep) continue;
 
-  /*--- Loop domain points. ---*/
+      nodes->AddMax_Lambda_Inv(iPoint,Lambda);
 
-  SU2_OMP_FOR_DYN(omp_chunk_size)
-  for (unsigned long iPoint = 0; iPoint < nPointDomain; ++iPoint) {
+      /*--- Viscous contribution ---*/
 
-    const bool boundary_i = geometry->node[iPoint]->GetPhysicalBoundary();
-    const su2double Pressure_i = nodes->GetPressure(iPoint);
+      if (!viscous) continue;
 
-    /*--- Initialize. ---*/
-    for (unsigned short iVar = 0; iVar < nVar; iVar++)
-      nodes->SetUnd_Lapl(iPoint, iVar, 0.0);
+      su2double Mean_LaminarVisc = nodes->GetLaminarViscosity(iPoint);
+      su2double Mean_EddyVisc    = nodes->GetEddyViscosity(iPoint);
+      su2double Mean_Density     = nodes->GetDensity(iPoint);
 
-    iPoint_UndLapl[iPoint] = 0.0;
-    jPoint_UndLapl[iPoint] = 0.0;
+      su2double Lambda_1 = (4.0/3.0)*(Mean_LaminarVisc + Mean_EddyVisc);
+      su2double Lambda_2 = (1.0 + (Prandtl_Lam/Prandtl_Turb)*(Mean_EddyVisc/Mean_LaminarVisc))*(Gamma*Mean_LaminarVisc/Prandtl_Lam);
 
-    /*--- Loop over the neighbors of point i. ---*/
-    for (unsigned short iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); ++iNeigh)
-    {
-      auto jPoint = geometry->node[iPoint]->GetPoint(iNeigh);
-      bool boundary_j = geometry->node[jPoint]->GetPhysicalBoundary();
+      nodes->AddMax_Lambda_Visc(iPoint, (Lambda_1 + Lambda_2)*Area*Area/Mean_Density);
+    }
+    }
+  }
 
-      /*--- If iPoint is boundary it only takes contributions from other boundary points. ---*/
-      if (boundary_i && !boundary_j) continue;
+  /*--- Correct the eigenvalue, Laplacian, and sensor values across any periodic boundaries. ---*/
 
-      /*--- Add solution differences, with correction for compressible flows which use the enthalpy. ---*/
+  SU2_OMP_MASTER
+  {
+    for (unsigned short iPeriodic = 1; iPeriodic <= config->GetnMarker_Periodic()/2; iPeriodic++) {
+      InitiatePeriodicComms(geometry, config, iPeriodic, PERIODIC_MAX_EIG);
+      CompletePeriodicComms(geometry, config, iPeriodic, PERIODIC_MAX_EIG);
 
-      for (unsigned short iVar = 0; iVar < nVar; iVar++)
-        nodes->AddUnd_Lapl(iPoint, iVar, nodes->GetSolution(jPoint,iVar)-nodes->GetSolution(iPoint,iVar));
+      if (!jst) continue;
 
-      su2double Pressure_j = nodes->GetPressure(jPoint);
-      nodes->AddUnd_Lapl(iPoint, nVar-1, Pressure_j-Pressure_i);
+      InitiatePeriodicComms(geometry, config, iPeriodic, PERIODIC_LAPLACIAN);
+      CompletePeriodicComms(geometry, config, iPeriodic, PERIODIC_LAPLACIAN);
 
-      /*--- Dissipation sensor, add pressure difference and pressure sum. ---*/
-      iPoint_UndLapl[iPoint] += Pressure_j - Pressure_i;
-      jPoint_UndLapl[iPoint] += Pressure_j + Pressure_i;
+      InitiatePeriodicComms(geometry, config, iPeriodic, PERIODIC_SENSOR);
+      CompletePeriodicComms(geometry, config, iPeriodic, PERIODIC_SENSOR);
     }
-
-    if (!isPeriodic)
-      nodes->SetSensor(iPoint, fabs(iPoint_UndLapl[iPoint]) / jPoint_UndLapl[iPoint]);
   }
+  SU2_OMP_BARRIER
 
-  if (isPeriodic) {
-    /*--- Correct the Laplacian and sensor values across any periodic boundaries. ---*/
-
-    SU2_OMP_MASTER
-    {
-      for (unsigned short iPeriodic = 1; iPeriodic <= config->GetnMarker_Periodic()/2; iPeriodic++) {
-        InitiatePeriodicComms(geometry, config, iPeriodic, PERIODIC_LAPLACIAN);
-        CompletePeriodicComms(geometry, config, iPeriodic, PERIODIC_LAPLACIAN);
-
-        InitiatePeriodicComms(geometry, config, iPeriodic, PERIODIC_SENSOR);
-        CompletePeriodicComms(geometry, config, iPeriodic, PERIODIC_SENSOR);
-      }
-    }
-    SU2_OMP_BARRIER
-
-    /*--- Set final pressure switch for each point ---*/
+  /*--- Set final pressure switch for each point ---*/
 
+  if (jst && isPeriodic) {
     SU2_OMP_FOR_STAT(omp_chunk_size)
     for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
       nodes->SetSensor(iPoint, fabs(iPoint_UndLapl[iPoint]) / jPoint_UndLapl[iPoint]);
@@ -3737,11 +3967,20 @@ void CEulerSolver::SetUndivided_Laplacian_And_Centered_Dissipation_Sensor(CGeome
   {
     /*--- MPI parallelization ---*/
 
-    InitiateComms(geometry, config, UNDIVIDED_LAPLACIAN);
-    CompleteComms(geometry, config, UNDIVIDED_LAPLACIAN);
+    InitiateComms(geometry, config, MAX_EIGENVALUE);
+    CompleteComms(geometry, config, MAX_EIGENVALUE);
 
-    InitiateComms(geometry, config, SENSOR);
-    CompleteComms(geometry, config, SENSOR);
+    if (jst) {
+      InitiateComms(geometry, config, UNDIVIDED_LAPLACIAN);
+      CompleteComms(geometry, config, UNDIVIDED_LAPLACIAN);
+
+      InitiateComms(geometry, config, SENSOR);
+      CompleteComms(geometry, config, SENSOR);
+    }
+
+    /*--- The next call to SetTime_Step reuses the spectral radii. ---*/
+
+    SpectralRadiiReady = timeStep;
   }
   SU2_OMP_BARRIER
 
@@ -4040,72 +4279,35 @@ void CEulerSolver::Pressure_Forces(CGeometry *geometry, CConfig *config) {
 
 #ifdef HAVE_MPI
 
-  /*--- Add AllBound information using all the nodes ---*/
+  /*--- Add the AllBound information and the forces on the surfaces using all the nodes,
+   all the values are summed with a single reduction. ---*/
 
   if (config->GetComm_Level() == COMM_FULL) {
 
-    auto Allreduce = [](su2double x) {
-      su2double tmp = x; x = 0.0;
-      SU2_MPI::Allreduce(&tmp, &x, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-      return x;
-    };
-    AllBoundInvCoeff.CD = Allreduce(AllBoundInvCoeff.CD);
-    AllBoundInvCoeff.CL = Allreduce(AllBoundInvCoeff.CL);
-    AllBoundInvCoeff.CSF = Allreduce(AllBoundInvCoeff.CSF);
-    AllBoundInvCoeff.CEff = AllBoundInvCoeff.CL / (AllBoundInvCoeff.CD + EPS);
-
-    AllBoundInvCoeff.CMx = Allreduce(AllBoundInvCoeff.CMx);
-    AllBoundInvCoeff.CMy = Allreduce(AllBoundInvCoeff.CMy);
-    AllBoundInvCoeff.CMz = Allreduce(AllBoundInvCoeff.CMz);
-
-    AllBoundInvCoeff.CoPx = Allreduce(AllBoundInvCoeff.CoPx);
-    AllBoundInvCoeff.CoPy = Allreduce(AllBoundInvCoeff.CoPy);
-    AllBoundInvCoeff.CoPz = Allreduce(AllBoundInvCoeff.CoPz);
-
-    AllBoundInvCoeff.CFx = Allreduce(AllBoundInvCoeff.CFx);
-    AllBoundInvCoeff.CFy = Allreduce(AllBoundInvCoeff.CFy);
-    AllBoundInvCoeff.CFz = Allreduce(AllBoundInvCoeff.CFz);
-
-    AllBoundInvCoeff.CT = Allreduce(AllBoundInvCoeff.CT);
-    AllBoundInvCoeff.CQ = Allreduce(AllBoundInvCoeff.CQ);
-    AllBoundInvCoeff.CMerit = AllBoundInvCoeff.CT / (AllBoundInvCoeff.CQ + EPS);
-    AllBound_CNearFieldOF_Inv = Allreduce(AllBound_CNearFieldOF_Inv);
-
-  }
-
-  /*--- Add the forces on the surfaces using all the nodes ---*/
-
-  if (config->GetComm_Level() == COMM_FULL) {
+    const int nMarkerMon = config->GetnMarker_Monitoring();
 
-    int nMarkerMon = config->GetnMarker_Monitoring();
+    CSumReduction reduction;
 
-    /*--- Use the same buffer for all reductions. We could avoid the copy back into
-     *    the original variable by swaping pointers, but it is safer this way... ---*/
+    for (su2double* coeff : {&AllBoundInvCoeff.CD, &AllBoundInvCoeff.CL, &AllBoundInvCoeff.CSF, &AllBoundInvCoeff.CMx,
+                             &AllBoundInvCoeff.CMy, &AllBoundInvCoeff.CMz, &AllBoundInvCoeff.CoPx, &AllBoundInvCoeff.CoPy,
+                             &AllBoundInvCoeff.CoPz, &AllBoundInvCoeff.CFx, &AllBoundInvCoeff.CFy, &AllBoundInvCoeff.CFz,
+                             &AllBoundInvCoeff.CT, &AllBoundInvCoeff.CQ})
+      reduction.Add(*coeff);
+    reduction.Add(AllBound_CNearFieldOF_Inv);
 
-    su2double* buffer = new su2double [nMarkerMon];
+    for (su2double* coeff : {SurfaceInvCoeff.CL, SurfaceInvCoeff.CD, SurfaceInvCoeff.CSF, SurfaceInvCoeff.CFx,
+                             SurfaceInvCoeff.CFy, SurfaceInvCoeff.CFz, SurfaceInvCoeff.CMx, SurfaceInvCoeff.CMy,
+                             SurfaceInvCoeff.CMz})
+      reduction.Add(coeff, nMarkerMon);
 
-    auto Allreduce_inplace = [buffer](int size, su2double* x) {
-      SU2_MPI::Allreduce(x, buffer, size, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-      for(int i=0; i<size; ++i) x[i] = buffer[i];
-    };
+    reduction.Complete();
 
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CL);
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CD);
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CSF);
+    AllBoundInvCoeff.CEff = AllBoundInvCoeff.CL / (AllBoundInvCoeff.CD + EPS);
+    AllBoundInvCoeff.CMerit = AllBoundInvCoeff.CT / (AllBoundInvCoeff.CQ + EPS);
 
     for (iMarker_Monitoring = 0; iMarker_Monitoring < nMarkerMon; iMarker_Monitoring++)
       SurfaceInvCoeff.CEff[iMarker_Monitoring] = SurfaceInvCoeff.CL[iMarker_Monitoring] / (SurfaceInvCoeff.CD[iMarker_Monitoring] + EPS);
 
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CFx);
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CFy);
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CFz);
-
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CMx);
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CMy);
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CMz);
-
-    delete [] buffer;
-
   }
 
 #endif
@@ -4360,72 +4562,34 @@ void CEulerSolver::Momentum_Forces(CGeometry *geometry, CConfig *config) {
 
 #ifdef HAVE_MPI
 
-  /*--- Add AllBound information using all the nodes ---*/
+  /*--- Add the AllBound information and the forces on the surfaces using all the nodes,
+   all the values are summed with a single reduction. ---*/
 
   if (config->GetComm_Level() == COMM_FULL) {
 
-    auto Allreduce = [](su2double x) {
-      su2double tmp = x; x = 0.0;
-      SU2_MPI::Allreduce(&tmp, &x, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-      return x;
-    };
-
-    AllBoundMntCoeff.CD = Allreduce(AllBoundMntCoeff.CD);
-    AllBoundMntCoeff.CL = Allreduce(AllBoundMntCoeff.CL);
-    AllBoundMntCoeff.CSF = Allreduce(AllBoundMntCoeff.CSF);
-    AllBoundMntCoeff.CEff = AllBoundMntCoeff.CL / (AllBoundMntCoeff.CD + EPS);
-
-    AllBoundMntCoeff.CFx = Allreduce(AllBoundMntCoeff.CFx);
-    AllBoundMntCoeff.CFy = Allreduce(AllBoundMntCoeff.CFy);
-    AllBoundMntCoeff.CFz = Allreduce(AllBoundMntCoeff.CFz);
-
-    AllBoundMntCoeff.CMx = Allreduce(AllBoundMntCoeff.CMx);
-    AllBoundMntCoeff.CMy = Allreduce(AllBoundMntCoeff.CMy);
-    AllBoundMntCoeff.CMz = Allreduce(AllBoundMntCoeff.CMz);
-
-    AllBoundMntCoeff.CoPx = Allreduce(AllBoundMntCoeff.CoPx);
-    AllBoundMntCoeff.CoPy = Allreduce(AllBoundMntCoeff.CoPy);
-    AllBoundMntCoeff.CoPz = Allreduce(AllBoundMntCoeff.CoPz);
-
-    AllBoundMntCoeff.CT = Allreduce(AllBoundMntCoeff.CT);
-    AllBoundMntCoeff.CQ = Allreduce(AllBoundMntCoeff.CQ);
-    AllBoundMntCoeff.CMerit = AllBoundMntCoeff.CT / (AllBoundMntCoeff.CQ + EPS);
-
-  }
-
-  /*--- Add the forces on the surfaces using all the nodes ---*/
-
-  if (config->GetComm_Level() == COMM_FULL) {
+    const int nMarkerMon = config->GetnMarker_Monitoring();
 
-    int nMarkerMon = config->GetnMarker_Monitoring();
+    CSumReduction reduction;
 
-    /*--- Use the same buffer for all reductions. We could avoid the copy back into
-     *    the original variable by swaping pointers, but it is safer this way... ---*/
+    for (su2double* coeff : {&AllBoundMntCoeff.CD, &AllBoundMntCoeff.CL, &AllBoundMntCoeff.CSF, &AllBoundMntCoeff.CMx,
+                             &AllBoundMntCoeff.CMy, &AllBoundMntCoeff.CMz, &AllBoundMntCoeff.CoPx, &AllBoundMntCoeff.CoPy,
+                             &AllBoundMntCoeff.CoPz, &AllBoundMntCoeff.CFx, &AllBoundMntCoeff.CFy, &AllBoundMntCoeff.CFz,
+                             &AllBoundMntCoeff.CT, &AllBoundMntCoeff.CQ})
+      reduction.Add(*coeff);
 
-    su2double* buffer = new su2double [nMarkerMon];
+    for (su2double* coeff : {SurfaceMntCoeff.CL, SurfaceMntCoeff.CD, SurfaceMntCoeff.CSF, SurfaceMntCoeff.CFx,
+                             SurfaceMntCoeff.CFy, SurfaceMntCoeff.CFz, SurfaceMntCoeff.CMx, SurfaceMntCoeff.CMy,
+                             SurfaceMntCoeff.CMz})
+      reduction.Add(coeff, nMarkerMon);
 
-    auto Allreduce_inplace = [buffer](int size, su2double* x) {
-      SU2_MPI::Allreduce(x, buffer, size, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-      for(int i=0; i<size; ++i) x[i] = buffer[i];
-    };
+    reduction.Complete();
 
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CL);
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CD);
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CSF);
+    AllBoundMntCoeff.CEff = AllBoundMntCoeff.CL / (AllBoundMntCoeff.CD + EPS);
+    AllBoundMntCoeff.CMerit = AllBoundMntCoeff.CT / (AllBoundMntCoeff.CQ + EPS);
 
     for (iMarker_Monitoring = 0; iMarker_Monitoring < nMarkerMon; iMarker_Monitoring++)
       SurfaceMntCoeff.CEff[iMarker_Monitoring] = SurfaceMntCoeff.CL[iMarker_Monitoring] / (SurfaceMntCoeff.CD[iMarker_Monitoring] + EPS);
 
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CFx);
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CFy);
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CFz);
-
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CMx);
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CMy);
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CMz);
-
-    delete [] buffer;
-
   }
 
 #endif
@@ -4496,58 +4660,109 @@ void CEulerSolver::Explicit_Iteration(CGeometry *geometry, CSolver **solver_cont
   const su2double* coordMax[MAXNVAR] = {nullptr};
   unsigned long idxMax[MAXNVAR] = {0};
 
-  /*--- Update the solution and residuals ---*/
+  /*--- Without multigrid the truncation error may not be allocated (lean storage). ---*/
 
-  SU2_OMP(for schedule(static,omp_chunk_size) nowait)
-  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+  const bool truncError = nodes->GetResTruncErrorAllocated();
+  const su2double zeroTruncError[MAXNVAR] = {0.0};
 
-    su2double Vol = geometry->node[iPoint]->GetVolume() + geometry->node[iPoint]->GetPeriodicVolume();
-    su2double Delta = nodes->GetDelta_Time(iPoint) / Vol;
+  /*--- Implicit residual smoothing, the last sweep is done point by point in the update. ---*/
 
-    const su2double* Res_TruncError = nodes->GetResTruncError(iPoint);
-    const su2double* Residual = LinSysRes.GetBlock(iPoint);
+  const bool smoothing = !adjoint && (config->GetResSmoothing_Iter() > 0);
+  const su2double smoothCoeff = config->GetResSmoothing_Coeff();
 
-    if (!adjoint) {
-      for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+  if (smoothing) SmoothResidual(geometry, config);
 
-        su2double Res = Residual[iVar] + Res_TruncError[iVar];
+  /*--- Frozen points (see ACTIVE_SET), the criterion is evaluated in the first stage. ---*/
 
-        /*--- "Static" switch which should be optimized at compile time. ---*/
-        switch(IntegrationType) {
+  const bool activeSet = config->GetActiveSet();
+  unsigned long nActive = 0;
 
-          case EULER_EXPLICIT:
-            nodes->AddSolution(iPoint,iVar, -Res*Delta);
-            break;
+  /*--- Update the solution and residuals. The points are processed in blocks, first the residual
+   *    of each point of the block is assembled (and its norms accumulated), then the stage update
+   *    is a single loop over the contiguous entries of the block in the solution containers. ---*/
 
-          case RUNGE_KUTTA_EXPLICIT:
-            nodes->AddSolution(iPoint, iVar, -Res*Delta*RK_AlphaCoeff);
-            break;
+  constexpr unsigned long BLOCK_SIZE = 16;
+  const unsigned long nBlock = roundUpDiv(nPointDomain, BLOCK_SIZE);
 
-          case CLASSICAL_RK4_EXPLICIT:
-          {
-            su2double tmp_time = -1.0*RK_TimeCoeff[iRKStep]*Delta;
-            su2double tmp_func = -1.0*RK_FuncCoeff[iRKStep]*Delta;
+  if (!adjoint) {
+    SU2_OMP(for schedule(static,roundUpDiv(omp_chunk_size,BLOCK_SIZE)) nowait)
+    for (unsigned long iBlock = 0; iBlock < nBlock; iBlock++) {
 
-            if (iRKStep < 3) {
-              /* Base Solution Update */
-              nodes->AddSolution(iPoint,iVar, tmp_time*Res);
+      const unsigned long begin = iBlock*BLOCK_SIZE;
+      const unsigned long end = min(begin+BLOCK_SIZE, nPointDomain);
+      const unsigned long nEntry = (end-begin)*nVar;
 
-              /* New Solution Update */
-              nodes->AddSolution_New(iPoint,iVar, tmp_func*Res);
-            } else {
-              nodes->SetSolution(iPoint, iVar, nodes->GetSolution_New(iPoint, iVar) + tmp_func*Res);
-            }
+      su2double Res[BLOCK_SIZE*MAXNVAR], Delta[BLOCK_SIZE*MAXNVAR];
+
+      for (unsigned long iPoint = begin; iPoint < end; iPoint++) {
+
+        su2double Vol = geometry->node[iPoint]->GetVolume() + geometry->node[iPoint]->GetPeriodicVolume();
+        const su2double delta = nodes->GetDelta_Time(iPoint) / Vol;
+
+        su2double* res = &Res[(iPoint-begin)*nVar];
+        const su2double* Res_TruncError = truncError? nodes->GetResTruncError(iPoint) : zeroTruncError;
+        const su2double* Residual = LinSysRes.GetBlock(iPoint);
+
+        for (unsigned short iVar = 0; iVar < nVar; iVar++)
+          res[iVar] = Residual[iVar] + Res_TruncError[iVar];
+
+        const bool frozen = activeSet && UpdateActiveSet(config, iPoint, res, nActive, iRKStep == 0);
+
+        for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+          Delta[(iPoint-begin)*nVar+iVar] = frozen? 0.0 : delta;
+
+          /*--- Update residual information for current thread. ---*/
+          resRMS[iVar] += res[iVar]*res[iVar];
+          if (fabs(res[iVar]) > resMax[iVar]) {
+            resMax[iVar] = fabs(res[iVar]);
+            idxMax[iVar] = iPoint;
+            coordMax[iVar] = geometry->node[iPoint]->GetCoord();
           }
-          break;
         }
 
-        /*--- Update residual information for current thread. ---*/
-        resRMS[iVar] += Res*Res;
-        if (fabs(Res) > resMax[iVar]) {
-          resMax[iVar] = fabs(Res);
-          idxMax[iVar] = iPoint;
-          coordMax[iVar] = geometry->node[iPoint]->GetCoord();
+        /*--- The norms are those of the residual before the smoothing. ---*/
+
+        if (smoothing) GetSmoothedResidual(geometry, iPoint, smoothCoeff, res);
+      }
+
+      su2double* solution = nodes->GetSolution(begin);
+      const su2double* solution_old = nodes->GetSolution_Old(begin);
+
+      /*--- "Static" switch which should be optimized at compile time. ---*/
+      switch(IntegrationType) {
+
+        case EULER_EXPLICIT:
+          SU2_OMP_SIMD
+          for (unsigned long k = 0; k < nEntry; k++)
+            solution[k] = solution_old[k] - Res[k]*Delta[k];
+          break;
+
+        case RUNGE_KUTTA_EXPLICIT:
+          SU2_OMP_SIMD
+          for (unsigned long k = 0; k < nEntry; k++)
+            solution[k] = solution_old[k] - Res[k]*Delta[k]*RK_AlphaCoeff;
+          break;
+
+        case CLASSICAL_RK4_EXPLICIT:
+        {
+          su2double* solution_new = nodes->GetSolution_New(begin);
+          const su2double tmp_time = -1.0*RK_TimeCoeff[iRKStep];
+          const su2double tmp_func = -1.0*RK_FuncCoeff[iRKStep];
+
+          if (iRKStep < 3) {
+            /* Base and New Solution Update */
+            SU2_OMP_SIMD
+            for (unsigned long k = 0; k < nEntry; k++) {
+              solution[k] = solution_old[k] + tmp_time*Delta[k]*Res[k];
+              solution_new[k] += tmp_func*Delta[k]*Res[k];
+            }
+          } else {
+            SU2_OMP_SIMD
+            for (unsigned long k = 0; k < nEntry; k++)
+              solution[k] = solution_new[k] + tmp_func*Delta[k]*Res[k];
+          }
         }
+        break;
       }
     }
   }
@@ -4561,6 +4776,8 @@ void CEulerSolver::Explicit_Iteration(CGeometry *geometry, CSolver **solver_cont
   }
   SU2_OMP_BARRIER
 
+  if (activeSet && !adjoint) SetActiveSetFraction(geometry, nActive);
+
   SU2_OMP_MASTER
   {
     /*--- MPI solution ---*/
@@ -4580,6 +4797,93 @@ void CEulerSolver::Explicit_Iteration(CGeometry *geometry, CSolver **solver_cont
 
 }
 
+void CEulerSolver::SmoothResidual(CGeometry *geometry, const CConfig *config) {
+
+  const unsigned short nSweeps = config->GetResSmoothing_Iter();
+  const su2double coeff = config->GetResSmoothing_Coeff();
+
+  /*--- Allocate the working matrices and flag the points with strong boundary conditions. ---*/
+
+  SU2_OMP_MASTER
+  if (resSmoothRHS.rows() != nPointDomain) {
+    resSmoothRHS.resize(nPointDomain,nVar);
+    if (nSweeps > 1) resSmooth[0].resize(nPointDomain,nVar);
+    if (nSweeps > 2) resSmooth[1].resize(nPointDomain,nVar);
+
+    resSmoothFixed.resize(nPointDomain) = false;
+    for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+      if ((config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX) ||
+          (config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL) ||
+          (config->GetMarker_All_KindBC(iMarker) == CHT_WALL_INTERFACE)) {
+        for (unsigned long iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+          const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          if (iPoint < nPointDomain) resSmoothFixed(iPoint) = true;
+        }
+      }
+    }
+  }
+  SU2_OMP_BARRIER
+
+  /*--- Right hand side of the smoothing, the residual plus the truncation error. ---*/
+
+  const bool truncError = nodes->GetResTruncErrorAllocated();
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    /*--- The points skipped by the active set keep their last complete residual. ---*/
+    if (activeSetSkip && activeSetFrozen(iPoint)) {
+      for (unsigned short iVar = 0; iVar < nVar; iVar++)
+        resSmoothRHS(iPoint,iVar) = activeSetResidual(iPoint,iVar);
+      continue;
+    }
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      resSmoothRHS(iPoint,iVar) = LinSysRes(iPoint,iVar);
+      if (truncError) resSmoothRHS(iPoint,iVar) += nodes->GetResTruncError(iPoint)[iVar];
+    }
+  }
+
+  /*--- Jacobi sweeps, (1 + eps*n_i) R_i - eps * sum_j R_j = R*_i, each reads the previous one. Only
+   *    the neighbors owned by this rank are used, which keeps the partitions independent. ---*/
+
+  const su2activematrix* input = &resSmoothRHS;
+
+  for (unsigned short iSweep = 0; iSweep+1 < nSweeps; iSweep++) {
+
+    su2activematrix& output = resSmooth[iSweep%2];
+
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+
+      if (resSmoothFixed(iPoint)) {
+        for (unsigned short iVar = 0; iVar < nVar; iVar++)
+          output(iPoint,iVar) = resSmoothRHS(iPoint,iVar);
+        continue;
+      }
+
+      su2double sum[MAXNVAR] = {0.0};
+      unsigned short nNeigh = 0;
+
+      for (unsigned short iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); iNeigh++) {
+        const unsigned long jPoint = geometry->node[iPoint]->GetPoint(iNeigh);
+        if (jPoint >= nPointDomain) continue;
+        for (unsigned short iVar = 0; iVar < nVar; iVar++)
+          sum[iVar] += (*input)(jPoint,iVar);
+        ++nNeigh;
+      }
+
+      const su2double factor = 1.0 / (1.0 + coeff*nNeigh);
+      for (unsigned short iVar = 0; iVar < nVar; iVar++)
+        output(iPoint,iVar) = (resSmoothRHS(iPoint,iVar) + coeff*sum[iVar]) * factor;
+    }
+    input = &output;
+  }
+
+  SU2_OMP_MASTER
+  resSmoothLast = input;
+  SU2_OMP_BARRIER
+
+}
+
 void CEulerSolver::ExplicitRK_Iteration(CGeometry *geometry, CSolver **solver_container,
                                         CConfig *config, unsigned short iRKStep) {
 
@@ -4599,7 +4903,23 @@ void CEulerSolver::ExplicitEuler_Iteration(CGeometry *geometry, CSolver **solver
 
 void CEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
 
-  const bool adjoint = config->GetContinuous_Adjoint();
+  PrepareImplicitIteration(geometry, solver_container, config);
+
+  /*--- Solve or smooth the linear system. ---*/
+
+  auto iter = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
+  SU2_OMP_MASTER
+  {
+    SetIterLinSolver(iter);
+    SetResLinSolver(System.GetResidual());
+  }
+  SU2_OMP_BARRIER
+
+  CompleteImplicitIteration(geometry, solver_container, config);
+}
+
+void CEulerSolver::PrepareImplicitIteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
+
   const bool roe_turkel = config->GetKind_Upwind_Flow() == TURKEL;
   const bool low_mach_prec = config->Low_Mach_Preconditioning();
 
@@ -4625,6 +4945,15 @@ void CEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver
   const su2double* coordMax[MAXNVAR] = {nullptr};
   unsigned long idxMax[MAXNVAR] = {0};
 
+  /*--- Without multigrid the truncation error may not be allocated (lean storage). ---*/
+
+  const bool truncError = nodes->GetResTruncErrorAllocated();
+
+  /*--- Frozen points (see ACTIVE_SET). ---*/
+
+  const bool activeSet = config->GetActiveSet();
+  unsigned long nActive = 0;
+
   /*--- Build implicit system ---*/
 
   SU2_OMP(for schedule(static,omp_chunk_size) nowait)
@@ -4632,7 +4961,34 @@ void CEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver
 
     /*--- Read the residual ---*/
 
-    su2double* local_Res_TruncError = nodes->GetResTruncError(iPoint);
+    su2double zeroTruncError[MAXNVAR] = {0.0};
+    su2double* local_Res_TruncError = truncError? nodes->GetResTruncError(iPoint) : zeroTruncError;
+
+    /*--- Frozen points are not updated, identity rows and zero right hand side, their
+     *    contribution to the norms is their last complete residual. ---*/
+
+    if (activeSet) {
+      su2double res[MAXNVAR];
+      for (unsigned short iVar = 0; iVar < nVar; iVar++)
+        res[iVar] = LinSysRes(iPoint,iVar) + local_Res_TruncError[iVar];
+
+      if (UpdateActiveSet(config, iPoint, res, nActive, true)) {
+        for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+          Jacobian.DeleteValsRowi(iPoint*nVar+iVar);
+          LinSysRes(iPoint,iVar) = 0.0;
+          LinSysSol(iPoint,iVar) = 0.0;
+
+          su2double Res = fabs(res[iVar]);
+          resRMS[iVar] += Res*Res;
+          if (Res > resMax[iVar]) {
+            resMax[iVar] = Res;
+            idxMax[iVar] = iPoint;
+            coordMax[iVar] = geometry->node[iPoint]->GetCoord();
+          }
+        }
+        continue;
+      }
+    }
 
     /*--- Read the volume ---*/
 
@@ -4682,6 +5038,8 @@ void CEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver
     AddRes_Max(iVar, resMax[iVar], geometry->node[idxMax[iVar]]->GetGlobalIndex(), coordMax[iVar]);
   }
 
+  if (activeSet) SetActiveSetFraction(geometry, nActive);
+
   /*--- Initialize residual and solution at the ghost points ---*/
 
   SU2_OMP(sections nowait)
@@ -4702,16 +5060,14 @@ void CEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver
     delete [] LowMachPrec;
   }
 
-  /*--- Solve or smooth the linear system. ---*/
+  /*--- The ghost points are initialized with "nowait", the system is complete after this barrier. ---*/
 
-  auto iter = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
-  SU2_OMP_MASTER
-  {
-    SetIterLinSolver(iter);
-    SetResLinSolver(System.GetResidual());
-  }
   SU2_OMP_BARRIER
+}
 
+void CEulerSolver::CompleteImplicitIteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
+
+  const bool adjoint = config->GetContinuous_Adjoint();
 
   ComputeUnderRelaxationFactor(solver_container, config);
 
@@ -4757,30 +5113,31 @@ void CEulerSolver::ComputeUnderRelaxationFactor(CSolver **solver_container, CCon
 
   const su2double allowableRatio = 0.2;
 
+  /* The turbulence nodes and the checked variables are loop invariants. */
+
+  const CVariable* turbNodes = (config->GetKind_Turb_Model() != NONE)? solver_container[TURB_SOL]->GetNodes() : nullptr;
+  const unsigned short checkVar[] = {0, static_cast<unsigned short>(nVar-1)};
+
   SU2_OMP_FOR_STAT(omp_chunk_size)
   for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
     su2double localUnderRelaxation = 1.0;
 
-    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
-
-      /* We impose a limit on the maximum percentage that the
-       density and energy can change over a nonlinear iteration. */
+    /* We impose a limit on the maximum percentage that the
+     density and energy can change over a nonlinear iteration. */
 
-      if ((iVar == 0) || (iVar == nVar-1)) {
-        const unsigned long index = iPoint*nVar + iVar;
-        su2double ratio = fabs(LinSysSol[index])/(nodes->GetSolution(iPoint, iVar)+EPS);
-        if (ratio > allowableRatio) {
-          localUnderRelaxation = min(allowableRatio/ratio, localUnderRelaxation);
-        }
+    for (auto iVar : checkVar) {
+      const su2double ratio = fabs(LinSysSol(iPoint,iVar))/(nodes->GetSolution(iPoint, iVar)+EPS);
+      if (ratio > allowableRatio) {
+        localUnderRelaxation = min(allowableRatio/ratio, localUnderRelaxation);
       }
     }
 
     /* In case of turbulence, take the min of the under-relaxation factor
      between the mean flow and the turb model. */
 
-    if (config->GetKind_Turb_Model() != NONE)
-      localUnderRelaxation = min(localUnderRelaxation, solver_container[TURB_SOL]->GetNodes()->GetUnderRelaxation(iPoint));
+    if (turbNodes != nullptr)
+      localUnderRelaxation = min(localUnderRelaxation, turbNodes->GetUnderRelaxation(iPoint));
 
     /* Threshold the relaxation factor in the event that there is
      a very small value. This helps avoid catastrophic crashes due
@@ -4798,43 +5155,286 @@ void CEulerSolver::ComputeUnderRelaxationFactor(CSolver **solver_container, CCon
 
 void CEulerSolver::SetPrimitive_Gradient_GG(CGeometry *geometry, CConfig *config, bool reconstruction) {
 
-  const auto& primitives = nodes->GetPrimitive();
-  auto& gradient = reconstruction? nodes->GetGradient_Reconstruction() : nodes->GetGradient_Primitive();
+  const auto& primitives = nodes->GetPrimitive();
+  auto& gradient = reconstruction? nodes->GetGradient_Reconstruction() : nodes->GetGradient_Primitive();
+
+  /*--- The exchange of the reconstruction gradients can overlap the upwind fluxes. ---*/
+
+  const bool deferComms = reconstruction && allowPendingComms &&
+                          (config->GetKind_ConvNumScheme_Flow() == SPACE_UPWIND);
+
+  computeGradientsGreenGauss(this, PRIMITIVE_GRADIENT, PERIODIC_PRIM_GG, *geometry,
+                             *config, primitives, 0, nPrimVarGrad, gradient, deferComms);
+}
+
+void CEulerSolver::SetPrimitive_Gradient_LS(CGeometry *geometry, CConfig *config, bool reconstruction) {
+
+  /*--- Set a flag for unweighted or weighted least-squares. ---*/
+  bool weighted;
+
+  if (reconstruction)
+    weighted = (config->GetKind_Gradient_Method_Recon() == WEIGHTED_LEAST_SQUARES);
+  else
+    weighted = (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES);
+
+  const auto& primitives = nodes->GetPrimitive();
+  auto& rmatrix = nodes->GetRmatrix();
+  auto& gradient = reconstruction? nodes->GetGradient_Reconstruction() : nodes->GetGradient_Primitive();
+  PERIODIC_QUANTITIES kindPeriodicComm = weighted? PERIODIC_PRIM_LS : PERIODIC_PRIM_ULS;
+
+  /*--- The exchange of the reconstruction gradients can overlap the upwind fluxes. ---*/
+
+  const bool deferComms = reconstruction && allowPendingComms &&
+                          (config->GetKind_ConvNumScheme_Flow() == SPACE_UPWIND);
+
+  computeGradientsLeastSquares(this, PRIMITIVE_GRADIENT, kindPeriodicComm, *geometry, *config,
+                               weighted, primitives, 0, nPrimVarGrad, gradient, rmatrix, deferComms);
+}
+
+void CEulerSolver::SetPrimitive_Limiter(CGeometry *geometry, CConfig *config) {
+
+  /*--- Frozen limiters (see SetLimiterUpdate), the halo values are also unchanged. ---*/
+
+  if (limiterUpdate == LimiterUpdate::NONE) return;
+
+  const auto pointMask = (limiterUpdate == LimiterUpdate::SOME)? &limiterPoints : nullptr;
+
+  auto kindLimiter = static_cast<ENUM_LIMITER>(config->GetKind_SlopeLimit_Flow());
+  const auto& primitives = nodes->GetPrimitive();
+  const auto& gradient = nodes->GetGradient_Reconstruction();
+  auto& primMin = nodes->GetSolution_Min();
+  auto& primMax = nodes->GetSolution_Max();
+  auto& limiter = nodes->GetLimiter_Primitive();
+
+  /*--- The limiter of a point does not depend on halo gradients, hence it can be computed while
+   *    they are exchanged, and its own exchange can overlap the upwind fluxes. ---*/
+
+  const bool deferComms = allowPendingComms && (config->GetKind_ConvNumScheme_Flow() == SPACE_UPWIND);
+
+  computeLimiters(kindLimiter, this, PRIMITIVE_LIMITER, PERIODIC_LIM_PRIM_1, PERIODIC_LIM_PRIM_2,
+            *geometry, *config, 0, nPrimVarGrad, primitives, gradient, primMin, primMax, limiter, deferComms,
+            false, pointMask);
+}
+
+void CEulerSolver::SetPrimitive_Gradient_Limiter(CGeometry *geometry, CConfig *config, bool reconstruction) {
+
+  const auto kindGradient = reconstruction? config->GetKind_Gradient_Method_Recon() : config->GetKind_Gradient_Method();
+  const auto kindLimiter = static_cast<ENUM_LIMITER>(config->GetKind_SlopeLimit_Flow());
+  const bool weighted = (kindGradient == WEIGHTED_LEAST_SQUARES);
+  const bool leastSquares = weighted || (kindGradient == LEAST_SQUARES);
+
+  /*--- The periodic corrections of the gradients and of the min/max need separate passes,
+   *    and the frozen limiters must not be overwritten. ---*/
+
+  if ((config->GetnMarker_Periodic() > 0) || (kindLimiter == NO_LIMITER) ||
+      (limiterUpdate != LimiterUpdate::ALL) ||
+      (!leastSquares && (kindGradient != GREEN_GAUSS))) {
+    if (kindGradient == GREEN_GAUSS) SetPrimitive_Gradient_GG(geometry, config, reconstruction);
+    if (leastSquares) SetPrimitive_Gradient_LS(geometry, config, reconstruction);
+    SetPrimitive_Limiter(geometry, config);
+    return;
+  }
+
+  const auto& primitives = nodes->GetPrimitive();
+  auto& gradient = reconstruction? nodes->GetGradient_Reconstruction() : nodes->GetGradient_Primitive();
+  auto& primMin = nodes->GetSolution_Min();
+  auto& primMax = nodes->GetSolution_Max();
+  auto& limiter = nodes->GetLimiter_Primitive();
+
+  /*--- Gradients and min/max without communication, the limiters then only project the
+   *    gradients over the neighbors, and the halo exchange carries both quantities. ---*/
+
+  if (leastSquares) {
+    computeGradientsLeastSquares(nullptr, PRIMITIVE_GRADIENT, PERIODIC_NONE, *geometry, *config, weighted,
+                                 primitives, 0, nPrimVarGrad, gradient, nodes->GetRmatrix(), false, &primMin, &primMax);
+  }
+  else {
+    computeGradientsGreenGauss(nullptr, PRIMITIVE_GRADIENT, PERIODIC_NONE, *geometry, *config,
+                               primitives, 0, nPrimVarGrad, gradient, false, &primMin, &primMax);
+  }
+
+  const bool deferComms = reconstruction && allowPendingComms &&
+                          (config->GetKind_ConvNumScheme_Flow() == SPACE_UPWIND);
+
+  computeLimiters(kindLimiter, this, PRIMITIVE_GRAD_LIMITER, PERIODIC_NONE, PERIODIC_NONE, *geometry, *config,
+                  0, nPrimVarGrad, primitives, gradient, primMin, primMax, limiter, deferComms, true);
+}
+
+void CEulerSolver::SetLimiterUpdate(CGeometry *geometry, const CConfig *config) {
+
+  if (!config->GetLimiterFreeze()) return;
+
+  const auto iter = config->GetInnerIter();
+
+  /*--- The decision is made once per iteration, the preprocessing may be called several times. ---*/
+
+  SU2_OMP_MASTER
+  if (iter != limiterUpdateIter) {
+
+    const su2double threshold = config->GetLimiterFreezeParam(0);
+    const auto frequency = static_cast<unsigned long>(SU2_TYPE::Int(config->GetLimiterFreezeParam(1)));
+    const su2double tolerance = config->GetLimiterFreezeParam(2);
+    const su2double rms = GetRes_RMS(0);
+
+    /*--- The residual is not available before the first iteration. ---*/
+
+    const bool converged = (iter > 0) && (rms > 0.0) && (log10(rms) < threshold);
+
+    if (!converged) {
+      limiterUpdate = LimiterUpdate::ALL;
+      limiterFrozen = false;
+    }
+    else if (!limiterFrozen || (iter < limiterFreezeIter) || (iter - limiterFreezeIter >= frequency)) {
+      limiterUpdate = LimiterUpdate::ALL;
+      limiterFrozen = true;
+      limiterFreezeIter = iter;
+      if (limiterSolution.size() == 0) limiterSolution.resize(nPointDomain, nVar);
+    }
+    else {
+      limiterUpdate = (tolerance > 0.0)? LimiterUpdate::SOME : LimiterUpdate::NONE;
+      if (limiterPoints.size() == 0) limiterPoints.resize(nPointDomain) = false;
+    }
+
+    limiterUpdateIter = iter;
+    limiterUpdateFraction = (limiterUpdate == LimiterUpdate::ALL)? 1.0 : 0.0;
+    limiterUpdatePoints = 0;
+  }
+  SU2_OMP_BARRIER
+
+  /*--- Reference solution for the partial updates. ---*/
+
+  if ((limiterUpdate == LimiterUpdate::ALL) && limiterFrozen) {
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
+      for (unsigned short iVar = 0; iVar < nVar; iVar++)
+        limiterSolution(iPoint,iVar) = nodes->GetSolution(iPoint,iVar);
+  }
+
+  if (limiterUpdate != LimiterUpdate::SOME) return;
+
+  /*--- Mark the points whose solution changed by more than the tolerance since their
+   *    limiters were computed, and make that solution the new reference. ---*/
+
+  const su2double tolerance = config->GetLimiterFreezeParam(2);
+  unsigned long nMarked = 0;
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    bool changed = false;
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      const su2double ref = limiterSolution(iPoint,iVar);
+      changed |= (fabs(nodes->GetSolution(iPoint,iVar) - ref) > tolerance * (fabs(ref) + EPS));
+    }
+    limiterPoints(iPoint) = changed;
+
+    if (changed) {
+      nMarked++;
+      for (unsigned short iVar = 0; iVar < nVar; iVar++)
+        limiterSolution(iPoint,iVar) = nodes->GetSolution(iPoint,iVar);
+    }
+  }
+
+  SU2_OMP_ATOMIC
+  limiterUpdatePoints += nMarked;
+  SU2_OMP_BARRIER
+
+  /*--- Over all the calls of the iteration. ---*/
+
+  SU2_OMP_MASTER
+  {
+    unsigned long nGlobal = 0;
+    SU2_MPI::Allreduce(&limiterUpdatePoints, &nGlobal, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+    limiterUpdateFraction = su2double(nGlobal) / geometry->GetGlobal_nPointDomain();
+  }
+  SU2_OMP_BARRIER
+}
+
+void CEulerSolver::SetActiveSet(CGeometry *geometry, const CConfig *config) {
+
+  if (!config->GetActiveSet()) return;
+
+  const auto iter = config->GetInnerIter();
+
+  /*--- The decision is made once per iteration, the preprocessing may be called several times. ---*/
+
+  SU2_OMP_MASTER
+  if (iter != activeSetIter) {
+
+    /*--- The halo points are never frozen, their edges are always computed. ---*/
+
+    if (activeSetFrozen.size() == 0) {
+      activeSetFrozen.resize(nPoint) = false;
+      activeSetCount.resize(nPointDomain) = 0;
+      activeSetResidual.resize(nPointDomain, nVar) = su2double(0.0);
+    }
+
+    /*--- Full sweep periodically, and at the first iteration of a run. ---*/
+
+    const auto frequency = static_cast<unsigned long>(SU2_TYPE::Int(config->GetActiveSetParam(2)));
+
+    activeSetSkip = (iter > activeSetSweepIter) && (iter - activeSetSweepIter < frequency);
+    if (!activeSetSkip) activeSetSweepIter = iter;
+
+    /*--- Reference for the criterion, the norms are reset before the update. ---*/
+
+    for (unsigned short iVar = 0; iVar < nVar; iVar++)
+      activeSetRMS[iVar] = GetRes_RMS(iVar);
+
+    activeSetIter = iter;
+  }
+  SU2_OMP_BARRIER
+}
+
+bool CEulerSolver::UpdateActiveSet(const CConfig *config, unsigned long iPoint, su2double* residual,
+                                   unsigned long& nActive, bool evaluate) {
+
+  /*--- Point skipped by the residual loops, use the residual it had when it was frozen. ---*/
+
+  if (activeSetSkip && activeSetFrozen(iPoint)) {
+    for (unsigned short iVar = 0; iVar < nVar; iVar++)
+      residual[iVar] = activeSetResidual(iPoint,iVar);
+    return true;
+  }
+
+  /*--- Complete residual, the point is frozen after enough consecutive iterations with
+   *    a residual (all variables) below the fraction of the global rms, or unfrozen. ---*/
 
-  computeGradientsGreenGauss(this, PRIMITIVE_GRADIENT, PERIODIC_PRIM_GG, *geometry,
-                             *config, primitives, 0, nPrimVarGrad, gradient);
-}
+  if (evaluate) {
+    const su2double fraction = config->GetActiveSetParam(0);
+    const auto nIter = static_cast<unsigned long>(SU2_TYPE::Int(config->GetActiveSetParam(1)));
 
-void CEulerSolver::SetPrimitive_Gradient_LS(CGeometry *geometry, CConfig *config, bool reconstruction) {
+    bool low = true;
+    for (unsigned short iVar = 0; iVar < nVar; iVar++)
+      low &= (fabs(residual[iVar]) < fraction * activeSetRMS[iVar]);
 
-  /*--- Set a flag for unweighted or weighted least-squares. ---*/
-  bool weighted;
+    activeSetCount(iPoint) = low? min(activeSetCount(iPoint)+1, nIter) : 0;
+    activeSetFrozen(iPoint) = (activeSetCount(iPoint) >= nIter);
 
-  if (reconstruction)
-    weighted = (config->GetKind_Gradient_Method_Recon() == WEIGHTED_LEAST_SQUARES);
-  else
-    weighted = (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES);
+    if (activeSetFrozen(iPoint)) {
+      for (unsigned short iVar = 0; iVar < nVar; iVar++)
+        activeSetResidual(iPoint,iVar) = residual[iVar];
+    }
+  }
 
-  const auto& primitives = nodes->GetPrimitive();
-  auto& rmatrix = nodes->GetRmatrix();
-  auto& gradient = reconstruction? nodes->GetGradient_Reconstruction() : nodes->GetGradient_Primitive();
-  PERIODIC_QUANTITIES kindPeriodicComm = weighted? PERIODIC_PRIM_LS : PERIODIC_PRIM_ULS;
+  nActive += !activeSetFrozen(iPoint);
 
-  computeGradientsLeastSquares(this, PRIMITIVE_GRADIENT, kindPeriodicComm, *geometry, *config,
-                               weighted, primitives, 0, nPrimVarGrad, gradient, rmatrix);
+  return activeSetFrozen(iPoint);
 }
 
-void CEulerSolver::SetPrimitive_Limiter(CGeometry *geometry, CConfig *config) {
+void CEulerSolver::SetActiveSetFraction(CGeometry *geometry, unsigned long nActive) {
 
-  auto kindLimiter = static_cast<ENUM_LIMITER>(config->GetKind_SlopeLimit_Flow());
-  const auto& primitives = nodes->GetPrimitive();
-  const auto& gradient = nodes->GetGradient_Reconstruction();
-  auto& primMin = nodes->GetSolution_Min();
-  auto& primMax = nodes->GetSolution_Max();
-  auto& limiter = nodes->GetLimiter_Primitive();
+  SU2_OMP_ATOMIC
+  activeSetPoints += nActive;
+  SU2_OMP_BARRIER
 
-  computeLimiters(kindLimiter, this, PRIMITIVE_LIMITER, PERIODIC_LIM_PRIM_1, PERIODIC_LIM_PRIM_2,
-            *geometry, *config, 0, nPrimVarGrad, primitives, gradient, primMin, primMax, limiter);
+  SU2_OMP_MASTER
+  {
+    unsigned long nGlobal = 0;
+    SU2_MPI::Allreduce(&activeSetPoints, &nGlobal, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+    activeSetFraction = su2double(nGlobal) / geometry->GetGlobal_nPointDomain();
+    activeSetPoints = 0;
+  }
+  SU2_OMP_BARRIER
 }
 
 void CEulerSolver::SetPreconditioner(const CConfig *config, unsigned long iPoint,
@@ -6245,6 +6845,9 @@ void CEulerSolver::SetFarfield_AoA(CGeometry *geometry, CSolver **solver_contain
     AoA_Prev = config->GetAoA();
     dCL_dAlpha = config->GetdCL_dAlpha();
     AoA_inc = 0.0;
+    AoA_Ramp_inc = 0.0;
+    AoA_Ramp_Left = 0;
+    Newton_Prev_Valid = false;
   }
 
   /*--- Retrieve the AoA (degrees) ---*/
@@ -6255,9 +6858,10 @@ void CEulerSolver::SetFarfield_AoA(CGeometry *geometry, CSolver **solver_contain
 
   if (fabs(AoA_inc) > 0.0 && Output) {
 
-    /* --- Update *_Prev values with current coefficients --- */
+    /* --- Update *_Prev values with current coefficients, the Newton updates keep their
+       own estimate of dCL/dAlpha (the coefficients are not settled during a ramp). --- */
 
-    SetCoefficient_Gradients(config);
+    if (!config->GetFixed_CL_Newton()) SetCoefficient_Gradients(config);
 
     Total_CD_Prev = TotalCoeff.CD;
     Total_CL_Prev = TotalCoeff.CL;
@@ -6325,9 +6929,16 @@ bool CEulerSolver::FixedCL_Convergence(CConfig* config, bool convergence) {
   AoA_inc = 0.0;
 
 
+  /*--- Newton updates before finite differencing. ---*/
+
+  if (!Start_AoA_FD && config->GetFixed_CL_Newton()) {
+    fixed_cl_conv = FixedCL_NewtonUpdate(config, convergence);
+    if (fixed_cl_conv) return true;
+  }
+
   /*--- if in Fixed CL mode, before finite differencing --- */
 
-  if (!Start_AoA_FD){
+  else if (!Start_AoA_FD){
     if (convergence){
 
       /* --- C_L and solution are converged, start finite differencing --- */
@@ -6420,6 +7031,70 @@ bool CEulerSolver::FixedCL_Convergence(CConfig* config, bool convergence) {
 
 }
 
+bool CEulerSolver::FixedCL_NewtonUpdate(CConfig* config, bool convergence) {
+
+  const su2double Target_CL = config->GetTarget_CL();
+  const unsigned long curr_iter = config->GetInnerIter();
+  const unsigned long Iter_dCL_dAlpha = config->GetIter_dCL_dAlpha();
+  const bool cl_converged = (fabs(TotalCoeff.CL-Target_CL) < (config->GetCauchy_Eps()/2));
+
+  /* --- C_L and solution are converged (not while ramping), or the total iteration
+      limit is reached, finish or start finite differencing as for the fixed point updates. --- */
+
+  const bool iter_limit = (curr_iter == config->GetnInner_Iter() - Iter_dCL_dAlpha);
+
+  if ((convergence && cl_converged && (AoA_Ramp_Left == 0)) || iter_limit) {
+    AoA_Ramp_Left = 0;
+    if (Iter_dCL_dAlpha == 0) {
+      if (!iter_limit) return true;
+      End_AoA_FD = true;
+    }
+    Iter_Update_AoA = curr_iter;
+    Start_AoA_FD = true;
+    AoA_inc = 0.001;
+    return false;
+  }
+
+  /* --- Keep applying the current update. --- */
+
+  if (AoA_Ramp_Left > 0) {
+    AoA_inc = AoA_Ramp_inc;
+    AoA_Ramp_Left--;
+    return false;
+  }
+
+  if ((curr_iter - Iter_Update_AoA) < config->GetFixed_CL_Newton_Iter() || cl_converged) return false;
+
+  /* --- Secant estimate of the slope from the previous update, it is averaged with the current
+      estimate, and only accepted within a factor of 4 of the initial value, as the coefficients
+      are not fully settled. --- */
+
+  const su2double AoA = config->GetAoA();
+
+  if (Newton_Prev_Valid && (fabs(AoA-AoA_Newton_Prev) > 1e-6)) {
+    const su2double secant = (TotalCoeff.CL-CL_Newton_Prev) / (AoA-AoA_Newton_Prev);
+    const su2double initial = config->GetdCL_dAlpha();
+    if (secant*initial > 0.0) {
+      const su2double lower = 0.25*fabs(initial), upper = 4.0*fabs(initial);
+      const su2double slope = min(max(su2double(fabs(secant)), lower), upper);
+      dCL_dAlpha = 0.5*(dCL_dAlpha + ((initial > 0.0)? slope : su2double(-slope)));
+    }
+  }
+  AoA_Newton_Prev = AoA;
+  CL_Newton_Prev = TotalCoeff.CL;
+  Newton_Prev_Valid = true;
+
+  /* --- Newton step, spread over a number of iterations. --- */
+
+  const auto nRamp = config->GetFixed_CL_AoA_Ramp();
+  AoA_Ramp_inc = (Target_CL-TotalCoeff.CL) / (dCL_dAlpha*nRamp);
+  AoA_Ramp_Left = nRamp-1;
+  AoA_inc = AoA_Ramp_inc;
+  Iter_Update_AoA = curr_iter;
+
+  return false;
+}
+
 void CEulerSolver::SetCoefficient_Gradients(CConfig *config){
   su2double dCL_dAlpha_, dCD_dCL_, dCMx_dCL_, dCMy_dCL_, dCMz_dCL_;
   su2double AoA = config->GetAoA();
@@ -6774,12 +7449,18 @@ void CEulerSolver::BC_Sym_Plane(CGeometry      *geometry,
   for (iVar = 0; iVar < nPrimVarGrad; iVar++)
     Grad_Reflected[iVar] = new su2double[nDim];
 
+  /*--- The normal of straight boundaries is computed once by each thread (for the first vertex it visits). ---*/
+  bool normalComputed = false;
+
   /*--- Loop over all the vertices on this boundary marker. ---*/
+  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
-    if (iVertex == 0 ||
+    if (!normalComputed ||
         geometry->bound_is_straight[val_marker] != true) {
 
+      normalComputed = true;
+
       /*----------------------------------------------------------------------------------------------*/
       /*--- Preprocessing:                                                                         ---*/
       /*--- Compute the unit normal and (in case of viscous flow) a corresponding unit tangential  ---*/
@@ -6793,7 +7474,7 @@ void CEulerSolver::BC_Sym_Plane(CGeometry      *geometry,
       /*--- penalty).                                                                              ---*/
       /*----------------------------------------------------------------------------------------------*/
 
-      /*--- Normal vector for a random vertex (zero) on this marker (negate for outward convention). ---*/
+      /*--- Normal vector for a random vertex on this marker (negate for outward convention). ---*/
       geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
       for (iDim = 0; iDim < nDim; iDim++)
         Normal[iDim] = -Normal[iDim];
@@ -6890,7 +7571,7 @@ void CEulerSolver::BC_Sym_Plane(CGeometry      *geometry,
 
       /*--- Compute the residual using an upwind scheme. ---*/
 
-      auto residual = conv_numerics->ComputeResidual(config);
+      auto residual = conv_numerics->ComputeResidualPreacc(config);
 
       /*--- Update residual value ---*/
       LinSysRes.AddBlock(iPoint, residual);
@@ -6994,7 +7675,7 @@ void CEulerSolver::BC_Sym_Plane(CGeometry      *geometry,
 
         /*--- Compute and update residual. Note that the viscous shear stress tensor is computed in the
               following routine based upon the velocity-component gradients. ---*/
-        auto residual = visc_numerics->ComputeResidual(config);
+        auto residual = visc_numerics->ComputeResidualPreacc(config);
 
         LinSysRes.SubtractBlock(iPoint, residual);
 
@@ -7045,6 +7726,7 @@ void CEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container,
 
   /*--- Loop over all the vertices on this boundary marker ---*/
 
+  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
     iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
 
@@ -7215,7 +7897,7 @@ void CEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container,
 
       /*--- Compute the convective residual using an upwind scheme ---*/
 
-      auto residual = conv_numerics->ComputeResidual(config);
+      auto residual = conv_numerics->ComputeResidualPreacc(config);
 
       /*--- Update residual value ---*/
 
@@ -7259,7 +7941,7 @@ void CEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container,
 
         /*--- Compute and update viscous residual ---*/
 
-        auto residual = visc_numerics->ComputeResidual(config);
+        auto residual = visc_numerics->ComputeResidualPreacc(config);
         LinSysRes.SubtractBlock(iPoint, residual);
 
         /*--- Viscous Jacobian contribution for implicit integration ---*/
@@ -7298,30 +7980,35 @@ void CEulerSolver::BC_Riemann(CGeometry *geometry, CSolver **solver_container,
   bool gravity = (config->GetGravityForce());
   bool tkeNeeded = (config->GetKind_Turb_Model() == SST) || (config->GetKind_Turb_Model() == SST_SUST);
 
+  /*--- Temporaries of this call, from the arena of the thread (released on return). ---*/
+  MemoryAllocation::CScratchScope scratch;
+
   su2double *Normal, *FlowDirMix, TangVelocity, NormalVelocity;
-  Normal = new su2double[nDim];
-
-  Velocity_i = new su2double[nDim];
-  Velocity_b = new su2double[nDim];
-  Velocity_e = new su2double[nDim];
-  FlowDirMix = new su2double[nDim];
-  Lambda_i = new su2double[nVar];
-  u_i = new su2double[nVar];
-  u_e = new su2double[nVar];
-  u_b = new su2double[nVar];
-  dw = new su2double[nVar];
-
-  S_boundary = new su2double[8];
-
-  P_Tensor = new su2double*[nVar];
-  invP_Tensor = new su2double*[nVar];
-  for (iVar = 0; iVar < nVar; iVar++)
-  {
-    P_Tensor[iVar] = new su2double[nVar];
-    invP_Tensor[iVar] = new su2double[nVar];
-  }
+  Normal = scratch.alloc<su2double>(nDim);
+
+  Velocity_i = scratch.alloc<su2double>(nDim);
+  Velocity_b = scratch.alloc<su2double>(nDim);
+  Velocity_e = scratch.alloc<su2double>(nDim);
+  FlowDirMix = scratch.alloc<su2double>(nDim);
+  Lambda_i = scratch.alloc<su2double>(nVar);
+  u_i = scratch.alloc<su2double>(nVar);
+  u_e = scratch.alloc<su2double>(nVar);
+  u_b = scratch.alloc<su2double>(nVar);
+  dw = scratch.alloc<su2double>(nVar);
+
+  S_boundary = scratch.alloc<su2double>(8);
+
+  /*--- Local residual and Jacobian (thread safety). ---*/
+  su2double *Residual = scratch.alloc<su2double>(nVar);
+  su2double **Jacobian_i = scratch.alloc_matrix<su2double>(nVar, nVar);
+
+  P_Tensor = scratch.alloc_matrix<su2double>(nVar, nVar);
+  invP_Tensor = scratch.alloc_matrix<su2double>(nVar, nVar);
+  Jacobian_b = scratch.alloc_matrix<su2double>(nVar, nVar);
+  DubDu = scratch.alloc_matrix<su2double>(nVar, nVar);
 
   /*--- Loop over all the vertices on this boundary marker ---*/
+  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
     V_boundary= GetCharacPrimVar(val_marker, iVertex);
@@ -7602,14 +8289,6 @@ void CEulerSolver::BC_Riemann(CGeometry *geometry, CSolver **solver_container,
 
       if (implicit) {
 
-        Jacobian_b = new su2double*[nVar];
-        DubDu = new su2double*[nVar];
-        for (iVar = 0; iVar < nVar; iVar++)
-        {
-          Jacobian_b[iVar] = new su2double[nVar];
-          DubDu[iVar] = new su2double[nVar];
-        }
-
         /*--- Initialize DubDu to unit matrix---*/
 
         for (iVar = 0; iVar < nVar; iVar++)
@@ -7663,13 +8342,6 @@ void CEulerSolver::BC_Riemann(CGeometry *geometry, CSolver **solver_container,
             }
           }
         }
-
-        for (iVar = 0; iVar < nVar; iVar++) {
-          delete [] Jacobian_b[iVar];
-          delete [] DubDu[iVar];
-        }
-        delete [] Jacobian_b;
-        delete [] DubDu;
       }
 
       /*--- Update residual value ---*/
@@ -7743,7 +8415,7 @@ void CEulerSolver::BC_Riemann(CGeometry *geometry, CSolver **solver_container,
 
         /*--- Compute and update residual ---*/
 
-        auto residual = visc_numerics->ComputeResidual(config);
+        auto residual = visc_numerics->ComputeResidualPreacc(config);
         LinSysRes.SubtractBlock(iPoint, residual);
 
         /*--- Jacobian contribution for implicit integration ---*/
@@ -7756,29 +8428,6 @@ void CEulerSolver::BC_Riemann(CGeometry *geometry, CSolver **solver_container,
     }
   }
 
-  /*--- Free locally allocated memory ---*/
-  delete [] Normal;
-  delete [] Velocity_e;
-  delete [] Velocity_b;
-  delete [] Velocity_i;
-  delete [] FlowDirMix;
-
-  delete [] S_boundary;
-  delete [] Lambda_i;
-  delete [] u_i;
-  delete [] u_e;
-  delete [] u_b;
-  delete [] dw;
-
-
-  for (iVar = 0; iVar < nVar; iVar++)
-  {
-    delete [] P_Tensor[iVar];
-    delete [] invP_Tensor[iVar];
-  }
-  delete [] P_Tensor;
-  delete [] invP_Tensor;
-
 }
 
 
@@ -7805,31 +8454,31 @@ void CEulerSolver::BC_TurboRiemann(CGeometry *geometry, CSolver **solver_contain
   bool gravity = (config->GetGravityForce());
   bool tkeNeeded = (config->GetKind_Turb_Model() == SST) || (config->GetKind_Turb_Model() == SST_SUST);
 
+  /*--- Temporaries of this call, from the arena of the thread (released on return). ---*/
+  MemoryAllocation::CScratchScope scratch;
+
   su2double *Normal, *turboNormal, *UnitNormal, *FlowDirMix, FlowDirMixMag, *turboVelocity;
-  Normal = new su2double[nDim];
-  turboNormal = new su2double[nDim];
-  UnitNormal = new su2double[nDim];
-
-  Velocity_i = new su2double[nDim];
-  Velocity_b = new su2double[nDim];
-  Velocity_e = new su2double[nDim];
-  turboVelocity = new su2double[nDim];
-  FlowDirMix = new su2double[nDim];
-  Lambda_i = new su2double[nVar];
-  u_i = new su2double[nVar];
-  u_e = new su2double[nVar];
-  u_b = new su2double[nVar];
-  dw = new su2double[nVar];
-
-  S_boundary = new su2double[8];
-
-  P_Tensor = new su2double*[nVar];
-  invP_Tensor = new su2double*[nVar];
-  for (iVar = 0; iVar < nVar; iVar++)
-  {
-    P_Tensor[iVar] = new su2double[nVar];
-    invP_Tensor[iVar] = new su2double[nVar];
-  }
+  Normal = scratch.alloc<su2double>(nDim);
+  turboNormal = scratch.alloc<su2double>(nDim);
+  UnitNormal = scratch.alloc<su2double>(nDim);
+
+  Velocity_i = scratch.alloc<su2double>(nDim);
+  Velocity_b = scratch.alloc<su2double>(nDim);
+  Velocity_e = scratch.alloc<su2double>(nDim);
+  turboVelocity = scratch.alloc<su2double>(nDim);
+  FlowDirMix = scratch.alloc<su2double>(nDim);
+  Lambda_i = scratch.alloc<su2double>(nVar);
+  u_i = scratch.alloc<su2double>(nVar);
+  u_e = scratch.alloc<su2double>(nVar);
+  u_b = scratch.alloc<su2double>(nVar);
+  dw = scratch.alloc<su2double>(nVar);
+
+  S_boundary = scratch.alloc<su2double>(8);
+
+  P_Tensor = scratch.alloc_matrix<su2double>(nVar, nVar);
+  invP_Tensor = scratch.alloc_matrix<su2double>(nVar, nVar);
+  Jacobian_b = scratch.alloc_matrix<su2double>(nVar, nVar);
+  DubDu = scratch.alloc_matrix<su2double>(nVar, nVar);
 
   /*--- Loop over all the vertices on this boundary marker ---*/
   for (iSpan= 0; iSpan < nSpanWiseSections; iSpan++){
@@ -8106,14 +8755,6 @@ void CEulerSolver::BC_TurboRiemann(CGeometry *geometry, CSolver **solver_contain
 
         if (implicit) {
 
-          Jacobian_b = new su2double*[nVar];
-          DubDu = new su2double*[nVar];
-          for (iVar = 0; iVar < nVar; iVar++)
-          {
-            Jacobian_b[iVar] = new su2double[nVar];
-            DubDu[iVar] = new su2double[nVar];
-          }
-
           /*--- Initialize DubDu to unit matrix---*/
 
           for (iVar = 0; iVar < nVar; iVar++)
@@ -8167,13 +8808,6 @@ void CEulerSolver::BC_TurboRiemann(CGeometry *geometry, CSolver **solver_contain
               }
             }
           }
-
-          for (iVar = 0; iVar < nVar; iVar++) {
-            delete [] Jacobian_b[iVar];
-            delete [] DubDu[iVar];
-          }
-          delete [] Jacobian_b;
-          delete [] DubDu;
         }
 
         /*--- Update residual value ---*/
@@ -8247,7 +8881,7 @@ void CEulerSolver::BC_TurboRiemann(CGeometry *geometry, CSolver **solver_contain
 
           /*--- Compute and update residual ---*/
 
-          auto residual = visc_numerics->ComputeResidual(config);
+          auto residual = visc_numerics->ComputeResidualPreacc(config);
           LinSysRes.SubtractBlock(iPoint, residual);
 
           /*--- Jacobian contribution for implicit integration ---*/
@@ -8260,32 +8894,6 @@ void CEulerSolver::BC_TurboRiemann(CGeometry *geometry, CSolver **solver_contain
     }
 }
 
-  /*--- Free locally allocated memory ---*/
-  delete [] Normal;
-  delete [] UnitNormal;
-  delete [] turboNormal;
-  delete [] turboVelocity;
-  delete [] Velocity_e;
-  delete [] Velocity_b;
-  delete [] Velocity_i;
-  delete [] FlowDirMix;
-
-  delete [] S_boundary;
-  delete [] Lambda_i;
-  delete [] u_i;
-  delete [] u_e;
-  delete [] u_b;
-  delete [] dw;
-
-
-  for (iVar = 0; iVar < nVar; iVar++)
-  {
-    delete [] P_Tensor[iVar];
-    delete [] invP_Tensor[iVar];
-  }
-  delete [] P_Tensor;
-  delete [] invP_Tensor;
-
 }
 
 void CEulerSolver::PreprocessBC_Giles(CGeometry *geometry, CConfig *config, CNumerics *conv_numerics, unsigned short marker_flag) {
@@ -8297,11 +8905,12 @@ void CEulerSolver::PreprocessBC_Giles(CGeometry *geometry, CConfig *config, CNum
   long freq;
   unsigned short  iZone     = config->GetiZone();
   unsigned short nSpanWiseSections = geometry->GetnSpanWiseSections(marker_flag);
-  turboNormal   = new su2double[nDim];
-  turboVelocity = new su2double[nDim];
-  Velocity_i    = new su2double[nDim];
-  deltaprim     = new su2double[nVar];
-  cj            = new su2double[nVar];
+  MemoryAllocation::CScratchScope scratch;
+  turboNormal   = scratch.alloc<su2double>(nDim);
+  turboVelocity = scratch.alloc<su2double>(nDim);
+  Velocity_i    = scratch.alloc<su2double>(nDim);
+  deltaprim     = scratch.alloc<su2double>(nVar);
+  cj            = scratch.alloc<su2double>(nVar);
   complex<su2double> I, cktemp_inf,cktemp_out1, cktemp_out2, expArg;
   I = complex<su2double>(0.0,1.0);
 
@@ -8435,12 +9044,6 @@ void CEulerSolver::PreprocessBC_Giles(CGeometry *geometry, CConfig *config, CNum
     }
   }
 
-  delete [] turboVelocity;
-  delete [] turboNormal;
-  delete [] Velocity_i;
-  delete [] deltaprim;
-  delete [] cj;
-
 }
 
 void CEulerSolver::BC_Giles(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics,
@@ -8467,45 +9070,35 @@ void CEulerSolver::BC_Giles(CGeometry *geometry, CSolver **solver_container, CNu
   su2double spanPercent, extrarelfacAvg = 0.0, deltaSpan = 0.0, relfacAvg, relfacFou, coeffrelfacAvg = 0.0;
   unsigned short Turbo_Flag;
 
-  Normal                = new su2double[nDim];
-  turboNormal           = new su2double[nDim];
-  UnitNormal            = new su2double[nDim];
-  turboVelocity         = new su2double[nDim];
-  Velocity_i            = new su2double[nDim];
-  Velocity_b            = new su2double[nDim];
+  /*--- Temporaries of this call, from the arena of the thread (released on return). ---*/
+  MemoryAllocation::CScratchScope scratch;
+
+  Normal                = scratch.alloc<su2double>(nDim);
+  turboNormal           = scratch.alloc<su2double>(nDim);
+  UnitNormal            = scratch.alloc<su2double>(nDim);
+  turboVelocity         = scratch.alloc<su2double>(nDim);
+  Velocity_i            = scratch.alloc<su2double>(nDim);
+  Velocity_b            = scratch.alloc<su2double>(nDim);
 
 
   su2double AverageSoundSpeed, *AverageTurboMach, AverageEntropy, AverageEnthalpy;
-  AverageTurboMach = new su2double[nDim];
-  S_boundary       = new su2double[8];
+  AverageTurboMach = scratch.alloc<su2double>(nDim);
+  S_boundary       = scratch.alloc<su2double>(8);
 
   su2double  AvgMach , *cj, GilesBeta, *delta_c, **R_Matrix, *deltaprim, **R_c_inv,**R_c, alphaIn_BC, gammaIn_BC = 0,
       P_Total, T_Total, *FlowDir, Enthalpy_BC, Entropy_BC, *R, *c_avg,*dcjs, Beta_inf2, c2js_Re, c3js_Re, cOutjs_Re, avgVel2 =0.0;
 
   long freq;
 
-  delta_c       = new su2double[nVar];
-  deltaprim     = new su2double[nVar];
-  cj            = new su2double[nVar];
-  R_Matrix      = new su2double*[nVar];
-  R_c           = new su2double*[nVar-1];
-  R_c_inv       = new su2double*[nVar-1];
-  R             = new su2double[nVar-1];
-  c_avg         = new su2double[nVar];
-  dcjs          = new su2double[nVar];
-
-  for (iVar = 0; iVar < nVar; iVar++)
-  {
-    R_Matrix[iVar] = new su2double[nVar];
-    c_avg[iVar]    =  0.0;
-    dcjs[iVar]     =  0.0;
-  }
-  for (iVar = 0; iVar < nVar-1; iVar++)
-  {
-    R_c[iVar] = new su2double[nVar-1];
-    R_c_inv[iVar] = new su2double[nVar-1];
-  }
-
+  delta_c       = scratch.alloc<su2double>(nVar);
+  deltaprim     = scratch.alloc<su2double>(nVar);
+  cj            = scratch.alloc<su2double>(nVar);
+  R_Matrix      = scratch.alloc_matrix<su2double>(nVar, nVar);
+  R_c           = scratch.alloc_matrix<su2double>(nVar-1, nVar-1);
+  R_c_inv       = scratch.alloc_matrix<su2double>(nVar-1, nVar-1);
+  R             = scratch.alloc<su2double>(nVar-1);
+  c_avg         = scratch.alloc<su2double>(nVar);
+  dcjs          = scratch.alloc<su2double>(nVar);
 
   complex<su2double> I, c2ks, c2js, c3ks, c3js, c4ks, c4js, cOutks, cOutjs, Beta_inf;
   I = complex<su2double>(0.0,1.0);
@@ -9079,7 +9672,7 @@ void CEulerSolver::BC_Giles(CGeometry *geometry, CSolver **solver_container, CNu
 
       /*--- Compute the residual using an upwind scheme ---*/
 
-      auto residual = conv_numerics->ComputeResidual(config);
+      auto residual = conv_numerics->ComputeResidualPreacc(config);
 
       /*--- Update residual value ---*/
       LinSysRes.AddBlock(iPoint, residual);
@@ -9140,7 +9733,7 @@ void CEulerSolver::BC_Giles(CGeometry *geometry, CSolver **solver_container, CNu
 
         /*--- Compute and update residual ---*/
 
-        auto residual = visc_numerics->ComputeResidual(config);
+        auto residual = visc_numerics->ComputeResidualPreacc(config);
         LinSysRes.SubtractBlock(iPoint, residual);
 
         /*--- Jacobian contribution for implicit integration ---*/
@@ -9153,36 +9746,6 @@ void CEulerSolver::BC_Giles(CGeometry *geometry, CSolver **solver_container, CNu
     }
   }
 
-  /*--- Free locally allocated memory ---*/
-  delete [] Normal;
-
-  delete [] Velocity_b;
-  delete [] Velocity_i;
-
-  delete [] S_boundary;
-  delete [] delta_c;
-  delete [] deltaprim;
-  delete [] cj;
-  for (iVar = 0; iVar < nVar; iVar++)
-  {
-    delete [] R_Matrix[iVar];
-  }
-  for (iVar = 0; iVar < nVar-1; iVar++)
-  {
-    delete [] R_c_inv[iVar];
-    delete [] R_c[iVar];
-  }
-  delete [] R_Matrix;
-  delete [] R_c;
-  delete [] R_c_inv;
-  delete [] R;
-  delete [] c_avg;
-  delete [] dcjs;
-
-  delete [] AverageTurboMach;
-  delete [] UnitNormal;
-  delete [] turboNormal;
-  delete [] turboVelocity;
 }
 
 void CEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
@@ -9205,6 +9768,7 @@ void CEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
 
   /*--- Loop over all the vertices on this boundary marker ---*/
 
+  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
     /*--- Allocate the value at the inlet ---*/
@@ -9421,7 +9985,7 @@ void CEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
 
       /*--- Compute the residual using an upwind scheme ---*/
 
-      auto residual = conv_numerics->ComputeResidual(config);
+      auto residual = conv_numerics->ComputeResidualPreacc(config);
 
       /*--- Update residual value ---*/
 
@@ -9500,6 +10064,7 @@ void CEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
   su2double *Normal = new su2double[nDim];
 
   /*--- Loop over all the vertices on this boundary marker ---*/
+  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
     /*--- Allocate the value at the outlet ---*/
@@ -9599,7 +10164,7 @@ void CEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
 
       /*--- Compute the residual using an upwind scheme ---*/
 
-      auto residual = conv_numerics->ComputeResidual(config);
+      auto residual = conv_numerics->ComputeResidualPreacc(config);
 
       /*--- Add Residuals and Jacobians ---*/
 
@@ -9700,6 +10265,7 @@ void CEulerSolver::BC_Supersonic_Inlet(CGeometry *geometry, CSolver **solver_con
 
   /*--- Loop over all the vertices on this boundary marker ---*/
 
+  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
     /*--- Allocate the value at the outlet ---*/
@@ -9741,7 +10307,7 @@ void CEulerSolver::BC_Supersonic_Inlet(CGeometry *geometry, CSolver **solver_con
 
       /*--- Compute the residual using an upwind scheme ---*/
 
-      auto residual = conv_numerics->ComputeResidual(config);
+      auto residual = conv_numerics->ComputeResidualPreacc(config);
 
       LinSysRes.AddBlock(iPoint, residual);
 
@@ -9817,6 +10383,7 @@ void CEulerSolver::BC_Supersonic_Outlet(CGeometry *geometry, CSolver **solver_co
 
   /*--- Loop over all the vertices on this boundary marker ---*/
 
+  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
     iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
@@ -9862,7 +10429,7 @@ void CEulerSolver::BC_Supersonic_Outlet(CGeometry *geometry, CSolver **solver_co
 
       /*--- Compute the residual using an upwind scheme ---*/
 
-      auto residual = conv_numerics->ComputeResidual(config);
+      auto residual = conv_numerics->ComputeResidualPreacc(config);
 
       LinSysRes.AddBlock(iPoint, residual);
 
@@ -9999,6 +10566,7 @@ void CEulerSolver::BC_Engine_Inflow(CGeometry *geometry, CSolver **solver_contai
 
   /*--- Loop over all the vertices on this boundary marker ---*/
 
+  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
     /*--- Allocate the value at the outlet ---*/
@@ -10085,7 +10653,7 @@ void CEulerSolver::BC_Engine_Inflow(CGeometry *geometry, CSolver **solver_contai
 
       /*--- Compute the residual using an upwind scheme ---*/
 
-      auto residual = conv_numerics->ComputeResidual(config);
+      auto residual = conv_numerics->ComputeResidualPreacc(config);
 
       LinSysRes.AddBlock(iPoint, residual);
 
@@ -10187,6 +10755,7 @@ void CEulerSolver::BC_Engine_Exhaust(CGeometry *geometry, CSolver **solver_conta
 
   /*--- Loop over all the vertices on this boundary marker ---*/
 
+  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
     /*--- Allocate the value at the exhaust ---*/
@@ -10340,7 +10909,7 @@ void CEulerSolver::BC_Engine_Exhaust(CGeometry *geometry, CSolver **solver_conta
 
       /*--- Compute the residual using an upwind scheme ---*/
 
-      auto residual = conv_numerics->ComputeResidual(config);
+      auto residual = conv_numerics->ComputeResidualPreacc(config);
 
       LinSysRes.AddBlock(iPoint, residual);
 
@@ -10478,7 +11047,7 @@ void CEulerSolver::BC_Fluid_Interface(CGeometry *geometry, CSolver **solver_cont
 
             /*--- Compute the convective residual using an upwind scheme ---*/
 
-            auto residual = conv_numerics->ComputeResidual(config);
+            auto residual = conv_numerics->ComputeResidualPreacc(config);
 
             /*--- Accumulate the residuals to compute the average ---*/
 
@@ -10538,7 +11107,7 @@ void CEulerSolver::BC_Fluid_Interface(CGeometry *geometry, CSolver **solver_cont
 
               /*--- Compute and update residual ---*/
 
-              auto residual = visc_numerics->ComputeResidual(config);
+              auto residual = visc_numerics->ComputeResidualPreacc(config);
 
               /*--- Accumulate the residuals to compute the average ---*/
 
@@ -10607,7 +11176,7 @@ void CEulerSolver::BC_Interface_Boundary(CGeometry *geometry, CSolver **solver_c
       /*--- Compute the convective residual using an upwind scheme ---*/
 
 
-      auto residual = numerics->ComputeResidual(config);
+      auto residual = numerics->ComputeResidualPreacc(config);
 
       /*--- Add Residuals and Jacobians ---*/
 
@@ -10668,7 +11237,7 @@ void CEulerSolver::BC_NearField_Boundary(CGeometry *geometry, CSolver **solver_c
 
       /*--- Compute the convective residual using an upwind scheme ---*/
 
-      auto residual = numerics->ComputeResidual(config);
+      auto residual = numerics->ComputeResidualPreacc(config);
 
       /*--- Add Residuals and Jacobians ---*/
 
@@ -10732,6 +11301,7 @@ void CEulerSolver::BC_ActDisk(CGeometry *geometry, CSolver **solver_container, C
 
   /*--- Loop over all the vertices on this boundary marker ---*/
 
+  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
     iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
@@ -11046,7 +11616,7 @@ void CEulerSolver::BC_ActDisk(CGeometry *geometry, CSolver **solver_container, C
 
       /*--- Compute the residual using an upwind scheme ---*/
 
-      auto residual = conv_numerics->ComputeResidual(config);
+      auto residual = conv_numerics->ComputeResidualPreacc(config);
 
       /*--- Update residual value ---*/
 
@@ -11524,64 +12094,61 @@ void CEulerSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig
   /*--- Load data from the restart into correct containers. ---*/
 
   counter = 0;
-  for (iPoint_Global = 0; iPoint_Global < geometry[MESH_0]->GetGlobal_nPointDomain(); iPoint_Global++ ) {
+  for (const auto& globalToLocal : geometry[MESH_0]->GetGlobal_to_Local_Map()) {
 
-    /*--- Retrieve local index. If this node from the restart file lives
-     on the current processor, we will load and instantiate the vars. ---*/
+    /*--- The points of this rank, in the order of their data in the restart file. ---*/
 
-    iPoint_Local = geometry[MESH_0]->GetGlobal_to_Local_Point(iPoint_Global);
+    iPoint_Global = globalToLocal.first;
+    iPoint_Local = globalToLocal.second;
 
-    if (iPoint_Local > -1) {
+    /*--- We need to store this point's data, so jump to the correct
+     offset in the buffer of data from the restart file and load it. ---*/
 
-      /*--- We need to store this point's data, so jump to the correct
-       offset in the buffer of data from the restart file and load it. ---*/
+    index = counter*Restart_Vars[1] + skipVars;
+    for (iVar = 0; iVar < nVar; iVar++) Solution[iVar] = Restart_Data[index+iVar];
+    nodes->SetSolution(iPoint_Local,Solution);
+    iPoint_Global_Local++;
 
-      index = counter*Restart_Vars[1] + skipVars;
-      for (iVar = 0; iVar < nVar; iVar++) Solution[iVar] = Restart_Data[index+iVar];
-      nodes->SetSolution(iPoint_Local,Solution);
-      iPoint_Global_Local++;
+    /*--- For dynamic meshes, read in and store the
+     grid coordinates and grid velocities for each node. ---*/
 
-      /*--- For dynamic meshes, read in and store the
-       grid coordinates and grid velocities for each node. ---*/
+    if (dynamic_grid && val_update_geo) {
 
-      if (dynamic_grid && val_update_geo) {
+      /*--- Read in the next 2 or 3 variables which are the grid velocities ---*/
+      /*--- If we are restarting the solution from a previously computed static calculation (no grid movement) ---*/
+      /*--- the grid velocities are set to 0. This is useful for FSI computations ---*/
 
-        /*--- Read in the next 2 or 3 variables which are the grid velocities ---*/
-        /*--- If we are restarting the solution from a previously computed static calculation (no grid movement) ---*/
-        /*--- the grid velocities are set to 0. This is useful for FSI computations ---*/
+      su2double GridVel[3] = {0.0,0.0,0.0};
+      if (!steady_restart) {
 
-        su2double GridVel[3] = {0.0,0.0,0.0};
-        if (!steady_restart) {
-
-          /*--- Rewind the index to retrieve the Coords. ---*/
-          index = counter*Restart_Vars[1];
-          for (iDim = 0; iDim < nDim; iDim++) { Coord[iDim] = Restart_Data[index+iDim]; }
+        /*--- Rewind the index to retrieve the Coords. ---*/
+        index = counter*Restart_Vars[1];
+        for (iDim = 0; iDim < nDim; iDim++) { Coord[iDim] = Restart_Data[index+iDim]; }
 
-          /*--- Move the index forward to get the grid velocities. ---*/
-          index = counter*Restart_Vars[1] + skipVars + nVar + turbVars;
-          for (iDim = 0; iDim < nDim; iDim++) { GridVel[iDim] = Restart_Data[index+iDim]; }
-        }
+        /*--- Move the index forward to get the grid velocities. ---*/
+        index = counter*Restart_Vars[1] + skipVars + nVar + turbVars;
+        for (iDim = 0; iDim < nDim; iDim++) { GridVel[iDim] = Restart_Data[index+iDim]; }
+      }
 
-        for (iDim = 0; iDim < nDim; iDim++) {
-          geometry[MESH_0]->node[iPoint_Local]->SetCoord(iDim, Coord[iDim]);
-          geometry[MESH_0]->node[iPoint_Local]->SetGridVel(iDim, GridVel[iDim]);
-        }
+      for (iDim = 0; iDim < nDim; iDim++) {
+        geometry[MESH_0]->node[iPoint_Local]->SetCoord(iDim, Coord[iDim]);
+        geometry[MESH_0]->node[iPoint_Local]->SetGridVel(iDim, GridVel[iDim]);
       }
+    }
 
-      if (static_fsi && val_update_geo) {
-       /*--- Rewind the index to retrieve the Coords. ---*/
-        index = counter*Restart_Vars[1];
-        for (iDim = 0; iDim < nDim; iDim++) { Coord[iDim] = Restart_Data[index+iDim];}
+    if (static_fsi && val_update_geo) {
+     /*--- Rewind the index to retrieve the Coords. ---*/
+      index = counter*Restart_Vars[1];
+      for (iDim = 0; iDim < nDim; iDim++) { Coord[iDim] = Restart_Data[index+iDim];}
 
-        for (iDim = 0; iDim < nDim; iDim++) {
-          geometry[MESH_0]->node[iPoint_Local]->SetCoord(iDim, Coord[iDim]);
-        }
+      for (iDim = 0; iDim < nDim; iDim++) {
+        geometry[MESH_0]->node[iPoint_Local]->SetCoord(iDim, Coord[iDim]);
       }
-
-      /*--- Increment the overall counter for how many points have been loaded. ---*/
-      counter++;
     }
 
+    /*--- Increment the overall counter for how many points have been loaded. ---*/
+    counter++;
+
   }
 
   /*--- Detect a wrong solution file ---*/
@@ -11765,96 +12332,60 @@ void CEulerSolver::SetFreeStream_TurboSolution(CConfig *config) {
 
 void CEulerSolver::PreprocessAverage(CSolver **solver, CGeometry *geometry, CConfig *config, unsigned short marker_flag) {
 
-  unsigned long iVertex, iPoint;
   unsigned short iDim, iMarker, iMarkerTP, iSpan;
-  su2double Pressure = 0.0, Density = 0.0, *Velocity = NULL, *TurboVelocity,
-      Area, TotalArea, TotalAreaPressure, TotalAreaDensity, *TotalAreaVelocity, *UnitNormal, *TurboNormal;
+  su2double TotalArea, TotalAreaPressure, TotalAreaDensity, TotalAreaVelocity[MAXNDIM] = {0.0};
   string Marker_Tag, Monitoring_Tag;
   unsigned short  iZone     = config->GetiZone();
   const su2double  *AverageTurboNormal;
-  su2double VelSq;
-
-  /*-- Variables declaration and allocation ---*/
-  Velocity           = new su2double[nDim];
-  UnitNormal         = new su2double[nDim];
-  TurboNormal        = new su2double[nDim];
-  TurboVelocity      = new su2double[nDim];
-  TotalAreaVelocity  = new su2double[nDim];
-
-
-  for (iSpan= 0; iSpan < nSpanWiseSections; iSpan++){
-
-    for (iDim=0; iDim<nDim; iDim++) {
-      TotalAreaVelocity[iDim] = 0.0;
-    }
 
-    TotalAreaPressure = 0.0;
-    TotalAreaDensity  = 0.0;
+  /*--- Markers of this kind (inflow or outflow), the turbo vertices are already grouped by span. ---*/
 
-    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++){
-      for (iMarkerTP=1; iMarkerTP < config->GetnMarker_Turbomachinery()+1; iMarkerTP++){
-        if (config->GetMarker_All_Turbomachinery(iMarker) == iMarkerTP){
-          if (config->GetMarker_All_TurbomachineryFlag(iMarker) == marker_flag){
+  vector<unsigned short> turboMarkers;
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
+    for (iMarkerTP=1; iMarkerTP < config->GetnMarker_Turbomachinery()+1; iMarkerTP++)
+      if (config->GetMarker_All_Turbomachinery(iMarker) == iMarkerTP &&
+          config->GetMarker_All_TurbomachineryFlag(iMarker) == marker_flag)
+        turboMarkers.push_back(iMarker);
 
-            /*--- Retrieve Old Solution ---*/
+  /*--- Area-weighted sums of density, pressure and velocity, one row per span, reduced in one call. ---*/
 
-            /*--- Loop over the vertices to sum all the quantities pithc-wise ---*/
-            for (iVertex = 0; iVertex < geometry->GetnVertexSpan(iMarker,iSpan); iVertex++) {
-              iPoint = geometry->turbovertex[iMarker][iSpan][iVertex]->GetNode();
-              if (geometry->node[iPoint]->GetDomain()){
-                /*--- Compute the integral fluxes for the boundaries ---*/
+  const unsigned short nSum = nDim+2;
+  vector<su2double> localSums(nSpanWiseSections*nSum, 0.0);
 
-                Pressure = nodes->GetPressure(iPoint);
-                Density = nodes->GetDensity(iPoint);
+  SU2_OMP_PARALLEL_(for schedule(dynamic,1))
+  for (unsigned short jSpan = 0; jSpan < nSpanWiseSections; jSpan++) {
 
-                /*--- Normal vector for this vertex (negate for outward convention) ---*/
-                geometry->turbovertex[iMarker][iSpan][iVertex]->GetNormal(UnitNormal);
-                geometry->turbovertex[iMarker][iSpan][iVertex]->GetTurboNormal(TurboNormal);
-                Area = geometry->turbovertex[iMarker][iSpan][iVertex]->GetArea();
+    su2double* sums = &localSums[jSpan*nSum];
 
-                VelSq = 0.0;
-                for (iDim = 0; iDim < nDim; iDim++) {
-                  Velocity[iDim] = nodes->GetVelocity(iPoint,iDim);
-                  VelSq += Velocity[iDim]*Velocity[iDim];
-                }
+    for (auto jMarker : turboMarkers) {
 
-                ComputeTurboVelocity(Velocity, TurboNormal , TurboVelocity, marker_flag, config->GetKind_TurboMachinery(iZone));
+      /*--- Loop over the vertices to sum all the quantities pitch-wise ---*/
+      for (unsigned long iVertex = 0; iVertex < geometry->GetnVertexSpan(jMarker,jSpan); iVertex++) {
+        const auto turboVertex = geometry->turbovertex[jMarker][jSpan][iVertex];
+        const auto iPoint = turboVertex->GetNode();
+        if (!geometry->node[iPoint]->GetDomain()) continue;
 
-                /*--- Compute different integral quantities for the boundary of interest ---*/
+        const su2double Area = turboVertex->GetArea();
 
-                TotalAreaPressure += Area*Pressure;
-                TotalAreaDensity  += Area*Density;
-                for (iDim = 0; iDim < nDim; iDim++)
-                  TotalAreaVelocity[iDim] += Area*Velocity[iDim];
-              }
-            }
-          }
-        }
+        sums[0] += Area*nodes->GetDensity(iPoint);
+        sums[1] += Area*nodes->GetPressure(iPoint);
+        for (unsigned short kDim = 0; kDim < nDim; kDim++)
+          sums[2+kDim] += Area*nodes->GetVelocity(iPoint,kDim);
       }
     }
+  }
 
+  /*--- Add information using all the nodes ---*/
 
-#ifdef HAVE_MPI
-
-    /*--- Add information using all the nodes ---*/
-
-    su2double MyTotalAreaDensity = TotalAreaDensity;
-    su2double MyTotalAreaPressure  = TotalAreaPressure;
-
-    SU2_MPI::Allreduce(&MyTotalAreaDensity, &TotalAreaDensity, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyTotalAreaPressure, &TotalAreaPressure, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-
-    su2double* MyTotalAreaVelocity = new su2double[nDim];
-
-    for (iDim = 0; iDim < nDim; iDim++) {
-      MyTotalAreaVelocity[iDim] = TotalAreaVelocity[iDim];
-    }
-
-    SU2_MPI::Allreduce(MyTotalAreaVelocity, TotalAreaVelocity, nDim, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  vector<su2double> spanSums(localSums.size());
+  SU2_MPI::Allreduce(localSums.data(), spanSums.data(), localSums.size(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
 
-    delete [] MyTotalAreaVelocity;
+  for (iSpan= 0; iSpan < nSpanWiseSections; iSpan++){
 
-#endif
+    TotalAreaDensity  = spanSums[iSpan*nSum];
+    TotalAreaPressure = spanSums[iSpan*nSum+1];
+    for (iDim = 0; iDim < nDim; iDim++)
+      TotalAreaVelocity[iDim] = spanSums[iSpan*nSum+2+iDim];
 
     /*--- initialize spanwise average quantities ---*/
 
@@ -11917,25 +12448,16 @@ void CEulerSolver::PreprocessAverage(CSolver **solver, CGeometry *geometry, CCon
     }
   }
 
-
-  /*--- Free locally allocated memory ---*/
-  delete [] Velocity;
-  delete [] UnitNormal;
-  delete [] TurboNormal;
-  delete [] TurboVelocity;
-  delete [] TotalAreaVelocity;
-
 }
 
 
 void CEulerSolver::TurboAverageProcess(CSolver **solver, CGeometry *geometry, CConfig *config, unsigned short marker_flag) {
 
-  unsigned long iVertex, iPoint, nVert;
-  unsigned short iDim, iVar, iMarker, iMarkerTP, iSpan, jSpan;
+  unsigned long nVert;
+  unsigned short iDim, iVar, iMarker, iMarkerTP, iSpan;
   unsigned short average_process = config->GetKind_AverageProcess();
   unsigned short performance_average_process = config->GetKind_PerformanceAverageProcess();
-  su2double Pressure = 0.0, Density = 0.0, Enthalpy = 0.0,  *Velocity = NULL, *TurboVelocity,
-      Area, TotalArea, Radius1, Radius2, Vt2, TotalAreaPressure, TotalAreaDensity, *TotalAreaVelocity, *UnitNormal, *TurboNormal,
+  su2double TotalArea, Radius1, Radius2, Vt2, TotalAreaPressure, TotalAreaDensity, *TotalAreaVelocity,
       TotalMassPressure, TotalMassDensity, *TotalMassVelocity;
   string Marker_Tag, Monitoring_Tag;
   su2double val_init_pressure;
@@ -11943,17 +12465,12 @@ void CEulerSolver::TurboAverageProcess(CSolver **solver, CGeometry *geometry, CC
   su2double TotalDensity, TotalPressure, *TotalVelocity, *TotalFluxes;
   const su2double *AverageTurboNormal;
   su2double TotalNu, TotalOmega, TotalKine, TotalMassNu, TotalMassOmega, TotalMassKine, TotalAreaNu, TotalAreaOmega, TotalAreaKine;
-  su2double Nu, Kine, Omega;
   su2double MachTest, soundSpeed;
   bool turbulent = (config->GetKind_Turb_Model() != NONE);
   bool spalart_allmaras = (config->GetKind_Turb_Model() == SA);
   bool menter_sst       = ((config->GetKind_Turb_Model() == SST) || (config->GetKind_Turb_Model() == SST_SUST));
 
   /*-- Variables declaration and allocation ---*/
-  Velocity            = new su2double[nDim];
-  UnitNormal          = new su2double[nDim];
-  TurboNormal         = new su2double[nDim];
-  TurboVelocity       = new su2double[nDim];
   TotalVelocity       = new su2double[nDim];
   TotalAreaVelocity   = new su2double[nDim];
   TotalMassVelocity   = new su2double[nDim];
@@ -11969,243 +12486,142 @@ void CEulerSolver::TurboAverageProcess(CSolver **solver, CGeometry *geometry, CC
   avgMixVelocity      = new su2double[nDim];
   avgMixTurboVelocity = new su2double[nDim];
 
+  /*--- Markers of this kind (inflow or outflow), the turbo vertices are already grouped by span. ---*/
+
+  vector<unsigned short> turboMarkers;
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
+    for (iMarkerTP=1; iMarkerTP < config->GetnMarker_Turbomachinery()+1; iMarkerTP++)
+      if (config->GetMarker_All_Turbomachinery(iMarker) == iMarkerTP &&
+          config->GetMarker_All_TurbomachineryFlag(iMarker) == marker_flag)
+        turboMarkers.push_back(iMarker);
+
+  /*--- Pitch-wise sums of all the quantities, packed as one row per span plus a last row for
+   *    the whole boundary, such that everything is reduced in one call. The spans are
+   *    independent and are summed by different threads. ---*/
+
+  enum : unsigned short {SUM_DENSITY, SUM_PRESSURE, SUM_AREA_DENSITY, SUM_AREA_PRESSURE, SUM_MASS_DENSITY,
+                         SUM_MASS_PRESSURE, SUM_NU, SUM_KINE, SUM_OMEGA, SUM_AREA_NU, SUM_AREA_KINE, SUM_AREA_OMEGA,
+                         SUM_MASS_NU, SUM_MASS_KINE, SUM_MASS_OMEGA, SUM_VELOCITY};
+  const unsigned short SUM_AREA_VELOCITY = SUM_VELOCITY + nDim;
+  const unsigned short SUM_MASS_VELOCITY = SUM_AREA_VELOCITY + nDim;
+  const unsigned short SUM_FLUXES = SUM_MASS_VELOCITY + nDim;
+  const unsigned short nSum = SUM_FLUXES + nVar;
+
+  vector<su2double> localSums((nSpanWiseSections+1)*nSum, 0.0);
+
+  SU2_OMP_PARALLEL_(for schedule(dynamic,1))
+  for (unsigned short jSpan = 0; jSpan < nSpanWiseSections; jSpan++) {
+
+    su2double* sums = &localSums[jSpan*nSum];
+    su2double Velocity[MAXNDIM] = {0.0}, UnitNormal[MAXNDIM] = {0.0};
+    su2double TurboNormal[MAXNDIM] = {0.0}, TurboVelocity[MAXNDIM] = {0.0};
+
+    for (auto jMarker : turboMarkers) {
+      for (unsigned long iVertex = 0; iVertex < geometry->GetnVertexSpan(jMarker,jSpan); iVertex++) {
+        const auto turboVertex = geometry->turbovertex[jMarker][jSpan][iVertex];
+        const auto iPoint = turboVertex->GetNode();
+
+        /*--- Compute the integral fluxes for the boundaries ---*/
+        const su2double Pressure = nodes->GetPressure(iPoint);
+        const su2double Density  = nodes->GetDensity(iPoint);
+        const su2double Enthalpy = nodes->GetEnthalpy(iPoint);
+
+        /*--- Normal vector for this vertex (negate for outward convention) ---*/
+        turboVertex->GetNormal(UnitNormal);
+        turboVertex->GetTurboNormal(TurboNormal);
+        const su2double Area = turboVertex->GetArea();
+
+        for (unsigned short kDim = 0; kDim < nDim; kDim++)
+          Velocity[kDim] = nodes->GetVelocity(iPoint,kDim);
+
+        ComputeTurboVelocity(Velocity, TurboNormal , TurboVelocity, marker_flag, config->GetKind_TurboMachinery(iZone));
+
+        const su2double MassFlux = Area*(Density*TurboVelocity[0]);
+
+        /*--- Compute different integral quantities for the boundary of interest ---*/
+
+        sums[SUM_DENSITY]       += Density;
+        sums[SUM_PRESSURE]      += Pressure;
+        sums[SUM_AREA_DENSITY]  += Area*Density;
+        sums[SUM_AREA_PRESSURE] += Area*Pressure;
+        sums[SUM_MASS_DENSITY]  += MassFlux*Density;
+        sums[SUM_MASS_PRESSURE] += MassFlux*Pressure;
+        for (unsigned short kDim = 0; kDim < nDim; kDim++) {
+          sums[SUM_VELOCITY+kDim]      += Velocity[kDim];
+          sums[SUM_AREA_VELOCITY+kDim] += Area*Velocity[kDim];
+          sums[SUM_MASS_VELOCITY+kDim] += MassFlux*Velocity[kDim];
+        }
 
-  for (iSpan= 0; iSpan < nSpanWiseSections + 1; iSpan++){
-
-    /*--- Forces initialization for contenitors ---*/
-    for (iVar=0;iVar<nVar;iVar++)
-      TotalFluxes[iVar]= 0.0;
-    for (iDim=0; iDim<nDim; iDim++) {
-      TotalVelocity[iDim]     = 0.0;
-      TotalAreaVelocity[iDim] = 0.0;
-      TotalMassVelocity[iDim] = 0.0;
-    }
-
-    TotalDensity      = 0.0;
-    TotalPressure     = 0.0;
-    TotalAreaPressure = 0.0;
-    TotalAreaDensity  = 0.0;
-    TotalMassPressure = 0.0;
-    TotalMassDensity  = 0.0;
-    TotalNu           = 0.0;
-    TotalOmega        = 0.0;
-    TotalKine         = 0.0;
-    TotalMassNu       = 0.0;
-    TotalMassOmega    = 0.0;
-    TotalMassKine     = 0.0;
-    TotalAreaNu       = 0.0;
-    TotalAreaOmega    = 0.0;
-    TotalAreaKine     = 0.0;
-
-    Nu    = 0.0;
-    Omega = 0.0;
-    Kine  = 0.0;
-
-    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++){
-      for (iMarkerTP=1; iMarkerTP < config->GetnMarker_Turbomachinery()+1; iMarkerTP++){
-        if (config->GetMarker_All_Turbomachinery(iMarker) == iMarkerTP){
-          if (config->GetMarker_All_TurbomachineryFlag(iMarker) == marker_flag){
-
-            /*--- Retrieve Old Solution ---*/
-
-            /*--- Loop over the vertices to sum all the quantities pithc-wise ---*/
-            if(iSpan < nSpanWiseSections){
-              for (iVertex = 0; iVertex < geometry->GetnVertexSpan(iMarker,iSpan); iVertex++) {
-                iPoint = geometry->turbovertex[iMarker][iSpan][iVertex]->GetNode();
-
-                /*--- Compute the integral fluxes for the boundaries ---*/
-                Pressure = nodes->GetPressure(iPoint);
-                Density  = nodes->GetDensity(iPoint);
-                Enthalpy = nodes->GetEnthalpy(iPoint);
-
-                /*--- Normal vector for this vertex (negate for outward convention) ---*/
-                geometry->turbovertex[iMarker][iSpan][iVertex]->GetNormal(UnitNormal);
-                geometry->turbovertex[iMarker][iSpan][iVertex]->GetTurboNormal(TurboNormal);
-                Area = geometry->turbovertex[iMarker][iSpan][iVertex]->GetArea();
-                su2double VelNormal = 0.0, VelSq = 0.0;
-
-                for (iDim = 0; iDim < nDim; iDim++) {
-                  Velocity[iDim] = nodes->GetVelocity(iPoint,iDim);
-                  VelNormal += UnitNormal[iDim]*Velocity[iDim];
-                  VelSq += Velocity[iDim]*Velocity[iDim];
-                }
-
-                ComputeTurboVelocity(Velocity, TurboNormal , TurboVelocity, marker_flag, config->GetKind_TurboMachinery(iZone));
-
-                /*--- Compute different integral quantities for the boundary of interest ---*/
-
-                TotalDensity          += Density;
-                TotalPressure         += Pressure;
-                for (iDim = 0; iDim < nDim; iDim++)
-                  TotalVelocity[iDim] += Velocity[iDim];
-
-                TotalAreaPressure         += Area*Pressure;
-                TotalAreaDensity          += Area*Density;
-                for (iDim = 0; iDim < nDim; iDim++)
-                  TotalAreaVelocity[iDim] += Area*Velocity[iDim];
-
-                TotalMassPressure         += Area*(Density*TurboVelocity[0] )*Pressure;
-                TotalMassDensity          += Area*(Density*TurboVelocity[0] )*Density;
-                for (iDim = 0; iDim < nDim; iDim++)
-                  TotalMassVelocity[iDim] += Area*(Density*TurboVelocity[0] )*Velocity[iDim];
-
-                TotalFluxes[0]      += Area*(Density*TurboVelocity[0]);
-                TotalFluxes[1]      += Area*(Density*TurboVelocity[0]*TurboVelocity[0] + Pressure);
-                for (iDim = 2; iDim < nDim+1; iDim++)
-                  TotalFluxes[iDim] += Area*(Density*TurboVelocity[0]*TurboVelocity[iDim -1]);
-                TotalFluxes[nDim+1] += Area*(Density*TurboVelocity[0]*Enthalpy);
-
-
-                /*--- Compute turbulent integral quantities for the boundary of interest ---*/
-
-                if(turbulent){
-                  if(menter_sst){
-                    Kine = solver[TURB_SOL]->GetNodes()->GetSolution(iPoint,0);
-                    Omega = solver[TURB_SOL]->GetNodes()->GetSolution(iPoint,1);
-                  }
-                  if(spalart_allmaras){
-                    Nu = solver[TURB_SOL]->GetNodes()->GetSolution(iPoint,0);
-                  }
-
-                  TotalKine   += Kine;
-                  TotalOmega  += Omega;
-                  TotalNu     += Nu;
-
-                  TotalAreaKine    += Area*Kine;
-                  TotalAreaOmega   += Area*Omega;
-                  TotalAreaNu      += Area*Nu;
-
-                  TotalMassKine    += Area*(Density*TurboVelocity[0] )*Kine;
-                  TotalMassOmega   += Area*(Density*TurboVelocity[0] )*Omega;
-                  TotalMassNu      += Area*(Density*TurboVelocity[0] )*Nu;
+        sums[SUM_FLUXES]   += MassFlux;
+        sums[SUM_FLUXES+1] += MassFlux*TurboVelocity[0] + Area*Pressure;
+        for (unsigned short kDim = 2; kDim < nDim+1; kDim++)
+          sums[SUM_FLUXES+kDim] += MassFlux*TurboVelocity[kDim-1];
+        sums[SUM_FLUXES+nDim+1] += MassFlux*Enthalpy;
 
+        /*--- Compute turbulent integral quantities for the boundary of interest ---*/
 
-                }
-              }
-            }
-            else{
-              for (jSpan= 0; jSpan < nSpanWiseSections; jSpan++){
-                for (iVertex = 0; iVertex < geometry->GetnVertexSpan(iMarker,jSpan); iVertex++) {
-                  iPoint = geometry->turbovertex[iMarker][jSpan][iVertex]->GetNode();
-
-                  /*--- Compute the integral fluxes for the boundaries ---*/
-                  Pressure = nodes->GetPressure(iPoint);
-                  Density  = nodes->GetDensity(iPoint);
-                  Enthalpy = nodes->GetEnthalpy(iPoint);
-
-                  /*--- Normal vector for this vertex (negate for outward convention) ---*/
-                  geometry->turbovertex[iMarker][jSpan][iVertex]->GetNormal(UnitNormal);
-                  geometry->turbovertex[iMarker][jSpan][iVertex]->GetTurboNormal(TurboNormal);
-                  Area = geometry->turbovertex[iMarker][jSpan][iVertex]->GetArea();
-                  su2double VelNormal = 0.0, VelSq = 0.0;
-
-                  for (iDim = 0; iDim < nDim; iDim++) {
-                    Velocity[iDim] = nodes->GetVelocity(iPoint,iDim);
-                    VelNormal += UnitNormal[iDim]*Velocity[iDim];
-                    VelSq += Velocity[iDim]*Velocity[iDim];
-                  }
-
-                  ComputeTurboVelocity(Velocity, TurboNormal , TurboVelocity, marker_flag, config->GetKind_TurboMachinery(iZone));
-
-                  /*--- Compute different integral quantities for the boundary of interest ---*/
-
-                  TotalDensity          += Density;
-                  TotalPressure         += Pressure;
-                  for (iDim = 0; iDim < nDim; iDim++)
-                    TotalVelocity[iDim] += Velocity[iDim];
-
-                  TotalAreaPressure         += Area*Pressure;
-                  TotalAreaDensity          += Area*Density;
-                  for (iDim = 0; iDim < nDim; iDim++)
-                    TotalAreaVelocity[iDim] += Area*Velocity[iDim];
-
-                  TotalMassPressure         += Area*(Density*TurboVelocity[0] )*Pressure;
-                  TotalMassDensity          += Area*(Density*TurboVelocity[0] )*Density;
-                  for (iDim = 0; iDim < nDim; iDim++)
-                    TotalMassVelocity[iDim] += Area*(Density*TurboVelocity[0] )*Velocity[iDim];
-
-                  TotalFluxes[0]      += Area*(Density*TurboVelocity[0]);
-                  TotalFluxes[1]      += Area*(Density*TurboVelocity[0]*TurboVelocity[0] + Pressure);
-                  for (iDim = 2; iDim < nDim+1; iDim++)
-                    TotalFluxes[iDim] += Area*(Density*TurboVelocity[0]*TurboVelocity[iDim -1]);
-                  TotalFluxes[nDim+1] += Area*(Density*TurboVelocity[0]*Enthalpy);
-
-
-                  /*--- Compute turbulent integral quantities for the boundary of interest ---*/
-
-                  if(turbulent){
-                    if(menter_sst){
-                      Kine  = solver[TURB_SOL]->GetNodes()->GetSolution(iPoint,0);
-                      Omega = solver[TURB_SOL]->GetNodes()->GetSolution(iPoint,1);
-                    }
-                    if(spalart_allmaras){
-                      Nu    = solver[TURB_SOL]->GetNodes()->GetSolution(iPoint,0);
-                    }
-
-                    TotalKine   += Kine;
-                    TotalOmega  += Omega;
-                    TotalNu     += Nu;
-
-                    TotalAreaKine   += Area*Kine;
-                    TotalAreaOmega  += Area*Omega;
-                    TotalAreaNu     += Area*Nu;
-
-                    TotalMassKine    += Area*(Density*TurboVelocity[0] )*Kine;
-                    TotalMassOmega   += Area*(Density*TurboVelocity[0] )*Omega;
-                    TotalMassNu      += Area*(Density*TurboVelocity[0] )*Nu;
-
-                  }
-                }
-              }
-            }
+        if(turbulent){
+          su2double Nu = 0.0, Kine = 0.0, Omega = 0.0;
+          if(menter_sst){
+            Kine  = solver[TURB_SOL]->GetNodes()->GetSolution(iPoint,0);
+            Omega = solver[TURB_SOL]->GetNodes()->GetSolution(iPoint,1);
           }
+          if(spalart_allmaras){
+            Nu    = solver[TURB_SOL]->GetNodes()->GetSolution(iPoint,0);
+          }
+
+          sums[SUM_KINE]       += Kine;
+          sums[SUM_OMEGA]      += Omega;
+          sums[SUM_NU]         += Nu;
+          sums[SUM_AREA_KINE]  += Area*Kine;
+          sums[SUM_AREA_OMEGA] += Area*Omega;
+          sums[SUM_AREA_NU]    += Area*Nu;
+          sums[SUM_MASS_KINE]  += MassFlux*Kine;
+          sums[SUM_MASS_OMEGA] += MassFlux*Omega;
+          sums[SUM_MASS_NU]    += MassFlux*Nu;
         }
       }
     }
+  }
 
-#ifdef HAVE_MPI
-
-    /*--- Add information using all the nodes ---*/
+  /*--- The 1D (whole boundary) row is the sum of the span rows. ---*/
+  for (iSpan = 0; iSpan < nSpanWiseSections; iSpan++)
+    for (unsigned short iSum = 0; iSum < nSum; iSum++)
+      localSums[nSpanWiseSections*nSum+iSum] += localSums[iSpan*nSum+iSum];
 
-    auto Allreduce = [](su2double x) {
-      su2double tmp = x; x = 0.0;
-      SU2_MPI::Allreduce(&tmp, &x, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-      return x;
-    };
+  /*--- Add information using all the nodes ---*/
 
-    TotalDensity = Allreduce(TotalDensity);
-    TotalPressure = Allreduce(TotalPressure);
-    TotalAreaDensity = Allreduce(TotalAreaDensity);
-    TotalAreaPressure = Allreduce(TotalAreaPressure);
-    TotalMassDensity = Allreduce(TotalMassDensity);
-    TotalMassPressure = Allreduce(TotalMassPressure);
-
-    TotalNu = Allreduce(TotalNu);
-    TotalKine = Allreduce(TotalKine);
-    TotalOmega = Allreduce(TotalOmega);
-    TotalAreaNu = Allreduce(TotalAreaNu);
-    TotalAreaKine = Allreduce(TotalAreaKine);
-    TotalAreaOmega = Allreduce(TotalAreaOmega);
-
-    TotalMassNu = Allreduce(TotalMassNu);
-    TotalMassKine = Allreduce(TotalMassKine);
-    TotalMassOmega = Allreduce(TotalMassOmega);
-
-    su2double* buffer = new su2double[max(nVar,nDim)];
-
-    auto Allreduce_inplace = [buffer](int size, su2double* x) {
-      SU2_MPI::Allreduce(x, buffer, size, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-      for(int i=0; i<size; ++i) x[i] = buffer[i];
-    };
+  vector<su2double> spanSums(localSums.size());
+  SU2_MPI::Allreduce(localSums.data(), spanSums.data(), localSums.size(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
 
-    Allreduce_inplace(nVar, TotalFluxes);
-    Allreduce_inplace(nDim, TotalVelocity);
-    Allreduce_inplace(nDim, TotalAreaVelocity);
-    Allreduce_inplace(nDim, TotalMassVelocity);
+  for (iSpan= 0; iSpan < nSpanWiseSections + 1; iSpan++){
 
-    delete [] buffer;
+    const su2double* sums = &spanSums[iSpan*nSum];
+
+    TotalDensity      = sums[SUM_DENSITY];
+    TotalPressure     = sums[SUM_PRESSURE];
+    TotalAreaDensity  = sums[SUM_AREA_DENSITY];
+    TotalAreaPressure = sums[SUM_AREA_PRESSURE];
+    TotalMassDensity  = sums[SUM_MASS_DENSITY];
+    TotalMassPressure = sums[SUM_MASS_PRESSURE];
+
+    TotalNu           = sums[SUM_NU];
+    TotalKine         = sums[SUM_KINE];
+    TotalOmega        = sums[SUM_OMEGA];
+    TotalAreaNu       = sums[SUM_AREA_NU];
+    TotalAreaKine     = sums[SUM_AREA_KINE];
+    TotalAreaOmega    = sums[SUM_AREA_OMEGA];
+    TotalMassNu       = sums[SUM_MASS_NU];
+    TotalMassKine     = sums[SUM_MASS_KINE];
+    TotalMassOmega    = sums[SUM_MASS_OMEGA];
 
-#endif
+    for (iDim = 0; iDim < nDim; iDim++) {
+      TotalVelocity[iDim]     = sums[SUM_VELOCITY+iDim];
+      TotalAreaVelocity[iDim] = sums[SUM_AREA_VELOCITY+iDim];
+      TotalMassVelocity[iDim] = sums[SUM_MASS_VELOCITY+iDim];
+    }
+    for (iVar = 0; iVar < nVar; iVar++)
+      TotalFluxes[iVar] = sums[SUM_FLUXES+iVar];
 
     for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++){
       for (iMarkerTP=1; iMarkerTP < config->GetnMarker_Turbomachinery()+1; iMarkerTP++){
@@ -12503,10 +12919,6 @@ void CEulerSolver::TurboAverageProcess(CSolver **solver, CGeometry *geometry, CC
   }
 
   /*--- Free locally allocated memory ---*/
-  delete [] Velocity;
-  delete [] UnitNormal;
-  delete [] TurboNormal;
-  delete [] TurboVelocity;
   delete [] TotalVelocity;
   delete [] TotalAreaVelocity;
   delete [] TotalFluxes;
@@ -12577,180 +12989,100 @@ void CEulerSolver::GatherInOutAverageValues(CConfig *config, CGeometry *geometry
 
   unsigned short iMarker, iMarkerTP;
   unsigned short iSpan;
-  int markerTP;
-  su2double     densityIn, pressureIn, normalVelocityIn, tangVelocityIn, radialVelocityIn;
-  su2double     densityOut, pressureOut, normalVelocityOut, tangVelocityOut, radialVelocityOut;
-  su2double     kineIn, omegaIn, nuIn, kineOut, omegaOut, nuOut;
+  int iRank, markerTP = -1;
   //TODO (turbo) implement interpolation so that Inflow and Outflow spanwise section can be different
 
-  for (iSpan= 0; iSpan < nSpanWiseSections + 1 ; iSpan++) {
-
-#ifdef HAVE_MPI
-    unsigned short i, n1, n2, n1t,n2t;
-    su2double *TurbPerfIn= NULL,*TurbPerfOut= NULL;
-    su2double *TotTurbPerfIn = NULL,*TotTurbPerfOut = NULL;
-    int *TotMarkerTP = NULL;
-
-    n1          = 8;
-    n2          = 8;
-    n1t         = n1*size;
-    n2t         = n2*size;
-    TurbPerfIn  = new su2double[n1];
-    TurbPerfOut = new su2double[n2];
-
-    for (i=0;i<n1;i++)
-      TurbPerfIn[i]    = -1.0;
-    for (i=0;i<n2;i++)
-      TurbPerfOut[i]   = -1.0;
-#endif
-
-    densityIn            = -1.0;
-    pressureIn           = -1.0;
-    normalVelocityIn     = -1.0;
-    tangVelocityIn       = -1.0;
-    radialVelocityIn     = -1.0;
-    densityOut           = -1.0;
-    pressureOut          = -1.0;
-    normalVelocityOut    = -1.0;
-    tangVelocityOut      = -1.0;
-    radialVelocityOut    = -1.0;
-    kineIn               = -1.0;
-    omegaIn              = -1.0;
-    nuIn                 = -1.0;
-    kineOut              = -1.0;
-    omegaOut             = -1.0;
-    nuOut                = -1.0;
-
-    markerTP             = -1;
-
-    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++){
-      for (iMarkerTP = 1; iMarkerTP < config->GetnMarker_Turbomachinery()+1; iMarkerTP++){
-        if (config->GetMarker_All_Turbomachinery(iMarker) == iMarkerTP){
-          if (config->GetMarker_All_TurbomachineryFlag(iMarker) == INFLOW){
-            markerTP            = iMarkerTP;
-            densityIn           = DensityIn[iMarkerTP -1][iSpan];
-            pressureIn          = PressureIn[iMarkerTP -1][iSpan];
-            normalVelocityIn    = TurboVelocityIn[iMarkerTP -1][iSpan][0];
-            tangVelocityIn      = TurboVelocityIn[iMarkerTP -1][iSpan][1];
-            if (nDim ==3){
-              radialVelocityIn  = TurboVelocityIn[iMarkerTP -1][iSpan][2];
-            }
-            kineIn              = KineIn[iMarkerTP -1][iSpan];
-            omegaIn             = OmegaIn[iMarkerTP -1][iSpan];
-            nuIn                = NuIn[iMarkerTP -1][iSpan];
-
-#ifdef HAVE_MPI
-            TurbPerfIn[0]  = densityIn;
-            TurbPerfIn[1]  = pressureIn;
-            TurbPerfIn[2]  = normalVelocityIn;
-            TurbPerfIn[3]  = tangVelocityIn;
-            TurbPerfIn[4]  = radialVelocityIn;
-            TurbPerfIn[5]  = kineIn;
-            TurbPerfIn[6]  = omegaIn;
-            TurbPerfIn[7]  = nuIn;
-#endif
-          }
+  /*--- Inflow and outflow performance values of all spans, packed as (density, pressure, normal, tangential
+   *    and radial velocity, kine, omega, nu) to be gathered in one call, inflow spans first. A negative
+   *    density marks a rank without the marker. ---*/
+
+  constexpr unsigned short nPerf = 8;
+  const unsigned short nSpan = nSpanWiseSections + 1;
+  vector<su2double> TurbPerf(2*nSpan*nPerf, -1.0);
+
+  auto PackPerf = [&](su2double *perf, const su2double *density, const su2double *pressure,
+                      su2double **turboVelocity, const su2double *kine, const su2double *omega, const su2double *nu) {
+    for (iSpan = 0; iSpan < nSpan; iSpan++) {
+      perf[iSpan*nPerf]   = density[iSpan];
+      perf[iSpan*nPerf+1] = pressure[iSpan];
+      perf[iSpan*nPerf+2] = turboVelocity[iSpan][0];
+      perf[iSpan*nPerf+3] = turboVelocity[iSpan][1];
+      if (nDim == 3)
+        perf[iSpan*nPerf+4] = turboVelocity[iSpan][2];
+      perf[iSpan*nPerf+5] = kine[iSpan];
+      perf[iSpan*nPerf+6] = omega[iSpan];
+      perf[iSpan*nPerf+7] = nu[iSpan];
+    }
+  };
 
-          /*--- retrieve outlet information ---*/
-          if (config->GetMarker_All_TurbomachineryFlag(iMarker) == OUTFLOW){
-            densityOut           = DensityOut[iMarkerTP -1][iSpan];
-            pressureOut          = PressureOut[iMarkerTP -1][iSpan];
-            normalVelocityOut    = TurboVelocityOut[iMarkerTP -1][iSpan][0];
-            tangVelocityOut      = TurboVelocityOut[iMarkerTP -1][iSpan][1];
-            if (nDim ==3){
-              radialVelocityOut  = TurboVelocityOut[iMarkerTP -1][iSpan][2];
-            }
-            kineOut              = KineOut[iMarkerTP -1][iSpan];
-            omegaOut             = OmegaOut[iMarkerTP -1][iSpan];
-            nuOut                = NuOut[iMarkerTP -1][iSpan];
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++){
+    for (iMarkerTP = 1; iMarkerTP < config->GetnMarker_Turbomachinery()+1; iMarkerTP++){
+      if (config->GetMarker_All_Turbomachinery(iMarker) == iMarkerTP){
+        if (config->GetMarker_All_TurbomachineryFlag(iMarker) == INFLOW){
+          markerTP = iMarkerTP;
+          PackPerf(TurbPerf.data(), DensityIn[iMarkerTP -1], PressureIn[iMarkerTP -1], TurboVelocityIn[iMarkerTP -1],
+                   KineIn[iMarkerTP -1], OmegaIn[iMarkerTP -1], NuIn[iMarkerTP -1]);
+        }
 
-#ifdef HAVE_MPI
-            TurbPerfOut[0]  = densityOut;
-            TurbPerfOut[1]  = pressureOut;
-            TurbPerfOut[2]  = normalVelocityOut;
-            TurbPerfOut[3]  = tangVelocityOut;
-            TurbPerfOut[4]  = radialVelocityOut;
-            TurbPerfOut[5]  = kineOut;
-            TurbPerfOut[6]  = omegaOut;
-            TurbPerfOut[7]  = nuOut;
-#endif
-          }
+        /*--- retrieve outlet information ---*/
+        if (config->GetMarker_All_TurbomachineryFlag(iMarker) == OUTFLOW){
+          PackPerf(&TurbPerf[nSpan*nPerf], DensityOut[iMarkerTP -1], PressureOut[iMarkerTP -1], TurboVelocityOut[iMarkerTP -1],
+                   KineOut[iMarkerTP -1], OmegaOut[iMarkerTP -1], NuOut[iMarkerTP -1]);
         }
       }
     }
+  }
 
-#ifdef HAVE_MPI
-    if (rank == MASTER_NODE){
-      TotTurbPerfIn       = new su2double[n1t];
-      TotTurbPerfOut      = new su2double[n2t];
-      for (i=0;i<n1t;i++)
-        TotTurbPerfIn[i]  = -1.0;
-      for (i=0;i<n2t;i++)
-        TotTurbPerfOut[i] = -1.0;
-      TotMarkerTP = new int[size];
-      for(i=0; i<size; i++){
-        TotMarkerTP[i]    = -1;
-      }
-    }
-    SU2_MPI::Gather(TurbPerfIn, n1, MPI_DOUBLE, TotTurbPerfIn, n1, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Gather(TurbPerfOut, n2, MPI_DOUBLE,TotTurbPerfOut, n2, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Gather(&markerTP, 1, MPI_INT,TotMarkerTP, 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
-    if (rank == MASTER_NODE){
-      delete [] TurbPerfIn, delete [] TurbPerfOut;
-    }
-
-    if (rank == MASTER_NODE){
-      for (i=0;i<size;i++){
-        if(TotTurbPerfIn[n1*i] > 0.0){
-          densityIn        = TotTurbPerfIn[n1*i];
-          pressureIn       = TotTurbPerfIn[n1*i+1];
-          normalVelocityIn = TotTurbPerfIn[n1*i+2];
-          tangVelocityIn   = TotTurbPerfIn[n1*i+3];
-          radialVelocityIn = TotTurbPerfIn[n1*i+4];
-          kineIn           = TotTurbPerfIn[n1*i+5];
-          omegaIn          = TotTurbPerfIn[n1*i+6];
-          nuIn             = TotTurbPerfIn[n1*i+7];
-          markerTP         = TotMarkerTP[i];
-        }
+  const int nTurbPerf = TurbPerf.size();
+  vector<su2double> TotTurbPerf;
+  vector<int> TotMarkerTP;
+  if (rank == MASTER_NODE) {
+    TotTurbPerf.resize(size*nTurbPerf);
+    TotMarkerTP.resize(size);
+  }
+  SU2_MPI::Gather(TurbPerf.data(), nTurbPerf, MPI_DOUBLE, TotTurbPerf.data(), nTurbPerf, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Gather(&markerTP, 1, MPI_INT, TotMarkerTP.data(), 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
 
-        if(TotTurbPerfOut[n2*i] > 0.0){
-          densityOut        = TotTurbPerfOut[n1*i];
-          pressureOut       = TotTurbPerfOut[n1*i+1];
-          normalVelocityOut = TotTurbPerfOut[n1*i+2];
-          tangVelocityOut   = TotTurbPerfOut[n1*i+3];
-          radialVelocityOut = TotTurbPerfOut[n1*i+4];
-          kineOut           = TotTurbPerfOut[n1*i+5];
-          omegaOut          = TotTurbPerfOut[n1*i+6];
-          nuOut             = TotTurbPerfOut[n1*i+7];
-        }
-      }
+  if (rank != MASTER_NODE) return;
 
-      delete [] TotTurbPerfIn, delete [] TotTurbPerfOut; delete [] TotMarkerTP;
-    }
+  for (iSpan = 0; iSpan < nSpan; iSpan++) {
 
-#endif
+    /*--- Take the values of the ranks that own the inflow and outflow markers. ---*/
+    const su2double *perfIn = &TurbPerf[iSpan*nPerf];
+    const su2double *perfOut = &TurbPerf[(nSpan+iSpan)*nPerf];
+    int spanMarkerTP = markerTP;
+
+    for (iRank = 0; iRank < size; iRank++) {
+      const su2double *rankPerf = &TotTurbPerf[iRank*nTurbPerf];
+      if (rankPerf[iSpan*nPerf] > 0.0) {
+        perfIn = &rankPerf[iSpan*nPerf];
+        spanMarkerTP = TotMarkerTP[iRank];
+      }
+      if (rankPerf[(nSpan+iSpan)*nPerf] > 0.0)
+        perfOut = &rankPerf[(nSpan+iSpan)*nPerf];
+    }
 
-    if (rank == MASTER_NODE && markerTP > -1){
+    if (spanMarkerTP > -1){
       /*----Quantities needed for computing the turbomachinery performance -----*/
-      DensityIn[markerTP -1][iSpan]              = densityIn;
-      PressureIn[markerTP -1][iSpan]             = pressureIn;
-      TurboVelocityIn[markerTP -1][iSpan][0]     = normalVelocityIn;
-      TurboVelocityIn[markerTP -1][iSpan][1]     = tangVelocityIn;
+      DensityIn[spanMarkerTP -1][iSpan]              = perfIn[0];
+      PressureIn[spanMarkerTP -1][iSpan]             = perfIn[1];
+      TurboVelocityIn[spanMarkerTP -1][iSpan][0]     = perfIn[2];
+      TurboVelocityIn[spanMarkerTP -1][iSpan][1]     = perfIn[3];
       if (nDim == 3)
-        TurboVelocityIn[markerTP -1][iSpan][2]   = radialVelocityIn;
-      KineIn[markerTP -1][iSpan]                 = kineIn;
-      OmegaIn[markerTP -1][iSpan]                = omegaIn;
-      NuIn[markerTP -1][iSpan]                   = nuIn;
-
-      DensityOut[markerTP -1][iSpan]             = densityOut;
-      PressureOut[markerTP -1][iSpan]            = pressureOut;
-      TurboVelocityOut[markerTP -1][iSpan][0]    = normalVelocityOut;
-      TurboVelocityOut[markerTP -1][iSpan][1]    = tangVelocityOut;
+        TurboVelocityIn[spanMarkerTP -1][iSpan][2]   = perfIn[4];
+      KineIn[spanMarkerTP -1][iSpan]                 = perfIn[5];
+      OmegaIn[spanMarkerTP -1][iSpan]                = perfIn[6];
+      NuIn[spanMarkerTP -1][iSpan]                   = perfIn[7];
+
+      DensityOut[spanMarkerTP -1][iSpan]             = perfOut[0];
+      PressureOut[spanMarkerTP -1][iSpan]            = perfOut[1];
+      TurboVelocityOut[spanMarkerTP -1][iSpan][0]    = perfOut[2];
+      TurboVelocityOut[spanMarkerTP -1][iSpan][1]    = perfOut[3];
       if (nDim == 3)
-        TurboVelocityOut[markerTP -1][iSpan][2]  = radialVelocityOut;
-      KineOut[markerTP -1][iSpan]                = kineOut;
-      OmegaOut[markerTP -1][iSpan]               = omegaOut;
-      NuOut[markerTP -1][iSpan]                  = nuOut;
+        TurboVelocityOut[spanMarkerTP -1][iSpan][2]  = perfOut[4];
+      KineOut[spanMarkerTP -1][iSpan]                = perfOut[5];
+      OmegaOut[spanMarkerTP -1][iSpan]               = perfOut[6];
+      NuOut[spanMarkerTP -1][iSpan]                  = perfOut[7];
     }
   }
 }
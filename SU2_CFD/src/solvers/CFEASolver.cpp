@@ -224,6 +224,13 @@ CFEASolver::CFEASolver(CGeometry *geometry, CConfig *config) : CSolver() {
   /*--- Initialization of matrix structures ---*/
   if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (Non-Linear Elasticity)." << endl;
 
+  /*--- Matrix-free products, only the diagonal blocks are needed (for the preconditioner). ---*/
+  matrix_free = config->GetFEA_MatrixFree();
+  if (matrix_free) {
+    Jacobian.SetDiagonalOnly();
+    DirichletNode.resize(nPoint, false);
+  }
+
   Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
 
   if (dynamic) {
@@ -851,6 +858,13 @@ void CFEASolver::Compute_StiffMatrix(CGeometry *geometry, CNumerics **numerics,
   const su2double simp_exponent = config->GetSIMP_Exponent();
   const su2double simp_minstiff = config->GetSIMP_MinStiffness();
 
+  /*--- Keep what is needed to recompute the tangents for matrix-free products. ---*/
+  tangent_numerics = numerics;
+  tangent_nonlinear = false;
+  if (matrix_free) DirichletNode.assign(nPoint, false);
+
+  if (config->GetFEA_GradientCache() && GradCachePos.empty()) InitializeGradCache(geometry);
+
   /*--- Start OpenMP parallel region. ---*/
 
   SU2_OMP_PARALLEL
@@ -903,6 +917,7 @@ void CFEASolver::Compute_StiffMatrix(CGeometry *geometry, CNumerics **numerics,
 
         /*--- Set the properties of the element ---*/
         element->Set_ElProperties(element_properties[iElem]);
+        SetElementGradCache(element, EL_KIND, iElem, true);
 
         /*--- Compute the components of the jacobian and the stress term, one numerics per thread. ---*/
         int NUM_TERM = thread*MAX_TERMS + element_properties[iElem]->GetMat_Mod();
@@ -932,6 +947,9 @@ void CFEASolver::Compute_StiffMatrix(CGeometry *geometry, CNumerics **numerics,
 
   } // end SU2_OMP_PARALLEL
 
+  /*--- All the elements were visited. ---*/
+  if (!GradCachePos.empty()) grad_cache_ready = true;
+
 }
 
 void CFEASolver::Compute_StiffMatrix_NodalStressRes(CGeometry *geometry, CNumerics **numerics, CConfig *config) {
@@ -943,6 +961,14 @@ void CFEASolver::Compute_StiffMatrix_NodalStressRes(CGeometry *geometry, CNumeri
   const su2double simp_exponent = config->GetSIMP_Exponent();
   const su2double simp_minstiff = config->GetSIMP_MinStiffness();
 
+  /*--- Keep what is needed to recompute the tangents for matrix-free products. ---*/
+  tangent_numerics = numerics;
+  tangent_nonlinear = true;
+  tangent_updated = true;
+  if (matrix_free) DirichletNode.assign(nPoint, false);
+
+  if (config->GetFEA_GradientCache() && GradCachePos.empty()) InitializeGradCache(geometry);
+
   /*--- Start OpenMP parallel region. ---*/
 
   SU2_OMP_PARALLEL
@@ -1010,6 +1036,7 @@ void CFEASolver::Compute_StiffMatrix_NodalStressRes(CGeometry *geometry, CNumeri
         fea_elem->Set_ElProperties(element_properties[iElem]);
         if (de_effects)
           de_elem->Set_ElProperties(element_properties[iElem]);
+        SetElementGradCache(fea_elem, EL_KIND, iElem, true);
 
         /*--- Compute the components of the Jacobian and the stress term for the material. ---*/
         int NUM_TERM = thread*MAX_TERMS + element_properties[iElem]->GetMat_Mod();
@@ -1041,6 +1068,9 @@ void CFEASolver::Compute_StiffMatrix_NodalStressRes(CGeometry *geometry, CNumeri
             /*--- Get a pointer to the matrix block to perform the update. ---*/
             auto Kij = Jacobian.GetBlock(indexNode[iNode], indexNode[jNode]);
 
+            /*--- Off-diagonal blocks are not stored in matrix-free mode. ---*/
+            if (Kij == nullptr) continue;
+
             /*--- Retrieve the values of the FEA term. ---*/
             auto Kab = fea_elem->Get_Kab(iNode, jNode);
             su2double Ks_ab = fea_elem->Get_Ks_ab(iNode, jNode);
@@ -1072,6 +1102,200 @@ void CFEASolver::Compute_StiffMatrix_NodalStressRes(CGeometry *geometry, CNumeri
 
   } // end SU2_OMP_PARALLEL
 
+  /*--- All the elements were visited. ---*/
+  if (!GradCachePos.empty()) grad_cache_ready = true;
+
+}
+
+template<class ScalarType>
+void CFEASolver::ElementMatrixProduct(const CSysVector<ScalarType>& u, CSysVector<ScalarType>& v, bool dirichletColumns,
+                                      CGeometry *geometry, const CConfig *config) {
+
+  /*--- The same terms of the last assembly, see Compute_StiffMatrix(_NodalStressRes). ---*/
+  const bool prestretch_fem = tangent_nonlinear && config->GetPrestretch();
+  const bool de_effects = tangent_nonlinear && config->GetDE_Effects();
+
+  const bool topology_mode = config->GetTopology_Optimization();
+  const su2double simp_exponent = config->GetSIMP_Exponent();
+  const su2double simp_minstiff = config->GetSIMP_MinStiffness();
+
+  auto numerics = tangent_numerics;
+
+  /*--- The vector being multiplied may have just been written by other threads. ---*/
+  SU2_OMP_BARRIER
+
+  v.SetValZero();
+  SU2_OMP_BARRIER
+
+  for(auto color : ElemColoring) {
+
+    /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+    SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+    for(auto k = 0ul; k < color.size; ++k) {
+
+      auto iElem = color.indices[k];
+
+      unsigned short iNode, jNode, iDim, iVar, jVar;
+
+      int thread = omp_get_thread_num();
+
+      /*--- Convert VTK type to index in the element container. ---*/
+      int EL_KIND;
+      unsigned short nNodes;
+      GetElemKindAndNumNodes(geometry->elem[iElem]->GetVTK_Type(), EL_KIND, nNodes);
+
+      /*--- Each thread needs a dedicated element. ---*/
+      CElement* fea_elem = element_container[FEA_TERM][EL_KIND+thread*MAX_FE_KINDS];
+      CElement* de_elem = element_container[DE_TERM][EL_KIND+thread*MAX_FE_KINDS];
+
+      /*--- Skip the elements that do not contribute to the requested rows and columns. ---*/
+      unsigned long indexNode[MAXNNODE];
+      bool anyRow = false, anyCol = false;
+
+      for (iNode = 0; iNode < nNodes; iNode++) {
+        indexNode[iNode] = geometry->elem[iElem]->GetNode(iNode);
+        const bool enforced = DirichletNode[indexNode[iNode]];
+        anyRow |= (indexNode[iNode] < nPointDomain) && !enforced;
+        anyCol |= (enforced == dirichletColumns);
+      }
+      if (!anyRow || !anyCol) continue;
+
+      for (iNode = 0; iNode < nNodes; iNode++) {
+        for (iDim = 0; iDim < nDim; iDim++) {
+          su2double val_Coord = Get_ValCoord(geometry, indexNode[iNode], iDim);
+          su2double val_Sol = nodes->GetSolution(indexNode[iNode],iDim) + val_Coord;
+
+          if (prestretch_fem)
+            val_Coord = nodes->GetPrestretch(indexNode[iNode],iDim);
+
+          fea_elem->SetCurr_Coord(iNode, iDim, val_Sol);
+          fea_elem->SetRef_Coord(iNode, iDim, val_Coord);
+
+          if (de_effects) {
+            de_elem->SetCurr_Coord(iNode, iDim, val_Sol);
+            de_elem->SetRef_Coord(iNode, iDim, val_Coord);
+          }
+        }
+      }
+
+      su2double simp_penalty = 1.0;
+      if (topology_mode) {
+        su2double density = element_properties[iElem]->GetPhysicalDensity();
+        simp_penalty = simp_minstiff+(1.0-simp_minstiff)*pow(density,simp_exponent);
+      }
+
+      fea_elem->Set_ElProperties(element_properties[iElem]);
+      if (de_effects)
+        de_elem->Set_ElProperties(element_properties[iElem]);
+      SetElementGradCache(fea_elem, EL_KIND, iElem, false);
+
+      /*--- Recompute the tangent of the element. ---*/
+      int NUM_TERM = thread*MAX_TERMS + element_properties[iElem]->GetMat_Mod();
+
+      numerics[NUM_TERM]->Compute_Tangent_Matrix(fea_elem, config);
+
+      if (de_effects)
+        numerics[DE_TERM + thread*MAX_TERMS]->Compute_Tangent_Matrix(de_elem, config);
+
+      /*--- Accumulate the product on the free domain rows. ---*/
+      for (iNode = 0; iNode < nNodes; iNode++) {
+
+        const auto iPoint = indexNode[iNode];
+        if ((iPoint >= nPointDomain) || DirichletNode[iPoint]) continue;
+
+        ScalarType prod[MAXNVAR] = {0.0};
+
+        for (jNode = 0; jNode < nNodes; jNode++) {
+
+          const auto jPoint = indexNode[jNode];
+          if (DirichletNode[jPoint] != dirichletColumns) continue;
+
+          /*--- Full block, and the diagonal (stress and electric) terms. ---*/
+          auto Kab = fea_elem->Get_Kab(iNode, jNode);
+          su2double Ks_ab = 0.0;
+          if (tangent_nonlinear) Ks_ab += fea_elem->Get_Ks_ab(iNode, jNode);
+          if (de_effects) Ks_ab += de_elem->Get_Ks_ab(iNode, jNode);
+
+          const passivedouble Ks = SU2_TYPE::GetValue(simp_penalty*Ks_ab);
+
+          for (iVar = 0; iVar < nVar; iVar++) {
+            prod[iVar] += Ks * u(jPoint,iVar);
+            for (jVar = 0; jVar < nVar; jVar++)
+              prod[iVar] += SU2_TYPE::GetValue(simp_penalty*Kab[iVar*nVar+jVar]) * u(jPoint,jVar);
+          }
+        }
+
+        if (LockStrategy) omp_set_lock(&UpdateLocks[iPoint]);
+
+        for (iVar = 0; iVar < nVar; iVar++)
+          v(iPoint,iVar) += prod[iVar];
+
+        if (LockStrategy) omp_unset_lock(&UpdateLocks[iPoint]);
+      }
+
+    } // end iElem loop
+
+  } // end color loop
+
+  /*--- The rows of the enforced nodes are the identity. ---*/
+
+  if (!dirichletColumns) {
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++)
+      if (DirichletNode[iPoint])
+        for (unsigned short iVar = 0; iVar < nVar; iVar++)
+          v(iPoint,iVar) = u(iPoint,iVar);
+  }
+
+}
+
+void CFEASolver::MatrixFreeProduct(const CSysVector<ScalarImplicit>& u, CSysVector<ScalarImplicit>& v,
+                                   CGeometry *geometry, CConfig *config) {
+
+  ElementMatrixProduct(u, v, false, geometry, config);
+
+  /*--- Set the halo values of the result, as CSysMatrix does for its products. ---*/
+
+  SU2_OMP_MASTER
+  {
+    Jacobian.InitiateComms(v, geometry, config, SOLUTION_MATRIX);
+    Jacobian.CompleteComms(v, geometry, config, SOLUTION_MATRIX);
+  }
+  SU2_OMP_BARRIER
+
+}
+
+void CFEASolver::EnforceSolutionAtNode(unsigned long iPoint, const su2double* x_i) {
+
+  /*--- Without the off-diagonal blocks only the row is eliminated, the matrix-free
+   *    products skip the columns of the marked nodes, see Solve_System. ---*/
+
+  if (matrix_free) DirichletNode[iPoint] = true;
+
+  Jacobian.EnforceSolutionAtNode(iPoint, x_i, LinSysRes);
+
+}
+
+void CFEASolver::InitializeGradCache(CGeometry *geometry) {
+
+  /*--- The records of each kind of element are contiguous, in the order of the elements. ---*/
+
+  unsigned long size[MAX_FE_KINDS] = {0};
+  GradCachePos.resize(nElement);
+
+  for (auto iElem = 0ul; iElem < nElement; iElem++) {
+    int EL_KIND;
+    unsigned short nNodes;
+    GetElemKindAndNumNodes(geometry->elem[iElem]->GetVTK_Type(), EL_KIND, nNodes);
+
+    GradCachePos[iElem] = size[EL_KIND];
+    size[EL_KIND] += element_container[FEA_TERM][EL_KIND]->GetGradCacheSize();
+  }
+
+  for (auto iKind = 0u; iKind < MAX_FE_KINDS; iKind++)
+    GradCache[iKind].resize(size[iKind]) = su2double(0.0);
+
+  grad_cache_ready = false;
 }
 
 void CFEASolver::Compute_MassMatrix(CGeometry *geometry, CNumerics **numerics, CConfig *config) {
@@ -1210,22 +1434,22 @@ void CFEASolver::Compute_MassRes(CGeometry *geometry, CNumerics **numerics, CCon
 
         numerics[FEA_TERM + thread*MAX_TERMS]->Compute_Mass_Matrix(element, config);
 
-        /*--- Add contributions of this element to the mass matrix.
-         * In case we need to use locks we guard the entire update. ---*/
-        if (LockStrategy) omp_set_lock(&UpdateLocks[0]);
-
+        /*--- Add contributions of this element to the mass residual, each node receives the
+         *    sum of its row and column of the element mass matrix times its own auxiliary value. ---*/
         for (iNode = 0; iNode < nNodes; iNode++) {
-          for (jNode = 0; jNode < nNodes; jNode++) {
 
-            su2double Mab = simp_penalty * element->Get_Mab(iNode, jNode);
+          su2double Ma = 0.0;
+          for (jNode = 0; jNode < nNodes; jNode++)
+            Ma += element->Get_Mab(iNode, jNode) + element->Get_Mab(jNode, iNode);
+          Ma *= simp_penalty;
 
-            for (iVar = 0; iVar < nVar; iVar++) {
-              TimeRes[indexNode[iNode]*nVar+iVar] += Mab * TimeRes_Aux(indexNode[iNode],iVar);
-              TimeRes[indexNode[jNode]*nVar+iVar] += Mab * TimeRes_Aux(indexNode[jNode],iVar);
-            }
-          }
+          if (LockStrategy) omp_set_lock(&UpdateLocks[indexNode[iNode]]);
+
+          for (iVar = 0; iVar < nVar; iVar++)
+            TimeRes(indexNode[iNode],iVar) += Ma * TimeRes_Aux(indexNode[iNode],iVar);
+
+          if (LockStrategy) omp_unset_lock(&UpdateLocks[indexNode[iNode]]);
         }
-        if (LockStrategy) omp_unset_lock(&UpdateLocks[0]);
 
       } // end iElem loop
 
@@ -1302,6 +1526,7 @@ void CFEASolver::Compute_NodalStressRes(CGeometry *geometry, CNumerics **numeric
 
         /*--- Set the properties of the element. ---*/
         element->Set_ElProperties(element_properties[iElem]);
+        SetElementGradCache(element, EL_KIND, iElem, false);
 
         /*--- Compute the components of the Jacobian and the stress term for the material. ---*/
         int NUM_TERM = thread*MAX_TERMS + element_properties[iElem]->GetMat_Mod();
@@ -1402,6 +1627,7 @@ void CFEASolver::Compute_NodalStress(CGeometry *geometry, CNumerics **numerics,
 
         /*--- Set the properties of the element. ---*/
         element->Set_ElProperties(element_properties[iElem]);
+        SetElementGradCache(element, EL_KIND, iElem, false);
 
         /*--- Compute the averaged nodal stresses. ---*/
         int NUM_TERM = thread*MAX_TERMS + element_properties[iElem]->GetMat_Mod();
@@ -1759,7 +1985,7 @@ void CFEASolver::BC_Clamped(CGeometry *geometry, CNumerics *numerics, CConfig *c
 
     LinSysSol.SetBlock(iPoint, zeros);
     LinSysReact.SetBlock(iPoint, zeros);
-    Jacobian.EnforceSolutionAtNode(iPoint, zeros, LinSysRes);
+    EnforceSolutionAtNode(iPoint, zeros);
 
   }
 
@@ -1823,7 +2049,7 @@ void CFEASolver::BC_DispDir(CGeometry *geometry, CNumerics *numerics, CConfig *c
       LinSysSol(iNode,iDim) = DispDir[iDim] - nodes->GetSolution(iNode,iDim);
 
     /*--- Enforce the solution. ---*/
-    Jacobian.EnforceSolutionAtNode(iNode, LinSysSol.GetBlock(iNode), LinSysRes);
+    EnforceSolutionAtNode(iNode, LinSysSol.GetBlock(iNode));
   }
 
 }
@@ -1858,16 +2084,28 @@ void CFEASolver::Postprocessing(CGeometry *geometry, CSolver **solver_container,
 
     SU2_OMP_PARALLEL
     {
-#ifndef CODI_REVERSE_TYPE
-      Jacobian.ComputeResidual(LinSysSol, LinSysRes, LinSysAux);
+#if !defined(CODI_REVERSE_TYPE) && !defined(USE_MIXED_PRECISION)
+      if (matrix_free) {
+        ElementMatrixProduct(LinSysSol, LinSysAux, false, geometry, config);
+        LinSysAux -= LinSysRes;
+      }
+      else {
+        Jacobian.ComputeResidual(LinSysSol, LinSysRes, LinSysAux);
+      }
 #else
       /*---  We need temporaries to interface with the matrix ---*/
       {
-        CSysVector<passivedouble> sol, res;
+        CSysVector<su2mixedfloat> sol, res;
         sol.PassiveCopy(LinSysSol);
         res.PassiveCopy(LinSysRes);
-        CSysVector<passivedouble> aux(res);
-        Jacobian.ComputeResidual(sol, res, aux);
+        CSysVector<su2mixedfloat> aux(res);
+        if (matrix_free) {
+          ElementMatrixProduct(sol, aux, false, geometry, config);
+          aux -= res;
+        }
+        else {
+          Jacobian.ComputeResidual(sol, res, aux);
+        }
         LinSysAux.PassiveCopy(aux);
       }
 #endif
@@ -2137,7 +2375,7 @@ void CFEASolver::BC_Deforming(CGeometry *geometry, CNumerics *numerics, CConfig
 
     /*--- Set and enforce solution ---*/
     LinSysSol.SetBlock(iNode, Disp);
-    Jacobian.EnforceSolutionAtNode(iNode, Disp, LinSysRes);
+    EnforceSolutionAtNode(iNode, Disp);
 
   }
 
@@ -2166,12 +2404,19 @@ void CFEASolver::Integrate_FSI_Loads(CGeometry *geometry, CConfig *config) {
 
     nElem = geometry->GetnElem_Bound(iMarker);
 
-    for (iElem = 0; iElem < nElem; ++iElem) {
+    /*--- Each element writes its own position, the elements are processed in parallel. ---*/
+    const auto offset = forces.size();
+    forces.resize(offset + nElem*nDim);
+
+    SU2_OMP_PARALLEL_(for schedule(static,computeStaticChunkSize(nElem, omp_get_max_threads(), OMP_MAX_SIZE)))
+    for (unsigned long iElem = 0; iElem < nElem; ++iElem) {
+      unsigned short iNode, iDim;
+
       /*--- Define the boundary element ---*/
       unsigned long nodeList[4];
       su2double coords[4][3];
       bool quad = geometry->bound[iMarker][iElem]->GetVTK_Type() == QUADRILATERAL;
-      nNode = quad? 4 : nDim;
+      const unsigned short nNode = quad? 4 : nDim;
 
       for (iNode = 0; iNode < nNode; ++iNode) {
         nodeList[iNode] = geometry->bound[iMarker][iElem]->GetNode(iNode);
@@ -2200,7 +2445,7 @@ void CFEASolver::Integrate_FSI_Loads(CGeometry *geometry, CConfig *config) {
         for (iDim = 0; iDim < nDim; ++iDim)
           force[iDim] += weight*area*nodes->Get_FlowTraction(nodeList[iNode],iDim);
 
-      for (iDim = 0; iDim < nDim; ++iDim) forces.push_back(force[iDim]);
+      for (iDim = 0; iDim < nDim; ++iDim) forces[offset + iElem*nDim + iDim] = force[iDim];
     }
   }
 
@@ -2386,7 +2631,6 @@ su2double CFEASolver::Compute_LoadCoefficient(su2double CurrentTime, su2double R
 
 void CFEASolver::ImplicitNewmark_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
 
-  const bool first_iter = (config->GetInnerIter() == 0);
   const bool dynamic = (config->GetTime_Domain());
   const bool linear_analysis = (config->GetGeometricConditions() == SMALL_DEFORMATIONS);
   const bool nonlinear_analysis = (config->GetGeometricConditions() == LARGE_DEFORMATIONS);
@@ -2437,13 +2681,13 @@ void CFEASolver::ImplicitNewmark_Iteration(CGeometry *geometry, CSolver **solver
       /*
        * If the problem is nonlinear, we need to add the Mass Matrix contribution to the Jacobian at the beginning
        * of each time step. If the solution method is Newton Rapshon, we repeat this step at the beginning of each
-       * iteration, as the Jacobian is recomputed.
+       * iteration, as the Jacobian is recomputed, likewise when the frozen tangent of the other methods is.
        *
        * If the problem is linear, we add the Mass Matrix contribution to the Jacobian everytime because for
        * correct differentiation the Jacobian is recomputed every time step.
        *
        */
-      if ((nonlinear_analysis && (newton_raphson || first_iter)) || linear_analysis) {
+      if ((nonlinear_analysis && (newton_raphson || tangent_updated)) || linear_analysis) {
         Jacobian.MatrixMatrixAddition(a_dt[0], MassMatrix);
       }
 
@@ -2478,18 +2722,15 @@ void CFEASolver::ImplicitNewmark_Update(CGeometry *geometry, CSolver **solver_co
     unsigned long iPoint;
     unsigned short iVar;
 
-    /*--- Update solution. ---*/
+    /*--- Update solution, single sweep over the nodal data. ---*/
 
     SU2_OMP_FOR_STAT(omp_chunk_size)
     for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
       /*--- Displacement component of the solution. ---*/
       for (iVar = 0; iVar < nVar; iVar++)
         nodes->Add_DeltaSolution(iPoint, iVar, LinSysSol(iPoint,iVar));
-    }
 
-    if (dynamic) {
-      SU2_OMP_FOR_STAT(omp_chunk_size)
-      for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      if (dynamic) {
         for (iVar = 0; iVar < nVar; iVar++) {
 
           /*--- Acceleration component of the solution. ---*/
@@ -2536,11 +2777,8 @@ void CFEASolver::ImplicitNewmark_Relaxation(CGeometry *geometry, CSolver **solve
     SU2_OMP_FOR_STAT(omp_chunk_size)
     for (iPoint=0; iPoint < nPointDomain; iPoint++) {
       nodes->SetSolution(iPoint, nodes->GetSolution_Pred(iPoint));
-    }
 
-    if (dynamic) {
-      SU2_OMP_FOR_STAT(omp_chunk_size)
-      for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      if (dynamic) {
         for (iVar = 0; iVar < nVar; iVar++) {
 
           /*--- Acceleration component of the solution ---*/
@@ -2589,7 +2827,6 @@ void CFEASolver::ImplicitNewmark_Relaxation(CGeometry *geometry, CSolver **solve
 
 void CFEASolver::GeneralizedAlpha_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
 
-  const bool first_iter = (config->GetInnerIter() == 0);
   const bool dynamic = (config->GetTime_Domain());
   const bool linear_analysis = (config->GetGeometricConditions() == SMALL_DEFORMATIONS);
   const bool nonlinear_analysis = (config->GetGeometricConditions() == LARGE_DEFORMATIONS);
@@ -2642,7 +2879,7 @@ void CFEASolver::GeneralizedAlpha_Iteration(CGeometry *geometry, CSolver **solve
       /*--- Add the mass matrix contribution to the Jacobian. ---*/
 
       /*--- See notes on logic in ImplicitNewmark_Iteration(). ---*/
-      if ((nonlinear_analysis && (newton_raphson || first_iter)) || linear_analysis) {
+      if ((nonlinear_analysis && (newton_raphson || tangent_updated)) || linear_analysis) {
         Jacobian.MatrixMatrixAddition(a_dt[0], MassMatrix);
       }
 
@@ -2774,15 +3011,34 @@ void CFEASolver::GeneralizedAlpha_UpdateSolution(CGeometry *geometry, CSolver **
 void CFEASolver::GeneralizedAlpha_UpdateLoads(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
 
   /*--- Set the load conditions of the time step n+1 as the load conditions for time step n ---*/
-  nodes->Set_SurfaceLoad_Res_n();
-  nodes->Set_FlowTraction_n();
+  SU2_OMP_PARALLEL
+  {
+    nodes->Set_SurfaceLoad_Res_n();
+    nodes->Set_FlowTraction_n();
+  }
 
 }
 
 void CFEASolver::Solve_System(CGeometry *geometry, CConfig *config) {
 
+  const bool nonlinear_analysis = (config->GetGeometricConditions() == LARGE_DEFORMATIONS);
+  const bool frozen_tangent = nonlinear_analysis && (config->GetKind_SpaceIteScheme_FEA() != NEWTON_RAPHSON);
+  const bool quasi_newton = nonlinear_analysis && (config->GetKind_SpaceIteScheme_FEA() == QUASI_NEWTON_BFGS);
+
+  /*--- The preconditioner of the frozen tangent remains valid. ---*/
+  System.SetMatrixUnchanged(frozen_tangent && !tangent_updated);
+
   SU2_OMP_PARALLEL
   {
+  /*--- When matrix-free the columns of the enforced nodes were not eliminated by the BCs,
+   *    move them to the right hand side (the enforced values are in the solution vector). ---*/
+
+  if (matrix_free) {
+    ElementMatrixProduct(LinSysSol, LinSysAux, true, geometry, config);
+    LinSysRes -= LinSysAux;
+    SU2_OMP_BARRIER
+  }
+
   /*--- Initialize residual and solution at the ghost points ---*/
 
   SU2_OMP(sections)
@@ -2796,19 +3052,154 @@ void CFEASolver::Solve_System(CGeometry *geometry, CConfig *config) {
       LinSysSol.SetBlock_Zero(iPoint);
   }
 
+  /*--- Decide if the frozen tangent is recomputed on the next iteration, because it is too old,
+   *    or because the residual did not drop enough since the last iteration. ---*/
+
+  if (frozen_tangent) {
+    const su2double resNorm = LinSysRes.norm();
+    SU2_OMP_MASTER
+    {
+      const auto maxAge = config->GetFEA_Tangent_Update_Iter();
+      const su2double stallRatio = config->GetFEA_Tangent_Stall_Ratio();
+
+      tangent_age = tangent_updated? 0 : tangent_age+1;
+      const bool stalled = !tangent_updated && (stallRatio > 0.0) && (resNorm > stallRatio*tangent_resNorm);
+      tangent_refresh = stalled || ((maxAge > 0) && (tangent_age+1 >= maxAge));
+      tangent_resNorm = resNorm;
+    }
+    SU2_OMP_BARRIER
+  }
+
   /*--- Solve or smooth the linear system. ---*/
 
-  auto iter = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
+  const CMatrixFreeProduct product(*this, geometry, config);
+
+  unsigned long iter = 0;
+  if (quasi_newton)
+    iter = QuasiNewtonStep(geometry, config);
+  else
+    iter = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config, matrix_free? &product : nullptr);
+
   SU2_OMP_MASTER
   {
     SetIterLinSolver(iter);
     SetResLinSolver(System.GetResidual());
+    tangent_updated = false;
   }
   SU2_OMP_BARRIER
 
   } // end SU2_OMP_PARALLEL
 }
 
+unsigned long CFEASolver::QuasiNewtonStep(CGeometry *geometry, CConfig *config) {
+
+  const unsigned short memory = config->GetQuasiNewton_Memory();
+  const bool line_search = config->GetQuasiNewton_LineSearch();
+
+  SU2_OMP_MASTER
+  {
+    if (qn_Step.empty()) {
+      qn_Step.resize(memory);
+      qn_ResChange.resize(memory);
+      qn_Rho.resize(memory);
+      for (auto i = 0u; i < memory; i++) {
+        qn_Step[i].Initialize(nPoint, nPointDomain, nVar, 0.0);
+        qn_ResChange[i].Initialize(nPoint, nPointDomain, nVar, 0.0);
+      }
+      qn_LastStep.Initialize(nPoint, nPointDomain, nVar, 0.0);
+      qn_LastRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
+      qn_Work.Initialize(nPoint, nPointDomain, nVar, 0.0);
+    }
+
+    /*--- The updates correct a particular tangent. ---*/
+    if (tangent_updated) {
+      qn_nPairs = 0;
+      qn_pending = false;
+    }
+  }
+  SU2_OMP_BARRIER
+
+  if (qn_pending) {
+
+    /*--- Line search, the residual (minus the gradient of the energy) should be nearly orthogonal to the
+     *    last step, otherwise its length is corrected by the secant method without solving the system. ---*/
+
+    su2double g0 = 0.0, g1 = 0.0;
+    qn_LastStep.Dot2(qn_LastRes, LinSysRes, g0, g1);
+
+    if (line_search && !qn_searched && (fabs(g1) > 0.5*fabs(g0)) && (g0 != g1)) {
+      su2double alpha = g0 / (g0 - g1);
+      alpha = min(max(alpha, su2double(0.1)), su2double(1.0));
+
+      if (alpha < 1.0) {
+        LinSysSol.Equals_AX(alpha-1.0, qn_LastStep);
+        qn_LastStep *= alpha;
+        SU2_OMP_MASTER
+        qn_searched = true;
+        SU2_OMP_BARRIER
+        return 0;
+      }
+    }
+
+    /*--- New update, from the last (complete) step and the decrease of the residual over it.
+     *    It is only kept if positive definite (s.y > 0), the oldest is replaced when full. ---*/
+
+    const auto k = qn_iNext;
+    qn_Step[k] = qn_LastStep;
+    qn_ResChange[k].Equals_AX_Plus_BY(1.0, qn_LastRes, -1.0, LinSysRes);
+
+    su2double sy = 0.0, yy = 0.0;
+    qn_ResChange[k].Dot2(qn_Step[k], qn_ResChange[k], sy, yy);
+
+    SU2_OMP_MASTER
+    {
+      if (sy > EPS*yy) {
+        qn_Rho[k] = 1.0 / sy;
+        qn_iNext = (k+1) % memory;
+        qn_nPairs = min<unsigned short>(qn_nPairs+1, memory);
+      }
+    }
+    SU2_OMP_BARRIER
+  }
+
+  /*--- Two-loop recursion, the inverse of the frozen tangent is the initial approximation. ---*/
+
+  vector<su2double> a(qn_nPairs);
+
+  qn_Work = LinSysRes;
+
+  for (auto i = 0u; i < qn_nPairs; i++) {
+    const auto k = (qn_iNext + memory - 1 - i) % memory;
+    a[i] = qn_Rho[k] * qn_Step[k].dot(qn_Work);
+    qn_Work.Plus_AX(-a[i], qn_ResChange[k]);
+  }
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (auto iPoint = nPointDomain; iPoint < nPoint; iPoint++)
+    qn_Work.SetBlock_Zero(iPoint);
+
+  const auto iter = System.Solve(Jacobian, qn_Work, LinSysSol, geometry, config);
+
+  for (auto i = qn_nPairs; i-- > 0; ) {
+    const auto k = (qn_iNext + memory - 1 - i) % memory;
+    const su2double b = qn_Rho[k] * qn_ResChange[k].dot(LinSysSol);
+    LinSysSol.Plus_AX(a[i]-b, qn_Step[k]);
+  }
+
+  /*--- Keep what is needed by the next update. ---*/
+
+  qn_LastStep = LinSysSol;
+  qn_LastRes = LinSysRes;
+
+  SU2_OMP_MASTER
+  {
+    qn_pending = true;
+    qn_searched = false;
+  }
+  SU2_OMP_BARRIER
+
+  return iter;
+}
 
 void CFEASolver::PredictStruct_Displacement(CGeometry **fea_geometry,
                                             CConfig *fea_config,
@@ -2944,6 +3335,12 @@ void CFEASolver::ComputeAitken_Coefficient(CGeometry **fea_geometry, CConfig *fe
 
     }
 
+  }
+  else if (RelaxMethod_FSI == IQN_ILS) {
+
+    /*--- The interface is updated by SetIQN_Relaxation, elsewhere the calculated solution is used. ---*/
+    SetWAitken_Dyn(1.0);
+
   }
   else {
     if (rank == MASTER_NODE) cout << "No relaxation method used. " << endl;
@@ -2977,6 +3374,146 @@ void CFEASolver::SetAitken_Relaxation(CGeometry **fea_geometry,
     }
   }
 
+  if (fea_config->GetRelaxation_Method_FSI() == IQN_ILS)
+    SetIQN_Relaxation(fea_geometry[MESH_0], fea_config);
+
+}
+
+void CFEASolver::SetIQN_Relaxation(CGeometry *geometry, const CConfig *config) {
+
+  /*--- Gather the (owned) points of the FSI interface markers, each counted once. ---*/
+
+  if (!IQN_Initialized) {
+    vector<bool> isInterface(nPointDomain, false);
+    for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+      if (config->GetMarker_All_ZoneInterface(iMarker) == 0) continue;
+      for (unsigned long iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+        const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        if (geometry->node[iPoint]->GetDomain() && !isInterface[iPoint]) {
+          isInterface[iPoint] = true;
+          IQN_Point.push_back(iPoint);
+        }
+      }
+    }
+    IQN_Initialized = true;
+  }
+
+  const unsigned long nDOF = IQN_Point.size()*nDim;
+  const unsigned long timeIter = config->GetTimeIter();
+
+  /*--- Residual r = x~ - x of the fixed point iteration, x being the predicted
+   *    displacement given to the fluid and x~ the one calculated with its loads. ---*/
+
+  vector<su2double> res(nDOF), calc(nDOF);
+  for (unsigned long k = 0; k < IQN_Point.size(); k++) {
+    for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+      calc[k*nDim+iDim] = nodes->GetSolution(IQN_Point[k], iDim);
+      res[k*nDim+iDim] = calc[k*nDim+iDim] - nodes->GetSolution_Pred_Old(IQN_Point[k], iDim);
+    }
+  }
+
+  /*--- At the start of a time step discard the history that is too old, and
+   *    do not form differences with the last iteration of the previous step. ---*/
+
+  if (config->GetOuterIter() == 0) {
+    IQN_Res_Old.clear();
+    for (size_t iCol = IQN_V.size(); iCol-- > 0; ) {
+      if (IQN_TimeIter[iCol] + config->GetIQN_ReuseTimeIter() < timeIter) {
+        IQN_V.erase(IQN_V.begin()+iCol);
+        IQN_W.erase(IQN_W.begin()+iCol);
+        IQN_TimeIter.erase(IQN_TimeIter.begin()+iCol);
+      }
+    }
+  }
+
+  if (!IQN_Res_Old.empty()) {
+    vector<su2double> deltaRes(nDOF), deltaCalc(nDOF);
+    for (unsigned long i = 0; i < nDOF; i++) {
+      deltaRes[i] = res[i] - IQN_Res_Old[i];
+      deltaCalc[i] = calc[i] - IQN_Calc_Old[i];
+    }
+    IQN_V.insert(IQN_V.begin(), move(deltaRes));
+    IQN_W.insert(IQN_W.begin(), move(deltaCalc));
+    IQN_TimeIter.insert(IQN_TimeIter.begin(), timeIter);
+  }
+  IQN_Res_Old = res;
+  IQN_Calc_Old = calc;
+
+  /*--- Global dot products of a vector with a set of vectors, in one reduction. ---*/
+
+  auto globalDots = [&](const vector<vector<su2double> >& basis, const vector<su2double>& vec) {
+    vector<su2double> local(basis.size(), 0.0), global(basis.size(), 0.0);
+    for (size_t iCol = 0; iCol < basis.size(); iCol++)
+      for (unsigned long i = 0; i < nDOF; i++) local[iCol] += basis[iCol][i] * vec[i];
+    SU2_MPI::Allreduce(local.data(), global.data(), basis.size(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    return global;
+  };
+
+  /*--- Economy QR decomposition of V (Gram-Schmidt with reorthogonalization). Columns whose
+   *    orthogonal part is small relative to their norm are (nearly) linearly dependent on
+   *    newer information, they are removed from the history (QR filtering). ---*/
+
+  vector<vector<su2double> > Q;
+  vector<vector<su2double> > R;  /*--- Column iCol of the upper triangular factor, size iCol+1. ---*/
+
+  for (size_t iCol = 0; iCol < IQN_V.size(); ) {
+    vector<su2double> q = IQN_V[iCol];
+    const su2double normV = sqrt(globalDots({q}, q)[0]);
+    vector<su2double> rCol(Q.size(), 0.0);
+
+    for (int pass = 0; pass < 2; pass++) {
+      const auto proj = globalDots(Q, q);
+      for (size_t jCol = 0; jCol < Q.size(); jCol++) {
+        rCol[jCol] += proj[jCol];
+        for (unsigned long i = 0; i < nDOF; i++) q[i] -= proj[jCol] * Q[jCol][i];
+      }
+    }
+    const su2double normQ = sqrt(globalDots({q}, q)[0]);
+
+    if (normV < EPS || normQ < config->GetIQN_FilterTol()*normV) {
+      IQN_V.erase(IQN_V.begin()+iCol);
+      IQN_W.erase(IQN_W.begin()+iCol);
+      IQN_TimeIter.erase(IQN_TimeIter.begin()+iCol);
+      continue;
+    }
+    for (auto& val : q) val /= normQ;
+    rCol.push_back(normQ);
+    Q.push_back(move(q));
+    R.push_back(move(rCol));
+    iCol++;
+  }
+
+  /*--- Update the interface. Without history relax with the static parameter, otherwise
+   *    x = x~ + W c, with c the least squares solution of V c = -r, i.e. R c = -Q^T r. ---*/
+
+  const auto nCol = Q.size();
+  vector<su2double> coeff(nCol, 0.0);
+
+  if (nCol > 0) {
+    coeff = globalDots(Q, res);
+    for (size_t iCol = nCol; iCol-- > 0; ) {
+      coeff[iCol] = -coeff[iCol];
+      for (size_t jCol = iCol+1; jCol < nCol; jCol++) coeff[iCol] -= R[jCol][iCol] * coeff[jCol];
+      coeff[iCol] /= R[iCol][iCol];
+    }
+  }
+
+  const su2double relax = config->GetAitkenStatRelax();
+
+  for (unsigned long k = 0; k < IQN_Point.size(); k++) {
+    su2double* dispPred = nodes->GetSolution_Pred(IQN_Point[k]);
+    for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+      const auto i = k*nDim+iDim;
+      if (nCol == 0) {
+        dispPred[iDim] = calc[i] - (1.0 - relax) * res[i];
+      }
+      else {
+        dispPred[iDim] = calc[i];
+        for (size_t iCol = 0; iCol < nCol; iCol++) dispPred[iDim] += IQN_W[iCol][i] * coeff[iCol];
+      }
+    }
+  }
+
 }
 
 void CFEASolver::Update_StructSolution(CGeometry **fea_geometry,
@@ -3425,45 +3962,41 @@ void CFEASolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig *c
 
   /*--- Load data from the restart into correct containers. ---*/
 
-  unsigned long iPoint_Global, counter = 0;
-
-  for (iPoint_Global = 0; iPoint_Global < geometry[MESH_0]->GetGlobal_nPointDomain(); iPoint_Global++) {
+  unsigned long counter = 0;
 
-    /*--- Retrieve local index. If this node from the restart file lives
-     on the current processor, we will load and instantiate the vars. ---*/
+  for (const auto& globalToLocal : geometry[MESH_0]->GetGlobal_to_Local_Map()) {
 
-    auto iPoint_Local = geometry[MESH_0]->GetGlobal_to_Local_Point(iPoint_Global);
+    /*--- The points of this rank, in the order of their data in the restart file. ---*/
 
-    if (iPoint_Local >= 0) {
+    auto iPoint_Local = globalToLocal.second;
 
-      /*--- We need to store this point's data, so jump to the correct
-       offset in the buffer of data from the restart file and load it. ---*/
+    /*--- We need to store this point's data, so jump to the correct
+     offset in the buffer of data from the restart file and load it. ---*/
 
-      const auto index = counter*Restart_Vars[1] + skipVars;
-      const passivedouble* Sol = &Restart_Data[index];
+    const auto index = counter*Restart_Vars[1] + skipVars;
+    const passivedouble* Sol = &Restart_Data[index];
 
-      for (unsigned short iVar = 0; iVar < nVar; iVar++) {
-        nodes->SetSolution(iPoint_Local, iVar, Sol[iVar]);
-        if (dynamic) {
-          nodes->Set_Solution_time_n(iPoint_Local, iVar, Sol[iVar]);
-          nodes->SetSolution_Vel(iPoint_Local, iVar, Sol[iVar+nVar]);
-          nodes->SetSolution_Vel_time_n(iPoint_Local, iVar, Sol[iVar+nVar]);
-          nodes->SetSolution_Accel(iPoint_Local, iVar, Sol[iVar+2*nVar]);
-          nodes->SetSolution_Accel_time_n(iPoint_Local, iVar, Sol[iVar+2*nVar]);
-        }
-        if (fluid_structure && !dynamic) {
-          nodes->SetSolution_Pred(iPoint_Local, iVar, Sol[iVar]);
-          nodes->SetSolution_Pred_Old(iPoint_Local, iVar, Sol[iVar]);
-        }
-        if (fluid_structure && discrete_adjoint){
-          nodes->SetSolution_Old(iPoint_Local, iVar, Sol[iVar]);
-        }
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      nodes->SetSolution(iPoint_Local, iVar, Sol[iVar]);
+      if (dynamic) {
+        nodes->Set_Solution_time_n(iPoint_Local, iVar, Sol[iVar]);
+        nodes->SetSolution_Vel(iPoint_Local, iVar, Sol[iVar+nVar]);
+        nodes->SetSolution_Vel_time_n(iPoint_Local, iVar, Sol[iVar+nVar]);
+        nodes->SetSolution_Accel(iPoint_Local, iVar, Sol[iVar+2*nVar]);
+        nodes->SetSolution_Accel_time_n(iPoint_Local, iVar, Sol[iVar+2*nVar]);
+      }
+      if (fluid_structure && !dynamic) {
+        nodes->SetSolution_Pred(iPoint_Local, iVar, Sol[iVar]);
+        nodes->SetSolution_Pred_Old(iPoint_Local, iVar, Sol[iVar]);
+      }
+      if (fluid_structure && discrete_adjoint){
+        nodes->SetSolution_Old(iPoint_Local, iVar, Sol[iVar]);
       }
-
-      /*--- Increment the overall counter for how many points have been loaded. ---*/
-      counter++;
     }
 
+    /*--- Increment the overall counter for how many points have been loaded. ---*/
+    counter++;
+
   }
 
   /*--- Detect a wrong solution file. ---*/
@@ -29,8 +29,51 @@
 #include "../../include/solvers/CFEM_DG_EulerSolver.hpp"
 #include "../../../Common/include/toolboxes/printing_toolbox.hpp"
 
+#include <chrono>
+
 #define SIZE_ARR_NORM 8
 
+namespace {
+/*--- Conversion from the active type to the type of the implicit linear system, passive
+ *    unless it is also su2double (forward AD), in which case the derivatives are kept. ---*/
+template<class T>
+inline T ToScalar(const su2double& val) { return SU2_TYPE::GetValue(val); }
+
+template<>
+inline su2double ToScalar<su2double>(const su2double& val) { return val; }
+
+/*--- Copy functions for the ADER predictor solution, which can be stored in single precision. ---*/
+inline void CopyPredictorData(su2double *dst, const su2double *src, const unsigned long n) {
+  memcpy(dst, src, n*sizeof(su2double));
+}
+
+inline void CopyPredictorData(float *dst, const float *src, const unsigned long n) {
+  memcpy(dst, src, n*sizeof(float));
+}
+
+inline void CopyPredictorData(float *dst, const su2double *src, const unsigned long n) {
+  for(unsigned long i=0; i<n; ++i) dst[i] = SU2_TYPE::GetValue(src[i]);
+}
+
+inline void CopyPredictorData(su2double *dst, const float *src, const unsigned long n) {
+  for(unsigned long i=0; i<n; ++i) dst[i] = src[i];
+}
+
+/*--- Rotation of the momentum variables of a DOF for rotational periodicity. ---*/
+inline void RotateMomentum(su2double *sol, const su2double rotMatrix[][3]) {
+  const su2double ru = sol[1], rv = sol[2], rw = sol[3];
+  sol[1] = rotMatrix[0][0]*ru + rotMatrix[0][1]*rv + rotMatrix[0][2]*rw;
+  sol[2] = rotMatrix[1][0]*ru + rotMatrix[1][1]*rv + rotMatrix[1][2]*rw;
+  sol[3] = rotMatrix[2][0]*ru + rotMatrix[2][1]*rv + rotMatrix[2][2]*rw;
+}
+
+inline void RotateMomentum(float *sol, const su2double rotMatrix[][3]) {
+  su2double solD[] = {0.0, sol[1], sol[2], sol[3]};
+  RotateMomentum(solD, rotMatrix);
+  for(unsigned short k=1; k<=3; ++k) sol[k] = SU2_TYPE::GetValue(solD[k]);
+}
+}
+
 CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(void) : CSolver() {
 
   /*--- Basic array initialization ---*/
@@ -258,6 +301,14 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
     sizeWorkArray = max(sizeWorkArray, sizePredictorADER);
   }
 
+  /*--- The sum factorization kernels of the volume residual use the memory
+        after the arrays of the volume residual as work space. ---*/
+  unsigned long sizeSumFact = 0;
+  for(unsigned short i=0; i<nStandardElementsSol; ++i)
+    sizeSumFact = max(sizeSumFact, standardElementsSol[i].GetSizeWorkSumFactorization());
+
+  sizeWorkArray += nPadGemm*sizeSumFact;
+
   /*--- Perform the non-dimensionalization for the flow equations using the
         specified reference values. ---*/
   SetNondimensionalization(config, iMesh, true);
@@ -375,7 +426,12 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
     const unsigned short nTimeDOFs = config->GetnTimeDOFsADER_DG();
 
     VecTotResDOFsADER.assign(nVar*nDOFsLocTot, 0.0);
-    VecSolDOFsPredictorADER.resize(nTimeDOFs*nVar*nDOFsLocTot);
+
+    /* The predictor solution is stored in either double or single precision. */
+    if( config->GetADER_Predictor_SinglePrecision() )
+      VecSolDOFsPredictorADERFloat.resize(nTimeDOFs*nVar*nDOFsLocTot);
+    else
+      VecSolDOFsPredictorADER.resize(nTimeDOFs*nVar*nDOFsLocTot);
   }
   else {
 
@@ -404,6 +460,13 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
   else
     VecResDOFs.resize(nVar*nDOFsLocTot);
 
+  /*--- Allocate the memory for the p-multigrid algorithm. The residuals are
+        needed on all levels, the forcing term only on the coarse levels. ---*/
+  if(config->GetnMGLevels() > 0) {
+    VecResDOFsMG.assign(nVar*nDOFsLocOwned, 0.0);
+    if(MGLevel != MESH_0) VecForcingTermMG.assign(nVar*nDOFsLocOwned, 0.0);
+  }
+
   nEntriesResFaces.assign(nDOFsLocTot+1, 0);
   nEntriesResAdjFaces.assign(nDOFsLocTot+1, 0);
   startLocResFacesMarkers.resize(nMarker);
@@ -687,9 +750,11 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
   }
 
   /* Check if the exact Jacobian of the spatial discretization must be
-     determined. If so, the color of each DOF must be determined, which
-     is converted to the DOFs for each color. */
-  if( config->GetJacobian_Spatial_Discretization_Only() ) {
+     determined, either on its own or for the implicit time integration.
+     If so, the color of each DOF must be determined, which is converted
+     to the DOFs for each color. */
+  const bool implicit = config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT;
+  if( config->GetJacobian_Spatial_Discretization_Only() || implicit ) {
 
     /* Write a message that the graph coloring is performed. */
     if(rank == MASTER_NODE)
@@ -714,6 +779,45 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
     MetaDataJacobianComputation(DGGeometry, colorLocalDOFs);
   }
 
+  /*--- For the implicit time integration, allocate the matrix (preconditioner)
+        and the vectors of the linear system for the owned DOFs. The matrix only
+        contains the couplings between the owned DOFs, possibly within the
+        elements only. ---*/
+  if( implicit ) {
+
+    /* Determine the element of every owned DOF. */
+    vector<unsigned long> elemOwnedDOFs(nDOFsLocOwned);
+    for(unsigned long l=0; l<nVolElemOwned; ++l) {
+      for(unsigned short i=0; i<volElem[l].nDOFsSol; ++i)
+        elemOwnedDOFs[volElem[l].offsetDOFsSolLocal+i] = l;
+    }
+
+    /* Convert the global DOFs of the non-zero entries to local owned DOFs. */
+    const bool elementBlocks = config->GetElementBlock_Jacobian_DGFEM();
+    const unsigned long offsetRank = nDOFsPerRank[rank];
+
+    vector<unsigned long> outerPtr(nDOFsLocOwned+1, 0), innerIdx;
+
+    for(unsigned long i=0; i<nDOFsLocOwned; ++i) {
+      for(unsigned long j=0; j<nonZeroEntriesJacobian[i].size(); ++j) {
+        const unsigned long jj = nonZeroEntriesJacobian[i][j];
+        if((jj < offsetRank) || (jj >= offsetRank+nDOFsLocOwned)) continue;
+        if(elementBlocks && (elemOwnedDOFs[jj-offsetRank] != elemOwnedDOFs[i])) continue;
+        innerIdx.push_back(jj-offsetRank);
+      }
+      outerPtr[i+1] = innerIdx.size();
+    }
+
+    Jacobian.Initialize(nDOFsLocOwned, nVar, nVar, CCompressedSparsePatternLocal(outerPtr, innerIdx),
+                        geometry, config);
+
+    LinSysSol.Initialize(nDOFsLocOwned, nDOFsLocOwned, nVar, 0.0);
+    LinSysRes.Initialize(nDOFsLocOwned, nDOFsLocOwned, nVar, 0.0);
+
+    VecResDOFsImplicit.resize(nVar*nDOFsLocOwned);
+    timeTermJacobian.assign(nDOFsLocOwned, 0.0);
+  }
+
   /* Set up the persistent communication for the conservative variables and
      the reverse communication for the residuals of the halo elements. */
   Prepare_MPI_Communication(DGGeometry, config);
@@ -731,6 +835,8 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
 CFEM_DG_EulerSolver::~CFEM_DG_EulerSolver(void) {
 
   if(FluidModel    != NULL) delete FluidModel;
+  for (unsigned long iThread = 1; iThread < FluidModelThreads.size(); iThread++)
+    delete FluidModelThreads[iThread];
   if(blasFunctions != NULL) delete blasFunctions;
 
   /*--- Array deallocation ---*/
@@ -1041,32 +1147,39 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
   /*--- Delete the original (dimensional) FluidModel object before replacing. ---*/
 
   delete FluidModel;
+  for (unsigned long iThread = 1; iThread < FluidModelThreads.size(); iThread++)
+    delete FluidModelThreads[iThread];
 
-  switch (config->GetKind_FluidModel()) {
+  auto createFluidModelND = [&]() {
 
-    case STANDARD_AIR:
-      FluidModel = new CIdealGas(1.4, Gas_ConstantND, config->GetCompute_Entropy());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
+    CFluidModel *fluidModel = NULL;
 
-    case IDEAL_GAS:
-      FluidModel = new CIdealGas(Gamma, Gas_ConstantND, config->GetCompute_Entropy());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
+    switch (config->GetKind_FluidModel()) {
 
-    case VW_GAS:
-      FluidModel = new CVanDerWaalsGas(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
-                                       config->GetTemperature_Critical()/config->GetTemperature_Ref());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
+      case STANDARD_AIR:
+        fluidModel = new CIdealGas(1.4, Gas_ConstantND, config->GetCompute_Entropy());
+        break;
 
-    case PR_GAS:
-      FluidModel = new CPengRobinson(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
-                                     config->GetTemperature_Critical()/config->GetTemperature_Ref(), config->GetAcentric_Factor());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
+      case IDEAL_GAS:
+        fluidModel = new CIdealGas(Gamma, Gas_ConstantND, config->GetCompute_Entropy());
+        break;
 
-  }
+      case VW_GAS:
+        fluidModel = new CVanDerWaalsGas(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
+                                         config->GetTemperature_Critical()/config->GetTemperature_Ref());
+        break;
+
+      case PR_GAS:
+        fluidModel = new CPengRobinson(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
+                                       config->GetTemperature_Critical()/config->GetTemperature_Ref(), config->GetAcentric_Factor());
+        break;
+
+    }
+    fluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
+    return fluidModel;
+  };
+
+  FluidModel = createFluidModelND();
 
   Energy_FreeStreamND = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStreamND*ModVel_FreeStreamND;
 
@@ -1089,6 +1202,18 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
 
   }
 
+  /*--- Copies of the dimensionless fluid model for the threads that carry out the
+        tasks of the task list, the fluid models store the state of the last evaluation. ---*/
+
+  FluidModelThreads.assign(omp_get_max_threads(), FluidModel);
+  for (unsigned long iThread = 1; iThread < FluidModelThreads.size(); iThread++) {
+    FluidModelThreads[iThread] = createFluidModelND();
+    if (viscous) {
+      FluidModelThreads[iThread]->SetLaminarViscosityModel(config);
+      FluidModelThreads[iThread]->SetThermalConductivityModel(config);
+    }
+  }
+
   if (tkeNeeded) { Energy_FreeStreamND += Tke_FreeStreamND; };  config->SetEnergy_FreeStreamND(Energy_FreeStreamND);
 
   Energy_Ref = Energy_FreeStream/Energy_FreeStreamND; config->SetEnergy_Ref(Energy_Ref);
@@ -2715,9 +2840,12 @@ void CFEM_DG_EulerSolver::Initiate_MPI_Communication(CConfig *config,
        working solution is communicated, there is only one time level. */
     unsigned short nTimeDOFs;
     su2double *commData;
+    float *commDataFloat = nullptr;
     if(config->GetKind_TimeIntScheme_Flow() == ADER_DG) {
       nTimeDOFs = config->GetnTimeDOFsADER_DG();
       commData  = VecSolDOFsPredictorADER.data();
+      if( config->GetADER_Predictor_SinglePrecision() )
+        commDataFloat = VecSolDOFsPredictorADERFloat.data();
     }
     else {
       nTimeDOFs = 1;
@@ -2739,7 +2867,8 @@ void CFEM_DG_EulerSolver::Initiate_MPI_Communication(CConfig *config,
 
         for(unsigned short k=0; k<nTimeDOFs; ++k) {
           const unsigned long indS = nVar*(volElem[jj].offsetDOFsSolLocal + k*nDOFsLocTot);
-          memcpy(sendBuf+ii, commData+indS, nBytes);
+          if( commDataFloat ) CopyPredictorData(sendBuf+ii, commDataFloat+indS, nItems);
+          else                memcpy(sendBuf+ii, commData+indS, nBytes);
           ii += nItems;
         }
       }
@@ -2778,9 +2907,12 @@ bool CFEM_DG_EulerSolver::Complete_MPI_Communication(CConfig *config,
      working solution is communicated, there is only one time level. */
   unsigned short nTimeDOFs;
   su2double *commData;
+  float *commDataFloat = nullptr;
   if(config->GetKind_TimeIntScheme_Flow() == ADER_DG) {
     nTimeDOFs = config->GetnTimeDOFsADER_DG();
     commData  = VecSolDOFsPredictorADER.data();
+    if( config->GetADER_Predictor_SinglePrecision() )
+      commDataFloat = VecSolDOFsPredictorADERFloat.data();
   }
   else {
     nTimeDOFs = 1;
@@ -2825,7 +2957,8 @@ bool CFEM_DG_EulerSolver::Complete_MPI_Communication(CConfig *config,
 
         for(unsigned short k=0; k<nTimeDOFs; ++k) {
           const unsigned long indR = nVar*(volElem[jj].offsetDOFsSolLocal + k*nDOFsLocTot);
-          memcpy(commData+indR, recvBuf+ii, nBytes);
+          if( commDataFloat ) CopyPredictorData(commDataFloat+indR, recvBuf+ii, nItems);
+          else                memcpy(commData+indR, recvBuf+ii, nBytes);
           ii += nItems;
         }
       }
@@ -2841,13 +2974,14 @@ bool CFEM_DG_EulerSolver::Complete_MPI_Communication(CConfig *config,
   for(unsigned long i=0; i<elementsSendSelfComm[timeLevel].size(); ++i) {
     const unsigned long elemS  = elementsSendSelfComm[timeLevel][i];
     const unsigned long elemR  = elementsRecvSelfComm[timeLevel][i];
-    const unsigned long nBytes = volElem[elemS].nDOFsSol * nVar*sizeof(su2double);
+    const unsigned long nItems = volElem[elemS].nDOFsSol * nVar;
 
     for(unsigned short j=0; j<nTimeDOFs; ++j) {
       const unsigned long indS = nVar*(volElem[elemS].offsetDOFsSolLocal + j*nDOFsLocTot);
       const unsigned long indR = nVar*(volElem[elemR].offsetDOFsSolLocal + j*nDOFsLocTot);
 
-      memcpy(commData+indR, commData+indS, nBytes);
+      if( commDataFloat ) CopyPredictorData(commDataFloat+indR, commDataFloat+indS, nItems);
+      else                CopyPredictorData(commData+indR, commData+indS, nItems);
     }
   }
 
@@ -2888,17 +3022,13 @@ bool CFEM_DG_EulerSolver::Complete_MPI_Communication(CConfig *config,
         const unsigned long ind     = halosRotationalPeriodicity[timeLevel][k][j];
         for(unsigned short i=0; i<volElem[ind].nDOFsSol; ++i) {
 
-          /* Determine the pointer in commData where the solution of this DOF
-             is stored and copy the momentum variables. Note that a rotational
+          /* Determine the position in commData where the solution of this DOF
+             is stored and correct the momentum variables. Note that a rotational
              correction can only take place for a 3D simulation. */
-          su2double *sol = commData + nVar*(volElem[ind].offsetDOFsSolLocal + i + tIndOff);
-
-          const su2double ru = sol[1], rv = sol[2], rw = sol[3];
+          const unsigned long indSol = nVar*(volElem[ind].offsetDOFsSolLocal + i + tIndOff);
 
-          /* Correct the momentum variables. */
-          sol[1] = rotMatrix[0][0]*ru + rotMatrix[0][1]*rv + rotMatrix[0][2]*rw;
-          sol[2] = rotMatrix[1][0]*ru + rotMatrix[1][1]*rv + rotMatrix[1][2]*rw;
-          sol[3] = rotMatrix[2][0]*ru + rotMatrix[2][1]*rv + rotMatrix[2][2]*rw;
+          if( commDataFloat ) RotateMomentum(commDataFloat+indSol, rotMatrix);
+          else                RotateMomentum(commData+indSol, rotMatrix);
         }
       }
     }
@@ -3412,7 +3542,30 @@ void CFEM_DG_EulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_co
 }
 
 void CFEM_DG_EulerSolver::Postprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config,
-                                      unsigned short iMesh) { }
+                                      unsigned short iMesh) {
+
+  /*--- Check if the cost of the elements is measured. ---*/
+  if( elemCostThreads.empty() ) return;
+
+  /*--- The first time step is not taken into account, because it contains
+        the overhead of the initialization, e.g. the tuning of the kernels
+        of the matrix multiplications. ---*/
+  if(nTimeStepsElemCost < 0) {
+    for(unsigned long i=0; i<elemCostThreads.size(); ++i)
+      fill(elemCostThreads[i].begin(), elemCostThreads[i].end(), 0.0);
+    nTimeStepsElemCost = 0;
+    return;
+  }
+  ++nTimeStepsElemCost;
+
+  /*--- Write the cost at the frequency of the volume output and at the end of the computation. ---*/
+  const bool timeDomain  = config->GetTime_Domain();
+  const unsigned long iter  = timeDomain ? config->GetTimeIter()   : config->GetInnerIter();
+  const unsigned long nIter = timeDomain ? config->GetnTime_Iter() : config->GetnInner_Iter();
+
+  if(((iter+1)%config->GetVolume_Wrt_Freq() == 0) || (iter+1 == nIter))
+    WriteElementCost(config);
+}
 
 void CFEM_DG_EulerSolver::ComputeSpatialJacobian(CGeometry *geometry,  CSolver **solver_container,
                                                  CNumerics **numerics, CConfig *config,
@@ -3468,7 +3621,7 @@ void CFEM_DG_EulerSolver::ComputeSpatialJacobian(CGeometry *geometry,  CSolver *
         su2double *solDOF = VecWorkSolDOFs[0].data() + jj*nVar;
 
 #ifdef CODI_FORWARD_TYPE
-        solDOF[var].setGradient(1.0);
+        SU2_TYPE::SetDerivative(solDOF[var], 1.0);
 #else
         solDOF[var] += 0.001;   /* This is to avoid a compiler warning. */
 #endif
@@ -3496,7 +3649,7 @@ void CFEM_DG_EulerSolver::ComputeSpatialJacobian(CGeometry *geometry,  CSolver *
           /* Store the matrix entries. */
           for(unsigned short j=0; j<nVar; ++j) {
 #ifdef CODI_FORWARD_TYPE
-            Jac[var+j*nVar] = resDOF[j].getGradient();
+            Jac[var+j*nVar] = SU2_TYPE::GetDerivative(resDOF[j]);
 #else
             Jac[var+j*nVar] = 0.0;   /* This is to avoid a compiler warning. */
 #endif
@@ -3511,7 +3664,7 @@ void CFEM_DG_EulerSolver::ComputeSpatialJacobian(CGeometry *geometry,  CSolver *
         su2double *solDOF = VecWorkSolDOFs[0].data() + jj*nVar;
 
 #ifdef CODI_FORWARD_TYPE
-        solDOF[var].setGradient(0.0);
+        SU2_TYPE::SetDerivative(solDOF[var], 0.0);
 #else
         solDOF[var] -= 0.001;   /* This is to avoid a compiler warning. */
 #endif
@@ -3574,6 +3727,182 @@ void CFEM_DG_EulerSolver::ComputeSpatialJacobian(CGeometry *geometry,  CSolver *
   }
 }
 
+void CFEM_DG_EulerSolver::ImplicitNewtonKrylov_Iteration(CGeometry      *geometry,
+                                                         CSolver        **solver_container,
+                                                         CNumerics      **numerics,
+                                                         CConfig        *config,
+                                                         unsigned short iMesh) {
+
+  /* Keep the residual of the current state, computed in the space integration,
+     because VecResDOFs is overwritten by the residuals of the perturbed states. */
+  const unsigned long nVarOwned = nVar*nDOFsLocOwned;
+  memcpy(VecResDOFsImplicit.data(), VecResDOFs.data(), nVarOwned*sizeof(su2double));
+
+  /* Determine the step of the finite differences, relative to the rms of the solution. */
+  su2double sumSol2 = 0.0;
+  for(unsigned long i=0; i<nVarOwned; ++i) sumSol2 += VecSolDOFs[i]*VecSolDOFs[i];
+
+#ifdef HAVE_MPI
+  su2double sumSol2Loc = sumSol2;
+  SU2_MPI::Allreduce(&sumSol2Loc, &sumSol2, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#endif
+
+  const su2double rmsSolution = sqrt(sumSol2/(nVar*nDOFsGlobal));
+  finDiffStepImplicit = config->GetNewtonKrylov_FinDiffStep()*(1.0 + rmsSolution);
+
+  /* Update the Jacobian, i.e. the preconditioner, at the requested frequency. */
+  if(nIterImplicit%config->GetJacobian_Frequency_DGFEM() == 0)
+    ComputeJacobianImplicit(geometry, solver_container, numerics, config, iMesh);
+  ++nIterImplicit;
+
+  /*--- Update the pseudo time term of the Jacobian, which changes with the time
+        step, and set the right hand side and initial guess of the system. ---*/
+  for(unsigned long l=0; l<nVolElemOwned; ++l) {
+    const su2double timeTerm = 1.0/VecDeltaTime[l];
+
+    for(unsigned short i=0; i<volElem[l].nDOFsSol; ++i) {
+      const unsigned long ii = volElem[l].offsetDOFsSolLocal + i;
+
+      Jacobian.AddVal2Diag(ii, timeTerm - timeTermJacobian[ii]);
+      timeTermJacobian[ii] = timeTerm;
+
+      for(unsigned short k=0; k<nVar; ++k) {
+        LinSysRes(ii,k) = -VecResDOFsImplicit[ii*nVar+k];
+        LinSysSol(ii,k) = 0.0;
+      }
+    }
+  }
+
+  /*--- Solve the system with the matrix-free products. ---*/
+  const CMatrixFreeProduct product(*this, geometry, solver_container, numerics, config, iMesh);
+
+  const unsigned long iter = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config, &product);
+  SetIterLinSolver(iter);
+  SetResLinSolver(System.GetResidual());
+
+  /* Update the solution of the owned DOFs. */
+  for(unsigned long i=0; i<nDOFsLocOwned; ++i) {
+    for(unsigned short k=0; k<nVar; ++k)
+      VecSolDOFs[i*nVar+k] += LinSysSol(i,k);
+  }
+
+  /* Restore the residual of the state before the update, which is monitored. */
+  memcpy(VecResDOFs.data(), VecResDOFsImplicit.data(), nVarOwned*sizeof(su2double));
+
+  /*--- Compute the root mean square residual. Note that the SetResidual_RMS
+        function of CSolver cannot be used, because that is for the FV solver. ---*/
+  SetResidual_RMS_FEM(geometry, config);
+
+  /*--- For verification cases, compute the global error metrics. ---*/
+  ComputeVerificationError(geometry, config);
+}
+
+void CFEM_DG_EulerSolver::ComputeJacobianImplicit(CGeometry      *geometry,
+                                                  CSolver        **solver_container,
+                                                  CNumerics      **numerics,
+                                                  CConfig        *config,
+                                                  unsigned short iMesh) {
+
+  /* Reset the Jacobian, the pseudo time term is added again afterwards. */
+  Jacobian.SetValZero();
+  timeTermJacobian.assign(nDOFsLocOwned, 0.0);
+
+  /* Easier storage of the global index of the first owned DOF, the relative step
+     of the finite differences and the working solution, which is perturbed. */
+  const unsigned long offsetRank = nDOFsPerRank[rank];
+  const su2double relStep = config->GetNewtonKrylov_FinDiffStep();
+  su2double *solWork = VecWorkSolDOFs[0].data();
+
+  /* Start from the unperturbed solution. */
+  Set_OldSolution(geometry);
+
+  /*--- Loop over the colors and the number of variables. The DOFs of a color are
+        perturbed simultaneously, such that the residual of every DOF depends on at
+        most one perturbed DOF, see MetaDataJacobianComputation. ---*/
+  for(int color=0; color<nGlobalColors; ++color) {
+    for(unsigned short var=0; var<nVar; ++var) {
+
+      /* Perturb the owned DOFs of this color, the halo DOFs are communicated in
+         the task list. */
+      for(unsigned long j=0; j<localDOFsPerColor[color].size(); ++j) {
+        const unsigned long jj = localDOFsPerColor[color][j]*nVar + var;
+        solWork[jj] += relStep*(1.0 + fabs(VecSolDOFs[jj]));
+      }
+
+      /* Carry out all the tasks to compute the residual. */
+      ProcessTaskList_DG(geometry, solver_container, numerics, config, iMesh);
+
+      /* Loop over the owned DOFs and store the column of their Jacobian block,
+         if the perturbed DOF is owned and the block is part of the pattern. */
+      for(unsigned long i=0; i<nDOFsLocOwned; ++i) {
+        const int ind = colorToIndEntriesJacobian[i][color];
+        if(ind < 0) continue;
+
+        const unsigned long jj = nonZeroEntriesJacobian[i][ind];
+        if((jj < offsetRank) || (jj >= offsetRank+nDOFsLocOwned)) continue;
+
+        const unsigned long j = jj - offsetRank;
+        ScalarImplicit *Jac = Jacobian.GetBlock(i, j);
+        if( !Jac ) continue;
+
+        const su2double epsInv = 1.0/(solWork[j*nVar+var] - VecSolDOFs[j*nVar+var]);
+        for(unsigned short k=0; k<nVar; ++k)
+          Jac[k*nVar+var] = ToScalar<ScalarImplicit>(epsInv*(VecResDOFs[i*nVar+k] - VecResDOFsImplicit[i*nVar+k]));
+      }
+
+      /* Reset the perturbations for this color. */
+      for(unsigned long j=0; j<localDOFsPerColor[color].size(); ++j) {
+        const unsigned long jj = localDOFsPerColor[color][j]*nVar + var;
+        solWork[jj] = VecSolDOFs[jj];
+      }
+    }
+  }
+}
+
+void CFEM_DG_EulerSolver::MatrixFreeProduct(const CSysVector<ScalarImplicit> &u,
+                                            CSysVector<ScalarImplicit>       &v,
+                                            CGeometry                        *geometry,
+                                            CSolver                          **solver_container,
+                                            CNumerics                        **numerics,
+                                            CConfig                          *config,
+                                            unsigned short                   iMesh) {
+
+  /* Determine the step of the finite differences for this direction. */
+  const su2double rmsDirection = u.norm()/sqrt(su2double(nVar*nDOFsGlobal));
+
+  if(rmsDirection == 0.0) {
+    v = ScalarImplicit(0.0);
+    return;
+  }
+
+  const su2double eps = finDiffStepImplicit/rmsDirection;
+
+  /* Perturb the working solution of the owned DOFs, the halo DOFs are
+     communicated in the task list. */
+  su2double *solWork = VecWorkSolDOFs[0].data();
+  for(unsigned long i=0; i<nDOFsLocOwned; ++i) {
+    for(unsigned short k=0; k<nVar; ++k)
+      solWork[i*nVar+k] = VecSolDOFs[i*nVar+k] + eps*u(i,k);
+  }
+
+  /* Carry out all the tasks to compute the residual of the perturbed state. */
+  ProcessTaskList_DG(geometry, solver_container, numerics, config, iMesh);
+
+  /* Finite differences plus the pseudo time term. */
+  for(unsigned long l=0; l<nVolElemOwned; ++l) {
+    const su2double timeTerm = 1.0/VecDeltaTime[l];
+
+    for(unsigned short i=0; i<volElem[l].nDOFsSol; ++i) {
+      const unsigned long ii = volElem[l].offsetDOFsSolLocal + i;
+
+      for(unsigned short k=0; k<nVar; ++k) {
+        const su2double dRes = (VecResDOFs[ii*nVar+k] - VecResDOFsImplicit[ii*nVar+k])/eps;
+        v(ii,k) = ToScalar<ScalarImplicit>(timeTerm*u(ii,k) + dRes);
+      }
+    }
+  }
+}
+
 void CFEM_DG_EulerSolver::Set_OldSolution(CGeometry *geometry) {
 
   memcpy(VecWorkSolDOFs[0].data(), VecSolDOFs.data(), VecSolDOFs.size()*sizeof(su2double));
@@ -3780,80 +4109,103 @@ void CFEM_DG_EulerSolver::CheckTimeSynchronization(CConfig         *config,
 void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **solver_container,
                                              CNumerics **numerics, CConfig *config,
                                              unsigned short iMesh) {
-  /* Easier storage of the number of time levels.. */
-  const unsigned short nTimeLevels = config->GetnLevels_TimeAccurateLTS();
-
-  /* Define and initialize the bool vector, that indicates whether or
-     not the tasks from the list have been completed. */
-  vector<bool> taskCompleted(tasksList.size(), false);
-
-  /* Allocate the memory for the work array and initialize it to zero to avoid
-     warnings in debug mode  about uninitialized memory when padding is applied. */
-  vector<su2double> workArrayVec(sizeWorkArray, 0.0);
-  su2double *workArray = workArrayVec.data();
 
-  /* While loop to carry out all the tasks in tasksList. */
-  unsigned long lowestIndexInList = 0;
-  while(lowestIndexInList < tasksList.size()) {
+  /*--------------------------------------------------------------------------*/
+  /*--- The master thread walks through the list of tasks and carries out  ---*/
+  /*--- the MPI communication (MPI is initialized with funneled threading)  ---*/
+  /*--- as well as the tasks involving faces and boundaries, which use the  ---*/
+  /*--- numerics and the work variables of the solver. The element based   ---*/
+  /*--- tasks are split in chunks of elements and spawned as OpenMP tasks,  ---*/
+  /*--- such that they are carried out by the other threads, overlapping   ---*/
+  /*--- with the communication. Without OpenMP the tasks are carried out    ---*/
+  /*--- immediately, i.e. in the same order as the sequential algorithm.    ---*/
+  /*--------------------------------------------------------------------------*/
 
-    /* Find the next task that can be carried out. The outer loop is there
-       to make sure that a communication is completed in case there are no
-       other tasks */
-    for(unsigned short j=0; j<2; ++j) {
+  /* Number of threads, limited by the number of fluid models. */
+  const int nThreads = max(1, min(omp_get_max_threads(), int(FluidModelThreads.size())));
+
+  /* Define and initialize the vectors that indicate whether or not the tasks
+     from the list have been started and completed. These are not vector<bool>,
+     because the completion is set by the threads that carry out the tasks. */
+  vector<char> taskStarted(tasksList.size(), false);
+  vector<char> taskCompleted(tasksList.size(), false);
+
+  /* Number of chunks of each task that are still to be carried out. */
+  vector<unsigned long> nChunksToDo(tasksList.size(), 0);
+
+  /* Allocate the memory for the work arrays of the threads and initialize it to zero
+     to avoid warnings in debug mode about uninitialized memory when padding is applied. */
+  vector<vector<su2double> > workArrayVec(nThreads, vector<su2double>(sizeWorkArray, 0.0));
+
+  /* Allocate the memory to accumulate the measured cost of the owned elements. */
+  if(config->GetMeasure_ElemCost_DGFEM() && elemCostThreads.empty())
+    elemCostThreads.assign(omp_get_max_threads(), vector<passivedouble>(nVolElemOwned, 0.0));
+
+  /* Lambdas to read and set the completion of a task. The flushes make sure
+     that the data computed in a task is seen by the tasks that depend on it. */
+  auto isCompleted = [&](const unsigned long i) {
+    char completed;
+    SU2_OMP(atomic read)
+    completed = taskCompleted[i];
+    SU2_OMP(flush)
+    return (completed != 0);
+  };
+
+  auto setCompleted = [&](const unsigned long i) {
+    SU2_OMP(flush)
+    SU2_OMP(atomic write)
+    taskCompleted[i] = true;
+  };
+
+  /* Lambda to carry out a chunk of a task and set the completion of the task
+     when its last chunk is finished. */
+  auto carryOutChunk = [&](const unsigned long i, const unsigned long elemBeg,
+                           const unsigned long elemEnd) {
+    CarryOutTask_DG(config, numerics, tasksList[i], elemBeg, elemEnd,
+                    workArrayVec[omp_get_thread_num()].data());
+    unsigned long nLeft;
+    SU2_OMP(atomic capture)
+    nLeft = --nChunksToDo[i];
+    if(nLeft == 0) setCompleted(i);
+  };
+
+  SU2_OMP_PARALLEL_ON(nThreads)
+  SU2_OMP_MASTER
+  {
+    su2double *workArray = workArrayVec[omp_get_thread_num()].data();
+
+    /* While loop to carry out all the tasks in tasksList. */
+    unsigned long lowestIndexInList = 0;
+    while(lowestIndexInList < tasksList.size()) {
+
+      /* Find the next task that can be carried out. The outer loop is there
+         to make sure that a communication is completed in case there are no
+         other tasks */
       bool taskCarriedOut = false;
-      for(unsigned long i=lowestIndexInList; i<tasksList.size(); ++i) {
-
-        /* Determine whether or not it can be attempted to carry out
-           this task. */
-        bool taskCanBeCarriedOut = !taskCompleted[i];
-        for(unsigned short ind=0; ind<tasksList[i].nIndMustBeCompleted; ++ind) {
-          if( !taskCompleted[tasksList[i].indMustBeCompleted[ind]] )
-            taskCanBeCarriedOut = false;
-        }
+      for(unsigned short j=0; j<2; ++j) {
+        for(unsigned long i=lowestIndexInList; i<tasksList.size(); ++i) {
+
+          /* Determine whether or not it can be attempted to carry out
+             this task. */
+          if( taskStarted[i] ) continue;
+          bool taskCanBeCarriedOut = true;
+          for(unsigned short ind=0; ind<tasksList[i].nIndMustBeCompleted; ++ind) {
+            if( !isCompleted(tasksList[i].indMustBeCompleted[ind]) ) {
+              taskCanBeCarriedOut = false;
+              break;
+            }
+          }
 
-        if( taskCanBeCarriedOut ) {
+          if( !taskCanBeCarriedOut ) continue;
 
           /*--- Determine the actual task to be carried out and do so. The
                 only tasks that may fail are the completion of the non-blocking
                 communication. If that is the case the next task needs to be
                 found. ---*/
+          bool spawnTask = true;
+          unsigned long elemBeg = 0, elemEnd = 0;
           switch( tasksList[i].task ) {
 
-            case CTaskDefinition::ADER_PREDICTOR_STEP_COMM_ELEMENTS: {
-
-              /* Carry out the ADER predictor step for the elements whose
-                 solution must be communicated for this time level. */
-              const unsigned short level   = tasksList[i].timeLevel;
-              const unsigned long  elemBeg = nVolElemOwnedPerTimeLevel[level]
-                                           + nVolElemInternalPerTimeLevel[level];
-              const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level+1];
-
-              ADER_DG_PredictorStep(config, elemBeg, elemEnd, workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
-
-            case CTaskDefinition::ADER_PREDICTOR_STEP_INTERNAL_ELEMENTS: {
-
-              /* Carry out the ADER predictor step for the elements whose
-                 solution must not be communicated for this time level. */
-              const unsigned short level   = tasksList[i].timeLevel;
-              const unsigned long  elemBeg = nVolElemOwnedPerTimeLevel[level];
-              const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level]
-                                           + nVolElemInternalPerTimeLevel[level];
-              ADER_DG_PredictorStep(config, elemBeg, elemEnd, workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
-
-            case CTaskDefinition::INITIATE_MPI_COMMUNICATION: {
-
-              /* Start the MPI communication of the solution in the halo elements. */
-              Initiate_MPI_Communication(config, tasksList[i].timeLevel);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
-
             case CTaskDefinition::COMPLETE_MPI_COMMUNICATION: {
 
               /* Attempt to complete the MPI communication of the solution data.
@@ -3862,232 +4214,428 @@ void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **sol
                  the list is carried out. If j==1, this means that the next
                  tasks are waiting for this communication to be completed and
                  hence MPI_Waitall is used. */
+              spawnTask = false;
               if( Complete_MPI_Communication(config, tasksList[i].timeLevel,
-                                             j==1) )
-                taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
-
-            case CTaskDefinition::INITIATE_REVERSE_MPI_COMMUNICATION: {
-
-              /* Start the communication of the residuals, for which the
-                 reverse communication must be used. */
-              Initiate_MPI_ReverseCommunication(config, tasksList[i].timeLevel);
-              taskCarriedOut = taskCompleted[i] = true;
+                                             j==1) ) {
+                taskCarriedOut = taskStarted[i] = true;
+                setCompleted(i);
+              }
               break;
             }
 
             case CTaskDefinition::COMPLETE_REVERSE_MPI_COMMUNICATION: {
 
-              /* Attempt to complete the MPI communication of the residual data.
-                 For j==0, SU2_MPI::Testall will be used, which returns false if
-                 not all requests can be completed. In that case the next task on
-                 the list is carried out. If j==1, this means that the next
-                 tasks are waiting for this communication to be completed and
-                 hence MPI_Waitall is used. */
+              /* Attempt to complete the MPI communication of the residual data,
+                 see above. */
+              spawnTask = false;
               if( Complete_MPI_ReverseCommunication(config, tasksList[i].timeLevel,
-                                                    j==1) )
-                taskCarriedOut = taskCompleted[i] = true;
+                                                    j==1) ) {
+                taskCarriedOut = taskStarted[i] = true;
+                setCompleted(i);
+              }
               break;
             }
 
-            case CTaskDefinition::ADER_TIME_INTERPOLATE_OWNED_ELEMENTS: {
-
-              /* Interpolate the predictor solution of the owned elements
-                 in time to the given time integration point for the
-                 given time level. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long nAdjElem = 0, *adjElem = NULL;
-              if(level < (nTimeLevels-1)) {
-                nAdjElem = ownedElemAdjLowTimeLevel[level+1].size();
-                adjElem  = ownedElemAdjLowTimeLevel[level+1].data();
-              }
+            case CTaskDefinition::INITIATE_MPI_COMMUNICATION:
+            case CTaskDefinition::INITIATE_REVERSE_MPI_COMMUNICATION:
+            case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_OWNED_ELEMENTS:
+            case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_HALO_ELEMENTS:
+            case CTaskDefinition::SURFACE_RESIDUAL_OWNED_ELEMENTS:
+            case CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS:
+            case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_OWNED:
+            case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO: {
 
-              ADER_DG_TimeInterpolatePredictorSol(config, tasksList[i].intPointADER,
-                                                  nVolElemOwnedPerTimeLevel[level],
-                                                  nVolElemOwnedPerTimeLevel[level+1],
-                                                  nAdjElem, adjElem,
-                                                  tasksList[i].secondPartTimeIntADER,
-                                                  VecWorkSolDOFs[level].data());
-              taskCarriedOut = taskCompleted[i] = true;
+              /* Tasks carried out by the master thread itself. */
+              spawnTask = false;
+              CarryOutTask_DG(config, numerics, tasksList[i], 0, 0, workArray);
+              taskCarriedOut = taskStarted[i] = true;
+              setCompleted(i);
               break;
             }
 
-            case CTaskDefinition::ADER_TIME_INTERPOLATE_HALO_ELEMENTS: {
+            case CTaskDefinition::ADER_PREDICTOR_STEP_COMM_ELEMENTS: {
 
-              /* Interpolate the predictor solution of the halo elements
-                 in time to the given time integration point for the
-                 given time level. */
+              /* The elements whose solution must be communicated. */
               const unsigned short level = tasksList[i].timeLevel;
-              unsigned long nAdjElem = 0, *adjElem = NULL;
-              if(level < (nTimeLevels-1)) {
-                nAdjElem = haloElemAdjLowTimeLevel[level+1].size();
-                adjElem  = haloElemAdjLowTimeLevel[level+1].data();
-              }
-
-              ADER_DG_TimeInterpolatePredictorSol(config, tasksList[i].intPointADER,
-                                                  nVolElemHaloPerTimeLevel[level],
-                                                  nVolElemHaloPerTimeLevel[level+1],
-                                                  nAdjElem, adjElem,
-                                                  tasksList[i].secondPartTimeIntADER,
-                                                  VecWorkSolDOFs[level].data());
-              taskCarriedOut = taskCompleted[i] = true;
+              elemBeg = nVolElemOwnedPerTimeLevel[level] + nVolElemInternalPerTimeLevel[level];
+              elemEnd = nVolElemOwnedPerTimeLevel[level+1];
               break;
             }
 
-            case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_OWNED_ELEMENTS: {
+            case CTaskDefinition::ADER_PREDICTOR_STEP_INTERNAL_ELEMENTS: {
 
-              /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
+              /* The elements whose solution must not be communicated. */
               const unsigned short level = tasksList[i].timeLevel;
-              Shock_Capturing_DG(config, nVolElemOwnedPerTimeLevel[level],
-                                 nVolElemOwnedPerTimeLevel[level+1], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
+              elemBeg = nVolElemOwnedPerTimeLevel[level];
+              elemEnd = nVolElemOwnedPerTimeLevel[level] + nVolElemInternalPerTimeLevel[level];
               break;
             }
 
-            case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_HALO_ELEMENTS: {
+            case CTaskDefinition::VOLUME_RESIDUAL:
+            case CTaskDefinition::MULTIPLY_INVERSE_MASS_MATRIX:
+            case CTaskDefinition::ADER_UPDATE_SOLUTION: {
 
-              /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
+              /* The owned elements of the time level. */
               const unsigned short level = tasksList[i].timeLevel;
-              Shock_Capturing_DG(config, nVolElemHaloPerTimeLevel[level],
-                                 nVolElemHaloPerTimeLevel[level+1], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
+              elemBeg = nVolElemOwnedPerTimeLevel[level];
+              elemEnd = nVolElemOwnedPerTimeLevel[level+1];
               break;
             }
 
-            case CTaskDefinition::VOLUME_RESIDUAL: {
+            default: {
 
-              /*--- Compute the volume portion of the residual. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              Volume_Residual(config, nVolElemOwnedPerTimeLevel[level],
-                              nVolElemOwnedPerTimeLevel[level+1], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
+              /* The remaining tasks are spawned as a whole, i.e. as one chunk. */
+              elemEnd = 1;
               break;
             }
+          }
 
-            case CTaskDefinition::SURFACE_RESIDUAL_OWNED_ELEMENTS: {
+          /* Spawn the chunks of the element based tasks. The number of chunks
+             is such that the load can be balanced over the threads. */
+          if( spawnTask ) {
+            taskCarriedOut = taskStarted[i] = true;
 
-              /* Compute the residual of the faces that only involve owned elements. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long indResFaces = startLocResInternalFacesLocalElem[level];
-              ResidualFaces(config, nMatchingInternalFacesLocalElem[level],
-                            nMatchingInternalFacesLocalElem[level+1],
-                            indResFaces, numerics[CONV_TERM], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+            const unsigned long nElem     = elemEnd - elemBeg;
+            const unsigned long chunkSize = roundUpDiv(nElem, 4*nThreads);
 
-            case CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS: {
+            if(nElem == 0) setCompleted(i);
+            nChunksToDo[i] = roundUpDiv(nElem, max(chunkSize, 1ul));
+            SU2_OMP(flush)
 
-              /* Compute the residual of the faces that involve a halo element. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long indResFaces = startLocResInternalFacesWithHaloElem[level];
-              ResidualFaces(config, nMatchingInternalFacesWithHaloElem[level],
-                            nMatchingInternalFacesWithHaloElem[level+1],
-                            indResFaces, numerics[CONV_TERM], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
+            for(unsigned long chunkBeg=elemBeg; chunkBeg<elemEnd; chunkBeg+=chunkSize) {
+              const unsigned long chunkEnd = min(chunkBeg+chunkSize, elemEnd);
+              SU2_OMP(task firstprivate(i, chunkBeg, chunkEnd))
+              carryOutChunk(i, chunkBeg, chunkEnd);
             }
+          }
 
-            case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_OWNED: {
+          /* Break the inner loop if a task has been carried out. */
+          if( taskCarriedOut ) break;
+        }
 
-              /*--- Apply the boundary conditions that only depend on data
-                    of owned elements. ---*/
-              Boundary_Conditions(tasksList[i].timeLevel, config, numerics, false,
-                                  workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+        /* Break the outer loop if a task has been carried out. */
+        if( taskCarriedOut ) break;
 
-            case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO: {
+        /* Nothing could be started, which means that the next tasks are
+           waiting for either the communication or the spawned tasks. Help
+           carrying out the spawned tasks before waiting for the communication. */
+        if(j == 0) {
+          SU2_OMP(taskyield)
+        }
+      }
 
-              /*--- Apply the boundary conditions that also depend on data
-                    of halo elements. ---*/
-              Boundary_Conditions(tasksList[i].timeLevel, config, numerics, true,
-                                  workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /* Update the value of lowestIndexInList. */
+      for(; lowestIndexInList < tasksList.size(); ++lowestIndexInList)
+        if( !isCompleted(lowestIndexInList) ) break;
+    }
 
-            case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_OWNED_ELEMENTS: {
+    SU2_OMP(taskwait)
+  }
+}
 
-              /* Create the final residual by summing up all contributions. */
-              CreateFinalResidual(tasksList[i].timeLevel, true);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+void CFEM_DG_EulerSolver::CarryOutTask_DG(CConfig               *config,
+                                          CNumerics             **numerics,
+                                          const CTaskDefinition &task,
+                                          const unsigned long   elemBeg,
+                                          const unsigned long   elemEnd,
+                                          su2double             *workArray) {
 
-            case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_HALO_ELEMENTS: {
+  /* Easier storage of the number of time levels.. */
+  const unsigned short nTimeLevels = config->GetnLevels_TimeAccurateLTS();
 
-              /* Create the final residual by summing up all contributions. */
-              CreateFinalResidual(tasksList[i].timeLevel, false);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+  /* Start time of the task, used when the cost of the elements is measured. */
+  const auto timeBeg = chrono::steady_clock::now();
 
-            case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_OWNED_ELEMENTS: {
+  switch( task.task ) {
 
-              /* Accumulate the space time residuals for the owned elements
-                 for ADER-DG. */
-              AccumulateSpaceTimeResidualADEROwnedElem(config, tasksList[i].timeLevel,
-                                                       tasksList[i].intPointADER);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::ADER_PREDICTOR_STEP_COMM_ELEMENTS:
+    case CTaskDefinition::ADER_PREDICTOR_STEP_INTERNAL_ELEMENTS: {
 
-            case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_HALO_ELEMENTS: {
+      /* Carry out the ADER predictor step for the given elements. */
+      ADER_DG_PredictorStep(config, elemBeg, elemEnd, workArray);
+      break;
+    }
 
-              /* Accumulate the space time residuals for the halo elements
-                 for ADER-DG. */
-              AccumulateSpaceTimeResidualADERHaloElem(config, tasksList[i].timeLevel,
-                                                      tasksList[i].intPointADER);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::INITIATE_MPI_COMMUNICATION: {
 
-            case CTaskDefinition::MULTIPLY_INVERSE_MASS_MATRIX: {
+      /* Start the MPI communication of the solution in the halo elements. */
+      Initiate_MPI_Communication(config, task.timeLevel);
+      break;
+    }
 
-              /*--- Multiply the residual by the (lumped) mass matrix, to obtain the final value. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              const bool useADER = config->GetKind_TimeIntScheme() == ADER_DG;
-              MultiplyResidualByInverseMassMatrix(config, useADER,
-                                                  nVolElemOwnedPerTimeLevel[level],
-                                                  nVolElemOwnedPerTimeLevel[level+1],
-                                                  workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::INITIATE_REVERSE_MPI_COMMUNICATION: {
 
-            case CTaskDefinition::ADER_UPDATE_SOLUTION: {
+      /* Start the communication of the residuals, for which the
+         reverse communication must be used. */
+      Initiate_MPI_ReverseCommunication(config, task.timeLevel);
+      break;
+    }
 
-              /*--- Perform the update step for ADER-DG. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              ADER_DG_Iteration(nVolElemOwnedPerTimeLevel[level],
-                                nVolElemOwnedPerTimeLevel[level+1]);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::ADER_TIME_INTERPOLATE_OWNED_ELEMENTS: {
 
-            default: {
+      /* Interpolate the predictor solution of the owned elements
+         in time to the given time integration point for the
+         given time level. */
+      const unsigned short level = task.timeLevel;
+      unsigned long nAdjElem = 0, *adjElem = NULL;
+      if(level < (nTimeLevels-1)) {
+        nAdjElem = ownedElemAdjLowTimeLevel[level+1].size();
+        adjElem  = ownedElemAdjLowTimeLevel[level+1].data();
+      }
 
-              cout << "Task not defined. This should not happen." << endl;
-              exit(1);
-            }
-          }
-        }
+      ADER_DG_TimeInterpolatePredictorSol(config, task.intPointADER,
+                                          nVolElemOwnedPerTimeLevel[level],
+                                          nVolElemOwnedPerTimeLevel[level+1],
+                                          nAdjElem, adjElem,
+                                          task.secondPartTimeIntADER,
+                                          VecWorkSolDOFs[level].data());
+      break;
+    }
 
-        /* Break the inner loop if a task has been carried out. */
-        if( taskCarriedOut ) break;
+    case CTaskDefinition::ADER_TIME_INTERPOLATE_HALO_ELEMENTS: {
+
+      /* Interpolate the predictor solution of the halo elements
+         in time to the given time integration point for the
+         given time level. */
+      const unsigned short level = task.timeLevel;
+      unsigned long nAdjElem = 0, *adjElem = NULL;
+      if(level < (nTimeLevels-1)) {
+        nAdjElem = haloElemAdjLowTimeLevel[level+1].size();
+        adjElem  = haloElemAdjLowTimeLevel[level+1].data();
       }
 
-      /* Break the outer loop if a task has been carried out. */
-      if( taskCarriedOut ) break;
+      ADER_DG_TimeInterpolatePredictorSol(config, task.intPointADER,
+                                          nVolElemHaloPerTimeLevel[level],
+                                          nVolElemHaloPerTimeLevel[level+1],
+                                          nAdjElem, adjElem,
+                                          task.secondPartTimeIntADER,
+                                          VecWorkSolDOFs[level].data());
+      break;
+    }
+
+    case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_OWNED_ELEMENTS: {
+
+      /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
+      const unsigned short level = task.timeLevel;
+      Shock_Capturing_DG(config, nVolElemOwnedPerTimeLevel[level],
+                         nVolElemOwnedPerTimeLevel[level+1], workArray);
+      break;
+    }
+
+    case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_HALO_ELEMENTS: {
+
+      /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
+      const unsigned short level = task.timeLevel;
+      Shock_Capturing_DG(config, nVolElemHaloPerTimeLevel[level],
+                         nVolElemHaloPerTimeLevel[level+1], workArray);
+      break;
+    }
+
+    case CTaskDefinition::VOLUME_RESIDUAL: {
+
+      /*--- Compute the volume portion of the residual of the given elements. ---*/
+      Volume_Residual(config, elemBeg, elemEnd, workArray);
+      break;
+    }
+
+    case CTaskDefinition::SURFACE_RESIDUAL_OWNED_ELEMENTS: {
+
+      /* Compute the residual of the faces that only involve owned elements. */
+      const unsigned short level = task.timeLevel;
+      unsigned long indResFaces = startLocResInternalFacesLocalElem[level];
+      ResidualFaces(config, nMatchingInternalFacesLocalElem[level],
+                    nMatchingInternalFacesLocalElem[level+1],
+                    indResFaces, numerics[CONV_TERM], workArray);
+      break;
+    }
+
+    case CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS: {
+
+      /* Compute the residual of the faces that involve a halo element. */
+      const unsigned short level = task.timeLevel;
+      unsigned long indResFaces = startLocResInternalFacesWithHaloElem[level];
+      ResidualFaces(config, nMatchingInternalFacesWithHaloElem[level],
+                    nMatchingInternalFacesWithHaloElem[level+1],
+                    indResFaces, numerics[CONV_TERM], workArray);
+      break;
+    }
+
+    case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_OWNED: {
+
+      /*--- Apply the boundary conditions that only depend on data
+            of owned elements. ---*/
+      Boundary_Conditions(task.timeLevel, config, numerics, false, workArray);
+      break;
+    }
+
+    case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO: {
+
+      /*--- Apply the boundary conditions that also depend on data
+            of halo elements. ---*/
+      Boundary_Conditions(task.timeLevel, config, numerics, true, workArray);
+      break;
+    }
+
+    case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_OWNED_ELEMENTS: {
+
+      /* Create the final residual by summing up all contributions. */
+      CreateFinalResidual(task.timeLevel, true);
+      break;
+    }
+
+    case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_HALO_ELEMENTS: {
+
+      /* Create the final residual by summing up all contributions. */
+      CreateFinalResidual(task.timeLevel, false);
+      break;
+    }
+
+    case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_OWNED_ELEMENTS: {
+
+      /* Accumulate the space time residuals for the owned elements
+         for ADER-DG. */
+      AccumulateSpaceTimeResidualADEROwnedElem(config, task.timeLevel,
+                                               task.intPointADER);
+      break;
+    }
+
+    case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_HALO_ELEMENTS: {
+
+      /* Accumulate the space time residuals for the halo elements
+         for ADER-DG. */
+      AccumulateSpaceTimeResidualADERHaloElem(config, task.timeLevel,
+                                              task.intPointADER);
+      break;
+    }
+
+    case CTaskDefinition::MULTIPLY_INVERSE_MASS_MATRIX: {
+
+      /*--- Multiply the residual by the (lumped) mass matrix, to obtain the final value. ---*/
+      const bool useADER = config->GetKind_TimeIntScheme() == ADER_DG;
+      MultiplyResidualByInverseMassMatrix(config, useADER, elemBeg, elemEnd, workArray);
+      break;
+    }
+
+    case CTaskDefinition::ADER_UPDATE_SOLUTION: {
+
+      /*--- Perform the update step for ADER-DG for the given elements. ---*/
+      ADER_DG_Iteration(elemBeg, elemEnd);
+      break;
+    }
+
+    default: {
+
+      cout << "Task not defined. This should not happen." << endl;
+      exit(1);
     }
+  }
+
+  /* Add the time of the task to the cost of the elements, if needed. */
+  if( !elemCostThreads.empty() ) {
+    const chrono::duration<passivedouble> time = chrono::steady_clock::now() - timeBeg;
+    AddElementCost(task, elemBeg, elemEnd, time.count());
+  }
+}
+
+void CFEM_DG_EulerSolver::AddElementCost(const CTaskDefinition &task,
+                                         const unsigned long   elemBeg,
+                                         const unsigned long   elemEnd,
+                                         const passivedouble   time) {
+
+  /*--- Determine the range of owned elements the task concerns. The element
+        based tasks are carried out for the given range, the other tasks
+        for the owned elements of the time level of the task. The initiation
+        of the communication is not part of the cost of the elements. ---*/
+  unsigned long indBeg = elemBeg, indEnd = elemEnd;
+  switch( task.task ) {
+    case CTaskDefinition::ADER_PREDICTOR_STEP_COMM_ELEMENTS:
+    case CTaskDefinition::ADER_PREDICTOR_STEP_INTERNAL_ELEMENTS:
+    case CTaskDefinition::VOLUME_RESIDUAL:
+    case CTaskDefinition::MULTIPLY_INVERSE_MASS_MATRIX:
+    case CTaskDefinition::ADER_UPDATE_SOLUTION:
+      break;
+
+    case CTaskDefinition::INITIATE_MPI_COMMUNICATION:
+    case CTaskDefinition::INITIATE_REVERSE_MPI_COMMUNICATION:
+      return;
+
+    default:
+      indBeg = nVolElemOwnedPerTimeLevel[task.timeLevel];
+      indEnd = nVolElemOwnedPerTimeLevel[task.timeLevel+1];
+      break;
+  }
+
+  /*--- Distribute the time over the elements proportional to their
+        number of DOFs. ---*/
+  unsigned long nDOFs = 0;
+  for(unsigned long l=indBeg; l<indEnd; ++l) nDOFs += volElem[l].nDOFsSol;
+  if(nDOFs == 0) return;
+
+  const passivedouble timePerDOF = time/nDOFs;
+  vector<passivedouble> &elemCost = elemCostThreads[omp_get_thread_num()];
+  for(unsigned long l=indBeg; l<indEnd; ++l)
+    elemCost[l] += timePerDOF*volElem[l].nDOFsSol;
+}
+
+void CFEM_DG_EulerSolver::WriteElementCost(CConfig *config) {
+
+  /*--- Determine the cost per update of the owned elements, i.e. the accumulated
+        cost divided by the number of time steps and the number of updates per
+        time step of the time level of the element. ---*/
+  vector<unsigned long> elemIDs(nVolElemOwned);
+  vector<passivedouble> elemCost(nVolElemOwned, 0.0);
+
+  for(unsigned long l=0; l<nVolElemOwned; ++l) {
+    for(unsigned long i=0; i<elemCostThreads.size(); ++i)
+      elemCost[l] += elemCostThreads[i][l];
+    elemCost[l] /= nTimeStepsElemCost*volElem[l].factTimeLevel;
+    elemIDs[l]   = volElem[l].elemIDGlobal;
+  }
+
+  /*--- Gather the cost on the master node, which writes the file. ---*/
+#ifdef HAVE_MPI
+  unsigned long nElemOwned = nVolElemOwned, nElemGlobal;
+  SU2_MPI::Reduce(&nElemOwned, &nElemGlobal, 1, MPI_UNSIGNED_LONG, MPI_SUM,
+                  MASTER_NODE, MPI_COMM_WORLD);
+
+  if(rank != MASTER_NODE) {
+    SU2_MPI::Send(&nElemOwned, 1, MPI_UNSIGNED_LONG, MASTER_NODE, rank, MPI_COMM_WORLD);
+    SU2_MPI::Send(elemIDs.data(), nElemOwned, MPI_UNSIGNED_LONG, MASTER_NODE, rank, MPI_COMM_WORLD);
+    SU2_MPI::Send(elemCost.data(), nElemOwned, MPI_DOUBLE, MASTER_NODE, rank, MPI_COMM_WORLD);
+    return;
+  }
+
+  vector<passivedouble> costGlobal(nElemGlobal, 0.0);
+  for(unsigned long l=0; l<nElemOwned; ++l) costGlobal[elemIDs[l]] = elemCost[l];
 
-    /* Update the value of lowestIndexInList. */
-    for(; lowestIndexInList < tasksList.size(); ++lowestIndexInList)
-      if( !taskCompleted[lowestIndexInList] ) break;
+  for(int i=0; i<size; ++i) {
+    if(i == MASTER_NODE) continue;
+
+    unsigned long nElemRank;
+    SU2_MPI::Status status;
+    SU2_MPI::Recv(&nElemRank, 1, MPI_UNSIGNED_LONG, i, i, MPI_COMM_WORLD, &status);
+
+    elemIDs.resize(nElemRank);
+    elemCost.resize(nElemRank);
+    SU2_MPI::Recv(elemIDs.data(), nElemRank, MPI_UNSIGNED_LONG, i, i, MPI_COMM_WORLD, &status);
+    SU2_MPI::Recv(elemCost.data(), nElemRank, MPI_DOUBLE, i, i, MPI_COMM_WORLD, &status);
+
+    for(unsigned long l=0; l<nElemRank; ++l) costGlobal[elemIDs[l]] = elemCost[l];
   }
+#else
+  const unsigned long nElemGlobal = nVolElemOwned;
+  vector<passivedouble> costGlobal(nElemGlobal, 0.0);
+  for(unsigned long l=0; l<nVolElemOwned; ++l) costGlobal[elemIDs[l]] = elemCost[l];
+#endif
+
+  /*--- Write the number of elements followed by their cost. ---*/
+  const string fileName = config->GetElemCost_FileName_DGFEM();
+  ofstream costFile(fileName, ios::binary);
+  if( !costFile.is_open() )
+    SU2_MPI::Error(string("Could not open the file ") + fileName, CURRENT_FUNCTION);
+
+  costFile.write(reinterpret_cast<const char*>(&nElemGlobal), sizeof(unsigned long));
+  costFile.write(reinterpret_cast<const char*>(costGlobal.data()), nElemGlobal*sizeof(passivedouble));
 }
 
 void CFEM_DG_EulerSolver::ADER_SpaceTimeIntegration(CGeometry *geometry,  CSolver **solver_container,
@@ -4671,11 +5219,13 @@ void CFEM_DG_EulerSolver::ADER_DG_PredictorStep(CConfig             *config,
     /* Store the predictor solution in the correct location of
        VecSolDOFsPredictorADER. */
     for(unsigned short j=0; j<nTimeDOFs; ++j) {
-      su2double *solADERPred = VecSolDOFsPredictorADER.data()
-                             + nVar*(j*nDOFsLocTot + volElem[l].offsetDOFsSolLocal);
+      const unsigned long offADERPred = nVar*(j*nDOFsLocTot + volElem[l].offsetDOFsSolLocal);
       su2double *solPredTime = solPred + j*nVarNDOFs;
 
-      memcpy(solADERPred, solPredTime, nBytes);
+      if( VecSolDOFsPredictorADERFloat.size() )
+        CopyPredictorData(VecSolDOFsPredictorADERFloat.data()+offADERPred, solPredTime, nVarNDOFs);
+      else
+        memcpy(VecSolDOFsPredictorADER.data()+offADERPred, solPredTime, nBytes);
     }
   }
 }
@@ -4687,6 +5237,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
                                                               const unsigned short NPad,
                                                               su2double            *res,
                                                               su2double            *work) {
+  /* Fluid model of this thread, the tasks of the task list may run concurrently. */
+  CFluidModel *fluidModel = FluidModelThreads[omp_get_thread_num()];
 
   /* Get the necessary information from the standard element. */
   const unsigned short ind                = elem->indStandardElement;
@@ -4743,8 +5295,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
       const su2double v            = DensityInv*solDOF[2];
       const su2double StaticEnergy = DensityInv*solDOF[3] - 0.5*(u*u + v*v);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      fluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure = fluidModel->GetPressure();
 
       /* The Cartesian fluxes in the x-direction. */
       const su2double uRel = u - gridVel[0];
@@ -4932,6 +5484,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
                                                               const unsigned short NPad,
                                                               su2double            *res,
                                                               su2double            *work) {
+  /* Fluid model of this thread, the tasks of the task list may run concurrently. */
+  CFluidModel *fluidModel = FluidModelThreads[omp_get_thread_num()];
 
   /* Get the necessary information from the standard element. */
   const unsigned short ind                = elem->indStandardElement;
@@ -4992,8 +5546,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
       const su2double w            = DensityInv*solDOF[3];
       const su2double StaticEnergy = DensityInv*solDOF[4] - 0.5*(u*u + v*v + w*w);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      fluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure = fluidModel->GetPressure();
 
       /* The Cartesian fluxes in the x-direction. */
       const su2double uRel = u - gridVel[0];
@@ -5213,6 +5767,8 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
                                                                  const unsigned short NPad,
                                                                  su2double            *res,
                                                                  su2double            *work) {
+  /* Fluid model of this thread, the tasks of the task list may run concurrently. */
+  CFluidModel *fluidModel = FluidModelThreads[omp_get_thread_num()];
 
   /* Set the pointers for solAndGradInt and divFlux to work. The same array
      can be used for both help arrays. */
@@ -5282,8 +5838,8 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
       const su2double kinEnergy    = 0.5*(u*u + v*v);
       const su2double StaticEnergy = rhoInv*rE - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      fluidModel->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = fluidModel->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
       /* Set the pointer to the grid velocities in this integration point.
@@ -5422,6 +5978,8 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
                                                                  const unsigned short NPad,
                                                                  su2double            *res,
                                                                  su2double            *work) {
+  /* Fluid model of this thread, the tasks of the task list may run concurrently. */
+  CFluidModel *fluidModel = FluidModelThreads[omp_get_thread_num()];
 
   /* Set the pointers for solAndGradInt and divFlux to work. The same array
      can be used for both help arrays. */
@@ -5497,8 +6055,8 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
       const su2double kinEnergy    = 0.5*(u*u + v*v + w*w);
       const su2double StaticEnergy = rhoInv*rE - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      fluidModel->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = fluidModel->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
       /* Set the pointer to the grid velocities in this integration point.
@@ -5689,11 +6247,19 @@ void CFEM_DG_EulerSolver::ADER_DG_TimeInterpolatePredictorSol(CConfig
     /* Loop over the time DOFs, for which the predictor solution is present. */
     for(unsigned short j=0; j<nTimeDOFs; ++j) {
 
-      /* Add the contribution of this predictor solution to the interpolated solution. */
-      const su2double *solPred = VecSolDOFsPredictorADER.data()
-                               + nVar*(j*nDOFsLocTot + volElem[l].offsetDOFsSolLocal);
-      for(unsigned short i=0; i<nSolVar; ++i)
-        solDOFs[i] += DOFToThisTimeInt[j]*solPred[i];
+      /* Add the contribution of this predictor solution to the interpolated solution,
+         which may be stored in single precision. */
+      const unsigned long offPred = nVar*(j*nDOFsLocTot + volElem[l].offsetDOFsSolLocal);
+      if( VecSolDOFsPredictorADERFloat.size() ) {
+        const float *solPred = VecSolDOFsPredictorADERFloat.data() + offPred;
+        for(unsigned short i=0; i<nSolVar; ++i)
+          solDOFs[i] += DOFToThisTimeInt[j]*solPred[i];
+      }
+      else {
+        const su2double *solPred = VecSolDOFsPredictorADER.data() + offPred;
+        for(unsigned short i=0; i<nSolVar; ++i)
+          solDOFs[i] += DOFToThisTimeInt[j]*solPred[i];
+      }
     }
   }
 
@@ -5731,11 +6297,19 @@ void CFEM_DG_EulerSolver::ADER_DG_TimeInterpolatePredictorSol(CConfig
     /* Loop over the time DOFs, for which the predictor solution is present. */
     for(unsigned short j=0; j<nTimeDOFs; ++j) {
 
-      /* Add the contribution of this predictor solution to the interpolated solution. */
-      const su2double *solPred = VecSolDOFsPredictorADER.data()
-                               + nVar*(j*nDOFsLocTot + volElem[ll].offsetDOFsSolLocal);
-      for(unsigned short i=0; i<nSolVar; ++i)
-        solDOFs[i] += DOFToThisTimeInt[j]*solPred[i];
+      /* Add the contribution of this predictor solution to the interpolated solution,
+         which may be stored in single precision. */
+      const unsigned long offPred = nVar*(j*nDOFsLocTot + volElem[ll].offsetDOFsSolLocal);
+      if( VecSolDOFsPredictorADERFloat.size() ) {
+        const float *solPred = VecSolDOFsPredictorADERFloat.data() + offPred;
+        for(unsigned short i=0; i<nSolVar; ++i)
+          solDOFs[i] += DOFToThisTimeInt[j]*solPred[i];
+      }
+      else {
+        const su2double *solPred = VecSolDOFsPredictorADER.data() + offPred;
+        for(unsigned short i=0; i<nSolVar; ++i)
+          solDOFs[i] += DOFToThisTimeInt[j]*solPred[i];
+      }
     }
   }
 }
@@ -5756,6 +6330,8 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
                                           const unsigned long elemBeg,
                                           const unsigned long elemEnd,
                                           su2double           *workArray) {
+  /* Fluid model of this thread, the tasks of the task list may run concurrently. */
+  CFluidModel *fluidModel = FluidModelThreads[omp_get_thread_num()];
 
   /*--- Determine whether a body force term is present. ---*/
   bool body_force = config->GetBody_Force();
@@ -5808,6 +6384,10 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
     su2double *sources = solDOFs + nDOFs*NPad;
     su2double *solInt  = sources + nInt *NPad;
     su2double *fluxes  = solInt  + nInt *NPad;
+    su2double *workSumFact = fluxes + nInt*NPad*nDim;
+
+    /* Whether or not sum factorization is used for this standard element. */
+    const bool sumFact = standardElementsSol[ind].GetSumFactorization();
 
     /*------------------------------------------------------------------------*/
     /*--- Step 1: Interpolate the solution to the integration points of    ---*/
@@ -5830,8 +6410,13 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
     }
 
     /* Call the general function to carry out the matrix product to determine
-       the solution in the integration points of the chunk of elements. */
-    blasFunctions->gemm(nInt, NPad, nDOFs, matBasisInt, solDOFs, solInt, config);
+       the solution in the integration points of the chunk of elements, or use
+       sum factorization for tensor product elements. */
+    if( sumFact )
+      standardElementsSol[ind].SumFactSolAndGradIntegration(NPad, false, solDOFs, solInt,
+                                                            workSumFact, blasFunctions, config);
+    else
+      blasFunctions->gemm(nInt, NPad, nDOFs, matBasisInt, solDOFs, solInt, config);
 
     /*------------------------------------------------------------------------*/
     /*--- Step 2: Compute the inviscid fluxes, multiplied by minus the     ---*/
@@ -5882,8 +6467,8 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
             const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v);
 
             /*--- Compute the pressure. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure = FluidModel->GetPressure();
+            fluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure = fluidModel->GetPressure();
 
             /* Compute the relative velocities w.r.t. the grid. */
             const su2double uRel = u - gridVel[0];
@@ -5977,8 +6562,8 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
             const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v + w*w);
 
             /*--- Compute the pressure. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure = FluidModel->GetPressure();
+            fluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure = fluidModel->GetPressure();
 
             /* Compute the relative velocities w.r.t. the grid. */
             const su2double uRel = u - gridVel[0];
@@ -6096,16 +6681,24 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
     /*---         integration over the volume element.                     ---*/
     /*------------------------------------------------------------------------*/
 
-    /* Call the general function to carry out the matrix product.
-       Use solDOFs as a temporary storage for the matrix product. */
-    blasFunctions->gemm(nDOFs, NPad, nInt*nDim, matDerBasisIntTrans, fluxes, solDOFs, config);
+    /* Call the general function to carry out the matrix product, or use
+       sum factorization. Use solDOFs as a temporary storage for the matrix product. */
+    if( sumFact )
+      standardElementsSol[ind].SumFactResidualFluxes(NPad, fluxes, solDOFs, workSumFact,
+                                                     blasFunctions, config);
+    else
+      blasFunctions->gemm(nDOFs, NPad, nInt*nDim, matDerBasisIntTrans, fluxes, solDOFs, config);
 
     /* Add the contribution from the source terms, if needed. Use solInt
        as temporary storage for the matrix product. */
     if( addSourceTerms ) {
 
       /* Call the general function to carry out the matrix product. */
-      blasFunctions->gemm(nDOFs, NPad, nInt, matBasisIntTrans, sources, solInt, config);
+      if( sumFact )
+        standardElementsSol[ind].SumFactResidualSources(NPad, sources, solInt, workSumFact,
+                                                        blasFunctions, config);
+      else
+        blasFunctions->gemm(nDOFs, NPad, nInt, matBasisIntTrans, sources, solInt, config);
 
       /* Add the residuals due to source terms to the volume residuals */
       for(unsigned short i=0; i<(nDOFs*NPad); ++i)
@@ -6644,6 +7237,10 @@ void CFEM_DG_EulerSolver::CreateFinalResidual(const unsigned short timeLevel,
     }
   }
 
+  /* The forcing term of a coarse p-multigrid level is added to the
+     residual of the owned elements. */
+  const bool addForcingTerm = ownedElements && VecForcingTermMG.size();
+
   /* Loop over the required element range. */
   for(unsigned long l=elemStart; l<elemEnd; ++l) {
 
@@ -6658,6 +7255,12 @@ void CFEM_DG_EulerSolver::CreateFinalResidual(const unsigned short timeLevel,
         for(unsigned short k=0; k<nVar; ++k)
           resDOF[k] += resFace[k];
       }
+
+      if( addForcingTerm ) {
+        const su2double *forcing = VecForcingTermMG.data() + nVar*i;
+        for(unsigned short k=0; k<nVar; ++k)
+          resDOF[k] += forcing[k];
+      }
     }
   }
 }
@@ -6679,6 +7282,12 @@ void CFEM_DG_EulerSolver::MultiplyResidualByInverseMassMatrix(
     /* Easier storage of the residuals for this volume element. */
     su2double *res = VecRes.data() + nVar*volElem[l].offsetDOFsSolLocal;
 
+    /* The p-multigrid algorithm restricts the residuals before the
+       multiplication with the inverse of the mass matrix. */
+    if( VecResDOFsMG.size() )
+      memcpy(VecResDOFsMG.data() + nVar*volElem[l].offsetDOFsSolLocal, res,
+             nVar*volElem[l].nDOFsSol*sizeof(su2double));
+
     /* Check whether a multiplication must be carried out with the inverse of
        the lumped mass matrix or the full mass matrix. Note that it is crucial
        that the test is performed with the lumpedMassMatrix and not with
@@ -7223,6 +7832,178 @@ void CFEM_DG_EulerSolver::ClassicalRK4_Iteration(CGeometry *geometry, CSolver **
   }
 }
 
+void CFEM_DG_EulerSolver::SetRestricted_Solution_FEM(CSolver *sol_fine, CConfig *config) {
+
+  CFEM_DG_EulerSolver *solFine = dynamic_cast<CFEM_DG_EulerSolver *>(sol_fine);
+
+  /*--- Create the transfer operators, if not done already. ---*/
+  if(indTransferMG.size() != nVolElemOwned) SetTransferOperatorsMG(solFine);
+
+  /*--- Loop over the owned elements and interpolate the solution of the
+        corresponding fine element in the DOFs of this element. ---*/
+  for(unsigned long l=0; l<nVolElemOwned; ++l) {
+
+    const CVolumeElementFEM &elemFine = solFine->volElem[elemFineMG[l]];
+    const su2double *solFineElem = solFine->VecSolDOFs.data() + nVar*elemFine.offsetDOFsSolLocal;
+    su2double       *solElem     = VecSolDOFs.data()          + nVar*volElem[l].offsetDOFsSolLocal;
+
+    blasFunctions->gemm(volElem[l].nDOFsSol, nVar, elemFine.nDOFsSol,
+                        matSolRestrictionMG[indTransferMG[l]].data(),
+                        solFineElem, solElem, config);
+  }
+
+  /*--- Store the restricted solution to compute the correction and reset the
+        forcing term for the computation of the residual of this solution. ---*/
+  VecSolDOFsRestrictedMG = VecSolDOFs;
+  VecForcingTermMG.assign(nVar*nDOFsLocOwned, 0.0);
+}
+
+void CFEM_DG_EulerSolver::SetForcing_Term_FEM(CSolver *sol_fine, CConfig *config) {
+
+  const CFEM_DG_EulerSolver *solFine = dynamic_cast<const CFEM_DG_EulerSolver *>(sol_fine);
+  const su2double factor = config->GetDamp_Res_Restric();
+
+  /*--- Loop over the owned elements. The restriction of the fine residual is
+        the transpose of the prolongation, which is the Galerkin projection of
+        the weak residual, because the coarse basis functions are contained in
+        the fine space. ---*/
+  for(unsigned long l=0; l<nVolElemOwned; ++l) {
+
+    const CVolumeElementFEM &elemFine = solFine->volElem[elemFineMG[l]];
+    const su2double *resFineElem = solFine->VecResDOFsMG.data() + nVar*elemFine.offsetDOFsSolLocal;
+    const su2double *resElem     = VecResDOFsMG.data()          + nVar*volElem[l].offsetDOFsSolLocal;
+    su2double       *forcing     = VecForcingTermMG.data()      + nVar*volElem[l].offsetDOFsSolLocal;
+
+    blasFunctions->gemm(volElem[l].nDOFsSol, nVar, elemFine.nDOFsSol,
+                        matResRestrictionMG[indTransferMG[l]].data(),
+                        resFineElem, forcing, config);
+
+    for(unsigned short i=0; i<(nVar*volElem[l].nDOFsSol); ++i)
+      forcing[i] = factor*forcing[i] - resElem[i];
+  }
+}
+
+void CFEM_DG_EulerSolver::SetProlongated_Correction_FEM(CSolver *sol_fine, CConfig *config) {
+
+  CFEM_DG_EulerSolver *solFine = dynamic_cast<CFEM_DG_EulerSolver *>(sol_fine);
+  const su2double factor = config->GetDamp_Correc_Prolong();
+
+  /* Work vectors for the correction of an element on both levels. */
+  vector<su2double> corrCoarse, corrFine;
+
+  /*--- Loop over the owned elements and add the prolongated correction to
+        the solution of the corresponding fine element. ---*/
+  for(unsigned long l=0; l<nVolElemOwned; ++l) {
+
+    const CVolumeElementFEM &elemFine = solFine->volElem[elemFineMG[l]];
+    const unsigned long offset     = nVar*volElem[l].offsetDOFsSolLocal;
+    const unsigned short nVarNDOFs = nVar*volElem[l].nDOFsSol;
+
+    corrCoarse.resize(nVarNDOFs);
+    corrFine.resize(nVar*elemFine.nDOFsSol);
+
+    for(unsigned short i=0; i<nVarNDOFs; ++i)
+      corrCoarse[i] = VecSolDOFs[offset+i] - VecSolDOFsRestrictedMG[offset+i];
+
+    blasFunctions->gemm(elemFine.nDOFsSol, nVar, volElem[l].nDOFsSol,
+                        matProlongationMG[indTransferMG[l]].data(),
+                        corrCoarse.data(), corrFine.data(), config);
+
+    su2double *solFineElem = solFine->VecSolDOFs.data() + nVar*elemFine.offsetDOFsSolLocal;
+    for(unsigned short i=0; i<(nVar*elemFine.nDOFsSol); ++i)
+      solFineElem[i] += factor*corrFine[i];
+  }
+}
+
+void CFEM_DG_EulerSolver::SetTransferOperatorsMG(const CFEM_DG_EulerSolver *solFine) {
+
+  /*--- The elements are identical on all p-multigrid levels and they are owned
+        by the same rank. Create the mapping from the global element ID to the
+        local index of the owned elements of the finer level. ---*/
+  map<unsigned long, unsigned long> mapGlobalElemIDToIndFine;
+  for(unsigned long l=0; l<solFine->nVolElemOwned; ++l)
+    mapGlobalElemIDToIndFine[solFine->volElem[l].elemIDGlobal] = l;
+
+  elemFineMG.resize(nVolElemOwned);
+  indTransferMG.resize(nVolElemOwned);
+
+  /* The pairs of standard elements of the fine and this level, for which
+     the transfer operators are stored. */
+  vector<pair<unsigned short, unsigned short> > standardElemPairs;
+
+  /*--- Loop over the owned elements. ---*/
+  for(unsigned long l=0; l<nVolElemOwned; ++l) {
+
+    map<unsigned long, unsigned long>::const_iterator MI;
+    MI = mapGlobalElemIDToIndFine.find(volElem[l].elemIDGlobal);
+    if(MI == mapGlobalElemIDToIndFine.end())
+      SU2_MPI::Error("Element not found on the finer p-multigrid level.", CURRENT_FUNCTION);
+    elemFineMG[l] = MI->second;
+
+    /* Check whether the transfer operators for this pair of standard elements
+       are already present. */
+    const pair<unsigned short, unsigned short> elemPair(solFine->volElem[MI->second].indStandardElement,
+                                                        volElem[l].indStandardElement);
+    unsigned short ind;
+    for(ind=0; ind<standardElemPairs.size(); ++ind)
+      if(standardElemPairs[ind] == elemPair) break;
+
+    indTransferMG[l] = ind;
+    if(ind < standardElemPairs.size()) continue;
+    standardElemPairs.push_back(elemPair);
+
+    /* Copy the standard elements, because the evaluation of the basis
+       functions is not a const function. */
+    CFEMStandardElement standardFine   = solFine->standardElementsSol[elemPair.first];
+    CFEMStandardElement standardCoarse = standardElementsSol[elemPair.second];
+
+    const unsigned short nDOFsFine   = standardFine.GetNDOFs();
+    const unsigned short nDOFsCoarse = standardCoarse.GetNDOFs();
+
+    /* Lambda to retrieve the parametric coordinates of a DOF of a standard element. */
+    auto ParCoorDOF = [this](const CFEMStandardElement &standardElem,
+                             const unsigned short      iDOF,
+                             su2double                 *parCoor) {
+      parCoor[0] = (*standardElem.GetRDOFs())[iDOF];
+      if(nDim > 1) parCoor[1] = (*standardElem.GetSDOFs())[iDOF];
+      if(nDim > 2) parCoor[2] = (*standardElem.GetTDOFs())[iDOF];
+    };
+
+    vector<su2double> lagBasis;
+    su2double parCoor[3] = {0.0, 0.0, 0.0};
+
+    /* The prolongation matrix contains the basis functions of this level in the
+       fine DOFs. As the polynomial space is nested, this prolongation is exact.
+       The residual is restricted with its transpose. */
+    matProlongationMG.push_back(vector<su2double>(nDOFsFine*nDOFsCoarse));
+    matResRestrictionMG.push_back(vector<su2double>(nDOFsCoarse*nDOFsFine));
+    lagBasis.resize(nDOFsCoarse);
+
+    for(unsigned short j=0; j<nDOFsFine; ++j) {
+      ParCoorDOF(standardFine, j, parCoor);
+      standardCoarse.BasisFunctionsInPoint(parCoor, lagBasis);
+
+      for(unsigned short i=0; i<nDOFsCoarse; ++i) {
+        matProlongationMG.back()[j*nDOFsCoarse+i] = lagBasis[i];
+        matResRestrictionMG.back()[i*nDOFsFine+j] = lagBasis[i];
+      }
+    }
+
+    /* The solution is restricted by interpolating the fine solution in the DOFs
+       of this level. */
+    matSolRestrictionMG.push_back(vector<su2double>(nDOFsCoarse*nDOFsFine));
+    lagBasis.resize(nDOFsFine);
+
+    for(unsigned short i=0; i<nDOFsCoarse; ++i) {
+      ParCoorDOF(standardCoarse, i, parCoor);
+      standardFine.BasisFunctionsInPoint(parCoor, lagBasis);
+
+      for(unsigned short j=0; j<nDOFsFine; ++j)
+        matSolRestrictionMG.back()[i*nDOFsFine+j] = lagBasis[j];
+    }
+  }
+}
+
 void CFEM_DG_EulerSolver::SetResidual_RMS_FEM(CGeometry *geometry,
                                               CConfig *config) {
 
@@ -9403,7 +10184,7 @@ void CFEM_DG_EulerSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, C
   string restart_filename = config->GetSolution_FileName();
 
   int counter = 0;
-  long iPoint_Local = 0; unsigned long iPoint_Global = 0;
+  long iPoint_Local = 0;
   unsigned short rbuf_NotMatching = 0;
   unsigned long nDOF_Read = 0;
 
@@ -9424,28 +10205,24 @@ void CFEM_DG_EulerSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, C
   /*--- Load data from the restart into correct containers. ---*/
 
   counter = 0;
-  for (iPoint_Global = 0; iPoint_Global < geometry[MESH_0]->GetGlobal_nPointDomain(); iPoint_Global++) {
-
-    /*--- Retrieve local index. If this node from the restart file lives
-     on the current processor, we will load and instantiate the vars. ---*/
+  for (const auto& globalToLocal : geometry[MESH_0]->GetGlobal_to_Local_Map()) {
 
-    iPoint_Local = geometry[MESH_0]->GetGlobal_to_Local_Point(iPoint_Global);
+    /*--- The points of this rank, in the order of their data in the restart file. ---*/
 
-    if (iPoint_Local > -1) {
+    iPoint_Local = globalToLocal.second;
 
-      /*--- We need to store this point's data, so jump to the correct
-       offset in the buffer of data from the restart file and load it. ---*/
+    /*--- We need to store this point's data, so jump to the correct
+     offset in the buffer of data from the restart file and load it. ---*/
 
-      index = counter*Restart_Vars[1] + skipVars;
-      for (iVar = 0; iVar < nVar; iVar++) {
-        VecSolDOFs[nVar*iPoint_Local+iVar] = Restart_Data[index+iVar];
-      }
-      /*--- Update the local counter nDOF_Read. ---*/
-      ++nDOF_Read;
-
-      /*--- Increment the overall counter for how many points have been loaded. ---*/
-      counter++;
+    index = counter*Restart_Vars[1] + skipVars;
+    for (iVar = 0; iVar < nVar; iVar++) {
+      VecSolDOFs[nVar*iPoint_Local+iVar] = Restart_Data[index+iVar];
     }
+    /*--- Update the local counter nDOF_Read. ---*/
+    ++nDOF_Read;
+
+    /*--- Increment the overall counter for how many points have been loaded. ---*/
+    counter++;
 
   }
 
@@ -30,6 +30,7 @@
 #include "../../../Common/include/toolboxes/printing_toolbox.hpp"
 
 #define SIZE_ARR_NORM 8
+#define SIZE_BATCH_FACE 8
 
 CFEM_DG_NSSolver::CFEM_DG_NSSolver(void) : CFEM_DG_EulerSolver() {
 
@@ -390,7 +391,8 @@ void CFEM_DG_NSSolver::Friction_Forces(CGeometry *geometry, CConfig *config) {
 
                 /* Compute the wall shear stress and heat flux vector using
                    the wall model. */
-                su2double tauWall, qWall, ViscosityWall, kOverCvWall;
+                su2double tauWall = surfElem[l].wallModelData[4*ii];
+                su2double qWall, ViscosityWall, kOverCvWall;
 
                 boundaries[iMarker].wallModel->WallShearStressAndHeatFlux(Temperature, velTan,
                                                                           LaminarViscosity, Pressure,
@@ -1331,6 +1333,9 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
                                                            const unsigned short NPad,
                                                            su2double            *res,
                                                            su2double            *work) {
+  /* Fluid model of this thread, the tasks of the task list may run concurrently. */
+  CFluidModel *fluidModel = FluidModelThreads[omp_get_thread_num()];
+
   /* Constant factor present in the heat flux vector. */
   const su2double factHeatFlux_Lam  = Gamma/Prandtl_Lam;
   const su2double factHeatFlux_Turb = Gamma/Prandtl_Turb;
@@ -1434,9 +1439,9 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
       const su2double TotalEnergy  = DensityInv*solDOF[3];
       const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure     = FluidModel->GetPressure();
-      const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+      fluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure     = fluidModel->GetPressure();
+      const su2double ViscosityLam = fluidModel->GetLaminarViscosity();
 
       /* Compute the Cartesian gradients of the velocities and static energy. */
       const su2double dudx = DensityInv*(drudx - u*drhodx);
@@ -1655,6 +1660,9 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
                                                            const unsigned short NPad,
                                                            su2double            *res,
                                                            su2double            *work) {
+  /* Fluid model of this thread, the tasks of the task list may run concurrently. */
+  CFluidModel *fluidModel = FluidModelThreads[omp_get_thread_num()];
+
   /* Constant factor present in the heat flux vector. */
   const su2double factHeatFlux_Lam  = Gamma/Prandtl_Lam;
   const su2double factHeatFlux_Turb = Gamma/Prandtl_Turb;
@@ -1777,9 +1785,9 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
       const su2double TotalEnergy  = DensityInv*solDOF[4];
       const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v + w*w);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure     = FluidModel->GetPressure();
-      const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+      fluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure     = fluidModel->GetPressure();
+      const su2double ViscosityLam = fluidModel->GetLaminarViscosity();
 
       /* Compute the Cartesian gradients of the velocities and static energy. */
       const su2double dudx = DensityInv*(drudx - u*drhodx);
@@ -2043,6 +2051,8 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
                                                               const unsigned short NPad,
                                                               su2double            *res,
                                                               su2double            *work) {
+  /* Fluid model of this thread, the tasks of the task list may run concurrently. */
+  CFluidModel *fluidModel = FluidModelThreads[omp_get_thread_num()];
 
   /* Constant factor present in the heat flux vector, the inverse of
      the specific heat at constant volume and ratio lambdaOverMu. */
@@ -2150,13 +2160,13 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
       const su2double TotalEnergy  = rhoInv*rE;
       const su2double StaticEnergy = TotalEnergy - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      fluidModel->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = fluidModel->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
       /* Compute the laminar viscosity and its derivative w.r.t. temperature. */
-      const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
-      const su2double dViscLamdT   = FluidModel->GetdmudT_rho();
+      const su2double ViscosityLam = fluidModel->GetLaminarViscosity();
+      const su2double dViscLamdT   = fluidModel->GetdmudT_rho();
 
       /* Set the pointer to the grid velocities in this integration point.
          THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
@@ -2435,6 +2445,8 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
                                                               const unsigned short NPad,
                                                               su2double            *res,
                                                               su2double            *work) {
+  /* Fluid model of this thread, the tasks of the task list may run concurrently. */
+  CFluidModel *fluidModel = FluidModelThreads[omp_get_thread_num()];
 
   /* Constant factor present in the heat flux vector, the inverse of
      the specific heat at constant volume and ratio lambdaOverMu. */
@@ -2549,13 +2561,13 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
       const su2double TotalEnergy  = rhoInv*rE;
       const su2double StaticEnergy = TotalEnergy - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      fluidModel->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = fluidModel->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
        /* Compute the laminar viscosity and its derivative w.r.t. temperature. */
-      const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
-      const su2double dViscLamdT   = FluidModel->GetdmudT_rho();
+      const su2double ViscosityLam = fluidModel->GetLaminarViscosity();
+      const su2double dViscLamdT   = fluidModel->GetdmudT_rho();
 
       /* Set the pointer to the grid velocities in this integration point.
          THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
@@ -3171,6 +3183,8 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
                                        const unsigned long elemBeg,
                                        const unsigned long elemEnd,
                                        su2double           *workArray) {
+  /* Fluid model of this thread, the tasks of the task list may run concurrently. */
+  CFluidModel *fluidModel = FluidModelThreads[omp_get_thread_num()];
 
   /*--- Determine whether a body force term is present. ---*/
   bool body_force = config->GetBody_Force();
@@ -3200,6 +3214,11 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
      on the number of dimensions. */
   const unsigned short nMetricPerPoint = nDim*nDim + 1;
 
+  /* Working memory for the batched evaluation of the SGS model, which
+     stores the densities, velocity gradients and eddy viscosities of
+     the integration points of an element. */
+  vector<su2double> workSGS;
+
   /*--- Loop over the given element range to compute the contribution of the
         volume integral in the DG FEM formulation to the residual. Multiple
         elements are treated simultaneously to improve the performance
@@ -3230,6 +3249,16 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
     su2double *sources       = solDOFs       + nDOFs*NPad;
     su2double *solAndGradInt = sources       + nInt *NPad;
     su2double *fluxes        = solAndGradInt + nInt *NPad*(nDim+1);
+    su2double *workSumFact   = fluxes        + nInt *NPad*nDim;
+
+    /* Whether or not sum factorization is used for this standard element. */
+    const bool sumFact = standardElementsSol[ind].GetSumFactorization();
+
+    /* Set the pointers for the batched evaluation of the SGS model. */
+    if(workSGS.size() < nInt*(nDim*nDim+2)) workSGS.resize(nInt*(nDim*nDim+2));
+    su2double *rhoSGS     = workSGS.data();
+    su2double *velGradSGS = rhoSGS     + nInt;
+    su2double *muTurbSGS  = velGradSGS + nInt*nDim*nDim;
 
     /*------------------------------------------------------------------------*/
     /*--- Step 1: Determine the solution variables and their gradients     ---*/
@@ -3254,8 +3283,12 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
 
     /* Call the general function to carry out the matrix product to determine
        the solution and gradients in the integration points of the chunk
-       of elements. */
-    blasFunctions->gemm(nInt*(nDim+1), NPad, nDOFs, matBasisInt, solDOFs, solAndGradInt, config);
+       of elements, or use sum factorization for tensor product elements. */
+    if( sumFact )
+      standardElementsSol[ind].SumFactSolAndGradIntegration(NPad, true, solDOFs, solAndGradInt,
+                                                            workSumFact, blasFunctions, config);
+    else
+      blasFunctions->gemm(nInt*(nDim+1), NPad, nDOFs, matBasisInt, solDOFs, solAndGradInt, config);
 
     /*------------------------------------------------------------------------*/
     /*--- Step 2: Compute the total fluxes (inviscid fluxes minus the      ---*/
@@ -3280,6 +3313,51 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
           const unsigned short llNVar = ll*nVar;
           const unsigned long  lInd   = l + ll;
 
+          /*--- If an SGS model is used, compute the eddy viscosity in all
+                integration points of this element with one call. ---*/
+          if( SGSModelUsed ) {
+            for(unsigned short i=0; i<nInt; ++i) {
+
+              /* Compute the true metric terms in this integration point. */
+              const su2double *metricTerms = volElem[lInd].metricTerms.data()
+                                           + i*nMetricPerPoint;
+              const su2double JacInv = 1.0/metricTerms[0];
+
+              const su2double drdx = JacInv*metricTerms[1];
+              const su2double drdy = JacInv*metricTerms[2];
+
+              const su2double dsdx = JacInv*metricTerms[3];
+              const su2double dsdy = JacInv*metricTerms[4];
+
+              /* Compute the velocity gradients in this integration point. */
+              const su2double *sol    = solAndGradInt + i*NPad + llNVar;
+              const su2double *dSolDr = sol    + offDeriv;
+              const su2double *dSolDs = dSolDr + offDeriv;
+
+              const su2double dRhoDx  = dSolDr[0]*drdx + dSolDs[0]*dsdx;
+              const su2double dRhoUDx = dSolDr[1]*drdx + dSolDs[1]*dsdx;
+              const su2double dRhoVDx = dSolDr[2]*drdx + dSolDs[2]*dsdx;
+
+              const su2double dRhoDy  = dSolDr[0]*drdy + dSolDs[0]*dsdy;
+              const su2double dRhoUDy = dSolDr[1]*drdy + dSolDs[1]*dsdy;
+              const su2double dRhoVDy = dSolDr[2]*drdy + dSolDs[2]*dsdy;
+
+              const su2double rhoInv = 1.0/sol[0];
+              const su2double u      = sol[1]*rhoInv;
+              const su2double v      = sol[2]*rhoInv;
+
+              rhoSGS[i]             = sol[0];
+              velGradSGS[i]         = rhoInv*(dRhoUDx - u*dRhoDx);
+              velGradSGS[i+nInt]    = rhoInv*(dRhoUDy - u*dRhoDy);
+              velGradSGS[i+2*nInt]  = rhoInv*(dRhoVDx - v*dRhoDx);
+              velGradSGS[i+3*nInt]  = rhoInv*(dRhoVDy - v*dRhoDy);
+            }
+
+            const su2double lenScale = volElem[lInd].lenScale/nPoly;
+            SGSModel->ComputeEddyViscosity_2D(nInt, rhoSGS, velGradSGS, lenScale,
+                                              volElem[lInd].wallDistance.data(), muTurbSGS);
+          }
+
           for(unsigned short i=0; i<nInt; ++i) {
             const unsigned short iNPad = i*NPad;
 
@@ -3349,18 +3427,12 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
             const su2double divVel = dudx + dvdy;
 
             /*--- Compute the pressure and the laminar viscosity. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure     = FluidModel->GetPressure();
-            const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
-
-            /*--- If an SGS model is used the eddy viscosity must be computed. ---*/
-            su2double ViscosityTurb = 0.0;
-            if( SGSModelUsed ) {
-              const su2double lenScale = volElem[lInd].lenScale/nPoly;
-              ViscosityTurb = SGSModel->ComputeEddyViscosity_2D(sol[0], dudx, dudy,
-                                                                dvdx, dvdy, lenScale,
-                                                                volElem[lInd].wallDistance[i]);
-            }
+            fluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure     = fluidModel->GetPressure();
+            const su2double ViscosityLam = fluidModel->GetLaminarViscosity();
+
+            /*--- The eddy viscosity of the SGS model has been computed above. ---*/
+            const su2double ViscosityTurb = SGSModelUsed ? muTurbSGS[i] : 0.0;
 
             /* Compute the total viscosity and heat conductivity. Note that the heat
                conductivity is divided by the Cv, because gradients of internal energy
@@ -3443,6 +3515,58 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
           const unsigned short llNVar = ll*nVar;
           const unsigned long  lInd   = l + ll;
 
+          /*--- If an SGS model is used, compute the eddy viscosity in all
+                integration points of this element with one call. ---*/
+          if( SGSModelUsed ) {
+            for(unsigned short i=0; i<nInt; ++i) {
+
+              /* Compute the true metric terms in this integration point. */
+              const su2double *metricTerms = volElem[lInd].metricTerms.data()
+                                           + i*nMetricPerPoint;
+              const su2double JacInv = 1.0/metricTerms[0];
+
+              const su2double drdx = JacInv*metricTerms[1];
+              const su2double drdy = JacInv*metricTerms[2];
+              const su2double drdz = JacInv*metricTerms[3];
+
+              const su2double dsdx = JacInv*metricTerms[4];
+              const su2double dsdy = JacInv*metricTerms[5];
+              const su2double dsdz = JacInv*metricTerms[6];
+
+              const su2double dtdx = JacInv*metricTerms[7];
+              const su2double dtdy = JacInv*metricTerms[8];
+              const su2double dtdz = JacInv*metricTerms[9];
+
+              /* Compute the velocity gradients in this integration point. */
+              const su2double *sol    = solAndGradInt + i*NPad + llNVar;
+              const su2double *dSolDr = sol    + offDeriv;
+              const su2double *dSolDs = dSolDr + offDeriv;
+              const su2double *dSolDt = dSolDs + offDeriv;
+
+              const su2double rhoInv = 1.0/sol[0];
+              const su2double vel[]  = {sol[1]*rhoInv, sol[2]*rhoInv, sol[3]*rhoInv};
+
+              const su2double dRhoDx = dSolDr[0]*drdx + dSolDs[0]*dsdx + dSolDt[0]*dtdx;
+              const su2double dRhoDy = dSolDr[0]*drdy + dSolDs[0]*dsdy + dSolDt[0]*dtdy;
+              const su2double dRhoDz = dSolDr[0]*drdz + dSolDs[0]*dsdz + dSolDt[0]*dtdz;
+
+              rhoSGS[i] = sol[0];
+              for(unsigned short k=0; k<3; ++k) {
+                const su2double dRhoVelDx = dSolDr[k+1]*drdx + dSolDs[k+1]*dsdx + dSolDt[k+1]*dtdx;
+                const su2double dRhoVelDy = dSolDr[k+1]*drdy + dSolDs[k+1]*dsdy + dSolDt[k+1]*dtdy;
+                const su2double dRhoVelDz = dSolDr[k+1]*drdz + dSolDs[k+1]*dsdz + dSolDt[k+1]*dtdz;
+
+                velGradSGS[i+(3*k  )*nInt] = rhoInv*(dRhoVelDx - vel[k]*dRhoDx);
+                velGradSGS[i+(3*k+1)*nInt] = rhoInv*(dRhoVelDy - vel[k]*dRhoDy);
+                velGradSGS[i+(3*k+2)*nInt] = rhoInv*(dRhoVelDz - vel[k]*dRhoDz);
+              }
+            }
+
+            const su2double lenScale = volElem[lInd].lenScale/nPoly;
+            SGSModel->ComputeEddyViscosity_3D(nInt, rhoSGS, velGradSGS, lenScale,
+                                              volElem[lInd].wallDistance.data(), muTurbSGS);
+          }
+
           for(unsigned short i=0; i<nInt; ++i) {
             const unsigned short iNPad = i*NPad;
 
@@ -3542,19 +3666,12 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
             const su2double divVel = dudx + dvdy + dwdz;
 
             /*--- Compute the pressure and the laminar viscosity. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure     = FluidModel->GetPressure();
-            const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
-
-            /*--- If an SGS model is used the eddy viscosity must be computed. ---*/
-            su2double ViscosityTurb = 0.0;
-            if( SGSModelUsed ) {
-              const su2double lenScale = volElem[lInd].lenScale/nPoly;
-              ViscosityTurb = SGSModel->ComputeEddyViscosity_3D(sol[0], dudx, dudy, dudz,
-                                                                dvdx, dvdy, dvdz, dwdx,
-                                                                dwdy, dwdz, lenScale,
-                                                                volElem[lInd].wallDistance[i]);
-            }
+            fluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure     = fluidModel->GetPressure();
+            const su2double ViscosityLam = fluidModel->GetLaminarViscosity();
+
+            /*--- The eddy viscosity of the SGS model has been computed above. ---*/
+            const su2double ViscosityTurb = SGSModelUsed ? muTurbSGS[i] : 0.0;
 
             /* Compute the total viscosity and heat conductivity. Note that the heat
                conductivity is divided by the Cv, because gradients of internal energy
@@ -3708,16 +3825,24 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
     /*---         integration over the volume element.                     ---*/
     /*------------------------------------------------------------------------*/
 
-    /* Call the general function to carry out the matrix product.
-       Use solDOFs as a temporary storage for the matrix product. */
-    blasFunctions->gemm(nDOFs, NPad, nInt*nDim, matDerBasisIntTrans, fluxes, solDOFs, config);
+    /* Call the general function to carry out the matrix product, or use
+       sum factorization. Use solDOFs as a temporary storage for the matrix product. */
+    if( sumFact )
+      standardElementsSol[ind].SumFactResidualFluxes(NPad, fluxes, solDOFs, workSumFact,
+                                                     blasFunctions, config);
+    else
+      blasFunctions->gemm(nDOFs, NPad, nInt*nDim, matDerBasisIntTrans, fluxes, solDOFs, config);
 
     /* Add the contribution from the source terms, if needed. Use solAndGradInt
        as temporary storage for the matrix product. */
     if( addSourceTerms ) {
 
       /* Call the general function to carry out the matrix product. */
-      blasFunctions->gemm(nDOFs, NPad, nInt, matBasisIntTrans, sources, solAndGradInt, config);
+      if( sumFact )
+        standardElementsSol[ind].SumFactResidualSources(NPad, sources, solAndGradInt, workSumFact,
+                                                        blasFunctions, config);
+      else
+        blasFunctions->gemm(nDOFs, NPad, nInt, matBasisIntTrans, sources, solAndGradInt, config);
 
       /* Add the residuals due to source terms to the volume residuals */
       for(unsigned short i=0; i<(nDOFs*NPad); ++i)
@@ -4154,6 +4279,193 @@ void CFEM_DG_NSSolver::ResidualFaces(CConfig             *config,
   }
 }
 
+template<unsigned short NDIM>
+void CFEM_DG_NSSolver::ViscousNormalFluxFaceBatch(const unsigned short indFaceChunk,
+                                                  const unsigned short nInt,
+                                                  const unsigned short NPad,
+                                                  const su2double      HeatFlux,
+                                                  const su2double      factHeatFlux,
+                                                  const su2double      lenScale_LES,
+                                                  const su2double      *solInt,
+                                                  const su2double      *gradSolInt,
+                                                  const su2double      *metricCoorDerivFace,
+                                                  const su2double      *metricNormalsFace,
+                                                  const su2double      *wallDistanceInt,
+                                                        su2double      *viscNormFluxes,
+                                                        su2double      *viscosityInt,
+                                                        su2double      *kOverCvInt) {
+
+  /* Fluid model of this thread, the tasks of the task list may run concurrently. */
+  CFluidModel *fluidModel = FluidModelThreads[omp_get_thread_num()];
+
+  /* Number of variables and the constant factors present in the heat flux
+     vector, namely the ratio of thermal conductivity and viscosity. */
+  constexpr unsigned short NVAR = NDIM+2;
+  const su2double factHeatFlux_Lam  = Gamma/Prandtl_Lam;
+  const su2double factHeatFlux_Turb = Gamma/Prandtl_Turb;
+
+  /* Determine the offset between r- and -s-derivatives, which is also the
+     offset between s- and t-derivatives. */
+  const unsigned short offDeriv = NPad*nInt;
+
+  /*--- Loop over the integration points in batches of SIZE_BATCH_FACE points. ---*/
+  for(unsigned short iBeg=0; iBeg<nInt; iBeg+=SIZE_BATCH_FACE) {
+
+    const unsigned short nLanes = min<unsigned short>(SIZE_BATCH_FACE, nInt-iBeg);
+
+    su2double sol[NVAR][SIZE_BATCH_FACE], dSol[NDIM][NVAR][SIZE_BATCH_FACE];
+    su2double metric[NDIM*NDIM][SIZE_BATCH_FACE], normal[NDIM+1][SIZE_BATCH_FACE];
+    su2double vel[NDIM][SIZE_BATCH_FACE], velGrad[NDIM][NDIM][SIZE_BATCH_FACE];
+    su2double dStaticEnergy[NDIM][SIZE_BATCH_FACE], StaticEnergy[SIZE_BATCH_FACE];
+    su2double Viscosity[SIZE_BATCH_FACE], kOverCv[SIZE_BATCH_FACE];
+    su2double flux[NVAR][SIZE_BATCH_FACE];
+
+    /*--- Gather the solution, its gradients w.r.t. the parametric coordinates
+          and the metric terms of the points of the batch in "structure of
+          arrays" layout. The lanes past the last point repeat it. ---*/
+    for(unsigned short k=0; k<SIZE_BATCH_FACE; ++k) {
+      const unsigned short i = iBeg + min<unsigned short>(k, nLanes-1);
+      const unsigned short offPointer = NPad*i + NVAR*indFaceChunk;
+
+      for(unsigned short iVar=0; iVar<NVAR; ++iVar) {
+        sol[iVar][k] = solInt[offPointer+iVar];
+        for(unsigned short iDim=0; iDim<NDIM; ++iDim)
+          dSol[iDim][iVar][k] = gradSolInt[offPointer+iDim*offDeriv+iVar];
+      }
+
+      for(unsigned short j=0; j<NDIM*NDIM; ++j) metric[j][k] = metricCoorDerivFace[i*NDIM*NDIM+j];
+      for(unsigned short j=0; j<=NDIM; ++j)     normal[j][k] = metricNormalsFace[i*(NDIM+1)+j];
+    }
+
+    /*--- Compute the velocities, the static energy and their Cartesian gradients. ---*/
+    SU2_OMP_SIMD
+    for(unsigned short k=0; k<SIZE_BATCH_FACE; ++k) {
+
+      /* Cartesian gradients of the conservative variables. */
+      su2double solGradCart[NVAR][NDIM];
+      for(unsigned short iVar=0; iVar<NVAR; ++iVar) {
+        for(unsigned short jDim=0; jDim<NDIM; ++jDim) {
+          solGradCart[iVar][jDim] = dSol[0][iVar][k]*metric[jDim][k];
+          for(unsigned short iDim=1; iDim<NDIM; ++iDim)
+            solGradCart[iVar][jDim] += dSol[iDim][iVar][k]*metric[iDim*NDIM+jDim][k];
+        }
+      }
+
+      const su2double rhoInv      = 1.0/sol[0][k];
+      const su2double TotalEnergy = rhoInv*sol[NVAR-1][k];
+
+      su2double kinEnergy = 0.0;
+      for(unsigned short iDim=0; iDim<NDIM; ++iDim) {
+        vel[iDim][k] = rhoInv*sol[iDim+1][k];
+        kinEnergy   += vel[iDim][k]*vel[iDim][k];
+      }
+      StaticEnergy[k] = TotalEnergy - 0.5*kinEnergy;
+
+      for(unsigned short iDim=0; iDim<NDIM; ++iDim)
+        for(unsigned short jDim=0; jDim<NDIM; ++jDim)
+          velGrad[iDim][jDim][k] = rhoInv*(solGradCart[iDim+1][jDim] - vel[iDim][k]*solGradCart[0][jDim]);
+
+      for(unsigned short jDim=0; jDim<NDIM; ++jDim) {
+        su2double dEdx = rhoInv*(solGradCart[NVAR-1][jDim] - TotalEnergy*solGradCart[0][jDim]);
+        for(unsigned short iDim=0; iDim<NDIM; ++iDim)
+          dEdx -= vel[iDim][k]*velGrad[iDim][jDim][k];
+        dStaticEnergy[jDim][k] = dEdx;
+      }
+    }
+
+    /*--- Compute the laminar viscosity and the eddy viscosity, if needed. The
+          fluid model and the subgrid scale model are evaluated per point and
+          only for the valid lanes, the remaining lanes copy the last one. ---*/
+    for(unsigned short k=0; k<nLanes; ++k) {
+
+      fluidModel->SetTDState_rhoe(sol[0][k], StaticEnergy[k]);
+      const su2double ViscosityLam = fluidModel->GetLaminarViscosity();
+
+      su2double ViscosityTurb = 0.0;
+      if( SGSModelUsed ) {
+        const su2double wallDist = wallDistanceInt ? wallDistanceInt[iBeg+k] : 0.0;
+        if(NDIM == 2)
+          ViscosityTurb = SGSModel->ComputeEddyViscosity_2D(sol[0][k], velGrad[0][0][k], velGrad[0][1][k],
+                                                            velGrad[1][0][k], velGrad[1][1][k],
+                                                            lenScale_LES, wallDist);
+        else
+          ViscosityTurb = SGSModel->ComputeEddyViscosity_3D(sol[0][k], velGrad[0][0][k], velGrad[0][1][k],
+                                                            velGrad[0][NDIM-1][k], velGrad[1][0][k],
+                                                            velGrad[1][1][k], velGrad[1][NDIM-1][k],
+                                                            velGrad[NDIM-1][0][k], velGrad[NDIM-1][1][k],
+                                                            velGrad[NDIM-1][NDIM-1][k], lenScale_LES, wallDist);
+      }
+
+      /* Compute the total viscosity and heat conductivity. Note that the heat
+         conductivity is divided by the Cv, because gradients of internal energy
+         are computed and not temperature. */
+      Viscosity[k] = ViscosityLam + ViscosityTurb;
+      kOverCv[k]   = ViscosityLam*factHeatFlux_Lam + ViscosityTurb*factHeatFlux_Turb;
+    }
+
+    for(unsigned short k=nLanes; k<SIZE_BATCH_FACE; ++k) {
+      Viscosity[k] = Viscosity[nLanes-1];
+      kOverCv[k]   = kOverCv[nLanes-1];
+    }
+
+    /*--- Compute the viscous normal fluxes. ---*/
+    SU2_OMP_SIMD
+    for(unsigned short k=0; k<SIZE_BATCH_FACE; ++k) {
+
+      /*--- Set the value of the second viscosity and compute the divergence
+            term in the viscous normal stresses. ---*/
+      su2double divVel = 0.0;
+      for(unsigned short iDim=0; iDim<NDIM; ++iDim) divVel += velGrad[iDim][iDim][k];
+
+      const su2double lambda     = -TWO3*Viscosity[k];
+      const su2double lamDivTerm =  lambda*divVel;
+
+      /*--- Compute the viscous stress tensor and minus the heatflux vector.
+            The heat flux vector is multiplied by factHeatFlux, such that the
+            case of a prescribed heat flux is treated correctly. ---*/
+      su2double tau[NDIM][NDIM], q[NDIM];
+      for(unsigned short iDim=0; iDim<NDIM; ++iDim) {
+        for(unsigned short jDim=0; jDim<NDIM; ++jDim)
+          tau[iDim][jDim] = Viscosity[k]*(velGrad[iDim][jDim][k] + velGrad[jDim][iDim][k]);
+        tau[iDim][iDim] = 2.0*Viscosity[k]*velGrad[iDim][iDim][k] + lamDivTerm;
+        q[iDim] = factHeatFlux*kOverCv[k]*dStaticEnergy[iDim][k];
+      }
+
+      /*--- Compute the unscaled normal vector and the viscous normal flux.
+            Note that the energy flux gets a contribution from both the
+            prescribed and the computed heat flux. At least one of these
+            terms is zero. ---*/
+      su2double n[NDIM];
+      for(unsigned short jDim=0; jDim<NDIM; ++jDim) n[jDim] = normal[jDim][k]*normal[NDIM][k];
+
+      flux[0][k] = 0.0;
+      for(unsigned short iDim=0; iDim<NDIM; ++iDim) {
+        flux[iDim+1][k] = tau[iDim][0]*n[0];
+        for(unsigned short jDim=1; jDim<NDIM; ++jDim) flux[iDim+1][k] += tau[iDim][jDim]*n[jDim];
+      }
+
+      flux[NVAR-1][k] = normal[NDIM][k]*HeatFlux;
+      for(unsigned short jDim=0; jDim<NDIM; ++jDim) {
+        su2double workTerm = vel[0][k]*tau[0][jDim];
+        for(unsigned short iDim=1; iDim<NDIM; ++iDim) workTerm += vel[iDim][k]*tau[iDim][jDim];
+        flux[NVAR-1][k] += (workTerm + q[jDim])*n[jDim];
+      }
+    }
+
+    /*--- Scatter the fluxes, the viscosity and the thermal conductivity
+          of the valid lanes. ---*/
+    for(unsigned short k=0; k<nLanes; ++k) {
+      const unsigned short i = iBeg + k;
+      su2double *normalFlux = viscNormFluxes + NPad*i + NVAR*indFaceChunk;
+      for(unsigned short iVar=0; iVar<NVAR; ++iVar) normalFlux[iVar] = flux[iVar][k];
+
+      const unsigned short ind = indFaceChunk*nInt + i;
+      viscosityInt[ind] = Viscosity[k];
+      kOverCvInt[ind]   = kOverCv[k];
+    }
+  }
+}
+
 void CFEM_DG_NSSolver::ViscousNormalFluxFace(const CVolumeElementFEM *adjVolElem,
                                              const unsigned short    indFaceChunk,
                                              const unsigned short    nInt,
@@ -4183,6 +4495,22 @@ void CFEM_DG_NSSolver::ViscousNormalFluxFace(const CVolumeElementFEM *adjVolElem
 
   const su2double lenScale_LES = adjVolElem->lenScale/nPoly;
 
+  /* If the face has at least SIZE_BATCH_FACE integration points, the fluxes
+     are computed in batches of points, such that the arithmetic vectorizes. */
+  if(nInt >= SIZE_BATCH_FACE) {
+    if(nDim == 2)
+      ViscousNormalFluxFaceBatch<2>(indFaceChunk, nInt, NPad, HeatFlux, factHeatFlux,
+                                    lenScale_LES, solInt, gradSolInt, metricCoorDerivFace,
+                                    metricNormalsFace, wallDistanceInt, viscNormFluxes,
+                                    viscosityInt, kOverCvInt);
+    else
+      ViscousNormalFluxFaceBatch<3>(indFaceChunk, nInt, NPad, HeatFlux, factHeatFlux,
+                                    lenScale_LES, solInt, gradSolInt, metricCoorDerivFace,
+                                    metricNormalsFace, wallDistanceInt, viscNormFluxes,
+                                    viscosityInt, kOverCvInt);
+    return;
+  }
+
   /* Determine the offset between r- and -s-derivatives, which is also the
      offset between s- and t-derivatives. */
   const unsigned short offDeriv = NPad*nInt;
@@ -6300,10 +6628,21 @@ void CFEM_DG_NSSolver::WallTreatmentViscousFluxes(
                                         su2double          *kOverCvInt,
                                         CWallModel         *wallModel) {
 
+  /* Easier storage of the number of consecutive evaluations for which the
+     wall model data is reused and of the fluid model of this thread. */
+  const unsigned short nFreeze = config->GetWallModel_FreezeStages();
+  CFluidModel *fluidModel      = FluidModelThreads[omp_get_thread_num()];
+
   /* Loop over the simultaneously treated faces. */
   for(unsigned short l=0; l<nFaceSimul; ++l) {
     const unsigned short llNVar = l*nVar;
 
+    /* Determine whether the wall model must be evaluated or whether the data
+       of a previous evaluation, stored per integration point, is reused. */
+    su2double *wallData = surfElem[l].wallModelData.data();
+    const bool evalWallModel = (surfElem[l].nWallModelEvaluations%nFreeze) == 0;
+    ++surfElem[l].nWallModelEvaluations;
+
     /* Loop over the donors for this boundary face. */
     for(unsigned long j=0; j<surfElem[l].donorsWallFunction.size(); ++j) {
 
@@ -6318,39 +6657,54 @@ void CFEM_DG_NSSolver::WallTreatmentViscousFluxes(
                                      + nVar*volElem[donorID].offsetDOFsSolThisTimeLevel;
 
       /* Determine the number of integration points for this donor and
-         interpolate the solution for the corresponding exchange points. */
+         interpolate the solution for the corresponding exchange points.
+         The exchange states of all donors are stored consecutively. */
       const unsigned short nIntThisDonor = surfElem[l].nIntPerWallFunctionDonor[j+1]
                                          - surfElem[l].nIntPerWallFunctionDonor[j];
 
       blasFunctions->gemm(nIntThisDonor, nVar, nDOFsElem, surfElem[l].matWallFunctionDonor[j].data(),
-                          solDOFsElem, workArray, config);
+                          solDOFsElem, workArray + nVar*surfElem[l].nIntPerWallFunctionDonor[j],
+                          config);
+    }
+
+    /*--- Loop over the exchange points in batches, such that the wall model
+          can treat multiple points simultaneously. ---*/
+    for(unsigned short iBeg=0; iBeg<nInt; iBeg+=SIZE_BATCH_WALL_MODEL) {
+      const unsigned short nBatch = min(SIZE_BATCH_WALL_MODEL, nInt-iBeg);
 
-      /* Loop over the integration points for this donor element. */
-      for(unsigned short i=surfElem[l].nIntPerWallFunctionDonor[j];
-                         i<surfElem[l].nIntPerWallFunctionDonor[j+1]; ++i) {
+      su2double tExchange[SIZE_BATCH_WALL_MODEL], velExchange[SIZE_BATCH_WALL_MODEL];
+      su2double muExchange[SIZE_BATCH_WALL_MODEL], pExchange[SIZE_BATCH_WALL_MODEL];
+      su2double tauWall[SIZE_BATCH_WALL_MODEL], qWall[SIZE_BATCH_WALL_MODEL];
+      su2double ViscosityWall[SIZE_BATCH_WALL_MODEL], kOverCvWall[SIZE_BATCH_WALL_MODEL];
+      su2double dirTan[3*SIZE_BATCH_WALL_MODEL];
+
+      /* Loop over the points of the batch to determine the data in the exchange points. */
+      for(unsigned short i=0; i<nBatch; ++i) {
 
         /* Easier storage of the actual integration point. */
-        const unsigned short ii = surfElem[l].intPerWallFunctionDonor[i];
+        const unsigned short ii = surfElem[l].intPerWallFunctionDonor[iBeg+i];
 
         /* Determine the normal and the wall velocity for this integration point. */
         const su2double *normals = surfElem[l].metricNormalsFace.data() + ii*(nDim+1);
         const su2double *gridVel = surfElem[l].gridVelocities.data() + ii*nDim;
 
-        /* Determine the velocities and pressure in the exchange point. */
-        const su2double *solInt = workArray
-                                + nVar*(i-surfElem[l].nIntPerWallFunctionDonor[j]);
+        /* Determine the velocities and, if needed, the thermodynamic
+           state in the exchange point. */
+        const su2double *solInt = workArray + nVar*(iBeg+i);
 
         su2double rhoInv = 1.0/solInt[0];
         su2double vel[]  = {0.0, 0.0, 0.0};
         for(unsigned short k=0; k<nDim; ++k) vel[k] = rhoInv*solInt[k+1];
 
-        su2double vel2Mag = vel[0]*vel[0] + vel[1]*vel[1] + vel[2]*vel[2];
-        su2double eInt    = rhoInv*solInt[nVar-1] - 0.5*vel2Mag;
+        if( evalWallModel ) {
+          su2double vel2Mag = vel[0]*vel[0] + vel[1]*vel[1] + vel[2]*vel[2];
+          su2double eInt    = rhoInv*solInt[nVar-1] - 0.5*vel2Mag;
 
-        FluidModel->SetTDState_rhoe(solInt[0], eInt);
-        const su2double Pressure = FluidModel->GetPressure();
-        const su2double Temperature = FluidModel->GetTemperature();
-        const su2double LaminarViscosity= FluidModel->GetLaminarViscosity();
+          fluidModel->SetTDState_rhoe(solInt[0], eInt);
+          pExchange[i]  = fluidModel->GetPressure();
+          tExchange[i]  = fluidModel->GetTemperature();
+          muExchange[i] = fluidModel->GetLaminarViscosity();
+        }
 
         /* Subtract the prescribed wall velocity, i.e. grid velocity
            from the velocity in the exchange point. */
@@ -6367,24 +6721,49 @@ void CFEM_DG_NSSolver::WallTreatmentViscousFluxes(
         su2double velTan = sqrt(vel[0]*vel[0] + vel[1]*vel[1] + vel[2]*vel[2]);
         velTan = max(velTan,1.e-25);
 
-        su2double dirTan[] = {0.0, 0.0, 0.0};
-        for(unsigned short k=0; k<nDim; ++k) dirTan[k] = vel[k]/velTan;
+        velExchange[i] = velTan;
+        for(unsigned short k=0; k<nDim; ++k) dirTan[3*i+k] = vel[k]/velTan;
 
-        /* Compute the wall shear stress and heat flux vector using
-           the wall model. */
-        su2double tauWall, qWall, ViscosityWall, kOverCvWall;
+        /* The wall shear stress of the previous evaluation is the initial guess. */
+        tauWall[i] = wallData[4*ii];
+      }
 
-        wallModel->WallShearStressAndHeatFlux(Temperature, velTan, LaminarViscosity, Pressure,
-                                              Wall_HeatFlux, HeatFlux_Prescribed,
+      /* Compute the wall shear stress and heat flux using the wall model for
+         all points of the batch and store the results, or retrieve the stored
+         results when the wall model is frozen. */
+      if( evalWallModel ) {
+        wallModel->WallShearStressAndHeatFlux(nBatch, tExchange, velExchange, muExchange,
+                                              pExchange, Wall_HeatFlux, HeatFlux_Prescribed,
                                               Wall_Temperature, Temperature_Prescribed,
-                                              FluidModel, tauWall, qWall, ViscosityWall,
+                                              fluidModel, tauWall, qWall, ViscosityWall,
                                               kOverCvWall);
 
+        for(unsigned short i=0; i<nBatch; ++i) {
+          su2double *data = wallData + 4*surfElem[l].intPerWallFunctionDonor[iBeg+i];
+          data[0] = tauWall[i]; data[1] = qWall[i]; data[2] = ViscosityWall[i]; data[3] = kOverCvWall[i];
+        }
+      }
+      else {
+        for(unsigned short i=0; i<nBatch; ++i) {
+          const su2double *data = wallData + 4*surfElem[l].intPerWallFunctionDonor[iBeg+i];
+          tauWall[i] = data[0]; qWall[i] = data[1]; ViscosityWall[i] = data[2]; kOverCvWall[i] = data[3];
+        }
+      }
+
+      /* Loop over the points of the batch to compute the viscous fluxes. */
+      for(unsigned short i=0; i<nBatch; ++i) {
+
+        /* Easier storage of the actual integration point, its normal
+           and the tangential direction. */
+        const unsigned short ii = surfElem[l].intPerWallFunctionDonor[iBeg+i];
+        const su2double *normals = surfElem[l].metricNormalsFace.data() + ii*(nDim+1);
+        const su2double *dirT    = dirTan + 3*i;
+
         /* Compute the wall velocity in tangential direction. */
         const su2double *solWallInt = solIntL + NPad*ii + llNVar;
         su2double velWallTan = 0.0;
         for(unsigned short k=0; k<nDim; ++k)
-          velWallTan += solWallInt[k+1]*dirTan[k];
+          velWallTan += solWallInt[k+1]*dirT[k];
         velWallTan /= solWallInt[0];
 
         /* Determine the position where the viscous fluxes, viscosity and
@@ -6392,15 +6771,15 @@ void CFEM_DG_NSSolver::WallTreatmentViscousFluxes(
         su2double *normalFlux = viscFluxes + NPad*ii + llNVar;
 
         const unsigned short ind = l*nInt + ii;
-        viscosityInt[ind] = ViscosityWall;
-        kOverCvInt[ind]   = kOverCvWall;
+        viscosityInt[ind] = ViscosityWall[i];
+        kOverCvInt[ind]   = kOverCvWall[i];
 
         /* Compute the viscous normal flux. Note that the unscaled normals
            must be used, hence the multiplication with normals[nDim]. */
         normalFlux[0] = 0.0;
         for(unsigned short k=0; k<nDim; ++k)
-          normalFlux[k+1] = -normals[nDim]*tauWall*dirTan[k];
-        normalFlux[nVar-1] = normals[nDim]*(qWall - tauWall*velWallTan);
+          normalFlux[k+1] = -normals[nDim]*tauWall[i]*dirT[k];
+        normalFlux[nVar-1] = normals[nDim]*(qWall[i] - tauWall[i]*velWallTan);
       }
     }
   }
@@ -27,6 +27,7 @@
 
 
 #include "../../include/solvers/CHeatSolver.hpp"
+#include "../../../Common/include/omp_structure.hpp"
 
 CHeatSolver::CHeatSolver(void) : CSolver() {
 
@@ -68,6 +69,29 @@ CHeatSolver::CHeatSolver(CGeometry *geometry, CConfig *config, unsigned short iM
   nDim = geometry->GetnDim();
   nMarker = config->GetnMarker_All();
 
+#ifdef HAVE_OMP
+  /*--- Get the edge coloring, see notes in CEulerSolver's constructor. ---*/
+  su2double parallelEff = 1.0;
+  const auto& coloring = geometry->GetEdgeColoring(&parallelEff);
+
+  ReducerStrategy = parallelEff < COLORING_EFF_THRESH;
+
+  if (ReducerStrategy && (coloring.getOuterSize()>1))
+    geometry->SetNaturalEdgeColoring();
+
+  if (!coloring.empty()) {
+    auto groupSize = ReducerStrategy? 1ul : geometry->GetEdgeColorGroupSize();
+    auto nColor = coloring.getOuterSize();
+    EdgeColoring.reserve(nColor);
+
+    for(auto iColor = 0ul; iColor < nColor; ++iColor)
+      EdgeColoring.emplace_back(coloring.innerIdx(iColor), coloring.getNumNonZeros(iColor), groupSize);
+  }
+
+  omp_chunk_size = computeStaticChunkSize(nPoint, omp_get_max_threads(), OMP_MAX_SIZE);
+#else
+  EdgeColoring[0] = DummyGridColor<>(geometry->GetnEdge());
+#endif
   CurrentMesh = iMesh;
   /*--- Define some auxiliar vector related with the residual ---*/
 
@@ -100,11 +124,6 @@ CHeatSolver::CHeatSolver(CGeometry *geometry, CConfig *config, unsigned short iM
   Vector_i = new su2double[nDim]; for (iDim = 0; iDim < nDim; iDim++) Vector_i[iDim] = 0.0;
   Vector_j = new su2double[nDim]; for (iDim = 0; iDim < nDim; iDim++) Vector_j[iDim] = 0.0;
 
-  /*--- Define some auxiliary vectors related to the primitive flow solution ---*/
-
-  Primitive_Flow_i = new su2double[nDim+1]; for (iVar = 0; iVar < nDim+1; iVar++) Primitive_Flow_i[iVar] = 0.0;
-  Primitive_Flow_j = new su2double[nDim+1]; for (iVar = 0; iVar < nDim+1; iVar++) Primitive_Flow_j[iVar] = 0.0;
-
   /*--- Jacobians and vector structures for implicit computations ---*/
 
   Jacobian_i = new su2double* [nVar];
@@ -117,7 +136,7 @@ CHeatSolver::CHeatSolver(CGeometry *geometry, CConfig *config, unsigned short iM
   /*--- Initialization of the structure of the whole Jacobian ---*/
 
   if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (heat equation) MG level: " << iMesh << "." << endl;
-  Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+  Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config, ReducerStrategy);
 
   if (config->GetKind_Linear_Solver_Prec() == LINELET) {
     nLineLets = Jacobian.BuildLineletPreconditioner(geometry, config);
@@ -127,6 +146,9 @@ CHeatSolver::CHeatSolver(CGeometry *geometry, CConfig *config, unsigned short iM
   LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
   LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
 
+  if (ReducerStrategy)
+    EdgeFluxes.Initialize(geometry->GetnEdge(), geometry->GetnEdge(), nVar, nullptr);
+
   if (config->GetExtraOutput()) {
     if (nDim == 2) { nOutputVariables = 13; }
     else if (nDim == 3) { nOutputVariables = 19; }
@@ -270,19 +292,16 @@ CHeatSolver::~CHeatSolver(void) {
 
 void CHeatSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iMesh, unsigned short iRKStep, unsigned short RunTime_EqSystem, bool Output) {
 
-  unsigned long iPoint;
   bool center = (config->GetKind_ConvNumScheme_Heat() == SPACE_CENTERED);
 
   if (center) {
     SetUndivided_Laplacian(geometry, config);
   }
 
-  for (iPoint = 0; iPoint < nPoint; iPoint ++) {
+  /*--- Initialize the residual vector, and the edge fluxes of the reducer strategy ---*/
 
-    /*--- Initialize the residual vector ---*/
-
-    LinSysRes.SetBlock_Zero(iPoint);
-  }
+  LinSysRes.SetValZero();
+  if (ReducerStrategy) EdgeFluxes.SetValZero();
 
   /*--- Initialize the Jacobian matrices ---*/
 
@@ -364,26 +383,23 @@ void CHeatSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig *
   /*--- Load data from the restart into correct containers. ---*/
 
   counter = 0;
-  for (iPoint_Global = 0; iPoint_Global < geometry[MESH_0]->GetGlobal_nPointDomain(); iPoint_Global++ ) {
+  for (const auto& globalToLocal : geometry[MESH_0]->GetGlobal_to_Local_Map()) {
 
-    /*--- Retrieve local index. If this node from the restart file lives
-     on the current processor, we will load and instantiate the vars. ---*/
+    /*--- The points of this rank, in the order of their data in the restart file. ---*/
 
-    iPoint_Local = geometry[MESH_0]->GetGlobal_to_Local_Point(iPoint_Global);
+    iPoint_Global = globalToLocal.first;
+    iPoint_Local = globalToLocal.second;
 
-    if (iPoint_Local > -1) {
+    /*--- We need to store this point's data, so jump to the correct
+     offset in the buffer of data from the restart file and load it. ---*/
 
-      /*--- We need to store this point's data, so jump to the correct
-       offset in the buffer of data from the restart file and load it. ---*/
+    index = counter*Restart_Vars[1] + skipVars;
+    for (iVar = 0; iVar < nVar; iVar++) Solution[iVar] = Restart_Data[index+iVar];
+    nodes->SetSolution(iPoint_Local,Solution);
+    iPoint_Global_Local++;
 
-      index = counter*Restart_Vars[1] + skipVars;
-      for (iVar = 0; iVar < nVar; iVar++) Solution[iVar] = Restart_Data[index+iVar];
-      nodes->SetSolution(iPoint_Local,Solution);
-      iPoint_Global_Local++;
-
-      /*--- Increment the overall counter for how many points have been loaded. ---*/
-      counter++;
-    }
+    /*--- Increment the overall counter for how many points have been loaded. ---*/
+    counter++;
 
   }
 
@@ -454,85 +470,86 @@ void CHeatSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig *
 
 void CHeatSolver::SetUndivided_Laplacian(CGeometry *geometry, CConfig *config) {
 
-  unsigned long iPoint, jPoint, iEdge;
-  su2double *Diff;
-  unsigned short iVar;
-  bool boundary_i, boundary_j;
+  /*--- Loop domain points, each point gathers the differences with its neighbors (thread safety). ---*/
 
-  Diff = new su2double[nVar];
+  SU2_OMP_FOR_DYN(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
-  nodes->SetUnd_LaplZero();
+    const bool boundary_i = geometry->node[iPoint]->GetPhysicalBoundary();
 
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+    for (unsigned short iVar = 0; iVar < nVar; iVar++)
+      nodes->SetUnd_Lapl(iPoint, iVar, 0.0);
 
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
+    for (unsigned short iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); iNeigh++) {
 
-    /*--- Solution differences ---*/
+      const unsigned long jPoint = geometry->node[iPoint]->GetPoint(iNeigh);
+      const bool boundary_j = geometry->node[jPoint]->GetPhysicalBoundary();
 
-    for (iVar = 0; iVar < nVar; iVar++)
-      Diff[iVar] = nodes->GetSolution(iPoint,iVar) - nodes->GetSolution(jPoint,iVar);
+      /*--- Points on the boundary only take contributions from other boundary points ---*/
 
-    boundary_i = geometry->node[iPoint]->GetPhysicalBoundary();
-    boundary_j = geometry->node[jPoint]->GetPhysicalBoundary();
+      if (boundary_i && !boundary_j) continue;
 
-    /*--- Both points inside the domain, or both in the boundary ---*/
+      /*--- Solution differences ---*/
 
-    if ((!boundary_i && !boundary_j) || (boundary_i && boundary_j)) {
-      if (geometry->node[iPoint]->GetDomain()) nodes->SubtractUnd_Lapl(iPoint,Diff);
-      if (geometry->node[jPoint]->GetDomain()) nodes->AddUnd_Lapl(jPoint,Diff);
+      for (unsigned short iVar = 0; iVar < nVar; iVar++)
+        nodes->AddUnd_Lapl(iPoint, iVar, nodes->GetSolution(jPoint,iVar) - nodes->GetSolution(iPoint,iVar));
     }
-
-    /*--- iPoint inside the domain, jPoint on the boundary ---*/
-
-    if (!boundary_i && boundary_j)
-      if (geometry->node[iPoint]->GetDomain()) nodes->SubtractUnd_Lapl(iPoint,Diff);
-
-    /*--- jPoint inside the domain, iPoint on the boundary ---*/
-
-    if (boundary_i && !boundary_j)
-      if (geometry->node[jPoint]->GetDomain()) nodes->AddUnd_Lapl(jPoint,Diff);
-
   }
 
   /*--- MPI parallelization ---*/
 
-  InitiateComms(geometry, config, UNDIVIDED_LAPLACIAN);
-  CompleteComms(geometry, config, UNDIVIDED_LAPLACIAN);
-
-  delete [] Diff;
+  SU2_OMP_MASTER
+  {
+    InitiateComms(geometry, config, UNDIVIDED_LAPLACIAN);
+    CompleteComms(geometry, config, UNDIVIDED_LAPLACIAN);
+  }
+  SU2_OMP_BARRIER
 
 }
 
 void CHeatSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_container,  CNumerics **numerics_container,
                                     CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
 
-  CNumerics* numerics = numerics_container[CONV_TERM];
+  /*--- Pick one numerics object per thread. ---*/
+  CNumerics* numerics = numerics_container[CONV_TERM + omp_get_thread_num()*MAX_TERMS];
 
-  su2double *V_i, *V_j, Temp_i, Temp_j;
-  unsigned long iEdge, iPoint, jPoint;
   bool flow = ((config->GetKind_Solver() == INC_NAVIER_STOKES)
                || (config->GetKind_Solver() == INC_RANS)
                || (config->GetKind_Solver() == DISC_ADJ_INC_NAVIER_STOKES)
                || (config->GetKind_Solver() == DISC_ADJ_INC_RANS));
 
+  /*--- Static arrays for the residual and Jacobians of each edge (thread safety). ---*/
+  su2double residual[MAXNVAR] = {0.0}, jacobian_i[MAXNVAR][MAXNVAR] = {{0.0}}, jacobian_j[MAXNVAR][MAXNVAR] = {{0.0}};
+  su2double *Jac_i[MAXNVAR], *Jac_j[MAXNVAR];
+  for (unsigned short iVar = 0; iVar < MAXNVAR; iVar++) {
+    Jac_i[iVar] = jacobian_i[iVar];
+    Jac_j[iVar] = jacobian_j[iVar];
+  }
+
   if(flow) {
 
-    nVarFlow = solver_container[FLOW_SOL]->GetnVar();
+    CVariable* flowNodes = solver_container[FLOW_SOL]->GetNodes();
+
+    /*--- Loop over edge colors. ---*/
+    for (auto color : EdgeColoring)
+    {
+    /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+    SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+    for(auto k = 0ul; k < color.size; ++k) {
 
-    for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+      auto iEdge = color.indices[k];
 
       /*--- Points in edge ---*/
-      iPoint = geometry->edge[iEdge]->GetNode(0);
-      jPoint = geometry->edge[iEdge]->GetNode(1);
+      unsigned long iPoint = geometry->edge[iEdge]->GetNode(0);
+      unsigned long jPoint = geometry->edge[iEdge]->GetNode(1);
       numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
 
       /*--- Primitive variables w/o reconstruction ---*/
-      V_i = solver_container[FLOW_SOL]->GetNodes()->GetPrimitive(iPoint);
-      V_j = solver_container[FLOW_SOL]->GetNodes()->GetPrimitive(jPoint);
+      su2double *V_i = flowNodes->GetPrimitive(iPoint);
+      su2double *V_j = flowNodes->GetPrimitive(jPoint);
 
-      Temp_i = nodes->GetSolution(iPoint,0);
-      Temp_j = nodes->GetSolution(jPoint,0);
+      su2double Temp_i = nodes->GetSolution(iPoint,0);
+      su2double Temp_j = nodes->GetSolution(jPoint,0);
 
       numerics->SetUndivided_Laplacian(nodes->GetUndivided_Laplacian(iPoint), nodes->GetUndivided_Laplacian(jPoint));
       numerics->SetNeighbor(geometry->node[iPoint]->GetnNeighbor(), geometry->node[jPoint]->GetnNeighbor());
@@ -540,65 +557,91 @@ void CHeatSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_contai
       numerics->SetPrimitive(V_i, V_j);
       numerics->SetTemperature(Temp_i, Temp_j);
 
-      numerics->ComputeResidual(Residual, Jacobian_i, Jacobian_j, config);
+      numerics->ComputeResidual(residual, Jac_i, Jac_j, config);
 
-      LinSysRes.AddBlock(iPoint, Residual);
-      LinSysRes.SubtractBlock(jPoint, Residual);
+      if (ReducerStrategy) {
+        EdgeFluxes.AddBlock(iEdge, residual);
+        Jacobian.UpdateBlocks(iEdge, Jac_i, Jac_j);
+      }
+      else {
+        LinSysRes.AddBlock(iPoint, residual);
+        LinSysRes.SubtractBlock(jPoint, residual);
 
-      /*--- Implicit part ---*/
+        /*--- Implicit part ---*/
 
-      Jacobian.UpdateBlocks(iEdge, iPoint, jPoint, Jacobian_i, Jacobian_j);
+        Jacobian.UpdateBlocks(iEdge, iPoint, jPoint, Jac_i, Jac_j);
+      }
     }
+    } // end color loop
   }
 }
 
 void CHeatSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_container,
                                   CNumerics **numerics_container, CConfig *config, unsigned short iMesh) {
 
-  CNumerics* numerics = numerics_container[CONV_TERM];
+  /*--- Pick one numerics object per thread. ---*/
+  CNumerics* numerics = numerics_container[CONV_TERM + omp_get_thread_num()*MAX_TERMS];
 
-  su2double *V_i, *V_j, Temp_i, Temp_i_Corrected, Temp_j, Temp_j_Corrected, **Gradient_i, **Gradient_j, Project_Grad_i, Project_Grad_j,
-            **Temp_i_Grad, **Temp_j_Grad, Project_Temp_i_Grad, Project_Temp_j_Grad;
-  unsigned short iDim, iVar;
-  unsigned long iEdge, iPoint, jPoint;
   bool flow = ((config->GetKind_Solver() == INC_NAVIER_STOKES)
                || (config->GetKind_Solver() == INC_RANS)
                || (config->GetKind_Solver() == DISC_ADJ_INC_NAVIER_STOKES)
                || (config->GetKind_Solver() == DISC_ADJ_INC_RANS));
   bool muscl = (config->GetMUSCL_Heat());
 
+  /*--- Static arrays of MUSCL-reconstructed flow primitives, and for the residual
+   *    and Jacobians of each edge (thread safety). ---*/
+  su2double Primitive_Flow_i[MAXNVARFLOW] = {0.0}, Primitive_Flow_j[MAXNVARFLOW] = {0.0};
+  su2double residual[MAXNVAR] = {0.0}, jacobian_i[MAXNVAR][MAXNVAR] = {{0.0}}, jacobian_j[MAXNVAR][MAXNVAR] = {{0.0}};
+  su2double *Jac_i[MAXNVAR], *Jac_j[MAXNVAR];
+  for (unsigned short iVar = 0; iVar < MAXNVAR; iVar++) {
+    Jac_i[iVar] = jacobian_i[iVar];
+    Jac_j[iVar] = jacobian_j[iVar];
+  }
+
   if(flow) {
 
-    nVarFlow = solver_container[FLOW_SOL]->GetnVar();
+    CVariable* flowNodes = solver_container[FLOW_SOL]->GetNodes();
+    const unsigned short nVarFlow = solver_container[FLOW_SOL]->GetnVar();
+
+    /*--- Loop over edge colors. ---*/
+    for (auto color : EdgeColoring)
+    {
+    /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+    SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+    for(auto k = 0ul; k < color.size; ++k) {
+
+      auto iEdge = color.indices[k];
 
-    for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+      unsigned short iDim, iVar;
 
       /*--- Points in edge ---*/
-      iPoint = geometry->edge[iEdge]->GetNode(0);
-      jPoint = geometry->edge[iEdge]->GetNode(1);
+      unsigned long iPoint = geometry->edge[iEdge]->GetNode(0);
+      unsigned long jPoint = geometry->edge[iEdge]->GetNode(1);
       numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
 
       /*--- Primitive variables w/o reconstruction ---*/
-      V_i = solver_container[FLOW_SOL]->GetNodes()->GetPrimitive(iPoint);
-      V_j = solver_container[FLOW_SOL]->GetNodes()->GetPrimitive(jPoint);
+      su2double *V_i = flowNodes->GetPrimitive(iPoint);
+      su2double *V_j = flowNodes->GetPrimitive(jPoint);
 
-      Temp_i_Grad = nodes->GetGradient(iPoint);
-      Temp_j_Grad = nodes->GetGradient(jPoint);
+      su2double **Temp_i_Grad = nodes->GetGradient(iPoint);
+      su2double **Temp_j_Grad = nodes->GetGradient(jPoint);
       numerics->SetConsVarGradient(Temp_i_Grad, Temp_j_Grad);
 
-      Temp_i = nodes->GetSolution(iPoint,0);
-      Temp_j = nodes->GetSolution(jPoint,0);
+      su2double Temp_i = nodes->GetSolution(iPoint,0);
+      su2double Temp_j = nodes->GetSolution(jPoint,0);
 
       /* Second order reconstruction */
       if (muscl) {
 
+        su2double Vector_i[MAXNDIM] = {0.0}, Vector_j[MAXNDIM] = {0.0};
+
         for (iDim = 0; iDim < nDim; iDim++) {
           Vector_i[iDim] = 0.5*(geometry->node[jPoint]->GetCoord(iDim) - geometry->node[iPoint]->GetCoord(iDim));
           Vector_j[iDim] = 0.5*(geometry->node[iPoint]->GetCoord(iDim) - geometry->node[jPoint]->GetCoord(iDim));
         }
 
-        Gradient_i = solver_container[FLOW_SOL]->GetNodes()->GetGradient_Reconstruction(iPoint);
-        Gradient_j = solver_container[FLOW_SOL]->GetNodes()->GetGradient_Reconstruction(jPoint);
+        su2double **Gradient_i = flowNodes->GetGradient_Reconstruction(iPoint);
+        su2double **Gradient_j = flowNodes->GetGradient_Reconstruction(jPoint);
         Temp_i_Grad = nodes->GetGradient_Reconstruction(iPoint);
         Temp_j_Grad = nodes->GetGradient_Reconstruction(jPoint);
 
@@ -606,7 +649,7 @@ void CHeatSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_containe
         for (iVar = 0; iVar < nVarFlow; iVar++) {
 
           /*Apply the Gradient to get the right temperature value on the edge */
-          Project_Grad_i = 0.0; Project_Grad_j = 0.0;
+          su2double Project_Grad_i = 0.0, Project_Grad_j = 0.0;
           for (iDim = 0; iDim < nDim; iDim++) {
               Project_Grad_i += Vector_i[iDim]*Gradient_i[iVar][iDim];
               Project_Grad_j += Vector_j[iDim]*Gradient_j[iVar][iDim];
@@ -617,14 +660,14 @@ void CHeatSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_containe
         }
 
         /* Correct the temperature variables */
-        Project_Temp_i_Grad = 0.0; Project_Temp_j_Grad = 0.0;
+        su2double Project_Temp_i_Grad = 0.0, Project_Temp_j_Grad = 0.0;
         for (iDim = 0; iDim < nDim; iDim++) {
             Project_Temp_i_Grad += Vector_i[iDim]*Temp_i_Grad[0][iDim];
             Project_Temp_j_Grad += Vector_j[iDim]*Temp_j_Grad[0][iDim];
         }
 
-        Temp_i_Corrected = Temp_i + Project_Temp_i_Grad;
-        Temp_j_Corrected = Temp_j + Project_Temp_j_Grad;
+        su2double Temp_i_Corrected = Temp_i + Project_Temp_i_Grad;
+        su2double Temp_j_Corrected = Temp_j + Project_Temp_j_Grad;
 
         numerics->SetPrimitive(Primitive_Flow_i, Primitive_Flow_j);
         numerics->SetTemperature(Temp_i_Corrected, Temp_j_Corrected);
@@ -636,15 +679,22 @@ void CHeatSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_containe
         numerics->SetTemperature(Temp_i, Temp_j);
       }
 
-      numerics->ComputeResidual(Residual, Jacobian_i, Jacobian_j, config);
+      numerics->ComputeResidual(residual, Jac_i, Jac_j, config);
 
-      LinSysRes.AddBlock(iPoint, Residual);
-      LinSysRes.SubtractBlock(jPoint, Residual);
+      if (ReducerStrategy) {
+        EdgeFluxes.AddBlock(iEdge, residual);
+        Jacobian.UpdateBlocks(iEdge, Jac_i, Jac_j);
+      }
+      else {
+        LinSysRes.AddBlock(iPoint, residual);
+        LinSysRes.SubtractBlock(jPoint, residual);
 
-      /*--- Implicit part ---*/
+        /*--- Implicit part ---*/
 
-      Jacobian.UpdateBlocks(iEdge, iPoint, jPoint, Jacobian_i, Jacobian_j);
+        Jacobian.UpdateBlocks(iEdge, iPoint, jPoint, Jac_i, Jac_j);
+      }
     }
+    } // end color loop
   }
 
 }
@@ -652,11 +702,8 @@ void CHeatSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_containe
 void CHeatSolver::Viscous_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
                                    CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
 
-  CNumerics* numerics = numerics_container[VISC_TERM];
-
-  su2double laminar_viscosity, Prandtl_Lam, Prandtl_Turb, eddy_viscosity_i, eddy_viscosity_j,
-      thermal_diffusivity_i, thermal_diffusivity_j, Temp_i, Temp_j, **Temp_i_Grad, **Temp_j_Grad;
-  unsigned long iEdge, iPoint, jPoint;
+  /*--- Pick one numerics object per thread. ---*/
+  CNumerics* numerics = numerics_container[VISC_TERM + omp_get_thread_num()*MAX_TERMS];
 
   bool flow = ((config->GetKind_Solver() == INC_NAVIER_STOKES)
                || (config->GetKind_Solver() == INC_RANS)
@@ -665,16 +712,29 @@ void CHeatSolver::Viscous_Residual(CGeometry *geometry, CSolver **solver_contain
 
   bool turb = ((config->GetKind_Solver() == INC_RANS) || (config->GetKind_Solver() == DISC_ADJ_INC_RANS));
 
-  eddy_viscosity_i = 0.0;
-  eddy_viscosity_j = 0.0;
-  laminar_viscosity = config->GetMu_ConstantND();
-  Prandtl_Lam = config->GetPrandtl_Lam();
-  Prandtl_Turb = config->GetPrandtl_Turb();
+  const su2double laminar_viscosity = config->GetMu_ConstantND();
+  const su2double Prandtl_Lam = config->GetPrandtl_Lam();
+  const su2double Prandtl_Turb = config->GetPrandtl_Turb();
 
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  /*--- Static arrays for the residual and Jacobians of each edge (thread safety). ---*/
+  su2double residual[MAXNVAR] = {0.0}, jacobian_i[MAXNVAR][MAXNVAR] = {{0.0}}, jacobian_j[MAXNVAR][MAXNVAR] = {{0.0}};
+  su2double *Jac_i[MAXNVAR], *Jac_j[MAXNVAR];
+  for (unsigned short iVar = 0; iVar < MAXNVAR; iVar++) {
+    Jac_i[iVar] = jacobian_i[iVar];
+    Jac_j[iVar] = jacobian_j[iVar];
+  }
+
+  /*--- Loop over edge colors. ---*/
+  for (auto color : EdgeColoring)
+  {
+  /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+  SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+  for(auto k = 0ul; k < color.size; ++k) {
 
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
+    auto iEdge = color.indices[k];
+
+    unsigned long iPoint = geometry->edge[iEdge]->GetNode(0);
+    unsigned long jPoint = geometry->edge[iEdge]->GetNode(1);
 
     /*--- Points coordinates, and normal vector ---*/
 
@@ -682,17 +742,19 @@ void CHeatSolver::Viscous_Residual(CGeometry *geometry, CSolver **solver_contain
                        geometry->node[jPoint]->GetCoord());
     numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
 
-    Temp_i_Grad = nodes->GetGradient(iPoint);
-    Temp_j_Grad = nodes->GetGradient(jPoint);
+    su2double **Temp_i_Grad = nodes->GetGradient(iPoint);
+    su2double **Temp_j_Grad = nodes->GetGradient(jPoint);
     numerics->SetConsVarGradient(Temp_i_Grad, Temp_j_Grad);
 
     /*--- Primitive variables w/o reconstruction ---*/
-    Temp_i = nodes->GetSolution(iPoint,0);
-    Temp_j = nodes->GetSolution(jPoint,0);
+    su2double Temp_i = nodes->GetSolution(iPoint,0);
+    su2double Temp_j = nodes->GetSolution(jPoint,0);
     numerics->SetTemperature(Temp_i, Temp_j);
 
     /*--- Eddy viscosity to compute thermal conductivity ---*/
+    su2double thermal_diffusivity_i, thermal_diffusivity_j;
     if (flow) {
+      su2double eddy_viscosity_i = 0.0, eddy_viscosity_j = 0.0;
       if (turb) {
         eddy_viscosity_i = solver_container[TURB_SOL]->GetNodes()->GetmuT(iPoint);
         eddy_viscosity_j = solver_container[TURB_SOL]->GetNodes()->GetmuT(jPoint);
@@ -709,15 +771,49 @@ void CHeatSolver::Viscous_Residual(CGeometry *geometry, CSolver **solver_contain
 
     /*--- Compute residual, and Jacobians ---*/
 
-    numerics->ComputeResidual(Residual, Jacobian_i, Jacobian_j, config);
+    numerics->ComputeResidual(residual, Jac_i, Jac_j, config);
 
     /*--- Add and subtract residual, and update Jacobians ---*/
 
-    LinSysRes.SubtractBlock(iPoint, Residual);
-    LinSysRes.AddBlock(jPoint, Residual);
+    if (ReducerStrategy) {
+      EdgeFluxes.SubtractBlock(iEdge, residual);
+      Jacobian.UpdateBlocksSub(iEdge, Jac_i, Jac_j);
+    }
+    else {
+      LinSysRes.SubtractBlock(iPoint, residual);
+      LinSysRes.AddBlock(jPoint, residual);
+
+      Jacobian.UpdateBlocksSub(iEdge, iPoint, jPoint, Jac_i, Jac_j);
+    }
+  }
+  } // end color loop
+
+  /*--- The viscous residual is the last edge loop, the convective fluxes are also in EdgeFluxes. ---*/
+
+  if (ReducerStrategy) {
+    SumEdgeFluxes(geometry);
+    Jacobian.SetDiagonalAsColumnSum();
+  }
+}
+
+void CHeatSolver::SumEdgeFluxes(CGeometry* geometry) {
 
-    Jacobian.UpdateBlocksSub(iEdge, iPoint, jPoint, Jacobian_i, Jacobian_j);
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+
+    LinSysRes.SetBlock_Zero(iPoint);
+
+    for (unsigned short iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); ++iNeigh) {
+
+      auto iEdge = geometry->node[iPoint]->GetEdge(iNeigh);
+
+      if (iPoint == geometry->edge[iEdge]->GetNode(0))
+        LinSysRes.AddBlock(iPoint, EdgeFluxes.GetBlock(iEdge));
+      else
+        LinSysRes.SubtractBlock(iPoint, EdgeFluxes.GetBlock(iEdge));
+    }
   }
+
 }
 
 void CHeatSolver::Set_Heatflux_Areas(CGeometry *geometry, CConfig *config) {
@@ -902,11 +998,6 @@ void CHeatSolver::BC_HeatFlux_Wall(CGeometry *geometry, CSolver **solver_contain
 void CHeatSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
                             CNumerics *conv_numerics, CNumerics *visc_numerics, CConfig *config, unsigned short val_marker) {
 
-  unsigned short iDim;
-  unsigned long iVertex, iPoint, Point_Normal;
-  su2double *Flow_Dir,  Vel_Mag;
-  su2double *V_inlet, *V_domain;
-
   bool flow = ((config->GetKind_Solver() == INC_NAVIER_STOKES)
                || (config->GetKind_Solver() == INC_RANS)
                || (config->GetKind_Solver() == DISC_ADJ_INC_NAVIER_STOKES)
@@ -916,23 +1007,32 @@ void CHeatSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
   bool implicit             = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
   string Marker_Tag         = config->GetMarker_All_TagBound(val_marker);
 
-  su2double *Normal = new su2double[nDim];
-
-  su2double *Coord_i, *Coord_j, Area, dist_ij, laminar_viscosity, thermal_diffusivity, Twall, dTdn, Prandtl_Lam;
-  //su2double Prandtl_Turb;
-  Prandtl_Lam = config->GetPrandtl_Lam();
-//  Prandtl_Turb = config->GetPrandtl_Turb();
-  laminar_viscosity = config->GetMu_ConstantND();
+  su2double Prandtl_Lam = config->GetPrandtl_Lam();
+  su2double laminar_viscosity = config->GetMu_ConstantND();
   //laminar_viscosity = config->GetViscosity_FreeStreamND(); //TDE check for consistency with CHT
 
-  Twall = config->GetTemperature_FreeStreamND();
+  su2double Twall = config->GetTemperature_FreeStreamND();
 
-  for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
+  /*--- Static arrays for the residual and Jacobians of each vertex (thread safety). ---*/
+  su2double residual[MAXNVAR] = {0.0}, jacobian_i[MAXNVAR][MAXNVAR] = {{0.0}}, jacobian_j[MAXNVAR][MAXNVAR] = {{0.0}};
+  su2double *Jac_i[MAXNVAR], *Jac_j[MAXNVAR];
+  for (unsigned short iVar = 0; iVar < MAXNVAR; iVar++) {
+    Jac_i[iVar] = jacobian_i[iVar];
+    Jac_j[iVar] = jacobian_j[iVar];
+  }
 
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+  /*--- Loop over all the vertices on this boundary marker, each vertex is a unique point. ---*/
+
+  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+  for (unsigned long iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
+
+    unsigned long iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
 
     if (geometry->node[iPoint]->GetDomain()) {
 
+      unsigned short iDim;
+      su2double Normal[MAXNDIM] = {0.0};
+
       geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
       for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Normal[iDim];
 
@@ -944,14 +1044,14 @@ void CHeatSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
 
         /*--- Retrieve solution at this boundary node ---*/
 
-        V_domain = solver_container[FLOW_SOL]->GetNodes()->GetPrimitive(iPoint);
+        su2double *V_domain = solver_container[FLOW_SOL]->GetNodes()->GetPrimitive(iPoint);
 
         /*--- Retrieve the specified velocity for the inlet. ---*/
 
-        Vel_Mag  = config->GetInlet_Ptotal(Marker_Tag)/config->GetVelocity_Ref();
-        Flow_Dir = config->GetInlet_FlowDir(Marker_Tag);
+        su2double Vel_Mag  = config->GetInlet_Ptotal(Marker_Tag)/config->GetVelocity_Ref();
+        su2double *Flow_Dir = config->GetInlet_FlowDir(Marker_Tag);
 
-        V_inlet = solver_container[FLOW_SOL]->GetCharacPrimVar(val_marker, iVertex);
+        su2double *V_inlet = solver_container[FLOW_SOL]->GetCharacPrimVar(val_marker, iVertex);
 
         for (iDim = 0; iDim < nDim; iDim++)
           V_inlet[iDim+1] = Vel_Mag*Flow_Dir[iDim];
@@ -965,84 +1065,88 @@ void CHeatSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
 
         /*--- Compute the residual using an upwind scheme ---*/
 
-        conv_numerics->ComputeResidual(Residual, Jacobian_i, Jacobian_j, config);
+        conv_numerics->ComputeResidual(residual, Jac_i, Jac_j, config);
 
         /*--- Update residual value ---*/
 
-        LinSysRes.AddBlock(iPoint, Residual);
+        LinSysRes.AddBlock(iPoint, residual);
 
         /*--- Jacobian contribution for implicit integration ---*/
 
         if (implicit)
-          Jacobian.AddBlock2Diag(iPoint, Jacobian_i);
+          Jacobian.AddBlock2Diag(iPoint, Jac_i);
       }
 
       /*--- Viscous contribution ---*/
 
       if (viscous) {
 
-        Point_Normal = geometry->vertex[val_marker][iVertex]->GetNormal_Neighbor();
+        unsigned long Point_Normal = geometry->vertex[val_marker][iVertex]->GetNormal_Neighbor();
 
         geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
-        Area = 0.0;
+        su2double Area = 0.0;
         for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim];
         Area = sqrt (Area);
 
-        Coord_i = geometry->node[iPoint]->GetCoord();
-        Coord_j = geometry->node[Point_Normal]->GetCoord();
-        dist_ij = 0;
+        su2double *Coord_i = geometry->node[iPoint]->GetCoord();
+        su2double *Coord_j = geometry->node[Point_Normal]->GetCoord();
+        su2double dist_ij = 0;
         for (iDim = 0; iDim < nDim; iDim++)
           dist_ij += (Coord_j[iDim]-Coord_i[iDim])*(Coord_j[iDim]-Coord_i[iDim]);
         dist_ij = sqrt(dist_ij);
 
-        dTdn = -(nodes->GetSolution(Point_Normal,0) - Twall)/dist_ij;
+        su2double dTdn = -(nodes->GetSolution(Point_Normal,0) - Twall)/dist_ij;
 
-        thermal_diffusivity = laminar_viscosity/Prandtl_Lam;
+        su2double thermal_diffusivity = laminar_viscosity/Prandtl_Lam;
 
-        Res_Visc[0] = thermal_diffusivity*dTdn*Area;
+        residual[0] = thermal_diffusivity*dTdn*Area;
 
         if(implicit) {
 
-          Jacobian_i[0][0] = -thermal_diffusivity/dist_ij * Area;
+          Jac_i[0][0] = -thermal_diffusivity/dist_ij * Area;
         }
         /*--- Viscous contribution to the residual at the wall ---*/
 
-        LinSysRes.SubtractBlock(iPoint, Res_Visc);
-        Jacobian.SubtractBlock2Diag(iPoint, Jacobian_i);
+        LinSysRes.SubtractBlock(iPoint, residual);
+        Jacobian.SubtractBlock2Diag(iPoint, Jac_i);
       }
     }
   }
 
-  /*--- Free locally allocated memory ---*/
-  delete [] Normal;
-
 }
 
 void CHeatSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
                              CNumerics *conv_numerics, CNumerics *visc_numerics, CConfig *config, unsigned short val_marker) {
 
-  unsigned short iDim;
-  unsigned long iVertex, iPoint, Point_Normal;
-  su2double *V_outlet, *V_domain;
-
   bool flow = ((config->GetKind_Solver() == INC_NAVIER_STOKES)
                || (config->GetKind_Solver() == INC_RANS)
                || (config->GetKind_Solver() == DISC_ADJ_INC_NAVIER_STOKES)
                || (config->GetKind_Solver() == DISC_ADJ_INC_RANS));
   bool implicit             = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
 
-  su2double *Normal = new su2double[nDim];
+  /*--- Static arrays for the residual and Jacobians of each vertex (thread safety). ---*/
+  su2double residual[MAXNVAR] = {0.0}, jacobian_i[MAXNVAR][MAXNVAR] = {{0.0}}, jacobian_j[MAXNVAR][MAXNVAR] = {{0.0}};
+  su2double *Jac_i[MAXNVAR], *Jac_j[MAXNVAR];
+  for (unsigned short iVar = 0; iVar < MAXNVAR; iVar++) {
+    Jac_i[iVar] = jacobian_i[iVar];
+    Jac_j[iVar] = jacobian_j[iVar];
+  }
 
-  for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
+  /*--- Loop over all the vertices on this boundary marker, each vertex is a unique point. ---*/
 
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+  for (unsigned long iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
+
+    unsigned long iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
 
     if (geometry->node[iPoint]->GetDomain()) {
 
-      Point_Normal = geometry->vertex[val_marker][iVertex]->GetNormal_Neighbor();
+      unsigned short iDim;
+      unsigned long Point_Normal = geometry->vertex[val_marker][iVertex]->GetNormal_Neighbor();
 
       /*--- Normal vector for this vertex (negate for outward convention) ---*/
 
+      su2double Normal[MAXNDIM] = {0.0};
       geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
       for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Normal[iDim];
 
@@ -1051,11 +1155,11 @@ void CHeatSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
 
           /*--- Retrieve solution at this boundary node ---*/
 
-          V_domain = solver_container[FLOW_SOL]->GetNodes()->GetPrimitive(iPoint);
+          su2double *V_domain = solver_container[FLOW_SOL]->GetNodes()->GetPrimitive(iPoint);
 
           /*--- Retrieve the specified velocity for the inlet. ---*/
 
-          V_outlet = solver_container[FLOW_SOL]->GetCharacPrimVar(val_marker, iVertex);
+          su2double *V_outlet = solver_container[FLOW_SOL]->GetCharacPrimVar(val_marker, iVertex);
           for (iDim = 0; iDim < nDim; iDim++)
             V_outlet[iDim+1] = solver_container[FLOW_SOL]->GetNodes()->GetVelocity(Point_Normal, iDim);
 
@@ -1068,23 +1172,20 @@ void CHeatSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
 
           /*--- Compute the residual using an upwind scheme ---*/
 
-          conv_numerics->ComputeResidual(Residual, Jacobian_i, Jacobian_j, config);
+          conv_numerics->ComputeResidual(residual, Jac_i, Jac_j, config);
 
           /*--- Update residual value ---*/
 
-          LinSysRes.AddBlock(iPoint, Residual);
+          LinSysRes.AddBlock(iPoint, residual);
 
           /*--- Jacobian contribution for implicit integration ---*/
 
           if (implicit)
-            Jacobian.AddBlock2Diag(iPoint, Jacobian_i);
+            Jacobian.AddBlock2Diag(iPoint, Jac_i);
       }
     }
   }
 
-  /*--- Free locally allocated memory ---*/
-  delete [] Normal;
-
 }
 
 void CHeatSolver::BC_ConjugateHeat_Interface(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics, CConfig *config, unsigned short val_marker) {
@@ -1319,358 +1420,395 @@ void CHeatSolver::Heat_Fluxes(CGeometry *geometry, CSolver **solver_container, C
 void CHeatSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container, CConfig *config,
                                unsigned short iMesh, unsigned long Iteration) {
 
-  unsigned short iDim, iMarker;
-  unsigned long iEdge, iVertex, iPoint = 0, jPoint = 0;
-  su2double *Normal, Area, Vol, laminar_viscosity, eddy_viscosity, thermal_diffusivity, Prandtl_Lam, Prandtl_Turb, Mean_ProjVel, Mean_BetaInc2, Mean_DensityInc, Mean_SoundSpeed, Lambda;
-  su2double Global_Delta_Time = 0.0, Global_Delta_UnstTimeND = 0.0, Local_Delta_Time = 0.0, Local_Delta_Time_Inv, Local_Delta_Time_Visc, CFL_Reduction, K_v = 0.25;
-
-  bool flow = ((config->GetKind_Solver() == INC_NAVIER_STOKES)
-               || (config->GetKind_Solver() == INC_RANS)
-               || (config->GetKind_Solver() == DISC_ADJ_INC_NAVIER_STOKES)
-               || (config->GetKind_Solver() == DISC_ADJ_INC_RANS));
-
-  bool turb = ((config->GetKind_Solver() == INC_RANS) || (config->GetKind_Solver() == DISC_ADJ_INC_RANS));
-  bool dual_time = ((config->GetTime_Marching() == DT_STEPPING_1ST) ||
-                    (config->GetTime_Marching() == DT_STEPPING_2ND));
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
-
-  eddy_viscosity    = 0.0;
-  laminar_viscosity = config->GetMu_ConstantND();
-  Prandtl_Lam = config->GetPrandtl_Lam();
-  Prandtl_Turb = config->GetPrandtl_Turb();
-
-  thermal_diffusivity = config->GetThermalDiffusivity_Solid();
+  const bool flow = ((config->GetKind_Solver() == INC_NAVIER_STOKES)
+                     || (config->GetKind_Solver() == INC_RANS)
+                     || (config->GetKind_Solver() == DISC_ADJ_INC_NAVIER_STOKES)
+                     || (config->GetKind_Solver() == DISC_ADJ_INC_RANS));
+
+  const bool turb = ((config->GetKind_Solver() == INC_RANS) || (config->GetKind_Solver() == DISC_ADJ_INC_RANS));
+  const bool time_stepping = (config->GetTime_Marching() == TIME_STEPPING);
+  const bool dual_time = ((config->GetTime_Marching() == DT_STEPPING_1ST) ||
+                          (config->GetTime_Marching() == DT_STEPPING_2ND));
+  const bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  const bool unst_cfl = dual_time && (Iteration == 0) && (config->GetUnst_CFL() != 0.0) && (iMesh == MESH_0);
+
+  const su2double laminar_viscosity = config->GetMu_ConstantND();
+  const su2double Prandtl_Lam = config->GetPrandtl_Lam();
+  const su2double Prandtl_Turb = config->GetPrandtl_Turb();
+  const su2double CFL_Reduction = config->GetCFLRedCoeff_Turb();
+  const su2double K_v = 0.25;
+
+  CVariable* flowNodes = flow? solver_container[FLOW_SOL]->GetNodes() : nullptr;
+  CVariable* turbNodes = turb? solver_container[TURB_SOL]->GetNodes() : nullptr;
+
+  /*--- Thermal diffusivity used for the viscous spectral radius. ---*/
+
+  auto ThermalDiffusivity = [&](unsigned long iPoint) -> su2double {
+    if (!flow) return config->GetThermalDiffusivity_Solid();
+    su2double eddy_viscosity = turb? turbNodes->GetmuT(iPoint) : 0.0;
+    return laminar_viscosity/Prandtl_Lam + eddy_viscosity/Prandtl_Turb;
+  };
+
+  /*--- Inviscid spectral radius, based on the artificial compressibility of the flow. ---*/
+
+  auto InviscidLambda = [&](unsigned long iPoint, unsigned long jPoint, const su2double* Normal, su2double Area) -> su2double {
+    su2double Mean_ProjVel = 0.5 * (flowNodes->GetProjVel(iPoint,Normal) + flowNodes->GetProjVel(jPoint,Normal));
+    su2double Mean_BetaInc2 = 0.5 * (flowNodes->GetBetaInc2(iPoint) + flowNodes->GetBetaInc2(jPoint));
+    su2double Mean_DensityInc = 0.5 * (flowNodes->GetDensity(iPoint) + flowNodes->GetDensity(jPoint));
+    su2double Mean_SoundSpeed = sqrt(Mean_ProjVel*Mean_ProjVel + (Mean_BetaInc2/Mean_DensityInc)*Area*Area);
+    return fabs(Mean_ProjVel) + Mean_SoundSpeed;
+  };
+
+  /*--- Init thread-shared variables to compute min/max values. ---*/
+
+  SU2_OMP_MASTER
+  {
+    Min_Delta_Time = 1.E30;
+    Max_Delta_Time = 0.0;
+  }
+  SU2_OMP_BARRIER
 
-  /*--- Compute spectral radius based on thermal conductivity ---*/
+  /*--- Compute spectral radius based on thermal conductivity. Loop domain points,
+   *    each point gathers the contributions of its edges (thread safety). ---*/
 
-  Min_Delta_Time = 1.E30; Max_Delta_Time = 0.0;
-  CFL_Reduction = config->GetCFLRedCoeff_Turb();
+  SU2_OMP_FOR_DYN(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
     nodes->SetMax_Lambda_Inv(iPoint,0.0);
     nodes->SetMax_Lambda_Visc(iPoint,0.0);
-  }
 
-  /*--- Loop interior edges ---*/
+    for (unsigned short iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); iNeigh++) {
 
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+      unsigned long jPoint = geometry->node[iPoint]->GetPoint(iNeigh);
+      unsigned long iEdge = geometry->node[iPoint]->GetEdge(iNeigh);
 
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
+      /*--- get the edge's normal vector to compute the edge's area ---*/
+      const su2double* Normal = geometry->edge[iEdge]->GetNormal();
+      su2double Area = 0.0; for (unsigned short iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim]; Area = sqrt(Area);
 
-    /*--- get the edge's normal vector to compute the edge's area ---*/
-    Normal = geometry->edge[iEdge]->GetNormal();
-    Area = 0; for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim]; Area = sqrt(Area);
+      /*--- Inviscid contribution ---*/
 
-    /*--- Inviscid contribution ---*/
+      if (flow) nodes->AddMax_Lambda_Inv(iPoint, InviscidLambda(iPoint, jPoint, Normal, Area));
 
-    if (flow) {
-      Mean_ProjVel = 0.5 * (solver_container[FLOW_SOL]->GetNodes()->GetProjVel(iPoint,Normal) + solver_container[FLOW_SOL]->GetNodes()->GetProjVel(jPoint,Normal));
-      Mean_BetaInc2 = 0.5 * (solver_container[FLOW_SOL]->GetNodes()->GetBetaInc2(iPoint) + solver_container[FLOW_SOL]->GetNodes()->GetBetaInc2(jPoint));
-      Mean_DensityInc = 0.5 * (solver_container[FLOW_SOL]->GetNodes()->GetDensity(iPoint) + solver_container[FLOW_SOL]->GetNodes()->GetDensity(jPoint));
-      Mean_SoundSpeed = sqrt(Mean_ProjVel*Mean_ProjVel + (Mean_BetaInc2/Mean_DensityInc)*Area*Area);
-
-      Lambda = fabs(Mean_ProjVel) + Mean_SoundSpeed;
-      if (geometry->node[iPoint]->GetDomain()) nodes->AddMax_Lambda_Inv(iPoint, Lambda);
-      if (geometry->node[jPoint]->GetDomain()) nodes->AddMax_Lambda_Inv(jPoint, Lambda);
+      /*--- Viscous contribution, the eddy viscosity is the one of the first point of the edge. ---*/
+
+      su2double Lambda = ThermalDiffusivity(geometry->edge[iEdge]->GetNode(0))*Area*Area;
+      nodes->AddMax_Lambda_Visc(iPoint, Lambda);
     }
+  }
 
-    /*--- Viscous contribution ---*/
+  /*--- Loop boundary edges, the markers are processed one after the other. ---*/
 
-    thermal_diffusivity = config->GetThermalDiffusivity_Solid();
-    if(flow) {
-      if(turb) {
-        eddy_viscosity = solver_container[TURB_SOL]->GetNodes()->GetmuT(iPoint);
-      }
+  for (unsigned short iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
 
-      thermal_diffusivity = laminar_viscosity/Prandtl_Lam + eddy_viscosity/Prandtl_Turb;
-    }
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+    for (unsigned long iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
 
-    Lambda = thermal_diffusivity*Area*Area;
-    if (geometry->node[iPoint]->GetDomain()) nodes->AddMax_Lambda_Visc(iPoint, Lambda);
-    if (geometry->node[jPoint]->GetDomain()) nodes->AddMax_Lambda_Visc(jPoint, Lambda);
+      /*--- Point identification, Normal vector and area ---*/
 
-  }
+      unsigned long iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
 
-  /*--- Loop boundary edges ---*/
+      if (!geometry->node[iPoint]->GetDomain()) continue;
 
-  for (iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
-    for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+      const su2double* Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+      su2double Area = 0.0; for (unsigned short iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim]; Area = sqrt(Area);
 
-      /*--- Point identification, Normal vector and area ---*/
+      /*--- Inviscid contribution ---*/
 
-      iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-      Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
-      Area = 0.0; for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim]; Area = sqrt(Area);
+      if (flow) nodes->AddMax_Lambda_Inv(iPoint, InviscidLambda(iPoint, iPoint, Normal, Area));
 
-      /*--- Inviscid contribution ---*/
+      /*--- Viscous contribution ---*/
 
-      if (flow) {
-        Mean_ProjVel = solver_container[FLOW_SOL]->GetNodes()->GetProjVel(iPoint, Normal);
-        Mean_BetaInc2 = solver_container[FLOW_SOL]->GetNodes()->GetBetaInc2(iPoint);
-        Mean_DensityInc = solver_container[FLOW_SOL]->GetNodes()->GetDensity(iPoint);
-        Mean_SoundSpeed = sqrt(Mean_ProjVel*Mean_ProjVel + (Mean_BetaInc2/Mean_DensityInc)*Area*Area);
+      su2double Lambda = ThermalDiffusivity(iPoint)*Area*Area;
+      nodes->AddMax_Lambda_Visc(iPoint, Lambda);
+    }
+  }
 
-        Lambda = fabs(Mean_ProjVel) + Mean_SoundSpeed;
-        if (geometry->node[iPoint]->GetDomain()) nodes->AddMax_Lambda_Inv(iPoint, Lambda);
-      }
+  /*--- Each element uses their own speed, steady state simulation ---*/
+  {
+    /*--- Thread-local variables for min/max reduction. ---*/
+    su2double minDt = 1.E30, maxDt = 0.0;
 
-      /*--- Viscous contribution ---*/
+    SU2_OMP(for schedule(static,omp_chunk_size) nowait)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
-      thermal_diffusivity = config->GetThermalDiffusivity_Solid();
-      if(flow) {
-        if(turb) {
-          eddy_viscosity = solver_container[TURB_SOL]->GetNodes()->GetmuT(iPoint);
-        }
+      su2double Vol = geometry->node[iPoint]->GetVolume();
 
-        thermal_diffusivity = laminar_viscosity/Prandtl_Lam + eddy_viscosity/Prandtl_Turb;
-      }
+      if (Vol != 0.0) {
 
-      Lambda = thermal_diffusivity*Area*Area;
-      if (geometry->node[iPoint]->GetDomain()) nodes->AddMax_Lambda_Visc(iPoint, Lambda);
+        su2double Local_Delta_Time = 0.0, Local_Delta_Time_Inv, Local_Delta_Time_Visc;
 
-    }
-  }
+        if(flow) {
+          Local_Delta_Time_Inv = config->GetCFL(iMesh)*Vol / nodes->GetMax_Lambda_Inv(iPoint);
+          Local_Delta_Time_Visc = config->GetCFL(iMesh)*K_v*Vol*Vol/ nodes->GetMax_Lambda_Visc(iPoint);
+        }
+        else {
+          Local_Delta_Time_Inv = config->GetMax_DeltaTime();
+          Local_Delta_Time_Visc = config->GetCFL(iMesh)*K_v*Vol*Vol/ nodes->GetMax_Lambda_Visc(iPoint);
+          //Local_Delta_Time_Visc = 100.0*K_v*Vol*Vol/ nodes->GetMax_Lambda_Visc(iPoint);
+        }
 
-  /*--- Each element uses their own speed, steady state simulation ---*/
+        /*--- Time step setting method ---*/
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+        if (config->GetKind_TimeStep_Heat() == BYFLOW && flow) {
+          Local_Delta_Time = flowNodes->GetDelta_Time(iPoint);
+        }
+        else if (config->GetKind_TimeStep_Heat() == MINIMUM) {
+          Local_Delta_Time = min(Local_Delta_Time_Inv, Local_Delta_Time_Visc);
+        }
+        else if (config->GetKind_TimeStep_Heat() == CONVECTIVE) {
+          Local_Delta_Time = Local_Delta_Time_Inv;
+        }
+        else if (config->GetKind_TimeStep_Heat() == VISCOUS) {
+          Local_Delta_Time = Local_Delta_Time_Visc;
+        }
 
-    Vol = geometry->node[iPoint]->GetVolume();
+        /*--- Min-Max-Logic ---*/
 
-    if (Vol != 0.0) {
+        minDt = min(minDt, Local_Delta_Time);
+        maxDt = max(maxDt, Local_Delta_Time);
+        if (Local_Delta_Time > config->GetMax_DeltaTime())
+          Local_Delta_Time = config->GetMax_DeltaTime();
 
-      if(flow) {
-        Local_Delta_Time_Inv = config->GetCFL(iMesh)*Vol / nodes->GetMax_Lambda_Inv(iPoint);
-        Local_Delta_Time_Visc = config->GetCFL(iMesh)*K_v*Vol*Vol/ nodes->GetMax_Lambda_Visc(iPoint);
+        nodes->SetDelta_Time(iPoint,CFL_Reduction*Local_Delta_Time);
       }
       else {
-        Local_Delta_Time_Inv = config->GetMax_DeltaTime();
-        Local_Delta_Time_Visc = config->GetCFL(iMesh)*K_v*Vol*Vol/ nodes->GetMax_Lambda_Visc(iPoint);
-        //Local_Delta_Time_Visc = 100.0*K_v*Vol*Vol/ nodes->GetMax_Lambda_Visc(iPoint);
+        nodes->SetDelta_Time(iPoint,0.0);
       }
+    }
+    /*--- Min/max over threads. ---*/
+    SU2_OMP_CRITICAL
+    {
+      Min_Delta_Time = min(Min_Delta_Time, minDt);
+      Max_Delta_Time = max(Max_Delta_Time, maxDt);
+    }
+    SU2_OMP_BARRIER
+  }
 
-      /*--- Time step setting method ---*/
+  SU2_OMP_MASTER
+  {
+    /*--- The minimum time step of this rank is the candidate for the global one. ---*/
 
-      if (config->GetKind_TimeStep_Heat() == BYFLOW && flow) {
-        Local_Delta_Time = solver_container[FLOW_SOL]->GetNodes()->GetDelta_Time(iPoint);
-      }
-      else if (config->GetKind_TimeStep_Heat() == MINIMUM) {
-        Local_Delta_Time = min(Local_Delta_Time_Inv, Local_Delta_Time_Visc);
-      }
-      else if (config->GetKind_TimeStep_Heat() == CONVECTIVE) {
-        Local_Delta_Time = Local_Delta_Time_Inv;
-      }
-      else if (config->GetKind_TimeStep_Heat() == VISCOUS) {
-        Local_Delta_Time = Local_Delta_Time_Visc;
-      }
+    Global_Delta_Time = Min_Delta_Time;
 
-      /*--- Min-Max-Logic ---*/
+    /*--- Compute the max and the min dt (in parallel) ---*/
 
-      Global_Delta_Time = min(Global_Delta_Time, Local_Delta_Time);
-      Min_Delta_Time = min(Min_Delta_Time, Local_Delta_Time);
-      Max_Delta_Time = max(Max_Delta_Time, Local_Delta_Time);
-      if (Local_Delta_Time > config->GetMax_DeltaTime())
-        Local_Delta_Time = config->GetMax_DeltaTime();
+    if (config->GetComm_Level() == COMM_FULL) {
+      su2double rbuf_time;
+      SU2_MPI::Allreduce(&Min_Delta_Time, &rbuf_time, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+      Min_Delta_Time = rbuf_time;
 
-      nodes->SetDelta_Time(iPoint,CFL_Reduction*Local_Delta_Time);
+      SU2_MPI::Allreduce(&Max_Delta_Time, &rbuf_time, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+      Max_Delta_Time = rbuf_time;
     }
-    else {
-      nodes->SetDelta_Time(iPoint,0.0);
+
+    /*--- For exact time solution use the minimum delta time of the whole mesh ---*/
+
+    if (time_stepping || unst_cfl) {
+      su2double rbuf_time;
+      SU2_MPI::Allreduce(&Global_Delta_Time, &rbuf_time, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+      Global_Delta_Time = rbuf_time;
     }
-  }
 
-  /*--- Compute the max and the min dt (in parallel) ---*/
-  if (config->GetComm_Level() == COMM_FULL) {
-#ifdef HAVE_MPI
-    su2double rbuf_time, sbuf_time;
-    sbuf_time = Min_Delta_Time;
-    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_DOUBLE, MPI_MIN, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Bcast(&rbuf_time, 1, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    Min_Delta_Time = rbuf_time;
-
-    sbuf_time = Max_Delta_Time;
-    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_DOUBLE, MPI_MAX, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Bcast(&rbuf_time, 1, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    Max_Delta_Time = rbuf_time;
-#endif
-  }
+    /*--- Recompute the unsteady time step for the dual time strategy
+     if the unsteady CFL is diferent from 0 ---*/
 
-  /*--- For exact time solution use the minimum delta time of the whole mesh ---*/
-  if (config->GetTime_Marching() == TIME_STEPPING) {
-#ifdef HAVE_MPI
-    su2double rbuf_time, sbuf_time;
-    sbuf_time = Global_Delta_Time;
-    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_DOUBLE, MPI_MIN, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Bcast(&rbuf_time, 1, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    Global_Delta_Time = rbuf_time;
-#endif
-    for (iPoint = 0; iPoint < nPointDomain; iPoint++)
-      nodes->SetDelta_Time(iPoint,Global_Delta_Time);
+    if (unst_cfl)
+      config->SetDelta_UnstTimeND(config->GetUnst_CFL()*Global_Delta_Time/config->GetCFL(iMesh));
   }
+  SU2_OMP_BARRIER
 
-  /*--- Recompute the unsteady time step for the dual time strategy
-   if the unsteady CFL is diferent from 0 ---*/
-  if ((dual_time) && (Iteration == 0) && (config->GetUnst_CFL() != 0.0) && (iMesh == MESH_0)) {
-    Global_Delta_UnstTimeND = config->GetUnst_CFL()*Global_Delta_Time/config->GetCFL(iMesh);
-
-#ifdef HAVE_MPI
-    su2double rbuf_time, sbuf_time;
-    sbuf_time = Global_Delta_UnstTimeND;
-    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_DOUBLE, MPI_MIN, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Bcast(&rbuf_time, 1, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    Global_Delta_UnstTimeND = rbuf_time;
-#endif
-    config->SetDelta_UnstTimeND(Global_Delta_UnstTimeND);
+  if (time_stepping) {
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
+      nodes->SetDelta_Time(iPoint,Global_Delta_Time);
   }
 
   /*--- The pseudo local time (explicit integration) cannot be greater than the physical time ---*/
-  if (dual_time)
-    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-      if (!implicit) {
-        cout << "Using unsteady time: " << config->GetDelta_UnstTimeND() << endl;
-        Local_Delta_Time = min((2.0/3.0)*config->GetDelta_UnstTimeND(), nodes->GetDelta_Time(iPoint));
-        nodes->SetDelta_Time(iPoint,Local_Delta_Time);
-      }
+
+  if (dual_time && !implicit) {
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      su2double Local_Delta_Time = min((2.0/3.0)*config->GetDelta_UnstTimeND(), nodes->GetDelta_Time(iPoint));
+      nodes->SetDelta_Time(iPoint,Local_Delta_Time);
+    }
   }
 }
 
 void CHeatSolver::ExplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
 
-  su2double *local_Residual, *local_Res_TruncError, Vol, Delta, Res;
-  unsigned short iVar;
-  unsigned long iPoint;
-
   bool adjoint = config->GetContinuous_Adjoint();
 
-  for (iVar = 0; iVar < nVar; iVar++) {
+  /*--- Set shared residual variables to 0 and declare
+   *    local ones for current thread to work on. ---*/
+
+  SU2_OMP_MASTER
+  for (unsigned short iVar = 0; iVar < nVar; iVar++) {
     SetRes_RMS(iVar, 0.0);
     SetRes_Max(iVar, 0.0, 0);
   }
+  SU2_OMP_BARRIER
+
+  su2double resMax[MAXNVAR] = {0.0}, resRMS[MAXNVAR] = {0.0};
+  const su2double* coordMax[MAXNVAR] = {nullptr};
+  unsigned long idxMax[MAXNVAR] = {0};
 
   /*--- Update the solution ---*/
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-    Vol = geometry->node[iPoint]->GetVolume();
-    Delta = nodes->GetDelta_Time(iPoint) / Vol;
+  if (!adjoint) {
+    SU2_OMP(for schedule(static,omp_chunk_size) nowait)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
-    local_Res_TruncError = nodes->GetResTruncError(iPoint);
-    local_Residual = LinSysRes.GetBlock(iPoint);
+      su2double Vol = geometry->node[iPoint]->GetVolume();
+      su2double Delta = nodes->GetDelta_Time(iPoint) / Vol;
 
-    if (!adjoint) {
-      for (iVar = 0; iVar < nVar; iVar++) {
-        Res = local_Residual[iVar] + local_Res_TruncError[iVar];
+      const su2double* local_Res_TruncError = nodes->GetResTruncError(iPoint);
+      const su2double* local_Residual = LinSysRes.GetBlock(iPoint);
+
+      for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+        su2double Res = local_Residual[iVar] + local_Res_TruncError[iVar];
         nodes->AddSolution(iPoint,iVar, -Res*Delta);
-        AddRes_RMS(iVar, Res*Res);
-        AddRes_Max(iVar, fabs(Res), geometry->node[iPoint]->GetGlobalIndex(), geometry->node[iPoint]->GetCoord());
+
+        /*--- Update residual information for current thread. ---*/
+        resRMS[iVar] += Res*Res;
+        if (fabs(Res) > resMax[iVar]) {
+          resMax[iVar] = fabs(Res);
+          idxMax[iVar] = iPoint;
+          coordMax[iVar] = geometry->node[iPoint]->GetCoord();
+        }
       }
     }
-
+    SU2_OMP_CRITICAL
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      AddRes_RMS(iVar, resRMS[iVar]);
+      AddRes_Max(iVar, resMax[iVar], geometry->node[idxMax[iVar]]->GetGlobalIndex(), coordMax[iVar]);
+    }
   }
+  SU2_OMP_BARRIER
 
-  /*--- MPI solution ---*/
+  SU2_OMP_MASTER
+  {
+    /*--- MPI solution ---*/
 
-  InitiateComms(geometry, config, SOLUTION);
-  CompleteComms(geometry, config, SOLUTION);
+    InitiateComms(geometry, config, SOLUTION);
+    CompleteComms(geometry, config, SOLUTION);
 
-  /*--- Compute the root mean square residual ---*/
+    /*--- Compute the root mean square residual ---*/
 
-  SetResidual_RMS(geometry, config);
+    SetResidual_RMS(geometry, config);
+  }
+  SU2_OMP_BARRIER
 
 }
 
 
 void CHeatSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
 
-  unsigned short iVar;
-  unsigned long iPoint, total_index;
-  su2double Delta, Vol, *local_Res_TruncError;
-  bool flow = ((config->GetKind_Solver() == INC_NAVIER_STOKES)
-               || (config->GetKind_Solver() == INC_RANS)
-               || (config->GetKind_Solver() == DISC_ADJ_INC_NAVIER_STOKES)
-               || (config->GetKind_Solver() == DISC_ADJ_INC_RANS));
-
-
-  /*--- Set maximum residual to zero ---*/
+  /*--- Set shared residual variables to 0 and declare
+   *    local ones for current thread to work on. ---*/
 
-  for (iVar = 0; iVar < nVar; iVar++) {
+  SU2_OMP_MASTER
+  for (unsigned short iVar = 0; iVar < nVar; iVar++) {
     SetRes_RMS(iVar, 0.0);
     SetRes_Max(iVar, 0.0, 0);
   }
+  SU2_OMP_BARRIER
+
+  su2double resMax[MAXNVAR] = {0.0}, resRMS[MAXNVAR] = {0.0};
+  const su2double* coordMax[MAXNVAR] = {nullptr};
+  unsigned long idxMax[MAXNVAR] = {0};
 
   /*--- Build implicit system ---*/
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+  SU2_OMP(for schedule(static,omp_chunk_size) nowait)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
     /*--- Read the residual ---*/
 
-    local_Res_TruncError = nodes->GetResTruncError(iPoint);
+    su2double* local_Res_TruncError = nodes->GetResTruncError(iPoint);
 
     /*--- Read the volume ---*/
 
-    Vol = geometry->node[iPoint]->GetVolume();
+    su2double Vol = geometry->node[iPoint]->GetVolume();
 
     /*--- Modify matrix diagonal to assure diagonal dominance ---*/
 
     if (nodes->GetDelta_Time(iPoint) != 0.0) {
-
-      if(flow) {
-        Delta = Vol / nodes->GetDelta_Time(iPoint);
-        Jacobian.AddVal2Diag(iPoint, Delta);
-      }
-      else {
-        Delta = Vol / nodes->GetDelta_Time(iPoint);
-        Jacobian.AddVal2Diag(iPoint, Delta);
-      }
-
-    } else {
+      su2double Delta = Vol / nodes->GetDelta_Time(iPoint);
+      Jacobian.AddVal2Diag(iPoint, Delta);
+    }
+    else {
       Jacobian.SetVal2Diag(iPoint, 1.0);
-      for (iVar = 0; iVar < nVar; iVar++) {
-        total_index = iPoint*nVar + iVar;
-        LinSysRes[total_index] = 0.0;
+      for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+        LinSysRes(iPoint,iVar) = 0.0;
         local_Res_TruncError[iVar] = 0.0;
       }
     }
 
     /*--- Right hand side of the system (-Residual) and initial guess (x = 0) ---*/
 
-    for (iVar = 0; iVar < nVar; iVar++) {
-      total_index = iPoint*nVar+iVar;
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      unsigned long total_index = iPoint*nVar+iVar;
       LinSysRes[total_index] = - (LinSysRes[total_index] + local_Res_TruncError[iVar]);
       LinSysSol[total_index] = 0.0;
-      AddRes_RMS(iVar, LinSysRes[total_index]*LinSysRes[total_index]);
-      AddRes_Max(iVar, fabs(LinSysRes[total_index]), geometry->node[iPoint]->GetGlobalIndex(), geometry->node[iPoint]->GetCoord());
+
+      su2double Res = fabs(LinSysRes[total_index]);
+      resRMS[iVar] += Res*Res;
+      if (Res > resMax[iVar]) {
+        resMax[iVar] = Res;
+        idxMax[iVar] = iPoint;
+        coordMax[iVar] = geometry->node[iPoint]->GetCoord();
+      }
     }
   }
+  SU2_OMP_CRITICAL
+  for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+    AddRes_RMS(iVar, resRMS[iVar]);
+    AddRes_Max(iVar, resMax[iVar], geometry->node[idxMax[iVar]]->GetGlobalIndex(), coordMax[iVar]);
+  }
 
   /*--- Initialize residual and solution at the ghost points ---*/
 
-  for (iPoint = nPointDomain; iPoint < nPoint; iPoint++) {
-    for (iVar = 0; iVar < nVar; iVar++) {
-      total_index = iPoint*nVar + iVar;
-      LinSysRes[total_index] = 0.0;
-      LinSysSol[total_index] = 0.0;
-    }
+  SU2_OMP(sections)
+  {
+    SU2_OMP(section)
+    for (unsigned long iPoint = nPointDomain; iPoint < nPoint; iPoint++)
+      LinSysRes.SetBlock_Zero(iPoint);
+
+    SU2_OMP(section)
+    for (unsigned long iPoint = nPointDomain; iPoint < nPoint; iPoint++)
+      LinSysSol.SetBlock_Zero(iPoint);
   }
 
   /*--- Solve or smooth the linear system ---*/
 
-  System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
+  auto iter = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
+  SU2_OMP_MASTER
+  {
+    SetIterLinSolver(iter);
+    SetResLinSolver(System.GetResidual());
+  }
+  SU2_OMP_BARRIER
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-    for (iVar = 0; iVar < nVar; iVar++) {
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
       nodes->AddSolution(iPoint,iVar, LinSysSol[iPoint*nVar+iVar]);
     }
   }
 
-  /*--- MPI solution ---*/
+  SU2_OMP_MASTER
+  {
+    /*--- MPI solution ---*/
 
-  InitiateComms(geometry, config, SOLUTION);
-  CompleteComms(geometry, config, SOLUTION);
+    InitiateComms(geometry, config, SOLUTION);
+    CompleteComms(geometry, config, SOLUTION);
 
-  /*--- Compute the root mean square residual ---*/
+    /*--- Compute the root mean square residual ---*/
 
-  SetResidual_RMS(geometry, config);
+    SetResidual_RMS(geometry, config);
+  }
+  SU2_OMP_BARRIER
 
 }
 
@@ -1741,19 +1879,16 @@ void CHeatSolver::SetInitialCondition(CGeometry **geometry, CSolver ***solver_co
 void CHeatSolver::SetResidual_DualTime(CGeometry *geometry, CSolver **solver_container, CConfig *config,
                                         unsigned short iRKStep, unsigned short iMesh, unsigned short RunTime_EqSystem) {
 
-  /*--- Local variables ---*/
-
-  unsigned short iVar, jVar;
-  unsigned long iPoint;
-
-  su2double *U_time_n, *U_time_nP1, *U_time_nM1;
-  su2double Volume_nP1, TimeStep;
-
   bool implicit       = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
 
   /*--- Store the physical time step ---*/
 
-  TimeStep = config->GetDelta_UnstTimeND();
+  su2double TimeStep = config->GetDelta_UnstTimeND();
+
+  /*--- Static arrays for the residual and Jacobian of each point (thread safety). ---*/
+  su2double residual[MAXNVAR] = {0.0}, jacobian_i[MAXNVAR][MAXNVAR] = {{0.0}};
+  su2double *Jac_i[MAXNVAR];
+  for (unsigned short iVar = 0; iVar < MAXNVAR; iVar++) Jac_i[iVar] = jacobian_i[iVar];
 
   /*--- Compute the dual time-stepping source term for static meshes ---*/
 
@@ -1761,46 +1896,49 @@ void CHeatSolver::SetResidual_DualTime(CGeometry *geometry, CSolver **solver_con
 
     /*--- Loop over all nodes (excluding halos) ---*/
 
-    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+
+      unsigned short iVar, jVar;
 
       /*--- Retrieve the solution at time levels n-1, n, and n+1. Note that
        we are currently iterating on U^n+1 and that U^n & U^n-1 are fixed,
        previous solutions that are stored in memory. ---*/
 
-      U_time_nM1 = nodes->GetSolution_time_n1(iPoint);
-      U_time_n   = nodes->GetSolution_time_n(iPoint);
-      U_time_nP1 = nodes->GetSolution(iPoint);
+      const su2double *U_time_nM1 = nodes->GetSolution_time_n1(iPoint);
+      const su2double *U_time_n   = nodes->GetSolution_time_n(iPoint);
+      const su2double *U_time_nP1 = nodes->GetSolution(iPoint);
 
       /*--- CV volume at time n+1. As we are on a static mesh, the volume
        of the CV will remained fixed for all time steps. ---*/
 
-      Volume_nP1 = geometry->node[iPoint]->GetVolume();
+      su2double Volume_nP1 = geometry->node[iPoint]->GetVolume();
 
       /*--- Compute the dual time-stepping source term based on the chosen
        time discretization scheme (1st- or 2nd-order).---*/
 
       for (iVar = 0; iVar < nVar; iVar++) {
         if (config->GetTime_Marching() == DT_STEPPING_1ST)
-          Residual[iVar] = (U_time_nP1[iVar] - U_time_n[iVar])*Volume_nP1 / TimeStep;
+          residual[iVar] = (U_time_nP1[iVar] - U_time_n[iVar])*Volume_nP1 / TimeStep;
         if (config->GetTime_Marching() == DT_STEPPING_2ND)
-          Residual[iVar] = ( 3.0*U_time_nP1[iVar] - 4.0*U_time_n[iVar]
+          residual[iVar] = ( 3.0*U_time_nP1[iVar] - 4.0*U_time_n[iVar]
                             +1.0*U_time_nM1[iVar])*Volume_nP1 / (2.0*TimeStep);
       }
 
       /*--- Store the residual and compute the Jacobian contribution due
        to the dual time source term. ---*/
 
-      LinSysRes.AddBlock(iPoint, Residual);
+      LinSysRes.AddBlock(iPoint, residual);
       if (implicit) {
         for (iVar = 0; iVar < nVar; iVar++) {
-          for (jVar = 0; jVar < nVar; jVar++) Jacobian_i[iVar][jVar] = 0.0;
+          for (jVar = 0; jVar < nVar; jVar++) Jac_i[iVar][jVar] = 0.0;
           if (config->GetTime_Marching() == DT_STEPPING_1ST)
-            Jacobian_i[iVar][iVar] = Volume_nP1 / TimeStep;
+            Jac_i[iVar][iVar] = Volume_nP1 / TimeStep;
           if (config->GetTime_Marching() == DT_STEPPING_2ND)
-            Jacobian_i[iVar][iVar] = (Volume_nP1*3.0)/(2.0*TimeStep);
+            Jac_i[iVar][iVar] = (Volume_nP1*3.0)/(2.0*TimeStep);
         }
 
-        Jacobian.AddBlock2Diag(iPoint, Jacobian_i);
+        Jacobian.AddBlock2Diag(iPoint, Jac_i);
       }
     }
   }
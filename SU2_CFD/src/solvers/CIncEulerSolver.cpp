@@ -77,8 +77,6 @@ CIncEulerSolver::CIncEulerSolver(void) : CSolver() {
   Smatrix = NULL; Cvector = NULL;
   Preconditioner = NULL;
 
-  FluidModel = NULL;
-
   SlidingState     = NULL;
   SlidingStateNodes = NULL;
 
@@ -186,10 +184,6 @@ CIncEulerSolver::CIncEulerSolver(CGeometry *geometry, CConfig *config, unsigned
   Smatrix = NULL; Cvector = NULL;
   Preconditioner = NULL;
 
-  /*--- Fluid model pointer initialization ---*/
-
-  FluidModel = NULL;
-
   /*--- Set the gamma value ---*/
 
   Gamma = config->GetGamma();
@@ -285,6 +279,10 @@ CIncEulerSolver::CIncEulerSolver(CGeometry *geometry, CConfig *config, unsigned
   LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
   LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
 
+  /*--- Edge coloring and chunk sizes for the hybrid parallel execution. ---*/
+
+  HybridParallelInitialization(geometry, config);
+
   /*--- Jacobians and vector structures for implicit computations ---*/
 
   if (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) {
@@ -297,7 +295,7 @@ CIncEulerSolver::CIncEulerSolver(CGeometry *geometry, CConfig *config, unsigned
     }
 
     if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (Euler). MG level: " << iMesh <<"." << endl;
-    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config, ReducerStrategy);
 
     if (config->GetKind_Linear_Solver_Prec() == LINELET) {
       nLineLets = Jacobian.BuildLineletPreconditioner(geometry, config);
@@ -601,6 +599,65 @@ CIncEulerSolver::CIncEulerSolver(CGeometry *geometry, CConfig *config, unsigned
   /*--- Add the solver name (max 8 characters) ---*/
   SolverName = "INC.FLOW";
 
+  /*--- Finally, check that the static arrays will be large enough (keep this
+   *    check at the bottom to make sure we consider the "final" values). ---*/
+  if((nDim > MAXNDIM) || (nPrimVar > MAXNVAR))
+    SU2_MPI::Error("Oops! The CIncEulerSolver static array sizes are not large enough.",CURRENT_FUNCTION);
+}
+
+void CIncEulerSolver::HybridParallelInitialization(CGeometry *geometry, CConfig *config) {
+
+#ifdef HAVE_OMP
+  /*--- Get the edge coloring. If the expected parallel efficiency becomes too low setup the
+   *    reducer strategy. Where one loop is performed over edges followed by a point loop to
+   *    sum the fluxes for each cell and set the diagonal of the system matrix. ---*/
+
+  su2double parallelEff = 1.0;
+  const auto& coloring = geometry->GetEdgeColoring(&parallelEff);
+
+  /*--- The decision to use the strategy is local to each rank. ---*/
+  ReducerStrategy = parallelEff < COLORING_EFF_THRESH;
+
+  /*--- When using the reducer force a single color to reduce the color loop overhead. ---*/
+  if (ReducerStrategy && (coloring.getOuterSize()>1))
+    geometry->SetNaturalEdgeColoring();
+
+  if (!coloring.empty()) {
+    /*--- If the reducer strategy is used we are not constrained by group
+     *    size as we have no other edge loops in the incompressible solvers. ---*/
+    auto groupSize = ReducerStrategy? 1ul : geometry->GetEdgeColorGroupSize();
+    auto nColor = coloring.getOuterSize();
+    EdgeColoring.reserve(nColor);
+
+    for(auto iColor = 0ul; iColor < nColor; ++iColor)
+      EdgeColoring.emplace_back(coloring.innerIdx(iColor), coloring.getNumNonZeros(iColor), groupSize);
+  }
+
+  /*--- If the reducer strategy is not being forced (by EDGE_COLORING_GROUP_SIZE=0) print some messages. ---*/
+  if (config->GetEdgeColoringGroupSize() != 1<<30) {
+
+    su2double minEff = 1.0;
+    SU2_MPI::Reduce(&parallelEff, &minEff, 1, MPI_DOUBLE, MPI_MIN, MASTER_NODE, MPI_COMM_WORLD);
+
+    int tmp = ReducerStrategy, numRanksUsingReducer = 0;
+    SU2_MPI::Reduce(&tmp, &numRanksUsingReducer, 1, MPI_INT, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
+
+    if (minEff < COLORING_EFF_THRESH) {
+      cout << "WARNING: On " << numRanksUsingReducer << " MPI ranks the coloring efficiency was less than "
+           << COLORING_EFF_THRESH << " (min value was " << minEff << ").\n"
+           << "         Those ranks will now use a fallback strategy, better performance may be possible\n"
+           << "         with a different value of config option EDGE_COLORING_GROUP_SIZE (default 512)." << endl;
+    }
+  }
+
+  if (ReducerStrategy)
+    EdgeFluxes.Initialize(geometry->GetnEdge(), geometry->GetnEdge(), nVar, nullptr);
+
+  omp_chunk_size = computeStaticChunkSize(nPoint, omp_get_max_threads(), OMP_MAX_SIZE);
+#else
+  EdgeColoring[0] = DummyGridColor<>(geometry->GetnEdge());
+#endif
+
 }
 
 CIncEulerSolver::~CIncEulerSolver(void) {
@@ -784,7 +841,7 @@ CIncEulerSolver::~CIncEulerSolver(void) {
     delete [] YPlus;
   }
 
-  if (FluidModel != NULL) delete FluidModel;
+  for(auto& model : FluidModel) delete model;
 
   if (nodes != nullptr) delete nodes;
 }
@@ -831,21 +888,23 @@ void CIncEulerSolver::SetNondimensionalization(CConfig *config, unsigned short i
 
   /*--- Depending on the density model chosen, select a fluid model. ---*/
 
+  CFluidModel* auxFluidModel = nullptr;
+
   switch (config->GetKind_FluidModel()) {
 
     case CONSTANT_DENSITY:
 
-      FluidModel = new CConstantDensity(Density_FreeStream, config->GetSpecific_Heat_Cp());
-      FluidModel->SetTDState_T(Temperature_FreeStream);
+      auxFluidModel = new CConstantDensity(Density_FreeStream, config->GetSpecific_Heat_Cp());
+      auxFluidModel->SetTDState_T(Temperature_FreeStream);
       break;
 
     case INC_IDEAL_GAS:
 
       config->SetGas_Constant(UNIVERSAL_GAS_CONSTANT/(config->GetMolecular_Weight()/1000.0));
       Pressure_Thermodynamic = Density_FreeStream*Temperature_FreeStream*config->GetGas_Constant();
-      FluidModel = new CIncIdealGas(config->GetSpecific_Heat_Cp(), config->GetGas_Constant(), Pressure_Thermodynamic);
-      FluidModel->SetTDState_T(Temperature_FreeStream);
-      Pressure_Thermodynamic = FluidModel->GetPressure();
+      auxFluidModel = new CIncIdealGas(config->GetSpecific_Heat_Cp(), config->GetGas_Constant(), Pressure_Thermodynamic);
+      auxFluidModel->SetTDState_T(Temperature_FreeStream);
+      Pressure_Thermodynamic = auxFluidModel->GetPressure();
       config->SetPressure_Thermodynamic(Pressure_Thermodynamic);
       break;
 
@@ -853,15 +912,15 @@ void CIncEulerSolver::SetNondimensionalization(CConfig *config, unsigned short i
 
       config->SetGas_Constant(UNIVERSAL_GAS_CONSTANT/(config->GetMolecular_Weight()/1000.0));
       Pressure_Thermodynamic = Density_FreeStream*Temperature_FreeStream*config->GetGas_Constant();
-      FluidModel = new CIncIdealGasPolynomial(config->GetGas_Constant(), Pressure_Thermodynamic);
+      auxFluidModel = new CIncIdealGasPolynomial(config->GetGas_Constant(), Pressure_Thermodynamic);
       if (viscous) {
         /*--- Variable Cp model via polynomial. ---*/
         for (iVar = 0; iVar < config->GetnPolyCoeffs(); iVar++)
           config->SetCp_PolyCoeffND(config->GetCp_PolyCoeff(iVar), iVar);
-        FluidModel->SetCpModel(config);
+        auxFluidModel->SetCpModel(config);
       }
-      FluidModel->SetTDState_T(Temperature_FreeStream);
-      Pressure_Thermodynamic = FluidModel->GetPressure();
+      auxFluidModel->SetTDState_T(Temperature_FreeStream);
+      Pressure_Thermodynamic = auxFluidModel->GetPressure();
       config->SetPressure_Thermodynamic(Pressure_Thermodynamic);
       break;
 
@@ -887,8 +946,8 @@ void CIncEulerSolver::SetNondimensionalization(CConfig *config, unsigned short i
 
     /*--- Use the fluid model to compute the dimensional viscosity/conductivity. ---*/
 
-    FluidModel->SetLaminarViscosityModel(config);
-    Viscosity_FreeStream = FluidModel->GetLaminarViscosity();
+    auxFluidModel->SetLaminarViscosityModel(config);
+    Viscosity_FreeStream = auxFluidModel->GetLaminarViscosity();
     config->SetViscosity_FreeStream(Viscosity_FreeStream);
 
     Reynolds = Density_FreeStream*ModVel_FreeStream/Viscosity_FreeStream; config->SetReynolds(Reynolds);
@@ -945,7 +1004,7 @@ void CIncEulerSolver::SetNondimensionalization(CConfig *config, unsigned short i
 
   /*--- Get the freestream energy. Only useful if energy equation is active. ---*/
 
-  Energy_FreeStream = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
+  Energy_FreeStream = auxFluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
   config->SetEnergy_FreeStream(Energy_FreeStream);
   if (tkeNeeded) { Energy_FreeStream += Tke_FreeStream; }; config->SetEnergy_FreeStream(Energy_FreeStream);
 
@@ -995,37 +1054,9 @@ void CIncEulerSolver::SetNondimensionalization(CConfig *config, unsigned short i
   Omega_FreeStreamND = Density_FreeStreamND*Tke_FreeStreamND/(Viscosity_FreeStreamND*config->GetTurb2LamViscRatio_FreeStream());
   config->SetOmega_FreeStreamND(Omega_FreeStreamND);
 
-  /*--- Delete the original (dimensional) FluidModel object. No fluid is used for inscompressible cases. ---*/
+  /*--- Auxilary (dimensional) FluidModel no longer needed. ---*/
 
-  delete FluidModel;
-
-  switch (config->GetKind_FluidModel()) {
-
-    case CONSTANT_DENSITY:
-      FluidModel = new CConstantDensity(Density_FreeStreamND, Specific_Heat_CpND);
-      FluidModel->SetTDState_T(Temperature_FreeStreamND);
-      break;
-
-    case INC_IDEAL_GAS:
-      FluidModel = new CIncIdealGas(Specific_Heat_CpND, Gas_ConstantND, Pressure_ThermodynamicND);
-      FluidModel->SetTDState_T(Temperature_FreeStreamND);
-      break;
-
-    case INC_IDEAL_GAS_POLY:
-      FluidModel = new CIncIdealGasPolynomial(Gas_ConstantND, Pressure_ThermodynamicND);
-      if (viscous) {
-        /*--- Variable Cp model via polynomial. ---*/
-        config->SetCp_PolyCoeffND(config->GetCp_PolyCoeff(0)/Gas_Constant_Ref, 0);
-        for (iVar = 1; iVar < config->GetnPolyCoeffs(); iVar++)
-          config->SetCp_PolyCoeffND(config->GetCp_PolyCoeff(iVar)*pow(Temperature_Ref,iVar)/Gas_Constant_Ref, iVar);
-        FluidModel->SetCpModel(config);
-      }
-      FluidModel->SetTDState_T(Temperature_FreeStreamND);
-      break;
-
-  }
-
-  Energy_FreeStreamND = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStreamND*ModVel_FreeStreamND;
+  delete auxFluidModel;
 
   if (viscous) {
 
@@ -1055,12 +1086,53 @@ void CIncEulerSolver::SetNondimensionalization(CConfig *config, unsigned short i
     for (iVar = 1; iVar < config->GetnPolyCoeffs(); iVar++)
       config->SetKt_PolyCoeffND(config->GetKt_PolyCoeff(iVar)*pow(Temperature_Ref,iVar)/Conductivity_Ref, iVar);
 
+    /*--- Variable Cp model via polynomial. ---*/
+
+    if (config->GetKind_FluidModel() == INC_IDEAL_GAS_POLY) {
+      config->SetCp_PolyCoeffND(config->GetCp_PolyCoeff(0)/Gas_Constant_Ref, 0);
+      for (iVar = 1; iVar < config->GetnPolyCoeffs(); iVar++)
+        config->SetCp_PolyCoeffND(config->GetCp_PolyCoeff(iVar)*pow(Temperature_Ref,iVar)/Gas_Constant_Ref, iVar);
+    }
+  }
+
+  /*--- Create one final fluid model object per OpenMP thread to be able to use them in parallel.
+   *    GetFluidModel() should be used to automatically access the "right" object of each thread. ---*/
+
+  assert(FluidModel.empty() && "Potential memory leak!");
+  FluidModel.resize(omp_get_max_threads());
+
+  SU2_OMP_PARALLEL
+  {
+    const int thread = omp_get_thread_num();
+
+    switch (config->GetKind_FluidModel()) {
+
+      case CONSTANT_DENSITY:
+        FluidModel[thread] = new CConstantDensity(Density_FreeStreamND, Specific_Heat_CpND);
+        break;
+
+      case INC_IDEAL_GAS:
+        FluidModel[thread] = new CIncIdealGas(Specific_Heat_CpND, Gas_ConstantND, Pressure_ThermodynamicND);
+        break;
+
+      case INC_IDEAL_GAS_POLY:
+        FluidModel[thread] = new CIncIdealGasPolynomial(Gas_ConstantND, Pressure_ThermodynamicND);
+        if (viscous) GetFluidModel()->SetCpModel(config);
+        break;
+    }
+
+    GetFluidModel()->SetTDState_T(Temperature_FreeStreamND);
+
     /*--- Set up the transport property models. ---*/
 
-    FluidModel->SetLaminarViscosityModel(config);
-    FluidModel->SetThermalConductivityModel(config);
+    if (viscous) {
+      GetFluidModel()->SetLaminarViscosityModel(config);
+      GetFluidModel()->SetThermalConductivityModel(config);
+    }
+
+  } // end SU2_OMP_PARALLEL
 
-  }
+  Energy_FreeStreamND = GetFluidModel()->GetStaticEnergy() + 0.5*ModVel_FreeStreamND*ModVel_FreeStreamND;
 
   if (tkeNeeded) { Energy_FreeStreamND += Tke_FreeStreamND; };  config->SetEnergy_FreeStreamND(Energy_FreeStreamND);
 
@@ -1505,8 +1577,6 @@ void CIncEulerSolver::SetInitialCondition(CGeometry **geometry, CSolver ***solve
 
 void CIncEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iMesh, unsigned short iRKStep, unsigned short RunTime_EqSystem, bool Output) {
 
-  unsigned long ErrorCounter = 0;
-
   unsigned long InnerIter = config->GetInnerIter();
   bool cont_adjoint     = config->GetContinuous_Adjoint();
   bool disc_adjoint     = config->GetDiscrete_Adjoint();
@@ -1520,7 +1590,12 @@ void CIncEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_contai
 
   /*--- Set the primitive variables ---*/
 
-  ErrorCounter = SetPrimitive_Variables(solver_container, config, Output);
+  SU2_OMP_MASTER
+  ErrorCounter = 0;
+  SU2_OMP_BARRIER
+
+  SU2_OMP_ATOMIC
+  ErrorCounter += SetPrimitive_Variables(solver_container, config, Output);
 
   /*--- Upwind second order reconstruction ---*/
 
@@ -1559,20 +1634,28 @@ void CIncEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_contai
 
   /*--- Compute properties needed for mass flow BCs. ---*/
 
-  if (outlet) GetOutlet_Properties(geometry, config, iMesh, Output);
+  if (outlet) {
+    SU2_OMP_MASTER
+    GetOutlet_Properties(geometry, config, iMesh, Output);
+    SU2_OMP_BARRIER
+  }
 
-  /*--- Initialize the Jacobian matrices ---*/
+  /*--- Initialize the Jacobian matrices, not needed for the reducer strategy
+   *    as we set blocks (including diagonal ones) and completely overwrite. ---*/
 
-  if (implicit && !disc_adjoint) Jacobian.SetValZero();
+  if (implicit && !disc_adjoint && !ReducerStrategy) Jacobian.SetValZero();
 
   /*--- Error message ---*/
 
   if (config->GetComm_Level() == COMM_FULL) {
-#ifdef HAVE_MPI
-    unsigned long MyErrorCounter = ErrorCounter; ErrorCounter = 0;
-    SU2_MPI::Allreduce(&MyErrorCounter, &ErrorCounter, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
-#endif
-    if (iMesh == MESH_0) config->SetNonphysical_Points(ErrorCounter);
+    SU2_OMP_BARRIER
+    SU2_OMP_MASTER
+    {
+      unsigned long MyErrorCounter = ErrorCounter;
+      SU2_MPI::Allreduce(&MyErrorCounter, &ErrorCounter, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+      if (iMesh == MESH_0) config->SetNonphysical_Points(ErrorCounter);
+    }
+    SU2_OMP_BARRIER
   }
 
 }
@@ -1582,14 +1665,16 @@ void CIncEulerSolver::Postprocessing(CGeometry *geometry, CSolver **solver_conta
 
 unsigned long CIncEulerSolver::SetPrimitive_Variables(CSolver **solver_container, CConfig *config, bool Output) {
 
-  unsigned long iPoint, nonPhysicalPoints = 0;
-  bool physical = true;
+  /*--- Number of non-physical points, local to the thread, needs
+   *    further reduction if function is called in parallel ---*/
+  unsigned long nonPhysicalPoints = 0;
 
-  for (iPoint = 0; iPoint < nPoint; iPoint ++) {
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint ++) {
 
     /*--- Incompressible flow, primitive variables ---*/
 
-    physical = nodes->SetPrimVar(iPoint,FluidModel);
+    bool physical = nodes->SetPrimVar(iPoint, GetFluidModel());
 
     /* Check for non-realizable states for reporting. */
 
@@ -1607,64 +1692,101 @@ unsigned long CIncEulerSolver::SetPrimitive_Variables(CSolver **solver_container
 void CIncEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container, CConfig *config,
                                 unsigned short iMesh, unsigned long Iteration) {
 
-  su2double *Normal, Area, Vol, Mean_SoundSpeed = 0.0, Mean_ProjVel = 0.0,
-  Mean_BetaInc2, Lambda, Local_Delta_Time,
-  Global_Delta_Time = 1E6, Global_Delta_UnstTimeND, ProjVel, ProjVel_i, ProjVel_j;
+  const bool viscous       = config->GetViscous();
+  const bool energy        = config->GetEnergy_Equation();
+  const bool implicit      = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  const bool time_stepping = (config->GetTime_Marching() == TIME_STEPPING);
+  const bool dual_time     = (config->GetTime_Marching() == DT_STEPPING_1ST) ||
+                             (config->GetTime_Marching() == DT_STEPPING_2ND);
+  const su2double K_v = 0.25;
+
+  /*--- Init thread-shared variables to compute min/max values.
+   *    Critical sections are used for this instead of reduction
+   *    clauses for compatibility with OpenMP 2.0 (Windows...). ---*/
+
+  SU2_OMP_MASTER
+  {
+    Min_Delta_Time = 1e30;
+    Max_Delta_Time = 0.0;
+    Global_Delta_Time = 1e6;
+    Global_Delta_UnstTimeND = 1e30;
+  }
+  SU2_OMP_BARRIER
 
+  const su2double *Normal = nullptr;
+  su2double Area, Vol, Mean_SoundSpeed, Mean_ProjVel, Mean_BetaInc2, Lambda, Local_Delta_Time, Local_Delta_Time_Visc;
+  su2double Mean_LaminarVisc, Mean_EddyVisc, Mean_Density, Mean_Thermal_Conductivity, Mean_Cv, Lambda_1, Lambda_2;
   unsigned long iEdge, iVertex, iPoint, jPoint;
   unsigned short iDim, iMarker;
 
-  bool implicit      = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
-  bool time_stepping = config->GetTime_Marching() == TIME_STEPPING;
-  bool dual_time     = ((config->GetTime_Marching() == DT_STEPPING_1ST) ||
-                    (config->GetTime_Marching() == DT_STEPPING_2ND));
+  /*--- Loop domain points, each one accumulates the eigenvalues of the edges
+   *    it shares with its neighbors (avoids write conflicts between threads). ---*/
 
-  Min_Delta_Time = 1.E30; Max_Delta_Time = 0.0;
+  SU2_OMP_FOR_DYN(omp_chunk_size)
+  for (iPoint = 0; iPoint < nPointDomain; ++iPoint) {
 
-  /*--- Set maximum inviscid eigenvalue to zero, and compute sound speed ---*/
+    auto node_i = geometry->node[iPoint];
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
-    nodes->SetMax_Lambda_Inv(iPoint,0.0);
+    /*--- Set maximum eigenvalues to zero. ---*/
 
-  /*--- Loop interior edges ---*/
+    nodes->SetMax_Lambda_Inv(iPoint,0.0);
 
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+    if (viscous)
+      nodes->SetMax_Lambda_Visc(iPoint,0.0);
 
-    /*--- Point identification, Normal vector and area ---*/
+    /*--- Loop over the neighbors of point i. ---*/
 
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
+    for (unsigned short iNeigh = 0; iNeigh < node_i->GetnPoint(); ++iNeigh)
+    {
+      jPoint = node_i->GetPoint(iNeigh);
+      auto node_j = geometry->node[jPoint];
 
-    Normal = geometry->edge[iEdge]->GetNormal();
+      iEdge = node_i->GetEdge(iNeigh);
+      Normal = geometry->edge[iEdge]->GetNormal();
+      Area = 0.0; for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim]; Area = sqrt(Area);
 
-    Area = 0.0;
-    for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim];
-    Area = sqrt(Area);
+      /*--- Mean Values ---*/
 
-    /*--- Mean Values ---*/
+      Mean_ProjVel    = 0.5 * (nodes->GetProjVel(iPoint,Normal) + nodes->GetProjVel(jPoint,Normal));
+      Mean_BetaInc2   = 0.5 * (nodes->GetBetaInc2(iPoint)       + nodes->GetBetaInc2(jPoint));
+      Mean_SoundSpeed = sqrt(Mean_BetaInc2*Area*Area);
 
-    Mean_ProjVel    = 0.5 * (nodes->GetProjVel(iPoint,Normal) + nodes->GetProjVel(jPoint,Normal));
-    Mean_BetaInc2   = 0.5 * (nodes->GetBetaInc2(iPoint)      + nodes->GetBetaInc2(jPoint));
-    Mean_SoundSpeed = sqrt(Mean_BetaInc2*Area*Area);
+      /*--- Adjustment for grid movement ---*/
 
-    /*--- Adjustment for grid movement ---*/
+      if (dynamic_grid) {
+        const su2double *GridFlux = geometry->GetEdgeGridFlux(iEdge);
+        if (GridFlux) Mean_ProjVel -= *GridFlux;
+        else {
+          const su2double *GridVel_i = node_i->GetGridVel();
+          const su2double *GridVel_j = node_j->GetGridVel();
 
-    if (dynamic_grid) {
-      su2double *GridVel_i = geometry->node[iPoint]->GetGridVel();
-      su2double *GridVel_j = geometry->node[jPoint]->GetGridVel();
-      ProjVel_i = 0.0; ProjVel_j = 0.0;
-      for (iDim = 0; iDim < nDim; iDim++) {
-        ProjVel_i += GridVel_i[iDim]*Normal[iDim];
-        ProjVel_j += GridVel_j[iDim]*Normal[iDim];
+          for (iDim = 0; iDim < nDim; iDim++)
+            Mean_ProjVel -= 0.5 * (GridVel_i[iDim] + GridVel_j[iDim]) * Normal[iDim];
+        }
       }
-      Mean_ProjVel -= 0.5 * (ProjVel_i + ProjVel_j);
-    }
 
-    /*--- Inviscid contribution ---*/
+      /*--- Inviscid contribution ---*/
+
+      Lambda = fabs(Mean_ProjVel) + Mean_SoundSpeed;
+      nodes->AddMax_Lambda_Inv(iPoint,Lambda);
+
+      /*--- Viscous contribution ---*/
+
+      if (!viscous) continue;
+
+      Mean_LaminarVisc          = 0.5*(nodes->GetLaminarViscosity(iPoint)    + nodes->GetLaminarViscosity(jPoint));
+      Mean_EddyVisc             = 0.5*(nodes->GetEddyViscosity(iPoint)       + nodes->GetEddyViscosity(jPoint));
+      Mean_Density              = 0.5*(nodes->GetDensity(iPoint)             + nodes->GetDensity(jPoint));
+      Mean_Thermal_Conductivity = 0.5*(nodes->GetThermalConductivity(iPoint) + nodes->GetThermalConductivity(jPoint));
+      Mean_Cv                   = 0.5*(nodes->GetSpecificHeatCv(iPoint)      + nodes->GetSpecificHeatCv(jPoint));
 
-    Lambda = fabs(Mean_ProjVel) + Mean_SoundSpeed;
-    if (geometry->node[iPoint]->GetDomain()) nodes->AddMax_Lambda_Inv(iPoint,Lambda);
-    if (geometry->node[jPoint]->GetDomain()) nodes->AddMax_Lambda_Inv(jPoint,Lambda);
+      Lambda_1 = (4.0/3.0)*(Mean_LaminarVisc + Mean_EddyVisc);
+      Lambda_2 = 0.0;
+      if (energy) Lambda_2 = (1.0/Mean_Cv)*Mean_Thermal_Conductivity;
+      Lambda = (Lambda_1 + Lambda_2)*Area*Area/Mean_Density;
+
+      nodes->AddMax_Lambda_Visc(iPoint, Lambda);
+    }
 
   }
 
@@ -1673,111 +1795,144 @@ void CIncEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_contain
   for (iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
     if ((config->GetMarker_All_KindBC(iMarker) != INTERNAL_BOUNDARY) &&
         (config->GetMarker_All_KindBC(iMarker) != PERIODIC_BOUNDARY)) {
-    for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
 
-      /*--- Point identification, Normal vector and area ---*/
+      SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+      for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
 
-      iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-      Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+        /*--- Point identification, Normal vector and area ---*/
 
-      Area = 0.0;
-      for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim];
-      Area = sqrt(Area);
+        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
 
-      /*--- Mean Values ---*/
+        if (!geometry->node[iPoint]->GetDomain()) continue;
 
-      Mean_ProjVel    = nodes->GetProjVel(iPoint,Normal);
-      Mean_BetaInc2   = nodes->GetBetaInc2(iPoint);
-      Mean_SoundSpeed = sqrt(Mean_BetaInc2*Area*Area);
+        Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+        Area = 0.0; for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim]; Area = sqrt(Area);
 
-      /*--- Adjustment for grid movement ---*/
+        /*--- Mean Values ---*/
 
-      if (dynamic_grid) {
-        su2double *GridVel = geometry->node[iPoint]->GetGridVel();
-        ProjVel = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++)
-          ProjVel += GridVel[iDim]*Normal[iDim];
-        Mean_ProjVel -= ProjVel;
-      }
+        Mean_ProjVel    = nodes->GetProjVel(iPoint,Normal);
+        Mean_BetaInc2   = nodes->GetBetaInc2(iPoint);
+        Mean_SoundSpeed = sqrt(Mean_BetaInc2*Area*Area);
 
-      /*--- Inviscid contribution ---*/
+        /*--- Adjustment for grid movement ---*/
 
-      Lambda = fabs(Mean_ProjVel) + Mean_SoundSpeed;
-      if (geometry->node[iPoint]->GetDomain()) {
+        if (dynamic_grid) {
+          const su2double *GridVel = geometry->node[iPoint]->GetGridVel();
+
+          for (iDim = 0; iDim < nDim; iDim++)
+            Mean_ProjVel -= GridVel[iDim]*Normal[iDim];
+        }
+
+        /*--- Inviscid contribution ---*/
+
+        Lambda = fabs(Mean_ProjVel) + Mean_SoundSpeed;
         nodes->AddMax_Lambda_Inv(iPoint,Lambda);
-      }
 
-    }
+        /*--- Viscous contribution ---*/
+
+        if (!viscous) continue;
+
+        Mean_LaminarVisc          = nodes->GetLaminarViscosity(iPoint);
+        Mean_EddyVisc             = nodes->GetEddyViscosity(iPoint);
+        Mean_Density              = nodes->GetDensity(iPoint);
+        Mean_Thermal_Conductivity = nodes->GetThermalConductivity(iPoint);
+        Mean_Cv                   = nodes->GetSpecificHeatCv(iPoint);
+
+        Lambda_1 = (4.0/3.0)*(Mean_LaminarVisc + Mean_EddyVisc);
+        Lambda_2 = 0.0;
+        if (energy) Lambda_2 = (1.0/Mean_Cv)*Mean_Thermal_Conductivity;
+        Lambda = (Lambda_1 + Lambda_2)*Area*Area/Mean_Density;
+
+        nodes->AddMax_Lambda_Visc(iPoint, Lambda);
+
+      }
     }
   }
 
   /*--- Local time-stepping: each element uses their own speed for steady state
    simulations or for pseudo time steps in a dual time simulation. ---*/
+  {
+    /*--- Thread-local variables for min/max reduction. ---*/
+    su2double minDt = 1e30, maxDt = 0.0, glbDt = 1e6;
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    SU2_OMP(for schedule(static,omp_chunk_size) nowait)
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+
+      Vol = geometry->node[iPoint]->GetVolume();
 
-    Vol = geometry->node[iPoint]->GetVolume();
+      if (Vol != 0.0) {
+        Local_Delta_Time = nodes->GetLocalCFL(iPoint)*Vol / nodes->GetMax_Lambda_Inv(iPoint);
 
-    if (Vol != 0.0) {
-      Local_Delta_Time  = nodes->GetLocalCFL(iPoint)*Vol / nodes->GetMax_Lambda_Inv(iPoint);
-      Global_Delta_Time = min(Global_Delta_Time, Local_Delta_Time);
-      Min_Delta_Time    = min(Min_Delta_Time, Local_Delta_Time);
-      Max_Delta_Time    = max(Max_Delta_Time, Local_Delta_Time);
-      if (Local_Delta_Time > config->GetMax_DeltaTime())
-        Local_Delta_Time = config->GetMax_DeltaTime();
-      nodes->SetDelta_Time(iPoint,Local_Delta_Time);
+        if (viscous) {
+          Local_Delta_Time_Visc = nodes->GetLocalCFL(iPoint)*K_v*Vol*Vol/ nodes->GetMax_Lambda_Visc(iPoint);
+          Local_Delta_Time = min(Local_Delta_Time, Local_Delta_Time_Visc);
+        }
+
+        glbDt = min(glbDt, Local_Delta_Time);
+        minDt = min(minDt, Local_Delta_Time);
+        maxDt = max(maxDt, Local_Delta_Time);
+
+        nodes->SetDelta_Time(iPoint, min(Local_Delta_Time, config->GetMax_DeltaTime()));
+      }
+      else {
+        nodes->SetDelta_Time(iPoint,0.0);
+      }
     }
-    else {
-      nodes->SetDelta_Time(iPoint,0.0);
+    /*--- Min/max over threads. ---*/
+    SU2_OMP_CRITICAL
+    {
+      Min_Delta_Time = min(Min_Delta_Time, minDt);
+      Max_Delta_Time = max(Max_Delta_Time, maxDt);
+      Global_Delta_Time = min(Global_Delta_Time, glbDt);
     }
-
+    SU2_OMP_BARRIER
   }
 
-  /*--- Compute the max and the min dt (in parallel) ---*/
+  /*--- Compute the min/max dt (in parallel, now over mpi ranks). ---*/
 
+  SU2_OMP_MASTER
   if (config->GetComm_Level() == COMM_FULL) {
-#ifdef HAVE_MPI
-    su2double rbuf_time, sbuf_time;
-    sbuf_time = Min_Delta_Time;
-    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_DOUBLE, MPI_MIN, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Bcast(&rbuf_time, 1, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    su2double rbuf_time;
+    SU2_MPI::Allreduce(&Min_Delta_Time, &rbuf_time, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
     Min_Delta_Time = rbuf_time;
 
-    sbuf_time = Max_Delta_Time;
-    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_DOUBLE, MPI_MAX, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Bcast(&rbuf_time, 1, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(&Max_Delta_Time, &rbuf_time, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
     Max_Delta_Time = rbuf_time;
-#endif
   }
+  SU2_OMP_BARRIER
 
   /*--- For time-accurate simulations use the minimum delta time of the whole mesh (global) ---*/
 
   if (time_stepping) {
-#ifdef HAVE_MPI
-    su2double rbuf_time, sbuf_time;
-    sbuf_time = Global_Delta_Time;
-    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_DOUBLE, MPI_MIN, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Bcast(&rbuf_time, 1, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    Global_Delta_Time = rbuf_time;
-#endif
+
     /*--- If the unsteady CFL is set to zero, it uses the defined
      unsteady time step, otherwise it computes the time step based
      on the unsteady CFL ---*/
 
-    if (config->GetUnst_CFL() == 0.0) {
-      Global_Delta_Time = config->GetDelta_UnstTime();
+    SU2_OMP_MASTER
+    {
+      su2double rbuf_time;
+      SU2_MPI::Allreduce(&Global_Delta_Time, &rbuf_time, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+      Global_Delta_Time = rbuf_time;
+
+      if (config->GetUnst_CFL() == 0.0) {
+        Global_Delta_Time = config->GetDelta_UnstTime();
+      }
+      Min_Delta_Time = Global_Delta_Time;
+      Max_Delta_Time = Global_Delta_Time;
+
+      config->SetDelta_UnstTimeND(Global_Delta_Time);
     }
-    config->SetDelta_UnstTimeND(Global_Delta_Time);
-    for (iPoint = 0; iPoint < nPointDomain; iPoint++){
+    SU2_OMP_BARRIER
 
-      /*--- Sets the regular CFL equal to the unsteady CFL ---*/
+    /*--- Sets the regular CFL equal to the unsteady CFL ---*/
 
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
       nodes->SetLocalCFL(iPoint, config->GetUnst_CFL());
       nodes->SetDelta_Time(iPoint, Global_Delta_Time);
-      Min_Delta_Time = Global_Delta_Time;
-      Max_Delta_Time = Global_Delta_Time;
-
     }
+
   }
 
   /*--- Recompute the unsteady time step for the dual time strategy
@@ -1785,49 +1940,63 @@ void CIncEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_contain
 
   if ((dual_time) && (Iteration == 0) && (config->GetUnst_CFL() != 0.0) && (iMesh == MESH_0)) {
 
-    Global_Delta_UnstTimeND = 1e30;
-    for (iPoint = 0; iPoint < nPointDomain; iPoint++){
-      Global_Delta_UnstTimeND = min(Global_Delta_UnstTimeND,config->GetUnst_CFL()*Global_Delta_Time/nodes->GetLocalCFL(iPoint));
+    /*--- Thread-local variable for reduction. ---*/
+    su2double glbDtND = 1e30;
+
+    SU2_OMP(for schedule(static,omp_chunk_size) nowait)
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      glbDtND = min(glbDtND, config->GetUnst_CFL()*Global_Delta_Time / nodes->GetLocalCFL(iPoint));
     }
+    SU2_OMP_CRITICAL
+    Global_Delta_UnstTimeND = min(Global_Delta_UnstTimeND, glbDtND);
+    SU2_OMP_BARRIER
 
-#ifdef HAVE_MPI
-    su2double rbuf_time, sbuf_time;
-    sbuf_time = Global_Delta_UnstTimeND;
-    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_DOUBLE, MPI_MIN, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Bcast(&rbuf_time, 1, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    Global_Delta_UnstTimeND = rbuf_time;
-#endif
-    config->SetDelta_UnstTimeND(Global_Delta_UnstTimeND);
+    SU2_OMP_MASTER
+    {
+      SU2_MPI::Allreduce(&Global_Delta_UnstTimeND, &glbDtND, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+      Global_Delta_UnstTimeND = glbDtND;
+
+      config->SetDelta_UnstTimeND(Global_Delta_UnstTimeND);
+    }
+    SU2_OMP_BARRIER
   }
 
   /*--- The pseudo local time (explicit integration) cannot be greater than the physical time ---*/
 
-  if (dual_time)
+  if (dual_time && !implicit) {
+    SU2_OMP_FOR_STAT(omp_chunk_size)
     for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-      if (!implicit) {
-        Local_Delta_Time = min((2.0/3.0)*config->GetDelta_UnstTimeND(), nodes->GetDelta_Time(iPoint));
-        nodes->SetDelta_Time(iPoint,Local_Delta_Time);
-      }
+      Local_Delta_Time = min((2.0/3.0)*config->GetDelta_UnstTimeND(), nodes->GetDelta_Time(iPoint));
+      nodes->SetDelta_Time(iPoint, Local_Delta_Time);
     }
+  }
 
 }
 
 void CIncEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
                                      CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
 
-  CNumerics* numerics = numerics_container[CONV_TERM];
+  const bool implicit   = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  const bool jst_scheme = ((config->GetKind_Centered_Flow() == JST) && (iMesh == MESH_0));
 
-  unsigned long iEdge, iPoint, jPoint;
+  /*--- Pick one numerics object per thread. ---*/
+  CNumerics* numerics = numerics_container[CONV_TERM + omp_get_thread_num()*MAX_TERMS];
 
-  bool implicit      = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
-  bool jst_scheme  = ((config->GetKind_Centered_Flow() == JST) && (iMesh == MESH_0));
+  /*--- Loop over edge colors. ---*/
+  for (auto color : EdgeColoring)
+  {
+  /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+  SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+  for(auto k = 0ul; k < color.size; ++k) {
 
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+    auto iEdge = color.indices[k];
 
     /*--- Points in edge, set normal vectors, and number of neighbors ---*/
 
-    iPoint = geometry->edge[iEdge]->GetNode(0); jPoint = geometry->edge[iEdge]->GetNode(1);
-    numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
+    auto iPoint = geometry->GetEdgeNode(iEdge,0);
+    auto jPoint = geometry->GetEdgeNode(iEdge,1);
+
+    numerics->SetNormal(geometry->GetEdgeNormal(iEdge));
     numerics->SetNeighbor(geometry->node[iPoint]->GetnNeighbor(), geometry->node[jPoint]->GetnNeighbor());
 
     /*--- Set primitive variables w/o reconstruction ---*/
@@ -1848,23 +2017,31 @@ void CIncEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_co
     /*--- Grid movement ---*/
 
     if (dynamic_grid) {
-      numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(), geometry->node[jPoint]->GetGridVel());
+      const su2double *GridFlux = geometry->GetEdgeGridFlux(iEdge);
+      if (GridFlux) numerics->SetGridFlux(GridFlux);
+      else numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(), geometry->node[jPoint]->GetGridVel());
     }
 
     /*--- Compute residuals, and Jacobians ---*/
 
-    auto residual = numerics->ComputeResidual(config);
+    auto residual = numerics->ComputeResidualPreacc(config);
 
-    /*--- Update convective and artificial dissipation residuals ---*/
+    /*--- Viscous contribution. ---*/
 
-    LinSysRes.AddBlock(iPoint, residual);
-    LinSysRes.SubtractBlock(jPoint, residual);
+    auto viscous = ViscousEdgeResidual(iEdge, geometry, solver_container,
+                                       numerics_container[VISC_TERM + omp_get_thread_num()*MAX_TERMS], config);
 
-    /*--- Store implicit contributions from the residual calculation. ---*/
+    /*--- Update convective, artificial dissipation, and viscous residuals. ---*/
 
-    if (implicit) {
-      Jacobian.UpdateBlocks(iEdge, iPoint, jPoint, residual.jacobian_i, residual.jacobian_j);
-    }
+    UpdateEdgeContribution(iEdge, iPoint, jPoint, implicit, residual.residual,
+                           residual.jacobian_i, residual.jacobian_j, viscous);
+  }
+  } // end color loop
+
+  if (ReducerStrategy) {
+    SumEdgeFluxes(geometry);
+    if (implicit)
+      Jacobian.SetDiagonalAsColumnSum();
   }
 
 }
@@ -1872,50 +2049,66 @@ void CIncEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_co
 void CIncEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_container,
                                       CNumerics **numerics_container, CConfig *config, unsigned short iMesh) {
 
-  CNumerics* numerics = numerics_container[CONV_TERM];
+  const auto InnerIter  = config->GetInnerIter();
+  const bool implicit   = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  const bool muscl      = (config->GetMUSCL_Flow() && (iMesh == MESH_0));
+  const bool limiter    = (config->GetKind_SlopeLimit_Flow() != NO_LIMITER) && (InnerIter <= config->GetLimiterIter());
+  const bool van_albada = config->GetKind_SlopeLimit_Flow() == VAN_ALBADA_EDGE;
+  const bool energy     = config->GetEnergy_Equation();
 
-  su2double **Gradient_i, **Gradient_j, Project_Grad_i, Project_Grad_j,
-  *V_i, *V_j, *S_i, *S_j, *Limiter_i = NULL, *Limiter_j = NULL;
+  /*--- Non-physical counter. ---*/
+  unsigned long counter_local = 0;
+  SU2_OMP_MASTER
+  ErrorCounter = 0;
 
-  unsigned long iEdge, iPoint, jPoint, counter_local = 0, counter_global = 0;
-  unsigned short iDim, iVar;
+  /*--- Pick one numerics object per thread. ---*/
+  CNumerics* numerics = numerics_container[CONV_TERM + omp_get_thread_num()*MAX_TERMS];
 
-  unsigned long InnerIter = config->GetInnerIter();
-  bool implicit         = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
-  bool muscl            = (config->GetMUSCL_Flow() && (iMesh == MESH_0));
-  bool limiter          = (config->GetKind_SlopeLimit_Flow() != NO_LIMITER) && (InnerIter <= config->GetLimiterIter());
-  bool van_albada       = config->GetKind_SlopeLimit_Flow() == VAN_ALBADA_EDGE;
+  /*--- Static arrays of MUSCL-reconstructed primitives (thread safety). ---*/
+  su2double Primitive_i[MAXNVAR] = {0.0}, Primitive_j[MAXNVAR] = {0.0};
+
+  /*--- Loop over edge colors. ---*/
+  for (auto color : EdgeColoring)
+  {
+  /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+  SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+  for(auto k = 0ul; k < color.size; ++k) {
 
-  /*--- Loop over all the edges ---*/
+    auto iEdge = color.indices[k];
 
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+    unsigned short iDim, iVar;
 
     /*--- Points in edge and normal vectors ---*/
 
-    iPoint = geometry->edge[iEdge]->GetNode(0); jPoint = geometry->edge[iEdge]->GetNode(1);
-    numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
+    auto iPoint = geometry->GetEdgeNode(iEdge,0);
+    auto jPoint = geometry->GetEdgeNode(iEdge,1);
+
+    numerics->SetNormal(geometry->GetEdgeNormal(iEdge));
 
     /*--- Grid movement ---*/
 
-    if (dynamic_grid)
-      numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(), geometry->node[jPoint]->GetGridVel());
+    if (dynamic_grid) {
+      const su2double *GridFlux = geometry->GetEdgeGridFlux(iEdge);
+      if (GridFlux) numerics->SetGridFlux(GridFlux);
+      else numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(), geometry->node[jPoint]->GetGridVel());
+    }
 
     /*--- Get primitive variables ---*/
 
-    V_i = nodes->GetPrimitive(iPoint); V_j = nodes->GetPrimitive(jPoint);
-    S_i = nodes->GetSecondary(iPoint); S_j = nodes->GetSecondary(jPoint);
+    auto V_i = nodes->GetPrimitive(iPoint); auto V_j = nodes->GetPrimitive(jPoint);
+    auto S_i = nodes->GetSecondary(iPoint); auto S_j = nodes->GetSecondary(jPoint);
 
     /*--- High order reconstruction using MUSCL strategy ---*/
 
     if (muscl) {
 
-      for (iDim = 0; iDim < nDim; iDim++) {
-        Vector_i[iDim] = 0.5*(geometry->node[jPoint]->GetCoord(iDim) - geometry->node[iPoint]->GetCoord(iDim));
-        Vector_j[iDim] = 0.5*(geometry->node[iPoint]->GetCoord(iDim) - geometry->node[jPoint]->GetCoord(iDim));
-      }
+      su2double Vector_ij[MAXNDIM] = {0.0};
+      geometry->GetEdgeHalfVector(iEdge, Vector_ij);
 
-      Gradient_i = nodes->GetGradient_Reconstruction(iPoint);
-      Gradient_j = nodes->GetGradient_Reconstruction(jPoint);
+      auto Gradient_i = nodes->GetGradient_Reconstruction(iPoint);
+      auto Gradient_j = nodes->GetGradient_Reconstruction(jPoint);
+
+      su2double *Limiter_i = nullptr, *Limiter_j = nullptr;
 
       if (limiter) {
         Limiter_i = nodes->GetLimiter_Primitive(iPoint);
@@ -1923,10 +2116,10 @@ void CIncEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_cont
       }
 
       for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-        Project_Grad_i = 0.0; Project_Grad_j = 0.0;
+        su2double Project_Grad_i = 0.0, Project_Grad_j = 0.0;
         for (iDim = 0; iDim < nDim; iDim++) {
-          Project_Grad_i += Vector_i[iDim]*Gradient_i[iVar][iDim];
-          Project_Grad_j += Vector_j[iDim]*Gradient_j[iVar][iDim];
+          Project_Grad_i += Vector_ij[iDim]*Gradient_i[iVar][iDim];
+          Project_Grad_j -= Vector_ij[iDim]*Gradient_j[iVar][iDim];
         }
         if (limiter) {
           if (van_albada){
@@ -1954,41 +2147,28 @@ void CIncEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_cont
        incompressible flow, only the temperature and density need to be
        checked. Pressure is the dynamic pressure (can be negative). ---*/
 
-      if (config->GetEnergy_Equation()) {
+      bool bad_i = false, bad_j = false;
+
+      if (energy) {
         bool neg_temperature_i = (Primitive_i[nDim+1] < 0.0);
         bool neg_temperature_j = (Primitive_j[nDim+1] < 0.0);
 
         bool neg_density_i  = (Primitive_i[nDim+2] < 0.0);
         bool neg_density_j  = (Primitive_j[nDim+2] < 0.0);
 
-        if (neg_density_i || neg_temperature_i) {
-          nodes->SetNon_Physical(iPoint, true);
-        } else {
-          nodes->SetNon_Physical(iPoint, false);
-        }
-
-        if (neg_density_j || neg_temperature_j) {
-          nodes->SetNon_Physical(jPoint, true);
-        } else {
-          nodes->SetNon_Physical(jPoint, false);
-        }
+        nodes->SetNon_Physical(iPoint, neg_density_i || neg_temperature_i);
+        nodes->SetNon_Physical(jPoint, neg_density_j || neg_temperature_j);
 
         /* Lastly, check for existing first-order points still active
          from previous iterations. */
 
-        if (nodes->GetNon_Physical(iPoint)) {
-          counter_local++;
-          for (iVar = 0; iVar < nPrimVar; iVar++)
-            Primitive_i[iVar] = V_i[iVar];
-        }
-        if (nodes->GetNon_Physical(jPoint)) {
-          counter_local++;
-          for (iVar = 0; iVar < nPrimVar; iVar++)
-            Primitive_j[iVar] = V_j[iVar];
-        }
+        bad_i = nodes->GetNon_Physical(iPoint);
+        bad_j = nodes->GetNon_Physical(jPoint);
+
+        counter_local += bad_i+bad_j;
       }
 
-      numerics->SetPrimitive(Primitive_i, Primitive_j);
+      numerics->SetPrimitive(bad_i? V_i : Primitive_i,  bad_j? V_j : Primitive_j);
 
     } else {
 
@@ -2001,27 +2181,106 @@ void CIncEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_cont
 
     /*--- Compute the residual ---*/
 
-    auto residual = numerics->ComputeResidual(config);
+    auto residual = numerics->ComputeResidualPreacc(config);
 
-    /*--- Update residual value ---*/
+    /*--- Viscous contribution. ---*/
 
-    LinSysRes.AddBlock(iPoint, residual);
-    LinSysRes.SubtractBlock(jPoint, residual);
+    auto viscous = ViscousEdgeResidual(iEdge, geometry, solver_container,
+                                       numerics_container[VISC_TERM + omp_get_thread_num()*MAX_TERMS], config);
 
-    /*--- Set implicit Jacobians ---*/
+    /*--- Update residual value (and Jacobian) with both contributions. ---*/
 
-    if (implicit) {
-      Jacobian.UpdateBlocks(iEdge, iPoint, jPoint, residual.jacobian_i, residual.jacobian_j);
-    }
+    UpdateEdgeContribution(iEdge, iPoint, jPoint, implicit, residual.residual,
+                           residual.jacobian_i, residual.jacobian_j, viscous);
+  }
+  } // end color loop
+
+  if (ReducerStrategy) {
+    SumEdgeFluxes(geometry);
+    if (implicit)
+      Jacobian.SetDiagonalAsColumnSum();
   }
 
   /*--- Warning message about non-physical reconstructions. ---*/
 
-  if (config->GetComm_Level() == COMM_FULL) {
-    if (iMesh == MESH_0) {
-      SU2_MPI::Reduce(&counter_local, &counter_global, 1, MPI_UNSIGNED_LONG, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
-      config->SetNonphysical_Reconstr(counter_global);
+  if ((iMesh == MESH_0) && (config->GetComm_Level() == COMM_FULL)) {
+    /*--- Add counter results for all threads. ---*/
+    SU2_OMP_ATOMIC
+    ErrorCounter += counter_local;
+    SU2_OMP_BARRIER
+
+    /*--- Add counter results for all ranks. ---*/
+    SU2_OMP_MASTER
+    {
+      counter_local = ErrorCounter;
+      SU2_MPI::Reduce(&counter_local, &ErrorCounter, 1, MPI_UNSIGNED_LONG, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
+      config->SetNonphysical_Reconstr(ErrorCounter);
     }
+    SU2_OMP_BARRIER
+  }
+
+}
+
+void CIncEulerSolver::SumEdgeFluxes(CGeometry* geometry) {
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+
+    LinSysRes.SetBlock_Zero(iPoint);
+
+    for (unsigned short iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); ++iNeigh) {
+
+      auto iEdge = geometry->node[iPoint]->GetEdge(iNeigh);
+
+      if (iPoint == geometry->GetEdgeNode(iEdge,0))
+        LinSysRes.AddBlock(iPoint, EdgeFluxes.GetBlock(iEdge));
+      else
+        LinSysRes.SubtractBlock(iPoint, EdgeFluxes.GetBlock(iEdge));
+    }
+  }
+
+}
+
+void CIncEulerSolver::UpdateEdgeContribution(unsigned long iEdge, unsigned long iPoint, unsigned long jPoint,
+                                             bool implicit, const su2double *flux, const su2double* const* jacobian_i,
+                                             const su2double* const* jacobian_j, const CNumerics::ResidualType<>& viscous) {
+
+  /*--- Sum of the contributions (thread-local storage), only if there is a viscous one. ---*/
+
+  su2double Flux[MAXNVAR], JacobianRows_i[MAXNVAR*MAXNVAR], JacobianRows_j[MAXNVAR*MAXNVAR];
+  su2double *Jacobian_i[MAXNVAR], *Jacobian_j[MAXNVAR];
+
+  if (viscous.residual != nullptr) {
+    for (unsigned short iVar = 0; iVar < nVar; iVar++)
+      Flux[iVar] = flux[iVar] - viscous.residual[iVar];
+    flux = Flux;
+
+    if (implicit) {
+      for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+        Jacobian_i[iVar] = &JacobianRows_i[iVar*nVar];
+        Jacobian_j[iVar] = &JacobianRows_j[iVar*nVar];
+        for (unsigned short jVar = 0; jVar < nVar; jVar++) {
+          Jacobian_i[iVar][jVar] = jacobian_i[iVar][jVar] - viscous.jacobian_i[iVar][jVar];
+          Jacobian_j[iVar][jVar] = jacobian_j[iVar][jVar] - viscous.jacobian_j[iVar][jVar];
+        }
+      }
+      jacobian_i = Jacobian_i;
+      jacobian_j = Jacobian_j;
+    }
+  }
+
+  /*--- Update the residual and Jacobian once. ---*/
+
+  if (ReducerStrategy) {
+    EdgeFluxes.SetBlock(iEdge, flux);
+    if (implicit)
+      Jacobian.SetBlocks(iEdge, jacobian_i, jacobian_j);
+  }
+  else {
+    LinSysRes.AddBlock(iPoint, flux);
+    LinSysRes.SubtractBlock(jPoint, flux);
+    if (implicit)
+      Jacobian.UpdateBlocks(iEdge, iPoint, jPoint, jacobian_i, jacobian_j);
   }
 
 }
@@ -2029,7 +2288,8 @@ void CIncEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_cont
 void CIncEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_container,
                                       CNumerics **numerics_container, CConfig *config, unsigned short iMesh) {
 
-  CNumerics* numerics = numerics_container[SOURCE_FIRST_TERM];
+  /*--- Pick one numerics object per thread. ---*/
+  CNumerics* numerics = numerics_container[SOURCE_FIRST_TERM + omp_get_thread_num()*MAX_TERMS];
 
   unsigned short iVar;
   unsigned long iPoint;
@@ -2046,7 +2306,7 @@ void CIncEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_cont
   if (body_force) {
 
     /*--- Loop over all points ---*/
-
+    SU2_OMP_FOR_STAT(omp_chunk_size)
     for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
       /*--- Load the conservative variables ---*/
@@ -2065,7 +2325,7 @@ void CIncEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_cont
 
       /*--- Compute the rotating frame source residual ---*/
 
-      auto residual = numerics->ComputeResidual(config);
+      auto residual = numerics->ComputeResidualPreacc(config);
 
       /*--- Add the source residual to the total ---*/
 
@@ -2077,7 +2337,7 @@ void CIncEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_cont
   if (boussinesq) {
 
     /*--- Loop over all points ---*/
-
+    SU2_OMP_FOR_STAT(omp_chunk_size)
     for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
       /*--- Load the conservative variables ---*/
@@ -2096,7 +2356,7 @@ void CIncEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_cont
 
       /*--- Compute the rotating frame source residual ---*/
 
-      auto residual = numerics->ComputeResidual(config);
+      auto residual = numerics->ComputeResidualPreacc(config);
 
       /*--- Add the source residual to the total ---*/
 
@@ -2108,7 +2368,7 @@ void CIncEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_cont
   if (rotating_frame) {
 
     /*--- Loop over all points ---*/
-
+    SU2_OMP_FOR_DYN(omp_chunk_size)
     for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
       /*--- Load the conservative variables ---*/
@@ -2125,7 +2385,7 @@ void CIncEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_cont
 
       /*--- Compute the rotating frame source residual ---*/
 
-      auto residual = numerics->ComputeResidual(config);
+      auto residual = numerics->ComputeResidualPreacc(config);
 
       /*--- Add the source residual to the total ---*/
 
@@ -2144,6 +2404,7 @@ void CIncEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_cont
 
     if (viscous) {
 
+      SU2_OMP_FOR_STAT(omp_chunk_size)
       for (iPoint = 0; iPoint < nPoint; iPoint++) {
 
         su2double yCoord          = geometry->node[iPoint]->GetCoord(1);
@@ -2172,7 +2433,7 @@ void CIncEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_cont
     }
 
     /*--- loop over points ---*/
-
+    SU2_OMP_FOR_DYN(omp_chunk_size)
     for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
       /*--- Conservative variables w/o reconstruction ---*/
@@ -2209,7 +2470,7 @@ void CIncEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_cont
 
       /*--- Compute Source term Residual ---*/
 
-      auto residual = numerics->ComputeResidual(config);
+      auto residual = numerics->ComputeResidualPreacc(config);
 
       /*--- Add Residual ---*/
 
@@ -2225,8 +2486,9 @@ void CIncEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_cont
 
   if (radiation) {
 
-    CNumerics* second_numerics = numerics_container[SOURCE_SECOND_TERM];
+    CNumerics* second_numerics = numerics_container[SOURCE_SECOND_TERM + omp_get_thread_num()*MAX_TERMS];
 
+    SU2_OMP_FOR_STAT(omp_chunk_size)
     for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
       /*--- Store the radiation source term ---*/
@@ -2239,7 +2501,7 @@ void CIncEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_cont
 
       /*--- Compute the residual ---*/
 
-      auto residual = second_numerics->ComputeResidual(config);
+      auto residual = second_numerics->ComputeResidualPreacc(config);
 
       /*--- Add Residual ---*/
 
@@ -2275,6 +2537,7 @@ void CIncEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_cont
       if (config->GetTime_Marching()) time = config->GetPhysicalTime();
 
       /*--- Loop over points ---*/
+      SU2_OMP_FOR_DYN(omp_chunk_size)
       for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
         /*--- Get control volume size. ---*/
@@ -2314,252 +2577,227 @@ void CIncEulerSolver::Source_Template(CGeometry *geometry, CSolver **solver_cont
 
 void CIncEulerSolver::SetMax_Eigenvalue(CGeometry *geometry, CConfig *config) {
 
-  su2double *Normal, Area, Mean_SoundSpeed = 0.0, Mean_ProjVel = 0.0,
-  Mean_BetaInc2, Lambda, ProjVel, ProjVel_i, ProjVel_j, *GridVel, *GridVel_i, *GridVel_j;
-
-  unsigned long iEdge, iVertex, iPoint, jPoint;
-  unsigned short iDim, iMarker;
+  /*--- Loop domain points. ---*/
 
-  /*--- Set maximum inviscid eigenvalue to zero, and compute sound speed ---*/
+  SU2_OMP_FOR_DYN(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; ++iPoint) {
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    /*--- Set eigenvalues to zero. ---*/
     nodes->SetLambda(iPoint,0.0);
-  }
-
-  /*--- Loop interior edges ---*/
-
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
 
-    /*--- Point identification, Normal vector and area ---*/
+    /*--- Loop over the neighbors of point i. ---*/
+    for (unsigned short iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); ++iNeigh)
+    {
+      auto jPoint = geometry->node[iPoint]->GetPoint(iNeigh);
 
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
+      auto iEdge = geometry->node[iPoint]->GetEdge(iNeigh);
+      auto Normal = geometry->edge[iEdge]->GetNormal();
+      su2double Area = 0.0;
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) Area += pow(Normal[iDim],2);
+      Area = sqrt(Area);
 
-    Normal = geometry->edge[iEdge]->GetNormal();
-    Area = 0.0;
-    for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim];
-    Area = sqrt(Area);
+      /*--- Mean Values ---*/
 
-    /*--- Mean Values ---*/
+      su2double Mean_ProjVel    = 0.5 * (nodes->GetProjVel(iPoint,Normal) + nodes->GetProjVel(jPoint,Normal));
+      su2double Mean_BetaInc2   = 0.5 * (nodes->GetBetaInc2(iPoint)      + nodes->GetBetaInc2(jPoint));
+      su2double Mean_SoundSpeed = sqrt(Mean_BetaInc2*Area*Area);
 
-    Mean_ProjVel    = 0.5 * (nodes->GetProjVel(iPoint,Normal) + nodes->GetProjVel(jPoint,Normal));
-    Mean_BetaInc2   = 0.5 * (nodes->GetBetaInc2(iPoint)      + nodes->GetBetaInc2(jPoint));
-    Mean_SoundSpeed = sqrt(Mean_BetaInc2*Area*Area);
+      /*--- Adjustment for grid movement ---*/
 
-    /*--- Adjustment for grid movement ---*/
+      if (dynamic_grid) {
+        const su2double *GridFlux = geometry->GetEdgeGridFlux(iEdge);
+        if (GridFlux) Mean_ProjVel -= *GridFlux;
+        else {
+          const su2double *GridVel_i = geometry->node[iPoint]->GetGridVel();
+          const su2double *GridVel_j = geometry->node[jPoint]->GetGridVel();
 
-    if (dynamic_grid) {
-      GridVel_i = geometry->node[iPoint]->GetGridVel();
-      GridVel_j = geometry->node[jPoint]->GetGridVel();
-      ProjVel_i = 0.0; ProjVel_j =0.0;
-      for (iDim = 0; iDim < nDim; iDim++) {
-        ProjVel_i += GridVel_i[iDim]*Normal[iDim];
-        ProjVel_j += GridVel_j[iDim]*Normal[iDim];
+          for (unsigned short iDim = 0; iDim < nDim; iDim++)
+            Mean_ProjVel -= 0.5 * (GridVel_i[iDim] + GridVel_j[iDim]) * Normal[iDim];
+        }
       }
-      Mean_ProjVel -= 0.5 * (ProjVel_i + ProjVel_j);
-    }
 
-    /*--- Inviscid contribution ---*/
+      /*--- Inviscid contribution ---*/
 
-    Lambda = fabs(Mean_ProjVel) + Mean_SoundSpeed;
-    if (geometry->node[iPoint]->GetDomain()) nodes->AddLambda(iPoint,Lambda);
-    if (geometry->node[jPoint]->GetDomain()) nodes->AddLambda(jPoint,Lambda);
+      su2double Lambda = fabs(Mean_ProjVel) + Mean_SoundSpeed;
+      nodes->AddLambda(iPoint, Lambda);
+    }
 
   }
 
   /*--- Loop boundary edges ---*/
 
-  for (iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
+  for (unsigned short iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
     if ((config->GetMarker_All_KindBC(iMarker) != INTERNAL_BOUNDARY) &&
         (config->GetMarker_All_KindBC(iMarker) != PERIODIC_BOUNDARY)) {
-    for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+    for (unsigned long iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
 
       /*--- Point identification, Normal vector and area ---*/
 
-      iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-      Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
-      Area = 0.0;
-      for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim];
+      auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+      auto Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+      su2double Area = 0.0;
+      for (unsigned short iDim = 0; iDim < nDim; iDim++)
+        Area += pow(Normal[iDim],2);
       Area = sqrt(Area);
 
       /*--- Mean Values ---*/
 
-      Mean_ProjVel    = nodes->GetProjVel(iPoint,Normal);
-      Mean_BetaInc2   = nodes->GetBetaInc2(iPoint);
-      Mean_SoundSpeed = sqrt(Mean_BetaInc2*Area*Area);
+      su2double Mean_ProjVel    = nodes->GetProjVel(iPoint,Normal);
+      su2double Mean_BetaInc2   = nodes->GetBetaInc2(iPoint);
+      su2double Mean_SoundSpeed = sqrt(Mean_BetaInc2*Area*Area);
 
       /*--- Adjustment for grid movement ---*/
 
       if (dynamic_grid) {
-        GridVel = geometry->node[iPoint]->GetGridVel();
-        ProjVel = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++)
-          ProjVel += GridVel[iDim]*Normal[iDim];
-        Mean_ProjVel -= ProjVel;
+        auto GridVel = geometry->node[iPoint]->GetGridVel();
+        for (unsigned short iDim = 0; iDim < nDim; iDim++)
+          Mean_ProjVel -= GridVel[iDim]*Normal[iDim];
       }
 
       /*--- Inviscid contribution ---*/
 
-      Lambda = fabs(Mean_ProjVel) + Mean_SoundSpeed;
+      su2double Lambda = fabs(Mean_ProjVel) + Mean_SoundSpeed;
       if (geometry->node[iPoint]->GetDomain()) {
         nodes->AddLambda(iPoint,Lambda);
       }
-
     }
     }
   }
 
-  /*--- Correct the eigenvalue values across any periodic boundaries. ---*/
+  SU2_OMP_MASTER
+  {
+    /*--- Correct the eigenvalue values across any periodic boundaries. ---*/
 
-  for (unsigned short iPeriodic = 1; iPeriodic <= config->GetnMarker_Periodic()/2; iPeriodic++) {
-    InitiatePeriodicComms(geometry, config, iPeriodic, PERIODIC_MAX_EIG);
-    CompletePeriodicComms(geometry, config, iPeriodic, PERIODIC_MAX_EIG);
-  }
+    for (unsigned short iPeriodic = 1; iPeriodic <= config->GetnMarker_Periodic()/2; iPeriodic++) {
+      InitiatePeriodicComms(geometry, config, iPeriodic, PERIODIC_MAX_EIG);
+      CompletePeriodicComms(geometry, config, iPeriodic, PERIODIC_MAX_EIG);
+    }
 
-  /*--- MPI parallelization ---*/
+    /*--- MPI parallelization ---*/
 
-  InitiateComms(geometry, config, MAX_EIGENVALUE);
-  CompleteComms(geometry, config, MAX_EIGENVALUE);
+    InitiateComms(geometry, config, MAX_EIGENVALUE);
+    CompleteComms(geometry, config, MAX_EIGENVALUE);
+  }
+  SU2_OMP_BARRIER
 
 }
 
 void CIncEulerSolver::SetUndivided_Laplacian(CGeometry *geometry, CConfig *config) {
 
-  unsigned long iPoint, jPoint, iEdge;
-  su2double *Diff;
-  unsigned short iVar;
-  bool boundary_i, boundary_j;
-
-  Diff = new su2double[nVar];
+  /*--- Loop domain points. ---*/
 
-  nodes->SetUnd_LaplZero();
+  SU2_OMP_FOR_DYN(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; ++iPoint) {
 
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+    const bool boundary_i = geometry->node[iPoint]->GetPhysicalBoundary();
 
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
+    /*--- Initialize. ---*/
+    for (unsigned short iVar = 0; iVar < nVar; iVar++)
+      nodes->SetUnd_Lapl(iPoint, iVar, 0.0);
 
-    /*--- Solution differences ---*/
-
-    for (iVar = 0; iVar < nVar; iVar++)
-      Diff[iVar] = nodes->GetSolution(iPoint,iVar) - nodes->GetSolution(jPoint,iVar);
+    /*--- Loop over the neighbors of point i. ---*/
+    for (unsigned short iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); ++iNeigh)
+    {
+      auto jPoint = geometry->node[iPoint]->GetPoint(iNeigh);
+      bool boundary_j = geometry->node[jPoint]->GetPhysicalBoundary();
 
-    boundary_i = geometry->node[iPoint]->GetPhysicalBoundary();
-    boundary_j = geometry->node[jPoint]->GetPhysicalBoundary();
+      /*--- If iPoint is boundary it only takes contributions from other boundary points. ---*/
+      if (boundary_i && !boundary_j) continue;
 
-    /*--- Both points inside the domain, or both in the boundary ---*/
+      /*--- Add solution differences. ---*/
 
-    if ((!boundary_i && !boundary_j) || (boundary_i && boundary_j)) {
-      if (geometry->node[iPoint]->GetDomain()) nodes->SubtractUnd_Lapl(iPoint,Diff);
-      if (geometry->node[jPoint]->GetDomain()) nodes->AddUnd_Lapl(jPoint,Diff);
+      for (unsigned short iVar = 0; iVar < nVar; iVar++)
+        nodes->AddUnd_Lapl(iPoint, iVar, nodes->GetSolution(jPoint,iVar)-nodes->GetSolution(iPoint,iVar));
     }
-
-    /*--- iPoint inside the domain, jPoint on the boundary ---*/
-
-    if (!boundary_i && boundary_j)
-      if (geometry->node[iPoint]->GetDomain()) nodes->SubtractUnd_Lapl(iPoint,Diff);
-
-    /*--- jPoint inside the domain, iPoint on the boundary ---*/
-
-    if (boundary_i && !boundary_j)
-      if (geometry->node[jPoint]->GetDomain()) nodes->AddUnd_Lapl(jPoint,Diff);
-
   }
 
-  /*--- Correct the Laplacian values across any periodic boundaries. ---*/
-
-  for (unsigned short iPeriodic = 1; iPeriodic <= config->GetnMarker_Periodic()/2; iPeriodic++) {
-    InitiatePeriodicComms(geometry, config, iPeriodic, PERIODIC_LAPLACIAN);
-    CompletePeriodicComms(geometry, config, iPeriodic, PERIODIC_LAPLACIAN);
-  }
+  SU2_OMP_MASTER
+  {
+    /*--- Correct the Laplacian values across any periodic boundaries. ---*/
 
-  /*--- MPI parallelization ---*/
+    for (unsigned short iPeriodic = 1; iPeriodic <= config->GetnMarker_Periodic()/2; iPeriodic++) {
+      InitiatePeriodicComms(geometry, config, iPeriodic, PERIODIC_LAPLACIAN);
+      CompletePeriodicComms(geometry, config, iPeriodic, PERIODIC_LAPLACIAN);
+    }
 
-  InitiateComms(geometry, config, UNDIVIDED_LAPLACIAN);
-  CompleteComms(geometry, config, UNDIVIDED_LAPLACIAN);
+    /*--- MPI parallelization ---*/
 
-  delete [] Diff;
+    InitiateComms(geometry, config, UNDIVIDED_LAPLACIAN);
+    CompleteComms(geometry, config, UNDIVIDED_LAPLACIAN);
+  }
+  SU2_OMP_BARRIER
 
 }
 
 void CIncEulerSolver::SetCentered_Dissipation_Sensor(CGeometry *geometry, CConfig *config) {
 
-  unsigned long iEdge, iPoint, jPoint;
-  su2double Pressure_i = 0.0, Pressure_j = 0.0;
-  bool boundary_i, boundary_j;
+  /*--- We can access memory more efficiently if there are no periodic boundaries. ---*/
 
-  /*--- Reset variables to store the undivided pressure ---*/
+  const bool isPeriodic = (config->GetnMarker_Periodic() > 0);
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-    iPoint_UndLapl[iPoint] = 0.0;
-    jPoint_UndLapl[iPoint] = 0.0;
-  }
+  /*--- Loop domain points. ---*/
 
-  /*--- Evaluate the pressure sensor ---*/
+  SU2_OMP_FOR_DYN(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; ++iPoint) {
 
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
+    const bool boundary_i = geometry->node[iPoint]->GetPhysicalBoundary();
 
     /*--- Get the pressure, or density for incompressible solvers ---*/
 
-    Pressure_i = nodes->GetDensity(iPoint);
-    Pressure_j = nodes->GetDensity(jPoint);
-
-    boundary_i = geometry->node[iPoint]->GetPhysicalBoundary();
-    boundary_j = geometry->node[jPoint]->GetPhysicalBoundary();
+    const su2double Pressure_i = nodes->GetDensity(iPoint);
 
-    /*--- Both points inside the domain, or both on the boundary ---*/
+    iPoint_UndLapl[iPoint] = 0.0;
+    jPoint_UndLapl[iPoint] = 0.0;
 
-    if ((!boundary_i && !boundary_j) || (boundary_i && boundary_j)) {
+    /*--- Loop over the neighbors of point i. ---*/
+    for (unsigned short iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); ++iNeigh)
+    {
+      auto jPoint = geometry->node[iPoint]->GetPoint(iNeigh);
+      bool boundary_j = geometry->node[jPoint]->GetPhysicalBoundary();
 
-      if (geometry->node[iPoint]->GetDomain()) {
-        iPoint_UndLapl[iPoint] += (Pressure_j - Pressure_i);
-        jPoint_UndLapl[iPoint] += (Pressure_i + Pressure_j);
-      }
+      /*--- If iPoint is boundary it only takes contributions from other boundary points. ---*/
+      if (boundary_i && !boundary_j) continue;
 
-      if (geometry->node[jPoint]->GetDomain()) {
-        iPoint_UndLapl[jPoint] += (Pressure_i - Pressure_j);
-        jPoint_UndLapl[jPoint] += (Pressure_i + Pressure_j);
-      }
+      su2double Pressure_j = nodes->GetDensity(jPoint);
 
+      /*--- Dissipation sensor, add pressure difference and pressure sum. ---*/
+      iPoint_UndLapl[iPoint] += Pressure_j - Pressure_i;
+      jPoint_UndLapl[iPoint] += Pressure_j + Pressure_i;
     }
 
-    /*--- iPoint inside the domain, jPoint on the boundary ---*/
-
-    if (!boundary_i && boundary_j)
-      if (geometry->node[iPoint]->GetDomain()) {
-        iPoint_UndLapl[iPoint] += (Pressure_j - Pressure_i);
-        jPoint_UndLapl[iPoint] += (Pressure_i + Pressure_j);
-      }
+    if (!isPeriodic)
+      nodes->SetSensor(iPoint, fabs(iPoint_UndLapl[iPoint]) / jPoint_UndLapl[iPoint]);
+  }
 
-    /*--- jPoint inside the domain, iPoint on the boundary ---*/
+  if (isPeriodic) {
+    /*--- Correct the sensor values across any periodic boundaries. ---*/
 
-    if (boundary_i && !boundary_j)
-      if (geometry->node[jPoint]->GetDomain()) {
-        iPoint_UndLapl[jPoint] += (Pressure_i - Pressure_j);
-        jPoint_UndLapl[jPoint] += (Pressure_i + Pressure_j);
+    SU2_OMP_MASTER
+    {
+      for (unsigned short iPeriodic = 1; iPeriodic <= config->GetnMarker_Periodic()/2; iPeriodic++) {
+        InitiatePeriodicComms(geometry, config, iPeriodic, PERIODIC_SENSOR);
+        CompletePeriodicComms(geometry, config, iPeriodic, PERIODIC_SENSOR);
       }
+    }
+    SU2_OMP_BARRIER
 
-  }
-
-  /*--- Correct the sensor values across any periodic boundaries. ---*/
+    /*--- Set final pressure switch for each point ---*/
 
-  for (unsigned short iPeriodic = 1; iPeriodic <= config->GetnMarker_Periodic()/2; iPeriodic++) {
-    InitiatePeriodicComms(geometry, config, iPeriodic, PERIODIC_SENSOR);
-    CompletePeriodicComms(geometry, config, iPeriodic, PERIODIC_SENSOR);
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
+      nodes->SetSensor(iPoint, fabs(iPoint_UndLapl[iPoint]) / jPoint_UndLapl[iPoint]);
   }
 
-  /*--- Set pressure switch for each point ---*/
-
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
-    nodes->SetSensor(iPoint,fabs(iPoint_UndLapl[iPoint]) / jPoint_UndLapl[iPoint]);
-
-  /*--- MPI parallelization ---*/
+  SU2_OMP_MASTER
+  {
+    /*--- MPI parallelization ---*/
 
-  InitiateComms(geometry, config, SENSOR);
-  CompleteComms(geometry, config, SENSOR);
+    InitiateComms(geometry, config, SENSOR);
+    CompleteComms(geometry, config, SENSOR);
+  }
+  SU2_OMP_BARRIER
 
 }
 
@@ -3333,219 +3571,326 @@ void CIncEulerSolver::Momentum_Forces(CGeometry *geometry, CConfig *config) {
 }
 
 void CIncEulerSolver::ExplicitRK_Iteration(CGeometry *geometry, CSolver **solver_container,
-                                        CConfig *config, unsigned short iRKStep) {
+                                           CConfig *config, unsigned short iRKStep) {
 
-  su2double *Residual, *Res_TruncError, Vol, Delta, Res;
-  unsigned short iVar, jVar;
-  unsigned long iPoint;
+  const su2double RK_AlphaCoeff = config->Get_Alpha_RKStep(iRKStep);
+  const bool adjoint = config->GetContinuous_Adjoint();
 
-  su2double RK_AlphaCoeff = config->Get_Alpha_RKStep(iRKStep);
-  bool adjoint = config->GetContinuous_Adjoint();
+  /*--- Local matrix for preconditioning. ---*/
+  su2double** Preconditioner = new su2double* [nVar];
+  for(unsigned short iVar = 0; iVar < nVar; ++iVar)
+    Preconditioner[iVar] = new su2double [nVar];
 
-  for (iVar = 0; iVar < nVar; iVar++) {
+  /*--- Set shared residual variables to 0 and declare
+   *    local ones for current thread to work on. ---*/
+
+  SU2_OMP_MASTER
+  for (unsigned short iVar = 0; iVar < nVar; iVar++) {
     SetRes_RMS(iVar, 0.0);
     SetRes_Max(iVar, 0.0, 0);
   }
+  SU2_OMP_BARRIER
+
+  su2double resMax[MAXNVAR] = {0.0}, resRMS[MAXNVAR] = {0.0};
+  const su2double* coordMax[MAXNVAR] = {nullptr};
+  unsigned long idxMax[MAXNVAR] = {0};
 
   /*--- Update the solution ---*/
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-    Vol = (geometry->node[iPoint]->GetVolume() +
-           geometry->node[iPoint]->GetPeriodicVolume());
-    Delta = nodes->GetDelta_Time(iPoint) / Vol;
+  if (!adjoint) {
+    SU2_OMP(for schedule(static,omp_chunk_size) nowait)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
-    Res_TruncError = nodes->GetResTruncError(iPoint);
-    Residual = LinSysRes.GetBlock(iPoint);
+      su2double Vol = (geometry->node[iPoint]->GetVolume() +
+                       geometry->node[iPoint]->GetPeriodicVolume());
+      su2double Delta = nodes->GetDelta_Time(iPoint) / Vol;
 
-    if (!adjoint) {
-      SetPreconditioner(config, iPoint);
-      for (iVar = 0; iVar < nVar; iVar ++ ) {
-        Res = 0.0;
-        for (jVar = 0; jVar < nVar; jVar ++ )
+      const su2double* Res_TruncError = nodes->GetResTruncError(iPoint);
+      const su2double* Residual = LinSysRes.GetBlock(iPoint);
+
+      SetPreconditioner(config, iPoint, 1.0, Preconditioner);
+
+      for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+        su2double Res = 0.0;
+        for (unsigned short jVar = 0; jVar < nVar; jVar++)
           Res += Preconditioner[iVar][jVar]*(Residual[jVar] + Res_TruncError[jVar]);
+
         nodes->AddSolution(iPoint,iVar, -Res*Delta*RK_AlphaCoeff);
-        AddRes_RMS(iVar, Res*Res);
-        AddRes_Max(iVar, fabs(Res), geometry->node[iPoint]->GetGlobalIndex(), geometry->node[iPoint]->GetCoord());
+
+        resRMS[iVar] += Res*Res;
+        if (fabs(Res) > resMax[iVar]) {
+          resMax[iVar] = fabs(Res);
+          idxMax[iVar] = iPoint;
+          coordMax[iVar] = geometry->node[iPoint]->GetCoord();
+        }
       }
     }
+    SU2_OMP_CRITICAL
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      AddRes_RMS(iVar, resRMS[iVar]);
+      AddRes_Max(iVar, resMax[iVar], geometry->node[idxMax[iVar]]->GetGlobalIndex(), coordMax[iVar]);
+    }
   }
 
-  /*--- MPI solution ---*/
+  /*--- Free local preconditioner. ---*/
+  for(unsigned short iVar = 0; iVar < nVar; ++iVar)
+    delete [] Preconditioner[iVar];
+  delete [] Preconditioner;
 
-  InitiateComms(geometry, config, SOLUTION);
-  CompleteComms(geometry, config, SOLUTION);
+  SU2_OMP_BARRIER
 
-  /*--- Compute the root mean square residual ---*/
+  SU2_OMP_MASTER
+  {
+    /*--- MPI solution ---*/
 
-  SetResidual_RMS(geometry, config);
+    InitiateComms(geometry, config, SOLUTION);
+    CompleteComms(geometry, config, SOLUTION);
 
-  /*--- For verification cases, compute the global error metrics. ---*/
+    /*--- Compute the root mean square residual ---*/
 
-  ComputeVerificationError(geometry, config);
+    SetResidual_RMS(geometry, config);
+
+    /*--- For verification cases, compute the global error metrics. ---*/
+
+    ComputeVerificationError(geometry, config);
+  }
+  SU2_OMP_BARRIER
 
 }
 
 void CIncEulerSolver::ExplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
 
-  su2double *local_Residual, *local_Res_TruncError, Vol, Delta, Res;
-  unsigned short iVar, jVar;
-  unsigned long iPoint;
+  const bool adjoint = config->GetContinuous_Adjoint();
 
-  bool adjoint = config->GetContinuous_Adjoint();
+  /*--- Local matrix for preconditioning. ---*/
+  su2double** Preconditioner = new su2double* [nVar];
+  for(unsigned short iVar = 0; iVar < nVar; ++iVar)
+    Preconditioner[iVar] = new su2double [nVar];
 
-  for (iVar = 0; iVar < nVar; iVar++) {
+  /*--- Set shared residual variables to 0 and declare
+   *    local ones for current thread to work on. ---*/
+
+  SU2_OMP_MASTER
+  for (unsigned short iVar = 0; iVar < nVar; iVar++) {
     SetRes_RMS(iVar, 0.0);
     SetRes_Max(iVar, 0.0, 0);
   }
+  SU2_OMP_BARRIER
+
+  su2double resMax[MAXNVAR] = {0.0}, resRMS[MAXNVAR] = {0.0};
+  const su2double* coordMax[MAXNVAR] = {nullptr};
+  unsigned long idxMax[MAXNVAR] = {0};
 
   /*--- Update the solution ---*/
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-    Vol = (geometry->node[iPoint]->GetVolume() +
-           geometry->node[iPoint]->GetPeriodicVolume());
-    Delta = nodes->GetDelta_Time(iPoint) / Vol;
+  if (!adjoint) {
+    SU2_OMP(for schedule(static,omp_chunk_size) nowait)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+
+      su2double Vol = (geometry->node[iPoint]->GetVolume() +
+                       geometry->node[iPoint]->GetPeriodicVolume());
+      su2double Delta = nodes->GetDelta_Time(iPoint) / Vol;
 
-    local_Res_TruncError = nodes->GetResTruncError(iPoint);
-    local_Residual = LinSysRes.GetBlock(iPoint);
+      const su2double* Res_TruncError = nodes->GetResTruncError(iPoint);
+      const su2double* Residual = LinSysRes.GetBlock(iPoint);
 
+      SetPreconditioner(config, iPoint, 1.0, Preconditioner);
+
+      for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+        su2double Res = 0.0;
+        for (unsigned short jVar = 0; jVar < nVar; jVar++)
+          Res += Preconditioner[iVar][jVar]*(Residual[jVar] + Res_TruncError[jVar]);
 
-    if (!adjoint) {
-      SetPreconditioner(config, iPoint);
-      for (iVar = 0; iVar < nVar; iVar ++ ) {
-        Res = 0.0;
-        for (jVar = 0; jVar < nVar; jVar ++ )
-          Res += Preconditioner[iVar][jVar]*(local_Residual[jVar] + local_Res_TruncError[jVar]);
         nodes->AddSolution(iPoint,iVar, -Res*Delta);
-        AddRes_RMS(iVar, Res*Res);
-        AddRes_Max(iVar, fabs(Res), geometry->node[iPoint]->GetGlobalIndex(), geometry->node[iPoint]->GetCoord());
+
+        resRMS[iVar] += Res*Res;
+        if (fabs(Res) > resMax[iVar]) {
+          resMax[iVar] = fabs(Res);
+          idxMax[iVar] = iPoint;
+          coordMax[iVar] = geometry->node[iPoint]->GetCoord();
+        }
       }
     }
+    SU2_OMP_CRITICAL
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      AddRes_RMS(iVar, resRMS[iVar]);
+      AddRes_Max(iVar, resMax[iVar], geometry->node[idxMax[iVar]]->GetGlobalIndex(), coordMax[iVar]);
+    }
   }
 
-  /*--- MPI solution ---*/
+  /*--- Free local preconditioner. ---*/
+  for(unsigned short iVar = 0; iVar < nVar; ++iVar)
+    delete [] Preconditioner[iVar];
+  delete [] Preconditioner;
 
-  InitiateComms(geometry, config, SOLUTION);
-  CompleteComms(geometry, config, SOLUTION);
+  SU2_OMP_BARRIER
 
-  /*--- Compute the root mean square residual ---*/
+  SU2_OMP_MASTER
+  {
+    /*--- MPI solution ---*/
 
-  SetResidual_RMS(geometry, config);
+    InitiateComms(geometry, config, SOLUTION);
+    CompleteComms(geometry, config, SOLUTION);
 
-  /*--- For verification cases, compute the global error metrics. ---*/
+    /*--- Compute the root mean square residual ---*/
 
-  ComputeVerificationError(geometry, config);
+    SetResidual_RMS(geometry, config);
+
+    /*--- For verification cases, compute the global error metrics. ---*/
+
+    ComputeVerificationError(geometry, config);
+  }
+  SU2_OMP_BARRIER
 
 }
 
 void CIncEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
 
-  unsigned short iVar, jVar;
-  unsigned long iPoint, total_index, IterLinSol = 0;
-  su2double Delta, *local_Res_TruncError, Vol;
+  PrepareImplicitIteration(geometry, solver_container, config);
 
-  bool adjoint = config->GetContinuous_Adjoint();
+  /*--- Solve or smooth the linear system. ---*/
 
-  /*--- Set maximum residual to zero ---*/
+  auto iter = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
+  SU2_OMP_MASTER
+  {
+    SetIterLinSolver(iter);
+    SetResLinSolver(System.GetResidual());
+  }
+  SU2_OMP_BARRIER
 
-  for (iVar = 0; iVar < nVar; iVar++) {
+  CompleteImplicitIteration(geometry, solver_container, config);
+}
+
+void CIncEulerSolver::PrepareImplicitIteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
+
+  /*--- Local matrix for preconditioning. ---*/
+  su2double** Preconditioner = new su2double* [nVar];
+  for(unsigned short iVar = 0; iVar < nVar; ++iVar)
+    Preconditioner[iVar] = new su2double [nVar];
+
+  /*--- Set shared residual variables to 0 and declare
+   *    local ones for current thread to work on. ---*/
+
+  SU2_OMP_MASTER
+  for (unsigned short iVar = 0; iVar < nVar; iVar++) {
     SetRes_RMS(iVar, 0.0);
     SetRes_Max(iVar, 0.0, 0);
   }
+  SU2_OMP_BARRIER
+
+  su2double resMax[MAXNVAR] = {0.0}, resRMS[MAXNVAR] = {0.0};
+  const su2double* coordMax[MAXNVAR] = {nullptr};
+  unsigned long idxMax[MAXNVAR] = {0};
 
   /*--- Build implicit system ---*/
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+  SU2_OMP(for schedule(static,omp_chunk_size) nowait)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
     /*--- Read the residual ---*/
 
-    local_Res_TruncError = nodes->GetResTruncError(iPoint);
+    su2double* local_Res_TruncError = nodes->GetResTruncError(iPoint);
 
     /*--- Read the volume ---*/
 
-    Vol = (geometry->node[iPoint]->GetVolume() +
-           geometry->node[iPoint]->GetPeriodicVolume());
+    su2double Vol = geometry->node[iPoint]->GetVolume() + geometry->node[iPoint]->GetPeriodicVolume();
 
     /*--- Apply the preconditioner and add to the diagonal. ---*/
 
     if (nodes->GetDelta_Time(iPoint) != 0.0) {
-      Delta = Vol / nodes->GetDelta_Time(iPoint);
-      SetPreconditioner(config, iPoint);
-      for (iVar = 0; iVar < nVar; iVar ++ ) {
-        for (jVar = 0; jVar < nVar; jVar ++ ) {
-          Preconditioner[iVar][jVar] = Delta*Preconditioner[iVar][jVar];
-        }
-      }
+      su2double Delta = Vol / nodes->GetDelta_Time(iPoint);
+      SetPreconditioner(config, iPoint, Delta, Preconditioner);
       Jacobian.AddBlock2Diag(iPoint, Preconditioner);
-    } else {
+    }
+    else {
       Jacobian.SetVal2Diag(iPoint, 1.0);
-      for (iVar = 0; iVar < nVar; iVar++) {
-        total_index = iPoint*nVar + iVar;
-        LinSysRes[total_index] = 0.0;
+      for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+        LinSysRes(iPoint,iVar) = 0.0;
         local_Res_TruncError[iVar] = 0.0;
       }
     }
 
     /*--- Right hand side of the system (-Residual) and initial guess (x = 0) ---*/
 
-    for (iVar = 0; iVar < nVar; iVar++) {
-      total_index = iPoint*nVar + iVar;
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      unsigned long total_index = iPoint*nVar + iVar;
       LinSysRes[total_index] = - (LinSysRes[total_index] + local_Res_TruncError[iVar]);
       LinSysSol[total_index] = 0.0;
-      AddRes_RMS(iVar, LinSysRes[total_index]*LinSysRes[total_index]);
-      AddRes_Max(iVar, fabs(LinSysRes[total_index]), geometry->node[iPoint]->GetGlobalIndex(), geometry->node[iPoint]->GetCoord());
-    }
 
+      su2double Res = fabs(LinSysRes[total_index]);
+      resRMS[iVar] += Res*Res;
+      if (Res > resMax[iVar]) {
+        resMax[iVar] = Res;
+        idxMax[iVar] = iPoint;
+        coordMax[iVar] = geometry->node[iPoint]->GetCoord();
+      }
+    }
+  }
+  SU2_OMP_CRITICAL
+  for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+    AddRes_RMS(iVar, resRMS[iVar]);
+    AddRes_Max(iVar, resMax[iVar], geometry->node[idxMax[iVar]]->GetGlobalIndex(), coordMax[iVar]);
   }
 
   /*--- Initialize residual and solution at the ghost points ---*/
 
-  for (iPoint = nPointDomain; iPoint < nPoint; iPoint++) {
-    for (iVar = 0; iVar < nVar; iVar++) {
-      total_index = iPoint*nVar + iVar;
-      LinSysRes[total_index] = 0.0;
-      LinSysSol[total_index] = 0.0;
-    }
-  }
+  SU2_OMP(sections nowait)
+  {
+    SU2_OMP(section)
+    for (unsigned long iPoint = nPointDomain; iPoint < nPoint; iPoint++)
+      LinSysRes.SetBlock_Zero(iPoint);
 
-  /*--- Solve or smooth the linear system ---*/
+    SU2_OMP(section)
+    for (unsigned long iPoint = nPointDomain; iPoint < nPoint; iPoint++)
+      LinSysSol.SetBlock_Zero(iPoint);
+  }
 
-  IterLinSol = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
+  /*--- Free local preconditioner. ---*/
+  for(unsigned short iVar = 0; iVar < nVar; ++iVar)
+    delete [] Preconditioner[iVar];
+  delete [] Preconditioner;
 
-  /*--- Store the value of the residual. ---*/
+  /*--- The ghost points are initialized with "nowait", the system is complete after this barrier. ---*/
 
-  SetResLinSolver(System.GetResidual());
+  SU2_OMP_BARRIER
+}
 
-  /*--- The the number of iterations of the linear solver ---*/
+void CIncEulerSolver::CompleteImplicitIteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
 
-  SetIterLinSolver(IterLinSol);
+  const bool adjoint = config->GetContinuous_Adjoint();
 
   /*--- Update solution (system written in terms of increments) ---*/
 
   if (!adjoint) {
-    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-      for (iVar = 0; iVar < nVar; iVar++) {
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      for (unsigned short iVar = 0; iVar < nVar; iVar++) {
         nodes->AddSolution(iPoint, iVar, nodes->GetUnderRelaxation(iPoint)*LinSysSol[iPoint*nVar+iVar]);
       }
     }
   }
 
-  for (unsigned short iPeriodic = 1; iPeriodic <= config->GetnMarker_Periodic()/2; iPeriodic++) {
-    InitiatePeriodicComms(geometry, config, iPeriodic, PERIODIC_IMPLICIT);
-    CompletePeriodicComms(geometry, config, iPeriodic, PERIODIC_IMPLICIT);
-  }
+  SU2_OMP_MASTER
+  {
+    for (unsigned short iPeriodic = 1; iPeriodic <= config->GetnMarker_Periodic()/2; iPeriodic++) {
+      InitiatePeriodicComms(geometry, config, iPeriodic, PERIODIC_IMPLICIT);
+      CompletePeriodicComms(geometry, config, iPeriodic, PERIODIC_IMPLICIT);
+    }
 
-  /*--- MPI solution ---*/
+    /*--- MPI solution ---*/
 
-  InitiateComms(geometry, config, SOLUTION);
-  CompleteComms(geometry, config, SOLUTION);
+    InitiateComms(geometry, config, SOLUTION);
+    CompleteComms(geometry, config, SOLUTION);
 
-  /*--- Compute the root mean square residual ---*/
+    /*--- Compute the root mean square residual ---*/
 
-  SetResidual_RMS(geometry, config);
+    SetResidual_RMS(geometry, config);
 
-  /*--- For verification cases, compute the global error metrics. ---*/
+    /*--- For verification cases, compute the global error metrics. ---*/
 
-  ComputeVerificationError(geometry, config);
+    ComputeVerificationError(geometry, config);
+  }
+  SU2_OMP_BARRIER
 
 }
 
@@ -3554,11 +3899,12 @@ void CIncEulerSolver::ComputeUnderRelaxationFactor(CSolver **solver_container, C
   /* Loop over the solution update given by relaxing the linear
    system for this nonlinear iteration. */
 
-  su2double localUnderRelaxation = 1.0;
   const su2double allowableRatio = 0.2;
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
   for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
-    localUnderRelaxation = 1.0;
+    su2double localUnderRelaxation = 1.0;
     for (unsigned short iVar = 0; iVar < nVar; iVar++) {
 
       /* We impose a limit on the maximum percentage that the
@@ -3894,48 +4240,53 @@ void CIncEulerSolver::Evaluate_ObjFunc(CConfig *config) {
 void CIncEulerSolver::SetBeta_Parameter(CGeometry *geometry, CSolver **solver_container,
                                    CConfig *config, unsigned short iMesh) {
 
-  su2double epsilon2  = config->GetBeta_Factor();
-  su2double epsilon2_default = 4.1;
-  su2double maxVel2 = 0.0;
-  su2double Beta = 1.0;
-
-  unsigned long iPoint;
+  const su2double epsilon2_default = 4.1;
 
   /*--- For now, only the finest mesh level stores the Beta for all levels. ---*/
 
   if (iMesh == MESH_0) {
 
-    for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    SU2_OMP_MASTER
+    MaxVel2 = 0.0;
+    SU2_OMP_BARRIER
 
-      /*--- Store the local maximum of the squared velocity in the field. ---*/
+    su2double maxVel2 = 0.0;
 
-      if (nodes->GetVelocity2(iPoint) > maxVel2)
-        maxVel2 = nodes->GetVelocity2(iPoint);
+    /*--- Store the local maximum of the squared velocity in the field. ---*/
 
-    }
+    SU2_OMP(for schedule(static,omp_chunk_size) nowait)
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
+      maxVel2 = max(maxVel2, nodes->GetVelocity2(iPoint));
 
-    /*--- Communicate the max globally to give a conservative estimate. ---*/
+    SU2_OMP_CRITICAL
+    MaxVel2 = max(MaxVel2, maxVel2);
 
-#ifdef HAVE_MPI
-    su2double myMaxVel2 = maxVel2; maxVel2 = 0.0;
-    SU2_MPI::Allreduce(&myMaxVel2, &maxVel2, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
-#endif
+    SU2_OMP_BARRIER
+
+    /*--- Communicate the max globally to give a conservative estimate. ---*/
 
-    Beta = max(1e-10,maxVel2);
-    config->SetMax_Vel2(Beta);
+    SU2_OMP_MASTER
+    {
+      maxVel2 = MaxVel2;
+      SU2_MPI::Allreduce(&maxVel2, &MaxVel2, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
 
+      config->SetMax_Vel2(max(1e-10, MaxVel2));
+    }
+    SU2_OMP_BARRIER
   }
 
   /*--- Allow an override if user supplies a large epsilon^2. ---*/
 
-  epsilon2 = max(epsilon2_default,epsilon2);
+  const su2double BetaInc2 = max(epsilon2_default, config->GetBeta_Factor()) * config->GetMax_Vel2();
 
-  for (iPoint = 0; iPoint < nPoint; iPoint++)
-    nodes->SetBetaInc2(iPoint,epsilon2*config->GetMax_Vel2());
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
+    nodes->SetBetaInc2(iPoint, BetaInc2);
 
 }
 
-void CIncEulerSolver::SetPreconditioner(CConfig *config, unsigned long iPoint) {
+void CIncEulerSolver::SetPreconditioner(const CConfig *config, unsigned long iPoint,
+                                        su2double delta, su2double** Preconditioner) const {
 
   unsigned short iDim, jDim;
 
@@ -4031,6 +4382,12 @@ void CIncEulerSolver::SetPreconditioner(CConfig *config, unsigned long iPoint) {
 
   }
 
+  /*--- Scale by delta (volume over time step for the implicit diagonal). ---*/
+
+  for (unsigned short iVar = 0; iVar < nVar; iVar++)
+    for (unsigned short jVar = 0; jVar < nVar; jVar++)
+      Preconditioner[iVar][jVar] *= delta;
+
 }
 
 void CIncEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics,
@@ -4108,7 +4465,7 @@ void CIncEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_contain
 
       /*--- Compute the convective residual using an upwind scheme ---*/
 
-      auto residual = conv_numerics->ComputeResidual(config);
+      auto residual = conv_numerics->ComputeResidualPreacc(config);
 
       /*--- Update residual value ---*/
 
@@ -4149,7 +4506,7 @@ void CIncEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_contain
 
         /*--- Compute and update viscous residual ---*/
 
-        auto residual = visc_numerics->ComputeResidual(config);
+        auto residual = visc_numerics->ComputeResidualPreacc(config);
         LinSysRes.SubtractBlock(iPoint, residual);
 
         /*--- Viscous Jacobian contribution for implicit integration ---*/
@@ -4360,7 +4717,7 @@ void CIncEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
 
       /*--- Compute the residual using an upwind scheme ---*/
 
-      auto residual = conv_numerics->ComputeResidual(config);
+      auto residual = conv_numerics->ComputeResidualPreacc(config);
 
       /*--- Update residual value ---*/
 
@@ -4401,7 +4758,7 @@ void CIncEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
 
         /*--- Compute and update residual ---*/
 
-        auto residual = visc_numerics->ComputeResidual(config);
+        auto residual = visc_numerics->ComputeResidualPreacc(config);
 
         LinSysRes.SubtractBlock(iPoint, residual);
 
@@ -4568,7 +4925,7 @@ void CIncEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
 
       /*--- Compute the residual using an upwind scheme ---*/
 
-      auto residual = conv_numerics->ComputeResidual(config);
+      auto residual = conv_numerics->ComputeResidualPreacc(config);
 
       /*--- Update residual value ---*/
 
@@ -4610,7 +4967,7 @@ void CIncEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
 
         /*--- Compute and update residual ---*/
 
-        auto residual = visc_numerics->ComputeResidual(config);
+        auto residual = visc_numerics->ComputeResidualPreacc(config);
 
         LinSysRes.SubtractBlock(iPoint, residual);
 
@@ -4786,7 +5143,7 @@ void CIncEulerSolver::BC_Sym_Plane(CGeometry      *geometry,
       conv_numerics->SetSecondary(nodes->GetSecondary(iPoint), nodes->GetSecondary(iPoint));
 
       /*--- Compute the residual using an upwind scheme. ---*/
-      auto residual = conv_numerics->ComputeResidual(config);
+      auto residual = conv_numerics->ComputeResidualPreacc(config);
 
       /*--- Update residual value ---*/
       LinSysRes.AddBlock(iPoint, residual);
@@ -4889,7 +5246,7 @@ void CIncEulerSolver::BC_Sym_Plane(CGeometry      *geometry,
 
         /*--- Compute and update residual. Note that the viscous shear stress tensor is computed in the
               following routine based upon the velocity-component gradients. ---*/
-        auto residual = visc_numerics->ComputeResidual(config);
+        auto residual = visc_numerics->ComputeResidualPreacc(config);
 
         LinSysRes.SubtractBlock(iPoint, residual);
 
@@ -4980,7 +5337,7 @@ void CIncEulerSolver::BC_Fluid_Interface(CGeometry *geometry, CSolver **solver_c
 
             /*--- Compute the convective residual using an upwind scheme ---*/
 
-            auto residual = conv_numerics->ComputeResidual(config);
+            auto residual = conv_numerics->ComputeResidualPreacc(config);
 
             /*--- Accumulate the residuals to compute the average ---*/
 
@@ -5039,7 +5396,7 @@ void CIncEulerSolver::BC_Fluid_Interface(CGeometry *geometry, CSolver **solver_c
 
               /*--- Compute and update residual ---*/
 
-              auto residual = visc_numerics->ComputeResidual(config);
+              auto residual = visc_numerics->ComputeResidualPreacc(config);
 
               /*--- Accumulate the residuals to compute the average ---*/
 
@@ -5176,6 +5533,16 @@ void CIncEulerSolver::SetResidual_DualTime(CGeometry *geometry, CSolver **solver
   bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
   bool energy   = config->GetEnergy_Equation();
 
+  /*--- Thread-local residual, and matrix for the preconditioned Jacobian. ---*/
+
+  su2double Residual[MAXNVAR] = {0.0};
+  su2double** Jacobian_i = nullptr;
+  if (implicit) {
+    Jacobian_i = new su2double* [nVar];
+    for (iVar = 0; iVar < nVar; iVar++)
+      Jacobian_i[iVar] = new su2double [nVar];
+  }
+
   /*--- Store the physical time step ---*/
 
   TimeStep = config->GetDelta_UnstTimeND();
@@ -5186,17 +5553,12 @@ void CIncEulerSolver::SetResidual_DualTime(CGeometry *geometry, CSolver **solver
 
     /*--- Loop over all nodes (excluding halos) ---*/
 
+    SU2_OMP_FOR_STAT(omp_chunk_size)
     for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
-      /*--- Initialize the Residual / Jacobian container to zero. ---*/
+      /*--- Initialize the Residual container to zero. ---*/
 
-      for (iVar = 0; iVar < nVar; iVar++) {
-        Residual[iVar] = 0.0;
-        if (implicit) {
-        for (jVar = 0; jVar < nVar; jVar++)
-          Jacobian_i[iVar][jVar] = 0.0;
-        }
-      }
+      for (iVar = 0; iVar < nVar; iVar++) Residual[iVar] = 0.0;
 
       /*--- Retrieve the solution at time levels n-1, n, and n+1. Note that
        we are currently iterating on U^n+1 and that U^n & U^n-1 are fixed,
@@ -5255,21 +5617,13 @@ void CIncEulerSolver::SetResidual_DualTime(CGeometry *geometry, CSolver **solver
 
       if (implicit) {
 
-        SetPreconditioner(config, iPoint);
-        for (iVar = 0; iVar < nVar; iVar++) {
-          for (jVar = 0; jVar < nVar; jVar++) {
-            Jacobian_i[iVar][jVar] = Preconditioner[iVar][jVar];
-          }
-        }
+        su2double Delta = 0.0;
+        if (config->GetTime_Marching() == DT_STEPPING_1ST)
+          Delta = Volume_nP1 / TimeStep;
+        if (config->GetTime_Marching() == DT_STEPPING_2ND)
+          Delta = (Volume_nP1*3.0)/(2.0*TimeStep);
 
-        for (iVar = 0; iVar < nVar; iVar++) {
-          for (jVar = 0; jVar < nVar; jVar++) {
-            if (config->GetTime_Marching() == DT_STEPPING_1ST)
-              Jacobian_i[iVar][jVar] *= Volume_nP1 / TimeStep;
-            if (config->GetTime_Marching() == DT_STEPPING_2ND)
-              Jacobian_i[iVar][jVar] *= (Volume_nP1*3.0)/(2.0*TimeStep);
-          }
-        }
+        SetPreconditioner(config, iPoint, Delta, Jacobian_i);
 
         if (!energy) {
             for (iVar = 0; iVar < nVar; iVar++) {
@@ -5293,8 +5647,11 @@ void CIncEulerSolver::SetResidual_DualTime(CGeometry *geometry, CSolver **solver
      equations. The GCL prevents accuracy issues caused by grid motion, i.e.
      a uniform free-stream should be preserved through a moving grid. First,
      we will loop over the edges and boundaries to compute the GCL component
-     of the dual time source term that depends on grid velocities. ---*/
+     of the dual time source term that depends on grid velocities.
+     The edge loop scatters to both points, it is done by the master thread. ---*/
 
+    SU2_OMP_MASTER
+    {
     for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
 
       /*--- Initialize the Residual / Jacobian container to zero. ---*/
@@ -5411,21 +5768,18 @@ void CIncEulerSolver::SetResidual_DualTime(CGeometry *geometry, CSolver **solver
       }
       }
     }
+    } // end SU2_OMP_MASTER
+    SU2_OMP_BARRIER
 
     /*--- Loop over all nodes (excluding halos) to compute the remainder
      of the dual time-stepping source term. ---*/
 
+    SU2_OMP_FOR_STAT(omp_chunk_size)
     for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
-      /*--- Initialize the Residual / Jacobian container to zero. ---*/
+      /*--- Initialize the Residual container to zero. ---*/
 
-      for (iVar = 0; iVar < nVar; iVar++) {
-        Residual[iVar] = 0.0;
-        if (implicit) {
-          for (jVar = 0; jVar < nVar; jVar++)
-            Jacobian_i[iVar][jVar] = 0.0;
-        }
-      }
+      for (iVar = 0; iVar < nVar; iVar++) Residual[iVar] = 0.0;
 
       /*--- Retrieve the solution at time levels n-1, n, and n+1. Note that
        we are currently iterating on U^n+1 and that U^n & U^n-1 are fixed,
@@ -5480,21 +5834,13 @@ void CIncEulerSolver::SetResidual_DualTime(CGeometry *geometry, CSolver **solver
       if (!energy) Residual[nDim+1] = 0.0;
       LinSysRes.AddBlock(iPoint, Residual);
       if (implicit) {
-        SetPreconditioner(config, iPoint);
-        for (iVar = 0; iVar < nVar; iVar++) {
-          for (jVar = 0; jVar < nVar; jVar++) {
-            Jacobian_i[iVar][jVar] = Preconditioner[iVar][jVar];
-          }
-        }
+        su2double Delta = 0.0;
+        if (config->GetTime_Marching() == DT_STEPPING_1ST)
+          Delta = Volume_nP1 / TimeStep;
+        if (config->GetTime_Marching() == DT_STEPPING_2ND)
+          Delta = (Volume_nP1*3.0)/(2.0*TimeStep);
 
-        for (iVar = 0; iVar < nVar; iVar++) {
-          for (jVar = 0; jVar < nVar; jVar++) {
-            if (config->GetTime_Marching() == DT_STEPPING_1ST)
-              Jacobian_i[iVar][jVar] *= Volume_nP1 / TimeStep;
-            if (config->GetTime_Marching() == DT_STEPPING_2ND)
-              Jacobian_i[iVar][jVar] *= (Volume_nP1*3.0)/(2.0*TimeStep);
-          }
-        }
+        SetPreconditioner(config, iPoint, Delta, Jacobian_i);
 
         if (!energy) {
           for (iVar = 0; iVar < nVar; iVar++) {
@@ -5507,6 +5853,12 @@ void CIncEulerSolver::SetResidual_DualTime(CGeometry *geometry, CSolver **solver
     }
   }
 
+  if (implicit) {
+    for (iVar = 0; iVar < nVar; iVar++)
+      delete [] Jacobian_i[iVar];
+    delete [] Jacobian_i;
+  }
+
 }
 
 void CIncEulerSolver::GetOutlet_Properties(CGeometry *geometry, CConfig *config, unsigned short iMesh, bool Output) {
@@ -5884,68 +6236,65 @@ void CIncEulerSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConf
   /*--- Load data from the restart into correct containers. ---*/
 
   counter = 0;
-  for (iPoint_Global = 0; iPoint_Global < geometry[MESH_0]->GetGlobal_nPointDomain(); iPoint_Global++ ) {
-
-    /*--- Retrieve local index. If this node from the restart file lives
-     on the current processor, we will load and instantiate the vars. ---*/
+  for (const auto& globalToLocal : geometry[MESH_0]->GetGlobal_to_Local_Map()) {
 
-    iPoint_Local = geometry[MESH_0]->GetGlobal_to_Local_Point(iPoint_Global);
+    /*--- The points of this rank, in the order of their data in the restart file. ---*/
 
-    if (iPoint_Local > -1) {
+    iPoint_Global = globalToLocal.first;
+    iPoint_Local = globalToLocal.second;
 
-      /*--- We need to store this point's data, so jump to the correct
-       offset in the buffer of data from the restart file and load it. ---*/
+    /*--- We need to store this point's data, so jump to the correct
+     offset in the buffer of data from the restart file and load it. ---*/
 
-      index = counter*Restart_Vars[1] + skipVars;
-      for (iVar = 0; iVar < nVar_Restart; iVar++) Solution[iVar] = Restart_Data[index+iVar];
-      nodes->SetSolution(iPoint_Local,Solution);
-      iPoint_Global_Local++;
+    index = counter*Restart_Vars[1] + skipVars;
+    for (iVar = 0; iVar < nVar_Restart; iVar++) Solution[iVar] = Restart_Data[index+iVar];
+    nodes->SetSolution(iPoint_Local,Solution);
+    iPoint_Global_Local++;
 
-      /*--- For dynamic meshes, read in and store the
-       grid coordinates and grid velocities for each node. ---*/
+    /*--- For dynamic meshes, read in and store the
+     grid coordinates and grid velocities for each node. ---*/
 
-      if (dynamic_grid && val_update_geo) {
+    if (dynamic_grid && val_update_geo) {
 
-        /*--- Read in the next 2 or 3 variables which are the grid velocities ---*/
-        /*--- If we are restarting the solution from a previously computed static calculation (no grid movement) ---*/
-        /*--- the grid velocities are set to 0. This is useful for FSI computations ---*/
+      /*--- Read in the next 2 or 3 variables which are the grid velocities ---*/
+      /*--- If we are restarting the solution from a previously computed static calculation (no grid movement) ---*/
+      /*--- the grid velocities are set to 0. This is useful for FSI computations ---*/
 
-        su2double GridVel[3] = {0.0,0.0,0.0};
-        if (!steady_restart) {
+      su2double GridVel[3] = {0.0,0.0,0.0};
+      if (!steady_restart) {
 
-          /*--- Rewind the index to retrieve the Coords. ---*/
-          index = counter*Restart_Vars[1];
-          for (iDim = 0; iDim < nDim; iDim++) { Coord[iDim] = Restart_Data[index+iDim]; }
+        /*--- Rewind the index to retrieve the Coords. ---*/
+        index = counter*Restart_Vars[1];
+        for (iDim = 0; iDim < nDim; iDim++) { Coord[iDim] = Restart_Data[index+iDim]; }
 
-          /*--- Move the index forward to get the grid velocities. ---*/
-          index = counter*Restart_Vars[1] + skipVars + nVar_Restart + turbVars;
-          for (iDim = 0; iDim < nDim; iDim++) { GridVel[iDim] = Restart_Data[index+iDim]; }
-        }
+        /*--- Move the index forward to get the grid velocities. ---*/
+        index = counter*Restart_Vars[1] + skipVars + nVar_Restart + turbVars;
+        for (iDim = 0; iDim < nDim; iDim++) { GridVel[iDim] = Restart_Data[index+iDim]; }
+      }
 
-        for (iDim = 0; iDim < nDim; iDim++) {
-          geometry[MESH_0]->node[iPoint_Local]->SetCoord(iDim, Coord[iDim]);
-          geometry[MESH_0]->node[iPoint_Local]->SetGridVel(iDim, GridVel[iDim]);
-        }
+      for (iDim = 0; iDim < nDim; iDim++) {
+        geometry[MESH_0]->node[iPoint_Local]->SetCoord(iDim, Coord[iDim]);
+        geometry[MESH_0]->node[iPoint_Local]->SetGridVel(iDim, GridVel[iDim]);
       }
+    }
 
 
-      /*--- For static FSI problems, grid_movement is 0 but we need to read in and store the
-       grid coordinates for each node (but not the grid velocities, as there are none). ---*/
+    /*--- For static FSI problems, grid_movement is 0 but we need to read in and store the
+     grid coordinates for each node (but not the grid velocities, as there are none). ---*/
 
-      if (static_fsi && val_update_geo) {
-       /*--- Rewind the index to retrieve the Coords. ---*/
-        index = counter*Restart_Vars[1];
-        for (iDim = 0; iDim < nDim; iDim++) { Coord[iDim] = Restart_Data[index+iDim];}
+    if (static_fsi && val_update_geo) {
+     /*--- Rewind the index to retrieve the Coords. ---*/
+      index = counter*Restart_Vars[1];
+      for (iDim = 0; iDim < nDim; iDim++) { Coord[iDim] = Restart_Data[index+iDim];}
 
-        for (iDim = 0; iDim < nDim; iDim++) {
-          geometry[MESH_0]->node[iPoint_Local]->SetCoord(iDim, Coord[iDim]);
-        }
+      for (iDim = 0; iDim < nDim; iDim++) {
+        geometry[MESH_0]->node[iPoint_Local]->SetCoord(iDim, Coord[iDim]);
       }
+    }
 
-      /*--- Increment the overall counter for how many points have been loaded. ---*/
-      counter++;
+    /*--- Increment the overall counter for how many points have been loaded. ---*/
+    counter++;
 
-    }
   }
 
   /*--- Detect a wrong solution file ---*/
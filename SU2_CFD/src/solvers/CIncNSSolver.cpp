@@ -155,10 +155,6 @@ CIncNSSolver::CIncNSSolver(CGeometry *geometry, CConfig *config, unsigned short
   for (iMarker = 0; iMarker < nMarker; iMarker++)
     nVertex[iMarker] = geometry->nVertex[iMarker];
 
-  /*--- Fluid model intialization. ---*/
-
-  FluidModel = NULL;
-
   /*--- Perform the non-dimensionalization for the flow equations using the
    specified reference values. ---*/
 
@@ -226,6 +222,10 @@ CIncNSSolver::CIncNSSolver(CGeometry *geometry, CConfig *config, unsigned short
   LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
   LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
 
+  /*--- Edge coloring and chunk sizes for the hybrid parallel execution. ---*/
+
+  HybridParallelInitialization(geometry, config);
+
   /*--- Jacobians and vector structures for implicit computations ---*/
 
   if (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) {
@@ -238,7 +238,7 @@ CIncNSSolver::CIncNSSolver(CGeometry *geometry, CConfig *config, unsigned short
     }
 
     if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (Navier-Stokes). MG level: " << iMesh <<"." << endl;
-    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config, ReducerStrategy);
 
     if (config->GetKind_Linear_Solver_Prec() == LINELET) {
       nLineLets = Jacobian.BuildLineletPreconditioner(geometry, config);
@@ -637,6 +637,10 @@ CIncNSSolver::CIncNSSolver(CGeometry *geometry, CConfig *config, unsigned short
   /*--- Add the solver name (max 8 characters) ---*/
   SolverName = "INC.FLOW";
 
+  /*--- Finally, check that the static arrays will be large enough (keep this
+   *    check at the bottom to make sure we consider the "final" values). ---*/
+  if((nDim > MAXNDIM) || (nPrimVar > MAXNVAR))
+    SU2_MPI::Error("Oops! The CIncNSSolver static array sizes are not large enough.",CURRENT_FUNCTION);
 }
 
 CIncNSSolver::~CIncNSSolver(void) {
@@ -703,9 +707,6 @@ CIncNSSolver::~CIncNSSolver(void) {
 
 void CIncNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iMesh, unsigned short iRKStep, unsigned short RunTime_EqSystem, bool Output) {
 
-  unsigned long iPoint, ErrorCounter = 0;
-  su2double StrainMag = 0.0, Omega = 0.0, *Vorticity;
-
   unsigned long InnerIter     = config->GetInnerIter();
   bool cont_adjoint         = config->GetContinuous_Adjoint();
   bool disc_adjoint         = config->GetDiscrete_Adjoint();
@@ -720,7 +721,12 @@ void CIncNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
 
   /*--- Set the primitive variables ---*/
 
-  ErrorCounter = SetPrimitive_Variables(solver_container, config, Output);
+  SU2_OMP_MASTER
+  ErrorCounter = 0;
+  SU2_OMP_BARRIER
+
+  SU2_OMP_ATOMIC
+  ErrorCounter += SetPrimitive_Variables(solver_container, config, Output);
 
   /*--- Compute gradient for MUSCL reconstruction. ---*/
 
@@ -764,62 +770,95 @@ void CIncNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
 
   /*--- Compute properties needed for mass flow BCs. ---*/
 
-  if (outlet) GetOutlet_Properties(geometry, config, iMesh, Output);
+  if (outlet) {
+    SU2_OMP_MASTER
+    GetOutlet_Properties(geometry, config, iMesh, Output);
+    SU2_OMP_BARRIER
+  }
 
   /*--- Evaluate the vorticity and strain rate magnitude ---*/
 
+  SU2_OMP_MASTER
+  {
+    StrainMag_Max = 0.0;
+    Omega_Max = 0.0;
+  }
+  SU2_OMP_BARRIER
+
   nodes->SetVorticity_StrainMag();
 
-  StrainMag_Max = 0.0; Omega_Max = 0.0;
-  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+  su2double strainMax = 0.0, omegaMax = 0.0;
+
+  SU2_OMP(for schedule(static,omp_chunk_size) nowait)
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
 
-    StrainMag = nodes->GetStrainMag(iPoint);
-    Vorticity = nodes->GetVorticity(iPoint);
-    Omega = sqrt(Vorticity[0]*Vorticity[0]+ Vorticity[1]*Vorticity[1]+ Vorticity[2]*Vorticity[2]);
+    su2double StrainMag = nodes->GetStrainMag(iPoint);
+    const su2double* Vorticity = nodes->GetVorticity(iPoint);
+    su2double Omega = sqrt(Vorticity[0]*Vorticity[0]+ Vorticity[1]*Vorticity[1]+ Vorticity[2]*Vorticity[2]);
 
-    StrainMag_Max = max(StrainMag_Max, StrainMag);
-    Omega_Max = max(Omega_Max, Omega);
+    strainMax = max(strainMax, StrainMag);
+    omegaMax = max(omegaMax, Omega);
 
   }
+  SU2_OMP_CRITICAL
+  {
+    StrainMag_Max = max(StrainMag_Max, strainMax);
+    Omega_Max = max(Omega_Max, omegaMax);
+  }
 
-  /*--- Initialize the Jacobian matrices ---*/
+  /*--- Initialize the Jacobian matrices, not needed for the reducer strategy
+   *    as we set blocks (including diagonal ones) and completely overwrite. ---*/
 
-  if (implicit && !disc_adjoint) Jacobian.SetValZero();
+  if (implicit && !disc_adjoint && !ReducerStrategy) Jacobian.SetValZero();
 
   /*--- Error message ---*/
 
   if (config->GetComm_Level() == COMM_FULL) {
-
-#ifdef HAVE_MPI
-    unsigned long MyErrorCounter = ErrorCounter; ErrorCounter = 0;
-    su2double MyOmega_Max = Omega_Max; Omega_Max = 0.0;
-    su2double MyStrainMag_Max = StrainMag_Max; StrainMag_Max = 0.0;
-
-    SU2_MPI::Allreduce(&MyErrorCounter, &ErrorCounter, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyStrainMag_Max, &StrainMag_Max, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyOmega_Max, &Omega_Max, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
-#endif
-
-    if (iMesh == MESH_0)
-      config->SetNonphysical_Points(ErrorCounter);
-
+    SU2_OMP_BARRIER
+    SU2_OMP_MASTER
+    {
+      unsigned long MyErrorCounter = ErrorCounter;
+      su2double MyOmega_Max = Omega_Max;
+      su2double MyStrainMag_Max = StrainMag_Max;
+
+      SU2_MPI::Allreduce(&MyErrorCounter, &ErrorCounter, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+      SU2_MPI::Allreduce(&MyStrainMag_Max, &StrainMag_Max, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+      SU2_MPI::Allreduce(&MyOmega_Max, &Omega_Max, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+
+      if (iMesh == MESH_0)
+        config->SetNonphysical_Points(ErrorCounter);
+    }
+    SU2_OMP_BARRIER
   }
 
 }
 
 unsigned long CIncNSSolver::SetPrimitive_Variables(CSolver **solver_container, CConfig *config, bool Output) {
 
-  unsigned long iPoint, nonPhysicalPoints = 0;
-  su2double eddy_visc = 0.0, turb_ke = 0.0, DES_LengthScale = 0.0;
-  unsigned short turb_model = config->GetKind_Turb_Model();
-  bool physical = true;
+  /*--- Devirtualized point loop for the variable density (polynomial) models. ---*/
 
-  bool tkeNeeded = ((turb_model == SST) || (turb_model == SST_SUST));
+  if ((config->GetKind_FluidModel() == INC_IDEAL_GAS_POLY) &&
+      (config->GetKind_ViscosityModel() == POLYNOMIAL_VISCOSITY) &&
+      (config->GetKind_ConductivityModel() == POLYNOMIAL_CONDUCTIVITY)) {
+    if (config->GetKind_ConductivityModel_Turb() == CONSTANT_PRANDTL_TURB)
+      return SetPrimitive_Variables_Batched<CPolynomialConductivityRANS>(solver_container, config, Output);
+    return SetPrimitive_Variables_Batched<CPolynomialConductivity>(solver_container, config, Output);
+  }
 
-  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+  /*--- Number of non-physical points, local to the thread, needs
+   *    further reduction if function is called in parallel ---*/
+  unsigned long nonPhysicalPoints = 0;
+
+  const unsigned short turb_model = config->GetKind_Turb_Model();
+  const bool tkeNeeded = (turb_model == SST) || (turb_model == SST_SUST);
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
 
     /*--- Retrieve the value of the kinetic energy (if needed) ---*/
 
+    su2double eddy_visc = 0.0, turb_ke = 0.0, DES_LengthScale = 0.0;
+
     if (turb_model != NONE && solver_container[TURB_SOL] != nullptr) {
       eddy_visc = solver_container[TURB_SOL]->GetNodes()->GetmuT(iPoint);
       if (tkeNeeded) turb_ke = solver_container[TURB_SOL]->GetNodes()->GetSolution(iPoint,0);
@@ -831,7 +870,7 @@ unsigned long CIncNSSolver::SetPrimitive_Variables(CSolver **solver_container, C
 
     /*--- Incompressible flow, primitive variables --- */
 
-    physical = static_cast<CIncNSVariable*>(nodes)->SetPrimVar(iPoint,eddy_visc, turb_ke, FluidModel);
+    bool physical = static_cast<CIncNSVariable*>(nodes)->SetPrimVar(iPoint,eddy_visc, turb_ke, GetFluidModel());
 
     /* Check for non-realizable states for reporting. */
 
@@ -851,288 +890,139 @@ unsigned long CIncNSSolver::SetPrimitive_Variables(CSolver **solver_container, C
 
 }
 
-void CIncNSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iMesh, unsigned long Iteration) {
-
-  su2double Mean_BetaInc2, *Normal, Area, Vol, Mean_SoundSpeed = 0.0, Mean_ProjVel = 0.0, Lambda, Local_Delta_Time, Local_Delta_Time_Visc,
-  Global_Delta_Time = 1E6, Mean_LaminarVisc = 0.0, Mean_EddyVisc = 0.0, Mean_Density = 0.0, Mean_Thermal_Conductivity = 0.0, Mean_Cv = 0.0, Lambda_1, Lambda_2, K_v = 0.25, Global_Delta_UnstTimeND;
-  unsigned long iEdge, iVertex, iPoint = 0, jPoint = 0;
-  unsigned short iDim, iMarker;
-  su2double ProjVel, ProjVel_i, ProjVel_j;
-
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
-  bool dual_time = ((config->GetTime_Marching() == DT_STEPPING_1ST) ||
-                    (config->GetTime_Marching() == DT_STEPPING_2ND));
-  bool energy = config->GetEnergy_Equation();
-
-  Min_Delta_Time = 1.E30; Max_Delta_Time = 0.0;
-
-  /*--- Set maximum inviscid eigenvalue to zero, and compute sound speed and viscosity ---*/
-
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-    nodes->SetMax_Lambda_Inv(iPoint,0.0);
-    nodes->SetMax_Lambda_Visc(iPoint,0.0);
-  }
-
-  /*--- Loop interior edges ---*/
-
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-
-    /*--- Point identification, Normal vector and area ---*/
-
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
-
-    Normal = geometry->edge[iEdge]->GetNormal();
-    Area = 0; for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim]; Area = sqrt(Area);
-
-    /*--- Mean Values ---*/
-
-    Mean_ProjVel    = 0.5 * (nodes->GetProjVel(iPoint,Normal) + nodes->GetProjVel(jPoint,Normal));
-    Mean_BetaInc2   = 0.5 * (nodes->GetBetaInc2(iPoint)       + nodes->GetBetaInc2(jPoint));
-    Mean_Density    = 0.5 * (nodes->GetDensity(iPoint)        + nodes->GetDensity(jPoint));
-    Mean_SoundSpeed = sqrt(Mean_BetaInc2*Area*Area);
-
-    /*--- Adjustment for grid movement ---*/
-
-    if (dynamic_grid) {
-      su2double *GridVel_i = geometry->node[iPoint]->GetGridVel();
-      su2double *GridVel_j = geometry->node[jPoint]->GetGridVel();
-      ProjVel_i = 0.0; ProjVel_j =0.0;
-      for (iDim = 0; iDim < nDim; iDim++) {
-        ProjVel_i += GridVel_i[iDim]*Normal[iDim];
-        ProjVel_j += GridVel_j[iDim]*Normal[iDim];
-      }
-      Mean_ProjVel -= 0.5 * (ProjVel_i + ProjVel_j);
-    }
-
-    /*--- Inviscid contribution ---*/
-
-    Lambda = fabs(Mean_ProjVel) + Mean_SoundSpeed;
-    if (geometry->node[iPoint]->GetDomain()) nodes->AddMax_Lambda_Inv(iPoint,Lambda);
-    if (geometry->node[jPoint]->GetDomain()) nodes->AddMax_Lambda_Inv(jPoint,Lambda);
+template<class ConductivityModelType>
+unsigned long CIncNSSolver::SetPrimitive_Variables_Batched(CSolver **solver_container, const CConfig *config, bool Output) {
 
-    /*--- Viscous contribution ---*/
+  constexpr auto SIZE = CFluidBatch::SIZE;
 
-    Mean_LaminarVisc          = 0.5*(nodes->GetLaminarViscosity(iPoint)    + nodes->GetLaminarViscosity(jPoint));
-    Mean_EddyVisc             = 0.5*(nodes->GetEddyViscosity(iPoint)       + nodes->GetEddyViscosity(jPoint));
-    Mean_Density              = 0.5*(nodes->GetDensity(iPoint)             + nodes->GetDensity(jPoint));
-    Mean_Thermal_Conductivity = 0.5*(nodes->GetThermalConductivity(iPoint) + nodes->GetThermalConductivity(jPoint));
-    Mean_Cv                   = 0.5*(nodes->GetSpecificHeatCv(iPoint)      + nodes->GetSpecificHeatCv(jPoint));
+  auto flowNodes = static_cast<CIncNSVariable*>(nodes);
+  auto fluidModel = static_cast<const CIncIdealGasPolynomial*>(GetFluidModel());
+  auto viscosityModel = static_cast<const CPolynomialViscosity*>(fluidModel->GetViscosityModel());
+  auto conductivityModel = static_cast<const ConductivityModelType*>(fluidModel->GetConductivityModel());
 
-    Lambda_1 = (4.0/3.0)*(Mean_LaminarVisc + Mean_EddyVisc);
-    Lambda_2 = 0.0;
-    if (energy) Lambda_2 = (1.0/Mean_Cv)*Mean_Thermal_Conductivity;
-    Lambda = (Lambda_1 + Lambda_2)*Area*Area/Mean_Density;
-
-    if (geometry->node[iPoint]->GetDomain()) nodes->AddMax_Lambda_Visc(iPoint,Lambda);
-    if (geometry->node[jPoint]->GetDomain()) nodes->AddMax_Lambda_Visc(jPoint,Lambda);
-
-  }
+  const unsigned short turb_model = config->GetKind_Turb_Model();
+  const bool tkeNeeded = (turb_model == SST) || (turb_model == SST_SUST);
+  const bool hybridRANSLES = (config->GetKind_HybridRANSLES() != NO_HYBRIDRANSLES);
 
-  /*--- Loop boundary edges ---*/
+  CVariable* turbNodes = nullptr;
+  if ((turb_model != NONE) && (solver_container[TURB_SOL] != nullptr))
+    turbNodes = solver_container[TURB_SOL]->GetNodes();
 
-  for (iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
-    if ((config->GetMarker_All_KindBC(iMarker) != INTERNAL_BOUNDARY) &&
-        (config->GetMarker_All_KindBC(iMarker) != PERIODIC_BOUNDARY)) {
-    for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+  unsigned long nonPhysicalPoints = 0;
+  const unsigned long nBatch = roundUpDiv(nPoint, SIZE);
 
-      /*--- Point identification, Normal vector and area ---*/
+  SU2_OMP_FOR_STAT(roundUpDiv(omp_chunk_size, SIZE))
+  for (unsigned long iBatch = 0; iBatch < nBatch; ++iBatch) {
 
-      iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-      Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
-      Area = 0.0; for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim]; Area = sqrt(Area);
+    const unsigned long begin = iBatch*SIZE;
+    const unsigned long nLane = min<unsigned long>(SIZE, nPoint-begin);
 
-      /*--- Mean Values ---*/
+    CFluidBatch batch;
+    su2double turb_ke[SIZE] = {0.0};
 
-      Mean_ProjVel    = nodes->GetProjVel(iPoint,Normal);
-      Mean_BetaInc2   = nodes->GetBetaInc2(iPoint);
-      Mean_Density    = nodes->GetDensity(iPoint);
-      Mean_SoundSpeed = sqrt(Mean_BetaInc2*Area*Area);
-
-      /*--- Adjustment for grid movement ---*/
-
-      if (dynamic_grid) {
-        su2double *GridVel = geometry->node[iPoint]->GetGridVel();
-        ProjVel = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++)
-          ProjVel += GridVel[iDim]*Normal[iDim];
-        Mean_ProjVel -= ProjVel;
-      }
+    /*--- Gather the temperatures, the lanes past the last point repeat it. ---*/
 
-      /*--- Inviscid contribution ---*/
+    for (unsigned long k = 0; k < nLane; ++k) {
+      const unsigned long iPoint = begin + k;
 
-      Lambda = fabs(Mean_ProjVel) + Mean_SoundSpeed;
-      if (geometry->node[iPoint]->GetDomain()) {
-        nodes->AddMax_Lambda_Inv(iPoint,Lambda);
+      su2double eddy_visc = 0.0, DES_LengthScale = 0.0;
+      if (turbNodes != nullptr) {
+        eddy_visc = turbNodes->GetmuT(iPoint);
+        if (tkeNeeded) turb_ke[k] = turbNodes->GetSolution(iPoint,0);
+        if (hybridRANSLES) DES_LengthScale = turbNodes->GetDES_LengthScale(iPoint);
       }
+      flowNodes->SetDES_LengthScale(iPoint, DES_LengthScale);
 
-      /*--- Viscous contribution ---*/
-
-      Mean_LaminarVisc          = nodes->GetLaminarViscosity(iPoint);
-      Mean_EddyVisc             = nodes->GetEddyViscosity(iPoint);
-      Mean_Density              = nodes->GetDensity(iPoint);
-      Mean_Thermal_Conductivity = nodes->GetThermalConductivity(iPoint);
-      Mean_Cv                   = nodes->GetSpecificHeatCv(iPoint);
-
-      Lambda_1 = (4.0/3.0)*(Mean_LaminarVisc + Mean_EddyVisc);
-      Lambda_2 = 0.0;
-      if (energy) Lambda_2 = (1.0/Mean_Cv)*Mean_Thermal_Conductivity;
-      Lambda = (Lambda_1 + Lambda_2)*Area*Area/Mean_Density;
-
-      if (geometry->node[iPoint]->GetDomain()) nodes->AddMax_Lambda_Visc(iPoint,Lambda);
+      flowNodes->SetDensity_Old(iPoint);
+      flowNodes->SetPressure(iPoint);
 
+      batch.Temperature[k] = flowNodes->GetSolution(iPoint,nDim+1);
+      batch.Mu_Turb[k] = eddy_visc;
     }
+    for (unsigned long k = nLane; k < SIZE; ++k) {
+      batch.Temperature[k] = batch.Temperature[nLane-1];
+      batch.Mu_Turb[k] = batch.Mu_Turb[nLane-1];
     }
-  }
 
-  /*--- Each element uses their own speed, steady state simulation ---*/
+    /*--- Thermodynamic state and transport properties (statically bound). ---*/
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    fluidModel->SetTDState_T(batch);
+    viscosityModel->SetViscosity(batch);
+    conductivityModel->SetConductivity(batch);
 
-    Vol = geometry->node[iPoint]->GetVolume();
+    /*--- Scatter the primitive variables. ---*/
 
-    if (Vol != 0.0) {
-      Local_Delta_Time = nodes->GetLocalCFL(iPoint)*Vol / nodes->GetMax_Lambda_Inv(iPoint);
-      Local_Delta_Time_Visc = nodes->GetLocalCFL(iPoint)*K_v*Vol*Vol/ nodes->GetMax_Lambda_Visc(iPoint);
-      Local_Delta_Time = min(Local_Delta_Time, Local_Delta_Time_Visc);
-      Global_Delta_Time = min(Global_Delta_Time, Local_Delta_Time);
-      Min_Delta_Time = min(Min_Delta_Time, Local_Delta_Time);
-      Max_Delta_Time = max(Max_Delta_Time, Local_Delta_Time);
-      if (Local_Delta_Time > config->GetMax_DeltaTime())
-        Local_Delta_Time = config->GetMax_DeltaTime();
-      nodes->SetDelta_Time(iPoint,Local_Delta_Time);
-    }
-    else {
-      nodes->SetDelta_Time(iPoint,0.0);
-    }
+    for (unsigned long k = 0; k < nLane; ++k) {
+      const unsigned long iPoint = begin + k;
 
-  }
+      if (!Output) LinSysRes.SetBlock_Zero(iPoint);
 
-  /*--- Compute the max and the min dt (in parallel) ---*/
-  if (config->GetComm_Level() == COMM_FULL) {
-#ifdef HAVE_MPI
-    su2double rbuf_time, sbuf_time;
-    sbuf_time = Min_Delta_Time;
-    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_DOUBLE, MPI_MIN, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Bcast(&rbuf_time, 1, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    Min_Delta_Time = rbuf_time;
-
-    sbuf_time = Max_Delta_Time;
-    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_DOUBLE, MPI_MAX, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Bcast(&rbuf_time, 1, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    Max_Delta_Time = rbuf_time;
-#endif
-  }
+      if ((batch.Temperature[k] <= 0.0) || (batch.Density[k] <= 0.0)) {
 
-  /*--- For exact time solution use the minimum delta time of the whole mesh ---*/
-  if (config->GetTime_Marching() == TIME_STEPPING) {
-#ifdef HAVE_MPI
-    su2double rbuf_time, sbuf_time;
-    sbuf_time = Global_Delta_Time;
-    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_DOUBLE, MPI_MIN, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Bcast(&rbuf_time, 1, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    Global_Delta_Time = rbuf_time;
-#endif
-    /*--- If the unsteady CFL is set to zero, it uses the defined
-     unsteady time step, otherwise it computes the time step based
-     on the unsteady CFL ---*/
-
-    if (config->GetUnst_CFL() == 0.0) {
-      Global_Delta_Time = config->GetDelta_UnstTime();
-    }
-    config->SetDelta_UnstTimeND(Global_Delta_Time);
-    for (iPoint = 0; iPoint < nPointDomain; iPoint++){
+        /*--- Copy the old solution and recompute the primitives with the generic method. ---*/
 
-      /*--- Sets the regular CFL equal to the unsteady CFL ---*/
+        for (unsigned long iVar = 0; iVar < nVar; iVar++)
+          flowNodes->SetSolution(iPoint, iVar, flowNodes->GetSolution_Old(iPoint, iVar));
 
-      nodes->SetLocalCFL(iPoint, config->GetUnst_CFL());
-      nodes->SetDelta_Time(iPoint, Global_Delta_Time);
-      Min_Delta_Time = Global_Delta_Time;
-      Max_Delta_Time = Global_Delta_Time;
+        flowNodes->SetPrimVar(iPoint, batch.Mu_Turb[k], turb_ke[k], GetFluidModel());
 
-    }
-  }
+        nonPhysicalPoints++;
+        continue;
+      }
 
-  /*--- Recompute the unsteady time step for the dual time strategy
-   if the unsteady CFL is diferent from 0 ---*/
-  if ((dual_time) && (Iteration == 0) && (config->GetUnst_CFL() != 0.0) && (iMesh == MESH_0)) {
+      flowNodes->SetTemperature(iPoint, batch.Temperature[k]);
+      flowNodes->SetDensity(iPoint, batch.Density[k]);
+      flowNodes->SetVelocity(iPoint);
 
-    Global_Delta_UnstTimeND = 1e30;
-    for (iPoint = 0; iPoint < nPointDomain; iPoint++){
-      Global_Delta_UnstTimeND = min(Global_Delta_UnstTimeND,config->GetUnst_CFL()*Global_Delta_Time/nodes->GetLocalCFL(iPoint));
+      flowNodes->SetLaminarViscosity(iPoint, batch.Mu[k]);
+      flowNodes->SetEddyViscosity(iPoint, batch.Mu_Turb[k]);
+      flowNodes->SetThermalConductivity(iPoint, batch.Kt[k]);
+      flowNodes->SetSpecificHeatCp(iPoint, batch.Cp[k]);
+      flowNodes->SetSpecificHeatCv(iPoint, batch.Cv[k]);
     }
-
-#ifdef HAVE_MPI
-    su2double rbuf_time, sbuf_time;
-    sbuf_time = Global_Delta_UnstTimeND;
-    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_DOUBLE, MPI_MIN, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Bcast(&rbuf_time, 1, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    Global_Delta_UnstTimeND = rbuf_time;
-#endif
-    config->SetDelta_UnstTimeND(Global_Delta_UnstTimeND);
   }
 
-  /*--- The pseudo local time (explicit integration) cannot be greater than the physical time ---*/
-  if (dual_time)
-    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-      if (!implicit) {
-        Local_Delta_Time = min((2.0/3.0)*config->GetDelta_UnstTimeND(), nodes->GetDelta_Time(iPoint));
-        nodes->SetDelta_Time(iPoint,Local_Delta_Time);
-      }
-    }
-
+  return nonPhysicalPoints;
 }
 
-void CIncNSSolver::Viscous_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
-                                    CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
-
-  CNumerics* numerics = numerics_container[VISC_TERM];
-
-  unsigned long iPoint, jPoint, iEdge;
+CNumerics::ResidualType<> CIncNSSolver::ViscousEdgeResidual(unsigned long iEdge, CGeometry *geometry,
+                                                            CSolver **solver_container,
+                                                            CNumerics *numerics, CConfig *config) {
 
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  const bool tkeNeeded = (config->GetKind_Turb_Model() == SST) ||
+                         (config->GetKind_Turb_Model() == SST_SUST);
 
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  /*--- Points, coordinates and normal vector in edge ---*/
 
-    /*--- Points, coordinates and normal vector in edge ---*/
+  auto iPoint = geometry->edge[iEdge]->GetNode(0);
+  auto jPoint = geometry->edge[iEdge]->GetNode(1);
 
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
-    numerics->SetCoord(geometry->node[iPoint]->GetCoord(),
-                       geometry->node[jPoint]->GetCoord());
-    numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
+  numerics->SetCoord(geometry->node[iPoint]->GetCoord(),
+                     geometry->node[jPoint]->GetCoord());
 
-    /*--- Primitive and secondary variables ---*/
+  numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
 
-    numerics->SetPrimitive(nodes->GetPrimitive(iPoint),
-                           nodes->GetPrimitive(jPoint));
+  numerics->SetEdgeGeometry(geometry->GetEdgeGeometry(iEdge));
 
-    /*--- Gradient and limiters ---*/
+  /*--- Primitive and secondary variables ---*/
 
-    numerics->SetPrimVarGradient(nodes->GetGradient_Primitive(iPoint),
-                                 nodes->GetGradient_Primitive(jPoint));
+  numerics->SetPrimitive(nodes->GetPrimitive(iPoint),
+                         nodes->GetPrimitive(jPoint));
 
-    /*--- Turbulent kinetic energy ---*/
+  /*--- Gradient and limiters ---*/
 
-    if ((config->GetKind_Turb_Model() == SST) || (config->GetKind_Turb_Model() == SST_SUST))
-      numerics->SetTurbKineticEnergy(solver_container[TURB_SOL]->GetNodes()->GetSolution(iPoint,0),
-                                     solver_container[TURB_SOL]->GetNodes()->GetSolution(jPoint,0));
+  numerics->SetPrimVarGradient(nodes->GetGradient_Primitive(iPoint),
+                               nodes->GetGradient_Primitive(jPoint));
 
-    /*--- Compute and update residual ---*/
+  /*--- Turbulent kinetic energy ---*/
 
-    auto residual = numerics->ComputeResidual(config);
+  if (tkeNeeded)
+    numerics->SetTurbKineticEnergy(solver_container[TURB_SOL]->GetNodes()->GetSolution(iPoint,0),
+                                   solver_container[TURB_SOL]->GetNodes()->GetSolution(jPoint,0));
 
-    LinSysRes.SubtractBlock(iPoint, residual);
-    LinSysRes.AddBlock(jPoint, residual);
-
-    /*--- Implicit part ---*/
-
-    if (implicit) {
-      Jacobian.UpdateBlocksSub(iEdge, iPoint, jPoint, residual.jacobian_i, residual.jacobian_j);
-    }
-
-  }
+  /*--- Compute the residual, the caller updates the system. ---*/
 
+  return numerics->ComputeResidualPreacc(config);
 }
 
 void CIncNSSolver::Friction_Forces(CGeometry *geometry, CConfig *config) {
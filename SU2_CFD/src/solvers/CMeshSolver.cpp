@@ -50,6 +50,10 @@ CMeshSolver::CMeshSolver(CGeometry *geometry, CConfig *config) : CFEASolver(true
     break;
   }
 
+  /*--- The stiffness only depends on the reference coordinates, it can be kept across deformations. ---*/
+  reuse_stiffness = config->GetDeform_Reuse_Stiffness();
+  stiffness_assembled = false;
+
   /*--- Initialize the number of spatial dimensions, length of the state
    vector (same as spatial dimensions for grid deformation), and grid nodes. ---*/
 
@@ -268,12 +272,9 @@ void CMeshSolver::SetMinMaxVolume(CGeometry *geometry, CConfig *config, bool upd
 
 void CMeshSolver::SetWallDistance(CGeometry *geometry, CConfig *config) {
 
-  unsigned long nVertex_SolidWall, ii, jj, iVertex, iPoint, pointID, iElem;
-  unsigned short iNodes, nNodes = 0;
+  unsigned long nVertex_SolidWall, ii, jj, iVertex, iPoint;
   unsigned short iMarker, iDim;
-  su2double dist, MaxDistance_Local, MinDistance_Local;
-  su2double nodeDist, ElemDist;
-  int rankID;
+  su2double MaxDistance_Local, MinDistance_Local;
 
   /*--- Initialize min and max distance ---*/
 
@@ -335,21 +336,37 @@ void CMeshSolver::SetWallDistance(CGeometry *geometry, CConfig *config) {
   else {
 
     /*--- Solid wall boundary nodes are present. Compute the wall
-     distance for all nodes. ---*/
+     distance for all nodes, the searches of the ADT are thread safe. ---*/
 
-    for(iPoint=0; iPoint< nPoint; ++iPoint) {
+    SU2_OMP_PARALLEL
+    {
+      /*--- Local min/max, final reduction outside loop. ---*/
+      su2double maxDist = -1E22, minDist = 1E22;
 
-      WallADT.DetermineNearestNode(nodes->GetMesh_Coord(iPoint), dist,
-                                   pointID, rankID);
-      nodes->SetWallDistance(iPoint,dist);
+      SU2_OMP_FOR_DYN(omp_chunk_size)
+      for(unsigned long iPoint=0; iPoint < nPoint; ++iPoint) {
 
-      MaxDistance = max(MaxDistance, dist);
+        su2double dist;
+        unsigned long pointID;
+        int rankID;
 
-      /*--- To discard points on the surface we use > EPS ---*/
+        WallADT.DetermineNearestNode(nodes->GetMesh_Coord(iPoint), dist,
+                                     pointID, rankID);
+        nodes->SetWallDistance(iPoint,dist);
 
-      if (sqrt(dist) > EPS)  MinDistance = min(MinDistance, dist);
+        maxDist = max(maxDist, dist);
 
-    }
+        /*--- To discard points on the surface we use > EPS ---*/
+
+        if (sqrt(dist) > EPS)  minDist = min(minDist, dist);
+
+      }
+      SU2_OMP_CRITICAL
+      {
+        MaxDistance = max(MaxDistance, maxDist);
+        MinDistance = min(MinDistance, minDist);
+      }
+    } // end SU2_OMP_PARALLEL
 
     MaxDistance_Local = MaxDistance; MaxDistance = 0.0;
     MinDistance_Local = MinDistance; MinDistance = 0.0;
@@ -359,30 +376,36 @@ void CMeshSolver::SetWallDistance(CGeometry *geometry, CConfig *config) {
 
   }
 
-  /*--- Normalize distance from 0 to 1 ---*/
-  for (iPoint=0; iPoint < nPoint; ++iPoint) {
-    nodeDist = nodes->GetWallDistance(iPoint)/MaxDistance;
-    nodes->SetWallDistance(iPoint,nodeDist);
-  }
+  SU2_OMP_PARALLEL
+  {
+    /*--- Normalize distance from 0 to 1 ---*/
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (unsigned long iPoint=0; iPoint < nPoint; ++iPoint) {
+      su2double nodeDist = nodes->GetWallDistance(iPoint)/MaxDistance;
+      nodes->SetWallDistance(iPoint,nodeDist);
+    }
 
-  /*--- Compute the element distances ---*/
-  for (iElem = 0; iElem < nElement; iElem++) {
+    /*--- Compute the element distances ---*/
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (unsigned long iElem = 0; iElem < nElement; iElem++) {
 
-    int EL_KIND;
-    GetElemKindAndNumNodes(geometry->elem[iElem]->GetVTK_Type(), EL_KIND, nNodes);
+      int EL_KIND;
+      unsigned short nNodes;
+      GetElemKindAndNumNodes(geometry->elem[iElem]->GetVTK_Type(), EL_KIND, nNodes);
 
-    /*--- Average the distance of the nodes in the element ---*/
+      /*--- Average the distance of the nodes in the element ---*/
 
-    ElemDist = 0.0;
-    for (iNodes = 0; iNodes < nNodes; iNodes++){
-      iPoint = geometry->elem[iElem]->GetNode(iNodes);
-      ElemDist += nodes->GetWallDistance(iPoint);
-    }
-    ElemDist = ElemDist/su2double(nNodes);
+      su2double ElemDist = 0.0;
+      for (unsigned short iNodes = 0; iNodes < nNodes; iNodes++){
+        auto iPoint = geometry->elem[iElem]->GetNode(iNodes);
+        ElemDist += nodes->GetWallDistance(iPoint);
+      }
+      ElemDist = ElemDist/su2double(nNodes);
 
-    element[iElem].SetWallDistance(ElemDist);
+      element[iElem].SetWallDistance(ElemDist);
 
-  }
+    }
+  } // end SU2_OMP_PARALLEL
 
 }
 
@@ -428,8 +451,14 @@ void CMeshSolver::DeformMesh(CGeometry **geometry, CNumerics **numerics, CConfig
 
   if (multizone) nodes->Set_BGSSolution_k();
 
-  /*--- Compute the stiffness matrix. ---*/
-  Compute_StiffMatrix(geometry[MESH_0], numerics, config);
+  /*--- Compute the stiffness matrix, unless the one of a previous deformation is reused,
+   *    in which case the blocks eliminated by the boundary conditions are stored. ---*/
+  const bool assemble = !(reuse_stiffness && stiffness_assembled);
+
+  if (assemble) {
+    Compute_StiffMatrix(geometry[MESH_0], numerics, config);
+    if (reuse_stiffness) SetLiftingBlocks(geometry[MESH_0], config);
+  }
 
   /*--- Initialize vectors and clean residual. ---*/
   SU2_OMP_PARALLEL
@@ -452,9 +481,14 @@ void CMeshSolver::DeformMesh(CGeometry **geometry, CNumerics **numerics, CConfig
   InitiateComms(geometry[MESH_0], config, MESH_DISPLACEMENTS);
   CompleteComms(geometry[MESH_0], config, MESH_DISPLACEMENTS);
 
-  /*--- Impose boundary conditions (all of them are ESSENTIAL BC's - displacements). ---*/
+  /*--- Impose boundary conditions (all of them are ESSENTIAL BC's - displacements).
+   *    On a reused matrix this only sets the imposed values, the free rows of the
+   *    right hand side are then updated with the stored blocks. ---*/
   SetBoundaryDisplacements(geometry[MESH_0], numerics[FEA_TERM], config);
 
+  if (!assemble) AddLiftingResidual();
+  stiffness_assembled = true;
+
   /*--- Solve the linear system. ---*/
   Solve_System(geometry[MESH_0], config);
 
@@ -513,12 +547,10 @@ void CMeshSolver::UpdateGridCoord(CGeometry *geometry, CConfig *config){
 void CMeshSolver::UpdateDualGrid(CGeometry *geometry, CConfig *config){
 
   /*--- After moving all nodes, update the dual mesh. Recompute the edges and
-   dual mesh control volumes in the domain and on the boundaries. ---*/
+   dual mesh control volumes in the domain and on the boundaries, only where
+   they depend on displaced nodes. ---*/
 
-  geometry->SetCoord_CG();
-  geometry->SetControlVolume(config, UPDATE);
-  geometry->SetBoundControlVolume(config, UPDATE);
-  geometry->SetMaxLength(config);
+  geometry->UpdateDualGrid(config);
 
 }
 
@@ -575,9 +607,7 @@ void CMeshSolver::UpdateMultiGrid(CGeometry **geometry, CConfig *config){
 
   for (iMGlevel = 1; iMGlevel <= nMGlevel; iMGlevel++) {
     iMGfine = iMGlevel-1;
-    geometry[iMGlevel]->SetControlVolume(config, geometry[iMGfine], UPDATE);
-    geometry[iMGlevel]->SetBoundControlVolume(config, geometry[iMGfine],UPDATE);
-    geometry[iMGlevel]->SetCoord(geometry[iMGfine]);
+    geometry[iMGlevel]->UpdateDualGrid(config, geometry[iMGfine]);
     if (time_domain)
       geometry[iMGlevel]->SetRestricted_GridVelocity(geometry[iMGfine], config);
   }
@@ -619,6 +649,71 @@ void CMeshSolver::SetBoundaryDisplacements(CGeometry *geometry, CNumerics *numer
 
 }
 
+void CMeshSolver::SetLiftingBlocks(CGeometry *geometry, CConfig *config){
+
+  /*--- Nodes on which SetBoundaryDisplacements imposes the displacement. ---*/
+  vector<bool> imposed(nPoint, false);
+
+  for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    if ((config->GetMarker_All_Deform_Mesh(iMarker) == YES) ||
+        ((config->GetMarker_All_KindBC(iMarker) != SEND_RECEIVE) &&
+         (config->GetMarker_All_KindBC(iMarker) != PERIODIC_BOUNDARY))) {
+      for (auto iVertex = 0ul; iVertex < geometry->nVertex[iMarker]; iVertex++)
+        imposed[geometry->vertex[iMarker][iVertex]->GetNode()] = true;
+    }
+  }
+
+  /*--- The sparse pattern is that of the elements, store the blocks (j,i) of the
+   *    free nodes j that share an element with the imposed node i. ---*/
+  liftNode.clear();
+  liftPtr.assign(1, 0);
+  liftRow.clear();
+  liftBlock.clear();
+
+  vector<unsigned long> neighbors;
+
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+    if (!imposed[iPoint]) continue;
+
+    neighbors.clear();
+    for (unsigned short iElem = 0; iElem < geometry->node[iPoint]->GetnElem(); iElem++) {
+      auto elem = geometry->elem[geometry->node[iPoint]->GetElem(iElem)];
+      for (unsigned short iNode = 0; iNode < elem->GetnNodes(); iNode++) {
+        auto jPoint = elem->GetNode(iNode);
+        if (!imposed[jPoint]) neighbors.push_back(jPoint);
+      }
+    }
+    sort(neighbors.begin(), neighbors.end());
+    neighbors.erase(unique(neighbors.begin(), neighbors.end()), neighbors.end());
+
+    for (auto jPoint : neighbors) {
+      const auto block = Jacobian.GetBlock(jPoint, iPoint);
+      if (block == nullptr) continue;
+      liftRow.push_back(jPoint);
+      liftBlock.insert(liftBlock.end(), block, block+nVar*nVar);
+    }
+    liftNode.push_back(iPoint);
+    liftPtr.push_back(liftRow.size());
+  }
+
+}
+
+void CMeshSolver::AddLiftingResidual(){
+
+  /*--- The imposed displacement of node i is in its block of the right hand side. ---*/
+  for (auto k = 0ul; k < liftNode.size(); k++) {
+    const su2double* disp = LinSysRes.GetBlock(liftNode[k]);
+
+    for (auto index = liftPtr[k]; index < liftPtr[k+1]; index++) {
+      const su2double* block = &liftBlock[index*nVar*nVar];
+      for (unsigned short iVar = 0; iVar < nVar; iVar++)
+        for (unsigned short jVar = 0; jVar < nVar; jVar++)
+          LinSysRes(liftRow[index], iVar) -= block[iVar*nVar+jVar] * disp[jVar];
+    }
+  }
+
+}
+
 void CMeshSolver::SetDualTime_Mesh(void){
 
   nodes->Set_Solution_time_n1();
@@ -639,39 +734,35 @@ void CMeshSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig *
 
   /*--- Load data from the restart into correct containers. ---*/
 
-  unsigned long iPoint_Global, counter = 0;
+  unsigned long counter = 0;
 
-  for (iPoint_Global = 0; iPoint_Global < geometry[MESH_0]->GetGlobal_nPointDomain(); iPoint_Global++) {
+  for (const auto& globalToLocal : geometry[MESH_0]->GetGlobal_to_Local_Map()) {
 
-    /*--- Retrieve local index. If this node from the restart file lives
-     on the current processor, we will load and instantiate the vars. ---*/
+    /*--- The points of this rank, in the order of their data in the restart file. ---*/
 
-    auto iPoint_Local = geometry[MESH_0]->GetGlobal_to_Local_Point(iPoint_Global);
+    auto iPoint_Local = globalToLocal.second;
 
-    if (iPoint_Local >= 0) {
+    /*--- We need to store this point's data, so jump to the correct
+     offset in the buffer of data from the restart file and load it. ---*/
 
-      /*--- We need to store this point's data, so jump to the correct
-       offset in the buffer of data from the restart file and load it. ---*/
+    auto index = counter*Restart_Vars[1];
 
-      auto index = counter*Restart_Vars[1];
+    for (unsigned short iDim = 0; iDim < nDim; iDim++){
+      /*--- Update the coordinates of the mesh ---*/
+      su2double curr_coord = Restart_Data[index+iDim];
+      /// TODO: "Double deformation" in multizone adjoint if this is set here?
+      ///       In any case it should not be needed as deformation is called before other solvers
+      ///geometry[MESH_0]->node[iPoint_Local]->SetCoord(iDim, curr_coord);
 
-      for (unsigned short iDim = 0; iDim < nDim; iDim++){
-        /*--- Update the coordinates of the mesh ---*/
-        su2double curr_coord = Restart_Data[index+iDim];
-        /// TODO: "Double deformation" in multizone adjoint if this is set here?
-        ///       In any case it should not be needed as deformation is called before other solvers
-        ///geometry[MESH_0]->node[iPoint_Local]->SetCoord(iDim, curr_coord);
-
-        /*--- Store the displacements computed as the current coordinates
-         minus the coordinates of the reference mesh file ---*/
-        su2double displ = curr_coord - nodes->GetMesh_Coord(iPoint_Local, iDim);
-        nodes->SetSolution(iPoint_Local, iDim, displ);
-      }
-
-      /*--- Increment the overall counter for how many points have been loaded. ---*/
-      counter++;
+      /*--- Store the displacements computed as the current coordinates
+       minus the coordinates of the reference mesh file ---*/
+      su2double displ = curr_coord - nodes->GetMesh_Coord(iPoint_Local, iDim);
+      nodes->SetSolution(iPoint_Local, iDim, displ);
     }
 
+    /*--- Increment the overall counter for how many points have been loaded. ---*/
+    counter++;
+
   }
 
   /*--- Detect a wrong solution file ---*/
@@ -766,36 +857,32 @@ void CMeshSolver::Restart_OldGeometry(CGeometry *geometry, CConfig *config) {
 
     /*--- Load data from the restart into correct containers. ---*/
 
-    unsigned long iPoint_Global, counter = 0;
-
-    for (iPoint_Global = 0; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++) {
-
-      /*--- Retrieve local index. If this node from the restart file lives
-       on the current processor, we will load and instantiate the vars. ---*/
+    unsigned long counter = 0;
 
-      auto iPoint_Local = geometry->GetGlobal_to_Local_Point(iPoint_Global);
+    for (const auto& globalToLocal : geometry->GetGlobal_to_Local_Map()) {
 
-      if (iPoint_Local >= 0) {
+      /*--- The points of this rank, in the order of their data in the restart file. ---*/
 
-        /*--- We need to store this point's data, so jump to the correct
-         offset in the buffer of data from the restart file and load it. ---*/
+      auto iPoint_Local = globalToLocal.second;
 
-        auto index = counter*Restart_Vars[1];
+      /*--- We need to store this point's data, so jump to the correct
+       offset in the buffer of data from the restart file and load it. ---*/
 
-        for (unsigned short iDim = 0; iDim < nDim; iDim++) {
-          su2double curr_coord = Restart_Data[index+iDim];
-          su2double displ = curr_coord - nodes->GetMesh_Coord(iPoint_Local,iDim);
+      auto index = counter*Restart_Vars[1];
 
-          if(iStep==1)
-            nodes->Set_Solution_time_n(iPoint_Local, iDim, displ);
-          else
-            nodes->Set_Solution_time_n1(iPoint_Local, iDim, displ);
-        }
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+        su2double curr_coord = Restart_Data[index+iDim];
+        su2double displ = curr_coord - nodes->GetMesh_Coord(iPoint_Local,iDim);
 
-        /*--- Increment the overall counter for how many points have been loaded. ---*/
-        counter++;
+        if(iStep==1)
+          nodes->Set_Solution_time_n(iPoint_Local, iDim, displ);
+        else
+          nodes->Set_Solution_time_n1(iPoint_Local, iDim, displ);
       }
 
+      /*--- Increment the overall counter for how many points have been loaded. ---*/
+      counter++;
+
     }
 
     /*--- Detect a wrong solution file. ---*/
@@ -29,6 +29,7 @@
 #include "../../include/solvers/CNSSolver.hpp"
 #include "../../include/variables/CNSVariable.hpp"
 #include "../../../Common/include/toolboxes/printing_toolbox.hpp"
+#include "../../../Common/include/toolboxes/CSumReduction.hpp"
 
 CNSSolver::CNSSolver(void) : CEulerSolver() { }
 
@@ -181,33 +182,48 @@ void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, C
 
   CommonPreprocessing(geometry, solver_container, config, iMesh, iRKStep, RunTime_EqSystem, Output);
 
+  /*--- Compute the limiter in case we need it in the turbulence model or to limit the
+   *    viscous terms (check this logic with JST and 2nd order turbulence model).
+   *    It is computed together with the gradient it uses (reconstruction gradient). ---*/
+
+  const bool limiter = (iMesh == MESH_0) && (limiter_flow || limiter_turb || limiter_adjflow) && !Output && !van_albada;
+  const bool reconstruction = config->GetReconstructionGradientRequired() && (iMesh == MESH_0);
+
+  if (limiter) SetLimiterUpdate(geometry, config);
+
   /*--- Compute gradient for MUSCL reconstruction. ---*/
 
-  if (config->GetReconstructionGradientRequired() && (iMesh == MESH_0)) {
-    switch (config->GetKind_Gradient_Method_Recon()) {
-      case GREEN_GAUSS:
-        SetPrimitive_Gradient_GG(geometry, config, true); break;
-      case LEAST_SQUARES:
-      case WEIGHTED_LEAST_SQUARES:
-        SetPrimitive_Gradient_LS(geometry, config, true); break;
-      default: break;
+  if (reconstruction) {
+    if (limiter) {
+      SetPrimitive_Gradient_Limiter(geometry, config, true);
+    }
+    else {
+      switch (config->GetKind_Gradient_Method_Recon()) {
+        case GREEN_GAUSS:
+          SetPrimitive_Gradient_GG(geometry, config, true); break;
+        case LEAST_SQUARES:
+        case WEIGHTED_LEAST_SQUARES:
+          SetPrimitive_Gradient_LS(geometry, config, true); break;
+        default: break;
+      }
     }
   }
 
   /*--- Compute gradient of the primitive variables ---*/
 
-  if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
-    SetPrimitive_Gradient_GG(geometry, config);
-  }
-  else if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
-    SetPrimitive_Gradient_LS(geometry, config);
+  if (limiter && !reconstruction &&
+      ((config->GetKind_Gradient_Method() == GREEN_GAUSS) ||
+       (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES))) {
+    SetPrimitive_Gradient_Limiter(geometry, config, false);
   }
-
-  /*--- Compute the limiter in case we need it in the turbulence model or to limit the
-   *    viscous terms (check this logic with JST and 2nd order turbulence model) ---*/
-
-  if ((iMesh == MESH_0) && (limiter_flow || limiter_turb || limiter_adjflow) && !Output && !van_albada) {
-    SetPrimitive_Limiter(geometry, config);
+  else {
+    if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
+      SetPrimitive_Gradient_GG(geometry, config);
+    }
+    else if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
+      SetPrimitive_Gradient_LS(geometry, config);
+    }
+    if (limiter && !reconstruction) SetPrimitive_Limiter(geometry, config);
   }
 
   /*--- Evaluate the vorticity and strain rate magnitude ---*/
@@ -256,9 +272,7 @@ void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, C
   /*--- Compute the TauWall from the wall functions ---*/
 
   if (wall_functions) {
-    SU2_OMP_MASTER
     SetTauWall_WF(geometry, solver_container, config);
-    SU2_OMP_BARRIER
   }
 
 }
@@ -269,6 +283,11 @@ unsigned long CNSSolver::SetPrimitive_Variables(CSolver **solver_container, CCon
    *    further reduction if function is called in parallel ---*/
   unsigned long nonPhysicalPoints = 0;
 
+  /*--- Devirtualized point loop for the common fluid and transport models. ---*/
+
+  if (SetPrimitive_Variables_Specialized(solver_container, config, nonPhysicalPoints))
+    return nonPhysicalPoints;
+
   const unsigned short turb_model = config->GetKind_Turb_Model();
   const bool tkeNeeded = (turb_model == SST) || (turb_model == SST_SUST);
 
@@ -306,7 +325,34 @@ unsigned long CNSSolver::SetPrimitive_Variables(CSolver **solver_container, CCon
 void CNSSolver::Viscous_Residual(unsigned long iEdge, CGeometry *geometry, CSolver **solver_container,
                                  CNumerics *numerics, CConfig *config) {
 
-  const bool implicit  = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  const bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+
+  auto iPoint = geometry->edge[iEdge]->GetNode(0);
+  auto jPoint = geometry->edge[iEdge]->GetNode(1);
+
+  /*--- Compute and update residual ---*/
+
+  auto residual = ViscousEdgeResidual(iEdge, geometry, solver_container, numerics, config);
+
+  if (ReducerStrategy) {
+    EdgeFluxes.SubtractBlock(iEdge, residual);
+    if (implicit)
+      Jacobian.UpdateBlocksSub(iEdge, residual.jacobian_i, residual.jacobian_j);
+  }
+  else {
+    LinSysRes.SubtractBlock(iPoint, residual);
+    LinSysRes.AddBlock(jPoint, residual);
+
+    if (implicit)
+      Jacobian.UpdateBlocksSub(iEdge, iPoint, jPoint, residual.jacobian_i, residual.jacobian_j);
+  }
+
+}
+
+CNumerics::ResidualType<> CNSSolver::ViscousEdgeResidual(unsigned long iEdge, CGeometry *geometry,
+                                                         CSolver **solver_container,
+                                                         CNumerics *numerics, CConfig *config) {
+
   const bool tkeNeeded = (config->GetKind_Turb_Model() == SST) ||
                          (config->GetKind_Turb_Model() == SST_SUST);
 
@@ -323,6 +369,8 @@ void CNSSolver::Viscous_Residual(unsigned long iEdge, CGeometry *geometry, CSolv
 
   numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
 
+  numerics->SetEdgeGeometry(geometry->GetEdgeGeometry(iEdge));
+
   /*--- Primitive and secondary variables. ---*/
 
   numerics->SetPrimitive(nodes->GetPrimitive(iPoint),
@@ -347,23 +395,9 @@ void CNSSolver::Viscous_Residual(unsigned long iEdge, CGeometry *geometry, CSolv
   numerics->SetTauWall(nodes->GetTauWall(iPoint),
                        nodes->GetTauWall(iPoint));
 
-  /*--- Compute and update residual ---*/
-
-  auto residual = numerics->ComputeResidual(config);
-
-  if (ReducerStrategy) {
-    EdgeFluxes.SubtractBlock(iEdge, residual);
-    if (implicit)
-      Jacobian.UpdateBlocksSub(iEdge, residual.jacobian_i, residual.jacobian_j);
-  }
-  else {
-    LinSysRes.SubtractBlock(iPoint, residual);
-    LinSysRes.AddBlock(jPoint, residual);
-
-    if (implicit)
-      Jacobian.UpdateBlocksSub(iEdge, iPoint, jPoint, residual.jacobian_i, residual.jacobian_j);
-  }
+  /*--- Compute the residual, the caller updates the system. ---*/
 
+  return numerics->ComputeResidualPreacc(config);
 }
 
 void CNSSolver::Friction_Forces(CGeometry *geometry, CConfig *config) {
@@ -688,77 +722,42 @@ void CNSSolver::Friction_Forces(CGeometry *geometry, CConfig *config) {
 
 #ifdef HAVE_MPI
 
-  /*--- Add AllBound information using all the nodes ---*/
+  /*--- Add the AllBound information and the forces on the surfaces using all the nodes,
+   all the values are summed with a single reduction. ---*/
 
   if (config->GetComm_Level() == COMM_FULL) {
 
-    auto Allreduce = [](su2double x) {
-      su2double tmp = x; x = 0.0;
-      SU2_MPI::Allreduce(&tmp, &x, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-      return x;
-    };
-    AllBoundViscCoeff.CD = Allreduce(AllBoundViscCoeff.CD);
-    AllBoundViscCoeff.CL = Allreduce(AllBoundViscCoeff.CL);
-    AllBoundViscCoeff.CSF = Allreduce(AllBoundViscCoeff.CSF);
-    AllBoundViscCoeff.CEff = AllBoundViscCoeff.CL / (AllBoundViscCoeff.CD + EPS);
-
-    AllBoundViscCoeff.CMx = Allreduce(AllBoundViscCoeff.CMx);
-    AllBoundViscCoeff.CMy = Allreduce(AllBoundViscCoeff.CMy);
-    AllBoundViscCoeff.CMz = Allreduce(AllBoundViscCoeff.CMz);
-
-    AllBoundViscCoeff.CFx = Allreduce(AllBoundViscCoeff.CFx);
-    AllBoundViscCoeff.CFy = Allreduce(AllBoundViscCoeff.CFy);
-    AllBoundViscCoeff.CFz = Allreduce(AllBoundViscCoeff.CFz);
+    const int nMarkerMon = config->GetnMarker_Monitoring();
 
-    AllBoundViscCoeff.CoPx = Allreduce(AllBoundViscCoeff.CoPx);
-    AllBoundViscCoeff.CoPy = Allreduce(AllBoundViscCoeff.CoPy);
-    AllBoundViscCoeff.CoPz = Allreduce(AllBoundViscCoeff.CoPz);
+    CSumReduction reduction;
 
-    AllBoundViscCoeff.CT = Allreduce(AllBoundViscCoeff.CT);
-    AllBoundViscCoeff.CQ = Allreduce(AllBoundViscCoeff.CQ);
-    AllBoundViscCoeff.CMerit = AllBoundViscCoeff.CT / (AllBoundViscCoeff.CQ + EPS);
-
-    AllBound_HF_Visc = Allreduce(AllBound_HF_Visc);
-    AllBound_MaxHF_Visc = pow(Allreduce(pow(AllBound_MaxHF_Visc, MaxNorm)), 1.0/MaxNorm);
-
-  }
+    /*--- The norm of the maximum heat flux is the root of the sum of the powers. ---*/
 
-  /*--- Add the forces on the surfaces using all the nodes ---*/
+    su2double MaxHF_Norm = pow(AllBound_MaxHF_Visc, MaxNorm);
 
-  if (config->GetComm_Level() == COMM_FULL) {
-
-    int nMarkerMon = config->GetnMarker_Monitoring();
+    for (su2double* coeff : {&AllBoundViscCoeff.CD, &AllBoundViscCoeff.CL, &AllBoundViscCoeff.CSF, &AllBoundViscCoeff.CMx,
+                             &AllBoundViscCoeff.CMy, &AllBoundViscCoeff.CMz, &AllBoundViscCoeff.CoPx, &AllBoundViscCoeff.CoPy,
+                             &AllBoundViscCoeff.CoPz, &AllBoundViscCoeff.CFx, &AllBoundViscCoeff.CFy, &AllBoundViscCoeff.CFz,
+                             &AllBoundViscCoeff.CT, &AllBoundViscCoeff.CQ})
+      reduction.Add(*coeff);
+    reduction.Add(AllBound_HF_Visc);
+    reduction.Add(MaxHF_Norm);
 
-    /*--- Use the same buffer for all reductions. We could avoid the copy back into
-     *    the original variable by swaping pointers, but it is safer this way... ---*/
+    for (su2double* coeff : {SurfaceViscCoeff.CL, SurfaceViscCoeff.CD, SurfaceViscCoeff.CSF, SurfaceViscCoeff.CFx,
+                             SurfaceViscCoeff.CFy, SurfaceViscCoeff.CFz, SurfaceViscCoeff.CMx, SurfaceViscCoeff.CMy,
+                             SurfaceViscCoeff.CMz})
+      reduction.Add(coeff, nMarkerMon);
+    reduction.Add(Surface_HF_Visc, nMarkerMon);
+    reduction.Add(Surface_MaxHF_Visc, nMarkerMon);
 
-    su2double* buffer = new su2double [nMarkerMon];
+    reduction.Complete();
 
-    auto Allreduce_inplace = [buffer](int size, su2double* x) {
-      SU2_MPI::Allreduce(x, buffer, size, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-      for(int i=0; i<size; ++i) x[i] = buffer[i];
-    };
-
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CL);
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CD);
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CSF);
+    AllBoundViscCoeff.CEff = AllBoundViscCoeff.CL / (AllBoundViscCoeff.CD + EPS);
+    AllBoundViscCoeff.CMerit = AllBoundViscCoeff.CT / (AllBoundViscCoeff.CQ + EPS);
+    AllBound_MaxHF_Visc = pow(MaxHF_Norm, 1.0/MaxNorm);
 
     for (iMarker_Monitoring = 0; iMarker_Monitoring < nMarkerMon; iMarker_Monitoring++)
-      SurfaceViscCoeff.CEff[iMarker_Monitoring] = SurfaceViscCoeff.CL[iMarker_Monitoring] /
-                                                 (SurfaceViscCoeff.CD[iMarker_Monitoring] + EPS);
-
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CFx);
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CFy);
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CFz);
-
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CMx);
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CMy);
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CMz);
-
-    Allreduce_inplace(nMarkerMon, Surface_HF_Visc);
-    Allreduce_inplace(nMarkerMon, Surface_MaxHF_Visc);
-
-    delete [] buffer;
+      SurfaceViscCoeff.CEff[iMarker_Monitoring] = SurfaceViscCoeff.CL[iMarker_Monitoring] / (SurfaceViscCoeff.CD[iMarker_Monitoring] + EPS);
 
   }
 
@@ -1831,229 +1830,179 @@ void CNSSolver::BC_ConjugateHeat_Interface(CGeometry *geometry, CSolver **solver
 
 void CNSSolver::SetTauWall_WF(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
 
-  unsigned short iDim, jDim, iMarker;
-  unsigned long iVertex, iPoint, Point_Normal, counter;
-
-  su2double Area, div_vel, UnitNormal[3], *Normal;
-  su2double **grad_primvar, tau[3][3];
-
-  su2double Vel[3] = {0.0, 0.0, 0.0}, VelNormal, VelTang[3], VelTangMod, VelInfMod, WallDist[3], WallDistMod;
-  su2double T_Normal, P_Normal;
-  su2double Density_Wall, T_Wall, P_Wall, Lam_Visc_Wall, Tau_Wall = 0.0, Tau_Wall_Old = 0.0;
-  su2double *Coord, *Coord_Normal;
-  su2double diff, Delta;
-  su2double U_Tau, U_Plus, Gam, Beta, Phi, Q, Y_Plus_White, Y_Plus;
-  su2double TauElem[3], TauNormal, TauTangent[3], WallShearStress;
-  su2double Gas_Constant = config->GetGas_ConstantND();
-  su2double Cp = (Gamma / Gamma_Minus_One) * Gas_Constant;
+  /*--- Called by all threads, the stencils (wall point, normal neighbor, unit normal,
+   *    and distance) are built by the master thread the first time. ---*/
 
-  unsigned short max_iter = 10;
-  su2double tol = 1e-6;
+  SU2_OMP_MASTER
+  SetWallFunction_Stencil(geometry, config, false);
+  SU2_OMP_BARRIER
 
-  /*--- Get the freestream velocity magnitude for non-dim. purposes ---*/
+  const su2double Gas_Constant = config->GetGas_ConstantND();
+  const su2double Cp = (Gamma / Gamma_Minus_One) * Gas_Constant;
 
-  su2double *VelInf = config->GetVelocity_FreeStreamND();
-  VelInfMod = 0.0;
-  for (iDim = 0; iDim < nDim; iDim++)
-    VelInfMod += VelInf[iDim];
-  VelInfMod = sqrt(VelInfMod);
+  const unsigned short max_iter = 10;
+  const su2double tol = 1e-6;
 
   /*--- Compute the recovery factor ---*/
   // Double-check: laminar or turbulent Pr for this?
-  su2double Recovery = pow(config->GetPrandtl_Lam(), (1.0/3.0));
+  const su2double Recovery = pow(config->GetPrandtl_Lam(), (1.0/3.0));
 
   /*--- Typical constants from boundary layer theory ---*/
 
-  su2double kappa = 0.4;
-  su2double B = 5.5;
-
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-
-    if ((config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX) ||
-        (config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL) ) {
+  const su2double kappa = 0.4;
+  const su2double B = 5.5;
 
-      /*--- Identify the boundary by string name ---*/
+  for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
 
-      string Marker_Tag = config->GetMarker_All_TagBound(iMarker);
+    if ((config->GetMarker_All_KindBC(iMarker) != HEAT_FLUX) &&
+        (config->GetMarker_All_KindBC(iMarker) != ISOTHERMAL)) continue;
 
-      /*--- Get the specified wall heat flux from config ---*/
+    /*--- Loop over the stencils of the domain vertices of this marker, the vertices of
+     *    a marker are distinct, and markers are processed in order (as corners are shared). ---*/
 
-      // Wall_HeatFlux = config->GetWall_HeatFlux(Marker_Tag);
+    SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+    for (auto iStencil = WallFunc_Ptr[iMarker]; iStencil < WallFunc_Ptr[iMarker+1]; iStencil++) {
 
-      /*--- Loop over all of the vertices on this boundary marker ---*/
-
-      for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-        Point_Normal = geometry->vertex[iMarker][iVertex]->GetNormal_Neighbor();
+      unsigned short iDim, jDim;
 
-        /*--- Check if the node belongs to the domain (i.e, not a halo node)
-         and the neighbor is not part of the physical boundary ---*/
+      const unsigned long iPoint = WallFunc_Point[iStencil];
+      const unsigned long Point_Normal = WallFunc_Neighbor[iStencil];
+      const su2double* UnitNormal = &WallFunc_UnitNormal[iStencil*nDim];
+      const su2double WallDistMod = WallFunc_Dist[iStencil];
 
-        if (geometry->node[iPoint]->GetDomain()) {
+      /*--- Get the velocity, pressure, and temperature at the nearest
+       (normal) interior point. ---*/
 
-          /*--- Get coordinates of the current vertex and nearest normal point ---*/
+      const su2double P_Normal = nodes->GetPressure(Point_Normal);
+      const su2double T_Normal = nodes->GetTemperature(Point_Normal);
 
-          Coord = geometry->node[iPoint]->GetCoord();
-          Coord_Normal = geometry->node[Point_Normal]->GetCoord();
+      /*--- Compute the wall-parallel velocity at first point off the wall ---*/
 
-          /*--- Compute dual-grid area and boundary normal ---*/
-
-          Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
-
-          Area = 0.0;
-          for (iDim = 0; iDim < nDim; iDim++)
-            Area += Normal[iDim]*Normal[iDim];
-          Area = sqrt (Area);
-
-          for (iDim = 0; iDim < nDim; iDim++)
-            UnitNormal[iDim] = -Normal[iDim]/Area;
-
-          /*--- Get the velocity, pressure, and temperature at the nearest
-           (normal) interior point. ---*/
-
-          for (iDim = 0; iDim < nDim; iDim++)
-            Vel[iDim] = nodes->GetVelocity(Point_Normal,iDim);
-          P_Normal = nodes->GetPressure(Point_Normal);
-          T_Normal = nodes->GetTemperature(Point_Normal);
-
-          /*--- Compute the wall-parallel velocity at first point off the wall ---*/
-
-          VelNormal = 0.0;
-          for (iDim = 0; iDim < nDim; iDim++)
-            VelNormal += Vel[iDim] * UnitNormal[iDim];
-          for (iDim = 0; iDim < nDim; iDim++)
-            VelTang[iDim] = Vel[iDim] - VelNormal*UnitNormal[iDim];
-
-          VelTangMod = 0.0;
-          for (iDim = 0; iDim < nDim; iDim++)
-            VelTangMod += VelTang[iDim]*VelTang[iDim];
-          VelTangMod = sqrt(VelTangMod);
+      su2double Vel[3] = {0.0}, VelTang[3] = {0.0}, VelNormal = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++) {
+        Vel[iDim] = nodes->GetVelocity(Point_Normal,iDim);
+        VelNormal += Vel[iDim] * UnitNormal[iDim];
+      }
+      for (iDim = 0; iDim < nDim; iDim++)
+        VelTang[iDim] = Vel[iDim] - VelNormal*UnitNormal[iDim];
 
-          /*--- Compute normal distance of the interior point from the wall ---*/
+      su2double VelTangMod = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++)
+        VelTangMod += VelTang[iDim]*VelTang[iDim];
+      VelTangMod = sqrt(VelTangMod);
 
-          for (iDim = 0; iDim < nDim; iDim++)
-            WallDist[iDim] = (Coord[iDim] - Coord_Normal[iDim]);
+      /*--- Compute the wall temperature using the Crocco-Buseman equation ---*/
 
-          WallDistMod = 0.0;
-          for (iDim = 0; iDim < nDim; iDim++)
-            WallDistMod += WallDist[iDim]*WallDist[iDim];
-          WallDistMod = sqrt(WallDistMod);
+      const su2double T_Wall = T_Normal + Recovery*pow(VelTangMod,2.0)/(2.0*Cp);
 
-          /*--- Compute mach number ---*/
+      /*--- Extrapolate the pressure from the interior & compute the
+       wall density using the equation of state ---*/
 
-          // M_Normal = VelTangMod / sqrt(Gamma * Gas_Constant * T_Normal);
+      const su2double P_Wall = P_Normal;
+      const su2double Density_Wall = P_Wall/(Gas_Constant*T_Wall);
 
-          /*--- Compute the wall temperature using the Crocco-Buseman equation ---*/
+      const su2double Lam_Visc_Wall = nodes->GetLaminarViscosity(iPoint);
 
-          //T_Wall = T_Normal * (1.0 + 0.5*Gamma_Minus_One*Recovery*M_Normal*M_Normal);
-          T_Wall = T_Normal + Recovery*pow(VelTangMod,2.0)/(2.0*Cp);
+      /*--- The iterations start from the wall shear stress of the previous evaluation,
+       or the first time from the shear stress computed with the stress tensor. ---*/
 
-          /*--- Extrapolate the pressure from the interior & compute the
-           wall density using the equation of state ---*/
+      su2double Tau_Wall_Old = WallFunc_TauWall[iStencil];
 
-          P_Wall = P_Normal;
-          Density_Wall = P_Wall/(Gas_Constant*T_Wall);
+      if (Tau_Wall_Old <= 0.0) {
 
-          /*--- Compute the shear stress at the wall in the regular fashion
-           by using the stress tensor on the surface ---*/
+        /*--- Compute the shear stress at the wall in the regular fashion
+         by using the stress tensor on the surface ---*/
 
-          Lam_Visc_Wall = nodes->GetLaminarViscosity(iPoint);
-          grad_primvar  = nodes->GetGradient_Primitive(iPoint);
+        su2double **grad_primvar = nodes->GetGradient_Primitive(iPoint);
+        su2double tau[3][3] = {{0.0}}, TauElem[3] = {0.0}, TauTangent[3] = {0.0};
 
-          div_vel = 0.0;
-          for (iDim = 0; iDim < nDim; iDim++)
-            div_vel += grad_primvar[iDim+1][iDim];
+        su2double div_vel = 0.0;
+        for (iDim = 0; iDim < nDim; iDim++)
+          div_vel += grad_primvar[iDim+1][iDim];
 
-          for (iDim = 0; iDim < nDim; iDim++) {
-            for (jDim = 0 ; jDim < nDim; jDim++) {
-              Delta = 0.0; if (iDim == jDim) Delta = 1.0;
-              tau[iDim][jDim] = Lam_Visc_Wall*(  grad_primvar[jDim+1][iDim]
-                                               + grad_primvar[iDim+1][jDim]) -
-              TWO3*Lam_Visc_Wall*div_vel*Delta;
-            }
-            TauElem[iDim] = 0.0;
-            for (jDim = 0; jDim < nDim; jDim++)
-              TauElem[iDim] += tau[iDim][jDim]*UnitNormal[jDim];
+        for (iDim = 0; iDim < nDim; iDim++) {
+          for (jDim = 0 ; jDim < nDim; jDim++) {
+            const su2double Delta = (iDim == jDim)? 1.0 : 0.0;
+            tau[iDim][jDim] = Lam_Visc_Wall*(  grad_primvar[jDim+1][iDim]
+                                             + grad_primvar[iDim+1][jDim]) -
+            TWO3*Lam_Visc_Wall*div_vel*Delta;
           }
+          for (jDim = 0; jDim < nDim; jDim++)
+            TauElem[iDim] += tau[iDim][jDim]*UnitNormal[jDim];
+        }
 
-          /*--- Compute wall shear stress as the magnitude of the wall-tangential
-           component of the shear stress tensor---*/
-
-          TauNormal = 0.0;
-          for (iDim = 0; iDim < nDim; iDim++)
-            TauNormal += TauElem[iDim] * UnitNormal[iDim];
-
-          for (iDim = 0; iDim < nDim; iDim++)
-            TauTangent[iDim] = TauElem[iDim] - TauNormal * UnitNormal[iDim];
-
-          WallShearStress = 0.0;
-          for (iDim = 0; iDim < nDim; iDim++)
-            WallShearStress += TauTangent[iDim]*TauTangent[iDim];
-          WallShearStress = sqrt(WallShearStress);
-
-          /*--- Calculate the quantities from boundary layer theory and
-           iteratively solve for a new wall shear stress. Use the current wall
-           shear stress as a starting guess for the wall function. ---*/
-
-          Tau_Wall_Old = WallShearStress;
-          counter = 0; diff = 1.0;
-
-          while (diff > tol) {
+        /*--- Compute wall shear stress as the magnitude of the wall-tangential
+         component of the shear stress tensor---*/
 
-            /*--- Friction velocity and u+ ---*/
+        su2double TauNormal = 0.0;
+        for (iDim = 0; iDim < nDim; iDim++)
+          TauNormal += TauElem[iDim] * UnitNormal[iDim];
 
-            U_Tau = sqrt(Tau_Wall_Old/Density_Wall);
-            U_Plus = VelTangMod/U_Tau;
+        for (iDim = 0; iDim < nDim; iDim++)
+          TauTangent[iDim] = TauElem[iDim] - TauNormal * UnitNormal[iDim];
 
-            /*--- Gamma, Beta, Q, and Phi, defined by Nichols & Nelson (2004) ---*/
+        su2double WallShearStress = 0.0;
+        for (iDim = 0; iDim < nDim; iDim++)
+          WallShearStress += TauTangent[iDim]*TauTangent[iDim];
+        Tau_Wall_Old = sqrt(WallShearStress);
+      }
 
-            Gam  = Recovery*U_Tau*U_Tau/(2.0*Cp*T_Wall);
-            Beta = 0.0; // For adiabatic flows only
-            Q    = sqrt(Beta*Beta + 4.0*Gam);
-            Phi  = asin(-1.0*Beta/Q);
+      /*--- Calculate the quantities from boundary layer theory and
+       iteratively solve for a new wall shear stress. ---*/
 
-            /*--- Y+ defined by White & Christoph (compressibility and heat transfer) negative value for (2.0*Gam*U_Plus - Beta)/Q ---*/
+      su2double Tau_Wall = 0.0, diff = 1.0;
+      unsigned long counter = 0;
 
-            Y_Plus_White = exp((kappa/sqrt(Gam))*(asin((2.0*Gam*U_Plus - Beta)/Q) - Phi))*exp(-1.0*kappa*B);
+      while (diff > tol) {
 
-            /*--- Spalding's universal form for the BL velocity with the
-             outer velocity form of White & Christoph above. ---*/
+        /*--- Friction velocity and u+ ---*/
 
-            Y_Plus = U_Plus + Y_Plus_White - (exp(-1.0*kappa*B)*
-                                              (1.0 + kappa*U_Plus + kappa*kappa*U_Plus*U_Plus/2.0 +
-                                               kappa*kappa*kappa*U_Plus*U_Plus*U_Plus/6.0));
+        const su2double U_Tau = sqrt(Tau_Wall_Old/Density_Wall);
+        const su2double U_Plus = VelTangMod/U_Tau;
 
-            /*--- Calculate an updated value for the wall shear stress
-             using the y+ value, the definition of y+, and the definition of
-             the friction velocity. ---*/
+        /*--- Gamma, Beta, Q, and Phi, defined by Nichols & Nelson (2004) ---*/
 
-            Tau_Wall = (1.0/Density_Wall)*pow(Y_Plus*Lam_Visc_Wall/WallDistMod,2.0);
+        const su2double Gam  = Recovery*U_Tau*U_Tau/(2.0*Cp*T_Wall);
+        const su2double Beta = 0.0; // For adiabatic flows only
+        const su2double Q    = sqrt(Beta*Beta + 4.0*Gam);
+        const su2double Phi  = asin(-1.0*Beta/Q);
 
-            /*--- Difference between the old and new Tau. Update old value. ---*/
+        /*--- Y+ defined by White & Christoph (compressibility and heat transfer) negative value for (2.0*Gam*U_Plus - Beta)/Q ---*/
 
-            diff = fabs(Tau_Wall-Tau_Wall_Old);
-            Tau_Wall_Old += 0.25*(Tau_Wall-Tau_Wall_Old);
+        const su2double Y_Plus_White = exp((kappa/sqrt(Gam))*(asin((2.0*Gam*U_Plus - Beta)/Q) - Phi))*exp(-1.0*kappa*B);
 
-            counter++;
-            if (counter > max_iter) {
-              cout << "WARNING: Tau_Wall evaluation has not converged in solver_direct_mean.cpp" << endl;
-              cout << Tau_Wall_Old << " " << Tau_Wall << " " << diff << endl;
-              break;
-            }
+        /*--- Spalding's universal form for the BL velocity with the
+         outer velocity form of White & Christoph above. ---*/
 
-          }
+        const su2double Y_Plus = U_Plus + Y_Plus_White - (exp(-1.0*kappa*B)*
+                                          (1.0 + kappa*U_Plus + kappa*kappa*U_Plus*U_Plus/2.0 +
+                                           kappa*kappa*kappa*U_Plus*U_Plus*U_Plus/6.0));
 
+        /*--- Calculate an updated value for the wall shear stress
+         using the y+ value, the definition of y+, and the definition of
+         the friction velocity. ---*/
 
-          /*--- Store this value for the wall shear stress at the node.  ---*/
+        Tau_Wall = (1.0/Density_Wall)*pow(Y_Plus*Lam_Visc_Wall/WallDistMod,2.0);
 
-          nodes->SetTauWall(iPoint,Tau_Wall);
+        /*--- Difference between the old and new Tau. Update old value. ---*/
 
+        diff = fabs(Tau_Wall-Tau_Wall_Old);
+        Tau_Wall_Old += 0.25*(Tau_Wall-Tau_Wall_Old);
 
+        counter++;
+        if (counter > max_iter) {
+          cout << "WARNING: Tau_Wall evaluation has not converged in solver_direct_mean.cpp" << endl;
+          cout << Tau_Wall_Old << " " << Tau_Wall << " " << diff << endl;
+          break;
         }
 
       }
 
+      /*--- Store this value for the wall shear stress at the node, and for the next evaluation. ---*/
+
+      nodes->SetTauWall(iPoint,Tau_Wall);
+      WallFunc_TauWall[iStencil] = Tau_Wall;
+
     }
   }
 
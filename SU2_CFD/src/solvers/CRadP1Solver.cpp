@@ -27,6 +27,7 @@
 
 #include "../../include/solvers/CRadP1Solver.hpp"
 #include "../../include/variables/CRadP1Variable.hpp"
+#include "../../../Common/include/omp_structure.hpp"
 
 CRadP1Solver::CRadP1Solver(void) : CRadSolver() {
 
@@ -74,7 +75,7 @@ CRadP1Solver::CRadP1Solver(CGeometry* geometry, CConfig *config) : CRadSolver(ge
     }
 
     if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (P1 radiation equation)." << endl;
-    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config, ReducerStrategy);
 
   }
 
@@ -84,6 +85,9 @@ CRadP1Solver::CRadP1Solver(CGeometry* geometry, CConfig *config) : CRadSolver(ge
   LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
   LinSysAux.Initialize(nPoint, nPointDomain, nVar, 0.0);
 
+  if (ReducerStrategy)
+    EdgeFluxes.Initialize(geometry->GetnEdge(), geometry->GetnEdge(), nVar, nullptr);
+
   /*--- Read farfield conditions from config ---*/
   Temperature_Inf = config->GetTemperature_FreeStreamND();
 
@@ -162,12 +166,9 @@ CRadP1Solver::~CRadP1Solver(void) {
 
 void CRadP1Solver::Preprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iMesh, unsigned short iRKStep, unsigned short RunTime_EqSystem, bool Output) {
 
-  unsigned long iPoint;
-
-  /*--- Initialize the residual vector ---*/
-  for (iPoint = 0; iPoint < nPoint; iPoint ++) {
-    LinSysRes.SetBlock_Zero(iPoint);
-  }
+  /*--- Initialize the residual vector, and the edge fluxes of the reducer strategy ---*/
+  LinSysRes.SetValZero();
+  if (ReducerStrategy) EdgeFluxes.SetValZero();
 
   /*--- Initialize the Jacobian matrix ---*/
   Jacobian.SetValZero();
@@ -185,23 +186,22 @@ void CRadP1Solver::Preprocessing(CGeometry *geometry, CSolver **solver_container
 
 void CRadP1Solver::Postprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iMesh) {
 
-  unsigned long iPoint;
-  su2double Energy, Temperature;
-  su2double SourceTerm, SourceTerm_Derivative;
+  const CVariable* flowNodes = solver_container[FLOW_SOL]->GetNodes();
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
     /*--- Retrieve the radiative energy ---*/
-    Energy = nodes->GetSolution(iPoint, 0);
+    su2double Energy = nodes->GetSolution(iPoint, 0);
 
     /*--- Retrieve temperature from the flow solver ---*/
-    Temperature = solver_container[FLOW_SOL]->GetNodes()->GetPrimitive(iPoint,nDim+1);
+    su2double Temperature = flowNodes->GetPrimitive(iPoint,nDim+1);
 
     /*--- Compute the divergence of the radiative flux ---*/
-    SourceTerm = Absorption_Coeff*(Energy - 4.0*STEFAN_BOLTZMANN*pow(Temperature,4.0));
+    su2double SourceTerm = Absorption_Coeff*(Energy - 4.0*STEFAN_BOLTZMANN*pow(Temperature,4.0));
 
     /*--- Compute the derivative of the source term with respect to the temperature ---*/
-    SourceTerm_Derivative =  - 16.0*Absorption_Coeff*STEFAN_BOLTZMANN*pow(Temperature,3.0);
+    su2double SourceTerm_Derivative =  - 16.0*Absorption_Coeff*STEFAN_BOLTZMANN*pow(Temperature,3.0);
 
     /*--- Store the source term and its derivative ---*/
     nodes->SetRadiative_SourceTerm(iPoint, 0, SourceTerm);
@@ -214,16 +214,30 @@ void CRadP1Solver::Postprocessing(CGeometry *geometry, CSolver **solver_containe
 void CRadP1Solver::Viscous_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
                                     CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
 
-  CNumerics* numerics = numerics_container[VISC_TERM];
+  /*--- Pick one numerics object per thread. ---*/
+  CNumerics* numerics = numerics_container[VISC_TERM + omp_get_thread_num()*MAX_TERMS];
+
+  /*--- Static arrays for the residual and Jacobians of each edge (thread safety). ---*/
+  su2double residual[MAXNVAR] = {0.0}, jacobian_i[MAXNVAR][MAXNVAR] = {{0.0}}, jacobian_j[MAXNVAR][MAXNVAR] = {{0.0}};
+  su2double *Jac_i[MAXNVAR], *Jac_j[MAXNVAR];
+  for (unsigned short iVar = 0; iVar < MAXNVAR; iVar++) {
+    Jac_i[iVar] = jacobian_i[iVar];
+    Jac_j[iVar] = jacobian_j[iVar];
+  }
 
-  unsigned long iEdge, iPoint, jPoint;
+  /*--- Loop over edge colors. ---*/
+  for (auto color : EdgeColoring)
+  {
+  /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+  SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+  for(auto k = 0ul; k < color.size; ++k) {
 
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+    auto iEdge = color.indices[k];
 
     /*--- Points in edge ---*/
 
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
+    unsigned long iPoint = geometry->edge[iEdge]->GetNode(0);
+    unsigned long jPoint = geometry->edge[iEdge]->GetNode(1);
 
     /*--- Points coordinates, and normal vector ---*/
 
@@ -238,14 +252,25 @@ void CRadP1Solver::Viscous_Residual(CGeometry *geometry, CSolver **solver_contai
 
     /*--- Compute residual, and Jacobians ---*/
 
-    numerics->ComputeResidual(Residual, Jacobian_i, Jacobian_j, config);
+    numerics->ComputeResidual(residual, Jac_i, Jac_j, config);
 
     /*--- Add and subtract residual, and update Jacobian ---*/
 
-    LinSysRes.SubtractBlock(iPoint, Residual);
-    LinSysRes.AddBlock(jPoint, Residual);
-    Jacobian.UpdateBlocksSub(iEdge, iPoint, jPoint, Jacobian_i, Jacobian_j);
+    if (ReducerStrategy) {
+      EdgeFluxes.SubtractBlock(iEdge, residual);
+      Jacobian.UpdateBlocksSub(iEdge, Jac_i, Jac_j);
+    }
+    else {
+      LinSysRes.SubtractBlock(iPoint, residual);
+      LinSysRes.AddBlock(jPoint, residual);
+      Jacobian.UpdateBlocksSub(iEdge, iPoint, jPoint, Jac_i, Jac_j);
+    }
+  }
+  } // end color loop
 
+  if (ReducerStrategy) {
+    SumEdgeFluxes(geometry);
+    Jacobian.SetDiagonalAsColumnSum();
   }
 
 }
@@ -253,8 +278,15 @@ void CRadP1Solver::Viscous_Residual(CGeometry *geometry, CSolver **solver_contai
 void CRadP1Solver::Source_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
                                   CConfig *config, unsigned short iMesh) {
 
-  CNumerics* numerics = numerics_container[SOURCE_FIRST_TERM];
+  /*--- Pick one numerics object per thread. ---*/
+  CNumerics* numerics = numerics_container[SOURCE_FIRST_TERM + omp_get_thread_num()*MAX_TERMS];
+
+  /*--- Static arrays for the residual and Jacobian of each point (thread safety). ---*/
+  su2double residual[MAXNVAR] = {0.0}, jacobian_i[MAXNVAR][MAXNVAR] = {{0.0}};
+  su2double *Jac_i[MAXNVAR];
+  for (unsigned short iVar = 0; iVar < MAXNVAR; iVar++) Jac_i[iVar] = jacobian_i[iVar];
 
+  SU2_OMP_FOR_STAT(omp_chunk_size)
   for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
     /*--- Conservative variables w/o reconstruction ---*/
@@ -271,12 +303,12 @@ void CRadP1Solver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
 
     /*--- Compute the source term ---*/
 
-    numerics->ComputeResidual(Residual, Jacobian_i, config);
+    numerics->ComputeResidual(residual, Jac_i, config);
 
     /*--- Subtract residual and the Jacobian ---*/
 
-    LinSysRes.SubtractBlock(iPoint, Residual);
-    Jacobian.SubtractBlock2Diag(iPoint, Jacobian_i);
+    LinSysRes.SubtractBlock(iPoint, residual);
+    Jacobian.SubtractBlock2Diag(iPoint, Jac_i);
 
   }
 
@@ -518,160 +550,191 @@ void CRadP1Solver::BC_Marshak(CGeometry *geometry, CSolver **solver_container, C
 
 void CRadP1Solver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
 
-  unsigned short iVar;
-  unsigned long iPoint, total_index, IterLinSol = 0;
-  su2double Vol;
-  su2double Delta;
+  /*--- Set shared residual variables to 0 and declare
+   *    local ones for current thread to work on. ---*/
 
-  /*--- Set maximum residual to zero ---*/
-
-  for (iVar = 0; iVar < nVar; iVar++) {
+  SU2_OMP_MASTER
+  for (unsigned short iVar = 0; iVar < nVar; iVar++) {
     SetRes_RMS(iVar, 0.0);
     SetRes_Max(iVar, 0.0, 0);
   }
+  SU2_OMP_BARRIER
+
+  su2double resMax[MAXNVAR] = {0.0}, resRMS[MAXNVAR] = {0.0};
+  const su2double* coordMax[MAXNVAR] = {nullptr};
+  unsigned long idxMax[MAXNVAR] = {0};
+
   /*--- Build implicit system ---*/
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+  SU2_OMP(for schedule(static,omp_chunk_size) nowait)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
     /*--- Read the volume ---*/
 
-    Vol = geometry->node[iPoint]->GetVolume();
+    su2double Vol = geometry->node[iPoint]->GetVolume();
 
     /*--- Modify matrix diagonal to assure diagonal dominance ---*/
 
     if (nodes->GetDelta_Time(iPoint) != 0.0) {
-      Delta = Vol / nodes->GetDelta_Time(iPoint);
+      su2double Delta = Vol / nodes->GetDelta_Time(iPoint);
       Jacobian.AddVal2Diag(iPoint, Delta);
     }
     else {
       Jacobian.SetVal2Diag(iPoint, 1.0);
-      for (iVar = 0; iVar < nVar; iVar++) {
-        total_index = iPoint*nVar + iVar;
-        LinSysRes[total_index] = 0.0;
-      }
+      LinSysRes.SetBlock_Zero(iPoint);
     }
 
     /*--- Right hand side of the system (-Residual) and initial guess (x = 0) ---*/
 
-    for (iVar = 0; iVar < nVar; iVar++) {
-      total_index = iPoint*nVar+iVar;
-      LinSysRes[total_index] = - (LinSysRes[total_index]);
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      unsigned long total_index = iPoint*nVar+iVar;
+      LinSysRes[total_index] = - LinSysRes[total_index];
       LinSysSol[total_index] = 0.0;
-      AddRes_RMS(iVar, LinSysRes[total_index]*LinSysRes[total_index]);
-      AddRes_Max(iVar, fabs(LinSysRes[total_index]), geometry->node[iPoint]->GetGlobalIndex(), geometry->node[iPoint]->GetCoord());
+
+      su2double Res = fabs(LinSysRes[total_index]);
+      resRMS[iVar] += Res*Res;
+      if (Res > resMax[iVar]) {
+        resMax[iVar] = Res;
+        idxMax[iVar] = iPoint;
+        coordMax[iVar] = geometry->node[iPoint]->GetCoord();
+      }
     }
   }
+  SU2_OMP_CRITICAL
+  for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+    AddRes_RMS(iVar, resRMS[iVar]);
+    AddRes_Max(iVar, resMax[iVar], geometry->node[idxMax[iVar]]->GetGlobalIndex(), coordMax[iVar]);
+  }
 
   /*--- Initialize residual and solution at the ghost points ---*/
 
-  for (iPoint = nPointDomain; iPoint < nPoint; iPoint++) {
-    for (iVar = 0; iVar < nVar; iVar++) {
-      total_index = iPoint*nVar + iVar;
-      LinSysRes[total_index] = 0.0;
-      LinSysSol[total_index] = 0.0;
-    }
+  SU2_OMP(sections)
+  {
+    SU2_OMP(section)
+    for (unsigned long iPoint = nPointDomain; iPoint < nPoint; iPoint++)
+      LinSysRes.SetBlock_Zero(iPoint);
+
+    SU2_OMP(section)
+    for (unsigned long iPoint = nPointDomain; iPoint < nPoint; iPoint++)
+      LinSysSol.SetBlock_Zero(iPoint);
   }
 
   /*--- Solve or smooth the linear system ---*/
 
-  IterLinSol = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
+  auto iter = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
+  SU2_OMP_MASTER
+  {
+    SetIterLinSolver(iter);
+    SetResLinSolver(System.GetResidual());
+  }
+  SU2_OMP_BARRIER
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-    for (iVar = 0; iVar < nVar; iVar++) {
-      nodes->AddSolution(iPoint, iVar, LinSysSol[iPoint*nVar+iVar]);
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      nodes->AddSolution(iPoint,iVar, LinSysSol[iPoint*nVar+iVar]);
     }
   }
 
-  /*--- The the number of iterations of the linear solver ---*/
-
-  SetIterLinSolver(IterLinSol);
-
-  /*--- MPI solution ---*/
+  SU2_OMP_MASTER
+  {
+    /*--- MPI solution ---*/
 
-  InitiateComms(geometry, config, SOLUTION);
-  CompleteComms(geometry, config, SOLUTION);
+    InitiateComms(geometry, config, SOLUTION);
+    CompleteComms(geometry, config, SOLUTION);
 
-  /*--- Compute the root mean square residual ---*/
+    /*--- Compute the root mean square residual ---*/
 
-  SetResidual_RMS(geometry, config);
+    SetResidual_RMS(geometry, config);
+  }
+  SU2_OMP_BARRIER
 
 }
 
 void CRadP1Solver::SetTime_Step(CGeometry *geometry, CSolver **solver_container, CConfig *config,
                                unsigned short iMesh, unsigned long Iteration) {
 
-  unsigned short iDim, iMarker;
-  unsigned long iEdge, iVertex, iPoint = 0, jPoint = 0;
-  su2double *Normal, Area, Vol, Lambda;
-  su2double Global_Delta_Time = 1E6, Local_Delta_Time = 0.0, K_v = 0.25;
-  su2double CFL = config->GetCFL_Rad();
-  su2double GammaP1 = 1.0 / (3.0*(Absorption_Coeff + Scattering_Coeff));
-
-  /*--- Compute spectral radius based on thermal conductivity ---*/
+  const su2double K_v = 0.25;
+  const su2double CFL = config->GetCFL_Rad();
+  const su2double GammaP1 = 1.0 / (3.0*(Absorption_Coeff + Scattering_Coeff));
 
-  Min_Delta_Time = 1.E6; Max_Delta_Time = 0.0;
+  /*--- Init thread-shared variables to compute min/max values.
+   *    Critical sections are used for this instead of reduction
+   *    clauses for compatibility with OpenMP 2.0 (Windows...). ---*/
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-    nodes->SetMax_Lambda_Visc(iPoint, 0.0);
+  SU2_OMP_MASTER
+  {
+    Min_Delta_Time = 1.E6; Max_Delta_Time = 0.0;
   }
+  SU2_OMP_BARRIER
+
+  /*--- Compute spectral radius based on thermal conductivity, loop over the
+   *    neighbours of each point (interior edges) to avoid race conditions. ---*/
 
-  /*--- Loop interior edges ---*/
+  SU2_OMP_FOR_DYN(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+    nodes->SetMax_Lambda_Visc(iPoint, 0.0);
 
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
+    for (unsigned short iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); iNeigh++) {
 
-    /*--- Get the edge's normal vector to compute the edge's area ---*/
-    Normal = geometry->edge[iEdge]->GetNormal();
-    Area = 0; for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim]; Area = sqrt(Area);
+      unsigned long iEdge = geometry->node[iPoint]->GetEdge(iNeigh);
 
-    /*--- Viscous contribution ---*/
+      /*--- Get the edge's normal vector to compute the edge's area ---*/
+      const su2double* Normal = geometry->edge[iEdge]->GetNormal();
+      su2double Area = 0.0;
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim];
 
-    Lambda = GammaP1*Area*Area;
-    if (geometry->node[iPoint]->GetDomain()) nodes->AddMax_Lambda_Visc(iPoint, Lambda);
-    if (geometry->node[jPoint]->GetDomain()) nodes->AddMax_Lambda_Visc(jPoint, Lambda);
+      /*--- Viscous contribution (Area is already squared) ---*/
 
+      nodes->AddMax_Lambda_Visc(iPoint, GammaP1*Area);
+    }
   }
 
   /*--- Loop boundary edges ---*/
 
-  for (iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
-    for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+  for (unsigned short iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
+
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+    for (unsigned long iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
 
       /*--- Point identification, Normal vector and area ---*/
 
-      iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-      Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
-      Area = 0.0; for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim]; Area = sqrt(Area);
+      unsigned long iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
 
-      /*--- Viscous contribution ---*/
+      if (!geometry->node[iPoint]->GetDomain()) continue;
 
-      Lambda = GammaP1*Area*Area;
-      if (geometry->node[iPoint]->GetDomain()) nodes->AddMax_Lambda_Visc(iPoint, Lambda);
+      const su2double* Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+      su2double Area = 0.0;
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim];
 
+      /*--- Viscous contribution (Area is already squared) ---*/
+
+      nodes->AddMax_Lambda_Visc(iPoint, GammaP1*Area);
     }
   }
 
   /*--- Each element uses their own speed, steady state simulation ---*/
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+  su2double minDt = 1.E6, maxDt = 0.0;
+
+  SU2_OMP(for schedule(static,omp_chunk_size) nowait)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
-    Vol = geometry->node[iPoint]->GetVolume();
+    su2double Vol = geometry->node[iPoint]->GetVolume();
 
     if (Vol != 0.0) {
 
       /*--- Time step setting method ---*/
 
-       Local_Delta_Time = CFL*K_v*Vol*Vol/ nodes->GetMax_Lambda_Visc(iPoint);
+      su2double Local_Delta_Time = CFL*K_v*Vol*Vol/ nodes->GetMax_Lambda_Visc(iPoint);
 
       /*--- Min-Max-Logic ---*/
 
-      Global_Delta_Time = min(Global_Delta_Time, Local_Delta_Time);
-      Min_Delta_Time = min(Min_Delta_Time, Local_Delta_Time);
-      Max_Delta_Time = max(Max_Delta_Time, Local_Delta_Time);
-      if (Local_Delta_Time > config->GetMax_DeltaTime())
-        Local_Delta_Time = config->GetMax_DeltaTime();
+      minDt = min(minDt, Local_Delta_Time);
+      maxDt = max(maxDt, Local_Delta_Time);
+
+      Local_Delta_Time = min(Local_Delta_Time, config->GetMax_DeltaTime());
 
       nodes->SetDelta_Time(iPoint, Local_Delta_Time);
     }
@@ -679,8 +742,15 @@ void CRadP1Solver::SetTime_Step(CGeometry *geometry, CSolver **solver_container,
       nodes->SetDelta_Time(iPoint, 0.0);
     }
   }
+  SU2_OMP_CRITICAL
+  {
+    Min_Delta_Time = min(Min_Delta_Time, minDt);
+    Max_Delta_Time = max(Max_Delta_Time, maxDt);
+  }
+  SU2_OMP_BARRIER
 
   /*--- Compute the max and the min dt (in parallel) ---*/
+  SU2_OMP_MASTER
   if (config->GetComm_Level() == COMM_FULL) {
 
     su2double sbuf_time;
@@ -690,5 +760,6 @@ void CRadP1Solver::SetTime_Step(CGeometry *geometry, CSolver **solver_container,
     sbuf_time = Max_Delta_Time;
     SU2_MPI::Allreduce(&sbuf_time, &Max_Delta_Time, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
   }
+  SU2_OMP_BARRIER
 
 }
@@ -44,6 +44,11 @@
 #include "../../../Common/include/toolboxes/MMS/CUserDefinedSolution.hpp"
 #include "../../../Common/include/toolboxes/printing_toolbox.hpp"
 #include "../../../Common/include/toolboxes/C1DInterpolation.hpp"
+#include "../../../Common/include/toolboxes/compression_toolbox.hpp"
+#include "../../../Common/include/toolboxes/CLinearPartitioner.hpp"
+#include "../../../Common/include/adt_structure.hpp"
+#include "../../../Common/include/toolboxes/CSumReduction.hpp"
+#include "../../../Common/include/toolboxes/CRegionProfiler.hpp"
 #include "../../include/CMarkerProfileReaderFVM.hpp"
 
 
@@ -1555,12 +1560,18 @@ void CSolver::CompletePeriodicComms(CGeometry *geometry,
        the order they arrive. ---*/
 
 #ifdef HAVE_MPI
-      /*--- Once we have recv'd a message, get the source rank. ---*/
-      int ind;
-      SU2_MPI::Waitany(geometry->nPeriodicRecv,
-                       geometry->req_PeriodicRecv,
-                       &ind, &status);
-      source = status.MPI_SOURCE;
+      /*--- The data from this rank was copied when sending, it is
+       stored first. Otherwise, once we have recv'd a message, get
+       the source rank. ---*/
+      if ((iMessage == 0) && (geometry->iPeriodicRecvSelf >= 0)) {
+        source = rank;
+      } else {
+        int ind;
+        SU2_MPI::Waitany(geometry->GetnPeriodicRecvMPI(),
+                         geometry->req_PeriodicRecv,
+                         &ind, &status);
+        source = status.MPI_SOURCE;
+      }
 #else
       /*--- For serial calculations, we know the rank. ---*/
       source = rank;
@@ -1891,7 +1902,7 @@ void CSolver::CompletePeriodicComms(CGeometry *geometry,
      data in the loop above at this point. ---*/
 
 #ifdef HAVE_MPI
-    SU2_MPI::Waitall(geometry->nPeriodicSend,
+    SU2_MPI::Waitall(geometry->GetnPeriodicSendMPI(),
                      geometry->req_PeriodicSend,
                      MPI_STATUS_IGNORE);
 #endif
@@ -1902,10 +1913,56 @@ void CSolver::CompletePeriodicComms(CGeometry *geometry,
 
 }
 
+void CSolver::ReportVariableMemory(const CGeometry *geometry) const {
+
+  vector<pair<string, unsigned long> > memory;
+  base_nodes->GetContainerMemory(memory);
+
+  /*--- All ranks list the same containers, the sizes can be reduced directly. ---*/
+
+  const auto nContainer = memory.size();
+  vector<unsigned long> sizeLocal(nContainer), sizeGlobal(nContainer);
+
+  for (auto i = 0ul; i < nContainer; ++i) sizeLocal[i] = memory[i].second;
+
+  SU2_MPI::Allreduce(sizeLocal.data(), sizeGlobal.data(), nContainer, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+
+  if (rank != MASTER_NODE) return;
+
+  const su2double nPointGlobal = max<su2double>(geometry->GetGlobal_nPoint(), 1.0);
+  unsigned long total = 0;
+
+  cout << endl << "-- Memory of the variables of the solver (all ranks, including halos):" << endl;
+
+  PrintingToolbox::CTablePrinter MemoryTable(&cout);
+  MemoryTable.AddColumn("Container", 24);
+  MemoryTable.AddColumn("Size [MB]", 14);
+  MemoryTable.AddColumn("Bytes per point", 16);
+  MemoryTable.SetAlign(PrintingToolbox::CTablePrinter::RIGHT);
+  MemoryTable.PrintHeader();
+
+  for (auto i = 0ul; i < nContainer; ++i) {
+    if (sizeGlobal[i] == 0) continue;
+    total += sizeGlobal[i];
+    MemoryTable << memory[i].first << su2double(sizeGlobal[i])/1048576.0 << su2double(sizeGlobal[i])/nPointGlobal;
+  }
+  MemoryTable.PrintFooter();
+  MemoryTable << "Total" << su2double(total)/1048576.0 << su2double(total)/nPointGlobal;
+  MemoryTable.PrintFooter();
+}
+
 void CSolver::InitiateComms(CGeometry *geometry,
                             CConfig *config,
                             unsigned short commType) {
 
+  /*--- The buffers are shared, a pending exchange is completed first. ---*/
+
+  CompletePendingComms(geometry, config);
+
+  SU2_PROFILE_REGION("MPI communication");
+
+  CCommProfiler::SetKind(CCommProfiler::SOLVER_COMMS);
+
   /*--- Local variables ---*/
 
   unsigned short iVar, iDim;
@@ -1943,6 +2000,10 @@ void CSolver::InitiateComms(CGeometry *geometry,
       COUNT_PER_POINT  = nPrimVarGrad;
       MPI_TYPE         = COMM_TYPE_DOUBLE;
       break;
+    case PRIMITIVE_GRAD_LIMITER:
+      COUNT_PER_POINT  = nPrimVarGrad*(nDim*2+1);
+      MPI_TYPE         = COMM_TYPE_DOUBLE;
+      break;
     case SOLUTION_EDDY:
       COUNT_PER_POINT  = nVar+1;
       MPI_TYPE         = COMM_TYPE_DOUBLE;
@@ -2083,6 +2144,15 @@ void CSolver::InitiateComms(CGeometry *geometry,
             for (iVar = 0; iVar < nPrimVarGrad; iVar++)
               bufDSend[buf_offset+iVar] = base_nodes->GetLimiter_Primitive(iPoint, iVar);
             break;
+          case PRIMITIVE_GRAD_LIMITER:
+            for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+              for (iDim = 0; iDim < nDim; iDim++) {
+                bufDSend[buf_offset+iVar*nDim+iDim] = base_nodes->GetGradient_Primitive(iPoint, iVar, iDim);
+                bufDSend[buf_offset+iVar*nDim+iDim+nDim*nPrimVarGrad] = base_nodes->GetGradient_Reconstruction(iPoint, iVar, iDim);
+              }
+              bufDSend[buf_offset+iVar+2*nDim*nPrimVarGrad] = base_nodes->GetLimiter_Primitive(iPoint, iVar);
+            }
+            break;
           case AUXVAR_GRADIENT:
             for (iDim = 0; iDim < nDim; iDim++)
               bufDSend[buf_offset+iDim] = base_nodes->GetAuxVarGradient(iPoint, iDim);
@@ -2149,13 +2219,16 @@ void CSolver::CompleteComms(CGeometry *geometry,
                             CConfig *config,
                             unsigned short commType) {
 
+  SU2_PROFILE_REGION("MPI communication");
+
+  if (commPending && (commType == pendingCommType)) commPending = false;
+
   /*--- Local variables ---*/
 
   unsigned short iDim, iVar;
   unsigned long iPoint, iRecv, nRecv, msg_offset, buf_offset;
 
-  int ind, source, iMessage, jRecv;
-  SU2_MPI::Status status;
+  int iMessage, jRecv;
 
   /*--- Set some local pointers to make access simpler. ---*/
 
@@ -2169,18 +2242,9 @@ void CSolver::CompleteComms(CGeometry *geometry,
     for (iMessage = 0; iMessage < geometry->nP2PRecv; iMessage++) {
 
       /*--- For efficiency, recv the messages dynamically based on
-       the order they arrive. ---*/
-
-      SU2_MPI::Waitany(geometry->nP2PRecv, geometry->req_P2PRecv,
-                       &ind, &status);
-
-      /*--- Once we have recv'd a message, get the source rank. ---*/
+       the order they arrive, we know the offsets based on the message. ---*/
 
-      source = status.MPI_SOURCE;
-
-      /*--- We know the offsets based on the source rank. ---*/
-
-      jRecv = geometry->P2PRecv2Neighbor[source];
+      jRecv = geometry->WaitAnyP2PRecv();
 
       /*--- Get the offset in the buffer for the start of this message. ---*/
 
@@ -2251,6 +2315,15 @@ void CSolver::CompleteComms(CGeometry *geometry,
             for (iVar = 0; iVar < nPrimVarGrad; iVar++)
               base_nodes->SetLimiter_Primitive(iPoint, iVar, bufDRecv[buf_offset+iVar]);
             break;
+          case PRIMITIVE_GRAD_LIMITER:
+            for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+              for (iDim = 0; iDim < nDim; iDim++) {
+                base_nodes->SetGradient_Primitive(iPoint, iVar, iDim, bufDRecv[buf_offset+iVar*nDim+iDim]);
+                base_nodes->SetGradient_Reconstruction(iPoint, iVar, iDim, bufDRecv[buf_offset+iVar*nDim+iDim+nDim*nPrimVarGrad]);
+              }
+              base_nodes->SetLimiter_Primitive(iPoint, iVar, bufDRecv[buf_offset+iVar+2*nDim*nPrimVarGrad]);
+            }
+            break;
           case AUXVAR_GRADIENT:
             for (iDim = 0; iDim < nDim; iDim++)
               base_nodes->SetAuxVarGradient(iPoint, iDim, bufDRecv[buf_offset+iDim]);
@@ -2310,9 +2383,7 @@ void CSolver::CompleteComms(CGeometry *geometry,
      Note that this should be satisfied, as we have received all of the
      data in the loop above at this point. ---*/
 
-#ifdef HAVE_MPI
-    SU2_MPI::Waitall(geometry->nP2PSend, geometry->req_P2PSend, MPI_STATUS_IGNORE);
-#endif
+    geometry->WaitAllP2PSends();
 
   }
 
@@ -2332,8 +2403,6 @@ void CSolver::AdaptCFLNumber(CGeometry **geometry,
                              CSolver   ***solver_container,
                              CConfig   *config) {
 
-  /// TODO: Add OpenMP stuff to this method.
-
   /* Adapt the CFL number on all multigrid levels using an
    exponential progression with under-relaxation approach. */
 
@@ -2342,6 +2411,13 @@ void CSolver::AdaptCFLNumber(CGeometry **geometry,
   const su2double CFLFactorIncrease = config->GetCFL_AdaptParam(1);
   const su2double CFLMin            = config->GetCFL_AdaptParam(2);
   const su2double CFLMax            = config->GetCFL_AdaptParam(3);
+  const bool turbulence = (config->GetKind_Turb_Model() != NONE);
+
+  /* Min, max, and sum of the fine grid CFL numbers of this rank. */
+
+  su2double myCFLMin = 1e30;
+  su2double myCFLMax = 0.0;
+  su2double myCFLSum = 0.0;
 
   for (unsigned short iMesh = 0; iMesh <= config->GetnMGLevels(); iMesh++) {
 
@@ -2426,27 +2502,35 @@ void CSolver::AdaptCFLNumber(CGeometry **geometry,
         NonLinRes_Series[iCounter] = New_Func;
     }
 
-    /* Loop over all points on this grid and apply CFL adaption. */
+    /* Loop over all points on this grid and apply CFL adaption, the
+     loop invariants are hoisted and each thread reduces its own range. */
+
+    CVariable* flowNodes = solverFlow->GetNodes();
+    CVariable* turbNodes = ((iMesh == MESH_0) && turbulence)? solverTurb->GetNodes() : nullptr;
+    const unsigned long nPointDomain = geometry[iMesh]->GetnPointDomain();
+    const su2double mgFactor = MGFactor[iMesh];
+
+    SU2_OMP_PARALLEL_(if(solverFlow->GetHasHybridParallel()))
+    {
+    su2double thrCFLMin = 1e30;
+    su2double thrCFLMax = 0.0;
+    su2double thrCFLSum = 0.0;
 
-    su2double myCFLMin = 1e30;
-    su2double myCFLMax = 0.0;
-    su2double myCFLSum = 0.0;
-    for (unsigned long iPoint = 0; iPoint < geometry[iMesh]->GetnPointDomain(); iPoint++) {
+    SU2_OMP_FOR_STAT(roundUpDiv(nPointDomain, omp_get_num_threads()))
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
       /* Get the current local flow CFL number at this point. */
 
-      su2double CFL = solverFlow->GetNodes()->GetLocalCFL(iPoint);
+      su2double CFL = flowNodes->GetLocalCFL(iPoint);
 
       /* Get the current under-relaxation parameters that were computed
        during the previous nonlinear update. If we have a turbulence model,
        take the minimum under-relaxation parameter between the mean flow
        and turbulence systems. */
 
-      su2double underRelaxationFlow = solverFlow->GetNodes()->GetUnderRelaxation(iPoint);
-      su2double underRelaxationTurb = 1.0;
-      if ((iMesh == MESH_0) && (config->GetKind_Turb_Model() != NONE))
-        underRelaxationTurb = solverTurb->GetNodes()->GetUnderRelaxation(iPoint);
-      const su2double underRelaxation = min(underRelaxationFlow,underRelaxationTurb);
+      su2double underRelaxation = flowNodes->GetUnderRelaxation(iPoint);
+      if (turbNodes != nullptr)
+        underRelaxation = min(underRelaxation, turbNodes->GetUnderRelaxation(iPoint));
 
       /* If we apply a small under-relaxation parameter for stability,
        then we should reduce the CFL before the next iteration. If we
@@ -2454,57 +2538,59 @@ void CSolver::AdaptCFLNumber(CGeometry **geometry,
        then we schedule an increase the CFL number for the next iteration. */
 
       su2double CFLFactor = 1.0;
-      if ((underRelaxation < 0.1)) {
-        CFLFactor = CFLFactorDecrease;
-      } else if (underRelaxation >= 0.1 && underRelaxation < 1.0) {
-        CFLFactor = 1.0;
-      } else {
-        CFLFactor = CFLFactorIncrease;
-      }
+      if (underRelaxation < 0.1) CFLFactor = CFLFactorDecrease;
+      else if (underRelaxation >= 1.0) CFLFactor = CFLFactorIncrease;
 
-      /* Check if we are hitting the min or max and adjust. */
+      /* Check if we are hitting the min or max and adjust. If we detect
+       a stalled nonlinear residual, then force the CFL for all points to
+       the minimum temporarily to restart the ramp. */
 
-      if (CFL*CFLFactor <= CFLMin) {
+      if (reduceCFL || (CFL*CFLFactor <= CFLMin)) {
         CFL       = CFLMin;
-        CFLFactor = MGFactor[iMesh];
+        CFLFactor = mgFactor;
       } else if (CFL*CFLFactor >= CFLMax) {
         CFL       = CFLMax;
-        CFLFactor = MGFactor[iMesh];
-      }
-
-      /* If we detect a stalled nonlinear residual, then force the CFL
-       for all points to the minimum temporarily to restart the ramp. */
-
-      if (reduceCFL) {
-        CFL       = CFLMin;
-        CFLFactor = MGFactor[iMesh];
+        CFLFactor = mgFactor;
       }
 
       /* Apply the adjustment to the CFL and store local values. */
 
       CFL *= CFLFactor;
-      solverFlow->GetNodes()->SetLocalCFL(iPoint, CFL);
-      if ((iMesh == MESH_0) && (config->GetKind_Turb_Model() != NONE)) {
-        solverTurb->GetNodes()->SetLocalCFL(iPoint, CFL);
-      }
+      flowNodes->SetLocalCFL(iPoint, CFL);
+      if (turbNodes != nullptr) turbNodes->SetLocalCFL(iPoint, CFL);
 
       /* Store min and max CFL for reporting on fine grid. */
 
-      myCFLMin = min(CFL,myCFLMin);
-      myCFLMax = max(CFL,myCFLMax);
-      myCFLSum += CFL;
+      thrCFLMin = min(CFL,thrCFLMin);
+      thrCFLMax = max(CFL,thrCFLMax);
+      thrCFLSum += CFL;
 
     }
 
-    /* Reduce the min/max/avg local CFL numbers. */
-
-    SU2_MPI::Allreduce(&myCFLMin, &Min_CFL_Local, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&myCFLMax, &Max_CFL_Local, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&myCFLSum, &Avg_CFL_Local, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    Avg_CFL_Local /= su2double(geometry[iMesh]->GetGlobal_nPointDomain());
+    if (iMesh == MESH_0) {
+      SU2_OMP_CRITICAL
+      {
+        myCFLMin = min(thrCFLMin,myCFLMin);
+        myCFLMax = max(thrCFLMax,myCFLMax);
+        myCFLSum += thrCFLSum;
+      }
+    }
+    } // end SU2_OMP_PARALLEL
 
   }
 
+  /* Reduce the min/max/avg local CFL numbers of the fine grid, the
+   min and max are reduced together (as the max of -min and max). */
+
+  su2double myCFLMinMax[2] = {-myCFLMin, myCFLMax}, CFLMinMax[2] = {0.0};
+
+  SU2_MPI::Allreduce(myCFLMinMax, CFLMinMax, 2, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&myCFLSum, &Avg_CFL_Local, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+
+  Min_CFL_Local = -CFLMinMax[0];
+  Max_CFL_Local = CFLMinMax[1];
+  Avg_CFL_Local /= su2double(geometry[MESH_0]->GetGlobal_nPointDomain());
+
 }
 
 void CSolver::SetResidual_RMS(CGeometry *geometry, CConfig *config) {
@@ -2529,85 +2615,65 @@ void CSolver::SetResidual_RMS(CGeometry *geometry, CConfig *config) {
 
   int nProcessor = size, iProcessor;
 
-  su2double *sbuf_residual, *rbuf_residual, *sbuf_coord, *rbuf_coord, *Coord;
-  unsigned long *sbuf_point, *rbuf_point, Global_nPointDomain;
+  su2double *Coord, Global_nPointDomain;
   unsigned short iDim;
 
-  /*--- Set the L2 Norm residual in all the processors ---*/
+  /*--- Set the L2 Norm residual in all the processors, the number of points
+   is summed in the same reduction as the residuals. ---*/
 
-  sbuf_residual = new su2double[nVar];
-  rbuf_residual = new su2double[nVar];
+  vector<su2double> residual(nVar+1);
 
-  for (iVar = 0; iVar < nVar; iVar++) sbuf_residual[iVar] = GetRes_RMS(iVar);
+  for (iVar = 0; iVar < nVar; iVar++) residual[iVar] = GetRes_RMS(iVar);
+  residual[nVar] = geometry->GetnPointDomain();
 
   if (config->GetComm_Level() == COMM_FULL) {
 
-    unsigned long Local_nPointDomain = geometry->GetnPointDomain();
-    SU2_MPI::Allreduce(sbuf_residual, rbuf_residual, nVar, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&Local_nPointDomain, &Global_nPointDomain, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+    CSumReduction reduction;
+    reduction.Add(residual.data(), nVar+1);
+    reduction.Complete();
 
   }
-  else {
-    /*--- Reduced MPI comms have been requested. Use a local residual only. ---*/
 
-    for (iVar = 0; iVar < nVar; iVar++)
-      rbuf_residual[iVar] = sbuf_residual[iVar];
-    Global_nPointDomain = geometry->GetnPointDomain();
+  /*--- Reduced MPI comms may have been requested, the local residual is used instead. ---*/
 
-  }
+  Global_nPointDomain = residual[nVar];
 
   for (iVar = 0; iVar < nVar; iVar++) {
 
-    if (rbuf_residual[iVar] != rbuf_residual[iVar]) {
+    if (residual[iVar] != residual[iVar]) {
       SU2_MPI::Error("SU2 has diverged. (NaN detected)", CURRENT_FUNCTION);
     }
 
-    SetRes_RMS(iVar, max(EPS*EPS, sqrt(rbuf_residual[iVar]/Global_nPointDomain)));
+    SetRes_RMS(iVar, max(EPS*EPS, sqrt(residual[iVar]/Global_nPointDomain)));
 
   }
 
-  delete [] sbuf_residual;
-  delete [] rbuf_residual;
-
-  /*--- Set the Maximum residual in all the processors ---*/
+  /*--- Set the Maximum residual in all the processors, the values, points and
+   coordinates are gathered with one call as [res_0 .. res_nVar point_0 .. coord_0 ..]. ---*/
 
   if (config->GetComm_Level() == COMM_FULL) {
 
-    sbuf_residual = new su2double [nVar]();
-    sbuf_point = new unsigned long [nVar]();
-    sbuf_coord = new su2double[nVar*nDim]();
+    const int nValue = nVar*(2+nDim);
 
-    rbuf_residual = new su2double [nProcessor*nVar]();
-    rbuf_point = new unsigned long [nProcessor*nVar]();
-    rbuf_coord = new su2double[nProcessor*nVar*nDim]();
+    vector<su2double> sbuf_max(nValue), rbuf_max(nProcessor*nValue);
 
     for (iVar = 0; iVar < nVar; iVar++) {
-      sbuf_residual[iVar] = GetRes_Max(iVar);
-      sbuf_point[iVar] = GetPoint_Max(iVar);
+      sbuf_max[iVar] = GetRes_Max(iVar);
+      sbuf_max[nVar+iVar] = GetPoint_Max(iVar);
       Coord = GetPoint_Max_Coord(iVar);
       for (iDim = 0; iDim < nDim; iDim++)
-        sbuf_coord[iVar*nDim+iDim] = Coord[iDim];
+        sbuf_max[2*nVar+iVar*nDim+iDim] = Coord[iDim];
     }
 
-    SU2_MPI::Allgather(sbuf_residual, nVar, MPI_DOUBLE, rbuf_residual, nVar, MPI_DOUBLE, MPI_COMM_WORLD);
-    SU2_MPI::Allgather(sbuf_point, nVar, MPI_UNSIGNED_LONG, rbuf_point, nVar, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
-    SU2_MPI::Allgather(sbuf_coord, nVar*nDim, MPI_DOUBLE, rbuf_coord, nVar*nDim, MPI_DOUBLE, MPI_COMM_WORLD);
+    SU2_MPI::Allgather(sbuf_max.data(), nValue, MPI_DOUBLE, rbuf_max.data(), nValue, MPI_DOUBLE, MPI_COMM_WORLD);
 
     for (iVar = 0; iVar < nVar; iVar++) {
       for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
-        AddRes_Max(iVar, rbuf_residual[iProcessor*nVar+iVar], rbuf_point[iProcessor*nVar+iVar], &rbuf_coord[iProcessor*nVar*nDim+iVar*nDim]);
+        const su2double* rbuf = &rbuf_max[iProcessor*nValue];
+        AddRes_Max(iVar, rbuf[iVar], (unsigned long)SU2_TYPE::GetValue(rbuf[nVar+iVar]), &rbuf[2*nVar+iVar*nDim]);
       }
     }
 
-    delete [] sbuf_residual;
-    delete [] rbuf_residual;
-
-    delete [] sbuf_point;
-    delete [] rbuf_point;
-
-    delete [] sbuf_coord;
-    delete [] rbuf_coord;
-
   }
 
 #endif
@@ -2726,18 +2792,25 @@ void CSolver::SetRotatingFrame_GCL(CGeometry *geometry, CConfig *config) {
     for (iVar = 0; iVar < nVar; iVar++)
       Solution[iVar] = 0.5* (Solution_i[iVar] + Solution_j[iVar]);
 
-    /*--- Grid Velocity at each edge point ---*/
+    /*--- Projected grid velocity of the edge, stored if the grid velocities do not change. ---*/
 
-    su2double *GridVel_i = geometry->node[iPoint]->GetGridVel();
-    su2double *GridVel_j = geometry->node[jPoint]->GetGridVel();
-    for (iDim = 0; iDim < nDim; iDim++)
-      Vector[iDim] = 0.5* (GridVel_i[iDim] + GridVel_j[iDim]);
+    const su2double *GridFlux = geometry->GetEdgeGridFlux(iEdge);
+
+    if (GridFlux) {
+      ProjGridVel = *GridFlux;
+    }
+    else {
+      su2double *GridVel_i = geometry->node[iPoint]->GetGridVel();
+      su2double *GridVel_j = geometry->node[jPoint]->GetGridVel();
+      for (iDim = 0; iDim < nDim; iDim++)
+        Vector[iDim] = 0.5* (GridVel_i[iDim] + GridVel_j[iDim]);
 
-    Normal = geometry->edge[iEdge]->GetNormal();
+      Normal = geometry->edge[iEdge]->GetNormal();
 
-    ProjGridVel = 0.0;
-    for (iDim = 0; iDim < nDim; iDim++)
-      ProjGridVel += Vector[iDim]*Normal[iDim];
+      ProjGridVel = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++)
+        ProjGridVel += Vector[iDim]*Normal[iDim];
+    }
 
     for (iVar = 0; iVar < nVar; iVar++)
       Residual[iVar] = ProjGridVel*Solution_i[iVar];
@@ -2975,123 +3048,233 @@ void CSolver::SetGridVel_Gradient(CGeometry *geometry, CConfig *config) {
 
 }
 
-void CSolver::SetAuxVar_Surface_Gradient(CGeometry *geometry, CConfig *config) {
+const vector<unsigned long>& CSolver::SetAuxVar_Surface_Stencil(CGeometry *geometry, CConfig *config) {
 
-  unsigned short iDim, jDim, iNeigh, iMarker, Boundary;
-  unsigned short nDim = geometry->GetnDim();
-  unsigned long iPoint, jPoint, iVertex;
-  su2double *Coord_i, *Coord_j, AuxVar_i, AuxVar_j;
-  su2double **Smatrix, *Cvector;
+  /*--- The stencils only depend on the grid, they are rebuilt only if it moves. ---*/
 
-  Smatrix = new su2double* [nDim];
-  Cvector = new su2double [nDim];
-  for (iDim = 0; iDim < nDim; iDim++)
-    Smatrix[iDim] = new su2double [nDim];
+  if (!SurfGrad_Ptr.empty() && !config->GetDynamic_Grid()) return SurfGrad_AuxPoint;
 
+  const unsigned short nDim = geometry->GetnDim();
+  const unsigned long nPoint = geometry->GetnPoint();
 
-  /*--- Loop over boundary markers to select those for Euler or NS walls ---*/
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-    Boundary = config->GetMarker_All_KindBC(iMarker);
-    switch (Boundary) {
+  SurfGrad_Point.clear();
+  SurfGrad_Ptr.assign(1, 0);
+  SurfGrad_Neighbor.clear();
+  SurfGrad_Coeff.clear();
+  SurfGrad_AuxPoint.clear();
+
+  vector<bool> isWall(nPoint, false), isAux(nPoint, false);
+
+  /*--- Domain points of the Euler or NS walls, each point only once. ---*/
+
+  for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    switch (config->GetMarker_All_KindBC(iMarker)) {
       case EULER_WALL:
       case HEAT_FLUX:
       case ISOTHERMAL:
       case CHT_WALL_INTERFACE:
+        for (unsigned long iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+          const unsigned long iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          if (geometry->node[iPoint]->GetDomain() && !isWall[iPoint]) {
+            isWall[iPoint] = true;
+            SurfGrad_Point.push_back(iPoint);
+          }
+        }
+        break;
+      default:
+        break;
+    }
+  }
 
-        /*--- Loop over points on the surface (Least-Squares approximation) ---*/
-        for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-          if (geometry->node[iPoint]->GetDomain()) {
-            Coord_i = geometry->node[iPoint]->GetCoord();
-            AuxVar_i = base_nodes->GetAuxVar(iPoint);
+  /*--- Least squares gradient of each wall point, grad = S * sum_j d_j/w_j (a_j - a_i),
+   *    where d_j = x_j - x_i, w_j = |d_j|^2, and S := inv(R)*transpose(inv(R)) with
+   *    transpose(R)*R = sum_j d_j*transpose(d_j)/w_j. The coefficients S*d_j/w_j are stored. ---*/
 
-            /*--- Inizialization of variables ---*/
-            for (iDim = 0; iDim < nDim; iDim++)
-              Cvector[iDim] = 0.0;
-            su2double r11 = 0.0, r12 = 0.0, r13 = 0.0, r22 = 0.0, r23 = 0.0, r23_a = 0.0, r23_b = 0.0, r33 = 0.0;
-
-            for (iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); iNeigh++) {
-              jPoint = geometry->node[iPoint]->GetPoint(iNeigh);
-              Coord_j = geometry->node[jPoint]->GetCoord();
-              AuxVar_j = base_nodes->GetAuxVar(jPoint);
-
-              su2double weight = 0;
-              for (iDim = 0; iDim < nDim; iDim++)
-                weight += (Coord_j[iDim]-Coord_i[iDim])*(Coord_j[iDim]-Coord_i[iDim]);
-
-              /*--- Sumations for entries of upper triangular matrix R ---*/
-              r11 += (Coord_j[0]-Coord_i[0])*(Coord_j[0]-Coord_i[0])/weight;
-              r12 += (Coord_j[0]-Coord_i[0])*(Coord_j[1]-Coord_i[1])/weight;
-              r22 += (Coord_j[1]-Coord_i[1])*(Coord_j[1]-Coord_i[1])/weight;
-              if (nDim == 3) {
-                r13 += (Coord_j[0]-Coord_i[0])*(Coord_j[2]-Coord_i[2])/weight;
-                r23_a += (Coord_j[1]-Coord_i[1])*(Coord_j[2]-Coord_i[2])/weight;
-                r23_b += (Coord_j[0]-Coord_i[0])*(Coord_j[2]-Coord_i[2])/weight;
-                r33 += (Coord_j[2]-Coord_i[2])*(Coord_j[2]-Coord_i[2])/weight;
-              }
+  for (auto iPoint : SurfGrad_Point) {
 
-              /*--- Entries of c:= transpose(A)*b ---*/
-              for (iDim = 0; iDim < nDim; iDim++)
-                Cvector[iDim] += (Coord_j[iDim]-Coord_i[iDim])*(AuxVar_j-AuxVar_i)/weight;
-            }
+    const su2double *Coord_i = geometry->node[iPoint]->GetCoord();
+    const unsigned short nNeigh = geometry->node[iPoint]->GetnPoint();
 
-            /*--- Entries of upper triangular matrix R ---*/
-            r11 = sqrt(r11);
-            r12 = r12/r11;
-            r22 = sqrt(r22-r12*r12);
-            if (nDim == 3) {
-              r13 = r13/r11;
-              r23 = r23_a/r22 - r23_b*r12/(r11*r22);
-              r33 = sqrt(r33-r23*r23-r13*r13);
-            }
-            /*--- S matrix := inv(R)*traspose(inv(R)) ---*/
-            if (nDim == 2) {
-              su2double detR2 = (r11*r22)*(r11*r22);
-              Smatrix[0][0] = (r12*r12+r22*r22)/detR2;
-              Smatrix[0][1] = -r11*r12/detR2;
-              Smatrix[1][0] = Smatrix[0][1];
-              Smatrix[1][1] = r11*r11/detR2;
-            }
-            else {
-              su2double detR2 = (r11*r22*r33)*(r11*r22*r33);
-              su2double z11, z12, z13, z22, z23, z33; // aux vars
-              z11 = r22*r33;
-              z12 = -r12*r33;
-              z13 = r12*r23-r13*r22;
-              z22 = r11*r33;
-              z23 = -r11*r23;
-              z33 = r11*r22;
-              Smatrix[0][0] = (z11*z11+z12*z12+z13*z13)/detR2;
-              Smatrix[0][1] = (z12*z22+z13*z23)/detR2;
-              Smatrix[0][2] = (z13*z33)/detR2;
-              Smatrix[1][0] = Smatrix[0][1];
-              Smatrix[1][1] = (z22*z22+z23*z23)/detR2;
-              Smatrix[1][2] = (z23*z33)/detR2;
-              Smatrix[2][0] = Smatrix[0][2];
-              Smatrix[2][1] = Smatrix[1][2];
-              Smatrix[2][2] = (z33*z33)/detR2;
-            }
-            /*--- Computation of the gradient: S*c ---*/
-            su2double product;
-            for (iDim = 0; iDim < nDim; iDim++) {
-              product = 0.0;
-              for (jDim = 0; jDim < nDim; jDim++)
-                product += Smatrix[iDim][jDim]*Cvector[jDim];
-              base_nodes->SetAuxVarGradient(iPoint, iDim, product);
-            }
+    if (!isAux[iPoint]) { isAux[iPoint] = true; SurfGrad_AuxPoint.push_back(iPoint); }
+
+    su2double r11 = 0.0, r12 = 0.0, r13 = 0.0, r22 = 0.0, r23 = 0.0, r23_a = 0.0, r23_b = 0.0, r33 = 0.0;
+
+    for (unsigned short iNeigh = 0; iNeigh < nNeigh; iNeigh++) {
+      const unsigned long jPoint = geometry->node[iPoint]->GetPoint(iNeigh);
+      const su2double *Coord_j = geometry->node[jPoint]->GetCoord();
+
+      if (!isAux[jPoint]) { isAux[jPoint] = true; SurfGrad_AuxPoint.push_back(jPoint); }
+
+      su2double weight = 0.0;
+      for (unsigned short iDim = 0; iDim < nDim; iDim++)
+        weight += (Coord_j[iDim]-Coord_i[iDim])*(Coord_j[iDim]-Coord_i[iDim]);
+
+      /*--- Sumations for entries of upper triangular matrix R ---*/
+      r11 += (Coord_j[0]-Coord_i[0])*(Coord_j[0]-Coord_i[0])/weight;
+      r12 += (Coord_j[0]-Coord_i[0])*(Coord_j[1]-Coord_i[1])/weight;
+      r22 += (Coord_j[1]-Coord_i[1])*(Coord_j[1]-Coord_i[1])/weight;
+      if (nDim == 3) {
+        r13 += (Coord_j[0]-Coord_i[0])*(Coord_j[2]-Coord_i[2])/weight;
+        r23_a += (Coord_j[1]-Coord_i[1])*(Coord_j[2]-Coord_i[2])/weight;
+        r23_b += (Coord_j[0]-Coord_i[0])*(Coord_j[2]-Coord_i[2])/weight;
+        r33 += (Coord_j[2]-Coord_i[2])*(Coord_j[2]-Coord_i[2])/weight;
+      }
+    }
+
+    /*--- Entries of upper triangular matrix R ---*/
+    r11 = sqrt(r11);
+    r12 = r12/r11;
+    r22 = sqrt(r22-r12*r12);
+    if (nDim == 3) {
+      r13 = r13/r11;
+      r23 = r23_a/r22 - r23_b*r12/(r11*r22);
+      r33 = sqrt(r33-r23*r23-r13*r13);
+    }
+
+    /*--- S matrix := inv(R)*traspose(inv(R)) ---*/
+    su2double Smatrix[3][3] = {{0.0}};
+    if (nDim == 2) {
+      su2double detR2 = (r11*r22)*(r11*r22);
+      Smatrix[0][0] = (r12*r12+r22*r22)/detR2;
+      Smatrix[0][1] = -r11*r12/detR2;
+      Smatrix[1][0] = Smatrix[0][1];
+      Smatrix[1][1] = r11*r11/detR2;
+    }
+    else {
+      su2double detR2 = (r11*r22*r33)*(r11*r22*r33);
+      su2double z11, z12, z13, z22, z23, z33; // aux vars
+      z11 = r22*r33;
+      z12 = -r12*r33;
+      z13 = r12*r23-r13*r22;
+      z22 = r11*r33;
+      z23 = -r11*r23;
+      z33 = r11*r22;
+      Smatrix[0][0] = (z11*z11+z12*z12+z13*z13)/detR2;
+      Smatrix[0][1] = (z12*z22+z13*z23)/detR2;
+      Smatrix[0][2] = (z13*z33)/detR2;
+      Smatrix[1][0] = Smatrix[0][1];
+      Smatrix[1][1] = (z22*z22+z23*z23)/detR2;
+      Smatrix[1][2] = (z23*z33)/detR2;
+      Smatrix[2][0] = Smatrix[0][2];
+      Smatrix[2][1] = Smatrix[1][2];
+      Smatrix[2][2] = (z33*z33)/detR2;
+    }
+
+    /*--- Coefficients of the neighbors: S*d_j/w_j ---*/
+    for (unsigned short iNeigh = 0; iNeigh < nNeigh; iNeigh++) {
+      const unsigned long jPoint = geometry->node[iPoint]->GetPoint(iNeigh);
+      const su2double *Coord_j = geometry->node[jPoint]->GetCoord();
+
+      su2double weight = 0.0;
+      for (unsigned short iDim = 0; iDim < nDim; iDim++)
+        weight += (Coord_j[iDim]-Coord_i[iDim])*(Coord_j[iDim]-Coord_i[iDim]);
+
+      SurfGrad_Neighbor.push_back(jPoint);
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+        su2double product = 0.0;
+        for (unsigned short jDim = 0; jDim < nDim; jDim++)
+          product += Smatrix[iDim][jDim]*(Coord_j[jDim]-Coord_i[jDim]);
+        SurfGrad_Coeff.push_back(product/weight);
+      }
+    }
+    SurfGrad_Ptr.push_back(SurfGrad_Neighbor.size());
+  }
+
+  return SurfGrad_AuxPoint;
+}
+
+void CSolver::SetWallFunction_Stencil(CGeometry *geometry, const CConfig *config, bool allNeighbors) {
+
+  /*--- The stencils only depend on the grid, they are rebuilt only if it moves. ---*/
+
+  if (!WallFunc_Ptr.empty() && !config->GetDynamic_Grid()) return;
+
+  const unsigned short nDim = geometry->GetnDim();
+
+  WallFunc_Ptr.assign(1, 0);
+  WallFunc_Point.clear();
+  WallFunc_Neighbor.clear();
+  WallFunc_UnitNormal.clear();
+  WallFunc_Dist.clear();
+
+  for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+
+    const auto kindBC = config->GetMarker_All_KindBC(iMarker);
+
+    if ((kindBC == HEAT_FLUX) || (kindBC == ISOTHERMAL) || (kindBC == CHT_WALL_INTERFACE)) {
+
+      for (unsigned long iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+
+        const unsigned long iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        if (!geometry->node[iPoint]->GetDomain()) continue;
+
+        const su2double* Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+        const su2double* Coord = geometry->node[iPoint]->GetCoord();
+
+        su2double Area = 0.0;
+        for (unsigned short iDim = 0; iDim < nDim; iDim++)
+          Area += Normal[iDim]*Normal[iDim];
+        Area = sqrt(Area);
+
+        auto addStencil = [&](unsigned long jPoint) {
+          const su2double* Coord_Normal = geometry->node[jPoint]->GetCoord();
+          su2double Dist = 0.0;
+          for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+            WallFunc_UnitNormal.push_back(-Normal[iDim]/Area);
+            Dist += pow(Coord[iDim]-Coord_Normal[iDim], 2);
           }
-        } /*--- End of loop over surface points ---*/
-        break;
-      default:
-        break;
+          WallFunc_Point.push_back(iPoint);
+          WallFunc_Neighbor.push_back(jPoint);
+          WallFunc_Dist.push_back(sqrt(Dist));
+        };
+
+        if (allNeighbors) {
+          for (unsigned short iNode = 0; iNode < geometry->node[iPoint]->GetnPoint(); iNode++) {
+            const unsigned long jPoint = geometry->node[iPoint]->GetPoint(iNode);
+            if (!geometry->node[jPoint]->GetBoundary()) addStencil(jPoint);
+          }
+        }
+        else {
+          addStencil(geometry->vertex[iMarker][iVertex]->GetNormal_Neighbor());
+        }
+      }
     }
+    WallFunc_Ptr.push_back(WallFunc_Point.size());
   }
 
-  /*--- Memory deallocation ---*/
-  for (iDim = 0; iDim < nDim; iDim++)
-    delete [] Smatrix[iDim];
-  delete [] Cvector;
-  delete [] Smatrix;
+  /*--- The previous wall shear stresses are kept if the stencils did not change. ---*/
+
+  const auto nStencil = WallFunc_Point.size();
+  if (WallFunc_TauWall.size() != nStencil) WallFunc_TauWall.assign(nStencil, 0.0);
+  WallFunc_Value.resize(nStencil, 0.0);
+
+}
+
+void CSolver::SetAuxVar_Surface_Gradient(CGeometry *geometry, CConfig *config) {
+
+  const unsigned short nDim = geometry->GetnDim();
+
+  SetAuxVar_Surface_Stencil(geometry, config);
+
+  /*--- Loop over the points on the walls, the gradient is the product of
+   *    the precomputed coefficients and the differences of the variable. ---*/
+
+  for (auto k = 0ul; k < SurfGrad_Point.size(); k++) {
+    const unsigned long iPoint = SurfGrad_Point[k];
+    const su2double AuxVar_i = base_nodes->GetAuxVar(iPoint);
+
+    su2double gradient[3] = {0.0, 0.0, 0.0};
+
+    for (auto iNeigh = SurfGrad_Ptr[k]; iNeigh < SurfGrad_Ptr[k+1]; iNeigh++) {
+      const su2double delta = base_nodes->GetAuxVar(SurfGrad_Neighbor[iNeigh]) - AuxVar_i;
+      const su2double* coeff = &SurfGrad_Coeff[iNeigh*nDim];
+      for (unsigned short iDim = 0; iDim < nDim; iDim++)
+        gradient[iDim] += coeff[iDim]*delta;
+    }
+
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      base_nodes->SetAuxVarGradient(iPoint, iDim, gradient[iDim]);
+  }
 }
 
 void CSolver::SetSolution_Limiter(CGeometry *geometry, CConfig *config) {
@@ -3634,7 +3817,7 @@ void CSolver::Read_SU2_Restart_ASCII(CGeometry *geometry, CConfig *config, strin
   /*--- Check that this is an SU2 binary file. SU2 binary files
    have the hex representation of "SU2" as the first int in the file. ---*/
 
-  if (magic_number == 535532) {
+  if ((magic_number == 535532) || (magic_number == SU2_COMPRESSED_RESTART_ID)) {
     SU2_MPI::Error(string("File ") + string(fname) + string(" is a binary SU2 restart file, expected ASCII.\n") +
                    string("SU2 reads/writes binary restart files by default.\n") +
                    string("Note that backward compatibility for ASCII restart files is\n") +
@@ -3673,7 +3856,7 @@ void CSolver::Read_SU2_Restart_ASCII(CGeometry *geometry, CConfig *config, strin
   /*--- Check that this is an SU2 binary file. SU2 binary files
    have the hex representation of "SU2" as the first int in the file. ---*/
 
-  if (magic_number == 535532) {
+  if ((magic_number == 535532) || (magic_number == SU2_COMPRESSED_RESTART_ID)) {
     SU2_MPI::Error(string("File ") + string(fname) + string(" is a binary SU2 restart file, expected ASCII.\n") +
                    string("SU2 reads/writes binary restart files by default.\n") +
                    string("Note that backward compatibility for ASCII restart files is\n") +
@@ -3782,7 +3965,9 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, CConfig *config, stri
   /*--- Check that this is an SU2 binary file. SU2 binary files
    have the hex representation of "SU2" as the first int in the file. ---*/
 
-  if (Restart_Vars[0] != 535532) {
+  const bool compressed = (Restart_Vars[0] == SU2_COMPRESSED_RESTART_ID);
+
+  if ((Restart_Vars[0] != 535532) && !compressed) {
     SU2_MPI::Error(string("File ") + string(fname) + string(" is not a binary SU2 restart file.\n") +
                    string("SU2 reads/writes binary restart files by default.\n") +
                    string("Note that backward compatibility for ASCII restart files is\n") +
@@ -3807,6 +3992,14 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, CConfig *config, stri
     fields.push_back(str_buf);
   }
 
+  /*--- The data of compressed files is decompressed by the toolbox. ---*/
+
+  if (compressed) {
+    fclose(fhw);
+    Restart_Data = CompressionToolbox::ReadRestartData(val_filename, Restart_Vars, geometry);
+    return;
+  }
+
   /*--- For now, create a temp 1D buffer to read the data from file. ---*/
 
   Restart_Data = new passivedouble[nFields*geometry->GetnPointDomain()];
@@ -3827,8 +4020,7 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, CConfig *config, stri
   /*--- Parallel binary input using MPI I/O. ---*/
 
   MPI_File fhw;
-  SU2_MPI::Status status;
-  MPI_Datatype etype, filetype;
+  MPI_Status status;
   MPI_Offset disp;
   unsigned long iPoint_Global, index, iChar;
   string field_buf;
@@ -3859,7 +4051,9 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, CConfig *config, stri
   /*--- Check that this is an SU2 binary file. SU2 binary files
    have the hex representation of "SU2" as the first int in the file. ---*/
 
-  if (Restart_Vars[0] != 535532) {
+  const bool compressed = (Restart_Vars[0] == SU2_COMPRESSED_RESTART_ID);
+
+  if ((Restart_Vars[0] != 535532) && !compressed) {
     SU2_MPI::Error(string("File ") + string(fname) + string(" is not a binary SU2 restart file.\n") +
                    string("SU2 reads/writes binary restart files by default.\n") +
                    string("Note that backward compatibility for ASCII restart files is\n") +
@@ -3906,60 +4100,139 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, CConfig *config, stri
 
   delete [] mpi_str_buf;
 
-  /*--- We're writing only su2doubles in the data portion of the file. ---*/
+  /*--- The data of compressed files is decompressed by the toolbox. ---*/
 
-  etype = MPI_DOUBLE;
+  if (compressed) {
+    MPI_File_close(&fhw);
+    Restart_Data = CompressionToolbox::ReadRestartData(val_filename, Restart_Vars, geometry);
+    return;
+  }
 
-  /*--- We need to ignore the 4 ints describing the nVar_Restart and nPoints,
-   along with the string names of the variables. ---*/
+  /*--- The data is read in the contiguous slices of a linear partition of the points of the file,
+   each rank then requests the points that it owns from the ranks that read them. This avoids
+   a scan of all the global indices and the non-contiguous file views on every rank. ---*/
 
-  disp = nRestart_Vars*sizeof(int) + CGNS_STRING_SIZE*nFields*sizeof(char);
+  const unsigned long nPointFile = Restart_Vars[2];
+  CLinearPartitioner filePartitioner(nPointFile, 0);
 
-  /*--- Define a derived datatype for this rank's set of non-contiguous data
-   that will be placed in the restart. Here, we are collecting each one of the
-   points which are distributed throughout the file in blocks of nVar_Restart data. ---*/
+  const unsigned long firstPoint = filePartitioner.GetFirstIndexOnRank(rank);
+  const unsigned long nPointSlice = filePartitioner.GetSizeOnRank(rank);
 
-  int *blocklen = new int[geometry->GetnPointDomain()];
-  int *displace = new int[geometry->GetnPointDomain()];
-  int counter = 0;
-  for (iPoint_Global = 0; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++ ) {
-    if (geometry->GetGlobal_to_Local_Point(iPoint_Global) > -1) {
-      blocklen[counter] = nFields;
-      displace[counter] = iPoint_Global*nFields;
-      counter++;
-    }
-  }
-  MPI_Type_indexed(geometry->GetnPointDomain(), blocklen, displace, MPI_DOUBLE, &filetype);
-  MPI_Type_commit(&filetype);
+  /*--- We need to skip the 5 ints of the header and the string names of the variables.
+   The data portion of the file holds only doubles, nFields per point. ---*/
 
-  /*--- Set the view for the MPI file write, i.e., describe the location in
-   the file that this rank "sees" for writing its piece of the restart file. ---*/
+  disp = nRestart_Vars*sizeof(int) + CGNS_STRING_SIZE*nFields*sizeof(char) +
+         MPI_Offset(firstPoint)*nFields*sizeof(passivedouble);
 
-  MPI_File_set_view(fhw, disp, etype, filetype, (char*)"native", MPI_INFO_NULL);
+  MPI_Datatype pointtype;
+  MPI_Type_contiguous(nFields, MPI_DOUBLE, &pointtype);
+  MPI_Type_commit(&pointtype);
 
-  /*--- For now, create a temp 1D buffer to read the data from file. ---*/
+  vector<passivedouble> sliceData(nPointSlice*nFields);
 
-  Restart_Data = new passivedouble[nFields*geometry->GetnPointDomain()];
+  /*--- Collective call for all ranks to read their slice simultaneously. ---*/
 
-  /*--- Collective call for all ranks to read from their view simultaneously. ---*/
+  ierr = MPI_File_read_at_all(fhw, disp, sliceData.data(), nPointSlice, pointtype, &status);
 
-  MPI_File_read_all(fhw, Restart_Data, nFields*geometry->GetnPointDomain(), MPI_DOUBLE, &status);
+  int nRead = 0;
+  MPI_Get_count(&status, pointtype, &nRead);
+  if (ierr || (unsigned long)nRead != nPointSlice) {
+    SU2_MPI::Error(string("Error reading restart file ") + string(fname), CURRENT_FUNCTION);
+  }
 
-  /*--- All ranks close the file after writing. ---*/
+  /*--- All ranks close the file after reading and free the derived datatype. ---*/
 
   MPI_File_close(&fhw);
 
-  /*--- Free the derived datatype and release temp memory. ---*/
+  MPI_Type_free(&pointtype);
+
+  /*--- Request the points of this rank, they are visited by increasing global index, hence the
+   requests to each rank are contiguous and the replies are in the order of the restart data. ---*/
+
+  const auto& globalToLocal = geometry->GetGlobal_to_Local_Map();
+  const unsigned long nPointRequest = globalToLocal.size();
 
-  MPI_Type_free(&filetype);
+  vector<unsigned long> sendPoint;
+  sendPoint.reserve(nPointRequest);
 
-  delete [] blocklen;
-  delete [] displace;
+  vector<int> nSend(size, 0), nRecv(size, 0), sendDisp(size+1, 0), recvDisp(size+1, 0);
+
+  for (const auto& iPoint : globalToLocal) {
+    iPoint_Global = iPoint.first;
+    if (iPoint_Global >= nPointFile) {
+      SU2_MPI::Error(string("Restart file ") + string(fname) + string(" has fewer points than the mesh."), CURRENT_FUNCTION);
+    }
+    nSend[filePartitioner.GetRankContainingIndex(iPoint_Global)]++;
+    sendPoint.push_back(iPoint_Global);
+  }
+
+  SU2_MPI::Alltoall(nSend.data(), 1, MPI_INT, nRecv.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+  for (int iRank = 0; iRank < size; iRank++) {
+    sendDisp[iRank+1] = sendDisp[iRank] + nSend[iRank];
+    recvDisp[iRank+1] = recvDisp[iRank] + nRecv[iRank];
+  }
+
+  vector<unsigned long> recvPoint(recvDisp[size]);
+
+  SU2_MPI::Alltoallv(sendPoint.data(), nSend.data(), sendDisp.data(), MPI_UNSIGNED_LONG,
+                     recvPoint.data(), nRecv.data(), recvDisp.data(), MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+
+  /*--- Reply with the data of the requested points of the slice. ---*/
+
+  vector<passivedouble> replyData(recvPoint.size()*nFields);
+
+  for (index = 0; index < recvPoint.size(); index++) {
+    const passivedouble* values = &sliceData[(recvPoint[index]-firstPoint)*nFields];
+    copy(values, values+nFields, &replyData[index*nFields]);
+  }
+
+  for (int iRank = 0; iRank <= size; iRank++) {
+    if (iRank < size) { nSend[iRank] *= nFields; nRecv[iRank] *= nFields; }
+    sendDisp[iRank] *= nFields; recvDisp[iRank] *= nFields;
+  }
+
+  Restart_Data = new passivedouble[nPointRequest*nFields];
+
+  SelectMPIWrapper<passivedouble>::W::Alltoallv(replyData.data(), nRecv.data(), recvDisp.data(), MPI_DOUBLE,
+                                                Restart_Data, nSend.data(), sendDisp.data(), MPI_DOUBLE,
+                                                MPI_COMM_WORLD);
 
 #endif
 
 }
 
+vector<passivedouble> CSolver::ReadRestartFields(CGeometry *geometry, CConfig *config, string val_filename,
+                                                 unsigned short offset, unsigned short nFields) {
+
+  if (config->GetRead_Binary_Restart()) {
+    Read_SU2_Restart_Binary(geometry, config, val_filename);
+  } else {
+    Read_SU2_Restart_ASCII(geometry, config, val_filename);
+  }
+
+  const unsigned short skipVars = geometry->GetnDim() + offset;
+
+  if (Restart_Vars[1] < skipVars + nFields)
+    SU2_MPI::Error(string("The solution file ") + val_filename + string(" does not have enough fields."), CURRENT_FUNCTION);
+
+  /*--- The data of the points of this rank is in the order of their global index. ---*/
+
+  vector<passivedouble> fields(geometry->GetnPointDomain()*nFields);
+
+  unsigned long counter = 0;
+  for (const auto& globalToLocal : geometry->GetGlobal_to_Local_Map()) {
+    const unsigned long index = counter*Restart_Vars[1] + skipVars;
+    copy_n(&Restart_Data[index], nFields, &fields[globalToLocal.second*nFields]);
+    counter++;
+  }
+
+  delete [] Restart_Vars; Restart_Vars = nullptr;
+  delete [] Restart_Data; Restart_Data = nullptr;
+
+  return fields;
+}
+
 void CSolver::Read_SU2_Restart_Metadata(CGeometry *geometry, CConfig *config, bool adjoint, string val_filename) {
 
   su2double AoA_ = config->GetAoA();
@@ -3973,85 +4246,100 @@ void CSolver::Read_SU2_Restart_Metadata(CGeometry *geometry, CConfig *config, bo
   unsigned long InnerIter_ = 0;
   ifstream restart_file;
 
-  /*--- Carry on with ASCII metadata reading. ---*/
+  /*--- Carry on with ASCII metadata reading, only the master rank reads the file and broadcasts the values. ---*/
 
-  restart_file.open(val_filename.data(), ios::in);
-  if (restart_file.fail()) {
-    if (rank == MASTER_NODE) {
+  int noFile = 0;
+
+  if (rank == MASTER_NODE) {
+
+    restart_file.open(val_filename.data(), ios::in);
+    if (restart_file.fail()) {
+      noFile = 1;
       cout << " Warning: There is no restart file (" << val_filename.data() << ")."<< endl;
       cout << " Computation will continue without updating metadata parameters." << endl;
     }
-  }
-  else {
+    else {
 
-    string text_line;
+      string text_line;
 
-    /*--- Space for extra info (if any) ---*/
+      /*--- Space for extra info (if any) ---*/
 
-    while (getline (restart_file, text_line)) {
+      while (getline (restart_file, text_line)) {
 
-      /*--- External iteration ---*/
+        /*--- External iteration ---*/
 
-      position = text_line.find ("ITER=",0);
-      if (position != string::npos) {
-        text_line.erase (0,9); InnerIter_ = atoi(text_line.c_str());
-      }
+        position = text_line.find ("ITER=",0);
+        if (position != string::npos) {
+          text_line.erase (0,9); InnerIter_ = atoi(text_line.c_str());
+        }
 
-      /*--- Angle of attack ---*/
+        /*--- Angle of attack ---*/
 
-      position = text_line.find ("AOA=",0);
-      if (position != string::npos) {
-        text_line.erase (0,4); AoA_ = atof(text_line.c_str());
-      }
+        position = text_line.find ("AOA=",0);
+        if (position != string::npos) {
+          text_line.erase (0,4); AoA_ = atof(text_line.c_str());
+        }
 
-      /*--- Sideslip angle ---*/
+        /*--- Sideslip angle ---*/
 
-      position = text_line.find ("SIDESLIP_ANGLE=",0);
-      if (position != string::npos) {
-        text_line.erase (0,15); AoS_ = atof(text_line.c_str());
-      }
+        position = text_line.find ("SIDESLIP_ANGLE=",0);
+        if (position != string::npos) {
+          text_line.erase (0,15); AoS_ = atof(text_line.c_str());
+        }
 
-      /*--- BCThrust angle ---*/
+        /*--- BCThrust angle ---*/
 
-      position = text_line.find ("INITIAL_BCTHRUST=",0);
-      if (position != string::npos) {
-        text_line.erase (0,17); BCThrust_ = atof(text_line.c_str());
-      }
+        position = text_line.find ("INITIAL_BCTHRUST=",0);
+        if (position != string::npos) {
+          text_line.erase (0,17); BCThrust_ = atof(text_line.c_str());
+        }
 
-      /*--- dCD_dCL coefficient ---*/
+        /*--- dCD_dCL coefficient ---*/
 
-      position = text_line.find ("DCD_DCL_VALUE=",0);
-      if (position != string::npos) {
-        text_line.erase (0,14); dCD_dCL_ = atof(text_line.c_str());
-      }
+        position = text_line.find ("DCD_DCL_VALUE=",0);
+        if (position != string::npos) {
+          text_line.erase (0,14); dCD_dCL_ = atof(text_line.c_str());
+        }
 
-      /*--- dCMx_dCL coefficient ---*/
+        /*--- dCMx_dCL coefficient ---*/
 
-      position = text_line.find ("DCMX_DCL_VALUE=",0);
-      if (position != string::npos) {
-        text_line.erase (0,15); dCMx_dCL_ = atof(text_line.c_str());
-      }
+        position = text_line.find ("DCMX_DCL_VALUE=",0);
+        if (position != string::npos) {
+          text_line.erase (0,15); dCMx_dCL_ = atof(text_line.c_str());
+        }
 
-      /*--- dCMy_dCL coefficient ---*/
+        /*--- dCMy_dCL coefficient ---*/
 
-      position = text_line.find ("DCMY_DCL_VALUE=",0);
-      if (position != string::npos) {
-        text_line.erase (0,15); dCMy_dCL_ = atof(text_line.c_str());
-      }
+        position = text_line.find ("DCMY_DCL_VALUE=",0);
+        if (position != string::npos) {
+          text_line.erase (0,15); dCMy_dCL_ = atof(text_line.c_str());
+        }
 
-      /*--- dCMz_dCL coefficient ---*/
+        /*--- dCMz_dCL coefficient ---*/
+
+        position = text_line.find ("DCMZ_DCL_VALUE=",0);
+        if (position != string::npos) {
+          text_line.erase (0,15); dCMz_dCL_ = atof(text_line.c_str());
+        }
 
-      position = text_line.find ("DCMZ_DCL_VALUE=",0);
-      if (position != string::npos) {
-        text_line.erase (0,15); dCMz_dCL_ = atof(text_line.c_str());
       }
 
+      /*--- Close the restart meta file. ---*/
+
+      restart_file.close();
+
     }
 
-    /*--- Close the restart meta file. ---*/
+  }
 
-    restart_file.close();
+  SU2_MPI::Bcast(&noFile, 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
 
+  if (!noFile) {
+    su2double values[] = {AoA_, AoS_, BCThrust_, dCD_dCL_, dCMx_dCL_, dCMy_dCL_, dCMz_dCL_};
+    SU2_MPI::Bcast(values, 7, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Bcast(&InnerIter_, 1, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+    AoA_ = values[0]; AoS_ = values[1]; BCThrust_ = values[2]; dCD_dCL_ = values[3];
+    dCMx_dCL_ = values[4]; dCMy_dCL_ = values[5]; dCMz_dCL_ = values[6];
   }
 
 
@@ -4258,7 +4546,7 @@ void CSolver::LoadInletProfile(CGeometry **geometry,
 
       /*--- Get data for this profile. ---*/
 
-      vector<passivedouble> Inlet_Data = profileReader.GetDataForProfile(jMarker);
+      const vector<passivedouble>& Inlet_Data = profileReader.GetDataForProfile(jMarker);
       unsigned short nColumns = profileReader.GetNumberOfColumnsInProfile(jMarker);
       vector<su2double> Inlet_Data_Interpolated ((nCol_InletFile+nDim)*geometry[MESH_0]->nVertex[iMarker]);
 
@@ -4306,6 +4594,22 @@ void CSolver::LoadInletProfile(CGeometry **geometry,
           break;
       }
 
+      /*--- Without interpolation the vertices are matched to the nearest profile point, which is
+       found with a tree of the profile points (only if this rank has vertices on the marker). ---*/
+
+      CADTPointsOnlyClass* profileTree = nullptr;
+
+      if (!Interpolate && (nRows > 0) && (geometry[MESH_0]->nVertex[iMarker] > 0)) {
+        vector<su2double> profileCoord(nRows*nDim);
+        vector<unsigned long> profileRow(nRows);
+        for (iRow = 0; iRow < nRows; iRow++) {
+          for (iDim = 0; iDim < nDim; iDim++)
+            profileCoord[iRow*nDim+iDim] = Inlet_Data[iRow*nColumns+iDim];
+          profileRow[iRow] = iRow;
+        }
+        profileTree = new CADTPointsOnlyClass(nDim, nRows, profileCoord.data(), profileRow.data(), false);
+      }
+
       if (Interpolate == true){
         switch(config->GetKindInletInterpolationType()){
           case(VR_VTHETA):
@@ -4337,27 +4641,15 @@ void CSolver::LoadInletProfile(CGeometry **geometry,
 
           min_dist = 1e16;
 
-          /*--- Find the distance to the closest point in our inlet profile data. ---*/
+          /*--- Find the closest point in our inlet profile data. ---*/
 
-          for (iRow = 0; iRow < nRows; iRow++) {
-
-            /*--- Get the coords for this data point. ---*/
+          if (profileTree != nullptr) {
+            int rankID;
+            profileTree->DetermineNearestNode(Coord, min_dist, iRow, rankID);
 
             index = iRow*nColumns;
-
-            dist = 0.0;
-            for (unsigned short iDim = 0; iDim < nDim; iDim++)
-            dist += pow(Inlet_Data[index+iDim] - Coord[iDim], 2);
-            dist = sqrt(dist);
-
-            /*--- Check is this is the closest point and store data if so. ---*/
-
-            if (dist < min_dist) {
-            min_dist = dist;
             for (iVar = 0; iVar < nColumns; iVar++)
               Inlet_Values[iVar] = Inlet_Data[index+iVar];
-            }
-
           }
 
           /*--- If the diff is less than the tolerance, match the two.
@@ -4443,6 +4735,7 @@ void CSolver::LoadInletProfile(CGeometry **geometry,
 
       for (int i=0; i<nColumns;i++)
         delete interpolator[i];
+      delete profileTree;
 
     } // end jMarker loop
 
@@ -233,11 +233,14 @@ CSolver* CSolverFactory::createSubSolver(SUB_SOLVER_TYPE kindSolver, CSolver **s
       break;
     case SUB_SOLVER_TYPE::EULER:
       genericSolver = createFlowSolver(SUB_SOLVER_TYPE::EULER, solver, geometry, config, iMGLevel);
-      metaData.integrationType = INTEGRATION_TYPE::MULTIGRID;
+      metaData.integrationType = config->GetNewtonKrylov()? INTEGRATION_TYPE::NEWTON : INTEGRATION_TYPE::MULTIGRID;
       break;
     case SUB_SOLVER_TYPE::NAVIER_STOKES:
       genericSolver = createFlowSolver(SUB_SOLVER_TYPE::NAVIER_STOKES, solver, geometry, config, iMGLevel);
-      metaData.integrationType = INTEGRATION_TYPE::MULTIGRID;
+      if (config->GetCoupledTurbulence())
+        metaData.integrationType = INTEGRATION_TYPE::COUPLED_TURB;
+      else
+        metaData.integrationType = config->GetNewtonKrylov()? INTEGRATION_TYPE::NEWTON : INTEGRATION_TYPE::MULTIGRID;
       break;
     case SUB_SOLVER_TYPE::INC_EULER:
       genericSolver = createFlowSolver(SUB_SOLVER_TYPE::INC_EULER, solver, geometry, config, iMGLevel);
@@ -277,7 +280,7 @@ CSolver* CSolverFactory::createSubSolver(SUB_SOLVER_TYPE kindSolver, CSolver **s
       break;
     case SUB_SOLVER_TYPE::TURB: case SUB_SOLVER_TYPE::TURB_SA: case SUB_SOLVER_TYPE::TURB_SST:
       genericSolver = createTurbSolver(kindTurbModel, solver, geometry, config, iMGLevel, false);
-      metaData.integrationType = INTEGRATION_TYPE::SINGLEGRID;
+      metaData.integrationType = config->GetMG_Turbulence()? INTEGRATION_TYPE::MULTIGRID : INTEGRATION_TYPE::SINGLEGRID;
       break;
     case SUB_SOLVER_TYPE::TEMPLATE:
       genericSolver = new CTemplateSolver(geometry, config);
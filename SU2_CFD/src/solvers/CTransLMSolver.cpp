@@ -28,24 +28,16 @@
 
 #include "../../include/solvers/CTransLMSolver.hpp"
 #include "../../include/variables/CTransLMVariable.hpp"
-#include "../../include/variables/CTurbSAVariable.hpp"
 
 
 CTransLMSolver::CTransLMSolver(void) : CTurbSolver() {}
 
-CTransLMSolver::CTransLMSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh) : CTurbSolver() {
+CTransLMSolver::CTransLMSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh)
+              : CTurbSolver(geometry, config) {
   unsigned short iVar, iDim, nLineLets;
-  unsigned long iPoint, index;
-  su2double tu_Inf, dull_val, rey;
-  ifstream restart_file;
-  char *cstr;
-  string text_line;
+  su2double tu_Inf;
 
-  bool restart = (config->GetRestart() || config->GetRestart_Flow());
-
-  cout << "Entered constructor for CTransLMSolver -AA\n";
-  Gamma = config->GetGamma();
-  Gamma_Minus_One = Gamma - 1.0;
+  const bool multizone = config->GetMultizone_Problem();
 
   /*--- Define geometry constans in the solver structure ---*/
   nDim = geometry->GetnDim();
@@ -54,115 +46,104 @@ CTransLMSolver::CTransLMSolver(CGeometry *geometry, CConfig *config, unsigned sh
 
   /*--- Dimension of the problem --> 2 Transport equations (intermittency, Reth) ---*/
   nVar = 2;
+  nPrimVar = 2;
 
   /*--- Initialize nVarGrad for deallocation ---*/
 
   nVarGrad = nVar;
 
-  if (iMesh == MESH_0) {
+  /*--- Single grid simulation, or multigrid of the turbulence equations ---*/
+
+  MGLevel = iMesh;
+
+  if (iMesh == MESH_0 || config->GetMGCycle() == FULLMG_CYCLE || config->GetMG_Turbulence()) {
 
     /*--- Define some auxillary vectors related to the residual ---*/
-    Residual     = new su2double[nVar]; Residual_RMS = new su2double[nVar];
-    Residual_i   = new su2double[nVar]; Residual_j   = new su2double[nVar];
-    Residual_Max = new su2double[nVar];
+    Residual     = new su2double[nVar](); Residual_RMS = new su2double[nVar]();
+    Residual_i   = new su2double[nVar](); Residual_j   = new su2double[nVar]();
+    Residual_Max = new su2double[nVar]();
 
     /*--- Define some structures for locating max residuals ---*/
-    Point_Max = new unsigned long[nVar];
-    for (iVar = 0; iVar < nVar; iVar++) Point_Max[iVar] = 0;
+    Point_Max = new unsigned long[nVar]();
     Point_Max_Coord = new su2double*[nVar];
-    for (iVar = 0; iVar < nVar; iVar++) {
-      Point_Max_Coord[iVar] = new su2double[nDim];
-      for (iDim = 0; iDim < nDim; iDim++) Point_Max_Coord[iVar][iDim] = 0.0;
-    }
+    for (iVar = 0; iVar < nVar; iVar++)
+      Point_Max_Coord[iVar] = new su2double[nDim]();
 
     /*--- Define some auxiliar vector related with the solution ---*/
     Solution   = new su2double[nVar];
     Solution_i = new su2double[nVar]; Solution_j = new su2double[nVar];
 
-    /*--- Define some auxiliar vector related with the geometry ---*/
-    Vector_i = new su2double[nDim]; Vector_j = new su2double[nDim];
-
-    LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
-    LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
-
-    /*--- Jacobians and vector structures for implicit computations ---*/
-    if (config->GetKind_TimeIntScheme_Turb() == EULER_IMPLICIT) {
-
-      /*--- Point to point Jacobians ---*/
-      Jacobian_i = new su2double* [nVar];
-      Jacobian_j = new su2double* [nVar];
-      for (iVar = 0; iVar < nVar; iVar++) {
-        Jacobian_i[iVar] = new su2double [nVar];
-        Jacobian_j[iVar] = new su2double [nVar];
-      }
-      /*--- Initialization of the structure of the whole Jacobian ---*/
-      Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
-
-      if (config->GetKind_Linear_Solver_Prec() == LINELET) {
-        nLineLets = Jacobian.BuildLineletPreconditioner(geometry, config);
-        if (rank == MASTER_NODE) cout << "Compute linelet structure. " << nLineLets << " elements in each line (average)." << endl;
-      }
-
+    /*--- Point to point Jacobians (boundary conditions) ---*/
+    Jacobian_i = new su2double* [nVar];
+    Jacobian_j = new su2double* [nVar];
+    for (iVar = 0; iVar < nVar; iVar++) {
+      Jacobian_i[iVar] = new su2double [nVar]();
+      Jacobian_j[iVar] = new su2double [nVar]();
     }
 
-  /*--- Computation of gradients by least squares ---*/
-  if (config->GetLeastSquaresRequired()) {
-    /*--- S matrix := inv(R)*traspose(inv(R)) ---*/
-    Smatrix = new su2double* [nDim];
-    for (iDim = 0; iDim < nDim; iDim++)
-      Smatrix[iDim] = new su2double [nDim];
-    /*--- c vector := transpose(WA)*(Wb) ---*/
-    Cvector = new su2double* [nVar];
-    for (iVar = 0; iVar < nVar; iVar++)
-      Cvector[iVar] = new su2double [nDim];
-  }
+    /*--- Initialization of the structure of the whole Jacobian, the sparse pattern
+     *    (and edge map) of the geometry is shared with the flow and turbulence solvers. ---*/
 
-    /*--- Read farfield conditions from config ---*/
-    Intermittency_Inf = config->GetIntermittency_FreeStream();
-    tu_Inf            = config->GetTurbulenceIntensity_FreeStream();
+    if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (LM model)." << endl;
+    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config, ReducerStrategy);
 
-    /*-- Initialize REth from correlation --*/
-    if (tu_Inf <= 1.3) {
-      REth_Inf = (1173.51-589.428*tu_Inf+0.2196/(tu_Inf*tu_Inf));
-    } else {
-      REth_Inf = 331.5*pow(tu_Inf-0.5658,-0.671);
+    if (config->GetKind_Linear_Solver_Prec() == LINELET) {
+      nLineLets = Jacobian.BuildLineletPreconditioner(geometry, config);
+      if (rank == MASTER_NODE) cout << "Compute linelet structure. " << nLineLets << " elements in each line (average)." << endl;
     }
-    rey = config->GetReynolds();
 
-    //  REth_Inf *= mach/rey;
-    cout << "REth_Inf = " << REth_Inf << ", rey: "<< rey << " -AA" << endl;
+    LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
+    LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
 
-    /*--- Restart the solution from file information ---*/
-    if (!restart) nodes = new CTransLMVariable(Intermittency_Inf, REth_Inf, nPoint, nDim, nVar, config);
+    if (ReducerStrategy)
+      EdgeFluxes.Initialize(geometry->GetnEdge(), geometry->GetnEdge(), nVar, nullptr);
+
+    /*--- Computation of gradients by least squares ---*/
+    if (config->GetLeastSquaresRequired()) {
+      /*--- S matrix := inv(R)*traspose(inv(R)) ---*/
+      Smatrix = new su2double* [nDim];
+      for (iDim = 0; iDim < nDim; iDim++)
+        Smatrix[iDim] = new su2double [nDim];
+      /*--- c vector := transpose(WA)*(Wb) ---*/
+      Cvector = new su2double* [nVar];
+      for (iVar = 0; iVar < nVar; iVar++)
+        Cvector[iVar] = new su2double [nDim];
+    }
 
-  } else { /*--- Coarse levels ---*/
+    /*--- Initialize the BGS residuals in multizone problems. ---*/
+    if (multizone){
+      Residual_BGS      = new su2double[nVar]();
+      Residual_Max_BGS  = new su2double[nVar]();
 
-    cout << "No LM restart yet!!" << endl; // TODO, Aniket
-    int j;
-    cin >> j;
-    string mesh_filename = config->GetSolution_FileName();
-    cstr = new char [mesh_filename.size()+1];
-    strcpy (cstr, mesh_filename.c_str());
-    restart_file.open(cstr, ios::in);
-    if (restart_file.fail()) {
-      SU2_MPI::Error("There is no turbulent restart file.", CURRENT_FUNCTION);
+      Point_Max_BGS       = new unsigned long[nVar]();
+      Point_Max_Coord_BGS = new su2double*[nVar];
+      for (iVar = 0; iVar < nVar; iVar++)
+        Point_Max_Coord_BGS[iVar] = new su2double[nDim] ();
     }
+  }
 
-    nodes = new CTurbSAVariable(0.0, 0.0, nPoint, nDim, nVar, config);
+  /*--- Read farfield conditions from config ---*/
+  Intermittency_Inf = config->GetIntermittency_FreeStream();
+  tu_Inf            = config->GetTurbulenceIntensity_FreeStream();
 
-    for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
-      getline(restart_file, text_line);
-      istringstream point_line(text_line);
-      if (nDim == 2) point_line >> index >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> Solution[0];
-      if (nDim == 3) point_line >> index >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> Solution[0];
-      nodes->SetSolution(iPoint,0,Solution[0]);
-      nodes->SetSolution_Old(iPoint,0,Solution[0]);
-    }
-    restart_file.close();
+  /*-- Initialize REth from correlation --*/
+  if (tu_Inf <= 1.3) {
+    REth_Inf = (1173.51-589.428*tu_Inf+0.2196/(tu_Inf*tu_Inf));
+  } else {
+    REth_Inf = 331.5*pow(tu_Inf-0.5658,-0.671);
   }
 
+  /*--- Initialize the solution to the far-field state everywhere (on all levels),
+   *    a restart overwrites it in LoadRestart. ---*/
+
+  nodes = new CTransLMVariable(Intermittency_Inf, REth_Inf, nPoint, nDim, nVar, config);
   SetBaseClassPointerToNodes();
 
+  /*--- The transition equations are always solved implicitly, so set the
+   implicit flag in case we have periodic BCs. ---*/
+
+  SetImplicitPeriodic(true);
+
   /*--- Add the solver name (max 8 characters) ---*/
   SolverName = "TRANS";
 
@@ -173,211 +154,128 @@ CTransLMSolver::~CTransLMSolver(void) {
 }
 
 void CTransLMSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iMesh, unsigned short iRKStep, unsigned short RunTime_EqSystem, bool Output) {
-  unsigned long iPoint;
 
-  for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint ++)
-    LinSysRes.SetBlock_Zero(iPoint);
-  Jacobian.SetValZero();
+  const bool limiter = (config->GetKind_SlopeLimit_Turb() != NO_LIMITER) &&
+                       (config->GetInnerIter() <= config->GetLimiterIter());
+
+  /*--- Clear residual and system matrix, not needed for
+   * reducer strategy as we write over the entire matrix. ---*/
+  if (!ReducerStrategy) {
+    LinSysRes.SetValZero();
+    Jacobian.SetValZero();
+  }
+
+  /*--- Upwind second order reconstruction and gradients ---*/
+
+  if (config->GetReconstructionGradientRequired()) {
+    if (config->GetKind_Gradient_Method_Recon() == GREEN_GAUSS)
+      SetSolution_Gradient_GG(geometry, config, true);
+    if (config->GetKind_Gradient_Method_Recon() == LEAST_SQUARES)
+      SetSolution_Gradient_LS(geometry, config, true);
+    if (config->GetKind_Gradient_Method_Recon() == WEIGHTED_LEAST_SQUARES)
+      SetSolution_Gradient_LS(geometry, config, true);
+  }
+
+  if (config->GetKind_Gradient_Method() == GREEN_GAUSS)
+    SetSolution_Gradient_GG(geometry, config);
+
+  if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES)
+    SetSolution_Gradient_LS(geometry, config);
 
-  if (config->GetKind_Gradient_Method() == GREEN_GAUSS) SetSolution_Gradient_GG(geometry, config);
-  if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) SetSolution_Gradient_LS(geometry, config);
+  if (limiter) SetSolution_Limiter(geometry, config);
 }
 
 void CTransLMSolver::Postprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iMesh) {
 
   /*--- Correction for separation-induced transition, Replace intermittency with gamma_eff ---*/
-  for (unsigned int iPoint = 0; iPoint < geometry->GetnPoint(); iPoint ++)
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint ++)
     nodes->SetGammaEff(iPoint);
 }
 
 void CTransLMSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
 
-  unsigned short iVar;
-  unsigned long iPoint, total_index;
-  su2double Delta, Delta_flow, Vol;
-
-
-  /*--- Set maximum residual to zero ---*/
-
-  for (iVar = 0; iVar < nVar; iVar++) {
-    SetRes_RMS(iVar, 0.0);
-    SetRes_Max(iVar, 0.0, 0);
-  }
+  CVariable* flowNodes = solver_container[FLOW_SOL]->GetNodes();
 
-  /*--- Build implicit system ---*/
+  /*--- The transition equations are advanced with the local time step of the flow,
+   *    the diagonal of the system is then built by the generic method. ---*/
 
-  for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
-    Vol = geometry->node[iPoint]->GetVolume();
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
+    nodes->SetLocalCFL(iPoint, flowNodes->GetLocalCFL(iPoint));
 
-    /*--- Modify matrix diagonal to assure diagonal dominance ---*/
+  PrepareImplicitIteration(geometry, solver_container, config);
 
-    Delta_flow = Vol / (solver_container[FLOW_SOL]->GetNodes()->GetDelta_Time(iPoint));
-    Delta = Delta_flow;
-    Jacobian.AddVal2Diag(iPoint, Delta);
-
-    for (iVar = 0; iVar < nVar; iVar++) {
-      total_index = iPoint*nVar+iVar;
-
-      /*--- Right hand side of the system (-Residual) and initial guess (x = 0) ---*/
+  /*--- Solve or smooth the linear system ---*/
 
-      LinSysRes[total_index] = -LinSysRes[total_index];
-      LinSysSol[total_index] = 0.0;
-      AddRes_RMS(iVar, LinSysRes[total_index]*LinSysRes[total_index]*Vol);
-      AddRes_Max(iVar, fabs(LinSysRes[total_index]), geometry->node[iPoint]->GetGlobalIndex(), geometry->node[iPoint]->GetCoord());
-    }
+  auto iter = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
+  SU2_OMP_MASTER
+  {
+    SetIterLinSolver(iter);
+    SetResLinSolver(System.GetResidual());
   }
+  SU2_OMP_BARRIER
 
-  /*--- Initialize residual and solution at the ghost points ---*/
+  /*--- Update solution (system written in terms of increments), without the
+   *    clipping and under-relaxation of the turbulence variables. ---*/
 
-  for (iPoint = geometry->GetnPointDomain(); iPoint < geometry->GetnPoint(); iPoint++) {
-    for (iVar = 0; iVar < nVar; iVar++) {
-      total_index = iPoint*nVar + iVar;
-      LinSysRes[total_index] = 0.0;
-      LinSysSol[total_index] = 0.0;
-    }
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (unsigned short iVar = 0; iVar < nVar; iVar++)
+      nodes->AddSolution(iPoint, iVar, LinSysSol(iPoint,iVar));
   }
 
-  /*--- Solve or smooth the linear system ---*/
+  SU2_OMP_MASTER
+  {
+    /*--- MPI solution ---*/
 
-  System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
+    InitiateComms(geometry, config, SOLUTION);
+    CompleteComms(geometry, config, SOLUTION);
 
-  /*--- Update solution (system written in terms of increments) ---*/
+    /*--- Compute the root mean square residual ---*/
 
-  for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
-    for (iVar = 0; iVar < nVar; iVar++)
-      nodes->AddSolution(iPoint,iVar, LinSysSol[iPoint*nVar+iVar]);
+    SetResidual_RMS(geometry, config);
   }
-
-  /*--- MPI solution ---*/
-
-  InitiateComms(geometry, config, SOLUTION);
-  CompleteComms(geometry, config, SOLUTION);
-
-  /*--- Compute the root mean square residual ---*/
-
-  SetResidual_RMS(geometry, config);
+  SU2_OMP_BARRIER
 
 }
 
-void CTransLMSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_container,
+void CTransLMSolver::Source_Residual(CGeometry *geometry, CSolver **solver_container,
                                      CNumerics **numerics_container, CConfig *config, unsigned short iMesh) {
 
-  CNumerics* numerics = numerics_container[CONV_TERM];
-
-  su2double *trans_var_i, *trans_var_j, *U_i, *U_j;
-  unsigned long iEdge, iPoint, jPoint;
-
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-
-    /*--- Points in edge and normal vectors ---*/
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
-    numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
-
-    /*--- Conservative variables w/o reconstruction ---*/
-    U_i = solver_container[FLOW_SOL]->GetNodes()->GetSolution(iPoint);
-    U_j = solver_container[FLOW_SOL]->GetNodes()->GetSolution(jPoint);
-    numerics->SetConservative(U_i, U_j);
-
-    /*--- Transition variables w/o reconstruction ---*/
-    trans_var_i = nodes->GetSolution(iPoint);
-    trans_var_j = nodes->GetSolution(jPoint);
-    numerics->SetTransVar(trans_var_i, trans_var_j);
-
-    /*--- Add and subtract Residual ---*/
-    numerics->ComputeResidual(Residual, Jacobian_i, Jacobian_j, config);
-    LinSysRes.AddBlock(iPoint, Residual);
-    LinSysRes.SubtractBlock(jPoint, Residual);
-
-    /*--- Implicit part ---*/
-    Jacobian.UpdateBlocks(iEdge, iPoint, jPoint, Jacobian_i, Jacobian_j);
-
-  }
-
-}
-
-
-void CTransLMSolver::Viscous_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
-                                        CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
-
-  CNumerics* numerics = numerics_container[VISC_TERM];
-
-  unsigned long iEdge, iPoint, jPoint;
-
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-
-    /*--- Points in edge ---*/
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
-
-    /*--- Points coordinates, and normal vector ---*/
-    numerics->SetCoord(geometry->node[iPoint]->GetCoord(),
-                     geometry->node[jPoint]->GetCoord());
-
-    numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
-
-    /*--- Conservative variables w/o reconstruction ---*/
-    numerics->SetConservative(solver_container[FLOW_SOL]->GetNodes()->GetSolution(iPoint),
-                              solver_container[FLOW_SOL]->GetNodes()->GetSolution(jPoint));
-
-    /*--- Laminar Viscosity ---*/
-    numerics->SetLaminarViscosity(solver_container[FLOW_SOL]->GetNodes()->GetLaminarViscosity(iPoint),
-                                  solver_container[FLOW_SOL]->GetNodes()->GetLaminarViscosity(jPoint));
-    /*--- Eddy Viscosity ---*/
-    numerics->SetEddyViscosity(solver_container[FLOW_SOL]->GetNodes()->GetEddyViscosity(iPoint),
-                               solver_container[FLOW_SOL]->GetNodes()->GetEddyViscosity(jPoint));
+  CVariable* flowNodes = solver_container[FLOW_SOL]->GetNodes();
 
-    /*--- Transition variables w/o reconstruction, and its gradients ---*/
-    numerics->SetTransVar(nodes->GetSolution(iPoint), nodes->GetSolution(jPoint));
-    numerics->SetTransVarGradient(nodes->GetGradient(iPoint), nodes->GetGradient(jPoint));
+  /*--- Pick one numerics object per thread. ---*/
+  CNumerics* numerics = numerics_container[SOURCE_FIRST_TERM + omp_get_thread_num()*MAX_TERMS];
 
-//    ToDo: The flow solvers do not use the conservative variable gradients
-//    numerics->SetConsVarGradient(solver_container[FLOW_SOL]->GetNodes()->GetGradient(iPoint),
-//                                 solver_container[FLOW_SOL]->GetNodes()->GetGradient(jPoint));
+  /*--- Loop over all points. ---*/
 
+  SU2_OMP_FOR_DYN(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
-    /*--- Compute residual, and Jacobians ---*/
-    numerics->ComputeResidual(Residual, Jacobian_i, Jacobian_j, config);
+    /*--- Residual and Jacobian of this point (thread safety). ---*/
 
-    /*--- Add and subtract residual, and update Jacobians ---*/
-    LinSysRes.SubtractBlock(iPoint, Residual);
-    LinSysRes.AddBlock(jPoint, Residual);
-
-    Jacobian.UpdateBlocksSub(iEdge, iPoint, jPoint, Jacobian_i, Jacobian_j);
-
-  }
-}
-
-void CTransLMSolver::Source_Residual(CGeometry *geometry, CSolver **solver_container,
-                                     CNumerics **numerics_container, CConfig *config, unsigned short iMesh) {
-
-  CNumerics* numerics = numerics_container[SOURCE_FIRST_TERM];
-
-  unsigned long iPoint;
-  su2double gamma_sep = 0.0;
-
-  //cout << "Setting Trans residual -AA " << endl;
-  cout << "\nBeginAA" << endl;
-  for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
-    cout << "\niPoint: " << iPoint << endl;
+    su2double residual[MAXNVAR] = {0.0}, jacobianRows[MAXNVAR][MAXNVAR] = {{0.0}};
+    su2double* jacobian[MAXNVAR] = {jacobianRows[0], jacobianRows[1]};
+    su2double gamma_sep = 0.0;
 
     /*--- Conservative variables w/o reconstruction ---*/
 
-    numerics->SetConservative(solver_container[FLOW_SOL]->GetNodes()->GetSolution(iPoint), NULL);
+    numerics->SetConservative(flowNodes->GetSolution(iPoint), nullptr);
 
-    /*--- Gradient of the primitive and conservative variables ---*/
+    /*--- Gradient of the primitive variables ---*/
 
-    numerics->SetPrimVarGradient(solver_container[FLOW_SOL]->GetNodes()->GetGradient_Primitive(iPoint), NULL);
+    numerics->SetPrimVarGradient(flowNodes->GetGradient_Primitive(iPoint), nullptr);
 
     /*--- Laminar and eddy viscosity ---*/
 
-    numerics->SetLaminarViscosity(solver_container[FLOW_SOL]->GetNodes()->GetLaminarViscosity(iPoint), 0.0);
-    numerics->SetEddyViscosity(solver_container[FLOW_SOL]->GetNodes()->GetEddyViscosity(iPoint),0.0);
+    numerics->SetLaminarViscosity(flowNodes->GetLaminarViscosity(iPoint), 0.0);
+    numerics->SetEddyViscosity(flowNodes->GetEddyViscosity(iPoint), 0.0);
 
-    /*--- Turbulent variables w/o reconstruction, and its gradient ---*/
+    /*--- Transition variables w/o reconstruction ---*/
 
-    numerics->SetTransVar(nodes->GetSolution(iPoint), NULL);
-    // numerics->SetTransVarGradient(nodes->GetGradient(iPoint), NULL);  // Is this needed??
+    numerics->SetTransVar(nodes->GetSolution(iPoint), nullptr);
 
     /*--- Set volume ---*/
 
@@ -389,7 +287,7 @@ void CTransLMSolver::Source_Residual(CGeometry *geometry, CSolver **solver_conta
 
     /*--- Compute the source term ---*/
 
-    numerics->ComputeResidual_TransLM(Residual, Jacobian_i, NULL, config, gamma_sep);
+    numerics->ComputeResidual_TransLM(residual, jacobian, nullptr, config, gamma_sep);
 
     /*-- Store gamma_sep in variable class --*/
 
@@ -397,8 +295,8 @@ void CTransLMSolver::Source_Residual(CGeometry *geometry, CSolver **solver_conta
 
     /*--- Subtract residual and the Jacobian ---*/
 
-    LinSysRes.SubtractBlock(iPoint, Residual);
-    Jacobian.SubtractBlock2Diag(iPoint, Jacobian_i);
+    LinSysRes.SubtractBlock(iPoint, residual);
+    Jacobian.SubtractBlock2Diag(iPoint, jacobian);
 
   }
 }
@@ -26,6 +26,7 @@
  */
 
 #include "../../include/solvers/CTurbSASolver.hpp"
+#include "../../include/numerics/turbulent/batched_turb_sources.hpp"
 #include "../../include/variables/CTurbSAVariable.hpp"
 #include "../../../Common/include/omp_structure.hpp"
 
@@ -59,9 +60,11 @@ CTurbSASolver::CTurbSASolver(CGeometry *geometry, CConfig *config, unsigned shor
 
   nDim = geometry->GetnDim();
 
-  /*--- Single grid simulation ---*/
+  /*--- Single grid simulation, or multigrid of the turbulence equations ---*/
 
-  if (iMesh == MESH_0 || config->GetMGCycle() == FULLMG_CYCLE) {
+  MGLevel = iMesh;
+
+  if (iMesh == MESH_0 || config->GetMGCycle() == FULLMG_CYCLE || config->GetMG_Turbulence()) {
 
     /*--- Define some auxiliar vector related with the residual ---*/
 
@@ -235,6 +238,9 @@ CTurbSASolver::CTurbSASolver(CGeometry *geometry, CConfig *config, unsigned shor
   Max_CFL_Local = CFL;
   Avg_CFL_Local = CFL;
 
+  /*--- Vectorized source terms, if supported by the options. ---*/
+  SourceBatch = CTurbSourceBatchNumerics::CreateNumerics(nDim, config);
+
   /*--- Add the solver name (max 8 characters) ---*/
   SolverName = "SA";
 
@@ -326,6 +332,10 @@ void CTurbSASolver::Preprocessing(CGeometry *geometry, CSolver **solver_containe
 
   }
 
+  /*--- Evaluate the wall functions, applied later by the wall BCs. ---*/
+
+  if (config->GetWall_Functions()) ComputeNuTilde_WF(geometry, solver_container, config);
+
 }
 
 void CTurbSASolver::Postprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iMesh) {
@@ -368,75 +378,82 @@ void CTurbSASolver::Source_Residual(CGeometry *geometry, CSolver **solver_contai
 
   CVariable* flowNodes = solver_container[FLOW_SOL]->GetNodes();
 
-  /*--- Pick one numerics object per thread. ---*/
-  CNumerics* numerics = numerics_container[SOURCE_FIRST_TERM + omp_get_thread_num()*MAX_TERMS];
+  /*--- Vectorized source terms for batches of points, if supported by the options. ---*/
 
-  /*--- Loop over all points. ---*/
+  if (SourceBatch != nullptr) {
+    Source_Residual_Batched(geometry, solver_container, config);
+  }
+  else {
+    /*--- Pick one numerics object per thread. ---*/
+    CNumerics* numerics = numerics_container[SOURCE_FIRST_TERM + omp_get_thread_num()*MAX_TERMS];
 
-  SU2_OMP_FOR_DYN(omp_chunk_size)
-  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    /*--- Loop over all points. ---*/
 
-    /*--- Conservative variables w/o reconstruction ---*/
+    SU2_OMP_FOR_DYN(omp_chunk_size)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
-    numerics->SetPrimitive(flowNodes->GetPrimitive(iPoint), nullptr);
+      /*--- Conservative variables w/o reconstruction ---*/
 
-    /*--- Gradient of the primitive and conservative variables ---*/
+      numerics->SetPrimitive(flowNodes->GetPrimitive(iPoint), nullptr);
 
-    numerics->SetPrimVarGradient(flowNodes->GetGradient_Primitive(iPoint), nullptr);
+      /*--- Gradient of the primitive and conservative variables ---*/
 
-    /*--- Set vorticity and strain rate magnitude ---*/
+      numerics->SetPrimVarGradient(flowNodes->GetGradient_Primitive(iPoint), nullptr);
 
-    numerics->SetVorticity(flowNodes->GetVorticity(iPoint), nullptr);
+      /*--- Set vorticity and strain rate magnitude ---*/
 
-    numerics->SetStrainMag(flowNodes->GetStrainMag(iPoint), 0.0);
+      numerics->SetVorticity(flowNodes->GetVorticity(iPoint), nullptr);
 
-    /*--- Set intermittency ---*/
+      numerics->SetStrainMag(flowNodes->GetStrainMag(iPoint), 0.0);
 
-    if (transition) {
-      numerics->SetIntermittency(solver_container[TRANS_SOL]->GetNodes()->GetIntermittency(iPoint));
-    }
+      /*--- Set intermittency ---*/
 
-    /*--- Turbulent variables w/o reconstruction, and its gradient ---*/
+      if (transition) {
+        numerics->SetIntermittency(solver_container[TRANS_SOL]->GetNodes()->GetIntermittency(iPoint));
+      }
 
-    numerics->SetTurbVar(nodes->GetSolution(iPoint), nullptr);
-    numerics->SetTurbVarGradient(nodes->GetGradient(iPoint), nullptr);
+      /*--- Turbulent variables w/o reconstruction, and its gradient ---*/
 
-    /*--- Set volume ---*/
+      numerics->SetTurbVar(nodes->GetSolution(iPoint), nullptr);
+      numerics->SetTurbVarGradient(nodes->GetGradient(iPoint), nullptr);
 
-    numerics->SetVolume(geometry->node[iPoint]->GetVolume());
+      /*--- Set volume ---*/
 
-    /*--- Get Hybrid RANS/LES Type and set the appropriate wall distance ---*/
+      numerics->SetVolume(geometry->node[iPoint]->GetVolume());
 
-    if (config->GetKind_HybridRANSLES() == NO_HYBRIDRANSLES) {
+      /*--- Get Hybrid RANS/LES Type and set the appropriate wall distance ---*/
 
-      /*--- Set distance to the surface ---*/
+      if (config->GetKind_HybridRANSLES() == NO_HYBRIDRANSLES) {
 
-      numerics->SetDistance(geometry->node[iPoint]->GetWall_Distance(), 0.0);
+        /*--- Set distance to the surface ---*/
 
-    } else {
+        numerics->SetDistance(geometry->node[iPoint]->GetWall_Distance(), 0.0);
 
-      /*--- Set DES length scale ---*/
+      } else {
 
-      numerics->SetDistance(nodes->GetDES_LengthScale(iPoint), 0.0);
+        /*--- Set DES length scale ---*/
 
-    }
+        numerics->SetDistance(nodes->GetDES_LengthScale(iPoint), 0.0);
 
-    /*--- Compute the source term ---*/
+      }
 
-    auto residual = numerics->ComputeResidual(config);
+      /*--- Compute the source term ---*/
 
-    /*--- Store the intermittency ---*/
+      auto residual = numerics->ComputeResidualPreacc(config);
 
-    if (transition_BC) {
-      nodes->SetGammaBC(iPoint,numerics->GetGammaBC());
-    }
+      /*--- Store the intermittency ---*/
+
+      if (transition_BC) {
+        nodes->SetGammaBC(iPoint,numerics->GetGammaBC());
+      }
 
-    /*--- Subtract residual and the Jacobian ---*/
+      /*--- Subtract residual and the Jacobian ---*/
 
-    LinSysRes.SubtractBlock(iPoint, residual);
+      LinSysRes.SubtractBlock(iPoint, residual);
 
-    Jacobian.SubtractBlock2Diag(iPoint, residual.jacobian_i);
+      Jacobian.SubtractBlock2Diag(iPoint, residual.jacobian_i);
 
+    }
   }
 
   if (harmonic_balance) {
@@ -578,7 +595,7 @@ void CTurbSASolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container
 
       /*--- Compute residuals and Jacobians ---*/
 
-      auto residual = conv_numerics->ComputeResidual(config);
+      auto residual = conv_numerics->ComputeResidualPreacc(config);
 
       /*--- Add residuals and Jacobians ---*/
 
@@ -650,7 +667,7 @@ void CTurbSASolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container, CN
 
       /*--- Compute the residual using an upwind scheme ---*/
 
-      auto residual = conv_numerics->ComputeResidual(config);
+      auto residual = conv_numerics->ComputeResidualPreacc(config);
       LinSysRes.AddBlock(iPoint, residual);
 
       /*--- Jacobian contribution for implicit integration ---*/
@@ -743,7 +760,7 @@ void CTurbSASolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container, C
 
       /*--- Compute the residual using an upwind scheme ---*/
 
-      auto residual = conv_numerics->ComputeResidual(config);
+      auto residual = conv_numerics->ComputeResidualPreacc(config);
       LinSysRes.AddBlock(iPoint, residual);
 
       /*--- Jacobian contribution for implicit integration ---*/
@@ -833,7 +850,7 @@ void CTurbSASolver::BC_Engine_Inflow(CGeometry *geometry, CSolver **solver_conta
 
       /*--- Compute the residual using an upwind scheme ---*/
 
-      auto residual = conv_numerics->ComputeResidual(config);
+      auto residual = conv_numerics->ComputeResidualPreacc(config);
       LinSysRes.AddBlock(iPoint, residual);
 
       /*--- Jacobian contribution for implicit integration ---*/
@@ -930,7 +947,7 @@ void CTurbSASolver::BC_Engine_Exhaust(CGeometry *geometry, CSolver **solver_cont
 
       /*--- Compute the residual using an upwind scheme ---*/
 
-      auto residual = conv_numerics->ComputeResidual(config);
+      auto residual = conv_numerics->ComputeResidualPreacc(config);
       LinSysRes.AddBlock(iPoint, residual);
 
       /*--- Jacobian contribution for implicit integration ---*/
@@ -1089,7 +1106,7 @@ void CTurbSASolver::BC_ActDisk(CGeometry *geometry, CSolver **solver_container,
 
         /*--- Compute the residual using an upwind scheme ---*/
 
-        auto residual = conv_numerics->ComputeResidual(config);
+        auto residual = conv_numerics->ComputeResidualPreacc(config);
         LinSysRes.AddBlock(iPoint, residual);
 
         /*--- Jacobian contribution for implicit integration ---*/
@@ -1200,7 +1217,7 @@ void CTurbSASolver::BC_Inlet_MixingPlane(CGeometry *geometry, CSolver **solver_c
 
       /*--- Compute the residual using an upwind scheme ---*/
 
-      auto conv_residual = conv_numerics->ComputeResidual(config);
+      auto conv_residual = conv_numerics->ComputeResidualPreacc(config);
 
       /*--- Jacobian contribution for implicit integration ---*/
 
@@ -1223,7 +1240,7 @@ void CTurbSASolver::BC_Inlet_MixingPlane(CGeometry *geometry, CSolver **solver_c
 
       /*--- Compute residual, and Jacobians ---*/
 
-      auto visc_residual = visc_numerics->ComputeResidual(config);
+      auto visc_residual = visc_numerics->ComputeResidualPreacc(config);
 
       /*--- Subtract residual, and update Jacobians ---*/
 
@@ -1316,7 +1333,7 @@ void CTurbSASolver::BC_Inlet_Turbo(CGeometry *geometry, CSolver **solver_contain
 
       /*--- Compute the residual using an upwind scheme ---*/
 
-      auto conv_residual = conv_numerics->ComputeResidual(config);
+      auto conv_residual = conv_numerics->ComputeResidualPreacc(config);
 
       /*--- Jacobian contribution for implicit integration ---*/
 
@@ -1339,7 +1356,7 @@ void CTurbSASolver::BC_Inlet_Turbo(CGeometry *geometry, CSolver **solver_contain
 
       /*--- Compute residual, and Jacobians ---*/
 
-      auto visc_residual = visc_numerics->ComputeResidual(config);
+      auto visc_residual = visc_numerics->ComputeResidualPreacc(config);
 
       /*--- Subtract residual, and update Jacobians ---*/
 
@@ -1586,7 +1603,7 @@ void CTurbSASolver::BC_Fluid_Interface(CGeometry *geometry, CSolver **solver_con
 
             /*--- Compute the convective residual using an upwind scheme ---*/
 
-            auto residual = conv_numerics->ComputeResidual(config);
+            auto residual = conv_numerics->ComputeResidualPreacc(config);
 
             /*--- Accumulate the residuals to compute the average ---*/
 
@@ -1620,7 +1637,7 @@ void CTurbSASolver::BC_Fluid_Interface(CGeometry *geometry, CSolver **solver_con
 
           /*--- Compute and update residual ---*/
 
-          auto residual = visc_numerics->ComputeResidual(config);
+          auto residual = visc_numerics->ComputeResidualPreacc(config);
 
           LinSysRes.SubtractBlock(iPoint, residual);
 
@@ -1803,460 +1820,451 @@ void CTurbSASolver::BC_NearField_Boundary(CGeometry *geometry, CSolver **solver_
   //
 }
 
-void CTurbSASolver::SetNuTilde_WF(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics,
-                                  CNumerics *visc_numerics, CConfig *config, unsigned short val_marker) {
+void CTurbSASolver::ComputeNuTilde_WF(CGeometry *geometry, CSolver **solver_container, const CConfig *config) {
 
-  /*--- Local variables ---*/
+  /*--- The stencils pair the domain wall points with each of their interior neighbors,
+   *    they are built by the master thread the first time. ---*/
+
+  SU2_OMP_MASTER
+  SetWallFunction_Stencil(geometry, config, true);
+  SU2_OMP_BARRIER
+
+  CVariable* flowNodes = solver_container[FLOW_SOL]->GetNodes();
+
+  const su2double Gas_Constant = config->GetGas_ConstantND();
+  const su2double Cp = (Gamma / Gamma_Minus_One) * Gas_Constant;
+  const su2double cv1_3 = 7.1*7.1*7.1;
 
-  unsigned short iDim, jDim, iVar, iNode;
-  unsigned long iVertex, iPoint, iPoint_Neighbor, counter;
-
-  su2double func, func_prim;
-  su2double *Normal, Area;
-  su2double div_vel, UnitNormal[3];
-  su2double **grad_primvar, tau[3][3];
-  su2double Vel[3], VelNormal, VelTang[3], VelTangMod, VelInfMod, WallDist[3], WallDistMod;
-  su2double Lam_Visc_Normal, Kin_Visc_Normal, dypw_dyp, Eddy_Visc, nu_til_old, nu_til, cv1_3;
-  su2double T_Normal, P_Normal, Density_Normal;
-  su2double Density_Wall, T_Wall, P_Wall, Lam_Visc_Wall, Tau_Wall, Tau_Wall_Old;
-  su2double *Coord, *Coord_Normal;
-  su2double diff, Delta;
-  su2double U_Tau, U_Plus = 0.0, Gam = 0.0, Beta = 0.0, Phi, Q = 0.0, Y_Plus_White = 0.0, Y_Plus;
-  su2double TauElem[3], TauNormal, TauTangent[3], WallShearStress;
-  su2double Gas_Constant = config->GetGas_ConstantND();
-  su2double Cp = (Gamma / Gamma_Minus_One) * Gas_Constant;
-
-  unsigned short max_iter = 100;
-  su2double tol = 1e-10;
-
-  /*--- Get the freestream velocity magnitude for non-dim. purposes ---*/
-
-  su2double *VelInf = config->GetVelocity_FreeStreamND();
-  VelInfMod = 0.0;
-  for (iDim = 0; iDim < nDim; iDim++)
-    VelInfMod += VelInf[iDim];
-  VelInfMod = sqrt(VelInfMod);
+  const unsigned short max_iter = 100;
+  const su2double tol = 1e-10;
 
   /*--- Compute the recovery factor ---*/
   // su2double-check: laminar or turbulent Pr for this?
-  su2double Recovery = pow(config->GetPrandtl_Lam(),(1.0/3.0));
+  const su2double Recovery = pow(config->GetPrandtl_Lam(),(1.0/3.0));
 
   /*--- Typical constants from boundary layer theory ---*/
 
-  su2double kappa = 0.4;
-  su2double B = 5.5;
+  const su2double kappa = 0.4;
+  const su2double B = 5.5;
 
-  /*--- Identify the boundary by string name ---*/
+  /*--- Only the markers whose BC applies the wall functions (see BC_HeatFlux_Wall). Each stencil
+   *    is independent, the values are applied serially in the original order by SetNuTilde_WF
+   *    (interior points can be in several stencils). ---*/
 
-  string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
+  for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
 
-  /*--- Get the specified wall heat flux from config ---*/
+  if ((config->GetMarker_All_KindBC(iMarker) != HEAT_FLUX) &&
+      (config->GetMarker_All_KindBC(iMarker) != CHT_WALL_INTERFACE)) continue;
 
-  // Wall_HeatFlux = config->GetWall_HeatFlux(Marker_Tag);
+  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+  for (auto iStencil = WallFunc_Ptr[iMarker]; iStencil < WallFunc_Ptr[iMarker+1]; iStencil++) {
 
-  /*--- Loop over all of the vertices on this boundary marker ---*/
+    unsigned short iDim, jDim;
 
-  for(iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    const unsigned long iPoint = WallFunc_Point[iStencil];
+    const unsigned long iPoint_Neighbor = WallFunc_Neighbor[iStencil];
+    const su2double* UnitNormal = &WallFunc_UnitNormal[iStencil*nDim];
+    const su2double WallDistMod = WallFunc_Dist[iStencil];
 
-    /*--- We can use also GetNormal_Neighbor, and eliminate the following loop ---*/
+    /*--- Get the velocity, pressure, and temperature at the nearest
+     (normal) interior point. ---*/
 
-    iPoint_Neighbor = geometry->vertex[val_marker][iVertex]->GetNormal_Neighbor();
+    const su2double P_Normal = flowNodes->GetPressure(iPoint_Neighbor);
+    const su2double T_Normal = flowNodes->GetTemperature(iPoint_Neighbor);
 
-    for(iNode = 0; iNode < geometry->node[iPoint]->GetnPoint(); iNode++) {
-      iPoint_Neighbor = geometry->node[iPoint]->GetPoint(iNode);
+    /*--- Compute the wall-parallel velocity at first point off the wall ---*/
 
-      /*--- Check if the node belongs to the domain (i.e, not a halo node)
-       and the neighbor is not part of the physical boundary ---*/
+    su2double Vel[3] = {0.0}, VelTang[3] = {0.0}, VelNormal = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Vel[iDim] = flowNodes->GetVelocity(iPoint_Neighbor,iDim);
+      VelNormal += Vel[iDim] * UnitNormal[iDim];
+    }
+    for (iDim = 0; iDim < nDim; iDim++)
+      VelTang[iDim] = Vel[iDim] - VelNormal*UnitNormal[iDim];
 
-      if (geometry->node[iPoint]->GetDomain() && (!geometry->node[iPoint_Neighbor]->GetBoundary())) {
+    su2double VelTangMod = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++)
+      VelTangMod += VelTang[iDim]*VelTang[iDim];
+    VelTangMod = sqrt(VelTangMod);
 
-        /*--- Get coordinates of the current vertex and nearest normal point ---*/
+    /*--- Compute the wall temperature using the Crocco-Buseman equation ---*/
 
-        Coord = geometry->node[iPoint]->GetCoord();
-        Coord_Normal = geometry->node[iPoint_Neighbor]->GetCoord();
+    const su2double T_Wall = T_Normal + Recovery*pow(VelTangMod,2.0)/(2.0*Cp);
 
-        /*--- Compute dual-grid area and boundary normal ---*/
+    /*--- Extrapolate the pressure from the interior & compute the
+     wall density using the equation of state ---*/
 
-        Normal = geometry->vertex[val_marker][iVertex]->GetNormal();
+    const su2double P_Wall = P_Normal;
+    const su2double Density_Wall = P_Wall/(Gas_Constant*T_Wall);
 
-        Area = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++)
-          Area += Normal[iDim]*Normal[iDim];
-        Area = sqrt (Area);
+    const su2double Lam_Visc_Wall = flowNodes->GetLaminarViscosity(iPoint);
 
-        for (iDim = 0; iDim < nDim; iDim++)
-          UnitNormal[iDim] = -Normal[iDim]/Area;
+    /*--- The iterations start from the wall shear stress of the previous evaluation,
+     or the first time from the shear stress computed with the stress tensor. ---*/
 
-        /*--- Get the velocity, pressure, and temperature at the nearest
-         (normal) interior point. ---*/
+    su2double Tau_Wall_Old = WallFunc_TauWall[iStencil];
 
-        for (iDim = 0; iDim < nDim; iDim++)
-          Vel[iDim]    = solver_container[FLOW_SOL]->GetNodes()->GetVelocity(iPoint_Neighbor,iDim);
-        P_Normal       = solver_container[FLOW_SOL]->GetNodes()->GetPressure(iPoint_Neighbor);
-        T_Normal       = solver_container[FLOW_SOL]->GetNodes()->GetTemperature(iPoint_Neighbor);
+    if (Tau_Wall_Old <= 0.0) {
 
-        /*--- Compute the wall-parallel velocity at first point off the wall ---*/
+      /*--- Compute the shear stress at the wall in the regular fashion
+       by using the stress tensor on the surface ---*/
 
-        VelNormal = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++)
-          VelNormal += Vel[iDim] * UnitNormal[iDim];
-        for (iDim = 0; iDim < nDim; iDim++)
-          VelTang[iDim] = Vel[iDim] - VelNormal*UnitNormal[iDim];
+      su2double **grad_primvar = flowNodes->GetGradient_Primitive(iPoint);
+      su2double tau[3][3] = {{0.0}}, TauElem[3] = {0.0}, TauTangent[3] = {0.0};
 
-        VelTangMod = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++)
-          VelTangMod += VelTang[iDim]*VelTang[iDim];
-        VelTangMod = sqrt(VelTangMod);
+      su2double div_vel = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++)
+        div_vel += grad_primvar[iDim+1][iDim];
+
+      for (iDim = 0; iDim < nDim; iDim++) {
+        for (jDim = 0 ; jDim < nDim; jDim++) {
+          const su2double Delta = (iDim == jDim)? 1.0 : 0.0;
+          tau[iDim][jDim] = Lam_Visc_Wall*(  grad_primvar[jDim+1][iDim]
+                                           + grad_primvar[iDim+1][jDim]) -
+          TWO3*Lam_Visc_Wall*div_vel*Delta;
+        }
+        for (jDim = 0; jDim < nDim; jDim++)
+          TauElem[iDim] += tau[iDim][jDim]*UnitNormal[jDim];
+      }
 
-        /*--- Compute normal distance of the interior point from the wall ---*/
+      /*--- Compute wall shear stress as the magnitude of the wall-tangential
+       component of the shear stress tensor---*/
 
-        for (iDim = 0; iDim < nDim; iDim++)
-          WallDist[iDim] = (Coord[iDim] - Coord_Normal[iDim]);
+      su2double TauNormal = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++)
+        TauNormal += TauElem[iDim] * UnitNormal[iDim];
 
-        WallDistMod = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++)
-          WallDistMod += WallDist[iDim]*WallDist[iDim];
-        WallDistMod = sqrt(WallDistMod);
+      for (iDim = 0; iDim < nDim; iDim++)
+        TauTangent[iDim] = TauElem[iDim] - TauNormal * UnitNormal[iDim];
 
-        /*--- Compute mach number ---*/
+      su2double WallShearStress = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++)
+        WallShearStress += TauTangent[iDim]*TauTangent[iDim];
+      Tau_Wall_Old = sqrt(WallShearStress);
+    }
 
-        // M_Normal = VelTangMod / sqrt(Gamma * Gas_Constant * T_Normal);
+    /*--- Calculate the quantities from boundary layer theory and
+     iteratively solve for a new wall shear stress. ---*/
 
-        /*--- Compute the wall temperature using the Crocco-Buseman equation ---*/
+    su2double U_Plus = 0.0, Gam = 0.0, Beta = 0.0, Q = 0.0, Y_Plus_White = 0.0;
+    su2double Tau_Wall = 0.0, diff = 1.0;
+    unsigned long counter = 0;
 
-        //T_Wall = T_Normal * (1.0 + 0.5*Gamma_Minus_One*Recovery*M_Normal*M_Normal);
-        T_Wall = T_Normal + Recovery*pow(VelTangMod,2.0)/(2.0*Cp);
+    while (diff > tol) {
 
-        /*--- Extrapolate the pressure from the interior & compute the
-         wall density using the equation of state ---*/
+      /*--- Friction velocity and u+ ---*/
 
-        P_Wall = P_Normal;
-        Density_Wall = P_Wall/(Gas_Constant*T_Wall);
+      const su2double U_Tau = sqrt(Tau_Wall_Old/Density_Wall);
+      U_Plus = VelTangMod/U_Tau;
 
-        /*--- Compute the shear stress at the wall in the regular fashion
-         by using the stress tensor on the surface ---*/
+      /*--- Gamma, Beta, Q, and Phi, defined by Nichols & Nelson (2004) ---*/
 
-        Lam_Visc_Wall = solver_container[FLOW_SOL]->GetNodes()->GetLaminarViscosity(iPoint);
-        grad_primvar  = solver_container[FLOW_SOL]->GetNodes()->GetGradient_Primitive(iPoint);
+      Gam  = Recovery*U_Tau*U_Tau/(2.0*Cp*T_Wall);
+      Beta = 0.0; // For adiabatic flows only
+      Q    = sqrt(Beta*Beta + 4.0*Gam);
+      const su2double Phi = asin(-1.0*Beta/Q);
 
-        div_vel = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++)
-          div_vel += grad_primvar[iDim+1][iDim];
+      /*--- Y+ defined by White & Christoph (compressibility and heat transfer) ---*/
 
-        for (iDim = 0; iDim < nDim; iDim++) {
-          for (jDim = 0 ; jDim < nDim; jDim++) {
-            Delta = 0.0; if (iDim == jDim) Delta = 1.0;
-            tau[iDim][jDim] = Lam_Visc_Wall*(  grad_primvar[jDim+1][iDim]
-                                             + grad_primvar[iDim+1][jDim]) -
-            TWO3*Lam_Visc_Wall*div_vel*Delta;
-          }
-          TauElem[iDim] = 0.0;
-          for (jDim = 0; jDim < nDim; jDim++)
-            TauElem[iDim] += tau[iDim][jDim]*UnitNormal[jDim];
-        }
+      Y_Plus_White = exp((kappa/sqrt(Gam))*(asin((2.0*Gam*U_Plus - Beta)/Q) - Phi))*exp(-1.0*kappa*B);
 
-        /*--- Compute wall shear stress as the magnitude of the wall-tangential
-         component of the shear stress tensor---*/
+      /*--- Spalding's universal form for the BL velocity with the
+       outer velocity form of White & Christoph above. ---*/
 
-        TauNormal = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++)
-          TauNormal += TauElem[iDim] * UnitNormal[iDim];
+      const su2double Y_Plus = U_Plus + Y_Plus_White - (exp(-1.0*kappa*B)*
+                                        (1.0 + kappa*U_Plus + kappa*kappa*U_Plus*U_Plus/2.0 +
+                                         kappa*kappa*kappa*U_Plus*U_Plus*U_Plus/6.0));
 
-        for (iDim = 0; iDim < nDim; iDim++)
-          TauTangent[iDim] = TauElem[iDim] - TauNormal * UnitNormal[iDim];
+      /*--- Calculate an updated value for the wall shear stress
+       using the y+ value, the definition of y+, and the definition of
+       the friction velocity. ---*/
 
-        WallShearStress = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++)
-          WallShearStress += TauTangent[iDim]*TauTangent[iDim];
-        WallShearStress = sqrt(WallShearStress);
+      Tau_Wall = (1.0/Density_Wall)*pow(Y_Plus*Lam_Visc_Wall/WallDistMod,2.0);
 
-        /*--- Calculate the quantities from boundary layer theory and
-         iteratively solve for a new wall shear stress. Use the current wall
-         shear stress as a starting guess for the wall function. ---*/
+      /*--- Difference between the old and new Tau. Update old value. ---*/
 
-        Tau_Wall_Old = WallShearStress;
-        counter = 0; diff = 1.0;
+      diff = fabs(Tau_Wall-Tau_Wall_Old);
+      Tau_Wall_Old += 0.25*(Tau_Wall-Tau_Wall_Old);
 
-        while (diff > tol) {
+      counter++;
+      if (counter > max_iter) {
+        cout << "WARNING: Tau_Wall evaluation has not converged in solver_direct_turbulent" << endl;
+        break;
+      }
 
-          /*--- Friction velocity and u+ ---*/
+    }
 
-          U_Tau = sqrt(Tau_Wall_Old/Density_Wall);
-          U_Plus = VelTangMod/U_Tau;
+    WallFunc_TauWall[iStencil] = Tau_Wall;
 
-          /*--- Gamma, Beta, Q, and Phi, defined by Nichols & Nelson (2004) ---*/
+    /*--- Now compute the Eddy viscosity at the first point off of the wall ---*/
 
-          Gam  = Recovery*U_Tau*U_Tau/(2.0*Cp*T_Wall);
-          Beta = 0.0; // For adiabatic flows only
-          Q    = sqrt(Beta*Beta + 4.0*Gam);
-          Phi  = asin(-1.0*Beta/Q);
+    const su2double Lam_Visc_Normal = flowNodes->GetLaminarViscosity(iPoint_Neighbor);
+    const su2double Density_Normal = flowNodes->GetDensity(iPoint_Neighbor);
+    const su2double Kin_Visc_Normal = Lam_Visc_Normal/Density_Normal;
 
-          /*--- Y+ defined by White & Christoph (compressibility and heat transfer) ---*/
+    const su2double dypw_dyp = 2.0*Y_Plus_White*(kappa*sqrt(Gam)/Q)*sqrt(1.0 - pow(2.0*Gam*U_Plus - Beta,2.0)/(Q*Q));
+    su2double Eddy_Visc = Lam_Visc_Wall*(1.0 + dypw_dyp - kappa*exp(-1.0*kappa*B)*
+                                         (1.0 + kappa*U_Plus
+                                          + kappa*kappa*U_Plus*U_Plus/2.0)
+                                         - Lam_Visc_Normal/Lam_Visc_Wall);
 
-          Y_Plus_White = exp((kappa/sqrt(Gam))*(asin((2.0*Gam*U_Plus - Beta)/Q) - Phi))*exp(-1.0*kappa*B);
+    /*--- Eddy viscosity should be always a positive number ---*/
 
-          /*--- Spalding's universal form for the BL velocity with the
-           outer velocity form of White & Christoph above. ---*/
+    Eddy_Visc = max(0.0, Eddy_Visc);
 
-          Y_Plus = U_Plus + Y_Plus_White - (exp(-1.0*kappa*B)*
-                                            (1.0 + kappa*U_Plus + kappa*kappa*U_Plus*U_Plus/2.0 +
-                                             kappa*kappa*kappa*U_Plus*U_Plus*U_Plus/6.0));
+    /*--- Solve for the new value of nu_tilde given the eddy viscosity and using a Newton method,
+     starting from the current value at the interior point (if positive, from the wall value otherwise). ---*/
 
-          /*--- Calculate an updated value for the wall shear stress
-           using the y+ value, the definition of y+, and the definition of
-           the friction velocity. ---*/
+    su2double nu_til = 0.0, nu_til_old = nodes->GetSolution(iPoint_Neighbor,0);
+    if (nu_til_old <= 0.0) nu_til_old = nodes->GetSolution(iPoint,0);
+    counter = 0; diff = 1.0;
 
-          Tau_Wall = (1.0/Density_Wall)*pow(Y_Plus*Lam_Visc_Wall/WallDistMod,2.0);
+    while (diff > tol) {
 
-          /*--- Difference between the old and new Tau. Update old value. ---*/
+      const su2double func = nu_til_old*nu_til_old*nu_til_old*nu_til_old - (Eddy_Visc/Density_Normal)*(nu_til_old*nu_til_old*nu_til_old + Kin_Visc_Normal*Kin_Visc_Normal*Kin_Visc_Normal*cv1_3);
+      const su2double func_prim = 4.0 * nu_til_old*nu_til_old*nu_til_old - 3.0*(Eddy_Visc/Density_Normal)*(nu_til_old*nu_til_old);
+      nu_til = nu_til_old - func/func_prim;
 
-          diff = fabs(Tau_Wall-Tau_Wall_Old);
-          Tau_Wall_Old += 0.25*(Tau_Wall-Tau_Wall_Old);
+      diff = fabs(nu_til-nu_til_old);
+      nu_til_old = nu_til;
 
-          counter++;
-          if (counter > max_iter) {
-            cout << "WARNING: Tau_Wall evaluation has not converged in solver_direct_turbulent" << endl;
-            break;
-          }
+      counter++;
+      if (counter > max_iter) {
+        cout << "WARNING: Nu_tilde evaluation has not converged." << endl;
+        break;
+      }
 
-        }
+    }
+
+    WallFunc_Value[iStencil] = nu_til;
+  }
+  } // end marker loop
 
-        /*--- Now compute the Eddy viscosity at the first point off of the wall ---*/
+}
+
+void CTurbSASolver::SetNuTilde_WF(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics,
+                                  CNumerics *visc_numerics, CConfig *config, unsigned short val_marker) {
 
-        Lam_Visc_Normal = solver_container[FLOW_SOL]->GetNodes()->GetLaminarViscosity(iPoint_Neighbor);
-        Density_Normal = solver_container[FLOW_SOL]->GetNodes()->GetDensity(iPoint_Neighbor);
-        Kin_Visc_Normal = Lam_Visc_Normal/Density_Normal;
+  /*--- Impose the values of nu tilde computed by ComputeNuTilde_WF at the interior points. ---*/
 
-        dypw_dyp = 2.0*Y_Plus_White*(kappa*sqrt(Gam)/Q)*sqrt(1.0 - pow(2.0*Gam*U_Plus - Beta,2.0)/(Q*Q));
-        Eddy_Visc = Lam_Visc_Wall*(1.0 + dypw_dyp - kappa*exp(-1.0*kappa*B)*
-                                             (1.0 + kappa*U_Plus
-                                              + kappa*kappa*U_Plus*U_Plus/2.0)
-                                             - Lam_Visc_Normal/Lam_Visc_Wall);
+  for (auto iStencil = WallFunc_Ptr[val_marker]; iStencil < WallFunc_Ptr[val_marker+1]; iStencil++) {
 
-        /*--- Eddy viscosity should be always a positive number ---*/
+    const unsigned long iPoint_Neighbor = WallFunc_Neighbor[iStencil];
 
-        Eddy_Visc = max(0.0, Eddy_Visc);
+    for (unsigned short iVar = 0; iVar < nVar; iVar++)
+      Solution[iVar] = WallFunc_Value[iStencil];
 
-        /*--- Solve for the new value of nu_tilde given the eddy viscosity and using a Newton method ---*/
+    nodes->SetSolution_Old(iPoint_Neighbor,Solution);
+    LinSysRes.SetBlock_Zero(iPoint_Neighbor);
 
-        nu_til_old = 0.0; nu_til = 0.0; cv1_3 = 7.1*7.1*7.1;
-        nu_til_old = nodes->GetSolution(iPoint,0);
-        counter = 0; diff = 1.0;
+    /*--- includes 1 in the diagonal ---*/
 
-        while (diff > tol) {
+    Jacobian.DeleteValsRowi(iPoint_Neighbor);
+  }
+}
 
-          func = nu_til_old*nu_til_old*nu_til_old*nu_til_old - (Eddy_Visc/Density_Normal)*(nu_til_old*nu_til_old*nu_til_old + Kin_Visc_Normal*Kin_Visc_Normal*Kin_Visc_Normal*cv1_3);
-          func_prim = 4.0 * nu_til_old*nu_til_old*nu_til_old - 3.0*(Eddy_Visc/Density_Normal)*(nu_til_old*nu_til_old);
-          nu_til = nu_til_old - func/func_prim;
+void CTurbSASolver::SetDES_GeometricScales(CGeometry *geometry, const CConfig *config) {
 
-          diff = fabs(nu_til-nu_til_old);
-          nu_til_old = nu_til;
+  /*--- The geometric parts of the length scales only depend on the grid,
+   *    they are computed once, unless the grid is dynamic. ---*/
 
-          counter++;
-          if (counter > max_iter) {
-            cout << "WARNING: Nu_tilde evaluation has not converged." << endl;
-            break;
-          }
+  if (!DES_MaxLength.empty() && !config->GetDynamic_Grid()) return;
 
-        }
+  const auto kindHybridRANSLES = config->GetKind_HybridRANSLES();
 
-        for (iVar = 0; iVar < nVar; iVar++)
-          Solution[iVar] = nu_til;
+  DES_WallDist.resize(nPointDomain);
+  DES_MaxLength.resize(nPointDomain);
 
-        nodes->SetSolution_Old(iPoint_Neighbor,Solution);
-        LinSysRes.SetBlock_Zero(iPoint_Neighbor);
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    DES_WallDist[iPoint] = geometry->node[iPoint]->GetWall_Distance();
+    DES_MaxLength[iPoint] = geometry->node[iPoint]->GetMaxLength();
+  }
 
-        /*--- includes 1 in the diagonal ---*/
+  /*--- ZDES, max extent of the neighborhood of each point in each direction. ---*/
 
-        Jacobian.DeleteValsRowi(iPoint_Neighbor);
+  if (kindHybridRANSLES == SA_ZDES) {
+    DES_Delta.assign(3*nPointDomain, 0.0);
 
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      const su2double* coord_i = geometry->node[iPoint]->GetCoord();
+      for (unsigned short iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); iNeigh++) {
+        const su2double* coord_j = geometry->node[geometry->node[iPoint]->GetPoint(iNeigh)]->GetCoord();
+        for (unsigned short iDim = 0; iDim < nDim; iDim++)
+          DES_Delta[3*iPoint+iDim] = max(DES_Delta[3*iPoint+iDim], fabs(coord_j[iDim] - coord_i[iDim]));
       }
+    }
+  }
+
+  /*--- EDDES, neighbors of each point and absolute coordinate differences with them. ---*/
+
+  if (kindHybridRANSLES == SA_EDDES) {
+    DES_NeighPtr.assign(1, 0);
+    DES_Neighbor.clear();
+    DES_NeighDelta.clear();
 
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      const su2double* coord_i = geometry->node[iPoint]->GetCoord();
+      for (unsigned short iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); iNeigh++) {
+        const unsigned long jPoint = geometry->node[iPoint]->GetPoint(iNeigh);
+        const su2double* coord_j = geometry->node[jPoint]->GetCoord();
+        DES_Neighbor.push_back(jPoint);
+        for (unsigned short iDim = 0; iDim < 3; iDim++)
+          DES_NeighDelta.push_back((iDim < nDim)? fabs(coord_j[iDim] - coord_i[iDim]) : 0.0);
+      }
+      DES_NeighPtr.push_back(DES_Neighbor.size());
     }
   }
+
 }
 
 void CTurbSASolver::SetDES_LengthScale(CSolver **solver, CGeometry *geometry, CConfig *config){
 
-  unsigned short kindHybridRANSLES = config->GetKind_HybridRANSLES();
-  unsigned long iPoint = 0, jPoint = 0;
-  unsigned short iDim = 0, jDim = 0, iNeigh = 0, nNeigh = 0;
-
-  su2double constDES = config->GetConst_DES();
-
-  su2double density = 0.0, laminarViscosity = 0.0, kinematicViscosity = 0.0,
-      eddyViscosity = 0.0, kinematicViscosityTurb = 0.0, wallDistance = 0.0, lengthScale = 0.0;
-
-  su2double maxDelta = 0.0, deltaAux = 0.0, distDES = 0.0, uijuij = 0.0, k2 = 0.0, r_d = 0.0, f_d = 0.0;
-  su2double deltaDDES = 0.0, omega = 0.0, ln_max = 0.0, ln[3] = {0.0}, aux_ln = 0.0, f_kh = 0.0;
-
-  su2double nu_hat, fw_star = 0.424, cv1_3 = pow(7.1, 3.0); k2 = pow(0.41, 2.0);
-  su2double cb1   = 0.1355, ct3 = 1.2, ct4   = 0.5;
-  su2double sigma = 2./3., cb2 = 0.622, f_max=1.0, f_min=0.1, a1=0.15, a2=0.3;
-  su2double cw1 = 0.0, Ji = 0.0, Ji_2 = 0.0, Ji_3 = 0.0, fv1 = 0.0, fv2 = 0.0, ft2 = 0.0, psi_2 = 0.0;
-  const su2double *coord_i = nullptr, *coord_j = nullptr, *const *primVarGrad = nullptr, *vorticity = nullptr;
-  su2double delta[3] = {0.0}, ratioOmega[3] = {0.0}, vortexTiltingMeasure = 0.0;
-
-  SU2_OMP_FOR_DYN(omp_chunk_size)
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++){
-
-    coord_i                 = geometry->node[iPoint]->GetCoord();
-    nNeigh                  = geometry->node[iPoint]->GetnPoint();
-    wallDistance            = geometry->node[iPoint]->GetWall_Distance();
-    primVarGrad             = solver[FLOW_SOL]->GetNodes()->GetGradient_Primitive(iPoint);
-    vorticity               = solver[FLOW_SOL]->GetNodes()->GetVorticity(iPoint);
-    density                 = solver[FLOW_SOL]->GetNodes()->GetDensity(iPoint);
-    laminarViscosity        = solver[FLOW_SOL]->GetNodes()->GetLaminarViscosity(iPoint);
-    eddyViscosity           = solver[TURB_SOL]->GetNodes()->GetmuT(iPoint);
-    kinematicViscosity      = laminarViscosity/density;
-    kinematicViscosityTurb  = eddyViscosity/density;
-
-    uijuij = 0.0;
-    for(iDim = 0; iDim < nDim; iDim++){
-      for(jDim = 0; jDim < nDim; jDim++){
+  const auto kindHybridRANSLES = config->GetKind_HybridRANSLES();
+
+  const su2double constDES = config->GetConst_DES();
+  const su2double k2 = pow(0.41, 2.0);
+  const su2double f_max=1.0, f_min=0.1, a1=0.15, a2=0.3;
+
+  SU2_OMP_MASTER
+  SetDES_GeometricScales(geometry, config);
+  SU2_OMP_BARRIER
+
+  CVariable* flowNodes = solver[FLOW_SOL]->GetNodes();
+
+  /*--- Shielding function of DDES, also used by ZDES and EDDES. ---*/
+
+  auto shieldingFunction = [&](unsigned long iPoint) {
+
+    const su2double* const* primVarGrad = flowNodes->GetGradient_Primitive(iPoint);
+    const su2double density = flowNodes->GetDensity(iPoint);
+    const su2double kinematicViscosity = flowNodes->GetLaminarViscosity(iPoint)/density;
+    const su2double kinematicViscosityTurb = nodes->GetmuT(iPoint)/density;
+    const su2double wallDistance = DES_WallDist[iPoint];
+
+    su2double uijuij = 0.0;
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      for (unsigned short jDim = 0; jDim < nDim; jDim++)
         uijuij += primVarGrad[1+iDim][jDim]*primVarGrad[1+iDim][jDim];
-      }
-    }
-    uijuij = sqrt(fabs(uijuij));
-    uijuij = max(uijuij,1e-10);
-
-    /*--- Low Reynolds number correction term ---*/
-
-    nu_hat = nodes->GetSolution(iPoint,0);
-    Ji   = nu_hat/kinematicViscosity;
-    Ji_2 = Ji * Ji;
-    Ji_3 = Ji*Ji*Ji;
-    fv1  = Ji_3/(Ji_3+cv1_3);
-    fv2 = 1.0 - Ji/(1.0+Ji*fv1);
-    ft2 = ct3*exp(-ct4*Ji_2);
-    cw1 = cb1/k2+(1.0+cb2)/sigma;
-
-    psi_2 = (1.0 - (cb1/(cw1*k2*fw_star))*(ft2 + (1.0 - ft2)*fv2))/(fv1 * max(1.0e-10,1.0-ft2));
-    psi_2 = min(100.0,psi_2);
-
-    switch(kindHybridRANSLES){
-      case SA_DES:
-        /*--- Original Detached Eddy Simulation (DES97)
-        Spalart
-        1997
-        ---*/
-
-        maxDelta = geometry->node[iPoint]->GetMaxLength();
-        distDES = constDES * maxDelta;
-        lengthScale = min(distDES,wallDistance);
+    uijuij = max(sqrt(fabs(uijuij)), 1e-10);
 
-        break;
+    const su2double r_d = (kinematicViscosityTurb+kinematicViscosity)/(uijuij*k2*pow(wallDistance, 2.0));
+    return 1.0-tanh(pow(8.0*r_d,3.0));
+  };
 
-      case SA_DDES:
-        /*--- A New Version of Detached-eddy Simulation, Resistant to Ambiguous Grid Densities.
-         Spalart et al.
-         Theoretical and Computational Fluid Dynamics - 2006
-         ---*/
+  /*--- Unit vorticity vector (for ZDES and EDDES). ---*/
 
-        maxDelta = geometry->node[iPoint]->GetMaxLength();
+  auto unitVorticity = [&](unsigned long iPoint, su2double* ratioOmega) {
+    const su2double* vorticity = flowNodes->GetVorticity(iPoint);
+    const su2double omega = sqrt(vorticity[0]*vorticity[0] +
+                                 vorticity[1]*vorticity[1] +
+                                 vorticity[2]*vorticity[2]);
+    for (unsigned short iDim = 0; iDim < 3; iDim++)
+      ratioOmega[iDim] = vorticity[iDim]/omega;
+  };
 
-        r_d = (kinematicViscosityTurb+kinematicViscosity)/(uijuij*k2*pow(wallDistance, 2.0));
-        f_d = 1.0-tanh(pow(8.0*r_d,3.0));
+  /*--- The type of model is selected outside of the point loops. ---*/
 
-        distDES = constDES * maxDelta;
-        lengthScale = wallDistance-f_d*max(0.0,(wallDistance-distDES));
+  switch(kindHybridRANSLES){
+    case SA_DES:
+      /*--- Original Detached Eddy Simulation (DES97)
+      Spalart
+      1997
+      ---*/
 
-        break;
-      case SA_ZDES:
-        /*--- Recent improvements in the Zonal Detached Eddy Simulation (ZDES) formulation.
-         Deck
-         Theoretical and Computational Fluid Dynamics - 2012
-         ---*/
-
-        for (iNeigh = 0; iNeigh < nNeigh; iNeigh++){
-            jPoint = geometry->node[iPoint]->GetPoint(iNeigh);
-            coord_j = geometry->node[jPoint]->GetCoord();
-            for ( iDim = 0; iDim < nDim; iDim++){
-              deltaAux = abs(coord_j[iDim] - coord_i[iDim]);
-              delta[iDim] = max(delta[iDim], deltaAux);
-            }
-            deltaDDES = geometry->node[iPoint]->GetMaxLength();
-        }
+      SU2_OMP_FOR_STAT(omp_chunk_size)
+      for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+        const su2double distDES = constDES * DES_MaxLength[iPoint];
+        nodes->SetDES_LengthScale(iPoint, min(distDES, DES_WallDist[iPoint]));
+      }
+      break;
 
-        omega = sqrt(vorticity[0]*vorticity[0] +
-                     vorticity[1]*vorticity[1] +
-                     vorticity[2]*vorticity[2]);
+    case SA_DDES:
+      /*--- A New Version of Detached-eddy Simulation, Resistant to Ambiguous Grid Densities.
+       Spalart et al.
+       Theoretical and Computational Fluid Dynamics - 2006
+       ---*/
 
-        for (iDim = 0; iDim < 3; iDim++){
-          ratioOmega[iDim] = vorticity[iDim]/omega;
-        }
+      SU2_OMP_FOR_STAT(omp_chunk_size)
+      for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+        const su2double f_d = shieldingFunction(iPoint);
+        const su2double wallDistance = DES_WallDist[iPoint];
+        const su2double distDES = constDES * DES_MaxLength[iPoint];
+        nodes->SetDES_LengthScale(iPoint, wallDistance-f_d*max(0.0,(wallDistance-distDES)));
+      }
+      break;
+
+    case SA_ZDES:
+      /*--- Recent improvements in the Zonal Detached Eddy Simulation (ZDES) formulation.
+       Deck
+       Theoretical and Computational Fluid Dynamics - 2012
+       ---*/
+
+      SU2_OMP_FOR_STAT(omp_chunk_size)
+      for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+
+        su2double ratioOmega[3] = {0.0};
+        unitVorticity(iPoint, ratioOmega);
 
-        maxDelta = sqrt(pow(ratioOmega[0],2.0)*delta[1]*delta[2] +
-                        pow(ratioOmega[1],2.0)*delta[0]*delta[2] +
-                        pow(ratioOmega[2],2.0)*delta[0]*delta[1]);
+        const su2double* delta = &DES_Delta[3*iPoint];
 
-        r_d = (kinematicViscosityTurb+kinematicViscosity)/(uijuij*k2*pow(wallDistance, 2.0));
-        f_d = 1.0-tanh(pow(8.0*r_d,3.0));
+        su2double maxDelta = sqrt(pow(ratioOmega[0],2.0)*delta[1]*delta[2] +
+                                  pow(ratioOmega[1],2.0)*delta[0]*delta[2] +
+                                  pow(ratioOmega[2],2.0)*delta[0]*delta[1]);
+
+        const su2double f_d = shieldingFunction(iPoint);
 
         if (f_d < 0.99){
-          maxDelta = deltaDDES;
+          maxDelta = DES_MaxLength[iPoint];
         }
 
-        distDES = constDES * maxDelta;
-        lengthScale = wallDistance-f_d*max(0.0,(wallDistance-distDES));
-
-        break;
+        const su2double wallDistance = DES_WallDist[iPoint];
+        const su2double distDES = constDES * maxDelta;
+        nodes->SetDES_LengthScale(iPoint, wallDistance-f_d*max(0.0,(wallDistance-distDES)));
+      }
+      break;
 
-      case SA_EDDES:
+    case SA_EDDES:
 
-        /*--- An Enhanced Version of DES with Rapid Transition from RANS to LES in Separated Flows.
-         Shur et al.
-         Flow Turbulence Combust - 2015
-         ---*/
+      /*--- An Enhanced Version of DES with Rapid Transition from RANS to LES in Separated Flows.
+       Shur et al.
+       Flow Turbulence Combust - 2015
+       ---*/
 
-        vortexTiltingMeasure = nodes->GetVortex_Tilting(iPoint);
+      SU2_OMP_FOR_DYN(omp_chunk_size)
+      for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
-        omega = sqrt(vorticity[0]*vorticity[0] +
-                     vorticity[1]*vorticity[1] +
-                     vorticity[2]*vorticity[2]);
+        su2double ratioOmega[3] = {0.0};
+        unitVorticity(iPoint, ratioOmega);
 
-        for (iDim = 0; iDim < 3; iDim++){
-          ratioOmega[iDim] = vorticity[iDim]/omega;
-        }
+        su2double vortexTiltingMeasure = nodes->GetVortex_Tilting(iPoint);
+        su2double ln_max = 0.0;
 
-        ln_max = 0.0;
-        deltaDDES = 0.0;
-        for (iNeigh = 0;iNeigh < nNeigh; iNeigh++){
-          jPoint = geometry->node[iPoint]->GetPoint(iNeigh);
-          coord_j = geometry->node[jPoint]->GetCoord();
-          for (iDim = 0; iDim < nDim; iDim++){
-            delta[iDim] = fabs(coord_j[iDim] - coord_i[iDim]);
-          }
-          deltaDDES = geometry->node[iPoint]->GetMaxLength();
-          ln[0] = delta[1]*ratioOmega[2] - delta[2]*ratioOmega[1];
-          ln[1] = delta[2]*ratioOmega[0] - delta[0]*ratioOmega[2];
-          ln[2] = delta[0]*ratioOmega[1] - delta[1]*ratioOmega[0];
-          aux_ln = sqrt(ln[0]*ln[0] + ln[1]*ln[1] + ln[2]*ln[2]);
-          ln_max = max(ln_max,aux_ln);
-          vortexTiltingMeasure += nodes->GetVortex_Tilting(jPoint);
+        for (auto k = DES_NeighPtr[iPoint]; k < DES_NeighPtr[iPoint+1]; k++) {
+          const su2double* delta = &DES_NeighDelta[3*k];
+          const su2double ln[3] = {delta[1]*ratioOmega[2] - delta[2]*ratioOmega[1],
+                                   delta[2]*ratioOmega[0] - delta[0]*ratioOmega[2],
+                                   delta[0]*ratioOmega[1] - delta[1]*ratioOmega[0]};
+          ln_max = max(ln_max, sqrt(ln[0]*ln[0] + ln[1]*ln[1] + ln[2]*ln[2]));
+          vortexTiltingMeasure += nodes->GetVortex_Tilting(DES_Neighbor[k]);
         }
 
+        const auto nNeigh = DES_NeighPtr[iPoint+1] - DES_NeighPtr[iPoint];
         vortexTiltingMeasure = (vortexTiltingMeasure/fabs(nNeigh + 1.0));
 
-        f_kh = max(f_min, min(f_max, f_min + ((f_max - f_min)/(a2 - a1)) * (vortexTiltingMeasure - a1)));
+        const su2double f_kh = max(f_min, min(f_max, f_min + ((f_max - f_min)/(a2 - a1)) * (vortexTiltingMeasure - a1)));
 
-        r_d = (kinematicViscosityTurb+kinematicViscosity)/(uijuij*k2*pow(wallDistance, 2.0));
-        f_d = 1.0-tanh(pow(8.0*r_d,3.0));
+        const su2double f_d = shieldingFunction(iPoint);
 
-        maxDelta = (ln_max/sqrt(3.0)) * f_kh;
+        su2double maxDelta = (ln_max/sqrt(3.0)) * f_kh;
         if (f_d < 0.999){
-          maxDelta = deltaDDES;
+          maxDelta = DES_MaxLength[iPoint];
         }
 
-        distDES = constDES * maxDelta;
-        lengthScale=wallDistance-f_d*max(0.0,(wallDistance-distDES));
-
-        break;
-
-    }
-
-    nodes->SetDES_LengthScale(iPoint, lengthScale);
+        const su2double wallDistance = DES_WallDist[iPoint];
+        const su2double distDES = constDES * maxDelta;
+        nodes->SetDES_LengthScale(iPoint, wallDistance-f_d*max(0.0,(wallDistance-distDES)));
+      }
+      break;
 
   }
 }
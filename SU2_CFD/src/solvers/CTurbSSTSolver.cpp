@@ -26,6 +26,7 @@
  */
 
 #include "../../include/solvers/CTurbSSTSolver.hpp"
+#include "../../include/numerics/turbulent/batched_turb_sources.hpp"
 #include "../../include/variables/CTurbSSTVariable.hpp"
 #include "../../../Common/include/omp_structure.hpp"
 
@@ -61,9 +62,11 @@ CTurbSSTSolver::CTurbSSTSolver(CGeometry *geometry, CConfig *config, unsigned sh
 
   nDim = geometry->GetnDim();
 
-  /*--- Single grid simulation ---*/
+  /*--- Single grid simulation, or multigrid of the turbulence equations ---*/
 
-  if (iMesh == MESH_0) {
+  MGLevel = iMesh;
+
+  if (iMesh == MESH_0 || config->GetMG_Turbulence()) {
 
     /*--- Define some auxiliary vector related with the residual ---*/
 
@@ -236,6 +239,9 @@ CTurbSSTSolver::CTurbSSTSolver(CGeometry *geometry, CConfig *config, unsigned sh
   Max_CFL_Local = CFL;
   Avg_CFL_Local = CFL;
 
+  /*--- Vectorized source terms, if supported by the options. ---*/
+  SourceBatch = CTurbSourceBatchNumerics::CreateNumerics(nDim, config, constants, kine_Inf, omega_Inf);
+
   /*--- Add the solver name (max 8 characters) ---*/
   SolverName = "K-W SST";
 
@@ -356,62 +362,69 @@ void CTurbSSTSolver::Source_Residual(CGeometry *geometry, CSolver **solver_conta
 
   CVariable* flowNodes = solver_container[FLOW_SOL]->GetNodes();
 
-  /*--- Pick one numerics object per thread. ---*/
-  CNumerics* numerics = numerics_container[SOURCE_FIRST_TERM + omp_get_thread_num()*MAX_TERMS];
+  /*--- Vectorized source terms for batches of points, if supported by the options. ---*/
 
-  /*--- Loop over all points. ---*/
+  if (SourceBatch != nullptr) {
+    Source_Residual_Batched(geometry, solver_container, config);
+  }
+  else {
+    /*--- Pick one numerics object per thread. ---*/
+    CNumerics* numerics = numerics_container[SOURCE_FIRST_TERM + omp_get_thread_num()*MAX_TERMS];
 
-  SU2_OMP_FOR_DYN(omp_chunk_size)
-  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    /*--- Loop over all points. ---*/
 
-    /*--- Conservative variables w/o reconstruction ---*/
+    SU2_OMP_FOR_DYN(omp_chunk_size)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
-    numerics->SetPrimitive(flowNodes->GetPrimitive(iPoint), nullptr);
+      /*--- Conservative variables w/o reconstruction ---*/
 
-    /*--- Gradient of the primitive and conservative variables ---*/
+      numerics->SetPrimitive(flowNodes->GetPrimitive(iPoint), nullptr);
 
-    numerics->SetPrimVarGradient(flowNodes->GetGradient_Primitive(iPoint), nullptr);
+      /*--- Gradient of the primitive and conservative variables ---*/
 
-    /*--- Turbulent variables w/o reconstruction, and its gradient ---*/
+      numerics->SetPrimVarGradient(flowNodes->GetGradient_Primitive(iPoint), nullptr);
 
-    numerics->SetTurbVar(nodes->GetSolution(iPoint), nullptr);
-    numerics->SetTurbVarGradient(nodes->GetGradient(iPoint), nullptr);
+      /*--- Turbulent variables w/o reconstruction, and its gradient ---*/
 
-    /*--- Set volume ---*/
+      numerics->SetTurbVar(nodes->GetSolution(iPoint), nullptr);
+      numerics->SetTurbVarGradient(nodes->GetGradient(iPoint), nullptr);
 
-    numerics->SetVolume(geometry->node[iPoint]->GetVolume());
+      /*--- Set volume ---*/
 
-    /*--- Set distance to the surface ---*/
+      numerics->SetVolume(geometry->node[iPoint]->GetVolume());
 
-    numerics->SetDistance(geometry->node[iPoint]->GetWall_Distance(), 0.0);
+      /*--- Set distance to the surface ---*/
 
-    /*--- Menter's first blending function ---*/
+      numerics->SetDistance(geometry->node[iPoint]->GetWall_Distance(), 0.0);
 
-    numerics->SetF1blending(nodes->GetF1blending(iPoint),0.0);
+      /*--- Menter's first blending function ---*/
+
+      numerics->SetF1blending(nodes->GetF1blending(iPoint),0.0);
 
-    /*--- Menter's second blending function ---*/
+      /*--- Menter's second blending function ---*/
 
-    numerics->SetF2blending(nodes->GetF2blending(iPoint),0.0);
+      numerics->SetF2blending(nodes->GetF2blending(iPoint),0.0);
 
-    /*--- Set vorticity and strain rate magnitude ---*/
+      /*--- Set vorticity and strain rate magnitude ---*/
 
-    numerics->SetVorticity(flowNodes->GetVorticity(iPoint), nullptr);
+      numerics->SetVorticity(flowNodes->GetVorticity(iPoint), nullptr);
 
-    numerics->SetStrainMag(flowNodes->GetStrainMag(iPoint), 0.0);
+      numerics->SetStrainMag(flowNodes->GetStrainMag(iPoint), 0.0);
 
-    /*--- Cross diffusion ---*/
+      /*--- Cross diffusion ---*/
 
-    numerics->SetCrossDiff(nodes->GetCrossDiff(iPoint),0.0);
+      numerics->SetCrossDiff(nodes->GetCrossDiff(iPoint),0.0);
 
-    /*--- Compute the source term ---*/
+      /*--- Compute the source term ---*/
 
-    auto residual = numerics->ComputeResidual(config);
+      auto residual = numerics->ComputeResidualPreacc(config);
 
-    /*--- Subtract residual and the Jacobian ---*/
+      /*--- Subtract residual and the Jacobian ---*/
 
-    LinSysRes.SubtractBlock(iPoint, residual);
-    Jacobian.SubtractBlock2Diag(iPoint, residual.jacobian_i);
+      LinSysRes.SubtractBlock(iPoint, residual);
+      Jacobian.SubtractBlock2Diag(iPoint, residual.jacobian_i);
 
+    }
   }
 
 }
@@ -567,7 +580,7 @@ void CTurbSSTSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_containe
 
       /*--- Compute residuals and Jacobians ---*/
 
-      auto residual = conv_numerics->ComputeResidual(config);
+      auto residual = conv_numerics->ComputeResidualPreacc(config);
 
       /*--- Add residuals and Jacobians ---*/
 
@@ -642,7 +655,7 @@ void CTurbSSTSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container, C
 
       /*--- Compute the residual using an upwind scheme ---*/
 
-      auto residual = conv_numerics->ComputeResidual(config);
+      auto residual = conv_numerics->ComputeResidualPreacc(config);
       LinSysRes.AddBlock(iPoint, residual);
 
       /*--- Jacobian contribution for implicit integration ---*/
@@ -741,7 +754,7 @@ void CTurbSSTSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
 
       /*--- Compute the residual using an upwind scheme ---*/
 
-      auto residual = conv_numerics->ComputeResidual(config);
+      auto residual = conv_numerics->ComputeResidualPreacc(config);
       LinSysRes.AddBlock(iPoint, residual);
 
       /*--- Jacobian contribution for implicit integration ---*/
@@ -850,7 +863,7 @@ void CTurbSSTSolver::BC_Inlet_MixingPlane(CGeometry *geometry, CSolver **solver_
             geometry->node[iPoint]->GetGridVel());
 
       /*--- Compute the residual using an upwind scheme ---*/
-      auto conv_residual = conv_numerics->ComputeResidual(config);
+      auto conv_residual = conv_numerics->ComputeResidualPreacc(config);
 
       /*--- Jacobian contribution for implicit integration ---*/
       LinSysRes.AddBlock(iPoint, conv_residual);
@@ -871,7 +884,7 @@ void CTurbSSTSolver::BC_Inlet_MixingPlane(CGeometry *geometry, CSolver **solver_
       visc_numerics->SetF1blending(nodes->GetF1blending(iPoint), nodes->GetF1blending(iPoint));
 
       /*--- Compute residual, and Jacobians ---*/
-      auto visc_residual = visc_numerics->ComputeResidual(config);
+      auto visc_residual = visc_numerics->ComputeResidualPreacc(config);
 
       /*--- Subtract residual, and update Jacobians ---*/
       LinSysRes.SubtractBlock(iPoint, visc_residual);
@@ -975,7 +988,7 @@ void CTurbSSTSolver::BC_Inlet_Turbo(CGeometry *geometry, CSolver **solver_contai
                                   geometry->node[iPoint]->GetGridVel());
 
       /*--- Compute the residual using an upwind scheme ---*/
-      auto conv_residual = conv_numerics->ComputeResidual(config);
+      auto conv_residual = conv_numerics->ComputeResidualPreacc(config);
 
       /*--- Jacobian contribution for implicit integration ---*/
       LinSysRes.AddBlock(iPoint, conv_residual);
@@ -996,7 +1009,7 @@ void CTurbSSTSolver::BC_Inlet_Turbo(CGeometry *geometry, CSolver **solver_contai
       visc_numerics->SetF1blending(nodes->GetF1blending(iPoint), nodes->GetF1blending(iPoint));
 
       /*--- Compute residual, and Jacobians ---*/
-      auto visc_residual = visc_numerics->ComputeResidual(config);
+      auto visc_residual = visc_numerics->ComputeResidualPreacc(config);
 
       /*--- Subtract residual, and update Jacobians ---*/
       LinSysRes.SubtractBlock(iPoint, visc_residual);
@@ -1082,7 +1095,7 @@ void CTurbSSTSolver::BC_Fluid_Interface(CGeometry *geometry, CSolver **solver_co
             if (dynamic_grid)
               conv_numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(), geometry->node[iPoint]->GetGridVel());
 
-            auto residual = conv_numerics->ComputeResidual(config);
+            auto residual = conv_numerics->ComputeResidualPreacc(config);
 
             /*--- Accumulate the residuals to compute the average ---*/
 
@@ -1116,7 +1129,7 @@ void CTurbSSTSolver::BC_Fluid_Interface(CGeometry *geometry, CSolver **solver_co
 
           /*--- Compute and update residual ---*/
 
-          auto residual = visc_numerics->ComputeResidual(config);
+          auto residual = visc_numerics->ComputeResidualPreacc(config);
 
           LinSysRes.SubtractBlock(iPoint, residual);
 
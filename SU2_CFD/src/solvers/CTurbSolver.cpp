@@ -27,6 +27,7 @@
 
 
 #include "../../include/solvers/CTurbSolver.hpp"
+#include "../../include/numerics/turbulent/batched_turb_sources.hpp"
 #include "../../../Common/include/omp_structure.hpp"
 
 
@@ -88,6 +89,8 @@ CTurbSolver::~CTurbSolver(void) {
   }
 
   delete nodes;
+
+  delete SourceBatch;
 }
 
 void CTurbSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_container,
@@ -125,10 +128,10 @@ void CTurbSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_containe
 
     /*--- Points in edge and normal vectors ---*/
 
-    auto iPoint = geometry->edge[iEdge]->GetNode(0);
-    auto jPoint = geometry->edge[iEdge]->GetNode(1);
+    auto iPoint = geometry->GetEdgeNode(iEdge,0);
+    auto jPoint = geometry->GetEdgeNode(iEdge,1);
 
-    numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
+    numerics->SetNormal(geometry->GetEdgeNormal(iEdge));
 
     /*--- Primitive variables w/o reconstruction ---*/
 
@@ -151,13 +154,8 @@ void CTurbSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_containe
     if (muscl || musclFlow) {
       const su2double *Limiter_i = nullptr, *Limiter_j = nullptr;
 
-      const auto Coord_i = geometry->node[iPoint]->GetCoord();
-      const auto Coord_j = geometry->node[jPoint]->GetCoord();
-
       su2double Vector_ij[MAXNDIM] = {0.0};
-      for (iDim = 0; iDim < nDim; iDim++) {
-        Vector_ij[iDim] = 0.5*(Coord_j[iDim] - Coord_i[iDim]);
-      }
+      geometry->GetEdgeHalfVector(iEdge, Vector_ij);
 
       if (musclFlow) {
         /*--- Reconstruct mean flow primitive variables. ---*/
@@ -218,7 +216,7 @@ void CTurbSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_containe
 
     /*--- Update convective residual value ---*/
 
-    auto residual = numerics->ComputeResidual(config);
+    auto residual = numerics->ComputeResidualPreacc(config);
 
     if (ReducerStrategy) {
       EdgeFluxes.SetBlock(iEdge, residual);
@@ -250,14 +248,14 @@ void CTurbSolver::Viscous_Residual(unsigned long iEdge, CGeometry *geometry, CSo
 
   /*--- Points in edge ---*/
 
-  auto iPoint = geometry->edge[iEdge]->GetNode(0);
-  auto jPoint = geometry->edge[iEdge]->GetNode(1);
+  auto iPoint = geometry->GetEdgeNode(iEdge,0);
+  auto jPoint = geometry->GetEdgeNode(iEdge,1);
 
   /*--- Points coordinates, and normal vector ---*/
 
-  numerics->SetCoord(geometry->node[iPoint]->GetCoord(),
-                     geometry->node[jPoint]->GetCoord());
-  numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
+  numerics->SetCoord(geometry->GetPointCoord(iPoint),
+                     geometry->GetPointCoord(jPoint));
+  numerics->SetNormal(geometry->GetEdgeNormal(iEdge));
 
   /*--- Conservative variables w/o reconstruction ---*/
 
@@ -278,7 +276,7 @@ void CTurbSolver::Viscous_Residual(unsigned long iEdge, CGeometry *geometry, CSo
 
   /*--- Compute residual, and Jacobians ---*/
 
-  auto residual = numerics->ComputeResidual(config);
+  auto residual = numerics->ComputeResidualPreacc(config);
 
   if (ReducerStrategy) {
     EdgeFluxes.SubtractBlock(iEdge, residual);
@@ -302,7 +300,7 @@ void CTurbSolver::SumEdgeFluxes(CGeometry* geometry) {
 
       auto iEdge = geometry->node[iPoint]->GetEdge(iNeigh);
 
-      if (iPoint == geometry->edge[iEdge]->GetNode(0))
+      if (iPoint == geometry->GetEdgeNode(iEdge,0))
         LinSysRes.AddBlock(iPoint, EdgeFluxes.GetBlock(iEdge));
       else
         LinSysRes.SubtractBlock(iPoint, EdgeFluxes.GetBlock(iEdge));
@@ -311,6 +309,97 @@ void CTurbSolver::SumEdgeFluxes(CGeometry* geometry) {
 
 }
 
+void CTurbSolver::Source_Residual_Batched(CGeometry *geometry, CSolver **solver_container, const CConfig *config) {
+
+  constexpr auto BATCH = CTurbSourceBatch::SIZE;
+
+  const bool incompressible = (config->GetKind_Regime() == INCOMPRESSIBLE);
+  const bool sst = (nVar == 2);
+  const bool hybridRANSLES = !sst && (config->GetKind_HybridRANSLES() != NO_HYBRIDRANSLES);
+  const bool velGrad = SourceBatch->NeedsVelocityGradient();
+
+  /*--- Location of the viscosities in the primitive variables. ---*/
+  const auto iLamVisc = nDim + (incompressible? 4 : 5);
+
+  CVariable* flowNodes = solver_container[FLOW_SOL]->GetNodes();
+
+  /*--- Batch and Jacobian of one point of this thread. ---*/
+  CTurbSourceBatch batch;
+  su2double JacobianRows[MAXNVAR*MAXNVAR] = {0.0};
+  su2double *Jacobian_i[MAXNVAR];
+  for (unsigned short iVar = 0; iVar < nVar; iVar++)
+    Jacobian_i[iVar] = &JacobianRows[iVar*nVar];
+
+  const unsigned long nBatch = roundUpDiv(nPointDomain, BATCH);
+
+  SU2_OMP_FOR_DYN(roundUpDiv(omp_chunk_size, BATCH))
+  for (auto iBatch = 0ul; iBatch < nBatch; ++iBatch) {
+
+    const unsigned long begin = iBatch*BATCH;
+    batch.nPoint = min<unsigned long>(BATCH, nPointDomain-begin);
+
+    /*--- Gather the inputs, the lanes past the last point repeat it. ---*/
+
+    for (auto k = 0ul; k < BATCH; ++k) {
+
+      const auto iPoint = begin + min(k, batch.nPoint-1);
+
+      const su2double* V = flowNodes->GetPrimitive(iPoint);
+      batch.Density[k] = V[nDim+2];
+      batch.Pressure[k] = V[nDim+1];
+      batch.LamVisc[k] = V[iLamVisc];
+      batch.EddyVisc[k] = V[iLamVisc+1];
+
+      const su2double* Vorticity = flowNodes->GetVorticity(iPoint);
+      for (unsigned short iDim = 0; iDim < 3; iDim++)
+        batch.Vorticity[iDim][k] = Vorticity[iDim];
+      batch.StrainMag[k] = flowNodes->GetStrainMag(iPoint);
+
+      if (velGrad) {
+        su2double** PrimGrad = flowNodes->GetGradient_Primitive(iPoint);
+        for (unsigned short iDim = 0; iDim < nDim; iDim++)
+          for (unsigned short jDim = 0; jDim < nDim; jDim++)
+            batch.VelGrad[iDim][jDim][k] = PrimGrad[iDim+1][jDim];
+      }
+
+      const su2double* TurbVar = nodes->GetSolution(iPoint);
+      su2double** TurbGrad = nodes->GetGradient(iPoint);
+      for (unsigned short iVar = 0; iVar < nVar; iVar++)
+        batch.TurbVar[iVar][k] = TurbVar[iVar];
+      for (unsigned short iDim = 0; iDim < nDim; iDim++)
+        batch.TurbVarGrad[iDim][k] = TurbGrad[0][iDim];
+
+      batch.Volume[k] = geometry->node[iPoint]->GetVolume();
+      batch.Dist[k] = hybridRANSLES? nodes->GetDES_LengthScale(iPoint) : geometry->node[iPoint]->GetWall_Distance();
+
+      if (sst) {
+        batch.F1[k] = nodes->GetF1blending(iPoint);
+        batch.F2[k] = nodes->GetF2blending(iPoint);
+        batch.CDkw[k] = nodes->GetCrossDiff(iPoint);
+      }
+    }
+
+    /*--- Compute the source terms of the batch. ---*/
+
+    SourceBatch->ComputeResidual(batch);
+
+    /*--- Subtract the residuals and the Jacobians, the points of a batch are distinct. ---*/
+
+    for (auto k = 0ul; k < batch.nPoint; ++k) {
+
+      const auto iPoint = begin + k;
+
+      for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+        LinSysRes(iPoint,iVar) -= batch.Residual[iVar][k];
+        for (unsigned short jVar = 0; jVar < nVar; jVar++)
+          Jacobian_i[iVar][jVar] = batch.Jacobian[iVar][jVar][k];
+      }
+      Jacobian.SubtractBlock2Diag(iPoint, Jacobian_i);
+    }
+  }
+
+}
+
 void CTurbSolver::BC_Sym_Plane(CGeometry      *geometry,
                                CSolver        **solver_container,
                                CNumerics      *conv_numerics,
@@ -406,8 +495,22 @@ void CTurbSolver::BC_Periodic(CGeometry *geometry, CSolver **solver_container,
 
 void CTurbSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
 
-  const bool adjoint = config->GetContinuous_Adjoint() || (config->GetDiscrete_Adjoint() && config->GetFrozen_Visc_Disc());
-  const bool compressible = (config->GetKind_Regime() == COMPRESSIBLE);
+  PrepareImplicitIteration(geometry, solver_container, config);
+
+  /*--- Solve or smooth the linear system ---*/
+
+  auto iter = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
+  SU2_OMP_MASTER
+  {
+    SetIterLinSolver(iter);
+    SetResLinSolver(System.GetResidual());
+  }
+  SU2_OMP_BARRIER
+
+  CompleteImplicitIteration(geometry, solver_container, config);
+}
+
+void CTurbSolver::PrepareImplicitIteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
 
   CVariable* flowNodes = solver_container[FLOW_SOL]->GetNodes();
 
@@ -425,11 +528,18 @@ void CTurbSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_
   const su2double* coordMax[MAXNVAR] = {nullptr};
   unsigned long idxMax[MAXNVAR] = {0};
 
+  /*--- The truncation error is only allocated for the multigrid of the turbulence equations. ---*/
+
+  const bool truncError = nodes->GetResTruncErrorAllocated();
+
   /*--- Build implicit system ---*/
 
   SU2_OMP(for schedule(static,omp_chunk_size) nowait)
   for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
+    const su2double zeroTruncError[MAXNVAR] = {0.0};
+    const su2double* local_Res_TruncError = truncError? nodes->GetResTruncError(iPoint) : zeroTruncError;
+
     /*--- Read the volume ---*/
 
     su2double Vol = (geometry->node[iPoint]->GetVolume() + geometry->node[iPoint]->GetPeriodicVolume());
@@ -443,7 +553,7 @@ void CTurbSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_
 
     for (unsigned short iVar = 0; iVar < nVar; iVar++) {
       unsigned long total_index = iPoint*nVar + iVar;
-      LinSysRes[total_index] = -LinSysRes[total_index];
+      LinSysRes[total_index] = - (LinSysRes[total_index] + local_Res_TruncError[iVar]);
       LinSysSol[total_index] = 0.0;
 
       su2double Res = fabs(LinSysRes[total_index]);
@@ -473,17 +583,14 @@ void CTurbSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_
     for (unsigned long iPoint = nPointDomain; iPoint < nPoint; iPoint++)
       LinSysSol.SetBlock_Zero(iPoint);
   }
+}
 
-  /*--- Solve or smooth the linear system ---*/
+void CTurbSolver::CompleteImplicitIteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
 
-  auto iter = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
-  SU2_OMP_MASTER
-  {
-    SetIterLinSolver(iter);
-    SetResLinSolver(System.GetResidual());
-  }
-  SU2_OMP_BARRIER
+  const bool adjoint = config->GetContinuous_Adjoint() || (config->GetDiscrete_Adjoint() && config->GetFrozen_Visc_Disc());
+  const bool compressible = (config->GetKind_Regime() == COMPRESSIBLE);
 
+  CVariable* flowNodes = solver_container[FLOW_SOL]->GetNodes();
 
   ComputeUnderRelaxationFactor(solver_container, config);
 
@@ -914,27 +1021,23 @@ void CTurbSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig *
   /*--- Load data from the restart into correct containers. ---*/
 
   counter = 0;
-  for (iPoint_Global = 0; iPoint_Global < geometry[MESH_0]->GetGlobal_nPointDomain(); iPoint_Global++ ) {
-
+  for (const auto& globalToLocal : geometry[MESH_0]->GetGlobal_to_Local_Map()) {
 
-    /*--- Retrieve local index. If this node from the restart file lives
-     on the current processor, we will load and instantiate the vars. ---*/
+    /*--- The points of this rank, in the order of their data in the restart file. ---*/
 
-    iPoint_Local = geometry[MESH_0]->GetGlobal_to_Local_Point(iPoint_Global);
+    iPoint_Global = globalToLocal.first;
+    iPoint_Local = globalToLocal.second;
 
-    if (iPoint_Local > -1) {
+    /*--- We need to store this point's data, so jump to the correct
+     offset in the buffer of data from the restart file and load it. ---*/
 
-      /*--- We need to store this point's data, so jump to the correct
-       offset in the buffer of data from the restart file and load it. ---*/
+    index = counter*Restart_Vars[1] + skipVars;
+    for (iVar = 0; iVar < nVar; iVar++) Solution[iVar] = Restart_Data[index+iVar];
+    nodes->SetSolution(iPoint_Local,Solution);
+    iPoint_Global_Local++;
 
-      index = counter*Restart_Vars[1] + skipVars;
-      for (iVar = 0; iVar < nVar; iVar++) Solution[iVar] = Restart_Data[index+iVar];
-      nodes->SetSolution(iPoint_Local,Solution);
-      iPoint_Global_Local++;
-
-      /*--- Increment the overall counter for how many points have been loaded. ---*/
-      counter++;
-    }
+    /*--- Increment the overall counter for how many points have been loaded. ---*/
+    counter++;
 
   }
 
@@ -39,6 +39,20 @@ CEulerVariable::CEulerVariable(su2double density, const su2double *velocity, su2
   bool windgust  = config->GetWind_Gust();
   bool classical_rk4 = (config->GetKind_TimeIntScheme_Flow() == CLASSICAL_RK4_EXPLICIT);
 
+  /*--- In lean mode the containers are only allocated for the features that use them. ---*/
+
+  const bool lean = config->GetLeanVariableStorage();
+
+  const bool limiter = ((config->GetKind_SlopeLimit_Flow() != NO_LIMITER) ||
+                        (config->GetKind_SlopeLimit_Turb() != NO_LIMITER) ||
+                        (config->GetContinuous_Adjoint() && (config->GetKind_SlopeLimit_AdjFlow() != NO_LIMITER))) &&
+                       (config->GetKind_SlopeLimit_Flow() != VAN_ALBADA_EDGE);
+
+  const bool sensor = (config->GetKind_ConvNumScheme_Flow() == SPACE_CENTERED) ||
+                      (config->GetKind_RoeLowDiss() == FD_DUCROS) ||
+                      (config->GetKind_RoeLowDiss() == NTS_DUCROS) ||
+                      config->GetContinuous_Adjoint();
+
   /*--- Allocate and initialize the primitive variables and gradients ---*/
 
   nPrimVar          = nDim+9;
@@ -48,7 +62,8 @@ CEulerVariable::CEulerVariable(su2double density, const su2double *velocity, su2
 
   /*--- Allocate residual structures ---*/
 
-  Res_TruncError.resize(nPoint,nVar) = su2double(0.0);
+  if (!lean || (config->GetnMGLevels() > 0))
+    Res_TruncError.resize(nPoint,nVar) = su2double(0.0);
 
   /*--- Only for residual smoothing (multigrid) ---*/
 
@@ -65,14 +80,19 @@ CEulerVariable::CEulerVariable(su2double density, const su2double *velocity, su2
   if (config->GetKind_ConvNumScheme_Flow() == SPACE_CENTERED)
     Undivided_Laplacian.resize(nPoint,nVar);
 
-  /*--- Always allocate the slope limiter,
+  /*--- Always allocate the slope limiter (unless lean),
    and the auxiliar variables (check the logic - JST with 2nd order Turb model - ) ---*/
 
-  Limiter_Primitive.resize(nPoint,nPrimVarGrad) = su2double(0.0);
-  Limiter.resize(nPoint,nVar) = su2double(0.0);
+  if (!lean || limiter) {
+    Limiter_Primitive.resize(nPoint,nPrimVarGrad) = su2double(0.0);
 
-  Solution_Max.resize(nPoint,nPrimVarGrad) = su2double(0.0);
-  Solution_Min.resize(nPoint,nPrimVarGrad) = su2double(0.0);
+    Solution_Max.resize(nPoint,nPrimVarGrad) = su2double(0.0);
+    Solution_Min.resize(nPoint,nPrimVarGrad) = su2double(0.0);
+  }
+
+  /*--- The flow solver limits the primitive variables, not the conservative ones. ---*/
+
+  if (!lean) Limiter.resize(nPoint,nVar) = su2double(0.0);
 
   /*--- Solution initialization ---*/
 
@@ -133,7 +153,7 @@ CEulerVariable::CEulerVariable(su2double density, const su2double *velocity, su2
   Max_Lambda_Inv.resize(nPoint) = su2double(0.0);
   Delta_Time.resize(nPoint) = su2double(0.0);
   Lambda.resize(nPoint) = su2double(0.0);
-  Sensor.resize(nPoint) = su2double(0.0);
+  if (!lean || sensor) Sensor.resize(nPoint) = su2double(0.0);
 
   /* Under-relaxation parameter. */
   UnderRelaxation.resize(nPoint) = su2double(1.0);
@@ -203,3 +223,18 @@ void CEulerVariable::SetSecondaryVar(unsigned long iPoint, CFluidModel *FluidMod
 }
 
 void CEulerVariable::SetSolution_New() { Solution_New = Solution; }
+
+void CEulerVariable::GetContainerMemory(MemoryList& memory) const {
+  CVariable::GetContainerMemory(memory);
+
+  AddContainerMemory("Velocity2", Velocity2, memory);
+  AddContainerMemory("HB_Source", HB_Source, memory);
+  AddContainerMemory("WindGust", WindGust, memory);
+  AddContainerMemory("WindGustDer", WindGustDer, memory);
+  AddContainerMemory("Primitive", Primitive, memory);
+  AddContainerMemory("Gradient_Primitive", Gradient_Primitive, memory);
+  AddContainerMemory("Gradient_Aux", Gradient_Aux, memory);
+  AddContainerMemory("Limiter_Primitive", Limiter_Primitive, memory);
+  AddContainerMemory("Secondary", Secondary, memory);
+  AddContainerMemory("Solution_New", Solution_New, memory);
+}
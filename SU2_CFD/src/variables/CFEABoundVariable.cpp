@@ -27,6 +27,7 @@
 
 
 #include "../../include/variables/CFEABoundVariable.hpp"
+#include "../../../Common/include/omp_structure.hpp"
 
 
 CFEABoundVariable::CFEABoundVariable(const su2double *val_fea, unsigned long npoint, unsigned long ndim, unsigned long nvar, CConfig *config)
@@ -62,11 +63,17 @@ void CFEABoundVariable::AllocateBoundaryVariables(CConfig *config) {
   }
 }
 
-void CFEABoundVariable::Set_FlowTraction_n() { FlowTraction_n = FlowTraction; }
+void CFEABoundVariable::Set_FlowTraction_n() {
+  assert(FlowTraction_n.size() == FlowTraction.size());
+  parallelCopy(FlowTraction.size(), FlowTraction.data(), FlowTraction_n.data());
+}
 
-void CFEABoundVariable::Set_SurfaceLoad_Res_n() { Residual_Ext_Surf_n = Residual_Ext_Surf; }
+void CFEABoundVariable::Set_SurfaceLoad_Res_n() {
+  assert(Residual_Ext_Surf_n.size() == Residual_Ext_Surf.size());
+  parallelCopy(Residual_Ext_Surf.size(), Residual_Ext_Surf.data(), Residual_Ext_Surf_n.data());
+}
 
-void CFEABoundVariable::Clear_FlowTraction() { FlowTraction.setConstant(0.0); }
+void CFEABoundVariable::Clear_FlowTraction() { parallelSet(FlowTraction.size(), su2double(0.0), FlowTraction.data()); }
 
 void CFEABoundVariable::Clear_SurfaceLoad_Res() { Residual_Ext_Surf.setConstant(0.0); }
 
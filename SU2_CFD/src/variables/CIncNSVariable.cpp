@@ -27,6 +27,7 @@
 
 
 #include "../../include/variables/CIncNSVariable.hpp"
+#include "../../../Common/include/omp_structure.hpp"
 
 
 CIncNSVariable::CIncNSVariable(su2double pressure, const su2double *velocity, su2double temperature,
@@ -40,6 +41,7 @@ CIncNSVariable::CIncNSVariable(su2double pressure, const su2double *velocity, su
 
 bool CIncNSVariable::SetVorticity_StrainMag() {
 
+  SU2_OMP_FOR_STAT(256)
   for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
 
     /*--- Vorticity ---*/
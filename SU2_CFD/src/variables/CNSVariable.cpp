@@ -38,9 +38,16 @@ CNSVariable::CNSVariable(su2double density, const su2double *velocity, su2double
   Vorticity.resize(nPoint,3) = su2double(0.0);
   StrainMag.resize(nPoint) = su2double(0.0);
   Tau_Wall.resize(nPoint) = su2double(-1.0);
-  DES_LengthScale.resize(nPoint) = su2double(0.0);
-  Roe_Dissipation.resize(nPoint) = su2double(0.0);
-  Vortex_Tilting.resize(nPoint) = su2double(0.0);
+
+  /*--- In lean mode the DES and low dissipation containers are allocated only if used. ---*/
+
+  const bool lean = config->GetLeanVariableStorage();
+
+  if (!lean || (config->GetKind_HybridRANSLES() != NO_HYBRIDRANSLES))
+    DES_LengthScale.resize(nPoint) = su2double(0.0);
+  if (!lean || (config->GetKind_RoeLowDiss() != NO_ROELOWDISS))
+    Roe_Dissipation.resize(nPoint) = su2double(0.0);
+  if (!lean) Vortex_Tilting.resize(nPoint) = su2double(0.0);
   Max_Lambda_Visc.resize(nPoint) = su2double(0.0);
 }
 
@@ -273,3 +280,13 @@ void CNSVariable::SetSecondaryVar(unsigned long iPoint, CFluidModel *FluidModel)
 
 }
 
+void CNSVariable::GetContainerMemory(MemoryList& memory) const {
+  CEulerVariable::GetContainerMemory(memory);
+
+  AddContainerMemory("Vorticity", Vorticity, memory);
+  AddContainerMemory("StrainMag", StrainMag, memory);
+  AddContainerMemory("Tau_Wall", Tau_Wall, memory);
+  AddContainerMemory("DES_LengthScale", DES_LengthScale, memory);
+  AddContainerMemory("Roe_Dissipation", Roe_Dissipation, memory);
+  AddContainerMemory("Vortex_Tilting", Vortex_Tilting, memory);
+}
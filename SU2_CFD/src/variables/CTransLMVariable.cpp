@@ -41,5 +41,5 @@ CTransLMVariable::CTransLMVariable(su2double intermittency, su2double REth, unsi
   if (config->GetMultizone_Problem())
     Set_BGSSolution_k();
 
-  gamma_sep.resize(nPoint);
+  gamma_sep.resize(nPoint) = su2double(0.0);
 }
@@ -59,6 +59,20 @@ CTurbVariable::CTurbVariable(unsigned long npoint, unsigned long ndim, unsigned
 
   Delta_Time.resize(nPoint) = su2double(0.0);
 
+  /*--- Truncation error and residual smoothing of the multigrid cycle ---*/
+
+  if (config->GetMG_Turbulence()) {
+    Res_TruncError.resize(nPoint,nVar) = su2double(0.0);
+
+    for (unsigned long iMesh = 0; iMesh <= config->GetnMGLevels(); iMesh++) {
+      if (config->GetMG_CorrecSmooth(iMesh) > 0) {
+        Residual_Sum.resize(nPoint,nVar);
+        Residual_Old.resize(nPoint,nVar);
+        break;
+      }
+    }
+  }
+
   /* Under-relaxation parameter. */
   UnderRelaxation.resize(nPoint) = su2double(1.0);
   LocalCFL.resize(nPoint) = su2double(0.0);
@@ -100,6 +100,56 @@ void CVariable::Set_Solution_time_n1() {
   parallelCopy(Solution_time_n.size(), Solution_time_n.data(), Solution_time_n1.data());
 }
 
+void CVariable::Set_Solution_time_n2(bool lowPrec) {
+
+  const auto size = Solution_time_n1.size();
+  const su2double* sol_n1 = Solution_time_n1.data();
+
+  if (lowPrec) {
+    if (Solution_time_n2_LowPrec.size() != size) {
+      SU2_OMP_MASTER
+      Solution_time_n2_LowPrec.resize(nPoint,nVar);
+      SU2_OMP_BARRIER
+    }
+    float* sol_n2 = Solution_time_n2_LowPrec.data();
+
+    SU2_OMP_FOR_STAT(4196)
+    for (size_t i = 0; i < size; ++i) sol_n2[i] = SU2_TYPE::GetValue(sol_n1[i]);
+  }
+  else {
+    if (Solution_time_n2.size() != size) {
+      SU2_OMP_MASTER
+      Solution_time_n2.resize(nPoint,nVar);
+      SU2_OMP_BARRIER
+    }
+    parallelCopy(size, sol_n1, Solution_time_n2.data());
+  }
+}
+
+void CVariable::SetSolution_Extrapolated(unsigned short order) {
+
+  const auto size = Solution.size();
+  su2double* sol = Solution.data();
+  const su2double* sol_n = Solution_time_n.data();
+  const su2double* sol_n1 = Solution_time_n1.data();
+
+  if (order == 2) {
+    SU2_OMP_FOR_STAT(4196)
+    for (size_t i = 0; i < size; ++i) sol[i] = 2.0*sol_n[i] - sol_n1[i];
+  }
+  else if (Solution_time_n2_LowPrec.size() == size) {
+    const float* sol_n2 = Solution_time_n2_LowPrec.data();
+    SU2_OMP_FOR_STAT(4196)
+    for (size_t i = 0; i < size; ++i) sol[i] = 3.0*(sol_n[i] - sol_n1[i]) + su2double(sol_n2[i]);
+  }
+  else {
+    assert(Solution_time_n2.size() == size);
+    const su2double* sol_n2 = Solution_time_n2.data();
+    SU2_OMP_FOR_STAT(4196)
+    for (size_t i = 0; i < size; ++i) sol[i] = 3.0*(sol_n[i] - sol_n1[i]) + sol_n2[i];
+  }
+}
+
 void CVariable::Set_BGSSolution_k() {
   assert(Solution_BGS_k.size() == Solution.size());
   parallelCopy(Solution.size(), Solution.data(), Solution_BGS_k.data());
@@ -146,3 +196,37 @@ void CVariable::RegisterSolution_time_n1() {
     for(unsigned long iVar=0; iVar<nVar; ++iVar)
       AD::RegisterInput(Solution_time_n1(iPoint,iVar));
 }
+
+void CVariable::GetContainerMemory(MemoryList& memory) const {
+  AddContainerMemory("Solution", Solution, memory);
+  AddContainerMemory("Solution_Old", Solution_Old, memory);
+  AddContainerMemory("External", External, memory);
+  AddContainerMemory("Non_Physical", Non_Physical, memory);
+  AddContainerMemory("Non_Physical_Counter", Non_Physical_Counter, memory);
+  AddContainerMemory("UnderRelaxation", UnderRelaxation, memory);
+  AddContainerMemory("LocalCFL", LocalCFL, memory);
+  AddContainerMemory("Solution_time_n", Solution_time_n, memory);
+  AddContainerMemory("Solution_time_n1", Solution_time_n1, memory);
+  AddContainerMemory("Solution_time_n2", Solution_time_n2, memory);
+  AddContainerMemory("Solution_time_n2_LowPrec", Solution_time_n2_LowPrec, memory);
+  AddContainerMemory("Delta_Time", Delta_Time, memory);
+  AddContainerMemory("Gradient", Gradient, memory);
+  AddContainerMemory("Rmatrix", Rmatrix, memory);
+  AddContainerMemory("Limiter", Limiter, memory);
+  AddContainerMemory("Solution_Max", Solution_Max, memory);
+  AddContainerMemory("Solution_Min", Solution_Min, memory);
+  AddContainerMemory("AuxVar", AuxVar, memory);
+  AddContainerMemory("Grad_AuxVar", Grad_AuxVar, memory);
+  AddContainerMemory("Max_Lambda_Inv", Max_Lambda_Inv, memory);
+  AddContainerMemory("Max_Lambda_Visc", Max_Lambda_Visc, memory);
+  AddContainerMemory("Lambda", Lambda, memory);
+  AddContainerMemory("Sensor", Sensor, memory);
+  AddContainerMemory("Undivided_Laplacian", Undivided_Laplacian, memory);
+  AddContainerMemory("Res_TruncError", Res_TruncError, memory);
+  AddContainerMemory("Residual_Old", Residual_Old, memory);
+  AddContainerMemory("Residual_Sum", Residual_Sum, memory);
+  AddContainerMemory("Solution_Adj_Old", Solution_Adj_Old, memory);
+  AddContainerMemory("Solution_BGS_k", Solution_BGS_k, memory);
+  AddContainerMemory("AD_InputIndex", AD_InputIndex, memory);
+  AddContainerMemory("AD_OutputIndex", AD_OutputIndex, memory);
+}
@@ -60,24 +60,50 @@ using namespace std;
 
 void SetProjection_FD(CGeometry *geometry, CConfig *config, CSurfaceMovement *surface_movement, su2double **Gradient);
 
+/*!
+ * \brief Accumulate the surface sensitivity onto the control points of a FFD box (sparse projection).
+ * \param[in] geometry - Geometrical definition of the problem.
+ * \param[in] config - Definition of the particular problem.
+ * \param[in] FFDBox - FFD box, with the parametric coordinates of its surface points.
+ * \param[out] CPSensitivity - Sensitivity w.r.t. the coordinates of the control points.
+ */
+
+void SetControlPointSensitivity(CGeometry *geometry, CConfig *config, CFreeFormDefBox *FFDBox, vector<su2double> &CPSensitivity);
+
+/*!
+ * \brief Product of the current movement of the control points of a FFD box with their sensitivity.
+ * \param[in] FFDBox - FFD box, with the control points moved by a design variable.
+ * \param[in] CPSensitivity - Sensitivity w.r.t. the coordinates of the control points.
+ * \return Local (rank) contribution to the directional derivative.
+ */
+
+su2double GetControlPointProjection(CFreeFormDefBox *FFDBox, const vector<su2double> &CPSensitivity);
+
 /*!
  * \brief Projection of the surface sensitivity using algorithmic differentiation (AD).
+ * \details The surface deformation is recorded once and the tape is evaluated for all the objectives,
+ *          nDir (codi-reverse-directions) at a time, the gradients of all ranks are summed with one reduction.
  * \param[in] geometry - Geometrical definition of the problem.
  * \param[in] config - Definition of the particular problem.
  * \param[in] surface_movement - Surface movement class of the problem.
- * \param[in] Gradient_file - Output file to store the gradient data.
+ * \param[out] Gradient - Gradient of each objective.
+ * \param[in] ObjSensitivity - Mesh sensitivity of each objective (separate objectives), empty for a single objective
+ *            whose sensitivity is stored in the geometry.
+ * \param[in] ObjAoA_Sens - Sensitivity w.r.t. the angle of attack of each objective (separate objectives).
  */
 
-void SetProjection_AD(CGeometry *geometry, CConfig *config, CSurfaceMovement *surface_movement, su2double **Gradient);
+void SetProjection_AD(CGeometry *geometry, CConfig *config, CSurfaceMovement *surface_movement, vector<su2double**>& Gradient,
+                      const vector<su2activematrix>& ObjSensitivity, const vector<su2double>& ObjAoA_Sens);
 
 /*!
  * \brief Prints the gradient information to a file.
  * \param[in] Gradient - The gradient data.
  * \param[in] config - Definition of the particular problem.
  * \param[in] Gradient_file - Output file to store the gradient data.
+ * \param[in] val_obj - Index of the objective function.
  */
 
-void OutputGradient(su2double** Gradient, CConfig* config, ofstream& Gradient_file);
+void OutputGradient(su2double** Gradient, CConfig* config, ofstream& Gradient_file, unsigned short val_obj = 0);
 
 /*!
  * \brief Write the sensitivity (including mesh sensitivity) computed with the discrete adjoint method
@@ -85,6 +111,7 @@ void OutputGradient(su2double** Gradient, CConfig* config, ofstream& Gradient_fi
  * \param[in] geometry - Geometrical definition of the problem.
  * \param[in] config - Definition of the particular problem.
  * \param[in] val_nZone - Number of Zones.
+ * \param[in] val_obj - Index of the objective (separate objectives) appended to the filenames, -1 for none.
  */
 
-void SetSensitivity_Files(CGeometry ***geometry, CConfig **config, unsigned short val_nZone);
+void SetSensitivity_Files(CGeometry ***geometry, CConfig **config, unsigned short val_nZone, short val_obj = -1);
@@ -38,8 +38,9 @@ int main(int argc, char *argv[]) {
   ofstream Gradient_file;
   bool fem_solver = false;
 
-  su2double** Gradient;
-  unsigned short iDV, iDV_Value;
+  vector<su2double**> Gradient;
+  unsigned short iDV, iDV_Value, iObj, iDim;
+  unsigned long iPoint;
   int rank, size;
 
   /*--- MPI initialization, and buffer setting ---*/
@@ -237,6 +238,14 @@ int main(int argc, char *argv[]) {
   StartTime = su2double(clock())/su2double(CLOCKS_PER_SEC);
 #endif
 
+  /*--- Multipoint discrete adjoint with one adjoint solution per objective (DISCADJ_SEPARATE_OBJECTIVES),
+   a gradient is computed for each objective. ---*/
+
+  const bool separate_objectives = config_container[ZONE_0]->GetDiscAdj_Separate_Objectives();
+  const unsigned short nObj_Projection = separate_objectives? config_container[ZONE_0]->GetnObj() : 1;
+  vector<su2activematrix> ObjSensitivity(separate_objectives? nObj_Projection : 0);
+  vector<su2double> ObjAoA_Sens(nObj_Projection, 0.0);
+
   for (iZone = 0; iZone < nZone; iZone++) {
 
     if (rank == MASTER_NODE)
@@ -292,21 +301,43 @@ int main(int argc, char *argv[]) {
       if (rank == MASTER_NODE) cout << "Reading volume sensitivities at each node from file." << endl;
       grid_movement[iZone] = new CVolumetricMovement(geometry_container[iZone][INST_0], config_container[iZone]);
 
-      /*--- Read in sensitivities from file. ---*/
-      if (config_container[ZONE_0]->GetSensitivity_Format() == UNORDERED_ASCII)
-        geometry_container[iZone][INST_0]->ReadUnorderedSensitivity(config_container[iZone]);
-      else
-        geometry_container[iZone][INST_0]->SetSensitivity(config_container[iZone]);
+      /*--- With separate objectives (single zone) the adjoint of each objective is read, its mesh
+       sensitivity is computed and stored, and all of them are projected with one tape. ---*/
 
-      if (rank == MASTER_NODE)
-        cout << "\n---------------------- Mesh sensitivity computation ---------------------" << endl;
-      grid_movement[iZone]->SetVolume_Deformation(geometry_container[iZone][INST_0], config_container[iZone], false, true);
+      if (separate_objectives && (config_container[iZone]->GetSensitivity_Format() == UNORDERED_ASCII))
+        SU2_MPI::Error("DISCADJ_SEPARATE_OBJECTIVES does not support the UNORDERED_ASCII sensitivity format.", CURRENT_FUNCTION);
+
+      for (iObj = 0; iObj < nObj_Projection; iObj++) {
+
+        /*--- Read in sensitivities from file. ---*/
+        if (config_container[ZONE_0]->GetSensitivity_Format() == UNORDERED_ASCII)
+          geometry_container[iZone][INST_0]->ReadUnorderedSensitivity(config_container[iZone]);
+        else
+          geometry_container[iZone][INST_0]->SetSensitivity(config_container[iZone], separate_objectives? iObj : -1);
+
+        if (rank == MASTER_NODE)
+          cout << "\n---------------------- Mesh sensitivity computation ---------------------" << endl;
+        grid_movement[iZone]->SetVolume_Deformation(geometry_container[iZone][INST_0], config_container[iZone], false, true);
+
+        if (separate_objectives) {
+          CGeometry *geometry = geometry_container[iZone][INST_0];
+          ObjSensitivity[iObj].resize(geometry->GetnPoint(), geometry->GetnDim());
+          for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++)
+            for (iDim = 0; iDim < geometry->GetnDim(); iDim++)
+              ObjSensitivity[iObj](iPoint,iDim) = geometry->GetSensitivity(iPoint, iDim);
+          ObjAoA_Sens[iObj] = config_container[iZone]->GetAoA_Sens();
+
+          if (rank == MASTER_NODE)
+            cout << "\n------------------------ Mesh sensitivity Output ------------------------" << endl;
+          SetSensitivity_Files(geometry_container, config_container, nZone, iObj);
+        }
+      }
 
     }
   }
 
 
-  if (config_container[ZONE_0]->GetDiscrete_Adjoint()) {
+  if (config_container[ZONE_0]->GetDiscrete_Adjoint() && !separate_objectives) {
     if (rank == MASTER_NODE)
       cout << "\n------------------------ Mesh sensitivity Output ------------------------" << endl;
     SetSensitivity_Files(geometry_container, config_container, nZone);
@@ -316,24 +347,26 @@ int main(int argc, char *argv[]) {
     if ((config_container[iZone]->GetDesign_Variable(0) != NONE) &&
         (config_container[iZone]->GetDesign_Variable(0) != SURFACE_FILE)) {
 
-      /*--- Initialize structure to store the gradient ---*/
+      /*--- Initialize structure to store the gradient (of each objective) ---*/
 
-      Gradient = new su2double*[config_container[ZONE_0]->GetnDV()];
+      Gradient.resize(nObj_Projection);
 
-      for (iDV = 0; iDV  < config_container[iZone]->GetnDV(); iDV++){
-        Gradient[iDV] = new su2double[config_container[iZone]->GetnDV_Value(iDV)];
-        for (iDV_Value = 0; iDV_Value < config_container[iZone]->GetnDV_Value(iDV); iDV_Value++){
-          Gradient[iDV][iDV_Value] = 0.0;
+      for (iObj = 0; iObj < nObj_Projection; iObj++) {
+        Gradient[iObj] = new su2double*[config_container[iZone]->GetnDV()];
+
+        for (iDV = 0; iDV  < config_container[iZone]->GetnDV(); iDV++){
+          Gradient[iObj][iDV] = new su2double[config_container[iZone]->GetnDV_Value(iDV)];
+          for (iDV_Value = 0; iDV_Value < config_container[iZone]->GetnDV_Value(iDV); iDV_Value++){
+            Gradient[iObj][iDV][iDV_Value] = 0.0;
+          }
         }
       }
 
       if (rank == MASTER_NODE)
         cout << "\n---------- Start gradient evaluation using sensitivity information ----------" << endl;
 
-      /*--- Write the gradient in a external file ---*/
-
-      if (rank == MASTER_NODE)
-        Gradient_file.open(config_container[iZone]->GetObjFunc_Grad_FileName().c_str(), ios::out);
+      if (separate_objectives && !config_container[iZone]->GetAD_Mode())
+        SU2_MPI::Error("DISCADJ_SEPARATE_OBJECTIVES requires the projection with SU2_DOT_AD.", CURRENT_FUNCTION);
 
       /*--- Definition of the Class for surface deformation ---*/
 
@@ -347,23 +380,36 @@ int main(int argc, char *argv[]) {
        *    otherwise we use finite differences. ---*/
 
       if (config_container[iZone]->GetAD_Mode())
-        SetProjection_AD(geometry_container[iZone][INST_0], config_container[iZone], surface_movement[iZone] , Gradient);
+        SetProjection_AD(geometry_container[iZone][INST_0], config_container[iZone], surface_movement[iZone], Gradient,
+                         ObjSensitivity, ObjAoA_Sens);
       else
-        SetProjection_FD(geometry_container[iZone][INST_0], config_container[iZone], surface_movement[iZone] , Gradient);
+        SetProjection_FD(geometry_container[iZone][INST_0], config_container[iZone], surface_movement[iZone], Gradient[0]);
 
-      /*--- Print gradients to screen and file ---*/
+      for (iObj = 0; iObj < nObj_Projection; iObj++) {
 
-      OutputGradient(Gradient, config_container[iZone], Gradient_file);
+        /*--- Write the gradient in a external file, one per objective if they are separate ---*/
 
-      if (rank == MASTER_NODE)
-        Gradient_file.close();
+        if (rank == MASTER_NODE) {
+          string Gradient_filename = config_container[iZone]->GetObjFunc_Grad_FileName();
+          if (separate_objectives)
+            Gradient_filename = config_container[iZone]->GetObjFunc_Extension(Gradient_filename, iObj);
+          Gradient_file.open(Gradient_filename.c_str(), ios::out);
+        }
+
+        /*--- Print gradients to screen and file ---*/
+
+        OutputGradient(Gradient[iObj], config_container[iZone], Gradient_file, iObj);
+
+        if (rank == MASTER_NODE)
+          Gradient_file.close();
 
-      for (iDV = 0; iDV  < config_container[iZone]->GetnDV(); iDV++){
-        delete [] Gradient[iDV];
+        for (iDV = 0; iDV  < config_container[iZone]->GetnDV(); iDV++){
+          delete [] Gradient[iObj][iDV];
+        }
+        delete [] Gradient[iObj];
       }
     }
   }
-  delete [] Gradient;
 
   delete config;
   config = NULL;
@@ -454,15 +500,25 @@ void SetProjection_FD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
 
   unsigned short iDV, nDV, iFFDBox, nDV_Value, iMarker, iDim;
   unsigned long iVertex, iPoint;
-  su2double delta_eps, my_Gradient, localGradient, *Normal, dS, *VarCoord, Sensitivity,
+  su2double delta_eps, my_Gradient, *Normal, dS, *VarCoord, Sensitivity,
   dalpha[3], deps[3], dalpha_deps;
-  bool *UpdatePoint, MoveSurface, Local_MoveSurface;
+  bool *UpdatePoint, MoveSurface, Local_MoveSurface, SparseProjection;
   CFreeFormDefBox **FFDBox;
 
   int rank = SU2_MPI::GetRank();
 
   nDV = config->GetnDV();
 
+  /*--- Contribution of this rank to the gradient of each design variable, summed once after the loop. ---*/
+
+  vector<passivedouble> Local_Gradient(nDV, 0.0), Total_Gradient(nDV, 0.0);
+
+  /*--- Sensitivity w.r.t. the control points of each box, for the sparse projection. ---*/
+
+  bool sparse_projection = config->GetFFD_Sparse_Projection();
+  vector<vector<su2double> > CPSensitivity(MAX_NUMBER_FFD);
+  su2double my_SparseGradient;
+
   /*--- Boolean controlling points to be updated ---*/
 
   UpdatePoint = new bool[geometry->GetnPoint()];
@@ -489,6 +545,8 @@ void SetProjection_FD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
 
     MoveSurface = true;
     Local_MoveSurface = true;
+    SparseProjection = false;
+    my_SparseGradient = 0.0;
 
     /*--- Free Form deformation based ---*/
 
@@ -529,6 +587,14 @@ void SetProjection_FD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
           if (rank == MASTER_NODE) cout << "Check the FFD box intersections with the solid surfaces." << endl;
           surface_movement->CheckFFDIntersections(geometry, config, FFDBox[iFFDBox], iFFDBox);
 
+          /*--- The basis weights are computed once, the sensitivity is then projected
+           onto the control points of the box with a single sparse product. ---*/
+
+          if (sparse_projection) {
+            if (rank == MASTER_NODE) cout << "Project the surface sensitivity onto the FFD control points." << endl;
+            SetControlPointSensitivity(geometry, config, FFDBox[iFFDBox], CPSensitivity[iFFDBox]);
+          }
+
         }
 
         if (rank == MASTER_NODE)
@@ -565,11 +631,18 @@ void SetProjection_FD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
           case FFD_ANGLE_OF_ATTACK :  Gradient[iDV][0] = config->GetAoA_Sens(); break;
         }
 
-        /*--- Recompute cartesian coordinates using the new control points position ---*/
+        /*--- Recompute cartesian coordinates using the new control points position, or
+         with the sparse projection only the movement of the control points is needed ---*/
 
         if (Local_MoveSurface) {
           MoveSurface = true;
-          surface_movement->SetCartesianCoord(geometry, config, FFDBox[iFFDBox], iFFDBox, true);
+          if (sparse_projection) {
+            SparseProjection = true;
+            my_SparseGradient += GetControlPointProjection(FFDBox[iFFDBox], CPSensitivity[iFFDBox]);
+          }
+          else {
+            surface_movement->SetCartesianCoord(geometry, config, FFDBox[iFFDBox], iFFDBox, true);
+          }
         }
 
       }
@@ -646,7 +719,12 @@ void SetProjection_FD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
 
       my_Gradient = 0.0; Gradient[iDV][0] = 0.0;
 
-      if (MoveSurface) {
+      if (MoveSurface && SparseProjection) {
+
+        my_Gradient = my_SparseGradient / config->GetDV_Value(iDV);
+
+      }
+      else if (MoveSurface) {
 
         delta_eps = config->GetDV_Value(iDV);
 
@@ -685,11 +763,25 @@ void SetProjection_FD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
         }
       }
 
-      SU2_MPI::Allreduce(&my_Gradient, &localGradient, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-      Gradient[iDV][0] += localGradient;
+      Local_Gradient[iDV] = SU2_TYPE::GetValue(my_Gradient);
     }
   }
 
+  /*--- Sum the contributions of the ranks for all the design variables at once ---*/
+
+#ifdef HAVE_MPI
+  SelectMPIWrapper<passivedouble>::W::Allreduce(Local_Gradient.data(), Total_Gradient.data(), nDV,
+                                                MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#else
+  Total_Gradient = Local_Gradient;
+#endif
+
+  for (iDV = 0; iDV < nDV; iDV++) {
+    if ((config->GetDesign_Variable(iDV) != ANGLE_OF_ATTACK) &&
+        (config->GetDesign_Variable(iDV) != FFD_ANGLE_OF_ATTACK))
+      Gradient[iDV][0] += Total_Gradient[iDV];
+  }
+
   /*--- Delete memory for parameterization. ---*/
 
   if (FFDBox != NULL) {
@@ -706,11 +798,91 @@ void SetProjection_FD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
 }
 
 
-void SetProjection_AD(CGeometry *geometry, CConfig *config, CSurfaceMovement *surface_movement, su2double** Gradient){
+void SetControlPointSensitivity(CGeometry *geometry, CConfig *config, CFreeFormDefBox *FFDBox, vector<su2double> &CPSensitivity){
 
-  su2double DV_Value, *VarCoord, Sensitivity, my_Gradient, localGradient, *Normal, Area = 0.0;
-  unsigned short iDV_Value = 0, iMarker, nMarker, iDim, nDim, iDV, nDV, nDV_Value;
-  unsigned long iVertex, nVertex, iPoint;
+  unsigned short iMarker, iDim, nDim = geometry->GetnDim();
+  unsigned long iVertex, iPoint, iSurfacePoints, nSurfacePoints = FFDBox->GetnSurfacePoint();
+  su2double *Normal, dS, Sensitivity;
+
+  /*--- Same convention as the finite differences, each domain point contributes once with
+   the normal and sensitivity of the first vertex that is visited. ---*/
+
+  vector<su2double> PointSensitivity(geometry->GetnPoint()*nDim, 0.0);
+  vector<bool> UpdatePoint(geometry->GetnPoint(), true);
+
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    if (config->GetMarker_All_DV(iMarker) == YES) {
+      for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+
+        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        if ((iPoint < geometry->GetnPointDomain()) && UpdatePoint[iPoint]) {
+
+          Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+          Sensitivity = geometry->vertex[iMarker][iVertex]->GetAuxVar();
+
+          dS = 0.0;
+          for (iDim = 0; iDim < nDim; iDim++) dS += Normal[iDim]*Normal[iDim];
+          dS = sqrt(dS);
+
+          for (iDim = 0; iDim < nDim; iDim++)
+            PointSensitivity[iPoint*nDim+iDim] = -Sensitivity*Normal[iDim]/dS;
+
+          UpdatePoint[iPoint] = false;
+        }
+      }
+    }
+  }
+
+  /*--- Gather it at the surface points of the box (FFD boxes are always 3D), the box lists
+   one entry per vertex, points shared by several markers must only be counted once. ---*/
+
+  vector<su2double> SurfaceSensitivity(nSurfacePoints*3, 0.0);
+  UpdatePoint.assign(geometry->GetnPoint(), true);
+
+  for (iSurfacePoints = 0; iSurfacePoints < nSurfacePoints; iSurfacePoints++) {
+    iMarker = FFDBox->Get_MarkerIndex(iSurfacePoints);
+    iPoint = FFDBox->Get_PointIndex(iSurfacePoints);
+    if ((config->GetMarker_All_DV(iMarker) == YES) && UpdatePoint[iPoint]) {
+      for (iDim = 0; iDim < nDim; iDim++)
+        SurfaceSensitivity[iSurfacePoints*3+iDim] = PointSensitivity[iPoint*nDim+iDim];
+      UpdatePoint[iPoint] = false;
+    }
+  }
+
+  FFDBox->ProjectSurfaceToControlPoints(SurfaceSensitivity, CPSensitivity);
+
+}
+
+su2double GetControlPointProjection(CFreeFormDefBox *FFDBox, const vector<su2double> &CPSensitivity){
+
+  unsigned short iOrder, jOrder, kOrder, iDim;
+  unsigned long iControlPoint = 0;
+  su2double *Coord, *Coord_Orig, Projection = 0.0;
+
+  /*--- The movement of the control points w.r.t. their original position (the copy) ---*/
+
+  for (iOrder = 0; iOrder < FFDBox->GetlOrder(); iOrder++) {
+    for (jOrder = 0; jOrder < FFDBox->GetmOrder(); jOrder++) {
+      for (kOrder = 0; kOrder < FFDBox->GetnOrder(); kOrder++) {
+        Coord = FFDBox->Coord_Control_Points[iOrder][jOrder][kOrder];
+        Coord_Orig = FFDBox->Coord_Control_Points_Copy[iOrder][jOrder][kOrder];
+        for (iDim = 0; iDim < 3; iDim++)
+          Projection += (Coord[iDim]-Coord_Orig[iDim]) * CPSensitivity[3*iControlPoint+iDim];
+        iControlPoint++;
+      }
+    }
+  }
+
+  return Projection;
+
+}
+
+void SetProjection_AD(CGeometry *geometry, CConfig *config, CSurfaceMovement *surface_movement, vector<su2double**>& Gradient,
+                      const vector<su2activematrix>& ObjSensitivity, const vector<su2double>& ObjAoA_Sens){
+
+  su2double DV_Value, *VarCoord, Sensitivity, *Normal, Area = 0.0;
+  unsigned short iDV_Value = 0, iMarker, nMarker, iDim, nDim, iDV, nDV, nDV_Value, iDir, nSeed;
+  unsigned long iVertex, nVertex, iPoint, iObj, iGrad, nGrad = 0;
 
   int rank = SU2_MPI::GetRank();
 
@@ -718,8 +890,14 @@ void SetProjection_AD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
   nDim    = geometry->GetnDim();
   nDV     = config->GetnDV();
 
+  const unsigned short nDir = SU2_TYPE::GetnDirections();
+  const unsigned long nObj = Gradient.size();
+  const bool separate_objectives = !ObjSensitivity.empty();
+
   VarCoord = NULL;
 
+  for (iDV = 0; iDV < nDV; iDV++) nGrad += config->GetnDV_Value(iDV);
+
   /*--- Discrete adjoint gradient computation ---*/
 
   if (rank == MASTER_NODE)
@@ -732,8 +910,6 @@ void SetProjection_AD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
   /*--- Register design variables as input and set them to zero
    * (since we want to have the derivative at alpha = 0, i.e. for the current design) ---*/
 
-
-
   for (iDV = 0; iDV < nDV; iDV++){
 
     nDV_Value =  config->GetnDV_Value(iDV);
@@ -758,81 +934,115 @@ void SetProjection_AD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
 
   AD::StopRecording();
 
-  /*--- Create a structure to identify points that have been already visited.
-   * We need that to make sure to set the sensitivity of surface points only once
+  /*--- Identify the vertices whose sensitivity is set, the sensitivity of the surface points is set only once
    *  (Markers share points, so we would visit them more than once in the loop over the markers below) ---*/
 
-  bool* visited = new bool[geometry->GetnPoint()];
-  for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++){
-    visited[iPoint] = false;
-  }
-
-  /*--- Initialize the derivatives of the output of the surface deformation routine
-   * with the discrete adjoints from the CFD solution ---*/
+  vector<bool> visited(geometry->GetnPoint(), false);
+  vector<pair<unsigned short, unsigned long> > SeedVertex;
 
   for (iMarker = 0; iMarker < nMarker; iMarker++) {
     if (config->GetMarker_All_DV(iMarker) == YES) {
       nVertex = geometry->nVertex[iMarker];
       for (iVertex = 0; iVertex <nVertex; iVertex++) {
-        iPoint      = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
         if (!visited[iPoint]){
-          VarCoord    = geometry->vertex[iMarker][iVertex]->GetVarCoord();
-          Normal      = geometry->vertex[iMarker][iVertex]->GetNormal();
+          SeedVertex.push_back(make_pair(iMarker, iVertex));
+          visited[iPoint] = true;
+        }
+      }
+    }
+  }
 
-          Area = 0.0;
-          for (iDim = 0; iDim < nDim; iDim++){
-            Area += Normal[iDim]*Normal[iDim];
-          }
-          Area = sqrt(Area);
+  /*--- The tape is evaluated for nDir objectives at a time (codi-reverse-directions), the derivatives of the
+   *  output of the surface deformation routine are initialized with the discrete adjoints of each objective. ---*/
 
-          for (iDim = 0; iDim < nDim; iDim++){
-            if (config->GetDiscrete_Adjoint()){
-              Sensitivity = geometry->GetSensitivity(iPoint, iDim);
-            } else {
-              Sensitivity = -Normal[iDim]*geometry->vertex[iMarker][iVertex]->GetAuxVar()/Area;
-            }
-            SU2_TYPE::SetDerivative(VarCoord[iDim], SU2_TYPE::GetValue(Sensitivity));
+  if ((rank == MASTER_NODE) && (nObj > 1))
+    cout << "Evaluate the tape for " << nObj << " objective functions (" << nDir << " per evaluation)." << endl;
+
+  vector<passivedouble> Local_Gradient(nObj*nGrad, 0.0), Total_Gradient(nObj*nGrad, 0.0);
+
+  for (iObj = 0; iObj < nObj; iObj += nDir) {
+
+    nSeed = min<unsigned long>(nDir, nObj-iObj);
+
+    AD::ClearAdjoints();
+
+    for (const auto& seed : SeedVertex) {
+      iMarker  = seed.first;
+      iVertex  = seed.second;
+      iPoint   = geometry->vertex[iMarker][iVertex]->GetNode();
+      VarCoord = geometry->vertex[iMarker][iVertex]->GetVarCoord();
+      Normal   = geometry->vertex[iMarker][iVertex]->GetNormal();
+
+      Area = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++){
+        Area += Normal[iDim]*Normal[iDim];
+      }
+      Area = sqrt(Area);
+
+      for (iDir = 0; iDir < nSeed; iDir++) {
+        for (iDim = 0; iDim < nDim; iDim++){
+          if (separate_objectives) {
+            Sensitivity = ObjSensitivity[iObj+iDir](iPoint, iDim);
+          } else if (config->GetDiscrete_Adjoint()){
+            Sensitivity = geometry->GetSensitivity(iPoint, iDim);
+          } else {
+            Sensitivity = -Normal[iDim]*geometry->vertex[iMarker][iVertex]->GetAuxVar()/Area;
           }
-          visited[iPoint] = true;
+          SU2_TYPE::SetDerivative(VarCoord[iDim], iDir, SU2_TYPE::GetValue(Sensitivity));
         }
       }
     }
-  }
 
-  delete [] visited;
+    /*--- Compute derivatives and extract gradient (in the order of registration) ---*/
 
-  /*--- Compute derivatives and extract gradient ---*/
+    AD::ComputeAdjoint();
 
-  AD::ComputeAdjoint();
+    for (iDir = 0; iDir < nSeed; iDir++) {
+      AD::SetDirection(iDir);
+      iGrad = (iObj+iDir)*nGrad;
+      for (iDV = 0; iDV < nDV; iDV++){
+        for (iDV_Value = 0; iDV_Value < config->GetnDV_Value(iDV); iDV_Value++){
+          DV_Value = config->GetDV_Value(iDV, iDV_Value);
+          Local_Gradient[iGrad++] = SU2_TYPE::GetDerivative(DV_Value, iDir);
+        }
+      }
+    }
+  }
 
-  for (iDV = 0; iDV  < nDV; iDV++){
-    nDV_Value =  config->GetnDV_Value(iDV);
+  AD::SetDirection(0);
+  AD::Reset();
+
+  /*--- Sum the contributions of the ranks for all the objectives and design variables at once ---*/
 
-    for (iDV_Value = 0; iDV_Value < nDV_Value; iDV_Value++){
-      DV_Value = config->GetDV_Value(iDV, iDV_Value);
-      my_Gradient = SU2_TYPE::GetDerivative(DV_Value);
 #ifdef HAVE_MPI
-    SU2_MPI::Allreduce(&my_Gradient, &localGradient, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SelectMPIWrapper<passivedouble>::W::Allreduce(Local_Gradient.data(), Total_Gradient.data(), Local_Gradient.size(),
+                                                MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
 #else
-      localGradient = my_Gradient;
+  Total_Gradient = Local_Gradient;
 #endif
-      /*--- Angle of Attack design variable (this is different,
-       the value comes form the input file) ---*/
 
-      if ((config->GetDesign_Variable(iDV) == ANGLE_OF_ATTACK) ||
-          (config->GetDesign_Variable(iDV) == FFD_ANGLE_OF_ATTACK))  {
-        Gradient[iDV][iDV_Value] = config->GetAoA_Sens();
-      }
+  for (iObj = 0; iObj < nObj; iObj++) {
+    iGrad = iObj*nGrad;
+    for (iDV = 0; iDV < nDV; iDV++){
+      for (iDV_Value = 0; iDV_Value < config->GetnDV_Value(iDV); iDV_Value++){
 
-      Gradient[iDV][iDV_Value] += localGradient;
+        /*--- Angle of Attack design variable (this is different,
+         the value comes form the input file) ---*/
+
+        if ((config->GetDesign_Variable(iDV) == ANGLE_OF_ATTACK) ||
+            (config->GetDesign_Variable(iDV) == FFD_ANGLE_OF_ATTACK))  {
+          Gradient[iObj][iDV][iDV_Value] = separate_objectives? ObjAoA_Sens[iObj] : config->GetAoA_Sens();
+        }
+
+        Gradient[iObj][iDV][iDV_Value] += Total_Gradient[iGrad++];
+      }
     }
   }
 
-  AD::Reset();
-
 }
 
-void OutputGradient(su2double** Gradient, CConfig* config, ofstream& Gradient_file){
+void OutputGradient(su2double** Gradient, CConfig* config, ofstream& Gradient_file, unsigned short val_obj){
 
   unsigned short nDV, iDV, iDV_Value, nDV_Value;
 
@@ -858,7 +1068,7 @@ void OutputGradient(su2double** Gradient, CConfig* config, ofstream& Gradient_fi
       /*--- Print the kind of objective function to screen ---*/
 
       for (std::map<string, ENUM_OBJECTIVE>::const_iterator it = Objective_Map.begin(); it != Objective_Map.end(); ++it ){
-        if (it->second == config->GetKind_ObjFunc()){
+        if (it->second == config->GetKind_ObjFunc(val_obj)){
           cout << it->first << " gradient : ";
           if (iDV == 0) Gradient_file << it->first << " gradient " << endl;
         }
@@ -880,7 +1090,7 @@ void OutputGradient(su2double** Gradient, CConfig* config, ofstream& Gradient_fi
 }
 
 
-void SetSensitivity_Files(CGeometry ***geometry, CConfig **config, unsigned short val_nZone) {
+void SetSensitivity_Files(CGeometry ***geometry, CConfig **config, unsigned short val_nZone, short val_obj) {
 
   unsigned short iMarker,iDim, nDim, nMarker, nVar;
   unsigned long iVertex, iPoint, nPoint, nVertex;
@@ -974,13 +1184,17 @@ void SetSensitivity_Files(CGeometry ***geometry, CConfig **config, unsigned shor
 
     output->Load_Data(geometry[iZone][INST_0], config[iZone], &solver);
 
-    /*--- Set the surface filename ---*/
+    /*--- Set the surface filename (with the extension of the objective if they are separate) ---*/
 
-    output->SetSurface_Filename(config[iZone]->GetSurfSens_FileName());
+    string SurfSens_FileName = config[iZone]->GetSurfSens_FileName();
+    if (val_obj >= 0) SurfSens_FileName = config[iZone]->GetObjFunc_Extension(SurfSens_FileName, val_obj);
+    output->SetSurface_Filename(SurfSens_FileName);
 
     /*--- Set the surface filename ---*/
 
-    output->SetVolume_Filename(config[iZone]->GetVolSens_FileName());
+    string VolSens_FileName = config[iZone]->GetVolSens_FileName();
+    if (val_obj >= 0) VolSens_FileName = config[iZone]->GetObjFunc_Extension(VolSens_FileName, val_obj);
+    output->SetVolume_Filename(VolSens_FileName);
 
     /*--- Write to file ---*/
 
@@ -41,3 +41,21 @@
 #include "../../Common/include/grid_movement_structure.hpp"
 
 using namespace std;
+
+/*!
+ * \brief Gradient of the geometrical functions using Algorithmic Differentiation (AD, reverse mode).
+ * \details The surface deformation (at the current design) and the evaluation of all the functions are recorded once,
+ *          the tape is then evaluated once per function (per group of functions in the vector mode) for all the design
+ *          variables at once, instead of one deformation and evaluation per design variable with finite differences.
+ *          The gradient of a design variable with several values is the derivative along its values scaled by the
+ *          first one, which is the quantity approximated by the finite differences.
+ * \param[in] geometry - Geometrical definition of the problem.
+ * \param[in] config - Definition of the particular problem.
+ * \param[in] surface_movement - Surface movement class of the problem.
+ * \param[in] nPlane - Number of sections.
+ * \param[in] Plane_P0 - Point of the plane of each section.
+ * \param[in] Plane_Normal - Normal of the plane of each section.
+ * \param[out] Gradient - Gradient of each function (in the order of the gradient file) for each design variable (master node).
+ */
+void SetGradient_AD(CGeometry *geometry, CConfig *config, CSurfaceMovement *surface_movement, unsigned short nPlane,
+                    su2double **Plane_P0, su2double **Plane_Normal, vector<vector<passivedouble> >& Gradient);
@@ -402,12 +402,9 @@ int main(int argc, char *argv[]) {
     
   }
   
-  for (iPlane = 0; iPlane < nPlane; iPlane++) {
-    
-    geometry_container[ZONE_0]->ComputeAirfoil_Section(Plane_P0[iPlane], Plane_Normal[iPlane], -1E6, 1E6, -1E6, 1E6, -1E6, 1E6, NULL,
-                                                       Xcoord_Airfoil[iPlane], Ycoord_Airfoil[iPlane], Zcoord_Airfoil[iPlane],
-                                                       Variable_Airfoil[iPlane], true, config_container[ZONE_0]);
-  }
+  geometry_container[ZONE_0]->ComputeAirfoil_Sections(nPlane, Plane_P0, Plane_Normal, -1E6, 1E6, -1E6, 1E6, -1E6, 1E6, NULL,
+                                                      Xcoord_Airfoil, Ycoord_Airfoil, Zcoord_Airfoil,
+                                                      Variable_Airfoil, true, config_container[ZONE_0]);
   
   if (rank == MASTER_NODE)
     cout << endl <<"-------------------- Objective function evaluation ----------------------" << endl;
@@ -600,8 +597,20 @@ int main(int argc, char *argv[]) {
     FFDBox = new CFreeFormDefBox*[MAX_NUMBER_FFD];
     for (iFFDBox = 0; iFFDBox < MAX_NUMBER_FFD; iFFDBox++) FFDBox[iFFDBox] = NULL;
     
+#ifdef CODI_REVERSE_TYPE
+
+    /*--- Gradient of all the functions with respect to all the design variables, recorded once ---*/
+
+    if (rank == MASTER_NODE)
+      cout << endl << endl << "--------- Gradient evaluation using algorithmic differentiation ---------" << endl;
+
+    vector<vector<passivedouble> > Gradient_AD;
+    SetGradient_AD(geometry_container[ZONE_0], config_container[ZONE_0], surface_movement, nPlane,
+                   Plane_P0, Plane_Normal, Gradient_AD);
+#else
     if (rank == MASTER_NODE)
       cout << endl << endl << "------------- Gradient evaluation using finite differences --------------" << endl;
+#endif
     
     /*--- Write the gradient in a external file ---*/
     if (rank == MASTER_NODE) {
@@ -614,6 +623,15 @@ int main(int argc, char *argv[]) {
     }
     
     for (iDV = 0; iDV < config_container[ZONE_0]->GetnDV(); iDV++) {
+
+#ifdef CODI_REVERSE_TYPE
+
+      /*--- The derivatives are already known, only write them ---*/
+
+      if (rank == MASTER_NODE) cout << endl << "Design variable number "<< iDV <<"." << endl;
+      MoveSurface = true;
+
+#else
 			   
       /*--- Free Form deformation based ---*/
       
@@ -842,25 +860,84 @@ int main(int argc, char *argv[]) {
         
         /*--- Create airfoil structure ---*/
         
-        for (iPlane = 0; iPlane < nPlane; iPlane++) {
-          geometry_container[ZONE_0]->ComputeAirfoil_Section(Plane_P0[iPlane], Plane_Normal[iPlane], -1E6, 1E6, -1E6, 1E6, -1E6, 1E6, NULL,
-                                                             Xcoord_Airfoil[iPlane], Ycoord_Airfoil[iPlane], Zcoord_Airfoil[iPlane],
-                                                             Variable_Airfoil[iPlane], false, config_container[ZONE_0]);
-        }
+        geometry_container[ZONE_0]->ComputeAirfoil_Sections(nPlane, Plane_P0, Plane_Normal, -1E6, 1E6, -1E6, 1E6, -1E6, 1E6, NULL,
+                                                            Xcoord_Airfoil, Ycoord_Airfoil, Zcoord_Airfoil,
+                                                            Variable_Airfoil, false, config_container[ZONE_0]);
         
       }
+
+#endif
       
       /*--- Compute gradient ---*/
       
       if (rank == MASTER_NODE) {
-        
+
+#ifndef CODI_REVERSE_TYPE
         delta_eps = config_container[ZONE_0]->GetDV_Value(iDV);
         
         if (delta_eps == 0) {
           SU2_MPI::Error("The finite difference steps is zero!!", CURRENT_FUNCTION);
         }
+#endif
         
         if (MoveSurface) {
+
+#ifdef CODI_REVERSE_TYPE
+
+          /*--- Copy the derivatives, in the order of the gradient file ---*/
+
+          const passivedouble *Gradient_DV = Gradient_AD[iDV].data();
+
+          if (geometry_container[ZONE_0]->GetnDim() == 3) {
+            if (config_container[ZONE_0]->GetGeo_Description() == FUSELAGE) {
+              Fuselage_Volume_Grad            = Gradient_DV[0];
+              Fuselage_WettedArea_Grad        = Gradient_DV[1];
+              Fuselage_MinWidth_Grad          = Gradient_DV[2];
+              Fuselage_MaxWidth_Grad          = Gradient_DV[3];
+              Fuselage_MinWaterLineWidth_Grad = Gradient_DV[4];
+              Fuselage_MaxWaterLineWidth_Grad = Gradient_DV[5];
+              Fuselage_MinHeight_Grad         = Gradient_DV[6];
+              Fuselage_MaxHeight_Grad         = Gradient_DV[7];
+              Fuselage_MaxCurvature_Grad      = Gradient_DV[8];
+              Gradient_DV += 9;
+            }
+            else if (config_container[ZONE_0]->GetGeo_Description() == NACELLE) {
+              Nacelle_Volume_Grad          = Gradient_DV[0];
+              Nacelle_MinThickness_Grad    = Gradient_DV[1];
+              Nacelle_MaxThickness_Grad    = Gradient_DV[2];
+              Nacelle_MinChord_Grad        = Gradient_DV[3];
+              Nacelle_MaxChord_Grad        = Gradient_DV[4];
+              Nacelle_MinLERadius_Grad     = Gradient_DV[5];
+              Nacelle_MaxLERadius_Grad     = Gradient_DV[6];
+              Nacelle_MinToC_Grad          = Gradient_DV[7];
+              Nacelle_MaxToC_Grad          = Gradient_DV[8];
+              Nacelle_ObjFun_MinToC_Grad   = Gradient_DV[9];
+              Nacelle_MaxTwist_Grad        = Gradient_DV[10];
+              Gradient_DV += 11;
+            }
+            else {
+              Wing_Volume_Grad          = Gradient_DV[0];
+              Wing_MinThickness_Grad    = Gradient_DV[1];
+              Wing_MaxThickness_Grad    = Gradient_DV[2];
+              Wing_MinChord_Grad        = Gradient_DV[3];
+              Wing_MaxChord_Grad        = Gradient_DV[4];
+              Wing_MinLERadius_Grad     = Gradient_DV[5];
+              Wing_MaxLERadius_Grad     = Gradient_DV[6];
+              Wing_MinToC_Grad          = Gradient_DV[7];
+              Wing_MaxToC_Grad          = Gradient_DV[8];
+              Wing_ObjFun_MinToC_Grad   = Gradient_DV[9];
+              Wing_MaxTwist_Grad        = Gradient_DV[10];
+              Wing_MaxCurvature_Grad    = Gradient_DV[11];
+              Wing_MaxDihedral_Grad     = Gradient_DV[12];
+              Gradient_DV += 13;
+            }
+          }
+
+          const unsigned short nSectionFunc = (config_container[ZONE_0]->GetGeo_Description() == FUSELAGE)? 5 : 6;
+          for (iVar = 0; iVar < nPlane*nSectionFunc; iVar++)
+            Gradient[iVar] = Gradient_DV[iVar];
+
+#else
           
           if (config_container[ZONE_0]->GetGeo_Description() == FUSELAGE) {
             Fuselage_Volume_Grad = (Fuselage_Volume_New - Fuselage_Volume) / delta_eps;
@@ -971,6 +1048,8 @@ int main(int argc, char *argv[]) {
               
             }
           }
+
+#endif
           
         }
         
@@ -1313,3 +1392,164 @@ int main(int argc, char *argv[]) {
   return EXIT_SUCCESS;
   
 }
+
+void SetGradient_AD(CGeometry *geometry, CConfig *config, CSurfaceMovement *surface_movement, unsigned short nPlane,
+                    su2double **Plane_P0, su2double **Plane_Normal, vector<vector<passivedouble> >& Gradient) {
+
+  unsigned short iDV, iDV_Value, nDV_Value, iPlane, iDir, nSeed;
+  unsigned long iFunc, iGrad;
+
+  const int rank = SU2_MPI::GetRank();
+  const unsigned short nDV = config->GetnDV();
+  const unsigned short nDir = SU2_TYPE::GetnDirections();
+  const bool fuselage = (config->GetGeo_Description() == FUSELAGE);
+
+  /*--- Scale of the values of each design variable (see the finite differences, the step is the first value) ---*/
+
+  vector<vector<passivedouble> > DV_Scale(nDV);
+
+  for (iDV = 0; iDV < nDV; iDV++) {
+    nDV_Value = config->GetnDV_Value(iDV);
+    DV_Scale[iDV].resize(nDV_Value, 1.0);
+    if (nDV_Value > 1) {
+      const passivedouble First_Value = SU2_TYPE::GetValue(config->GetDV_Value(iDV, 0));
+      if (First_Value == 0.0) {
+        SU2_MPI::Error("The finite difference steps is zero!!", CURRENT_FUNCTION);
+      }
+      for (iDV_Value = 0; iDV_Value < nDV_Value; iDV_Value++)
+        DV_Scale[iDV][iDV_Value] = SU2_TYPE::GetValue(config->GetDV_Value(iDV, iDV_Value)) / First_Value;
+    }
+  }
+
+  /*--- Start recording of operations ---*/
+
+  AD::StartRecording();
+
+  /*--- Register design variables as input and set them to zero
+   (since we want to have the derivative at the current design) ---*/
+
+  for (iDV = 0; iDV < nDV; iDV++) {
+    for (iDV_Value = 0; iDV_Value < config->GetnDV_Value(iDV); iDV_Value++) {
+      su2double DV_Value = 0.0;
+      AD::RegisterInput(DV_Value);
+      config->SetDV_Value(iDV, iDV_Value, DV_Value);
+    }
+  }
+
+  /*--- Call the surface deformation routine ---*/
+
+  surface_movement->SetSurface_Deformation(geometry, config);
+
+  /*--- Evaluate the functions of the deformed surface, in the order of the gradient file ---*/
+
+  vector<su2double> Functions;
+
+  if (geometry->GetnDim() == 3) {
+    su2double Value[13] = {0.0};
+    if (fuselage) {
+      geometry->Compute_Fuselage(config, false, Value[0], Value[1], Value[2], Value[3], Value[4],
+                                 Value[5], Value[6], Value[7], Value[8]);
+      Functions.assign(Value, Value+9);
+    }
+    else if (config->GetGeo_Description() == NACELLE) {
+      geometry->Compute_Nacelle(config, false, Value[0], Value[1], Value[2], Value[3], Value[4], Value[5],
+                                Value[6], Value[7], Value[8], Value[9], Value[10]);
+      Functions.assign(Value, Value+11);
+    }
+    else {
+      geometry->Compute_Wing(config, false, Value[0], Value[1], Value[2], Value[3], Value[4], Value[5],
+                             Value[6], Value[7], Value[8], Value[9], Value[10], Value[11], Value[12]);
+      Functions.assign(Value, Value+13);
+    }
+  }
+
+  vector<vector<su2double> > Xcoord_Airfoil(nPlane), Ycoord_Airfoil(nPlane), Zcoord_Airfoil(nPlane), Variable_Airfoil(nPlane);
+
+  geometry->ComputeAirfoil_Sections(nPlane, Plane_P0, Plane_Normal, -1E6, 1E6, -1E6, 1E6, -1E6, 1E6, NULL,
+                                    Xcoord_Airfoil.data(), Ycoord_Airfoil.data(), Zcoord_Airfoil.data(),
+                                    Variable_Airfoil.data(), false, config);
+
+  /*--- The functions of the sections are grouped by kind, the sections are only known by the master node ---*/
+
+  const unsigned long nGlobalFunc = Functions.size();
+  Functions.resize(nGlobalFunc + (fuselage? 5 : 6)*nPlane, 0.0);
+  su2double *Section = &Functions[nGlobalFunc];
+
+  for (iPlane = 0; iPlane < nPlane; iPlane++) {
+    if (Xcoord_Airfoil[iPlane].size() > 1) {
+      vector<su2double> &Xcoord = Xcoord_Airfoil[iPlane], &Ycoord = Ycoord_Airfoil[iPlane], &Zcoord = Zcoord_Airfoil[iPlane];
+      if (fuselage) {
+        Section[0*nPlane + iPlane] = geometry->Compute_Area(Plane_P0[iPlane], Plane_Normal[iPlane], config, Xcoord, Ycoord, Zcoord);
+        Section[1*nPlane + iPlane] = geometry->Compute_Length(Plane_P0[iPlane], Plane_Normal[iPlane], config, Xcoord, Ycoord, Zcoord);
+        Section[2*nPlane + iPlane] = geometry->Compute_Width(Plane_P0[iPlane], Plane_Normal[iPlane], Xcoord, Ycoord, Zcoord);
+        Section[3*nPlane + iPlane] = geometry->Compute_WaterLineWidth(Plane_P0[iPlane], Plane_Normal[iPlane], config, Xcoord, Ycoord, Zcoord);
+        Section[4*nPlane + iPlane] = geometry->Compute_Height(Plane_P0[iPlane], Plane_Normal[iPlane], Xcoord, Ycoord, Zcoord);
+      }
+      else {
+        Section[0*nPlane + iPlane] = geometry->Compute_Area(Plane_P0[iPlane], Plane_Normal[iPlane], config, Xcoord, Ycoord, Zcoord);
+        Section[1*nPlane + iPlane] = geometry->Compute_MaxThickness(Plane_P0[iPlane], Plane_Normal[iPlane], config, Xcoord, Ycoord, Zcoord);
+        Section[2*nPlane + iPlane] = geometry->Compute_Chord(Plane_P0[iPlane], Plane_Normal[iPlane], Xcoord, Ycoord, Zcoord);
+        Section[3*nPlane + iPlane] = geometry->Compute_LERadius(Plane_P0[iPlane], Plane_Normal[iPlane], Xcoord, Ycoord, Zcoord);
+        Section[4*nPlane + iPlane] = Section[1*nPlane + iPlane] / Section[2*nPlane + iPlane];
+        Section[5*nPlane + iPlane] = geometry->Compute_Twist(Plane_P0[iPlane], Plane_Normal[iPlane], Xcoord, Ycoord, Zcoord);
+      }
+    }
+  }
+
+  for (iFunc = 0; iFunc < Functions.size(); iFunc++)
+    AD::RegisterOutput(Functions[iFunc]);
+
+  /*--- Stop the recording --- */
+
+  AD::StopRecording();
+
+  if (rank == MASTER_NODE)
+    cout << "Evaluate the tape for " << Functions.size() << " functions (" << nDir << " per evaluation)." << endl;
+
+  /*--- Each evaluation of the tape gives the derivatives of nDir functions with respect to all the design variables ---*/
+
+  const unsigned long nFunc = Functions.size();
+  vector<passivedouble> Local_Gradient(nDV*nFunc, 0.0), Total_Gradient(nDV*nFunc, 0.0);
+
+  for (iFunc = 0; iFunc < nFunc; iFunc += nDir) {
+
+    nSeed = min<unsigned long>(nDir, nFunc-iFunc);
+
+    AD::ClearAdjoints();
+
+    if (rank == MASTER_NODE) {
+      for (iDir = 0; iDir < nSeed; iDir++)
+        SU2_TYPE::SetDerivative(Functions[iFunc+iDir], iDir, 1.0);
+    }
+
+    AD::ComputeAdjoint();
+
+    for (iDir = 0; iDir < nSeed; iDir++) {
+      AD::SetDirection(iDir);
+      for (iDV = 0; iDV < nDV; iDV++) {
+        for (iDV_Value = 0; iDV_Value < config->GetnDV_Value(iDV); iDV_Value++) {
+          const su2double DV_Value = config->GetDV_Value(iDV, iDV_Value);
+          Local_Gradient[iDV*nFunc + iFunc+iDir] += SU2_TYPE::GetDerivative(DV_Value, iDir) * DV_Scale[iDV][iDV_Value];
+        }
+      }
+    }
+  }
+
+  AD::SetDirection(0);
+  AD::Reset();
+
+  /*--- Sum the contributions of the ranks ---*/
+
+#ifdef HAVE_MPI
+  SelectMPIWrapper<passivedouble>::W::Reduce(Local_Gradient.data(), Total_Gradient.data(), Local_Gradient.size(),
+                                             MPI_DOUBLE, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
+#else
+  Total_Gradient = Local_Gradient;
+#endif
+
+  Gradient.assign(nDV, vector<passivedouble>(nFunc, 0.0));
+  for (iDV = 0; iDV < nDV; iDV++)
+    for (iGrad = 0; iGrad < nFunc; iGrad++)
+      Gradient[iDV][iGrad] = Total_Gradient[iDV*nFunc + iGrad];
+
+}
@@ -160,8 +160,24 @@ int main(int argc, char *argv[]) {
   /*--- Create the point-to-point MPI communication structures. ---*/
   
   geometry_container[ZONE_0]->PreprocessP2PComms(geometry_container[ZONE_0], config_container[ZONE_0]);
-	
-	if ((config_container[ZONE_0]->GetKind_Adaptation() != NONE) && (config_container[ZONE_0]->GetKind_Adaptation() != PERIODIC)) {
+
+  if (config_container[ZONE_0]->GetParallel_Adaptation() && (config_container[ZONE_0]->GetKind_Adaptation() != NONE)) {
+
+    if (rank == MASTER_NODE)
+      cout << endl <<"----------------- Start parallel numerical grid adaptation --------------" << endl;
+
+    /*--- Refine the partitioned grid, each rank divides its elements and the grid is written in parallel. ---*/
+
+    CParallelGridAdaptation parallel_adaptation(geometry_container[ZONE_0], config_container[ZONE_0]);
+
+    parallel_adaptation.SetMarking(geometry_container[ZONE_0], config_container[ZONE_0]);
+    parallel_adaptation.SetEdgeSplitting(geometry_container[ZONE_0]);
+    parallel_adaptation.SetRefinement(geometry_container[ZONE_0], config_container[ZONE_0]);
+    parallel_adaptation.WriteMesh(geometry_container[ZONE_0], config_container[ZONE_0],
+                                  config_container[ZONE_0]->GetMesh_Out_FileName());
+
+  }
+	else if ((config_container[ZONE_0]->GetKind_Adaptation() != NONE) && (config_container[ZONE_0]->GetKind_Adaptation() != PERIODIC)) {
 		
 		cout << endl <<"--------------------- Start numerical grid adaptation -------------------" << endl;
 		
@@ -1117,17 +1117,21 @@ def directdiff( config, state=None ):
     with redirect_folder('DIRECTDIFF',pull,link) as push:
         with redirect_output(log_directdiff):
 
-            # iterate each dv
-            for i_dv in range(n_dv):
+            # iterate the dvs, in groups if SU2_CFD_DIRECTDIFF was compiled with several directions
+            n_dir = int(konfig.get('DIRECT_DIFF_DIRECTIONS', 1))
+            for i_run in range(0, n_dv, n_dir):
+
+                run_dvs = list(range(i_run, min(i_run + n_dir, n_dv)))
 
-                temp_config_name = 'config_DIRECTDIFF_%i.cfg' % i_dv
+                temp_config_name = 'config_DIRECTDIFF_%i.cfg' % i_run
 
                 this_konfig = copy.deepcopy(konfig)
 
                 this_dvs = [0.0]*n_dv
-                this_dvs[i_dv] = 1.0
                 this_dvs_old = [0.0]*n_dv
-                this_dvs_old[i_dv] = 1.0
+                for i_dv in run_dvs:
+                    this_dvs[i_dv] = 1.0
+                    this_dvs_old[i_dv] = 1.0
                 this_state = su2io.State()
                 this_state.FILES = copy.deepcopy( state.FILES )
                 this_konfig.unpack_dvs(this_dvs, this_dvs_old)
@@ -1138,19 +1142,21 @@ def directdiff( config, state=None ):
                 func_step = function( 'ALL', this_konfig, this_state )
 
                 # delete keys not returned by the solver
-                for key in grads.keys():
+                for key in list(grads.keys()):
                     if key == 'VARIABLE':
                         pass
                     elif not 'D_' + key in func_step:
                         del grads[key]
 
-                # store
-                for key in grads.keys():
-                    if key == 'VARIABLE':
-                        grads[key].append(i_dv)
-                    else:
-                        this_grad = func_step['D_' + key]
-                        grads[key].append(this_grad)
+                # store, the j-th dv of the run is the j-th direction (D_, D1_, ...)
+                for i_dir, i_dv in enumerate(run_dvs):
+                    for key in grads.keys():
+                        if key == 'VARIABLE':
+                            grads[key].append(i_dv)
+                        elif i_dir == 0:
+                            grads[key].append(func_step['D_' + key])
+                        else:
+                            grads[key].append(func_step['D%i_%s' % (i_dir, key)])
                 #: for each grad name
 
                 su2util.write_plot(grad_filename,output_format,grads)
@@ -345,6 +345,18 @@ def read_aerodynamics( History_filename , nZones = 1, special_cases=[], final_av
                 raise KeyError('Key ' + historyOutFields[key]['HEADER'] + ' was not found in history output.')
             Func_Values[key] = value[-1]
 
+    # further derivative directions of the vector forward mode, e.g. header d1[CD] for D1_DRAG
+    for this_objfun in list(Func_Values.keys()):
+        if historyOutFields[this_objfun]['TYPE'] != 'D_COEFFICIENT':
+            continue
+        header = historyOutFields[this_objfun]['HEADER']
+        if 'TIME_MARCHING' in special_cases:
+            header = historyOutFields['TAVG_' + this_objfun]['HEADER']
+        i_dir = 1
+        while ('d%i' % i_dir + header[1:]) in history_data:
+            Func_Values['D%i_%s' % (i_dir, this_objfun[2:])] = history_data['d%i' % i_dir + header[1:]][-1]
+            i_dir += 1
+
     return Func_Values
 
 #: def read_aerodynamics()
@@ -16,4 +16,6 @@ from .projection import projection
 from .deform     import deform
 from .geometry   import geometry
 from .adaptation import adaptation
-from .merge      import merge
\ No newline at end of file
+from .merge      import merge
+from .scheduler  import scheduler
+from .server     import server
\ No newline at end of file
@@ -68,6 +68,10 @@ return_code_map = {
     1 : EvaluationFailure ,
     2 : DivergenceFailure ,
 }
+
+# communicator of the evaluation packed into this process by SU2.run.scheduler,
+# SU2_CFD then runs in-process on it and the other executables run serially
+job_comm = None
     
 # ------------------------------------------------------------
 #  SU2 Suite Interface Functions
@@ -108,6 +112,11 @@ def CFD(config):
     
         the_Command = 'SU2_CFD%s %s' % (quote, tempname)
 
+    # packed evaluation, use the python wrapper on the processes of the job
+    if job_comm is not None and not direct_diff:
+        run_driver( tempname, konfig, auto_diff )
+        return
+
     the_Command = build_command( the_Command, processes )
     run_command( the_Command )
     
@@ -196,6 +205,9 @@ def GEO(config):
         forced to run in serial
     """    
     konfig = copy.deepcopy(config)
+
+    # the gradients are computed by algorithmic differentiation with SU2_GEO_AD
+    auto_diff = konfig.get('AUTO_DIFF','NO') == 'YES'
     
     tempname = 'config_GEO.cfg'
     konfig.dump(tempname)   
@@ -203,7 +215,10 @@ def GEO(config):
     # must run with rank 1
     processes = konfig['NUMBER_PART']
         
-    the_Command = 'SU2_GEO%s %s' % (quote, tempname)
+    if auto_diff:
+        the_Command = 'SU2_GEO_AD%s %s' % (quote, tempname)
+    else:
+        the_Command = 'SU2_GEO%s %s' % (quote, tempname)
     the_Command = build_command( the_Command , processes )
     run_command( the_Command )
     
@@ -261,6 +276,9 @@ def SOL_FSI(config):
 def build_command( the_Command , processes=0 ):
     """ builds an mpi command for given number of processes """
     the_Command = quote + (base_Command % the_Command)
+    # packed evaluations cannot launch mpi jobs, see run_command
+    if job_comm is not None:
+        processes = 1
     if processes > 1:
         if not mpi_Command:
             raise RuntimeError('could not find an mpi interface')
@@ -268,6 +286,66 @@ def build_command( the_Command , processes=0 ):
     return the_Command
 
 def run_command( Command ):
+    """ runs os command with subprocess
+        checks for errors from command
+        in a packed evaluation (see SU2.run.scheduler) the first
+        process of the job runs the command, the others wait
+    """
+
+    if job_comm is not None:
+        # all processes are done writing the input files
+        job_comm.Barrier()
+        error = None
+        if job_comm.Get_rank() == 0:
+            try:
+                _run_command( Command )
+            except Exception as exception:
+                error = exception
+        error = job_comm.bcast(error, root=0)
+        if error is not None:
+            raise error
+        return 0
+
+    return _run_command( Command )
+
+def run_driver( config_filename, konfig, auto_diff=False ):
+    """ runs SU2_CFD in-process through the python wrapper,
+        on the processes of the packed evaluation (job_comm)
+    """
+
+    if auto_diff:
+        import pysu2ad as pysu2
+    else:
+        import pysu2
+
+    multizone = konfig.get('MULTIZONE','NO') == 'YES'
+
+    # all processes are done writing the config file
+    job_comm.Barrier()
+
+    if multizone:
+        zones = konfig.get('CONFIG_LIST','')
+        if not isinstance(zones,list):
+            zones = zones.strip('()').split(',')
+        nZone = len([zone for zone in zones if zone.strip()]) or 1
+        if auto_diff:
+            raise RuntimeError('Packed evaluations of multizone discrete adjoints are not supported.')
+        driver = pysu2.CMultizoneDriver(config_filename, nZone, job_comm)
+    elif auto_diff:
+        driver = pysu2.CDiscAdjSinglezoneDriver(config_filename, 1, job_comm)
+    else:
+        driver = pysu2.CSinglezoneDriver(config_filename, 1, job_comm)
+
+    driver.StartSolver()
+    driver.Postprocessing()
+    del driver
+
+    sys.stdout.flush()
+    job_comm.Barrier()
+
+    return
+
+def _run_command( Command ):
     """ runs os command with subprocess
         checks for errors from command
     """
@@ -0,0 +1,242 @@
+#!/usr/bin/env python
+
+## \file scheduler.py
+#  \brief Packs independent evaluations into groups of processes of one MPI allocation
+#  \author SU2 Contributors
+#  \version 7.0.3 "Blackbird"
+#
+# SU2 Project Website: https://su2code.github.io
+#
+# The SU2 Project is maintained by the SU2 Foundation
+# (http://su2foundation.org)
+#
+# Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+#
+# SU2 is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# SU2 is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+
+# ----------------------------------------------------------------------
+#  Imports
+# ----------------------------------------------------------------------
+
+import os, sys, traceback
+import numpy as np
+from . import interface
+
+# ----------------------------------------------------------------------
+#  Job Scheduler
+# ----------------------------------------------------------------------
+
+class scheduler(object):
+    """ sched = SU2.run.scheduler(procs_per_job,comm=None)
+        results = sched.map(function,inputs,folder=None,log=None)
+
+        Runs independent evaluations (finite difference steps, polar points,
+        multipoint primals and adjoints, ...) concurrently, in groups of
+        procs_per_job processes of one MPI allocation (launched once, e.g.
+        mpirun -n 64 python script.py). Within an evaluation SU2.run.CFD
+        runs SU2_CFD in-process through the python wrapper (pysu2, or pysu2ad
+        for discrete adjoints) on the communicator of the group, instead of
+        starting a new mpirun. The other executables (SU2_DEF, SU2_DOT, ...)
+        are run serially by the first process of the group.
+
+        The evaluations are distributed dynamically, each group takes the
+        next one as soon as it is done with the previous one, so the whole
+        allocation is kept busy when the evaluations have different costs.
+
+        Inputs:
+            procs_per_job - number of processes of each evaluation, the
+                            processes that do not fill a group stay idle
+            comm          - mpi4py communicator of the allocation, by
+                            default MPI.COMM_WORLD
+
+        Example:
+            sched = SU2.run.scheduler(8)
+            def polar_point(aoa):
+                konfig = copy.deepcopy(config)
+                konfig.AOA = aoa
+                return SU2.run.direct(konfig)
+            results = sched.map(polar_point, [0.0,2.0,4.0], folder='AOA_%i')
+
+        Notes:
+            All the processes of the allocation must call map() with the
+            same inputs. An error of SU2 itself (SU2_MPI::Error) aborts
+            the entire allocation.
+    """
+
+    def __init__(self, procs_per_job, comm=None):
+
+        from mpi4py import MPI
+        if comm is None:
+            comm = MPI.COMM_WORLD
+
+        size = comm.Get_size()
+        rank = comm.Get_rank()
+
+        procs_per_job = max(1, min(int(procs_per_job), size))
+        n_groups = size // procs_per_job
+        group = rank // procs_per_job
+
+        # processes that do not fill a group are not part of any group
+        color = group if group < n_groups else MPI.UNDEFINED
+        job_comm = comm.Split(color, rank)
+
+        # shared counter of the next evaluation, held by the first process
+        itemsize = np.dtype('l').itemsize
+        counter_win = MPI.Win.Allocate(itemsize if rank == 0 else 0, itemsize, comm=comm)
+
+        self.MPI           = MPI
+        self.comm          = comm
+        self.rank          = rank
+        self.n_groups      = n_groups
+        self.procs_per_job = procs_per_job
+        self.job_comm      = job_comm if job_comm != MPI.COMM_NULL else None
+        self.counter_win   = counter_win
+
+        return
+
+    def __del__(self):
+        try:
+            self.counter_win.Free()
+            if self.job_comm is not None:
+                self.job_comm.Free()
+        except Exception:
+            pass
+
+    def map(self, function, inputs, folder=None, log=None):
+        """ results = sched.map(function,inputs,folder=None,log=None)
+
+            Evaluates function(input) for each input, on the group of
+            processes that takes it.
+
+            Inputs:
+                function - evaluation, called by all the processes of a group
+                inputs   - list of inputs of the evaluations
+                folder   - optional working folder of each evaluation, a
+                           pattern formatted with the index of the input,
+                           e.g. 'POINT_%03i', created if needed
+                log      - optional file (in the working folder) receiving
+                           the screen output of the evaluation, including
+                           the output of SU2 itself
+
+            Outputs:
+                results - list of the values returned by the evaluations
+                          (by the first process of each group), in the
+                          order of the inputs, an evaluation that raised
+                          an exception returns that exception
+        """
+
+        MPI = self.MPI
+        n_inputs = len(inputs)
+
+        # reset the counter of the next evaluation
+        if self.rank == 0:
+            self.counter_win.Lock(0, MPI.LOCK_EXCLUSIVE)
+            self.counter_win.Put(np.zeros(1, 'l'), 0)
+            self.counter_win.Unlock(0)
+        self.comm.Barrier()
+
+        local_results = []
+
+        if self.job_comm is not None:
+            while True:
+                index = self._next_index()
+                if index >= n_inputs: break
+
+                this_folder = (folder % index) if folder else None
+                result = self._evaluate(function, inputs[index], this_folder, log)
+
+                if self.job_comm.Get_rank() == 0:
+                    local_results.append( (index, result) )
+
+        # the results are known by the first process of each group
+        results = [None]*n_inputs
+        for group_results in self.comm.allgather(local_results):
+            for index, result in group_results:
+                results[index] = result
+
+        return results
+
+    def _next_index(self):
+        """ atomically takes the index of the next evaluation for this group """
+
+        MPI = self.MPI
+        index = None
+        if self.job_comm.Get_rank() == 0:
+            one = np.ones(1, 'l')
+            value = np.zeros(1, 'l')
+            self.counter_win.Lock(0, MPI.LOCK_SHARED)
+            self.counter_win.Fetch_and_op(one, value, 0, 0, MPI.SUM)
+            self.counter_win.Unlock(0)
+            index = int(value[0])
+        return self.job_comm.bcast(index, root=0)
+
+    def _evaluate(self, function, this_input, folder, log):
+        """ runs one evaluation on the processes of this group """
+
+        job_comm = self.job_comm
+        origin = os.getcwd()
+
+        # the first process creates the working folder
+        if folder:
+            if job_comm.Get_rank() == 0 and not os.path.exists(folder):
+                os.makedirs(folder)
+            job_comm.Barrier()
+            os.chdir(folder)
+
+        interface.job_comm = job_comm
+        try:
+            with redirect_fd(log):
+                result = function(this_input)
+        except Exception as exception:
+            sys.stderr.write('Packed evaluation failed:\n%s\n' % traceback.format_exc())
+            result = exception
+        finally:
+            interface.job_comm = None
+            os.chdir(origin)
+
+        return result
+
+#: class scheduler()
+
+
+# ----------------------------------------------------------------------
+#  Output Redirection
+# ----------------------------------------------------------------------
+
+class redirect_fd(object):
+    """ with redirect_fd(filename)
+
+        Redirects the standard output of the process, at the level of the
+        file descriptor such that the output of the wrapped SU2 follows,
+        None does not redirect.
+    """
+
+    def __init__(self, filename=None):
+        self.filename = filename
+
+    def __enter__(self):
+        if self.filename is None: return
+        sys.stdout.flush()
+        self.saved_fd = os.dup(1)
+        self.log = open(self.filename, 'a')
+        os.dup2(self.log.fileno(), 1)
+
+    def __exit__(self, exc_type, exc_value, traceback):
+        if self.filename is None: return
+        sys.stdout.flush()
+        os.dup2(self.saved_fd, 1)
+        os.close(self.saved_fd)
+        self.log.close()
+
+#: class redirect_fd()
@@ -0,0 +1,247 @@
+#!/usr/bin/env python
+
+## \file server.py
+#  \brief Long-lived SU2_CFD process evaluating many cases, reusing the driver when only the freestream angles change
+#  \author SU2 Contributors
+#  \version 7.0.3 "Blackbird"
+#
+# SU2 Project Website: https://su2code.github.io
+#
+# The SU2 Project is maintained by the SU2 Foundation
+# (http://su2foundation.org)
+#
+# Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+#
+# SU2 is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# SU2 is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+
+# ----------------------------------------------------------------------
+#  Imports
+# ----------------------------------------------------------------------
+
+import os, sys, copy, traceback
+from ..io import Config
+
+# options applied to the driver in memory, the other options need a new driver
+_in_memory_options = ['AOA', 'SIDESLIP_ANGLE']
+
+# ----------------------------------------------------------------------
+#  SU2_CFD Server
+# ----------------------------------------------------------------------
+
+class server(object):
+    """ srv = SU2.run.server(comm=None)
+        values = srv.evaluate(config,options=None)
+        srv.serve(address,authkey)
+
+        Evaluates many (small) cases with SU2_CFD, in-process through the
+        python wrapper (pysu2), on processes that are started, and have
+        initialized MPI and imported SU2, only once.
+
+        The driver of the previous case is kept. If the next case has the
+        same options, and the same grid file (name and modification time),
+        except for the angles of the freestream (AOA, SIDESLIP_ANGLE), the
+        angles are set in memory and the solution is reset to the initial
+        one of the driver. The geometry (partitioning, dual grid,
+        multigrid), the solver containers, the sparsity pattern of the
+        Jacobians and the linear solvers are then reused. Otherwise the
+        driver is replaced by one of the new case.
+
+        Inputs:
+            comm - mpi4py communicator of the server, by default
+                   MPI.COMM_WORLD
+
+        Example, on the processes of the server:
+            srv = SU2.run.server()
+            srv.serve(('localhost',6000), b'secret')
+
+        and in the client:
+            from multiprocessing.connection import Client
+            conn = Client(('localhost',6000), authkey=b'secret')
+            for aoa in [0.0,2.0,4.0]:
+                conn.send({'config': 'inv_NACA0012.cfg', 'options': {'AOA': aoa}})
+                values = conn.recv()   # history output, e.g. values['LIFT']
+            conn.send(None)            # stops the server
+
+        Notes:
+            The solution of a reused driver starts from the free-stream of
+            the first case of the driver. Discrete adjoints are not served.
+            An error of SU2 itself (SU2_MPI::Error) aborts all the processes
+            of the server.
+    """
+
+    def __init__(self, comm=None):
+
+        from mpi4py import MPI
+        if comm is None:
+            comm = MPI.COMM_WORLD
+
+        self.comm   = comm
+        self.rank   = comm.Get_rank()
+        self.driver = None
+        self.key    = None
+        self.state  = None
+
+        return
+
+    def __del__(self):
+        try:
+            self.close()
+        except Exception:
+            pass
+
+    def close(self):
+        """ srv.close()
+
+            Postprocesses and deletes the driver of the last case.
+        """
+        if self.driver is not None:
+            self.driver.Postprocessing()
+            self.driver = None
+            sys.stdout.flush()
+            self.comm.Barrier()
+        self.key = None
+        self.state = None
+
+    def evaluate(self, config, options=None):
+        """ values = srv.evaluate(config,options=None)
+
+            Runs one case, called by all the processes of the server.
+
+            Inputs:
+                config  - SU2.io.Config, or name of the config file
+                options - optional dictionary of options changed from
+                          the config, e.g. {'AOA': 2.0, 'MACH_NUMBER': 0.5}
+
+            Outputs:
+                values - dictionary of the history output fields of the
+                         last iteration (e.g. 'LIFT', 'DRAG', 'RMS_DENSITY')
+        """
+
+        if not isinstance(config, Config):
+            config = Config(config)
+        konfig = copy.deepcopy(config)
+        if options:
+            konfig.update(options)
+
+        if konfig.get('MATH_PROBLEM','DIRECT') != 'DIRECT':
+            raise RuntimeError('Only direct problems can be evaluated by the server.')
+
+        # the driver is reused if the rest of the case is the same
+        key = copy.deepcopy(konfig)
+        for option in _in_memory_options:
+            key.pop(option, None)
+        mesh_filename = konfig.get('MESH_FILENAME','')
+        if os.path.exists(mesh_filename):
+            key['MESH_FILENAME'] = (mesh_filename, os.path.getmtime(mesh_filename))
+
+        if self.driver is not None and key == self.key:
+            if 'AOA' in konfig:
+                self.driver.SetAngleOfAttack(float(konfig.AOA))
+            if 'SIDESLIP_ANGLE' in konfig:
+                self.driver.SetSideslipAngle(float(konfig.SIDESLIP_ANGLE))
+            self.driver.RestoreSolverState(self.state)
+        else:
+            self.close()
+            self.driver = self._new_driver(konfig)
+            self.key = key
+            self.state = self.driver.SaveSolverState()
+
+        self.driver.StartSolver()
+        sys.stdout.flush()
+
+        return dict(self.driver.GetHistoryOutputValues())
+
+    def serve(self, address, authkey=None):
+        """ srv.serve(address,authkey=None)
+
+            Evaluates the cases sent to the first process of the server,
+            through a multiprocessing.connection (see the example of the
+            class), until a client sends None.
+
+            Inputs:
+                address - address of the listener, e.g. ('localhost',6000)
+                authkey - optional key (bytes) the clients must provide
+
+            Each request is a dictionary with the 'config' (SU2.io.Config
+            or file name) and the optional 'options' of evaluate, the reply
+            is the dictionary of the history output, or the exception of a
+            failed evaluation.
+        """
+
+        listener = None
+        if self.rank == 0:
+            from multiprocessing.connection import Listener
+            listener = Listener(address, authkey=authkey)
+
+        try:
+            while True:
+                conn = listener.accept() if self.rank == 0 else None
+                if self._serve_connection(conn):
+                    break
+        finally:
+            if listener is not None:
+                listener.close()
+            self.close()
+
+        return
+
+    def _serve_connection(self, conn):
+        """ evaluates the requests of one client, returns True if the server must stop """
+
+        while True:
+            request = None
+            if self.rank == 0:
+                try:
+                    request = conn.recv()
+                except EOFError:
+                    request = 'disconnected'
+            request = self.comm.bcast(request, root=0)
+
+            if request is None or request == 'disconnected':
+                if self.rank == 0:
+                    conn.close()
+                return request is None
+
+            try:
+                result = self.evaluate(request['config'], request.get('options',None))
+            except Exception as exception:
+                sys.stderr.write('Served evaluation failed:\n%s\n' % traceback.format_exc())
+                result = exception
+                # the state of the driver is unknown
+                self.driver = None
+                self.key = None
+
+            if self.rank == 0:
+                conn.send(result)
+
+    def _new_driver(self, konfig):
+        """ writes the config of the case and builds its driver """
+
+        import pysu2
+
+        config_filename = 'config_CFD_server.cfg'
+        if self.rank == 0:
+            konfig.dump(config_filename)
+        self.comm.Barrier()
+
+        if konfig.get('MULTIZONE','NO') == 'YES':
+            zones = konfig.get('CONFIG_LIST','')
+            if not isinstance(zones,list):
+                zones = zones.strip('()').split(',')
+            nZone = len([zone for zone in zones if zone.strip()]) or 1
+            return pysu2.CMultizoneDriver(config_filename, nZone, self.comm)
+
+        return pysu2.CSinglezoneDriver(config_filename, 1, self.comm)
+
+#: class server()
@@ -42,6 +42,8 @@ def main():
                       help="under relaxation factor", metavar="UQ_URLX")
     parser.add_option("-b", "--deltaB", dest="uq_delta_b", default=1.0,
                       help="magnitude of perturbation", metavar="UQ_DELTA_B")
+    parser.add_option("-e", "--ensemble", dest="ensemble", default=False, action="store_true",
+                      help="solve the five perturbations in one run, sharing the geometry (UQ_ENSEMBLE)")
 
     (options, args)=parser.parse_args()
     options.partitions = int( options.partitions )
@@ -63,6 +65,15 @@ def main():
     config.UQ_URLX = options.urlx
     config.UQ_PERMUTE = 'NO'
 
+    # all the perturbations in one run, the files of member i have the suffix _i
+    # (1c, 2c, 3c, p1c1, p1c2 in this order)
+    if options.ensemble:
+        konfig = copy.deepcopy(config)
+        konfig.UQ_ENSEMBLE = 'YES'
+        info = SU2.run.CFD(konfig)
+        state.update(info)
+        return
+
 
     # perform eigenvalue perturbations
     for comp in range(1,4):
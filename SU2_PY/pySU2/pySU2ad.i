@@ -59,12 +59,46 @@ threads="1"
   %mpi4py_typemap(Comm, MPI_Comm)
 #endif
 
+// ----------- BULK ARRAYS ----------------
+// The bulk accessors of the markers read or write, in place, any C-contiguous buffer of doubles
+// (numpy arrays, array.array, ...) through the buffer protocol, without copies or per-vertex calls.
+%typemap(in) (passivedouble* values, unsigned long nValues) (Py_buffer view) {
+  view.obj = NULL;
+  if (PyObject_GetBuffer($input, &view, PyBUF_WRITABLE | PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) != 0) SWIG_fail;
+  if ((view.itemsize != sizeof(passivedouble)) || (view.format == NULL) ||
+      (view.format[strlen(view.format)-1] != 'd')) {
+    PyErr_SetString(PyExc_TypeError, "A writable contiguous array of doubles is expected.");
+    SWIG_fail;
+  }
+  $1 = static_cast<passivedouble*>(view.buf);
+  $2 = view.len/sizeof(passivedouble);
+}
+%typemap(freearg) (passivedouble* values, unsigned long nValues) {
+  if (view$argnum.obj != NULL) PyBuffer_Release(&view$argnum);
+}
+
+%typemap(in) (const passivedouble* values, unsigned long nValues) (Py_buffer view) {
+  view.obj = NULL;
+  if (PyObject_GetBuffer($input, &view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) != 0) SWIG_fail;
+  if ((view.itemsize != sizeof(passivedouble)) || (view.format == NULL) ||
+      (view.format[strlen(view.format)-1] != 'd')) {
+    PyErr_SetString(PyExc_TypeError, "A contiguous array of doubles is expected.");
+    SWIG_fail;
+  }
+  $1 = static_cast<const passivedouble*>(view.buf);
+  $2 = view.len/sizeof(passivedouble);
+}
+%typemap(freearg) (const passivedouble* values, unsigned long nValues) {
+  if (view$argnum.obj != NULL) PyBuffer_Release(&view$argnum);
+}
+
 namespace std {
    %template() vector<int>;
    %template() vector<double>;
    %template() vector<string>;
    %template() map<string, int>;
    %template() map<string, string>;
+   %template() map<string, double>;
 }
 
 // ----------- API CLASSES ----------------
@@ -86,6 +120,11 @@ const unsigned int MESH_0 = 0; /*!< \brief Definition of the finest grid level.
 const unsigned int MESH_1 = 1; /*!< \brief Definition of the finest grid level. */
 const unsigned int ZONE_0 = 0; /*!< \brief Definition of the first grid domain. */
 const unsigned int ZONE_1 = 1; /*!< \brief Definition of the first grid domain. */
+const unsigned int FLOW_SOL = 0; /*!< \brief Position of the mean flow solution in the solver container array. */
+const unsigned int TURB_SOL = 2; /*!< \brief Position of the turbulence model solution in the solver container array. */
+const unsigned int HEAT_SOL = 5; /*!< \brief Position of the heat equation in the solution solver array. */
+const unsigned int MESH_SOL = 9; /*!< \brief Position of the mesh solver. */
+const unsigned int FEA_SOL = 0;  /*!< \brief Position of the FEA equation in the solution solver array. */
 
 // CDriver class
 %include "../../SU2_CFD/include/drivers/CDriver.hpp"
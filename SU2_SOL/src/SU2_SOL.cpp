@@ -250,10 +250,59 @@ int main(int argc, char *argv[]) {
   if (rank == MASTER_NODE)
     cout << endl <<"------------------------- Solution Postprocessing -----------------------" << endl;
   
-  /*---  Check whether this is an FSI, fluid unsteady, harmonic balance or structural dynamic simulation and call the
-   solution merging routines accordingly.---*/
+  /*---  Check whether this is a batch conversion, an FSI, fluid unsteady, harmonic balance or structural dynamic
+   simulation and call the solution merging routines accordingly.---*/
 
-  if (multizone){
+  const vector<unsigned long>& BatchIter = config->GetSolution_Batch_Iter();
+
+  if (!BatchIter.empty()) {
+
+    /*--- Batch mode (SOLUTION_ITER_LIST/RANGE): the grid, the solvers and the output, with its sorted
+     connectivity and sort plan, are built once and the restart files are converted one after the other. ---*/
+
+    if (fsi || fem_solver || (config_container[ZONE_0]->GetTime_Marching() == HARMONIC_BALANCE))
+      SU2_MPI::Error("SOLUTION_ITER_LIST/RANGE only support finite volume problems (not FSI, DG-FEM or harmonic balance).",
+                     CURRENT_FUNCTION);
+
+    if (!(multizone ? driver_config : config_container[ZONE_0])->GetTime_Domain())
+      SU2_MPI::Error("SOLUTION_ITER_LIST/RANGE need TIME_DOMAIN= YES, the restart files are named by their time iteration.",
+                     CURRENT_FUNCTION);
+
+    /*--- Instantiate the solvers and the output of each zone from the first restart file. ---*/
+
+    for (iZone = 0; iZone < nZone; iZone++) {
+      config_container[iZone]->SetiInst(INST_0);
+      config_container[iZone]->SetTimeIter(BatchIter[0]);
+      solver_container[iZone][INST_0] = new CBaselineSolver(geometry_container[iZone][INST_0], config_container[iZone]);
+
+      output[iZone] = new CBaselineOutput(config_container[iZone], geometry_container[iZone][INST_0]->GetnDim(), solver_container[iZone][INST_0]);
+      output[iZone]->PreprocessVolumeOutput(config_container[iZone]);
+      output[iZone]->PreprocessHistoryOutput(config_container[iZone], false);
+    }
+
+    for (unsigned long iFile = 0; iFile < BatchIter.size(); iFile++) {
+
+      const unsigned long TimeIter = BatchIter[iFile];
+
+      if (rank == MASTER_NODE)
+        cout << "Writing the volume solution for time step " << TimeIter << " (" << iFile+1 << " of "
+             << BatchIter.size() << ")." << endl;
+
+      /*--- Load the restart of all the zones, the (dynamic) grid is updated from the file. ---*/
+
+      for (iZone = 0; iZone < nZone; iZone++) {
+        config_container[iZone]->SetTimeIter(TimeIter);
+        config_container[iZone]->SetiInst(INST_0);
+        solver_container[iZone][INST_0]->LoadRestart(geometry_container[iZone], &solver_container[iZone], config_container[iZone], TimeIter, true);
+      }
+
+      for (iZone = 0; iZone < nZone; iZone++) {
+        WriteFiles(config_container[iZone], geometry_container[iZone][INST_0], &solver_container[iZone][INST_0], output[iZone], TimeIter);
+      }
+    }
+
+  }
+  else if (multizone){
     
 
 
@@ -0,0 +1,237 @@
+#!/usr/bin/env python
+
+## \file benchmark.py
+#  \brief Python script for the performance benchmarks of SU2 (fixed number of iterations)
+#  \author SU2 Contributors
+#  \version 7.0.3 "Blackbird"
+#
+# SU2 Project Website: https://su2code.github.io
+#
+# The SU2 Project is maintained by the SU2 Foundation
+# (http://su2foundation.org)
+#
+# Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+#
+# SU2 is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# SU2 is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+
+from __future__ import print_function, division, absolute_import
+import os, sys, re, csv, glob, json, time, subprocess, datetime
+from optparse import OptionParser
+
+class BenchmarkCase:
+
+    def __init__(self, tag, cfg_dir, cfg_file, n_iter, iter_option="ITER", su2_exec="SU2_CFD"):
+        self.tag         = tag
+        self.cfg_dir     = cfg_dir
+        self.cfg_file    = cfg_file
+        self.n_iter      = n_iter
+        self.iter_option = iter_option
+        self.su2_exec    = su2_exec
+        self.timeout     = 3600
+
+    def write_config(self):
+        ''' Copy of the config that runs exactly n_iter iterations, with the timings and region profiling. '''
+
+        overrides = {self.iter_option    : str(self.n_iter),
+                     "CONV_RESIDUAL_MINVAL" : "-50",
+                     "CONV_CAUCHY_EPS"      : "1E-50",
+                     "CONV_STARTITER"       : str(self.n_iter+1),
+                     "WRT_PERFORMANCE"      : "YES",
+                     "REGION_PROFILING"     : "YES",
+                     "REGION_PROFILING_FILENAME" : "benchmark_profile",
+                     "CONV_FILENAME"        : "benchmark_history",
+                     "TABULAR_FORMAT"       : "CSV"}
+
+        lines = []
+        history_output = None
+        with open(self.cfg_file) as cfg:
+            for line in cfg:
+                key = line.split("=")[0].strip().upper() if "=" in line and not line.lstrip().startswith("%") else None
+                if key in overrides:
+                    continue
+                if key == "HISTORY_OUTPUT":
+                    history_output = line.split("=", 1)[1].strip().strip("()")
+                    continue
+                lines.append(line.rstrip("\n"))
+
+        # The linear solver iterations are only in the history if the LINSOL group is written.
+        history_output = history_output if history_output else "ITER, RMS_RES"
+        if "LINSOL" not in history_output:
+            history_output += ", LINSOL"
+
+        lines.append("% Benchmark settings")
+        for key in sorted(overrides):
+            lines.append("%s= %s" % (key, overrides[key]))
+        lines.append("HISTORY_OUTPUT= (%s)" % history_output)
+
+        self.bench_cfg = self.cfg_file + ".benchmark"
+        with open(self.bench_cfg, "w") as cfg:
+            cfg.write("\n".join(lines) + "\n")
+
+    def run(self, mpi_command, n_proc):
+        ''' Run the case, return the dictionary of results (None values for what was not found). '''
+
+        result = {"case": self.tag, "config": os.path.join(self.cfg_dir, self.cfg_file),
+                  "executable": self.su2_exec, "ranks": n_proc, "iterations": self.n_iter,
+                  "passed": False, "wall_time": None, "time_per_iter": None,
+                  "peak_memory_per_rank_mb": None, "peak_memory_mb": None,
+                  "linear_iterations": None, "regions": {}}
+
+        workdir = os.getcwd()
+        os.chdir(self.cfg_dir)
+        try:
+            for stale in glob.glob("benchmark_profile_*.csv") + glob.glob("benchmark_history*.csv"):
+                os.remove(stale)
+
+            self.write_config()
+
+            command = "%s %s" % (self.su2_exec, self.bench_cfg)
+            if n_proc > 1:
+                command = "%s -n %d %s" % (mpi_command, n_proc, command)
+            logfilename = "%s.benchmark.log" % os.path.splitext(self.cfg_file)[0]
+            command = "%s > %s 2>&1" % (command, logfilename)
+
+            print("%s: %s" % (self.tag, command))
+            sys.stdout.flush()
+
+            start = datetime.datetime.now()
+            process = subprocess.Popen(command, shell=True)
+            while process.poll() is None:
+                time.sleep(0.5)
+                if (datetime.datetime.now() - start).seconds > self.timeout:
+                    process.kill()
+                    print("ERROR: Execution timed out. timeout=%d" % self.timeout)
+                    break
+            result["wall_time"] = (datetime.datetime.now() - start).total_seconds()
+            result["passed"] = (process.returncode == 0)
+
+            self.parse_log(logfilename, result)
+            self.parse_profile(result)
+            self.parse_history(result)
+
+            os.remove(self.bench_cfg)
+        finally:
+            os.chdir(workdir)
+
+        return result
+
+    def parse_log(self, logfilename, result):
+        ''' Performance summary of the driver (WRT_PERFORMANCE). '''
+
+        if not os.path.isfile(logfilename):
+            return
+        patterns = {"time_per_iter"           : r"Avg\. s/iter:\s*([-+0-9.eE]+)",
+                    "peak_memory_per_rank_mb" : r"Peak memory/core \(MB\):\s*([-+0-9.eE]+)",
+                    "peak_memory_mb"          : r"Peak memory \(MB\):\s*([-+0-9.eE]+)"}
+        with open(logfilename) as log:
+            text = log.read()
+        for key in patterns:
+            match = re.findall(patterns[key], text)
+            if match:
+                result[key] = float(match[-1])
+
+    def parse_profile(self, result):
+        ''' Regions of the profiler of rank 0 (REGION_PROFILING). '''
+
+        if not os.path.isfile("benchmark_profile_0.csv"):
+            return
+        with open("benchmark_profile_0.csv") as profile:
+            for row in csv.DictReader(profile):
+                result["regions"][row["Region"]] = {"calls": int(row["Calls"]), "time": float(row["Time [s]"]),
+                                                    "max_time_per_call": float(row["Max time per call [s]"])}
+
+    def parse_history(self, result):
+        ''' Total number of linear solver iterations of the history, when the solver writes them. '''
+
+        files = sorted(glob.glob("benchmark_history*.csv"))
+        if not files:
+            return
+        with open(files[0]) as history:
+            reader = csv.reader(history)
+            header = [name.strip().strip('"') for name in next(reader, [])]
+            columns = [i for i, name in enumerate(header) if name in ("LinSolIter", "Linear_Solver_Iterations")]
+            if not columns:
+                return
+            total = 0
+            for row in reader:
+                for i in columns:
+                    try:
+                        total += int(float(row[i]))
+                    except (IndexError, ValueError):
+                        pass
+            result["linear_iterations"] = total
+
+def main():
+    '''This program runs a few representative cases for a fixed number of iterations (the convergence
+       criteria are disabled) and writes the time per iteration, the time of the profiled regions, the
+       linear solver iterations and the peak memory to a JSON file, to compare the performance of builds. '''
+
+    parser = OptionParser()
+    parser.add_option("-n", "--partitions", dest="partitions", default=1, type="int",
+                      help="number of MPI ranks", metavar="PARTITIONS")
+    parser.add_option("-m", "--mpi", dest="mpi", default="mpirun",
+                      help="MPI launcher", metavar="MPI")
+    parser.add_option("-o", "--output", dest="output", default="benchmark.json",
+                      help="JSON file of the results", metavar="OUTPUT")
+    parser.add_option("-c", "--cases", dest="cases", default="",
+                      help="comma separated tags of the cases to run (default all)", metavar="CASES")
+    (options, args) = parser.parse_args()
+
+    bench_list = []
+
+    # Compressible Euler, ONERA M6 (JST, implicit)
+    bench_list.append(BenchmarkCase("euler_oneram6", "euler/oneram6", "inv_ONERAM6.cfg", 20))
+
+    # Compressible Euler, CRM (JST, implicit, larger grid)
+    bench_list.append(BenchmarkCase("euler_crm", "euler/CRM", "inv_CRM_JST.cfg", 20))
+
+    # Compressible RANS, ONERA M6 (SA)
+    bench_list.append(BenchmarkCase("rans_oneram6", "rans/oneram6", "turb_ONERAM6.cfg", 20))
+
+    # Incompressible RANS, NACA0012
+    bench_list.append(BenchmarkCase("incomp_rans_naca0012", "incomp_rans/naca0012", "naca0012.cfg", 50))
+
+    # DG Navier-Stokes, unsteady cylinder (polynomial degree 4)
+    bench_list.append(BenchmarkCase("dg_ns_cylinder", "hom_navierstokes/UnsteadyCylinder/nPoly4",
+                                    "fem_unst_cylinder.cfg", 10, "TIME_ITER"))
+
+    # Nonlinear elasticity, 3D beam
+    bench_list.append(BenchmarkCase("fea_beam_3d", "fea_fsi/StatBeam_3d", "configBeam_3d.cfg", 5, "INNER_ITER"))
+
+    # Discrete adjoint RANS, NACA0012
+    bench_list.append(BenchmarkCase("disc_adj_rans_naca0012", "disc_adj_rans/naca0012", "turb_NACA0012_sa.cfg",
+                                    10, "ITER", "SU2_CFD_AD"))
+
+    if options.cases:
+        tags = [tag.strip() for tag in options.cases.split(",")]
+        bench_list = [case for case in bench_list if case.tag in tags]
+
+    results = [case.run(options.mpi, options.partitions) for case in bench_list]
+
+    with open(options.output, "w") as output:
+        json.dump({"date": datetime.datetime.now().isoformat(), "ranks": options.partitions,
+                   "cases": results}, output, indent=2, sort_keys=True)
+
+    print("\n%-26s %8s %14s %16s %12s" % ("Case", "Passed", "s/iter", "Peak mem. (MB)", "Lin. iter."))
+    for res in results:
+        print("%-26s %8s %14s %16s %12s" % (res["case"], res["passed"], res["time_per_iter"],
+                                            res["peak_memory_mb"], res["linear_iterations"]))
+    print("Results written to %s" % options.output)
+
+    if not all(res["passed"] for res in results):
+        sys.exit(1)
+
+# this is only accessed if running from command prompt
+if __name__ == '__main__':
+    main()